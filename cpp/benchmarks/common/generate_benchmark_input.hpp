@@ -6,8 +6,10 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <random>
+#include <string>
 #include <vector>
 
 /**
@@ -22,7 +24,8 @@
  * functions where they are used.
  *
  * Currently, the data generation is done on the CPU and the data is then copied to the device
- * memory.
+ * memory. `generate_input.hpp` generates large tables on the GPU instead, with per-column control
+ * of the cardinality, skew, runs and nulls of the data.
  */
 
 /**
@@ -30,7 +33,7 @@
  *
  * Produces the same random sequence on each run.
  */
-auto& deterministic_engine()
+inline auto& deterministic_engine()
 {
   static unsigned seed = 13377331;
   static std::mt19937 engine{seed};
@@ -138,7 +141,7 @@ T random_element()
  * @return The random boolean value
  */
 template <>
-bool random_element<bool>()
+inline bool random_element<bool>()
 {
   static std::uniform_int_distribution<> uniform{0, 1};
   return uniform(deterministic_engine()) == 1;
@@ -195,8 +198,8 @@ std::unique_ptr<cudf::column> create_random_column(cudf::size_type col_bytes, bo
  * @return Column filled with random data
  */
 template <>
-std::unique_ptr<cudf::column> create_random_column<std::string>(cudf::size_type col_bytes,
-                                                                bool include_validity)
+inline std::unique_ptr<cudf::column> create_random_column<std::string>(cudf::size_type col_bytes,
+                                                                       bool include_validity)
 {
   // TODO: have some elements be null?
 
@@ -245,4 +248,149 @@ std::unique_ptr<cudf::table> create_random_table(cudf::size_type num_columns,
   }());
 }
 
+/**
+ * @brief Distribution of the data generated by the `data_profile` overloads
+ *
+ * The defaults generate independent rows, 1% of them null, and strings of 16 characters on
+ * average.
+ */
+struct data_profile {
+  /// Probability for each row to be null; 0 generates a column without a null mask
+  double null_probability = 0.01;
+  /// Number of distinct values of the column; 0 draws every row independently
+  cudf::size_type cardinality = 0;
+  /// Mean of the Poisson distribution of the string lengths
+  int32_t avg_string_length = 16;
+  /// Longest generated string; longer strings are truncated
+  int32_t max_string_length = 64;
+  /// Probability for a character of a string to be a space, which controls the word lengths
+  double space_probability = 0.15;
+};
+
+/**
+ * @brief Creates a random string
+ *
+ * The characters are lowercase letters, digits (one in ten of the non-space characters) and
+ * spaces.
+ */
+inline std::string random_string(data_profile const& profile)
+{
+  std::poisson_distribution<int32_t> length_dist(profile.avg_string_length);
+  std::bernoulli_distribution space_dist(profile.space_probability);
+  std::uniform_int_distribution<int32_t> char_dist(0, 259);
+
+  auto const length = std::min(length_dist(deterministic_engine()), profile.max_string_length);
+  std::string str(length, ' ');
+  for (auto& chr : str) {
+    if (space_dist(deterministic_engine())) { continue; }
+    auto const c = char_dist(deterministic_engine());
+    chr          = c < 26 ? '0' + c % 10 : 'a' + c % 26;
+  }
+  return str;
+}
+
+/**
+ * @brief Creates `num_rows` random values with the cardinality of the profile
+ */
+template <typename T>
+std::vector<T> random_values(data_profile const& profile, cudf::size_type num_rows)
+{
+  auto generate = []() { return random_element<T>(); };
+  std::vector<T> pool;
+  std::generate_n(std::back_inserter(pool), profile.cardinality, generate);
+  std::uniform_int_distribution<cudf::size_type> pool_dist(0, std::max(profile.cardinality, 1) - 1);
+
+  std::vector<T> values;
+  values.reserve(num_rows);
+  std::generate_n(std::back_inserter(values), num_rows, [&]() {
+    return pool.empty() ? generate() : pool[pool_dist(deterministic_engine())];
+  });
+  return values;
+}
+
+template <>
+inline std::vector<std::string> random_values<std::string>(data_profile const& profile,
+                                                           cudf::size_type num_rows)
+{
+  std::vector<std::string> pool;
+  std::generate_n(std::back_inserter(pool), profile.cardinality, [&profile]() {
+    return random_string(profile);
+  });
+  std::uniform_int_distribution<cudf::size_type> pool_dist(0, std::max(profile.cardinality, 1) - 1);
+
+  std::vector<std::string> values;
+  values.reserve(num_rows);
+  std::generate_n(std::back_inserter(values), num_rows, [&]() {
+    return pool.empty() ? random_string(profile) : pool[pool_dist(deterministic_engine())];
+  });
+  return values;
+}
+
+/**
+ * @brief Creates the validity of `num_rows` rows with the null probability of the profile
+ */
+inline std::vector<bool> random_validity(data_profile const& profile, cudf::size_type num_rows)
+{
+  std::bernoulli_distribution null_dist(profile.null_probability);
+  std::vector<bool> valids(num_rows);
+  std::generate(
+    valids.begin(), valids.end(), [&]() { return not null_dist(deterministic_engine()); });
+  return valids;
+}
+
+/**
+ * @brief Creates a column of `num_rows` rows of the given type with the distribution of a profile
+ *
+ * @param[in] profile Distribution of the generated data
+ * @param[in] num_rows Number of rows of the column
+ *
+ * @return Column filled with random data
+ */
+template <typename T>
+std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
+                                                   cudf::size_type num_rows)
+{
+  auto const values = random_values<T>(profile, num_rows);
+  if (profile.null_probability == 0) {
+    return cudf::test::fixed_width_column_wrapper<T>(values.begin(), values.end()).release();
+  }
+  auto const valids = random_validity(profile, num_rows);
+  return cudf::test::fixed_width_column_wrapper<T>(values.begin(), values.end(), valids.begin())
+    .release();
+}
+
+template <>
+inline std::unique_ptr<cudf::column> create_random_column<std::string>(
+  data_profile const& profile, cudf::size_type num_rows)
+{
+  auto const values = random_values<std::string>(profile, num_rows);
+  if (profile.null_probability == 0) {
+    return cudf::test::strings_column_wrapper(values.begin(), values.end()).release();
+  }
+  auto const valids = random_validity(profile, num_rows);
+  return cudf::test::strings_column_wrapper(values.begin(), values.end(), valids.begin()).release();
+}
+
+/**
+ * @brief Creates a table of `num_columns` columns of the given type with the distribution of a
+ * profile
+ *
+ * @param[in] profile Distribution of the generated data
+ * @param[in] num_columns Number of columns in the table
+ * @param[in] num_rows Number of rows of each column
+ *
+ * @return Table filled with random data
+ */
+template <typename T>
+std::unique_ptr<cudf::table> create_random_table(data_profile const& profile,
+                                                 cudf::size_type num_columns,
+                                                 cudf::size_type num_rows)
+{
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  std::generate_n(std::back_inserter(columns), num_columns, [&]() {
+    return create_random_column<T>(profile, num_rows);
+  });
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
 // TODO: create random mixed table
@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "generate_input.hpp"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_vector.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ratio>
+
+namespace {
+// Seeds of the independent random streams of a column
+constexpr uint64_t run_stream       = 1;
+constexpr uint64_t value_stream     = 2;
+constexpr uint64_t null_run_stream  = 3;
+constexpr uint64_t null_stream      = 4;
+constexpr uint64_t length_stream    = 5;
+constexpr uint64_t character_stream = 6;
+constexpr uint64_t jitter_stream    = 7;
+
+/**
+ * @brief Bijective 64-bit mixing function (the finalizer of SplitMix64)
+ */
+__host__ __device__ inline uint64_t mix64(uint64_t x)
+{
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+/**
+ * @brief Counter-based random generator: the `counter`-th element of the `stream` of a seed
+ */
+struct random_stream {
+  uint64_t seed;
+
+  __device__ uint64_t bits(uint64_t stream, uint64_t counter) const
+  {
+    return mix64(seed ^ mix64(stream * 0x9e3779b97f4a7c15ull + counter));
+  }
+
+  /// Uniform in [0, 1)
+  __device__ double uniform(uint64_t stream, uint64_t counter) const
+  {
+    return (bits(stream, counter) >> 11) * (1.0 / 9007199254740992.0);
+  }
+};
+
+/**
+ * @brief Samples a value in `[lower, upper]` from a distribution
+ */
+struct range_sampler {
+  distribution_id id;
+  double lower;
+  double upper;
+
+  __device__ double operator()(random_stream rng, uint64_t stream, uint64_t counter) const
+  {
+    auto const range = upper - lower;
+    double value     = lower;
+    switch (id) {
+      case distribution_id::UNIFORM:
+        value = lower + rng.uniform(stream, counter) * (range + 1);
+        break;
+      case distribution_id::NORMAL: {
+        // Box-Muller transform of two uniform values
+        auto const u1 = rng.uniform(stream, 2 * counter) + 1e-12;
+        auto const u2 = rng.uniform(stream, 2 * counter + 1);
+        auto const z  = sqrt(-2.0 * log(u1)) * cos(2.0 * 3.141592653589793 * u2);
+        value         = lower + range / 2 + z * range / 6;
+        break;
+      }
+      case distribution_id::GEOMETRIC: {
+        auto const p = 1.0 / (1.0 + range / 4);
+        value        = lower + floor(log(1.0 - rng.uniform(stream, counter)) / log(1.0 - p));
+        break;
+      }
+    }
+    return fmin(fmax(value, lower), upper);
+  }
+};
+
+/**
+ * @brief Returns the index of the distinct value of each row of a column
+ *
+ * Runs of equal values start at each row with probability `1 / avg_run_length`; the value of
+ * each run is drawn from the Zipf distribution of the profile.
+ */
+rmm::device_vector<cudf::size_type> value_indices(column_profile const& profile,
+                                                  cudf::size_type num_rows,
+                                                  random_stream rng,
+                                                  cudf::size_type cardinality,
+                                                  cudaStream_t stream)
+{
+  auto policy = rmm::exec_policy(stream);
+  rmm::device_vector<cudf::size_type> run_ids(num_rows);
+  auto const run_start_probability = 1.0 / std::max(profile.avg_run_length, 1.0);
+  auto run_starts                  = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    [rng, run_start_probability] __device__(cudf::size_type row) {
+      return (row == 0 || rng.uniform(run_stream, row) < run_start_probability) ? 1 : 0;
+    });
+  thrust::inclusive_scan(policy->on(stream), run_starts, run_starts + num_rows, run_ids.begin());
+
+  rmm::device_vector<cudf::size_type> indices(num_rows);
+  if (profile.zipf_exponent <= 0) {
+    thrust::transform(policy->on(stream),
+                      run_ids.begin(),
+                      run_ids.end(),
+                      indices.begin(),
+                      [rng, cardinality] __device__(cudf::size_type run) {
+                        auto const index = static_cast<cudf::size_type>(
+                          rng.uniform(value_stream, run) * cardinality);
+                        return min(index, cardinality - 1);
+                      });
+    return indices;
+  }
+
+  // Inverse transform sampling of the cumulative Zipf weights
+  rmm::device_vector<double> cdf(cardinality);
+  auto const exponent = profile.zipf_exponent;
+  auto weights        = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    [exponent] __device__(cudf::size_type rank) { return pow(rank + 1.0, -exponent); });
+  thrust::inclusive_scan(policy->on(stream), weights, weights + cardinality, cdf.begin());
+  double const total = cdf.back();
+  auto targets       = thrust::make_transform_iterator(
+    run_ids.begin(), [rng, total] __device__(cudf::size_type run) {
+      return rng.uniform(value_stream, run) * total;
+    });
+  thrust::upper_bound(
+    policy->on(stream), cdf.begin(), cdf.end(), targets, targets + num_rows, indices.begin());
+  thrust::transform(policy->on(stream),
+                    indices.begin(),
+                    indices.end(),
+                    indices.begin(),
+                    [cardinality] __device__(cudf::size_type index) {
+                      return min(index, cardinality - 1);
+                    });
+  return indices;
+}
+
+/**
+ * @brief Returns the null mask and the null count of a column
+ *
+ * Runs of equal validity start at each row with probability `1 / avg_null_run_length`; each run
+ * is null with probability `null_probability`.
+ */
+std::pair<rmm::device_buffer, cudf::size_type> null_mask(column_profile const& profile,
+                                                         cudf::size_type num_rows,
+                                                         random_stream rng,
+                                                         cudaStream_t stream)
+{
+  if (profile.null_probability <= 0) { return {rmm::device_buffer{}, 0}; }
+  rmm::device_vector<cudf::size_type> run_ids(num_rows);
+  auto const run_start_probability = 1.0 / std::max(profile.avg_null_run_length, 1.0);
+  auto run_starts                  = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    [rng, run_start_probability] __device__(cudf::size_type row) {
+      return (row == 0 || rng.uniform(null_run_stream, row) < run_start_probability) ? 1 : 0;
+    });
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream)->on(stream), run_starts, run_starts + num_rows, run_ids.begin());
+  auto const null_probability = profile.null_probability;
+  return cudf::detail::valid_if(
+    run_ids.begin(),
+    run_ids.end(),
+    [rng, null_probability] __device__(cudf::size_type run) {
+      return rng.uniform(null_stream, run) >= null_probability;
+    },
+    stream);
+}
+
+/**
+ * @brief Default range of the values of timestamps and durations: until June 2020
+ */
+template <typename T, std::enable_if_t<cudf::is_chrono<T>()>* = nullptr>
+std::pair<double, double> default_range()
+{
+  using ratio = std::ratio_divide<std::ratio<1>, typename T::period>;
+  return {0, 1591053936.0 * ratio::num / ratio::den};
+}
+
+/**
+ * @brief Default range of the values of numeric types
+ *
+ * The range of the 64-bit integers is halved, so that the largest value converts to the type.
+ */
+template <typename T, std::enable_if_t<cudf::is_numeric<T>()>* = nullptr>
+std::pair<double, double> default_range()
+{
+  if (std::is_floating_point<T>::value) { return {-1e6, 1e6}; }
+  auto const scale = sizeof(T) >= sizeof(int64_t) ? 0.5 : 1.0;
+  return {scale * std::numeric_limits<T>::lowest(), scale * std::numeric_limits<T>::max()};
+}
+
+template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+__device__ T make_element(double value)
+{
+  return T{typename T::duration{static_cast<typename T::rep>(value)}};
+}
+
+template <typename T, std::enable_if_t<cudf::is_duration<T>()>* = nullptr>
+__device__ T make_element(double value)
+{
+  return T{static_cast<typename T::rep>(value)};
+}
+
+template <typename T, std::enable_if_t<cudf::is_numeric<T>()>* = nullptr>
+__device__ T make_element(double value)
+{
+  return static_cast<T>(value);
+}
+
+/**
+ * @brief Returns `a` such that `index -> index * a % n` is a permutation of `[0, n)`
+ */
+uint64_t permutation_multiplier(uint64_t n)
+{
+  auto gcd = [](uint64_t a, uint64_t b) {
+    while (b != 0) {
+      auto const r = a % b;
+      a            = b;
+      b            = r;
+    }
+    return a;
+  };
+  uint64_t multiplier = 2654435761ull % std::max(n, uint64_t{1});
+  while (n > 1 && gcd(multiplier, n) != 1) { ++multiplier; }
+  return std::max(multiplier, uint64_t{1});
+}
+
+/**
+ * @brief Creates a column of the type of a profile
+ *
+ * The seed selects the distinct value of each row and the nulls; the distinct values themselves
+ * only depend on the profile.
+ */
+struct create_column_fn {
+  column_profile const& profile;
+  cudf::size_type num_rows;
+  random_stream rng;
+  cudaStream_t stream;
+
+  cudf::size_type cardinality() const
+  {
+    return profile.cardinality > 0 ? std::min(profile.cardinality, num_rows) : num_rows;
+  }
+
+  /**
+   * The distinct values are spread evenly over the range in a random order: value `i` lies in the
+   * `permutation(i)`-th of `cardinality` equal slices of the range.
+   */
+  template <typename T,
+            std::enable_if_t<cudf::is_numeric<T>() or cudf::is_chrono<T>()>* = nullptr>
+  std::unique_ptr<cudf::column> operator()()
+  {
+    auto const num_values = cardinality();
+    auto const indices    = value_indices(profile, num_rows, rng, num_values, stream);
+    auto mask             = null_mask(profile, num_rows, rng, stream);
+
+    auto range = default_range<T>();
+    if (profile.lower_bound != 0 || profile.upper_bound != 0) {
+      range = {profile.lower_bound, profile.upper_bound};
+    }
+    CUDF_EXPECTS(range.first <= range.second, "Invalid value range");
+
+    auto result = cudf::make_fixed_width_column(
+      profile.type, num_rows, std::move(mask.first), mask.second, stream);
+    auto const multiplier = permutation_multiplier(num_values);
+    auto const lower      = range.first;
+    auto const slice      = (range.second - range.first) / num_values;
+    auto const integral   = std::is_integral<T>::value || cudf::is_chrono<T>();
+    auto const boolean    = std::is_same<T, bool>::value;
+    auto d_indices        = indices.data().get();
+    auto const value_rng  = random_stream{0};
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<cudf::size_type>(0),
+                      thrust::make_counting_iterator<cudf::size_type>(num_rows),
+                      result->mutable_view().template begin<T>(),
+                      [=] __device__(cudf::size_type row) {
+                        auto const index = static_cast<uint64_t>(d_indices[row]);
+                        auto const slot  = index * multiplier % num_values;
+                        if (boolean) { return make_element<T>(slot % 2); }
+                        auto value =
+                          lower + (slot + value_rng.uniform(jitter_stream, index)) * slice;
+                        if (integral) { value = floor(value); }
+                        return make_element<T>(value);
+                      });
+    return result;
+  }
+
+  /**
+   * Each distinct value is a string of random characters whose length is drawn from the length
+   * distribution of the profile.
+   */
+  template <typename T, std::enable_if_t<std::is_same<T, cudf::string_view>::value>* = nullptr>
+  std::unique_ptr<cudf::column> operator()()
+  {
+    CUDF_EXPECTS(profile.min_length >= 0 && profile.min_length <= profile.max_length,
+                 "Invalid string length range");
+    auto const indices = value_indices(profile, num_rows, rng, cardinality(), stream);
+    auto mask          = null_mask(profile, num_rows, rng, stream);
+    auto d_indices     = indices.data().get();
+    auto d_mask        = static_cast<cudf::bitmask_type const*>(mask.first.data());
+
+    range_sampler const lengths{profile.length_distribution,
+                                static_cast<double>(profile.min_length),
+                                static_cast<double>(profile.max_length)};
+    auto const value_rng = random_stream{0};
+    auto row_lengths     = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<cudf::size_type>(0),
+      [=] __device__(cudf::size_type row) {
+        if (d_mask != nullptr && !cudf::bit_is_set(d_mask, row)) { return cudf::size_type{0}; }
+        return static_cast<cudf::size_type>(lengths(value_rng, length_stream, d_indices[row]));
+      });
+    auto offsets = cudf::strings::detail::make_offsets_child_column(
+      row_lengths, row_lengths + num_rows, rmm::mr::get_default_resource(), stream);
+    auto d_offsets = offsets->view().template data<int32_t>();
+
+    cudf::size_type const bytes = thrust::device_pointer_cast(d_offsets)[num_rows];
+    auto chars                  = cudf::strings::detail::create_chars_child_column(
+      num_rows, mask.second, bytes, rmm::mr::get_default_resource(), stream);
+    auto d_chars                = chars->mutable_view().template data<char>();
+    auto const space_threshold  = static_cast<uint64_t>(profile.space_probability * 256);
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<cudf::size_type>(0),
+      num_rows,
+      [=] __device__(cudf::size_type row) {
+        auto const index = static_cast<uint64_t>(d_indices[row]) << 32;
+        for (auto i = d_offsets[row]; i < d_offsets[row + 1]; ++i) {
+          auto const bits = value_rng.bits(character_stream, index + i - d_offsets[row]);
+          // One in ten of the other characters is a digit
+          auto const c = static_cast<uint32_t>((bits >> 8) % 260);
+          if ((bits & 0xff) < space_threshold) {
+            d_chars[i] = ' ';
+          } else {
+            d_chars[i] = static_cast<char>(c < 26 ? '0' + c % 10 : 'a' + c % 26);
+          }
+        }
+      });
+
+    return cudf::make_strings_column(num_rows,
+                                     std::move(offsets),
+                                     std::move(chars),
+                                     mask.second,
+                                     std::move(mask.first),
+                                     stream);
+  }
+
+  template <typename T,
+            std::enable_if_t<not cudf::is_numeric<T>() and not cudf::is_chrono<T>() and
+                             not std::is_same<T, cudf::string_view>::value>* = nullptr>
+  std::unique_ptr<cudf::column> operator()()
+  {
+    CUDF_FAIL("Unsupported type for the benchmark data generator");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> create_random_column(column_profile const& profile,
+                                                   cudf::size_type num_rows,
+                                                   uint64_t seed)
+{
+  CUDF_EXPECTS(num_rows > 0, "The generated column must have at least one row");
+  return cudf::type_dispatcher(profile.type,
+                               create_column_fn{profile, num_rows, random_stream{mix64(seed)}, 0});
+}
+
+std::unique_ptr<cudf::table> create_random_table(std::vector<column_profile> const& profiles,
+                                                 cudf::size_type num_rows,
+                                                 uint64_t seed)
+{
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (size_t i = 0; i < profiles.size(); ++i) {
+    columns.push_back(create_random_column(profiles[i], num_rows, seed + i));
+  }
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+cudf::size_type rows_for_size(std::vector<column_profile> const& profiles, int64_t size_bytes)
+{
+  double row_bytes = 0;
+  for (auto const& profile : profiles) {
+    row_bytes += (profile.type.id() == cudf::type_id::STRING)
+                   ? (profile.min_length + profile.max_length) / 2.0 + sizeof(cudf::size_type)
+                   : cudf::size_of(profile.type);
+  }
+  return static_cast<cudf::size_type>(size_bytes / std::max(row_bytes, 1.0));
+}
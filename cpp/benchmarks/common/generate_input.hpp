@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <vector>
+
+/**
+ * @file generate_input.hpp
+ * @brief GPU generator of benchmark tables with per-column distribution profiles
+ *
+ * Unlike the host generator of `generate_benchmark_input.hpp`, which draws every row
+ * independently, this generator controls the properties of the data that change the behaviour of
+ * libcudf: the number of distinct values (dictionary encoding, hash table sizes), the skew of
+ * their frequencies (hash table contention), runs of equal values (run-length encoding), nulls and
+ * runs of nulls, and the distribution of the string lengths (warp divergence). All data is
+ * generated on the device with a counter-based hash, so multi-GB tables are created in
+ * milliseconds and the same seed always generates the same table.
+ */
+
+/**
+ * @brief Distribution of a random quantity over a range `[lower, upper]`
+ */
+enum class distribution_id : int8_t {
+  UNIFORM,    ///< Every value is equally likely
+  NORMAL,     ///< Centered in the range, with a standard deviation of a sixth of the range
+  GEOMETRIC,  ///< Decreasing from `lower`, with a mean at a quarter of the range
+};
+
+/**
+ * @brief Distribution of the data of one generated column
+ *
+ * Each row holds one of `cardinality` distinct values. The frequencies of the values follow a
+ * Zipf distribution of exponent `zipf_exponent`, which is uniform for an exponent of 0 and
+ * increasingly concentrated on a few values as the exponent grows. Rows form runs of equal values
+ * of geometrically distributed lengths, independently of the runs of nulls.
+ *
+ * The distinct values only depend on the profile, not on the seed: columns generated from the same
+ * profile with different seeds draw from the same values, like the keys of two tables to join.
+ */
+struct column_profile {
+  cudf::data_type type{cudf::type_id::INT32};  ///< Column type; fixed-width or STRING
+
+  /// Number of distinct values, at most the number of rows; 0 gives every row its own value
+  cudf::size_type cardinality = 0;
+  /// Exponent of the Zipf distribution of the value frequencies; 0 for uniform frequencies
+  double zipf_exponent = 0;
+  /// Average length of the runs of equal consecutive values; 1 draws every row independently
+  double avg_run_length = 1;
+
+  /// Probability for each row to be null; 0 generates a column without a null mask
+  double null_probability = 0.01;
+  /// Average length of the runs of consecutive nulls and of the runs between them
+  double avg_null_run_length = 1;
+
+  /// Range of the values of numeric, timestamp and duration columns, in the units of the type;
+  /// if both are 0, a range suited to the type is used
+  double lower_bound = 0;
+  double upper_bound = 0;
+
+  /// Distribution and range of the lengths of the strings, in bytes
+  distribution_id length_distribution = distribution_id::NORMAL;
+  cudf::size_type min_length          = 0;
+  cudf::size_type max_length          = 32;
+  /// Probability for a character of a string to be a space, which controls the word lengths
+  double space_probability = 0.15;
+
+  column_profile() = default;
+  explicit column_profile(cudf::type_id id) : type{id} {}
+};
+
+/**
+ * @brief Creates a column of random data on the device
+ *
+ * @param profile Distribution of the data
+ * @param num_rows Number of rows
+ * @param seed Seed of the random data; columns of different seeds are independent
+ * @return The generated column
+ */
+std::unique_ptr<cudf::column> create_random_column(column_profile const& profile,
+                                                   cudf::size_type num_rows,
+                                                   uint64_t seed = 0);
+
+/**
+ * @brief Creates a table of random data on the device, with one profile per column
+ *
+ * @param profiles Distribution of the data of each column
+ * @param num_rows Number of rows
+ * @param seed Seed of the random data; column `i` uses `seed + i`
+ * @return The generated table
+ */
+std::unique_ptr<cudf::table> create_random_table(std::vector<column_profile> const& profiles,
+                                                 cudf::size_type num_rows,
+                                                 uint64_t seed = 0);
+
+/**
+ * @brief Returns the number of rows of `profiles.size()` columns that take about `size_bytes`
+ *
+ * Strings are counted with their average length and their offset.
+ */
+cudf::size_type rows_for_size(std::vector<column_profile> const& profiles, int64_t size_bytes);
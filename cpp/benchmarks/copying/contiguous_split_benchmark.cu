@@ -164,6 +164,11 @@ CSBM_BENCHMARK_DEFINE(1Gb512ColsValidity, (int64_t)1 * 1024 * 1024 * 1024, 512,
 CSBM_BENCHMARK_DEFINE(1Gb10ColsNoValidity, (int64_t)1 * 1024 * 1024 * 1024, 10, 256, 0);
 CSBM_BENCHMARK_DEFINE(1Gb10ColsValidity, (int64_t)1 * 1024 * 1024 * 1024, 10, 256, 1);
 
+// many small partitions, as produced by a hash-partitioned shuffle
+CSBM_BENCHMARK_DEFINE(1Gb10Cols4096SplitsNoValidity, (int64_t)1 * 1024 * 1024 * 1024, 10, 4096, 0);
+CSBM_BENCHMARK_DEFINE(1Gb10Cols4096SplitsValidity, (int64_t)1 * 1024 * 1024 * 1024, 10, 4096, 1);
+CSBM_BENCHMARK_DEFINE(256Mb512Cols4096Splits, (int64_t)256 * 1024 * 1024, 512, 4096, 1);
+
 #define CSBM_STRINGS_BENCHMARK_DEFINE(name, size, num_columns, num_splits, validity) \
   BENCHMARK_DEFINE_F(ContiguousSplitStrings, name)(::benchmark::State & state)       \
   {                                                                                  \
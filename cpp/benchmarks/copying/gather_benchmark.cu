@@ -35,14 +35,14 @@
 class Gather : public cudf::benchmark {
 };
 
-template <class TypeParam, bool coalesce>
+template <class TypeParam, bool coalesce, bool nullable>
 void BM_gather(benchmark::State& state)
 {
   const cudf::size_type source_size{(cudf::size_type)state.range(0)};
   const cudf::size_type n_cols = (cudf::size_type)state.range(1);
 
-  // Every element is valid
-  auto data = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto data     = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 4; });
 
   // Gather indices
   std::vector<cudf::size_type> host_map_data(source_size);
@@ -61,7 +61,9 @@ void BM_gather(benchmark::State& state)
   std::vector<cudf::column_view> source_columns(n_cols);
 
   std::generate_n(std::back_inserter(source_column_wrappers), n_cols, [=]() {
-    return cudf::test::fixed_width_column_wrapper<TypeParam>(data, data + source_size);
+    return nullable
+             ? cudf::test::fixed_width_column_wrapper<TypeParam>(data, data + source_size, validity)
+             : cudf::test::fixed_width_column_wrapper<TypeParam>(data, data + source_size);
   });
   std::transform(source_column_wrappers.begin(),
                  source_column_wrappers.end(),
@@ -78,15 +80,30 @@ void BM_gather(benchmark::State& state)
   state.SetBytesProcessed(state.iterations() * state.range(0) * n_cols * 2 * sizeof(TypeParam));
 }
 
-#define GBM_BENCHMARK_DEFINE(name, type, coalesce)             \
+#define GBM_BENCHMARK_DEFINE(name, type, coalesce, nullable)   \
   BENCHMARK_DEFINE_F(Gather, name)(::benchmark::State & state) \
   {                                                            \
-    BM_gather<type, coalesce>(state);                          \
+    BM_gather<type, coalesce, nullable>(state);                \
   }                                                            \
   BENCHMARK_REGISTER_F(Gather, name)                           \
     ->RangeMultiplier(2)                                       \
     ->Ranges({{1 << 10, 1 << 26}, {1, 8}})                     \
     ->UseManualTime();
 
-GBM_BENCHMARK_DEFINE(double_coalesce_x, double, true);
-GBM_BENCHMARK_DEFINE(double_coalesce_o, double, false);
+// Wide tables, where the gather map is loaded once for all the columns
+#define GBM_WIDE_BENCHMARK_DEFINE(name, type, coalesce, nullable) \
+  BENCHMARK_DEFINE_F(Gather, name)(::benchmark::State & state)    \
+  {                                                               \
+    BM_gather<type, coalesce, nullable>(state);                   \
+  }                                                               \
+  BENCHMARK_REGISTER_F(Gather, name)                              \
+    ->RangeMultiplier(4)                                          \
+    ->Ranges({{1 << 16, 1 << 22}, {16, 256}})                     \
+    ->UseManualTime();
+
+GBM_BENCHMARK_DEFINE(double_coalesce_x, double, true, false);
+GBM_BENCHMARK_DEFINE(double_coalesce_o, double, false, false);
+GBM_BENCHMARK_DEFINE(double_coalesce_x_nulls, double, true, true);
+GBM_BENCHMARK_DEFINE(double_coalesce_o_nulls, double, false, true);
+GBM_WIDE_BENCHMARK_DEFINE(int32_wide_coalesce_o, int32_t, false, false);
+GBM_WIDE_BENCHMARK_DEFINE(int32_wide_coalesce_o_nulls, int32_t, false, true);
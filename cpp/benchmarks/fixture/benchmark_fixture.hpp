@@ -14,11 +14,90 @@
  * limitations under the License.
  */
 
+#pragma once
+
 #include <benchmark/benchmark.h>
+#include <benchmarks/fixture/memory_tracking_resource.hpp>
+#include <cudf/detail/utilities/launch_config.hpp>
 #include "rmm/mr/device/cnmem_memory_resource.hpp"
 #include "rmm/mr/device/default_memory_resource.hpp"
 
+#include <cuda_runtime.h>
+
+#include <memory>
+
 namespace cudf {
+/**
+ * @brief Returns the theoretical peak memory bandwidth of the current device in bytes per second
+ */
+inline double device_peak_bandwidth()
+{
+  static double const peak = []() {
+    int device{};
+    cudaGetDevice(&device);
+    cudaDeviceProp props{};
+    cudaGetDeviceProperties(&props, device);
+    // Double data rate: two transfers of the bus width per memory clock (in kHz)
+    return 2.0 * props.memoryClockRate * 1000.0 * (props.memoryBusWidth / 8);
+  }();
+  return peak;
+}
+
+/**
+ * @brief Installs a pooled, tracked default memory resource for the lifetime of the object
+ *
+ * The pool eliminates the allocation overhead from the measurements, and the tracking adaptor on
+ * top of it records the peak memory usage of the benchmark.
+ */
+class benchmark_memory_resource {
+ public:
+  benchmark_memory_resource() : _tracker(&_pool) { rmm::mr::set_default_resource(&_tracker); }
+
+  ~benchmark_memory_resource()
+  {
+    rmm::mr::set_default_resource(nullptr);  // reset default resource to the initial resource
+  }
+
+  memory_tracking_resource& tracker() { return _tracker; }
+
+ private:
+  rmm::mr::cnmem_memory_resource _pool;
+  memory_tracking_resource _tracker;
+};
+
+/**
+ * @brief Returns the tracking resource installed by the benchmark fixture, or nullptr
+ */
+inline memory_tracking_resource* current_memory_tracker()
+{
+  return dynamic_cast<memory_tracking_resource*>(rmm::mr::get_default_resource());
+}
+
+/**
+ * @brief Adds the memory counters shared by all benchmarks to a finished run
+ *
+ * - `peak_memory_usage`: largest number of bytes allocated at once through the tracker;
+ * - `percent_of_peak_bw`: if the benchmark called `SetBytesProcessed()`, the achieved
+ *   `bytes_per_second` as a percentage of the theoretical bandwidth of the device.
+ *
+ * The counters are written to the console and to the JSON output of `--benchmark_out`.
+ *
+ * @param state State of the finished run
+ * @param tracker Tracking resource the run allocated from
+ */
+inline void report_memory_counters(::benchmark::State& state,
+                                   memory_tracking_resource const& tracker)
+{
+  state.counters["peak_memory_usage"] = ::benchmark::Counter(
+    tracker.peak_bytes(), ::benchmark::Counter::kDefaults, ::benchmark::Counter::kIs1024);
+  auto const bytes = state.counters.find("bytes_per_second");
+  if (bytes != state.counters.end()) {
+    // A rate counter is divided by the elapsed time, which turns bytes into bandwidth
+    state.counters["percent_of_peak_bw"] = ::benchmark::Counter(
+      100.0 * bytes->second.value / device_peak_bandwidth(), ::benchmark::Counter::kIsRate);
+  }
+}
+
 /**
  * @brief Google Benchmark fixture for libcudf benchmarks
  *
@@ -29,7 +108,10 @@ namespace cudf {
  *
  * The SetUp and TearDown methods of this fixture initialize RMM into pool mode
  * and finalize it, respectively. These methods are called automatically by
- * Google Benchmark
+ * Google Benchmark. The pool is wrapped in a `memory_tracking_resource`, and
+ * TearDown adds the counters of `report_memory_counters()` to every run. When
+ * `LIBCUDF_LAUNCH_CONFIG_TUNE` is set, TearDown also writes the tuned launch
+ * configuration (see `cudf/detail/utilities/launch_config.hpp`).
  *
  * Example:
  *
@@ -54,22 +136,21 @@ class benchmark : public ::benchmark::Fixture {
  public:
   virtual void SetUp(const ::benchmark::State& state)
   {
-    auto mr = new rmm::mr::cnmem_memory_resource;
-    rmm::mr::set_default_resource(mr);  // set default resource to cnmem
+    memory_resource = std::make_unique<benchmark_memory_resource>();
   }
 
-  virtual void TearDown(const ::benchmark::State& state)
-  {
-    delete rmm::mr::get_default_resource();
-    rmm::mr::set_default_resource(nullptr);  // reset default resource to the initial resource
-  }
+  virtual void TearDown(const ::benchmark::State& state) { memory_resource.reset(); }
 
   // eliminate partial override warnings (see benchmark/benchmark.h)
   virtual void SetUp(::benchmark::State& st) { SetUp(const_cast<const ::benchmark::State&>(st)); }
   virtual void TearDown(::benchmark::State& st)
   {
+    if (memory_resource != nullptr) { report_memory_counters(st, memory_resource->tracker()); }
+    cudf::detail::write_tuned_launch_configs();
     TearDown(const_cast<const ::benchmark::State&>(st));
   }
+
+  std::unique_ptr<benchmark_memory_resource> memory_resource;
 };
 
 };  // namespace cudf
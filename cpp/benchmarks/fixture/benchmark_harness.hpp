@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file benchmark_harness.hpp
+ * @brief Parameter sweeps shared by the libcudf benchmarks
+ *
+ * A benchmark declares its parameters as named axes; every combination of the axis values becomes
+ * one run, named after the axes (`name<type>/size:1024/columns:4`) so that the runs of two builds
+ * can be matched by `scripts/compare_benchmarks.py`. Typed benchmarks are registered once per type
+ * of a type axis. Every run allocates from the tracked pool of `cudf::benchmark`, reports the
+ * counters of `report_memory_counters()` and, when tuning, writes the tuned launch configuration.
+ *
+ * Example:
+ *
+ * struct bm_gather {
+ *   template <typename T>
+ *   void operator()(::benchmark::State& state) const
+ *   {
+ *     auto const size = state.range(0);
+ *     // build the inputs
+ *     for (auto _ : state) {
+ *       cuda_event_timer timer(state, true);
+ *       // benchmark stuff
+ *     }
+ *     state.SetBytesProcessed(state.iterations() * size * sizeof(T) * 2);
+ *   }
+ * };
+ *
+ * static auto const gather_benchmarks = cudf::register_typed_benchmark<int32_t, double>(
+ *   "gather", bm_gather{}, {{"size", cudf::geometric_axis(1 << 10, 1 << 26, 4)}});
+ *
+ * JSON output, including the counters, is written with
+ * `--benchmark_out=<file> --benchmark_out_format=json`.
+ */
+
+namespace cudf {
+/**
+ * @brief A named benchmark parameter and the values it sweeps
+ */
+struct benchmark_axis {
+  std::string name;
+  std::vector<int64_t> values;
+};
+
+/**
+ * @brief Returns `first, first * multiplier, ...` up to and including `last`
+ */
+inline std::vector<int64_t> geometric_axis(int64_t first, int64_t last, int64_t multiplier = 2)
+{
+  std::vector<int64_t> values;
+  for (auto value = first; value <= last; value *= multiplier) { values.push_back(value); }
+  return values;
+}
+
+/**
+ * @brief Registers every combination of the axis values as the arguments of a benchmark
+ *
+ * The first axis varies slowest. `state.range(i)` of a run returns its value of axis `i`.
+ *
+ * @param bm Registered benchmark
+ * @param axes Axes of the benchmark
+ */
+inline void apply_axes(::benchmark::internal::Benchmark* bm,
+                       std::vector<benchmark_axis> const& axes)
+{
+  if (axes.empty()) { return; }
+  for (auto const& axis : axes) {
+    if (axis.values.empty()) { return; }
+  }
+  std::vector<std::string> names;
+  for (auto const& axis : axes) { names.push_back(axis.name); }
+  bm->ArgNames(names);
+
+  std::vector<size_t> indices(axes.size(), 0);
+  while (true) {
+    std::vector<int64_t> args;
+    for (size_t i = 0; i < axes.size(); ++i) { args.push_back(axes[i].values[indices[i]]); }
+    bm->Args(args);
+    // Advance the last axis first, carrying into the previous axes
+    auto i = axes.size();
+    while (i > 0 && ++indices[i - 1] == axes[i - 1].values.size()) { indices[--i] = 0; }
+    if (i == 0) { return; }
+  }
+}
+
+/**
+ * @brief Returns the number of bytes of the data of a table, for `SetBytesProcessed()`
+ *
+ * Counts the elements of the fixed-width columns and the characters and offsets of the strings
+ * columns; null masks are not counted.
+ */
+inline int64_t table_data_bytes(table_view const& input)
+{
+  int64_t bytes = 0;
+  for (auto const& col : input) {
+    if (col.type().id() == type_id::STRING) {
+      bytes += strings_column_view(col).chars_size() + (col.size() + 1) * sizeof(size_type);
+    } else {
+      bytes += static_cast<int64_t>(col.size()) * size_of(col.type());
+    }
+  }
+  return bytes;
+}
+
+namespace detail {
+/**
+ * @brief Name of a type of a type axis; `std::string` stands for the strings columns
+ */
+template <typename T>
+std::string benchmark_type_name()
+{
+  return cudf::type_to_name{}.template operator()<T>();
+}
+
+template <>
+inline std::string benchmark_type_name<std::string>()
+{
+  return "string";
+}
+
+template <typename T, typename Benchmark>
+void register_typed_benchmark(std::string const& name,
+                              Benchmark const& bm,
+                              std::vector<benchmark_axis> const& axes)
+{
+  auto const full_name = name + "<" + benchmark_type_name<T>() + ">";
+  auto registered      = ::benchmark::RegisterBenchmark(
+    full_name.c_str(), [bm](::benchmark::State& state) {
+      benchmark_memory_resource mr;
+      bm.template operator()<T>(state);
+      report_memory_counters(state, mr.tracker());
+      cudf::detail::write_tuned_launch_configs();
+    });
+  registered->UseManualTime();
+  apply_axes(registered, axes);
+}
+}  // namespace detail
+
+/**
+ * @brief Registers a benchmark for every type of a type axis and every combination of the axes
+ *
+ * The runs are timed with `cuda_event_timer`, which the benchmark must use in its loop. Call from
+ * the initializer of a namespace-scope variable so that the benchmarks are registered before
+ * `main()`.
+ *
+ * @tparam Types Type axis
+ * @param name Base name of the benchmarks; the type name is appended in angle brackets
+ * @param bm Functor whose `template <typename T> operator()(::benchmark::State&) const` runs the
+ * benchmark for type `T`
+ * @param axes Value axes of the benchmark
+ * @return The number of registered types
+ */
+template <typename... Types, typename Benchmark>
+int register_typed_benchmark(std::string const& name,
+                             Benchmark const& bm,
+                             std::vector<benchmark_axis> const& axes)
+{
+  int dummy[] = {(detail::register_typed_benchmark<Types>(name, bm, axes), 0)...};
+  (void)dummy;
+  return sizeof...(Types);
+}
+
+/**
+ * @brief Registers a benchmark without a type axis for every combination of the axes
+ *
+ * The runs are set up as those of `register_typed_benchmark()`.
+ *
+ * @param name Name of the benchmark
+ * @param bm Functor whose `operator()(::benchmark::State&) const` runs the benchmark
+ * @param axes Value axes of the benchmark
+ * @return The registered benchmark, for further configuration
+ */
+template <typename Benchmark>
+::benchmark::internal::Benchmark* register_benchmark(std::string const& name,
+                                                     Benchmark const& bm,
+                                                     std::vector<benchmark_axis> const& axes)
+{
+  auto registered = ::benchmark::RegisterBenchmark(name.c_str(), [bm](::benchmark::State& state) {
+    benchmark_memory_resource mr;
+    bm(state);
+    report_memory_counters(state, mr.tracker());
+    cudf::detail::write_tuned_launch_configs();
+  });
+  registered->UseManualTime();
+  apply_axes(registered, axes);
+  return registered;
+}
+
+}  // namespace cudf
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+namespace cudf {
+/**
+ * @brief Device memory resource adaptor that tracks the bytes allocated through it
+ *
+ * Forwards every request to the upstream resource and records the number of bytes currently
+ * allocated and the high-water mark since construction or the last `reset_peak()`. The benchmark
+ * fixture installs it on top of the pool so that benchmarks can report their peak memory usage.
+ */
+class memory_tracking_resource final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param upstream Resource serving the requests; not owned, must outlive this object
+   */
+  explicit memory_tracking_resource(rmm::mr::device_memory_resource* upstream) : _upstream(upstream)
+  {
+  }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+  /**
+   * @brief Returns the number of bytes currently allocated
+   */
+  std::size_t current_bytes() const
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _current_bytes;
+  }
+
+  /**
+   * @brief Returns the largest number of bytes allocated at once since the last reset
+   */
+  std::size_t peak_bytes() const
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _peak_bytes;
+  }
+
+  /**
+   * @brief Resets the peak to the number of bytes currently allocated
+   *
+   * Called before the timed loop, this excludes the inputs built by the benchmark from the peak.
+   */
+  void reset_peak()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _peak_bytes = _current_bytes;
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override
+  {
+    auto ptr = _upstream->allocate(bytes, stream);
+    std::lock_guard<std::mutex> lock(_mutex);
+    _current_bytes += bytes;
+    _peak_bytes = std::max(_peak_bytes, _current_bytes);
+    return ptr;
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, cudaStream_t stream) override
+  {
+    _upstream->deallocate(ptr, bytes, stream);
+    std::lock_guard<std::mutex> lock(_mutex);
+    _current_bytes -= bytes;
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t stream) const override
+  {
+    return _upstream->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* const _upstream;
+  mutable std::mutex _mutex;
+  std::size_t _current_bytes = 0;
+  std::size_t _peak_bytes    = 0;
+};
+
+}  // namespace cudf
@@ -19,7 +19,8 @@
 #include <cudf/groupby.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
-#include <fixture/benchmark_fixture.hpp>
+#include <benchmarks/common/generate_input.hpp>
+#include <fixture/benchmark_harness.hpp>
 #include <synchronization/synchronization.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
@@ -112,3 +113,43 @@ BENCHMARK_REGISTER_F(Groupby, PreSorted)
   ->UseManualTime()
   ->Unit(benchmark::kMillisecond)
   ->Arg(10000000);
+
+void BM_skewed_sum(benchmark::State& state)
+{
+  column_profile key_profile(cudf::type_id::INT64);
+  key_profile.cardinality      = state.range(1);
+  key_profile.zipf_exponent    = state.range(2);
+  key_profile.null_probability = 0;
+  column_profile value_profile(cudf::type_id::INT64);
+  value_profile.lower_bound = 0;
+  value_profile.upper_bound = 100;
+  auto const input =
+    create_random_table({key_profile, value_profile}, static_cast<cudf::size_type>(state.range(0)));
+
+  cudf::groupby::groupby gb_obj(cudf::table_view({input->get_column(0).view()}));
+
+  std::vector<cudf::groupby::aggregation_request> requests;
+  requests.emplace_back(cudf::groupby::aggregation_request());
+  requests[0].values = input->get_column(1).view();
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+
+  cudf::current_memory_tracker()->reset_peak();
+  for (auto _ : state) {
+    cuda_event_timer timer(state, true);
+
+    auto result = gb_obj.aggregate(requests);
+  }
+  state.SetBytesProcessed(state.iterations() * cudf::table_data_bytes(input->view()));
+}
+
+BENCHMARK_DEFINE_F(Groupby, Skewed)(::benchmark::State& state) { BM_skewed_sum(state); }
+
+BENCHMARK_REGISTER_F(Groupby, Skewed)
+  ->Apply([](benchmark::internal::Benchmark* b) {
+    cudf::apply_axes(b,
+                     {{"rows", {10000000}},
+                      {"cardinality", {100, 10000, 1000000}},
+                      {"zipf_exponent", {0, 1, 2}}});
+  })
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
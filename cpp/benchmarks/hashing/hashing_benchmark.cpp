@@ -13,10 +13,12 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/hashing.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/table.hpp>
 
-#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_harness.hpp>
 #include <benchmarks/synchronization/synchronization.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
@@ -74,3 +76,41 @@ BENCHMARK_REGISTER_F(Hashing, hash_partition)
   ->Apply(CustomRanges)
   ->Unit(benchmark::kMillisecond)
   ->UseManualTime();
+
+template <class T>
+void BM_hash(benchmark::State& state, cudf::hash_id hash_function)
+{
+  auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+  auto const num_cols = static_cast<cudf::size_type>(state.range(1));
+  data_profile profile;
+  profile.null_probability = state.range(2) / 100.0;
+  auto const input         = create_random_table<T>(profile, num_cols, num_rows);
+
+  cudf::current_memory_tracker()->reset_peak();
+  for (auto _ : state) {
+    cuda_event_timer timer(state, true);
+    auto output = cudf::hash(input->view(), hash_function);
+  }
+  state.SetBytesProcessed(state.iterations() * cudf::table_data_bytes(input->view()));
+}
+
+BENCHMARK_DEFINE_F(Hashing, murmur3)
+(::benchmark::State& state) { BM_hash<int64_t>(state, cudf::hash_id::HASH_MURMUR3); }
+
+BENCHMARK_DEFINE_F(Hashing, xxhash64)
+(::benchmark::State& state) { BM_hash<int64_t>(state, cudf::hash_id::HASH_XXHASH64); }
+
+BENCHMARK_DEFINE_F(Hashing, murmur3_strings)
+(::benchmark::State& state) { BM_hash<std::string>(state, cudf::hash_id::HASH_MURMUR3); }
+
+static void hash_axes(benchmark::internal::Benchmark* b)
+{
+  cudf::apply_axes(b,
+                   {{"rows", cudf::geometric_axis(1 << 16, 1 << 24, 4)},
+                    {"columns", {1, 4}},
+                    {"null_percent", {0, 10}}});
+}
+
+BENCHMARK_REGISTER_F(Hashing, murmur3)->Apply(hash_axes)->UseManualTime();
+BENCHMARK_REGISTER_F(Hashing, xxhash64)->Apply(hash_axes)->UseManualTime();
+BENCHMARK_REGISTER_F(Hashing, murmur3_strings)->Apply(hash_axes)->UseManualTime();
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_harness.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/functions.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+namespace {
+/**
+ * @brief Minimal writer of Avro object container files with the null codec
+ *
+ * libcudf has no Avro writer, so the benchmark encodes its input on the host.
+ */
+class avro_encoder {
+ public:
+  void write_long(int64_t value)
+  {
+    // Zigzag encoding followed by a little-endian base-128 varint
+    auto bits = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    while (bits >= 0x80) {
+      _buffer.push_back(static_cast<char>((bits & 0x7f) | 0x80));
+      bits >>= 7;
+    }
+    _buffer.push_back(static_cast<char>(bits));
+  }
+
+  void write_value(int64_t value) { write_long(value); }
+
+  void write_value(double value)
+  {
+    char bytes[sizeof(double)];
+    std::memcpy(bytes, &value, sizeof(double));
+    _buffer.insert(_buffer.end(), bytes, bytes + sizeof(double));
+  }
+
+  void write_value(std::string const& value)
+  {
+    write_long(value.size());
+    _buffer.insert(_buffer.end(), value.begin(), value.end());
+  }
+
+  void write_raw(std::string const& bytes)
+  {
+    _buffer.insert(_buffer.end(), bytes.begin(), bytes.end());
+  }
+
+  std::vector<char>& buffer() { return _buffer; }
+
+ private:
+  std::vector<char> _buffer;
+};
+
+template <typename T>
+std::string avro_type();
+template <>
+std::string avro_type<int64_t>()
+{
+  return "long";
+}
+template <>
+std::string avro_type<double>()
+{
+  return "double";
+}
+template <>
+std::string avro_type<std::string>()
+{
+  return "string";
+}
+
+/**
+ * @brief Returns an Avro file of records of `columns.size()` fields of type `T`
+ */
+template <typename T>
+std::vector<char> write_avro(std::vector<std::vector<T>> const& columns, cudf::size_type num_rows)
+{
+  static constexpr cudf::size_type rows_per_block = 16 * 1024;
+  std::string const sync_marker(16, '\x5a');
+
+  std::string schema = R"({"type":"record","name":"bench","fields":[)";
+  for (size_t c = 0; c < columns.size(); ++c) {
+    schema += (c == 0 ? "" : ",");
+    schema += R"({"name":"col)" + std::to_string(c) + R"(","type":")" + avro_type<T>() + "\"}";
+  }
+  schema += "]}";
+
+  avro_encoder file;
+  file.write_raw(std::string("Obj\x01", 4));
+  file.write_long(2);
+  file.write_value(std::string("avro.schema"));
+  file.write_value(schema);
+  file.write_value(std::string("avro.codec"));
+  file.write_value(std::string("null"));
+  file.write_long(0);
+  file.write_raw(sync_marker);
+
+  for (cudf::size_type begin = 0; begin < num_rows; begin += rows_per_block) {
+    auto const end = std::min(begin + rows_per_block, num_rows);
+    avro_encoder block;
+    for (auto r = begin; r < end; ++r) {
+      for (auto const& column : columns) { block.write_value(column[r]); }
+    }
+    file.write_long(end - begin);
+    file.write_long(block.buffer().size());
+    file.buffer().insert(file.buffer().end(), block.buffer().begin(), block.buffer().end());
+    file.write_raw(sync_marker);
+  }
+  return std::move(file.buffer());
+}
+
+/**
+ * @brief Reads `state.range(0)` Avro records of `state.range(1)` fields of type `T`
+ */
+struct avro_read_benchmark {
+  template <typename T>
+  void operator()(benchmark::State& state) const
+  {
+    auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+    auto const num_cols = static_cast<cudf::size_type>(state.range(1));
+
+    std::vector<std::vector<T>> columns;
+    for (cudf::size_type c = 0; c < num_cols; ++c) {
+      columns.push_back(random_values<T>(data_profile{}, num_rows));
+    }
+    auto const buffer = write_avro(columns, num_rows);
+
+    cudf_io::read_avro_args args(cudf_io::source_info(buffer.data(), buffer.size()));
+
+    cudf::current_memory_tracker()->reset_peak();
+    for (auto _ : state) {
+      cuda_event_timer raii(state, true);
+      cudf_io::read_avro(args);
+    }
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+  }
+};
+
+}  // namespace
+
+static auto const avro_read_benchmarks =
+  cudf::register_typed_benchmark<int64_t, double, std::string>(
+    "AvroRead",
+    avro_read_benchmark{},
+    {{"rows", cudf::geometric_axis(1 << 14, 1 << 22, 8)}, {"columns", {4, 16}}});
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_harness.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/functions.hpp>
+
+#include <string>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+namespace {
+template <typename T>
+void append_json_value(std::string& out, T value)
+{
+  out += std::to_string(value);
+}
+
+void append_json_value(std::string& out, std::string const& value) { out += '"' + value + '"'; }
+
+template <typename T>
+std::string json_dtype();
+template <>
+std::string json_dtype<int64_t>()
+{
+  return "int64";
+}
+template <>
+std::string json_dtype<double>()
+{
+  return "float64";
+}
+template <>
+std::string json_dtype<std::string>()
+{
+  return "str";
+}
+
+/**
+ * @brief Reads `state.range(0)` JSON lines of `state.range(1)` fields of type `T`
+ */
+struct json_read_benchmark {
+  template <typename T>
+  void operator()(benchmark::State& state) const
+  {
+    auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+    auto const num_cols = static_cast<cudf::size_type>(state.range(1));
+
+    data_profile profile;
+    profile.space_probability = 0;
+    std::vector<std::vector<T>> columns;
+    for (cudf::size_type c = 0; c < num_cols; ++c) {
+      columns.push_back(random_values<T>(profile, num_rows));
+    }
+    std::string buffer;
+    for (cudf::size_type r = 0; r < num_rows; ++r) {
+      buffer += '{';
+      for (cudf::size_type c = 0; c < num_cols; ++c) {
+        buffer += (c == 0 ? "\"col" : ",\"col") + std::to_string(c) + "\":";
+        append_json_value(buffer, columns[c][r]);
+      }
+      buffer += "}\n";
+    }
+
+    cudf_io::read_json_args args(cudf_io::source_info(buffer.data(), buffer.size()));
+    args.lines = true;
+    args.dtype = std::vector<std::string>(num_cols, json_dtype<T>());
+
+    cudf::current_memory_tracker()->reset_peak();
+    for (auto _ : state) {
+      cuda_event_timer raii(state, true);
+      cudf_io::read_json(args);
+    }
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+  }
+};
+
+}  // namespace
+
+static auto const json_read_benchmarks =
+  cudf::register_typed_benchmark<int64_t, double, std::string>(
+    "JsonRead",
+    json_read_benchmark{},
+    {{"rows", cudf::geometric_axis(1 << 14, 1 << 20, 8)}, {"columns", {4, 16}}});
@@ -17,7 +17,8 @@
 #include <benchmark/benchmark.h>
 
 #include <benchmarks/common/generate_benchmark_input.hpp>
-#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_harness.hpp>
 #include <benchmarks/io/cuio_benchmarks_common.hpp>
 #include <benchmarks/synchronization/synchronization.hpp>
 
@@ -65,3 +66,42 @@ void PQ_write(benchmark::State& state)
 
 CUIO_BENCH_ALL_TYPES(PARQ_WR_BENCHMARK_DEFINE, UNCOMPRESSED)
 CUIO_BENCH_ALL_TYPES(PARQ_WR_BENCHMARK_DEFINE, USE_SNAPPY)
+
+/**
+ * @brief Writes Parquet tables whose columns have `state.range(0)` distinct values in runs of
+ * `state.range(1)` rows on average, which exercise the dictionary and run-length encodings
+ */
+template <typename T>
+void PQ_write_encoding(benchmark::State& state)
+{
+  column_profile profile{cudf::type_to_id<T>()};
+  profile.cardinality    = state.range(0);
+  profile.avg_run_length = state.range(1);
+  std::vector<column_profile> const profiles(8, profile);
+  auto const tbl  = create_random_table(profiles, rows_for_size(profiles, data_size));
+  auto const view = tbl->view();
+
+  cudf::current_memory_tracker()->reset_peak();
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::write_parquet_args args{
+      cudf_io::sink_info(), view, nullptr, cudf_io::compression_type::SNAPPY};
+    cudf_io::write_parquet(args);
+  }
+
+  state.SetBytesProcessed(cudf::table_data_bytes(view) * state.iterations());
+}
+
+#define PARQ_WR_ENCODING_BENCHMARK_DEFINE(name, datatype)                         \
+  BENCHMARK_TEMPLATE_DEFINE_F(ParquetWrite, name, datatype)                       \
+  (::benchmark::State & state) { PQ_write_encoding<datatype>(state); }            \
+  BENCHMARK_REGISTER_F(ParquetWrite, name)                                        \
+    ->Apply([](benchmark::internal::Benchmark* b) {                               \
+      cudf::apply_axes(b, {{"cardinality", {0, 1000}}, {"run_length", {1, 32}}}); \
+    })                                                                            \
+    ->Unit(benchmark::kMillisecond)                                               \
+    ->UseManualTime();
+
+PARQ_WR_ENCODING_BENCHMARK_DEFINE(Int_encoding, int32_t)
+PARQ_WR_ENCODING_BENCHMARK_DEFINE(Double_encoding, double)
+PARQ_WR_ENCODING_BENCHMARK_DEFINE(String_encoding, cudf::string_view)
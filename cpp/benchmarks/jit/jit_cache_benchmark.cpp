@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/scalar/scalar.hpp>
+
+#include <jit/cache.h>
+
+#include <cuda_runtime.h>
+
+/**
+ * @file jit_cache_benchmark.cpp
+ * @brief Host throughput of JIT kernel lookups from many threads
+ *
+ * Both benchmarks look up kernels that are compiled before the first iteration, so they measure
+ * how the lookups of cached kernels scale with the number of threads of the process, in calls per
+ * second of real time, rather than compilation. The `JitBinopUdf` runs also launch the kernels.
+ */
+
+namespace {
+// c = a*a*a + b
+char const* const binop_ptx =
+  R"***(
+//
+// Generated by NVIDIA NVVM Compiler
+//
+// Compiler Build ID: CL-26218862
+// Cuda compilation tools, release 10.1, V10.1.168
+// Based on LLVM 3.4svn
+//
+
+.version 6.4
+.target sm_70
+.address_size 64
+
+	// .globl	_ZN8__main__7add$241Eff
+.common .global .align 8 .u64 _ZN08NumbaEnv8__main__7add$241Eff;
+.common .global .align 8 .u64 _ZN08NumbaEnv5numba7targets7numbers13int_power$242Efx;
+
+.visible .func  (.param .b32 func_retval0) _ZN8__main__7add$241Eff(
+	.param .b64 _ZN8__main__7add$241Eff_param_0,
+	.param .b32 _ZN8__main__7add$241Eff_param_1,
+	.param .b32 _ZN8__main__7add$241Eff_param_2
+)
+{
+	.reg .f32 	%f<5>;
+	.reg .b32 	%r<2>;
+	.reg .b64 	%rd<2>;
+
+
+	ld.param.u64 	%rd1, [_ZN8__main__7add$241Eff_param_0];
+	ld.param.f32 	%f1, [_ZN8__main__7add$241Eff_param_1];
+	ld.param.f32 	%f2, [_ZN8__main__7add$241Eff_param_2];
+	mul.f32 	%f3, %f1, %f1;
+	fma.rn.f32 	%f4, %f3, %f1, %f2;
+	st.f32 	[%rd1], %f4;
+	mov.u32 	%r1, 0;
+	st.param.b32	[func_retval0+0], %r1;
+	ret;
+}
+)***";
+
+char const* const program_source =
+  "jit_cache_benchmark_program\n"
+  "template<int N, typename T>\n"
+  "__global__\n"
+  "void my_kernel(T* data) {\n"
+  "    T data0 = data[0];\n"
+  "    for( int i=0; i<N-1; ++i ) {\n"
+  "        data[0] *= data0;\n"
+  "    }\n"
+  "}\n";
+
+/**
+ * @brief Returns the pooled default memory resource shared by the threads of all the runs
+ */
+cudf::benchmark_memory_resource& shared_memory_resource()
+{
+  static cudf::benchmark_memory_resource mr;
+  return mr;
+}
+
+void BM_jit_binop_udf(benchmark::State& state)
+{
+  shared_memory_resource();
+  auto const size = static_cast<cudf::size_type>(state.range(0));
+  auto const lhs  = cudf::sequence(size, cudf::numeric_scalar<float>(0));
+  auto const rhs  = cudf::sequence(size, cudf::numeric_scalar<float>(1));
+  cudf::data_type const output_type{cudf::type_id::FLOAT32};
+
+  // One of the threads compiles the kernel, the others wait for it
+  cudf::binary_operation(*lhs, *rhs, binop_ptx, output_type);
+
+  for (auto _ : state) { cudf::binary_operation(*lhs, *rhs, binop_ptx, output_type); }
+  cudaStreamSynchronize(0);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_jit_cache_lookup(benchmark::State& state)
+{
+  // Make the primary context current in the thread
+  cudaFree(0);
+  auto& cache        = cudf::jit::cudfJitCache::Instance();
+  auto const program = cache.getProgram("jit_cache_benchmark_program", program_source);
+  cache.getKernel("my_kernel", program, {"3", "int"});
+
+  for (auto _ : state) {
+    auto const cached = cache.getProgram("jit_cache_benchmark_program");
+    benchmark::DoNotOptimize(cache.getKernel("my_kernel", cached, {"3", "int"}));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_jit_binop_udf)->Name("JitBinopUdf")->Arg(1000)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_jit_cache_lookup)->Name("JitCacheLookup")->ThreadRange(1, 32)->UseRealTime();
@@ -25,7 +25,8 @@
 #include <cudf/utilities/error.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
-#include <fixture/benchmark_fixture.hpp>
+#include <benchmarks/common/generate_input.hpp>
+#include <fixture/benchmark_harness.hpp>
 #include <synchronization/synchronization.hpp>
 
 #include <vector>
@@ -111,3 +112,53 @@ BENCHMARK_REGISTER_F(Join, join_64bit)
   ->Args({50'000'000, 50'000'000})
   ->Args({40'000'000, 120'000'000})
   ->UseManualTime();
+
+/**
+ * @brief Inner join of a build table of `state.range(0)` keys drawn from as many distinct values
+ * with a probe table of `state.range(1)` keys of Zipf exponent `state.range(2)`
+ *
+ * Skewed probe keys concentrate the probes on a few slots of the hash table.
+ */
+template <typename key_type, typename payload_type>
+static void BM_join_skewed(benchmark::State &state)
+{
+  auto const build_size = static_cast<cudf::size_type>(state.range(0));
+  auto const probe_size = static_cast<cudf::size_type>(state.range(1));
+
+  column_profile key_profile{cudf::type_to_id<key_type>()};
+  key_profile.cardinality      = build_size;
+  key_profile.null_probability = 0;
+  column_profile payload_profile{cudf::type_to_id<payload_type>()};
+  payload_profile.null_probability = 0;
+
+  auto const build = create_random_table({key_profile, payload_profile}, build_size, 1);
+
+  // The probe keys are drawn from the same distinct values as the build keys
+  key_profile.zipf_exponent = state.range(2);
+  auto const probe          = create_random_table({key_profile, payload_profile}, probe_size, 2);
+
+  std::vector<cudf::size_type> columns_to_join = {0};
+
+  cudf::current_memory_tracker()->reset_peak();
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, 0);
+
+    auto result =
+      cudf::inner_join(probe->view(), build->view(), columns_to_join, columns_to_join, {{0, 0}});
+  }
+  state.SetBytesProcessed(state.iterations() * (cudf::table_data_bytes(build->view()) +
+                                                cudf::table_data_bytes(probe->view())));
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F(Join, join_32bit_skewed_probe, int32_t, int32_t)
+(::benchmark::State &st) { BM_join_skewed<int32_t, int32_t>(st); }
+
+BENCHMARK_REGISTER_F(Join, join_32bit_skewed_probe)
+  ->Unit(benchmark::kMillisecond)
+  ->Apply([](benchmark::internal::Benchmark *b) {
+    cudf::apply_axes(b,
+                     {{"build_rows", {100'000, 10'000'000}},
+                      {"probe_rows", {10'000'000}},
+                      {"zipf_exponent", {0, 1, 2}}});
+  })
+  ->UseManualTime();
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_harness.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/quantiles.hpp>
+
+/**
+ * @brief Computes `state.range(2)` evenly spaced quantiles of `state.range(1)` unsorted columns
+ */
+struct quantiles_benchmark {
+  template <typename T>
+  void operator()(benchmark::State& state) const
+  {
+    auto const input = create_random_table<T>(data_profile{}, state.range(1), state.range(0));
+
+    auto const num_quantiles = state.range(2);
+    std::vector<double> q(num_quantiles);
+    for (int64_t i = 0; i < num_quantiles; ++i) {
+      q[i] = static_cast<double>(i + 1) / (num_quantiles + 1);
+    }
+
+    cudf::current_memory_tracker()->reset_peak();
+    for (auto _ : state) {
+      cuda_event_timer raii(state, true);
+      cudf::quantiles(input->view(), q);
+    }
+    state.SetBytesProcessed(state.iterations() * cudf::table_data_bytes(input->view()));
+  }
+};
+
+static auto const quantiles_benchmarks = cudf::register_typed_benchmark<int32_t, double>(
+  "Quantiles",
+  quantiles_benchmark{},
+  {{"rows", cudf::geometric_axis(1 << 14, 1 << 24, 4)},
+   {"columns", {1, 4}},
+   {"quantiles", {1, 8}}});
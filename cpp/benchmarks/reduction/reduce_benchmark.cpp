@@ -18,7 +18,7 @@
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/types.hpp>
-#include <fixture/benchmark_fixture.hpp>
+#include <benchmarks/fixture/benchmark_harness.hpp>
 #include <synchronization/synchronization.hpp>
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_wrapper.hpp>
@@ -47,10 +47,17 @@ void BM_reduction(benchmark::State& state, std::unique_ptr<cudf::aggregation> co
       ? cudf::data_type{cudf::type_id::FLOAT64}
       : input_column.type();
 
+  cudf::current_memory_tracker()->reset_peak();
   for (auto _ : state) {
     cuda_event_timer timer(state, true);
     auto result = cudf::reduce(input_column, agg, output_dtype);
   }
+  state.SetBytesProcessed(state.iterations() * column_size * sizeof(type));
+}
+
+void reduction_axes(benchmark::internal::Benchmark* bm)
+{
+  cudf::apply_axes(bm, {{"size", cudf::geometric_axis(10000, 100000000, 10)}});
 }
 
 #define concat(a, b, c) a##b##c
@@ -64,11 +71,7 @@ void BM_reduction(benchmark::State& state, std::unique_ptr<cudf::aggregation> co
   }                                                               \
   BENCHMARK_REGISTER_F(Reduction, name)                           \
     ->UseManualTime()                                             \
-    ->Arg(10000)      /* 10k */                                   \
-    ->Arg(100000)     /* 100k */                                  \
-    ->Arg(1000000)    /* 1M */                                    \
-    ->Arg(10000000)   /* 10M */                                   \
-    ->Arg(100000000); /* 100M */
+    ->Apply(reduction_axes);
 
 #define REDUCE_BENCHMARK_DEFINE(type, aggregation) \
   RBM_BENCHMARK_DEFINE(concat(type, _, aggregation), type, aggregation)
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_harness.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/rolling.hpp>
+
+#include <functional>
+
+/**
+ * @brief Fixed-size rolling window of `state.range(1)` rows centered on each row
+ */
+struct rolling_window_benchmark {
+  std::function<std::unique_ptr<cudf::aggregation>()> make_aggregation;
+
+  template <typename T>
+  void operator()(benchmark::State& state) const
+  {
+    auto const num_rows    = state.range(0);
+    auto const window_size = static_cast<cudf::size_type>(state.range(1));
+    auto const column      = create_random_column<T>(data_profile{}, num_rows);
+    auto const agg         = make_aggregation();
+
+    cudf::current_memory_tracker()->reset_peak();
+    for (auto _ : state) {
+      cuda_event_timer raii(state, true);
+      cudf::rolling_window(column->view(), window_size / 2 + 1, window_size / 2, 1, agg);
+    }
+    // Each window reads its input from the cache; count the input and the output once
+    state.SetBytesProcessed(state.iterations() * num_rows * sizeof(T) * 2);
+  }
+};
+
+static std::vector<cudf::benchmark_axis> const rolling_axes{
+  {"rows", cudf::geometric_axis(1 << 16, 1 << 26, 4)}, {"window", {3, 30, 300}}};
+
+static auto const rolling_sum_benchmarks =
+  cudf::register_typed_benchmark<int32_t, int64_t, double>(
+    "RollingWindow/sum", rolling_window_benchmark{cudf::make_sum_aggregation}, rolling_axes);
+
+static auto const rolling_max_benchmarks =
+  cudf::register_typed_benchmark<int32_t, int64_t, double>(
+    "RollingWindow/max", rolling_window_benchmark{cudf::make_max_aggregation}, rolling_axes);
+
+static auto const rolling_mean_benchmarks = cudf::register_typed_benchmark<int32_t, double>(
+  "RollingWindow/mean", rolling_window_benchmark{cudf::make_mean_aggregation}, rolling_axes);
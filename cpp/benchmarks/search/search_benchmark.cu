@@ -153,3 +153,42 @@ BENCHMARK_REGISTER_F(Search, Table)
   ->UseManualTime()
   ->Unit(benchmark::kMillisecond)
   ->Apply(CustomArguments);
+
+void BM_bucketize(benchmark::State& state, bool histogram)
+{
+  const cudf::size_type column_size{(cudf::size_type)state.range(0)};
+  const cudf::size_type num_edges{(cudf::size_type)state.range(1)};
+
+  cudf::test::UniformRandomGenerator<float> random_gen(0, num_edges);
+  auto data_it = cudf::test::make_counting_transform_iterator(
+    0, [&](cudf::size_type row) { return random_gen.generate(); });
+  auto edge_it = cudf::test::make_counting_transform_iterator(
+    0, [](cudf::size_type row) { return static_cast<float>(row); });
+
+  cudf::test::fixed_width_column_wrapper<float> column(data_it, data_it + column_size);
+  cudf::test::fixed_width_column_wrapper<float> edges(edge_it, edge_it + num_edges);
+
+  for (auto _ : state) {
+    cuda_event_timer timer(state, true);
+    auto result = histogram ? cudf::histogram(column, edges)
+                            : cudf::bucketize(column, edges, cudf::closed_side::LEFT);
+  }
+}
+
+BENCHMARK_DEFINE_F(Search, Bucketize)(::benchmark::State& state) { BM_bucketize(state, false); }
+BENCHMARK_DEFINE_F(Search, Histogram)(::benchmark::State& state) { BM_bucketize(state, true); }
+
+static void BinArguments(benchmark::internal::Benchmark* b)
+{
+  for (int num_edges = 16; num_edges <= 65536; num_edges *= 16) b->Args({100000000, num_edges});
+}
+
+BENCHMARK_REGISTER_F(Search, Bucketize)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond)
+  ->Apply(BinArguments);
+
+BENCHMARK_REGISTER_F(Search, Histogram)
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond)
+  ->Apply(BinArguments);
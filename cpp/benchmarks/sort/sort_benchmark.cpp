@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_harness.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/sorting.hpp>
+
+/**
+ * @brief Sorts `state.range(1)` key columns of `state.range(0)` rows of type `T`
+ *
+ * `state.range(2)` is the number of distinct values of each column; 0 for unique keys.
+ */
+struct sorted_order_benchmark {
+  bool stable;
+
+  template <typename T>
+  void operator()(benchmark::State& state) const
+  {
+    data_profile profile;
+    profile.cardinality = state.range(2);
+    auto const keys     = create_random_table<T>(profile, state.range(1), state.range(0));
+
+    cudf::current_memory_tracker()->reset_peak();
+    for (auto _ : state) {
+      cuda_event_timer raii(state, true);
+      if (stable) {
+        cudf::stable_sorted_order(keys->view());
+      } else {
+        cudf::sorted_order(keys->view());
+      }
+    }
+    state.SetBytesProcessed(state.iterations() * cudf::table_data_bytes(keys->view()));
+  }
+};
+
+static std::vector<cudf::benchmark_axis> const sort_axes{
+  {"rows", cudf::geometric_axis(1 << 14, 1 << 24, 4)},
+  {"columns", {1, 4}},
+  {"cardinality", {0, 1000}}};
+
+static auto const sorted_order_benchmarks =
+  cudf::register_typed_benchmark<int32_t, int64_t, double, std::string>(
+    "SortedOrder", sorted_order_benchmark{false}, sort_axes);
+
+static auto const stable_sorted_order_benchmarks =
+  cudf::register_typed_benchmark<int64_t, std::string>(
+    "StableSortedOrder", sorted_order_benchmark{true}, sort_axes);
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_harness.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/stream_compaction.hpp>
+
+#include <numeric>
+
+/**
+ * @brief Drops the duplicates of `state.range(1)` key columns of `state.range(0)` rows
+ *
+ * `state.range(2)` is the number of distinct values of each key column; 0 for unique keys.
+ * `state.range(3)` selects the sort-based `drop_duplicates` (0) or the hash-based `distinct` (1).
+ */
+struct drop_duplicates_benchmark {
+  template <typename T>
+  void operator()(benchmark::State& state) const
+  {
+    data_profile profile;
+    profile.cardinality = state.range(2);
+    auto const input    = create_random_table<T>(profile, state.range(1), state.range(0));
+    std::vector<cudf::size_type> keys(input->num_columns());
+    std::iota(keys.begin(), keys.end(), 0);
+
+    cudf::current_memory_tracker()->reset_peak();
+    for (auto _ : state) {
+      cuda_event_timer raii(state, true);
+      if (state.range(3) == 0) {
+        cudf::drop_duplicates(input->view(), keys, cudf::duplicate_keep_option::KEEP_FIRST);
+      } else {
+        cudf::distinct(input->view(), keys);
+      }
+    }
+    state.SetBytesProcessed(state.iterations() * cudf::table_data_bytes(input->view()));
+  }
+};
+
+static auto const drop_duplicates_benchmarks =
+  cudf::register_typed_benchmark<int32_t, int64_t, double, std::string>(
+    "DropDuplicates",
+    drop_duplicates_benchmark{},
+    {{"rows", cudf::geometric_axis(1 << 14, 1 << 24, 4)},
+     {"columns", {1, 2}},
+     {"cardinality", {0, 100, 100000}},
+     {"hash", {0, 1}}});
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_harness.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/strings/contains.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+class StringContains : public cudf::benchmark {
+};
+
+static void BM_contains_re(benchmark::State& state)
+{
+  data_profile profile;
+  profile.avg_string_length = state.range(1);
+  profile.max_string_length = 4 * profile.avg_string_length;
+  auto const column         = create_random_column<std::string>(profile, state.range(0));
+  cudf::strings_column_view input(column->view());
+
+  cudf::current_memory_tracker()->reset_peak();
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    cudf::strings::contains_re(input, "[0-9]+[a-e]");
+  }
+  state.SetBytesProcessed(state.iterations() * input.chars_size());
+}
+
+static void string_axes(benchmark::internal::Benchmark* bm)
+{
+  cudf::apply_axes(bm,
+                   {{"rows", cudf::geometric_axis(1 << 12, 1 << 24, 8)},
+                    {"length", cudf::geometric_axis(8, 512, 4)}});
+}
+
+BENCHMARK_DEFINE_F(StringContains, contains_re)
+(::benchmark::State& state) { BM_contains_re(state); }
+BENCHMARK_REGISTER_F(StringContains, contains_re)
+  ->Apply(string_axes)
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
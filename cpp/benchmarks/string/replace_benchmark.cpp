@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_benchmark_input.hpp>
+#include <benchmarks/fixture/benchmark_harness.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/replace.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <tests/utilities/column_wrapper.hpp>
+
+class StringReplace : public cudf::benchmark {
+};
+
+enum class replace_type { scalar, multi };
+
+static void BM_replace(benchmark::State& state, replace_type rt)
+{
+  data_profile profile;
+  profile.avg_string_length = state.range(1);
+  profile.max_string_length = 4 * profile.avg_string_length;
+  auto const column         = create_random_column<std::string>(profile, state.range(0));
+  cudf::strings_column_view input(column->view());
+  cudf::string_scalar target("a");
+  cudf::string_scalar repl("xyz");
+  cudf::test::strings_column_wrapper targets({"a", "1", "e", "z"});
+  cudf::test::strings_column_wrapper repls({"xyz", "", "ee", "!"});
+
+  cudf::current_memory_tracker()->reset_peak();
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    switch (rt) {
+      case replace_type::scalar: cudf::strings::replace(input, target, repl); break;
+      case replace_type::multi:
+        cudf::strings::replace(
+          input, cudf::strings_column_view(targets), cudf::strings_column_view(repls));
+        break;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * input.chars_size());
+}
+
+static void string_axes(benchmark::internal::Benchmark* bm)
+{
+  cudf::apply_axes(bm,
+                   {{"rows", cudf::geometric_axis(1 << 12, 1 << 24, 8)},
+                    {"length", cudf::geometric_axis(8, 512, 4)}});
+}
+
+#define STRINGS_REPLACE_BENCHMARK_DEFINE(name)                            \
+  BENCHMARK_DEFINE_F(StringReplace, name)                                 \
+  (::benchmark::State & state) { BM_replace(state, replace_type::name); } \
+  BENCHMARK_REGISTER_F(StringReplace, name)                               \
+    ->Apply(string_axes)                                                  \
+    ->Unit(benchmark::kMillisecond)                                       \
+    ->UseManualTime();
+
+STRINGS_REPLACE_BENCHMARK_DEFINE(scalar)
+STRINGS_REPLACE_BENCHMARK_DEFINE(multi)
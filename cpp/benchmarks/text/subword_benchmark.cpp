@@ -15,6 +15,8 @@
  */
 
 #include <benchmark/benchmark.h>
+#include <benchmarks/fixture/benchmark_harness.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <nvtext/subword_tokenize.hpp>
 
@@ -78,4 +80,41 @@ static void BM_cuda_tokenizer_cudf(benchmark::State& state)
 }
 BENCHMARK(BM_cuda_tokenizer_cudf);
 
+class Subword : public cudf::benchmark {
+};
+
+static void BM_subword_tokenizer(benchmark::State& state)
+{
+  auto const nrows = static_cast<uint32_t>(state.range(0));
+  std::vector<const char*> h_strings(nrows, "This is a test ");
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  cudf::strings_column_view input{strings};
+
+  auto const vocabulary = nvtext::load_vocabulary_file(create_hash_vocab_file());
+  nvtext::subword_tokenizer tokenizer(vocabulary,
+                                      64,
+                                      48,
+                                      true,
+                                      false,
+                                      nrows,
+                                      static_cast<uint32_t>(input.chars_size()),
+                                      nrows);
+
+  cudf::current_memory_tracker()->reset_peak();
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    auto result = tokenizer.tokenize(input);
+  }
+  state.SetBytesProcessed(state.iterations() * input.chars_size());
+}
+
+BENCHMARK_DEFINE_F(Subword, tokenizer)
+(::benchmark::State& state) { BM_subword_tokenizer(state); }
+BENCHMARK_REGISTER_F(Subword, tokenizer)
+  ->Apply([](benchmark::internal::Benchmark* b) {
+    cudf::apply_axes(b, {{"rows", cudf::geometric_axis(1 << 10, 1 << 20, 4)}});
+  })
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
+
 BENCHMARK_MAIN();
@@ -0,0 +1,780 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_harness.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/datetime.hpp>
+#include <cudf/detail/nvtx/nvtx3.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/join.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/profiler.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @file tpch_benchmark.cpp
+ * @brief TPC-H queries 1, 3, 5, 6 and 9 built from libcudf APIs
+ *
+ * Each run reads the tables of a query from Parquet files in host memory and evaluates the query
+ * plan with filters, joins, groupbys and sorts, so that the measurements include what benchmarks
+ * of single primitives miss: the allocations and materialization of the intermediate tables, the
+ * repeated hashing of the same keys and the serialization of the operations on the stream.
+ *
+ * The tables are generated at a scale factor of `scale_factor_x100 / 100`. They have the row
+ * counts, keys and value ranges of the TPC-H schema but only the columns used by the queries. The
+ * string predicates `c_mktsegment = 'BUILDING'`, `r_name = 'ASIA'` and `p_name like '%green%'` are
+ * replaced by predicates of similar selectivity on integer codes, and the nations are grouped by
+ * key and name since the generated names are not unique.
+ *
+ * Every stage of a plan is an NVTX range of the `tpch` domain. After the timed iterations, one more
+ * run is profiled: the GPU time of each stage is reported as a `<query>/<stage>_ms` counter, and
+ * that of each libcudf operation, as measured by `cudf::enable_profiler()`, as a
+ * `cudf::<operation>_ms` counter.
+ */
+
+namespace {
+struct tpch_domain {
+  static constexpr char const* name{"tpch"};
+};
+
+// Dates of the queries, in days since the epoch
+constexpr int32_t date_1992_01_01 = 8035;
+constexpr int32_t date_1994_01_01 = 8766;
+constexpr int32_t date_1995_01_01 = 9131;
+constexpr int32_t date_1995_03_15 = 9204;
+constexpr int32_t date_1998_08_02 = 10440;
+constexpr int32_t date_1998_09_02 = 10471;
+constexpr int32_t date_1998_12_01 = 10561;
+
+cudf::data_type const bool8{cudf::type_id::BOOL8};
+cudf::data_type const int32{cudf::type_id::INT32};
+cudf::data_type const float64{cudf::type_id::FLOAT64};
+
+/**
+ * @brief Columns with names, the tables flowing through a query plan
+ */
+struct frame {
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  std::vector<std::string> names;
+
+  void add(std::string const& name, std::unique_ptr<cudf::column>&& column)
+  {
+    names.push_back(name);
+    columns.push_back(std::move(column));
+  }
+
+  cudf::column_view col(std::string const& name) const
+  {
+    auto const found = std::find(names.begin(), names.end(), name);
+    CUDF_EXPECTS(found != names.end(), "Unknown column");
+    return columns[std::distance(names.begin(), found)]->view();
+  }
+
+  cudf::table_view cols(std::vector<std::string> const& selected) const
+  {
+    std::vector<cudf::column_view> views;
+    for (auto const& name : selected) { views.push_back(col(name)); }
+    return cudf::table_view{views};
+  }
+
+  cudf::table_view view() const { return cols(names); }
+};
+
+/**
+ * @brief The tables of the database, as Parquet files in host memory
+ */
+struct tpch_database {
+  std::map<std::string, std::vector<char>> files;
+};
+
+/**
+ * @brief GPU time of the stages of a profiled run, in milliseconds
+ */
+struct query_profile {
+  std::map<std::string, double> stage_ms;
+};
+
+/**
+ * @brief A stage of a query plan: an NVTX range, also timed with events if `profile` is set
+ */
+class stage {
+ public:
+  stage(char const* name, query_profile* profile) : _range{name}, _name{name}, _profile{profile}
+  {
+    if (_profile == nullptr) { return; }
+    CUDA_TRY(cudaEventCreate(&_start));
+    CUDA_TRY(cudaEventCreate(&_stop));
+    CUDA_TRY(cudaEventRecord(_start, 0));
+  }
+
+  ~stage()
+  {
+    if (_profile == nullptr) { return; }
+    float ms = 0;
+    cudaEventRecord(_stop, 0);
+    cudaEventSynchronize(_stop);
+    cudaEventElapsedTime(&ms, _start, _stop);
+    _profile->stage_ms[_name] += ms;
+    cudaEventDestroy(_start);
+    cudaEventDestroy(_stop);
+  }
+
+  stage(stage const&) = delete;
+  stage& operator=(stage const&) = delete;
+
+ private:
+  nvtx3::domain_thread_range<tpch_domain> _range;
+  std::string _name;
+  query_profile* _profile;
+  cudaEvent_t _start = nullptr;
+  cudaEvent_t _stop  = nullptr;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Operators
+
+frame scan(tpch_database const& db, std::string const& table, std::vector<std::string> columns)
+{
+  auto const& file = db.files.at(table);
+  cudf::io::read_parquet_args args{cudf::io::source_info{file.data(), file.size()}};
+  args.columns = std::move(columns);
+  auto result  = cudf::io::read_parquet(args);
+  frame output;
+  output.columns = result.tbl->release();
+  output.names   = result.metadata.column_names;
+  return output;
+}
+
+frame filter(frame const& input, cudf::column_view const& mask)
+{
+  frame output;
+  output.columns = cudf::apply_boolean_mask(input.view(), mask)->release();
+  output.names   = input.names;
+  return output;
+}
+
+/**
+ * @brief Inner joins two frames, returning the columns of the left frame then those of the right
+ */
+frame join(frame const& left,
+           std::vector<std::string> const& left_on,
+           frame const& right,
+           std::vector<std::string> const& right_on)
+{
+  auto const maps = cudf::inner_join(left.cols(left_on), right.cols(right_on));
+  auto left_rows  = cudf::gather(left.view(), maps.first->view())->release();
+  auto right_rows = cudf::gather(right.view(), maps.second->view())->release();
+  frame output;
+  output.columns = std::move(left_rows);
+  output.names   = left.names;
+  for (size_t i = 0; i < right_rows.size(); ++i) {
+    output.add(right.names[i], std::move(right_rows[i]));
+  }
+  return output;
+}
+
+enum class agg { SUM, MEAN, COUNT };
+
+/**
+ * @brief Groups a frame by its `keys` columns, returning the keys and one `<agg>_<column>` column
+ * per aggregation
+ */
+frame aggregate(frame const& input,
+                std::vector<std::string> const& keys,
+                std::vector<std::pair<agg, std::string>> const& aggregations)
+{
+  cudf::groupby::groupby grouper(input.cols(keys));
+  std::vector<cudf::groupby::aggregation_request> requests(aggregations.size());
+  frame output;
+  output.names = keys;
+  for (size_t i = 0; i < aggregations.size(); ++i) {
+    requests[i].values = input.col(aggregations[i].second);
+    switch (aggregations[i].first) {
+      case agg::SUM:
+        requests[i].aggregations.push_back(cudf::make_sum_aggregation());
+        output.names.push_back("sum_" + aggregations[i].second);
+        break;
+      case agg::MEAN:
+        requests[i].aggregations.push_back(cudf::make_mean_aggregation());
+        output.names.push_back("mean_" + aggregations[i].second);
+        break;
+      case agg::COUNT:
+        requests[i].aggregations.push_back(cudf::make_count_aggregation());
+        output.names.push_back("count_" + aggregations[i].second);
+        break;
+    }
+  }
+  auto result    = grouper.aggregate(requests);
+  output.columns = result.first->release();
+  for (auto& request_result : result.second) {
+    output.columns.push_back(std::move(request_result.results.front()));
+  }
+  return output;
+}
+
+frame sort(frame const& input,
+           std::vector<std::string> const& keys,
+           std::vector<cudf::order> const& column_order)
+{
+  frame output;
+  output.columns = cudf::sort_by_key(input.view(), input.cols(keys), column_order)->release();
+  output.names   = input.names;
+  return output;
+}
+
+frame head(frame const& input, cudf::size_type num_rows)
+{
+  auto const end = std::min(num_rows, input.view().num_rows());
+  frame output;
+  output.columns = std::make_unique<cudf::table>(cudf::slice(input.view(), {0, end})[0])->release();
+  output.names   = input.names;
+  return output;
+}
+
+std::unique_ptr<cudf::column> compare(cudf::column_view const& column,
+                                      cudf::scalar const& value,
+                                      cudf::binary_operator op)
+{
+  return cudf::binary_operation(column, value, op, bool8);
+}
+
+std::unique_ptr<cudf::column> both(std::unique_ptr<cudf::column> const& lhs,
+                                   std::unique_ptr<cudf::column> const& rhs)
+{
+  return cudf::binary_operation(*lhs, *rhs, cudf::binary_operator::LOGICAL_AND, bool8);
+}
+
+cudf::timestamp_scalar<cudf::timestamp_D> date(int32_t days)
+{
+  return cudf::timestamp_scalar<cudf::timestamp_D>(cudf::timestamp_D{cudf::duration_D{days}});
+}
+
+/**
+ * @brief Returns `l_extendedprice * (1 - l_discount)`
+ */
+std::unique_ptr<cudf::column> discounted_price(frame const& input)
+{
+  auto const one_minus_discount =
+    cudf::binary_operation(cudf::numeric_scalar<double>(1),
+                           input.col("l_discount"),
+                           cudf::binary_operator::SUB,
+                           float64);
+  return cudf::binary_operation(
+    input.col("l_extendedprice"), *one_minus_discount, cudf::binary_operator::MUL, float64);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Queries
+
+/**
+ * @brief Pricing summary report: aggregates of the line items shipped before a date
+ */
+void q1(tpch_database const& db, query_profile* profile)
+{
+  frame lineitem;
+  {
+    stage s{"q1/scan", profile};
+    lineitem = scan(db,
+                    "lineitem",
+                    {"l_returnflag",
+                     "l_linestatus",
+                     "l_quantity",
+                     "l_extendedprice",
+                     "l_discount",
+                     "l_tax",
+                     "l_shipdate"});
+  }
+  {
+    stage s{"q1/filter", profile};
+    auto const mask = compare(
+      lineitem.col("l_shipdate"), date(date_1998_09_02), cudf::binary_operator::LESS_EQUAL);
+    lineitem = filter(lineitem, *mask);
+  }
+  {
+    stage s{"q1/project", profile};
+    auto disc_price         = discounted_price(lineitem);
+    auto const one_plus_tax = cudf::binary_operation(lineitem.col("l_tax"),
+                                                     cudf::numeric_scalar<double>(1),
+                                                     cudf::binary_operator::ADD,
+                                                     float64);
+    auto charge =
+      cudf::binary_operation(*disc_price, *one_plus_tax, cudf::binary_operator::MUL, float64);
+    lineitem.add("disc_price", std::move(disc_price));
+    lineitem.add("charge", std::move(charge));
+  }
+  frame result;
+  {
+    stage s{"q1/groupby", profile};
+    result = aggregate(lineitem,
+                       {"l_returnflag", "l_linestatus"},
+                       {{agg::SUM, "l_quantity"},
+                        {agg::SUM, "l_extendedprice"},
+                        {agg::SUM, "disc_price"},
+                        {agg::SUM, "charge"},
+                        {agg::MEAN, "l_quantity"},
+                        {agg::MEAN, "l_extendedprice"},
+                        {agg::MEAN, "l_discount"},
+                        {agg::COUNT, "l_quantity"}});
+  }
+  {
+    stage s{"q1/sort", profile};
+    result = sort(
+      result, {"l_returnflag", "l_linestatus"}, {cudf::order::ASCENDING, cudf::order::ASCENDING});
+  }
+}
+
+/**
+ * @brief Shipping priority: the 10 unshipped orders of a market segment with the most revenue
+ */
+void q3(tpch_database const& db, query_profile* profile)
+{
+  frame customer;
+  frame orders;
+  frame lineitem;
+  {
+    stage s{"q3/scan", profile};
+    customer = scan(db, "customer", {"c_custkey", "c_mktsegment"});
+    orders   = scan(db, "orders", {"o_orderkey", "o_custkey", "o_orderdate", "o_shippriority"});
+    lineitem = scan(db, "lineitem", {"l_orderkey", "l_extendedprice", "l_discount", "l_shipdate"});
+  }
+  {
+    stage s{"q3/filter", profile};
+    auto const segment = compare(customer.col("c_mktsegment"),
+                                 cudf::numeric_scalar<int32_t>(1),
+                                 cudf::binary_operator::EQUAL);
+    customer = filter(customer, *segment);
+    auto const ordered =
+      compare(orders.col("o_orderdate"), date(date_1995_03_15), cudf::binary_operator::LESS);
+    orders = filter(orders, *ordered);
+    auto const shipped =
+      compare(lineitem.col("l_shipdate"), date(date_1995_03_15), cudf::binary_operator::GREATER);
+    lineitem = filter(lineitem, *shipped);
+  }
+  frame joined;
+  {
+    stage s{"q3/join", profile};
+    auto const customer_orders = join(customer, {"c_custkey"}, orders, {"o_custkey"});
+    joined = join(lineitem, {"l_orderkey"}, customer_orders, {"o_orderkey"});
+  }
+  {
+    stage s{"q3/project", profile};
+    joined.add("revenue", discounted_price(joined));
+  }
+  frame result;
+  {
+    stage s{"q3/groupby", profile};
+    result = aggregate(
+      joined, {"l_orderkey", "o_orderdate", "o_shippriority"}, {{agg::SUM, "revenue"}});
+  }
+  {
+    stage s{"q3/sort", profile};
+    result = head(sort(result,
+                       {"sum_revenue", "o_orderdate"},
+                       {cudf::order::DESCENDING, cudf::order::ASCENDING}),
+                  10);
+  }
+}
+
+/**
+ * @brief Local supplier volume: the revenue of the orders of a region supplied from the nation of
+ * the customer, by nation
+ */
+void q5(tpch_database const& db, query_profile* profile)
+{
+  frame region;
+  frame nation;
+  frame customer;
+  frame orders;
+  frame lineitem;
+  frame supplier;
+  {
+    stage s{"q5/scan", profile};
+    region   = scan(db, "region", {"r_regionkey"});
+    nation   = scan(db, "nation", {"n_nationkey", "n_regionkey", "n_name"});
+    customer = scan(db, "customer", {"c_custkey", "c_nationkey"});
+    orders   = scan(db, "orders", {"o_orderkey", "o_custkey", "o_orderdate"});
+    lineitem = scan(db, "lineitem", {"l_orderkey", "l_suppkey", "l_extendedprice", "l_discount"});
+    supplier = scan(db, "supplier", {"s_suppkey", "s_nationkey"});
+  }
+  {
+    stage s{"q5/filter", profile};
+    auto const asia = compare(region.col("r_regionkey"),
+                              cudf::numeric_scalar<int32_t>(2),
+                              cudf::binary_operator::EQUAL);
+    region = filter(region, *asia);
+    auto const ordered = both(compare(orders.col("o_orderdate"),
+                                      date(date_1994_01_01),
+                                      cudf::binary_operator::GREATER_EQUAL),
+                              compare(orders.col("o_orderdate"),
+                                      date(date_1995_01_01),
+                                      cudf::binary_operator::LESS));
+    orders = filter(orders, *ordered);
+  }
+  frame joined;
+  {
+    stage s{"q5/join", profile};
+    auto const nations   = join(nation, {"n_regionkey"}, region, {"r_regionkey"});
+    auto const customers = join(customer, {"c_nationkey"}, nations, {"n_nationkey"});
+    auto const ordered   = join(orders, {"o_custkey"}, customers, {"c_custkey"});
+    auto const items     = join(lineitem, {"l_orderkey"}, ordered, {"o_orderkey"});
+    joined =
+      join(items, {"l_suppkey", "c_nationkey"}, supplier, {"s_suppkey", "s_nationkey"});
+  }
+  {
+    stage s{"q5/project", profile};
+    joined.add("revenue", discounted_price(joined));
+  }
+  frame result;
+  {
+    stage s{"q5/groupby", profile};
+    result = aggregate(joined, {"n_nationkey", "n_name"}, {{agg::SUM, "revenue"}});
+  }
+  {
+    stage s{"q5/sort", profile};
+    result = sort(result, {"sum_revenue"}, {cudf::order::DESCENDING});
+  }
+}
+
+/**
+ * @brief Forecasting revenue change: the revenue of the line items of a year within a range of
+ * discounts and quantities
+ */
+void q6(tpch_database const& db, query_profile* profile)
+{
+  frame lineitem;
+  {
+    stage s{"q6/scan", profile};
+    lineitem = scan(db, "lineitem", {"l_shipdate", "l_discount", "l_quantity", "l_extendedprice"});
+  }
+  {
+    stage s{"q6/filter", profile};
+    auto const shipped    = both(compare(lineitem.col("l_shipdate"),
+                                         date(date_1994_01_01),
+                                         cudf::binary_operator::GREATER_EQUAL),
+                                 compare(lineitem.col("l_shipdate"),
+                                         date(date_1995_01_01),
+                                         cudf::binary_operator::LESS));
+    auto const discounted = both(compare(lineitem.col("l_discount"),
+                                         cudf::numeric_scalar<double>(0.05),
+                                         cudf::binary_operator::GREATER_EQUAL),
+                                 compare(lineitem.col("l_discount"),
+                                         cudf::numeric_scalar<double>(0.07),
+                                         cudf::binary_operator::LESS_EQUAL));
+    auto const small      = compare(lineitem.col("l_quantity"),
+                                    cudf::numeric_scalar<double>(24),
+                                    cudf::binary_operator::LESS);
+    lineitem = filter(lineitem, *both(both(shipped, discounted), small));
+  }
+  {
+    stage s{"q6/aggregate", profile};
+    auto const revenue = cudf::binary_operation(lineitem.col("l_extendedprice"),
+                                                lineitem.col("l_discount"),
+                                                cudf::binary_operator::MUL,
+                                                float64);
+    cudf::reduce(*revenue, cudf::make_sum_aggregation(), float64);
+  }
+}
+
+/**
+ * @brief Product type profit measure: the profit on a kind of parts, by supplier nation and year
+ */
+void q9(tpch_database const& db, query_profile* profile)
+{
+  frame part;
+  frame supplier;
+  frame lineitem;
+  frame partsupp;
+  frame orders;
+  frame nation;
+  {
+    stage s{"q9/scan", profile};
+    part     = scan(db, "part", {"p_partkey", "p_category"});
+    supplier = scan(db, "supplier", {"s_suppkey", "s_nationkey"});
+    lineitem = scan(db,
+                    "lineitem",
+                    {"l_orderkey",
+                     "l_partkey",
+                     "l_suppkey",
+                     "l_quantity",
+                     "l_extendedprice",
+                     "l_discount"});
+    partsupp = scan(db, "partsupp", {"ps_partkey", "ps_suppkey", "ps_supplycost"});
+    orders   = scan(db, "orders", {"o_orderkey", "o_orderdate"});
+    nation   = scan(db, "nation", {"n_nationkey", "n_name"});
+  }
+  {
+    stage s{"q9/filter", profile};
+    auto const green = compare(
+      part.col("p_category"), cudf::numeric_scalar<int32_t>(5), cudf::binary_operator::LESS);
+    part = filter(part, *green);
+  }
+  frame joined;
+  {
+    stage s{"q9/join", profile};
+    auto const parts     = join(lineitem, {"l_partkey"}, part, {"p_partkey"});
+    auto const suppliers = join(parts, {"l_suppkey"}, supplier, {"s_suppkey"});
+    auto const costs =
+      join(suppliers, {"l_partkey", "l_suppkey"}, partsupp, {"ps_partkey", "ps_suppkey"});
+    auto const ordered = join(costs, {"l_orderkey"}, orders, {"o_orderkey"});
+    joined             = join(ordered, {"s_nationkey"}, nation, {"n_nationkey"});
+  }
+  {
+    stage s{"q9/project", profile};
+    auto const cost = cudf::binary_operation(
+      joined.col("ps_supplycost"), joined.col("l_quantity"), cudf::binary_operator::MUL, float64);
+    auto amount =
+      cudf::binary_operation(*discounted_price(joined), *cost, cudf::binary_operator::SUB, float64);
+    joined.add("amount", std::move(amount));
+    joined.add("o_year", cudf::datetime::extract_year(joined.col("o_orderdate")));
+  }
+  frame result;
+  {
+    stage s{"q9/groupby", profile};
+    result = aggregate(joined, {"n_nationkey", "n_name", "o_year"}, {{agg::SUM, "amount"}});
+  }
+  {
+    stage s{"q9/sort", profile};
+    result =
+      sort(result, {"n_name", "o_year"}, {cudf::order::ASCENDING, cudf::order::DESCENDING});
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Data generation
+
+column_profile value_profile(cudf::type_id id, double lower, double upper)
+{
+  column_profile profile{id};
+  profile.null_probability = 0;
+  profile.lower_bound      = lower;
+  profile.upper_bound      = upper;
+  return profile;
+}
+
+/**
+ * @brief Uniformly distributed keys of `[0, num_keys)`
+ */
+column_profile key_profile(cudf::size_type num_keys)
+{
+  auto profile        = value_profile(cudf::type_id::INT32, 0, num_keys);
+  profile.cardinality = num_keys;
+  return profile;
+}
+
+column_profile strings_profile(cudf::size_type cardinality,
+                               cudf::size_type min_length,
+                               cudf::size_type max_length)
+{
+  column_profile profile{cudf::type_id::STRING};
+  profile.null_probability = 0;
+  profile.cardinality      = cardinality;
+  profile.min_length       = min_length;
+  profile.max_length       = max_length;
+  return profile;
+}
+
+std::unique_ptr<cudf::column> int32_op(cudf::column_view const& lhs,
+                                       int32_t rhs,
+                                       cudf::binary_operator op)
+{
+  return cudf::binary_operation(lhs, cudf::numeric_scalar<int32_t>(rhs), op, int32);
+}
+
+/**
+ * @brief Returns the supplier of the `i`th of the 4 suppliers of each part, as in
+ * `(part + i * (suppliers / 4)) % suppliers`
+ */
+std::unique_ptr<cudf::column> part_supplier(cudf::column_view const& part,
+                                            cudf::column_view const& i,
+                                            cudf::size_type num_suppliers)
+{
+  auto const stride = int32_op(i, std::max(num_suppliers / 4, 1), cudf::binary_operator::MUL);
+  auto const sum    = cudf::binary_operation(part, *stride, cudf::binary_operator::ADD, int32);
+  return int32_op(*sum, num_suppliers, cudf::binary_operator::MOD);
+}
+
+std::vector<char> write_table(frame const& table)
+{
+  cudf::io::table_metadata metadata;
+  metadata.column_names = table.names;
+  std::vector<char> buffer;
+  cudf::io::write_parquet_args args{cudf::io::sink_info{&buffer}, table.view(), &metadata};
+  cudf::io::write_parquet(args);
+  return buffer;
+}
+
+tpch_database generate_database(double scale_factor)
+{
+  auto const rows = [scale_factor](double base) {
+    return std::max(static_cast<cudf::size_type>(base * scale_factor), cudf::size_type{1});
+  };
+  auto const num_suppliers = rows(10000);
+  auto const num_parts     = rows(200000);
+  auto const num_customers = rows(150000);
+  auto const num_orders    = rows(1500000);
+  auto const num_lineitems = rows(6000000);
+
+  uint64_t seed     = 0;
+  auto const random = [&seed](column_profile const& profile, cudf::size_type num_rows) {
+    return create_random_column(profile, num_rows, seed++);
+  };
+  auto const primary_key = [](cudf::size_type num_rows) {
+    return cudf::sequence(num_rows, cudf::numeric_scalar<int32_t>(0));
+  };
+  auto const date_profile = [](int32_t first, int32_t last) {
+    return value_profile(cudf::type_id::TIMESTAMP_DAYS, first, last + 1);
+  };
+
+  tpch_database db;
+  {
+    frame region;
+    region.add("r_regionkey", primary_key(5));
+    region.add("r_name", random(strings_profile(5, 4, 11), 5));
+    db.files["region"] = write_table(region);
+  }
+  {
+    frame nation;
+    nation.add("n_nationkey", primary_key(25));
+    nation.add("n_regionkey", int32_op(nation.col("n_nationkey"), 5, cudf::binary_operator::MOD));
+    nation.add("n_name", random(strings_profile(25, 4, 14), 25));
+    db.files["nation"] = write_table(nation);
+  }
+  {
+    frame supplier;
+    supplier.add("s_suppkey", primary_key(num_suppliers));
+    supplier.add("s_nationkey", random(key_profile(25), num_suppliers));
+    db.files["supplier"] = write_table(supplier);
+  }
+  {
+    frame customer;
+    customer.add("c_custkey", primary_key(num_customers));
+    customer.add("c_nationkey", random(key_profile(25), num_customers));
+    customer.add("c_mktsegment", random(key_profile(5), num_customers));
+    db.files["customer"] = write_table(customer);
+  }
+  {
+    frame part;
+    part.add("p_partkey", primary_key(num_parts));
+    part.add("p_category", random(key_profile(100), num_parts));
+    db.files["part"] = write_table(part);
+  }
+  {
+    // Each part has 4 suppliers
+    auto const index = primary_key(num_parts * 4);
+    frame partsupp;
+    partsupp.add("ps_partkey", int32_op(*index, 4, cudf::binary_operator::DIV));
+    auto const i = int32_op(*index, 4, cudf::binary_operator::MOD);
+    partsupp.add("ps_suppkey", part_supplier(partsupp.col("ps_partkey"), *i, num_suppliers));
+    partsupp.add("ps_supplycost",
+                 random(value_profile(cudf::type_id::FLOAT64, 1, 1000), num_parts * 4));
+    db.files["partsupp"] = write_table(partsupp);
+  }
+  {
+    frame orders;
+    orders.add("o_orderkey", primary_key(num_orders));
+    orders.add("o_custkey", random(key_profile(num_customers), num_orders));
+    orders.add("o_orderdate", random(date_profile(date_1992_01_01, date_1998_08_02), num_orders));
+    orders.add("o_shippriority", random(key_profile(1), num_orders));
+    db.files["orders"] = write_table(orders);
+  }
+  {
+    frame lineitem;
+    lineitem.add("l_orderkey", random(key_profile(num_orders), num_lineitems));
+    lineitem.add("l_partkey", random(key_profile(num_parts), num_lineitems));
+    auto const i = random(key_profile(4), num_lineitems);
+    lineitem.add("l_suppkey", part_supplier(lineitem.col("l_partkey"), *i, num_suppliers));
+    lineitem.add("l_quantity", random(value_profile(cudf::type_id::FLOAT64, 1, 51), num_lineitems));
+    lineitem.add("l_extendedprice",
+                 random(value_profile(cudf::type_id::FLOAT64, 900, 105000), num_lineitems));
+    lineitem.add("l_discount",
+                 random(value_profile(cudf::type_id::FLOAT64, 0, 0.1), num_lineitems));
+    lineitem.add("l_tax", random(value_profile(cudf::type_id::FLOAT64, 0, 0.08), num_lineitems));
+    lineitem.add("l_returnflag", random(strings_profile(3, 1, 1), num_lineitems));
+    lineitem.add("l_linestatus", random(strings_profile(2, 1, 1), num_lineitems));
+    lineitem.add("l_shipdate",
+                 random(date_profile(date_1992_01_01 + 1, date_1998_12_01), num_lineitems));
+    db.files["lineitem"] = write_table(lineitem);
+  }
+  return db;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks
+
+/**
+ * @brief Runs a query on a database of scale factor `state.range(0) / 100`
+ */
+struct tpch_benchmark {
+  void (*query)(tpch_database const&, query_profile*);
+
+  void operator()(::benchmark::State& state) const
+  {
+    auto const db = generate_database(state.range(0) / 100.0);
+
+    cudf::current_memory_tracker()->reset_peak();
+    for (auto _ : state) {
+      cuda_event_timer timer(state, true);
+      query(db, nullptr);
+    }
+
+    // One more run reports the time of the stages and of the libcudf operations
+    query_profile profile;
+    cudf::enable_profiler();
+    query(db, &profile);
+    auto const operations = cudf::get_profiles();
+    cudf::disable_profiler();
+    cudf::reset_profiles();
+    for (auto const& stage_ms : profile.stage_ms) {
+      state.counters[stage_ms.first + "_ms"] = stage_ms.second;
+    }
+    for (auto const& operation : operations) {
+      state.counters["cudf::" + operation.name + "_ms"] = operation.gpu_time_ms;
+    }
+  }
+};
+
+std::vector<cudf::benchmark_axis> const tpch_axes{{"scale_factor_x100", {1, 10, 100}}};
+
+auto const tpch_benchmarks = [] {
+  cudf::register_benchmark("TPCH/Q1", tpch_benchmark{q1}, tpch_axes);
+  cudf::register_benchmark("TPCH/Q3", tpch_benchmark{q3}, tpch_axes);
+  cudf::register_benchmark("TPCH/Q5", tpch_benchmark{q5}, tpch_axes);
+  cudf::register_benchmark("TPCH/Q6", tpch_benchmark{q6}, tpch_axes);
+  cudf::register_benchmark("TPCH/Q9", tpch_benchmark{q9}, tpch_axes);
+  return 5;
+}();
+
+}  // namespace
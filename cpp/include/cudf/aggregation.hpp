@@ -50,27 +50,33 @@ class aggregation {
    * @brief Possible aggregation operations
    */
   enum Kind {
-    SUM,             ///< sum reduction
-    PRODUCT,         ///< product reduction
-    MIN,             ///< min reduction
-    MAX,             ///< max reduction
-    COUNT_VALID,     ///< count number of valid elements
-    COUNT_ALL,       ///< count number of elements
-    ANY,             ///< any reduction
-    ALL,             ///< all reduction
-    SUM_OF_SQUARES,  ///< sum of squares reduction
-    MEAN,            ///< arithmetic mean reduction
-    VARIANCE,        ///< groupwise variance
-    STD,             ///< groupwise standard deviation
-    MEDIAN,          ///< median reduction
-    QUANTILE,        ///< compute specified quantile(s)
-    ARGMAX,          ///< Index of max element
-    ARGMIN,          ///< Index of min element
-    NUNIQUE,         ///< count number of unique elements
-    NTH_ELEMENT,     ///< get the nth element
-    ROW_NUMBER,      ///< get row-number of element
-    PTX,             ///< PTX UDF based reduction
-    CUDA             ///< CUDA UDf based reduction
+    SUM,                    ///< sum reduction
+    PRODUCT,                ///< product reduction
+    MIN,                    ///< min reduction
+    MAX,                    ///< max reduction
+    COUNT_VALID,            ///< count number of valid elements
+    COUNT_ALL,              ///< count number of elements
+    ANY,                    ///< any reduction
+    ALL,                    ///< all reduction
+    SUM_OF_SQUARES,         ///< sum of squares reduction
+    MEAN,                   ///< arithmetic mean reduction
+    VARIANCE,               ///< groupwise variance
+    STD,                    ///< groupwise standard deviation
+    MEDIAN,                 ///< median reduction
+    QUANTILE,               ///< compute specified quantile(s)
+    ARGMAX,                 ///< Index of max element
+    ARGMIN,                 ///< Index of min element
+    NUNIQUE,                ///< count number of unique elements
+    NTH_ELEMENT,            ///< get the nth element
+    ROW_NUMBER,             ///< get row-number of element
+    APPROX_COUNT_DISTINCT,  ///< approximate number of distinct elements
+    APPROX_QUANTILE,        ///< approximate quantile(s) from a t-digest
+    LEAD,                   ///< window function, accesses row at specified offset following row
+    LAG,                    ///< window function, accesses row at specified offset preceding row
+    COLLECT,                ///< collect values into a list
+    RANK,                   ///< rank of a row within its group
+    PTX,                    ///< PTX UDF based reduction
+    CUDA                    ///< CUDA UDf based reduction
   };
 
   aggregation(aggregation::Kind a) : kind{a} {}
@@ -192,6 +198,70 @@ std::unique_ptr<aggregation> make_nth_element_aggregation(
 /// Factory to create a ROW_NUMBER aggregation
 std::unique_ptr<aggregation> make_row_number_aggregation();
 
+/**
+ * @brief Factory to create a LEAD aggregation
+ *
+ * In a rolling window, `lead` returns the row `offset` rows after the current row if it is in the
+ * window of the current row, and null otherwise.
+ *
+ * @param offset Number of rows after the current row
+ */
+std::unique_ptr<aggregation> make_lead_aggregation(size_type offset);
+
+/**
+ * @brief Factory to create a LAG aggregation
+ *
+ * In a rolling window, `lag` returns the row `offset` rows before the current row if it is in the
+ * window of the current row, and null otherwise.
+ *
+ * @param offset Number of rows before the current row
+ */
+std::unique_ptr<aggregation> make_lag_aggregation(size_type offset);
+
+/**
+ * @brief Factory to create a COLLECT aggregation
+ *
+ * `collect` returns the list of the values of the window/group, including nulls.
+ */
+std::unique_ptr<aggregation> make_collect_aggregation();
+
+/**
+ * @brief Factory to create a RANK aggregation
+ *
+ * In a groupby scan, `rank` returns the one-based rank of each row within its group, in the order
+ * of the rows in the group. Rows equal to the previous row of the group get the same rank as that
+ * row, and the next distinct row gets its one-based position in the group. Ranks are meaningful
+ * when the rows of each group are ordered by the values.
+ */
+std::unique_ptr<aggregation> make_rank_aggregation();
+
+/**
+ * @brief Factory to create an `approx_count_distinct` aggregation
+ *
+ * `approx_count_distinct` estimates the number of distinct non-null elements
+ * with a HyperLogLog sketch of `2^precision` one byte registers. The relative
+ * standard error of the estimate is about `1.04 / sqrt(2^precision)`, i.e.
+ * 0.8% for the default precision.
+ *
+ * @param precision Base 2 logarithm of the number of registers of each
+ * sketch, in `[4, 18]`.
+ */
+std::unique_ptr<aggregation> make_approx_count_distinct_aggregation(int precision = 14);
+
+/**
+ * @brief Factory to create an `approx_quantile` aggregation
+ *
+ * `approx_quantile` estimates quantiles of the non-null numeric elements from a
+ * t-digest, without sorting them. The digest holds at most about
+ * `compression / 2` centroids, which are smallest at the tails so that extreme
+ * quantiles are the most accurate.
+ *
+ * @param q The desired quantiles, in `[0, 1]`
+ * @param compression Accuracy of the t-digest, at least 1
+ */
+std::unique_ptr<aggregation> make_approx_quantile_aggregation(std::vector<double> const& q,
+                                                              double compression = 100);
+
 /**
  * @brief Factory to create an aggregation base on UDF for PTX or CUDA
  *
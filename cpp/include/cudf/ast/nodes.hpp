@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/operators.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace cudf {
+namespace ast {
+namespace detail {
+class expression_linearizer;
+}  // namespace detail
+
+/**
+ * @addtogroup transformation_expressions
+ * @{
+ */
+
+/**
+ * @brief Table a column reference refers to
+ *
+ * Expressions evaluated against a single table refer to its columns as `LEFT`; join predicates
+ * refer to the columns of the left and right tables.
+ */
+enum class table_reference { LEFT, RIGHT };
+
+/**
+ * @brief Node of an expression tree
+ *
+ * Nodes refer to their operands without owning them; the whole tree must outlive its evaluation.
+ */
+class expression {
+ public:
+  virtual ~expression() = default;
+
+  /**
+   * @brief Appends the node to a linearized expression
+   *
+   * @return Index of the node's result in the linearized expression
+   */
+  virtual size_type accept(detail::expression_linearizer &visitor) const = 0;
+};
+
+/**
+ * @brief A constant value
+ *
+ * Supports the numeric and BOOL8 scalars. A null scalar is a null literal.
+ */
+class literal : public expression {
+ public:
+  explicit literal(cudf::scalar const &value) : _value(value) {}
+
+  cudf::scalar const &get_value() const { return _value; }
+
+  size_type accept(detail::expression_linearizer &visitor) const override;
+
+ private:
+  cudf::scalar const &_value;
+};
+
+/**
+ * @brief A column of a table the expression is evaluated against
+ *
+ * Supports the numeric and BOOL8 columns.
+ */
+class column_reference : public expression {
+ public:
+  explicit column_reference(size_type column_index, table_reference table = table_reference::LEFT)
+    : _column_index(column_index), _table(table)
+  {
+  }
+
+  size_type get_column_index() const { return _column_index; }
+
+  table_reference get_table() const { return _table; }
+
+  size_type accept(detail::expression_linearizer &visitor) const override;
+
+ private:
+  size_type _column_index;
+  table_reference _table;
+};
+
+/**
+ * @brief An operator applied to one or two operand nodes
+ */
+class operation : public expression {
+ public:
+  /**
+   * @brief Constructs a unary operation
+   *
+   * @throw cudf::logic_error if `op` is not a unary operator
+   */
+  operation(ast_operator op, expression const &input);
+
+  /**
+   * @brief Constructs a binary operation
+   *
+   * @throw cudf::logic_error if `op` is not a binary operator
+   */
+  operation(ast_operator op, expression const &left, expression const &right);
+
+  ast_operator get_operator() const { return _op; }
+
+  std::vector<std::reference_wrapper<expression const>> const &get_operands() const
+  {
+    return _operands;
+  }
+
+  size_type accept(detail::expression_linearizer &visitor) const override;
+
+ private:
+  ast_operator _op;
+  std::vector<std::reference_wrapper<expression const>> _operands;
+};
+
+/** @} */  // end of group
+}  // namespace ast
+}  // namespace cudf
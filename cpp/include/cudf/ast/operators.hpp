@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace cudf {
+namespace ast {
+/**
+ * @addtogroup transformation_expressions
+ * @{
+ */
+
+/**
+ * @brief Operators of an expression tree
+ *
+ * Unless noted otherwise, the result of an operator is null if any operand is null.
+ */
+enum class ast_operator : int32_t {
+  // Binary operators
+  ADD,            ///< operator +
+  SUB,            ///< operator -
+  MUL,            ///< operator *
+  DIV,            ///< operator / using the promoted type; integer division by zero is null
+  TRUE_DIV,       ///< operator / after promotion to floating point
+  MOD,            ///< operator % using the promoted type; integer modulo by zero is null
+  EQUAL,          ///< operator ==
+  NOT_EQUAL,      ///< operator !=
+  LESS,           ///< operator <
+  GREATER,        ///< operator >
+  LESS_EQUAL,     ///< operator <=
+  GREATER_EQUAL,  ///< operator >=
+  LOGICAL_AND,    ///< operator &&, with SQL semantics: `false && null` is `false`
+  LOGICAL_OR,     ///< operator ||, with SQL semantics: `true || null` is `true`
+  // Unary operators
+  NOT,      ///< operator !
+  NEGATE,   ///< operator - (unary)
+  ABS,      ///< Absolute value
+  IS_NULL,  ///< Whether the operand is null; never null
+};
+
+/**
+ * @brief Returns the number of operands of an operator
+ */
+constexpr int ast_operator_arity(ast_operator op)
+{
+  return (op == ast_operator::NOT || op == ast_operator::NEGATE || op == ast_operator::ABS ||
+          op == ast_operator::IS_NULL)
+           ? 1
+           : 2;
+}
+
+/** @} */  // end of group
+}  // namespace ast
+}  // namespace cudf
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/nodes.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace ast {
+/**
+ * @addtogroup transformation_expressions
+ * @{
+ */
+
+/**
+ * @brief Evaluates an expression tree against the rows of a table, in a single kernel
+ *
+ * The tree is linearized on the host and interpreted by every device thread for its rows, so
+ * the intermediate results stay in registers instead of being materialized as columns. Operands
+ * are promoted to a common type: integers and booleans to INT64 and floating-point values to
+ * FLOAT64. Arithmetic results are INT64, or FLOAT64 if any operand is floating-point or the
+ * operator is TRUE_DIV; comparison and logical results are BOOL8.
+ *
+ * @throw cudf::logic_error if a column index is out of range, if a column or literal type is not
+ * supported, or if the expression needs more than 16 intermediate results at once
+ *
+ * @param table The table whose columns the expression refers to
+ * @param expr The root of the expression tree
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return A column with one value per row of `table`
+ */
+std::unique_ptr<column> compute_column(
+  table_view const &table,
+  expression const &expr,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace ast
+}  // namespace cudf
@@ -20,6 +20,7 @@
 #include <cudf/scalar/scalar.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 
@@ -147,6 +148,27 @@ std::unique_ptr<column> binary_operation(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns the scale of the result of a binary operation between fixed-point operands.
+ *
+ * Fixed-point operands of `binary_operation` must be of the same type (`DECIMAL32` or
+ * `DECIMAL64`), with any scales. The supported operators and their output types are:
+ * - `ADD` and `SUB`: the operand type with the smaller of the two scales;
+ * - `MUL`: the operand type with the sum of the scales;
+ * - `DIV`: the operand type with the difference of the scales, the stored integers being divided
+ *   with truncation;
+ * - comparisons: `BOOL8`, the operands being compared at the smaller of their scales.
+ *
+ * @param op          The arithmetic binary operator
+ * @param left_scale  The scale of the left operand
+ * @param right_scale The scale of the right operand
+ * @return            The scale of the output of `op`
+ * @throw cudf::logic_error if @p op is not `ADD`, `SUB`, `MUL` or `DIV`
+ */
+int32_t binary_operation_fixed_point_scale(binary_operator op,
+                                           int32_t left_scale,
+                                           int32_t right_scale);
+
 /**
  * @brief Performs a binary operation between two columns using a
  * user-defined PTX function.
@@ -176,5 +198,31 @@ std::unique_ptr<column> binary_operation(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Operator and operand types of a binary operation to compile ahead of time.
+ */
+struct binary_operation_signature {
+  binary_operator op;     ///< The binary operator
+  data_type lhs_type;     ///< Data type of the left operand
+  data_type rhs_type;     ///< Data type of the right operand
+  data_type output_type;  ///< Data type of the output column
+};
+
+/**
+ * @brief Compiles the kernels used by `binary_operation` for the given signatures ahead of time.
+ *
+ * The kernels for column-column, column-scalar and scalar-column operands are compiled for the
+ * architecture of the current device. Compiled kernels are kept for the lifetime of the process
+ * and, when the kernel file cache is enabled, saved as cubins under `LIBCUDF_KERNEL_CACHE_PATH`,
+ * so later processes on the same GPU architecture load them without invoking the JIT compiler.
+ *
+ * Calling this once at startup moves the JIT compilation latency out of the first
+ * `binary_operation` calls.
+ *
+ * @param signatures Binary operations to compile
+ * @throw cudf::logic_error if a data type in @p signatures isn't fixed width
+ */
+void precompile_binary_operations(std::vector<binary_operation_signature> const& signatures);
+
 /** @} */  // end of group
 }  // namespace cudf
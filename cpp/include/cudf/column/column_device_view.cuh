@@ -718,6 +718,50 @@ __device__ inline dictionary32 const column_device_view::element<dictionary32>(
   return dictionary32{d_children[0].element<int32_t>(index)};
 }
 
+/**
+ * @brief Returns a `numeric::decimal32` element at the specified index for a `DECIMAL32` column.
+ *
+ * The element is constructed from the stored integer and the scale of the column's type.
+ *
+ * If the element at the specified index is NULL, i.e., `is_null(element_index) == true`,
+ * then any attempt to use the result will lead to undefined behavior.
+ *
+ * This function accounts for the offset.
+ *
+ * @param element_index Position of the desired element
+ * @return numeric::decimal32 representing the element at this index
+ */
+template <>
+__device__ inline numeric::decimal32 const column_device_view::element<numeric::decimal32>(
+  size_type element_index) const noexcept
+{
+  using namespace numeric;
+  return decimal32{scaled_integer<int32_t>{data<int32_t>()[element_index],
+                                           scale_type{type().scale()}}};
+}
+
+/**
+ * @brief Returns a `numeric::decimal64` element at the specified index for a `DECIMAL64` column.
+ *
+ * The element is constructed from the stored integer and the scale of the column's type.
+ *
+ * If the element at the specified index is NULL, i.e., `is_null(element_index) == true`,
+ * then any attempt to use the result will lead to undefined behavior.
+ *
+ * This function accounts for the offset.
+ *
+ * @param element_index Position of the desired element
+ * @return numeric::decimal64 representing the element at this index
+ */
+template <>
+__device__ inline numeric::decimal64 const column_device_view::element<numeric::decimal64>(
+  size_type element_index) const noexcept
+{
+  using namespace numeric;
+  return decimal64{scaled_integer<int64_t>{data<int64_t>()[element_index],
+                                           scale_type{type().scale()}}};
+}
+
 namespace detail {
 /**
  * @brief value accessor of column without null bitmask
@@ -210,6 +210,67 @@ std::unique_ptr<column> make_duration_column(
                                   null_count);
 }
 
+/**
+ * @brief Construct column with sufficient uninitialized storage
+ * to hold `size` elements of the specified fixed-point `data_type` with an
+ * optional null mask.
+ *
+ * The elements are stored as the integer representation of the type; the scale of the
+ * elements is held by `type`.
+ *
+ * @note `null_count()` is determined by the requested null mask `state`
+ *
+ * @throws std::bad_alloc if device memory allocation fails
+ * @throws cudf::logic_error if `type` is not a fixed-point type
+ *
+ * @param[in] type The desired fixed-point element type, including the scale
+ * @param[in] size The number of elements in the column
+ * @param[in] state Optional, controls allocation/initialization of the
+ * column's null mask. By default, no null mask is allocated.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> make_fixed_point_column(
+  data_type type,
+  size_type size,
+  mask_state state                    = mask_state::UNALLOCATED,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Construct column with sufficient uninitialized storage
+ * to hold `size` elements of the specified fixed-point `data_type` with a
+ * null mask.
+ *
+ * @note null_count is optional and will be computed if not provided.
+ *
+ * @throws std::bad_alloc if device memory allocation fails
+ * @throws cudf::logic_error if `type` is not a fixed-point type
+ *
+ * @param[in] type The desired fixed-point element type, including the scale
+ * @param[in] size The number of elements in the column
+ * @param[in] null_mask Null mask to use for this column.
+ * @param[in] null_count Optional number of nulls in the null_mask.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ */
+template <typename B>
+std::unique_ptr<column> make_fixed_point_column(
+  data_type type,
+  size_type size,
+  B&& null_mask,
+  size_type null_count                = cudf::UNKNOWN_NULL_COUNT,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+{
+  CUDF_EXPECTS(is_fixed_point(type), "Invalid, non-fixed-point type.");
+  return std::make_unique<column>(type,
+                                  size,
+                                  rmm::device_buffer{size * cudf::size_of(type), stream, mr},
+                                  std::forward<B>(null_mask),
+                                  null_count);
+}
+
 /**
  * @brief Construct column with sufficient uninitialized storage
  * to hold `size` elements of the specified fixed width `data_type` with an optional
@@ -265,6 +326,8 @@ std::unique_ptr<column> make_fixed_width_column(
     return make_timestamp_column(type, size, std::forward<B>(null_mask), null_count, stream, mr);
   } else if (is_duration(type)) {
     return make_duration_column(type, size, std::forward<B>(null_mask), null_count, stream, mr);
+  } else if (is_fixed_point(type)) {
+    return make_fixed_point_column(type, size, std::forward<B>(null_mask), null_count, stream, mr);
   }
   return make_numeric_column(type, size, std::forward<B>(null_mask), null_count, stream, mr);
 }
@@ -502,6 +565,41 @@ std::unique_ptr<cudf::column> make_lists_column(
   cudaStream_t stream                 = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Constructs a STRUCT type column given the child columns, null mask and null count.
+ *
+ * The columns and mask are moved into the resulting structs column. Row `i` of the column is
+ * the struct of the rows `i` of the children.
+ *
+ * @code{.pseudo}
+ * Example:
+ * Struct<int, string>
+ * input:              {{1, "a"}, null, {3, "c"}}
+ * child (field 0)     {1, 0, 3}
+ * child (field 1)     {"a", "", "c"}
+ * null_mask           {1, 0, 1}
+ * @endcode
+ *
+ * @throws cudf::logic_error if a child does not have `num_rows` rows
+ *
+ * @param num_rows The number of struct rows the column represents.
+ * @param child_columns The fields of the structs. A child may itself be nested.
+ * @param null_count The number of null structs.
+ * @param null_mask The bits specifying the null structs in device memory.
+ *                  Arrow format for nulls is used for interpeting this bitmask.
+ * @param stream Optional stream for use with all memory allocation
+ *               and device kernels
+ * @param mr Optional resource to use for device memory
+ *           allocation of the column's `null_mask`.
+ */
+std::unique_ptr<cudf::column> make_structs_column(
+  size_type num_rows,
+  std::vector<std::unique_ptr<column>>&& child_columns,
+  size_type null_count,
+  rmm::device_buffer&& null_mask,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Return a column with size elements that are all equal to the
  * given scalar.
@@ -139,6 +139,16 @@ class column_view_base {
    **/
   size_type null_count() const;
 
+  /**
+   * @brief Indicates if the count of null elements is known, i.e., if `null_count()` returns
+   * without computing it from the `null_mask`
+   *
+   * Operations that can derive the null count of their output from the null counts of their
+   * inputs use this to avoid forcing a count, and a synchronization, on views whose count is not
+   * known yet.
+   **/
+  bool has_known_null_count() const noexcept { return _null_count > cudf::UNKNOWN_NULL_COUNT; }
+
   /**
    * @brief Returns the count of null elements in the range [begin, end)
    *
@@ -17,11 +17,14 @@
 #pragma once
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/io/types.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 
+#include <cstring>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace cudf {
@@ -484,6 +487,128 @@ struct contiguous_split_result {
 std::vector<contiguous_split_result> contiguous_split(
   cudf::table_view const& input,
   std::vector<size_type> const& splits,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief The result of `pack`: the columns of a table in one contiguous device
+ * buffer and a host blob describing them
+ *
+ * @ingroup copy_split
+ *
+ * The two can be sent or spilled separately and turned back into a `table_view`
+ * of `gpu_data` with `unpack`, in any process and on any device that holds a
+ * copy of `gpu_data`.
+ */
+struct packed_columns {
+  std::unique_ptr<std::vector<uint8_t>> metadata;
+  std::unique_ptr<rmm::device_buffer> gpu_data;
+};
+
+/**
+ * @brief Deep-copies a table into a single contiguous device buffer and
+ * describes its columns in a host metadata blob
+ *
+ * @ingroup copy_split
+ *
+ * The copy is made by `contiguous_split` and `pack_metadata` describes it.
+ *
+ * @param input View of the table to pack
+ * @param mr Device memory resource used to allocate the returned device buffer
+ * @return The packed device buffer and its metadata
+ */
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Describes the columns of a table whose device memory is entirely
+ * within a contiguous buffer, such as a `contiguous_split_result`
+ *
+ * @ingroup copy_split
+ *
+ * The metadata records the type, size, null count and offset of each column and
+ * the positions of its data and null mask relative to `contiguous_buffer`, so
+ * the results of a single `contiguous_split` can be shipped without packing each
+ * of them again. It takes a few dozen bytes per column.
+ *
+ * @throws cudf::logic_error if the memory of a column is not within the buffer
+ *
+ * @param table View of the table whose device memory is in `contiguous_buffer`
+ * @param contiguous_buffer Start of the device buffer holding the table's memory
+ * @param buffer_size Size of the device buffer in bytes
+ * @return Host metadata blob for `unpack`
+ */
+std::vector<uint8_t> pack_metadata(table_view const& table,
+                                   uint8_t const* contiguous_buffer,
+                                   size_t buffer_size);
+
+/**
+ * @brief Rebuilds a view of the table described by the metadata of `pack`
+ *
+ * @ingroup copy_split
+ *
+ * No device memory is copied or accessed; the returned view references
+ * `input.gpu_data`, which must outlive it.
+ *
+ * @param input The packed device buffer and its metadata
+ * @return View of the packed table
+ */
+table_view unpack(packed_columns const& input);
+
+/**
+ * @brief Rebuilds a view of the table described by a metadata blob from `pack`
+ * or `pack_metadata`, whose device memory starts at `gpu_data`
+ *
+ * @ingroup copy_split
+ *
+ * @throws cudf::logic_error if `metadata` is not a blob created by `pack`
+ *
+ * @param metadata Host metadata blob
+ * @param gpu_data Start of the device buffer described by `metadata`
+ * @return View of the packed table, referencing `gpu_data`
+ */
+table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
+
+/**
+ * @brief Serializes a table into one self-describing device buffer, optionally
+ * compressed on the device
+ *
+ * @ingroup copy_split
+ *
+ * The table is packed as by `pack` and the packed data is stored in pages of
+ * 64KB, each compressed with snappy if `compression` is `SNAPPY`; pages that do
+ * not shrink are stored as they are. The buffer starts with a header holding the
+ * page table and the metadata of `pack`, so that a shuffle can copy it to the
+ * host, send it and copy it back to a device as a single block of bytes.
+ *
+ * @throws cudf::logic_error if `compression` is neither `NONE` nor `SNAPPY`
+ *
+ * @param input View of the table to serialize
+ * @param compression `NONE` or `SNAPPY`
+ * @param mr Device memory resource used to allocate the returned device buffer
+ * @return The serialized table
+ */
+std::unique_ptr<rmm::device_buffer> serialize_to_device_buffer(
+  table_view const& input,
+  io::compression_type compression    = io::compression_type::NONE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Restores the packed table of a buffer created by
+ * `serialize_to_device_buffer`, decompressing it on the device
+ *
+ * @ingroup copy_split
+ *
+ * @throws cudf::logic_error if `data` does not hold a serialized table
+ *
+ * @param data Device memory holding the serialized table
+ * @param size Size of the serialized table in bytes
+ * @param mr Device memory resource used to allocate the returned device buffer
+ * @return The packed table, whose view is returned by `unpack`
+ */
+packed_columns deserialize_from_device_buffer(
+  void const* data,
+  size_t size,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
 /**
@@ -717,6 +842,53 @@ std::unique_ptr<scalar> get_element(
   size_type index,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Host copies of elements of a column, returned from `get_elements`
+ */
+struct host_elements {
+  data_type type;                    ///< Type of the elements; the keys type for a dictionary
+  std::vector<uint8_t> data;         ///< Fixed-width values, `size_of(type)` bytes each
+  std::vector<std::string> strings;  ///< Values of a STRING column
+  std::vector<bool> validity;        ///< Validity of each element
+
+  /**
+   * @brief Returns the fixed-width value of element `i`
+   *
+   * The value of a null element is unspecified.
+   */
+  template <typename T>
+  T value(size_type i) const
+  {
+    T result;
+    std::memcpy(&result, data.data() + i * sizeof(T), sizeof(T));
+    return result;
+  }
+};
+
+/**
+ * @brief Copies the elements at the given row indices of each column of a table to host memory
+ *
+ * All rows are gathered into one small contiguous device buffer, which is brought to host
+ * with a single copy and stream synchronization. Fetching many elements this way costs about
+ * as much as a single `get_element`. Dictionary columns are returned as their keys type.
+ *
+ * ```
+ * input = {[10, 20, null, 40], ["a", "b", "c", "d"]}
+ * r = get_elements(input, {3, 0, 2})
+ * r[0] is {INT32, values [40, 10, ?], validity [1, 1, 0]}
+ * r[1] is {STRING, strings ["d", "a", "c"], validity [1, 1, 1]}
+ * ```
+ *
+ * @throws cudf::logic_error if any index is not within the range `[0, input.num_rows())`
+ * @throws cudf::logic_error if `input` has LIST columns
+ *
+ * @param input Table to get the elements from
+ * @param indices Row indices of the elements to get
+ * @return The elements of each column of `input`, in the order of `indices`
+ */
+std::vector<host_elements> get_elements(table_view const& input,
+                                        std::vector<size_type> const& indices);
+
 /**
  * @brief Indicates whether a row can be sampled more than once.
  **/
@@ -741,6 +913,10 @@ enum class sample_with_replacement : bool {
  * output:       {col1: {3, 1, 1}, col2: {8, 6, 6}}
  * @endcode
  *
+ * Without replacement, samples of a small fraction of the rows draw random
+ * row indices, so that their cost depends on `n` rather than on the number of
+ * rows. Larger samples shuffle all the row indices.
+ *
  * @throws cudf::logic_error if `n` > `input.num_rows()` and `replacement` == FALSE.
  * @throws cudf::logic_error if `n` < 0.
  *
@@ -759,5 +935,35 @@ std::unique_ptr<table> sample(
   int64_t const seed                  = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Samples each row of `input` independently with probability `fraction`
+ *
+ * The number of sampled rows is random, with an expected value of
+ * `fraction * input.num_rows()`. Sampled rows are in their order in `input`.
+ * The rows are selected in a single pass, without sorting or shuffling.
+ *
+ * @code{.pseudo}
+ * Example:
+ * input: {col1: {1, 2, 3, 4, 5}, col2: {6, 7, 8, 9, 10}}
+ * fraction: 0.4
+ *
+ * output:       {col1: {2, 5}, col2: {7, 10}}
+ * @endcode
+ *
+ * @throws cudf::logic_error if `fraction` is not in `[0, 1]`.
+ *
+ * @param input View of a table to sample.
+ * @param fraction Probability of sampling each row.
+ * @param seed Seed value to initiate random number generator.
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return std::unique_ptr<table> Table containing samples from `input`
+ */
+std::unique_ptr<table> sample_fraction(
+  table_view const& input,
+  double fraction,
+  int64_t const seed                  = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <string>
 
 /**
  * @file datetime.hpp
@@ -151,6 +152,23 @@ std::unique_ptr<cudf::column> extract_second(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Extracts year, month, day, hour, minute and second from any date time type in a single
+ * pass and returns them as int16_t columns of a cudf::table.
+ *
+ * This is faster than calling each of the `extract_*` functions since the calendar date and the
+ * time of day of each row are computed only once.
+ *
+ * @param[in] cudf::column_view of the input datetime values
+ *
+ * @returns cudf::table of the extracted int16_t years, months, days, hours, minutes and seconds,
+ * in that order
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::unique_ptr<cudf::table> extract_components(
+  cudf::column_view const& column,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
@@ -183,6 +201,30 @@ std::unique_ptr<cudf::column> day_of_year(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Converts timestamps from the local time of one timezone to the local time of another.
+ *
+ * The offsets of the timezones, including their daylight saving time transitions, come from the
+ * tzfile transition tables in `/usr/share/zoneinfo`. The table of each timezone is read and
+ * uploaded to the device the first time the timezone is used, and cached for the later calls.
+ * Local times that are repeated or skipped around a transition of `from_timezone` are converted
+ * with the offset of one side of the transition.
+ *
+ * @param[in] column cudf::column_view of the input timestamps, of a resolution of seconds or finer
+ * @param[in] from_timezone Name of the timezone of the input timestamps, for example "US/Pacific"
+ * or "UTC"
+ * @param[in] to_timezone Name of the timezone of the output timestamps
+ *
+ * @returns cudf::column of the converted timestamps, of the type of the input
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP or is TIMESTAMP_DAYS
+ * @throw cudf::logic_error if a timezone is not found
+ */
+std::unique_ptr<cudf::column> convert_timezone(
+  cudf::column_view const& column,
+  std::string const& from_timezone,
+  std::string const& to_timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace datetime
 }  // namespace cudf
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup aggregation_reduction
+ * @{
+ */
+
+/**
+ * @brief Statistics of the values of a column in each of a set of segments
+ *
+ * Each column has one row per segment. Minimum, maximum and sum are null for the segments
+ * without non-null values.
+ */
+struct segment_statistics {
+  /// Minimum non-null value, of the type of the input column
+  std::unique_ptr<column> min;
+  /// Maximum non-null value, of the type of the input column
+  std::unique_ptr<column> max;
+  /// Number of null values (`INT32`)
+  std::unique_ptr<column> null_count;
+  /// Sum of the values: `FLOAT64` for floating-point columns, `INT64` for integer and boolean
+  /// columns of up to 32 bits and total length in bytes for string columns; null for the other
+  /// types, whose sums could overflow
+  std::unique_ptr<column> sum;
+  /// Approximate number of distinct non-null values (`INT64`), with a relative error of about 3%
+  std::unique_ptr<column> distinct_count;
+};
+
+/**
+ * @brief Statistics of a column of a table
+ */
+struct column_description {
+  segment_statistics segments;  ///< Statistics of each segment of the column
+  segment_statistics total;     ///< Statistics of the whole column, as a single segment
+};
+
+/**
+ * @brief Computes the minimum, maximum, null count, sum and approximate distinct count of each
+ * column of a table, for the whole column and for each segment of `segment_size` rows
+ *
+ * All the statistics of all the columns are gathered in one pass over the table; segment
+ * statistics are then merged into the column statistics without reading the table again.
+ *
+ * Supported types are signed integers, booleans, floating-point numbers, timestamps, durations
+ * and strings.
+ *
+ * @throws cudf::logic_error if a column has an unsupported type
+ * @throws cudf::logic_error if `segment_size` is not positive
+ *
+ * @param input Table of the columns to describe
+ * @param segment_size Number of rows of each segment; the last segment may be shorter
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The statistics of each column, in table order
+ */
+std::vector<column_description> describe(
+  table_view const& input,
+  size_type segment_size,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
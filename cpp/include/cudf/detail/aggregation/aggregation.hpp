@@ -153,6 +153,78 @@ struct nth_element_aggregation final : derived_aggregation<nth_element_aggregati
   }
 };
 
+/**
+ * @brief Derived class for specifying a lead or lag aggregation
+ */
+struct lead_lag_aggregation final : derived_aggregation<lead_lag_aggregation> {
+  lead_lag_aggregation(aggregation::Kind k, size_type offset)
+    : derived_aggregation{k}, row_offset{offset}
+  {
+  }
+  size_type row_offset;  ///< Distance of the accessed row from the current row
+
+ protected:
+  friend class derived_aggregation<lead_lag_aggregation>;
+
+  bool operator==(lead_lag_aggregation const& other) const
+  {
+    return row_offset == other.row_offset;
+  }
+
+  size_t hash_impl() const { return std::hash<size_type>{}(row_offset); }
+};
+
+/**
+ * @brief Derived class for specifying an approx_count_distinct aggregation
+ */
+struct approx_count_distinct_aggregation final
+  : derived_aggregation<approx_count_distinct_aggregation> {
+  approx_count_distinct_aggregation(aggregation::Kind k, int precision)
+    : derived_aggregation{k}, _precision{precision}
+  {
+  }
+  int _precision;  ///< log2 of the number of registers of each sketch
+
+ protected:
+  friend class derived_aggregation<approx_count_distinct_aggregation>;
+
+  bool operator==(approx_count_distinct_aggregation const& other) const
+  {
+    return _precision == other._precision;
+  }
+
+  size_t hash_impl() const { return std::hash<int>{}(_precision); }
+};
+
+/**
+ * @brief Derived class for specifying an approx_quantile aggregation
+ */
+struct approx_quantile_aggregation final : derived_aggregation<approx_quantile_aggregation> {
+  approx_quantile_aggregation(aggregation::Kind k, std::vector<double> const& q, double compression)
+    : derived_aggregation{k}, _quantiles{q}, _compression{compression}
+  {
+  }
+  std::vector<double> _quantiles;  ///< Desired quantile(s)
+  double _compression;             ///< Accuracy of the t-digest
+
+ protected:
+  friend class derived_aggregation<approx_quantile_aggregation>;
+
+  bool operator==(approx_quantile_aggregation const& other) const
+  {
+    return _compression == other._compression and _quantiles == other._quantiles;
+  }
+
+  size_t hash_impl() const
+  {
+    return std::hash<double>{}(_compression) ^
+           std::accumulate(
+             _quantiles.cbegin(), _quantiles.cend(), size_t{0}, [](size_t a, double b) {
+               return a ^ std::hash<double>{}(b);
+             });
+  }
+};
+
 /**
  * @brief Derived class for specifying a custom aggregation
  * specified in udf
@@ -355,6 +427,31 @@ struct target_type_impl<Source, aggregation::ROW_NUMBER> {
   using type = cudf::size_type;
 };
 
+// Always use size_type for RANK
+template <typename Source>
+struct target_type_impl<Source, aggregation::RANK> {
+  using type = cudf::size_type;
+};
+
+// Always use int64_t for the estimate of APPROX_COUNT_DISTINCT of hashable types
+template <typename Source, aggregation::Kind k>
+struct target_type_impl<Source,
+                        k,
+                        std::enable_if_t<(is_fixed_width<Source>() or
+                                          std::is_same<Source, cudf::string_view>::value) and
+                                         (k == aggregation::APPROX_COUNT_DISTINCT)>> {
+  using type = int64_t;
+};
+
+// Always use double for APPROX_QUANTILE of numeric types, like QUANTILE
+template <typename Source, aggregation::Kind k>
+struct target_type_impl<Source,
+                        k,
+                        std::enable_if_t<is_numeric<Source>() and
+                                         (k == aggregation::APPROX_QUANTILE)>> {
+  using type = double;
+};
+
 /**
  * @brief Helper alias to get the accumulator type for performing aggregation
  * `k` on elements of type `Source`
@@ -440,6 +537,12 @@ CUDA_HOST_DEVICE_CALLABLE decltype(auto) aggregation_dispatcher(aggregation::Kin
       return f.template operator()<aggregation::NTH_ELEMENT>(std::forward<Ts>(args)...);
     case aggregation::ROW_NUMBER:
       return f.template operator()<aggregation::ROW_NUMBER>(std::forward<Ts>(args)...);
+    case aggregation::RANK:
+      return f.template operator()<aggregation::RANK>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_COUNT_DISTINCT:
+      return f.template operator()<aggregation::APPROX_COUNT_DISTINCT>(std::forward<Ts>(args)...);
+    case aggregation::APPROX_QUANTILE:
+      return f.template operator()<aggregation::APPROX_QUANTILE>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
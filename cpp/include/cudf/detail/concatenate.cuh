@@ -20,21 +20,48 @@
 #include <cudf/concatenate.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <rmm/device_buffer.hpp>
+
 #include <vector>
 
 namespace cudf {
 //! Inner interfaces and implementations
 namespace detail {
+/**
+ * @brief Device views of the columns to concatenate and the prefix sum of their sizes
+ *
+ * Owns the device memory of the views, of their children and of the offsets.
+ */
+struct concatenate_device_views {
+  rmm::device_buffer storage;         ///< Holds the views, their children and the offsets
+  column_device_view const* views{};  ///< Device views of the input columns
+  size_t const* offsets{};            ///< Prefix sum of the sizes, `num_views + 1` values
+  size_type num_views{};              ///< Number of input columns
+  size_t output_size{};               ///< Total number of rows of the input columns
+};
+
+/**
+ * @brief Creates the device views of the columns to concatenate
+ *
+ * The views of all the columns, the views of their children and the offsets are uploaded with a
+ * single allocation and a single copy, without synchronizing the stream. This keeps the host cost
+ * linear in the number of columns when concatenating many small columns.
+ *
+ * @param views Columns to concatenate
+ * @param stream CUDA stream used for the allocation and the copy
+ */
+concatenate_device_views create_device_views(std::vector<column_view> const& views,
+                                             cudaStream_t stream);
+
 /**
  * @copydoc cudf::concatenate_masks(std::vector<column_view>
  * const&,rmm::mr::device_memory_resource*)
  *
+ * @param d_views Device views of the columns, from `create_device_views()`
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
-void concatenate_masks(rmm::device_vector<column_device_view> const& d_views,
-                       rmm::device_vector<size_t> const& d_offsets,
+void concatenate_masks(concatenate_device_views const& d_views,
                        bitmask_type* dest_mask,
-                       size_type output_size,
                        cudaStream_t stream);
 
 /**
@@ -46,6 +73,25 @@ void concatenate_masks(std::vector<column_view> const& views,
                        bitmask_type* dest_mask,
                        cudaStream_t stream);
 
+/**
+ * @brief Indicates if the concatenation of the columns may contain nulls
+ *
+ * A nullable column whose null count is not known is assumed to have nulls, so that no null count
+ * is computed just to decide whether the output needs a null mask.
+ *
+ * @param views Columns to concatenate
+ */
+bool may_have_nulls(std::vector<column_view> const& views);
+
+/**
+ * @brief Returns the null count of the concatenation of the columns without counting it
+ *
+ * @param views Columns to concatenate
+ * @return The sum of the null counts of the columns, or `UNKNOWN_NULL_COUNT` if the null count
+ * of any of them is not known
+ */
+size_type concatenated_null_count(std::vector<column_view> const& views);
+
 /**
  * @copydoc cudf::concatenate(std::vector<column_view> const&,rmm::mr::device_memory_resource*)
  *
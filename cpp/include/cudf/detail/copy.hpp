@@ -84,6 +84,37 @@ std::vector<contiguous_split_result> contiguous_split(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::pack
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                    cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::serialize_to_device_buffer
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::unique_ptr<rmm::device_buffer> serialize_to_device_buffer(
+  table_view const& input,
+  io::compression_type compression    = io::compression_type::NONE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::deserialize_from_device_buffer
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+packed_columns deserialize_from_device_buffer(
+  void const* data,
+  size_t size,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @copydoc cudf::allocate_like(column_view const&, size_type, mask_allocation_policy,
  * rmm::mr::device_memory_resource*)
@@ -161,5 +192,26 @@ std::unique_ptr<table> sample(table_view const& input,
                               rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                               cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::sample_fraction
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> sample_fraction(
+  table_view const& input,
+  double fraction,
+  int64_t const seed                  = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::get_elements
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<host_elements> get_elements(table_view const& input,
+                                        std::vector<size_type> const& indices,
+                                        cudaStream_t stream = 0);
+
 }  // namespace detail
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,7 +24,9 @@
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/device_atomics.cuh>
 #include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
@@ -35,27 +37,102 @@
 #include <rmm/device_scalar.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
 #include <algorithm>
 #include <cub/cub.cuh>
+#include <vector>
 
 namespace {
-// Compute the count of elements that pass the mask within each block
+// Status of a block in the decoupled look-back of `compute_block_offsets`: the
+// flag is in the high word and the value in the low word
+using block_status = unsigned long long int;
+constexpr block_status status_invalid   = 0;  ///< The block has not published its count
+constexpr block_status status_aggregate = 1;  ///< The value is the count of the block
+constexpr block_status status_prefix    = 2;  ///< The value is the count of the blocks up to it
+
+__device__ inline block_status make_status(block_status flag, cudf::size_type value)
+{
+  return (flag << 32) | static_cast<uint32_t>(value);
+}
+
+__device__ inline block_status status_flag(block_status status) { return status >> 32; }
+
+__device__ inline cudf::size_type status_value(block_status status)
+{
+  return static_cast<cudf::size_type>(status & 0xffffffffu);
+}
+
+__device__ inline block_status load_status(block_status const* status)
+{
+  return *static_cast<volatile block_status const*>(status);
+}
+
+// Compute the output offset of each block in one pass: each block counts the
+// elements that pass the filter, publishes its count, and sums the counts of its
+// predecessors with a decoupled look-back, stopping at the first predecessor
+// that has published its inclusive prefix. Blocks take their index from a
+// counter in the order they start, so that a block only waits on blocks that
+// are running or done. The last block also writes the output size at
+// `block_offsets[num_blocks]`.
 template <typename Filter, int block_size>
-__global__ void compute_block_counts(cudf::size_type* __restrict__ block_counts,
-                                     cudf::size_type size,
-                                     cudf::size_type per_thread,
-                                     Filter filter)
+__launch_bounds__(block_size) __global__
+  void compute_block_offsets(block_status* __restrict__ status,
+                             cudf::size_type* __restrict__ block_offsets,
+                             cudf::size_type* next_block,
+                             cudf::size_type num_blocks,
+                             cudf::size_type size,
+                             cudf::size_type per_thread,
+                             Filter filter)
 {
-  int tid   = threadIdx.x + per_thread * block_size * blockIdx.x;
-  int count = 0;
+  constexpr int warp_size = cudf::detail::warp_size;
+  constexpr uint32_t full_mask{0xffffffff};
+
+  __shared__ cudf::size_type block_index;
+  if (threadIdx.x == 0) { block_index = atomicAdd(next_block, 1); }
+  __syncthreads();
+  int const block = block_index;
 
+  int tid               = threadIdx.x + per_thread * block_size * block;
+  cudf::size_type count = 0;
   for (int i = 0; i < per_thread; i++) {
-    bool mask_true = (tid < size) && filter(tid);
-    count += __syncthreads_count(mask_true);
+    count += __syncthreads_count((tid < size) && filter(tid));
     tid += block_size;
   }
 
-  if (threadIdx.x == 0) block_counts[blockIdx.x] = count;
+  // The first warp looks at the status of 32 predecessors at a time
+  if (threadIdx.x >= warp_size) { return; }
+  int const lane         = threadIdx.x;
+  cudf::size_type prefix = 0;
+  if (block > 0) {
+    if (lane == 0) { atomicExch(status + block, make_status(status_aggregate, count)); }
+    for (int window_end = block;; window_end -= warp_size) {
+      int const predecessor = window_end - 1 - lane;
+      auto lane_status      = (predecessor >= 0) ? load_status(status + predecessor)
+                                            : make_status(status_prefix, 0);
+      while (__any_sync(full_mask, status_flag(lane_status) == status_invalid)) {
+        if (status_flag(lane_status) == status_invalid) {
+          lane_status = load_status(status + predecessor);
+        }
+      }
+      // The nearest predecessor with an inclusive prefix ends the look-back
+      auto const prefix_lanes = __ballot_sync(full_mask, status_flag(lane_status) == status_prefix);
+      int const last_lane     = prefix_lanes ? __ffs(prefix_lanes) - 1 : warp_size - 1;
+      cudf::size_type value   = (lane <= last_lane) ? status_value(lane_status) : 0;
+      for (int offset = warp_size / 2; offset > 0; offset /= 2) {
+        value += __shfl_down_sync(full_mask, value, offset);
+      }
+      prefix += value;
+      if (prefix_lanes != 0) { break; }
+    }
+  }
+  if (lane == 0) {
+    atomicExch(status + block, make_status(status_prefix, prefix + count));
+    block_offsets[block] = prefix;
+    if (block == num_blocks - 1) { block_offsets[num_blocks] = prefix + count; }
+  }
 }
 
 // Compute the exclusive prefix sum of each thread's mask value within each block
@@ -71,188 +148,201 @@ __device__ cudf::size_type block_scan_mask(bool mask_true, cudf::size_type& bloc
   return offset;
 }
 
-// This kernel scatters data and validity mask of a column based on the
-// scan of the boolean mask. The block offsets for the scan are already computed.
-// Just compute the scan of the mask in each block and add it to the block's
-// output offset. This is the output index of each element. Scattering
-// the valid mask is not as easy, because each thread is only responsible for
-// one bit. Warp-level processing (ballot) makes this simpler.
-// To make scattering efficient, we "coalesce" the block's scattered data and
-// valids in shared memory, and then write from shared memory to global memory
-// in a contiguous manner.
-// The has_validity template parameter specializes this kernel for the
-// non-nullable case for performance without writing another kernel.
+// Scatter the validity of the elements selected in one tile of a block to the
+// output mask, and add the number of valid elements to `valid_count`. The valid
+// bools are "coalesced" in shared memory first, so that __ballot_sync combines
+// them into whole mask elements. Most mask elements can then be directly copied
+// from shared to global memory. Only the first and last 32-bit mask elements of
+// each tile must use an atomicOr, because these are where other tiles may
+// overlap; `output_valid` must be all zero before the kernel.
+template <int block_size>
+__device__ void scatter_tile_validity(bool* temp_valids,
+                                      cudf::bitmask_type* __restrict__ output_valid,
+                                      cudf::size_type* valid_count,
+                                      bool valid,
+                                      cudf::size_type local_index,
+                                      cudf::size_type tile_offset,
+                                      cudf::size_type tile_count)
+{
+  constexpr int warp_size = cudf::detail::warp_size;
+  constexpr int num_warps = block_size / warp_size;
+
+  temp_valids[threadIdx.x] = false;  // init shared memory
+  if (threadIdx.x < warp_size) temp_valids[block_size + threadIdx.x] = false;
+  __syncthreads();  // wait for init
+
+  // determine aligned offset for this tile's output
+  cudf::size_type const aligned_offset = tile_offset % warp_size;
+  if (valid) { temp_valids[local_index + aligned_offset] = true; }
+  __syncthreads();  // wait for the validity mask to be complete
+
+  if (tile_count > 0) {
+    // account for partial blocks with non-warp-aligned offsets
+    int const last_index  = tile_count + aligned_offset - 1;
+    int const last_warp   = min(num_warps, last_index / warp_size);
+    int const wid         = threadIdx.x / warp_size;
+    int const lane        = threadIdx.x % warp_size;
+    int const valid_index = (tile_offset / warp_size) + wid;
+
+    if (wid <= last_warp) {
+      uint32_t const valid_warp = __ballot_sync(0xffffffff, temp_valids[threadIdx.x]);
+      if (lane == 0 && valid_warp != 0) {
+        atomicAdd(valid_count, __popc(valid_warp));
+        if (wid > 0 && wid < last_warp) {
+          output_valid[valid_index] = valid_warp;
+        } else {
+          atomicOr(&output_valid[valid_index], valid_warp);
+        }
+      }
+    }
+
+    // if the tile is full and not aligned then we have one more warp to cover
+    if ((wid == 0) && (last_warp == num_warps)) {
+      uint32_t const valid_warp = __ballot_sync(0xffffffff, temp_valids[block_size + threadIdx.x]);
+      if (lane == 0 && valid_warp != 0) {
+        atomicAdd(valid_count, __popc(valid_warp));
+        atomicOr(&output_valid[valid_index + num_warps], valid_warp);
+      }
+    }
+  }
+  __syncthreads();  // temp_valids is reused by the next column
+}
+
+// This kernel compacts all the fixed-width columns of a table in one launch,
+// based on the scan of the filter. The block offsets are already computed;
+// each tile is scanned once and the selected elements of every column are
+// written to the block's output offset plus their index in the scan, which is
+// contiguous across the tile so the writes coalesce.
 //
-// Note: `filter` is not run on indices larger than the input column size
-template <typename T, typename Filter, int block_size, bool has_validity>
+// Note: `filter` is not run on indices larger than the input size
+template <typename Filter, int block_size>
 __launch_bounds__(block_size) __global__
-  void scatter_kernel(cudf::mutable_column_device_view output_view,
-                      cudf::size_type* output_null_count,
-                      cudf::column_device_view input_view,
-                      cudf::size_type const* __restrict__ block_offsets,
-                      cudf::size_type size,
-                      cudf::size_type per_thread,
-                      Filter filter)
+  void scatter_fixed_width_kernel(cudf::mutable_table_device_view output,
+                                  cudf::table_device_view input,
+                                  int const* __restrict__ element_sizes,
+                                  cudf::size_type* valid_counts,
+                                  cudf::size_type const* __restrict__ block_offsets,
+                                  cudf::size_type size,
+                                  cudf::size_type per_thread,
+                                  Filter filter)
 {
-  T* __restrict__ output_data                   = output_view.data<T>();
-  cudf::bitmask_type* __restrict__ output_valid = output_view.null_mask();
-  constexpr cudf::size_type leader_lane{0};
   static_assert(block_size <= 1024, "Maximum thread block size exceeded");
+  // one extra warp worth in case the tile is not aligned
+  __shared__ bool temp_valids[block_size + cudf::detail::warp_size];
 
-  int tid                      = threadIdx.x + per_thread * block_size * blockIdx.x;
-  cudf::size_type block_offset = block_offsets[blockIdx.x];
-
-  // one extra warp worth in case the block is not aligned
-  __shared__ bool temp_valids[has_validity ? block_size + cudf::detail::warp_size : 1];
-  __shared__ T temp_data[block_size];
-
-  cudf::size_type warp_valid_counts{0};
-  cudf::size_type block_sum = 0;
+  int tid                     = threadIdx.x + per_thread * block_size * blockIdx.x;
+  cudf::size_type tile_offset = block_offsets[blockIdx.x];
 
   // Note that since the maximum gridDim.x on all supported GPUs is as big as
   // cudf::size_type, this loop is sufficient to cover our maximum column size
   // regardless of the value of block_size and per_thread.
   for (int i = 0; i < per_thread; i++) {
-    bool mask_true = (tid < size) && filter(tid);
-
-    cudf::size_type tmp_block_sum = 0;
+    bool const mask_true       = (tid < size) && filter(tid);
+    cudf::size_type tile_count = 0;
     // get output location using a scan of the mask result
-    const cudf::size_type local_index = block_scan_mask<block_size>(mask_true, tmp_block_sum);
-    block_sum += tmp_block_sum;
-
-    if (has_validity) {
-      temp_valids[threadIdx.x] = false;  // init shared memory
-      if (threadIdx.x < cudf::detail::warp_size) temp_valids[block_size + threadIdx.x] = false;
-      __syncthreads();  // wait for init
-    }
-
-    if (mask_true) {
-      temp_data[local_index] = input_view.data<T>()[tid];  // scatter data to shared
-
-      // scatter validity mask to shared memory
-      if (has_validity and input_view.is_valid(tid)) {
-        // determine aligned offset for this warp's output
-        const cudf::size_type aligned_offset      = block_offset % cudf::detail::warp_size;
-        temp_valids[local_index + aligned_offset] = true;
+    cudf::size_type const local_index = block_scan_mask<block_size>(mask_true, tile_count);
+    cudf::size_type const output_row  = tile_offset + local_index;
+
+    for (cudf::size_type c = 0; c < input.num_columns(); ++c) {
+      auto const& input_column = input.column(c);
+      auto& output_column      = output.column(c);
+      if (mask_true) {
+        auto const element_size = element_sizes[c];
+        cudf::detail::copy_fixed_width_element(
+          output_column.head<uint8_t>() + static_cast<int64_t>(output_row) * element_size,
+          input_column.head<uint8_t>() +
+            static_cast<int64_t>(input_column.offset() + tid) * element_size,
+          element_size);
       }
-    }
-
-    __syncthreads();  // wait for shared data and validity mask to be complete
-
-    // Copy output data coalesced from shared to global
-    if (threadIdx.x < tmp_block_sum)
-      output_data[block_offset + threadIdx.x] = temp_data[threadIdx.x];
-
-    if (has_validity) {
-      // Since the valid bools are contiguous in shared memory now, we can use
-      // __popc to combine them into a single mask element.
-      // Then, most mask elements can be directly copied from shared to global
-      // memory. Only the first and last 32-bit mask elements of each block must
-      // use an atomicOr, because these are where other blocks may overlap.
-
-      constexpr int num_warps = block_size / cudf::detail::warp_size;
-      // account for partial blocks with non-warp-aligned offsets
-      const int last_index = tmp_block_sum + (block_offset % cudf::detail::warp_size) - 1;
-      const int last_warp  = min(num_warps, last_index / cudf::detail::warp_size);
-      const int wid        = threadIdx.x / cudf::detail::warp_size;
-      const int lane       = threadIdx.x % cudf::detail::warp_size;
-
-      if (tmp_block_sum > 0 && wid <= last_warp) {
-        int valid_index = (block_offset / cudf::detail::warp_size) + wid;
-
-        // compute the valid mask for this warp
-        uint32_t valid_warp = __ballot_sync(0xffffffff, temp_valids[threadIdx.x]);
-
-        // Note the atomicOr's below assume that output_valid has been set to
-        // all zero before the kernel
-
-        if (lane == 0 && valid_warp != 0) {
-          warp_valid_counts = __popc(valid_warp);
-          if (wid > 0 && wid < last_warp)
-            output_valid[valid_index] = valid_warp;
-          else {
-            atomicOr(&output_valid[valid_index], valid_warp);
-          }
-        }
-
-        // if the block is full and not aligned then we have one more warp to cover
-        if ((wid == 0) && (last_warp == num_warps)) {
-          uint32_t valid_warp = __ballot_sync(0xffffffff, temp_valids[block_size + threadIdx.x]);
-          if (lane == 0 && valid_warp != 0) {
-            warp_valid_counts += __popc(valid_warp);
-            atomicOr(&output_valid[valid_index + num_warps], valid_warp);
-          }
-        }
+      if (output_column.nullable()) {
+        scatter_tile_validity<block_size>(temp_valids,
+                                          output_column.null_mask(),
+                                          valid_counts + c,
+                                          mask_true && input_column.is_valid(tid),
+                                          local_index,
+                                          tile_offset,
+                                          tile_count);
       }
     }
 
-    block_offset += tmp_block_sum;
+    __syncthreads();  // the scan storage is reused by the next tile
+    tile_offset += tile_count;
     tid += block_size;
   }
-  // Compute total null_count for this block and add it to global count
-  cudf::size_type block_valid_count =
-    cudf::detail::single_lane_block_sum_reduce<block_size, leader_lane>(warp_valid_counts);
-  if (threadIdx.x == 0) {  // one thread computes and adds to null count
-    atomicAdd(output_null_count, block_sum - block_valid_count);
-  }
 }
 
-// Dispatch functor which performs the scatter for fixed column types and gather for other
+// This kernel compacts a strings column in one launch: the offset, the chars and
+// the validity of each selected string are written together. `char_offsets`
+// holds the exclusive scan of the sizes of the selected strings, so it is the
+// output offset of every selected string.
 template <typename Filter, int block_size>
-struct scatter_gather_functor {
-  // There are two operator functions, one for fixed-width column types and another for columns that
-  // can have children such as string_view. fixed-width column gatherer is simpler and the kernel is
-  // specifically designed for better performance compared to the generic gather used for strings.
-
-  // operator for non-fixed-width types.
-  template <typename T, std::enable_if_t<not cudf::is_fixed_width<T>()>* = nullptr>
-  std::unique_ptr<cudf::column> operator()(
-    cudf::column_view const& input,
-    cudf::size_type const& output_size,
-    cudf::size_type const* block_offsets,
-    Filter filter,
-    cudf::size_type per_thread,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-    cudaStream_t stream                 = 0)
-  {
-    rmm::device_uvector<cudf::size_type> indices(output_size, stream);
-
-    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
-                    thrust::counting_iterator<cudf::size_type>(0),
-                    thrust::counting_iterator<cudf::size_type>(input.size()),
-                    indices.begin(),
-                    filter);
-
-    auto output_table = cudf::detail::gather(
-      cudf::table_view{{input}}, indices.begin(), indices.end(), false, mr, stream);
+__launch_bounds__(block_size) __global__
+  void scatter_strings_kernel(cudf::column_device_view input,
+                              cudf::size_type const* __restrict__ char_offsets,
+                              cudf::size_type* __restrict__ output_offsets,
+                              char* __restrict__ output_chars,
+                              cudf::bitmask_type* __restrict__ output_valid,
+                              cudf::size_type* valid_count,
+                              cudf::size_type const* __restrict__ block_offsets,
+                              cudf::size_type size,
+                              cudf::size_type per_thread,
+                              Filter filter)
+{
+  __shared__ bool temp_valids[block_size + cudf::detail::warp_size];
 
-    // There will be only one column
-    return std::make_unique<cudf::column>(std::move(output_table->get_column(0)));
-  }
+  auto const offsets =
+    input.child(cudf::strings_column_view::offsets_column_index).data<cudf::size_type>() +
+    input.offset();
+  auto const chars = input.child(cudf::strings_column_view::chars_column_index).data<char>();
 
-  // operator template for fixed-width types
-  template <typename T, std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
-  std::unique_ptr<cudf::column> operator()(
-    cudf::column_view const& input,
-    cudf::size_type const& output_size,
-    cudf::size_type const* block_offsets,
-    Filter filter,
-    cudf::size_type per_thread,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-    cudaStream_t stream                 = 0)
-  {
-    auto output_column = cudf::detail::allocate_like(
-      input, output_size, cudf::mask_allocation_policy::RETAIN, mr, stream);
-    auto output = output_column->mutable_view();
+  int tid                     = threadIdx.x + per_thread * block_size * blockIdx.x;
+  cudf::size_type tile_offset = block_offsets[blockIdx.x];
 
-    bool has_valid = input.nullable();
+  for (int i = 0; i < per_thread; i++) {
+    bool const mask_true       = (tid < size) && filter(tid);
+    cudf::size_type tile_count = 0;
+    cudf::size_type const local_index = block_scan_mask<block_size>(mask_true, tile_count);
 
-    auto scatter = (has_valid) ? scatter_kernel<T, Filter, block_size, true>
-                               : scatter_kernel<T, Filter, block_size, false>;
+    if (mask_true) {
+      auto const output_begin                  = char_offsets[tid];
+      output_offsets[tile_offset + local_index] = output_begin;
+      memcpy(output_chars + output_begin, chars + offsets[tid], offsets[tid + 1] - offsets[tid]);
+    }
+    if (output_valid != nullptr) {
+      scatter_tile_validity<block_size>(temp_valids,
+                                        output_valid,
+                                        valid_count,
+                                        mask_true && input.is_valid(tid),
+                                        local_index,
+                                        tile_offset,
+                                        tile_count);
+    }
 
-    cudf::detail::grid_1d grid{input.size(), block_size, per_thread};
+    __syncthreads();  // the scan storage is reused by the next tile
+    tile_offset += tile_count;
+    tid += block_size;
+  }
+}
 
-    rmm::device_scalar<cudf::size_type> null_count{0, stream};
+// Compact the fixed-width columns of `input` with a single kernel launch
+template <typename Filter, int block_size>
+std::vector<std::unique_ptr<cudf::column>> scatter_fixed_width_columns(
+  cudf::table_view const& input,
+  cudf::size_type output_size,
+  cudf::size_type const* block_offsets,
+  Filter filter,
+  cudf::detail::grid_1d const& grid,
+  cudf::size_type per_thread,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  std::vector<std::unique_ptr<cudf::column>> output_columns;
+  std::vector<cudf::mutable_column_view> output_views;
+  std::vector<int> element_sizes;
+  for (auto const& column : input) {
+    output_columns.push_back(cudf::detail::allocate_like(
+      column, output_size, cudf::mask_allocation_policy::RETAIN, mr, stream));
+    auto output = output_columns.back()->mutable_view();
     if (output.nullable()) {
       // Have to initialize the output mask to all zeros because we may update
       // it with atomicOr().
@@ -261,21 +351,155 @@ struct scatter_gather_functor {
                                cudf::bitmask_allocation_size_bytes(output.size()),
                                stream));
     }
+    output_views.push_back(output);
+    element_sizes.push_back(static_cast<int>(cudf::size_of(column.type())));
+  }
+
+  rmm::device_uvector<int> d_element_sizes(element_sizes.size(), stream);
+  CUDA_TRY(cudaMemcpyAsync(d_element_sizes.data(),
+                           element_sizes.data(),
+                           element_sizes.size() * sizeof(int),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  rmm::device_uvector<cudf::size_type> valid_counts(input.num_columns(), stream);
+  CUDA_TRY(cudaMemsetAsync(
+    valid_counts.data(), 0, input.num_columns() * sizeof(cudf::size_type), stream));
+
+  auto const d_output = cudf::mutable_table_device_view::create(
+    cudf::mutable_table_view{output_views}, stream);
+  auto const d_input = cudf::table_device_view::create(input, stream);
+  scatter_fixed_width_kernel<Filter, block_size>
+    <<<grid.num_blocks, block_size, 0, stream>>>(*d_output,
+                                                 *d_input,
+                                                 d_element_sizes.data(),
+                                                 valid_counts.data(),
+                                                 block_offsets,
+                                                 input.num_rows(),
+                                                 per_thread,
+                                                 filter);
+
+  std::vector<cudf::size_type> h_valid_counts(input.num_columns());
+  CUDA_TRY(cudaMemcpyAsync(h_valid_counts.data(),
+                           valid_counts.data(),
+                           h_valid_counts.size() * sizeof(cudf::size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  for (size_t c = 0; c < output_columns.size(); ++c) {
+    if (output_views[c].nullable()) {
+      output_columns[c]->set_null_count(output_size - h_valid_counts[c]);
+    }
+  }
+  return output_columns;
+}
+
+// Size of string `i` if it passes the filter, and 0 otherwise or past the end
+template <typename Filter>
+struct selected_string_size {
+  cudf::size_type const* offsets;
+  cudf::size_type size;
+  mutable Filter filter;  ///< The filters of the callers need not be const
 
-    auto output_device_view = cudf::mutable_column_device_view::create(output, stream);
-    auto input_device_view  = cudf::column_device_view::create(input, stream);
-    scatter<<<grid.num_blocks, block_size, 0, stream>>>(*output_device_view,
-                                                        null_count.data(),
-                                                        *input_device_view,
-                                                        block_offsets,
-                                                        input.size(),
-                                                        per_thread,
-                                                        filter);
-
-    if (has_valid) { output_column->set_null_count(null_count.value(stream)); }
-    return output_column;
+  __device__ cudf::size_type operator()(cudf::size_type i) const
+  {
+    return (i < size && filter(i)) ? offsets[i + 1] - offsets[i] : 0;
   }
 };
+
+// Compact a strings column, computing the output offsets and copying the chars
+// together in a single kernel launch
+template <typename Filter, int block_size>
+std::unique_ptr<cudf::column> scatter_strings_column(cudf::column_view const& input,
+                                                     cudf::size_type output_size,
+                                                     cudf::size_type const* block_offsets,
+                                                     Filter filter,
+                                                     cudf::detail::grid_1d const& grid,
+                                                     cudf::size_type per_thread,
+                                                     rmm::mr::device_memory_resource* mr,
+                                                     cudaStream_t stream)
+{
+  auto const size = input.size();
+  auto const d_offsets =
+    cudf::strings_column_view(input).offsets().data<cudf::size_type>() + input.offset();
+
+  // Output offset of every selected string; the last element is the size of the chars
+  rmm::device_uvector<cudf::size_type> char_offsets(size + 1, stream);
+  auto const selected_sizes =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<cudf::size_type>(0),
+                                    selected_string_size<Filter>{d_offsets, size, filter});
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         selected_sizes,
+                         selected_sizes + size + 1,
+                         char_offsets.begin());
+  cudf::size_type chars_size{0};
+  CUDA_TRY(cudaMemcpyAsync(&chars_size,
+                           char_offsets.data() + size,
+                           sizeof(cudf::size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  auto offsets_column = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                                  output_size + 1,
+                                                  cudf::mask_state::UNALLOCATED,
+                                                  stream,
+                                                  mr);
+  auto chars_column   = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::INT8}, chars_size, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto d_output_offsets = offsets_column->mutable_view().data<cudf::size_type>();
+  CUDA_TRY(cudaMemcpyAsync(d_output_offsets + output_size,
+                           char_offsets.data() + size,
+                           sizeof(cudf::size_type),
+                           cudaMemcpyDeviceToDevice,
+                           stream));
+
+  rmm::device_buffer null_mask{};
+  rmm::device_scalar<cudf::size_type> valid_count{0, stream};
+  if (input.nullable()) {
+    null_mask = cudf::create_null_mask(output_size, cudf::mask_state::ALL_NULL, stream, mr);
+  }
+
+  auto const d_input = cudf::column_device_view::create(input, stream);
+  scatter_strings_kernel<Filter, block_size><<<grid.num_blocks, block_size, 0, stream>>>(
+    *d_input,
+    char_offsets.data(),
+    d_output_offsets,
+    chars_column->mutable_view().data<char>(),
+    static_cast<cudf::bitmask_type*>(null_mask.data()),
+    valid_count.data(),
+    block_offsets,
+    size,
+    per_thread,
+    filter);
+
+  auto const null_count = input.nullable() ? output_size - valid_count.value(stream) : 0;
+  return cudf::make_strings_column(output_size,
+                                   std::move(offsets_column),
+                                   std::move(chars_column),
+                                   null_count,
+                                   std::move(null_mask),
+                                   stream,
+                                   mr);
+}
+
+// Compact the columns of other types, such as lists and dictionaries, with a gather
+template <typename Filter>
+std::vector<std::unique_ptr<cudf::column>> gather_columns(cudf::table_view const& input,
+                                                          cudf::size_type output_size,
+                                                          Filter filter,
+                                                          rmm::mr::device_memory_resource* mr,
+                                                          cudaStream_t stream)
+{
+  rmm::device_uvector<cudf::size_type> indices(output_size, stream);
+
+  thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                  thrust::counting_iterator<cudf::size_type>(0),
+                  thrust::counting_iterator<cudf::size_type>(input.num_rows()),
+                  indices.begin(),
+                  filter);
+
+  return cudf::detail::gather(input, indices.begin(), indices.end(), false, mr, stream)->release();
+}
 }  // namespace
 
 namespace cudf {
@@ -288,6 +512,11 @@ namespace detail {
  * It will return true if element i of @p input should be copied,
  * false otherwise.
  *
+ * The output offset of every block of rows is computed in one pass over the
+ * filter with a decoupled look-back. All fixed-width columns are then compacted
+ * together in one kernel launch, and each strings column in one kernel launch
+ * that writes its offsets and chars together.
+ *
  * @tparam Filter the filter functor type
  * @param[in] input The table_view to filter
  * @param[in] filter A function object that takes an index and returns a bool
@@ -306,74 +535,76 @@ std::unique_ptr<table> copy_if(
 
   constexpr int block_size = 256;
   cudf::size_type per_thread =
-    elements_per_thread(compute_block_counts<Filter, block_size>, input.num_rows(), block_size);
+    elements_per_thread(compute_block_offsets<Filter, block_size>, input.num_rows(), block_size);
   cudf::detail::grid_1d grid{input.num_rows(), block_size, per_thread};
 
-  // temp storage for block counts and offsets
-  rmm::device_uvector<cudf::size_type> block_counts(grid.num_blocks, stream);
+  // temp storage for the look-back status and the block offsets
+  rmm::device_uvector<block_status> status(grid.num_blocks, stream);
+  CUDA_TRY(cudaMemsetAsync(status.data(), 0, grid.num_blocks * sizeof(block_status), stream));
+  rmm::device_scalar<cudf::size_type> next_block{0, stream};
   rmm::device_uvector<cudf::size_type> block_offsets(grid.num_blocks + 1, stream);
 
-  // 1. Find the count of elements in each block that "pass" the mask
-  compute_block_counts<Filter, block_size><<<grid.num_blocks, block_size, 0, stream>>>(
-    block_counts.begin(), input.num_rows(), per_thread, filter);
-
-  // initialize just the first element of block_offsets to 0 since the InclusiveSum below
-  // starts at the second element.
-  CUDA_TRY(cudaMemsetAsync(block_offsets.begin(), 0, sizeof(cudf::size_type), stream));
-
-  // 2. Find the offset for each block's output using a scan of block counts
-  if (grid.num_blocks > 1) {
-    // Determine and allocate temporary device storage
-    size_t temp_storage_bytes = 0;
-    cub::DeviceScan::InclusiveSum(nullptr,
-                                  temp_storage_bytes,
-                                  block_counts.begin(),
-                                  block_offsets.begin() + 1,
-                                  grid.num_blocks,
-                                  stream);
-    rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
-
-    // Run exclusive prefix sum
-    cub::DeviceScan::InclusiveSum(d_temp_storage.data(),
-                                  temp_storage_bytes,
-                                  block_counts.begin(),
-                                  block_offsets.begin() + 1,
-                                  grid.num_blocks,
-                                  stream);
-  }
+  compute_block_offsets<Filter, block_size>
+    <<<grid.num_blocks, block_size, 0, stream>>>(status.data(),
+                                                 block_offsets.data(),
+                                                 next_block.data(),
+                                                 grid.num_blocks,
+                                                 input.num_rows(),
+                                                 per_thread,
+                                                 filter);
 
-  // As it is InclusiveSum, last value in block_offsets will be output_size
-  // unless num_blocks == 1, in which case output_size is just block_counts[0]
   cudf::size_type output_size{0};
-  CUDA_TRY(cudaMemcpyAsync(
-    &output_size,
-    grid.num_blocks > 1 ? block_offsets.begin() + grid.num_blocks : block_counts.begin(),
-    sizeof(cudf::size_type),
-    cudaMemcpyDefault,
-    stream));
-
+  CUDA_TRY(cudaMemcpyAsync(&output_size,
+                           block_offsets.data() + grid.num_blocks,
+                           sizeof(cudf::size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
   CUDA_TRY(cudaStreamSynchronize(stream));
 
-  if (output_size == input.num_rows()) {
-    return std::make_unique<table>(input, stream, mr);
-  } else if (output_size > 0) {
-    std::vector<std::unique_ptr<column>> out_columns(input.num_columns());
-    std::transform(input.begin(), input.end(), out_columns.begin(), [&](auto col_view) {
-      return cudf::type_dispatcher(col_view.type(),
-                                   scatter_gather_functor<Filter, block_size>{},
-                                   col_view,
-                                   output_size,
-                                   block_offsets.begin(),
-                                   filter,
-                                   per_thread,
-                                   mr,
-                                   stream);
-    });
-
-    return std::make_unique<table>(std::move(out_columns));
-  } else {
-    return empty_like(input);
+  if (output_size == input.num_rows()) { return std::make_unique<table>(input, stream, mr); }
+  if (output_size == 0) { return empty_like(input); }
+
+  std::vector<size_type> fixed_width_indices;
+  std::vector<size_type> other_indices;
+  for (size_type c = 0; c < input.num_columns(); ++c) {
+    auto const type = input.column(c).type();
+    if (is_fixed_width(type)) {
+      fixed_width_indices.push_back(c);
+    } else if (type.id() != type_id::STRING) {
+      other_indices.push_back(c);
+    }
+  }
+
+  std::vector<std::unique_ptr<column>> out_columns(input.num_columns());
+  if (not fixed_width_indices.empty()) {
+    auto fixed_width_columns = scatter_fixed_width_columns<Filter, block_size>(
+      input.select(fixed_width_indices),
+      output_size,
+      block_offsets.data(),
+      filter,
+      grid,
+      per_thread,
+      mr,
+      stream);
+    for (size_t i = 0; i < fixed_width_indices.size(); ++i) {
+      out_columns[fixed_width_indices[i]] = std::move(fixed_width_columns[i]);
+    }
+  }
+  for (size_type c = 0; c < input.num_columns(); ++c) {
+    if (input.column(c).type().id() == type_id::STRING) {
+      out_columns[c] = scatter_strings_column<Filter, block_size>(
+        input.column(c), output_size, block_offsets.data(), filter, grid, per_thread, mr, stream);
+    }
   }
+  if (not other_indices.empty()) {
+    auto other_columns =
+      gather_columns(input.select(other_indices), output_size, filter, mr, stream);
+    for (size_t i = 0; i < other_indices.size(); ++i) {
+      out_columns[other_indices[i]] = std::move(other_columns[i]);
+    }
+  }
+
+  return std::make_unique<table>(std::move(out_columns));
 }
 
 }  // namespace detail
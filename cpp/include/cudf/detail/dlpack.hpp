@@ -39,5 +39,25 @@ DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                            cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::from_dlpack_view
+ */
+dlpack_table_view from_dlpack_view(DLManagedTensor* managed_tensor);
+
+/**
+ * @copydoc cudf::to_dlpack(std::unique_ptr<column>)
+ */
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input);
+
+/**
+ * @copydoc cudf::validity_to_dlpack
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+DLManagedTensor* validity_to_dlpack(
+  table_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace cudf
@@ -15,9 +15,11 @@
  */
 #pragma once
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/detail/utilities/warp_bitmask.cuh>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
@@ -25,6 +27,7 @@
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/detail/gather.cuh>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
@@ -357,6 +360,65 @@ struct column_gatherer_impl<list_view, MapItRoot> {
   }
 };
 
+// forward declaration for the recursion on the children of struct columns
+template <typename MapIterator>
+std::unique_ptr<table> gather(table_view const& source_table,
+                              MapIterator gather_map_begin,
+                              MapIterator gather_map_end,
+                              bool nullify_out_of_bounds          = false,
+                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                              cudaStream_t stream                 = 0);
+
+/**
+ * @brief Column gather specialization for struct_view column type.
+ *
+ * The children are gathered as a table with the same gather map, which recurses into nested
+ * children. The null mask of the struct column itself is gathered by the caller, like the null
+ * masks of the other columns of the table.
+ *
+ * @tparam MapItType Iterator type to access the gather map.
+ */
+template <typename MapItType>
+struct column_gatherer_impl<struct_view, MapItType> {
+  /**
+   * @brief Gather a struct column by gathering its children.
+   *
+   * @param column View into the column to gather from
+   * @param gather_map_begin iterator representing the start of the range to gather from
+   * @param gather_map_end iterator representing the end of the range to gather from
+   * @param nullify_out_of_bounds Nullify values in the gather map that are out of bounds
+   * @param stream CUDA stream on which to execute kernels
+   * @param mr Memory resource to use for all allocations
+   *
+   * @returns column with elements gathered based on the gather map
+   */
+  std::unique_ptr<column> operator()(column_view const& column,
+                                     MapItType gather_map_begin,
+                                     MapItType gather_map_end,
+                                     bool nullify_out_of_bounds,
+                                     cudaStream_t stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    structs_column_view structs(column);
+    auto const gather_map_size =
+      static_cast<size_type>(std::distance(gather_map_begin, gather_map_end));
+
+    std::vector<column_view> children;
+    for (size_type i = 0; i < structs.num_children(); ++i) {
+      children.push_back(structs.child(i));
+    }
+    auto gathered_children = gather(
+      table_view{children}, gather_map_begin, gather_map_end, nullify_out_of_bounds, mr, stream);
+
+    return make_structs_column(gather_map_size,
+                               gathered_children->release(),
+                               0,
+                               rmm::device_buffer{0, stream, mr},
+                               stream,
+                               mr);
+  }
+};
+
 /**
  * @brief Function object for gathering a type-erased
  * column. To be used with the cudf::type_dispatcher.
@@ -412,6 +474,164 @@ struct index_converter : public thrust::unary_function<map_type, map_type> {
   size_type n_rows;
 };
 
+/**
+ * @brief Copies a fixed-width element of `size` bytes
+ */
+__device__ inline void copy_fixed_width_element(void* output, void const* input, int size)
+{
+  switch (size) {
+    case 1: *static_cast<uint8_t*>(output) = *static_cast<uint8_t const*>(input); break;
+    case 2: *static_cast<uint16_t*>(output) = *static_cast<uint16_t const*>(input); break;
+    case 4: *static_cast<uint32_t*>(output) = *static_cast<uint32_t const*>(input); break;
+    case 8: *static_cast<uint64_t*>(output) = *static_cast<uint64_t const*>(input); break;
+    default: memcpy(output, input, size);
+  }
+}
+
+/**
+ * @brief Gathers the data and the validity of all the fixed-width columns of a table in one
+ * launch
+ *
+ * Each gather map index is loaded once and used for every column. The rows of a warp are the 32
+ * rows of one validity word of the target columns, so the validity of each target column is
+ * stored with one ballot per warp instead of a separate `gather_bitmask` pass. The valid counts
+ * are summed in shared memory, so the dynamic shared memory holds one `size_type` per column.
+ *
+ * @tparam NullifyOutOfBounds If true, rows with an out of bounds index are null and their data is
+ * left uninitialized
+ * @param source The columns to gather from
+ * @param target The output columns of `num_rows` rows, nullable wherever the source column is
+ * nullable or `NullifyOutOfBounds` is true
+ * @param element_sizes The size in bytes of the elements of each column
+ * @param gather_map The gather map
+ * @param num_rows The number of rows of the output
+ * @param valid_counts Per-column counts of valid output rows, zero-initialized
+ */
+template <bool NullifyOutOfBounds, typename MapIterator, int block_size>
+__launch_bounds__(block_size) __global__
+  void gather_fixed_width_kernel(table_device_view source,
+                                 mutable_table_device_view target,
+                                 int const* __restrict__ element_sizes,
+                                 MapIterator gather_map,
+                                 size_type num_rows,
+                                 size_type* valid_counts)
+{
+  using map_type = typename std::iterator_traits<MapIterator>::value_type;
+  extern __shared__ size_type block_valid_counts[];
+  for (size_type c = threadIdx.x; c < target.num_columns(); c += block_size) {
+    block_valid_counts[c] = 0;
+  }
+  __syncthreads();
+
+  auto const warp_begin = (threadIdx.x / warp_size) * warp_size;
+  auto const stride     = block_size * gridDim.x;
+  for (size_type first_row = blockIdx.x * block_size; first_row < num_rows; first_row += stride) {
+    // Skipping whole warps keeps the ballots below convergent
+    if (first_row + warp_begin >= num_rows) { continue; }
+    auto const row      = first_row + static_cast<size_type>(threadIdx.x);
+    auto const in_range = row < num_rows;
+    auto const index    = in_range ? gather_map[row] : map_type{0};
+    auto const in_bounds =
+      in_range &&
+      (not NullifyOutOfBounds || bounds_checker<map_type>{0, source.num_rows()}(index));
+
+    for (size_type c = 0; c < target.num_columns(); ++c) {
+      auto const& source_column = source.column(c);
+      auto& target_column       = target.column(c);
+      auto const element_size   = element_sizes[c];
+      if (in_bounds) {
+        copy_fixed_width_element(
+          target_column.head<uint8_t>() + static_cast<int64_t>(row) * element_size,
+          source_column.head<uint8_t>() +
+            static_cast<int64_t>(source_column.offset() + index) * element_size,
+          element_size);
+      }
+      if (target_column.nullable()) {
+        auto const valid = in_bounds && source_column.is_valid(index);
+        auto const count =
+          warp_set_validity_word(target_column.null_mask(), row, valid, 0xffffffff);
+        if (count > 0) { atomicAdd(block_valid_counts + c, count); }
+      }
+    }
+  }
+
+  __syncthreads();
+  for (size_type c = threadIdx.x; c < target.num_columns(); c += block_size) {
+    if (block_valid_counts[c] > 0) { atomicAdd(valid_counts + c, block_valid_counts[c]); }
+  }
+}
+
+/**
+ * @brief Gathers fixed-width columns with `gather_fixed_width_kernel`
+ *
+ * The columns are gathered in batches of at most `max_columns_per_launch` columns, which bounds
+ * the shared memory of the kernel.
+ *
+ * @param source The fixed-width columns to gather from
+ * @param gather_map The gather map
+ * @param num_rows The number of rows of the output
+ * @param nullify_out_of_bounds Nullify the rows of out of bounds indices
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The gathered columns
+ */
+template <typename MapIterator>
+std::vector<std::unique_ptr<column>> gather_fixed_width_columns(
+  std::vector<column_view> const& source,
+  MapIterator gather_map,
+  size_type num_rows,
+  bool nullify_out_of_bounds,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  constexpr size_type max_columns_per_launch = 1024;
+  constexpr int block_size                   = 256;
+
+  std::vector<std::unique_ptr<column>> target;
+  for (auto const& col : source) {
+    auto const state = (col.nullable() or nullify_out_of_bounds) ? mask_state::UNINITIALIZED
+                                                                 : mask_state::UNALLOCATED;
+    target.push_back(make_fixed_width_column(col.type(), num_rows, state, stream, mr));
+  }
+  if (num_rows == 0) {
+    for (auto& col : target) { col->set_null_count(0); }
+    return target;
+  }
+
+  for (size_t begin = 0; begin < source.size(); begin += max_columns_per_launch) {
+    auto const end = std::min(source.size(), begin + max_columns_per_launch);
+    std::vector<column_view> source_batch(source.begin() + begin, source.begin() + end);
+    std::vector<mutable_column_view> target_batch;
+    thrust::host_vector<int> element_sizes;
+    for (auto i = begin; i < end; ++i) {
+      target_batch.push_back(target[i]->mutable_view());
+      element_sizes.push_back(static_cast<int>(size_of(source[i].type())));
+    }
+    rmm::device_vector<int> d_element_sizes(element_sizes);
+    rmm::device_vector<size_type> d_valid_counts(source_batch.size(), 0);
+    auto d_source = table_device_view::create(table_view{source_batch}, stream);
+    auto d_target = mutable_table_device_view::create(mutable_table_view{target_batch}, stream);
+
+    auto kernel = nullify_out_of_bounds
+                    ? gather_fixed_width_kernel<true, MapIterator, block_size>
+                    : gather_fixed_width_kernel<false, MapIterator, block_size>;
+    cudf::detail::grid_1d grid{num_rows, block_size, 1};
+    kernel<<<grid.num_blocks, block_size, source_batch.size() * sizeof(size_type), stream>>>(
+      *d_source,
+      *d_target,
+      d_element_sizes.data().get(),
+      gather_map,
+      num_rows,
+      d_valid_counts.data().get());
+
+    thrust::host_vector<size_type> valid_counts(d_valid_counts);
+    for (auto i = begin; i < end; ++i) {
+      if (target[i]->nullable()) { target[i]->set_null_count(num_rows - valid_counts[i - begin]); }
+    }
+  }
+  return target;
+}
+
 template <gather_bitmask_op Op, typename GatherMap>
 void gather_bitmask(table_device_view input,
                     GatherMap gather_map_begin,
@@ -531,29 +751,54 @@ template <typename MapIterator>
 std::unique_ptr<table> gather(table_view const& source_table,
                               MapIterator gather_map_begin,
                               MapIterator gather_map_end,
-                              bool nullify_out_of_bounds          = false,
-                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-                              cudaStream_t stream                 = 0)
+                              bool nullify_out_of_bounds,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
 {
-  std::vector<std::unique_ptr<column>> destination_columns;
-
-  // TODO: Could be beneficial to use streams internally here
-
-  for (auto const& source_column : source_table) {
-    // The data gather for n columns will be put on the first n streams
-    destination_columns.push_back(cudf::type_dispatcher(source_column.type(),
-                                                        column_gatherer{},
-                                                        source_column,
-                                                        gather_map_begin,
-                                                        gather_map_end,
-                                                        nullify_out_of_bounds,
-                                                        stream,
-                                                        mr));
+  std::vector<std::unique_ptr<column>> destination_columns(source_table.num_columns());
+
+  // The fixed-width columns are gathered together, with their validity, in a single pass
+  std::vector<size_type> fixed_width_indices, other_indices;
+  std::vector<column_view> fixed_width_source, other_source;
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    auto const& source_column = source_table.column(i);
+    if (is_fixed_width(source_column.type())) {
+      fixed_width_indices.push_back(i);
+      fixed_width_source.push_back(source_column);
+    } else {
+      other_indices.push_back(i);
+      other_source.push_back(source_column);
+    }
+  }
+
+  if (not fixed_width_source.empty()) {
+    auto const num_rows = static_cast<size_type>(std::distance(gather_map_begin, gather_map_end));
+    auto gathered       = gather_fixed_width_columns(
+      fixed_width_source, gather_map_begin, num_rows, nullify_out_of_bounds, mr, stream);
+    for (size_t i = 0; i < gathered.size(); ++i) {
+      destination_columns[fixed_width_indices[i]] = std::move(gathered[i]);
+    }
   }
 
-  auto const op =
-    nullify_out_of_bounds ? gather_bitmask_op::NULLIFY : gather_bitmask_op::DONT_CHECK;
-  gather_bitmask(source_table, gather_map_begin, destination_columns, op, mr, stream);
+  if (not other_source.empty()) {
+    std::vector<std::unique_ptr<column>> gathered;
+    for (auto const& source_column : other_source) {
+      gathered.push_back(cudf::type_dispatcher(source_column.type(),
+                                               column_gatherer{},
+                                               source_column,
+                                               gather_map_begin,
+                                               gather_map_end,
+                                               nullify_out_of_bounds,
+                                               stream,
+                                               mr));
+    }
+    auto const op =
+      nullify_out_of_bounds ? gather_bitmask_op::NULLIFY : gather_bitmask_op::DONT_CHECK;
+    gather_bitmask(table_view{other_source}, gather_map_begin, gathered, op, mr, stream);
+    for (size_t i = 0; i < gathered.size(); ++i) {
+      destination_columns[other_indices[i]] = std::move(gathered[i]);
+    }
+  }
 
   return std::make_unique<table>(std::move(destination_columns));
 }
@@ -16,6 +16,7 @@
 
 #include <cudf/groupby.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/memory_estimate.hpp>
 
 #include <memory>
 #include <utility>
@@ -24,6 +25,16 @@ namespace cudf {
 namespace groupby {
 namespace detail {
 namespace hash {
+/**
+ * @brief Indicates whether the specified aggregation operation can be computed
+ * with a hash-based groupby implementation.
+ *
+ * @param t The aggregation operation to verify
+ * @return true `t` is valid for a hash based groupby
+ * @return false `t` is invalid for a hash based groupby
+ */
+bool is_hash_aggregation(aggregation::Kind t);
+
 /**
  * @brief Indicates if a set of aggregation requests can be satisfied with a
  * hash-based groupby implementation.
@@ -36,15 +47,70 @@ namespace hash {
  */
 bool can_use_hash_groupby(table_view const& keys, std::vector<aggregation_request> const& requests);
 
-// Hash-based groupby
+// Hash-based groupby, hashing the keys unless their precomputed `key_hashes` are given
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
   std::vector<aggregation_request> const& requests,
   null_policy include_null_keys,
   cudaStream_t stream,
-  rmm::mr::device_memory_resource* mr);
+  rmm::mr::device_memory_resource* mr,
+  column_view const& key_hashes = {});
+
+/**
+ * @brief Estimates the number of groups of `keys` from an evenly strided sample of its rows,
+ * as the hash-based groupby does to choose its strategy
+ *
+ * @param keys The table of keys
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+size_type estimate_num_groups(table_view const& keys, cudaStream_t stream = 0);
+
+/**
+ * @brief Estimates the device memory used by the hash-based groupby of `keys` into `num_groups`
+ * groups, with the strategy the groupby chooses for that number of groups
+ *
+ * @param keys The table of keys
+ * @param requests The set of columns to aggregate and the aggregations to perform
+ * @param num_groups The expected number of groups
+ */
+memory_estimate estimate_memory(table_view const& keys,
+                                std::vector<aggregation_request> const& requests,
+                                size_type num_groups);
 }  // namespace hash
 
+/**
+ * @brief Computes the start of the time bucket of every timestamp, as
+ * `time_bucket_aggregate` groups them
+ *
+ * @throw cudf::logic_error if `timestamps` is not a timestamp column
+ * @throw cudf::logic_error if `bucket_size` is not a valid, positive duration
+ * scalar of the resolution of `timestamps`
+ *
+ * @param timestamps Timestamps to bucket
+ * @param bucket_size Duration of a bucket
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Column of the type and null mask of `timestamps` holding the start of
+ * the bucket of each row
+ */
+std::unique_ptr<column> time_bucket_starts(column_view const& timestamps,
+                                           scalar const& bucket_size,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::groupby::time_bucket_aggregate
+ */
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> time_bucket_aggregate(
+  column_view const& timestamps,
+  scalar const& bucket_size,
+  table_view const& keys,
+  std::vector<aggregation_request> const& requests,
+  null_policy null_handling,
+  sorted timestamps_are_sorted,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0);
+
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
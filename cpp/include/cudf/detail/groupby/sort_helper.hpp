@@ -155,6 +155,21 @@ struct sort_groupby_helper {
    */
   column_view key_sort_order(cudaStream_t stream = 0);
 
+  /**
+   * @brief Get the sorted order of `keys` in which the rows of each group keep
+   * their order in `keys`.
+   *
+   * The groups are in the order of `key_sort_order()`, so that the group
+   * offsets and labels apply to both orders. Scans and other operations that
+   * depend on the order of the rows within the groups use this order.
+   *
+   * Computes and stores the order on first invocation, and returns the stored
+   * order on subsequent calls.
+   *
+   * @return the stable sort order indices for `keys`.
+   */
+  column_view stable_key_sort_order(cudaStream_t stream = 0);
+
   /**
    * @brief Get each group's offset into the sorted order of `keys`.
    *
@@ -183,7 +198,6 @@ struct sort_groupby_helper {
    */
   index_vector const& group_labels(cudaStream_t stream = 0);
 
- private:
   /**
    * @brief Get the group labels for unsorted keys
    *
@@ -200,6 +214,7 @@ struct sort_groupby_helper {
    */
   column_view unsorted_keys_labels(cudaStream_t stream = 0);
 
+ private:
   /**
    * @brief Get the column representing the row bitmask for the `keys`
    *
@@ -216,6 +231,7 @@ struct sort_groupby_helper {
 
  private:
   column_ptr _key_sorted_order;      ///< Indices to produce _keys in sorted order
+  column_ptr _stable_key_sorted_order;  ///< Sorted order keeping the order within groups
   column_ptr _unsorted_keys_labels;  ///< Group labels for unsorted _keys
   column_ptr _keys_bitmask_column;   ///< Column representing rows with one or more nulls values
   table_view _keys;                  ///< Input keys to sort by
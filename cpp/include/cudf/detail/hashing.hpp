@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/hashing.hpp>
+#include <cudf/partitioning.hpp>
 
 namespace cudf {
 namespace detail {
@@ -28,6 +29,33 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::hash_partition_and_pack
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<packed_columns> hash_partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::hash_partition_and_pack(table_view const&, column_view const&, int,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<packed_columns> hash_partition_and_pack(
+  table_view const& input,
+  column_view const& row_hashes,
+  int num_partitions,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
@@ -41,5 +69,118 @@ std::unique_ptr<column> hash(table_view const& input,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
                              cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::hash(table_view const&, hash_id, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> hash(table_view const& input,
+                             hash_id hash_function,
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                             cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::hyperloglog_sketches
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> hyperloglog_sketches(
+  column_view const& values,
+  column_view const& group_labels     = {},
+  size_type num_groups                = 1,
+  int precision                       = 14,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::merge_hyperloglog_sketches
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> merge_hyperloglog_sketches(
+  column_view const& sketches,
+  column_view const& group_labels     = {},
+  size_type num_groups                = 1,
+  int precision                       = 14,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::hyperloglog_estimates
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> hyperloglog_estimates(
+  column_view const& sketches,
+  int precision                       = 14,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Estimates the number of distinct non-null values of each group of
+ * `values` with HyperLogLog sketches.
+ *
+ * Equivalent to `hyperloglog_estimates(hyperloglog_sketches(values, group_labels,
+ * num_groups, precision), precision)`, except that the sketches are built and
+ * estimated a bounded number of groups at a time, so that any number of groups
+ * can be estimated without materializing all their sketches.
+ *
+ * @throw cudf::logic_error if `precision` is not in `[4, 18]`
+ * @throw cudf::logic_error if `group_labels` is neither empty nor an `INT32`
+ * column of the same size as `values`
+ *
+ * @param values Column whose distinct values are counted
+ * @param group_labels Group in `[0, num_groups)` of each row of `values`. Rows
+ * with a null label or a negative label are ignored. If empty, all rows belong
+ * to group 0.
+ * @param num_groups Number of groups
+ * @param precision Base 2 logarithm of the number of registers of each sketch
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns An `INT64` column of the estimate of each group
+ */
+std::unique_ptr<column> approx_count_distinct(
+  column_view const& values,
+  column_view const& group_labels,
+  size_type num_groups,
+  int precision,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::build_bloom_filter
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> build_bloom_filter(
+  table_view const& keys,
+  size_type num_bits,
+  int num_hashes                      = 3,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::bloom_filter_contains
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> bloom_filter_contains(
+  column_view const& filter,
+  table_view const& keys,
+  int num_hashes                      = 3,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::merge_bloom_filters
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> merge_bloom_filters(
+  std::vector<column_view> const& filters,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace cudf
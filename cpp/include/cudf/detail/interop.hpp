@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/interop.hpp>
+
+namespace cudf {
+namespace detail {
+/**
+ * @copydoc cudf::to_arrow
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::shared_ptr<arrow::Table> to_arrow(table_view input,
+                                       std::vector<std::string> const& column_names = {},
+                                       arrow::MemoryPool* ar_mr = arrow::default_memory_pool(),
+                                       cudaStream_t stream      = 0);
+
+/**
+ * @copydoc cudf::to_arrow_device
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::shared_ptr<arrow::Table> to_arrow_device(table_view input,
+                                              std::vector<std::string> const& column_names = {},
+                                              cudaStream_t stream = 0);
+
+/**
+ * @copydoc cudf::from_arrow(arrow::Table const&,rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> from_arrow(
+  arrow::Table const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace cudf
@@ -15,8 +15,12 @@
  */
 #pragma once
 
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/device_buffer.hpp>
+
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -39,6 +43,39 @@ std::vector<size_type> segmented_count_unset_bits(bitmask_type const* bitmask,
                                                   std::vector<size_type> const& indices,
                                                   cudaStream_t stream = 0);
 
+/**
+ * @brief Returns the bitwise AND of the null masks of the columns of a table and its null count
+ *
+ * The null count is computed by the kernel computing the mask, instead of counting the set bits
+ * of the result in a separate pass. If a single column is nullable and its null count is known,
+ * the mask is copied and no count is computed.
+ *
+ * @param view The table of columns
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The output bitmask, empty if no column is nullable, and its null count
+ */
+std::pair<rmm::device_buffer, size_type> bitmask_and_with_null_count(
+  table_view const& view,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the bitwise OR of the null masks of the columns of a table and its null count
+ *
+ * The null count is computed by the kernel computing the mask. If a single column is nullable and
+ * its null count is known, the mask is copied and no count is computed.
+ *
+ * @param view The table of columns
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The output bitmask, empty if any column is not nullable, and its null count
+ */
+std::pair<rmm::device_buffer, size_type> bitmask_or_with_null_count(
+  table_view const& view,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 
 }  // namespace cudf
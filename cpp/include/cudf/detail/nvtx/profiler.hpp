@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Whether the profiler of `cudf/utilities/profiler.hpp` is enabled
+ */
+extern std::atomic<bool> profiler_enabled;
+
+/**
+ * @brief Starts profiling a call of an operation on the calling thread
+ *
+ * @param name Name of the operation, with static storage duration
+ * @return false if the profiler was disabled concurrently, in which case the call is not profiled
+ */
+bool begin_profile_range(char const* name);
+
+/**
+ * @brief Ends the innermost call profiled on the calling thread and records its figures
+ */
+void end_profile_range();
+
+/**
+ * @brief Profiles the lifetime of the enclosing scope as a call of an operation
+ *
+ * Costs a single relaxed atomic load when the profiler is disabled. Used through
+ * `CUDF_FUNC_RANGE()`.
+ */
+class profile_range {
+ public:
+  explicit profile_range(char const* name)
+    : _active{profiler_enabled.load(std::memory_order_relaxed) && begin_profile_range(name)}
+  {
+  }
+
+  ~profile_range()
+  {
+    if (_active) { end_profile_range(); }
+  }
+
+  profile_range(profile_range const&) = delete;
+  profile_range& operator=(profile_range const&) = delete;
+
+ private:
+  bool const _active;
+};
+
+}  // namespace detail
+}  // namespace cudf
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "nvtx3.hpp"
+#include "profiler.hpp"
 
 namespace cudf {
 /**
@@ -40,7 +41,8 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * from the lifetime of a function.
  *
  * Uses the name of the immediately enclosing function returned by `__func__` to
- * name the range.
+ * name the range. The range is also a call of the operation profiled by
+ * `cudf::enable_profiler()`.
  *
  * Example:
  * ```
@@ -51,4 +53,6 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * ```
  *
  */
-#define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+#define CUDF_FUNC_RANGE()                   \
+  NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain) \
+  ::cudf::detail::profile_range const cudf_profile_range__{__func__}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/partitioning.hpp>
+
+namespace cudf {
+namespace detail {
+/**
+ * @copydoc cudf::range_partition
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::range_partition_and_pack
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<packed_columns> range_partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::sample_splitters
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> sample_splitters(
+  table_view const& keys,
+  size_type num_partitions,
+  size_type num_samples,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  int64_t seed                        = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace cudf
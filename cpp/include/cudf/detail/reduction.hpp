@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/reduction.hpp>
+
+namespace cudf {
+namespace detail {
+/**
+ * @copydoc cudf::reduce(column_view const&, std::unique_ptr<aggregation> const&, data_type,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<scalar> reduce(
+  column_view const& col,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::reduce(table_view const&,
+ * std::vector<std::vector<std::unique_ptr<aggregation>>> const&, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const& table,
+  std::vector<std::vector<std::unique_ptr<aggregation>>> const& aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @copydoc cudf::segmented_reduce
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const& values,
+  column_view const& offsets,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace cudf
@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -31,5 +33,48 @@ std::unique_ptr<table> tile(table_view const& input,
                             size_type count,
                             cudaStream_t stream                 = 0,
                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @copydoc cudf::explode
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<table> explode(
+  table_view const& input,
+  size_type explode_column_idx,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @copydoc cudf::explode_position
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<table> explode_position(
+  table_view const& input,
+  size_type explode_column_idx,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @copydoc cudf::convert_to_rows
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<column> convert_to_rows(
+  table_view const& input,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @copydoc cudf::convert_from_rows
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  cudaStream_t stream                 = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 }  // namespace detail
 }  // namespace cudf
@@ -25,6 +25,7 @@
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/strings/detail/scatter.cuh>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/utilities/traits.hpp>
 
 namespace cudf {
@@ -168,6 +169,55 @@ struct column_scatterer_impl<dictionary32, MapIterator> {
   }
 };
 
+// forward declaration for the recursion on the children of struct columns
+template <typename MapIterator>
+std::unique_ptr<table> scatter(
+  table_view const& source,
+  MapIterator scatter_map_begin,
+  MapIterator scatter_map_end,
+  table_view const& target,
+  bool check_bounds                   = false,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+template <typename MapIterator>
+struct column_scatterer_impl<struct_view, MapIterator> {
+  std::unique_ptr<column> operator()(column_view const& source,
+                                     MapIterator scatter_map_begin,
+                                     MapIterator scatter_map_end,
+                                     column_view const& target,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream) const
+  {
+    structs_column_view const structs_source(source);
+    structs_column_view const structs_target(target);
+    CUDF_EXPECTS(structs_source.num_children() == structs_target.num_children(),
+                 "Scatter source and target struct columns must have the same fields");
+
+    // the children are scattered as tables; the null mask of the struct column is copied from
+    // the target here and updated by the caller like the null masks of the other columns
+    std::vector<column_view> source_children, target_children;
+    for (size_type i = 0; i < structs_source.num_children(); ++i) {
+      source_children.push_back(structs_source.child(i));
+      target_children.push_back(structs_target.child(i));
+    }
+    auto scattered_children = scatter(table_view{source_children},
+                                      scatter_map_begin,
+                                      scatter_map_end,
+                                      table_view{target_children},
+                                      false,
+                                      mr,
+                                      stream);
+
+    return make_structs_column(target.size(),
+                               scattered_children->release(),
+                               target.null_count(),
+                               copy_bitmask(target, stream, mr),
+                               stream,
+                               mr);
+  }
+};
+
 template <typename MapIterator>
 struct column_scatterer {
   template <typename Element>
@@ -223,9 +273,9 @@ std::unique_ptr<table> scatter(
   MapIterator scatter_map_begin,
   MapIterator scatter_map_end,
   table_view const& target,
-  bool check_bounds                   = false,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-  cudaStream_t stream                 = 0)
+  bool check_bounds,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
 
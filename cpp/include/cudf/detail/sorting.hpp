@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/types.hpp>
+#include <cudf/utilities/memory_estimate.hpp>
 
 #include <memory>
 #include <vector>
@@ -61,5 +62,23 @@ std::unique_ptr<table> sort_by_key(
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
   cudaStream_t stream                            = 0);
 
+/**
+ * @copydoc cudf::estimate_sort_memory
+ */
+memory_estimate estimate_sort_memory(table_view const& values, table_view const& keys);
+
+/**
+ * @copydoc cudf::top_k
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> top_k(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
+
 }  // namespace detail
 }  // namespace cudf
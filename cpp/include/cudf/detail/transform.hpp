@@ -33,6 +33,21 @@ std::unique_ptr<column> transform(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @copydoc cudf::transform(table_view const&, std::string const&, data_type, bool, null_policy,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::unique_ptr<column> transform(
+  table_view const& inputs,
+  std::string const& udf,
+  data_type output_type,
+  bool is_ptx,
+  null_policy nulls                   = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /**
  * @copydoc cudf::nans_to_nulls
  *
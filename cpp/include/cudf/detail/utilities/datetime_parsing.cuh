@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cstdint>
+
+/**
+ * @file datetime_parsing.cuh
+ * @brief Device functions for parsing ISO-8601 dates and times from characters.
+ *
+ * These are shared by the strings timestamp converter and the CSV and JSON readers as a fast
+ * path for the most common layouts, `YYYY-MM-DD` and `YYYY-MM-DD?HH:MM:SS`. The fields are
+ * read at fixed offsets, so a parser does not need to search for separators or interpret a
+ * format per character. A string that does not match the layout exactly is left to the general
+ * parser of the caller.
+ */
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Number of characters of an ISO-8601 date, `YYYY-MM-DD`
+ */
+constexpr size_type iso_date_length = 10;
+
+/**
+ * @brief Number of characters of an ISO-8601 date and time, `YYYY-MM-DD?HH:MM:SS`
+ */
+constexpr size_type iso_datetime_length = 19;
+
+/**
+ * @brief Date and time fields parsed from an ISO-8601 string
+ */
+struct iso_datetime {
+  int32_t year   = 0;
+  int32_t month  = 1;
+  int32_t day    = 1;
+  int32_t hour   = 0;
+  int32_t minute = 0;
+  int32_t second = 0;
+};
+
+/**
+ * @brief Returns the value of `N` decimal digits, or -1 if any character is not a digit
+ *
+ * @param str First of the (at least) `N` characters to parse
+ */
+template <int N>
+__device__ inline int32_t parse_fixed_digits(char const* str)
+{
+  int32_t value = 0;
+#pragma unroll
+  for (int idx = 0; idx < N; ++idx) {
+    auto const digit = static_cast<uint32_t>(str[idx] - '0');
+    if (digit > 9) { return -1; }
+    value = value * 10 + static_cast<int32_t>(digit);
+  }
+  return value;
+}
+
+/**
+ * @brief Parses an ISO-8601 date, `YYYY-MM-DD`, into the date fields of `result`
+ *
+ * @param str First of the (at least) `iso_date_length` characters to parse
+ * @param result Receives the year, month and day
+ * @return true if the characters have the layout of an ISO-8601 date
+ */
+__device__ inline bool parse_iso_date(char const* str, iso_datetime& result)
+{
+  if (str[4] != '-' || str[7] != '-') { return false; }
+  auto const year  = parse_fixed_digits<4>(str);
+  auto const month = parse_fixed_digits<2>(str + 5);
+  auto const day   = parse_fixed_digits<2>(str + 8);
+  if (year < 0 || month < 0 || day < 0) { return false; }
+  result.year  = year;
+  result.month = month;
+  result.day   = day;
+  return true;
+}
+
+/**
+ * @brief Parses an ISO-8601 date and time, `YYYY-MM-DD?HH:MM:SS`, into `result`
+ *
+ * The date and time may be separated by either `T` or a space.
+ *
+ * @param str First of the (at least) `iso_datetime_length` characters to parse
+ * @param result Receives the fields of the date and time
+ * @return true if the characters have the layout of an ISO-8601 date and time
+ */
+__device__ inline bool parse_iso_datetime(char const* str, iso_datetime& result)
+{
+  if ((str[10] != 'T' && str[10] != ' ') || str[13] != ':' || str[16] != ':') { return false; }
+  auto const hour   = parse_fixed_digits<2>(str + 11);
+  auto const minute = parse_fixed_digits<2>(str + 14);
+  auto const second = parse_fixed_digits<2>(str + 17);
+  if (hour < 0 || minute < 0 || second < 0 || !parse_iso_date(str, result)) { return false; }
+  result.hour   = hour;
+  result.minute = minute;
+  result.second = second;
+  return true;
+}
+
+}  // namespace detail
+}  // namespace cudf
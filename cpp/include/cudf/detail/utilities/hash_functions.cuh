@@ -18,8 +18,71 @@
 
 #include <cudf/strings/string_view.cuh>
 
+#include <cstring>
+
 using hash_value_type = uint32_t;
 
+namespace cudf {
+namespace detail {
+/**
+ * @brief Loads the 4 bytes at `ptr`, which may not be aligned, with aligned
+ * 4-byte reads
+ *
+ * The bytes are read from the one or two aligned words that contain them and
+ * joined with a funnel shift. Aligned words that contain a byte of a device
+ * allocation are within the allocation, so no other memory is accessed.
+ */
+CUDA_HOST_DEVICE_CALLABLE uint32_t load_unaligned_uint32(uint8_t const* ptr)
+{
+#ifndef __CUDA_ARCH__
+  CUDF_FAIL("Hashing a string in host code is not supported.");
+#else
+  auto const address = reinterpret_cast<uintptr_t>(ptr);
+  auto const aligned = reinterpret_cast<uint32_t const*>(address & ~uintptr_t{3});
+  auto const shift   = static_cast<uint32_t>(address & 3) * 8;
+  if (shift == 0) { return aligned[0]; }
+  return __funnelshift_r(aligned[0], aligned[1], shift);
+#endif
+}
+
+/**
+ * @brief Reads words of the bytes of a string in device memory, which has no
+ * alignment guarantee
+ */
+struct unaligned_word_reader {
+  CUDA_HOST_DEVICE_CALLABLE uint32_t word32(uint8_t const* ptr) const
+  {
+    return load_unaligned_uint32(ptr);
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t word64(uint8_t const* ptr) const
+  {
+    return static_cast<uint64_t>(load_unaligned_uint32(ptr)) |
+           (static_cast<uint64_t>(load_unaligned_uint32(ptr + 4)) << 32);
+  }
+};
+
+/**
+ * @brief Reads words of the bytes of a fixed-width key held by the hash functor
+ */
+struct native_word_reader {
+  CUDA_HOST_DEVICE_CALLABLE uint32_t word32(uint8_t const* ptr) const
+  {
+    uint32_t word;
+    std::memcpy(&word, ptr, sizeof(word));
+    return word;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE uint64_t word64(uint8_t const* ptr) const
+  {
+    uint64_t word;
+    std::memcpy(&word, ptr, sizeof(word));
+    return word;
+  }
+};
+}  // namespace detail
+}  // namespace cudf
+
 // MurmurHash3_32 implementation from
 // https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.cpp
 //-----------------------------------------------------------------------------
@@ -35,6 +98,7 @@ struct MurmurHash3_32 {
   using result_type   = hash_value_type;
 
   CUDA_HOST_DEVICE_CALLABLE MurmurHash3_32() : m_seed(0) {}
+  CUDA_HOST_DEVICE_CALLABLE MurmurHash3_32(uint32_t seed) : m_seed(seed) {}
 
   CUDA_HOST_DEVICE_CALLABLE uint32_t rotl32(uint32_t x, int8_t r) const
   {
@@ -155,14 +219,9 @@ MurmurHash3_32<cudf::string_view>::operator()(cudf::string_view const& key) cons
   result_type h1        = m_seed;
   constexpr uint32_t c1 = 0xcc9e2d51;
   constexpr uint32_t c2 = 0x1b873593;
-  auto getblock32       = [] __host__ __device__(const uint32_t* p, int i) -> uint32_t {
-  // Individual byte reads for unaligned accesses (very likely)
-#ifndef __CUDA_ARCH__
-    CUDF_FAIL("Hashing a string in host code is not supported.");
-#else
-    auto q = (const uint8_t*)(p + i);
-    return q[0] | (q[1] << 8) | (q[2] << 16) | (q[3] << 24);
-#endif
+  // Strings are not aligned, so their blocks are read with aligned word loads
+  auto getblock32 = [] __host__ __device__(const uint32_t* p, int i) -> uint32_t {
+    return cudf::detail::load_unaligned_uint32(reinterpret_cast<const uint8_t*>(p + i));
   };
 
   //----------
@@ -211,6 +270,179 @@ MurmurHash3_32<double>::operator()(double const& key) const
   return this->compute_floating_point(key);
 }
 
+/**
+ * @brief xxHash64 hash function, which hashes keys to 64 bits
+ *
+ * Implementation of XXH64 from https://github.com/Cyan4973/xxHash, by Yann
+ * Collet, BSD 2-Clause License. Its 64-bit hash values make collisions of
+ * distinct rows unlikely even among billions of rows.
+ */
+template <typename Key>
+struct XXHash_64 {
+  using argument_type = Key;
+  using result_type   = uint64_t;
+
+  CUDA_HOST_DEVICE_CALLABLE XXHash_64() : m_seed(0) {}
+  CUDA_HOST_DEVICE_CALLABLE XXHash_64(uint64_t seed) : m_seed(seed) {}
+
+  /**
+   * @brief  Combines two hash values into a new single hash value. Called
+   * repeatedly to create a hash value from several variables.
+   * 64-bit version of the Boost hash_combine function
+   * https://www.boost.org/doc/libs/1_35_0/doc/html/boost/hash_combine_id241013.html
+   *
+   * @param lhs The first hash value to combine
+   * @param rhs The second hash value to combine
+   *
+   * @returns A hash value that intelligently combines the lhs and rhs hash values
+   */
+  CUDA_HOST_DEVICE_CALLABLE result_type hash_combine(result_type lhs, result_type rhs) const
+  {
+    result_type combined{lhs};
+
+    combined ^= rhs + 0x9e3779b97f4a7c15 + (combined << 6) + (combined >> 2);
+
+    return combined;
+  }
+
+  result_type CUDA_HOST_DEVICE_CALLABLE operator()(Key const& key) const { return compute(key); }
+
+  template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_floating_point(T const& key) const
+  {
+    // -0.0 and 0.0, and all NaNs, compare equal and so must hash equal
+    if (key == T{0.0}) {
+      return compute(T{0.0});
+    } else if (isnan(key)) {
+      return compute(std::numeric_limits<T>::quiet_NaN());
+    } else {
+      return compute(key);
+    }
+  }
+
+  template <typename TKey>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute(TKey const& key) const
+  {
+    return compute_bytes(reinterpret_cast<uint8_t const*>(&key),
+                         sizeof(TKey),
+                         cudf::detail::native_word_reader{});
+  }
+
+  template <typename WordReader>
+  result_type CUDA_HOST_DEVICE_CALLABLE compute_bytes(uint8_t const* data,
+                                                      uint64_t len,
+                                                      WordReader read) const
+  {
+    uint8_t const* const end = data + len;
+    result_type h64;
+    //----------
+    // body: 32-byte stripes processed by four accumulators
+    if (len >= 32) {
+      uint8_t const* const limit = end - 32;
+      result_type v1             = m_seed + prime1 + prime2;
+      result_type v2             = m_seed + prime2;
+      result_type v3             = m_seed;
+      result_type v4             = m_seed - prime1;
+      do {
+        v1 = round(v1, read.word64(data));
+        v2 = round(v2, read.word64(data + 8));
+        v3 = round(v3, read.word64(data + 16));
+        v4 = round(v4, read.word64(data + 24));
+        data += 32;
+      } while (data <= limit);
+      h64 = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+      h64 = merge_round(h64, v1);
+      h64 = merge_round(h64, v2);
+      h64 = merge_round(h64, v3);
+      h64 = merge_round(h64, v4);
+    } else {
+      h64 = m_seed + prime5;
+    }
+    h64 += len;
+    //----------
+    // tail
+    for (; data + 8 <= end; data += 8) {
+      h64 ^= round(0, read.word64(data));
+      h64 = rotl64(h64, 27) * prime1 + prime4;
+    }
+    if (data + 4 <= end) {
+      h64 ^= static_cast<result_type>(read.word32(data)) * prime1;
+      h64 = rotl64(h64, 23) * prime2 + prime3;
+      data += 4;
+    }
+    for (; data < end; ++data) {
+      h64 ^= static_cast<result_type>(*data) * prime5;
+      h64 = rotl64(h64, 11) * prime1;
+    }
+    //----------
+    // finalization
+    h64 ^= h64 >> 33;
+    h64 *= prime2;
+    h64 ^= h64 >> 29;
+    h64 *= prime3;
+    h64 ^= h64 >> 32;
+    return h64;
+  }
+
+ private:
+  static constexpr result_type prime1 = 0x9e3779b185ebca87;
+  static constexpr result_type prime2 = 0xc2b2ae3d27d4eb4f;
+  static constexpr result_type prime3 = 0x165667b19e3779f9;
+  static constexpr result_type prime4 = 0x85ebca77c2b2ae63;
+  static constexpr result_type prime5 = 0x27d4eb2f165667c5;
+
+  CUDA_HOST_DEVICE_CALLABLE result_type rotl64(result_type x, int8_t r) const
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE result_type round(result_type acc, result_type input) const
+  {
+    acc += input * prime2;
+    acc = rotl64(acc, 31);
+    return acc * prime1;
+  }
+
+  CUDA_HOST_DEVICE_CALLABLE result_type merge_round(result_type acc, result_type val) const
+  {
+    acc ^= round(0, val);
+    return acc * prime1 + prime4;
+  }
+
+  uint64_t m_seed;
+};
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<bool>::operator()(bool const& key) const
+{
+  return this->compute(static_cast<uint8_t>(key));
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<float>::operator()(float const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE XXHash_64<double>::operator()(double const& key) const
+{
+  return this->compute_floating_point(key);
+}
+
+/**
+ * @brief Specialization of XXHash_64 operator for strings, which reads their
+ * bytes 8 at a time with aligned word loads.
+ */
+template <>
+uint64_t CUDA_HOST_DEVICE_CALLABLE
+XXHash_64<cudf::string_view>::operator()(cudf::string_view const& key) const
+{
+  return this->compute_bytes(reinterpret_cast<uint8_t const*>(key.data()),
+                             key.size_bytes(),
+                             cudf::detail::unaligned_word_reader{});
+}
+
 /* --------------------------------------------------------------------------*/
 /**
  * @brief  This hash function simply returns the value that is asked to be hash
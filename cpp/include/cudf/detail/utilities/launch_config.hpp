@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @file launch_config.hpp
+ * @brief Per-architecture block sizes of tunable kernels
+ *
+ * A tunable kernel is written for any of a set of candidate block sizes and launched with the
+ * block size of a `tuned_launch`. The block size of each kernel on a device of a given compute
+ * capability is read from the file named by the `LIBCUDF_LAUNCH_CONFIG` environment variable,
+ * one `<compute capability> <kernel> <block size>` entry per line:
+ *
+ *     # '#' starts a comment
+ *     75 csv_data_type_detection 64
+ *     80 csv_data_type_detection 256
+ *
+ * Kernels without an entry, and entries that are not candidates of their kernel, use the default
+ * block size of the kernel.
+ *
+ * If `LIBCUDF_LAUNCH_CONFIG_TUNE` names a file, the launches of each kernel cycle through its
+ * candidates and are timed, and `write_tuned_launch_configs()` writes to that file the loaded
+ * entries updated with the fastest candidate of every kernel run on the current device, measured
+ * per unit of work. The benchmarks write the file after every run: running them on a device with
+ * the variable set produces a configuration for its architecture.
+ */
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Launch parameters of a kernel whose block size can be tuned
+ *
+ * Declared once per kernel, at namespace scope of the file launching it.
+ */
+struct tunable_kernel {
+  char const* name;             ///< Key of the kernel in the configuration file
+  int default_block_size;       ///< Block size the kernel was tuned for originally
+  std::vector<int> candidates;  ///< Block sizes the kernel supports, including the default
+};
+
+/**
+ * @brief Returns the block size of a kernel on the current device
+ */
+int launch_block_size(tunable_kernel const& kernel);
+
+/**
+ * @brief Sets the block size of a kernel on devices of the compute capability of the current
+ * device, as an entry of the configuration file does
+ *
+ * @param kernel Name of the kernel
+ * @param block_size Block size; ignored at launch if not a candidate of the kernel
+ */
+void set_launch_block_size(std::string const& kernel, int block_size);
+
+/**
+ * @brief Loads the entries of a configuration file, replacing the entries of the same kernels
+ *
+ * @throw cudf::logic_error if the file cannot be read or a line is not a valid entry
+ *
+ * @param path Path of the file
+ */
+void load_launch_configs(std::string const& path);
+
+/**
+ * @brief Writes the tuned configuration if tuning is enabled by `LIBCUDF_LAUNCH_CONFIG_TUNE`
+ *
+ * Waits for the timed launches to complete.
+ *
+ * @return Whether tuning is enabled
+ */
+bool write_tuned_launch_configs();
+
+/**
+ * @brief Chooses the block size of one launch of a tunable kernel
+ *
+ * The kernel is launched on `stream` during the lifetime of the object. When tuning, the block
+ * size is the next candidate of the kernel and the launch is timed with events recorded by the
+ * constructor and the destructor.
+ *
+ * Example:
+ * @code{.cpp}
+ * tunable_kernel const my_kernel_config{"my_kernel", 128, {64, 128, 256}};
+ *
+ * tuned_launch launch(my_kernel_config, num_rows, stream);
+ * auto const grid_size = (num_rows + launch.block_size() - 1) / launch.block_size();
+ * my_kernel<<<grid_size, launch.block_size(), 0, stream>>>(...);
+ * @endcode
+ */
+class tuned_launch {
+ public:
+  /**
+   * @param kernel The launched kernel
+   * @param work Amount of work of the launch, e.g. its number of rows, by which its time is
+   * divided to compare launches of different sizes
+   * @param stream Stream the kernel is launched on
+   */
+  tuned_launch(tunable_kernel const& kernel, std::size_t work, cudaStream_t stream);
+  ~tuned_launch();
+
+  tuned_launch(tuned_launch const&) = delete;
+  tuned_launch& operator=(tuned_launch const&) = delete;
+
+  int block_size() const { return _block_size; }
+
+ private:
+  tunable_kernel const& _kernel;
+  std::size_t _work;
+  cudaStream_t _stream;
+  int _block_size;
+  int _arch;
+  cudaEvent_t _start = nullptr;  ///< Recorded before the launch when tuning
+};
+
+}  // namespace detail
+}  // namespace cudf
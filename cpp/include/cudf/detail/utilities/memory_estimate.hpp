@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cstddef>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Estimates the device memory of the columns made by gathering `num_rows` rows of `input`
+ *
+ * Fixed-width columns are sized exactly. The rows of strings and list columns are charged the
+ * average size of a row of their children, computed on the host from the sizes of the children,
+ * and dictionary columns are charged their indices plus a copy of all of their keys.
+ *
+ * @param input Columns to gather from
+ * @param num_rows Number of rows gathered
+ * @param nullable Whether every gathered column gets a null mask, as the columns of the outer
+ * side of a join do; otherwise only the columns of `input` that have a null mask get one
+ *
+ * @return Estimated bytes of the gathered columns
+ */
+std::size_t estimate_gather_bytes(table_view const& input,
+                                  std::size_t num_rows,
+                                  bool nullable = false);
+
+}  // namespace detail
+}  // namespace cudf
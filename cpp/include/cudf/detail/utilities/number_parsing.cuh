@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/**
+ * @file number_parsing.cuh
+ * @brief Device functions for parsing decimal numbers from characters.
+ *
+ * These are shared by the strings converters and the CSV and JSON readers.
+ * Runs of decimal digits are consumed 8 at a time by loading them into a
+ * single 64-bit word and combining the digits with a few multiplications
+ * (SIMD within a register).
+ */
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Mantissas below this value can take one more decimal digit without
+ * overflowing 64 bits.
+ */
+constexpr uint64_t max_decimal_mantissa{1000000000000000000ul};
+
+/**
+ * @brief Loads 8 characters into a word with the first character in its lowest byte.
+ *
+ * @param ptr First of the (at least) 8 characters to load. No alignment is required.
+ */
+__device__ inline uint64_t load_eight_chars(char const* ptr)
+{
+  uint64_t chars = 0;
+  for (int idx = 0; idx < 8; ++idx) {
+    chars |= static_cast<uint64_t>(static_cast<uint8_t>(ptr[idx])) << (8 * idx);
+  }
+  return chars;
+}
+
+/**
+ * @brief Returns true if all 8 characters loaded by `load_eight_chars` are the digits [0-9].
+ */
+__device__ inline bool is_eight_digits(uint64_t chars)
+{
+  // each byte must be 0x3? and stay below 0x40 after adding 6
+  return (((chars & 0xF0F0F0F0F0F0F0F0ul) |
+           (((chars + 0x0606060606060606ul) & 0xF0F0F0F0F0F0F0F0ul) >> 4)) ==
+          0x3333333333333333ul);
+}
+
+/**
+ * @brief Returns the value of the 8 digits loaded by `load_eight_chars`.
+ *
+ * Pairs, quads and then the two halves of the digits are combined with one
+ * multiplication each.
+ */
+__device__ inline uint32_t parse_eight_digits(uint64_t chars)
+{
+  chars -= 0x3030303030303030ul;
+  chars = (chars * 10) + (chars >> 8);
+  chars = (((chars & 0x000000FF000000FFul) * (100 + (1000000ul << 32))) +
+           (((chars >> 16) & 0x000000FF000000FFul) * (1 + (10000ul << 32)))) >>
+          32;
+  return static_cast<uint32_t>(chars);
+}
+
+/**
+ * @brief Consumes the decimal digits [0-9] starting at `ptr` into `value`.
+ *
+ * The digits are accumulated modulo 2^64; `overflow` is set if the digits
+ * exceed the range of `uint64_t`.
+ *
+ * @param ptr First character to parse
+ * @param end End of the characters to parse
+ * @param[in,out] value Accumulated value of the digits
+ * @param[in,out] overflow Set to true if the value overflowed. Unchanged otherwise.
+ * @return Pointer to the first character that is not a digit
+ */
+__device__ inline char const* parse_integer_digits(char const* ptr,
+                                                   char const* end,
+                                                   uint64_t& value,
+                                                   bool& overflow)
+{
+  auto constexpr max_value = std::numeric_limits<uint64_t>::max();
+  while (end - ptr >= 8) {
+    auto const chars = load_eight_chars(ptr);
+    if (!is_eight_digits(chars)) break;
+    auto const digits = parse_eight_digits(chars);
+    overflow |= value > (max_value - digits) / 100000000ul;
+    value = value * 100000000ul + digits;
+    ptr += 8;
+  }
+  while (ptr < end && *ptr >= '0' && *ptr <= '9') {
+    auto const digit = static_cast<uint64_t>(*ptr++ - '0');
+    overflow |= value > (max_value - digit) / 10;
+    value = value * 10 + digit;
+  }
+  return ptr;
+}
+
+/**
+ * @brief Adds a decimal digit to a mantissa and decimal exponent pair.
+ *
+ * Digits that do not fit the mantissa are dropped and only scale the exponent.
+ *
+ * @param digit Value of the digit [0-9]
+ * @param fraction True if the digit follows the decimal point
+ * @param[in,out] mantissa Significant digits of the number
+ * @param[in,out] exponent Power of ten applied to the mantissa
+ * @param[in,out] truncated Set to true when a non-zero digit is dropped
+ */
+__device__ inline void add_decimal_digit(
+  uint32_t digit, bool fraction, uint64_t& mantissa, int32_t& exponent, bool& truncated)
+{
+  if (mantissa < max_decimal_mantissa) {
+    mantissa = mantissa * 10 + digit;
+    exponent -= fraction;
+  } else {
+    exponent += !fraction;
+    truncated |= digit != 0;
+  }
+}
+
+/**
+ * @brief Consumes the decimal digits [0-9] starting at `ptr` into a mantissa
+ * and decimal exponent pair.
+ *
+ * @param ptr First character to parse
+ * @param end End of the characters to parse
+ * @param fraction True if the digits follow the decimal point
+ * @param[in,out] mantissa Significant digits of the number
+ * @param[in,out] exponent Power of ten applied to the mantissa
+ * @param[in,out] truncated Set to true when a non-zero digit is dropped
+ * @return Pointer to the first character that is not a digit
+ */
+__device__ inline char const* parse_decimal_digits(char const* ptr,
+                                                   char const* end,
+                                                   bool fraction,
+                                                   uint64_t& mantissa,
+                                                   int32_t& exponent,
+                                                   bool& truncated)
+{
+  // 8 more digits fit while the mantissa is below 10^11
+  while (end - ptr >= 8 && mantissa < 100000000000ul) {
+    auto const chars = load_eight_chars(ptr);
+    if (!is_eight_digits(chars)) break;
+    mantissa = mantissa * 100000000ul + parse_eight_digits(chars);
+    exponent -= fraction ? 8 : 0;
+    ptr += 8;
+  }
+  while (ptr < end && *ptr >= '0' && *ptr <= '9') {
+    add_decimal_digit(*ptr++ - '0', fraction, mantissa, exponent, truncated);
+  }
+  return ptr;
+}
+
+/**
+ * @brief Returns 10^`exponent` for `exponent` in [0, 22], all of which are
+ * exactly representable as doubles.
+ */
+__device__ inline double exact_power_of_ten(int32_t exponent)
+{
+  double value = 1.0;
+  double power = 10.0;
+  // each square and product stays exact as long as the result is at most 10^22
+  for (; exponent > 0; exponent >>= 1) {
+    if (exponent & 1) value *= power;
+    power *= power;
+  }
+  return value;
+}
+
+/**
+ * @brief Returns the double closest to `mantissa * 10^exponent`.
+ *
+ * The result is correctly rounded when the mantissa holds all the significant
+ * digits, is at most 2^53 and the exponent is within [-22, 22]: both operands are
+ * then exact and IEEE multiplication and division round correctly. Other values
+ * are scaled with `exp10` and may be off by a few units in the last place.
+ *
+ * @param mantissa Significant digits of the number
+ * @param exponent Power of ten applied to the mantissa
+ * @param truncated True if some significant digits were dropped from the mantissa
+ */
+__device__ inline double decimal_to_double(uint64_t mantissa, int32_t exponent, bool truncated)
+{
+  if (mantissa == 0) return 0.0;
+  auto value = static_cast<double>(mantissa);
+  if (!truncated && mantissa <= (1ul << 53) && exponent >= -22 && exponent <= 22) {
+    return exponent < 0 ? value / exact_power_of_ten(-exponent)
+                        : value * exact_power_of_ten(exponent);
+  }
+  if (exponent > 308) return std::numeric_limits<double>::infinity();
+  if (exponent < -343) return 0.0;
+  // keep the intermediate value normal for the smallest exponents
+  if (exponent < -307) {
+    value *= 1e-307;
+    exponent += 307;
+  }
+  // using exp10() since the pow(10.0,exp_ten) function is
+  // very inaccurate in 10.2: http://nvbugs/2971187
+  return value * exp10(static_cast<double>(exponent));
+}
+
+/**
+ * @brief Parses an integer from `[begin, end)`.
+ *
+ * An optional '+' or '-' prefix is followed by base-10 digits [0-9]. Parsing
+ * stops at the first other character and the digits so far are converted,
+ * wrapping modulo 2^64 and then cast to `T`.
+ *
+ * @tparam T Integral type of the value
+ * @param begin First character to parse
+ * @param end End of the characters to parse
+ * @param[out] value The parsed integer
+ * @return true if all the characters were consumed, there was at least one digit
+ *         and the value fits in `T`
+ */
+template <typename T>
+__device__ inline bool parse_integer(char const* begin, char const* end, T& value)
+{
+  static_assert(std::is_integral<T>::value, "parse_integer requires an integral type");
+  auto ptr            = begin;
+  bool const negative = ptr < end && *ptr == '-';
+  if (ptr < end && (*ptr == '-' || *ptr == '+')) ++ptr;
+  uint64_t magnitude = 0;
+  bool overflow      = false;
+  auto const digits  = ptr;
+  ptr                = parse_integer_digits(ptr, end, magnitude, overflow);
+  value = static_cast<T>(static_cast<int64_t>(negative ? 0ul - magnitude : magnitude));
+  // the magnitude of the minimum of a signed type is one more than its maximum
+  auto const max_value = static_cast<uint64_t>(std::numeric_limits<T>::max());
+  auto const limit = negative ? (std::is_signed<T>::value ? max_value + 1 : 0ul) : max_value;
+  return ptr == end && ptr > digits && !overflow && magnitude <= limit;
+}
+
+/**
+ * @brief Parses a double from `[begin, end)`.
+ *
+ * An optional '+' or '-' prefix is followed by base-10 digits with an optional
+ * decimal point '.' and an optional exponent ("e" or "E", an optional sign and
+ * digits). The exact strings "NaN", "Inf" and "-Inf" are also recognized.
+ * Parsing stops at the first other character and the characters so far are converted.
+ *
+ * @param begin First character to parse
+ * @param end End of the characters to parse
+ * @param[out] value The parsed double
+ * @return true if all the characters were consumed and there was at least one
+ *         digit before the exponent
+ */
+__device__ inline bool parse_double(char const* begin, char const* end, double& value)
+{
+  auto const equals = [begin, end](char const* str, cudf::size_type bytes) {
+    if (end - begin != bytes) return false;
+    for (cudf::size_type idx = 0; idx < bytes; ++idx) {
+      if (begin[idx] != str[idx]) return false;
+    }
+    return true;
+  };
+  if (equals("NaN", 3)) {
+    value = std::numeric_limits<double>::quiet_NaN();
+    return true;
+  }
+  if (equals("Inf", 3) || equals("-Inf", 4)) {
+    value = (*begin == '-' ? -1 : 1) * std::numeric_limits<double>::infinity();
+    return true;
+  }
+
+  auto ptr          = begin;
+  double const sign = (ptr < end && *ptr == '-') ? -1.0 : 1.0;
+  if (ptr < end && (*ptr == '-' || *ptr == '+')) ++ptr;
+  uint64_t mantissa = 0;
+  int32_t exponent  = 0;
+  bool truncated    = false;
+  auto const digits = ptr;
+  ptr               = parse_decimal_digits(ptr, end, false, mantissa, exponent, truncated);
+  auto digits_count = ptr - digits;
+  if (ptr < end && *ptr == '.') {
+    auto const fraction = ++ptr;
+    ptr = parse_decimal_digits(ptr, end, true, mantissa, exponent, truncated);
+    digits_count += ptr - fraction;
+  }
+  bool valid = digits_count > 0;
+  if (ptr < end && (*ptr == 'e' || *ptr == 'E')) {
+    ++ptr;
+    int32_t const exp_sign = (ptr < end && *ptr == '-') ? -1 : 1;
+    if (ptr < end && (*ptr == '-' || *ptr == '+')) ++ptr;
+    auto const exp_digits = ptr;
+    int32_t exp_ten       = 0;
+    while (ptr < end && *ptr >= '0' && *ptr <= '9') {
+      // larger exponents saturate to zero or infinity anyway
+      if (exp_ten < 100000) exp_ten = exp_ten * 10 + (*ptr - '0');
+      ++ptr;
+    }
+    valid = valid && ptr > exp_digits;
+    exponent += exp_sign * exp_ten;
+  }
+  value = sign * decimal_to_double(mantissa, exponent, truncated);
+  return valid && ptr == end;
+}
+
+}  // namespace detail
+}  // namespace cudf
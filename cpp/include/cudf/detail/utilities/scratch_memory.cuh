@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/scratch_memory.hpp>
+
+#include <rmm/mr/device/thrust_allocator_adaptor.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+/**
+ * @file scratch_memory.cuh
+ * @brief Helpers allocating the temporaries of an API from the scratch resource
+ *
+ * `rmm::exec_policy()` and `rmm::device_vector` allocate from the default resource. Internal code
+ * uses these helpers instead, so that a caller's `scratch_resource_scope` applies to them.
+ */
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Returns a thrust execution policy whose temporary storage is allocated from the scratch
+ * resource on `stream`
+ *
+ * Used as `scratch_policy(stream)->on(stream)`, like `rmm::exec_policy()`.
+ */
+inline rmm::exec_policy_t scratch_policy(cudaStream_t stream = 0)
+{
+  auto* alloc  = new rmm::mr::thrust_allocator<char>(get_scratch_resource(), stream);
+  auto deleter = [alloc](rmm::par_t* pointer) {
+    delete alloc;
+    delete pointer;
+  };
+  return rmm::exec_policy_t{new rmm::par_t(*alloc), deleter};
+}
+
+/**
+ * @brief Returns a thrust allocator of the scratch resource on `stream`
+ */
+template <typename T>
+rmm::mr::thrust_allocator<T> scratch_allocator(cudaStream_t stream = 0)
+{
+  return rmm::mr::thrust_allocator<T>(get_scratch_resource(), stream);
+}
+
+/**
+ * @brief Returns an `rmm::device_vector` of `size` elements equal to `value`, allocated from the
+ * scratch resource on `stream`
+ *
+ * The vector keeps its allocator, so it is freed to the same resource wherever it is destroyed.
+ */
+template <typename T>
+rmm::device_vector<T> make_scratch_vector(std::size_t size,
+                                          T const& value      = T{},
+                                          cudaStream_t stream = 0)
+{
+  return rmm::device_vector<T>(size, value, scratch_allocator<T>(stream));
+}
+
+}  // namespace detail
+}  // namespace cudf
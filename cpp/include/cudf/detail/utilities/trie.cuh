@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,8 +23,12 @@
 #ifndef TRIE_CUH
 #define TRIE_CUH
 
+#include <algorithm>
+#include <cstdint>
 #include <deque>
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <cuda_runtime.h>
@@ -148,4 +152,131 @@ __host__ __device__ inline bool serializedTrieContains(const SerialTrieNode *tri
   return trie[curr_node].is_leaf;
 }
 
+/**
+ * @brief Slot of the perfect hash table placed in front of a serialized trie
+ *
+ * A slot holds the length and the first (up to) eight bytes of one key. `exact` is set when these
+ * identify the key; otherwise the key is longer than eight bytes and the match is confirmed in the
+ * trie.
+ */
+struct SerialTrieHashSlot {
+  uint64_t prefix{0};
+  int32_t length{-1};
+  bool exact{false};
+};
+
+/**
+ * @brief Host representation of the perfect hash table of a set of keys
+ */
+struct SerializedTrieHash {
+  thrust::host_vector<SerialTrieHashSlot> slots;  ///< Power-of-two number of slots, or empty
+  uint32_t seed{0};
+};
+
+/**
+ * @brief Device-accessible view of a serialized trie, optionally with its perfect hash table
+ */
+struct SerialTrieView {
+  SerialTrieNode const *nodes{nullptr};
+  SerialTrieHashSlot const *hash_slots{nullptr};  ///< If null, keys are only looked up in the trie
+  uint32_t hash_mask{0};
+  uint32_t hash_seed{0};
+};
+
+/**
+ * @brief Returns the first (up to) eight bytes of a key, zero padded, as a little-endian integer
+ */
+__host__ __device__ inline uint64_t serializedTrieKeyPrefix(const char *key, size_t key_len)
+{
+  uint64_t prefix = 0;
+  for (size_t i = 0; i < key_len && i < sizeof(prefix); ++i) {
+    prefix |= static_cast<uint64_t>(static_cast<uint8_t>(key[i])) << (8 * i);
+  }
+  return prefix;
+}
+
+__host__ __device__ inline uint32_t serializedTrieHash(uint64_t prefix,
+                                                       uint64_t key_len,
+                                                       uint32_t seed)
+{
+  uint64_t h = (prefix + seed) * 0x9E3779B97F4A7C15ull;
+  h ^= (key_len + seed) * 0xC2B2AE3D27D4EB4Full;
+  return static_cast<uint32_t>(h >> 32);
+}
+
+/**
+ * @brief Create a perfect hash table of the (length, prefix) pairs of a set of keys
+ *
+ * Searches for a seed that maps the distinct pairs to distinct slots, growing the table up to 64
+ * slots per pair. Returns an empty table if no such seed is found, in which case lookups only use
+ * the trie.
+ *
+ * @param[in] keys Array of strings in the set
+ *
+ * @return The slots and the seed of the hash table
+ */
+inline SerializedTrieHash createSerializedTrieHash(const std::vector<std::string> &keys)
+{
+  // Distinct (length, prefix) pairs, and whether each identifies a single key that fits the prefix
+  std::map<std::pair<int32_t, uint64_t>, bool> pairs;
+  for (const auto &key : keys) {
+    auto const pair = std::make_pair(static_cast<int32_t>(key.size()),
+                                     serializedTrieKeyPrefix(key.data(), key.size()));
+    pairs.emplace(pair, key.size() <= sizeof(uint64_t));
+  }
+
+  SerializedTrieHash hash;
+  if (pairs.empty()) { return hash; }
+  static constexpr uint32_t max_seeds = 256;
+  size_t num_slots                    = 1;
+  while (num_slots < 2 * pairs.size()) { num_slots *= 2; }
+  for (; num_slots <= 64 * pairs.size(); num_slots *= 2) {
+    for (uint32_t seed = 0; seed < max_seeds; ++seed) {
+      thrust::host_vector<SerialTrieHashSlot> slots(num_slots);
+      bool const collision_free =
+        std::all_of(pairs.begin(), pairs.end(), [&](auto const &pair) {
+          auto &slot =
+            slots[serializedTrieHash(pair.first.second, pair.first.first, seed) & (num_slots - 1)];
+          if (slot.length >= 0) { return false; }
+          slot.length = pair.first.first;
+          slot.prefix = pair.first.second;
+          slot.exact  = pair.second;
+          return true;
+        });
+      if (collision_free) {
+        hash.slots = std::move(slots);
+        hash.seed  = seed;
+        return hash;
+      }
+    }
+  }
+  return hash;
+}
+
+/*
+ * @brief Searches for a string in a serialized trie, first checking its perfect hash table
+ *
+ * A key is found in the hash table with a single probe comparing its length and first bytes; only
+ * the keys longer than eight bytes that match a slot are then searched in the trie.
+ *
+ * @param[in] trie View of the trie and its hash table
+ * @param[in] key Pointer to the start of the string to find
+ * @param[in] key_len Length of the string to find
+ *
+ * @return Boolean value, true if string is found, false otherwise
+ */
+__host__ __device__ inline bool serializedTrieContains(SerialTrieView const &trie,
+                                                       const char *key,
+                                                       size_t key_len)
+{
+  if (trie.hash_slots == nullptr) { return serializedTrieContains(trie.nodes, key, key_len); }
+  auto const prefix = serializedTrieKeyPrefix(key, key_len);
+  auto const &slot =
+    trie.hash_slots[serializedTrieHash(prefix, key_len, trie.hash_seed) & trie.hash_mask];
+  if (slot.length < 0 || static_cast<size_t>(slot.length) != key_len || slot.prefix != prefix) {
+    return false;
+  }
+  return slot.exact || serializedTrieContains(trie.nodes, key, key_len);
+}
+
 #endif  // TRIE_CUH
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Copies a host vector to a new device vector, ordered on `stream`
+ *
+ * Unlike constructing an `rmm::device_vector` from the host vector, the copy is issued on
+ * `stream` rather than on the legacy default stream, so it does not synchronize with other
+ * streams. The host vector must stay alive until the copy completes.
+ *
+ * @param source Host vector to copy
+ * @param stream CUDA stream used for the allocation and the copy
+ * @param mr Device memory resource used to allocate the returned vector
+ */
+template <typename T>
+rmm::device_uvector<T> make_device_uvector_async(
+  std::vector<T> const& source,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+{
+  rmm::device_uvector<T> result(source.size(), stream, mr);
+  if (not source.empty()) {
+    CUDA_TRY(cudaMemcpyAsync(
+      result.data(), source.data(), source.size() * sizeof(T), cudaMemcpyHostToDevice, stream));
+  }
+  return result;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+
+/**
+ * @file warp_bitmask.cuh
+ * @brief Word-at-a-time validity helpers for element-wise kernels
+ *
+ * In a grid-stride loop whose block size is a multiple of the warp size, the lanes of a warp
+ * process the 32 consecutive rows of one validity word. The warp can then load the validity of its
+ * rows as a single word instead of testing one bit per row, skip the per-row checks of all-valid
+ * and all-null words, and store the output validity with a single ballot.
+ */
+
+namespace cudf {
+namespace detail {
+static constexpr bitmask_type all_valid_word = ~bitmask_type{0};
+
+/**
+ * @brief Returns the validity of the rows `[word_idx * 32, word_idx * 32 + 32)` of a column
+ *
+ * The offset of the column is applied, so that bit `j` of the result is the validity of row
+ * `word_idx * 32 + j`. Returns `all_valid_word` if the column has no null mask. The bits of the
+ * rows past the end of the column are undefined.
+ *
+ * @param col The column
+ * @param word_idx Index of the word, relative to the first row of the column
+ */
+__device__ inline bitmask_type get_validity_word(column_device_view_base const& col,
+                                                 size_type word_idx)
+{
+  if (not col.nullable()) { return all_valid_word; }
+  auto const begin_bit  = col.offset() + word_idx * size_in_bits<bitmask_type>();
+  auto const source_idx = word_index(begin_bit);
+  auto const shift      = intra_word_index(begin_bit);
+  auto const curr_word  = col.null_mask()[source_idx];
+  if (shift == 0) { return curr_word; }
+  // The next word is read only if it holds rows of the column
+  auto const next_word = (word_index(col.offset() + col.size() - 1) > source_idx)
+                           ? col.null_mask()[source_idx + 1]
+                           : bitmask_type{0};
+  return __funnelshift_r(curr_word, next_word, shift);
+}
+
+/**
+ * @brief Returns the bit of a validity word holding the validity of a row
+ *
+ * @param word Validity word of the 32 rows including `row`, from `get_validity_word()`
+ * @param row Index of the row
+ */
+__device__ inline bool is_valid_in_word(bitmask_type word, size_type row)
+{
+  return (word >> intra_word_index(row)) & 1;
+}
+
+/**
+ * @brief Stores the output validity of the rows of a warp with one ballot
+ *
+ * Called by the lanes of `active_mask`, lane `j` passing the validity of row `first_row + j`,
+ * where `first_row` is a multiple of 32.
+ *
+ * @param mask Output null mask
+ * @param row Index of the row of the calling lane
+ * @param valid Validity of the row of the calling lane
+ * @param active_mask Lanes of the warp processing a row
+ * @return The number of valid rows on lane 0, and 0 on the other lanes, so that the returned
+ * counts can be summed across the block
+ */
+__device__ inline size_type warp_set_validity_word(bitmask_type* mask,
+                                                   size_type row,
+                                                   bool valid,
+                                                   uint32_t active_mask)
+{
+  auto const word = __ballot_sync(active_mask, valid);
+  if (threadIdx.x % warp_size == 0) {
+    mask[word_index(row)] = word;
+    return __popc(word);
+  }
+  return 0;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+
+namespace cudf {
+namespace dictionary {
+namespace detail {
+/**
+ * @brief Returns a single column by vertically concatenating the given vector of
+ * dictionary columns.
+ *
+ * The keys of the output are the union of the keys of the inputs. Only the keys are merged;
+ * the indices of each input are remapped to the union as in `set_keys()` and then
+ * concatenated, so the values of the dictionaries are never decoded.
+ *
+ * ```
+ * d1 = {["a","c"],[1,0,1]}
+ * d2 = {["b","c"],[0,1]}
+ * r = concatenate({d1,d2})
+ * r is now {["a","b","c"],[2,0,2,1,2]}
+ * ```
+ *
+ * @throw cudf::logic_error if the keys types of the dictionaries do not match
+ *
+ * @param columns Vector of dictionary columns to concatenate.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return New column with concatenated results.
+ */
+std::unique_ptr<column> concatenate(
+  std::vector<column_view> const& columns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace dictionary
+}  // namespace cudf
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+namespace cudf {
+namespace dictionary {
+namespace detail {
+/**
+ * @brief Returns a view of the table where each dictionary column is replaced by
+ * its indices with the offset, size and nulls of the dictionary.
+ *
+ * The keys of a dictionary are sorted and unique, so comparing, hashing or
+ * sorting the indices of a dictionary column gives the same result as doing so
+ * with its keys, without reading them.
+ *
+ * Other columns are returned as is.
+ *
+ * @param input Table whose dictionary columns are replaced.
+ * @return View of the table with the indices in place of the dictionary columns.
+ */
+table_view get_indices_annotated(table_view const& input);
+
+/**
+ * @brief Rebuilds dictionary columns from columns of indices computed from
+ * `get_indices_annotated(dictionaries)`, for example with a gather.
+ *
+ * Each INT32 column of `indices` at the position of a dictionary column of
+ * `dictionaries` becomes a dictionary column with a copy of its keys. The other
+ * columns are returned as is.
+ *
+ * ```
+ * d = {["a","c"],[1,0,1,1]}
+ * i = gather(get_indices_annotated({[d]}), [3,1])
+ * r = restore_dictionaries(i, {[d]})
+ * r is now {[{["a","c"],[1,0]}]}
+ * ```
+ *
+ * @throw cudf::logic_error if the tables do not have the same number of columns
+ *
+ * @param indices Table of indices and other columns.
+ * @param dictionaries Table the indices were computed from.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Table with the dictionary columns rebuilt.
+ */
+std::unique_ptr<table> restore_dictionaries(
+  std::unique_ptr<table>&& indices,
+  table_view const& dictionaries,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+}  // namespace detail
+}  // namespace dictionary
+}  // namespace cudf
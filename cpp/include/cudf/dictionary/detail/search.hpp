@@ -33,6 +33,31 @@ std::unique_ptr<numeric_scalar<int32_t>> get_index(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Get the index at which a key would be inserted into the keys of a
+ * dictionary column to keep them sorted.
+ *
+ * This is the index of the first key that is not less than `key`. It is the
+ * number of keys if `key` is greater than all of them. Since the keys are sorted,
+ * an element of the dictionary is less than `key` if and only if its index is less
+ * than the returned index.
+ *
+ * The result is not valid if `key` is not valid.
+ *
+ * @throw cudf::logic_error if `key.type() != dictionary.keys().type()`
+ *
+ * @param dictionary The dictionary to search for the key.
+ * @param key The value to search for in the dictionary keyset.
+ * @param mr Device memory resource used to allocate the returned scalar's device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Numeric scalar index value of the insert position
+ */
+std::unique_ptr<numeric_scalar<int32_t>> get_insert_index(
+  dictionary_column_view const& dictionary,
+  scalar const& key,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace dictionary
 }  // namespace cudf
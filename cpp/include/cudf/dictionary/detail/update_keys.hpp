@@ -17,6 +17,10 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace dictionary {
@@ -83,6 +87,39 @@ std::unique_ptr<column> set_keys(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Makes the dictionary columns at the same position in each of the tables
+ * share the same keys.
+ *
+ * The keys of each matched column are the union of the keys of that column in all
+ * the tables, as computed by `set_keys`. Since the shared keys are sorted, the
+ * indices of the matched columns can then be compared across tables in place of
+ * their keys.
+ *
+ * Columns that are not dictionaries, empty columns and dictionaries whose keys are
+ * already the union are returned as is.
+ *
+ * ```
+ * t1 = {[{["a","c"],[1,0,1]}]}
+ * t2 = {[{["b","c"],[0,1]}]}
+ * r = match_dictionaries({t1,t2})
+ * r.second is now {[{["a","b","c"],[2,0,2]}]} and {[{["a","b","c"],[1,2]}]}
+ * ```
+ *
+ * @throw cudf::logic_error if the tables do not have the same number of columns
+ * @throw cudf::logic_error if only some of the columns at a position are dictionaries
+ * @throw cudf::logic_error if the keys types of the dictionaries at a position do not match
+ *
+ * @param input Tables to match.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The new dictionary columns and views of the tables with the matched columns.
+ */
+std::pair<std::vector<std::unique_ptr<column>>, std::vector<table_view>> match_dictionaries(
+  std::vector<table_view> const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 }  // namespace detail
 }  // namespace dictionary
 }  // namespace cudf
@@ -47,6 +47,39 @@ std::unique_ptr<table> from_dlpack(
   DLManagedTensor const* managed_tensor,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Calls the `deleter` of a DLPack tensor
+ */
+struct dlpack_tensor_deleter {
+  void operator()(DLManagedTensor* tensor) const;
+};
+
+/**
+ * @brief Columns viewing the memory of a DLPack tensor, which they keep alive
+ */
+struct dlpack_table_view {
+  table_view view;  ///< One column per column of the tensor
+  std::unique_ptr<DLManagedTensor, dlpack_tensor_deleter> tensor;  ///< The viewed tensor
+};
+
+/**
+ * @brief Wrap a DLPack DLTensor into non-owning cudf columns without copying its data
+ *
+ * The returned view takes ownership of the tensor and calls the tensor's `deleter` when it is
+ * destroyed, so the columns are valid for the lifetime of the returned object. The `device_type`
+ * of the DLTensor must be `kDLGPU` or `kDLCPUPinned`, and `device_id` must match the current
+ * device. The tensor must be 1D, or 2D in column-major (Fortran) order with contiguous columns.
+ * The `dtype` must have 1 lane and the bitsize must match a supported `cudf::data_type`.
+ *
+ * @throw cudf::logic_error if the any of the DLTensor fields are unsupported. The tensor is
+ * deleted in that case too.
+ *
+ * @param managed_tensor a 1D or 2D column-major (Fortran order) tensor
+ *
+ * @return Columns viewing the tensor data, along with the tensor
+ */
+dlpack_table_view from_dlpack_view(DLManagedTensor* managed_tensor);
+
 /**
  * @brief Convert a cudf table into a DLPack DLTensor
  *
@@ -68,5 +101,43 @@ std::unique_ptr<table> from_dlpack(
 DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Convert a cudf column into a 1D DLPack DLTensor without copying its data
+ *
+ * The tensor takes ownership of the column. The type of the column must be numeric. The column
+ * may have nulls: the values of the null rows in the tensor are unspecified, and the validity of
+ * the rows can be exported with `validity_to_dlpack()` before the column is converted. If the
+ * column has zero rows, the result will be nullptr.
+ *
+ * @note The `deleter` method of the returned `DLManagedTensor` must be used to
+ * free the column.
+ *
+ * @throw cudf::logic_error if the data type is not numeric
+ *
+ * @param input Column to convert to DLPack
+ *
+ * @return 1D DLPack tensor owning the column data, or nullptr
+ */
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input);
+
+/**
+ * @brief Export the validity of the rows of a cudf table as a boolean DLPack DLTensor
+ *
+ * The result has the layout of the tensor of `to_dlpack(input)`: a 1D tensor for a single
+ * column, and a 2D column-major tensor otherwise. Each element is an 8-bit unsigned integer, 1
+ * for a valid row of a column and 0 for a null. If the input table is empty or has zero rows, the
+ * result will be nullptr.
+ *
+ * @note The `deleter` method of the returned `DLManagedTensor` must be used to
+ * free the memory allocated for the tensor.
+ *
+ * @param input Table whose validity to convert to DLPack
+ * @param mr Device memory resource used to allocate the returned DLPack tensor's device memory.
+ *
+ * @return 1D or 2D DLPack tensor of the validity of the table, or nullptr
+ */
+DLManagedTensor* validity_to_dlpack(
+  table_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <memory>
+
+/**
+ * @file encode.hpp
+ * @brief Compressed in-memory encodings of columns
+ *
+ * Encoded columns keep the data of hot tables in less device memory. The operators below consume
+ * them directly; other operators take the column decoded on demand.
+ */
+
+namespace cudf {
+/**
+ * @addtogroup transformation_transform
+ * @{
+ */
+
+/**
+ * @brief Booleans stored as one bit per row
+ *
+ * The value bits use the layout of a null mask: the value of row `i` is bit `i` of `bits()`.
+ * The value bits of the null rows are unspecified.
+ */
+class packed_bools {
+ public:
+  packed_bools(size_type size,
+               rmm::device_buffer&& bits,
+               rmm::device_buffer&& null_mask,
+               size_type null_count)
+    : _size(size), _bits(std::move(bits)), _null_mask(std::move(null_mask)), _null_count(null_count)
+  {
+  }
+
+  /**
+   * @brief Returns the number of rows
+   */
+  size_type size() const noexcept { return _size; }
+
+  /**
+   * @brief Returns the number of null rows
+   */
+  size_type null_count() const noexcept { return _null_count; }
+
+  /**
+   * @brief Returns the device value bits
+   */
+  bitmask_type const* bits() const noexcept
+  {
+    return static_cast<bitmask_type const*>(_bits.data());
+  }
+
+  /**
+   * @brief Returns the device null mask, or nullptr if no row is null
+   */
+  bitmask_type const* null_mask() const noexcept
+  {
+    return _null_mask.size() > 0 ? static_cast<bitmask_type const*>(_null_mask.data()) : nullptr;
+  }
+
+ private:
+  size_type _size;
+  rmm::device_buffer _bits;
+  rmm::device_buffer _null_mask;
+  size_type _null_count;
+};
+
+/**
+ * @brief A column stored as runs of equal rows
+ *
+ * Run `r` repeats `values()[r]` over the rows `[run_ends()[r - 1], run_ends()[r])`, the first run
+ * starting at row 0. Consecutive null rows form a single null run.
+ */
+class run_length_encoded {
+ public:
+  run_length_encoded(size_type size,
+                     std::unique_ptr<column> values,
+                     std::unique_ptr<column> run_ends)
+    : _size(size), _values(std::move(values)), _run_ends(std::move(run_ends))
+  {
+  }
+
+  /**
+   * @brief Returns the number of decoded rows
+   */
+  size_type size() const noexcept { return _size; }
+
+  /**
+   * @brief Returns the number of runs
+   */
+  size_type num_runs() const noexcept { return _values->size(); }
+
+  /**
+   * @brief Returns the value of each run
+   */
+  column_view values() const { return _values->view(); }
+
+  /**
+   * @brief Returns the `INT32` end row (exclusive) of each run
+   */
+  column_view run_ends() const { return _run_ends->view(); }
+
+ private:
+  size_type _size;
+  std::unique_ptr<column> _values;
+  std::unique_ptr<column> _run_ends;
+};
+
+/**
+ * @brief Packs a `BOOL8` column to one bit per row
+ *
+ * @throws cudf::logic_error if `input` is not a `BOOL8` column
+ *
+ * @param input Booleans to pack
+ * @param mr Device memory resource used to allocate the returned device memory
+ * @return The packed booleans
+ */
+std::unique_ptr<packed_bools> pack_bools(
+  column_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Unpacks booleans to a `BOOL8` column
+ *
+ * @param input Booleans to unpack
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New `BOOL8` column
+ */
+std::unique_ptr<column> unpack_bools(
+  packed_bools const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Performs a comparison or logical operation on packed booleans, 32 rows at a time
+ *
+ * A row of the output is null if the row of either input is null.
+ *
+ * @throws cudf::logic_error if the inputs have different sizes
+ * @throws cudf::logic_error if `op` is not a comparison, or a bitwise or logical AND, OR or XOR
+ *
+ * @param lhs Left operand
+ * @param rhs Right operand
+ * @param op Operator
+ * @param mr Device memory resource used to allocate the returned device memory
+ * @return The packed results
+ */
+std::unique_ptr<packed_bools> binary_operation(
+  packed_bools const& lhs,
+  packed_bools const& rhs,
+  binary_operator op,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Filters a table with a packed boolean mask
+ *
+ * Same as `apply_boolean_mask(table_view const&, column_view const&,
+ * rmm::mr::device_memory_resource*)` with the mask read one bit per row.
+ *
+ * @throws cudf::logic_error if `input` is not empty and its size differs from the mask size
+ *
+ * @param input Table to filter
+ * @param boolean_mask Rows to keep: the valid rows with a set bit
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The kept rows
+ */
+std::unique_ptr<table> apply_boolean_mask(
+  table_view const& input,
+  packed_bools const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Encodes a fixed-width column as runs of equal rows
+ *
+ * @throws cudf::logic_error if `input` is not a fixed-width column
+ *
+ * @param input Column to encode
+ * @param mr Device memory resource used to allocate the returned device memory
+ * @return The runs of the column
+ */
+std::unique_ptr<run_length_encoded> run_length_encode(
+  column_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Decodes runs of equal rows to a column
+ *
+ * @param input Runs to decode
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New column of `input.size()` rows
+ */
+std::unique_ptr<column> run_length_decode(
+  run_length_encoded const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Reduces a run-length encoded column without decoding it
+ *
+ * Same as `reduce(column_view const&, std::unique_ptr<aggregation> const&, data_type,
+ * rmm::mr::device_memory_resource*)` on the decoded column. `MIN`, `MAX`, `ANY` and `ALL` reduce
+ * the run values; `SUM` weighs each run value by the length of its run.
+ *
+ * @throws cudf::logic_error if the aggregation is not `SUM`, `MIN`, `MAX`, `ANY` or `ALL`
+ *
+ * @param input Runs to reduce
+ * @param agg Aggregation operator
+ * @param output_dtype The computation and output precision
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @return Output scalar with reduce result
+ */
+std::unique_ptr<scalar> reduce(
+  run_length_encoded const& input,
+  std::unique_ptr<aggregation> const& agg,
+  data_type output_dtype,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Filters a table with a run-length encoded boolean mask
+ *
+ * Same as `apply_boolean_mask(table_view const&, column_view const&,
+ * rmm::mr::device_memory_resource*)` with the mask decoded. The rows are gathered with one map
+ * built from the kept runs.
+ *
+ * @throws cudf::logic_error if the mask values are not `BOOL8`
+ * @throws cudf::logic_error if `input` is not empty and its size differs from the mask size
+ *
+ * @param input Table to filter
+ * @param boolean_mask Rows to keep: the rows of the valid runs with a true value
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The kept rows
+ */
+std::unique_ptr<table> apply_boolean_mask(
+  table_view const& input,
+  run_length_encoded const& boolean_mask,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup column_sort
+ * @{
+ */
+
+/**
+ * @brief Where `external_sorter` keeps the sorted runs while they are merged
+ */
+enum class spill_location {
+  HOST,  ///< Pinned host memory
+  DISK   ///< A temporary file removed when the sorter is destroyed
+};
+
+/**
+ * @brief Settings of an `external_sorter`
+ */
+struct external_sort_options {
+  std::vector<size_type> key_columns;       ///< Indices of the key columns, all if empty
+  std::vector<order> column_order;          ///< Order of each key column, ascending if empty
+  std::vector<null_order> null_precedence;  ///< Order of nulls of each key column
+  spill_location location{spill_location::HOST};  ///< Where sorted runs are spilled
+  std::string spill_directory{"/tmp"};  ///< Directory of the spill file for `spill_location::DISK`
+  io::compression_type compression{io::compression_type::NONE};  ///< `NONE` or `SNAPPY`
+  size_type spill_block_rows{1 << 20};   ///< Rows per spilled block of a sorted run
+  size_type output_chunk_rows{1 << 20};  ///< Largest number of rows returned by `next()`
+};
+
+/**
+ * @brief Sorts a table too large for device memory.
+ *
+ * The table is passed to `append()` as a sequence of runs that each fit in
+ * device memory. Every run is sorted on the device, cut into blocks of
+ * `spill_block_rows` rows and spilled to pinned host memory or to disk,
+ * optionally compressed. `next()` then returns the sorted rows of all runs in
+ * chunks of at most `output_chunk_rows` rows, by merging the runs with
+ * `cudf::merge` while keeping a single block of each run in device memory.
+ *
+ * The device memory used by the merge is thus bounded by about
+ * `number of runs * spill_block_rows` rows, independent of the size of the
+ * table.
+ *
+ * Rows that compare equal are returned in an unspecified order. Only fixed-width
+ * and string columns are supported.
+ *
+ * Example:
+ * @code{.pseudo}
+ * cudf::external_sorter sorter(options);
+ * for (auto const& run : runs) { sorter.append(run); }
+ * while (sorter.has_next()) { write(sorter.next()); }
+ * @endcode
+ */
+class external_sorter {
+ public:
+  /**
+   * @brief Constructs a sorter of runs with the given settings
+   *
+   * @throw cudf::logic_error if `compression` is neither `NONE` nor `SNAPPY`
+   * @throw cudf::logic_error if `spill_block_rows` or `output_chunk_rows` is not positive
+   * @throw cudf::logic_error if the spill file cannot be created in `spill_directory`
+   */
+  explicit external_sorter(external_sort_options const& options);
+
+  ~external_sorter();
+
+  external_sorter(external_sorter const&) = delete;
+  external_sorter& operator=(external_sorter const&) = delete;
+
+  /**
+   * @brief Sorts a run of the table and spills it
+   *
+   * @throw cudf::logic_error if `next()` has already been called
+   * @throw cudf::logic_error if the columns of `run` do not match the columns
+   * of the previous runs, or do not contain the key columns
+   *
+   * @param run Rows of the table to sort
+   */
+  void append(table_view const& run);
+
+  /**
+   * @brief Indicates if there are sorted rows left to return by `next()`
+   */
+  bool has_next();
+
+  /**
+   * @brief Returns the next chunk of the sorted rows of all runs
+   *
+   * @throw cudf::logic_error if `has_next()` is false
+   *
+   * @param mr Device memory resource used to allocate the returned table's device memory.
+   * @return At most `output_chunk_rows` rows that follow the rows returned so far in sorted order
+   */
+  std::unique_ptr<table> next(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 
+#pragma once
+
+#include <cudf/types.hpp>
+
 #include <cassert>
 #include <cmath>
 #include <functional>
@@ -278,6 +282,8 @@ class fixed_point {
   scale_type _scale;
 
  public:
+  using rep = Rep;
+
   /**
    * @brief Constructor that will perform shifting to store value appropriately
    *
@@ -309,6 +315,16 @@ class fixed_point {
   CUDA_HOST_DEVICE_CALLABLE
   fixed_point() : _value{0}, _scale{scale_type{0}} {}
 
+  /**
+   * @brief Returns the underlying (shifted) integer value
+   */
+  CUDA_HOST_DEVICE_CALLABLE Rep value() const { return _value; }
+
+  /**
+   * @brief Returns the scale
+   */
+  CUDA_HOST_DEVICE_CALLABLE scale_type scale() const { return _scale; }
+
   /**
    * @brief Explicit conversion operator
    *
@@ -771,5 +787,8 @@ std::ostream& operator<<(std::ostream& os, fixed_point<Rep, Radix> const& fp)
   return os << static_cast<double>(fp);
 }
 
+using decimal32 = fixed_point<int32_t, Radix::BASE_10>;
+using decimal64 = fixed_point<int64_t, Radix::BASE_10>;
+
 /** @} */  // end of group
 }  // namespace numeric
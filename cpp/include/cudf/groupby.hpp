@@ -17,9 +17,14 @@
 #pragma once
 
 #include <cudf/aggregation.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/replace.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/memory_estimate.hpp>
 
+#include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -32,6 +37,14 @@ class sort_groupby_helper;
 
 }  // namespace sort
 }  // namespace detail
+}  // namespace groupby
+namespace structs {
+namespace detail {
+struct flattened_table;
+
+}  // namespace detail
+}  // namespace structs
+namespace groupby {
 
 /**
  * @addtogroup aggregation_groupby
@@ -86,6 +99,10 @@ class groupby {
    * order of each column and null order in  `column_order` and
    * `null_precedence`, respectively.
    *
+   * Struct columns of `keys` are grouped by their fields, and two null structs
+   * are equivalent. A struct key with a null field counts as a key with NULL
+   * values for `null_handling`.
+   *
    * @note This object does *not* maintain the lifetime of `keys`. It is the
    * user's responsibility to ensure the `groupby` object does not outlive the
    * data viewed by the `keys` `table_view`.
@@ -107,6 +124,29 @@ class groupby {
                    std::vector<order> const& column_order         = {},
                    std::vector<null_order> const& null_precedence = {});
 
+  /**
+   * @brief Construct a groupby object with unsorted `keys` and the precomputed
+   * hash value of each of their rows
+   *
+   * Saves hashing the keys again when they were already hashed, e.g. to hash
+   * partition them. The hashes may come from any function, e.g. `cudf::hash`.
+   * They are only used by the hash-based implementation.
+   *
+   * @note This object does *not* maintain the lifetime of `keys` and
+   * `key_hashes`.
+   *
+   * @throw cudf::logic_error if `key_hashes` is not a non-nullable column of
+   * 32- or 64-bit integers with one row per row of `keys`
+   *
+   * @param keys Table whose rows act as the groupby keys
+   * @param key_hashes The hash value of each row of `keys`
+   * @param null_handling Indicates whether rows in `keys` that contain
+   * NULL values should be included
+   */
+  groupby(table_view const& keys,
+          column_view const& key_hashes,
+          null_policy null_handling = null_policy::EXCLUDE);
+
   /**
    * @brief Performs grouped aggregations on the specified values.
    *
@@ -156,13 +196,83 @@ class groupby {
    * @param requests The set of columns to aggregate and the aggregations to
    * perform
    * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches
    * @return Pair containing the table with each group's unique key and
    * a vector of aggregation_results for each request in the same order as
    * specified in `requests`.
    */
   std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate(
     std::vector<aggregation_request> const& requests,
-    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+  /**
+   * @brief Estimates the device memory used by `aggregate(requests)` without computing it
+   *
+   * The estimate follows the implementation `aggregate` dispatches to. A hash-based groupby is
+   * charged its hash map and sparse results, sized like the groupby sizes them, and the
+   * partitioned copy of the input when it partitions the input. A sort-based groupby is charged
+   * the sort of the keys, the group labels and the sorted values of every request.
+   *
+   * @throws cudf::logic_error if `requests[i].values.size() != keys.num_rows()`.
+   *
+   * @param requests The set of columns to aggregate and the aggregations to perform
+   * @param num_groups The expected number of groups; negative to estimate it from a sample of
+   * the rows of the keys, as the hash-based groupby does to choose its strategy
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The estimated output and peak scratch bytes of the aggregation
+   */
+  memory_estimate estimate_memory(std::vector<aggregation_request> const& requests,
+                                  size_type num_groups = -1,
+                                  cudaStream_t stream  = 0);
+
+  /**
+   * @brief Performs grouped scans on the specified values.
+   *
+   * Unlike `aggregate`, which produces one row per group, a scan produces one row per row of the
+   * values: the aggregation of the row with all the rows before it in its group. The rows of
+   * each group keep their order in `keys`, and the groups are in sorted order of their keys.
+   * Rows with null keys are excluded if the keys exclude nulls.
+   *
+   * Supported aggregations:
+   * - SUM, MIN and MAX of numeric values; null values are skipped, and are null in the result
+   * - COUNT_VALID and COUNT_ALL; the result has no nulls
+   * - RANK; the result has no nulls and ignores `inclusive`
+   *
+   * An exclusive scan aggregates the rows before each row only, starting from the identity of
+   * the aggregation at the first row of each group.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() != keys.num_rows()`
+   * @throws cudf::logic_error If an aggregation or its values type is not supported
+   *
+   * Example:
+   * ```
+   * Input:
+   * keys:     {1 2 1 3 1}
+   * request:
+   *   values: {3 1 4 9 2}
+   *   aggregations: {{SUM}, {MIN}}
+   *
+   * result:
+   *
+   * keys:  {1 1 1 2 3}
+   * values:
+   *   SUM: {3 7 9 1 9}
+   *   MIN: {3 3 2 1 9}
+   * ```
+   *
+   * @param requests The set of columns to scan and the aggregations to perform
+   * @param inclusive Whether the scans are inclusive or exclusive
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Pair containing the table of the keys of every row of the results, and a vector of
+   * aggregation_results for each request in the same order as specified in `requests`
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> scan(
+    std::vector<aggregation_request> const& requests,
+    scan_type inclusive                 = scan_type::INCLUSIVE,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
 
   /**
    * @brief The grouped data corresponding to a groupby operation on a set of values.
@@ -188,10 +298,118 @@ class groupby {
    * @param values Table representing values on which a groupby operation is to be performed
    * @param mr Device memory resource used to allocate the returned tables's device memory in the
    * returned groups
+   * @param stream CUDA stream used for device memory operations and kernel launches
    * @return A `groups` object representing grouped keys and values
    */
   groups get_groups(cudf::table_view values             = {},
-                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                    cudaStream_t stream                 = 0);
+
+  /**
+   * @brief Computes the row indices of the first `k` rows of each group in
+   * lexicographical sorted order of `order_by`
+   *
+   * The indices are grouped as the `groups` returned by `get_groups`, with the
+   * indices of each group in sorted order of their `order_by` rows and equal
+   * rows in their input order. Groups with fewer than `k` rows have all their
+   * rows returned. Rows with null keys are excluded if `include_null_keys` is
+   * `null_policy::EXCLUDE`.
+   *
+   * @throw cudf::logic_error if `order_by` and the keys differ in number of rows
+   * @throw cudf::logic_error if `k` is negative
+   *
+   * @param order_by Table whose rows order the rows within each group
+   * @param k Largest number of rows returned per group
+   * @param column_order The desired sort order for each column of `order_by`.
+   * Size must be equal to `order_by.num_columns()` or empty. If empty, all
+   * columns are sorted in ascending order.
+   * @param null_precedence The desired order of null compared to other elements
+   * for each column of `order_by`. Size must be equal to
+   * `order_by.num_columns()` or empty. If empty, `null_order::BEFORE` is used.
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return A non-nullable column of `size_type` row indices of the keys
+   */
+  std::unique_ptr<column> top_k(
+    table_view const& order_by,
+    size_type k,
+    std::vector<order> const& column_order         = {},
+    std::vector<null_order> const& null_precedence = {},
+    rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+    cudaStream_t stream                            = 0);
+
+  /**
+   * @brief Shifts the values of each group by an offset.
+   *
+   * Within each group, `output[i] = values[i - offset]`, where `i` is the position of a row in its
+   * group. The rows whose source is outside of their group are set to `fill_value`. The rows of
+   * each group keep their order in `keys`, and the groups are in sorted order of their keys, as
+   * in `scan`. Rows with null keys are excluded if the keys exclude nulls.
+   *
+   * Example:
+   * ```
+   * keys:       {1 2 1 2 1}
+   * values:     {3 1 4 9 2}
+   * offset:     1
+   * fill_value: 0
+   *
+   * result:
+   * keys:       {1 1 1 2 2}
+   * values:     {0 3 4 0 1}
+   * ```
+   *
+   * @throws cudf::logic_error If `values.size() != keys.num_rows()`
+   * @throws cudf::logic_error If `fill_value` and `values` differ in type
+   *
+   * @param values Column whose values are shifted
+   * @param offset The offset by which to shift the values; negative offsets shift them backwards
+   * @param fill_value Fill value for the rows without a source in their group
+   * @param mr Device memory resource used to allocate the returned table and column
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Pair containing the table of the keys of every row of the result, and the shifted
+   * values
+   */
+  std::pair<std::unique_ptr<table>, std::unique_ptr<column>> shift(
+    column_view const& values,
+    size_type offset,
+    scalar const& fill_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+  /**
+   * @brief Replaces the null values of each group with the first valid value before or after
+   * them in the group.
+   *
+   * The rows of each group keep their order in `keys`, and the groups are in sorted order of
+   * their keys, as in `scan`. Nulls without a valid value in the same direction in their group
+   * stay null. Rows with null keys are excluded if the keys exclude nulls.
+   *
+   * Example:
+   * ```
+   * keys:      {1 2 1 2 1}
+   * values:    {3 @ @ 9 @}
+   * PRECEDING:
+   * keys:      {1 1 1 2 2}
+   * values:    {3 3 3 @ 9}
+   * FOLLOWING:
+   * keys:      {1 1 1 2 2}
+   * values:    {3 @ @ 9 9}
+   * ```
+   *
+   * @throws cudf::logic_error If `values.size() != keys.num_rows()`
+   *
+   * @param values Column whose null values are replaced
+   * @param replace_policy Specify the position of the valid value relative to null value
+   * @param mr Device memory resource used to allocate the returned table and column
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Pair containing the table of the keys of every row of the result, and the values
+   * with the nulls replaced
+   */
+  std::pair<std::unique_ptr<table>, std::unique_ptr<column>> replace_nulls(
+    column_view const& values,
+    replace_policy const& replace_policy,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
 
  private:
   table_view _keys;                                      ///< Keys that determine grouping
@@ -203,10 +421,29 @@ class groupby {
   std::vector<null_order> _null_precedence{};            ///< If keys are sorted,
                                                          ///< indicates null order
                                                          ///< of each column
+  column_view _key_hashes{};                             ///< Precomputed hash of each
+                                                         ///< row of the keys, if any
+  table_view _nested_keys{};                             ///< Keys as given, if their struct
+                                                         ///< columns are flattened in `_keys`
+  std::unique_ptr<structs::detail::flattened_table>
+    _flattened_keys;  ///< Columns of `_keys`, if `_nested_keys`
+                      ///< has struct columns
   std::unique_ptr<detail::sort::sort_groupby_helper>
     _helper;  ///< Helper object
               ///< used by sort based implementation
 
+  /**
+   * @brief Replaces the struct columns of the keys by their fields
+   *
+   * Struct keys are grouped by the flattened columns, and rebuilt from them by `unflatten_keys`.
+   */
+  void flatten_keys(cudaStream_t stream);
+
+  /**
+   * @brief Rebuilds the struct columns of keys gathered from the flattened keys
+   */
+  std::unique_ptr<table> unflatten_keys(std::unique_ptr<table>&& keys);
+
   /**
    * @brief Get the sort helper object
    *
@@ -229,7 +466,310 @@ class groupby {
     std::vector<aggregation_request> const& requests,
     cudaStream_t stream,
     rmm::mr::device_memory_resource* mr);
+
+  // Sort-based groupby that computes the hash-compatible aggregations with a
+  // hash-based groupby over the sorted group labels
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> hybrid_aggregate(
+    std::vector<aggregation_request> const& requests,
+    cudaStream_t stream,
+    rmm::mr::device_memory_resource* mr);
 };
+
+/**
+ * @brief Groups values by keys across a sequence of batches and computes
+ * aggregations on the groups of all batches seen so far.
+ *
+ * Each call to `update` aggregates one batch and merges the result into the
+ * partial state of every group, which stays in device memory between
+ * batches. `finalize` computes the aggregation results from the partial state
+ * without consuming it, so results can be emitted after any batch.
+ *
+ * The partial state is proportional to the number of groups, not to the
+ * number of rows seen:
+ * - SUM, MIN, MAX, COUNT_VALID, COUNT_ALL: the running aggregate
+ * - MEAN: the running sum and count of valid values
+ * - VARIANCE, STD: the count, mean and sum of squared deviations (M2) of the
+ *   valid values, merged with the pairwise update of Chan et al.
+ * - NUNIQUE: the distinct (key, value) pairs seen so far
+ *
+ * Example:
+ * ```
+ * Batch 1: keys: {1 2 1}  values: {2 4 6}
+ * Batch 2: keys: {3 1}    values: {5 1}
+ *
+ * After both updates, with a MEAN aggregation:
+ *   keys: {1 2 3}
+ *   MEAN: {3 4 5}
+ * ```
+ * The order of the groups in the result is unspecified.
+ */
+class incremental_groupby {
+ public:
+  incremental_groupby(incremental_groupby const&) = delete;
+  incremental_groupby& operator=(incremental_groupby const&) = delete;
+  ~incremental_groupby();
+
+  /**
+   * @brief Construct an incremental groupby object with no groups
+   *
+   * @param include_null_keys Indicates whether rows in the keys of a batch
+   * that contain NULL values should be included
+   */
+  explicit incremental_groupby(null_policy include_null_keys = null_policy::EXCLUDE);
+
+  /**
+   * @brief Aggregates one batch of rows and merges the result into the
+   * partial state of the groups.
+   *
+   * The first call fixes the requested aggregations and the value types of
+   * each request. Every later call must pass requests with the same
+   * aggregations on values of the same types.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() != keys.num_rows()`
+   * @throws cudf::logic_error If an aggregation other than SUM, MIN, MAX,
+   * COUNT_VALID, COUNT_ALL, MEAN, VARIANCE, STD or NUNIQUE is requested, or
+   * MIN/MAX is requested on a non fixed-width type
+   * @throws cudf::logic_error If the requests or the key types differ from
+   * those of the first call
+   *
+   * @param keys Table whose rows act as the groupby keys of the batch
+   * @param requests The set of columns of the batch to aggregate and the
+   * aggregations to perform
+   */
+  void update(table_view const& keys, std::vector<aggregation_request> const& requests);
+
+  /**
+   * @brief Computes the aggregations over all batches merged so far.
+   *
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Pair containing the table with each group's unique key and
+   * a vector of aggregation_results for each request in the same order as
+   * specified in the calls to `update`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> finalize(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Returns the unique key of every group merged so far, in the order
+   * of the groups of `evict`, or a table with no columns before any update.
+   *
+   * The view is invalidated by the next call to `update` or `evict`.
+   */
+  table_view keys() const;
+
+  /**
+   * @brief Computes the aggregations of the selected groups and removes them
+   * from the partial state.
+   *
+   * An evicted group starts again from an empty state if a later batch has
+   * its key.
+   *
+   * @throws cudf::logic_error If there was no prior update
+   * @throws cudf::logic_error If `selection` is not a BOOL8 column with one row
+   * per row of `keys()`
+   *
+   * @param selection Indicates for each row of `keys()` whether its group is
+   * evicted. Null rows are not evicted.
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Pair containing the table with the key of each evicted group and a
+   * vector of aggregation_results for each request in the same order as
+   * specified in the calls to `update`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> evict(
+    column_view const& selection,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+ private:
+  null_policy _include_null_keys{null_policy::EXCLUDE};  ///< Include rows in keys
+                                                         ///< with NULLs
+  std::vector<data_type> _value_types;                   ///< Type of the values of each request
+  std::unique_ptr<table> _keys;                          ///< Unique keys of all groups so far
+  /// Aggregations of each request
+  std::vector<std::vector<std::unique_ptr<aggregation>>> _aggregations;
+  /// Partial state of each aggregation of each request. Holds one row per row of `_keys`,
+  /// except for NUNIQUE whose state holds the distinct pairs of key and value rows.
+  std::vector<std::vector<std::unique_ptr<table>>> _states;
+};
+
+/**
+ * @brief Groups rows by fixed-size time buckets of a timestamp column, and by
+ * `keys`, and computes aggregations on the groups.
+ *
+ * The bucket of a timestamp `t` starts at `floor(t / bucket_size) * bucket_size`,
+ * so that buckets are aligned on the Unix epoch. The bucket starts are computed
+ * in a single pass over the timestamps, in place of the datetime floor and casts
+ * that build such a key column otherwise. They are still materialized: the
+ * groupby hashes and compares them as a temporary key column, which takes one
+ * timestamp-sized element per row of scratch memory.
+ *
+ * If the timestamps are sorted and there are no other keys, the rows of each
+ * bucket are consecutive: the groups are found and aggregated segment by
+ * segment, without a hash table or a sort. Otherwise the groups are found like
+ * `groupby::aggregate` finds them.
+ *
+ * Example:
+ * ```
+ * timestamps (seconds): {0 130 299 300 310 650}
+ * bucket_size: 300 seconds
+ * keys:                 {1 2   1   1   1   2}
+ * request:
+ *   values:             {1 2   3   4   5   6}
+ *   aggregations:       {{SUM}}
+ *
+ * result (in any order):
+ *
+ * keys:  buckets {0 0 300 600}
+ *        keys    {1 2 1   2}
+ * values:
+ *   SUM:         {4 2 9   6}
+ * ```
+ *
+ * @throw cudf::logic_error if `timestamps` is not a timestamp column
+ * @throw cudf::logic_error if `bucket_size` is not a valid, positive duration
+ * scalar of the resolution of `timestamps`
+ * @throw cudf::logic_error if `keys` or the values of a request do not have
+ * one row per timestamp
+ *
+ * @param timestamps Timestamps whose buckets group the rows
+ * @param bucket_size Duration of a bucket, e.g. a `duration_scalar<duration_s>`
+ * of 300 for 5-minute buckets of a `TIMESTAMP_SECONDS` column
+ * @param keys Table whose rows group the rows of each bucket; may have no columns
+ * @param requests The set of columns to aggregate and the aggregations to
+ * perform
+ * @param null_handling Indicates whether rows with a null timestamp or a null
+ * key should be included
+ * @param timestamps_are_sorted Indicates whether `timestamps` are sorted in
+ * ascending order, with nulls first
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Pair of the table of the bucket start of each group followed by its
+ * keys, and the aggregation_results of each request in the order of `requests`.
+ * The groups are in ascending bucket order if the timestamps are sorted and there
+ * are no other keys, and in arbitrary order otherwise.
+ */
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> time_bucket_aggregate(
+  column_view const& timestamps,
+  scalar const& bucket_size,
+  table_view const& keys,
+  std::vector<aggregation_request> const& requests,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  sorted timestamps_are_sorted        = sorted::NO,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Aggregates a stream of batches of events over tumbling event-time
+ * windows, and emits the aggregations of each window once the watermark passes
+ * its end.
+ *
+ * The window of an event at time `t` is its bucket in `time_bucket_aggregate`,
+ * `[start, start + window_size)` with `start` a multiple of `window_size` since
+ * the Unix epoch. The groups are the pairs of a window start and a row of the
+ * keys. Their partial aggregates stay in device memory between batches, merged
+ * like `incremental_groupby` merges them, so a batch costs an aggregation of its
+ * own rows rather than of all the events of the open windows.
+ *
+ * The watermark is the event time before which no more events are expected.
+ * `advance_watermark` emits and evicts the groups of the windows it closes, the
+ * windows that end at or before the watermark. Late events, whose window was
+ * already closed, are dropped by `update`. Events that are out of order within
+ * windows still open are aggregated normally. Events with a null time belong to
+ * no window and are dropped.
+ *
+ * Example:
+ * ```
+ * window_size: 60 seconds, aggregation: SUM
+ *
+ * update: times {5 50 61 130}  keys {1 1 1 2}  values {1 2 3 4}
+ * advance_watermark(120) emits:
+ *   windows {0 60}  keys {1 1}  SUM {3 3}
+ * update: times {30 125}  keys {1 2}  values {5 6}
+ *   returns 1: the event at 30 is late and dropped
+ * advance_watermark(180) emits:
+ *   windows {120}  keys {2}  SUM {10}
+ * ```
+ */
+class event_time_window_groupby {
+ public:
+  event_time_window_groupby(event_time_window_groupby const&) = delete;
+  event_time_window_groupby& operator=(event_time_window_groupby const&) = delete;
+  ~event_time_window_groupby();
+
+  /**
+   * @brief Construct a window groupby object with no open windows
+   *
+   * @throws cudf::logic_error If `window_size` is not a valid, positive duration
+   * scalar
+   *
+   * @param window_size Duration of a window; event times and watermarks must be
+   * timestamps of its resolution
+   * @param include_null_keys Indicates whether rows in the keys of a batch
+   * that contain NULL values should be included
+   */
+  explicit event_time_window_groupby(scalar const& window_size,
+                                     null_policy include_null_keys = null_policy::EXCLUDE);
+
+  /**
+   * @brief Merges one batch of events into the partial aggregates of their
+   * windows.
+   *
+   * The requests follow the rules of `incremental_groupby::update`.
+   *
+   * @throws cudf::logic_error If `event_times` is not a timestamp column of the
+   * resolution of the window size
+   * @throws cudf::logic_error If `keys` or the values of a request do not have
+   * one row per event
+   * @throws cudf::logic_error If the requests do not match those of the first
+   * call, as in `incremental_groupby::update`
+   *
+   * @param event_times Time of each event of the batch
+   * @param keys Table whose rows group the events of each window; may have no columns
+   * @param requests The set of columns of the batch to aggregate and the
+   * aggregations to perform
+   * @return The number of late events dropped
+   */
+  size_type update(column_view const& event_times,
+                   table_view const& keys,
+                   std::vector<aggregation_request> const& requests);
+
+  /**
+   * @brief Advances the watermark, and emits and evicts the groups of the
+   * windows it closes.
+   *
+   * A watermark earlier than the current one does not move it back.
+   *
+   * @throws cudf::logic_error If `watermark` is not a valid timestamp scalar of
+   * the resolution of the window size
+   *
+   * @param watermark Event time before which no more events are expected
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Pair of the table of the window start of each closed group followed
+   * by its keys, and the aggregation_results of each request in the same order as
+   * specified in the calls to `update`. The table has no columns if there was no
+   * update yet. The order of the groups is unspecified.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> advance_watermark(
+    scalar const& watermark,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+  /**
+   * @brief Returns the number of groups of the windows still open
+   */
+  size_type num_open_groups() const { return _groups.keys().num_rows(); }
+
+ private:
+  std::unique_ptr<scalar> _window_size;  ///< Copy of the window size scalar
+  int64_t _window_ticks{};               ///< Window size in ticks of its resolution
+  int64_t _watermark;                    ///< Watermark in ticks since the epoch
+  incremental_groupby _groups;           ///< Partial aggregates of the open groups
+};
+
 /** @} */
 }  // namespace groupby
 }  // namespace cudf
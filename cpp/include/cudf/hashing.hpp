@@ -38,5 +38,173 @@ std::unique_ptr<column> hash(table_view const& input,
                              std::vector<uint32_t> const& initial_hash = {},
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes the hash value of each row in the input set of columns with
+ * the given hash function.
+ *
+ * `hash_id::HASH_MURMUR3` returns the same `INT32` hash values as
+ * `hash(input)`. `hash_id::HASH_XXHASH64` returns `UINT64` hash values, whose
+ * collisions are rare enough to tell apart billions of distinct rows.
+ *
+ * @param input The table of columns to hash
+ * @param hash_function The hash function to use
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns A column where each row is the hash of a row of the input
+ */
+std::unique_ptr<column> hash(table_view const& input,
+                             hash_id hash_function,
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Builds a HyperLogLog sketch of the distinct non-null values of each
+ * group of `values`.
+ *
+ * A sketch is `2^precision` registers of type `UINT8`, and the sketch of group
+ * `g` is made of rows `[g * 2^precision, (g + 1) * 2^precision)` of the returned
+ * column. Values are hashed to 64 bits by two `MurmurHash3_32` hashes with
+ * different seeds, so sketches built from different columns can be merged with
+ * `merge_hyperloglog_sketches`.
+ *
+ * @throw cudf::logic_error if `precision` is not in `[4, 18]`
+ * @throw cudf::logic_error if `group_labels` is neither empty nor an `INT32`
+ * column of the same size as `values`
+ * @throw cudf::logic_error if the sketches of `num_groups` groups do not fit in
+ * one column
+ *
+ * @param values Column whose distinct values are counted
+ * @param group_labels Group in `[0, num_groups)` of each row of `values`. Rows
+ * with a null label are ignored. If empty, all rows belong to group 0.
+ * @param num_groups Number of sketches to build
+ * @param precision Base 2 logarithm of the number of registers of each sketch
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns A `UINT8` column of the `num_groups * 2^precision` registers of the sketches
+ */
+std::unique_ptr<column> hyperloglog_sketches(
+  column_view const& values,
+  column_view const& group_labels     = {},
+  size_type num_groups                = 1,
+  int precision                       = 14,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Merges HyperLogLog sketches into one sketch per group.
+ *
+ * The merged sketch of a group estimates the number of distinct values of the
+ * union of the values of all sketches merged into it.
+ *
+ * @throw cudf::logic_error if `precision` is not in `[4, 18]`
+ * @throw cudf::logic_error if `sketches` is not a `UINT8` column of a multiple
+ * of `2^precision` rows
+ * @throw cudf::logic_error if `group_labels` is neither empty nor an `INT32`
+ * column with one row per sketch
+ *
+ * @param sketches Sketches built by `hyperloglog_sketches` with `precision`
+ * @param group_labels Group in `[0, num_groups)` each sketch is merged into.
+ * Sketches with a null label are ignored. If empty, all sketches are merged
+ * into group 0.
+ * @param num_groups Number of merged sketches
+ * @param precision Base 2 logarithm of the number of registers of each sketch
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns A `UINT8` column of the `num_groups * 2^precision` registers of the
+ * merged sketches
+ */
+std::unique_ptr<column> merge_hyperloglog_sketches(
+  column_view const& sketches,
+  column_view const& group_labels     = {},
+  size_type num_groups                = 1,
+  int precision                       = 14,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Estimates the number of distinct values counted by each HyperLogLog
+ * sketch.
+ *
+ * The relative standard error of an estimate is about `1.04 / sqrt(2^precision)`.
+ *
+ * @throw cudf::logic_error if `precision` is not in `[4, 18]`
+ * @throw cudf::logic_error if `sketches` is not a `UINT8` column of a multiple
+ * of `2^precision` rows
+ *
+ * @param sketches Sketches built by `hyperloglog_sketches` with `precision`
+ * @param precision Base 2 logarithm of the number of registers of each sketch
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns An `INT64` column of the estimate of each sketch
+ */
+std::unique_ptr<column> hyperloglog_estimates(
+  column_view const& sketches,
+  int precision                       = 14,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Builds a bloom filter of the rows of `keys`.
+ *
+ * The filter is a `UINT32` column of `ceil(num_bits / 32)` words of bits, so it
+ * can be copied, serialized and broadcast like any other column. Each row sets
+ * `num_hashes` bits derived from its `hash_id::HASH_XXHASH64` hash by double
+ * hashing. Null elements hash equal to each other, so a row with nulls is found
+ * by any row with nulls at the same positions and equal valid elements.
+ *
+ * @throw cudf::logic_error if `num_bits` is not positive
+ * @throw cudf::logic_error if `num_hashes` is not in `[1, 32]`
+ *
+ * @param keys The table of key columns whose rows are inserted
+ * @param num_bits Minimum number of bits of the filter, rounded up to a multiple of 32
+ * @param num_hashes Number of bits set by each row
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns A `UINT32` column of the words of the filter
+ */
+std::unique_ptr<column> build_bloom_filter(
+  table_view const& keys,
+  size_type num_bits,
+  int num_hashes                      = 3,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Indicates which rows of `keys` may have been inserted into a bloom filter.
+ *
+ * A row that was inserted is always found, whereas a row that was not inserted
+ * is found with a probability that decreases with the number of bits per
+ * inserted row. The result can be passed to `apply_boolean_mask` to drop rows
+ * that cannot match, for instance the probe rows of a semi join.
+ *
+ * @throw cudf::logic_error if `filter` is not a non-empty `UINT32` column without nulls
+ * @throw cudf::logic_error if `num_hashes` is not in `[1, 32]`
+ *
+ * @param filter Filter built by `build_bloom_filter` or `merge_bloom_filters`
+ * @param keys The table of key columns to look up, of the same types as the
+ * columns the filter was built from
+ * @param num_hashes Number of bits set by each row when the filter was built
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns A non-nullable `BOOL8` column that is `false` for each row of `keys`
+ * that was not inserted into the filter
+ */
+std::unique_ptr<column> bloom_filter_contains(
+  column_view const& filter,
+  table_view const& keys,
+  int num_hashes                      = 3,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Merges bloom filters into a filter of the union of their rows.
+ *
+ * @throw cudf::logic_error if `filters` is empty
+ * @throw cudf::logic_error if the filters are not non-empty `UINT32` columns
+ * without nulls of the same size
+ *
+ * @param filters Filters built with the same number of bits and hashes
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns A `UINT32` column of the words of the merged filter
+ */
+std::unique_ptr<column> merge_bloom_filters(
+  std::vector<column_view> const& filters,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <arrow/api.h>
+
+#include <string>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup interop_arrow
+ * @{
+ */
+
+/**
+ * @brief Create an `arrow::Table` in host memory from a cudf table
+ *
+ * Columns of the following types are supported, with or without nulls:
+ * - integral and floating point types, `BOOL8`
+ * - `TIMESTAMP_DAYS` as `arrow::date32`, the other timestamps and durations
+ *   (except `DURATION_DAYS`) as `arrow::timestamp` and `arrow::duration`
+ * - `STRING` as `arrow::utf8`
+ * - `LIST` as `arrow::list` of any of the supported types
+ * - `DICTIONARY32` as `arrow::dictionary` with `arrow::int32` indices
+ *
+ * The buffers of sliced columns are copied whole and the resulting arrays have
+ * the offset of the columns. The returned table has one chunk per column, so it
+ * can be read as a single `arrow::RecordBatch` with `arrow::TableBatchReader`.
+ *
+ * @throw cudf::logic_error if a column type is not supported
+ * @throw cudf::logic_error if `column_names` is not empty and its size does
+ * not match the number of columns
+ *
+ * @param input Table to copy to host memory
+ * @param column_names Names of the columns, or empty to name them by their index
+ * @param ar_mr Arrow memory pool used to allocate the returned table's memory
+ * @return Arrow table with a copy of the data of `input`
+ */
+std::shared_ptr<arrow::Table> to_arrow(table_view input,
+                                       std::vector<std::string> const& column_names = {},
+                                       arrow::MemoryPool* ar_mr = arrow::default_memory_pool());
+
+/**
+ * @brief Create an `arrow::Table` whose buffers are `arrow::cuda::CudaBuffer`s
+ * that reference the device memory of a cudf table without copying it
+ *
+ * The supported types and the layout of the arrays are those of `to_arrow`.
+ * `BOOL8` columns are the exception: Arrow packs booleans into bits, so their
+ * data is packed into new device memory owned by the returned table. Empty
+ * columns are returned as empty arrays in host memory.
+ *
+ * @note The returned table does not own the memory of `input`, which must
+ * outlive it.
+ *
+ * @throw cudf::logic_error if a column type is not supported
+ * @throw cudf::logic_error if `column_names` is not empty and its size does
+ * not match the number of columns
+ *
+ * @param input Table whose device memory is referenced
+ * @param column_names Names of the columns, or empty to name them by their index
+ * @return Arrow table referencing the device memory of `input`
+ */
+std::shared_ptr<arrow::Table> to_arrow_device(table_view input,
+                                              std::vector<std::string> const& column_names = {});
+
+/**
+ * @brief Create a cudf table from an `arrow::Table` in host memory
+ *
+ * Supports the Arrow types created by `to_arrow`. The chunks of each column are
+ * concatenated. Dictionary arrays may have any integral index type and unsorted
+ * dictionaries; their keys are sorted to form a `DICTIONARY32` column.
+ *
+ * @throw cudf::logic_error if an Arrow type is not supported
+ *
+ * @param input Arrow table in host memory
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return cudf table with a copy of the data of `input`
+ */
+std::unique_ptr<table> from_arrow(
+  arrow::Table const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @copydoc cudf::from_arrow(arrow::Table const&,rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<table> from_arrow(
+  arrow::RecordBatch const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Create a view of an `arrow::Table` whose buffers are in device memory
+ *
+ * Fixed-width, string and list arrays are viewed without copying their device
+ * memory, with the offsets of the arrays as the offsets of the columns. The
+ * table must have a single chunk per column and its bitmaps must be aligned to
+ * 4 bytes.
+ *
+ * @note The returned view does not own any memory; `input` must outlive it.
+ *
+ * @throw cudf::logic_error if a buffer of `input` is not an `arrow::cuda::CudaBuffer`
+ * @throw cudf::logic_error if a column has more than one chunk
+ * @throw cudf::logic_error if an Arrow type is not supported. Booleans and
+ * dictionaries are not supported since their layouts differ from cudf's.
+ *
+ * @param input Arrow table in device memory
+ * @return View of `input` as a cudf table
+ */
+table_view from_arrow_device(arrow::Table const& input);
+
+/** @} */  // end of group
+}  // namespace cudf
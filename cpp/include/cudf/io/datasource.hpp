@@ -22,6 +22,8 @@
 #include <arrow/io/memory.h>
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <cudf/io/types.hpp>
 #include <cudf/utilities/error.hpp>
@@ -72,6 +74,10 @@ class datasource {
   /**
    * @brief Creates a source from a memory buffer.
    *
+   * Sources of `REGISTERED` and `PINNED` buffers support `device_read()`, which copies the data to
+   * the device without staging. A `REGISTERED` buffer is page-locked until the source is destroyed;
+   * if it cannot be page-locked, the source reads it as pageable memory.
+   *
    * @param[in] buffer Host buffer object
    */
   static std::unique_ptr<datasource> create(host_buffer const& buffer);
@@ -91,6 +97,13 @@ class datasource {
    */
   static std::unique_ptr<datasource> create(datasource* source);
 
+  /**
+   * @brief Creates a vector of file datasources, opening the files in parallel.
+   *
+   * @param[in] filepaths Paths to the files
+   */
+  static std::vector<std::unique_ptr<datasource>> create(std::vector<std::string> const& filepaths);
+
   /**
    * @brief Creates a vector of datasources, one per element in the input vector.
    *
@@ -180,6 +193,17 @@ class datasource {
     CUDF_FAIL("datasource classes that support device_read must override this function.");
   }
 
+  /**
+   * @brief Informs the source of the byte ranges that the reader is about to read.
+   *
+   * Sources with a high per-request latency (e.g. object stores) can fetch the ranges ahead of
+   * the reads and in fewer, larger requests. The reads themselves still go through `host_read()`
+   * or `device_read()`. The default implementation ignores the hint.
+   *
+   * @param[in] ranges List of (offset, size) pairs
+   */
+  virtual void prefetch(std::vector<std::pair<size_t, size_t>> const& ranges) {}
+
   /**
    * @brief Returns the size of the data in the source.
    *
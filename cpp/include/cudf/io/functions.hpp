@@ -23,10 +23,13 @@
 
 #include "types.hpp"
 
+#include <cudf/copying.hpp>
 #include <cudf/io/writers.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/memory_estimate.hpp>
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -113,6 +116,9 @@ struct read_json_args {
 
   ///< Data types of the column; empty to infer dtypes
   std::vector<std::string> dtype;
+  /// Number of records sampled to infer the column types when `dtype` is empty; 0 samples all
+  /// records. Columns whose sampled type does not fit all the records are widened while parsing
+  size_type type_inference_rows = 0;
   /// Specify the compression format of the source or infer from file extension
   compression_type compression = compression_type::AUTO;
 
@@ -127,6 +133,11 @@ struct read_json_args {
   /// Whether to parse dates as DD/MM versus MM/DD
   bool dayfirst = false;
 
+  /// Whether to read records with nested objects and arrays. The fields of nested objects become
+  /// columns named by the dot-separated field names, and arrays become LIST columns; `dtype`
+  /// then maps column names to the (element) types, as in `{"a.b:int32"}`
+  bool nested = false;
+
   read_json_args() = default;
 
   explicit read_json_args(const source_info& src) : source(src) {}
@@ -229,6 +240,9 @@ struct read_csv_args {
 
   /// Per-column types; disables type inference on those columns
   std::vector<std::string> dtype;
+  /// Number of rows sampled to infer the column types when `dtype` is empty; 0 samples all rows.
+  /// Columns whose sampled type does not fit all the rows are widened while parsing
+  size_type type_inference_rows = 0;
   /// Additional values to recognize as boolean true values
   std::vector<std::string> true_values;
   /// Additional values to recognize as boolean false values
@@ -243,6 +257,8 @@ struct read_csv_args {
   bool dayfirst = false;
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{type_id::EMPTY};
+  /// Whether to return the metrics of the read in `table_with_metadata::metrics`
+  bool collect_metrics = false;
 
   read_csv_args() = default;
   explicit read_csv_args(source_info const& src) : source(src) {}
@@ -272,6 +288,88 @@ struct read_csv_args {
 table_with_metadata read_csv(read_csv_args const& args,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+namespace detail {
+namespace csv {
+/**
+ * @brief Forward declaration of anonymous chunked-reader state struct.
+ */
+struct csv_chunked_read_state;
+};  // namespace csv
+};  // namespace detail
+
+/**
+ * @brief Begin the process of reading a CSV dataset in a chunked/stream form.
+ *
+ * @ingroup io_readers
+ *
+ * The intent of the read_csv_chunked_ path is to allow reading a dataset larger than the
+ * available device memory as a series of tables. Each table holds the rows that start within the
+ * next `chunk_size` bytes of the source, so a row that straddles the end of a chunk is carried
+ * over whole into that chunk's table. The header is only parsed from the start of the source;
+ * all the tables have its column names, and the column types inferred from the first table with
+ * rows. The data of the next chunk is loaded while the current one is parsed.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks of 256MB:
+ * @code
+ *  ...
+ *  cudf::io::read_csv_args args{cudf::source_info("dataset.csv")};
+ *  ...
+ *  auto state = cudf::read_csv_chunked_begin(args, 256 << 20);
+ *  while (cudf::read_csv_chunked_has_next(state)) {
+ *    auto chunk = cudf::read_csv_chunked(state);
+ *    ...
+ *  }
+ *  cudf::read_csv_chunked_end(state);
+ * @endcode
+ *
+ * @throw cudf::logic_error if `args` uses a byte range, row selection or compression
+ *
+ * @param[in] args Settings for controlling reading behavior
+ * @param[in] chunk_size Number of bytes in which each chunk's rows start
+ * @param[in] mr Device memory resource used to allocate device memory of the returned tables
+ *
+ * @returns pointer to an anonymous state structure storing information about the chunked read.
+ * this pointer must be passed to all subsequent read_csv_chunked() calls.
+ */
+std::shared_ptr<detail::csv::csv_chunked_read_state> read_csv_chunked_begin(
+  read_csv_args const& args,
+  size_t chunk_size,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns whether there are chunks left to read.
+ *
+ * @ingroup io_readers
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_csv_chunked_begin()
+ */
+bool read_csv_chunked_has_next(std::shared_ptr<detail::csv::csv_chunked_read_state> state);
+
+/**
+ * @brief Reads the next chunk of a CSV dataset.
+ *
+ * @ingroup io_readers
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_csv_chunked_begin()
+ *
+ * @return The set of columns along with metadata
+ *
+ * @throw cudf::logic_error if there are no chunks left to read
+ */
+table_with_metadata read_csv_chunked(std::shared_ptr<detail::csv::csv_chunked_read_state> state);
+
+/**
+ * @brief Finish reading a chunked/stream CSV dataset, releasing the source.
+ *
+ * @ingroup io_readers
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_csv_chunked_begin()
+ */
+void read_csv_chunked_end(std::shared_ptr<detail::csv::csv_chunked_read_state>& state);
+
 /**
  * @brief Settings to use for `write_csv()`
  *
@@ -287,8 +385,10 @@ struct write_csv_args : detail::csv::writer_options {
                  char delim                     = ',',
                  std::string true_v             = std::string{"true"},
                  std::string false_v            = std::string{"false"},
-                 table_metadata const* metadata = nullptr)
-    : writer_options(na, include_header, rows_per_chunk, line_term, delim, true_v, false_v),
+                 table_metadata const* metadata = nullptr,
+                 compression_type compression   = compression_type::NONE)
+    : writer_options(
+        na, include_header, rows_per_chunk, line_term, delim, true_v, false_v, compression),
       sink_(snk),
       table_(table),
       metadata_(metadata)
@@ -341,6 +441,81 @@ struct write_csv_args : detail::csv::writer_options {
 void write_csv(write_csv_args const& args,
                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Settings to use for `write_json()`
+ *
+ * @ingroup io_writers
+ */
+struct write_json_args : detail::json::writer_options {
+  write_json_args(sink_info const& snk,
+                  table_view const& table,
+                  bool lines,
+                  bool include_nulls,
+                  int rows_per_chunk,
+                  std::string line_term          = std::string{"\n"},
+                  table_metadata const* metadata = nullptr)
+    : writer_options(lines, include_nulls, rows_per_chunk, line_term),
+      sink_(snk),
+      table_(table),
+      metadata_(metadata)
+  {
+  }
+
+  detail::json::writer_options const& get_options(void) const
+  {
+    return *this;  // sliced to base
+  }
+
+  sink_info const& sink(void) const { return sink_; }
+
+  table_view const& table(void) const { return table_; }
+
+  table_metadata const* metadata(void) const { return metadata_; }
+
+  // Specify the sink to use for writer output:
+  //
+  sink_info const sink_;
+
+  // Set of columns to output:
+  //
+  table_view const table_;
+
+  // Optional associated metadata; the column names are the keys of the objects
+  //
+  table_metadata const* metadata_;
+};
+
+/**
+ * @brief Writes a set of columns to JSON format
+ *
+ * Each row is written as an object whose keys are the column names (the column indices if
+ * `metadata` is not provided). In lines mode, the objects are written one per line (JSON Lines);
+ * otherwise they are written as a single array of objects (records orientation).
+ *
+ * Numbers and booleans are written as JSON literals, non-finite floats as `null`, and strings and
+ * timestamps (in ISO 8601 format) as escaped JSON strings.
+ *
+ * The following code snippet demonstrates how to write columns to a file:
+ * @code
+ *  #include <cudf/io/functions.hpp>
+ *  ...
+ *  std::string filepath = "dataset.json";
+ *  cudf::io::sink_info sink_info(filepath);
+ *
+ *  cudf::io::write_json_args args{sink_info, table->view(), lines, include_nulls,
+ * rows_per_chunk};
+ *  ...
+ *  cudf::io::write_json(args);
+ * @endcode
+ *
+ * @throw cudf::logic_error if a column is not of a numeric, boolean, timestamp or string type
+ *
+ * @param args Settings for controlling writing behavior
+ * @param mr Device memory resource to use for device memory allocation
+ */
+void write_json(write_json_args const& args,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Settings to use for `read_orc()`
  *
@@ -371,12 +546,29 @@ struct read_orc_args {
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{type_id::EMPTY};
 
-  /// Whether to convert decimals to float64
+  /// Whether to convert decimals to float64; otherwise they are read as DECIMAL64
   bool decimals_as_float = true;
-  /// For decimals as int, optional forced decimal scale;
+  /// For decimals as DECIMAL64, optional forced number of fractional digits;
   /// -1 is auto (column scale), >=0: number of fractional digits
   int forced_decimals_scale = -1;
 
+  /// Skip stripes whose statistics show no row can satisfy this filter; empty reads all.
+  /// Dates are compared as days and timestamps as UTC milliseconds since the epoch
+  stats_filter filter;
+
+  /// Whether to return the metrics of the read in `table_with_metadata::metrics`
+  bool collect_metrics = false;
+
+  /// Whether to keep the parsed footer of the file in a process-wide cache, and reuse it if the
+  /// file is read again unmodified. Only applies to file paths.
+  bool use_metadata_cache = false;
+
+  /// Late materialization: the rows to return among those selected by the other options, as a
+  /// BOOL8 column with one value per row (null rows are not returned). Typically computed from a
+  /// first read of the filter columns only. Only the stripes holding selected rows are decoded.
+  /// Cannot be combined with `filter`. Unset (EMPTY type) returns all rows.
+  column_view row_mask;
+
   read_orc_args() = default;
 
   explicit read_orc_args(source_info const& src) : source(src) {}
@@ -405,6 +597,145 @@ struct read_orc_args {
 table_with_metadata read_orc(read_orc_args const& args,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Reads the schema, the stripes and the column statistics of ORC files without their data
+ *
+ * @ingroup io_readers
+ *
+ * Only the postscript, the footer and the stripe statistics of each file are read, so that the
+ * stripes to read can be planned on the host. Statistics are returned for the leaf columns.
+ *
+ * @param source Files or buffers to inspect
+ *
+ * @return The metadata of each source, in order
+ */
+std::vector<file_metadata> read_orc_statistics(source_info const& source);
+
+/**
+ * @brief Settings to use for `read_orc_chunked_begin()`
+ */
+struct read_orc_chunked_args {
+  source_info source;
+
+  /// Names of column to read; empty is all
+  std::vector<std::string> columns;
+
+  /// List of individual stripes to read (all if empty)
+  std::vector<size_type> stripe_list;
+
+  /// Whether to use row index to speed-up reading
+  bool use_index = true;
+
+  /// Whether to use numpy-compatible dtypes
+  bool use_np_dtypes = true;
+  /// Cast timestamp columns to a specific type
+  data_type timestamp_type{type_id::EMPTY};
+
+  /// Whether to convert decimals to float64; otherwise they are read as DECIMAL64
+  bool decimals_as_float = true;
+  /// For decimals as DECIMAL64, optional forced number of fractional digits;
+  /// -1 is auto (column scale), >=0: number of fractional digits
+  int forced_decimals_scale = -1;
+
+  /// Skip stripes whose statistics show no row can satisfy this filter; empty reads all
+  stats_filter filter;
+
+  /// Limit on the device memory used to read each chunk, in bytes; 0 reads everything at once
+  size_t chunk_read_limit = 0;
+
+  explicit read_orc_chunked_args() = default;
+
+  explicit read_orc_chunked_args(source_info const& src, size_t chunk_read_limit_ = 0)
+    : source(src), chunk_read_limit(chunk_read_limit_)
+  {
+  }
+};
+
+namespace detail {
+namespace orc {
+/**
+ * @brief Forward declaration of anonymous chunked-reader state struct.
+ */
+struct orc_chunked_read_state;
+};  // namespace orc
+};  // namespace detail
+
+/**
+ * @brief Begin the process of reading an ORC dataset in a chunked/stream form.
+ *
+ * @ingroup io_readers
+ *
+ * The intent of the read_orc_chunked_ path is to allow reading a dataset larger than the available
+ * device memory as a series of tables. The file footer, the stripe footers and the timezone table
+ * are read once; each table then holds a run of consecutive stripes whose estimated read footprint
+ * (stream data of the selected columns, its decompressed copy and the output columns) is within
+ * `chunk_read_limit` bytes. A stripe that exceeds the limit on its own is returned as a single
+ * table.
+ *
+ * While a table is decoded, the stripes of the next table are read and decompressed on a second
+ * CUDA stream, so up to two chunks can be in device memory at the same time.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks of at most 1GB:
+ * @code
+ *  ...
+ *  std::string filepath = "dataset.orc";
+ *  cudf::io::read_orc_chunked_args args{cudf::source_info(filepath), 1 << 30};
+ *  ...
+ *  auto state = cudf::read_orc_chunked_begin(args);
+ *  while (cudf::read_orc_chunked_has_next(state)) {
+ *    auto chunk = cudf::read_orc_chunked(state);
+ *    ...
+ *  }
+ *  cudf::read_orc_chunked_end(state);
+ * @endcode
+ *
+ * @param[in] args Settings for controlling reading behavior
+ * @param[in] mr Device memory resource used to allocate device memory of the returned tables
+ *
+ * @returns pointer to an anonymous state structure storing information about the chunked read.
+ * this pointer must be passed to all subsequent read_orc_chunked() calls.
+ */
+std::shared_ptr<detail::orc::orc_chunked_read_state> read_orc_chunked_begin(
+  read_orc_chunked_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns whether there are chunks left to read.
+ *
+ * @ingroup io_readers
+ *
+ * The first call always returns true, so that even a dataset with no selected stripes yields one
+ * (empty) table with the column schema.
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_orc_chunked_begin()
+ */
+bool read_orc_chunked_has_next(std::shared_ptr<detail::orc::orc_chunked_read_state> state);
+
+/**
+ * @brief Reads the next chunk of an ORC dataset.
+ *
+ * @ingroup io_readers
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_orc_chunked_begin()
+ *
+ * @return The set of columns along with metadata
+ *
+ * @throw cudf::logic_error if there are no chunks left to read
+ */
+table_with_metadata read_orc_chunked(std::shared_ptr<detail::orc::orc_chunked_read_state> state);
+
+/**
+ * @brief Finish reading a chunked/stream ORC dataset, releasing the source.
+ *
+ * @ingroup io_readers
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_orc_chunked_begin()
+ */
+void read_orc_chunked_end(std::shared_ptr<detail::orc::orc_chunked_read_state>& state);
+
 /**
  * @brief Settings to use for `read_parquet()`
  */
@@ -423,10 +754,31 @@ struct read_parquet_args {
 
   /// Whether to store string data as categorical type
   bool strings_to_categorical = false;
+  /// Whether to return string data as DICTIONARY32 columns built from the file dictionaries
+  bool strings_to_dictionary = false;
   /// Whether to use PANDAS metadata to load columns
   bool use_pandas_metadata = true;
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{type_id::EMPTY};
+  /// Whether to convert decimals to float64; otherwise decimals stored as INT32/INT64 are read
+  /// as DECIMAL32/DECIMAL64 columns, and other decimals are still converted to float64
+  bool decimals_as_float = true;
+
+  /// Skip row groups whose statistics show no row can satisfy this filter; empty reads all
+  stats_filter filter;
+
+  /// Whether to return the metrics of the read in `table_with_metadata::metrics`
+  bool collect_metrics = false;
+
+  /// Whether to keep the parsed footer of the file in a process-wide cache, and reuse it if the
+  /// file is read again unmodified. Only applies to file paths.
+  bool use_metadata_cache = false;
+
+  /// Late materialization: the rows to return among those selected by the other options, as a
+  /// BOOL8 column with one value per row (null rows are not returned). Typically computed from a
+  /// first read of the filter columns only. Only the pages holding selected rows are decoded.
+  /// Cannot be combined with `filter`. Unset (EMPTY type) returns all rows.
+  column_view row_mask;
 
   explicit read_parquet_args() = default;
 
@@ -457,6 +809,157 @@ table_with_metadata read_parquet(
   read_parquet_args const& args,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Estimates the device memory needed by `read_parquet(args)`, from the footers only
+ *
+ * @ingroup io_readers
+ *
+ * Each row group to read is charged its compressed pages, the decompressed pages of its
+ * compressed column chunks and its decoded output columns, with the uncompressed page sizes
+ * standing for the characters of string columns. Row groups skipped by `args.filter` are not
+ * charged; `args.row_mask` is ignored, so the estimate is an upper bound.
+ *
+ * @param args Settings of the read to estimate
+ *
+ * @return The estimated output and peak scratch bytes of the read
+ */
+memory_estimate estimate_read_parquet_memory(read_parquet_args const& args);
+
+/**
+ * @brief Reads the schema, the row groups and the column chunk statistics of Parquet files
+ * without their data
+ *
+ * @ingroup io_readers
+ *
+ * Only the footer of each file is read, so that the row groups to read can be planned on the
+ * host. Parquet files have no file-level statistics; `file_metadata::columns` is empty.
+ *
+ * @param source Files or buffers to inspect
+ *
+ * @return The metadata of each source, in order
+ */
+std::vector<file_metadata> read_parquet_metadata(source_info const& source);
+
+/**
+ * @brief Settings to use for `read_parquet_chunked_begin()`
+ */
+struct read_parquet_chunked_args {
+  source_info source;
+
+  /// Names of column to read; empty is all
+  std::vector<std::string> columns;
+
+  /// List of individual row groups to read (all if empty)
+  std::vector<std::vector<size_type>> row_groups;
+
+  /// Whether to store string data as categorical type
+  bool strings_to_categorical = false;
+  /// Whether to return string data as DICTIONARY32 columns built from the file dictionaries
+  bool strings_to_dictionary = false;
+  /// Whether to use PANDAS metadata to load columns
+  bool use_pandas_metadata = true;
+  /// Cast timestamp columns to a specific type
+  data_type timestamp_type{type_id::EMPTY};
+  /// Whether to convert decimals to float64; otherwise decimals stored as INT32/INT64 are read
+  /// as DECIMAL32/DECIMAL64 columns, and other decimals are still converted to float64
+  bool decimals_as_float = true;
+
+  /// Skip row groups whose statistics show no row can satisfy this filter; empty reads all
+  stats_filter filter;
+
+  /// Limit on the device memory used to read each chunk, in bytes; 0 reads everything at once
+  size_t chunk_read_limit = 0;
+
+  explicit read_parquet_chunked_args() = default;
+
+  explicit read_parquet_chunked_args(source_info const& src, size_t chunk_read_limit_ = 0)
+    : source(src), chunk_read_limit(chunk_read_limit_)
+  {
+  }
+};
+
+namespace detail {
+namespace parquet {
+/**
+ * @brief Forward declaration of anonymous chunked-reader state struct.
+ */
+struct pq_chunked_read_state;
+};  // namespace parquet
+};  // namespace detail
+
+/**
+ * @brief Begin the process of reading a parquet dataset in a chunked/stream form.
+ *
+ * @ingroup io_readers
+ *
+ * The intent of the read_parquet_chunked_ path is to allow reading a dataset larger than the
+ * available device memory as a series of tables. The file metadata is parsed once; each
+ * table then holds a run of consecutive row groups whose estimated read footprint (compressed and
+ * decompressed page data plus the output columns) is within `chunk_read_limit` bytes. A row group
+ * that exceeds the limit on its own is returned as a single table.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks of at most 1GB:
+ * @code
+ *  ...
+ *  std::string filepath = "dataset.parquet";
+ *  cudf::io::read_parquet_chunked_args args{cudf::source_info(filepath), 1 << 30};
+ *  ...
+ *  auto state = cudf::read_parquet_chunked_begin(args);
+ *  while (cudf::read_parquet_chunked_has_next(state)) {
+ *    auto chunk = cudf::read_parquet_chunked(state);
+ *    ...
+ *  }
+ *  cudf::read_parquet_chunked_end(state);
+ * @endcode
+ *
+ * @param[in] args Settings for controlling reading behavior
+ * @param[in] mr Device memory resource used to allocate device memory of the returned tables
+ *
+ * @returns pointer to an anonymous state structure storing information about the chunked read.
+ * this pointer must be passed to all subsequent read_parquet_chunked() calls.
+ */
+std::shared_ptr<detail::parquet::pq_chunked_read_state> read_parquet_chunked_begin(
+  read_parquet_chunked_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns whether there are chunks left to read.
+ *
+ * @ingroup io_readers
+ *
+ * The first call always returns true, so that even a dataset with no selected row groups yields
+ * one (empty) table with the column schema.
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_parquet_chunked_begin()
+ */
+bool read_parquet_chunked_has_next(std::shared_ptr<detail::parquet::pq_chunked_read_state> state);
+
+/**
+ * @brief Reads the next chunk of a parquet dataset.
+ *
+ * @ingroup io_readers
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_parquet_chunked_begin()
+ *
+ * @return The set of columns along with metadata
+ *
+ * @throw cudf::logic_error if there are no chunks left to read
+ */
+table_with_metadata read_parquet_chunked(
+  std::shared_ptr<detail::parquet::pq_chunked_read_state> state);
+
+/**
+ * @brief Finish reading a chunked/stream parquet dataset, releasing the sources.
+ *
+ * @ingroup io_readers
+ *
+ * @param[in] state Opaque state information about the reader process. Must be the same pointer
+ * returned from read_parquet_chunked_begin()
+ */
+void read_parquet_chunked_end(std::shared_ptr<detail::parquet::pq_chunked_read_state>& state);
+
 /**
  * @brief Settings to use for `write_orc()`
  *
@@ -473,6 +976,14 @@ struct write_orc_args {
   table_view table;
   /// Optional associated metadata
   const table_metadata* metadata;
+  /// Optional per-column flags (one entry per column, in table order) enabling a bloom filter in
+  /// each row group; readers use them to skip stripes on equality filters. Only integer, date,
+  /// floating-point and string columns get a filter
+  std::vector<bool> bloom_filter_columns;
+  /// False positive probability targeted by the bloom filters
+  double bloom_filter_fpp = 0.05;
+  /// Receives the metrics of the write if not null
+  io_metrics* metrics = nullptr;
 
   write_orc_args() = default;
 
@@ -524,6 +1035,12 @@ struct write_orc_chunked_args {
   bool enable_statistics;
   /// Optional associated metadata
   const table_metadata_with_nullability* metadata;
+  /// Optional per-column flags (one entry per column, in table order) enabling bloom filters
+  std::vector<bool> bloom_filter_columns;
+  /// False positive probability targeted by the bloom filters
+  double bloom_filter_fpp = 0.05;
+  /// Receives the metrics of all the writes if not null; must outlive the chunked write
+  io_metrics* metrics = nullptr;
 
   explicit write_orc_chunked_args(sink_info const& sink_,
                                   const table_metadata_with_nullability* metadata_ = nullptr,
@@ -621,6 +1138,34 @@ struct write_parquet_args {
   bool return_filemetadata = false;
   /// Column chunks file path to be set in the raw output metadata
   std::string metadata_out_file_path;
+  /// Encode integer columns (INT32 and INT64 physical types, including timestamps) with
+  /// DELTA_BINARY_PACKED instead of dictionary or PLAIN encoding; this suits sorted or
+  /// monotonic columns, such as event times and sequential IDs
+  bool delta_encoding = false;
+  /// Target size in bytes of the uncompressed data pages; larger pages decode with more
+  /// parallelism, smaller pages allow finer page skipping
+  size_t max_page_size = 512 * 1024;
+  /// Maximum size in bytes of a dictionary page; once a column chunk's dictionary reaches it, the
+  /// rest of the chunk is written with PLAIN encoding
+  size_t max_dictionary_size = 512 * 1024;
+  /// Optional per-column encodings (one entry per column, in table order) overriding the
+  /// writer's default choice and `delta_encoding`
+  std::vector<column_encoding> column_encodings;
+  /// Optional per-column flags (one entry per column, in table order) enabling a bloom filter in
+  /// each column chunk; readers use them to skip row groups on equality filters. Boolean and list
+  /// columns have no filter
+  std::vector<bool> bloom_filter_columns;
+  /// False positive probability targeted by the bloom filters
+  double bloom_filter_fpp = 0.01;
+  /// Order of the rows within each row group. Sorting the rows by the columns used in filters
+  /// narrows the min/max statistics of the row groups and pages, so that readers skip more of
+  /// them; Z-order keeps the statistics of each of several columns narrow
+  row_clustering clustering = row_clustering::NONE;
+  /// Indices of the columns to cluster the rows by: any sortable columns for `SORT`, and up to 8
+  /// numeric, timestamp or duration columns for `Z_ORDER`
+  std::vector<size_type> clustering_columns;
+  /// Receives the metrics of the write if not null
+  io_metrics* metrics = nullptr;
 
   write_parquet_args() = default;
 
@@ -662,6 +1207,80 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet(
   write_parquet_args const& args,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Settings to use for `write_parquet_partitioned()`
+ *
+ * @ingroup io_writers
+ */
+struct write_parquet_partitioned_args {
+  /// Table to partition and write
+  table_view table;
+  /// Indices of the partition key columns; as in Hive-style layouts, the keys are not written
+  /// to the files
+  std::vector<size_type> partition_columns;
+  /// Returns the sink of a partition, from the index of the partition and the table of the keys
+  /// of all the partitions (row `i` holds the keys of partition `i`)
+  std::function<sink_info(size_type, table_view const&)> sink_factory;
+  /// Specify the compression format to use
+  compression_type compression = compression_type::AUTO;
+  /// Specify the level of statistics in the output files
+  statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
+  /// Optional associated metadata, with the names of all the columns of `table`
+  const table_metadata* metadata = nullptr;
+  /// Encode integer columns with DELTA_BINARY_PACKED, as in `write_parquet_args`
+  bool delta_encoding = false;
+  /// Target size in bytes of the uncompressed data pages
+  size_t max_page_size = 512 * 1024;
+  /// Maximum size in bytes of a dictionary page
+  size_t max_dictionary_size = 512 * 1024;
+  /// Optional per-column encodings, one entry per column of `table`; the entries of the
+  /// partition columns are ignored
+  std::vector<column_encoding> column_encodings;
+  /// Optional per-column bloom filter flags, one entry per column of `table`; the entries of the
+  /// partition columns are ignored
+  std::vector<bool> bloom_filter_columns;
+  /// False positive probability targeted by the bloom filters
+  double bloom_filter_fpp = 0.01;
+  /// Order of the rows within each row group of each file
+  row_clustering clustering = row_clustering::NONE;
+  /// Indices in `table` of the columns to cluster the rows by; the partition columns, which are
+  /// constant within a file, are left out
+  std::vector<size_type> clustering_columns;
+  /// Receives the metrics of the writes if not null
+  io_metrics* metrics = nullptr;
+};
+
+/**
+ * @brief Writes each partition of a table, by the values of its key columns, to its own
+ * parquet file
+ *
+ * @ingroup io_writers
+ *
+ * The rows are grouped by key with a single sort; the partitions are then written without
+ * copying, one file per distinct key, to the sinks returned by `sink_factory`. Rows with null
+ * keys form their own partitions.
+ *
+ * The following code snippet writes one file per date:
+ * @code
+ *  ...
+ *  cudf::io::write_parquet_partitioned_args args;
+ *  args.table             = table->view();
+ *  args.partition_columns = {0};
+ *  args.sink_factory      = [&](cudf::size_type i, cudf::table_view const& keys) {
+ *    return cudf::io::sink_info(dataset_path + "/part-" + std::to_string(i) + ".parquet");
+ *  };
+ *  auto keys = cudf::io::write_parquet_partitioned(args);
+ * @endcode
+ *
+ * @param args Settings for controlling writing behavior
+ * @param mr Device memory resource to use for device memory allocation
+ *
+ * @return The keys of the partitions, one row per partition in the order of the sinks
+ */
+std::unique_ptr<table> write_parquet_partitioned(
+  write_parquet_partitioned_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Merges multiple raw metadata blobs that were previously created by write_parquet
  * into a single metadata blob
@@ -688,6 +1307,24 @@ struct write_parquet_chunked_args {
   statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
   /// Optional associated metadata.
   const table_metadata_with_nullability* metadata;
+  /// Encode integer columns with DELTA_BINARY_PACKED instead of dictionary or PLAIN encoding
+  bool delta_encoding = false;
+  /// Target size in bytes of the uncompressed data pages
+  size_t max_page_size = 512 * 1024;
+  /// Maximum size in bytes of a dictionary page; the rest of the chunk is written PLAIN
+  size_t max_dictionary_size = 512 * 1024;
+  /// Optional per-column encodings (one entry per column, in table order)
+  std::vector<column_encoding> column_encodings;
+  /// Optional per-column flags (one entry per column, in table order) enabling bloom filters
+  std::vector<bool> bloom_filter_columns;
+  /// False positive probability targeted by the bloom filters
+  double bloom_filter_fpp = 0.01;
+  /// Order of the rows within each row group; the rows of a row group come from a single chunk
+  row_clustering clustering = row_clustering::NONE;
+  /// Indices of the columns to cluster the rows by
+  std::vector<size_type> clustering_columns;
+  /// Receives the metrics of all the writes if not null; must outlive the chunked write
+  io_metrics* metrics = nullptr;
 
   write_parquet_chunked_args() = default;
 
@@ -776,5 +1413,96 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet_chunked_end(
   bool return_filemetadata                  = false,
   const std::string& metadata_out_file_path = "");
 
+/**
+ * @brief Settings to use for `write_packed()`
+ *
+ * @ingroup io_writers
+ */
+struct write_packed_args {
+  /// Specify the sink to use for writer output
+  sink_info sink;
+  /// Set of columns to output; ignored if `packed` is set
+  table_view table;
+  /// Optional table already packed by `pack`, written without packing it again
+  packed_columns const* packed = nullptr;
+
+  write_packed_args() = default;
+
+  explicit write_packed_args(sink_info const& sink_, table_view const& table_)
+    : sink(sink_), table(table_)
+  {
+  }
+
+  explicit write_packed_args(sink_info const& sink_, packed_columns const& packed_)
+    : sink(sink_), packed(&packed_)
+  {
+  }
+};
+
+/**
+ * @brief Writes a table in the packed layout of `pack`, as a file that
+ * `read_packed` loads without decoding
+ *
+ * @ingroup io_writers
+ *
+ * The file holds a small header, the host metadata blob of `pack` and the packed
+ * device data, aligned on 4KB. The data is written straight from device memory
+ * when the sink supports it, e.g. with GPUDirect Storage for file paths.
+ *
+ * The format is meant for caching tables across processes of the same libcudf
+ * version, not for interchange.
+ *
+ * The following code snippet demonstrates how to cache a table in a file:
+ * @code
+ *  cudf::io::write_packed_args args{cudf::io::sink_info("table.cudfpack"), table->view()};
+ *  cudf::io::write_packed(args);
+ * @endcode
+ *
+ * @param args Settings for controlling writing behavior
+ * @param mr Device memory resource used to allocate the packed copy of the table
+ */
+void write_packed(write_packed_args const& args,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Settings to use for `read_packed()`
+ *
+ * @ingroup io_readers
+ */
+struct read_packed_args {
+  source_info source;
+
+  read_packed_args() = default;
+
+  explicit read_packed_args(source_info const& src) : source(src) {}
+};
+
+/**
+ * @brief Reads a table written by `write_packed`
+ *
+ * @ingroup io_readers
+ *
+ * The packed data is read in a single transfer into one device buffer, straight
+ * from the file when the source supports device reads and from its memory mapping
+ * otherwise; the columns are not decoded or copied again.
+ *
+ * The following code snippet demonstrates how to load a cached table:
+ * @code
+ *  cudf::io::read_packed_args args{cudf::io::source_info("table.cudfpack")};
+ *  auto const packed = cudf::io::read_packed(args);
+ *  cudf::table_view const view = cudf::unpack(packed);
+ * @endcode
+ *
+ * @throws cudf::logic_error if the source does not hold exactly one packed table
+ * file
+ *
+ * @param args Settings for controlling reading behavior
+ * @param mr Device memory resource used to allocate the returned device buffer
+ *
+ * @return The packed table, whose view is returned by `unpack`
+ */
+packed_columns read_packed(read_packed_args const& args,
+                           rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 }  // namespace io
 }  // namespace cudf
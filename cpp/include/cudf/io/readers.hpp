@@ -23,8 +23,10 @@
 
 #include "types.hpp"
 
+#include <cudf/column/column_view.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/memory_estimate.hpp>
 
 #include <memory>
 #include <string>
@@ -133,6 +135,10 @@ struct reader_options {
   /// Per-column types; disables type inference on those columns
   std::vector<std::string> dtype;
   bool dayfirst = false;
+  /// Number of records sampled to infer the column types; 0 samples all records
+  size_type type_inference_rows = 0;
+  /// Flatten nested objects into columns and read arrays into LIST columns
+  bool nested = false;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -143,12 +149,18 @@ struct reader_options {
    * @param[in] lines Restrict to `JSON Lines` format rather than full JSON
    * @param[in] compression Compression type: "none", "infer", "gzip", "zip"
    * @param[in] dtype Ordered list of data types; deduced from dataset if empty
+   * @param[in] nested Flatten nested objects and read arrays into LIST columns
    *---------------------------------------------------------------------------**/
   reader_options(bool lines,
                  compression_type compression,
                  std::vector<std::string> dtype,
-                 bool dayfirst)
-    : lines(lines), compression(compression), dtype(std::move(dtype)), dayfirst(dayfirst)
+                 bool dayfirst,
+                 bool nested = false)
+    : lines(lines),
+      compression(compression),
+      dtype(std::move(dtype)),
+      dayfirst(dayfirst),
+      nested(nested)
   {
   }
 };
@@ -273,6 +285,8 @@ struct reader_options {
 
   /// Per-column types; disables type inference on those columns
   std::vector<std::string> dtype;
+  /// Number of rows sampled to infer the column types; 0 samples all rows
+  size_type type_inference_rows = 0;
   /// User-extensible list of values to recognize as boolean true values
   std::vector<std::string> true_values{"True", "TRUE", "true"};
   /// User-extensible list of values to recognize as boolean false values
@@ -296,6 +310,8 @@ struct reader_options {
                                      "null"};
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{type_id::EMPTY};
+  /// Whether to return the metrics of the read with the table
+  bool collect_metrics = false;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -375,6 +391,33 @@ class reader {
                                 size_type skip_rows_end,
                                 size_type num_rows,
                                 cudaStream_t stream = 0);
+
+  /**
+   * @brief Starts reading the dataset as a series of tables.
+   *
+   * Each table holds the rows that start within the next `chunk_size` bytes, so a row that
+   * straddles the end of a chunk is read with that chunk. The header is only parsed from the
+   * first chunk, and the column types inferred from the first chunk with rows are used for all
+   * the following chunks.
+   *
+   * @param chunk_size Number of bytes in which each chunk's rows start
+   */
+  void begin_chunked_read(size_t chunk_size);
+
+  /**
+   * @brief Returns whether there are chunks left to read.
+   */
+  bool has_next_chunk() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset; the data of the following chunk is loaded into
+   * host memory in the background while this one is converted.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_next_chunk(cudaStream_t stream = 0);
 };
 
 }  // namespace csv
@@ -390,6 +433,12 @@ struct reader_options {
   data_type timestamp_type{type_id::EMPTY};
   bool decimals_as_float    = true;
   int forced_decimals_scale = -1;
+  stats_filter filter;
+  bool collect_metrics    = false;
+  bool use_metadata_cache = false;
+  /// Rows to return among those read, one BOOL8 value per row; stripes without any selected
+  /// row are not decoded. Not owned; must outlive the reads. Unset (EMPTY type) returns all rows.
+  column_view row_mask;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -401,19 +450,22 @@ struct reader_options {
    * @param use_index_lookup Whether to use row index for faster scanning
    * @param np_compat Whether to use numpy-compatible dtypes
    * @param timestamp_type Cast timestamp columns to a specific type
+   * @param filter Predicate used to skip stripes based on their statistics
    */
   reader_options(std::vector<std::string> columns,
                  bool use_index_lookup,
                  bool np_compat,
                  data_type timestamp_type,
                  bool decimals_as_float_    = true,
-                 int forced_decimals_scale_ = -1)
+                 int forced_decimals_scale_ = -1,
+                 stats_filter filter        = {})
     : columns(std::move(columns)),
       use_index(use_index_lookup),
       use_np_dtypes(np_compat),
       timestamp_type(timestamp_type),
       decimals_as_float(decimals_as_float_),
-      forced_decimals_scale(forced_decimals_scale_)
+      forced_decimals_scale(forced_decimals_scale_),
+      filter(std::move(filter))
   {
   }
 };
@@ -481,6 +533,9 @@ class reader {
   /**
    * @brief Reads and returns specific stripes.
    *
+   * If a statistics filter is set in the reader options, the stripes that cannot contain
+   * matching rows are skipped from the list.
+   *
    * @param stripe_list Indices of the stripes to read
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
@@ -499,10 +554,58 @@ class reader {
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return The set of columns along with table metadata
+   *
+   * @throw cudf::logic_error if a statistics filter is set and a partial range is requested
    */
   table_with_metadata read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream = 0);
+
+  /**
+   * @brief Splits the stripes to read into batches for `read_next_chunk()`.
+   *
+   * The file metadata parsed by the constructor is reused for every batch. Each batch holds
+   * consecutive stripes whose estimated device memory usage during the read (stream data, its
+   * decompressed copy and output columns) fits within `chunk_read_limit`; a single stripe larger
+   * than the limit forms its own batch.
+   *
+   * @param chunk_read_limit Byte limit for each batch; `0` for no limit
+   * @param stripe_list Indices of the stripes to read; empty for all stripes
+   *
+   * @throw cudf::logic_error if stripe index is out of range
+   * @throw cudf::logic_error if a row mask is set in the reader options
+   */
+  void begin_chunked_read(size_t chunk_read_limit, std::vector<size_type> const &stripe_list = {});
+
+  /**
+   * @brief Returns whether there are batches left to read with `read_next_chunk()`.
+   */
+  bool has_next_chunk() const;
+
+  /**
+   * @brief Reads the next batch of stripes planned by `begin_chunked_read()`.
+   *
+   * The stripes of the following batch are then read and decompressed on a second CUDA stream
+   * while this batch is decoded.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   *
+   * @throw cudf::logic_error if there are no batches left to read
+   */
+  table_with_metadata read_next_chunk(cudaStream_t stream = 0);
 };
 
+/**
+ * @brief Reads the schema, the stripes and the column statistics of an ORC file
+ *
+ * Only the postscript, the footer and the stripe statistics are read.
+ *
+ * @param source Dataset source
+ *
+ * @return File-level and per-stripe statistics of the leaf columns
+ */
+file_metadata read_statistics(datasource *source);
+
 }  // namespace orc
 
 namespace parquet {
@@ -514,6 +617,15 @@ struct reader_options {
   bool strings_to_categorical = false;
   bool use_pandas_metadata    = false;
   data_type timestamp_type{type_id::EMPTY};
+  stats_filter filter;
+  bool strings_to_dictionary = false;
+  bool collect_metrics       = false;
+  bool use_metadata_cache    = false;
+  /// Whether to convert INT32/INT64 decimals to FLOAT64 rather than DECIMAL32/DECIMAL64
+  bool decimals_as_float = true;
+  /// Rows to return among those read, one BOOL8 value per row; pages without any selected row
+  /// are not decoded. Not owned; must outlive the reads. Unset (EMPTY type) returns all rows.
+  column_view row_mask;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -525,15 +637,21 @@ struct reader_options {
    * @param strings_to_categorical Whether to return strings as category
    * @param use_pandas_metadata Whether to always load PANDAS index columns
    * @param timestamp_type Cast timestamp columns to a specific type
+   * @param filter Predicate used to skip row groups based on their statistics
+   * @param strings_to_dictionary Whether to return strings as DICTIONARY32 columns
    */
   reader_options(std::vector<std::string> columns,
                  bool strings_to_categorical,
                  bool use_pandas_metadata,
-                 data_type timestamp_type)
+                 data_type timestamp_type,
+                 stats_filter filter        = {},
+                 bool strings_to_dictionary = false)
     : columns(std::move(columns)),
       strings_to_categorical(strings_to_categorical),
       use_pandas_metadata(use_pandas_metadata),
-      timestamp_type(timestamp_type)
+      timestamp_type(timestamp_type),
+      filter(std::move(filter)),
+      strings_to_dictionary(strings_to_dictionary)
   {
   }
 };
@@ -586,6 +704,9 @@ class reader {
   /**
    * @brief Reads specific row groups.
    *
+   * If a statistics filter is set in the reader options, the row groups that cannot contain
+   * matching rows are skipped from the list.
+   *
    * @param row_group_list Indices of the row groups
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
@@ -604,10 +725,76 @@ class reader {
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return The set of columns along with table metadata
+   *
+   * @throw cudf::logic_error if a statistics filter is set and a partial range is requested
    */
   table_with_metadata read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream = 0);
+
+  /**
+   * @brief Estimates the device memory needed to read row groups, from the footers only.
+   *
+   * Each selected row group is charged its compressed pages, the decompressed pages of its
+   * compressed column chunks and its decoded output columns, with the uncompressed page sizes
+   * standing for the characters of string columns. This is the sizing `begin_chunked_read()`
+   * batches row groups with.
+   *
+   * @param row_groups Indices of the row groups per source; empty for all row groups
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; use `0` for all remaining data. The row groups
+   * holding the rows are charged as a whole.
+   *
+   * @return The estimated output and peak scratch bytes of the read
+   *
+   * @throw cudf::logic_error if row group index is out of range
+   */
+  memory_estimate estimate_memory(std::vector<std::vector<size_type>> const &row_groups = {},
+                                  size_type skip_rows                                   = 0,
+                                  size_type num_rows                                    = 0);
+
+  /**
+   * @brief Splits the row groups to read into batches for `read_next_chunk()`.
+   *
+   * The file metadata parsed by the constructor is reused for every batch. Each batch holds
+   * consecutive row groups whose estimated device memory usage during the read (compressed and
+   * decompressed pages plus output columns) fits within `chunk_read_limit`; a single row group
+   * larger than the limit forms its own batch.
+   *
+   * @param chunk_read_limit Byte limit for each batch; `0` for no limit
+   * @param row_groups Indices of the row groups per source; empty for all row groups
+   *
+   * @throw cudf::logic_error if row group index is out of range
+   */
+  void begin_chunked_read(size_t chunk_read_limit,
+                          std::vector<std::vector<size_type>> const &row_groups = {});
+
+  /**
+   * @brief Returns whether there are batches left to read with `read_next_chunk()`.
+   */
+  bool has_next_chunk() const;
+
+  /**
+   * @brief Reads the next batch of row groups planned by `begin_chunked_read()`.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with table metadata
+   *
+   * @throw cudf::logic_error if there are no batches left to read
+   */
+  table_with_metadata read_next_chunk(cudaStream_t stream = 0);
 };
 
+/**
+ * @brief Reads the schema, the row groups and the column chunk statistics of a Parquet file
+ *
+ * Only the footer is read.
+ *
+ * @param source Dataset source
+ *
+ * @return Per-row group statistics of the column chunks
+ */
+file_metadata read_metadata(datasource *source);
+
 }  // namespace parquet
 
 }  // namespace detail
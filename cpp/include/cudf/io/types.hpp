@@ -25,6 +25,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 // Forward declarations
@@ -57,7 +58,8 @@ enum class compression_type {
   BZIP2,   ///< BZIP2 format, using Burrows-Wheeler transform
   BROTLI,  ///< BROTLI format, using LZ77 + Huffman + 2nd order context modeling
   ZIP,     ///< ZIP format, using DEFLATE algorithm
-  XZ       ///< XZ format, using LZMA(2) algorithm
+  XZ,      ///< XZ format, using LZMA(2) algorithm
+  ZSTD     ///< ZSTD format, using LZ77 + FSE/Huffman entropy coding
 };
 
 /**
@@ -90,6 +92,170 @@ enum statistics_freq {
   STATISTICS_PAGE     = 2,  //!< Per-page column statistics
 };
 
+/**
+ * @brief Per-column encoding requested from the parquet writer
+ */
+enum class column_encoding {
+  USE_DEFAULT,          //!< Let the writer choose (dictionary if it is smaller than plain)
+  DICTIONARY,           //!< Use dictionary encoding, falling back to plain if it grows too large
+  PLAIN,                //!< Use plain encoding
+  DELTA_BINARY_PACKED,  //!< Use DELTA_BINARY_PACKED (INT32 and INT64 physical types only)
+};
+
+/**
+ * @brief Order of the rows of each row group written by the parquet writer
+ */
+enum class row_clustering {
+  NONE,     //!< Write the rows in input order
+  SORT,     //!< Sort the rows lexicographically by the clustering columns
+  Z_ORDER,  //!< Sort the rows by the Z-order (Morton) code interleaving the clustering columns
+};
+
+/**
+ * @brief Comparison operators supported by `stats_filter`
+ */
+enum class filter_op : int8_t {
+  EQUAL,          ///< column == literal
+  NOT_EQUAL,      ///< column != literal
+  LESS,           ///< column < literal
+  LESS_EQUAL,     ///< column <= literal
+  GREATER,        ///< column > literal
+  GREATER_EQUAL,  ///< column >= literal
+};
+
+/**
+ * @brief Predicate used by readers to skip data using file statistics
+ *
+ * A filter is either a comparison between a named column and a host literal, or the logical
+ * AND/OR of two filters. Readers evaluate the filter against the min/max statistics stored in the
+ * file and skip any block (e.g. Parquet row group) for which the filter is provably false. The
+ * filter is conservative: blocks without statistics are always read, and rows of the blocks that
+ * are read are returned unfiltered. Equality comparisons also use the bloom filters of the file,
+ * if any.
+ *
+ * Literals are compared against the physical values stored in the file; for example timestamps
+ * are compared as integers in the stored time unit.
+ *
+ * @code
+ *  // Select rows where `a >= 10 AND (b < 2.5 OR c == "x")`
+ *  auto f = stats_filter::logical_and(
+ *    stats_filter("a", filter_op::GREATER_EQUAL, 10),
+ *    stats_filter::logical_or(stats_filter("b", filter_op::LESS, 2.5),
+ *                             stats_filter("c", filter_op::EQUAL, "x")));
+ * @endcode
+ */
+class stats_filter {
+ public:
+  /**
+   * @brief Kind of expression node
+   */
+  enum class node_kind : int8_t {
+    NONE,     ///< Empty filter; matches everything
+    COMPARE,  ///< Comparison of a column against a literal
+    AND,      ///< Logical AND of two filters
+    OR,       ///< Logical OR of two filters
+  };
+
+  /**
+   * @brief Type of the literal value in a comparison
+   */
+  enum class literal_kind : int8_t { INTEGER, FLOAT, STRING };
+
+  stats_filter() = default;
+
+  /**
+   * @brief Construct a comparison against an integer literal
+   */
+  template <typename T, typename std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  stats_filter(std::string column, filter_op op, T value)
+    : _kind(node_kind::COMPARE),
+      _column(std::move(column)),
+      _op(op),
+      _literal_kind(literal_kind::INTEGER),
+      _int_value(static_cast<int64_t>(value))
+  {
+  }
+
+  /**
+   * @brief Construct a comparison against a floating-point literal
+   */
+  template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  stats_filter(std::string column, filter_op op, T value)
+    : _kind(node_kind::COMPARE),
+      _column(std::move(column)),
+      _op(op),
+      _literal_kind(literal_kind::FLOAT),
+      _float_value(static_cast<double>(value))
+  {
+  }
+
+  /**
+   * @brief Construct a comparison against a string literal
+   */
+  stats_filter(std::string column, filter_op op, std::string value)
+    : _kind(node_kind::COMPARE),
+      _column(std::move(column)),
+      _op(op),
+      _literal_kind(literal_kind::STRING),
+      _string_value(std::move(value))
+  {
+  }
+
+  /**
+   * @copydoc stats_filter(std::string, filter_op, std::string)
+   */
+  stats_filter(std::string column, filter_op op, const char* value)
+    : stats_filter(std::move(column), op, std::string(value))
+  {
+  }
+
+  /**
+   * @brief Returns a filter that is true when both `lhs` and `rhs` are true
+   */
+  static stats_filter logical_and(stats_filter lhs, stats_filter rhs)
+  {
+    return stats_filter(node_kind::AND, std::move(lhs), std::move(rhs));
+  }
+
+  /**
+   * @brief Returns a filter that is true when either `lhs` or `rhs` is true
+   */
+  static stats_filter logical_or(stats_filter lhs, stats_filter rhs)
+  {
+    return stats_filter(node_kind::OR, std::move(lhs), std::move(rhs));
+  }
+
+  node_kind kind() const { return _kind; }
+  bool empty() const { return _kind == node_kind::NONE; }
+
+  std::string const& column() const { return _column; }
+  filter_op op() const { return _op; }
+  literal_kind get_literal_kind() const { return _literal_kind; }
+  int64_t int_value() const { return _int_value; }
+  double float_value() const { return _float_value; }
+  std::string const& string_value() const { return _string_value; }
+
+  stats_filter const& left() const { return *_children[0]; }
+  stats_filter const& right() const { return *_children[1]; }
+
+ private:
+  stats_filter(node_kind kind, stats_filter lhs, stats_filter rhs)
+    : _kind(kind),
+      _children{std::make_shared<stats_filter>(std::move(lhs)),
+                std::make_shared<stats_filter>(std::move(rhs))}
+  {
+  }
+
+  node_kind _kind = node_kind::NONE;
+  std::string _column;
+  filter_op _op              = filter_op::EQUAL;
+  literal_kind _literal_kind = literal_kind::INTEGER;
+  int64_t _int_value         = 0;
+  double _float_value        = 0;
+  std::string _string_value;
+  std::vector<std::shared_ptr<stats_filter const>> _children;
+};
+
 /**
  * @brief Table metadata for io readers/writers (primarily column names)
  * For nested types (structs, maps, unions), the ordering of names in the column_names vector
@@ -129,12 +295,110 @@ struct table_metadata_with_nullability : public table_metadata {
   std::vector<bool> column_nullable;  //!< Per-column nullability information.
 };
 
+/**
+ * @brief Data (de)compressed with one codec by a reader or a writer
+ */
+struct codec_metrics {
+  size_t num_blocks         = 0;  ///< Number of compressed blocks or pages
+  size_t compressed_bytes   = 0;  ///< Compressed size
+  size_t uncompressed_bytes = 0;  ///< Uncompressed size
+};
+
+/**
+ * @brief How much data a reader or a writer moves and where it spends its time
+ *
+ * The times are in milliseconds. Each phase is timed once its device work is complete, so
+ * collecting the metrics adds a few synchronizations. `host_io_ms` sums the time of the calls to
+ * the data sources or sink, which can be issued from several threads and overlap the other
+ * phases.
+ */
+struct io_metrics {
+  size_t bytes_read    = 0;  ///< Bytes read from the data sources
+  size_t bytes_written = 0;  ///< Bytes written to the data sink
+  std::map<std::string, codec_metrics> codecs;  ///< Data (de)compressed, by codec name
+
+  double host_io_ms       = 0;  ///< Time spent reading the sources or writing the sink
+  double h2d_copy_ms      = 0;  ///< Reading the data into device memory, including host reads
+  double d2h_copy_ms      = 0;  ///< Copying the encoded data to host memory
+  double decompression_ms = 0;  ///< Decompressing the data
+  double compression_ms   = 0;  ///< Compressing the data
+  double decode_ms        = 0;  ///< Decoding the data into columns
+  double encode_ms        = 0;  ///< Encoding the columns
+
+  size_t row_groups_read    = 0;  ///< Row groups (Parquet) or stripes (ORC) read
+  size_t row_groups_skipped = 0;  ///< Row groups or stripes skipped using their statistics
+  size_t peak_scratch_bytes = 0;  ///< Largest temporary device memory held, outputs excluded
+};
+
+/**
+ * @brief Statistics of one column within a file, a row group or a stripe
+ *
+ * The min/max values are only set if `kind` is not `NONE`, in the fields of the ordering of the
+ * column: `i_min`/`i_max` for signed integers and booleans, `u_min`/`u_max` for unsigned integers,
+ * `f_min`/`f_max` for floating-point values and `s_min`/`s_max` for strings, which compare as
+ * unsigned bytes. Counts that the file does not record are -1.
+ */
+struct column_statistics {
+  /**
+   * @brief Ordering of the min/max values
+   */
+  enum class value_kind : int8_t { NONE, SIGNED, UNSIGNED, FLOAT, STRING };
+
+  std::string name;                       ///< Name of the column
+  value_kind kind    = value_kind::NONE;  ///< Which min/max fields are set
+  int64_t num_values = -1;                ///< Number of values, including nulls
+  int64_t null_count = -1;                ///< Number of null values
+  int64_t i_min      = 0;
+  int64_t i_max      = 0;
+  uint64_t u_min     = 0;
+  uint64_t u_max     = 0;
+  double f_min       = 0;
+  double f_max       = 0;
+  std::string s_min;
+  std::string s_max;
+};
+
+/**
+ * @brief Position and column statistics of a row group (Parquet) or a stripe (ORC)
+ */
+struct row_block_metadata {
+  int64_t first_row = 0;                   ///< Index of the first row of the block in the file
+  int64_t num_rows  = 0;                   ///< Number of rows of the block
+  int64_t offset    = 0;                   ///< Byte offset of the block in the file
+  int64_t size      = 0;                   ///< Size of the block in the file, in bytes
+  std::vector<column_statistics> columns;  ///< Statistics of each column of `file_metadata`
+};
+
+/**
+ * @brief Schema, row blocks and statistics of a file, read from its footer without the data
+ */
+struct file_metadata {
+  int64_t num_rows = 0;                          ///< Total number of rows
+  std::vector<std::string> column_names;         ///< Names of the columns, in file order
+  std::vector<data_type> column_types;           ///< Types of the columns, as read by default
+  std::vector<column_statistics> columns;        ///< File-level statistics; empty for Parquet
+  std::vector<row_block_metadata> blocks;        ///< Row groups (Parquet) or stripes (ORC)
+  std::map<std::string, std::string> user_data;  ///< Key-value metadata of the file
+};
+
 /**
  * @brief Table with table metadata used by io readers to return the metadata by value
  */
 struct table_with_metadata {
   std::unique_ptr<table> tbl;
   table_metadata metadata;
+  std::unique_ptr<io_metrics> metrics;  ///< Metrics of the read, if they were requested
+};
+
+/**
+ * @brief Kind of the host memory of a `host_buffer`, which sets how readers copy it to the device
+ */
+enum class host_memory_kind {
+  PAGEABLE,    ///< Pageable memory, copied to the device through pinned staging buffers
+  REGISTERED,  ///< Pageable memory that the reader page-locks with `cudaHostRegister()` for the
+               ///< duration of the read, to copy it to the device with direct DMA transfers
+  PINNED,      ///< Memory that the caller guarantees is page-locked, for example allocated with
+               ///< `cudaMallocHost()`; copied to the device with direct DMA transfers
 };
 
 /**
@@ -143,10 +407,14 @@ struct table_with_metadata {
  * Used to describe buffer input in `source_info` objects.
  */
 struct host_buffer {
-  const char* data = nullptr;
-  size_t size      = 0;
-  host_buffer()    = default;
-  host_buffer(const char* data, size_t size) : data(data), size(size) {}
+  const char* data        = nullptr;
+  size_t size             = 0;
+  host_memory_kind memory = host_memory_kind::PAGEABLE;
+  host_buffer()           = default;
+  host_buffer(const char* data, size_t size, host_memory_kind memory = host_memory_kind::PAGEABLE)
+    : data(data), size(size), memory(memory)
+  {
+  }
 };
 
 /**
@@ -174,8 +442,10 @@ struct source_info {
     : type(io_type::HOST_BUFFER), buffers(host_buffers)
   {
   }
-  explicit source_info(const char* host_data, size_t size)
-    : type(io_type::HOST_BUFFER), buffers({{host_data, size}})
+  explicit source_info(const char* host_data,
+                       size_t size,
+                       host_memory_kind memory = host_memory_kind::PAGEABLE)
+    : type(io_type::HOST_BUFFER), buffers({{host_data, size, memory}})
   {
   }
 
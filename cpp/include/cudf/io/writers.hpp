@@ -30,6 +30,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 //! cuDF interfaces
 namespace cudf {
@@ -46,6 +47,12 @@ struct writer_options {
   compression_type compression = compression_type::AUTO;
   /// Enables writing column statistics in the ORC file
   bool enable_statistics = true;
+  /// Optional per-column flags enabling a bloom filter in each row group
+  std::vector<bool> bloom_filter_columns;
+  /// False positive probability targeted by the bloom filters
+  double bloom_filter_fpp = 0.05;
+  /// Receives the metrics of the writes if not null
+  io_metrics* metrics = nullptr;
 
   writer_options()                      = default;
   writer_options(writer_options const&) = default;
@@ -132,6 +139,24 @@ struct writer_options {
   compression_type compression = compression_type::AUTO;
   /// Select the statistics level to generate in the parquet file
   statistics_freq stats_granularity = statistics_freq::STATISTICS_ROWGROUP;
+  /// Encode integer columns with DELTA_BINARY_PACKED instead of dictionary or PLAIN encoding
+  bool delta_encoding = false;
+  /// Target size in bytes of the uncompressed data pages
+  size_t max_page_size = 512 * 1024;
+  /// Maximum size in bytes of a dictionary page; the rest of the chunk is written PLAIN
+  size_t max_dictionary_size = 512 * 1024;
+  /// Optional per-column encodings, overriding `delta_encoding` for the columns they cover
+  std::vector<column_encoding> column_encodings;
+  /// Optional per-column flags enabling a bloom filter in each column chunk
+  std::vector<bool> bloom_filter_columns;
+  /// False positive probability targeted by the bloom filters
+  double bloom_filter_fpp = 0.01;
+  /// Order of the rows within each row group
+  row_clustering clustering = row_clustering::NONE;
+  /// Indices of the columns to cluster the rows by
+  std::vector<size_type> clustering_columns;
+  /// Receives the metrics of the writes if not null
+  io_metrics* metrics = nullptr;
 
   writer_options()                      = default;
   writer_options(writer_options const&) = default;
@@ -140,9 +165,13 @@ struct writer_options {
    * @brief Constructor to populate writer options.
    *
    * @param format Compression format to use
+   * @param stats_lvl Statistics level to generate
+   * @param delta_enc Whether to encode integer columns with DELTA_BINARY_PACKED
    */
-  explicit writer_options(compression_type format, statistics_freq stats_lvl)
-    : compression(format), stats_granularity(stats_lvl)
+  explicit writer_options(compression_type format,
+                          statistics_freq stats_lvl,
+                          bool delta_enc = false)
+    : compression(format), stats_granularity(stats_lvl), delta_encoding(delta_enc)
   {
   }
 };
@@ -253,21 +282,24 @@ struct writer_options {
    * @param delim character to use between each column entry (default ',')
    * @param true_v string to use for values !=0 in INT8 types (default 'true')
    * @param false_v string to use for values ==0 in INT8 types (default 'false')
+   * @param compression compression to apply to the output; NONE or GZIP (default NONE)
    */
   writer_options(std::string const& na,
                  bool include_header,
                  int rows_per_chunk,
-                 std::string line_terminator = std::string{"\n"},
-                 char delim                  = ',',
-                 std::string true_v          = std::string{"true"},
-                 std::string false_v         = std::string{"false"})
+                 std::string line_terminator  = std::string{"\n"},
+                 char delim                   = ',',
+                 std::string true_v           = std::string{"true"},
+                 std::string false_v          = std::string{"false"},
+                 compression_type compression = compression_type::NONE)
     : na_rep_(na),
       include_header_(include_header),
       rows_per_chunk_(rows_per_chunk),
       line_terminator_(line_terminator),
       inter_column_delimiter_(delim),
       true_value_(true_v),
-      false_value_(false_v)
+      false_value_(false_v),
+      compression_(compression)
   {
   }
 
@@ -285,6 +317,8 @@ struct writer_options {
 
   std::string const& false_value(void) const { return false_value_; }
 
+  compression_type compression(void) const { return compression_; }
+
   // string to use for null entries:
   //
   std::string const na_rep_;
@@ -312,6 +346,10 @@ struct writer_options {
   // string to use for values ==0 in INT8 types (default 'false'):
   //
   std::string const false_value_;
+
+  // compression to apply to the output (default NONE):
+  //
+  compression_type compression_{compression_type::NONE};
 };
 
 /**
@@ -358,6 +396,105 @@ class writer {
 
 }  // namespace csv
 
+namespace json {
+
+/**
+ * @brief Options for the JSON writer.
+ * Also base class for `write_json_args`
+ */
+struct writer_options {
+  writer_options()                      = default;
+  writer_options(writer_options const&) = default;
+
+  virtual ~writer_options(void) = default;
+
+  /**
+   * @brief Constructor to populate writer options.
+   *
+   * @param lines flag that indicates whether to write one JSON object per line (JSON Lines)
+   * instead of a single array of objects (records orientation)
+   * @param include_nulls flag that indicates whether to write null fields as `null`
+   * instead of omitting them from their object
+   * @param rows_per_chunk maximum number of rows to process for each file write
+   * @param line_terminator character to use for separating lines in lines mode (default "\n")
+   */
+  writer_options(bool lines,
+                 bool include_nulls,
+                 int rows_per_chunk,
+                 std::string line_terminator = std::string{"\n"})
+    : lines_(lines),
+      include_nulls_(include_nulls),
+      rows_per_chunk_(rows_per_chunk),
+      line_terminator_(line_terminator)
+  {
+  }
+
+  bool lines(void) const { return lines_; }
+
+  bool include_nulls(void) const { return include_nulls_; }
+
+  int rows_per_chunk(void) const { return rows_per_chunk_; }
+
+  std::string const& line_terminator(void) const { return line_terminator_; }
+
+  // Indicates whether to write one object per line:
+  //
+  bool lines_{true};
+
+  // Indicates whether to write null fields as `null`:
+  //
+  bool include_nulls_{true};
+
+  // maximum number of rows to process for each file write:
+  //
+  int rows_per_chunk_{0};
+
+  // character to use for separating lines in lines mode (default "\n"):
+  //
+  std::string const line_terminator_{"\n"};
+};
+
+/**
+ * @brief Class to write JSON dataset data into columns.
+ */
+class writer {
+ public:
+  class impl;
+
+ private:
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor for output to a file.
+   *
+   * @param sinkp The data sink to write the data to
+   * @param options Settings for controlling writing behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  writer(std::unique_ptr<cudf::io::data_sink> sinkp,
+         writer_options const& options,
+         rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~writer();
+
+  /**
+   * @brief Writes the entire dataset.
+   *
+   * @param table Set of columns to output
+   * @param metadata Table metadata and column names
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void write_all(table_view const& table,
+                 const table_metadata* metadata = nullptr,
+                 cudaStream_t stream            = 0);
+};
+
+}  // namespace json
+
 }  // namespace detail
 }  // namespace io
 }  // namespace cudf
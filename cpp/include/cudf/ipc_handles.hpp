@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup comms_ipc
+ * @{
+ */
+
+/**
+ * @brief Describes the device memory of a table for another process on the same node
+ *
+ * The descriptor is a compact host blob holding one `cudaIpcMemHandle_t` per distinct device
+ * allocation referenced by the table, followed by the type, size, null count and offset of each
+ * column and the positions of its data and null mask within those allocations. It takes a few
+ * dozen bytes per column and per allocation, and no device memory is copied.
+ *
+ * The table's memory must remain allocated and unmodified until every importing process has
+ * destroyed its `imported_table`. Memory that CUDA IPC cannot share, such as managed memory,
+ * cannot be exported; note that the handle of a suballocation, such as one from a pool resource,
+ * exposes the whole underlying allocation to the importer.
+ *
+ * @throws cudf::cuda_error if a handle cannot be created for the memory of a column
+ *
+ * @param input View of the table to share
+ * @return Host descriptor for `import_ipc`
+ */
+std::vector<uint8_t> export_ipc(table_view const& input);
+
+/**
+ * @brief A table of another process's device memory, opened from an `export_ipc` descriptor
+ *
+ * The IPC handles stay open, and the view valid, for the lifetime of the object.
+ */
+class imported_table {
+ public:
+  imported_table(imported_table const&) = delete;
+  imported_table& operator=(imported_table const&) = delete;
+
+  /**
+   * @brief Closes the IPC handles
+   */
+  ~imported_table();
+
+  /**
+   * @brief Returns a view of the imported table
+   */
+  table_view view() const { return _view; }
+
+ private:
+  friend std::unique_ptr<imported_table> import_ipc(std::vector<uint8_t> const& descriptor);
+
+  imported_table() = default;
+
+  std::vector<void*> _allocations;  ///< Opened allocations of the exporting process
+  table_view _view;
+};
+
+/**
+ * @brief Opens the device memory described by an `export_ipc` descriptor and rebuilds a view of
+ * the table over it without copying
+ *
+ * Must be called in a process other than the exporting one, on a device that can access the
+ * exporting device's memory. Peer access is enabled as needed.
+ *
+ * @throws cudf::logic_error if `descriptor` is not a blob created by `export_ipc`
+ * @throws cudf::cuda_error if a handle cannot be opened
+ *
+ * @param descriptor Host descriptor from `export_ipc`
+ * @return The imported table, which owns the opened handles
+ */
+std::unique_ptr<imported_table> import_ipc(std::vector<uint8_t> const& descriptor);
+
+/** @} */  // end of group
+}  // namespace cudf
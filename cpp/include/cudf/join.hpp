@@ -16,6 +16,12 @@
 
 #pragma once
 
+#include <cudf/ast/nodes.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/memory_estimate.hpp>
+
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -34,6 +40,10 @@ namespace cudf {
  * Inner Join returns rows from both tables as long as the values
  * in the columns being joined on match.
  *
+ * The join columns of this and the other joins may be struct columns, whose
+ * rows match when all of their fields do. Null structs are null join-key
+ * values for `compare_nulls`.
+ *
  * @code{.pseudo}
  *          Left a: {0, 1, 2}
  *          Right b: {1, 2, 3}, a: {1, 2, 5}
@@ -79,6 +89,7 @@ namespace cudf {
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
  *
  * @return Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -91,7 +102,8 @@ std::unique_ptr<cudf::table> inner_join(
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
   null_equality compare_nulls         = null_equality::EQUAL,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Performs a left join (also known as left outer join) on the
@@ -147,6 +159,7 @@ std::unique_ptr<cudf::table> inner_join(
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
  *
  * @return Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -159,7 +172,8 @@ std::unique_ptr<cudf::table> left_join(
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
   null_equality compare_nulls         = null_equality::EQUAL,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Performs a full join (also known as full outer join) on the
@@ -215,6 +229,7 @@ std::unique_ptr<cudf::table> left_join(
  * @param[in] compare_nulls controls whether null join-key values
  * should match or not.
  * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
  *
  * @return Result of joining `left` and `right` tables on the columns
  * specified by `left_on` and `right_on`. The resulting table will be joined columns of
@@ -227,7 +242,8 @@ std::unique_ptr<cudf::table> full_join(
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
   null_equality compare_nulls         = null_equality::EQUAL,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 /**
  * @brief Performs a left semi join on the specified columns of two
  * tables (`left`, `right`)
@@ -270,6 +286,7 @@ std::unique_ptr<cudf::table> full_join(
  * @param[in] compare_nulls    Controls whether null join-key values should match or not.
  * @param[in] mr               Device memory resource used to allocate the returned table's
  *                             device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  *
  * @return                     Result of joining `left` and `right` tables on the columns
  *                             specified by `left_on` and `right_on`. The resulting table
@@ -282,7 +299,36 @@ std::unique_ptr<cudf::table> left_semi_join(
   std::vector<cudf::size_type> const& right_on,
   std::vector<cudf::size_type> const& return_columns,
   null_equality compare_nulls         = null_equality::EQUAL,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Performs a left semi join like `left_semi_join`, with the precomputed hash
+ * values of the keys of both tables.
+ *
+ * Saves hashing the keys again when they were already hashed, e.g. to hash
+ * partition them. The hashes may come from any function, e.g. `cudf::hash`, as
+ * long as both tables are hashed by the same function.
+ *
+ * @throw cudf::logic_error if `left_hashes` or `right_hashes` is not a
+ * non-nullable column of 32- or 64-bit integers with one row per row of its table
+ *
+ * @param left_hashes The hash value of the `left_on` columns of each row of `left`
+ * @param right_hashes The hash value of the `right_on` columns of each row of `right`
+ *
+ * @copydetails left_semi_join
+ */
+std::unique_ptr<cudf::table> left_semi_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  cudf::column_view const& left_hashes,
+  cudf::column_view const& right_hashes,
+  std::vector<cudf::size_type> const& return_columns,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Performs a left anti join on the specified columns of two
@@ -326,6 +372,7 @@ std::unique_ptr<cudf::table> left_semi_join(
  * @param[in] compare_nulls    Controls whether null join-key values should match or not.
  * @param[in] mr               Device memory resource used to allocate the returned table's
  *                             device memory
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  *
  * @return                     Result of joining `left` and `right` tables on the columns
  *                             specified by `left_on` and `right_on`. The resulting table
@@ -338,7 +385,36 @@ std::unique_ptr<cudf::table> left_anti_join(
   std::vector<cudf::size_type> const& right_on,
   std::vector<cudf::size_type> const& return_columns,
   null_equality compare_nulls         = null_equality::EQUAL,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Performs a left anti join like `left_anti_join`, with the precomputed hash
+ * values of the keys of both tables.
+ *
+ * Saves hashing the keys again when they were already hashed, e.g. to hash
+ * partition them. The hashes may come from any function, e.g. `cudf::hash`, as
+ * long as both tables are hashed by the same function.
+ *
+ * @throw cudf::logic_error if `left_hashes` or `right_hashes` is not a
+ * non-nullable column of 32- or 64-bit integers with one row per row of its table
+ *
+ * @param left_hashes The hash value of the `left_on` columns of each row of `left`
+ * @param right_hashes The hash value of the `right_on` columns of each row of `right`
+ *
+ * @copydetails left_anti_join
+ */
+std::unique_ptr<cudf::table> left_anti_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  cudf::column_view const& left_hashes,
+  cudf::column_view const& right_hashes,
+  std::vector<cudf::size_type> const& return_columns,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
 
 /**
  * @brief Performs a cross join on two tables (`left`, `right`)
@@ -359,13 +435,595 @@ std::unique_ptr<cudf::table> left_anti_join(
  * @param left  The left table
  * @param right The right table
  * @param mr    Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
  *
  * @return     Result of cross joining `left` and `right` tables
  */
 std::unique_ptr<cudf::table> cross_join(
   cudf::table_view const& left,
   cudf::table_view const& right,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of an inner join between the key columns of two tables
+ * (`left_keys`, `right_keys`) instead of the joined table.
+ *
+ * The gather maps can be used with `cudf::gather` to materialize any columns of the joined
+ * tables, possibly after combining them with other joins or filters.
+ *
+ * @code{.pseudo}
+ *          Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}
+ * Result: { left indices: {1, 2}, right indices: {0, 1} }
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in `left_keys` and `right_keys` mismatch
+ * or is 0
+ * @throw cudf::logic_error if the types of the key columns do not match
+ *
+ * @param[in] left_keys The left table key columns
+ * @param[in] right_keys The right table key columns
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param[in] keys_sorted Whether both tables are sorted on their key columns, in ascending order
+ * with nulls first (the default order of `cudf::sort`). Sorted tables are merge joined, which
+ * needs no hash table. Dictionary columns are always hash joined.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Pair of INT32 columns holding the gather maps of the left and right tables
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  sorted keys_sorted                  = sorted::NO,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of a left join between the key columns of two tables
+ * (`left_keys`, `right_keys`) instead of the joined table.
+ *
+ * Left rows without a match are paired with a right index of -1.
+ *
+ * @code{.pseudo}
+ *          Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}
+ * Result: { left indices: {0, 1, 2}, right indices: {-1, 0, 1} }
+ * @endcode
+ *
+ * @copydetails inner_join(cudf::table_view const&, cudf::table_view const&, null_equality,
+ * sorted, rmm::mr::device_memory_resource*)
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  sorted keys_sorted                  = sorted::NO,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of a full join between the key columns of two tables
+ * (`left_keys`, `right_keys`) instead of the joined table.
+ *
+ * The result contains the rows of a left join, followed by the right rows without a match,
+ * which are paired with a left index of -1.
+ *
+ * @code{.pseudo}
+ *          Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}
+ * Result: { left indices: {0, 1, 2, -1}, right indices: {-1, 0, 1, 2} }
+ * @endcode
+ *
+ * @copydetails inner_join(cudf::table_view const&, cudf::table_view const&, null_equality,
+ * sorted, rmm::mr::device_memory_resource*)
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  sorted keys_sorted                  = sorted::NO,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of an inner join between the key columns of two tables
+ * (`left_keys`, `right_keys`), joining one hash partition of the tables at a time.
+ *
+ * Both tables are hash partitioned on their key columns into `num_partitions` partitions, so
+ * matching rows always land in the same partition pair. Each pair is then joined on its own,
+ * which keeps the hash table of a partition small enough to stay resident in the L2 cache when
+ * the right table is large. The result holds the same index pairs as `cudf::inner_join`, but
+ * grouped by partition instead of in the order of the unpartitioned join.
+ *
+ * @throw cudf::logic_error if the number of columns in `left_keys` and `right_keys` mismatch
+ * or is 0
+ * @throw cudf::logic_error if the types of the key columns do not match
+ * @throw cudf::logic_error if `num_partitions` is negative
+ *
+ * @param[in] left_keys The left table key columns
+ * @param[in] right_keys The right table key columns
+ * @param[in] num_partitions The number of partitions to split both tables into. If 0, the
+ * number is chosen so that the hash table of each partition fits in the device's L2 cache.
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Pair of INT32 columns holding the gather maps of the left and right tables
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> partitioned_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  cudf::size_type num_partitions      = 0,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of a left join between the key columns of two tables
+ * (`left_keys`, `right_keys`), joining one hash partition of the tables at a time.
+ *
+ * Left rows without a match are paired with a right index of -1.
+ *
+ * @copydetails partitioned_inner_join(cudf::table_view const&, cudf::table_view const&,
+ * cudf::size_type, null_equality, rmm::mr::device_memory_resource*)
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> partitioned_left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  cudf::size_type num_partitions      = 0,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of a full join between the key columns of two tables
+ * (`left_keys`, `right_keys`), joining one hash partition of the tables at a time.
+ *
+ * Rows of either table without a match are paired with an index of -1.
+ *
+ * @copydetails partitioned_inner_join(cudf::table_view const&, cudf::table_view const&,
+ * cudf::size_type, null_equality, rmm::mr::device_memory_resource*)
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> partitioned_full_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  cudf::size_type num_partitions      = 0,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of an inner join between two tables on an arbitrary predicate
+ *
+ * The predicate is an expression tree whose column references refer to the `left` or `right`
+ * table, e.g. `left.ts >= right.start AND left.ts <= right.end`; a pair of rows matches if the
+ * predicate is true (not false or null). If the top-level conjunctions of the predicate include
+ * equalities between a left and a right integer or BOOL8 column, the tables are hash joined on
+ * those columns and the whole predicate is evaluated on the candidate pairs only. Otherwise the
+ * predicate is evaluated on every pair of rows by a nested loop kernel, which only allocates the
+ * output gather maps.
+ *
+ * @code{.pseudo}
+ *          Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}
+ *          Predicate: left.a > right.b
+ * Result: { left indices: {2}, right indices: {0} }
+ * @endcode
+ *
+ * @throw cudf::logic_error if the predicate refers to a column out of range or of an unsupported
+ * type (see `cudf::ast::compute_column`), or if its result is not a boolean
+ * @throw cudf::logic_error if the output exceeds the maximum column size
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param predicate The join predicate
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Pair of INT32 columns holding the gather maps of the left and right tables
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> conditional_inner_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  ast::expression const& predicate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns the row indices of a left join between two tables on an arbitrary predicate
+ *
+ * Left rows without a match are paired with a right index of -1.
+ *
+ * @copydetails conditional_inner_join(cudf::table_view const&, cudf::table_view const&,
+ * ast::expression const&, rmm::mr::device_memory_resource*)
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> conditional_left_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  ast::expression const& predicate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Direction of the search of an as-of join
+ */
+enum class asof_direction : int8_t {
+  BACKWARD,  ///< Match the last right row whose key is less than or equal to the left key
+  FORWARD,   ///< Match the first right row whose key is greater than or equal to the left key
+  NEAREST    ///< Match the closer of the backward and forward matches, backward on ties
+};
+
+/**
+ * @brief Returns the row indices of an as-of join between two tables
+ *
+ * Each left row is matched with the right row of equal `by` keys whose `on` key is the nearest
+ * in the given direction, as in a join of trades to the latest quote of each symbol. The rows
+ * whose `on` keys are farther apart than `tolerance` do not match. Every left row is returned,
+ * in order, and the left rows without a match are paired with a right index of -1.
+ *
+ * The right rows of each `by` group are sorted by `on` once, and each left row then finds its
+ * group and its match with binary searches, without materializing any intermediate table.
+ *
+ * @code{.pseudo}
+ *          Left  by: {A, B, A, A}  on: {2, 3, 5, 9}
+ *          Right by: {A, A, B, A}  on: {1, 2, 4, 6}
+ *          direction: BACKWARD
+ * Result: { left indices: {0, 1, 2, 3}, right indices: {1, -1, 1, 3} }
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns in `left_by` and `right_by` mismatch
+ * @throw cudf::logic_error if the types of the `by` columns or of the `on` columns mismatch
+ * @throw cudf::logic_error if the `on` columns are not of an integral, timestamp or duration
+ * type, or contain nulls
+ * @throw cudf::logic_error if `tolerance` is negative
+ *
+ * @param[in] left_by The left table grouping columns; may have no columns
+ * @param[in] left_on The left table key column
+ * @param[in] right_by The right table grouping columns; may have no columns
+ * @param[in] right_on The right table key column. The right rows with equal `by` keys must be
+ * sorted by `on` in ascending order, which holds when the whole table is sorted by `on`.
+ * @param[in] direction The direction of the search
+ * @param[in] tolerance The maximum distance between matched keys, in units of the representation
+ * of the `on` type (e.g. ticks of the timestamp resolution)
+ * @param[in] compare_nulls controls whether null `by` values should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Pair of INT32 columns holding the gather maps of the left and right tables
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> asof_join(
+  cudf::table_view const& left_by,
+  cudf::column_view const& left_on,
+  cudf::table_view const& right_by,
+  cudf::column_view const& right_on,
+  asof_direction direction            = asof_direction::BACKWARD,
+  int64_t tolerance                   = std::numeric_limits<int64_t>::max(),
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Estimates the device memory used by `inner_join`, `left_join` or `full_join` of two
+ * tables, without reading their data
+ *
+ * The output is sized as `output_rows` gathered rows of the left columns and of the right
+ * columns not in `columns_in_common`, each with a null mask. The scratch memory is the hash table
+ * built on the right keys, sized like the joins size it, and the join indices of both sides.
+ * An inner join builds its hash table on the smaller table, so its estimate is an upper bound.
+ *
+ * The number of output rows depends on the data. `hash_join::inner_join_size` and
+ * `hash_join::left_join_size` compute it exactly; a foreign key join returns `left.num_rows()`
+ * rows.
+ *
+ * @throw cudf::logic_error if the number of columns in `left_on` and `right_on` mismatch
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param left_on The column indices from `left` to join on
+ * @param right_on The column indices from `right` to join on
+ * @param columns_in_common The pairs of left and right key columns returned only once
+ * @param output_rows Expected number of rows of the joined table
+ *
+ * @return The estimated output and peak scratch bytes of the join
+ */
+memory_estimate estimate_join_memory(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  std::size_t output_rows);
+
+/**
+ * @brief Hash join that builds the hash table of a build table once and probes it with any
+ * number of probe tables.
+ *
+ * Probing returns gather maps, i.e. the row indices of the matching probe and build table rows,
+ * so the joined columns can be materialized with `cudf::gather` only when needed.
+ *
+ * The build table is not copied; it must outlive the `hash_join` object.
+ *
+ * @code{.pseudo}
+ *          Build b: {1, 2, 3}
+ *          Probe a: {0, 1, 2}
+ *          hash_join joiner(Build, {0});
+ *          joiner.inner_join(Probe, {0})
+ * Result: { probe indices: {1, 2}, build indices: {0, 1} }
+ * @endcode
+ */
+class hash_join {
+ public:
+  hash_join() = delete;
+  ~hash_join();
+  hash_join(hash_join const&) = delete;
+  hash_join(hash_join&&)      = delete;
+  hash_join& operator=(hash_join const&) = delete;
+  hash_join& operator=(hash_join&&) = delete;
+
+  /**
+   * @brief Constructs the hash table of the build table's join keys.
+   *
+   * @throw cudf::logic_error if `build_on` is empty
+   * @throw cudf::logic_error if the number of rows in `build` exceeds MAX_JOIN_SIZE
+   * @throw std::out_of_range if an element of `build_on` exceeds the number of columns in `build`
+   *
+   * @param build The build table
+   * @param build_on The column indices from `build` to join on
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_join(cudf::table_view const& build,
+            std::vector<size_type> const& build_on,
+            cudaStream_t stream = 0);
+
+  /**
+   * @brief Constructs the hash table of the build table's join keys from their precomputed
+   * hash values.
+   *
+   * Saves hashing the keys again when they were already hashed, e.g. to hash partition them.
+   * The hashes may come from any function, e.g. `cudf::hash`, as long as the probe rows are
+   * hashed by the same function; the probe tables must then be passed with their hashes too.
+   * `inner_join_splits` and `left_join_splits` are not supported by such a join.
+   *
+   * @throw cudf::logic_error if `build_on` is empty
+   * @throw cudf::logic_error if the number of rows in `build` exceeds MAX_JOIN_SIZE
+   * @throw cudf::logic_error if `build_hashes` is not a non-nullable column of 32- or 64-bit
+   * integers with one row per row of `build`
+   * @throw std::out_of_range if an element of `build_on` exceeds the number of columns in `build`
+   *
+   * @param build The build table
+   * @param build_on The column indices from `build` to join on
+   * @param build_hashes The hash value of the `build_on` columns of each row of `build`
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_join(cudf::table_view const& build,
+            std::vector<size_type> const& build_on,
+            cudf::column_view const& build_hashes,
+            cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns the row indices of an inner join between the probe table and the build table.
+   *
+   * @throw cudf::logic_error if the number of elements in `probe_on` and the `build_on` columns
+   * of the constructor are not equal
+   * @throw cudf::logic_error if the types of the joined columns do not match
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on.
+   * The column from `probe` indicated by `probe_on[i]` will be compared against the build column
+   * indicated by `build_on[i]`.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param mr Device memory resource used to allocate the returned columns' device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return Pair of INT32 columns holding the gather maps of the probe and build tables
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Performs `inner_join` with the precomputed hash value of each probe row.
+   *
+   * @throw cudf::logic_error if `probe_hashes` is not a non-nullable column of 32- or 64-bit
+   * integers with one row per row of `probe`
+   * @throw cudf::logic_error if the build table was not constructed with precomputed hashes
+   *
+   * @param probe_hashes The hash value of the `probe_on` columns of each row of `probe`, computed
+   * by the function that hashed the build rows
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    cudf::column_view const& probe_hashes,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Returns the row indices of a left join between the probe table and the build table.
+   *
+   * Every probe row is included. Probe rows without a match are paired with a build index of -1.
+   *
+   * @copydetails hash_join::inner_join
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Performs `left_join` with the precomputed hash value of each probe row.
+   *
+   * @throw cudf::logic_error if `probe_hashes` is not a non-nullable column of 32- or 64-bit
+   * integers with one row per row of `probe`
+   * @throw cudf::logic_error if the build table was not constructed with precomputed hashes
+   *
+   * @param probe_hashes The hash value of the `probe_on` columns of each row of `probe`, computed
+   * by the function that hashed the build rows
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    cudf::column_view const& probe_hashes,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Returns the row indices of a full join between the probe table and the build table.
+   *
+   * The result contains the rows of a left join, followed by the build rows without a match,
+   * which are paired with a probe index of -1.
+   *
+   * @copydetails hash_join::inner_join
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Performs `full_join` with the precomputed hash value of each probe row.
+   *
+   * @throw cudf::logic_error if `probe_hashes` is not a non-nullable column of 32- or 64-bit
+   * integers with one row per row of `probe`
+   * @throw cudf::logic_error if the build table was not constructed with precomputed hashes
+   *
+   * @param probe_hashes The hash value of the `probe_on` columns of each row of `probe`, computed
+   * by the function that hashed the build rows
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join(
+    cudf::table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    cudf::column_view const& probe_hashes,
+    null_equality compare_nulls         = null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Returns the exact number of rows `inner_join` would return for the probe table.
+   *
+   * @throw cudf::logic_error if the number of elements in `probe_on` and the `build_on` columns
+   * of the constructor are not equal
+   * @throw cudf::logic_error if the types of the joined columns do not match
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return Number of rows in the inner join output. The count is exact even if it exceeds the
+   * maximum column size, in which case `inner_join` would throw.
+   */
+  std::size_t inner_join_size(cudf::table_view const& probe,
+                              std::vector<size_type> const& probe_on,
+                              null_equality compare_nulls = null_equality::EQUAL,
+                              cudaStream_t stream         = 0) const;
+
+  /**
+   * @brief Returns `inner_join_size` with the precomputed hash value of each probe row.
+   *
+   * @throw cudf::logic_error if `probe_hashes` is not a non-nullable column of 32- or 64-bit
+   * integers with one row per row of `probe`
+   * @throw cudf::logic_error if the build table was not constructed with precomputed hashes
+   *
+   * @param probe_hashes The hash value of the `probe_on` columns of each row of `probe`, computed
+   * by the function that hashed the build rows
+   */
+  std::size_t inner_join_size(cudf::table_view const& probe,
+                              std::vector<size_type> const& probe_on,
+                              cudf::column_view const& probe_hashes,
+                              null_equality compare_nulls = null_equality::EQUAL,
+                              cudaStream_t stream         = 0) const;
+
+  /**
+   * @brief Returns the exact number of rows `left_join` would return for the probe table.
+   *
+   * @copydetails hash_join::inner_join_size
+   */
+  std::size_t left_join_size(cudf::table_view const& probe,
+                             std::vector<size_type> const& probe_on,
+                             null_equality compare_nulls = null_equality::EQUAL,
+                             cudaStream_t stream         = 0) const;
+
+  /**
+   * @brief Returns `left_join_size` with the precomputed hash value of each probe row.
+   *
+   * @throw cudf::logic_error if `probe_hashes` is not a non-nullable column of 32- or 64-bit
+   * integers with one row per row of `probe`
+   * @throw cudf::logic_error if the build table was not constructed with precomputed hashes
+   *
+   * @param probe_hashes The hash value of the `probe_on` columns of each row of `probe`, computed
+   * by the function that hashed the build rows
+   */
+  std::size_t left_join_size(cudf::table_view const& probe,
+                             std::vector<size_type> const& probe_on,
+                             cudf::column_view const& probe_hashes,
+                             null_equality compare_nulls = null_equality::EQUAL,
+                             cudaStream_t stream         = 0) const;
+
+  /**
+   * @brief Splits the probe table so that the inner join of each part with the build table
+   * returns at most `max_output_rows` rows.
+   *
+   * Bounds the memory of a join whose output is too large, e.g. a skewed many-to-many join, by
+   * joining the probe table one part at a time. The parts are grown greedily from the exact
+   * output size of each probe row; a probe row with more than `max_output_rows` matches gets a
+   * part of its own. The probe indices of a part's output are relative to the part:
+   *
+   * @code{.pseudo}
+   * auto const splits = joiner.inner_join_splits(probe, {0}, max_output_rows);
+   * for (auto const& part : cudf::split(probe, splits)) {
+   *   auto const part_indices = joiner.inner_join(part, {0});
+   *   ...
+   * }
+   * @endcode
+   *
+   * @throw cudf::logic_error if `max_output_rows` is 0
+   * @throw cudf::logic_error if the number of elements in `probe_on` and the `build_on` columns
+   * of the constructor are not equal
+   * @throw cudf::logic_error if the types of the joined columns do not match
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on
+   * @param max_output_rows The maximum number of rows of the join output of one part
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The first row of every part but the first, as expected by `cudf::split`
+   */
+  std::vector<size_type> inner_join_splits(cudf::table_view const& probe,
+                                           std::vector<size_type> const& probe_on,
+                                           std::size_t max_output_rows,
+                                           null_equality compare_nulls = null_equality::EQUAL,
+                                           cudaStream_t stream         = 0) const;
+
+  /**
+   * @brief Splits the probe table so that the left join of each part with the build table
+   * returns at most `max_output_rows` rows.
+   *
+   * @copydetails hash_join::inner_join_splits
+   */
+  std::vector<size_type> left_join_splits(cudf::table_view const& probe,
+                                          std::vector<size_type> const& probe_on,
+                                          std::size_t max_output_rows,
+                                          null_equality compare_nulls = null_equality::EQUAL,
+                                          cudaStream_t stream         = 0) const;
+
+ private:
+  struct hash_join_impl;
+  const std::unique_ptr<const hash_join_impl> impl;
+};
 
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+
+namespace cudf {
+namespace lists {
+/**
+ * @addtogroup lists_contains
+ * @{
+ */
+
+/**
+ * @brief Returns a boolean column identifying the lists that contain a key
+ *
+ * @code{.pseudo}
+ * l = [{1, 2, 3}, {4, null}, {}, null, {2, 2}]
+ * r = contains(l, 2)
+ * r is now [true, false, false, null, true]
+ * @endcode
+ *
+ * Null elements of the lists never match the key. Null lists produce null output rows, and an
+ * invalid key produces an all-null column.
+ *
+ * @throw cudf::logic_error if the type of `search_key` is not the type of the list elements
+ * @throw cudf::logic_error if the list elements are not of a fixed-width or string type
+ *
+ * @param lists Lists column to search
+ * @param search_key Value to search for in each list
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New BOOL8 column with one row per list
+ */
+std::unique_ptr<column> contains(
+  lists_column_view const& lists,
+  cudf::scalar const& search_key,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace lists
+}  // namespace cudf
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
+namespace cudf {
+namespace lists {
+/**
+ * @addtogroup lists_elements
+ * @{
+ */
+
+/**
+ * @brief Returns the number of elements of each list of a lists column
+ *
+ * @code{.pseudo}
+ * l = [{1, 2, 3}, {4}, {}, null, {5, 6}]
+ * r = count_elements(l)
+ * r is now [3, 1, 0, null, 2]
+ * @endcode
+ *
+ * Null elements of the lists are counted. Null lists produce null output rows.
+ *
+ * @param input Lists column whose lists are counted
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New INT32 column of the number of elements of each list
+ */
+std::unique_ptr<column> count_elements(
+  lists_column_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace lists
+}  // namespace cudf
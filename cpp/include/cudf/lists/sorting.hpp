@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/types.hpp>
+
+namespace cudf {
+namespace lists {
+/**
+ * @addtogroup lists_sort
+ * @{
+ */
+
+/**
+ * @brief Sorts the elements within each list of a lists column
+ *
+ * @code{.pseudo}
+ * l = [{3, 1, 2}, {}, {null, 5, 4}, null]
+ * r = sort_lists(l, order::ASCENDING, null_order::AFTER)
+ * r is now [{1, 2, 3}, {}, {4, 5, null}, null]
+ * @endcode
+ *
+ * The output has the offsets and the null mask of the input; only the order of the elements of
+ * each list changes. The sort is stable.
+ *
+ * @throw cudf::logic_error if the list elements are lists
+ *
+ * @param input Lists column whose lists are sorted
+ * @param column_order Sort order of the elements of each list
+ * @param null_precedence Order of the null elements relative to the other elements of each list
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New lists column with the elements of each list sorted
+ */
+std::unique_ptr<column> sort_lists(
+  lists_column_view const& input,
+  order column_order,
+  null_order null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace lists
+}  // namespace cudf
@@ -83,6 +83,10 @@ namespace cudf {
  * columns in `tables_to_merge` tables
  * @throws cudf::logic_error if `key_cols` size and `column_order` size mismatches
  *
+ * Up to 32 tables are merged in a single pass, which ranks each row against the other tables
+ * with binary searches and gathers the output once. Larger sets of tables are merged in groups of
+ * 32. Rows with equal keys are ordered by the index of their input table.
+ *
  * @param[in] tables_to_merge Non-empty list of tables to be merged
  * @param[in] key_cols Indices of left_cols and right_cols to be used
  *                     for comparison criteria
@@ -99,5 +103,83 @@ std::unique_ptr<cudf::table> merge(
   std::vector<cudf::null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr                  = rmm::mr::get_default_resource());
 
+/**
+ * @brief Merges a set of sorted tables into a sequence of chunks of bounded size.
+ *
+ * The output of `merge()` is produced in chunks of `chunk_rows` rows, the last chunk holding the
+ * remaining rows, so that the input tables can be merged without materializing the full output.
+ * This allows combining many sorted runs, as in an external sort, with a peak memory of about
+ * twice the chunk size on top of the inputs and of an index of the rows of all the inputs.
+ *
+ * The constructor ranks every row of the inputs against the other inputs in a single pass, which
+ * costs one binary search per row and per other input. Each call to `next()` then concatenates
+ * the rows of the inputs that fall in the chunk and reorders them with a single gather.
+ *
+ * The input tables must outlive the `chunked_merge` object.
+ *
+ * ```
+ * Example:
+ * input:
+ * table 1 => col 1 {0, 2, 4}
+ * table 2 => col 1 {1, 3, 5}
+ * chunk_rows = 4
+ * output:
+ * chunk 1 => col 1 {0, 1, 2, 3}
+ * chunk 2 => col 1 {4, 5}
+ * ```
+ */
+class chunked_merge {
+ public:
+  chunked_merge()                     = delete;
+  chunked_merge(chunked_merge const&) = delete;
+  chunked_merge(chunked_merge&&)      = delete;
+  chunked_merge& operator=(chunked_merge const&) = delete;
+  chunked_merge& operator=(chunked_merge&&) = delete;
+  ~chunked_merge();
+
+  /**
+   * @brief Ranks the rows of the tables to merge.
+   *
+   * @throws cudf::logic_error for the invalid arguments of `merge()`
+   * @throws cudf::logic_error if `chunk_rows` is not positive
+   *
+   * @param[in] tables_to_merge Non-empty list of tables to be merged
+   * @param[in] key_cols Indices of the columns used for comparison criteria
+   * @param[in] column_order Sort order types of columns indexed by key_cols
+   * @param[in] null_precedence Array indicating the order of nulls with respect
+   * to non-nulls for the indexing columns (key_cols)
+   * @param[in] chunk_rows Maximum number of rows of each chunk
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches
+   */
+  chunked_merge(std::vector<table_view> const& tables_to_merge,
+                std::vector<cudf::size_type> const& key_cols,
+                std::vector<cudf::order> const& column_order,
+                std::vector<cudf::null_order> const& null_precedence,
+                size_type chunk_rows,
+                cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns whether chunks remain to be merged.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Returns the next chunk of the merged output.
+   *
+   * @throws cudf::logic_error if no chunk remains
+   *
+   * @param[in] mr Device memory resource used to allocate the returned table's device memory
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches
+   * @returns A table containing the next `chunk_rows` rows of the merged output
+   */
+  std::unique_ptr<cudf::table> next(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0);
+
+ private:
+  struct impl;
+  std::unique_ptr<impl> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -231,5 +231,57 @@ rmm::device_buffer bitmask_and(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
   cudaStream_t stream                 = 0);
 
+/**
+ * @brief Returns a bitwise OR of the bitmasks of columns of a table
+ *
+ * The masks of all the columns are combined word by word in a single kernel. If any of the
+ * columns isn't nullable, it is all valid and so is the result: an empty bitmask is returned.
+ *
+ * @param view The table of columns
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return rmm::device_buffer Output bitmask
+ */
+rmm::device_buffer bitmask_or(
+  table_view const& view,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns a bitwise AND of the bitmasks of columns of a table and its null count
+ *
+ * The null count is computed by the kernel computing the mask, instead of counting the set bits
+ * of the result in a separate pass.
+ *
+ * @see bitmask_and
+ *
+ * @param view The table of columns
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return The output bitmask, empty if no column is nullable, and its null count
+ */
+std::pair<rmm::device_buffer, size_type> bitmask_and_with_null_count(
+  table_view const& view,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/**
+ * @brief Returns a bitwise OR of the bitmasks of columns of a table and its null count
+ *
+ * The null count is computed by the kernel computing the mask, instead of counting the set bits
+ * of the result in a separate pass.
+ *
+ * @see bitmask_or
+ *
+ * @param view The table of columns
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned device_buffer
+ * @return The output bitmask, empty if any column is not nullable, and its null count
+ */
+std::pair<rmm::device_buffer, size_type> bitmask_or_with_null_count(
+  table_view const& view,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
 /** @} */  // end of group
 }  // namespace cudf
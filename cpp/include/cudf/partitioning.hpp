@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/copying.hpp>
 #include <cudf/types.hpp>
 #include <memory>
 #include <vector>
@@ -78,6 +79,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
  * @param input The table to partition
  * @param columns_to_hash Indices of input columns to hash
  * @param num_partitions The number of partitions to use
+ * @param hash_function The hash function used to hash the rows
  * @param mr Device memory resource used to allocate the returned table's device memory.
  *
  * @returns An output table and a vector of row offsets to each partition
@@ -86,8 +88,187 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Hash partitions the rows of `input` directly into one packed buffer per
+ * partition.
+ *
+ * Assigns the rows to `num_partitions` partitions like `hash_partition` and
+ * copies the rows of each partition into its own contiguous device buffer, with
+ * the metadata produced by `pack_metadata`, so that each partition can be sent to
+ * another process and rebuilt with `unpack`. This is equivalent to, but copies the
+ * data only once instead of, a `hash_partition` followed by a `pack` of each
+ * partition.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ * @throw cudf::logic_error if `input` has a column that is neither fixed-width nor strings
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param hash_function The hash function used to hash the rows
+ * @param mr Device memory resource used to allocate the returned device buffers.
+ *
+ * @returns The `num_partitions` packed partitions, or no partitions if
+ * `num_partitions <= 0`
+ */
+std::vector<packed_columns> hash_partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Partitions rows from the input table by their precomputed hash values.
+ *
+ * Saves hashing the keys again when the same keys are hashed by several
+ * operators. When `row_hashes` is `hash(input.select(columns_to_hash),
+ * hash_function)`, the rows are assigned to the same partitions as by
+ * `hash_partition(input, columns_to_hash, num_partitions, hash_function)`:
+ * 32-bit hashes are partitioned like `hash_id::HASH_MURMUR3` hashes and 64-bit
+ * hashes like `hash_id::HASH_XXHASH64` hashes.
+ *
+ * @throw cudf::logic_error if `row_hashes` is not a non-nullable column of 32-
+ * or 64-bit integers with one row per row of `input`
+ *
+ * @param input The table to partition
+ * @param row_hashes The hash value of each row of `input`
+ * @param num_partitions The number of partitions to use
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @returns An output table and a vector of row offsets to each partition
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
+  table_view const& input,
+  column_view const& row_hashes,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Partitions the rows of `input` by their precomputed hash values directly
+ * into one packed buffer per partition.
+ *
+ * Assigns the rows to partitions like `hash_partition(input, row_hashes,
+ * num_partitions)` and packs them like `hash_partition_and_pack`.
+ *
+ * @throw cudf::logic_error if `row_hashes` is not a non-nullable column of 32-
+ * or 64-bit integers with one row per row of `input`
+ * @throw cudf::logic_error if `input` has a column that is neither fixed-width nor strings
+ *
+ * @param input The table to partition
+ * @param row_hashes The hash value of each row of `input`
+ * @param num_partitions The number of partitions to use
+ * @param mr Device memory resource used to allocate the returned device buffers.
+ *
+ * @returns The `num_partitions` packed partitions, or no partitions if
+ * `num_partitions <= 0`
+ */
+std::vector<packed_columns> hash_partition_and_pack(
+  table_view const& input,
+  column_view const& row_hashes,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Partitions the rows of `input` into the ranges delimited by sorted `splitters`.
+ *
+ * `splitters` holds `k` rows sorted by `column_order` and `null_precedence`, with the
+ * same types as the `key_columns` of `input`. A row whose keys sort after exactly `j`
+ * splitters, i.e. `lower_bound(splitters, keys)` is `j`, goes to partition `j`, so
+ * there are `k + 1` partitions and every key of partition `j` sorts before every key
+ * of partition `j + 1`. The rows are rearranged like `partition` and the order within
+ * each partition is undefined.
+ *
+ * ```
+ * input      => col 0 {5, 1, 9, 3, 7, 3}
+ * key_columns => {0}
+ * splitters  => col 0 {3, 7}
+ *
+ * output:
+ * table   => col 0 {1, 3, 3, 5, 7, 9}
+ * offsets => {0, 3, 5, 6}
+ * ```
+ *
+ * @throw std::out_of_range if an index of `key_columns` is invalid
+ * @throw cudf::logic_error if the columns of `splitters` do not match the key columns
+ *
+ * @param input The table to partition
+ * @param key_columns Indices of the input columns compared with `splitters`
+ * @param splitters The sorted rows that delimit the partitions
+ * @param column_order The sort order of each key column, ascending if empty
+ * @param null_precedence The order of the nulls of each key column, before if empty
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return Pair containing the reordered table and vector of `k + 2` offsets to each
+ * partition such that the size of partition `i` is `offset[i+1] - offset[i]`.
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& splitters,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Range partitions the rows of `input` directly into one packed buffer per
+ * partition.
+ *
+ * Assigns the rows to the `splitters.num_rows() + 1` partitions like `range_partition`
+ * and packs them like `hash_partition_and_pack`. The rows of each partition keep
+ * their order in `input`.
+ *
+ * @throw std::out_of_range if an index of `key_columns` is invalid
+ * @throw cudf::logic_error if the columns of `splitters` do not match the key columns
+ * @throw cudf::logic_error if `input` has a column that is neither fixed-width nor strings
+ *
+ * @param input The table to partition
+ * @param key_columns Indices of the input columns compared with `splitters`
+ * @param splitters The sorted rows that delimit the partitions
+ * @param column_order The sort order of each key column, ascending if empty
+ * @param null_precedence The order of the nulls of each key column, before if empty
+ * @param mr Device memory resource used to allocate the returned device buffers.
+ * @return The `splitters.num_rows() + 1` packed partitions
+ */
+std::vector<packed_columns> range_partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& splitters,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
+/**
+ * @brief Chooses the splitters of `num_partitions` range partitions of similar size
+ * from a random sample of the rows of `keys`.
+ *
+ * Samples `num_samples` distinct rows of `keys`, sorts them and returns the
+ * `num_partitions - 1` samples at evenly spaced ranks, to be passed to
+ * `range_partition`. In a distributed sort each process samples its own rows and
+ * the splitters are chosen from the gathered samples.
+ *
+ * @throw cudf::logic_error if `num_partitions <= 0`
+ *
+ * @param keys The key columns of the table to partition
+ * @param num_partitions The number of partitions
+ * @param num_samples The number of rows to sample, at most `keys.num_rows()`
+ * @param column_order The sort order of each key column, ascending if empty
+ * @param null_precedence The order of the nulls of each key column, before if empty
+ * @param seed Seed of the random sampling
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return The sorted splitters, empty if `num_partitions == 1` or `keys` is empty
+ */
+std::unique_ptr<table> sample_splitters(
+  table_view const& keys,
+  size_type num_partitions,
+  size_type num_samples,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  int64_t seed                                   = 0,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+
 /**
  * @brief Round-robin partition.
  *
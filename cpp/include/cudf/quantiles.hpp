@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
@@ -56,6 +57,35 @@ std::unique_ptr<column> quantile(
   bool exact                          = true,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes quantiles of the valid values of an unsorted column.
+ *
+ * Unlike `quantile`, `input` is not expected to be sorted and nulls are ignored:
+ * the quantiles are those of the sorted valid values of `input`, and are null
+ * only if `input` has no valid values. NaN values are ordered after all other
+ * values.
+ *
+ * When the quantiles need at most a few values of the sorted order, the values
+ * are found by a radix selection, which reads the column once per byte of its
+ * type rather than sorting it. Otherwise the column is sorted.
+ *
+ * @throw cudf::logic_error if `input` is not a numeric column
+ *
+ * @param input Column from which to compute quantile values
+ * @param q Quantiles in range [0, 1]
+ * @param interp Strategy used to select between values adjacent to a quantile
+ * @param exact If true, returns doubles. If false, returns same type as input.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns Column of the quantiles
+ */
+std::unique_ptr<column> quantile_unsorted(
+  column_view const& input,
+  std::vector<double> const& q,
+  interpolation interp                = interpolation::LINEAR,
+  bool exact                          = true,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Returns the rows of the input corresponding to the requested quantiles.
  *
@@ -93,5 +123,95 @@ std::unique_ptr<table> quantiles(
   std::vector<null_order> const& null_precedence = {},
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
 
+/**
+ * @brief Builds a t-digest of the non-null values of each group of `values`.
+ *
+ * A t-digest summarizes the distribution of a group by a small set of weighted
+ * centroids, which are kept small near the ends of the distribution and are
+ * allowed to grow near its median, so that extreme quantiles such as p99 stay
+ * accurate. Each digest holds at most about `compression / 2` centroids.
+ *
+ * The digests are returned as a table of three columns: the `INT32` group of
+ * each centroid, its `FLOAT64` mean and its `FLOAT64` weight, i.e. the number
+ * of values it summarizes. Rows are sorted by group, and then by mean. Digests
+ * built from different columns can be combined with `merge_tdigests`.
+ *
+ * The values are never sorted as a whole. They are digested a bounded number
+ * of rows at a time, and each chunk is merged into the digests of the previous
+ * chunks.
+ *
+ * @throw cudf::logic_error if `values` is not a numeric column
+ * @throw cudf::logic_error if `group_labels` is neither empty nor an `INT32`
+ * column of the same size as `values`
+ * @throw cudf::logic_error if `compression` is less than 1
+ *
+ * @param values Column whose distribution is summarized. NaN values are ignored.
+ * @param group_labels Group in `[0, num_groups)` of each row of `values`. Rows
+ * with a null label or a label outside `[0, num_groups)` are ignored. If empty,
+ * all rows belong to group 0.
+ * @param num_groups Number of groups
+ * @param compression Accuracy of the digests, bounding their number of centroids
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @returns Table of the group, mean and weight of the centroids of every digest
+ */
+std::unique_ptr<table> tdigest(
+  column_view const& values,
+  column_view const& group_labels     = {},
+  size_type num_groups                = 1,
+  double compression                  = 100,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Merges t-digests into one digest per group.
+ *
+ * `digests` may be the concatenation of any number of tables returned by
+ * `tdigest` or `merge_tdigests`, in any order. The centroids of every group
+ * are merged into a single digest, as if the digest had been built from all
+ * the values summarized by them.
+ *
+ * @throw cudf::logic_error if `digests` is not a table of `INT32` groups and
+ * `FLOAT64` means and weights, without nulls
+ * @throw cudf::logic_error if `compression` is less than 1
+ *
+ * @param digests Table of the group, mean and weight of centroids
+ * @param compression Accuracy of the merged digests
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ *
+ * @returns Table of the group, mean and weight of the centroids of the merged
+ * digests, sorted by group and then by mean
+ */
+std::unique_ptr<table> merge_tdigests(
+  table_view const& digests,
+  double compression                  = 100,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Estimates quantiles of every group from its t-digest.
+ *
+ * Quantiles are interpolated linearly between the centers of the centroids of
+ * the group's digest. Quantiles in the first or last half centroid of a digest
+ * are the mean of that centroid.
+ *
+ * @throw cudf::logic_error if `digests` is not a table of `INT32` groups and
+ * `FLOAT64` means and weights, without nulls
+ * @throw cudf::logic_error if any of `q` is not in `[0, 1]`
+ *
+ * @param digests Table of the centroids of the digests, sorted by group and
+ * then by mean, as returned by `tdigest` or `merge_tdigests`
+ * @param num_groups Number of groups
+ * @param q Quantiles in `[0, 1]` to estimate for every group
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @returns `FLOAT64` column of `num_groups * q.size()` rows, where row
+ * `g * q.size() + i` is quantile `q[i]` of group `g`. Groups without centroids
+ * have null quantiles.
+ */
+std::unique_ptr<column> tdigest_quantiles(
+  table_view const& digests,
+  size_type num_groups,
+  std::vector<double> const& q,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
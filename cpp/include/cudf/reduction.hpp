@@ -18,6 +18,9 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
 
 namespace cudf {
 /**
@@ -62,6 +65,74 @@ std::unique_ptr<scalar> reduce(
   data_type output_dtype,
   rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Computes several reductions of each column of a table with as few passes as possible.
+ *
+ * The aggregations `sum`, `sum_of_squares`, `min`, `max`, `mean`, `variance` and `std` of the
+ * numeric columns (except UINT64), and `min` and `max` of the timestamp and duration columns, are
+ * computed for all columns by a single pass over the table, and their results are copied to the
+ * host at once. `count` is computed from the null counts of the columns. The other aggregations
+ * are computed by `reduce()`, one call per aggregation.
+ *
+ * The type of each result depends on the aggregation:
+ * - `sum`, `product` and `sum_of_squares`: FLOAT64 for floating point columns, INT64 otherwise
+ * - `min` and `max`: the type of the column
+ * - `any` and `all`: BOOL8
+ * - `count` and `nunique`: INT32
+ * - otherwise: FLOAT64
+ *
+ * The null values are skipped. The result of an aggregation other than `count` is not valid if the
+ * column has no valid value.
+ *
+ * @throws cudf::logic_error if `aggs.size() != table.num_columns()`
+ * @throws cudf::logic_error if an aggregation is not supported by `reduce()` for the column type
+ *
+ * @param table Input table
+ * @param aggs `aggs[i]` holds the aggregations of column `i`
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns `result[i][j]` is the result of `aggs[i][j]` over column `i`
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const &table,
+  std::vector<std::vector<std::unique_ptr<aggregation>>> const &aggs,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Computes the reduction of each segment of a column.
+ *
+ * Segment `i` holds the rows `[offsets[i], offsets[i + 1])` of `values`, so that the output has
+ * `offsets.size() - 1` rows. The segments of the rows of a LIST column are given by its child and
+ * offsets columns, which avoids exploding the lists to reduce them with a groupby.
+ *
+ * With `null_policy::EXCLUDE`, the null values are skipped and the output row of a segment is null
+ * if the segment has no valid value. With `null_policy::INCLUDE`, the output row of a segment is
+ * null if the segment has a null value. The output row of an empty segment is always null.
+ *
+ * The supported aggregations are `sum`, `product`, `min`, `max`, `any`, `all` and
+ * `sum_of_squares`, with the input and output types supported by `reduce()`.
+ *
+ * @throws cudf::logic_error if `offsets` is not a non-nullable INT32 column.
+ * @throws cudf::logic_error if the aggregation is not supported.
+ * @throws cudf::logic_error if `values` is a STRING, LIST or DICTIONARY32 column.
+ * @throws cudf::logic_error if `values` type is not convertible to `output_dtype`.
+ * @throws cudf::logic_error if `output_dtype` is not BOOL8 for `any` and `all`.
+ *
+ * @param values Input column view
+ * @param offsets Offsets of the segments in `values`, in increasing order
+ * @param agg unique_ptr of the aggregation operator applied to each segment
+ * @param output_dtype The computation and output precision
+ * @param null_handling Whether the null values are skipped or make the result of their segment null
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @returns Column of the reduction of each segment
+ */
+std::unique_ptr<column> segmented_reduce(
+  column_view const &values,
+  column_view const &offsets,
+  std::unique_ptr<aggregation> const &agg,
+  data_type output_dtype,
+  null_policy null_handling,
+  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Computes the scan of a column.
  *
@@ -25,6 +25,14 @@ namespace cudf {
  * @{
  */
 
+/**
+ * @brief Policy to specify the position of replacement values relative to null rows
+ */
+enum class replace_policy : bool {
+  PRECEDING,  ///< Replace each null with the first valid value before it
+  FOLLOWING   ///< Replace each null with the first valid value after it
+};
+
 /**
  * @brief Replaces all null values in a column with corresponding values of another column
  *
@@ -60,6 +68,30 @@ std::unique_ptr<column> replace_nulls(
   scalar const& replacement,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Replaces all null values in a column with the first valid value before or after them
+ *
+ * With `replace_policy::PRECEDING`, each null is replaced with the nearest valid value before it
+ * (a forward fill). With `replace_policy::FOLLOWING`, each null is replaced with the nearest valid
+ * value after it (a backward fill). Nulls without a valid value in that direction stay null.
+ *
+ * @code{.pseudo}
+ * input     = {null, 1, null, null, 4, null}
+ * PRECEDING = {null, 1, 1, 1, 4, 4}
+ * FOLLOWING = {1, 1, 4, 4, 4, null}
+ * @endcode
+ *
+ * @param[in] input A column whose null values will be replaced
+ * @param[in] replace_policy Specify the position of the valid value relative to null value
+ * @param[in] mr Device memory resource used to allocate device memory of the returned column.
+ *
+ * @returns Copy of `input` with null values replaced based on `replace_policy`.
+ */
+std::unique_ptr<column> replace_nulls(
+  column_view const& input,
+  replace_policy const& replace_policy,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Replaces all NaN values in a column with corresponding values from another column
  *
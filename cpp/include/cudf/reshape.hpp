@@ -17,8 +17,10 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <memory>
+#include <vector>
 #include "cudf/types.hpp"
 
 namespace cudf {
@@ -68,5 +70,99 @@ std::unique_ptr<table> tile(table_view const& input,
                             size_type count,
                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Explodes a lists column, producing one row per element of its lists
+ *
+ * The column `explode_column_idx` of `input` is replaced by the column of the elements of its
+ * lists, and the rows of the other columns are repeated once per element of the list of their
+ * row. Rows whose list is null or empty produce no output rows.
+ *
+ * ```
+ * input  = [[5, 10, 15], [{1, 2}, {}, {3, null, 4}]]
+ * explode(input, 1)
+ * return = [[5, 5, 15, 15, 15], [1, 2, 3, null, 4]]
+ * ```
+ *
+ * @throws cudf::logic_error if `explode_column_idx` is not the index of a lists column
+ *
+ * @param input Table to explode
+ * @param explode_column_idx Index of the lists column to explode
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return The table with one row per element of the lists of the exploded column
+ */
+std::unique_ptr<table> explode(
+  table_view const& input,
+  size_type explode_column_idx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Explodes a lists column like `explode`, adding the position of each element in its list
+ *
+ * The output has one more column than `input`: the INT32 column of the zero-based position of
+ * each element in its list, inserted before the exploded column.
+ *
+ * ```
+ * input  = [[5, 10, 15], [{1, 2}, {}, {3, null, 4}]]
+ * explode_position(input, 1)
+ * return = [[5, 5, 15, 15, 15], [0, 1, 0, 1, 2], [1, 2, 3, null, 4]]
+ * ```
+ *
+ * @throws cudf::logic_error if `explode_column_idx` is not the index of a lists column
+ *
+ * @param input Table to explode
+ * @param explode_column_idx Index of the lists column to explode
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return The table with one row per element of the lists of the exploded column
+ */
+std::unique_ptr<table> explode_position(
+  table_view const& input,
+  size_type explode_column_idx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Converts a table of fixed-width columns into a column of packed rows
+ *
+ * Each row of the result is a list of the same number of INT8 bytes holding the fields of the
+ * row in column order. Each field is aligned to the size of its type, and is followed by the
+ * validity of the row: bit `i % 8` of byte `i / 8` is set if column `i` is valid. The row is
+ * padded to a multiple of 8 bytes, and padding bytes are zero. The bytes of a null field are
+ * unspecified.
+ *
+ * ```
+ * input  = [INT8 [1, 2], INT32 [3, null], INT16 [4, 5]]
+ * layout = INT8 at 0, INT32 at 4, INT16 at 8, validity byte at 10, 16 bytes per row
+ * ```
+ *
+ * @throws cudf::logic_error if a column of `input` is not fixed-width
+ * @throws cudf::logic_error if the size of the rows exceeds the column size limit
+ *
+ * @param input Table to convert
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return LIST column of INT8 with one list of bytes per row of `input`
+ */
+std::unique_ptr<column> convert_to_rows(
+  table_view const& input, rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Converts a column of packed rows back into a table, the inverse of `convert_to_rows`
+ *
+ * @throws cudf::logic_error if a type of `schema` is not fixed-width
+ * @throws cudf::logic_error if `input` is not a LIST column of INT8 with enough bytes for its
+ * rows with the layout of `schema`
+ *
+ * @param input Rows in the layout of `convert_to_rows`; every list must hold one row
+ * @param schema Types of the columns of the rows
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return Table with one column per type of `schema`
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
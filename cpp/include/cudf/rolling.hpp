@@ -42,6 +42,15 @@ namespace cudf {
  * The returned column for count aggregation always has `INT32` type. All other operators return a
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
+ * The other window functions are:
+ * - `ARGMIN` and `ARGMAX`: the `INT32` index in `input` of the first minimum or maximum element of
+ *   the window.
+ * - `VARIANCE` and `STD`: a `FLOAT64` column, null for the windows with `ddof` or fewer
+ *   observations.
+ * - `LEAD` and `LAG`: the element `offset` rows after or before element `i`, or null if that
+ *   element is outside of the window of element `i`. `min_periods` is ignored.
+ * - `COLLECT`: a list column holding the elements of each window, including nulls. The list of a
+ *   window with fewer than `min_periods` elements is null.
  *
  * @param[in] input_col The input column
  * @param[in] preceding_window The static rolling window size in the backward direction.
@@ -119,6 +128,8 @@ std::unique_ptr<column> rolling_window(
  * The returned column for `op == COUNT` always has `INT32` type. All other operators return a
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
+ * The other window functions (`ARGMIN`, `ARGMAX`, `VARIANCE`, `STD`, `LEAD`, `LAG` and `COLLECT`)
+ * are described in the fixed-size `rolling_window()`.
  *
  * @param[in] group_keys The (pre-sorted) grouping columns
  * @param[in] input The input column (to be aggregated)
@@ -209,6 +220,8 @@ std::unique_ptr<column> grouped_rolling_window(
  * The returned column for `op == COUNT` always has `INT32` type. All other operators return a
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
+ * The other window functions (`ARGMIN`, `ARGMAX`, `VARIANCE`, `STD`, `LEAD`, `LAG` and `COLLECT`)
+ * are described in the fixed-size `rolling_window()`.
  *
  * @param[in] group_keys The (pre-sorted) grouping columns
  * @param[in] timestamp_column The (pre-sorted) timestamps for each row
@@ -251,6 +264,8 @@ std::unique_ptr<column> grouped_time_range_rolling_window(
  * The returned column for count aggregation always has INT32 type. All other operators return a
  * column of the same type as the input. Therefore it is suggested to convert integer column types
  * (especially low-precision integers) to `FLOAT32` or `FLOAT64` before doing a rolling `MEAN`.
+ * The other window functions (`ARGMIN`, `ARGMAX`, `VARIANCE`, `STD`, `LEAD`, `LAG` and `COLLECT`)
+ * are described in the fixed-size `rolling_window()`.
  *
  * @throws cudf::logic_error if window column type is not INT32
  *
@@ -275,5 +290,78 @@ std::unique_ptr<column> rolling_window(
   std::unique_ptr<aggregation> const& agg,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief  Applies a fixed-size user-defined rolling window function to the rows of several
+ * columns.
+ *
+ * Like the fixed-size `rolling_window()` with a UDF aggregation, but the UDF aggregates the
+ * window of each row in each of the `inputs` columns. A CUDA UDF takes the output pointer, a
+ * pointer to each input column, and the start and size of the window:
+ *
+ * @code{.cpp}
+ * template <typename OutType, typename InType0, typename InType1>
+ * __device__ void CUDA_GENERIC_AGGREGATOR(OutType *ret, InType0 *in_col0, InType1 *in_col1,
+ *                                         cudf::size_type start, cudf::size_type count)
+ * @endcode
+ *
+ * A PTX UDF, such as a Numba function, takes an array argument per input column holding the
+ * window of that column. A UDF must only read the elements of the windows.
+ *
+ * @throws cudf::logic_error if `agg` is not a UDF aggregation
+ * @throws cudf::logic_error if `inputs` has no columns or more than 4 columns
+ * @throws cudf::logic_error if an input column has nulls or is not of a fixed-width type
+ *
+ * @param[in] inputs The input columns
+ * @param[in] preceding_window The static rolling window size in the backward direction.
+ * @param[in] following_window The static rolling window size in the forward direction.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] agg The UDF aggregation
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns   A nullable output column containing the rolling window results
+ */
+std::unique_ptr<column> rolling_window(
+  table_view const& inputs,
+  size_type preceding_window,
+  size_type following_window,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& agg,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Applies a variable-size user-defined rolling window function to the rows of several
+ * columns.
+ *
+ * The UDF is applied as in the fixed-size `rolling_window()` of several columns, with the
+ * window sizes of the variable-size `rolling_window()`.
+ *
+ * @throws cudf::logic_error if `agg` is not a UDF aggregation
+ * @throws cudf::logic_error if `inputs` has no columns or more than 4 columns
+ * @throws cudf::logic_error if an input column has nulls or is not of a fixed-width type
+ * @throws cudf::logic_error if window column type is not INT32
+ *
+ * @param[in] inputs The input columns
+ * @param[in] preceding_window A non-nullable column of INT32 window sizes in the forward direction.
+ *                             `preceding_window[i]` specifies preceding window size for
+ *                             element `i`.
+ * @param[in] following_window A non-nullable column of INT32 window sizes in the backward
+ *                             direction. `following_window[i]` specifies following window size
+ *                             for element `i`.
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] agg The UDF aggregation
+ * @param[in] mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns   A nullable output column containing the rolling window results
+ */
+std::unique_ptr<column> rolling_window(
+  table_view const& inputs,
+  column_view const& preceding_window,
+  column_view const& following_window,
+  size_type min_periods,
+  std::unique_ptr<aggregation> const& agg,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
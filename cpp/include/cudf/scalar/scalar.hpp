@@ -191,6 +191,24 @@ class fixed_width_scalar : public scalar {
       _data{std::forward<rmm::device_scalar<T>>(data)}
   {
   }
+
+  /**
+   * @brief Construct a new fixed width scalar object of a type carrying metadata
+   *
+   * @param value The initial value of the scalar
+   * @param type The type of the scalar, e.g., a fixed-point type with its scale
+   * @param is_valid Whether the value held by the scalar is valid
+   * @param stream CUDA stream used for device memory operations.
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  fixed_width_scalar(T value,
+                     data_type type,
+                     bool is_valid                       = true,
+                     cudaStream_t stream                 = 0,
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+    : scalar(type, is_valid, stream, mr), _data(value, stream, mr)
+  {
+  }
 };
 
 }  // namespace detail
@@ -243,6 +261,97 @@ class numeric_scalar : public detail::fixed_width_scalar<T> {
     : detail::fixed_width_scalar<T>(std::forward<rmm::device_scalar<T>>(data), is_valid, stream, mr)
   {
   }
+
+ protected:
+  /**
+   * @brief Construct a new numeric scalar object holding the representation of another type
+   *
+   * @param value The initial value of the scalar
+   * @param type The type of the scalar, whose storage type is `T`
+   * @param is_valid Whether the value held by the scalar is valid
+   * @param stream CUDA stream used for device memory operations.
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  numeric_scalar(T value,
+                 data_type type,
+                 bool is_valid                       = true,
+                 cudaStream_t stream                 = 0,
+                 rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+    : detail::fixed_width_scalar<T>(value, type, is_valid, stream, mr)
+  {
+  }
+};
+
+/**
+ * @brief An owning class to represent a fixed-point value in device memory
+ *
+ * The value is stored as its integer representation, the scale being held by the `data_type` of
+ * the scalar. A `fixed_point_scalar<T>` is a `numeric_scalar` of the representation type of `T`,
+ * like the type dispatcher handles fixed-point columns as columns of their representation type.
+ *
+ * @ingroup scalar_classes
+ *
+ * @tparam T the fixed-point type, `numeric::decimal32` or `numeric::decimal64`
+ */
+template <typename T>
+class fixed_point_scalar : public numeric_scalar<typename T::rep> {
+  static_assert(is_fixed_point<T>(), "Unexpected non-fixed-point type.");
+
+ public:
+  using rep_type = typename T::rep;
+
+  fixed_point_scalar()                                = delete;
+  ~fixed_point_scalar()                               = default;
+  fixed_point_scalar(fixed_point_scalar&& other)      = default;
+  fixed_point_scalar(fixed_point_scalar const& other) = default;
+  fixed_point_scalar& operator=(fixed_point_scalar const& other) = delete;
+  fixed_point_scalar& operator=(fixed_point_scalar&& other) = delete;
+
+  /**
+   * @brief Construct a new fixed-point scalar object from its representation
+   *
+   * @param value The integer representation of the value
+   * @param scale The scale of the value
+   * @param is_valid Whether the value held by the scalar is valid
+   * @param stream CUDA stream used for device memory operations.
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  fixed_point_scalar(rep_type value,
+                     numeric::scale_type scale,
+                     bool is_valid                       = true,
+                     cudaStream_t stream                 = 0,
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+    : numeric_scalar<rep_type>(
+        value, data_type{type_to_id<T>(), static_cast<int32_t>(scale)}, is_valid, stream, mr)
+  {
+  }
+
+  /**
+   * @brief Construct a new fixed-point scalar object
+   *
+   * @param value The initial value of the scalar
+   * @param is_valid Whether the value held by the scalar is valid
+   * @param stream CUDA stream used for device memory operations.
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  fixed_point_scalar(T value,
+                     bool is_valid                       = true,
+                     cudaStream_t stream                 = 0,
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+    : fixed_point_scalar(value.value(), value.scale(), is_valid, stream, mr)
+  {
+  }
+
+  /**
+   * @brief Get the value of the scalar as a fixed-point number
+   *
+   * @param stream CUDA stream used for device memory operations.
+   */
+  T fixed_point_value(cudaStream_t stream = 0) const
+  {
+    using namespace numeric;
+    return T{scaled_integer<rep_type>{this->value(stream), scale_type{this->type().scale()}}};
+  }
 };
 
 /**
@@ -167,5 +167,155 @@ std::unique_ptr<column> contains(
   column_view const& needles,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Sorted table prepared for repeated `lower_bound` and `upper_bound` searches.
+ *
+ * `cudf::lower_bound` and `cudf::upper_bound` upload the sort order of the table and build its
+ * device view on every call, and search with one binary search per value, each step of which is
+ * a random read. When the same sorted table is searched with many batches of values, as in
+ * time-bucketing or as-of joins, constructing a `search_index` once amortizes this work.
+ *
+ * When the table has a single key column without nulls of an integral, timestamp or duration
+ * type, the index holds a copy of the keys in Eytzinger layout, where the children of element
+ * `k` are the elements `2k` and `2k + 1`. The first levels of the search tree then share a few
+ * cache lines that stay cached across the values, and the search is branch-free. This copy uses
+ * up to twice the size of the key column. Other tables and values with nulls use the generic row
+ * comparator on the table itself.
+ *
+ * The table must outlive the index, and must not be modified while the index is in use.
+ */
+class search_index {
+ public:
+  search_index() = delete;
+  ~search_index();
+  search_index(search_index const&) = delete;
+  search_index(search_index&&)      = delete;
+  search_index& operator=(search_index const&) = delete;
+  search_index& operator=(search_index&&) = delete;
+
+  /**
+   * @brief Prepares a sorted table for searches.
+   *
+   * @throws cudf::logic_error if `column_order` or `null_precedence` is not empty and its size
+   * differs from the number of columns of `t`
+   *
+   * @param t               Sorted table to search
+   * @param column_order    Vector of column sort order
+   * @param null_precedence Vector of null_precedence enums values
+   * @param stream          CUDA stream used for device memory operations and kernel launches
+   */
+  search_index(table_view const& t,
+               std::vector<order> const& column_order,
+               std::vector<null_order> const& null_precedence,
+               cudaStream_t stream = 0);
+
+  /**
+   * @brief Find smallest indices in the table where values should be inserted to maintain
+   * order.
+   *
+   * Returns the same result as `cudf::lower_bound` on the table of the index.
+   *
+   * @param values Find insert locations for these values
+   * @param mr     Device memory resource used to allocate the returned column's device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return A non-nullable column of cudf::size_type elements containing the insertion points.
+   */
+  std::unique_ptr<column> lower_bound(
+    table_view const& values,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+  /**
+   * @brief Find largest indices in the table where values should be inserted to maintain
+   * order.
+   *
+   * Returns the same result as `cudf::upper_bound` on the table of the index.
+   *
+   * @param values Find insert locations for these values
+   * @param mr     Device memory resource used to allocate the returned column's device memory
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return A non-nullable column of cudf::size_type elements containing the insertion points.
+   */
+  std::unique_ptr<column> upper_bound(
+    table_view const& values,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+    cudaStream_t stream                 = 0) const;
+
+ private:
+  struct search_index_impl;
+  const std::unique_ptr<const search_index_impl> impl;
+};
+
+/**
+ * @brief The side of the bins of `bucketize()` and `histogram()` that includes its edge
+ */
+enum class closed_side : bool {
+  LEFT,  ///< Bin `i` holds the values in `[bin_edges[i], bin_edges[i + 1])`
+  RIGHT  ///< Bin `i` holds the values in `(bin_edges[i], bin_edges[i + 1]]`
+};
+
+/**
+ * @brief Returns the index of the bin of each element of a column
+ *
+ * The `n` sorted edges of `bin_edges` delimit `n - 1` bins. Element `i` of the result is the
+ * index of the bin holding `input[i]`, or null if `input[i]` is null, NaN or outside of the
+ * bins.
+ *
+ * @code{.pseudo}
+ *   input     = { 1, 10, 15, 20, 25, null }
+ *   bin_edges = { 0, 10, 20 }
+ *
+ *   bucketize(input, bin_edges, closed_side::LEFT)  = { 0, 1, 1, null, null, null }
+ *   bucketize(input, bin_edges, closed_side::RIGHT) = { 0, 0, 1, 1, null, null }
+ * @endcode
+ *
+ * Each element is located with one binary search of the edges, which is faster than
+ * `lower_bound()` for few edges.
+ *
+ * @throws cudf::logic_error if `input` and `bin_edges` have different types
+ * @throws cudf::logic_error if the type is not numeric, timestamp or duration
+ * @throws cudf::logic_error if `bin_edges` has nulls or fewer than 2 edges
+ *
+ * @param input Column of the values to bin
+ * @param bin_edges Ascending, non-null column of the edges of the bins
+ * @param closed The side of the bins that includes its edge
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A nullable `INT32` column of the bin of each element of `input`
+ */
+std::unique_ptr<column> bucketize(
+  column_view const& input,
+  column_view const& bin_edges,
+  closed_side closed,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Counts the elements of a column in each bin delimited by `bin_edges`
+ *
+ * Equivalent to counting the rows of each bin of `bucketize(input, bin_edges, closed)`, without
+ * materializing the bins. The null elements and those outside of the bins are not counted.
+ *
+ * @code{.pseudo}
+ *   input     = { 1, 10, 15, 20, 25, null }
+ *   bin_edges = { 0, 10, 20 }
+ *
+ *   histogram(input, bin_edges) = { 1, 2 }
+ * @endcode
+ *
+ * @throws cudf::logic_error if `input` and `bin_edges` have different types
+ * @throws cudf::logic_error if the type is not numeric, timestamp or duration
+ * @throws cudf::logic_error if `bin_edges` has nulls or fewer than 2 edges
+ *
+ * @param input Column of the values to count
+ * @param bin_edges Ascending, non-null column of the edges of the bins
+ * @param closed The side of the bins that includes its edge
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable `INT64` column of `bin_edges.size() - 1` counts
+ */
+std::unique_ptr<column> histogram(
+  column_view const& input,
+  column_view const& bin_edges,
+  closed_side closed                  = closed_side::LEFT,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace comms {
+/**
+ * @addtogroup comms_shuffle
+ * @{
+ */
+
+/**
+ * @brief Transport used by the ranks of a group of GPUs to exchange table partitions
+ *
+ * Every rank of the group owns one communicator, and all ranks call the exchanges in the same
+ * order. Implementations wrap a transport such as NCCL, UCX or peer-to-peer copies between the
+ * devices of a process; libcudf provides the latter with `make_peer_communicators()`.
+ */
+class communicator {
+ public:
+  virtual ~communicator() = default;
+
+  /**
+   * @brief Returns the index of this rank in the group
+   */
+  virtual int rank() const = 0;
+
+  /**
+   * @brief Returns the number of ranks in the group
+   */
+  virtual int size() const = 0;
+
+  /**
+   * @brief Sends one host message to every rank and receives one from every rank
+   *
+   * @param send Message for each rank, `send[r]` being sent to rank `r`. Size must be `size()`.
+   * @return The message received from each rank, indexed by the sending rank
+   */
+  virtual std::vector<std::vector<uint8_t>> all_to_all(
+    std::vector<std::vector<uint8_t>> const& send) = 0;
+
+  /**
+   * @brief Sends one device buffer to every rank and receives one from every rank
+   *
+   * The sizes of the received buffers must have been agreed upon beforehand, typically with the
+   * host `all_to_all`. The data of `send` must be complete when the call is made; the received
+   * data is ready once the work queued on `stream` completes.
+   *
+   * @param send Device buffer for each rank, `send[r]` being sent to rank `r`
+   * @param send_sizes Size in bytes of each buffer of `send`
+   * @param recv Device buffer receiving the data of each rank, indexed by the sending rank
+   * @param recv_sizes Size in bytes of each buffer of `recv`
+   * @param stream CUDA stream of this rank's device used for the copies
+   */
+  virtual void all_to_all(std::vector<void const*> const& send,
+                          std::vector<size_t> const& send_sizes,
+                          std::vector<void*> const& recv,
+                          std::vector<size_t> const& recv_sizes,
+                          cudaStream_t stream) = 0;
+};
+
+/**
+ * @brief Creates the communicators of a group of ranks driven by the threads of this process
+ *
+ * Rank `r` runs on device `devices[r]` and must be driven by its own thread. Device buffers are
+ * copied with `cudaMemcpyPeerAsync`, over NVLink where the devices are connected by it. A device
+ * may back several ranks.
+ *
+ * @param devices Device of each rank
+ * @return The communicator of each rank
+ */
+std::vector<std::unique_ptr<communicator>> make_peer_communicators(std::vector<int> const& devices);
+
+/**
+ * @brief Redistributes the rows of a table partitioned across the ranks of a group so that all
+ * rows with equal keys end up on the same rank
+ *
+ * Each rank hash partitions its rows into one packed partition per rank with
+ * `hash_partition_and_pack`, exchanges the sizes and metadata of the partitions with a host
+ * all-to-all and the partitions themselves with a device all-to-all, and concatenates the
+ * partitions it received. Every rank of the group must call `shuffle` with tables of the same
+ * schema and the same `columns_to_hash`.
+ *
+ * @throw std::out_of_range if an index of `columns_to_hash` is invalid
+ * @throw cudf::logic_error if `input` has a column that is neither fixed-width nor strings
+ *
+ * @param input The rows held by this rank
+ * @param columns_to_hash Indices of the columns whose values decide the rank of each row
+ * @param comm Communicator of this rank
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream of this rank's device used for device memory operations and kernel
+ * launches
+ * @return The rows of all ranks whose keys hash to this rank, in the order of the sending ranks
+ */
+std::unique_ptr<table> shuffle(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  communicator& comm,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0);
+
+/** @} */  // end of group
+}  // namespace comms
+}  // namespace cudf
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/types.hpp>
+#include <cudf/utilities/memory_estimate.hpp>
 
 #include <memory>
 #include <vector>
@@ -52,6 +53,7 @@ enum class rank_method {
  * for each column.  Size must be equal to `input.num_columns()` or empty.
  * If empty, all columns will be sorted in `null_order::BEFORE`.
  * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @return A non-nullable column of `size_type` elements containing the permuted row indices of
  * `input` if it were sorted
  */
@@ -59,7 +61,8 @@ std::unique_ptr<column> sorted_order(
   table_view input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
-  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
 
 /**
  * @brief Computes the row indices that would produce `input` in a stable
@@ -73,7 +76,41 @@ std::unique_ptr<column> stable_sorted_order(
   table_view input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
-  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
+
+/**
+ * @brief Computes the row indices of the first `k` rows of `keys` in
+ * lexicographical sorted order, without sorting all rows.
+ *
+ * The result is the first `k` rows of `stable_sorted_order(keys, column_order,
+ * null_precedence)`. When the first column of `keys` is numeric, timestamp or
+ * duration, its `k`-th value is found by radix select and only the rows up to
+ * it are sorted; otherwise all rows are sorted.
+ *
+ * @throw cudf::logic_error if `k` is negative
+ *
+ * @param keys The table to order
+ * @param k Number of rows to return. All rows are returned if `k` is larger
+ * than `keys.num_rows()`.
+ * @param column_order The desired sort order for each column. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns will be sorted
+ * in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column.  Size must be equal to `keys.num_columns()` or empty.
+ * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return A non-nullable column of `min(k, keys.num_rows())` `size_type` row
+ * indices of `keys` in sorted order
+ */
+std::unique_ptr<column> top_k(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
 
 /**
  * @brief Checks whether the rows of a `table` are sorted in a lexicographical
@@ -88,12 +125,14 @@ std::unique_ptr<column> stable_sorted_order(
  *                              elements for each column. Size must be equal to
  *                              `input.num_columns()` or empty. If empty,
  *                              `null_order::BEFORE` is assumed for all columns.
+ * @param[in] stream            CUDA stream used for device memory operations and kernel launches
  *
  * @returns bool                true if sorted as expected, false if not.
  */
 bool is_sorted(cudf::table_view const& table,
                std::vector<order> const& column_order,
-               std::vector<null_order> const& null_precedence);
+               std::vector<null_order> const& null_precedence,
+               cudaStream_t stream = 0);
 
 /**
  * @brief Performs a lexicographic sort of the rows of a table
@@ -107,12 +146,14 @@ bool is_sorted(cudf::table_view const& table,
  * `input.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
  * @param mr Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @return New table containing the desired sorted order of `input`
  */
 std::unique_ptr<table> sort(table_view input,
                             std::vector<order> const& column_order         = {},
                             std::vector<null_order> const& null_precedence = {},
-                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+                            rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                            cudaStream_t stream                 = 0);
 
 /**
  * @brief Performs a key-value sort.
@@ -132,6 +173,7 @@ std::unique_ptr<table> sort(table_view input,
  * `keys.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
  * @param mr Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @return The reordering of `values` determined by the lexicographic order of
  * the rows of `keys`.
  */
@@ -140,7 +182,24 @@ std::unique_ptr<table> sort_by_key(
   table_view const& keys,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
-  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource());
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_default_resource(),
+  cudaStream_t stream                            = 0);
+
+/**
+ * @brief Estimates the device memory used by `sort_by_key(values, keys)`, or by `sort(values)`
+ * when `keys` is `values`, without reading their data
+ *
+ * The output is the reordered `values`. The scratch memory is the sorted order of the keys and the
+ * temporaries of the sort the keys dispatch to: radix sorts of fixed-width keys and of the
+ * prefixes of a strings key, or a comparison sort otherwise.
+ *
+ * @throws cudf::logic_error if `values.num_rows() != keys.num_rows()`.
+ *
+ * @param values The table to reorder
+ * @param keys The table that determines the ordering
+ * @return The estimated output and peak scratch bytes of the sort
+ */
+memory_estimate estimate_sort_memory(table_view const& values, table_view const& keys);
 
 /**
  * @brief Computes the ranks of input column in sorted order.
@@ -167,6 +226,7 @@ std::unique_ptr<table> sort_by_key(
  * for column
  * @param percentage flag to convert ranks to percentage in range (0,1}
  * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @return std::unique_ptr<column> A column of containing the rank of the each
  * element of the column of `input`. The output column type will be `size_type`
  * column by default or else `double` when `method=rank_method::AVERAGE` or
@@ -178,7 +238,8 @@ std::unique_ptr<column> rank(column_view const& input,
                              null_policy null_handling,
                              null_order null_precedence,
                              bool percentage,
-                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+                             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                             cudaStream_t stream                 = 0);
 
 /** @} */  // end of group
 }  // namespace cudf
@@ -239,6 +239,63 @@ std::unique_ptr<table> drop_duplicates(
   null_equality nulls_equal           = null_equality::EQUAL,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Create a new table with one row of each set of rows with equal `keys` columns
+ *
+ * Unlike `drop_duplicates`, the rows are found with a hash set instead of by sorting the keys,
+ * which is faster and needs less temporary memory. Which row of a set of duplicates is kept is
+ * unspecified, and the output rows are in their order in `input`.
+ *
+ * ```
+ * input = { {1, 3, 1, 2, 3}, {"a", "b", "c", "d", "e"} }
+ * keys  = {0}
+ * distinct(input, keys) = { {1, 3, 2}, {"a", "b", "d"} }
+ *                      or { {3, 1, 2}, {"b", "c", "d"} }, ...
+ * ```
+ *
+ * @param[in] input           input table_view to copy only distinct rows
+ * @param[in] keys            vector of indices representing key columns from `input`
+ * @param[in] nulls_equal     flag to denote nulls are equal if null_equality::EQUAL,
+ * nulls are not equal if null_equality::UNEQUAL
+ * @param[in] mr              Device memory resource used to allocate the returned table's device
+ * memory
+ *
+ * @return Table with distinct rows
+ */
+std::unique_ptr<table> distinct(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Create a new table with one row of each set of rows with equal `keys` columns, from
+ * the precomputed hash values of the keys
+ *
+ * Finds the rows like `distinct(input, keys, nulls_equal)`, but saves hashing the keys again
+ * when they were already hashed, e.g. to hash partition them. The hashes may come from any
+ * function, e.g. `cudf::hash`.
+ *
+ * @throw cudf::logic_error if `key_hashes` is not a non-nullable column of 32- or 64-bit
+ * integers with one row per row of `input`
+ *
+ * @param[in] input           input table_view to copy only distinct rows
+ * @param[in] keys            vector of indices representing key columns from `input`
+ * @param[in] key_hashes      The hash value of the `keys` columns of each row of `input`
+ * @param[in] nulls_equal     flag to denote nulls are equal if null_equality::EQUAL,
+ * nulls are not equal if null_equality::UNEQUAL
+ * @param[in] mr              Device memory resource used to allocate the returned table's device
+ * memory
+ *
+ * @return Table with distinct rows
+ */
+std::unique_ptr<table> distinct(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  column_view const& key_hashes,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Count the unique elements in the column_view
  *
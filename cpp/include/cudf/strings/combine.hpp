@@ -156,6 +156,47 @@ std::unique_ptr<column> concatenate(
   string_scalar const& col_narep       = string_scalar("", false),
   rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource());
 
+/**
+ * @brief Concatenates a list of strings columns using separators for each row
+ * and a replacement string for the nulls of each column.
+ *
+ * This is the same as the concatenate with a separators column above, except that the null
+ * strings of column `i` are replaced by `col_nareps[i]`. The null strings of a column whose
+ * entry of @p col_nareps is null are skipped, along with their separator.
+ *
+ * @code{.pseudo}
+ * Example:
+ * c0     = ['aa', null, '',  null]
+ * c1     = [null, 'cc', 'dd', null]
+ * sep    = ['::', '%%', null, '!']
+ * nareps = ['~', null]
+ * out    = concatenate([c0, c1], sep, nareps)
+ * out is ['aa', '~%%cc', null, '~']
+ * @endcode
+ *
+ * @throw cudf::logic_error if no input columns are specified - table view is empty
+ * @throw cudf::logic_error if input columns are not all strings columns.
+ * @throw cudf::logic_error if the number of rows from @p separators and @p strings_columns
+ *                          do not match
+ * @throw cudf::logic_error if the size of @p col_nareps is not the number of columns of
+ *                          @p strings_columns
+ *
+ * @param strings_columns List of strings columns to concatenate.
+ * @param separators Strings column that provides the separator for a given row
+ * @param col_nareps Strings column that provides the replacement of the null strings of each
+ *        column of @p strings_columns; a null entry means no replacement for that column.
+ * @param separator_narep String that should be used in place of a null separator for a given
+ *        row. Default of invalid-scalar means no row separator value replacements.
+ * @param mr Resource for allocating device memory.
+ * @return New column with concatenated results.
+ */
+std::unique_ptr<column> concatenate(
+  table_view const& strings_columns,
+  strings_column_view const& separators,
+  strings_column_view const& col_nareps,
+  string_scalar const& separator_narep = string_scalar("", false),
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 namespace cudf {
 namespace strings {
@@ -50,6 +51,34 @@ std::unique_ptr<column> contains_re(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a table of boolean columns identifying rows which
+ * match each of the given regex patterns.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abc","123","def456"]
+ * r = contains_re(s,["\\d+","^[a-z]"])
+ * r is now [[false, true, true], [true, false, true]]
+ * @endcode
+ *
+ * Each string is read once and evaluated against every pattern, which is faster
+ * than calling `contains_re` for each pattern.
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * See the @ref md_regex "Regex Features" page for details on patterns supported by this API.
+ *
+ * @param strings Strings instance for this operation.
+ * @param patterns Regex patterns to match to each string.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return New table with a column of boolean results for each pattern.
+ */
+std::unique_ptr<table> contains_re(
+  strings_column_view const& strings,
+  std::vector<std::string> const& patterns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Returns a boolean column identifying rows which
  * matching the given regex pattern but only at the beginning the string.
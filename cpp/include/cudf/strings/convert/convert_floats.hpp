@@ -46,6 +46,40 @@ std::unique_ptr<column> to_floats(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a new numeric column by parsing float values from each string
+ * in the provided strings column and optionally setting malformed strings to null.
+ *
+ * Any null entries will result in corresponding null entries in the output column.
+ *
+ * A well-formed string has an optional '-' or '+' prefix, one or more characters
+ * [0-9] with an optional decimal '.' and an optional exponent (e.g. "-1.78e+5").
+ * The strings "NaN", "Inf" and "-Inf" are also well-formed.
+ * If `invalid_as_null` is true, any other string results in a null entry.
+ * Otherwise, the strings are converted as in to_floats(strings_column_view const&,
+ * data_type,rmm::mr::device_memory_resource*).
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ['1.5', '-2e3', '1.5.3', '', 'NaN']
+ * r = to_floats(s, FLOAT64, true)
+ * r is [1.5, -2000, null, null, NaN]
+ * @endcode
+ *
+ * @throw cudf::logic_error if output_type is not float type.
+ *
+ * @param strings Strings instance for this operation.
+ * @param output_type Type of float numeric column to return.
+ * @param invalid_as_null Set entries of malformed strings to null.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New column with floats converted from strings.
+ */
+std::unique_ptr<column> to_floats(
+  strings_column_view const& strings,
+  data_type output_type,
+  bool invalid_as_null,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Returns a new strings column converting the float values from the
  * provided column into strings.
@@ -53,6 +53,39 @@ std::unique_ptr<column> to_integers(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a new integer numeric column parsing integer values from the
+ * provided strings column and optionally setting malformed strings to null.
+ *
+ * Any null entries will result in corresponding null entries in the output column.
+ *
+ * A well-formed string has an optional '-' or '+' prefix followed by one or more
+ * characters [0-9] only, and its value fits in the `output_type`.
+ * If `invalid_as_null` is true, any other string results in a null entry.
+ * Otherwise, the strings are converted as in to_integers(strings_column_view const&,
+ * data_type,rmm::mr::device_memory_resource*).
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ['123', '-45', '12a', '', '300']
+ * r = to_integers(s, INT8, true)
+ * r is [123, -45, null, null, null]
+ * @endcode
+ *
+ * @throw cudf::logic_error if output_type is not integral type.
+ *
+ * @param strings Strings instance for this operation.
+ * @param output_type Type of integer numeric column to return.
+ * @param invalid_as_null Set entries of malformed strings to null.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New column with integers converted from strings.
+ */
+std::unique_ptr<column> to_integers(
+  strings_column_view const& strings,
+  data_type output_type,
+  bool invalid_as_null,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Returns a new strings column converting the integer values from the
  * provided column into strings.
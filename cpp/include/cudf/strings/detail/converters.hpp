@@ -24,12 +24,13 @@ namespace strings {
 namespace detail {
 
 /**
- * @copydoc to_integers(strings_column_view const&,data_type,rmm::mr::device_memory_resource*)
+ * @copydoc to_integers(strings_column_view const&,data_type,bool,rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<column> to_integers(strings_column_view const& strings,
                                     data_type output_type,
+                                    bool invalid_as_null,
                                     cudaStream_t stream,
                                     rmm::mr::device_memory_resource* mr);
 
@@ -43,12 +44,13 @@ std::unique_ptr<column> from_integers(column_view const& integers,
                                       rmm::mr::device_memory_resource* mr);
 
 /**
- * @copydoc to_floats(strings_column_view const&,data_type,rmm::mr::device_memory_resource*)
+ * @copydoc to_floats(strings_column_view const&,data_type,bool,rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 std::unique_ptr<column> to_floats(strings_column_view const& strings,
                                   data_type output_type,
+                                  bool invalid_as_null,
                                   cudaStream_t stream,
                                   rmm::mr::device_memory_resource* mr);
 
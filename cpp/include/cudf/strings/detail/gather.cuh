@@ -18,6 +18,8 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
@@ -33,6 +35,50 @@ constexpr inline bool is_signed_iterator()
 
 namespace strings {
 namespace detail {
+/**
+ * @brief Copies the chars of the gathered strings, one warp per string
+ *
+ * The lanes of a warp copy consecutive bytes of the string, so that the loads and stores of long
+ * strings coalesce instead of being serialized in one thread.
+ *
+ * @tparam NullifyOutOfBounds If true, indices outside the column's range are skipped.
+ * @tparam MapIterator Iterator for retrieving integer indices of the column.
+ *
+ * @param d_strings The strings column to gather from
+ * @param map_begin Start of index iterator
+ * @param output_count Number of strings to gather
+ * @param d_offsets Offsets of the output strings
+ * @param d_chars Chars of the output strings
+ */
+template <bool NullifyOutOfBounds, typename MapIterator>
+__global__ void gather_chars_kernel(column_device_view d_strings,
+                                    MapIterator map_begin,
+                                    size_type output_count,
+                                    int32_t const* __restrict__ d_offsets,
+                                    char* __restrict__ d_chars)
+{
+  auto const lane          = threadIdx.x % cudf::detail::warp_size;
+  auto const warp_stride   = (blockDim.x * gridDim.x) / cudf::detail::warp_size;
+  auto const strings_count = d_strings.size();
+  for (size_type idx = (threadIdx.x + blockIdx.x * blockDim.x) / cudf::detail::warp_size;
+       idx < output_count;
+       idx += warp_stride) {
+    auto const index = map_begin[idx];
+    if (NullifyOutOfBounds) {
+      if (is_signed_iterator<MapIterator>() ? ((index < 0) || (index >= strings_count))
+                                            : (index >= strings_count))
+        continue;
+    }
+    if (d_strings.is_null(index)) continue;
+    auto const d_str = d_strings.element<string_view>(index);
+    auto const in    = d_str.data();
+    auto const out   = d_chars + d_offsets[idx];
+    for (size_type i = lane; i < d_str.size_bytes(); i += cudf::detail::warp_size) {
+      out[i] = in[i];
+    }
+  }
+}
+
 /**
  * @brief Returns a new strings column using the specified indices to select
  * elements from the `strings` column.
@@ -90,20 +136,14 @@ std::unique_ptr<cudf::column> gather(
   auto chars_view   = chars_column->mutable_view();
   auto d_chars      = chars_view.template data<char>();
   // fill in chars
-  auto gather_chars =
-    [d_strings, begin, strings_count, d_offsets, d_chars] __device__(size_type idx) {
-      auto index = begin[idx];
-      if (NullifyOutOfBounds) {
-        if (is_signed_iterator<MapIterator>() ? ((index < 0) || (index >= strings_count))
-                                              : (index >= strings_count))
-          return;
-      }
-      if (d_strings.is_null(index)) return;
-      string_view d_str = d_strings.element<string_view>(index);
-      memcpy(d_chars + d_offsets[idx], d_str.data(), d_str.size_bytes());
-    };
-  thrust::for_each_n(
-    execpol->on(stream), thrust::make_counting_iterator<size_type>(0), output_count, gather_chars);
+  if (bytes > 0) {
+    constexpr int block_size      = 256;
+    constexpr int warps_per_block = block_size / cudf::detail::warp_size;
+    auto const num_blocks =
+      cudf::util::div_rounding_up_safe<size_type>(output_count, warps_per_block);
+    gather_chars_kernel<NullifyOutOfBounds><<<num_blocks, block_size, 0, stream>>>(
+      d_strings, begin, output_count, d_offsets, d_chars);
+  }
 
   return make_strings_column(output_count,
                              std::move(offsets_column),
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/inline_strings.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+
+#include <limits>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+/**
+ * @copydoc to_inline_strings(strings_column_view const&,rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<inline_strings> to_inline_strings(strings_column_view const& strings,
+                                                  cudaStream_t stream,
+                                                  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc from_inline_strings(inline_strings const&,rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> from_inline_strings(inline_strings const& strings,
+                                            cudaStream_t stream,
+                                            rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Returns the length and prefix of a view as one word
+ *
+ * Two strings with different head words are different.
+ */
+__device__ inline uint64_t head_word(inline_string const& view)
+{
+  return *reinterpret_cast<uint64_t const*>(&view);
+}
+
+/**
+ * @brief Returns the prefix of a view as an integer ordered like the prefix bytes
+ */
+__device__ inline uint32_t prefix_key(inline_string const& view)
+{
+  return __byte_perm(*reinterpret_cast<uint32_t const*>(view.prefix), 0, 0x0123);
+}
+
+/**
+ * @brief Non-owning device view of an `inline_strings` set
+ */
+struct inline_strings_device_view {
+  inline_string const* views;
+  char const* data;
+  bitmask_type const* null_mask;
+
+  explicit inline_strings_device_view(inline_strings const& strings)
+    : views(strings.views()), data(strings.data()), null_mask(strings.null_mask())
+  {
+  }
+
+  __device__ bool is_null(size_type idx) const
+  {
+    return null_mask != nullptr && not bit_is_set(null_mask, idx);
+  }
+
+  /**
+   * @brief Returns the string of a row
+   *
+   * The string of an inline view is read from the view, whose prefix and suffix are contiguous.
+   */
+  __device__ string_view element(size_type idx) const
+  {
+    auto const& view = views[idx];
+    return view.is_inline() ? string_view(view.prefix, view.length)
+                            : string_view(data + view.offset, view.length);
+  }
+};
+
+/**
+ * @brief Compares the strings of two rows, which may belong to different sets
+ *
+ * The prefixes decide the order of most pairs of different strings without reading the data
+ * buffers.
+ *
+ * @return Negative, zero or positive if the left string is less than, equal to or greater than
+ * the right string
+ */
+__device__ inline int compare(inline_strings_device_view const& lhs,
+                              size_type lhs_idx,
+                              inline_strings_device_view const& rhs,
+                              size_type rhs_idx)
+{
+  auto const lhs_key = prefix_key(lhs.views[lhs_idx]);
+  auto const rhs_key = prefix_key(rhs.views[rhs_idx]);
+  // Zero padding orders a prefix before its extensions, so differing keys decide the order
+  if (lhs_key != rhs_key) { return lhs_key < rhs_key ? -1 : 1; }
+  return lhs.element(lhs_idx).compare(rhs.element(rhs_idx));
+}
+
+/**
+ * @brief Returns true if the strings of two rows are equal
+ *
+ * Strings with a different length or prefix are rejected from the head words alone, and inline
+ * strings are compared without reading the data buffers.
+ */
+__device__ inline bool equal(inline_strings_device_view const& lhs,
+                             size_type lhs_idx,
+                             inline_strings_device_view const& rhs,
+                             size_type rhs_idx)
+{
+  auto const& lhs_view = lhs.views[lhs_idx];
+  auto const& rhs_view = rhs.views[rhs_idx];
+  if (head_word(lhs_view) != head_word(rhs_view)) { return false; }
+  if (lhs_view.is_inline()) {
+    return *reinterpret_cast<uint64_t const*>(lhs_view.suffix) ==
+           *reinterpret_cast<uint64_t const*>(rhs_view.suffix);
+  }
+  return lhs.element(lhs_idx) == rhs.element(rhs_idx);
+}
+
+/**
+ * @brief Row comparator ordering the rows of an `inline_strings` set, for sorting row indices
+ */
+struct inline_strings_less {
+  inline_strings_device_view d_strings;
+  order column_order         = order::ASCENDING;
+  null_order null_precedence = null_order::BEFORE;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    auto const lhs_null = d_strings.is_null(lhs);
+    auto const rhs_null = d_strings.is_null(rhs);
+    if (lhs_null or rhs_null) {
+      if (lhs_null and rhs_null) { return false; }
+      return lhs_null == (null_precedence == null_order::BEFORE);
+    }
+    auto const result = compare(d_strings, lhs, d_strings, rhs);
+    return column_order == order::ASCENDING ? result < 0 : result > 0;
+  }
+};
+
+/**
+ * @brief Row equality of two `inline_strings` sets, for joins and groupby
+ */
+struct inline_strings_equal {
+  inline_strings_device_view lhs;
+  inline_strings_device_view rhs;
+  bool nulls_are_equal = true;
+
+  __device__ bool operator()(size_type lhs_idx, size_type rhs_idx) const
+  {
+    auto const lhs_null = lhs.is_null(lhs_idx);
+    auto const rhs_null = rhs.is_null(rhs_idx);
+    if (lhs_null or rhs_null) { return nulls_are_equal and lhs_null and rhs_null; }
+    return equal(lhs, lhs_idx, rhs, rhs_idx);
+  }
+};
+
+/**
+ * @brief Row hasher of an `inline_strings` set
+ *
+ * The hashes are the same as the hashes of the strings column rows, so that hashes from both
+ * representations can be mixed.
+ */
+struct inline_strings_hasher {
+  inline_strings_device_view d_strings;
+
+  __device__ hash_value_type operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) { return std::numeric_limits<hash_value_type>::max(); }
+    return MurmurHash3_32<string_view>{}(d_strings.element(idx));
+  }
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
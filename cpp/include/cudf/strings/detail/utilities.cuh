@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,10 +17,19 @@
 
 #include <cuda_runtime.h>
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
 
+#include <rmm/device_buffer.hpp>
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/partition.h>
 #include <thrust/scan.h>
+#include <limits>
 #include <mutex>
 #include <unordered_map>
 
@@ -62,6 +71,220 @@ std::unique_ptr<column> make_offsets_child_column(
   return offsets_column;
 }
 
+/**
+ * @brief Strings of at least this many bytes are processed by a warp per string
+ * rather than a thread per string.
+ */
+constexpr size_type LONG_STRING_THRESHOLD{256};
+
+/**
+ * @brief Row indices of a strings column split by the byte length of each string.
+ */
+struct string_length_bins {
+  rmm::device_vector<size_type> short_rows;  ///< null rows and rows below the threshold
+  rmm::device_vector<size_type> long_rows;   ///< rows with at least threshold bytes
+};
+
+/**
+ * @brief Returns true for a valid string of at least `threshold` bytes.
+ */
+struct is_long_string_fn {
+  column_device_view const d_strings;
+  size_type const threshold;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    return d_strings.is_valid(idx) &&
+           d_strings.element<string_view>(idx).size_bytes() >= threshold;
+  }
+};
+
+/**
+ * @brief Splits the rows of a strings column into short and long strings so that
+ * each set can be processed by a kernel suited to its length.
+ *
+ * Heavy-tailed length distributions leave most threads of a thread-per-string kernel
+ * idle while a few lanes scan long strings. The long rows returned here are meant to
+ * be processed cooperatively, e.g. by a warp per string.
+ *
+ * Both sets of rows keep their relative order.
+ *
+ * @param d_strings Strings column to split.
+ * @param threshold Strings with at least this many bytes are considered long.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The short and long row indices.
+ */
+inline string_length_bins bin_strings_by_length(column_device_view const& d_strings,
+                                                size_type threshold = LONG_STRING_THRESHOLD,
+                                                cudaStream_t stream = 0)
+{
+  auto const strings_count = d_strings.size();
+  rmm::device_vector<size_type> long_rows(strings_count);
+  rmm::device_vector<size_type> short_rows(strings_count);
+  auto const ends = thrust::stable_partition_copy(rmm::exec_policy(stream)->on(stream),
+                                                  thrust::make_counting_iterator<size_type>(0),
+                                                  thrust::make_counting_iterator(strings_count),
+                                                  long_rows.begin(),
+                                                  short_rows.begin(),
+                                                  is_long_string_fn{d_strings, threshold});
+  long_rows.resize(thrust::distance(long_rows.begin(), ends.first));
+  short_rows.resize(thrust::distance(short_rows.begin(), ends.second));
+  return string_length_bins{std::move(short_rows), std::move(long_rows)};
+}
+
+/**
+ * @brief Appends bytes to the output of a bounded write function if they fit in its buffer.
+ *
+ * @param d_buffer Output buffer of the string.
+ * @param capacity Size of `d_buffer` in bytes.
+ * @param bytes Number of output bytes so far; incremented by `size` even if the bytes do not fit.
+ * @param data Bytes to append.
+ * @param size Number of bytes to append.
+ */
+__device__ inline void append_bounded(
+  char* d_buffer, size_type capacity, size_type& bytes, const char* data, size_type size)
+{
+  if (bytes + size <= capacity) { memcpy(d_buffer + bytes, data, size); }
+  bytes += size;
+}
+
+/**
+ * @copydoc append_bounded(char*, size_type, size_type&, const char*, size_type)
+ *
+ * @param chr Character to append.
+ */
+__device__ inline void append_bounded(char* d_buffer,
+                                      size_type capacity,
+                                      size_type& bytes,
+                                      char_utf8 chr)
+{
+  auto const char_bytes = bytes_in_char_utf8(chr);
+  if (bytes + char_bytes <= capacity) { from_char_utf8(chr, d_buffer + bytes); }
+  bytes += char_bytes;
+}
+
+/**
+ * @brief Writes each string into its slot of the scratch buffer and records its size.
+ */
+template <typename BoundedWriteFunction>
+struct bounded_write_fn {
+  BoundedWriteFunction fn;
+  const int32_t* d_input_offsets;  ///< offsets of the input strings
+  size_type max_expansion;         ///< 0 computes the sizes only
+  char* d_scratch;
+  int32_t* d_sizes;
+
+  __device__ void operator()(size_type idx)
+  {
+    auto const begin    = (d_input_offsets[idx] - d_input_offsets[0]) * max_expansion;
+    auto const capacity = (d_input_offsets[idx + 1] - d_input_offsets[idx]) * max_expansion;
+    d_sizes[idx]        = fn(idx, d_scratch + begin, capacity);
+  }
+};
+
+/**
+ * @brief Copies each string from its scratch slot into the chars column, or writes it again if
+ * it did not fit in its slot.
+ */
+template <typename BoundedWriteFunction>
+struct compact_strings_fn {
+  BoundedWriteFunction fn;
+  const int32_t* d_input_offsets;
+  size_type max_expansion;
+  const char* d_scratch;
+  const int32_t* d_offsets;
+  char* d_chars;
+
+  __device__ void operator()(size_type idx)
+  {
+    auto const size     = d_offsets[idx + 1] - d_offsets[idx];
+    auto const capacity = (d_input_offsets[idx + 1] - d_input_offsets[idx]) * max_expansion;
+    auto const d_output = d_chars + d_offsets[idx];
+    if (size > capacity) {
+      fn(idx, d_output, size);
+    } else if (size > 0) {
+      auto const begin = (d_input_offsets[idx] - d_input_offsets[0]) * max_expansion;
+      memcpy(d_output, d_scratch + begin, size);
+    }
+  }
+};
+
+/**
+ * @brief Creates child offsets and chars columns by calling the function once per string, when
+ * the size of most output strings is bounded by a multiple of the size of their input string.
+ *
+ * `make_strings_children()` calls its function twice per string: once to compute the output
+ * sizes and once, after the offsets are known, to write the output. For transforms such as case
+ * conversion, the second call repeats all of the work of the first. Here, each string is instead
+ * written once into its own slot of a scratch buffer of `max_expansion` times the input bytes.
+ * The strings are then compacted into the chars column with a copy, using the offsets scanned
+ * from their sizes.
+ *
+ * The bound does not need to hold for every string: the strings that do not fit in their slot
+ * are written again directly into the chars column during the compaction. If the scratch buffer
+ * would exceed the maximum column size, the function is called twice per string instead.
+ *
+ * @tparam BoundedWriteFunction Function called as `fn(idx, d_buffer, capacity)` that returns the
+ *         size in bytes of the output string `idx`, and writes it to `d_buffer` if it fits in
+ *         `capacity` bytes. The contents of `d_buffer` are ignored if the string does not fit.
+ *
+ * @param fn Function computing and writing the output strings.
+ * @param strings Input strings column; its string sizes bound the output sizes.
+ * @param max_expansion Scratch bytes per byte of each input string.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return offsets child column and chars child column for a strings column
+ */
+template <typename BoundedWriteFunction>
+auto make_strings_children_bounded(
+  BoundedWriteFunction fn,
+  strings_column_view const& strings,
+  size_type max_expansion,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  auto const strings_count   = strings.size();
+  auto const d_input_offsets = strings.offsets().template data<int32_t>() + strings.offset();
+  auto const input_bytes     = thrust::device_pointer_cast(d_input_offsets)[strings_count] -
+                           thrust::device_pointer_cast(d_input_offsets)[0];
+  auto const scratch_size    = static_cast<int64_t>(input_bytes) * max_expansion;
+  if (scratch_size > std::numeric_limits<size_type>::max()) { max_expansion = 0; }
+  rmm::device_buffer scratch(max_expansion > 0 ? scratch_size : 0, stream);
+  auto const d_scratch = static_cast<char*>(scratch.data());
+
+  auto offsets_column = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets_column->mutable_view().template data<int32_t>();
+
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    bounded_write_fn<BoundedWriteFunction>{
+      fn, d_input_offsets, max_expansion, d_scratch, d_offsets});
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream), d_offsets, d_offsets + strings_count + 1, d_offsets);
+
+  std::unique_ptr<column> chars_column =
+    create_chars_child_column(strings_count,
+                              strings.null_count(),
+                              thrust::device_pointer_cast(d_offsets)[strings_count],
+                              mr,
+                              stream);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     strings_count,
+                     compact_strings_fn<BoundedWriteFunction>{
+                       fn,
+                       d_input_offsets,
+                       max_expansion,
+                       d_scratch,
+                       d_offsets,
+                       chars_column->mutable_view().template data<char>()});
+
+  return std::make_pair(std::move(offsets_column), std::move(chars_column));
+}
+
 // This template is a thin wrapper around per-context singleton objects.
 // It maintains a single object for each CUDA context.
 template <typename TableType>
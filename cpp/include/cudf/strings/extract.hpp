@@ -54,6 +54,41 @@ std::unique_ptr<table> extract(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a lists column of the strings of the groups of every match of the given regular
+ * expression pattern within each string.
+ *
+ * Each row of the output holds the groups of the first match of the corresponding string in
+ * order, followed by those of the next match and so on. A group that does not participate in a
+ * match is a null entry of the list.
+ *
+ * Any null string entries return corresponding null output list entries.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["a1b2","c3",null,"d"]
+ * r = extract_all(s,"([ab])(\\d)")
+ * r is now a lists column of strings:
+ *   [ ["a","1","b","2"],
+ *     [],
+ *     null,
+ *     [] ]
+ * @endcode
+ *
+ * See the @ref md_regex "Regex Features" page for details on patterns supported by this API.
+ *
+ * @throw cudf::logic_error if the pattern has no groups.
+ *
+ * @param strings Strings instance for this operation.
+ * @param pattern The regular expression pattern with group indicators.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New lists column of strings.
+ */
+std::unique_ptr<column> extract_all(
+  strings_column_view const& strings,
+  std::string const& pattern,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
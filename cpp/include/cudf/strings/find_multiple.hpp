@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 namespace cudf {
 namespace strings {
@@ -53,6 +54,69 @@ std::unique_ptr<column> find_multiple(
   strings_column_view const& targets,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a boolean column identifying rows which contain
+ * any of the target strings.
+ *
+ * Each string is scanned once by an Aho-Corasick automaton of the targets,
+ * so the cost does not depend on the number of targets.
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abc","def",""]
+ * t = ["b","xy","ef"]
+ * r = contains_any(s,t)
+ * r is now [true, true, false]
+ * @endcode
+ *
+ * @throw cudf::logic_error targets is empty or contains nulls or empty strings
+ *
+ * @param strings Strings instance for this operation.
+ * @param targets Strings to search for in each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New BOOL8 column of the results.
+ */
+std::unique_ptr<column> contains_any(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns every occurrence of each of the target strings in each string.
+ *
+ * The result is a table of three INT32 columns with one row per occurrence:
+ * the index of the string, the index of the target and the character position
+ * of the occurrence in the string. Occurrences may overlap. They are ordered by
+ * string and then by the position where they end. A target listed more than
+ * once is reported with its first index.
+ *
+ * Each string is scanned once by an Aho-Corasick automaton of the targets,
+ * so the cost does not depend on the number of targets. Null strings have no
+ * occurrences.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abcab","xbc"]
+ * t = ["ab","bc"]
+ * r = find_all_literals(s,t)
+ * r is now [[0, 0, 0, 1], [0, 1, 0, 1], [0, 1, 3, 1]]
+ * @endcode
+ *
+ * @throw cudf::logic_error targets is empty or contains nulls or empty strings
+ *
+ * @param strings Strings instance for this operation.
+ * @param targets Strings to search for in each string.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return New table of the string index, target index and character position
+ * of each occurrence.
+ */
+std::unique_ptr<table> find_all_literals(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
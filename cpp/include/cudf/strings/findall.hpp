@@ -56,6 +56,36 @@ std::unique_ptr<table> findall_re(
   std::string const& pattern,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns a lists column of the strings matching the regex pattern within each string.
+ *
+ * Each row of the output holds the matches of the corresponding string in order, so its size is
+ * the total number of matches rather than the number of strings times the most matches of any
+ * string as with `findall_re`.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["bunny","rabbit"]
+ * r = findall_record(s, "[ab]")
+ * r is now a lists column of strings:
+ *   [ ["b"],
+ *     ["a","b","b"] ]
+ * @endcode
+ *
+ * Any null string entries return corresponding null output list entries.
+ *
+ * See the @ref md_regex "Regex Features" page for details on patterns supported by this API.
+ *
+ * @param strings Strings instance for this operation.
+ * @param pattern Regex pattern to match within each string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New lists column of strings.
+ */
+std::unique_ptr<column> findall_record(
+  strings_column_view const& strings,
+  std::string const& pattern,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
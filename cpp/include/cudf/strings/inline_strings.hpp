@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+namespace cudf {
+namespace strings {
+/**
+ * @brief Fixed-size view of one string of an `inline_strings` set
+ *
+ * @ingroup strings_classes
+ *
+ * The first 8 bytes hold the length and the first 4 bytes of the string, so that most comparisons
+ * of different strings are decided without reading the string. A string of at most 12 bytes is
+ * stored entirely in the view; a longer string is stored in the data buffer of its set. The unused
+ * bytes of the prefix and of the inline string are zero.
+ */
+struct alignas(16) inline_string {
+  static constexpr size_type prefix_bytes     = 4;   ///< Bytes of the string kept in the prefix
+  static constexpr size_type max_inline_bytes = 12;  ///< Longest string stored in the view
+
+  size_type length;           ///< Number of bytes of the string
+  char prefix[prefix_bytes];  ///< First bytes of the string
+  union {
+    char suffix[max_inline_bytes - prefix_bytes];  ///< Remaining bytes of an inline string
+    int64_t offset;                                ///< Offset of a long string in the data buffer
+  };
+
+  /**
+   * @brief Returns true if the whole string is stored in the view
+   */
+  CUDA_HOST_DEVICE_CALLABLE bool is_inline() const { return length <= max_inline_bytes; }
+};
+
+static_assert(sizeof(inline_string) == 16, "inline_string must be 16 bytes");
+
+/**
+ * @brief Strings stored as an array of `inline_string` views and a data buffer holding the
+ * strings longer than `inline_string::max_inline_bytes`
+ *
+ * @ingroup strings_classes
+ *
+ * This is an alternate representation of a strings column for kernels that compare, hash or sort
+ * many short strings: the strings of up to 12 bytes are read from the views alone. Null strings
+ * have a zero view.
+ */
+class inline_strings {
+ public:
+  inline_strings(size_type size,
+                 rmm::device_buffer&& views,
+                 rmm::device_buffer&& data,
+                 rmm::device_buffer&& null_mask,
+                 size_type null_count)
+    : _size(size),
+      _views(std::move(views)),
+      _data(std::move(data)),
+      _null_mask(std::move(null_mask)),
+      _null_count(null_count)
+  {
+  }
+
+  /**
+   * @brief Returns the number of strings
+   */
+  size_type size() const noexcept { return _size; }
+
+  /**
+   * @brief Returns the number of null strings
+   */
+  size_type null_count() const noexcept { return _null_count; }
+
+  /**
+   * @brief Returns the device array of `size()` views
+   */
+  inline_string const* views() const noexcept
+  {
+    return static_cast<inline_string const*>(_views.data());
+  }
+
+  /**
+   * @brief Returns the device buffer of the long strings
+   */
+  char const* data() const noexcept { return static_cast<char const*>(_data.data()); }
+
+  /**
+   * @brief Returns the number of bytes of the long strings
+   */
+  std::size_t data_size() const noexcept { return _data.size(); }
+
+  /**
+   * @brief Returns the device null mask, or nullptr if no string is null
+   */
+  bitmask_type const* null_mask() const noexcept
+  {
+    return _null_mask.size() > 0 ? static_cast<bitmask_type const*>(_null_mask.data()) : nullptr;
+  }
+
+ private:
+  size_type _size;
+  rmm::device_buffer _views;
+  rmm::device_buffer _data;
+  rmm::device_buffer _null_mask;
+  size_type _null_count;
+};
+
+/**
+ * @addtogroup strings_convert
+ * @{
+ */
+
+/**
+ * @brief Converts a strings column to the `inline_strings` representation
+ *
+ * Only the strings longer than `inline_string::max_inline_bytes` are copied to the data buffer.
+ *
+ * @param strings Strings to convert
+ * @param mr Device memory resource used to allocate the returned device memory
+ * @return The strings as views and a data buffer
+ */
+std::unique_ptr<inline_strings> to_inline_strings(
+  strings_column_view const& strings,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Converts `inline_strings` back to a strings column
+ *
+ * @throws cudf::logic_error if the strings have more bytes than a strings column can hold
+ *
+ * @param strings Strings to convert
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New strings column
+ */
+std::unique_ptr<column> from_inline_strings(
+  inline_strings const& strings,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
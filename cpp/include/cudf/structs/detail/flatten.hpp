@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace structs {
+namespace detail {
+/**
+ * @brief Table of the columns of a table whose struct columns are replaced by their fields,
+ * with the column order and null precedence of each column.
+ *
+ * Holds the columns and null masks created by the flattening, so it must outlive `columns`.
+ */
+struct flattened_table {
+  table_view columns;                                  ///< The flattened columns
+  std::vector<order> column_order;                     ///< Order of each flattened column
+  std::vector<null_order> null_precedence;             ///< Null precedence of each column
+  std::vector<std::unique_ptr<column>> owned_columns;  ///< Columns created by the flattening
+  std::vector<rmm::device_buffer> owned_masks;         ///< Null masks created by the flattening
+};
+
+/**
+ * @brief Replaces each struct column of a table by its fields, recursively, so that the rows of
+ * the result compare, sort and hash like the rows of the input.
+ *
+ * A nullable struct column is replaced by a BOOL8 column of its nulls, whose valid rows are all
+ * equal, followed by its fields with the nulls of the struct added to their own. Two null structs
+ * are thus equal whatever their fields hold. The fields of a struct column get the order and
+ * null precedence of the struct column. An empty `column_order` or `null_precedence` stays empty.
+ *
+ * ```
+ * input  = [ Struct<int, int>{{1, 2}, null, {3, 4}} ]
+ * output = [ {0, null, 0}, {1, null, 3}, {2, null, 4} ]
+ * ```
+ *
+ * Columns of other types are returned as is.
+ *
+ * @param input Table whose struct columns are flattened
+ * @param column_order Order of each column of `input`, or empty
+ * @param null_precedence Null precedence of each column of `input`, or empty
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The flattened columns, with the column order and null precedence of each
+ */
+flattened_table flatten_nested_columns(table_view const& input,
+                                       std::vector<order> const& column_order,
+                                       std::vector<null_order> const& null_precedence,
+                                       cudaStream_t stream = 0);
+
+/**
+ * @brief Replaces each struct column of a table by its fields like `flatten_nested_columns`, but
+ * with a null indicator column for every struct column, nullable or not.
+ *
+ * The flattened columns of two tables then line up whenever the types of their columns do,
+ * whatever their nullability, so that the rows of one can be compared with the rows of the other.
+ *
+ * @param input Table whose struct columns are flattened
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The flattened columns
+ */
+flattened_table flatten_nested_columns_with_null_indicators(table_view const& input,
+                                                            cudaStream_t stream = 0);
+
+/**
+ * @brief Rebuilds the struct columns of a table from the rows of its flattened columns
+ *
+ * `flattened` holds columns with the types of the columns returned by `flatten_nested_columns` for
+ * `schema`, such as the rows of those columns gathered by a groupby. Only the types and the
+ * nullability of the columns of `schema` are used. The fields of the null structs are null.
+ *
+ * @param flattened Columns of the flattened form of `schema`
+ * @param schema Table whose struct columns were flattened
+ * @return Table of the columns of `flattened`, with the struct columns of `schema` rebuilt
+ */
+std::unique_ptr<table> unflatten_nested_columns(std::unique_ptr<table>&& flattened,
+                                                table_view const& schema);
+
+}  // namespace detail
+}  // namespace structs
+}  // namespace cudf
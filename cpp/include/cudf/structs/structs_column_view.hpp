@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+
+namespace cudf {
+
+/**
+ * @ingroup structs_classes
+ * @{
+ */
+
+/**
+ * @brief Given a column-view of structs type, an instance of this class
+ * provides a wrapper on this compound column for struct operations.
+ *
+ * The children of a structs column hold one row per row of the parent. The parent's
+ * offset and size apply to the children, so the children returned by `child()` are sliced
+ * to the rows of the parent.
+ */
+class structs_column_view : private column_view {
+ public:
+  structs_column_view(column_view const& structs_column);
+  structs_column_view(structs_column_view&& structs_view)      = default;
+  structs_column_view(const structs_column_view& structs_view) = default;
+  ~structs_column_view()                                       = default;
+  structs_column_view& operator=(structs_column_view const&) = default;
+  structs_column_view& operator=(structs_column_view&&) = default;
+
+  using column_view::has_nulls;
+  using column_view::null_count;
+  using column_view::null_mask;
+  using column_view::num_children;
+  using column_view::offset;
+  using column_view::size;
+
+  /**
+   * @brief Returns the parent column.
+   */
+  column_view parent() const;
+
+  /**
+   * @brief Returns a field of the structs, sliced to the rows of the parent
+   *
+   * @throw cudf::logic_error if `index` is not the index of a child
+   *
+   * @param index Index of the field
+   */
+  column_view child(size_type index) const;
+};
+/** @} */  // end of group
+}  // namespace cudf
@@ -21,6 +21,7 @@
 #include <cudf/detail/utilities/release_assert.cuh>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -392,10 +393,12 @@ class row_lexicographic_comparator {
 template <template <typename> class hash_function, bool has_nulls = true>
 class element_hasher {
  public:
+  using result_type = typename hash_function<size_type>::result_type;
+
   template <typename T>
-  __device__ inline hash_value_type operator()(column_device_view col, size_type row_index)
+  __device__ inline result_type operator()(column_device_view col, size_type row_index)
   {
-    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<hash_value_type>::max(); }
+    if (has_nulls && col.is_null(row_index)) { return std::numeric_limits<result_type>::max(); }
 
     return hash_function<T>{}(col.element<T>(row_index));
   }
@@ -410,13 +413,15 @@ class element_hasher {
 template <template <typename> class hash_function, bool has_nulls = true>
 class row_hasher {
  public:
+  using result_type = typename hash_function<size_type>::result_type;
+
   row_hasher() = delete;
   row_hasher(table_device_view t) : _table{t} {}
 
   __device__ auto operator()(size_type row_index) const
   {
-    auto hash_combiner = [](hash_value_type lhs, hash_value_type rhs) {
-      return hash_function<hash_value_type>{}.hash_combine(lhs, rhs);
+    auto hash_combiner = [](result_type lhs, result_type rhs) {
+      return hash_function<result_type>{}.hash_combine(lhs, rhs);
     };
 
     // Hashes an element in a column
@@ -432,7 +437,7 @@ class row_hasher {
                                     thrust::make_counting_iterator(0),
                                     thrust::make_counting_iterator(_table.num_columns()),
                                     hasher,
-                                    hash_value_type{0},
+                                    result_type{0},
                                     hash_combiner);
   }
 
@@ -440,6 +445,79 @@ class row_hasher {
   table_device_view _table;
 };
 
+/**
+ * @brief Computes the hash value of a row like `row_hasher`, or reads it from a
+ * column of precomputed row hashes.
+ *
+ * Lets the operators that hash the same keys one after another, e.g. a hash
+ * partition followed by a join and a groupby, reuse the hashes of `cudf::hash`
+ * instead of hashing the keys again. The precomputed hashes are 32- or 64-bit
+ * integers, zero-extended or truncated to `result_type`.
+ *
+ * Hash tables pick the slot of a row from the low bits of its hash, which all
+ * the rows of a hash partition share when partitioned by the same hashes. The
+ * precomputed hashes of such tables are remixed with the 64-bit finalizer of
+ * MurmurHash3, unless `remix` is false.
+ *
+ * @tparam hash_function Hash functor used when no precomputed hashes are given.
+ * @tparam has_nulls Indicates the potential for null values in the table.
+ **/
+template <template <typename> class hash_function, bool has_nulls = true>
+class precomputed_row_hasher {
+ public:
+  using result_type = typename hash_function<size_type>::result_type;
+
+  precomputed_row_hasher() = delete;
+
+  /**
+   * @brief Constructs a hasher of the rows of `t`
+   *
+   * @throw cudf::logic_error if `row_hashes` is not empty and is not a non-nullable
+   * column of 32- or 64-bit integers with one row per row of `t`
+   *
+   * @param t The table whose rows are hashed when `row_hashes` is empty
+   * @param row_hashes Precomputed hash of each row of `t`, or an empty column
+   * @param remix Whether the precomputed hashes are remixed
+   */
+  precomputed_row_hasher(table_device_view t,
+                         column_view const& row_hashes = column_view{},
+                         bool remix                    = true)
+    : _hasher{t}, _remix{remix}
+  {
+    if (row_hashes.size() == 0) { return; }
+    CUDF_EXPECTS(is_index_type(row_hashes.type()) and not row_hashes.nullable(),
+                 "Row hashes must be a non-nullable integer column");
+    CUDF_EXPECTS(row_hashes.size() == t.num_rows(), "Row hashes must have one row per key row");
+    if (size_of(row_hashes.type()) == sizeof(uint64_t)) {
+      _hashes64 = row_hashes.data<uint64_t>();
+    } else {
+      CUDF_EXPECTS(size_of(row_hashes.type()) == sizeof(uint32_t),
+                   "Row hashes must be 32- or 64-bit integers");
+      _hashes32 = row_hashes.data<uint32_t>();
+    }
+  }
+
+  __device__ result_type operator()(size_type row_index) const
+  {
+    if (_hashes64 == nullptr and _hashes32 == nullptr) { return _hasher(row_index); }
+    uint64_t hash = (_hashes64 != nullptr) ? _hashes64[row_index] : _hashes32[row_index];
+    if (_remix) {
+      hash ^= hash >> 33;
+      hash *= 0xff51afd7ed558ccdull;
+      hash ^= hash >> 33;
+      hash *= 0xc4ceb9fe1a85ec53ull;
+      hash ^= hash >> 33;
+    }
+    return static_cast<result_type>(hash);
+  }
+
+ private:
+  row_hasher<hash_function, has_nulls> _hasher;
+  uint32_t const* _hashes32{nullptr};
+  uint64_t const* _hashes64{nullptr};
+  bool _remix;
+};
+
 /**
  * @brief Computes the hash value of a row in the given table, combined with an
  * initial hash value for each column.
@@ -450,16 +528,18 @@ class row_hasher {
 template <template <typename> class hash_function, bool has_nulls = true>
 class row_hasher_initial_values {
  public:
+  using result_type = typename hash_function<size_type>::result_type;
+
   row_hasher_initial_values() = delete;
-  row_hasher_initial_values(table_device_view t, hash_value_type* initial_hash)
+  row_hasher_initial_values(table_device_view t, result_type* initial_hash)
     : _table{t}, _initial_hash(initial_hash)
   {
   }
 
   __device__ auto operator()(size_type row_index) const
   {
-    auto hash_combiner = [](hash_value_type lhs, hash_value_type rhs) {
-      return hash_function<hash_value_type>{}.hash_combine(lhs, rhs);
+    auto hash_combiner = [](result_type lhs, result_type rhs) {
+      return hash_function<result_type>{}.hash_combine(lhs, rhs);
     };
 
     // Hashes an element in a column and combines with an initial value
@@ -477,13 +557,13 @@ class row_hasher_initial_values {
                                     thrust::make_counting_iterator(0),
                                     thrust::make_counting_iterator(_table.num_columns()),
                                     hasher,
-                                    hash_value_type{0},
+                                    result_type{0},
                                     hash_combiner);
   }
 
  private:
   table_device_view _table;
-  hash_value_type* _initial_hash;
+  result_type* _initial_hash;
 };
 
 }  // namespace cudf
@@ -51,6 +51,42 @@ std::unique_ptr<column> transform(
   bool is_ptx,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Creates a new column by applying a function of one element of each
+ * input column to every row of a table.
+ *
+ * Computes:
+ * `out[i] = F(in0[i], in1[i], ...)`
+ *
+ * The UDF is compiled with a kernel that reads the inputs and their validity,
+ * and writes the output and its validity, in a single pass. With
+ * `null_policy::EXCLUDE`, the UDF has the signature `f(out*, in0, in1, ...)`;
+ * it is only called for rows where every input is valid, and the other rows
+ * are null. With `null_policy::INCLUDE`, the UDF has the signature
+ * `f(out*, bool* out_valid, in0, bool valid0, in1, bool valid1, ...)`; it is
+ * called for every row and sets the validity of the output row, which is null
+ * unless the UDF sets `*out_valid` to true.
+ *
+ * @throws cudf::logic_error if `inputs` has no columns
+ * @throws cudf::logic_error if a column of `inputs` is not of a fixed-width type
+ *
+ * @param inputs        The columns whose rows are transformed
+ * @param udf           The PTX/CUDA string of the function to apply
+ * @param output_type   The output type that is compatible with the output type in the UDF
+ * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ * @param nulls         Whether the UDF is called for rows with null inputs
+ * @param mr            Device memory resource used to allocate the returned column's device memory
+ * @return              The column resulting from applying the function to every
+ *                      row of the inputs
+ **/
+std::unique_ptr<column> transform(
+  table_view const& inputs,
+  std::string const& udf,
+  data_type output_type,
+  bool is_ptx,
+  null_policy nulls                   = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Creates a null_mask from `input` by converting `NaN` to null and
  * preserving existing null values and also returns new null_count.
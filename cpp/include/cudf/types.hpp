@@ -59,6 +59,7 @@ class column_view;
 class mutable_column_view;
 class string_view;
 class list_view;
+class struct_view;
 
 class scalar;
 template <typename T>
@@ -178,6 +179,14 @@ enum class interpolation : int32_t {
   NEAREST    ///< i or j, whichever is nearest
 };
 
+/**
+ * @brief Identifies the hash function used to hash the rows of a table
+ */
+enum class hash_id : int32_t {
+  HASH_MURMUR3 = 0,  ///< MurmurHash3_32, 32-bit hash values
+  HASH_XXHASH64      ///< xxHash64, 64-bit hash values
+};
+
 /**
  * @brief Identifies a column's logical element type
  **/
@@ -207,6 +216,9 @@ enum class type_id : int32_t {
   DICTIONARY32,            ///< Dictionary type using int32 indices
   STRING,                  ///< String elements
   LIST,                    ///< List elements
+  DECIMAL32,               ///< Fixed-point decimal with a base 10 scale in int32
+  DECIMAL64,               ///< Fixed-point decimal with a base 10 scale in int64
+  STRUCT,                  ///< Struct elements
   // `NUM_TYPE_IDS` must be last!
   NUM_TYPE_IDS  ///< Total number of type ids
 };
@@ -233,30 +245,45 @@ class data_type {
    **/
   explicit constexpr data_type(type_id id) : _id{id} {}
 
+  /**
+   * @brief Construct a new `data_type` object for a fixed-point type
+   *
+   * An element of this type with stored integer `v` represents the value `v * 10^scale`.
+   *
+   * @param id The type's identifier, `DECIMAL32` or `DECIMAL64`
+   * @param scale The base 10 exponent applied to the stored integers
+   **/
+  explicit constexpr data_type(type_id id, int32_t scale) : _id{id}, _fixed_point_scale{scale} {}
+
   /**
    * @brief Returns the type identifier
    **/
   CUDA_HOST_DEVICE_CALLABLE type_id id() const noexcept { return _id; }
 
+  /**
+   * @brief Returns the scale (for fixed-point types only)
+   **/
+  CUDA_HOST_DEVICE_CALLABLE int32_t scale() const noexcept { return _fixed_point_scale; }
+
  private:
   type_id _id{type_id::EMPTY};
-  // Store additional type specific metadata, timezone, decimal precision and
-  // scale, etc.
+  int32_t _fixed_point_scale{};  // Store scale for fixed-point types
 };
 
 /**
  * @brief Compares two `data_type` objects for equality.
  *
- * // TODO Define exactly what it means for two `data_type`s to be equal. e.g.,
- * are two timestamps with different resolutions equal? How about decimals with
- * different scale/precision?
+ * Two fixed-point types are equal only if their scales are equal.
  *
  * @param lhs The first `data_type` to compare
  * @param rhs The second `data_type` to compare
  * @return true `lhs` is equal to `rhs`
  * @return false `lhs` is not equal to `rhs`
  */
-inline bool operator==(data_type const& lhs, data_type const& rhs) { return lhs.id() == rhs.id(); }
+inline bool operator==(data_type const& lhs, data_type const& rhs)
+{
+  return lhs.id() == rhs.id() && lhs.scale() == rhs.scale();
+}
 
 /**
  * @brief Returns the size in bytes of elements of the specified `data_type`
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <utility>
+
+namespace cudf {
+/**
+ * @addtogroup utility_graph
+ * @{
+ */
+
+/**
+ * @brief A sequence of libcudf calls captured on a stream into a CUDA graph, to be replayed
+ *
+ * Pipelines that run the same calls on identically shaped batches can capture the calls once and
+ * then launch the graph for each batch, paying the launch overhead and the host-side setup of the
+ * calls once instead of for every batch:
+ *
+ * ```
+ * cudf::fixed_buffer_resource slot{slot_ptr, slot_size};
+ * std::unique_ptr<cudf::column> result;
+ * cudf::captured_graph graph(stream, [&](cudaStream_t s) {
+ *   cudf::scratch_resource_scope scratch{&slot};
+ *   result = cudf::detail::binary_operation(lhs, rhs, op, type, &slot, s);
+ * });
+ * for (auto& batch : batches) {
+ *   copy_batch_into(lhs, rhs, batch, stream);  // same buffers, new values
+ *   graph.launch(stream);                      // recomputes `result` in place
+ * }
+ * ```
+ *
+ * The graph replays the captured kernels and copies on the device addresses used during the
+ * capture. The inputs and the outputs of the captured calls must therefore stay alive while the
+ * graph is used, and new batches are passed by writing them into the captured input buffers, or
+ * by recapturing on new buffers of the same shape with `update()`, which patches the graph in
+ * place and is much cheaper than capturing into a new graph.
+ *
+ * The captured calls must be `detail::` calls on the capturing stream that neither synchronize
+ * nor call `cudaMalloc`/`cudaFree`. Their temporaries and outputs must come from a
+ * stream-ordered resource that suballocates from memory it already owns, such as a
+ * `fixed_buffer_resource` set as the `mr` and, with a `scratch_resource_scope`, as the scratch
+ * resource. Calls that copy results to host, such as those computing output sizes, cannot be
+ * captured; the capture then fails with a `cudf::cuda_error`.
+ */
+class captured_graph {
+ public:
+  /**
+   * @brief Captures the work that `fn` enqueues on `stream`
+   *
+   * @throw cudf::logic_error if `stream` is the default stream, which cannot be captured
+   * @throw cudf::cuda_error if `fn` made a call that cannot be captured
+   *
+   * @param stream The stream to capture; must not be the default stream
+   * @param fn Callable taking `stream` and enqueuing the calls to capture on it
+   */
+  template <typename Fn>
+  captured_graph(cudaStream_t stream, Fn&& fn) : _exec{instantiate(capture(stream, fn))}
+  {
+  }
+
+  captured_graph(captured_graph const&) = delete;
+  captured_graph& operator=(captured_graph const&) = delete;
+  captured_graph(captured_graph&& other) noexcept : _exec{std::exchange(other._exec, nullptr)} {}
+  captured_graph& operator=(captured_graph&& other) noexcept
+  {
+    std::swap(_exec, other._exec);
+    return *this;
+  }
+  ~captured_graph();
+
+  /**
+   * @brief Replays the captured calls on `stream`
+   *
+   * @param stream The stream to launch the graph on; any stream, including the default stream
+   */
+  void launch(cudaStream_t stream) const;
+
+  /**
+   * @brief Recaptures the calls, typically on new buffers of the same shape, into the graph
+   *
+   * The graph is patched in place when the new capture has the same kernels and copies, only with
+   * different arguments; otherwise it is replaced by the new capture.
+   *
+   * @throw cudf::logic_error if `stream` is the default stream, which cannot be captured
+   * @throw cudf::cuda_error if `fn` made a call that cannot be captured
+   *
+   * @param stream The stream to capture; must not be the default stream
+   * @param fn Callable taking `stream` and enqueuing the calls to capture on it
+   */
+  template <typename Fn>
+  void update(cudaStream_t stream, Fn&& fn)
+  {
+    update_graph(capture(stream, fn));
+  }
+
+ private:
+  template <typename Fn>
+  static cudaGraph_t capture(cudaStream_t stream, Fn& fn)
+  {
+    begin_capture(stream);
+    try {
+      fn(stream);
+    } catch (...) {
+      abort_capture(stream);
+      throw;
+    }
+    return end_capture(stream);
+  }
+
+  static void begin_capture(cudaStream_t stream);
+  static cudaGraph_t end_capture(cudaStream_t stream);
+  static void abort_capture(cudaStream_t stream) noexcept;
+  static cudaGraphExec_t instantiate(cudaGraph_t graph);
+  void update_graph(cudaGraph_t graph);
+
+  cudaGraphExec_t _exec{};
+};
+
+/** @} */  // end of group
+}  // namespace cudf
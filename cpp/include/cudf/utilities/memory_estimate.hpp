@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace cudf {
+/**
+ * @addtogroup utility_types
+ * @{
+ */
+
+/**
+ * @brief Device memory a call is expected to need, from an `estimate_*_memory` function
+ *
+ * The estimates use the sizing logic of the implementations, such as the size of their hash
+ * tables and of the pages they decompress, so that a scheduler can admit a call only when enough
+ * device memory is free. The sizes of data-dependent outputs, such as the rows of a join or the
+ * groups of a groupby, come from the caller or from a sample of the input.
+ */
+struct memory_estimate {
+  std::size_t output_bytes  = 0;  ///< Bytes of the returned columns
+  std::size_t scratch_bytes = 0;  ///< Peak bytes of the temporaries, freed before returning
+
+  /**
+   * @brief Returns the peak device memory of the call, outputs and temporaries included
+   */
+  std::size_t peak_bytes() const { return output_bytes + scratch_bytes; }
+};
+
+/** @} */  // end of group
+}  // namespace cudf
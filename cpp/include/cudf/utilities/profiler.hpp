@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup utility_profiler
+ * @{
+ */
+
+/**
+ * @brief Aggregate resource usage of the calls of one libcudf operation
+ *
+ * Operations are the functions marked with `CUDF_FUNC_RANGE()`, that is the public APIs, and are
+ * named after the function. The figures of a call include the calls it makes to other operations.
+ */
+struct operation_profile {
+  std::string name;           ///< Name of the function
+  int64_t calls{};            ///< Number of completed calls
+  int64_t bytes_allocated{};  ///< Total bytes allocated during the calls
+  int64_t peak_bytes{};       ///< Largest growth of the allocated memory during a single call
+  double gpu_time_ms{};       ///< Total default stream time of the calls, in milliseconds
+};
+
+/**
+ * @brief Starts profiling the libcudf operations
+ *
+ * Wraps the current default device memory resource in a tracking adaptor and sets the adaptor as
+ * the default resource, so the memory resource must be configured before the profiler is enabled.
+ * Allocations made from another resource passed explicitly to an API are not counted. The time of
+ * each call is measured with CUDA events; the figures of a call are attributed to the operations
+ * running on the calling thread.
+ *
+ * Profiling adds a small host overhead to each call and nothing once disabled. Calling this
+ * function when the profiler is already enabled has no effect.
+ */
+void enable_profiler();
+
+/**
+ * @brief Stops profiling and restores the previous default device memory resource
+ *
+ * The profiles collected so far are kept until `reset_profiles()`.
+ */
+void disable_profiler();
+
+/**
+ * @brief Returns whether the profiler is enabled
+ */
+bool is_profiler_enabled();
+
+/**
+ * @brief Returns the profiles of the operations called since the last reset, sorted by name
+ *
+ * Waits for the work of the profiled calls to complete to measure their GPU time.
+ */
+std::vector<operation_profile> get_profiles();
+
+/**
+ * @brief Clears the collected profiles
+ */
+void reset_profiles();
+
+/**
+ * @brief Returns the profiles as a JSON document
+ *
+ * The document is an object with an `operations` array holding one object per operation, with
+ * the fields `name`, `calls`, `bytes_allocated`, `peak_bytes` and `gpu_time_ms`.
+ */
+std::string profiles_to_json();
+
+/**
+ * @brief Returns the profiles in the Prometheus text exposition format
+ *
+ * Exposes the counters `cudf_operation_calls_total`, `cudf_operation_allocated_bytes_total` and
+ * `cudf_operation_gpu_seconds_total` and the gauge `cudf_operation_peak_bytes`, labeled by
+ * `operation`, for an application to serve on its metrics endpoint.
+ */
+std::string profiles_to_prometheus();
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup utility_scratch
+ * @{
+ */
+
+/**
+ * @brief Returns the device memory resource of the temporary allocations of the calling thread
+ *
+ * Temporaries are the allocations that an API frees before it returns, as opposed to the returned
+ * columns, which are allocated from the `mr` parameter of the API. They are allocated
+ * stream-ordered on the stream of the call.
+ *
+ * @return The resource of the innermost `scratch_resource_scope` of the calling thread, or the
+ * default resource if there is none
+ */
+rmm::mr::device_memory_resource* get_scratch_resource();
+
+/**
+ * @brief Directs the temporary allocations of the libcudf calls made by the current thread to a
+ * device memory resource for the lifetime of the scope
+ *
+ * Lets a caller put an arena, a limit or an accounting adaptor under the scratch memory of the
+ * operators of one query without changing the default resource of the other threads:
+ *
+ * ```
+ * rmm::mr::cnmem_memory_resource query_arena{arena_size};
+ * {
+ *   cudf::scratch_resource_scope scratch{&query_arena};
+ *   auto result = cudf::groupby::groupby(keys).aggregate(requests, result_mr);
+ * }
+ * ```
+ *
+ * Scopes nest. The resource must be usable from the streams of the calls made in the scope, and
+ * must outlive the scope and the objects created in it that cache intermediate results, such as
+ * `cudf::hash_join` and `cudf::groupby::groupby`.
+ */
+class scratch_resource_scope {
+ public:
+  /**
+   * @brief Makes `mr` the scratch resource of the current thread until the scope is destroyed
+   *
+   * @param mr The resource of the temporary allocations; must not be nullptr
+   */
+  explicit scratch_resource_scope(rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Restores the scratch resource that was current when the scope was created
+   */
+  ~scratch_resource_scope();
+
+  scratch_resource_scope(scratch_resource_scope const&) = delete;
+  scratch_resource_scope& operator=(scratch_resource_scope const&) = delete;
+
+ private:
+  rmm::mr::device_memory_resource* const _previous;
+};
+
+/**
+ * @brief Device memory resource allocating from a fixed, caller-owned device buffer
+ *
+ * Lets a caller read or compute into memory it already owns, such as the slots of a ring of
+ * batch buffers, so that repeated calls on identically shaped inputs do not allocate:
+ *
+ * ```
+ * cudf::fixed_buffer_resource slot{slot_ptr, slot_size};
+ * auto batch = cudf::io::read_parquet(args, &slot);  // outputs are carved out of the slot
+ * ```
+ *
+ * Allocations are carved out of the buffer in order. Freeing the most recent allocation returns
+ * its space, and the buffer is reused from the start once every allocation is freed. An
+ * allocation that does not fit throws `std::bad_alloc`, so the caller can size the buffer for the
+ * largest expected output. Freed space is reused in stream order, so allocations must be made and
+ * freed on a single stream, or the caller must synchronize between streams. All functions are
+ * thread-safe.
+ */
+class fixed_buffer_resource final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Constructs a resource over a device buffer
+   *
+   * @param buffer The device buffer; must outlive the resource and its allocations
+   * @param capacity Size of the buffer in bytes
+   */
+  fixed_buffer_resource(void* buffer, std::size_t capacity)
+    : _buffer{static_cast<char*>(buffer)}, _capacity{capacity}
+  {
+  }
+
+  bool supports_streams() const noexcept override { return true; }
+  bool supports_get_mem_info() const noexcept override { return true; }
+
+  /**
+   * @brief Returns the bytes of the buffer in use, including the freed space that is not
+   * reusable yet
+   */
+  std::size_t used_bytes() const;
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override;
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override;
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t stream) const override;
+
+  char* const _buffer;
+  std::size_t const _capacity;
+  mutable std::mutex _mutex;
+  std::size_t _used       = 0;
+  std::size_t _num_allocs = 0;
+};
+
+/**
+ * @brief Device memory resource serving small allocations from slabs of an upstream resource
+ *
+ * Scalars, device views and the counters of kernels allocate a few bytes each, and through a
+ * general purpose resource every one of these allocations and frees can cost more than the kernel
+ * using it; `cudaMalloc` and `cudaFree` even synchronize the device. This resource serves the
+ * allocations of at most `max_small_size` bytes from slabs allocated from its upstream, in size
+ * classes of 256 to 4096 bytes, and forwards the larger ones to the upstream:
+ *
+ * ```
+ * cudf::small_object_resource small{rmm::mr::get_default_resource()};
+ * rmm::mr::set_default_resource(&small);  // scalars, device views and counters
+ * ```
+ *
+ * or, to pool only the temporaries of the calls of one thread, installed in a
+ * `scratch_resource_scope`.
+ *
+ * Freed blocks are reused in stream order: a block freed on a stream is only reused by the
+ * allocations on that stream, and the slabs of a stream are allocated on it. The slabs are
+ * returned to the upstream when the resource is destroyed, so the resource holds on to the
+ * largest number of small blocks that were in use at once. All functions are thread-safe.
+ */
+class small_object_resource final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Size in bytes of the largest allocation served from the slabs
+   */
+  static constexpr std::size_t max_small_size = 4096;
+
+  /**
+   * @brief Constructs a resource over an upstream resource
+   *
+   * @param upstream The resource of the slabs and of the allocations larger than
+   * `max_small_size`; must outlive the resource
+   * @param slab_size Size in bytes of the slabs allocated from `upstream`, at least
+   * `max_small_size`
+   */
+  explicit small_object_resource(rmm::mr::device_memory_resource* upstream,
+                                 std::size_t slab_size = 1 << 20);
+
+  /**
+   * @brief Returns the slabs to the upstream resource
+   */
+  ~small_object_resource() override;
+
+  small_object_resource(small_object_resource const&) = delete;
+  small_object_resource& operator=(small_object_resource const&) = delete;
+
+  bool supports_streams() const noexcept override { return true; }
+  bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+  /**
+   * @brief Returns the bytes of the slabs allocated from the upstream resource
+   */
+  std::size_t slab_bytes() const;
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override;
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override;
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t stream) const override;
+
+  static constexpr std::size_t num_size_classes = 5;
+
+  /**
+   * @brief The small blocks of a stream
+   */
+  struct stream_blocks {
+    std::array<std::vector<void*>, num_size_classes> free;  ///< Freed blocks of each size class
+    char* slab_next = nullptr;  ///< Start of the unused part of the current slab
+    char* slab_end  = nullptr;  ///< End of the current slab
+  };
+
+  rmm::mr::device_memory_resource* const _upstream;
+  std::size_t const _slab_size;
+  mutable std::mutex _mutex;
+  std::vector<std::pair<void*, cudaStream_t>> _slabs;
+  std::unordered_map<cudaStream_t, stream_blocks> _streams;
+};
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace cudf {
+/**
+ * @addtogroup utility_spill
+ * @{
+ */
+
+class spillable_table;
+
+/**
+ * @brief Tracks the residency of a set of spillable tables and evicts the least recently used
+ * ones from device memory
+ *
+ * A table is evicted by copying its packed device buffer to pinned host memory, or to a file of
+ * `spill_directory` if one is given, and freeing the device buffer. The tables are evicted when
+ * the device memory they hold exceeds `device_limit`, and on demand by `spill()`, typically
+ * from a `spill_on_demand_resource` that failed an allocation. All functions are thread-safe.
+ */
+class spill_manager {
+ public:
+  /**
+   * @brief Constructs a manager of no tables
+   *
+   * @param device_limit Device memory the managed tables may hold before the least recently used
+   * are evicted
+   * @param spill_directory Directory of the files of evicted tables, or empty to evict the tables
+   * to pinned host memory
+   */
+  explicit spill_manager(std::size_t device_limit   = std::numeric_limits<std::size_t>::max(),
+                         std::string spill_directory = {});
+
+  spill_manager(spill_manager const&) = delete;
+  spill_manager& operator=(spill_manager const&) = delete;
+
+  /**
+   * @brief Evicts the least recently used tables that are not locked until at least `bytes`
+   * bytes of device memory are freed or no table is left to evict
+   *
+   * @param bytes Device memory to free
+   * @return The device memory freed
+   */
+  std::size_t spill(std::size_t bytes);
+
+  /**
+   * @brief Returns the device memory held by the managed tables
+   */
+  std::size_t device_bytes() const;
+
+  /**
+   * @brief Returns the size of the managed tables that are evicted
+   */
+  std::size_t spilled_bytes() const;
+
+ private:
+  friend class spillable_table;
+
+  void register_table(spillable_table* table);
+  void unregister_table(spillable_table* table);
+  void touch(spillable_table* table);  ///< Marks the table as most recently used
+  std::size_t spill_locked(std::size_t bytes, spillable_table const* keep);
+
+  std::size_t const _device_limit;
+  std::string const _spill_directory;
+  // Recursive, since restoring a table allocates device memory, which may spill other tables
+  mutable std::recursive_mutex _mutex;
+  std::list<spillable_table*> _tables;  ///< Most recently used first
+  std::size_t _device_bytes  = 0;
+  std::size_t _spilled_bytes = 0;
+  std::size_t _next_id       = 0;  ///< Names the files of evicted tables
+};
+
+/**
+ * @brief A table whose device memory a `spill_manager` can evict and restore
+ *
+ * The table is packed into one contiguous device buffer with `pack`, so that evicting and
+ * restoring it each take a single copy. Its columns are accessed through a `lock`, which
+ * restores the table if it is evicted and keeps it resident while the lock is alive.
+ */
+class spillable_table {
+ public:
+  /**
+   * @brief Keeps a table resident in device memory and gives access to its columns
+   */
+  class lock {
+   public:
+    lock(lock&& other) noexcept;
+    lock& operator=(lock&&) = delete;
+    ~lock();
+
+    /**
+     * @brief Returns a view of the table, valid for the lifetime of the lock
+     */
+    table_view view() const { return _view; }
+
+   private:
+    friend class spillable_table;
+    lock(spillable_table* table, table_view view) : _table{table}, _view{view} {}
+
+    spillable_table* _table;
+    table_view _view;
+  };
+
+  /**
+   * @brief Packs a copy of a table and registers it with a manager
+   *
+   * @param input The table to copy
+   * @param manager The manager evicting the table; must outlive it
+   * @param mr Device memory resource used to allocate the packed buffer and the buffers of
+   * restored tables
+   */
+  spillable_table(table_view const& input,
+                  spill_manager& manager,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Registers an already packed table with a manager
+   *
+   * @param packed The packed table
+   * @param manager The manager evicting the table; must outlive it
+   * @param mr Device memory resource used to allocate the buffers of restored tables
+   */
+  spillable_table(packed_columns&& packed,
+                  spill_manager& manager,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  spillable_table(spillable_table const&) = delete;
+  spillable_table& operator=(spillable_table const&) = delete;
+
+  /**
+   * @brief Unregisters the table and frees its memory
+   *
+   * The table must not be locked.
+   */
+  ~spillable_table();
+
+  /**
+   * @brief Restores the table if it is evicted and locks it in device memory
+   *
+   * @throws rmm::bad_alloc if the table cannot be restored
+   */
+  lock acquire();
+
+  /**
+   * @brief Returns whether the table is evicted from device memory
+   */
+  bool is_spilled() const;
+
+  /**
+   * @brief Returns the size of the packed device buffer of the table
+   */
+  std::size_t size() const { return _size; }
+
+ private:
+  friend class spill_manager;
+  struct storage;
+
+  std::size_t spill(std::string const& spill_directory, std::size_t id);
+  void restore();
+
+  spill_manager& _manager;
+  rmm::mr::device_memory_resource* const _mr;
+  std::size_t const _size;
+  std::unique_ptr<storage> _storage;
+  int _locks = 0;  ///< Guarded by the mutex of the manager
+};
+
+/**
+ * @brief Device memory resource that evicts the tables of a `spill_manager` when an allocation
+ * fails and retries it
+ *
+ * Making it the default resource lets every libcudf allocation reclaim the memory of the evicted
+ * tables instead of failing.
+ */
+class spill_on_demand_resource final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Constructs the adaptor
+   *
+   * @param upstream The resource serving the allocations; must outlive the adaptor
+   * @param manager The manager evicting tables on failure; must outlive the adaptor
+   */
+  spill_on_demand_resource(rmm::mr::device_memory_resource* upstream, spill_manager& manager)
+    : _upstream{upstream}, _manager{manager}
+  {
+  }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override;
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override
+  {
+    _upstream->deallocate(p, bytes, stream);
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t stream) const override
+  {
+    return _upstream->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* const _upstream;
+  spill_manager& _manager;
+};
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -18,6 +18,7 @@
 
 #include <cudf/lists/list_view.cuh>
 #include <cudf/strings/string_view.cuh>
+#include <cudf/structs/struct_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/wrappers/durations.hpp>
@@ -160,7 +161,7 @@ struct is_unsigned_impl {
  *
  * "Numeric" types are fundamental integral/floating point types such as `INT*`
  * or `FLOAT*`. Types that wrap a numeric type are not considered numeric, e.g.,
- *`TIMESTAMP`.
+ *`TIMESTAMP` or `DECIMAL32`.
  *
  * @param type The `data_type` to verify
  * @return true `type` is numeric
@@ -168,7 +169,9 @@ struct is_unsigned_impl {
  **/
 constexpr inline bool is_numeric(data_type type)
 {
-  return cudf::type_dispatcher(type, is_numeric_impl{});
+  // Fixed-point types are dispatched as their integer storage types
+  return type.id() != type_id::DECIMAL32 and type.id() != type_id::DECIMAL64 and
+         cudf::type_dispatcher(type, is_numeric_impl{});
 }
 
 /**
@@ -400,6 +403,34 @@ constexpr inline bool is_chrono(data_type type)
   return cudf::type_dispatcher(type, is_chrono_impl{});
 }
 
+/**
+ * @brief Indicates whether the type `T` is a fixed-point type.
+ *
+ * @tparam T  The type to verify
+ * @return true `T` is a fixed-point type
+ * @return false  `T` is not a fixed-point type
+ **/
+template <typename T>
+constexpr inline bool is_fixed_point()
+{
+  return std::is_same<numeric::decimal32, T>::value || std::is_same<numeric::decimal64, T>::value;
+}
+
+/**
+ * @brief Indicates whether `type` is a fixed-point `data_type`.
+ *
+ * The type is checked on its `id()` because fixed-point types are dispatched as their storage
+ * types.
+ *
+ * @param type The `data_type` to verify
+ * @return true `type` is a fixed-point type
+ * @return false `type` is not a fixed-point type
+ **/
+constexpr inline bool is_fixed_point(data_type type)
+{
+  return type.id() == type_id::DECIMAL32 || type.id() == type_id::DECIMAL64;
+}
+
 /**
  * @brief Indicates whether elements of type `T` are fixed-width.
  *
@@ -414,7 +445,7 @@ constexpr inline bool is_fixed_width()
 {
   // TODO Add fixed width wrapper types
   // Is a category fixed width?
-  return cudf::is_numeric<T>() || cudf::is_chrono<T>();
+  return cudf::is_numeric<T>() || cudf::is_chrono<T>() || cudf::is_fixed_point<T>();
 }
 
 struct is_fixed_width_impl {
@@ -455,7 +486,7 @@ template <typename T>
 constexpr inline bool is_compound()
 {
   return std::is_same<T, cudf::string_view>::value or std::is_same<T, cudf::dictionary32>::value or
-         std::is_same<T, cudf::list_view>::value;
+         std::is_same<T, cudf::list_view>::value or std::is_same<T, cudf::struct_view>::value;
 }
 
 struct is_compound_impl {
@@ -497,7 +528,7 @@ constexpr inline bool is_compound(data_type type)
 template <typename T>
 constexpr inline bool is_nested()
 {
-  return std::is_same<T, cudf::list_view>::value;
+  return std::is_same<T, cudf::list_view>::value or std::is_same<T, cudf::struct_view>::value;
 }
 
 struct is_nested_impl {
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/wrappers/dictionary.hpp>
@@ -132,6 +133,30 @@ CUDF_TYPE_MAPPING(cudf::duration_us, type_id::DURATION_MICROSECONDS);
 CUDF_TYPE_MAPPING(cudf::duration_ns, type_id::DURATION_NANOSECONDS);
 CUDF_TYPE_MAPPING(dictionary32, type_id::DICTIONARY32);
 CUDF_TYPE_MAPPING(cudf::list_view, type_id::LIST);
+CUDF_TYPE_MAPPING(numeric::decimal32, type_id::DECIMAL32);
+CUDF_TYPE_MAPPING(numeric::decimal64, type_id::DECIMAL64);
+CUDF_TYPE_MAPPING(cudf::struct_view, type_id::STRUCT);
+
+/**
+ * @brief Maps a C++ type to the type of its elements in device memory
+ *
+ * Fixed-point types are stored as their representation type, the scale being held by the
+ * `data_type` of the column. All other types are stored as themselves.
+ *
+ * @tparam T The type to map
+ **/
+template <typename T>
+struct device_storage_type {
+  using type = T;
+};
+
+template <typename Rep, numeric::Radix Rad>
+struct device_storage_type<numeric::fixed_point<Rep, Rad>> {
+  using type = Rep;
+};
+
+template <typename T>
+using device_storage_type_t = typename device_storage_type<T>::type;
 
 template <typename T>
 struct type_to_scalar_type_impl {
@@ -225,6 +250,153 @@ using scalar_type_t = typename type_to_scalar_type_impl<T>::ScalarType;
 template <typename T>
 using scalar_device_type_t = typename type_to_scalar_type_impl<T>::ScalarDeviceType;
 
+/**
+ * @brief Groups of types that a build can exclude from the `type_dispatcher`
+ *
+ * The `type_dispatcher` instantiates the dispatched functor for every type it supports, which
+ * dominates the size and the compile time of libcudf. Defining `CUDF_DISPATCH_EXCLUDE_<GROUP>`
+ * for a translation unit removes the types of the group from all of its dispatches: the functors
+ * are not instantiated for them, and dispatching them fails at runtime. The CMake option
+ * `CUDF_DISPATCH_EXCLUDE` defines the macros for the whole library.
+ */
+enum dispatch_group : uint32_t {
+  DISPATCH_UNSIGNED   = 1 << 0,  ///< UINT8, UINT16, UINT32 and UINT64
+  DISPATCH_TIMESTAMPS = 1 << 1,  ///< TIMESTAMP_*
+  DISPATCH_DURATIONS  = 1 << 2,  ///< DURATION_*
+  DISPATCH_DECIMALS   = 1 << 3,  ///< DECIMAL32 and DECIMAL64
+  DISPATCH_DICTIONARY = 1 << 4,  ///< DICTIONARY32
+  DISPATCH_LIST       = 1 << 5,  ///< LIST
+  DISPATCH_STRUCT     = 1 << 6,  ///< STRUCT
+};
+
+/**
+ * @brief The groups of types excluded from the dispatches of this translation unit
+ */
+constexpr uint32_t excluded_dispatch_groups = 0
+#ifdef CUDF_DISPATCH_EXCLUDE_UNSIGNED
+                                              | DISPATCH_UNSIGNED
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_TIMESTAMPS
+                                              | DISPATCH_TIMESTAMPS
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_DURATIONS
+                                              | DISPATCH_DURATIONS
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_DECIMALS
+                                              | DISPATCH_DECIMALS
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_DICTIONARY
+                                              | DISPATCH_DICTIONARY
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_LIST
+                                              | DISPATCH_LIST
+#endif
+#ifdef CUDF_DISPATCH_EXCLUDE_STRUCT
+                                              | DISPATCH_STRUCT
+#endif
+  ;
+
+/**
+ * @brief Returns the group of a `type_id`, or 0 for the types that are always dispatched
+ */
+CUDA_HOST_DEVICE_CALLABLE constexpr uint32_t dispatch_group_of(type_id id)
+{
+  switch (id) {
+    case type_id::UINT8:
+    case type_id::UINT16:
+    case type_id::UINT32:
+    case type_id::UINT64: return DISPATCH_UNSIGNED;
+    case type_id::TIMESTAMP_DAYS:
+    case type_id::TIMESTAMP_SECONDS:
+    case type_id::TIMESTAMP_MILLISECONDS:
+    case type_id::TIMESTAMP_MICROSECONDS:
+    case type_id::TIMESTAMP_NANOSECONDS: return DISPATCH_TIMESTAMPS;
+    case type_id::DURATION_DAYS:
+    case type_id::DURATION_SECONDS:
+    case type_id::DURATION_MILLISECONDS:
+    case type_id::DURATION_MICROSECONDS:
+    case type_id::DURATION_NANOSECONDS: return DISPATCH_DURATIONS;
+    case type_id::DECIMAL32:
+    case type_id::DECIMAL64: return DISPATCH_DECIMALS;
+    case type_id::DICTIONARY32: return DISPATCH_DICTIONARY;
+    case type_id::LIST: return DISPATCH_LIST;
+    case type_id::STRUCT: return DISPATCH_STRUCT;
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Returns whether the `type_dispatcher` instantiates functors for a `type_id`
+ *
+ * @param id The type to check
+ * @param excluded_groups The excluded groups, by default those of this translation unit
+ */
+CUDA_HOST_DEVICE_CALLABLE constexpr bool is_dispatched(
+  type_id id, uint32_t excluded_groups = excluded_dispatch_groups)
+{
+  return (dispatch_group_of(id) & excluded_groups) == 0;
+}
+
+namespace detail {
+/**
+ * @brief Invokes `f.operator()<T>`, or fails if the type is excluded from dispatching
+ *
+ * The excluded case never names `operator()<T>`, so the functor is not instantiated for `T`.
+ */
+template <bool Dispatched>
+struct dispatch_case {
+#pragma nv_exec_check_disable
+  template <typename T, typename Functor, typename... Ts>
+  CUDA_HOST_DEVICE_CALLABLE static constexpr decltype(auto) invoke(Functor& f, Ts&&... args)
+  {
+    return f.template operator()<T>(std::forward<Ts>(args)...);
+  }
+};
+
+template <>
+struct dispatch_case<false> {
+#pragma nv_exec_check_disable
+  template <typename T, typename Functor, typename... Ts>
+  CUDA_HOST_DEVICE_CALLABLE static auto invoke(Functor& f, Ts&&... args)
+    -> decltype(f.template operator()<int8_t>(std::forward<Ts>(args)...))
+  {
+#ifndef __CUDA_ARCH__
+    CUDF_FAIL("Unsupported type_id: the type is excluded from dispatching in this build.");
+#else
+    release_assert(false && "Unsupported type_id: the type is excluded from dispatching.");
+    using return_type = decltype(f.template operator()<int8_t>(std::forward<Ts>(args)...));
+    return return_type();
+#endif
+  }
+};
+
+/**
+ * @brief The C++ type dispatched for a `type_id`; fixed-point types are dispatched as their
+ * storage types
+ */
+template <template <cudf::type_id> typename IdTypeMap, type_id Id>
+using dispatched_type_t =
+  std::conditional_t<Id == type_id::DECIMAL32 || Id == type_id::DECIMAL64,
+                     device_storage_type_t<typename IdTypeMap<Id>::type>,
+                     typename IdTypeMap<Id>::type>;
+
+/**
+ * @brief Invokes the functor with the type dispatched for `Id`, unless `Id` is excluded
+ */
+#pragma nv_exec_check_disable
+template <template <cudf::type_id> typename IdTypeMap,
+          type_id Id,
+          uint32_t ExcludedGroups,
+          typename Functor,
+          typename... Ts>
+CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) dispatch_id(Functor& f, Ts&&... args)
+{
+  return dispatch_case<is_dispatched(Id, ExcludedGroups)>::template invoke<
+    dispatched_type_t<IdTypeMap, Id>>(f, std::forward<Ts>(args)...);
+}
+
+}  // namespace detail
+
 /**
  * @brief Invokes an `operator()` template with the type instantiation based on
  * the specified `cudf::data_type`'s `id()`.
@@ -254,6 +426,16 @@ using scalar_device_type_t = typename type_to_scalar_type_impl<T>::ScalarDeviceT
  * cudf::type_dispatcher<always_int>(data_type, f);
  * @endcode
  *
+ * The fixed-point types `DECIMAL32` and `DECIMAL64` are dispatched as their storage types
+ * (`device_storage_type_t<T>`, i.e., `int32_t` and `int64_t`), so that algorithms that do not
+ * depend on the scale (copying, gathering, sorting, hashing, etc.) work on them unchanged.
+ * Algorithms whose result depends on the scale must check for `is_fixed_point(dtype)` and read
+ * the scale from `dtype.scale()`.
+ *
+ * The types of the groups in `ExcludedGroups` (see `dispatch_group`) are not instantiated, and
+ * dispatching them throws `cudf::logic_error`. By default, these are the groups excluded from the
+ * translation unit with the `CUDF_DISPATCH_EXCLUDE_<GROUP>` macros.
+ *
  * It is sometimes necessary to customize the dispatched functor's
  * `operator()` for different types.  This can be done in several ways.
  *
@@ -308,6 +490,7 @@ using scalar_device_type_t = typename type_to_scalar_type_impl<T>::ScalarDeviceT
  * trying to return different types from the same function.
  *
  * @tparam id_to_type_impl Maps a `cudf::type_id` its dispatched C++ type
+ * @tparam ExcludedGroups Bitwise OR of the `dispatch_group`s that are not dispatched
  * @tparam Functor The callable object's type
  * @tparam Ts Variadic parameter pack type
  * @param dtype The `cudf::data_type` whose `id()` determines which template
@@ -321,6 +504,7 @@ using scalar_device_type_t = typename type_to_scalar_type_impl<T>::ScalarDeviceT
 // of calling a __host__ functor from this function which is __host__ __device__
 #pragma nv_exec_check_disable
 template <template <cudf::type_id> typename IdTypeMap = id_to_type_impl,
+          uint32_t ExcludedGroups                     = excluded_dispatch_groups,
           typename Functor,
           typename... Ts>
 CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_type dtype,
@@ -344,17 +528,17 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_ty
       return f.template operator()<typename IdTypeMap<type_id::INT64>::type>(
         std::forward<Ts>(args)...);
     case type_id::UINT8:
-      return f.template operator()<typename IdTypeMap<type_id::UINT8>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::UINT8, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::UINT16:
-      return f.template operator()<typename IdTypeMap<type_id::UINT16>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::UINT16, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::UINT32:
-      return f.template operator()<typename IdTypeMap<type_id::UINT32>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::UINT32, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::UINT64:
-      return f.template operator()<typename IdTypeMap<type_id::UINT64>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::UINT64, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::FLOAT32:
       return f.template operator()<typename IdTypeMap<type_id::FLOAT32>::type>(
         std::forward<Ts>(args)...);
@@ -365,41 +549,50 @@ CUDA_HOST_DEVICE_CALLABLE constexpr decltype(auto) type_dispatcher(cudf::data_ty
       return f.template operator()<typename IdTypeMap<type_id::STRING>::type>(
         std::forward<Ts>(args)...);
     case type_id::TIMESTAMP_DAYS:
-      return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_DAYS>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::TIMESTAMP_DAYS, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::TIMESTAMP_SECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_SECONDS>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::TIMESTAMP_SECONDS, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::TIMESTAMP_MILLISECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_MILLISECONDS>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::TIMESTAMP_MILLISECONDS, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::TIMESTAMP_MICROSECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_MICROSECONDS>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::TIMESTAMP_MICROSECONDS, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::TIMESTAMP_NANOSECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_NANOSECONDS>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::TIMESTAMP_NANOSECONDS, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::DURATION_DAYS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_DAYS>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::DURATION_DAYS, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::DURATION_SECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_SECONDS>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::DURATION_SECONDS, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::DURATION_MILLISECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_MILLISECONDS>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::DURATION_MILLISECONDS, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::DURATION_MICROSECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_MICROSECONDS>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::DURATION_MICROSECONDS, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::DURATION_NANOSECONDS:
-      return f.template operator()<typename IdTypeMap<type_id::DURATION_NANOSECONDS>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::DURATION_NANOSECONDS, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::DICTIONARY32:
-      return f.template operator()<typename IdTypeMap<type_id::DICTIONARY32>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::DICTIONARY32, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     case type_id::LIST:
-      return f.template operator()<typename IdTypeMap<type_id::LIST>::type>(
-        std::forward<Ts>(args)...);
+      return detail::dispatch_id<IdTypeMap, type_id::LIST, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
+    case type_id::DECIMAL32:
+      return detail::dispatch_id<IdTypeMap, type_id::DECIMAL32, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
+    case type_id::DECIMAL64:
+      return detail::dispatch_id<IdTypeMap, type_id::DECIMAL64, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
+    case type_id::STRUCT:
+      return detail::dispatch_id<IdTypeMap, type_id::STRUCT, ExcludedGroups>(
+        f, std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported type_id.");
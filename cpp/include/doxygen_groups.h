@@ -33,6 +33,7 @@
  *      @defgroup dictionary_classes Dictionary
  *      @defgroup timestamp_classes Timestamp
  *      @defgroup lists_classes Lists
+ *      @defgroup structs_classes Structs
  *   @}
  *   @defgroup table_classes Table
  *   @defgroup scalar_classes Scalar
@@ -71,6 +72,7 @@
  *     @defgroup transformation_unaryops Unary Operations
  *     @defgroup transformation_binaryops Binary Operations
  *     @defgroup transformation_transform Transform
+ *     @defgroup transformation_expressions Expression Evaluation
  *     @defgroup transformation_replace Replacing
  *     @defgroup transformation_fill Filling
  *   @}
@@ -86,6 +88,7 @@
  *   @defgroup column_interop Interop
  *   @{
  *     @defgroup interop_dlpack DLPack
+ *     @defgroup interop_arrow Arrow
  *   @}
  * @}
  * @defgroup datetime_apis DateTime
@@ -112,14 +115,27 @@
  *   @defgroup dictionary_search Searching
  *   @defgroup dictionary_update Updating Keys
  * @}
+ * @defgroup lists_apis Lists
+ * @{
+ *   @defgroup lists_elements Counting
+ *   @defgroup lists_contains Searching
+ *   @defgroup lists_sort Sorting
+ * @}
  * @defgroup io_apis IO
  * @{
  *   @defgroup io_datasources Datasources
  *   @defgroup io_readers Readers
  *   @defgroup io_writers Writers
  * @}
+ * @defgroup comms_apis Communication
+ * @{
+ *   @defgroup comms_shuffle Shuffling
+ *   @defgroup comms_ipc CUDA IPC
+ * @}
  * @defgroup nvtext_apis NVText
  * @{
+ *   @defgroup nvtext_edit_distance Edit Distance
+ *   @defgroup nvtext_minhash MinHashing
  *   @defgroup nvtext_ngrams NGrams
  *   @defgroup nvtext_normalize Normalizing
  *   @defgroup nvtext_tokenize Tokenizing
@@ -131,5 +147,9 @@
  *   @defgroup utility_dispatcher Type Dispatcher
  *   @defgroup utility_bitmask Bitmask
  *   @defgroup utility_error Exception
+ *   @defgroup utility_profiler Profiler
+ *   @defgroup utility_scratch Scratch Memory
+ *   @defgroup utility_spill Spilling
+ *   @defgroup utility_graph CUDA Graphs
  * @}
  */
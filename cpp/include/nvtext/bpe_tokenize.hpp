@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <memory>
+#include <string>
+
+namespace nvtext {
+namespace detail {
+struct bpe_merge_table;
+}
+
+/**
+ * @addtogroup nvtext_tokenize
+ * @{
+ */
+
+/**
+ * @brief The vocabulary and merge ranks of a byte-level BPE tokenizer in device memory
+ *
+ * The object returned from `load_bpe_vocabulary()` can be used to call `bpe_tokenize()`
+ * without incurring the cost of loading the same files each time.
+ */
+struct bpe_vocabulary {
+  bpe_vocabulary();
+  ~bpe_vocabulary();
+
+  cudf::size_type vocabulary_size{};                ///< Number of tokens of the vocabulary
+  cudf::size_type num_merges{};                     ///< Number of merge rules
+  std::unique_ptr<cudf::column> byte_token_ids;     ///< UINT32 token id of each of the 256 bytes
+  std::unique_ptr<detail::bpe_merge_table> merges;  ///< Hash table of (pair -> rank, token id)
+};
+
+/**
+ * @brief Load the vocabulary and merge rules of a byte-level BPE tokenizer into device memory.
+ *
+ * The tokens of both files are in the byte-level encoding of GPT-2, where each byte is
+ * represented by a printable unicode character; for example a space is written `Ġ`.
+ *
+ * @code{.pseudo}
+ * Format of the vocabulary file: one token per line; the token id is the line number.
+ *  Ġthe
+ *  ...
+ * Format of the merges file: one pair of tokens per line separated by a space, in the order
+ * of their priority. An optional first line starting with `#version` is ignored.
+ *  #version: 0.2
+ *  Ġ t
+ *  h e
+ *  ...
+ * @endcode
+ *
+ * This is the `merges.txt` file of the GPT-2 tokenizer together with the keys of its
+ * `vocab.json` file written one per line in the order of their ids.
+ *
+ * @throw cudf::logic_error if either file could not be opened.
+ * @throw cudf::logic_error if the vocabulary does not have a token for each of the 256 bytes.
+ * @throw cudf::logic_error if a merge pair or its merged token is not in the vocabulary.
+ *
+ * @param filename_vocabulary Path of the vocabulary file
+ * @param filename_merges Path of the merges file
+ * @param mr Memory resource to allocate any returned objects.
+ * @return Vocabulary and merge table for `bpe_tokenize()`
+ */
+std::unique_ptr<bpe_vocabulary> load_bpe_vocabulary(
+  std::string const& filename_vocabulary,
+  std::string const& filename_merges,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the byte-pair encoding token ids of each string.
+ *
+ * Each string is split into words before each whitespace character and between punctuation
+ * and other characters, using the code point metadata of the subword tokenizer; a space stays
+ * at the beginning of the word that follows it. Each word starts as one token per byte and the
+ * adjacent pair of tokens with the lowest merge rank is merged until no merge rule applies.
+ *
+ * ```
+ * vocabulary: [..., "he", "ll", "hell", "hello"]  with merges [h e, l l, he ll, hell o]
+ * s = ["hello", "help", null]
+ * bpe_tokenize(s) = [[id(hello)], [id(he), id(l), id(p)], null]
+ * ```
+ *
+ * Any null row entries result in corresponding null output rows.
+ *
+ * @param strings Strings column to tokenize
+ * @param vocabulary Vocabulary and merges from `load_bpe_vocabulary()`
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of UINT32 token ids
+ */
+std::unique_ptr<cudf::column> bpe_tokenize(
+  cudf::strings_column_view const& strings,
+  bpe_vocabulary const& vocabulary,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
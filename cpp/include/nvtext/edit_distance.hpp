@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+namespace nvtext {
+/**
+ * @addtogroup nvtext_edit_distance
+ * @{
+ */
+
+/**
+ * @brief Compute the edit distance between individual strings in two strings columns.
+ *
+ * The output[i] is the Levenshtein distance between strings[i] and targets[i], the minimum
+ * number of character insertions, deletions and substitutions that change one string into
+ * the other. Pairs whose shorter string has at most 64 characters are computed with the
+ * bit-parallel algorithm of Myers in the registers of a thread; longer pairs fall back to
+ * dynamic programming over a single row of working memory.
+ *
+ * ```
+ * s = ["hello", "", "world"]
+ * t = ["hallo", "goodbye", "world"]
+ * d = edit_distance(s, t)
+ * d is now [1, 7, 0]
+ * ```
+ *
+ * Any null entries in either column result in corresponding null output rows.
+ *
+ * @throw cudf::logic_error if `strings.size() != targets.size()`
+ *
+ * @param strings Strings for this operation.
+ * @param targets Strings to compute edit distance against `strings`.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column of edit distance values.
+ */
+std::unique_ptr<cudf::column> edit_distance(
+  cudf::strings_column_view const& strings,
+  cudf::strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Compute the edit distance between each string and a single target string.
+ *
+ * ```
+ * s = ["hello", "", "world"]
+ * d = edit_distance(s, "hallo")
+ * d is now [1, 5, 4]
+ * ```
+ *
+ * Any null entries result in corresponding null output rows. All the output rows are null
+ * if `target` is invalid.
+ *
+ * @param strings Strings for this operation.
+ * @param target String to compute edit distance against each of `strings`.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New INT32 column of edit distance values.
+ */
+std::unique_ptr<cudf::column> edit_distance(
+  cudf::strings_column_view const& strings,
+  cudf::string_scalar const& target,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Compute the edit distance between all pairs of strings in a single column.
+ *
+ * Row i of the output is a list of the edit distances between strings[i] and each of the
+ * strings in the column. Each distance is computed once for both rows of the pair.
+ *
+ * ```
+ * s = ["hello", "hallo", "hella"]
+ * d = edit_distance_matrix(s)
+ * d is now [[0, 1, 1],
+ *           [1, 0, 2],
+ *           [1, 2, 0]]
+ * ```
+ *
+ * Null entries are compared as empty strings.
+ *
+ * @throw cudf::logic_error if the output would have more than the maximum number of elements
+ *        of a column
+ *
+ * @param strings Strings for this operation.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of INT32 edit distance values.
+ */
+std::unique_ptr<cudf::column> edit_distance_matrix(
+  cudf::strings_column_view const& strings,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Compute the Jaro-Winkler similarity between individual strings in two strings columns.
+ *
+ * The Jaro similarity counts the characters of the two strings that match within a window of
+ * half the length of the longer string, and the transpositions among those. The Winkler
+ * variant increases the similarity of strings sharing a prefix of up to 4 characters by
+ * `prefix_weight` for each common character. The result is between 0 (no similarity) and
+ * 1 (equal strings). The match flags of strings with at most 64 characters are kept in the
+ * registers of a thread.
+ *
+ * ```
+ * s = ["martha", "dixon", ""]
+ * t = ["marhta", "dicksonx", ""]
+ * d = jaro_winkler(s, t)
+ * d is now [0.961, 0.813, 1.0]
+ * ```
+ *
+ * Any null entries in either column result in corresponding null output rows.
+ *
+ * @throw cudf::logic_error if `strings.size() != targets.size()`
+ * @throw cudf::logic_error if `prefix_weight` is not within [0, 0.25]
+ *
+ * @param strings Strings for this operation.
+ * @param targets Strings to compute the similarity against `strings`.
+ * @param prefix_weight Weight of each character of the common prefix. Default is 0.1.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New FLOAT64 column of similarity values.
+ */
+std::unique_ptr<cudf::column> jaro_winkler(
+  cudf::strings_column_view const& strings,
+  cudf::strings_column_view const& targets,
+  double prefix_weight                = 0.1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Compute the Jaro-Winkler similarity between each string and a single target string.
+ *
+ * Any null entries result in corresponding null output rows. All the output rows are null
+ * if `target` is invalid.
+ *
+ * @throw cudf::logic_error if `prefix_weight` is not within [0, 0.25]
+ *
+ * @param strings Strings for this operation.
+ * @param target String to compute the similarity against each of `strings`.
+ * @param prefix_weight Weight of each character of the common prefix. Default is 0.1.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New FLOAT64 column of similarity values.
+ */
+std::unique_ptr<cudf::column> jaro_winkler(
+  cudf::strings_column_view const& strings,
+  cudf::string_scalar const& target,
+  double prefix_weight                = 0.1,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
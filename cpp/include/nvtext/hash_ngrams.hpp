@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+namespace nvtext {
+/**
+ * @addtogroup nvtext_ngrams
+ * @{
+ */
+
+/**
+ * @brief Returns the feature indices of the character ngrams of each string
+ *
+ * Each ngram of `ngrams` consecutive characters of a string is hashed with MurmurHash3_32
+ * and mapped to the feature index `hash % num_features`. The ngrams are hashed in place in
+ * the chars of the column; unlike `generate_character_ngrams()` no ngram strings are created,
+ * so the output needs 4 bytes per ngram.
+ *
+ * Row `i` of the output lists the feature indices of the ngrams of string `i` in order;
+ * the list is empty if the string has fewer than `ngrams` characters. The output can be
+ * used as the column indices of a sparse matrix of the strings.
+ *
+ * ```
+ * s = ["abab", "ab", "a"]
+ * hash_ngrams(s, 2, 8) = [[x, y, x], [x], []]  // x and y are the features of "ab" and "ba"
+ * ```
+ *
+ * Any null row entries result in corresponding null output rows.
+ *
+ * @throw cudf::logic_error if `ngrams < 1`
+ * @throw cudf::logic_error if `num_features < 1`
+ *
+ * @param strings Strings column to hash the ngrams of
+ * @param ngrams Number of characters of each ngram. Default is 2.
+ * @param num_features Number of features; the indices are in `[0, num_features)`.
+ *                     Default is 2^20.
+ * @param seed Seed of the hash function. Default is 0.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of INT32 feature indices
+ */
+std::unique_ptr<cudf::column> hash_ngrams(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams              = 2,
+  cudf::size_type num_features        = 1 << 20,
+  uint32_t seed                       = 0,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the feature indices of the token ngrams of each string
+ *
+ * Each string is tokenized as in `ngrams_tokenize()`. Each token is hashed with
+ * MurmurHash3_32, the hashes of `ngrams` consecutive tokens are combined into the hash of
+ * the ngram and the ngram is mapped to the feature index `hash % num_features`. Neither the
+ * tokens nor the ngrams are materialized as strings.
+ *
+ * Row `i` of the output lists the feature indices of the ngrams of string `i` in order;
+ * the list is empty if the string has fewer than `ngrams` tokens. Since the ngrams are
+ * hashed from their tokens, the separators between the tokens do not change the features:
+ * "a b" and "a  b" have the same bigram feature.
+ *
+ * ```
+ * s = ["a b a b", "b a", ""]
+ * hash_tokens(s, 2, 8) = [[x, y, x], [y], []]  // x and y are the features of "a b" and "b a"
+ * ```
+ *
+ * Any null row entries result in corresponding null output rows.
+ *
+ * @throw cudf::logic_error if `ngrams < 1`
+ * @throw cudf::logic_error if `num_features < 1`
+ * @throw cudf::logic_error if `delimiter` is invalid
+ *
+ * @param strings Strings column to hash the token ngrams of
+ * @param ngrams Number of tokens of each ngram. Default is 1, hashing the tokens.
+ * @param num_features Number of features; the indices are in `[0, num_features)`.
+ *                     Default is 2^20.
+ * @param delimiter UTF-8 characters used to separate each string into tokens.
+ *                  The default of empty string will separate tokens using whitespace.
+ * @param seed Seed of the hash function. Default is 0.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of INT32 feature indices
+ */
+std::unique_ptr<cudf::column> hash_tokens(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams               = 1,
+  cudf::size_type num_features         = 1 << 20,
+  cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+  uint32_t seed                        = 0,
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+namespace nvtext {
+/**
+ * @addtogroup nvtext_minhash
+ * @{
+ */
+
+/**
+ * @brief Returns the minhash value of each string
+ *
+ * The hash of each character ngram of `width` characters of a string is computed with
+ * MurmurHash3_32 and the minimum is returned. Strings with fewer than `width` characters
+ * are hashed as a single ngram. The ngrams are hashed without being materialized, so the
+ * cost is proportional to the number of characters of the column.
+ *
+ * Two strings sharing a large fraction of their ngrams are likely to have the same minhash:
+ * the probability is the Jaccard similarity of their ngram sets.
+ *
+ * ```
+ * s = ["abcdabcd", "bcdabcda", "xyz"]
+ * minhash(s, 0, 4) = [h, h, h']  // the first two strings have the same ngram set
+ * ```
+ *
+ * Any null row entries result in corresponding null output rows.
+ *
+ * @throw cudf::logic_error if `width < 2`
+ * @throw cudf::logic_error if `seed` is not a valid UINT32 scalar
+ *
+ * @param strings Strings column to compute minhash values of
+ * @param seed Seed of the hash function
+ * @param width Number of characters of each ngram. Default is 4.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New UINT32 column of minhash values
+ */
+std::unique_ptr<cudf::column> minhash(
+  cudf::strings_column_view const& strings,
+  cudf::numeric_scalar<uint32_t> const& seed = cudf::numeric_scalar<uint32_t>{0},
+  cudf::size_type width                      = 4,
+  rmm::mr::device_memory_resource* mr        = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the minhash signature of each string for a set of seeds
+ *
+ * Row `i` of the output is a list of `seeds.size()` values, where value `j` is the minhash
+ * of string `i` (see the previous overload) computed with `seeds[j]`. All seeds are computed
+ * by a single kernel, without materializing the ngrams.
+ *
+ * The fraction of equal values of two signatures estimates the Jaccard similarity of the ngram
+ * sets of the two strings. Use `minhash_lsh_buckets()` to bucket the signatures for
+ * near-duplicate detection.
+ *
+ * ```
+ * s = ["abcdabcd", "bcdabcda", null]
+ * minhash(s, [1, 2], 4) = [[a, b], [a, b], null]
+ * ```
+ *
+ * Any null row entries result in corresponding null output rows. Each output row, null
+ * or not, has `seeds.size()` elements.
+ *
+ * @throw cudf::logic_error if `width < 2`
+ * @throw cudf::logic_error if `seeds` is empty, is not UINT32 or has nulls
+ *
+ * @param strings Strings column to compute minhash signatures of
+ * @param seeds UINT32 column of the seeds of the hash functions
+ * @param width Number of characters of each ngram. Default is 4.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of UINT32 minhash signatures
+ */
+std::unique_ptr<cudf::column> minhash(
+  cudf::strings_column_view const& strings,
+  cudf::column_view const& seeds,
+  cudf::size_type width               = 4,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns the locality-sensitive hashing bucket of each band of minhash signatures
+ *
+ * Each signature of `num_hashes` values is split into `num_bands` bands of
+ * `num_hashes / num_bands` consecutive values, and each band is hashed into a bucket.
+ * Two rows with the same bucket for the same band are candidate near-duplicates; the chance
+ * of this grows sharply with the similarity of the rows.
+ *
+ * Row `i` of the output is a list of `num_bands` buckets. Exploding the output with
+ * `cudf::explode_position()` gives (band, bucket) keys for a groupby that collects the
+ * candidate rows of each bucket.
+ *
+ * ```
+ * s = [[1, 2, 3, 4], [1, 2, 5, 6]]
+ * minhash_lsh_buckets(s, 2) = [[a, b], [a, c]]  // the rows share the first band
+ * ```
+ *
+ * Any null row entries result in corresponding null output rows.
+ *
+ * @throw cudf::logic_error if `signatures` is not a LIST column of UINT32 values
+ * @throw cudf::logic_error if the signatures do not all have the same number of values
+ * @throw cudf::logic_error if `num_bands` is not a positive divisor of the number of values
+ *
+ * @param signatures Minhash signatures, such as returned from `minhash()`
+ * @param num_bands Number of bands of each signature
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of UINT32 buckets
+ */
+std::unique_ptr<cudf::column> minhash_lsh_buckets(
+  cudf::lists_column_view const& signatures,
+  cudf::size_type num_bands,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
@@ -21,8 +21,12 @@
 
 #include <stdint.h>
 #include <string.h>
+#include <memory>
 
 namespace nvtext {
+namespace detail {
+class wordpiece_tokenizer;
+}
 
 /**
  * @brief The vocabulary data for use with the subword_tokenize function.
@@ -171,4 +175,104 @@ tokenizer_result subword_tokenize(
   uint32_t max_rows_tensor,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Device buffers preallocated by the caller for the output of `subword_tokenizer`.
+ *
+ * Each column is a UINT32 view of at least `max_rows_tensor * max_sequence_length`
+ * elements for the token-ids and the attention-mask, and `max_rows_tensor * 3` elements
+ * for the metadata. The views may wrap the memory of tensors of another library,
+ * for example tensors exchanged through DLPack, so that the output is written in place
+ * and handed off without a copy.
+ */
+struct tokenizer_buffers {
+  cudf::mutable_column_view tensor_token_ids;
+  cudf::mutable_column_view tensor_attention_mask;
+  cudf::mutable_column_view tensor_metadata;
+};
+
+/**
+ * @brief Tokenizer that keeps its working memory on the device across calls.
+ *
+ * The @ref subword_tokenize functions allocate the working memory of the tokenizer and
+ * the output columns on every call. An instance of this class allocates the working memory
+ * once, for the `max_num_strings`, `max_num_chars` and `max_rows_tensor` limits, and then
+ * tokenizes successive batches of strings, either into new columns or into buffers
+ * preallocated by the caller.
+ *
+ * The vocabulary is referenced, not copied, and must outlive the tokenizer.
+ *
+ * See @ref subword_tokenize for the description of the parameters.
+ */
+class subword_tokenizer {
+ public:
+  /**
+   * @brief Creates a tokenizer for batches of at most `max_num_strings` strings and
+   *        `max_num_chars` characters.
+   *
+   * @throw cudf::logic_error if `stride > max_sequence_length`
+   * @throw cudf::logic_error if `max_sequence_length * max_rows_tensor` is
+   *        larger than the max value for cudf::size_type
+   *
+   * @param vocabulary_table The vocabulary table loaded with @ref load_vocabulary_file
+   * @param max_sequence_length Limit of the number of token-ids per row in final tensor
+   *        for each string.
+   * @param stride Each row in the output token-ids will replicate `max_sequence_length - stride`
+   *        the token-ids from the previous row, unless it is the first string.
+   * @param do_lower_case If true, the tokenizer will convert uppercase characters in the
+   *        input stream to lower-case and strip accents from those characters.
+   * @param do_truncate If true, the tokenizer will discard all the token-ids after
+   *        `max_sequence_length` for each input string.
+   * @param max_num_strings Maximum number of strings of each batch.
+   * @param max_num_chars Maximum number of characters of each batch.
+   * @param max_rows_tensor Maximum number of rows for the output token-ids of each batch.
+   */
+  subword_tokenizer(hashed_vocabulary const& vocabulary_table,
+                    uint32_t max_sequence_length,
+                    uint32_t stride,
+                    bool do_lower_case,
+                    bool do_truncate,
+                    uint32_t max_num_strings,
+                    uint32_t max_num_chars,
+                    uint32_t max_rows_tensor);
+
+  ~subword_tokenizer();
+
+  /**
+   * @brief Tokenizes a batch of strings into new columns.
+   *
+   * @throw cudf::logic_error if the batch exceeds `max_num_strings` or `max_num_chars`
+   *
+   * @param strings The input strings to tokenize.
+   * @param mr Memory resource to allocate any returned objects.
+   * @return token-ids, attention-mask, and metadata
+   */
+  tokenizer_result tokenize(
+    cudf::strings_column_view const& strings,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Tokenizes a batch of strings into preallocated buffers.
+   *
+   * The first `nrows_tensor` rows of the buffers are written, where `nrows_tensor` is the
+   * returned value; the remaining elements of the buffers are not modified.
+   *
+   * @throw cudf::logic_error if the batch exceeds `max_num_strings` or `max_num_chars`
+   * @throw cudf::logic_error if the buffers are not UINT32 columns
+   * @throw cudf::logic_error if the buffers are too small for the output rows
+   *
+   * @param strings The input strings to tokenize.
+   * @param output Buffers receiving the token-ids, attention-mask, and metadata
+   * @return The number of output rows `nrows_tensor`
+   */
+  uint32_t tokenize(cudf::strings_column_view const& strings, tokenizer_buffers const& output);
+
+ private:
+  uint32_t const _max_sequence_length;
+  uint32_t const _stride;
+  bool const _do_truncate;
+  uint32_t const _max_num_strings;
+  uint32_t const _max_num_chars;
+  std::unique_ptr<detail::wordpiece_tokenizer> _tokenizer;
+};
+
 }  // namespace nvtext
@@ -175,5 +175,46 @@ std::unique_ptr<cudf::column> character_tokenize(
   cudf::strings_column_view const& strings,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Returns the vocabulary IDs of the tokens of each string
+ *
+ * Each string is tokenized as in `tokenize()` and each token is looked up in the
+ * `vocabulary`; its ID is the row of the token in the vocabulary, or `default_id` if the
+ * token is not in the vocabulary. The vocabulary is loaded into a device hash table and the
+ * tokens are looked up by the tokenizing kernel, so no strings column of tokens is created.
+ * Tokenizing on whitespace collapses any run of whitespace, so the strings do not need to be
+ * normalized with `normalize_spaces()` first.
+ *
+ * Row `i` of the output lists the IDs of the tokens of string `i` in order.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["the  fox", "a fox jumped", null]
+ * v = ["fox", "the", "jumped"]
+ * t = tokenize_with_vocabulary(s, v)
+ * t is now [[1, 0], [-1, 0, 2], null]
+ * @endcode
+ *
+ * Any null row entries result in corresponding null output rows.
+ * If the vocabulary has duplicate entries, the ID of a token is its first row.
+ *
+ * @throw cudf::logic_error if the vocabulary contains nulls.
+ * @throw cudf::logic_error if `delimiter` is invalid.
+ *
+ * @param strings Strings column to tokenize.
+ * @param vocabulary Strings of the vocabulary; the ID of each string is its row.
+ * @param delimiter UTF-8 characters used to separate each string into tokens.
+ *                  The default of empty string will separate tokens using whitespace.
+ * @param default_id ID of the tokens not found in the vocabulary. Default is -1.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New LIST column of INT32 token IDs.
+ */
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(
+  cudf::strings_column_view const& strings,
+  cudf::strings_column_view const& vocabulary,
+  cudf::string_scalar const& delimiter = cudf::string_scalar{""},
+  cudf::size_type default_id           = -1,
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_default_resource());
+
 /** @} */  // end of tokenize group
 }  // namespace nvtext
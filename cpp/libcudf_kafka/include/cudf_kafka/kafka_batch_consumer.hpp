@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <librdkafka/rdkafkacpp.h>
+#include <atomic>
+#include <condition_variable>
+#include <cudf/io/datasource.hpp>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace external {
+namespace kafka {
+
+/**
+ * @brief A Kafka topic partition and a message offset within it
+ **/
+struct topic_partition_offset {
+  std::string topic;
+  int partition;
+  int64_t offset;
+};
+
+class pinned_buffer_pool;
+
+/**
+ * @brief A batch of consumed Kafka messages, readable as a libcudf datasource
+ *
+ * The messages are stored back to back, each followed by the delimiter, in pinned host memory
+ * owned by the `kafka_batch_consumer` that produced the batch. `host_read` returns views of that
+ * memory without copying it, so the batch can be passed directly to `read_json` or `read_csv`.
+ * The memory is handed back to the consumer for the next batch when the batch is destroyed.
+ *
+ * @ingroup io_datasources
+ **/
+class kafka_batch : public cudf::io::datasource {
+ public:
+  ~kafka_batch() override;
+
+  std::unique_ptr<cudf::io::datasource::buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override;
+
+  size_t size() const override { return _size; }
+
+  /**
+   * @brief Returns the number of messages in the batch
+   **/
+  size_t num_messages() const { return _num_messages; }
+
+  /**
+   * @brief Returns, for each topic partition in the batch, the offset of the message that follows
+   * the last message of the batch, i.e. the offset to commit once the batch is processed
+   **/
+  std::vector<topic_partition_offset> const &next_offsets() const { return _next_offsets; }
+
+ private:
+  friend class kafka_batch_consumer;
+
+  kafka_batch(std::shared_ptr<pinned_buffer_pool> pool,
+              uint8_t *data,
+              size_t size,
+              size_t num_messages,
+              std::vector<topic_partition_offset> next_offsets);
+
+  std::shared_ptr<pinned_buffer_pool> _pool;
+  uint8_t *_data;
+  size_t _size;
+  size_t _num_messages;
+  std::vector<topic_partition_offset> _next_offsets;
+};
+
+/**
+ * @brief Consumes many Kafka topic partitions in the background into batches
+ *
+ * A background thread polls all the assigned partitions and fills fixed-size pinned host buffers
+ * with messages. Two buffers are used, so the next batch is consumed while the caller processes
+ * the previous one. A batch is complete when its buffer is full or `batch_timeout` milliseconds
+ * after its first message.
+ *
+ * Offsets are not committed automatically: call `commit` once a batch has been processed so that
+ * a restarted consumer resumes after it.
+ **/
+class kafka_batch_consumer {
+ public:
+  /**
+   * @brief Instantiate a consumer of the given topic partitions and start consuming. Documentation
+   * for librdkafka configurations can be found at
+   * https://github.com/edenhill/librdkafka/blob/master/CONFIGURATION.md
+   *
+   * @throw cudf::logic_error if a configuration is invalid or `group.id` is not configured
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka client; `enable.auto.commit` defaults to `false`
+   * @param assignment topic partitions to consume and the offset to start consuming each from
+   * @param batch_size capacity in bytes of each batch buffer; a message with its delimiter must
+   * fit into one buffer
+   * @param batch_timeout maximum time (milliseconds) a batch waits to be filled after its first
+   * message
+   * @param delimiter optional delimiter to insert into the output after each message, Ex: "\n"
+   **/
+  kafka_batch_consumer(std::map<std::string, std::string> const &configs,
+                       std::vector<topic_partition_offset> const &assignment,
+                       size_t batch_size,
+                       int batch_timeout,
+                       std::string delimiter);
+
+  /**
+   * @brief Stops consuming and closes the Kafka consumer
+   *
+   * Batches returned by `next_batch` remain valid.
+   **/
+  ~kafka_batch_consumer();
+
+  /**
+   * @brief Returns the next complete batch of messages
+   *
+   * @throw cudf::logic_error if the background consumption failed
+   *
+   * @param timeout maximum time (milliseconds) to wait for a batch
+   *
+   * @return The batch, or `nullptr` if no batch was completed within `timeout`
+   **/
+  std::unique_ptr<kafka_batch> next_batch(int timeout);
+
+  /**
+   * @brief Synchronously commits the offsets that follow the messages of `batch`
+   *
+   * @throw cudf::logic_error if the commit fails
+   *
+   * @param batch A processed batch returned by `next_batch`
+   **/
+  void commit(kafka_batch const &batch);
+
+ private:
+  /**
+   * @brief A batch filled by the background thread and not yet returned by `next_batch`
+   **/
+  struct ready_batch {
+    uint8_t *data;
+    size_t size;
+    size_t num_messages;
+    std::vector<topic_partition_offset> next_offsets;
+  };
+
+  /**
+   * @brief Body of the background thread: fills batches until the consumer is destroyed
+   **/
+  void consume_batches();
+
+  std::unique_ptr<RdKafka::Conf> kafka_conf;  // RDKafka configuration object
+  std::unique_ptr<RdKafka::KafkaConsumer> consumer;
+  std::shared_ptr<pinned_buffer_pool> buffers;
+  size_t const batch_size;
+  int const batch_timeout;
+  std::string const delimiter;
+
+  std::mutex ready_mutex;
+  std::condition_variable ready_condition;
+  std::deque<ready_batch> ready;
+  std::exception_ptr error;
+  std::atomic<bool> stopping{false};
+
+  std::thread consumer_thread;
+};
+
+}  // namespace kafka
+}  // namespace external
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <librdkafka/rdkafkacpp.h>
+#include <atomic>
+#include <cudf/io/data_sink.hpp>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace external {
+namespace kafka {
+
+/**
+ * @brief How the bytes written to a `kafka_producer` are split into Kafka messages
+ **/
+enum class message_framing {
+  ROWS,   ///< One message per delimited record, Ex: a CSV or JSON lines row
+  BATCHES  ///< Messages of up to `max_message_size` bytes, each ending on a record boundary
+};
+
+/**
+ * @brief libcudf data_sink that produces the writer output to an Apache Kafka topic
+ *
+ * Passing the producer to the CSV or JSON writers streams the results back to Kafka without an
+ * intermediate file. Written bytes are copied into librdkafka's queue and delivered
+ * asynchronously; a record split across two writes is held back until it is complete. `flush()`
+ * produces any held-back bytes, waits for the outstanding deliveries and reports failures.
+ *
+ * @ingroup io_writers
+ **/
+class kafka_producer : public cudf::io::data_sink {
+ public:
+  /**
+   * @brief Instantiate a Kafka producer object. Documentation for librdkafka configurations can be
+   * found at https://github.com/edenhill/librdkafka/blob/master/CONFIGURATION.md
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka client
+   * @param topic_name name of the Kafka topic to produce to
+   * @param partition partition to produce to, or `RdKafka::Topic::PARTITION_UA` to let the
+   * configured partitioner choose
+   * @param framing how the written bytes are split into messages
+   * @param delimiter record delimiter, Ex: "\n"; with `BATCHES` framing an empty delimiter splits
+   * the bytes at `max_message_size` regardless of record boundaries, as for Avro output
+   * @param max_message_size maximum size of the messages produced with `BATCHES` framing
+   * @param flush_timeout maximum (millisecond) time `flush()` waits for outstanding deliveries
+   **/
+  kafka_producer(std::map<std::string, std::string> configs,
+                 std::string topic_name,
+                 int32_t partition,
+                 message_framing framing,
+                 std::string delimiter,
+                 size_t max_message_size = 1 << 20,
+                 int flush_timeout        = 10000);
+
+  /**
+   * @brief Waits up to `flush_timeout` for outstanding deliveries; failures are not reported
+   **/
+  ~kafka_producer() override;
+
+  /**
+   * @brief Produces the complete messages in the buffer and holds back the rest
+   *
+   * @throw cudf::logic_error if librdkafka rejects a message
+   **/
+  void host_write(void const *data, size_t size) override;
+
+  /**
+   * @brief Produces the held-back bytes and waits for all outstanding deliveries
+   *
+   * @throw cudf::logic_error if deliveries are still outstanding after `flush_timeout`, or if any
+   * message failed to be delivered since the previous flush
+   **/
+  void flush() override;
+
+  /**
+   * @brief Returns the total number of bytes written to the sink
+   **/
+  size_t bytes_written() override { return _bytes_written; }
+
+  /**
+   * @brief Returns the number of messages produced so far
+   **/
+  size_t messages_produced() const { return _messages_produced; }
+
+  /**
+   * @brief Returns the number of messages whose delivery has been confirmed by the broker
+   **/
+  size_t messages_delivered() const { return _delivery_report.delivered; }
+
+ private:
+  /**
+   * @brief Counts the delivery reports; invoked by librdkafka from `poll()` and `flush()`
+   **/
+  struct delivery_report : public RdKafka::DeliveryReportCb {
+    void dr_cb(RdKafka::Message &message) override;
+
+    std::atomic<size_t> delivered{0};
+    std::atomic<size_t> failed{0};
+  };
+
+  /**
+   * @brief Produces one message, waiting for space if librdkafka's queue is full
+   **/
+  void produce(char const *data, size_t size);
+
+  /**
+   * @brief Produces the messages of `_pending`, holding back an incomplete final record
+   *
+   * @param flush_all whether to also produce the incomplete final record
+   **/
+  void produce_pending(bool flush_all);
+
+  std::unique_ptr<RdKafka::Conf> kafka_conf;  // RDKafka configuration object
+  delivery_report _delivery_report;
+  std::unique_ptr<RdKafka::Producer> producer;
+  std::unique_ptr<RdKafka::Topic> topic;
+  int32_t const partition;
+  message_framing const framing;
+  std::string const delimiter;
+  size_t const max_message_size;
+  int const flush_timeout;
+
+  std::string _pending;  // Bytes not produced yet
+  size_t _bytes_written     = 0;
+  size_t _messages_produced = 0;
+};
+
+}  // namespace kafka
+}  // namespace external
+}  // namespace io
+}  // namespace cudf
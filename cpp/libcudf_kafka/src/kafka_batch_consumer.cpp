@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cudf_kafka/kafka_batch_consumer.hpp"
+#include <librdkafka/rdkafkacpp.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+namespace cudf {
+namespace io {
+namespace external {
+namespace kafka {
+
+namespace {
+// Number of buffers: one filled by the consumer thread while the caller processes the other
+constexpr size_t num_batch_buffers = 2;
+// Poll interval while waiting for the first message of a batch, so that stopping is noticed
+constexpr int idle_poll_interval = 100;
+
+struct pinned_deleter {
+  void operator()(uint8_t *ptr) const { cudaFreeHost(ptr); }
+};
+
+/**
+ * @brief Creates the librdkafka partitions of `offsets`; the caller destroys them
+ **/
+std::vector<RdKafka::TopicPartition *> make_topic_partitions(
+  std::vector<topic_partition_offset> const &offsets)
+{
+  std::vector<RdKafka::TopicPartition *> partitions;
+  for (auto const &offset : offsets) {
+    partitions.push_back(
+      RdKafka::TopicPartition::create(offset.topic, offset.partition, offset.offset));
+  }
+  return partitions;
+}
+}  // namespace
+
+/**
+ * @brief Fixed set of pinned host buffers shared by a consumer and its batches
+ *
+ * Batches hold a reference to the pool, so the buffers outlive the consumer.
+ **/
+class pinned_buffer_pool {
+ public:
+  pinned_buffer_pool(size_t num_buffers, size_t buffer_size)
+  {
+    for (size_t i = 0; i < num_buffers; ++i) {
+      uint8_t *ptr = nullptr;
+      CUDA_TRY(cudaMallocHost(&ptr, buffer_size));
+      _buffers.emplace_back(ptr);
+      _free.push_back(ptr);
+    }
+  }
+
+  /**
+   * @brief Waits for a free buffer; returns `nullptr` once `shutdown` is called
+   **/
+  uint8_t *acquire()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [this] { return _shutdown || !_free.empty(); });
+    if (_shutdown) { return nullptr; }
+    auto const ptr = _free.back();
+    _free.pop_back();
+    return ptr;
+  }
+
+  void release(uint8_t *ptr)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _free.push_back(ptr);
+    _condition.notify_one();
+  }
+
+  void shutdown()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shutdown = true;
+    _condition.notify_all();
+  }
+
+ private:
+  std::vector<std::unique_ptr<uint8_t, pinned_deleter>> _buffers;
+  std::vector<uint8_t *> _free;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _shutdown = false;
+};
+
+kafka_batch::kafka_batch(std::shared_ptr<pinned_buffer_pool> pool,
+                         uint8_t *data,
+                         size_t size,
+                         size_t num_messages,
+                         std::vector<topic_partition_offset> next_offsets)
+  : _pool(std::move(pool)),
+    _data(data),
+    _size(size),
+    _num_messages(num_messages),
+    _next_offsets(std::move(next_offsets))
+{
+}
+
+kafka_batch::~kafka_batch() { _pool->release(_data); }
+
+std::unique_ptr<cudf::io::datasource::buffer> kafka_batch::host_read(size_t offset, size_t size)
+{
+  if (offset > _size) { return std::make_unique<non_owning_buffer>(); }
+  size = std::min(size, _size - offset);
+  return std::make_unique<non_owning_buffer>(_data + offset, size);
+}
+
+size_t kafka_batch::host_read(size_t offset, size_t size, uint8_t *dst)
+{
+  if (offset > _size) { return 0; }
+  auto const read_size = std::min(size, _size - offset);
+  memcpy(dst, _data + offset, read_size);
+  return read_size;
+}
+
+kafka_batch_consumer::kafka_batch_consumer(std::map<std::string, std::string> const &configs,
+                                           std::vector<topic_partition_offset> const &assignment,
+                                           size_t batch_size,
+                                           int batch_timeout,
+                                           std::string delimiter)
+  : batch_size(batch_size), batch_timeout(batch_timeout), delimiter(delimiter)
+{
+  kafka_conf = std::unique_ptr<RdKafka::Conf>(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
+
+  // offsets are committed by the caller once a batch is processed
+  std::string error_string;
+  CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK ==
+                 kafka_conf->set("enable.auto.commit", "false", error_string),
+               "Invalid Kafka configuration");
+  for (auto const &key_value : configs) {
+    CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK ==
+                   kafka_conf->set(key_value.first, key_value.second, error_string),
+                 "Invalid Kafka configuration");
+  }
+
+  std::string conf_val;
+  CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK == kafka_conf->get("group.id", conf_val),
+               "Kafka group.id must be configured");
+
+  std::string errstr;
+  consumer = std::unique_ptr<RdKafka::KafkaConsumer>(
+    RdKafka::KafkaConsumer::create(kafka_conf.get(), errstr));
+  CUDF_EXPECTS(consumer != nullptr, "Failed to create the Kafka consumer");
+
+  auto partitions   = make_topic_partitions(assignment);
+  auto const result = consumer->assign(partitions);
+  RdKafka::TopicPartition::destroy(partitions);
+  CUDF_EXPECTS(result == RdKafka::ErrorCode::ERR_NO_ERROR,
+               "Failed to assign the Kafka topic partitions");
+
+  buffers         = std::make_shared<pinned_buffer_pool>(num_batch_buffers, batch_size);
+  consumer_thread = std::thread(&kafka_batch_consumer::consume_batches, this);
+}
+
+kafka_batch_consumer::~kafka_batch_consumer()
+{
+  stopping = true;
+  buffers->shutdown();
+  consumer_thread.join();
+  consumer->close();
+  for (auto const &batch : ready) {
+    buffers->release(batch.data);
+  }
+}
+
+std::unique_ptr<kafka_batch> kafka_batch_consumer::next_batch(int timeout)
+{
+  std::unique_lock<std::mutex> lock(ready_mutex);
+  ready_condition.wait_for(lock, std::chrono::milliseconds(timeout), [this] {
+    return !ready.empty() || error != nullptr;
+  });
+  if (ready.empty()) {
+    if (error != nullptr) { std::rethrow_exception(error); }
+    return nullptr;
+  }
+  auto batch = std::move(ready.front());
+  ready.pop_front();
+  return std::unique_ptr<kafka_batch>(new kafka_batch(
+    buffers, batch.data, batch.size, batch.num_messages, std::move(batch.next_offsets)));
+}
+
+void kafka_batch_consumer::commit(kafka_batch const &batch)
+{
+  auto offsets      = make_topic_partitions(batch.next_offsets());
+  auto const result = consumer->commitSync(offsets);
+  RdKafka::TopicPartition::destroy(offsets);
+  CUDF_EXPECTS(result == RdKafka::ErrorCode::ERR_NO_ERROR, "Failed to commit the Kafka offsets");
+}
+
+void kafka_batch_consumer::consume_batches()
+{
+  // message read into the previous batch that did not fit into it
+  std::unique_ptr<RdKafka::Message> pending;
+  try {
+    for (auto data = buffers->acquire(); data != nullptr; data = buffers->acquire()) {
+      size_t size         = 0;
+      size_t num_messages = 0;
+      std::map<std::pair<std::string, int>, int64_t> next_offsets;
+      auto deadline = std::chrono::steady_clock::time_point::max();
+
+      while (!stopping && std::chrono::steady_clock::now() < deadline) {
+        auto const poll_timeout =
+          num_messages == 0
+            ? idle_poll_interval
+            : std::max<int64_t>(0,
+                                std::chrono::duration_cast<std::chrono::milliseconds>(
+                                  deadline - std::chrono::steady_clock::now())
+                                  .count());
+        std::unique_ptr<RdKafka::Message> msg{
+          pending != nullptr ? pending.release() : consumer->consume(poll_timeout)};
+
+        if (msg->err() == RdKafka::ErrorCode::ERR__TIMED_OUT ||
+            msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
+          continue;
+        }
+        if (msg->err() != RdKafka::ErrorCode::ERR_NO_ERROR) {
+          throw cudf::logic_error("Kafka consume failed: " + msg->errstr());
+        }
+
+        auto const message_size = msg->len() + delimiter.size();
+        CUDF_EXPECTS(message_size <= batch_size, "Kafka message does not fit into a batch");
+        if (size + message_size > batch_size) {
+          pending = std::move(msg);
+          break;
+        }
+        memcpy(data + size, msg->payload(), msg->len());
+        memcpy(data + size + msg->len(), delimiter.data(), delimiter.size());
+        size += message_size;
+        next_offsets[{msg->topic_name(), msg->partition()}] = msg->offset() + 1;
+        if (num_messages++ == 0) {
+          deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
+        }
+      }
+
+      if (num_messages == 0) {
+        buffers->release(data);
+        continue;
+      }
+      std::vector<topic_partition_offset> offsets;
+      for (auto const &next_offset : next_offsets) {
+        offsets.push_back(
+          {next_offset.first.first, next_offset.first.second, next_offset.second});
+      }
+      std::lock_guard<std::mutex> lock(ready_mutex);
+      ready.push_back({data, size, num_messages, std::move(offsets)});
+      ready_condition.notify_one();
+    }
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(ready_mutex);
+    error = std::current_exception();
+    ready_condition.notify_all();
+  }
+}
+
+}  // namespace kafka
+}  // namespace external
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cudf_kafka/kafka_producer.hpp"
+#include <librdkafka/rdkafkacpp.h>
+#include <algorithm>
+#include <memory>
+
+namespace cudf {
+namespace io {
+namespace external {
+namespace kafka {
+
+namespace {
+// Time to wait for librdkafka to deliver queued messages when its queue is full
+constexpr int queue_full_poll_interval = 100;
+}  // namespace
+
+void kafka_producer::delivery_report::dr_cb(RdKafka::Message &message)
+{
+  if (message.err() == RdKafka::ERR_NO_ERROR) {
+    ++delivered;
+  } else {
+    ++failed;
+  }
+}
+
+kafka_producer::kafka_producer(std::map<std::string, std::string> configs,
+                               std::string topic_name,
+                               int32_t partition,
+                               message_framing framing,
+                               std::string delimiter,
+                               size_t max_message_size,
+                               int flush_timeout)
+  : partition(partition),
+    framing(framing),
+    delimiter(delimiter),
+    max_message_size(max_message_size),
+    flush_timeout(flush_timeout)
+{
+  CUDF_EXPECTS(framing != message_framing::ROWS || !delimiter.empty(),
+               "ROWS framing requires a record delimiter");
+  CUDF_EXPECTS(max_message_size > delimiter.size(), "Invalid maximum Kafka message size");
+
+  kafka_conf = std::unique_ptr<RdKafka::Conf>(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
+
+  for (auto const &key_value : configs) {
+    std::string error_string;
+    CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK ==
+                   kafka_conf->set(key_value.first, key_value.second, error_string),
+                 "Invalid Kafka configuration");
+  }
+  std::string error_string;
+  CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK ==
+                 kafka_conf->set("dr_cb", &_delivery_report, error_string),
+               "Failed to set the Kafka delivery report callback");
+
+  std::string errstr;
+  producer =
+    std::unique_ptr<RdKafka::Producer>(RdKafka::Producer::create(kafka_conf.get(), errstr));
+  CUDF_EXPECTS(producer != nullptr, "Failed to create the Kafka producer");
+
+  topic = std::unique_ptr<RdKafka::Topic>(
+    RdKafka::Topic::create(producer.get(), topic_name, nullptr, errstr));
+  CUDF_EXPECTS(topic != nullptr, "Failed to create the Kafka topic handle");
+}
+
+kafka_producer::~kafka_producer()
+{
+  // Destructors must not throw; held-back bytes are produced without checking the deliveries
+  try {
+    produce_pending(true);
+  } catch (...) {
+  }
+  producer->flush(flush_timeout);
+}
+
+void kafka_producer::produce(char const *data, size_t size)
+{
+  while (true) {
+    // RK_MSG_COPY: the writer reuses its buffers as soon as `host_write` returns
+    auto const err = producer->produce(topic.get(),
+                                       partition,
+                                       RdKafka::Producer::RK_MSG_COPY,
+                                       const_cast<char *>(data),
+                                       size,
+                                       nullptr,
+                                       nullptr);
+    if (err != RdKafka::ERR__QUEUE_FULL) {
+      CUDF_EXPECTS(err == RdKafka::ERR_NO_ERROR, "Failed to produce the Kafka message");
+      break;
+    }
+    producer->poll(queue_full_poll_interval);
+  }
+  ++_messages_produced;
+  // Serves the delivery reports of the earlier messages without blocking
+  producer->poll(0);
+}
+
+void kafka_producer::produce_pending(bool flush_all)
+{
+  size_t pos = 0;
+  if (framing == message_framing::ROWS) {
+    // Records are produced without their delimiter; empty records are skipped
+    for (auto end = _pending.find(delimiter); end != std::string::npos;
+         end = _pending.find(delimiter, pos)) {
+      if (end > pos) { produce(_pending.data() + pos, end - pos); }
+      pos = end + delimiter.size();
+    }
+    if (flush_all && pos < _pending.size()) {
+      produce(_pending.data() + pos, _pending.size() - pos);
+      pos = _pending.size();
+    }
+  } else {
+    // Batches keep the delimiters so that the concatenated messages parse like the written bytes
+    while (pos < _pending.size() && (flush_all || _pending.size() - pos >= max_message_size)) {
+      auto const remaining = _pending.size() - pos;
+      auto size            = std::min(remaining, max_message_size);
+      if (!delimiter.empty() && remaining > max_message_size) {
+        auto const last = _pending.rfind(delimiter, pos + max_message_size - delimiter.size());
+        if (last != std::string::npos && last >= pos) {
+          size = last + delimiter.size() - pos;
+        } else {
+          // A record longer than the maximum message size is produced as a single message
+          auto const next = _pending.find(delimiter, pos + max_message_size);
+          if (next == std::string::npos && !flush_all) { break; }
+          size = (next == std::string::npos) ? remaining : next + delimiter.size() - pos;
+        }
+      }
+      produce(_pending.data() + pos, size);
+      pos += size;
+    }
+  }
+  _pending.erase(0, pos);
+}
+
+void kafka_producer::host_write(void const *data, size_t size)
+{
+  _pending.append(static_cast<char const *>(data), size);
+  _bytes_written += size;
+  produce_pending(false);
+}
+
+void kafka_producer::flush()
+{
+  produce_pending(true);
+  CUDF_EXPECTS(producer->flush(flush_timeout) == RdKafka::ERR_NO_ERROR,
+               "Timed out waiting for the Kafka message deliveries");
+  CUDF_EXPECTS(_delivery_report.failed.exchange(0) == 0, "Failed to deliver Kafka messages");
+}
+
+}  // namespace kafka
+}  // namespace external
+}  // namespace io
+}  // namespace cudf
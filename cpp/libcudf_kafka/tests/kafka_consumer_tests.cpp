@@ -18,7 +18,10 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
+#include "cudf_kafka/kafka_batch_consumer.hpp"
 #include "cudf_kafka/kafka_consumer.hpp"
+#include "cudf_kafka/kafka_producer.hpp"
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/functions.hpp>
@@ -54,3 +57,79 @@ TEST_F(KafkaDatasourceTest, InvalidConfigValues)
   EXPECT_THROW(kafka::kafka_consumer kc(kafka_configs, "csv-topic", 0, 0, 3, 5000, "\n"),
                cudf::logic_error);
 }
+
+TEST_F(KafkaDatasourceTest, BatchConsumerMissingGroupID)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs.insert({"bootstrap.servers", "localhost:9092"});
+  std::vector<kafka::topic_partition_offset> assignment{{"csv-topic", 0, 0}, {"csv-topic", 1, 0}};
+
+  EXPECT_THROW(kafka::kafka_batch_consumer kc(kafka_configs, assignment, 1 << 20, 100, "\n"),
+               cudf::logic_error);
+}
+
+TEST_F(KafkaDatasourceTest, BatchConsumerInvalidConfigValues)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs.insert({"group.id", "batch-test"});
+  kafka_configs.insert({"message.max.bytes", "this should be a number not text"});
+  std::vector<kafka::topic_partition_offset> assignment{{"csv-topic", 0, 0}};
+
+  EXPECT_THROW(kafka::kafka_batch_consumer kc(kafka_configs, assignment, 1 << 20, 100, "\n"),
+               cudf::logic_error);
+}
+
+TEST_F(KafkaDatasourceTest, ProducerInvalidConfigValues)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs.insert({"message.max.bytes", "this should be a number not text"});
+
+  EXPECT_THROW(kafka::kafka_producer kp(
+                 kafka_configs, "csv-topic", 0, kafka::message_framing::ROWS, "\n"),
+               cudf::logic_error);
+
+  // Rows can only be split on a delimiter
+  kafka_configs.clear();
+  EXPECT_THROW(
+    kafka::kafka_producer kp(kafka_configs, "csv-topic", 0, kafka::message_framing::ROWS, ""),
+    cudf::logic_error);
+}
+
+// Messages are queued by librdkafka, so the framing is observable without a broker
+std::map<std::string, std::string> unreachable_broker_configs()
+{
+  return {{"bootstrap.servers", "localhost:1"}, {"message.timeout.ms", "100"}};
+}
+
+TEST_F(KafkaDatasourceTest, ProducerRowFraming)
+{
+  kafka::kafka_producer kp(
+    unreachable_broker_configs(), "csv-topic", 0, kafka::message_framing::ROWS, "\n", 1 << 20, 10);
+
+  std::string const first  = "a,1\nb,2\nc,";
+  std::string const second = "3\n\nd,4";
+  kp.host_write(first.data(), first.size());
+  EXPECT_EQ(kp.messages_produced(), 2u);
+  // The incomplete row is completed by the next write
+  kp.host_write(second.data(), second.size());
+  EXPECT_EQ(kp.messages_produced(), 3u);
+  EXPECT_EQ(kp.bytes_written(), first.size() + second.size());
+
+  // Flushing produces the final row; its delivery fails without a broker
+  EXPECT_THROW(kp.flush(), cudf::logic_error);
+  EXPECT_EQ(kp.messages_produced(), 4u);
+  EXPECT_EQ(kp.messages_delivered(), 0u);
+}
+
+TEST_F(KafkaDatasourceTest, ProducerBatchFraming)
+{
+  kafka::kafka_producer kp(
+    unreachable_broker_configs(), "csv-topic", 0, kafka::message_framing::BATCHES, "\n", 10, 10);
+
+  // Batches of up to 10 bytes end on a row boundary
+  std::string const rows = "aaa\nbbb\nccc\nddd\n";
+  kp.host_write(rows.data(), rows.size());
+  EXPECT_EQ(kp.messages_produced(), 1u);
+  EXPECT_THROW(kp.flush(), cudf::logic_error);
+  EXPECT_EQ(kp.messages_produced(), 2u);
+}
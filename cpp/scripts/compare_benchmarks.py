@@ -0,0 +1,140 @@
+# Copyright (c) 2020, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""Compares the Google Benchmark JSON output of two libcudf benchmark runs.
+
+Produce the inputs with
+    ./GATHER_BENCH --benchmark_out=<file>.json --benchmark_out_format=json
+on the baseline and on the candidate build. Runs are matched by name; with
+--benchmark_repetitions the mean aggregate of each run is compared. The
+script prints the change of the time, of the throughput and of the peak
+memory of every run, and exits with status 1 if any run regressed by more
+than the threshold.
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import sys
+
+# Counter name -> True if a larger value is better
+COUNTERS = {
+    "bytes_per_second": True,
+    "percent_of_peak_bw": True,
+    "peak_memory_usage": False,
+}
+
+
+def parse_args():
+    argparser = argparse.ArgumentParser(
+        "Compares two libcudf benchmark JSON outputs"
+    )
+    argparser.add_argument("baseline", help="JSON output of the baseline run")
+    argparser.add_argument(
+        "candidate", help="JSON output of the candidate run"
+    )
+    argparser.add_argument(
+        "-threshold",
+        type=float,
+        default=5.0,
+        help="Relative change in percent above which a run is flagged",
+    )
+    argparser.add_argument(
+        "-filter",
+        type=str,
+        default="",
+        help="Only compare the runs whose name contains this string",
+    )
+    return argparser.parse_args()
+
+
+def load_runs(path):
+    """Returns the runs of a JSON output, keyed by name"""
+    with open(path) as f:
+        data = json.load(f)
+    runs = {}
+    for run in data.get("benchmarks", []):
+        if run.get("run_type") == "aggregate":
+            if run.get("aggregate_name") != "mean":
+                continue
+            runs[run["run_name"]] = run
+        elif run.get("run_name", run["name"]) not in runs:
+            runs[run.get("run_name", run["name"])] = run
+    return runs
+
+
+def to_seconds(run):
+    scale = {"ns": 1e-9, "us": 1e-6, "ms": 1e-3, "s": 1.0}
+    return run["real_time"] * scale[run.get("time_unit", "ns")]
+
+
+def relative_change(baseline, candidate):
+    if baseline == 0:
+        return 0.0
+    return 100.0 * (candidate - baseline) / baseline
+
+
+def compare(baseline, candidate, threshold, name_filter):
+    """Prints the changes and returns the names of the regressed runs"""
+    regressions = []
+    names = sorted(set(baseline) & set(candidate))
+    for name in names:
+        if name_filter not in name:
+            continue
+        base, cand = baseline[name], candidate[name]
+        changes = [("time", relative_change(to_seconds(base), to_seconds(cand)))]
+        regressed = changes[0][1] > threshold
+        for counter, larger_is_better in COUNTERS.items():
+            if counter in base and counter in cand:
+                change = relative_change(base[counter], cand[counter])
+                changes.append((counter, change))
+                regressed |= (-change if larger_is_better else change) > threshold
+        print(
+            "{:<60} {} {}".format(
+                name,
+                " ".join("{}:{:+.1f}%".format(c, v) for c, v in changes),
+                "REGRESSION" if regressed else "",
+            )
+        )
+        if regressed:
+            regressions.append(name)
+
+    for name in sorted(set(baseline) - set(candidate)):
+        print("{:<60} missing from the candidate".format(name))
+    for name in sorted(set(candidate) - set(baseline)):
+        print("{:<60} new in the candidate".format(name))
+    return regressions
+
+
+def main():
+    args = parse_args()
+    regressions = compare(
+        load_runs(args.baseline),
+        load_runs(args.candidate),
+        args.threshold,
+        args.filter,
+    )
+    if regressions:
+        print(
+            "{} runs regressed by more than {}%".format(
+                len(regressions), args.threshold
+            )
+        )
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
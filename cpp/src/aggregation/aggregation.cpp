@@ -16,6 +16,8 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <memory>
@@ -116,6 +118,39 @@ std::unique_ptr<aggregation> make_row_number_aggregation()
 {
   return std::make_unique<aggregation>(aggregation::ROW_NUMBER);
 }
+/// Factory to create a LEAD aggregation
+std::unique_ptr<aggregation> make_lead_aggregation(size_type offset)
+{
+  return std::make_unique<detail::lead_lag_aggregation>(aggregation::LEAD, offset);
+}
+/// Factory to create a LAG aggregation
+std::unique_ptr<aggregation> make_lag_aggregation(size_type offset)
+{
+  return std::make_unique<detail::lead_lag_aggregation>(aggregation::LAG, offset);
+}
+/// Factory to create a COLLECT aggregation
+std::unique_ptr<aggregation> make_collect_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::COLLECT);
+}
+/// Factory to create a RANK aggregation
+std::unique_ptr<aggregation> make_rank_aggregation()
+{
+  return std::make_unique<aggregation>(aggregation::RANK);
+}
+/// Factory to create an APPROX_COUNT_DISTINCT aggregation
+std::unique_ptr<aggregation> make_approx_count_distinct_aggregation(int precision)
+{
+  return std::make_unique<detail::approx_count_distinct_aggregation>(
+    aggregation::APPROX_COUNT_DISTINCT, precision);
+}
+/// Factory to create an APPROX_QUANTILE aggregation
+std::unique_ptr<aggregation> make_approx_quantile_aggregation(std::vector<double> const& q,
+                                                              double compression)
+{
+  return std::make_unique<detail::approx_quantile_aggregation>(
+    aggregation::APPROX_QUANTILE, q, compression);
+}
 /// Factory to create a UDF aggregation
 std::unique_ptr<aggregation> make_udf_aggregation(udf_type type,
                                                   std::string const& user_defined_aggregator,
@@ -145,17 +180,42 @@ struct is_valid_aggregation_impl {
     return is_valid_aggregation<Source, k>();
   }
 };
+
+// Aggregations whose result on the stored integers of a fixed-point column is not the
+// representation of a fixed-point result with the scale of the column
+constexpr bool is_scale_dependent_aggregation(aggregation::Kind k)
+{
+  return k == aggregation::PRODUCT || k == aggregation::SUM_OF_SQUARES ||
+         k == aggregation::MEAN || k == aggregation::VARIANCE || k == aggregation::STD ||
+         k == aggregation::MEDIAN || k == aggregation::QUANTILE;
+}
 }  // namespace
 
 // Return target data_type for the given source_type and aggregation
 data_type target_type(data_type source, aggregation::Kind k)
 {
+  // COLLECT gathers the elements of any type into lists
+  if (k == aggregation::COLLECT) { return data_type{type_id::LIST}; }
+  // Fixed-point aggregations are computed on the stored integers; the results that represent
+  // values of the source keep its scale
+  if (is_fixed_point(source)) {
+    CUDF_EXPECTS(not is_scale_dependent_aggregation(k),
+                 "Unsupported aggregation for fixed-point type");
+    if (k == aggregation::MIN || k == aggregation::MAX || k == aggregation::NTH_ELEMENT) {
+      return source;
+    }
+    if (k == aggregation::SUM) { return data_type{type_id::DECIMAL64, source.scale()}; }
+  }
   return dispatch_type_and_aggregation(source, k, target_type_functor{});
 }
 
 // Verifies the aggregation `k` is valid on the type `source`
 bool is_valid_aggregation(data_type source, aggregation::Kind k)
 {
+  if (k == aggregation::COLLECT) { return true; }
+  // UDFs are checked when they are compiled
+  if (k == aggregation::PTX || k == aggregation::CUDA) { return true; }
+  if (is_fixed_point(source) && is_scale_dependent_aggregation(k)) { return false; }
   return dispatch_type_and_aggregation(source, k, is_valid_aggregation_impl{});
 }
 }  // namespace detail
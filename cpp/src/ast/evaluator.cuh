@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "linearizer.hpp"
+
+#include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cstring>
+#include <vector>
+
+namespace cudf {
+namespace ast {
+namespace detail {
+/**
+ * @brief Value of an operand or of an intermediate result
+ */
+struct value {
+  union {
+    int64_t i;  ///< BOOL and INTEGER values
+    double f;   ///< FLOAT values
+  };
+  bool valid;
+};
+
+struct literal_converter {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>()> * = nullptr>
+  value operator()(scalar const &input, cudaStream_t stream)
+  {
+    auto const &typed = static_cast<numeric_scalar<T> const &>(input);
+    value result{};
+    result.valid = typed.is_valid(stream);
+    if (result.valid) {
+      if (std::is_floating_point<T>::value) {
+        result.f = static_cast<double>(typed.value(stream));
+      } else {
+        result.i = static_cast<int64_t>(typed.value(stream));
+      }
+    }
+    return result;
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_numeric<T>()> * = nullptr>
+  value operator()(scalar const &, cudaStream_t)
+  {
+    CUDF_FAIL("Only numeric and BOOL8 literals are supported in expressions");
+  }
+};
+
+struct column_loader {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>()> * = nullptr>
+  __device__ void operator()(column_device_view const &col, size_type row, value &result)
+  {
+    if (std::is_floating_point<T>::value) {
+      result.f = static_cast<double>(col.element<T>(row));
+    } else {
+      result.i = static_cast<int64_t>(col.element<T>(row));
+    }
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_numeric<T>()> * = nullptr>
+  __device__ void operator()(column_device_view const &, size_type, value &)
+  {
+    release_assert(false && "Unsupported column type in expression");
+  }
+};
+
+__device__ inline double as_float(value const &v, value_class type)
+{
+  return (type == value_class::FLOAT) ? v.f : static_cast<double>(v.i);
+}
+
+__device__ inline bool as_bool(value const &v, value_class type)
+{
+  return (type == value_class::FLOAT) ? (v.f != 0) : (v.i != 0);
+}
+
+// Signed overflow wraps around instead of being undefined
+__device__ inline int64_t wrap(uint64_t v) { return static_cast<int64_t>(v); }
+
+__device__ inline value load_column(column_device_view const &col, size_type row)
+{
+  value result;
+  result.i     = 0;
+  result.valid = col.is_valid(row);
+  if (result.valid) { type_dispatcher(col.type(), column_loader{}, col, row, result); }
+  return result;
+}
+
+__device__ inline value evaluate(instruction const &ins, value const &lhs, value const &rhs)
+{
+  auto const lhs_type = ins.inputs[0].type;
+  auto const rhs_type = ins.inputs[1].type;
+  bool const is_float = ins.operand_type == value_class::FLOAT;
+  auto const lhs_f    = is_float ? as_float(lhs, lhs_type) : 0.;
+  auto const rhs_f    = is_float ? as_float(rhs, rhs_type) : 0.;
+  value out;
+  out.i     = 0;
+  out.valid = lhs.valid && rhs.valid;
+  switch (ins.op) {
+    case ast_operator::ADD:
+      if (is_float) {
+        out.f = lhs_f + rhs_f;
+      } else {
+        out.i = wrap(static_cast<uint64_t>(lhs.i) + static_cast<uint64_t>(rhs.i));
+      }
+      break;
+    case ast_operator::SUB:
+      if (is_float) {
+        out.f = lhs_f - rhs_f;
+      } else {
+        out.i = wrap(static_cast<uint64_t>(lhs.i) - static_cast<uint64_t>(rhs.i));
+      }
+      break;
+    case ast_operator::MUL:
+      if (is_float) {
+        out.f = lhs_f * rhs_f;
+      } else {
+        out.i = wrap(static_cast<uint64_t>(lhs.i) * static_cast<uint64_t>(rhs.i));
+      }
+      break;
+    case ast_operator::DIV:
+      if (is_float) {
+        out.f = lhs_f / rhs_f;
+      } else if (rhs.i == 0) {
+        out.valid = false;
+      } else {
+        out.i = (rhs.i == -1) ? wrap(0 - static_cast<uint64_t>(lhs.i)) : lhs.i / rhs.i;
+      }
+      break;
+    case ast_operator::TRUE_DIV: out.f = lhs_f / rhs_f; break;
+    case ast_operator::MOD:
+      if (is_float) {
+        out.f = fmod(lhs_f, rhs_f);
+      } else if (rhs.i == 0) {
+        out.valid = false;
+      } else {
+        out.i = (rhs.i == -1) ? 0 : lhs.i % rhs.i;
+      }
+      break;
+    case ast_operator::EQUAL: out.i = is_float ? lhs_f == rhs_f : lhs.i == rhs.i; break;
+    case ast_operator::NOT_EQUAL: out.i = is_float ? lhs_f != rhs_f : lhs.i != rhs.i; break;
+    case ast_operator::LESS: out.i = is_float ? lhs_f < rhs_f : lhs.i < rhs.i; break;
+    case ast_operator::GREATER: out.i = is_float ? lhs_f > rhs_f : lhs.i > rhs.i; break;
+    case ast_operator::LESS_EQUAL: out.i = is_float ? lhs_f <= rhs_f : lhs.i <= rhs.i; break;
+    case ast_operator::GREATER_EQUAL: out.i = is_float ? lhs_f >= rhs_f : lhs.i >= rhs.i; break;
+    case ast_operator::LOGICAL_AND: {
+      bool const lhs_false = lhs.valid && !as_bool(lhs, lhs_type);
+      bool const rhs_false = rhs.valid && !as_bool(rhs, rhs_type);
+      if (lhs_false || rhs_false) {
+        out.valid = true;
+      } else {
+        out.i = 1;
+      }
+      break;
+    }
+    case ast_operator::LOGICAL_OR: {
+      bool const lhs_true = lhs.valid && as_bool(lhs, lhs_type);
+      bool const rhs_true = rhs.valid && as_bool(rhs, rhs_type);
+      if (lhs_true || rhs_true) {
+        out.valid = true;
+        out.i     = 1;
+      }
+      break;
+    }
+    case ast_operator::NOT: out.i = !as_bool(lhs, lhs_type); break;
+    case ast_operator::NEGATE:
+      if (is_float) {
+        out.f = -lhs_f;
+      } else {
+        out.i = wrap(0 - static_cast<uint64_t>(lhs.i));
+      }
+      break;
+    case ast_operator::ABS:
+      if (is_float) {
+        out.f = fabs(lhs_f);
+      } else {
+        out.i = (lhs.i < 0) ? wrap(0 - static_cast<uint64_t>(lhs.i)) : lhs.i;
+      }
+      break;
+    case ast_operator::IS_NULL:
+      out.valid = true;
+      out.i     = !lhs.valid;
+      break;
+    default: release_assert(false && "Unsupported expression operator");
+  }
+  return out;
+}
+
+/**
+ * @brief Location and shape of a linearized expression in device memory
+ */
+struct plan_view {
+  void const *data;          ///< The literals followed by the instructions
+  int32_t num_literals;      ///< Number of literals
+  int32_t num_instructions;  ///< Number of instructions
+  operand result;            ///< Operand holding the value of the expression
+
+  __host__ __device__ size_t size() const
+  {
+    return num_literals * sizeof(value) + num_instructions * sizeof(instruction);
+  }
+
+  __device__ value const *literals() const { return static_cast<value const *>(data); }
+
+  __device__ instruction const *instructions() const
+  {
+    return reinterpret_cast<instruction const *>(literals() + num_literals);
+  }
+};
+
+/**
+ * @brief Device copy of a linearized expression
+ *
+ * Kernels evaluating the plan stage it in `view().size()` bytes of dynamic shared memory.
+ */
+class device_plan {
+ public:
+  static constexpr size_t max_size = 48 * 1024;  ///< Dynamic shared memory without opt-in
+
+  /**
+   * @brief Copies the literal values and instructions of a linearized expression to the device
+   *
+   * @throw cudf::logic_error if the plan does not fit in `max_size` bytes
+   */
+  device_plan(expression_linearizer const &linearizer, cudaStream_t stream)
+  {
+    std::vector<value> literals;
+    for (auto const &lit : linearizer.literals()) {
+      literals.push_back(
+        type_dispatcher(lit.get().type(), literal_converter{}, lit.get(), stream));
+    }
+    auto const &instructions = linearizer.instructions();
+    _view = plan_view{nullptr,
+                      static_cast<int32_t>(literals.size()),
+                      static_cast<int32_t>(instructions.size()),
+                      linearizer.result()};
+    CUDF_EXPECTS(_view.size() <= max_size, "The expression is too large to evaluate");
+
+    auto const literals_size = literals.size() * sizeof(value);
+    std::vector<uint8_t> host_plan(_view.size());
+    std::memcpy(host_plan.data(), literals.data(), literals_size);
+    std::memcpy(host_plan.data() + literals_size,
+                instructions.data(),
+                instructions.size() * sizeof(instruction));
+    _buffer     = rmm::device_buffer(host_plan.data(), host_plan.size(), stream);
+    _view.data = _buffer.data();
+  }
+
+  plan_view const &view() const { return _view; }
+
+ private:
+  rmm::device_buffer _buffer;
+  plan_view _view;
+};
+
+/**
+ * @brief Copies a plan to shared memory and returns the view of the copy
+ *
+ * Must be called by all the threads of the block; synchronizes the block.
+ */
+__device__ inline plan_view stage_plan(plan_view const &plan, void *shared)
+{
+  auto const src = static_cast<int64_t const *>(plan.data);
+  auto const dst = static_cast<int64_t *>(shared);
+  // Both the value and instruction sizes are multiples of 8 bytes
+  for (size_t i = threadIdx.x; i < plan.size() / sizeof(int64_t); i += blockDim.x) {
+    dst[i] = src[i];
+  }
+  __syncthreads();
+  auto staged = plan;
+  staged.data = shared;
+  return staged;
+}
+
+/**
+ * @brief Evaluates a plan for a pair of rows of the left and right tables
+ *
+ * @param plan The plan, preferably staged in shared memory
+ * @param left The table of the `LEFT` column references
+ * @param right The table of the `RIGHT` column references
+ * @param left_row Row index in `left`
+ * @param right_row Row index in `right`
+ * @param registers Storage for `max_intermediates` intermediate results
+ */
+__device__ inline value evaluate_plan(plan_view const &plan,
+                                      table_device_view const &left,
+                                      table_device_view const &right,
+                                      size_type left_row,
+                                      size_type right_row,
+                                      value *registers)
+{
+  auto const literals = plan.literals();
+  auto load           = [&](operand const &op) {
+    switch (op.source) {
+      case operand_source::LEFT_COLUMN: return load_column(left.column(op.index), left_row);
+      case operand_source::RIGHT_COLUMN: return load_column(right.column(op.index), right_row);
+      case operand_source::LITERAL: return literals[op.index];
+      default: return registers[op.index];
+    }
+  };
+  auto const instructions = plan.instructions();
+  for (int32_t i = 0; i < plan.num_instructions; ++i) {
+    auto const &ins = instructions[i];
+    auto const lhs  = load(ins.inputs[0]);
+    value rhs;
+    rhs.i     = 0;
+    rhs.valid = true;
+    if (ast_operator_arity(ins.op) == 2) { rhs = load(ins.inputs[1]); }
+    registers[ins.output] = evaluate(ins, lhs, rhs);
+  }
+  return load(plan.result);
+}
+
+/**
+ * @brief Returns whether a predicate value is true; null is false
+ */
+__device__ inline bool is_true(value const &v, value_class type)
+{
+  return v.valid && as_bool(v, type);
+}
+
+}  // namespace detail
+}  // namespace ast
+}  // namespace cudf
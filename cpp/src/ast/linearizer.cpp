@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "linearizer.hpp"
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+namespace cudf {
+namespace ast {
+size_type literal::accept(detail::expression_linearizer &visitor) const
+{
+  return visitor.visit(*this);
+}
+
+size_type column_reference::accept(detail::expression_linearizer &visitor) const
+{
+  return visitor.visit(*this);
+}
+
+operation::operation(ast_operator op, expression const &input) : _op(op), _operands({input})
+{
+  CUDF_EXPECTS(ast_operator_arity(op) == 1, "The operator is not unary");
+}
+
+operation::operation(ast_operator op, expression const &left, expression const &right)
+  : _op(op), _operands({left, right})
+{
+  CUDF_EXPECTS(ast_operator_arity(op) == 2, "The operator is not binary");
+}
+
+size_type operation::accept(detail::expression_linearizer &visitor) const
+{
+  return visitor.visit(*this);
+}
+
+namespace detail {
+namespace {
+value_class value_class_of(data_type type)
+{
+  if (type.id() == type_id::BOOL8) { return value_class::BOOL; }
+  if (is_floating_point(type)) { return value_class::FLOAT; }
+  CUDF_EXPECTS(is_numeric(type), "Only numeric and BOOL8 types are supported in expressions");
+  return value_class::INTEGER;
+}
+
+value_class promote(value_class lhs, value_class rhs)
+{
+  return (lhs == value_class::FLOAT || rhs == value_class::FLOAT) ? value_class::FLOAT
+                                                                  : value_class::INTEGER;
+}
+
+/**
+ * @brief Returns the type of the operands and of the result of an operator
+ */
+std::pair<value_class, value_class> operator_types(ast_operator op,
+                                                   value_class lhs,
+                                                   value_class rhs)
+{
+  switch (op) {
+    case ast_operator::ADD:
+    case ast_operator::SUB:
+    case ast_operator::MUL:
+    case ast_operator::DIV:
+    case ast_operator::MOD: return {promote(lhs, rhs), promote(lhs, rhs)};
+    case ast_operator::TRUE_DIV: return {value_class::FLOAT, value_class::FLOAT};
+    case ast_operator::EQUAL:
+    case ast_operator::NOT_EQUAL:
+    case ast_operator::LESS:
+    case ast_operator::GREATER:
+    case ast_operator::LESS_EQUAL:
+    case ast_operator::GREATER_EQUAL: return {promote(lhs, rhs), value_class::BOOL};
+    case ast_operator::LOGICAL_AND:
+    case ast_operator::LOGICAL_OR:
+    case ast_operator::NOT: return {value_class::BOOL, value_class::BOOL};
+    case ast_operator::NEGATE:
+    case ast_operator::ABS: return {promote(lhs, lhs), promote(lhs, lhs)};
+    case ast_operator::IS_NULL: return {lhs, value_class::BOOL};
+    default: CUDF_FAIL("Unsupported expression operator");
+  }
+}
+
+}  // namespace
+
+expression_linearizer::expression_linearizer(expression const &expr,
+                                             table_view const &left,
+                                             table_view const &right)
+  : _left(left), _right(right)
+{
+  expr.accept(*this);
+}
+
+int32_t expression_linearizer::allocate_register()
+{
+  if (!_free_registers.empty()) {
+    auto const reg = _free_registers.back();
+    _free_registers.pop_back();
+    return reg;
+  }
+  CUDF_EXPECTS(_num_registers < max_intermediates, "The expression is too deep to evaluate");
+  return _num_registers++;
+}
+
+size_type expression_linearizer::visit(literal const &expr)
+{
+  auto const &value = expr.get_value();
+  if (!value.is_valid()) { _nullable = true; }
+  _nodes.push_back({operand_source::LITERAL,
+                    value_class_of(value.type()),
+                    static_cast<int32_t>(_literals.size())});
+  _literals.emplace_back(value);
+  return _nodes.size() - 1;
+}
+
+size_type expression_linearizer::visit(column_reference const &expr)
+{
+  bool const is_left = expr.get_table() == table_reference::LEFT;
+  auto const &table  = is_left ? _left : _right;
+  auto const index   = expr.get_column_index();
+  CUDF_EXPECTS(index >= 0 && index < table.num_columns(), "Column index out of range");
+  auto const &col = table.column(index);
+  if (col.nullable()) { _nullable = true; }
+  _nodes.push_back({is_left ? operand_source::LEFT_COLUMN : operand_source::RIGHT_COLUMN,
+                    value_class_of(col.type()),
+                    index});
+  return _nodes.size() - 1;
+}
+
+size_type expression_linearizer::visit(operation const &expr)
+{
+  instruction ins{};
+  ins.op         = expr.get_operator();
+  auto const ops = expr.get_operands();
+  for (size_t i = 0; i < ops.size(); ++i) { ins.inputs[i] = _nodes[ops[i].get().accept(*this)]; }
+  // The registers of the operands are free once the instruction has read them
+  for (size_t i = 0; i < ops.size(); ++i) {
+    if (ins.inputs[i].source == operand_source::INTERMEDIATE) {
+      _free_registers.push_back(ins.inputs[i].index);
+    }
+  }
+  auto const types =
+    operator_types(ins.op, ins.inputs[0].type, ins.inputs[ops.size() - 1].type);
+  ins.operand_type = types.first;
+  ins.output       = allocate_register();
+  if ((ins.op == ast_operator::DIV || ins.op == ast_operator::MOD) &&
+      ins.operand_type == value_class::INTEGER) {
+    _nullable = true;
+  }
+  _instructions.push_back(ins);
+  _nodes.push_back({operand_source::INTERMEDIATE, types.second, ins.output});
+  return _nodes.size() - 1;
+}
+
+}  // namespace detail
+}  // namespace ast
+}  // namespace cudf
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/nodes.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace cudf {
+namespace ast {
+namespace detail {
+/**
+ * @brief Maximum number of intermediate results live at once during an evaluation
+ */
+constexpr int32_t max_intermediates = 16;
+
+/**
+ * @brief Type a value is evaluated in
+ *
+ * BOOL and INTEGER values are held as `int64_t`, FLOAT values as `double`.
+ */
+enum class value_class : int8_t { BOOL, INTEGER, FLOAT };
+
+/**
+ * @brief Where an operand of an instruction is read from
+ */
+enum class operand_source : int8_t { LEFT_COLUMN, RIGHT_COLUMN, LITERAL, INTERMEDIATE };
+
+/**
+ * @brief Operand of an instruction
+ */
+struct operand {
+  operand_source source;
+  value_class type;
+  int32_t index;  ///< Column index, literal index or intermediate register
+};
+
+/**
+ * @brief Operation of a linearized expression, writing its result to an intermediate register
+ */
+struct alignas(8) instruction {
+  ast_operator op;
+  value_class operand_type;  ///< Type the operands are promoted to before the operation
+  int32_t output;            ///< Intermediate register receiving the result
+  operand inputs[2];         ///< Operands; the second is unused by unary operators
+};
+
+/**
+ * @brief Flattens an expression tree into a sequence of instructions
+ *
+ * The nodes are visited in post-order, so that the operands of an instruction are computed
+ * before it. The register of an intermediate result is reused as soon as its consumer has run,
+ * which bounds the number of registers by the depth of the tree rather than its size.
+ */
+class expression_linearizer {
+ public:
+  /**
+   * @brief Linearizes an expression
+   *
+   * @throw cudf::logic_error if a column reference is out of range of its table
+   *
+   * @param expr The root of the expression tree
+   * @param left The table the `LEFT` column references refer to
+   * @param right The table the `RIGHT` column references refer to
+   */
+  expression_linearizer(expression const &expr,
+                        table_view const &left,
+                        table_view const &right = table_view{});
+
+  size_type visit(literal const &expr);
+  size_type visit(column_reference const &expr);
+  size_type visit(operation const &expr);
+
+  /**
+   * @brief Returns the operand holding the value of the expression
+   */
+  operand result() const { return _nodes.back(); }
+
+  std::vector<instruction> const &instructions() const { return _instructions; }
+
+  std::vector<std::reference_wrapper<scalar const>> const &literals() const { return _literals; }
+
+  /**
+   * @brief Returns the number of intermediate registers used
+   */
+  int32_t num_registers() const { return _num_registers; }
+
+  /**
+   * @brief Returns whether the result may contain nulls
+   */
+  bool nullable() const { return _nullable; }
+
+ private:
+  int32_t allocate_register();
+
+  table_view const _left;
+  table_view const _right;
+  std::vector<operand> _nodes;  ///< Result of each visited node
+  std::vector<instruction> _instructions;
+  std::vector<std::reference_wrapper<scalar const>> _literals;
+  std::vector<int32_t> _free_registers;
+  int32_t _num_registers = 0;
+  bool _nullable         = false;
+};
+
+}  // namespace detail
+}  // namespace ast
+}  // namespace cudf
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "evaluator.cuh"
+
+#include <cudf/ast/detail/transform.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/valid_if.cuh>
+
+#include <thrust/functional.h>
+
+namespace cudf {
+namespace ast {
+namespace detail {
+namespace {
+constexpr int block_size = 128;
+
+/**
+ * @brief Evaluates a linearized expression for each row of a table
+ *
+ * @param table The table the expression refers to
+ * @param plan The linearized expression
+ * @param output Output values, of the type matching the class of the plan's result
+ * @param output_valid Output validity per row, or nullptr if the result has no nulls
+ */
+__global__ void compute_column_kernel(table_device_view table,
+                                      plan_view plan,
+                                      void *output,
+                                      bool *output_valid)
+{
+  extern __shared__ int64_t shared_plan[];
+  auto const staged = stage_plan(plan, shared_plan);
+
+  value registers[max_intermediates];
+  auto const num_rows = table.num_rows();
+  for (size_type row = blockIdx.x * blockDim.x + threadIdx.x; row < num_rows;
+       row += blockDim.x * gridDim.x) {
+    auto const out = evaluate_plan(staged, table, table, row, row, registers);
+    switch (staged.result.type) {
+      case value_class::BOOL: static_cast<bool *>(output)[row] = out.i != 0; break;
+      case value_class::INTEGER: static_cast<int64_t *>(output)[row] = out.i; break;
+      default: static_cast<double *>(output)[row] = out.f; break;
+    }
+    if (output_valid != nullptr) { output_valid[row] = out.valid; }
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<column> compute_column(table_view const &table,
+                                       expression const &expr,
+                                       rmm::mr::device_memory_resource *mr,
+                                       cudaStream_t stream)
+{
+  expression_linearizer const linearizer(expr, table);
+  auto const result = linearizer.result();
+  auto const output_type =
+    data_type{(result.type == value_class::BOOL)
+                ? type_id::BOOL8
+                : (result.type == value_class::INTEGER) ? type_id::INT64 : type_id::FLOAT64};
+  auto const num_rows = table.num_rows();
+  auto output =
+    make_fixed_width_column(output_type, num_rows, mask_state::UNALLOCATED, stream, mr);
+  if (num_rows == 0) { return output; }
+
+  device_plan const plan(linearizer, stream);
+  rmm::device_buffer valid(linearizer.nullable() ? num_rows * sizeof(bool) : 0, stream);
+  auto const d_table = table_device_view::create(table, stream);
+  cudf::detail::grid_1d const grid{num_rows, block_size};
+  compute_column_kernel<<<grid.num_blocks,
+                          grid.num_threads_per_block,
+                          plan.view().size(),
+                          stream>>>(
+    *d_table,
+    plan.view(),
+    output->mutable_view().head(),
+    linearizer.nullable() ? static_cast<bool *>(valid.data()) : nullptr);
+  CHECK_CUDA(stream);
+
+  if (linearizer.nullable()) {
+    auto const d_valid = static_cast<bool const *>(valid.data());
+    auto mask          = cudf::detail::valid_if(
+      d_valid, d_valid + num_rows, thrust::identity<bool>{}, stream, mr);
+    if (mask.second > 0) { output->set_null_mask(std::move(mask.first), mask.second); }
+  }
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> compute_column(table_view const &table,
+                                       expression const &expr,
+                                       rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column(table, expr, mr);
+}
+
+}  // namespace ast
+}  // namespace cudf
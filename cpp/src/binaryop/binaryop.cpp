@@ -19,7 +19,12 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/indices.hpp>
+#include <cudf/dictionary/detail/search.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table_view.hpp>
@@ -37,6 +42,7 @@
 
 #include <bit.hpp.jit>
 #include <durations.hpp.jit>
+#include <algorithm>
 #include <jit/common_headers.hpp>
 #include <string>
 #include <timestamps.hpp.jit>
@@ -64,6 +70,77 @@ rmm::device_buffer scalar_col_valid_mask_and(column_view const& col,
     return rmm::device_buffer{0, stream, mr};
   }
 }
+
+/**
+ * @brief Returns true if `op` compares the order or the equality of its operands
+ */
+bool is_comparison_binop(binary_operator op)
+{
+  return op == binary_operator::EQUAL or op == binary_operator::NOT_EQUAL or
+         op == binary_operator::LESS or op == binary_operator::GREATER or
+         op == binary_operator::LESS_EQUAL or op == binary_operator::GREATER_EQUAL;
+}
+
+/**
+ * @brief Returns the comparison giving the same result with its operands swapped
+ */
+binary_operator swap_comparison_operands(binary_operator op)
+{
+  switch (op) {
+    case binary_operator::LESS: return binary_operator::GREATER;
+    case binary_operator::GREATER: return binary_operator::LESS;
+    case binary_operator::LESS_EQUAL: return binary_operator::GREATER_EQUAL;
+    case binary_operator::GREATER_EQUAL: return binary_operator::LESS_EQUAL;
+    default: return op;
+  }
+}
+
+/**
+ * @brief Compares the elements of a dictionary column with a key by comparing
+ * their indices with a position in the keys of the dictionary.
+ *
+ * With `k` the number of keys less than `key`, an element is less than `key` if
+ * and only if its index is less than `k` since the keys are sorted and unique.
+ * It is equal to `key` if and only if `key` is found at `k`.
+ */
+std::unique_ptr<column> dictionary_scalar_compare(column_view const& lhs,
+                                                  scalar const& rhs,
+                                                  binary_operator op,
+                                                  data_type output_type,
+                                                  rmm::mr::device_memory_resource* mr,
+                                                  cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_comparison_binop(op), "Unsupported operator for a dictionary column");
+  auto const indices = cudf::dictionary::detail::get_indices_annotated(table_view{{lhs}});
+
+  int32_t position = 0;
+  if (rhs.is_valid(stream)) {
+    cudf::dictionary_column_view const dictionary(lhs);
+    auto const insert_index = cudf::dictionary::detail::get_insert_index(
+      dictionary, rhs, rmm::mr::get_default_resource(), stream);
+    auto const found =
+      cudf::dictionary::detail::get_index(dictionary, rhs, rmm::mr::get_default_resource(), stream)
+        ->is_valid(stream);
+    auto const lower = insert_index->value(stream);
+    switch (op) {
+      case binary_operator::LESS:
+      case binary_operator::GREATER_EQUAL: position = lower; break;
+      case binary_operator::LESS_EQUAL:
+        position = lower + found;
+        op       = binary_operator::LESS;
+        break;
+      case binary_operator::GREATER:
+        position = lower + found;
+        op       = binary_operator::GREATER_EQUAL;
+        break;
+      // no index is negative, so a key that is not found matches no element
+      default: position = found ? lower : -1; break;
+    }
+  }
+  numeric_scalar<int32_t> const position_scalar(position, rhs.is_valid(stream), stream);
+  return cudf::detail::binary_operation(
+    indices.column(0), position_scalar, op, output_type, mr, stream);
+}
 }  // namespace detail
 
 namespace jit {
@@ -240,6 +317,25 @@ void binary_operation(mutable_column_view& out,
             cudf::jit::get_data_ptr(rhs));
 }
 
+void precompile(binary_operation_signature const& signature)
+{
+  auto const output_type_name = cudf::jit::get_type_name(signature.output_type);
+  auto const lhs_type_name    = cudf::jit::get_type_name(signature.lhs_type);
+  auto const rhs_type_name    = cudf::jit::get_type_name(signature.rhs_type);
+  auto const direct_op        = get_operator_name(signature.op, OperatorType::Direct);
+  auto const reverse_op       = get_operator_name(signature.op, OperatorType::Reverse);
+  auto const suffix           = null_using_binop(signature.op) ? "_with_validity" : "";
+
+  auto instantiate = [&](std::string const& kernel_name, std::vector<std::string> arguments) {
+    cudf::jit::launcher(hash, code::kernel, header_names, cudf::jit::compiler_flags, headers_code)
+      .set_kernel_inst(kernel_name + suffix, arguments);
+  };
+  // column op column, column op scalar and scalar op column (reversed operands)
+  instantiate("kernel_v_v", {output_type_name, lhs_type_name, rhs_type_name, direct_op});
+  instantiate("kernel_v_s", {output_type_name, lhs_type_name, rhs_type_name, direct_op});
+  instantiate("kernel_v_s", {output_type_name, rhs_type_name, lhs_type_name, reverse_op});
+}
+
 }  // namespace jit
 }  // namespace binops
 
@@ -256,6 +352,11 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, mr, stream);
   }
 
+  if (rhs.type().id() == type_id::DICTIONARY32) {
+    return binops::detail::dictionary_scalar_compare(
+      rhs, lhs, binops::detail::swap_comparison_operands(op), output_type, mr, stream);
+  }
+
   // Check for datatype
   CUDF_EXPECTS(is_fixed_width(output_type), "Invalid/Unsupported output datatype");
 
@@ -274,6 +375,14 @@ std::unique_ptr<column> binary_operation(scalar const& lhs,
   if (rhs.size() == 0) { return out; }
 
   auto out_view = out->mutable_view();
+  if (binops::compiled::fixed_width_binary_operation(
+        out_view,
+        {cudf::jit::get_data_ptr(lhs), lhs.type(), true},
+        {cudf::jit::get_data_ptr(rhs), rhs.type(), false},
+        op,
+        stream)) {
+    return out;
+  }
   binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
   return out;
 }
@@ -289,6 +398,10 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, mr, stream);
   }
 
+  if (lhs.type().id() == type_id::DICTIONARY32) {
+    return binops::detail::dictionary_scalar_compare(lhs, rhs, op, output_type, mr, stream);
+  }
+
   // Check for datatype
   CUDF_EXPECTS(is_fixed_width(output_type), "Invalid/Unsupported output datatype");
 
@@ -307,6 +420,14 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   if (lhs.size() == 0) { return out; }
 
   auto out_view = out->mutable_view();
+  if (binops::compiled::fixed_width_binary_operation(
+        out_view,
+        {cudf::jit::get_data_ptr(lhs), lhs.type(), false},
+        {cudf::jit::get_data_ptr(rhs), rhs.type(), true},
+        op,
+        stream)) {
+    return out;
+  }
   binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
   return out;
 }
@@ -324,6 +445,21 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
     return binops::compiled::binary_operation(lhs, rhs, op, output_type, mr, stream);
   }
 
+  // Dictionaries that share their sorted keys compare like their indices
+  if ((lhs.type().id() == type_id::DICTIONARY32) && (rhs.type().id() == type_id::DICTIONARY32)) {
+    CUDF_EXPECTS(binops::detail::is_comparison_binop(op),
+                 "Unsupported operator for dictionary columns");
+    auto const matched = cudf::dictionary::detail::match_dictionaries(
+      {table_view{{lhs}}, table_view{{rhs}}}, rmm::mr::get_default_resource(), stream);
+    return binary_operation(
+      cudf::dictionary::detail::get_indices_annotated(matched.second[0]).column(0),
+      cudf::dictionary::detail::get_indices_annotated(matched.second[1]).column(0),
+      op,
+      output_type,
+      mr,
+      stream);
+  }
+
   // Check for datatype
   CUDF_EXPECTS(is_fixed_width(output_type), "Invalid/Unsupported output datatype");
 
@@ -331,18 +467,30 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   CUDF_EXPECTS(is_fixed_width(rhs.type()), "Invalid/Unsupported rhs datatype");
 
   std::unique_ptr<column> out;
+  size_type null_count{cudf::UNKNOWN_NULL_COUNT};
   if (binops::null_using_binop(op)) {
     out = make_fixed_width_column(output_type, rhs.size(), mask_state::ALL_VALID, stream, mr);
   } else {
-    auto new_mask = bitmask_and(table_view({lhs, rhs}), mr, stream);
+    auto new_mask = cudf::detail::bitmask_and_with_null_count(table_view({lhs, rhs}), mr, stream);
+    null_count    = new_mask.second;
     out           = make_fixed_width_column(
-      output_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+      output_type, lhs.size(), std::move(new_mask.first), null_count, stream, mr);
   }
 
   // Check for 0 sized data
   if (lhs.size() == 0 || rhs.size() == 0) { return out; }
 
   auto out_view = out->mutable_view();
+  // Unless the operator computes the output validity, the mask is not modified through the view
+  out->set_null_count(null_count);
+  if (binops::compiled::fixed_width_binary_operation(
+        out_view,
+        {cudf::jit::get_data_ptr(lhs), lhs.type(), false},
+        {cudf::jit::get_data_ptr(rhs), rhs.type(), false},
+        op,
+        stream)) {
+    return out;
+  }
   binops::jit::binary_operation(out_view, lhs, rhs, op, stream);
   return out;
 }
@@ -365,14 +513,16 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
 
   CUDF_EXPECTS((lhs.size() == rhs.size()), "Column sizes don't match");
 
-  auto new_mask = bitmask_and(table_view({lhs, rhs}), mr, stream);
-  auto out      = make_fixed_width_column(
-    output_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+  auto new_mask   = cudf::detail::bitmask_and_with_null_count(table_view({lhs, rhs}), mr, stream);
+  auto null_count = new_mask.second;
+  auto out        = make_fixed_width_column(
+    output_type, lhs.size(), std::move(new_mask.first), null_count, stream, mr);
 
   // Check for 0 sized data
   if (lhs.size() == 0 || rhs.size() == 0) { return out; }
 
   auto out_view = out->mutable_view();
+  out->set_null_count(null_count);  // the mask is not modified through the view
   binops::jit::binary_operation(out_view, lhs, rhs, ptx, stream);
   return out;
 }
@@ -419,4 +569,28 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return detail::binary_operation(lhs, rhs, ptx, output_type, mr);
 }
 
+int32_t binary_operation_fixed_point_scale(binary_operator op,
+                                           int32_t left_scale,
+                                           int32_t right_scale)
+{
+  switch (op) {
+    case binary_operator::ADD:
+    case binary_operator::SUB: return std::min(left_scale, right_scale);
+    case binary_operator::MUL: return left_scale + right_scale;
+    case binary_operator::DIV: return left_scale - right_scale;
+    default: CUDF_FAIL("Unsupported operator for fixed-point types");
+  }
+}
+
+void precompile_binary_operations(std::vector<binary_operation_signature> const& signatures)
+{
+  CUDF_FUNC_RANGE();
+  for (auto const& signature : signatures) {
+    CUDF_EXPECTS(is_fixed_width(signature.output_type), "Invalid/Unsupported output datatype");
+    CUDF_EXPECTS(is_fixed_width(signature.lhs_type), "Invalid/Unsupported lhs datatype");
+    CUDF_EXPECTS(is_fixed_width(signature.rhs_type), "Invalid/Unsupported rhs datatype");
+    binops::jit::precompile(signature);
+  }
+}
+
 }  // namespace cudf
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fixed_width_ops.cuh"
+
+#include <cudf/wrappers/durations.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+namespace detail {
+namespace {
+/**
+ * @brief Additions and subtractions of the timestamps and durations of one unit
+ */
+template <typename Timestamp>
+using chrono_add_signatures =
+  type_list<signature<Timestamp, Timestamp, typename Timestamp::duration>,
+            signature<Timestamp, typename Timestamp::duration, Timestamp>,
+            signature<typename Timestamp::duration,
+                      typename Timestamp::duration,
+                      typename Timestamp::duration>>;
+
+template <typename Timestamp>
+using chrono_sub_signatures =
+  type_list<signature<Timestamp, Timestamp, typename Timestamp::duration>,
+            signature<typename Timestamp::duration, Timestamp, Timestamp>,
+            signature<typename Timestamp::duration,
+                      typename Timestamp::duration,
+                      typename Timestamp::duration>>;
+
+template <template <typename> class Signatures, typename Op>
+bool launch_chrono(mutable_column_view& out,
+                   fixed_width_operand const& lhs,
+                   fixed_width_operand const& rhs,
+                   cudaStream_t stream)
+{
+  return launch_matching<Op>(Signatures<timestamp_D>{}, out, lhs, rhs, stream) ||
+         launch_matching<Op>(Signatures<timestamp_s>{}, out, lhs, rhs, stream) ||
+         launch_matching<Op>(Signatures<timestamp_ms>{}, out, lhs, rhs, stream) ||
+         launch_matching<Op>(Signatures<timestamp_us>{}, out, lhs, rhs, stream) ||
+         launch_matching<Op>(Signatures<timestamp_ns>{}, out, lhs, rhs, stream);
+}
+
+template <typename Op>
+bool launch_numeric(mutable_column_view& out,
+                    fixed_width_operand const& lhs,
+                    fixed_width_operand const& rhs,
+                    cudaStream_t stream)
+{
+  return launch_product<Op>(
+    numeric_types{}, numeric_types{}, numeric_types{}, out, lhs, rhs, stream);
+}
+
+}  // namespace
+
+bool arithmetic_operation(mutable_column_view& out,
+                          fixed_width_operand const& lhs,
+                          fixed_width_operand const& rhs,
+                          binary_operator op,
+                          cudaStream_t stream)
+{
+  switch (op) {
+    case binary_operator::ADD:
+      return launch_numeric<ops::Add>(out, lhs, rhs, stream) ||
+             launch_chrono<chrono_add_signatures, ops::Add>(out, lhs, rhs, stream);
+    case binary_operator::SUB:
+      return launch_numeric<ops::Sub>(out, lhs, rhs, stream) ||
+             launch_chrono<chrono_sub_signatures, ops::Sub>(out, lhs, rhs, stream);
+    case binary_operator::MUL: return launch_numeric<ops::Mul>(out, lhs, rhs, stream);
+    case binary_operator::DIV: return launch_numeric<ops::Div>(out, lhs, rhs, stream);
+    case binary_operator::TRUE_DIV: return launch_numeric<ops::TrueDiv>(out, lhs, rhs, stream);
+    case binary_operator::FLOOR_DIV: return launch_numeric<ops::FloorDiv>(out, lhs, rhs, stream);
+    case binary_operator::MOD: return launch_numeric<ops::Mod>(out, lhs, rhs, stream);
+    default: return false;
+  }
+}
+
+}  // namespace detail
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
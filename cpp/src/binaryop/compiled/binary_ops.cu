@@ -16,12 +16,14 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 
 #include "binary_ops.hpp"
+#include "fixed_width_ops.cuh"
 
 namespace cudf {
 namespace binops {
@@ -164,16 +166,18 @@ struct binary_op {
                                      rmm::mr::device_memory_resource* mr,
                                      cudaStream_t stream)
   {
-    auto new_mask = bitmask_and(table_view({lhs, rhs}), mr, stream);
-    auto out      = make_fixed_width_column(
-      out_type, lhs.size(), std::move(new_mask), cudf::UNKNOWN_NULL_COUNT, stream, mr);
+    auto new_mask   = cudf::detail::bitmask_and_with_null_count(table_view({lhs, rhs}), mr, stream);
+    auto null_count = new_mask.second;
+    auto out        = make_fixed_width_column(
+      out_type, lhs.size(), std::move(new_mask.first), null_count, stream, mr);
 
     if (lhs.size() > 0) {
-      auto out_view        = out->mutable_view();
+      auto out_view = out->mutable_view();
+      out->set_null_count(null_count);  // the mask is not modified through the view
       auto out_itr         = out_view.begin<Out>();
       auto lhs_device_view = column_device_view::create(lhs, stream);
       auto rhs_device_view = column_device_view::create(rhs, stream);
-      if (lhs.has_nulls() && rhs.has_nulls()) {
+      if (lhs.nullable() && rhs.nullable()) {
         auto lhs_itr = cudf::detail::make_null_replacement_iterator(*lhs_device_view, Lhs{});
         auto rhs_itr = cudf::detail::make_null_replacement_iterator(*rhs_device_view, Rhs{});
         thrust::transform(rmm::exec_policy(stream)->on(stream),
@@ -182,7 +186,7 @@ struct binary_op {
                           rhs_itr,
                           out_itr,
                           apply_binop<Lhs, Rhs, Out>{op});
-      } else if (lhs.has_nulls()) {
+      } else if (lhs.nullable()) {
         auto lhs_itr = cudf::detail::make_null_replacement_iterator(*lhs_device_view, Lhs{});
         auto rhs_itr = thrust::make_transform_iterator(
           thrust::make_counting_iterator(size_type{0}),
@@ -193,7 +197,7 @@ struct binary_op {
                           rhs_itr,
                           out_itr,
                           apply_binop<Lhs, Rhs, Out>{op});
-      } else if (rhs.has_nulls()) {
+      } else if (rhs.nullable()) {
         auto lhs_itr = thrust::make_transform_iterator(
           thrust::make_counting_iterator(size_type{0}),
           [col = *lhs_device_view] __device__(size_type i) { return col.element<Lhs>(i); });
@@ -480,6 +484,35 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   }
 }
 
+bool fixed_width_binary_operation(mutable_column_view& out,
+                                  fixed_width_operand const& lhs,
+                                  fixed_width_operand const& rhs,
+                                  binary_operator op,
+                                  cudaStream_t stream)
+{
+  if (is_fixed_point(lhs.type) || is_fixed_point(rhs.type)) {
+    return detail::fixed_point_operation(out, lhs, rhs, op, stream);
+  }
+  switch (op) {
+    case binary_operator::ADD:
+    case binary_operator::SUB:
+    case binary_operator::MUL:
+    case binary_operator::DIV:
+    case binary_operator::TRUE_DIV:
+    case binary_operator::FLOOR_DIV:
+    case binary_operator::MOD:
+      return detail::arithmetic_operation(out, lhs, rhs, op, stream);
+    case binary_operator::EQUAL:
+    case binary_operator::NOT_EQUAL:
+    case binary_operator::LESS:
+    case binary_operator::GREATER:
+    case binary_operator::LESS_EQUAL:
+    case binary_operator::GREATER_EQUAL:
+      return detail::comparison_operation(out, lhs, rhs, op, stream);
+    default: return false;
+  }
+}
+
 }  // namespace compiled
 }  // namespace binops
 }  // namespace cudf
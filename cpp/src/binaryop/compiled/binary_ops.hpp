@@ -42,6 +42,40 @@ inline bool null_using_binop(binary_operator op)
 }
 
 namespace compiled {
+/**
+ * @brief Operand of a precompiled fixed-width binary operation
+ */
+struct fixed_width_operand {
+  void const* data;  ///< Device pointer to the first element
+  data_type type;
+  bool is_scalar;  ///< Whether `data` holds a single value used for every row
+};
+
+/**
+ * @brief Computes `out[i] = op(lhs[i], rhs[i])` with a precompiled kernel
+ *
+ * Kernels are precompiled for the arithmetic operators and comparisons of the most common types:
+ * - any combination of INT32, INT64, FLOAT32 and FLOAT64 operands and output;
+ * - additions and subtractions of timestamps and durations of one unit;
+ * - comparisons of two timestamps or of two durations of the same type;
+ * - the operators of `binary_operation_fixed_point_scale()` between fixed-point operands.
+ *
+ * Other operators and types are left to the JIT compiled kernels. Only the data of `out` is
+ * written; its null mask must be computed by the caller.
+ *
+ * @param out    Output column, of the size of the column operands
+ * @param lhs    The left operand
+ * @param rhs    The right operand
+ * @param op     The binary operator
+ * @param stream CUDA stream used for the kernel launch
+ * @return Whether a precompiled kernel computed the operation
+ */
+bool fixed_width_binary_operation(mutable_column_view& out,
+                                  fixed_width_operand const& lhs,
+                                  fixed_width_operand const& rhs,
+                                  binary_operator op,
+                                  cudaStream_t stream = 0);
+
 
 /**
  * @brief Performs a binary operation between a string scalar and a string
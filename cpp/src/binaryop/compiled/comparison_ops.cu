@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fixed_width_ops.cuh"
+
+#include <cudf/wrappers/durations.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+namespace detail {
+namespace {
+/**
+ * @brief Comparisons of the numeric types, and of timestamps or durations of the same unit
+ */
+template <typename Op>
+bool launch_comparison(mutable_column_view& out,
+                       fixed_width_operand const& lhs,
+                       fixed_width_operand const& rhs,
+                       cudaStream_t stream)
+{
+  using chrono_signatures = type_list<signature<bool, timestamp_D, timestamp_D>,
+                                      signature<bool, timestamp_s, timestamp_s>,
+                                      signature<bool, timestamp_ms, timestamp_ms>,
+                                      signature<bool, timestamp_us, timestamp_us>,
+                                      signature<bool, timestamp_ns, timestamp_ns>,
+                                      signature<bool, duration_D, duration_D>,
+                                      signature<bool, duration_s, duration_s>,
+                                      signature<bool, duration_ms, duration_ms>,
+                                      signature<bool, duration_us, duration_us>,
+                                      signature<bool, duration_ns, duration_ns>>;
+  return launch_product<Op>(
+           type_list<bool>{}, numeric_types{}, numeric_types{}, out, lhs, rhs, stream) ||
+         launch_matching<Op>(chrono_signatures{}, out, lhs, rhs, stream);
+}
+
+}  // namespace
+
+bool comparison_operation(mutable_column_view& out,
+                          fixed_width_operand const& lhs,
+                          fixed_width_operand const& rhs,
+                          binary_operator op,
+                          cudaStream_t stream)
+{
+  switch (op) {
+    case binary_operator::EQUAL: return launch_comparison<ops::Equal>(out, lhs, rhs, stream);
+    case binary_operator::NOT_EQUAL: return launch_comparison<ops::NotEqual>(out, lhs, rhs, stream);
+    case binary_operator::LESS: return launch_comparison<ops::Less>(out, lhs, rhs, stream);
+    case binary_operator::GREATER: return launch_comparison<ops::Greater>(out, lhs, rhs, stream);
+    case binary_operator::LESS_EQUAL:
+      return launch_comparison<ops::LessEqual>(out, lhs, rhs, stream);
+    case binary_operator::GREATER_EQUAL:
+      return launch_comparison<ops::GreaterEqual>(out, lhs, rhs, stream);
+    default: return false;
+  }
+}
+
+}  // namespace detail
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
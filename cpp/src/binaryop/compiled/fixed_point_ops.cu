@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fixed_width_ops.cuh"
+
+#include <cudf/binaryop.hpp>
+#include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <thrust/functional.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+namespace detail {
+namespace {
+/**
+ * @brief Computes `out[i] = Op(lhs[i] * lhs_factor, rhs[i] * rhs_factor)` on stored integers
+ *
+ * The factors bring the operands to a common scale where the operator requires it.
+ */
+template <typename Op, typename Out, typename Rep>
+__global__ void fixed_point_op_kernel(size_type size,
+                                      Out* out,
+                                      Rep const* lhs,
+                                      bool lhs_is_scalar,
+                                      Rep lhs_factor,
+                                      Rep const* rhs,
+                                      bool rhs_is_scalar,
+                                      Rep rhs_factor)
+{
+  for (size_type i = blockIdx.x * blockDim.x + threadIdx.x; i < size;
+       i += blockDim.x * gridDim.x) {
+    out[i] = Op{}(lhs[lhs_is_scalar ? 0 : i] * lhs_factor, rhs[rhs_is_scalar ? 0 : i] * rhs_factor);
+  }
+}
+
+template <typename Op, typename Out, typename Rep>
+void launch_fixed_point(mutable_column_view& out,
+                        fixed_width_operand const& lhs,
+                        fixed_width_operand const& rhs,
+                        bool rescale,
+                        cudaStream_t stream)
+{
+  auto const scale  = std::min(lhs.type.scale(), rhs.type.scale());
+  auto const factor = [&](int32_t operand_scale) {
+    return rescale ? numeric::detail::ipow<Rep, numeric::Radix::BASE_10>(operand_scale - scale)
+                   : Rep{1};
+  };
+  auto const lhs_factor = factor(lhs.type.scale());
+  auto const rhs_factor = factor(rhs.type.scale());
+  cudf::detail::grid_1d const grid{out.size(), 256};
+  fixed_point_op_kernel<Op, Out, Rep><<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+    out.size(),
+    out.data<Out>(),
+    static_cast<Rep const*>(lhs.data),
+    lhs.is_scalar,
+    lhs_factor,
+    static_cast<Rep const*>(rhs.data),
+    rhs.is_scalar,
+    rhs_factor);
+  CHECK_CUDA(stream);
+}
+
+template <typename Rep>
+void launch_fixed_point_operator(mutable_column_view& out,
+                           fixed_width_operand const& lhs,
+                           fixed_width_operand const& rhs,
+                           binary_operator op,
+                           cudaStream_t stream)
+{
+  switch (op) {
+    case binary_operator::ADD:
+      return launch_fixed_point<thrust::plus<Rep>, Rep, Rep>(out, lhs, rhs, true, stream);
+    case binary_operator::SUB:
+      return launch_fixed_point<thrust::minus<Rep>, Rep, Rep>(out, lhs, rhs, true, stream);
+    case binary_operator::MUL:
+      return launch_fixed_point<thrust::multiplies<Rep>, Rep, Rep>(out, lhs, rhs, false, stream);
+    case binary_operator::DIV:
+      return launch_fixed_point<thrust::divides<Rep>, Rep, Rep>(out, lhs, rhs, false, stream);
+    case binary_operator::EQUAL:
+      return launch_fixed_point<thrust::equal_to<Rep>, bool, Rep>(out, lhs, rhs, true, stream);
+    case binary_operator::NOT_EQUAL:
+      return launch_fixed_point<thrust::not_equal_to<Rep>, bool, Rep>(out, lhs, rhs, true, stream);
+    case binary_operator::LESS:
+      return launch_fixed_point<thrust::less<Rep>, bool, Rep>(out, lhs, rhs, true, stream);
+    case binary_operator::GREATER:
+      return launch_fixed_point<thrust::greater<Rep>, bool, Rep>(out, lhs, rhs, true, stream);
+    case binary_operator::LESS_EQUAL:
+      return launch_fixed_point<thrust::less_equal<Rep>, bool, Rep>(out, lhs, rhs, true, stream);
+    case binary_operator::GREATER_EQUAL:
+      return launch_fixed_point<thrust::greater_equal<Rep>, bool, Rep>(
+        out, lhs, rhs, true, stream);
+    default: CUDF_FAIL("Unsupported operator for fixed-point types");
+  }
+}
+
+bool is_comparison(binary_operator op)
+{
+  return op == binary_operator::EQUAL || op == binary_operator::NOT_EQUAL ||
+         op == binary_operator::LESS || op == binary_operator::GREATER ||
+         op == binary_operator::LESS_EQUAL || op == binary_operator::GREATER_EQUAL;
+}
+
+}  // namespace
+
+bool fixed_point_operation(mutable_column_view& out,
+                           fixed_width_operand const& lhs,
+                           fixed_width_operand const& rhs,
+                           binary_operator op,
+                           cudaStream_t stream)
+{
+  CUDF_EXPECTS(lhs.type.id() == rhs.type.id(),
+               "Fixed-point operands must be of the same fixed-point type");
+  if (is_comparison(op)) {
+    CUDF_EXPECTS(out.type().id() == type_id::BOOL8, "Comparisons of fixed-point types are BOOL8");
+  } else {
+    auto const scale = binary_operation_fixed_point_scale(op, lhs.type.scale(), rhs.type.scale());
+    CUDF_EXPECTS(out.type() == data_type(lhs.type.id(), scale),
+                 "Invalid output type for fixed-point operation");
+  }
+  if (lhs.type.id() == type_id::DECIMAL32) {
+    launch_fixed_point_operator<int32_t>(out, lhs, rhs, op, stream);
+  } else {
+    launch_fixed_point_operator<int64_t>(out, lhs, rhs, op, stream);
+  }
+  return true;
+}
+
+}  // namespace detail
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "binary_ops.hpp"
+#include "operation.cuh"
+
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <initializer_list>
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+namespace detail {
+template <typename... Ts>
+struct type_list {
+};
+
+/**
+ * @brief Output and operand types of a precompiled operation
+ */
+template <typename Out, typename Lhs, typename Rhs>
+struct signature {
+};
+
+using numeric_types = type_list<int32_t, int64_t, float, double>;
+
+/**
+ * @brief Computes `out[i] = Op(lhs[i], rhs[i])`, where a scalar operand is read at index 0
+ */
+template <typename Op, typename Out, typename Lhs, typename Rhs>
+__global__ void fixed_width_binary_op_kernel(size_type size,
+                                             Out* out,
+                                             Lhs const* lhs,
+                                             bool lhs_is_scalar,
+                                             Rhs const* rhs,
+                                             bool rhs_is_scalar)
+{
+  for (size_type i = blockIdx.x * blockDim.x + threadIdx.x; i < size;
+       i += blockDim.x * gridDim.x) {
+    out[i] = Op::template operate<Out, Lhs, Rhs>(lhs[lhs_is_scalar ? 0 : i],
+                                                 rhs[rhs_is_scalar ? 0 : i]);
+  }
+}
+
+template <typename T>
+bool is_type(data_type type)
+{
+  return type.id() == type_to_id<T>();
+}
+
+template <typename Op, typename Out, typename Lhs, typename Rhs>
+bool launch(mutable_column_view& out,
+            fixed_width_operand const& lhs,
+            fixed_width_operand const& rhs,
+            cudaStream_t stream)
+{
+  if (!is_type<Out>(out.type()) || !is_type<Lhs>(lhs.type) || !is_type<Rhs>(rhs.type)) {
+    return false;
+  }
+  cudf::detail::grid_1d const grid{out.size(), 256};
+  fixed_width_binary_op_kernel<Op, Out, Lhs, Rhs>
+    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+      out.size(),
+      out.data<Out>(),
+      static_cast<Lhs const*>(lhs.data),
+      lhs.is_scalar,
+      static_cast<Rhs const*>(rhs.data),
+      rhs.is_scalar);
+  CHECK_CUDA(stream);
+  return true;
+}
+
+/**
+ * @brief Launches the kernel of the signature matching the operand types, if any
+ */
+template <typename Op, typename... Out, typename... Lhs, typename... Rhs>
+bool launch_matching(type_list<signature<Out, Lhs, Rhs>...>,
+                     mutable_column_view& out,
+                     fixed_width_operand const& lhs,
+                     fixed_width_operand const& rhs,
+                     cudaStream_t stream)
+{
+  bool launched = false;
+  (void)std::initializer_list<int>{
+    (launched = launched || launch<Op, Out, Lhs, Rhs>(out, lhs, rhs, stream), 0)...};
+  return launched;
+}
+
+template <typename Op, typename Out, typename Lhs, typename... Rhs>
+bool launch_rhs(type_list<Rhs...>,
+                mutable_column_view& out,
+                fixed_width_operand const& lhs,
+                fixed_width_operand const& rhs,
+                cudaStream_t stream)
+{
+  return launch_matching<Op>(type_list<signature<Out, Lhs, Rhs>...>{}, out, lhs, rhs, stream);
+}
+
+/**
+ * @brief Launches the kernel for any combination of the output, left and right types
+ *
+ * The types are matched one level at a time, so that a call compares a few type ids only.
+ */
+template <typename Op, typename RhsList, typename Out, typename... Lhs>
+bool launch_lhs(type_list<Lhs...>,
+                RhsList rhs_types,
+                mutable_column_view& out,
+                fixed_width_operand const& lhs,
+                fixed_width_operand const& rhs,
+                cudaStream_t stream)
+{
+  bool launched = false;
+  (void)std::initializer_list<int>{
+    (launched = launched || (is_type<Lhs>(lhs.type) &&
+                             launch_rhs<Op, Out, Lhs>(rhs_types, out, lhs, rhs, stream)),
+     0)...};
+  return launched;
+}
+
+template <typename Op, typename LhsList, typename RhsList, typename... Out>
+bool launch_product(type_list<Out...>,
+                    LhsList lhs_types,
+                    RhsList rhs_types,
+                    mutable_column_view& out,
+                    fixed_width_operand const& lhs,
+                    fixed_width_operand const& rhs,
+                    cudaStream_t stream)
+{
+  bool launched = false;
+  (void)std::initializer_list<int>{
+    (launched = launched ||
+                (is_type<Out>(out.type()) &&
+                 launch_lhs<Op, RhsList, Out>(lhs_types, rhs_types, out, lhs, rhs, stream)),
+     0)...};
+  return launched;
+}
+
+/**
+ * @brief Computes an arithmetic operation with a precompiled kernel, if the types are covered
+ */
+bool arithmetic_operation(mutable_column_view& out,
+                          fixed_width_operand const& lhs,
+                          fixed_width_operand const& rhs,
+                          binary_operator op,
+                          cudaStream_t stream);
+
+/**
+ * @brief Computes a comparison with a precompiled kernel, if the types are covered
+ */
+bool comparison_operation(mutable_column_view& out,
+                          fixed_width_operand const& lhs,
+                          fixed_width_operand const& rhs,
+                          binary_operator op,
+                          cudaStream_t stream);
+
+/**
+ * @brief Computes an operation between fixed-point operands with a precompiled kernel
+ *
+ * @throw cudf::logic_error if the operator or the types are not supported for fixed-point types
+ */
+bool fixed_point_operation(mutable_column_view& out,
+                           fixed_width_operand const& lhs,
+                           fixed_width_operand const& rhs,
+                           binary_operator op,
+                           cudaStream_t stream);
+
+}  // namespace detail
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
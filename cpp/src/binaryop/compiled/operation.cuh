@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <cmath>
+#include <type_traits>
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+/**
+ * @brief Device operators of the precompiled fixed-width binary operations
+ *
+ * Each operator computes its result exactly like the operator of the same name in
+ * `jit/code/operation.cpp`, so that the precompiled and JIT paths agree for every type.
+ */
+namespace ops {
+template <typename... Ts>
+using common_t = typename std::common_type<Ts...>::type;
+
+template <typename T>
+constexpr bool is_chrono_v = cudf::is_chrono<T>();
+
+template <typename T>
+constexpr bool is_duration_v = cudf::is_duration<T>();
+
+struct Add {
+  template <typename Out,
+            typename Lhs,
+            typename Rhs,
+            std::enable_if_t<(is_chrono_v<Out> && is_chrono_v<Lhs> && is_chrono_v<Rhs>)>* = nullptr>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    return x + y;
+  }
+
+  template <
+    typename Out,
+    typename Lhs,
+    typename Rhs,
+    std::enable_if_t<(!is_chrono_v<Out> || !is_chrono_v<Lhs> || !is_chrono_v<Rhs>)>* = nullptr>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    using Common = common_t<Out, Lhs, Rhs>;
+    return static_cast<Out>(static_cast<Common>(x) + static_cast<Common>(y));
+  }
+};
+
+struct Sub {
+  template <typename Out,
+            typename Lhs,
+            typename Rhs,
+            std::enable_if_t<(is_chrono_v<Out> && is_chrono_v<Lhs> && is_chrono_v<Rhs>)>* = nullptr>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    return x - y;
+  }
+
+  template <
+    typename Out,
+    typename Lhs,
+    typename Rhs,
+    std::enable_if_t<(!is_chrono_v<Out> || !is_chrono_v<Lhs> || !is_chrono_v<Rhs>)>* = nullptr>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    using Common = common_t<Out, Lhs, Rhs>;
+    return static_cast<Out>(static_cast<Common>(x) - static_cast<Common>(y));
+  }
+};
+
+struct Mul {
+  template <typename Out, typename Lhs, typename Rhs>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    using Common = common_t<Out, Lhs, Rhs>;
+    return static_cast<Out>(static_cast<Common>(x) * static_cast<Common>(y));
+  }
+};
+
+struct Div {
+  template <typename Out, typename Lhs, typename Rhs>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    using Common = common_t<Out, Lhs, Rhs>;
+    return static_cast<Out>(static_cast<Common>(x) / static_cast<Common>(y));
+  }
+};
+
+struct TrueDiv {
+  template <typename Out, typename Lhs, typename Rhs>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    return static_cast<Out>(static_cast<double>(x) / static_cast<double>(y));
+  }
+};
+
+struct FloorDiv {
+  template <typename Out, typename Lhs, typename Rhs>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    return static_cast<Out>(floor(static_cast<double>(x) / static_cast<double>(y)));
+  }
+};
+
+struct Mod {
+  template <typename Out,
+            typename Lhs,
+            typename Rhs,
+            std::enable_if_t<std::is_integral<common_t<Out, Lhs, Rhs>>::value>* = nullptr>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    using Common = common_t<Out, Lhs, Rhs>;
+    return static_cast<Out>(static_cast<Common>(x) % static_cast<Common>(y));
+  }
+
+  template <typename Out,
+            typename Lhs,
+            typename Rhs,
+            std::enable_if_t<std::is_same<common_t<Out, Lhs, Rhs>, float>::value>* = nullptr>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    return static_cast<Out>(fmodf(static_cast<float>(x), static_cast<float>(y)));
+  }
+
+  template <typename Out,
+            typename Lhs,
+            typename Rhs,
+            std::enable_if_t<std::is_same<common_t<Out, Lhs, Rhs>, double>::value>* = nullptr>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    return static_cast<Out>(fmod(static_cast<double>(x), static_cast<double>(y)));
+  }
+};
+
+struct Equal {
+  template <typename Out, typename Lhs, typename Rhs>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    return (x == y);
+  }
+};
+
+struct NotEqual {
+  template <typename Out, typename Lhs, typename Rhs>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    return (x != y);
+  }
+};
+
+struct Less {
+  template <typename Out, typename Lhs, typename Rhs>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    return (x < y);
+  }
+};
+
+struct Greater {
+  template <typename Out, typename Lhs, typename Rhs>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    return (x > y);
+  }
+};
+
+struct LessEqual {
+  template <typename Out, typename Lhs, typename Rhs>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    return (x <= y);
+  }
+};
+
+struct GreaterEqual {
+  template <typename Out, typename Lhs, typename Rhs>
+  static CUDA_DEVICE_CALLABLE Out operate(Lhs x, Rhs y)
+  {
+    return (x >= y);
+  }
+};
+
+}  // namespace ops
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
@@ -23,6 +23,7 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <thrust/binary_search.h>
@@ -34,6 +35,7 @@
 #include <rmm/device_scalar.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <numeric>
 #include <type_traits>
 
@@ -201,7 +203,7 @@ __global__ void count_set_bits_kernel(bitmask_type const *bitmask,
  * @brief Convenience function to get offset word from a bitmask
  *
  * @see copy_offset_bitmask
- * @see offset_bitmask_and
+ * @see offset_bitmask_binop
  */
 __device__ bitmask_type get_mask_offset_word(bitmask_type const *__restrict__ source,
                                              size_type destination_word_index,
@@ -311,8 +313,13 @@ __global__ void copy_offset_bitmask(bitmask_type *__restrict__ destination,
 }
 
 /**
- * @brief Computes the bitwise AND of an array of bitmasks
+ * @brief Computes a bitwise operation across an array of bitmasks
  *
+ * Each destination word is reduced from the corresponding words of all the sources, so that
+ * the masks of any number of columns are combined in one pass without intermediate masks.
+ *
+ * @tparam Binop Bitwise operator, `bitwise_and` or `bitwise_or`
+ * @param op The operator combining the words of the sources
  * @param destination The bitmask to write result into
  * @param source Array of source mask pointers. All masks must be of same size
  * @param begin_bit Array of offsets into corresponding @p source masks.
@@ -320,39 +327,80 @@ __global__ void copy_offset_bitmask(bitmask_type *__restrict__ destination,
  * @param num_sources Number of masks in @p source array
  * @param source_size Number of bits in each mask in @p source
  * @param number_of_mask_words The number of words of type bitmask_type to copy
+ * @param valid_count If not null, the number of set bits of the result is added to it
  */
-__global__ void offset_bitmask_and(bitmask_type *__restrict__ destination,
-                                   bitmask_type const *const *__restrict__ source,
-                                   size_type const *__restrict__ begin_bit,
-                                   size_type num_sources,
-                                   size_type source_size,
-                                   size_type number_of_mask_words)
+template <size_type block_size, typename Binop>
+__global__ void offset_bitmask_binop(Binop op,
+                                     bitmask_type *__restrict__ destination,
+                                     bitmask_type const *const *__restrict__ source,
+                                     size_type const *__restrict__ begin_bit,
+                                     size_type num_sources,
+                                     size_type source_size,
+                                     size_type number_of_mask_words,
+                                     size_type *valid_count)
 {
+  size_type thread_count{0};
   for (size_type destination_word_index = threadIdx.x + blockIdx.x * blockDim.x;
        destination_word_index < number_of_mask_words;
        destination_word_index += blockDim.x * gridDim.x) {
-    bitmask_type destination_word = ~bitmask_type{0};  // All bits 1
-    for (size_type i = 0; i < num_sources; i++) {
-      destination_word &= get_mask_offset_word(
+    auto const source_word = [&](size_type i) {
+      return get_mask_offset_word(
         source[i], destination_word_index, begin_bit[i], begin_bit[i] + source_size);
+    };
+    bitmask_type destination_word = source_word(0);
+    for (size_type i = 1; i < num_sources; i++) {
+      destination_word = op(destination_word, source_word(i));
     }
 
     destination[destination_word_index] = destination_word;
+
+    // The bits of the last word past the end of the mask are not counted
+    auto const num_tail_bits = source_size % detail::size_in_bits<bitmask_type>();
+    if (destination_word_index == number_of_mask_words - 1 and num_tail_bits > 0) {
+      destination_word &= set_least_significant_bits(num_tail_bits);
+    }
+    thread_count += __popc(destination_word);
+  }
+
+  if (valid_count != nullptr) {
+    using BlockReduce = cub::BlockReduce<size_type, block_size>;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    size_type block_count{BlockReduce(temp_storage).Sum(thread_count)};
+    if (threadIdx.x == 0) { atomicAdd(valid_count, block_count); }
   }
 }
 
-// Bitwise AND of the masks
-rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
-                               std::vector<size_type> const &begin_bits,
-                               size_type mask_size,
-                               cudaStream_t stream,
-                               rmm::mr::device_memory_resource *mr)
+struct bitwise_and {
+  __device__ bitmask_type operator()(bitmask_type lhs, bitmask_type rhs) const
+  {
+    return lhs & rhs;
+  }
+};
+
+struct bitwise_or {
+  __device__ bitmask_type operator()(bitmask_type lhs, bitmask_type rhs) const
+  {
+    return lhs | rhs;
+  }
+};
+
+// Bitwise operation across the masks, adding the set bits of the result to `valid_count` if not
+// null
+template <typename Binop>
+rmm::device_buffer bitmask_binop(Binop op,
+                                 std::vector<bitmask_type const *> const &masks,
+                                 std::vector<size_type> const &begin_bits,
+                                 size_type mask_size,
+                                 size_type *valid_count,
+                                 cudaStream_t stream,
+                                 rmm::mr::device_memory_resource *mr)
 {
   CUDF_EXPECTS(std::all_of(begin_bits.begin(), begin_bits.end(), [](auto b) { return b >= 0; }),
                "Invalid range.");
   CUDF_EXPECTS(mask_size > 0, "Invalid bit range.");
   CUDF_EXPECTS(std::all_of(masks.begin(), masks.end(), [](auto p) { return p != nullptr; }),
                "Mask pointer cannot be null");
+  CUDF_EXPECTS(not masks.empty(), "At least one mask is required.");
 
   rmm::device_buffer dest_mask{};
   auto num_bytes = bitmask_allocation_size_bytes(mask_size);
@@ -364,20 +412,80 @@ rmm::device_buffer bitmask_and(std::vector<bitmask_type const *> const &masks,
   rmm::device_vector<bitmask_type const *> d_masks(masks);
   rmm::device_vector<size_type> d_begin_bits(begin_bits);
 
-  cudf::detail::grid_1d config(number_of_mask_words, 256);
-  offset_bitmask_and<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-    static_cast<bitmask_type *>(dest_mask.data()),
-    d_masks.data().get(),
-    d_begin_bits.data().get(),
-    d_masks.size(),
-    mask_size,
-    number_of_mask_words);
+  constexpr size_type block_size{256};
+  cudf::detail::grid_1d config(number_of_mask_words, block_size);
+  offset_bitmask_binop<block_size>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+      op,
+      static_cast<bitmask_type *>(dest_mask.data()),
+      d_masks.data().get(),
+      d_begin_bits.data().get(),
+      d_masks.size(),
+      mask_size,
+      number_of_mask_words,
+      valid_count);
 
   CHECK_CUDA(stream);
 
   return dest_mask;
 }
 
+/**
+ * @brief Combines the null masks of the columns of a table with a bitwise operation
+ *
+ * A column without a null mask is all valid: it is skipped by AND and makes the result of OR all
+ * valid. If a single mask remains and its null count is known, it is copied.
+ *
+ * @param op `bitwise_and` or `bitwise_or`
+ * @param view The table of columns
+ * @param valid_count If not null, scratch used to compute the null count of the result in the same
+ * kernel as the mask; otherwise the returned null count is `UNKNOWN_NULL_COUNT`
+ * @return The output bitmask, empty if the result is all valid, and its null count
+ */
+template <typename Binop>
+std::pair<rmm::device_buffer, size_type> table_bitmask_binop(
+  Binop op,
+  table_view const &view,
+  rmm::device_scalar<size_type> *valid_count,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource *mr)
+{
+  auto const all_valid = [&] { return std::make_pair(rmm::device_buffer{0, stream, mr}, 0); };
+  if (view.num_rows() == 0 or view.num_columns() == 0) { return all_valid(); }
+  if (std::is_same<Binop, bitwise_or>::value and
+      std::any_of(view.begin(), view.end(), [](auto const &col) { return not col.nullable(); })) {
+    return all_valid();
+  }
+
+  std::vector<bitmask_type const *> masks;
+  std::vector<size_type> offsets;
+  for (auto const &col : view) {
+    if (col.nullable()) {
+      masks.push_back(col.null_mask());
+      offsets.push_back(col.offset());
+    }
+  }
+  if (masks.empty()) { return all_valid(); }
+
+  // A single mask is copied, and its null count is known if the column's is
+  if (masks.size() == 1) {
+    auto const col =
+      *std::find_if(view.begin(), view.end(), [](auto const &c) { return c.nullable(); });
+    if (valid_count == nullptr or col.has_known_null_count()) {
+      return {copy_bitmask(col, stream, mr),
+              valid_count == nullptr ? UNKNOWN_NULL_COUNT : col.null_count()};
+    }
+  }
+
+  if (valid_count == nullptr) {
+    return {bitmask_binop(op, masks, offsets, view.num_rows(), nullptr, stream, mr),
+            UNKNOWN_NULL_COUNT};
+  }
+  auto null_mask =
+    bitmask_binop(op, masks, offsets, view.num_rows(), valid_count->data(), stream, mr);
+  return {std::move(null_mask), view.num_rows() - valid_count->value(stream)};
+}
+
 // convert [first_bit_index,last_bit_index) to
 // [first_word_index,last_word_index)
 struct to_word_index : public thrust::unary_function<size_type, size_type> {
@@ -426,7 +534,7 @@ cudf::size_type count_set_bits(bitmask_type const *bitmask,
 
   cudf::detail::grid_1d grid(num_words, block_size);
 
-  rmm::device_scalar<size_type> non_zero_count(0, stream);
+  rmm::device_scalar<size_type> non_zero_count(0, stream, get_scratch_resource());
 
   count_set_bits_kernel<block_size><<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
     bitmask, start, stop - 1, non_zero_count.data());
@@ -650,21 +758,47 @@ rmm::device_buffer bitmask_and(table_view const &view,
                                cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  rmm::device_buffer null_mask{0, stream, mr};
-  if (view.num_rows() == 0 or view.num_columns() == 0) { return null_mask; }
+  return table_bitmask_binop(bitwise_and{}, view, nullptr, stream, mr).first;
+}
 
-  std::vector<bitmask_type const *> masks;
-  std::vector<size_type> offsets;
-  for (auto &&col : view) {
-    if (col.nullable()) {
-      masks.push_back(col.null_mask());
-      offsets.push_back(col.offset());
-    }
-  }
+// Returns the bitwise OR of the null masks of all columns in the table view
+rmm::device_buffer bitmask_or(table_view const &view,
+                              rmm::mr::device_memory_resource *mr,
+                              cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return table_bitmask_binop(bitwise_or{}, view, nullptr, stream, mr).first;
+}
 
-  if (masks.size() > 0) { return bitmask_and(masks, offsets, view.num_rows(), stream, mr); }
+std::pair<rmm::device_buffer, size_type> bitmask_and_with_null_count(
+  table_view const &view, rmm::mr::device_memory_resource *mr, cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bitmask_and_with_null_count(view, mr, stream);
+}
 
-  return null_mask;
+std::pair<rmm::device_buffer, size_type> bitmask_or_with_null_count(
+  table_view const &view, rmm::mr::device_memory_resource *mr, cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bitmask_or_with_null_count(view, mr, stream);
 }
 
+namespace detail {
+std::pair<rmm::device_buffer, size_type> bitmask_and_with_null_count(
+  table_view const &view, rmm::mr::device_memory_resource *mr, cudaStream_t stream)
+{
+  rmm::device_scalar<size_type> valid_count(0, stream, get_scratch_resource());
+  return table_bitmask_binop(bitwise_and{}, view, &valid_count, stream, mr);
+}
+
+std::pair<rmm::device_buffer, size_type> bitmask_or_with_null_count(
+  table_view const &view, rmm::mr::device_memory_resource *mr, cudaStream_t stream)
+{
+  rmm::device_scalar<size_type> valid_count(0, stream, get_scratch_resource());
+  return table_bitmask_binop(bitwise_or{}, view, &valid_count, stream, mr);
+}
+
+}  // namespace detail
+
 }  // namespace cudf
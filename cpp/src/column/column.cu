@@ -21,6 +21,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/copying.hpp>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -225,6 +226,24 @@ struct create_column_from_view {
   {
     CUDF_FAIL("list_view not supported yet");
   }
+
+  template <typename ColumnType,
+            std::enable_if_t<std::is_same<ColumnType, cudf::struct_view>::value> * = nullptr>
+  std::unique_ptr<column> operator()()
+  {
+    // the copied children start at the first row of the view
+    structs_column_view sview(view);
+    std::vector<std::unique_ptr<column>> children;
+    for (size_type i = 0; i < sview.num_children(); ++i) {
+      children.emplace_back(std::make_unique<column>(sview.child(i), stream, mr));
+    }
+    return std::make_unique<column>(view.type(),
+                                    view.size(),
+                                    rmm::device_buffer{0, stream, mr},
+                                    cudf::copy_bitmask(view, stream, mr),
+                                    view.null_count(),
+                                    std::move(children));
+  }
 };
 }  // anonymous namespace
 
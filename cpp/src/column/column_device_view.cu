@@ -17,6 +17,7 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
 #include <numeric>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -114,7 +115,7 @@ create_device_view_from_view(ColumnView const& source, cudaStream_t stream)
   // require setting some internal device pointers before being copied
   // from CPU to device.
   rmm::device_buffer* const descendant_storage =
-    new rmm::device_buffer(descendant_storage_bytes, stream);
+    new rmm::device_buffer(descendant_storage_bytes, stream, get_scratch_resource());
 
   auto deleter = [descendant_storage](ColumnDeviceView* v) {
     v->destroy();
@@ -108,6 +108,24 @@ std::unique_ptr<column> make_duration_column(data_type type,
                                   std::vector<std::unique_ptr<column>>{});
 }
 
+// Allocate storage for a specified number of fixed-point elements
+std::unique_ptr<column> make_fixed_point_column(data_type type,
+                                                size_type size,
+                                                mask_state state,
+                                                cudaStream_t stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(is_fixed_point(type), "Invalid, non-fixed-point type.");
+
+  return std::make_unique<column>(type,
+                                  size,
+                                  rmm::device_buffer{size * cudf::size_of(type), stream, mr},
+                                  create_null_mask(size, state, stream, mr),
+                                  state_null_count(state, size),
+                                  std::vector<std::unique_ptr<column>>{});
+}
+
 // Allocate storage for a specified number of fixed width elements
 std::unique_ptr<column> make_fixed_width_column(data_type type,
                                                 size_type size,
@@ -122,6 +140,8 @@ std::unique_ptr<column> make_fixed_width_column(data_type type,
     return make_timestamp_column(type, size, state, stream, mr);
   } else if (is_duration(type)) {
     return make_duration_column(type, size, state, stream, mr);
+  } else if (is_fixed_point(type)) {
+    return make_fixed_point_column(type, size, state, stream, mr);
   }
   return make_numeric_column(type, size, state, stream, mr);
 }
@@ -190,6 +210,16 @@ std::unique_ptr<cudf::column> column_from_scalar_dispatch::operator()<cudf::list
   CUDF_FAIL("TODO");
 }
 
+template <>
+std::unique_ptr<cudf::column> column_from_scalar_dispatch::operator()<cudf::struct_view>(
+  scalar const& value,
+  size_type size,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FAIL("struct_view not supported yet");
+}
+
 std::unique_ptr<column> make_column_from_scalar(scalar const& s,
                                                 size_type size,
                                                 rmm::mr::device_memory_resource* mr,
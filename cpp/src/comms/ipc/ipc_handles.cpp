@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/ipc_handles.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Identifies the descriptors created by `export_ipc`
+ */
+constexpr uint32_t ipc_magic{0x43495031};  // "CIP1"
+
+/**
+ * @brief The header of the descriptor
+ */
+struct ipc_table_header {
+  uint32_t magic;
+  size_type num_columns;
+  size_type num_allocations;
+  size_type num_serialized_columns;  ///< Number of columns including all children
+};
+
+/**
+ * @brief The position of a buffer within the exported allocations
+ */
+struct ipc_buffer {
+  int32_t allocation;  ///< Index of the allocation holding the buffer or -1 if there is none
+  int64_t offset;      ///< Position of the buffer within the allocation
+};
+
+/**
+ * @brief The metadata of one column
+ *
+ * The columns are stored in pre-order: each column is followed by the metadata
+ * of its children.
+ */
+struct ipc_column {
+  type_id type;
+  int32_t scale;
+  size_type size;
+  size_type null_count;
+  size_type offset;
+  size_type num_children;
+  ipc_buffer data;
+  ipc_buffer null_mask;
+};
+
+/**
+ * @brief Collects the distinct allocations referenced by the exported columns
+ */
+class allocation_table {
+ public:
+  /**
+   * @brief Returns the position of `ptr` within its allocation, adding the allocation if needed
+   */
+  ipc_buffer locate(void const* ptr)
+  {
+    if (ptr == nullptr) { return ipc_buffer{-1, 0}; }
+    CUdeviceptr base;
+    size_t size;
+    CUDF_EXPECTS(cuMemGetAddressRange(&base, &size, reinterpret_cast<CUdeviceptr>(ptr)) ==
+                   CUDA_SUCCESS,
+                 "Column memory is not a device allocation");
+    auto const base_ptr = reinterpret_cast<void*>(base);
+    auto const offset   = static_cast<uint8_t const*>(ptr) - static_cast<uint8_t const*>(base_ptr);
+    auto it             = std::find(_bases.begin(), _bases.end(), base_ptr);
+    if (it == _bases.end()) {
+      cudaIpcMemHandle_t handle;
+      CUDA_TRY(cudaIpcGetMemHandle(&handle, base_ptr));
+      _handles.push_back(handle);
+      it = _bases.insert(_bases.end(), base_ptr);
+    }
+    return ipc_buffer{static_cast<int32_t>(it - _bases.begin()), offset};
+  }
+
+  std::vector<cudaIpcMemHandle_t> const& handles() const { return _handles; }
+
+ private:
+  std::vector<void*> _bases;
+  std::vector<cudaIpcMemHandle_t> _handles;
+};
+
+void serialize_column(column_view const& col,
+                      allocation_table& allocations,
+                      std::vector<ipc_column>& columns)
+{
+  columns.push_back(ipc_column{col.type().id(),
+                               col.type().scale(),
+                               col.size(),
+                               col.null_count(),
+                               col.offset(),
+                               col.num_children(),
+                               allocations.locate(col.head()),
+                               allocations.locate(col.null_mask())});
+  std::for_each(col.child_begin(), col.child_end(), [&](column_view const& child) {
+    serialize_column(child, allocations, columns);
+  });
+}
+
+/**
+ * @brief Rebuilds the column at `next` and its children, advancing `next` past them
+ */
+column_view deserialize_column(ipc_column const*& next,
+                               ipc_column const* end,
+                               std::vector<void*> const& allocations)
+{
+  CUDF_EXPECTS(next < end, "Invalid IPC table descriptor");
+  auto const& col = *next++;
+  std::vector<column_view> children;
+  for (size_type idx = 0; idx < col.num_children; ++idx) {
+    children.push_back(deserialize_column(next, end, allocations));
+  }
+  auto const resolve = [&](ipc_buffer const& buffer) -> void const* {
+    if (buffer.allocation < 0) { return nullptr; }
+    CUDF_EXPECTS(static_cast<size_t>(buffer.allocation) < allocations.size(),
+                 "Invalid IPC table descriptor");
+    return static_cast<uint8_t const*>(allocations[buffer.allocation]) + buffer.offset;
+  };
+  return column_view(data_type{col.type, col.scale},
+                     col.size,
+                     resolve(col.data),
+                     static_cast<bitmask_type const*>(resolve(col.null_mask)),
+                     col.null_count,
+                     col.offset,
+                     children);
+}
+
+}  // namespace
+}  // namespace detail
+
+std::vector<uint8_t> export_ipc(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  detail::allocation_table allocations;
+  std::vector<detail::ipc_column> columns;
+  std::for_each(input.begin(), input.end(), [&](column_view const& col) {
+    detail::serialize_column(col, allocations, columns);
+  });
+
+  auto const& handles = allocations.handles();
+  detail::ipc_table_header const header{detail::ipc_magic,
+                                        input.num_columns(),
+                                        static_cast<size_type>(handles.size()),
+                                        static_cast<size_type>(columns.size())};
+  auto const handles_size = handles.size() * sizeof(cudaIpcMemHandle_t);
+  auto const columns_size = columns.size() * sizeof(detail::ipc_column);
+  std::vector<uint8_t> descriptor(sizeof(header) + handles_size + columns_size);
+  auto next = descriptor.data();
+  std::memcpy(next, &header, sizeof(header));
+  std::memcpy(next += sizeof(header), handles.data(), handles_size);
+  std::memcpy(next += handles_size, columns.data(), columns_size);
+  return descriptor;
+}
+
+imported_table::~imported_table()
+{
+  // Errors cannot be reported from a destructor; a handle that fails to close is leaked
+  for (auto ptr : _allocations) { cudaIpcCloseMemHandle(ptr); }
+}
+
+std::unique_ptr<imported_table> import_ipc(std::vector<uint8_t> const& descriptor)
+{
+  CUDF_FUNC_RANGE();
+  detail::ipc_table_header header;
+  CUDF_EXPECTS(descriptor.size() >= sizeof(header), "Invalid IPC table descriptor");
+  std::memcpy(&header, descriptor.data(), sizeof(header));
+  CUDF_EXPECTS(header.magic == detail::ipc_magic, "Invalid IPC table descriptor");
+  CUDF_EXPECTS(header.num_allocations >= 0 && header.num_serialized_columns >= header.num_columns,
+               "Invalid IPC table descriptor");
+  auto const handles_size = header.num_allocations * sizeof(cudaIpcMemHandle_t);
+  auto const columns_size = header.num_serialized_columns * sizeof(detail::ipc_column);
+  CUDF_EXPECTS(descriptor.size() == sizeof(header) + handles_size + columns_size,
+               "Invalid IPC table descriptor");
+
+  // The descriptor may have been received into memory of any alignment
+  std::vector<cudaIpcMemHandle_t> handles(header.num_allocations);
+  std::vector<detail::ipc_column> columns(header.num_serialized_columns);
+  std::memcpy(handles.data(), descriptor.data() + sizeof(header), handles_size);
+  std::memcpy(columns.data(), descriptor.data() + sizeof(header) + handles_size, columns_size);
+
+  std::unique_ptr<imported_table> result{new imported_table};
+  for (auto const& handle : handles) {
+    void* ptr;
+    CUDA_TRY(cudaIpcOpenMemHandle(&ptr, handle, cudaIpcMemLazyEnablePeerAccess));
+    result->_allocations.push_back(ptr);
+  }
+
+  auto next = columns.data();
+  std::vector<column_view> views;
+  for (size_type idx = 0; idx < header.num_columns; ++idx) {
+    views.push_back(
+      detail::deserialize_column(next, columns.data() + columns.size(), result->_allocations));
+  }
+  result->_view = table_view(views);
+  return result;
+}
+
+}  // namespace cudf
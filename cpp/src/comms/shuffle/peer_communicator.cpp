@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/shuffle.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <condition_variable>
+#include <mutex>
+
+namespace cudf {
+namespace comms {
+namespace {
+/**
+ * @brief State shared by the ranks of a peer group: the buffers each rank is sending
+ */
+class peer_group {
+ public:
+  explicit peer_group(std::vector<int> const& devices)
+    : devices(devices),
+      host_send(devices.size(), nullptr),
+      device_send(devices.size(), nullptr),
+      device_send_sizes(devices.size(), nullptr)
+  {
+  }
+
+  /**
+   * @brief Blocks until all ranks of the group reach the barrier
+   */
+  void barrier()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto const generation = _generation;
+    if (++_arrived == devices.size()) {
+      _arrived = 0;
+      ++_generation;
+      _all_arrived.notify_all();
+    } else {
+      _all_arrived.wait(lock, [&]() { return _generation != generation; });
+    }
+  }
+
+  std::vector<int> const devices;
+  // Slot `r` is written by rank `r` before the first barrier of an exchange and read by the
+  // other ranks until the second barrier
+  std::vector<std::vector<std::vector<uint8_t>> const*> host_send;
+  std::vector<std::vector<void const*> const*> device_send;
+  std::vector<std::vector<size_t> const*> device_send_sizes;
+
+ private:
+  std::mutex _mutex;
+  std::condition_variable _all_arrived;
+  size_t _arrived    = 0;
+  size_t _generation = 0;
+};
+
+/**
+ * @brief Communicator of a rank of a peer group; each rank pulls the buffers sent to it
+ */
+class peer_communicator : public communicator {
+ public:
+  peer_communicator(int rank, std::shared_ptr<peer_group> group)
+    : _rank(rank), _group(std::move(group))
+  {
+  }
+
+  int rank() const override { return _rank; }
+
+  int size() const override { return static_cast<int>(_group->devices.size()); }
+
+  std::vector<std::vector<uint8_t>> all_to_all(
+    std::vector<std::vector<uint8_t>> const& send) override
+  {
+    CUDF_EXPECTS(send.size() == static_cast<size_t>(size()), "Expected one message per rank");
+    _group->host_send[_rank] = &send;
+    _group->barrier();
+    std::vector<std::vector<uint8_t>> recv(size());
+    for (int r = 0; r < size(); ++r) { recv[r] = (*_group->host_send[r])[_rank]; }
+    _group->barrier();
+    return recv;
+  }
+
+  void all_to_all(std::vector<void const*> const& send,
+                  std::vector<size_t> const& send_sizes,
+                  std::vector<void*> const& recv,
+                  std::vector<size_t> const& recv_sizes,
+                  cudaStream_t stream) override
+  {
+    auto const num_ranks = static_cast<size_t>(size());
+    CUDF_EXPECTS(send.size() == num_ranks && send_sizes.size() == num_ranks &&
+                   recv.size() == num_ranks && recv_sizes.size() == num_ranks,
+                 "Expected one buffer per rank");
+    _group->device_send[_rank]       = &send;
+    _group->device_send_sizes[_rank] = &send_sizes;
+    _group->barrier();
+
+    // Errors are raised only after the second barrier, so that the other ranks are not left
+    // waiting for this one
+    bool sizes_match  = true;
+    cudaError_t error = cudaSuccess;
+    for (size_t r = 0; r < num_ranks && error == cudaSuccess; ++r) {
+      auto const size = (*_group->device_send_sizes[r])[_rank];
+      if (size != recv_sizes[r]) {
+        sizes_match = false;
+        continue;
+      }
+      if (size == 0) { continue; }
+      error = cudaMemcpyPeerAsync(recv[r],
+                                  _group->devices[_rank],
+                                  (*_group->device_send[r])[_rank],
+                                  _group->devices[r],
+                                  size,
+                                  stream);
+    }
+    // The senders may free their buffers once every receiver has finished copying them
+    if (error == cudaSuccess) { error = cudaStreamSynchronize(stream); }
+    _group->barrier();
+
+    CUDA_TRY(error);
+    CUDF_EXPECTS(sizes_match, "Received buffer size differs from the size sent");
+  }
+
+ private:
+  int const _rank;
+  std::shared_ptr<peer_group> _group;
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<communicator>> make_peer_communicators(std::vector<int> const& devices)
+{
+  CUDF_EXPECTS(not devices.empty(), "A peer group needs at least one rank");
+  auto group = std::make_shared<peer_group>(devices);
+  std::vector<std::unique_ptr<communicator>> result;
+  for (size_t r = 0; r < devices.size(); ++r) {
+    result.push_back(std::make_unique<peer_communicator>(static_cast<int>(r), group));
+  }
+  return result;
+}
+
+}  // namespace comms
+}  // namespace cudf
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/shuffle.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf {
+namespace comms {
+namespace {
+/**
+ * @brief Host message announcing a packed partition: the size of its device buffer followed by
+ * its metadata
+ */
+std::vector<uint8_t> make_partition_message(packed_columns const& partition)
+{
+  uint64_t const gpu_size = partition.gpu_data->size();
+  std::vector<uint8_t> message(sizeof(gpu_size) + partition.metadata->size());
+  std::memcpy(message.data(), &gpu_size, sizeof(gpu_size));
+  std::copy(partition.metadata->begin(), partition.metadata->end(), message.begin() + sizeof(gpu_size));
+  return message;
+}
+
+size_t partition_message_gpu_size(std::vector<uint8_t> const& message)
+{
+  uint64_t gpu_size;
+  CUDF_EXPECTS(message.size() >= sizeof(gpu_size), "Invalid shuffle partition message");
+  std::memcpy(&gpu_size, message.data(), sizeof(gpu_size));
+  return gpu_size;
+}
+
+}  // namespace
+
+std::unique_ptr<table> shuffle(table_view const& input,
+                               std::vector<size_type> const& columns_to_hash,
+                               communicator& comm,
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  auto const num_ranks = comm.size();
+  auto const partitions =
+    cudf::detail::hash_partition_and_pack(input,
+                                          columns_to_hash,
+                                          num_ranks,
+                                          hash_id::HASH_MURMUR3,
+                                          rmm::mr::get_default_resource(),
+                                          stream);
+  // The partitions are read by the other ranks outside of `stream`
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  std::vector<std::vector<uint8_t>> messages;
+  std::vector<void const*> send;
+  std::vector<size_t> send_sizes;
+  for (auto const& partition : partitions) {
+    messages.push_back(make_partition_message(partition));
+    send.push_back(partition.gpu_data->data());
+    send_sizes.push_back(partition.gpu_data->size());
+  }
+  auto const received = comm.all_to_all(messages);
+
+  std::vector<rmm::device_buffer> buffers;
+  buffers.reserve(received.size());
+  std::vector<void*> recv;
+  std::vector<size_t> recv_sizes;
+  for (auto const& message : received) {
+    recv_sizes.push_back(partition_message_gpu_size(message));
+    buffers.emplace_back(recv_sizes.back(), stream);
+    recv.push_back(buffers.back().data());
+  }
+  comm.all_to_all(send, send_sizes, recv, recv_sizes, stream);
+
+  std::vector<table_view> views;
+  for (size_t r = 0; r < received.size(); ++r) {
+    views.push_back(unpack(received[r].data() + sizeof(uint64_t),
+                           static_cast<uint8_t const*>(buffers[r].data())));
+  }
+  return cudf::detail::concatenate(views, mr, stream);
+}
+
+}  // namespace comms
+}  // namespace cudf
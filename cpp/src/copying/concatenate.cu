@@ -17,18 +17,23 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/dictionary/detail/concatenate.hpp>
 #include <cudf/lists/detail/concatenate.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/strings/detail/concatenate.hpp>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/scratch_memory.hpp>
 
 #include <thrust/binary_search.h>
-#include <thrust/transform_scan.h>
 
 #include <algorithm>
+#include <iterator>
 #include <numeric>
 #include <utility>
 
@@ -42,46 +47,49 @@ constexpr bool use_fused_kernel_heuristic(bool const has_nulls, size_t const num
   return has_nulls || num_columns > 4;
 }
 
-auto create_device_views(std::vector<column_view> const& views, cudaStream_t stream)
+concatenate_device_views create_device_views(std::vector<column_view> const& views,
+                                             cudaStream_t stream)
 {
-  // Create device views for each input view
-  using CDViewPtr =
-    decltype(column_device_view::create(std::declval<column_view>(), std::declval<cudaStream_t>()));
-  auto device_view_owners = std::vector<CDViewPtr>(views.size());
-  std::transform(
-    views.cbegin(), views.cend(), device_view_owners.begin(), [stream](auto const& col) {
-      // TODO creating this device view can invoke null count computation
-      // even though it isn't used. See this issue:
-      // https://github.com/rapidsai/cudf/issues/4368
-      return column_device_view::create(col, stream);
+  // The views are stored first, followed by the descendants of all the views and the offsets.
+  // Both the views and their children are multiples of the alignment of `column_device_view`.
+  auto const views_bytes = views.size() * sizeof(column_device_view);
+  auto const descendants_bytes =
+    std::accumulate(views.cbegin(), views.cend(), std::size_t{0}, [](auto acc, auto const& col) {
+      return acc + column_device_view::extent(col) - sizeof(column_device_view);
     });
+  auto const offsets_bytes = (views.size() + 1) * sizeof(size_t);
+
+  // Assemble everything in host memory, so that a single copy uploads it
+  std::vector<char> staging_buffer(views_bytes + descendants_bytes + offsets_bytes);
+  concatenate_device_views result{rmm::device_buffer(staging_buffer.size(), stream)};
+
+  auto* h_views       = reinterpret_cast<column_device_view*>(staging_buffer.data());
+  auto* h_descendants = staging_buffer.data() + views_bytes;
+  auto* d_descendants = static_cast<char*>(result.storage.data()) + views_bytes;
+  auto* h_offsets =
+    reinterpret_cast<size_t*>(staging_buffer.data() + views_bytes + descendants_bytes);
+  h_offsets[0] = 0;
+  for (std::size_t i = 0; i < views.size(); ++i) {
+    new (h_views + i) column_device_view(views[i], h_descendants, d_descendants);
+    auto const descendant_bytes = column_device_view::extent(views[i]) - sizeof(column_device_view);
+    h_descendants += descendant_bytes;
+    d_descendants += descendant_bytes;
+    h_offsets[i + 1] = h_offsets[i] + views[i].size();
+  }
 
-  // Assemble contiguous array of device views
-  auto device_views = thrust::host_vector<column_device_view>();
-  device_views.reserve(views.size());
-  std::transform(device_view_owners.cbegin(),
-                 device_view_owners.cend(),
-                 std::back_inserter(device_views),
-                 [](auto const& col) { return *col; });
-  // TODO each of these device vector copies invoke stream synchronization
-  // which appears to add unnecessary overhead. See this issue:
-  // https://github.com/rapidsai/rmm/issues/120
-  auto d_views = rmm::device_vector<column_device_view>{device_views};
-
-  // Compute the partition offsets
-  auto offsets = thrust::host_vector<size_t>(views.size() + 1);
-  thrust::transform_inclusive_scan(
-    thrust::host,
-    device_views.cbegin(),
-    device_views.cend(),
-    std::next(offsets.begin()),
-    [](auto const& col) { return col.size(); },
-    thrust::plus<size_t>{});
-  auto const d_offsets   = rmm::device_vector<size_t>{offsets};
-  auto const output_size = offsets.back();
-
-  return std::make_tuple(
-    std::move(device_view_owners), std::move(d_views), std::move(d_offsets), output_size);
+  // The copy from pageable memory returns once the staging buffer has been read
+  CUDA_TRY(cudaMemcpyAsync(result.storage.data(),
+                           staging_buffer.data(),
+                           staging_buffer.size(),
+                           cudaMemcpyHostToDevice,
+                           stream));
+
+  auto* d_storage    = static_cast<char*>(result.storage.data());
+  result.views       = reinterpret_cast<column_device_view const*>(d_storage);
+  result.offsets     = reinterpret_cast<size_t const*>(d_storage + views_bytes + descendants_bytes);
+  result.num_views   = static_cast<size_type>(views.size());
+  result.output_size = h_offsets[views.size()];
+  return result;
 }
 
 /**
@@ -124,20 +132,15 @@ __global__ void concatenate_masks_kernel(column_device_view const* views,
   }
 }
 
-void concatenate_masks(rmm::device_vector<column_device_view> const& d_views,
-                       rmm::device_vector<size_t> const& d_offsets,
+void concatenate_masks(concatenate_device_views const& d_views,
                        bitmask_type* dest_mask,
-                       size_type output_size,
                        cudaStream_t stream)
 {
   constexpr size_type block_size{256};
+  auto const output_size = static_cast<size_type>(d_views.output_size);
   cudf::detail::grid_1d config(output_size, block_size);
   concatenate_masks_kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-    d_views.data().get(),
-    d_offsets.data().get(),
-    static_cast<size_type>(d_views.size()),
-    dest_mask,
-    output_size);
+    d_views.views, d_views.offsets, d_views.num_views, dest_mask, output_size);
 }
 
 void concatenate_masks(std::vector<column_view> const& views,
@@ -145,12 +148,26 @@ void concatenate_masks(std::vector<column_view> const& views,
                        cudaStream_t stream)
 {
   // Preprocess and upload inputs to device memory
-  auto const device_views = create_device_views(views, stream);
-  auto const& d_views     = std::get<1>(device_views);
-  auto const& d_offsets   = std::get<2>(device_views);
-  auto const output_size  = std::get<3>(device_views);
+  auto const d_views = create_device_views(views, stream);
+
+  concatenate_masks(d_views, dest_mask, stream);
+}
+
+bool may_have_nulls(std::vector<column_view> const& views)
+{
+  return std::any_of(views.begin(), views.end(), [](auto const& col) {
+    return col.nullable() and (not col.has_known_null_count() or col.null_count() > 0);
+  });
+}
 
-  concatenate_masks(d_views, d_offsets, dest_mask, output_size, stream);
+size_type concatenated_null_count(std::vector<column_view> const& views)
+{
+  size_type null_count = 0;
+  for (auto const& col : views) {
+    if (not col.has_known_null_count()) { return cudf::UNKNOWN_NULL_COUNT; }
+    null_count += col.null_count();
+  }
+  return null_count;
 }
 
 template <typename T, size_type block_size, bool Nullable>
@@ -214,10 +231,8 @@ std::unique_ptr<column> fused_concatenate(std::vector<column_view> const& views,
   using mask_policy = cudf::mask_allocation_policy;
 
   // Preprocess and upload inputs to device memory
-  auto const device_views = create_device_views(views, stream);
-  auto const& d_views     = std::get<1>(device_views);
-  auto const& d_offsets   = std::get<2>(device_views);
-  auto const output_size  = std::get<3>(device_views);
+  auto const d_views     = create_device_views(views, stream);
+  auto const output_size = d_views.output_size;
 
   CUDF_EXPECTS(output_size < std::numeric_limits<size_type>::max(),
                "Total number of concatenated rows exceeds size_type range");
@@ -229,7 +244,7 @@ std::unique_ptr<column> fused_concatenate(std::vector<column_view> const& views,
   auto out_view   = out_col->mutable_view();
   auto d_out_view = mutable_column_device_view::create(out_view, stream);
 
-  rmm::device_scalar<size_type> d_valid_count(0);
+  rmm::device_scalar<size_type> d_valid_count(0, stream, get_scratch_resource());
 
   // Launch kernel
   constexpr size_type block_size{256};
@@ -237,13 +252,16 @@ std::unique_ptr<column> fused_concatenate(std::vector<column_view> const& views,
   auto const kernel = has_nulls ? fused_concatenate_kernel<T, block_size, true>
                                 : fused_concatenate_kernel<T, block_size, false>;
   kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-    d_views.data().get(),
-    d_offsets.data().get(),
-    static_cast<size_type>(d_views.size()),
-    *d_out_view,
-    d_valid_count.data());
+    d_views.views, d_views.offsets, d_views.num_views, *d_out_view, d_valid_count.data());
 
-  if (has_nulls) { out_col->set_null_count(output_size - d_valid_count.value(stream)); }
+  if (has_nulls) {
+    // The null count is the sum of the input null counts when they are known, which avoids
+    // synchronizing on the count of the kernel
+    auto const null_count = concatenated_null_count(views);
+    out_col->set_null_count(null_count != cudf::UNKNOWN_NULL_COUNT
+                              ? null_count
+                              : output_size - d_valid_count.value(stream));
+  }
 
   return out_col;
 }
@@ -276,6 +294,9 @@ std::unique_ptr<column> for_each_concatenate(std::vector<column_view> const& vie
   // If concatenated column is nullable, proceed to calculate it
   if (has_nulls) {
     cudf::detail::concatenate_masks(views, (col->mutable_view()).null_mask(), stream);
+    col->set_null_count(concatenated_null_count(views));
+  } else {
+    col->set_null_count(0);
   }
 
   return col;
@@ -290,8 +311,7 @@ struct concatenate_dispatch {
   template <typename T>
   std::unique_ptr<column> operator()()
   {
-    bool const has_nulls =
-      std::any_of(views.cbegin(), views.cend(), [](auto const& col) { return col.has_nulls(); });
+    bool const has_nulls = may_have_nulls(views);
 
     // Use a heuristic to guess when the fused kernel will be faster
     if (use_fused_kernel_heuristic(has_nulls, views.size())) {
@@ -305,7 +325,7 @@ struct concatenate_dispatch {
 template <>
 std::unique_ptr<column> concatenate_dispatch::operator()<cudf::dictionary32>()
 {
-  CUDF_FAIL("dictionary concatenate not yet supported");
+  return cudf::dictionary::detail::concatenate(views, mr, stream);
 }
 
 template <>
@@ -320,6 +340,45 @@ std::unique_ptr<column> concatenate_dispatch::operator()<cudf::list_view>()
   return cudf::lists::detail::concatenate(views, stream, mr);
 }
 
+template <>
+std::unique_ptr<column> concatenate_dispatch::operator()<cudf::struct_view>()
+{
+  auto const num_fields = views.front().num_children();
+  CUDF_EXPECTS(std::all_of(views.begin(),
+                           views.end(),
+                           [num_fields](auto const& v) { return v.num_children() == num_fields; }),
+               "Mismatched number of struct fields in columns to concatenate.");
+
+  // Each field is concatenated from the rows of its parent views
+  std::vector<std::unique_ptr<column>> children;
+  for (size_type i = 0; i < num_fields; ++i) {
+    std::vector<column_view> fields;
+    std::transform(views.begin(), views.end(), std::back_inserter(fields), [i](auto const& v) {
+      return structs_column_view(v).child(i);
+    });
+    children.push_back(concatenate(fields, mr, stream));
+  }
+
+  size_type const total_element_count =
+    std::accumulate(views.begin(), views.end(), 0, [](auto accumulator, auto const& v) {
+      return accumulator + v.size();
+    });
+  bool const has_nulls = may_have_nulls(views);
+  auto null_mask       = create_null_mask(total_element_count,
+                                    has_nulls ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED,
+                                    stream,
+                                    mr);
+  if (has_nulls) {
+    concatenate_masks(views, static_cast<bitmask_type*>(null_mask.data()), stream);
+  }
+  return make_structs_column(total_element_count,
+                             std::move(children),
+                             has_nulls ? concatenated_null_count(views) : 0,
+                             std::move(null_mask),
+                             stream,
+                             mr);
+}
+
 // Concatenates the elements from a vector of column_views
 std::unique_ptr<column> concatenate(std::vector<column_view> const& columns_to_concat,
                                     rmm::mr::device_memory_resource* mr,
@@ -14,160 +14,136 @@
  * limitations under the License.
  */
 
-#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/transform.h>
+
+#include <cub/cub.cuh>
 
 #include <numeric>
 
 namespace cudf {
 namespace detail {
 namespace {
+// align all column size allocations to this boundary so that all output column buffers
+// start at that alignment.
+static constexpr size_t split_align = 64;
+
+// copies are cut into pieces of at most this many bytes, each copied by one block, so
+// that a few large columns do not leave most of the device idle while thousands of small
+// splits still launch only one kernel.
+static constexpr size_type copy_chunk_bytes = 64 * 1024;
+
+constexpr int copy_block_size = 256;
+
 /**
- * @brief Copies contents of `in` to `out`.  Copies validity if present
- * but does not compute null count.
- *
- * @param in column_view to copy from
- * @param out mutable_column_view to copy to.
+ * @brief The kinds of buffers copied by `copy_partitions_kernel`
  */
-template <size_type block_size, typename T, bool has_validity>
-__launch_bounds__(block_size) __global__
-  void copy_in_place_kernel(column_device_view const in, mutable_column_device_view out)
-{
-  const size_type tid            = threadIdx.x + blockIdx.x * block_size;
-  const int warp_id              = tid / cudf::detail::warp_size;
-  const size_type warps_per_grid = gridDim.x * block_size / cudf::detail::warp_size;
+enum class copy_kind : int8_t {
+  BYTES,     ///< plain copy of data or chars
+  VALIDITY,  ///< null mask realigned to start at bit 0 of the destination
+  OFFSETS    ///< strings offsets shifted down to start at 0
+};
+
+/**
+ * @brief A piece of one buffer of the input table to copy into the buffer of a split
+ */
+struct copy_op {
+  uint8_t const* src;
+  uint8_t* dst;
+  size_type size;            ///< bytes, bits or offsets to copy depending on `kind`
+  size_type src_bit_offset;  ///< VALIDITY: index of the first bit to copy from `src`
+  size_type offset_shift;    ///< OFFSETS: value subtracted from each offset
+  size_type count_index;     ///< VALIDITY: counter of the set bits of the output column
+  copy_kind kind;
+};
 
-  // begin/end indices for the column data
+__device__ void copy_bytes(copy_op const& op)
+{
   size_type begin = 0;
-  size_type end   = in.size();
-  // warp indices.  since 1 warp == 32 threads == sizeof(bit_mask_t) * 8,
-  // each warp will process one (32 bit) of the validity mask via
-  // __ballot_sync()
-  size_type warp_begin = cudf::word_index(begin);
-  size_type warp_end   = cudf::word_index(end - 1);
-
-  // lane id within the current warp
-  const int lane_id = threadIdx.x % cudf::detail::warp_size;
-
-  // current warp.
-  size_type warp_cur = warp_begin + warp_id;
-  size_type index    = tid;
-  while (warp_cur <= warp_end) {
-    bool in_range = (index >= begin && index < end);
-
-    bool valid = true;
-    if (has_validity) { valid = in_range && in.is_valid(index); }
-    if (in_range) { out.element<T>(index) = in.element<T>(index); }
-
-    // update validity
-    if (has_validity) {
-      // the final validity mask for this warp
-      int warp_mask = __ballot_sync(0xFFFF'FFFF, valid && in_range);
-      // only one guy in the warp needs to update the mask and count
-      if (lane_id == 0) { out.set_mask_word(warp_cur, warp_mask); }
+  // destinations are always aligned to `split_align`, so copy words when the source is too
+  if (reinterpret_cast<uintptr_t>(op.src) % sizeof(uint64_t) == 0) {
+    auto const src   = reinterpret_cast<uint64_t const*>(op.src);
+    auto const dst   = reinterpret_cast<uint64_t*>(op.dst);
+    auto const words = op.size / static_cast<size_type>(sizeof(uint64_t));
+    for (size_type idx = threadIdx.x; idx < words; idx += blockDim.x) {
+      dst[idx] = src[idx];
     }
+    begin = words * sizeof(uint64_t);
+  }
+  for (size_type idx = begin + threadIdx.x; idx < op.size; idx += blockDim.x) {
+    op.dst[idx] = op.src[idx];
+  }
+}
 
-    // next grid
-    warp_cur += warps_per_grid;
-    index += block_size * gridDim.x;
+template <int block_size>
+__device__ void copy_validity(copy_op const& op, size_type* valid_counts)
+{
+  auto const src        = reinterpret_cast<bitmask_type const*>(op.src);
+  auto const dst        = reinterpret_cast<bitmask_type*>(op.dst);
+  auto constexpr bits   = static_cast<size_type>(size_in_bits<bitmask_type>());
+  auto const first_word = word_index(op.src_bit_offset);
+  auto const shift      = intra_word_index(op.src_bit_offset);
+  auto const src_words  = word_index(op.src_bit_offset + op.size - 1) - first_word + 1;
+  auto const dst_words  = (op.size + bits - 1) / bits;
+  size_type valid_count = 0;
+  for (size_type idx = threadIdx.x; idx < dst_words; idx += blockDim.x) {
+    auto const curr = src[first_word + idx];
+    auto const next = idx + 1 < src_words ? src[first_word + idx + 1] : bitmask_type{0};
+    auto word       = __funnelshift_r(curr, next, shift);
+    // clear the bits past the end of the column
+    auto const remaining = op.size - idx * bits;
+    if (remaining < bits) { word &= (bitmask_type{1} << remaining) - 1; }
+    dst[idx] = word;
+    valid_count += __popc(word);
+  }
+  using BlockReduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  auto const block_count = BlockReduce(temp_storage).Sum(valid_count);
+  if (threadIdx.x == 0) { atomicAdd(valid_counts + op.count_index, block_count); }
+}
+
+__device__ void copy_offsets(copy_op const& op)
+{
+  auto const src = reinterpret_cast<size_type const*>(op.src);
+  auto const dst = reinterpret_cast<size_type*>(op.dst);
+  for (size_type idx = threadIdx.x; idx < op.size; idx += blockDim.x) {
+    dst[idx] = src[idx] - op.offset_shift;
   }
 }
 
 /**
- * @brief Copies contents of one string column to another.  Copies validity if present
- * but does not compute null count.
- *
- * The purpose of this kernel is to reduce the number of
- * kernel calls for copying a string column from 2 to 1, since number of kernel calls is the
- * dominant factor in large scale contiguous_split() calls.  To do this, the kernel is
- * invoked with using max(num_chars, num_offsets) threads and then doing separate
- * bounds checking on offset, chars and validity indices.
+ * @brief Copies all the buffers of all the splits, one `copy_op` per block
  *
- * Outgoing offset values are shifted down to account for the new base address
- * each column gets as a result of the contiguous_split() process.
+ * The number of set bits of each output null mask is accumulated in `valid_counts`.
  *
- * @param in num_strings number of strings (rows) in the column
- * @param in offsets_in pointer to incoming offsets to be copied
- * @param out offsets_out pointer to output offsets
- * @param in validity_in_offset offset into validity buffer to add to element indices
- * @param in validity_in pointer to incoming validity vector to be copied
- * @param out validity_out pointer to output validity vector
- * @param in offset_shift value to shift copied offsets down by
- * @param in num_chars number of chars to copy
- * @param in chars_in input chars to be copied
- * @param out chars_out output chars to be copied.
+ * @param ops The pieces of the buffers to copy
+ * @param valid_counts Counters of the set bits of each output column, zero-initialized
  */
-template <size_type block_size, bool has_validity>
+template <int block_size>
 __launch_bounds__(block_size) __global__
-  void copy_in_place_strings_kernel(size_type num_strings,
-                                    size_type const* __restrict__ offsets_in,
-                                    size_type* __restrict__ offsets_out,
-                                    size_type validity_in_offset,
-                                    bitmask_type const* __restrict__ validity_in,
-                                    bitmask_type* __restrict__ validity_out,
-                                    size_type offset_shift,
-                                    size_type num_chars,
-                                    char const* __restrict__ chars_in,
-                                    char* __restrict__ chars_out)
+  void copy_partitions_kernel(copy_op const* __restrict__ ops, size_type* __restrict__ valid_counts)
 {
-  const size_type tid            = threadIdx.x + blockIdx.x * block_size;
-  const int warp_id              = tid / cudf::detail::warp_size;
-  const size_type warps_per_grid = gridDim.x * block_size / cudf::detail::warp_size;
-
-  // how many warps we'll be processing. with strings, the chars and offsets
-  // lengths may be different.  so we'll just march the worst case.
-  size_type warp_begin = cudf::word_index(0);
-  size_type warp_end   = cudf::word_index(std::max(num_chars, num_strings + 1) - 1);
-
-  // end indices for chars
-  size_type chars_end = num_chars;
-  // end indices for offsets
-  size_type offsets_end = num_strings + 1;
-  // end indices for validity and the last warp that actually should
-  // be updated
-  size_type validity_end      = num_strings;
-  size_type validity_warp_end = cudf::word_index(num_strings - 1);
-
-  // lane id within the current warp
-  const int lane_id = threadIdx.x % cudf::detail::warp_size;
-
-  size_type warp_cur = warp_begin + warp_id;
-  size_type index    = tid;
-  while (warp_cur <= warp_end) {
-    if (index < chars_end) { chars_out[index] = chars_in[index]; }
-
-    if (index < offsets_end) {
-      // each output column starts at a new base pointer. so we have to
-      // shift every offset down by the point (in chars) at which it was split.
-      offsets_out[index] = offsets_in[index] - offset_shift;
-    }
-
-    // if we're still in range of validity at all
-    if (has_validity && warp_cur <= validity_warp_end) {
-      bool valid = (index < validity_end) && bit_is_set(validity_in, validity_in_offset + index);
-
-      // the final validity mask for this warp
-      int warp_mask = __ballot_sync(0xFFFF'FFFF, valid);
-      // only one guy in the warp needs to update the mask and count
-      if (lane_id == 0) { validity_out[warp_cur] = warp_mask; }
-    }
-
-    // next grid
-    warp_cur += warps_per_grid;
-    index += block_size * gridDim.x;
+  auto const op = ops[blockIdx.x];
+  switch (op.kind) {
+    case copy_kind::BYTES: copy_bytes(op); break;
+    case copy_kind::VALIDITY: copy_validity<block_size>(op, valid_counts); break;
+    case copy_kind::OFFSETS: copy_offsets(op); break;
   }
 }
 
-// align all column size allocations to this boundary so that all output column buffers
-// start at that alignment.
-static constexpr size_t split_align = 64;
-
 /**
  * @brief Information about the split for a given column. Bundled together
  *        into a struct because tuples were getting pretty unreadable.
@@ -182,297 +158,253 @@ struct column_split_info {
 };
 
 /**
- * @brief Functor called by the `type_dispatcher` to incrementally compute total
- * memory buffer size needed to allocate a contiguous copy of all columns within
- * a source table.
+ * @brief The first and last offsets of the rows of a strings column in a split
  */
-struct column_buffer_size_functor {
-  template <typename T>
-  size_t operator()(column_view const& c, column_split_info& split_info)
+struct string_range {
+  size_type const* offsets;  // offsets of the first row of the split
+  size_type size;
+};
+
+struct string_range_fn {
+  __device__ thrust::pair<size_type, size_type> operator()(string_range const& range) const
   {
-    split_info.data_buf_size = cudf::util::round_up_safe(c.size() * sizeof(T), split_align);
-    split_info.validity_buf_size =
-      (c.has_nulls() ? cudf::bitmask_allocation_size_bytes(c.size(), split_align) : 0);
-    return split_info.data_buf_size + split_info.validity_buf_size;
+    return thrust::make_pair(range.offsets[0], range.offsets[range.size]);
   }
 };
-template <>
-size_t column_buffer_size_functor::operator()<string_view>(column_view const& c,
-                                                           column_split_info& split_info)
-{
-  // this has already been precomputed in an earlier step. return the sum.
-  return split_info.data_buf_size + split_info.validity_buf_size + split_info.offsets_buf_size;
-}
 
 /**
- * @brief Functor called by the `type_dispatcher` to copy a column into a contiguous
- * buffer of output memory.
+ * @brief Computes the sizes of the buffers of every column of every split
+ *
+ * The character ranges of all strings columns of all splits are read from the
+ * device with a single kernel and copy, skipped if the table has no strings column.
  *
- * Used for copying each column in a source table into one contiguous buffer of memory.
+ * @return The information of column `c` of split `s`, at `s * num_columns + c`
  */
-struct column_copy_functor {
-  template <typename T>
-  void operator()(column_view const& in,
-                  column_split_info const& split_info,
-                  char*& dst,
-                  std::vector<column_view>& out_cols)
-  {
-    // outgoing pointers
-    char* data             = dst;
-    bitmask_type* validity = split_info.validity_buf_size == 0
-                               ? nullptr
-                               : reinterpret_cast<bitmask_type*>(dst + split_info.data_buf_size);
-
-    // increment working buffer
-    dst += (split_info.data_buf_size + split_info.validity_buf_size);
-
-    // no work to do
-    if (in.size() == 0) {
-      out_cols.push_back(column_view{in.type(), 0, nullptr});
-      return;
-    }
-
-    // custom copy kernel (which could probably just be an in-place copy() function in cudf).
-    cudf::size_type num_els  = cudf::util::round_up_safe(in.size(), cudf::detail::warp_size);
-    constexpr int block_size = 256;
-    cudf::detail::grid_1d grid{num_els, block_size, 1};
+std::vector<column_split_info> compute_split_info(table_view const& input,
+                                                  std::vector<table_view> const& subtables,
+                                                  cudaStream_t stream)
+{
+  auto const num_columns = input.num_columns();
+  std::vector<bool> has_nulls(num_columns);
+  std::transform(input.begin(), input.end(), has_nulls.begin(), [](column_view const& c) {
+    return c.has_nulls();
+  });
 
-    // output copied column
-    mutable_column_view mcv{in.type(), in.size(), data, validity, in.null_count()};
-    if (in.has_nulls()) {
-      copy_in_place_kernel<block_size, T, true><<<grid.num_blocks, block_size, 0, 0>>>(
-        *column_device_view::create(in), *mutable_column_device_view::create(mcv));
-    } else {
-      copy_in_place_kernel<block_size, T, false><<<grid.num_blocks, block_size, 0, 0>>>(
-        *column_device_view::create(in), *mutable_column_device_view::create(mcv));
+  std::vector<string_range> ranges;
+  std::vector<size_t> range_index;
+  for (size_t s = 0; s < subtables.size(); ++s) {
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col = subtables[s].column(c);
+      if (col.type().id() == type_id::STRING) {
+        auto const offsets = strings_column_view(col).offsets().head<size_type>();
+        ranges.push_back(string_range{offsets + col.offset(), col.size()});
+        range_index.push_back(s * num_columns + c);
+      }
     }
-
-    out_cols.push_back(mcv);
   }
-};
-template <>
-void column_copy_functor::operator()<string_view>(column_view const& in,
-                                                  column_split_info const& split_info,
-                                                  char*& dst,
-                                                  std::vector<column_view>& out_cols)
-{
-  // outgoing pointers
-  char* chars_buf            = dst;
-  bitmask_type* validity_buf = split_info.validity_buf_size == 0
-                                 ? nullptr
-                                 : reinterpret_cast<bitmask_type*>(dst + split_info.data_buf_size);
-  size_type* offsets_buf =
-    reinterpret_cast<size_type*>(dst + split_info.data_buf_size + split_info.validity_buf_size);
-
-  // increment working buffer
-  dst += (split_info.data_buf_size + split_info.validity_buf_size + split_info.offsets_buf_size);
-
-  // offsets column.
-  strings_column_view strings_c(in);
-  column_view in_offsets = strings_c.offsets();
-  // note, incoming columns are sliced, so their size is fundamentally different from their child
-  // offset columns, which are unsliced.
-  size_type num_offsets = in.size() + 1;
-  cudf::size_type num_threads =
-    cudf::util::round_up_safe(std::max(split_info.num_chars, num_offsets), cudf::detail::warp_size);
-  column_view in_chars = strings_c.chars();
-
-  // a column with no strings will still have a single offset.
-  CUDF_EXPECTS(num_offsets > 0, "Invalid offsets child column");
-
-  // 1 combined kernel call that copies chars, offsets and validity in one pass. see notes on why
-  // this exists in the kernel brief.
-  constexpr int block_size = 256;
-  cudf::detail::grid_1d grid{num_threads, block_size, 1};
-  if (in.has_nulls()) {
-    copy_in_place_strings_kernel<block_size, true><<<grid.num_blocks, block_size, 0, 0>>>(
-      in.size(),                                        // num_rows
-      in_offsets.head<size_type>() + in.offset(),       // offsets_in
-      offsets_buf,                                      // offsets_out
-      in.offset(),                                      // validity_in_offset
-      in.null_mask(),                                   // validity_in
-      validity_buf,                                     // validity_out
-      split_info.chars_offset,                          // offset_shift
-      split_info.num_chars,                             // num_chars
-      in_chars.head<char>() + split_info.chars_offset,  // chars_in
-      chars_buf);
-  } else {
-    copy_in_place_strings_kernel<block_size, false><<<grid.num_blocks, block_size, 0, 0>>>(
-      in.size(),                                        // num_rows
-      in_offsets.head<size_type>() + in.offset(),       // offsets_in
-      offsets_buf,                                      // offsets_out
-      0,                                                // validity_in_offset
-      nullptr,                                          // validity_in
-      nullptr,                                          // validity_out
-      split_info.chars_offset,                          // offset_shift
-      split_info.num_chars,                             // num_chars
-      in_chars.head<char>() + split_info.chars_offset,  // chars_in
-      chars_buf);
+  std::vector<thrust::pair<size_type, size_type>> offsets(ranges.size());
+  if (not ranges.empty()) {
+    auto const d_ranges = make_device_uvector_async(ranges, stream);
+    rmm::device_uvector<thrust::pair<size_type, size_type>> d_offsets(ranges.size(), stream);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      d_ranges.begin(),
+                      d_ranges.end(),
+                      d_offsets.begin(),
+                      string_range_fn{});
+    CUDA_TRY(cudaMemcpyAsync(offsets.data(),
+                             d_offsets.data(),
+                             offsets.size() * sizeof(offsets[0]),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
   }
 
-  // output child columns
-  column_view out_offsets{in_offsets.type(), num_offsets, offsets_buf};
-  column_view out_chars{in_chars.type(), static_cast<size_type>(split_info.num_chars), chars_buf};
-
-  // result
-  out_cols.push_back(column_view(
-    in.type(), in.size(), nullptr, validity_buf, in.null_count(), 0, {out_offsets, out_chars}));
-}
-
-/**
- * @brief Information about a string column in a table view.
- *
- * Used internally by preprocess_string_column_info as part of a device-accessible
- * vector for computing final string information in a single kernel call.
- */
-struct column_preprocess_info {
-  size_type index;
-  size_type offset;
-  size_type size;
-  bool has_nulls;
-  cudf::column_device_view offsets;
-};
-
-/**
- * @brief Preprocess information about all strings columns in a table view.
- *
- * In order to minimize how often we touch the gpu, we need to preprocess various pieces of
- * information about the string columns in a table as a batch process.  This function builds a list
- * of the offset columns for all input string columns and computes this information with a single
- * thrust call.  In addition, the vector returned is allocated for -all- columns in the table so
- * further processing of non-string columns can happen afterwards.
- *
- * The key things this function avoids
- * - avoiding reaching into gpu memory on the cpu to retrieve offsets to compute string sizes.
- * - creating column_device_views on the base string_column_view itself as that causes gpu memory
- * allocation.
- */
-thrust::host_vector<column_split_info> preprocess_string_column_info(
-  cudf::table_view const& t,
-  rmm::device_vector<column_split_info>& device_split_info,
-  cudaStream_t stream)
-{
-  // build a list of all the offset columns and their indices for all input string columns and put
-  // them on the gpu
-  thrust::host_vector<column_preprocess_info> offset_columns;
-  offset_columns.reserve(t.num_columns());  // worst case
-
-  // collect only string columns
-  size_type column_index = 0;
-  std::for_each(t.begin(), t.end(), [&offset_columns, &column_index](cudf::column_view const& c) {
-    if (c.type().id() == type_id::STRING) {
-      cudf::column_device_view cdv((strings_column_view(c)).offsets(), 0, 0);
-      offset_columns.push_back(
-        column_preprocess_info{column_index, c.offset(), c.size(), c.has_nulls(), cdv});
+  std::vector<column_split_info> split_info(subtables.size() * num_columns);
+  for (size_t s = 0; s < subtables.size(); ++s) {
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col = subtables[s].column(c);
+      auto& info      = split_info[s * num_columns + c];
+      info.validity_buf_size =
+        has_nulls[c] ? cudf::bitmask_allocation_size_bytes(col.size(), split_align) : 0;
+      if (col.type().id() != type_id::STRING) {
+        info.data_buf_size =
+          cudf::util::round_up_safe(col.size() * cudf::size_of(col.type()), split_align);
+      }
     }
-    column_index++;
-  });
-  rmm::device_vector<column_preprocess_info> device_offset_columns = offset_columns;
-
-  // compute column split information
-  rmm::device_vector<thrust::pair<size_type, size_type>> device_offsets(t.num_columns());
-  auto* offsets_p = device_offsets.data().get();
-  thrust::for_each(rmm::exec_policy(stream)->on(stream),
-                   device_offset_columns.begin(),
-                   device_offset_columns.end(),
-                   [offsets_p] __device__(column_preprocess_info const& cpi) {
-                     offsets_p[cpi.index] =
-                       thrust::make_pair(cpi.offsets.head<int32_t>()[cpi.offset],
-                                         cpi.offsets.head<int32_t>()[cpi.offset + cpi.size]);
-                   });
-  thrust::host_vector<thrust::pair<size_type, size_type>> host_offsets(device_offsets);
-  thrust::host_vector<column_split_info> split_info(t.num_columns());
-  std::for_each(offset_columns.begin(),
-                offset_columns.end(),
-                [&split_info, &host_offsets](column_preprocess_info const& cpi) {
-                  int32_t offset_start = host_offsets[cpi.index].first;
-                  int32_t offset_end   = host_offsets[cpi.index].second;
-                  auto num_chars       = offset_end - offset_start;
-                  split_info[cpi.index].data_buf_size =
-                    cudf::util::round_up_safe(static_cast<size_t>(num_chars), split_align);
-                  split_info[cpi.index].validity_buf_size =
-                    cpi.has_nulls ? cudf::bitmask_allocation_size_bytes(cpi.size, split_align) : 0;
-                  split_info[cpi.index].offsets_buf_size =
-                    cudf::util::round_up_safe((cpi.size + 1) * sizeof(size_type), split_align);
-                  split_info[cpi.index].num_chars    = num_chars;
-                  split_info[cpi.index].chars_offset = offset_start;
-                });
+  }
+  for (size_t r = 0; r < range_index.size(); ++r) {
+    auto& info        = split_info[range_index[r]];
+    auto const size   = ranges[r].size;
+    info.chars_offset = offsets[r].first;
+    info.num_chars    = offsets[r].second - offsets[r].first;
+    info.data_buf_size =
+      cudf::util::round_up_safe(static_cast<size_t>(info.num_chars), split_align);
+    info.offsets_buf_size = cudf::util::round_up_safe((size + 1) * sizeof(size_type), split_align);
+  }
   return split_info;
 }
 
 /**
- * @brief Creates a contiguous_split_result object which contains a deep-copy of the input
- * table_view into a single contiguous block of memory.
- *
- * The table_view contained within the contiguous_split_result will pass an expect_tables_equal()
- * call with the input table.  The memory referenced by the table_view and its internal column_views
- * is entirely contained in single block of memory.
+ * @brief Appends the pieces of a copy of `size` units of `unit_bits` bits each to `ops`
  */
-contiguous_split_result alloc_and_copy(cudf::table_view const& t,
-                                       rmm::device_vector<column_split_info>& device_split_info,
-                                       rmm::mr::device_memory_resource* mr,
-                                       cudaStream_t stream)
+void add_copy_ops(copy_op op, size_type unit_bits, std::vector<copy_op>& ops)
 {
-  // preprocess column split information for string columns.
-  thrust::host_vector<column_split_info> split_info =
-    preprocess_string_column_info(t, device_split_info, stream);
-
-  // compute the rest of the column sizes (non-string columns, and total buffer size)
-  size_t total_size      = 0;
-  size_type column_index = 0;
-  std::for_each(
-    t.begin(), t.end(), [&total_size, &column_index, &split_info](cudf::column_view const& c) {
-      total_size +=
-        cudf::type_dispatcher(c.type(), column_buffer_size_functor{}, c, split_info[column_index]);
-      column_index++;
-    });
-
-  // allocate
-  auto device_buf = std::make_unique<rmm::device_buffer>(total_size, stream, mr);
-  char* buf       = static_cast<char*>(device_buf->data());
-
-  // copy (this would be cleaner with a std::transform, but there's an nvcc compiler issue in the
-  // way)
-  std::vector<column_view> out_cols;
-  out_cols.reserve(t.num_columns());
-
-  column_index = 0;
-  std::for_each(
-    t.begin(), t.end(), [&out_cols, &buf, &column_index, &split_info](cudf::column_view const& c) {
-      cudf::type_dispatcher(
-        c.type(), column_copy_functor{}, c, split_info[column_index], buf, out_cols);
-      column_index++;
-    });
-
-  return contiguous_split_result{cudf::table_view{out_cols}, std::move(device_buf)};
+  auto const chunk_units = copy_chunk_bytes * 8 / unit_bits;
+  auto const size        = op.size;
+  for (size_type begin = 0; begin < size; begin += chunk_units) {
+    auto piece = op;
+    piece.size = std::min(chunk_units, size - begin);
+    piece.dst  = op.dst + static_cast<size_t>(begin) * unit_bits / 8;
+    if (op.kind == copy_kind::VALIDITY) {
+      piece.src_bit_offset = op.src_bit_offset + begin;
+    } else {
+      piece.src = op.src + static_cast<size_t>(begin) * unit_bits / 8;
+    }
+    ops.push_back(piece);
+  }
 }
 
-};  // anonymous namespace
+}  // anonymous namespace
 
 std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& input,
                                                       std::vector<size_type> const& splits,
                                                       rmm::mr::device_memory_resource* mr,
                                                       cudaStream_t stream)
 {
-  auto subtables = cudf::split(input, splits);
+  std::for_each(input.begin(), input.end(), [](column_view const& c) {
+    CUDF_EXPECTS(is_fixed_width(c.type()) || c.type().id() == type_id::STRING,
+                 "contiguous_split supports only fixed-width and string columns");
+  });
+  auto const subtables   = cudf::split(input, splits);
+  auto const num_columns = input.num_columns();
+  auto const split_info  = compute_split_info(input, subtables, stream);
+
+  // lay out the buffers of each split, allocate them and list the copies of all the splits,
+  // which are then made by a single kernel instead of one per column and split.
+  std::vector<std::unique_ptr<rmm::device_buffer>> buffers;
+  std::vector<copy_op> ops;
+  for (size_t s = 0; s < subtables.size(); ++s) {
+    auto const info_begin = split_info.begin() + s * num_columns;
+    auto const total_size = std::accumulate(
+      info_begin, info_begin + num_columns, size_t{0}, [](size_t sum, column_split_info const& i) {
+        return sum + i.data_buf_size + i.validity_buf_size + i.offsets_buf_size;
+      });
+    buffers.push_back(std::make_unique<rmm::device_buffer>(total_size, stream, mr));
+    auto dst = static_cast<uint8_t*>(buffers.back()->data());
+
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& in         = subtables[s].column(c);
+      auto const& info       = info_begin[c];
+      auto const count_index = static_cast<size_type>(s * num_columns + c);
+      uint8_t* data          = dst;
+      auto validity          = info.validity_buf_size == 0 ? nullptr : dst + info.data_buf_size;
+      auto offsets           = dst + info.data_buf_size + info.validity_buf_size;
+      dst += info.data_buf_size + info.validity_buf_size + info.offsets_buf_size;
+
+      if (validity != nullptr && in.size() > 0) {
+        add_copy_ops(copy_op{reinterpret_cast<uint8_t const*>(in.null_mask()),
+                             validity,
+                             in.size(),
+                             in.offset(),
+                             0,
+                             count_index,
+                             copy_kind::VALIDITY},
+                     1,
+                     ops);
+      }
+      if (in.type().id() == type_id::STRING) {
+        strings_column_view const strings(in);
+        add_copy_ops(copy_op{strings.chars().head<uint8_t>() + info.chars_offset,
+                             data,
+                             info.num_chars,
+                             0,
+                             0,
+                             count_index,
+                             copy_kind::BYTES},
+                     8,
+                     ops);
+        add_copy_ops(copy_op{reinterpret_cast<uint8_t const*>(
+                               strings.offsets().head<size_type>() + in.offset()),
+                             offsets,
+                             in.size() + 1,
+                             0,
+                             info.chars_offset,
+                             count_index,
+                             copy_kind::OFFSETS},
+                     8 * sizeof(size_type),
+                     ops);
+      } else if (in.size() > 0) {
+        auto const width = static_cast<size_type>(cudf::size_of(in.type()));
+        add_copy_ops(copy_op{static_cast<uint8_t const*>(in.head()) + in.offset() * width,
+                             data,
+                             in.size() * width,
+                             0,
+                             0,
+                             count_index,
+                             copy_kind::BYTES},
+                     8,
+                     ops);
+      }
+    }
+  }
 
-  // optimization : for large numbers of splits this allocation can dominate total time
-  //                spent if done inside alloc_and_copy().  so we'll allocate it once
-  //                and reuse it.
-  //
-  //                benchmark:        1 GB data, 10 columns, 256 splits.
-  //                no optimization:  106 ms (8 GB/s)
-  //                optimization:     20 ms (48 GB/s)
-  rmm::device_vector<column_split_info> device_split_info(input.num_columns());
+  // the null counts are the only results read back, so a table without nulls is split without
+  // synchronizing the stream.
+  bool const any_nulls = std::any_of(
+    input.begin(), input.end(), [](column_view const& c) { return c.has_nulls(); });
+  rmm::device_uvector<size_type> valid_counts(any_nulls ? split_info.size() : 0, stream);
+  if (any_nulls) {
+    CUDA_TRY(cudaMemsetAsync(
+      valid_counts.data(), 0, valid_counts.size() * sizeof(size_type), stream));
+  }
+  if (not ops.empty()) {
+    auto const d_ops = make_device_uvector_async(ops, stream);
+    copy_partitions_kernel<copy_block_size>
+      <<<ops.size(), copy_block_size, 0, stream>>>(d_ops.data(), valid_counts.data());
+    CHECK_CUDA(stream);
+  }
+  std::vector<size_type> h_valid_counts(valid_counts.size());
+  if (any_nulls) {
+    CUDA_TRY(cudaMemcpyAsync(h_valid_counts.data(),
+                             valid_counts.data(),
+                             valid_counts.size() * sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
 
+  // build the views of the copied columns
   std::vector<contiguous_split_result> result;
-  std::transform(subtables.begin(),
-                 subtables.end(),
-                 std::back_inserter(result),
-                 [mr, stream, &device_split_info](table_view const& t) {
-                   return alloc_and_copy(t, device_split_info, mr, stream);
-                 });
-
+  result.reserve(subtables.size());
+  for (size_t s = 0; s < subtables.size(); ++s) {
+    auto dst = static_cast<uint8_t*>(buffers[s]->data());
+    std::vector<column_view> out_cols;
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& in   = subtables[s].column(c);
+      auto const& info = split_info[s * num_columns + c];
+      auto data        = dst;
+      auto validity    = info.validity_buf_size == 0
+                        ? nullptr
+                        : reinterpret_cast<bitmask_type const*>(dst + info.data_buf_size);
+      auto offsets = reinterpret_cast<size_type const*>(dst + info.data_buf_size +
+                                                        info.validity_buf_size);
+      dst += info.data_buf_size + info.validity_buf_size + info.offsets_buf_size;
+      auto const null_count =
+        validity == nullptr ? 0 : in.size() - h_valid_counts[s * num_columns + c];
+
+      if (in.type().id() == type_id::STRING) {
+        column_view out_offsets{data_type{type_id::INT32}, in.size() + 1, offsets};
+        column_view out_chars{data_type{type_id::INT8}, info.num_chars, data};
+        out_cols.push_back(column_view(
+          in.type(), in.size(), nullptr, validity, null_count, 0, {out_offsets, out_chars}));
+      } else if (in.size() == 0) {
+        out_cols.push_back(column_view{in.type(), 0, nullptr});
+      } else {
+        out_cols.push_back(column_view{in.type(), in.size(), data, validity, null_count});
+      }
+    }
+    result.push_back(contiguous_split_result{table_view{out_cols}, std::move(buffers[s])});
+  }
   return result;
 }
 
@@ -480,10 +412,11 @@ std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& in
 
 std::vector<contiguous_split_result> contiguous_split(cudf::table_view const& input,
                                                       std::vector<size_type> const& splits,
-                                                      rmm::mr::device_memory_resource* mr)
+                                                      rmm::mr::device_memory_resource* mr,
+                                                      cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return cudf::detail::contiguous_split(input, splits, mr, (cudaStream_t)0);
+  return cudf::detail::contiguous_split(input, splits, mr, stream);
 }
 
 };  // namespace cudf
@@ -167,6 +167,17 @@ std::unique_ptr<cudf::column> out_of_place_copy_range_dispatch::operator()<cudf:
   CUDF_FAIL("list_view type not supported");
 }
 
+template <>
+std::unique_ptr<cudf::column> out_of_place_copy_range_dispatch::operator()<cudf::struct_view>(
+  cudf::size_type source_begin,
+  cudf::size_type source_end,
+  cudf::size_type target_begin,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FAIL("struct_view type not supported");
+}
+
 }  // namespace
 
 namespace cudf {
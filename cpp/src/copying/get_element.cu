@@ -16,12 +16,23 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
 
 #include <cudf/detail/utilities/cuda.cuh>
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace detail {
 
@@ -35,7 +46,7 @@ struct get_element_functor {
     cudaStream_t stream                 = 0,
     rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource())
   {
-    auto s = make_fixed_width_scalar(data_type(type_to_id<T>()), stream, mr);
+    auto s = make_fixed_width_scalar(input.type(), stream, mr);
 
     using ScalarType = cudf::scalar_type_t<T>;
     auto typed_s     = static_cast<ScalarType *>(s.get());
@@ -105,14 +116,14 @@ struct get_element_functor {
     return result;
   }
 
-  template <typename T, std::enable_if_t<std::is_same<T, list_view>::value> *p = nullptr>
+  template <typename T, std::enable_if_t<cudf::is_nested<T>()> *p = nullptr>
   std::unique_ptr<scalar> operator()(
     column_view const &input,
     size_type index,
     cudaStream_t stream                 = 0,
     rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource())
   {
-    CUDF_FAIL("get_element_functor not supported for list_view");
+    CUDF_FAIL("get_element_functor not supported for nested types");
   }
 };
 
@@ -127,6 +138,95 @@ std::unique_ptr<scalar> get_element(column_view const &input,
   return type_dispatcher(input.type(), get_element_functor{}, input, index, stream, mr);
 }
 
+std::vector<host_elements> get_elements(table_view const &input,
+                                        std::vector<size_type> const &indices,
+                                        cudaStream_t stream)
+{
+  CUDF_EXPECTS(std::all_of(indices.begin(),
+                           indices.end(),
+                           [&input](size_type i) { return i >= 0 and i < input.num_rows(); }),
+               "Index out of bounds");
+  CUDF_EXPECTS(std::none_of(input.begin(),
+                            input.end(),
+                            [](column_view const &c) { return is_nested(c.type()); }),
+               "get_elements not supported for nested types");
+
+  if (indices.empty()) {
+    std::vector<host_elements> results;
+    for (auto const &col : input) {
+      results.push_back({col.type().id() == type_id::DICTIONARY32
+                           ? dictionary_column_view(col).keys().type()
+                           : col.type()});
+    }
+    return results;
+  }
+
+  // gather the rows into a small table, decoding the dictionaries
+  rmm::device_vector<size_type> d_indices(indices);
+  column_view const gather_map(
+    data_type{type_id::INT32}, static_cast<size_type>(indices.size()), d_indices.data().get());
+  auto gathered = detail::gather(input,
+                                 gather_map,
+                                 detail::out_of_bounds_policy::IGNORE,
+                                 detail::negative_index_policy::NOT_ALLOWED,
+                                 rmm::mr::get_default_resource(),
+                                 stream)
+                    ->release();
+  std::vector<column_view> columns;
+  for (auto &col : gathered) {
+    if (col->type().id() == type_id::DICTIONARY32) {
+      col = dictionary::detail::decode(
+        dictionary_column_view(col->view()), rmm::mr::get_default_resource(), stream);
+    }
+    columns.push_back(col->view());
+  }
+
+  // pack the gathered columns into one buffer and bring it to host with a single copy
+  auto const packed =
+    detail::contiguous_split(table_view{columns}, {}, rmm::mr::get_default_resource(), stream)
+      .front();
+  auto const d_base = static_cast<uint8_t const *>(packed.all_data->data());
+  std::vector<uint8_t> h_data(packed.all_data->size());
+  if (!h_data.empty()) {
+    CUDA_TRY(cudaMemcpyAsync(h_data.data(), d_base, h_data.size(), cudaMemcpyDeviceToHost, stream));
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  // returns the host address of a device address inside the packed buffer
+  auto to_host = [&h_data, d_base](void const *ptr) {
+    return h_data.data() + (static_cast<uint8_t const *>(ptr) - d_base);
+  };
+
+  std::vector<host_elements> results;
+  for (auto const &col : packed.table) {
+    host_elements result{col.type()};
+    auto const num_rows = col.size();
+    auto const null_mask =
+      col.nullable() ? reinterpret_cast<bitmask_type const *>(to_host(col.null_mask())) : nullptr;
+    for (size_type i = 0; i < num_rows; ++i) {
+      result.validity.push_back(null_mask == nullptr || bit_is_set(null_mask, col.offset() + i));
+    }
+    if (col.type().id() == type_id::STRING) {
+      strings_column_view const strings(col);
+      auto const offsets =
+        reinterpret_cast<int32_t const *>(to_host(strings.offsets().data<int32_t>())) +
+        col.offset();
+      auto const chars = strings.chars_size() > 0
+                           ? reinterpret_cast<char const *>(to_host(strings.chars().data<char>()))
+                           : nullptr;
+      for (size_type i = 0; i < num_rows; ++i) {
+        auto const length = offsets[i + 1] - offsets[i];
+        result.strings.push_back(chars ? std::string(chars + offsets[i], length) : std::string{});
+      }
+    } else {
+      auto const element_size = size_of(col.type());
+      auto const begin        = to_host(col.head()) + col.offset() * element_size;
+      result.data.assign(begin, begin + num_rows * element_size);
+    }
+    results.push_back(std::move(result));
+  }
+  return results;
+}
+
 }  // namespace detail
 
 std::unique_ptr<scalar> get_element(column_view const &input,
@@ -136,4 +236,11 @@ std::unique_ptr<scalar> get_element(column_view const &input,
   return detail::get_element(input, index, 0, mr);
 }
 
+std::vector<host_elements> get_elements(table_view const &input,
+                                        std::vector<size_type> const &indices)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_elements(input, indices);
+}
+
 }  // namespace cudf
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Identifies the metadata blobs created by `pack_metadata`
+ */
+constexpr uint32_t packed_magic{0x43504b31};  // "CPK1"
+
+/**
+ * @brief The header of the metadata blob
+ */
+struct serialized_table {
+  uint32_t magic;
+  size_type num_columns;
+};
+
+/**
+ * @brief The metadata of one column
+ *
+ * The columns are stored in pre-order: each column is followed by the metadata
+ * of its children.
+ */
+struct serialized_column {
+  type_id type;
+  size_type size;
+  size_type null_count;
+  size_type offset;
+  size_type num_children;
+  int64_t data_offset;       ///< Position of the data in the buffer or -1 if there is no data
+  int64_t null_mask_offset;  ///< Position of the null mask in the buffer or -1 if there is none
+};
+
+/**
+ * @brief Returns the position of `ptr` within the buffer, or -1 if `ptr` is null
+ */
+int64_t buffer_offset(void const* ptr, uint8_t const* base, size_t buffer_size)
+{
+  if (ptr == nullptr) { return -1; }
+  auto const position = static_cast<uint8_t const*>(ptr) - base;
+  CUDF_EXPECTS(position >= 0 && static_cast<size_t>(position) <= buffer_size,
+               "Column memory is not within the contiguous buffer");
+  return position;
+}
+
+void serialize_column(column_view const& col,
+                      uint8_t const* base,
+                      size_t buffer_size,
+                      std::vector<serialized_column>& columns)
+{
+  columns.push_back(serialized_column{col.type().id(),
+                                      col.size(),
+                                      col.null_count(),
+                                      col.offset(),
+                                      col.num_children(),
+                                      buffer_offset(col.head(), base, buffer_size),
+                                      buffer_offset(col.null_mask(), base, buffer_size)});
+  std::for_each(col.child_begin(), col.child_end(), [&](column_view const& child) {
+    serialize_column(child, base, buffer_size, columns);
+  });
+}
+
+/**
+ * @brief Rebuilds the column at `next` and its children, advancing `next` past them
+ *
+ * The blob may have been received into memory of any alignment, so the metadata
+ * is copied out rather than dereferenced in place.
+ */
+column_view deserialize_column(uint8_t const*& next, uint8_t const* gpu_data)
+{
+  serialized_column col;
+  std::memcpy(&col, next, sizeof(col));
+  next += sizeof(col);
+  std::vector<column_view> children;
+  for (size_type idx = 0; idx < col.num_children; ++idx) {
+    children.push_back(deserialize_column(next, gpu_data));
+  }
+  auto const data      = col.data_offset < 0 ? nullptr : gpu_data + col.data_offset;
+  auto const null_mask = col.null_mask_offset < 0 ? nullptr : gpu_data + col.null_mask_offset;
+  return column_view(data_type{col.type},
+                     col.size,
+                     data,
+                     reinterpret_cast<bitmask_type const*>(null_mask),
+                     col.null_count,
+                     col.offset,
+                     children);
+}
+
+}  // namespace
+
+packed_columns pack(cudf::table_view const& input,
+                    rmm::mr::device_memory_resource* mr,
+                    cudaStream_t stream)
+{
+  // an empty splits vector returns a single contiguous copy of the whole table
+  auto contiguous = std::move(contiguous_split(input, {}, mr, stream).front());
+  auto metadata   = pack_metadata(contiguous.table,
+                                static_cast<uint8_t const*>(contiguous.all_data->data()),
+                                contiguous.all_data->size());
+  return packed_columns{std::make_unique<std::vector<uint8_t>>(std::move(metadata)),
+                        std::move(contiguous.all_data)};
+}
+
+}  // namespace detail
+
+packed_columns pack(cudf::table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::pack(input, mr);
+}
+
+std::vector<uint8_t> pack_metadata(table_view const& table,
+                                   uint8_t const* contiguous_buffer,
+                                   size_t buffer_size)
+{
+  CUDF_FUNC_RANGE();
+  std::vector<detail::serialized_column> columns;
+  std::for_each(table.begin(), table.end(), [&](column_view const& col) {
+    detail::serialize_column(col, contiguous_buffer, buffer_size, columns);
+  });
+
+  detail::serialized_table const header{detail::packed_magic, table.num_columns()};
+  auto const columns_size = columns.size() * sizeof(detail::serialized_column);
+  std::vector<uint8_t> metadata(sizeof(header) + columns_size);
+  std::memcpy(metadata.data(), &header, sizeof(header));
+  std::memcpy(metadata.data() + sizeof(header), columns.data(), columns_size);
+  return metadata;
+}
+
+table_view unpack(packed_columns const& input)
+{
+  return unpack(input.metadata->data(), static_cast<uint8_t const*>(input.gpu_data->data()));
+}
+
+table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
+{
+  CUDF_FUNC_RANGE();
+  detail::serialized_table header;
+  std::memcpy(&header, metadata, sizeof(header));
+  CUDF_EXPECTS(header.magic == detail::packed_magic, "Invalid packed table metadata");
+
+  auto next = metadata + sizeof(header);
+  std::vector<column_view> columns;
+  for (size_type idx = 0; idx < header.num_columns; ++idx) {
+    columns.push_back(detail::deserialize_column(next, gpu_data));
+  }
+  return table_view(columns);
+}
+
+}  // namespace cudf
@@ -19,16 +19,77 @@
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/scratch_memory.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/device_vector.h>
 #include <thrust/random.h>
 #include <thrust/random/uniform_int_distribution.h>
+#include <thrust/random/uniform_real_distribution.h>
 #include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
 
 namespace cudf {
 namespace detail {
+namespace {
+// Samples of at most this fraction of the rows draw random indices instead of shuffling all rows
+constexpr size_type sparse_sample_ratio = 16;
+
+/**
+ * @brief Returns `n` distinct random row indices in `[0, num_rows)`, in random order
+ *
+ * Random indices are drawn in rounds, and sorted to remove duplicates, until `n` distinct indices
+ * are found; the distinct indices are then shuffled and the first `n` kept. Every set of `n` rows
+ * is equally likely. Since `n` is small relative to `num_rows`, duplicates are rare, and the cost
+ * is that of sorting about `n` indices rather than shuffling `num_rows`.
+ */
+rmm::device_vector<size_type> sparse_sample_indices(size_type num_rows,
+                                                    size_type n,
+                                                    int64_t seed,
+                                                    cudaStream_t stream)
+{
+  auto const expected_duplicates =
+    static_cast<size_type>(static_cast<double>(n) * n / (2.0 * num_rows));
+  auto const draws_per_round = n + 2 * expected_duplicates + 32;
+
+  auto indices = make_scratch_vector<size_type>(0, 0, stream);
+  int64_t drawn{0};
+  while (static_cast<size_type>(indices.size()) < n) {
+    auto const num_unique = indices.size();
+    indices.resize(num_unique + draws_per_round);
+    auto random_index = [seed, num_rows, drawn] __device__(size_type i) {
+      thrust::default_random_engine rng(seed);
+      thrust::uniform_int_distribution<size_type> dist{0, num_rows - 1};
+      rng.discard(drawn + i);
+      return dist(rng);
+    };
+    thrust::transform(scratch_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(draws_per_round),
+                      indices.begin() + num_unique,
+                      random_index);
+    drawn += draws_per_round;
+    thrust::sort(scratch_policy(stream)->on(stream), indices.begin(), indices.end());
+    auto const end =
+      thrust::unique(scratch_policy(stream)->on(stream), indices.begin(), indices.end());
+    indices.resize(end - indices.begin());
+  }
+
+  auto sample = make_scratch_vector<size_type>(indices.size(), 0, stream);
+  thrust::shuffle_copy(scratch_policy(stream)->on(stream),
+                       indices.begin(),
+                       indices.end(),
+                       sample.begin(),
+                       thrust::default_random_engine(seed));
+  sample.resize(n);
+  return sample;
+}
+
+}  // namespace
 
 std::unique_ptr<table> sample(table_view const& input,
                               size_type const n,
@@ -49,7 +110,7 @@ std::unique_ptr<table> sample(table_view const& input,
   if (replacement == sample_with_replacement::TRUE) {
     auto RandomGen = [seed, num_rows] __device__(auto i) {
       thrust::default_random_engine rng(seed);
-      thrust::uniform_int_distribution<size_type> dist{0, num_rows};
+      thrust::uniform_int_distribution<size_type> dist{0, num_rows - 1};
       rng.discard(i);
       return dist(rng);
     };
@@ -59,6 +120,9 @@ std::unique_ptr<table> sample(table_view const& input,
     auto end = thrust::make_transform_iterator(thrust::counting_iterator<size_type>(n), RandomGen);
 
     return detail::gather(input, begin, end, false, mr, stream);
+  } else if (n <= num_rows / sparse_sample_ratio) {
+    auto const indices = sparse_sample_indices(num_rows, n, seed, stream);
+    return detail::gather(input, indices.begin(), indices.end(), false, mr, stream);
   } else {
     auto gather_map =
       make_numeric_column(data_type{type_id::INT32}, num_rows, mask_state::UNALLOCATED, stream);
@@ -81,6 +145,30 @@ std::unique_ptr<table> sample(table_view const& input,
   }
 }
 
+std::unique_ptr<table> sample_fraction(table_view const& input,
+                                       double fraction,
+                                       int64_t const seed,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  CUDF_EXPECTS(fraction >= 0 and fraction <= 1, "expected a sampling fraction in [0, 1]");
+  auto const num_rows = input.num_rows();
+
+  auto is_sampled = [seed, fraction] __device__(size_type i) {
+    thrust::default_random_engine rng(seed);
+    thrust::uniform_real_distribution<double> dist{0, 1};
+    rng.discard(i);
+    return dist(rng) < fraction;
+  };
+  auto gather_map = make_scratch_vector<size_type>(num_rows, 0, stream);
+  auto const end  = thrust::copy_if(scratch_policy(stream)->on(stream),
+                                   thrust::make_counting_iterator<size_type>(0),
+                                   thrust::make_counting_iterator<size_type>(num_rows),
+                                   gather_map.begin(),
+                                   is_sampled);
+  return detail::gather(input, gather_map.begin(), end, false, mr, stream);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> sample(table_view const& input,
@@ -93,4 +181,14 @@ std::unique_ptr<table> sample(table_view const& input,
 
   return detail::sample(input, n, replacement, seed, mr);
 }
+
+std::unique_ptr<table> sample_fraction(table_view const& input,
+                                       double fraction,
+                                       int64_t const seed,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  return detail::sample_fraction(input, fraction, seed, mr);
+}
 }  // namespace cudf
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/comp/gpuinflate.h>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Identifies the buffers created by `serialize_to_device_buffer`
+ */
+constexpr uint32_t serialized_magic{0x43534231};  // "CSB1"
+
+/**
+ * @brief Size of the pages of packed data compressed independently
+ */
+constexpr size_t serialized_page_size{64 * 1024};
+
+/**
+ * @brief Worst case size of the snappy output of a page
+ */
+constexpr size_t max_compressed_page_size{32 + serialized_page_size + serialized_page_size / 6};
+
+/**
+ * @brief The header of a serialized buffer
+ *
+ * The header is followed by the page table, the metadata of `pack` and the stored pages.
+ */
+struct serialized_buffer_header {
+  uint32_t magic;
+  uint32_t num_compressed_pages;
+  uint64_t packed_size;    ///< Size of the packed data; page `p` starts at `p * page size`
+  uint64_t metadata_size;  ///< Size of the metadata of `pack`
+  uint64_t num_pages;
+  uint64_t payload_size;  ///< Total size of the stored pages
+};
+
+/**
+ * @brief The location of a stored page, relative to the first stored page
+ */
+struct serialized_page {
+  uint64_t stored_offset;
+  uint32_t stored_size;
+  uint32_t compressed;
+};
+
+size_t packed_page_offset(size_t page) { return page * serialized_page_size; }
+
+size_t packed_page_size(size_t page, size_t packed_size)
+{
+  return std::min(serialized_page_size, packed_size - packed_page_offset(page));
+}
+
+/**
+ * @brief Compresses the pages of the packed data with snappy into `scratch`
+ *
+ * @return The size of each compressed page, or 0 for the pages that do not shrink
+ */
+std::vector<size_t> compress_pages(uint8_t const* packed,
+                                   size_t packed_size,
+                                   size_t num_pages,
+                                   rmm::device_buffer& scratch,
+                                   cudaStream_t stream)
+{
+  std::vector<io::gpu_inflate_input_s> inputs(num_pages);
+  for (size_t p = 0; p < num_pages; ++p) {
+    inputs[p].srcDevice = packed + packed_page_offset(p);
+    inputs[p].srcSize   = packed_page_size(p, packed_size);
+    inputs[p].dstDevice = static_cast<uint8_t*>(scratch.data()) + p * max_compressed_page_size;
+    inputs[p].dstSize   = max_compressed_page_size;
+  }
+  auto d_inputs = make_device_uvector_async(inputs, stream);
+  rmm::device_uvector<io::gpu_inflate_status_s> d_statuses(num_pages, stream);
+  CUDA_TRY(io::gpu_snap(d_inputs.data(), d_statuses.data(), num_pages, stream));
+  std::vector<io::gpu_inflate_status_s> statuses(num_pages);
+  CUDA_TRY(cudaMemcpyAsync(statuses.data(),
+                           d_statuses.data(),
+                           num_pages * sizeof(io::gpu_inflate_status_s),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  std::vector<size_t> compressed_sizes(num_pages);
+  std::transform(
+    statuses.begin(),
+    statuses.end(),
+    inputs.begin(),
+    compressed_sizes.begin(),
+    [](auto const& status, auto const& input) {
+      return status.status == 0 && status.bytes_written < input.srcSize ? status.bytes_written : 0;
+    });
+  return compressed_sizes;
+}
+
+/**
+ * @brief Copies the blocks of memory described by `blocks` with a single kernel
+ */
+void copy_blocks(std::vector<io::gpu_inflate_input_s> const& blocks, cudaStream_t stream)
+{
+  if (blocks.empty()) { return; }
+  auto d_blocks = make_device_uvector_async(blocks, stream);
+  CUDA_TRY(io::gpu_copy_uncompressed_blocks(d_blocks.data(), blocks.size(), stream));
+}
+
+}  // namespace
+
+std::unique_ptr<rmm::device_buffer> serialize_to_device_buffer(table_view const& input,
+                                                               io::compression_type compression,
+                                                               rmm::mr::device_memory_resource* mr,
+                                                               cudaStream_t stream)
+{
+  CUDF_EXPECTS(
+    compression == io::compression_type::NONE || compression == io::compression_type::SNAPPY,
+    "Unsupported serialization compression");
+  auto const packed      = pack(input, rmm::mr::get_default_resource(), stream);
+  auto const d_packed    = static_cast<uint8_t const*>(packed.gpu_data->data());
+  auto const packed_size = packed.gpu_data->size();
+  auto const num_pages   = (packed_size + serialized_page_size - 1) / serialized_page_size;
+
+  rmm::device_buffer scratch;
+  std::vector<size_t> compressed_sizes(num_pages, 0);
+  if (compression == io::compression_type::SNAPPY && num_pages > 0) {
+    scratch          = rmm::device_buffer(num_pages * max_compressed_page_size, stream);
+    compressed_sizes = compress_pages(d_packed, packed_size, num_pages, scratch, stream);
+  }
+
+  serialized_buffer_header header{serialized_magic, 0, packed_size, 0, num_pages, 0};
+  header.metadata_size = packed.metadata->size();
+  std::vector<serialized_page> pages(num_pages);
+  for (size_t p = 0; p < num_pages; ++p) {
+    auto const compressed  = compressed_sizes[p] > 0;
+    auto const stored_size = compressed ? compressed_sizes[p] : packed_page_size(p, packed_size);
+    pages[p] = serialized_page{header.payload_size, static_cast<uint32_t>(stored_size), compressed};
+    header.payload_size += pages[p].stored_size;
+    header.num_compressed_pages += compressed;
+  }
+
+  // The header, page table and metadata are uploaded with one copy
+  auto const pages_size  = num_pages * sizeof(serialized_page);
+  auto const header_size = sizeof(header) + pages_size + header.metadata_size;
+  std::vector<uint8_t> host_header(header_size);
+  std::memcpy(host_header.data(), &header, sizeof(header));
+  std::memcpy(host_header.data() + sizeof(header), pages.data(), pages_size);
+  std::copy(packed.metadata->begin(),
+            packed.metadata->end(),
+            host_header.begin() + sizeof(header) + pages_size);
+
+  auto result = std::make_unique<rmm::device_buffer>(header_size + header.payload_size, stream, mr);
+  auto const payload = static_cast<uint8_t*>(result->data()) + header_size;
+  CUDA_TRY(cudaMemcpyAsync(
+    result->data(), host_header.data(), header_size, cudaMemcpyHostToDevice, stream));
+  if (header.num_compressed_pages == 0) {
+    CUDA_TRY(cudaMemcpyAsync(payload, d_packed, packed_size, cudaMemcpyDeviceToDevice, stream));
+  } else {
+    std::vector<io::gpu_inflate_input_s> blocks(num_pages);
+    for (size_t p = 0; p < num_pages; ++p) {
+      blocks[p].srcDevice = pages[p].compressed
+                              ? static_cast<uint8_t const*>(scratch.data()) +
+                                  p * max_compressed_page_size
+                              : d_packed + packed_page_offset(p);
+      blocks[p].srcSize   = pages[p].stored_size;
+      blocks[p].dstDevice = payload + pages[p].stored_offset;
+      blocks[p].dstSize   = pages[p].stored_size;
+    }
+    copy_blocks(blocks, stream);
+  }
+  // The host header must stay alive until its copy completes
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return result;
+}
+
+packed_columns deserialize_from_device_buffer(void const* data,
+                                              size_t size,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  auto const d_data = static_cast<uint8_t const*>(data);
+  serialized_buffer_header header;
+  CUDF_EXPECTS(size >= sizeof(header), "Invalid serialized table");
+  CUDA_TRY(cudaMemcpyAsync(&header, d_data, sizeof(header), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_EXPECTS(header.magic == serialized_magic, "Invalid serialized table");
+
+  auto const pages_size  = header.num_pages * sizeof(serialized_page);
+  auto const header_size = sizeof(header) + pages_size + header.metadata_size;
+  CUDF_EXPECTS(header_size + header.payload_size <= size, "Truncated serialized table");
+
+  std::vector<serialized_page> pages(header.num_pages);
+  auto metadata = std::make_unique<std::vector<uint8_t>>(header.metadata_size);
+  CUDA_TRY(cudaMemcpyAsync(
+    pages.data(), d_data + sizeof(header), pages_size, cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaMemcpyAsync(metadata->data(),
+                           d_data + sizeof(header) + pages_size,
+                           header.metadata_size,
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  auto gpu_data      = std::make_unique<rmm::device_buffer>(header.packed_size, stream, mr);
+  auto const packed  = static_cast<uint8_t*>(gpu_data->data());
+  auto const payload = d_data + header_size;
+  if (header.num_compressed_pages == 0) {
+    CUDA_TRY(
+      cudaMemcpyAsync(packed, payload, header.packed_size, cudaMemcpyDeviceToDevice, stream));
+  } else {
+    std::vector<io::gpu_inflate_input_s> compressed_pages;
+    std::vector<io::gpu_inflate_input_s> raw_pages;
+    for (size_t p = 0; p < header.num_pages; ++p) {
+      io::gpu_inflate_input_s const input{payload + pages[p].stored_offset,
+                                          pages[p].stored_size,
+                                          packed + packed_page_offset(p),
+                                          packed_page_size(p, header.packed_size)};
+      (pages[p].compressed ? compressed_pages : raw_pages).push_back(input);
+    }
+    auto d_compressed = make_device_uvector_async(compressed_pages, stream);
+    rmm::device_uvector<io::gpu_inflate_status_s> d_statuses(compressed_pages.size(), stream);
+    CUDA_TRY(
+      io::gpu_unsnap(d_compressed.data(), d_statuses.data(), compressed_pages.size(), stream));
+    copy_blocks(raw_pages, stream);
+
+    std::vector<io::gpu_inflate_status_s> statuses(compressed_pages.size());
+    CUDA_TRY(cudaMemcpyAsync(statuses.data(),
+                             d_statuses.data(),
+                             statuses.size() * sizeof(io::gpu_inflate_status_s),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    CUDF_EXPECTS(std::all_of(statuses.begin(),
+                             statuses.end(),
+                             [](auto const& s) { return s.status == 0; }),
+                 "Failed to decompress a serialized table");
+  }
+  return packed_columns{std::move(metadata), std::move(gpu_data)};
+}
+
+}  // namespace detail
+
+std::unique_ptr<rmm::device_buffer> serialize_to_device_buffer(table_view const& input,
+                                                               io::compression_type compression,
+                                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::serialize_to_device_buffer(input, compression, mr);
+}
+
+packed_columns deserialize_from_device_buffer(void const* data,
+                                              size_t size,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::deserialize_from_device_buffer(data, size, mr);
+}
+
+}  // namespace cudf
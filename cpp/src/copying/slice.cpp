@@ -35,7 +35,31 @@ std::vector<column_view> slice(column_view const& input,
 
   if (indices.size() == 0 or input.size() == 0) { return result; }
 
-  auto null_counts = cudf::detail::segmented_count_unset_bits(input.null_mask(), indices, stream);
+  for (size_t i = 0; i < indices.size() / 2; i++) {
+    auto begin = indices[2 * i];
+    auto end   = indices[2 * i + 1];
+    CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.");
+    CUDF_EXPECTS(end >= begin, "End index cannot be smaller than the starting index.");
+    CUDF_EXPECTS(end <= input.size(), "Slice range out of bounds.");
+  }
+
+  // The null counts of the slices follow from the null count of the input when it has no nulls
+  // or only nulls. Otherwise they are counted with a single launch if the null count of the input
+  // is known, and left unknown, to be counted on demand, if it is not.
+  std::vector<size_type> null_counts(indices.size() / 2, cudf::UNKNOWN_NULL_COUNT);
+  if (not input.nullable() or (input.has_known_null_count() and input.null_count() == 0)) {
+    std::fill(null_counts.begin(), null_counts.end(), 0);
+  } else if (input.has_known_null_count() and input.null_count() == input.size()) {
+    for (size_t i = 0; i < null_counts.size(); i++) {
+      null_counts[i] = indices[2 * i + 1] - indices[2 * i];
+    }
+  } else if (input.has_known_null_count()) {
+    std::vector<size_type> mask_indices(indices.size());
+    std::transform(indices.begin(), indices.end(), mask_indices.begin(), [&input](auto index) {
+      return index + input.offset();
+    });
+    null_counts = cudf::detail::segmented_count_unset_bits(input.null_mask(), mask_indices, stream);
+  }
 
   std::vector<column_view> children{};
   for (size_type i = 0; i < input.num_children(); i++) { children.push_back(input.child(i)); }
@@ -43,9 +67,6 @@ std::vector<column_view> slice(column_view const& input,
   for (size_t i = 0; i < indices.size() / 2; i++) {
     auto begin = indices[2 * i];
     auto end   = indices[2 * i + 1];
-    CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.");
-    CUDF_EXPECTS(end >= begin, "End index cannot be smaller than the starting index.");
-    CUDF_EXPECTS(end <= input.size(), "Slice range out of bounds.");
     result.emplace_back(input.type(),
                         end - begin,
                         input.head(),
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,11 +20,15 @@
 #include <cudf/datetime.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
 namespace cudf {
 namespace datetime {
 namespace detail {
@@ -180,8 +184,110 @@ std::unique_ptr<column> apply_datetime_op(column_view const& column,
   return output;
 }
 
+// Extract the year, month, day, hour, minute and second of a timestamp, computing the civil
+// date and the time of day only once for all of the components
+template <typename Timestamp>
+struct extract_components_fn {
+  Timestamp const* input;
+  int16_t* out_years;
+  int16_t* out_months;
+  int16_t* out_days;
+  int16_t* out_hours;
+  int16_t* out_minutes;
+  int16_t* out_seconds;
+
+  CUDA_DEVICE_CALLABLE void operator()(size_type idx) const
+  {
+    using namespace simt::std::chrono;
+
+    auto const ts               = input[idx];
+    auto const days_since_epoch = floor<days>(ts);
+
+    auto time_since_midnight = ts - days_since_epoch;
+
+    if (time_since_midnight.count() < 0) { time_since_midnight += days(1); }
+
+    auto const hrs_  = duration_cast<hours>(time_since_midnight);
+    auto const mins_ = duration_cast<minutes>(time_since_midnight - hrs_);
+    auto const secs_ = duration_cast<seconds>(time_since_midnight - hrs_ - mins_);
+    auto const date  = year_month_day(days_since_epoch);
+
+    out_years[idx]   = static_cast<int>(date.year());
+    out_months[idx]  = static_cast<unsigned>(date.month());
+    out_days[idx]    = static_cast<unsigned>(date.day());
+    out_hours[idx]   = hrs_.count();
+    out_minutes[idx] = mins_.count();
+    out_seconds[idx] = secs_.count();
+  }
+};
+
+struct launch_extract_components {
+  template <typename Element>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
+    column_view const&, std::vector<std::unique_ptr<column>>&, cudaStream_t) const
+  {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    column_view const& input,
+    std::vector<std::unique_ptr<column>>& outputs,
+    cudaStream_t stream) const
+  {
+    auto output = [&outputs](size_t idx) { return outputs[idx]->mutable_view().data<int16_t>(); };
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       input.size(),
+                       extract_components_fn<Timestamp>{input.data<Timestamp>(),
+                                                        output(0),
+                                                        output(1),
+                                                        output(2),
+                                                        output(3),
+                                                        output(4),
+                                                        output(5)});
+  }
+};
+
+std::unique_ptr<table> extract_components(column_view const& column,
+                                          cudaStream_t stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  constexpr size_t num_components = 6;
+  auto const output_col_type      = data_type{type_id::INT16};
+
+  std::vector<std::unique_ptr<cudf::column>> components;
+  if (column.size() == 0) {
+    for (size_t idx = 0; idx < num_components; ++idx) {
+      components.push_back(make_empty_column(output_col_type));
+    }
+    return std::make_unique<table>(std::move(components));
+  }
+
+  auto const null_mask = copy_bitmask(column, stream, mr);
+  for (size_t idx = 0; idx < num_components; ++idx) {
+    components.push_back(make_fixed_width_column(output_col_type,
+                                                 column.size(),
+                                                 rmm::device_buffer{null_mask, stream, mr},
+                                                 column.null_count(),
+                                                 stream,
+                                                 mr));
+  }
+  type_dispatcher(column.type(), launch_extract_components{}, column, components, stream);
+
+  return std::make_unique<table>(std::move(components));
+}
+
 }  // namespace detail
 
+std::unique_ptr<table> extract_components(column_view const& column,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_components(column, 0, mr);
+}
+
 std::unique_ptr<column> extract_year(column_view const& column, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
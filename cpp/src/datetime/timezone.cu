@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/datetime.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <io/orc/timezone.h>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/transform.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+namespace {
+/**
+ * @brief Device view of a timezone transition table from `io::BuildTimezoneTransitionTable`
+ *
+ * Entry `i` of the table is the pair `(table[i * 2 + 1], table[i * 2 + 2])`: the UTC time in
+ * seconds from which the UTC offset in seconds applies. The first `num_entries` entries hold the
+ * historical transitions; the last `dst_cycle` entries hold the transitions of the 400 years from
+ * 1970, which repeat forever. UTC has an empty table.
+ */
+struct timezone_table_view {
+  int64_t const* table = nullptr;
+  uint32_t num_entries = 0;
+  uint32_t dst_cycle   = 0;
+
+  /**
+   * @brief Returns the offset in seconds of the timezone from UTC at a UTC time in seconds
+   */
+  __device__ int64_t utc_offset(int64_t ts) const
+  {
+    if (table == nullptr) { return 0; }
+    uint32_t first, last;
+    if (ts <= table[1]) {
+      return table[2];
+    } else if (ts <= table[(num_entries - 1) * 2 + 1]) {
+      first = 0;
+      last  = num_entries - 1;
+    } else if (!dst_cycle) {
+      return table[(num_entries - 1) * 2 + 2];
+    } else {
+      // Apply 400-year cycle rule
+      constexpr int64_t k400Years = (365 * 400 + (100 - 3)) * 24 * 60 * 60ll;
+      ts %= k400Years;
+      if (ts < 0) { ts += k400Years; }
+      first = num_entries;
+      last  = num_entries + dst_cycle - 1;
+      if (ts < table[num_entries * 2 + 1]) { return table[last * 2 + 2]; }
+    }
+    // Binary search the table from first to last for the last transition before ts
+    do {
+      uint32_t mid = first + ((last - first + 1) >> 1);
+      if (table[mid * 2 + 1] <= ts) {
+        first = mid;
+      } else {
+        if (mid == last) { break; }
+        last = mid;
+      }
+    } while (first < last);
+    return table[first * 2 + 2];
+  }
+};
+
+/**
+ * @brief Process-wide cache of the transition tables uploaded to each device, by timezone name
+ *
+ * The tables are never freed: the cache is intentionally leaked so that no device memory is
+ * released during static destruction, after the CUDA context may have been torn down.
+ */
+class timezone_table_cache {
+ public:
+  static timezone_table_cache& instance()
+  {
+    static timezone_table_cache* cache = new timezone_table_cache();
+    return *cache;
+  }
+
+  /**
+   * @brief Returns the transition table of a timezone on the current device, uploading it the
+   * first time the timezone is requested
+   *
+   * @throw cudf::logic_error if the timezone is not found
+   */
+  timezone_table_view get(std::string const& timezone_name, cudaStream_t stream)
+  {
+    int device = 0;
+    CUDA_TRY(cudaGetDevice(&device));
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const key = std::make_pair(device, timezone_name);
+    auto it        = _tables.find(key);
+    if (it == _tables.end()) {
+      std::vector<int64_t> h_table;
+      CUDF_EXPECTS(io::BuildTimezoneTransitionTable(h_table, timezone_name),
+                   "Invalid timezone: " + timezone_name);
+      auto d_table = std::make_unique<rmm::device_vector<int64_t>>(h_table.size());
+      CUDA_TRY(cudaMemcpyAsync(d_table->data().get(),
+                               h_table.data(),
+                               h_table.size() * sizeof(int64_t),
+                               cudaMemcpyHostToDevice,
+                               stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+      it = _tables.emplace(key, std::move(d_table)).first;
+    }
+    return make_view(*it->second);
+  }
+
+ private:
+  static timezone_table_view make_view(rmm::device_vector<int64_t> const& table)
+  {
+    // 2 entries per year for 400 years follow the historical transitions
+    constexpr uint32_t dst_cycle = 800;
+    if (table.empty()) { return timezone_table_view{}; }
+    auto const num_pairs = static_cast<uint32_t>((table.size() - 1) / 2);
+    if (num_pairs > dst_cycle) {
+      return timezone_table_view{table.data().get(), num_pairs - dst_cycle, dst_cycle};
+    }
+    return timezone_table_view{table.data().get(), num_pairs, 0};
+  }
+
+  timezone_table_cache() = default;
+
+  std::mutex _mutex;
+  std::map<std::pair<int, std::string>, std::unique_ptr<rmm::device_vector<int64_t>>> _tables;
+};
+
+// Convert a local time of one timezone to the local time of another timezone
+template <typename Timestamp>
+struct convert_timezone_fn {
+  timezone_table_view from_tz;
+  timezone_table_view to_tz;
+
+  CUDA_DEVICE_CALLABLE Timestamp operator()(Timestamp const ts) const
+  {
+    using namespace simt::std::chrono;
+    using duration_type = typename Timestamp::duration;
+
+    auto const local = floor<seconds>(ts).time_since_epoch().count();
+    // The offset of the source timezone is a function of UTC time; the offset at the local time
+    // is the right one except within the offset around a transition, where it is corrected with
+    // the offset at the resulting UTC time
+    auto const guess       = from_tz.utc_offset(local);
+    auto const from_offset = from_tz.utc_offset(local - guess);
+    auto const to_offset   = to_tz.utc_offset(local - from_offset);
+
+    return ts + duration_cast<duration_type>(seconds(to_offset - from_offset));
+  }
+};
+
+struct dispatch_convert_timezone_fn {
+  template <typename Timestamp>
+  typename std::enable_if_t<!cudf::is_timestamp_t<Timestamp>::value ||
+                              std::is_same<Timestamp, cudf::timestamp_D>::value,
+                            void>
+  operator()(column_view const&,
+             mutable_column_view&,
+             timezone_table_view,
+             timezone_table_view,
+             cudaStream_t) const
+  {
+    CUDF_FAIL(
+      "Timezone conversion requires a timestamp type with a resolution of seconds or finer");
+  }
+
+  template <typename Timestamp>
+  typename std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value &&
+                              !std::is_same<Timestamp, cudf::timestamp_D>::value,
+                            void>
+  operator()(column_view const& input,
+             mutable_column_view& output,
+             timezone_table_view from_tz,
+             timezone_table_view to_tz,
+             cudaStream_t stream) const
+  {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      input.begin<Timestamp>(),
+                      input.end<Timestamp>(),
+                      output.begin<Timestamp>(),
+                      convert_timezone_fn<Timestamp>{from_tz, to_tz});
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> convert_timezone(column_view const& column,
+                                         std::string const& from_timezone,
+                                         std::string const& to_timezone,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  CUDF_EXPECTS(column.type().id() != type_id::TIMESTAMP_DAYS,
+               "Timezone conversion requires a timestamp type with a resolution of seconds or "
+               "finer");
+  if (column.size() == 0) return make_empty_column(column.type());
+
+  auto const from_tz = timezone_table_cache::instance().get(from_timezone, stream);
+  auto const to_tz   = timezone_table_cache::instance().get(to_timezone, stream);
+
+  auto output = make_fixed_width_column(column.type(),
+                                        column.size(),
+                                        copy_bitmask(column, stream, mr),
+                                        column.null_count(),
+                                        stream,
+                                        mr);
+  auto output_view = output->mutable_view();
+  type_dispatcher(
+    column.type(), dispatch_convert_timezone_fn{}, column, output_view, from_tz, to_tz, stream);
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> convert_timezone(column_view const& column,
+                                         std::string const& from_timezone,
+                                         std::string const& to_timezone,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(column, from_timezone, to_timezone, 0, mr);
+}
+
+}  // namespace datetime
+}  // namespace cudf
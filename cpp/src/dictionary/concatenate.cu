@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/dictionary/detail/concatenate.hpp>
+#include <cudf/dictionary/detail/indices.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace dictionary {
+namespace detail {
+std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  // make the dictionaries share the union of their keys; this only remaps the indices
+  std::vector<table_view> tables;
+  std::transform(columns.begin(), columns.end(), std::back_inserter(tables), [](auto const& c) {
+    return table_view{{c}};
+  });
+  auto const matched = match_dictionaries(tables, rmm::mr::get_default_resource(), stream);
+
+  // the shared keys are copied once and the indices are concatenated with their nulls
+  std::unique_ptr<column> keys_column;
+  std::vector<column_view> indices;
+  for (auto const& table : matched.second) {
+    if (table.num_rows() == 0) { continue; }
+    if (!keys_column) {
+      keys_column =
+        std::make_unique<column>(dictionary_column_view(table.column(0)).keys(), stream, mr);
+    }
+    indices.push_back(get_indices_annotated(table).column(0));
+  }
+  auto indices_column   = cudf::detail::concatenate(indices, mr, stream);
+  auto const null_count = indices_column->null_count();
+  auto const size       = indices_column->size();
+  auto contents         = indices_column->release();
+  return make_dictionary_column(std::move(keys_column),
+                                std::make_unique<column>(data_type{type_id::INT32},
+                                                         size,
+                                                         std::move(*(contents.data.release())),
+                                                         rmm::device_buffer{0, stream, mr},
+                                                         0),
+                                std::move(*(contents.null_mask.release())),
+                                null_count);
+}
+
+}  // namespace detail
+}  // namespace dictionary
+}  // namespace cudf
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/dictionary/detail/indices.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace cudf {
+namespace dictionary {
+namespace detail {
+namespace {
+/**
+ * @brief Builds a dictionary column with a copy of the keys of `dictionary` and
+ * the indices and nulls of `indices`.
+ */
+std::unique_ptr<column> restore_dictionary(std::unique_ptr<column>&& indices,
+                                           dictionary_column_view const& dictionary,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  CUDF_EXPECTS(indices->type().id() == type_id::INT32, "indices must be of type INT32");
+  if (dictionary.size() == 0 || indices->size() == 0) {
+    return make_empty_column(data_type{type_id::DICTIONARY32});
+  }
+  auto const size       = indices->size();
+  auto const null_count = indices->null_count();
+  auto contents         = indices->release();
+  auto indices_column =
+    std::make_unique<column>(data_type{type_id::INT32}, size, std::move(*contents.data));
+  return make_dictionary_column(std::make_unique<column>(dictionary.keys(), stream, mr),
+                                std::move(indices_column),
+                                std::move(*contents.null_mask),
+                                null_count);
+}
+
+}  // namespace
+
+table_view get_indices_annotated(table_view const& input)
+{
+  std::vector<column_view> columns;
+  std::transform(input.begin(), input.end(), std::back_inserter(columns), [](auto const& col) {
+    if (col.type().id() != type_id::DICTIONARY32) { return col; }
+    if (col.size() == 0) { return column_view{data_type{type_id::INT32}, 0, nullptr}; }
+    return dictionary_column_view(col).get_indices_annotated();
+  });
+  return table_view{columns};
+}
+
+std::unique_ptr<table> restore_dictionaries(std::unique_ptr<table>&& indices,
+                                            table_view const& dictionaries,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  CUDF_EXPECTS(indices->num_columns() == dictionaries.num_columns(),
+               "Mismatch in the number of columns");
+  auto columns = indices->release();
+  for (size_t i = 0; i < columns.size(); ++i) {
+    auto const& col = dictionaries.column(i);
+    if (col.type().id() == type_id::DICTIONARY32) {
+      columns[i] = restore_dictionary(std::move(columns[i]), col, mr, stream);
+    }
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+}  // namespace dictionary
+}  // namespace cudf
@@ -18,6 +18,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/dictionary/detail/search.hpp>
 #include <cudf/dictionary/search.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <thrust/binary_search.h>
@@ -38,7 +39,7 @@ namespace detail {
 struct find_index_fn {
   template <typename Element,
             std::enable_if_t<not std::is_same<Element, dictionary32>::value and
-                             not std::is_same<Element, list_view>::value>* = nullptr>
+                             not cudf::is_nested<Element>()>* = nullptr>
   std::unique_ptr<numeric_scalar<int32_t>> operator()(dictionary_column_view const& input,
                                                       scalar const& key,
                                                       rmm::mr::device_memory_resource* mr,
@@ -70,13 +71,13 @@ struct find_index_fn {
     CUDF_FAIL("dictionary column cannot be the keys column of another dictionary");
   }
 
-  template <typename Element, std::enable_if_t<std::is_same<Element, list_view>::value>* = nullptr>
+  template <typename Element, std::enable_if_t<cudf::is_nested<Element>()>* = nullptr>
   std::unique_ptr<numeric_scalar<int32_t>> operator()(dictionary_column_view const& input,
                                                       scalar const& key,
                                                       rmm::mr::device_memory_resource* mr,
                                                       cudaStream_t stream) const
   {
-    CUDF_FAIL("list_view column cannot be the keys column of a dictionary");
+    CUDF_FAIL("nested column cannot be the keys column of a dictionary");
   }
 };
 
@@ -88,6 +89,63 @@ std::unique_ptr<numeric_scalar<int32_t>> get_index(dictionary_column_view const&
   return type_dispatcher(dictionary.keys().type(), find_index_fn(), dictionary, key, mr, stream);
 }
 
+/**
+ * @brief Find the index of the first key in a dictionary's keys column that is
+ * not less than a given key.
+ *
+ * This is the position the given key (scalar) would be inserted at to keep the
+ * keys sorted. It is equal to the number of keys if all of them are less than
+ * the given key.
+ */
+struct find_insert_index_fn {
+  template <typename Element,
+            std::enable_if_t<not std::is_same<Element, dictionary32>::value and
+                             not cudf::is_nested<Element>()>* = nullptr>
+  std::unique_ptr<numeric_scalar<int32_t>> operator()(dictionary_column_view const& input,
+                                                      scalar const& key,
+                                                      rmm::mr::device_memory_resource* mr,
+                                                      cudaStream_t stream) const
+  {
+    if (!key.is_valid()) return std::make_unique<numeric_scalar<int32_t>>(0, false, stream, mr);
+    if (input.size() == 0) return std::make_unique<numeric_scalar<int32_t>>(0, true, stream, mr);
+    CUDF_EXPECTS(input.keys().type() == key.type(),
+                 "search key type must match dictionary keys type");
+    auto keys_view = column_device_view::create(input.keys(), stream);
+    auto find_key  = static_cast<scalar_type_t<Element> const&>(key).value(stream);
+    auto iter      = thrust::lower_bound(
+      thrust::device, keys_view->begin<Element>(), keys_view->end<Element>(), find_key);
+    return std::make_unique<numeric_scalar<int32_t>>(
+      thrust::distance(keys_view->begin<Element>(), iter), true, stream, mr);
+  }
+  template <typename Element,
+            std::enable_if_t<std::is_same<Element, dictionary32>::value>* = nullptr>
+  std::unique_ptr<numeric_scalar<int32_t>> operator()(dictionary_column_view const& input,
+                                                      scalar const& key,
+                                                      rmm::mr::device_memory_resource* mr,
+                                                      cudaStream_t stream) const
+  {
+    CUDF_FAIL("dictionary column cannot be the keys column of another dictionary");
+  }
+
+  template <typename Element, std::enable_if_t<cudf::is_nested<Element>()>* = nullptr>
+  std::unique_ptr<numeric_scalar<int32_t>> operator()(dictionary_column_view const& input,
+                                                      scalar const& key,
+                                                      rmm::mr::device_memory_resource* mr,
+                                                      cudaStream_t stream) const
+  {
+    CUDF_FAIL("nested column cannot be the keys column of a dictionary");
+  }
+};
+
+std::unique_ptr<numeric_scalar<int32_t>> get_insert_index(dictionary_column_view const& dictionary,
+                                                          scalar const& key,
+                                                          rmm::mr::device_memory_resource* mr,
+                                                          cudaStream_t stream)
+{
+  return type_dispatcher(
+    dictionary.keys().type(), find_insert_index_fn(), dictionary, key, mr, stream);
+}
+
 }  // namespace detail
 
 // external API
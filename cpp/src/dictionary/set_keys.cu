@@ -16,10 +16,12 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/search.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/stream_compaction.hpp>
@@ -27,6 +29,8 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <thrust/binary_search.h>
 
+#include <algorithm>
+
 namespace cudf {
 namespace dictionary {
 namespace detail {
@@ -92,11 +96,10 @@ struct dispatch_compute_indices {
 }  // namespace
 
 //
-std::unique_ptr<column> set_keys(
-  dictionary_column_view const& dictionary_column,
-  column_view const& new_keys,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
-  cudaStream_t stream                 = 0)
+std::unique_ptr<column> set_keys(dictionary_column_view const& dictionary_column,
+                                 column_view const& new_keys,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream)
 {
   CUDF_EXPECTS(!new_keys.has_nulls(), "keys parameter must not have nulls");
   auto keys = dictionary_column.keys();
@@ -142,6 +145,61 @@ std::unique_ptr<column> set_keys(
                                 std::move(new_nulls.first),
                                 new_nulls.second);
 }
+
+std::pair<std::vector<std::unique_ptr<column>>, std::vector<table_view>> match_dictionaries(
+  std::vector<table_view> const& input,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  std::vector<std::vector<column_view>> columns(input.size());
+  std::vector<std::unique_ptr<column>> matched;
+  if (input.empty()) { return std::make_pair(std::move(matched), std::vector<table_view>{}); }
+  auto const num_columns = input.front().num_columns();
+  CUDF_EXPECTS(std::all_of(input.begin(),
+                           input.end(),
+                           [num_columns](auto const& t) { return t.num_columns() == num_columns; }),
+               "Mismatch in the number of columns");
+
+  for (size_type i = 0; i < num_columns; ++i) {
+    auto const is_dictionary = input.front().column(i).type().id() == type_id::DICTIONARY32;
+    std::vector<column_view> keys;
+    for (size_t t = 0; t < input.size(); ++t) {
+      auto const& col = input[t].column(i);
+      columns[t].push_back(col);
+      CUDF_EXPECTS((col.type().id() == type_id::DICTIONARY32) == is_dictionary,
+                   "Mismatch in the types of the columns to match");
+      if (is_dictionary && col.size() > 0) { keys.push_back(dictionary_column_view(col).keys()); }
+    }
+    if (keys.size() < 2) { continue; }
+    CUDF_EXPECTS(std::all_of(keys.begin(),
+                             keys.end(),
+                             [&keys](auto const& k) { return k.type() == keys.front().type(); }),
+                 "keys types must match");
+
+    // the union of the keys; set_keys sorts and removes the duplicates
+    auto const all_keys = cudf::detail::concatenate(keys, rmm::mr::get_default_resource(), stream);
+    auto const new_keys = cudf::detail::drop_duplicates(table_view{{all_keys->view()}},
+                                                        std::vector<size_type>{0},
+                                                        duplicate_keep_option::KEEP_FIRST,
+                                                        null_equality::EQUAL,
+                                                        rmm::mr::get_default_resource(),
+                                                        stream);
+    auto const new_keys_view = new_keys->get_column(0).view();
+    for (size_t t = 0; t < input.size(); ++t) {
+      auto const& col = columns[t].back();
+      // unique keys that hold as many values as the union are the union
+      if (col.size() == 0 || dictionary_column_view(col).keys_size() == new_keys_view.size()) {
+        continue;
+      }
+      matched.push_back(set_keys(dictionary_column_view(col), new_keys_view, mr, stream));
+      columns[t].back() = matched.back()->view();
+    }
+  }
+
+  std::vector<table_view> tables(columns.begin(), columns.end());
+  return std::make_pair(std::move(matched), std::move(tables));
+}
+
 }  // namespace detail
 
 // external API
@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 #include <cudf/column/column_factories.hpp>
+#include <cudf/column/column.hpp>
 #include <cudf/detail/dlpack.hpp>
+#include <cudf/unary.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -100,6 +102,7 @@ struct dltensor_context {
   int64_t shape[2];
   int64_t strides[2];
   rmm::device_buffer buffer;
+  std::unique_ptr<column> owner;  // set instead of buffer when a column is exported zero-copy
 
   static void deleter(DLManagedTensor* arg)
   {
@@ -109,21 +112,9 @@ struct dltensor_context {
   }
 };
 
-}  // namespace
-
-namespace detail {
-std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
-                                   rmm::mr::device_memory_resource* mr,
-                                   cudaStream_t stream)
+// Validate the shape and device of a tensor
+void validate_tensor(DLTensor const& tensor)
 {
-  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
-  auto const& tensor = managed_tensor->dl_tensor;
-
-  // We can copy from host or device pointers
-  CUDF_EXPECTS(kDLGPU == tensor.ctx.device_type || kDLCPU == tensor.ctx.device_type ||
-                 kDLCPUPinned == tensor.ctx.device_type,
-               "DLTensor must be GPU, CPU, or pinned type");
-
   // Make sure the current device ID matches the Tensor's device ID
   if (tensor.ctx.device_type != kDLCPU) {
     int device_id = 0;
@@ -144,6 +135,23 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
     CUDF_EXPECTS(tensor.shape[1] < std::numeric_limits<size_type>::max(),
                  "DLTensor second dim exceeds size supported by cudf");
   }
+}
+
+}  // namespace
+
+namespace detail {
+std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
+{
+  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
+  auto const& tensor = managed_tensor->dl_tensor;
+
+  // We can copy from host or device pointers
+  CUDF_EXPECTS(kDLGPU == tensor.ctx.device_type || kDLCPU == tensor.ctx.device_type ||
+                 kDLCPUPinned == tensor.ctx.device_type,
+               "DLTensor must be GPU, CPU, or pinned type");
+  validate_tensor(tensor);
 
   size_t const num_columns = (tensor.ndim == 2) ? static_cast<size_t>(tensor.shape[1]) : 1;
 
@@ -251,8 +259,88 @@ DLManagedTensor* to_dlpack(table_view const& input,
   return managed_tensor.release();
 }
 
+dlpack_table_view from_dlpack_view(DLManagedTensor* managed_tensor)
+{
+  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
+  dlpack_table_view result;
+  // Take ownership first so that the tensor is released if it is rejected
+  result.tensor.reset(managed_tensor);
+  auto const& tensor = managed_tensor->dl_tensor;
+
+  // The columns reference the tensor memory, which must be accessible from the device
+  CUDF_EXPECTS(kDLGPU == tensor.ctx.device_type || kDLCPUPinned == tensor.ctx.device_type,
+               "DLTensor must be GPU or pinned type to be viewed without a copy");
+  validate_tensor(tensor);
+  CUDF_EXPECTS(nullptr == tensor.strides || tensor.strides[0] == 1,
+               "DLTensor columns must be contiguous to be viewed without a copy");
+
+  size_t const num_columns = (tensor.ndim == 2) ? static_cast<size_t>(tensor.shape[1]) : 1;
+  data_type const dtype    = DLDataType_to_data_type(tensor.dtype);
+  auto const num_rows      = static_cast<size_type>(tensor.shape[0]);
+  size_t const col_stride  = (tensor.ndim == 2 && nullptr != tensor.strides)
+                              ? size_of(dtype) * tensor.strides[1]
+                              : size_of(dtype) * num_rows;
+
+  auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset;
+  std::vector<column_view> columns;
+  for (size_t col = 0; col < num_columns; ++col) {
+    columns.emplace_back(dtype, num_rows, reinterpret_cast<void const*>(tensor_data));
+    tensor_data += col_stride;
+  }
+  result.view = table_view(columns);
+  return result;
+}
+
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input)
+{
+  CUDF_EXPECTS(nullptr != input, "input column is null");
+  auto const num_rows = input->size();
+  if (num_rows == 0) { return nullptr; }
+  DLDataType const dltype = data_type_to_DLDataType(input->type());
+
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
+
+  DLTensor& tensor = managed_tensor->dl_tensor;
+  tensor.dtype     = dltype;
+  tensor.ndim      = 1;
+  tensor.shape     = context->shape;
+  tensor.shape[0]  = num_rows;
+  CUDA_TRY(cudaGetDevice(&tensor.ctx.device_id));
+  tensor.ctx.device_type = kDLGPU;
+
+  // The tensor takes ownership of the column, so its data does not need to be copied
+  tensor.data    = input->mutable_view().head<void>();
+  context->owner = std::move(input);
+
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+  return managed_tensor.release();
+}
+
+DLManagedTensor* validity_to_dlpack(table_view const& input,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return nullptr; }
+  if (input.num_columns() == 1) { return to_dlpack(cudf::is_valid(input.column(0), mr)); }
+
+  std::vector<std::unique_ptr<column>> validity;
+  std::vector<column_view> views;
+  for (auto const& col : input) {
+    validity.push_back(cudf::is_valid(col));
+    views.push_back(validity.back()->view());
+  }
+  return to_dlpack(table_view(views), mr, stream);
+}
+
 }  // namespace detail
 
+void dlpack_tensor_deleter::operator()(DLManagedTensor* tensor) const
+{
+  if (tensor != nullptr && tensor->deleter != nullptr) { tensor->deleter(tensor); }
+}
+
 std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
                                    rmm::mr::device_memory_resource* mr)
 {
@@ -264,4 +352,19 @@ DLManagedTensor* to_dlpack(table_view const& input, rmm::mr::device_memory_resou
   return detail::to_dlpack(input, mr);
 }
 
+dlpack_table_view from_dlpack_view(DLManagedTensor* managed_tensor)
+{
+  return detail::from_dlpack_view(managed_tensor);
+}
+
+DLManagedTensor* to_dlpack(std::unique_ptr<column> input)
+{
+  return detail::to_dlpack(std::move(input));
+}
+
+DLManagedTensor* validity_to_dlpack(table_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  return detail::validity_to_dlpack(input, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/encode.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Applies a binary operator to 32 packed booleans at a time
+ */
+struct packed_binary_op_fn {
+  bitmask_type const* lhs_bits;
+  bitmask_type const* rhs_bits;
+  bitmask_type const* lhs_mask;
+  bitmask_type const* rhs_mask;
+  binary_operator op;
+  bitmask_type* out_bits;
+  bitmask_type* out_mask;
+
+  __device__ bitmask_type apply(bitmask_type lhs, bitmask_type rhs) const
+  {
+    switch (op) {
+      case binary_operator::EQUAL: return ~(lhs ^ rhs);
+      case binary_operator::NOT_EQUAL:
+      case binary_operator::BITWISE_XOR: return lhs ^ rhs;
+      case binary_operator::LESS: return ~lhs & rhs;
+      case binary_operator::GREATER: return lhs & ~rhs;
+      case binary_operator::LESS_EQUAL: return ~lhs | rhs;
+      case binary_operator::GREATER_EQUAL: return lhs | ~rhs;
+      case binary_operator::BITWISE_AND:
+      case binary_operator::LOGICAL_AND: return lhs & rhs;
+      default: return lhs | rhs;
+    }
+  }
+
+  __device__ void operator()(size_type word_idx) const
+  {
+    out_bits[word_idx] = apply(lhs_bits[word_idx], rhs_bits[word_idx]);
+    if (out_mask != nullptr) {
+      out_mask[word_idx] = (lhs_mask != nullptr ? lhs_mask[word_idx] : ~bitmask_type{0}) &
+                           (rhs_mask != nullptr ? rhs_mask[word_idx] : ~bitmask_type{0});
+    }
+  }
+};
+
+/**
+ * @brief Returns true if the row is valid and its bit is set
+ *
+ * This is the filter functor for apply_boolean_mask with packed booleans
+ */
+struct packed_mask_filter {
+  bitmask_type const* bits;
+  bitmask_type const* null_mask;
+
+  __device__ inline bool operator()(size_type i)
+  {
+    return bit_is_set(bits, i) && (null_mask == nullptr || bit_is_set(null_mask, i));
+  }
+};
+
+bool is_packed_binary_op(binary_operator op)
+{
+  switch (op) {
+    case binary_operator::EQUAL:
+    case binary_operator::NOT_EQUAL:
+    case binary_operator::LESS:
+    case binary_operator::GREATER:
+    case binary_operator::LESS_EQUAL:
+    case binary_operator::GREATER_EQUAL:
+    case binary_operator::BITWISE_AND:
+    case binary_operator::BITWISE_OR:
+    case binary_operator::BITWISE_XOR:
+    case binary_operator::LOGICAL_AND:
+    case binary_operator::LOGICAL_OR: return true;
+    default: return false;
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<packed_bools> pack_bools(column_view const& input,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  CUDF_EXPECTS(input.type().id() == type_id::BOOL8, "Input is not of type bool");
+  auto bits =
+    valid_if(input.begin<bool>(), input.end<bool>(), thrust::identity<bool>{}, stream, mr);
+  return std::make_unique<packed_bools>(
+    input.size(), std::move(bits.first), copy_bitmask(input, stream, mr), input.null_count());
+}
+
+std::unique_ptr<column> unpack_bools(packed_bools const& input,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+{
+  auto null_mask = input.null_mask() != nullptr
+                     ? copy_bitmask(input.null_mask(), 0, input.size(), stream, mr)
+                     : rmm::device_buffer{0, stream, mr};
+  auto output = make_fixed_width_column(
+    data_type{type_id::BOOL8}, input.size(), std::move(null_mask), input.null_count(), stream, mr);
+  auto const bits = input.bits();
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    output->mutable_view().begin<bool>(),
+                    [bits] __device__(size_type idx) { return bit_is_set(bits, idx); });
+  return output;
+}
+
+std::unique_ptr<packed_bools> binary_operation(packed_bools const& lhs,
+                                               packed_bools const& rhs,
+                                               binary_operator op,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size(), "Column sizes don't match");
+  CUDF_EXPECTS(is_packed_binary_op(op), "Unsupported operator for packed booleans");
+
+  auto const size     = lhs.size();
+  auto const nullable = lhs.null_mask() != nullptr || rhs.null_mask() != nullptr;
+  auto bits           = create_null_mask(size, mask_state::UNINITIALIZED, stream, mr);
+  auto null_mask      = nullable ? create_null_mask(size, mask_state::UNINITIALIZED, stream, mr)
+                                 : rmm::device_buffer{0, stream, mr};
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_bitmask_words(size),
+                     packed_binary_op_fn{lhs.bits(),
+                                         rhs.bits(),
+                                         lhs.null_mask(),
+                                         rhs.null_mask(),
+                                         op,
+                                         static_cast<bitmask_type*>(bits.data()),
+                                         static_cast<bitmask_type*>(null_mask.data())});
+  auto const null_count =
+    nullable ? count_unset_bits(static_cast<bitmask_type const*>(null_mask.data()), 0, size) : 0;
+  return std::make_unique<packed_bools>(size, std::move(bits), std::move(null_mask), null_count);
+}
+
+std::unique_ptr<table> apply_boolean_mask(table_view const& input,
+                                          packed_bools const& boolean_mask,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  if (boolean_mask.size() == 0) { return empty_like(input); }
+  CUDF_EXPECTS(input.num_rows() == 0 || input.num_rows() == boolean_mask.size(),
+               "Column size mismatch");
+  return copy_if(
+    input, packed_mask_filter{boolean_mask.bits(), boolean_mask.null_mask()}, mr, stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<packed_bools> pack_bools(column_view const& input,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::pack_bools(input, mr);
+}
+
+std::unique_ptr<column> unpack_bools(packed_bools const& input,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::unpack_bools(input, mr);
+}
+
+std::unique_ptr<packed_bools> binary_operation(packed_bools const& lhs,
+                                               packed_bools const& rhs,
+                                               binary_operator op,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::binary_operation(lhs, rhs, op, mr);
+}
+
+std::unique_ptr<table> apply_boolean_mask(table_view const& input,
+                                          packed_bools const& boolean_mask,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_boolean_mask(input, boolean_mask, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/encode.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/adjacent_difference.h>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Writes the first row of each run and returns the number of runs
+ */
+template <bool has_nulls>
+size_type find_run_starts(table_device_view const& d_input,
+                          size_type* run_starts,
+                          cudaStream_t stream)
+{
+  auto equal = row_equality_comparator<has_nulls>{d_input, d_input};
+  auto end   = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                             thrust::make_counting_iterator<size_type>(0),
+                             thrust::make_counting_iterator<size_type>(d_input.num_rows()),
+                             run_starts,
+                             [equal] __device__(size_type idx) {
+                               return idx == 0 || not equal(idx - 1, idx);
+                             });
+  return static_cast<size_type>(thrust::distance(run_starts, end));
+}
+
+}  // namespace
+
+std::unique_ptr<run_length_encoded> run_length_encode(column_view const& input,
+                                                      rmm::mr::device_memory_resource* mr,
+                                                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_fixed_width(input.type()), "Run-length encoding supports only fixed-width types");
+  auto const size = input.size();
+  rmm::device_vector<size_type> run_starts(size);
+  auto d_input        = table_device_view::create(table_view{{input}}, stream);
+  auto const num_runs = input.has_nulls()
+                          ? find_run_starts<true>(*d_input, run_starts.data().get(), stream)
+                          : find_run_starts<false>(*d_input, run_starts.data().get(), stream);
+
+  auto values = detail::gather(
+    table_view{{input}}, run_starts.begin(), run_starts.begin() + num_runs, false, mr, stream);
+
+  auto run_ends = make_numeric_column(
+    data_type{type_id::INT32}, num_runs, mask_state::UNALLOCATED, stream, mr);
+  auto const d_starts = run_starts.data().get();
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_runs),
+                    run_ends->mutable_view().begin<size_type>(),
+                    [d_starts, num_runs, size] __device__(size_type run) {
+                      return run + 1 < num_runs ? d_starts[run + 1] : size;
+                    });
+  return std::make_unique<run_length_encoded>(
+    size, std::move(values->release().front()), std::move(run_ends));
+}
+
+std::unique_ptr<column> run_length_decode(run_length_encoded const& input,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  auto const run_ends = input.run_ends();
+  // The run of a row is the first run ending after it
+  rmm::device_vector<size_type> gather_map(input.size());
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      run_ends.begin<size_type>(),
+                      run_ends.end<size_type>(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      gather_map.begin());
+  auto output = detail::gather(
+    table_view{{input.values()}}, gather_map.begin(), gather_map.end(), false, mr, stream);
+  return std::move(output->release().front());
+}
+
+std::unique_ptr<scalar> reduce(run_length_encoded const& input,
+                               std::unique_ptr<aggregation> const& agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream)
+{
+  switch (agg->kind) {
+    // The extrema and the logical reductions do not depend on the run lengths
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::ANY:
+    case aggregation::ALL: return detail::reduce(input.values(), agg, output_dtype, mr, stream);
+    case aggregation::SUM: {
+      auto const run_ends = input.run_ends();
+      auto lengths        = make_numeric_column(
+        data_type{type_id::INT32}, input.num_runs(), mask_state::UNALLOCATED, stream);
+      thrust::adjacent_difference(rmm::exec_policy(stream)->on(stream),
+                                  run_ends.begin<size_type>(),
+                                  run_ends.end<size_type>(),
+                                  lengths->mutable_view().begin<size_type>());
+      auto weighted = detail::binary_operation(input.values(),
+                                               lengths->view(),
+                                               binary_operator::MUL,
+                                               output_dtype,
+                                               rmm::mr::get_default_resource(),
+                                               stream);
+      return detail::reduce(weighted->view(), agg, output_dtype, mr, stream);
+    }
+    default: CUDF_FAIL("Unsupported reduction for a run-length encoded column");
+  }
+}
+
+std::unique_ptr<table> apply_boolean_mask(table_view const& input,
+                                          run_length_encoded const& boolean_mask,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  if (boolean_mask.size() == 0) { return empty_like(input); }
+  CUDF_EXPECTS(boolean_mask.values().type().id() == type_id::BOOL8, "Mask must be Boolean type");
+  CUDF_EXPECTS(input.num_rows() == 0 || input.num_rows() == boolean_mask.size(),
+               "Column size mismatch");
+  if (input.num_rows() == 0) { return empty_like(input); }
+
+  auto const num_runs = boolean_mask.num_runs();
+  auto const d_ends   = boolean_mask.run_ends().data<size_type>();
+  auto values         = column_device_view::create(boolean_mask.values(), stream);
+  auto d_values       = *values;
+  // kept_ends[r] is the number of output rows up to the end of run `r`
+  rmm::device_vector<size_type> kept_ends(num_runs);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_runs),
+    kept_ends.begin(),
+    [d_values, d_ends] __device__(size_type run) -> size_type {
+      if (d_values.is_null(run) || not d_values.element<bool>(run)) { return 0; }
+      return d_ends[run] - (run > 0 ? d_ends[run - 1] : 0);
+    },
+    thrust::plus<size_type>());
+  size_type const num_kept = kept_ends.back();
+
+  // Each output row is found in its run without expanding the mask
+  rmm::device_vector<size_type> gather_map(num_kept);
+  auto const d_kept_ends = kept_ends.data().get();
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_kept),
+    gather_map.begin(),
+    [d_kept_ends, d_ends, num_runs] __device__(size_type idx) {
+      auto const run = static_cast<size_type>(thrust::distance(
+        d_kept_ends, thrust::upper_bound(thrust::seq, d_kept_ends, d_kept_ends + num_runs, idx)));
+      auto const run_start  = run > 0 ? d_ends[run - 1] : 0;
+      auto const kept_start = run > 0 ? d_kept_ends[run - 1] : 0;
+      return run_start + idx - kept_start;
+    });
+  return detail::gather(input, gather_map.begin(), gather_map.end(), false, mr, stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<run_length_encoded> run_length_encode(column_view const& input,
+                                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::run_length_encode(input, mr);
+}
+
+std::unique_ptr<column> run_length_decode(run_length_encoded const& input,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::run_length_decode(input, mr);
+}
+
+std::unique_ptr<scalar> reduce(run_length_encoded const& input,
+                               std::unique_ptr<aggregation> const& agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(input, agg, output_dtype, mr);
+}
+
+std::unique_ptr<table> apply_boolean_mask(table_view const& input,
+                                          run_length_encoded const& boolean_mask,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_boolean_mask(input, boolean_mask, mr);
+}
+
+}  // namespace cudf
@@ -16,8 +16,13 @@
 
 #pragma once
 
+#include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/aggregation/result_cache.hpp>
 #include <cudf/detail/groupby.hpp>
+#include <cudf/detail/utilities/memory_estimate.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/traits.hpp>
+
 #include <vector>
 
 namespace cudf {
@@ -36,6 +41,30 @@ inline std::vector<aggregation_result> extract_results(
   return results;
 }
 
+/**
+ * @brief Estimates the device memory of the result of an aggregation of `values` over
+ * `num_groups` groups
+ *
+ * COLLECT returns every row of `values`; the other aggregations return one row per group.
+ */
+inline std::size_t estimate_result_bytes(column_view const& values,
+                                         aggregation::Kind kind,
+                                         size_type num_groups)
+{
+  auto const num_rows = static_cast<std::size_t>(num_groups);
+  if (kind == aggregation::COLLECT) {
+    return (num_rows + 1) * sizeof(size_type) +
+           cudf::detail::estimate_gather_bytes(table_view{{values}}, values.size());
+  }
+  auto const type = cudf::detail::target_type(values.type(), kind);
+  if (not is_fixed_width(type)) {
+    return cudf::detail::estimate_gather_bytes(table_view{{values}}, num_rows);
+  }
+  bool const nullable =
+    values.nullable() and kind != aggregation::COUNT_VALID and kind != aggregation::COUNT_ALL;
+  return num_rows * size_of(type) + (nullable ? bitmask_allocation_size_bytes(num_groups) : 0);
+}
+
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/groupby.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+namespace cudf {
+namespace groupby {
+namespace {
+/**
+ * @brief Copies a duration scalar and returns its value in ticks
+ */
+struct copy_window_size_fn {
+  template <typename T>
+  std::enable_if_t<cudf::is_duration<T>(), std::pair<std::unique_ptr<scalar>, int64_t>> operator()(
+    scalar const& window_size) const
+  {
+    auto const& duration = static_cast<duration_scalar<T> const&>(window_size);
+    return {std::make_unique<duration_scalar<T>>(duration),
+            static_cast<int64_t>(duration.value().count())};
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not cudf::is_duration<T>(), std::pair<std::unique_ptr<scalar>, int64_t>>
+  operator()(Args&&...) const
+  {
+    CUDF_FAIL("Window size must be a duration");
+  }
+};
+
+/**
+ * @brief Returns the ticks since the epoch of a timestamp scalar of the
+ * resolution of the window size
+ */
+struct watermark_ticks_fn {
+  template <typename T>
+  std::enable_if_t<cudf::is_timestamp<T>(), int64_t> operator()(scalar const& watermark,
+                                                                data_type window_type,
+                                                                cudaStream_t stream) const
+  {
+    CUDF_EXPECTS(window_type == data_type{type_to_id<typename T::duration>()},
+                 "Watermark must be a timestamp of the resolution of the window size");
+    auto const& timestamp = static_cast<timestamp_scalar<T> const&>(watermark);
+    return static_cast<int64_t>(timestamp.value(stream).time_since_epoch().count());
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not cudf::is_timestamp<T>(), int64_t> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Watermark must be a timestamp");
+  }
+};
+
+/**
+ * @brief Computes whether the window of each valid row of `starts` is closed by
+ * the watermark, or open if `closed` is false. Null rows are neither.
+ */
+struct window_mask_fn {
+  template <typename T>
+  std::enable_if_t<cudf::is_timestamp<T>(), std::unique_ptr<column>> operator()(
+    column_view const& starts,
+    int64_t window_ticks,
+    int64_t watermark,
+    bool closed,
+    cudaStream_t stream) const
+  {
+    using Rep   = typename T::rep;
+    auto result = make_numeric_column(
+      data_type{type_id::BOOL8}, starts.size(), mask_state::UNALLOCATED, stream);
+    auto d_starts = column_device_view::create(starts, stream);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(starts.size()),
+                      result->mutable_view().begin<bool>(),
+                      [d_starts = *d_starts, window_ticks, watermark, closed] __device__(
+                        size_type i) {
+                        if (d_starts.is_null(i)) { return false; }
+                        auto const end = static_cast<int64_t>(d_starts.element<Rep>(i)) +
+                                         window_ticks;
+                        return (end <= watermark) == closed;
+                      });
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not cudf::is_timestamp<T>(), std::unique_ptr<column>> operator()(
+    Args&&...) const
+  {
+    CUDF_FAIL("Window starts must be timestamps");
+  }
+};
+
+}  // namespace
+
+event_time_window_groupby::event_time_window_groupby(scalar const& window_size,
+                                                     null_policy include_null_keys)
+  : _watermark{std::numeric_limits<int64_t>::min()}, _groups{include_null_keys}
+{
+  CUDF_EXPECTS(window_size.is_valid(), "Window size must be valid");
+  std::tie(_window_size, _window_ticks) =
+    type_dispatcher(window_size.type(), copy_window_size_fn{}, window_size);
+  CUDF_EXPECTS(_window_ticks > 0, "Window size must be positive");
+}
+
+event_time_window_groupby::~event_time_window_groupby() = default;
+
+size_type event_time_window_groupby::update(column_view const& event_times,
+                                            table_view const& keys,
+                                            std::vector<aggregation_request> const& requests)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(keys.num_columns() == 0 or keys.num_rows() == event_times.size(),
+               "Keys must have one row per event");
+  CUDF_EXPECTS(std::all_of(requests.begin(),
+                           requests.end(),
+                           [&event_times](auto const& request) {
+                             return request.values.size() == event_times.size();
+                           }),
+               "Size mismatch between request values and event times.");
+
+  auto const starts = detail::time_bucket_starts(event_times, *_window_size);
+  auto const open   = type_dispatcher(
+    starts->type(), window_mask_fn{}, starts->view(), _window_ticks, _watermark, false, 0);
+  auto const num_open = static_cast<size_type>(
+    thrust::count(rmm::exec_policy(0)->on(0),
+                  open->view().begin<bool>(),
+                  open->view().end<bool>(),
+                  true));
+  auto const num_late = event_times.size() - event_times.null_count() - num_open;
+
+  // The window start is the first key of the groups
+  std::vector<column_view> columns{starts->view()};
+  columns.insert(columns.end(), keys.begin(), keys.end());
+  for (auto const& request : requests) { columns.push_back(request.values); }
+
+  // Drop the late events and the events without a time
+  std::unique_ptr<table> open_events;
+  table_view events{columns};
+  if (num_open < event_times.size()) {
+    open_events = apply_boolean_mask(events, open->view());
+    events      = open_events->view();
+  }
+
+  auto const num_keys = 1 + keys.num_columns();
+  std::vector<column_view> window_keys(events.begin(), events.begin() + num_keys);
+  std::vector<aggregation_request> window_requests(requests.size());
+  for (size_t i = 0; i < requests.size(); i++) {
+    window_requests[i].values = events.column(num_keys + i);
+    for (auto const& agg : requests[i].aggregations) {
+      window_requests[i].aggregations.push_back(agg->clone());
+    }
+  }
+  _groups.update(table_view{window_keys}, window_requests);
+  return num_late;
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
+event_time_window_groupby::advance_watermark(scalar const& watermark,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(watermark.is_valid(stream), "Watermark must be valid");
+  auto const ticks = type_dispatcher(
+    watermark.type(), watermark_ticks_fn{}, watermark, _window_size->type(), stream);
+  _watermark = std::max(_watermark, ticks);
+
+  auto const groups = _groups.keys();
+  if (groups.num_columns() == 0) {
+    return std::make_pair(std::make_unique<table>(), std::vector<aggregation_result>{});
+  }
+  auto const closed = type_dispatcher(groups.column(0).type(),
+                                      window_mask_fn{},
+                                      groups.column(0),
+                                      _window_ticks,
+                                      _watermark,
+                                      true,
+                                      stream);
+  return _groups.evict(closed->view(), mr, stream);
+}
+
+}  // namespace groupby
+}  // namespace cudf
@@ -14,23 +14,43 @@
  * limitations under the License.
  */
 
+#include <groupby/common/utils.hpp>
+
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/memory_estimate.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/structs/detail/flatten.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
 #include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -48,6 +68,35 @@ groupby::groupby(table_view const& keys,
     _column_order{column_order},
     _null_precedence{null_precedence}
 {
+  flatten_keys(0);
+}
+
+groupby::groupby(table_view const& keys, column_view const& key_hashes, null_policy null_handling)
+  : _keys{keys}, _include_null_keys{null_handling}, _key_hashes{key_hashes}
+{
+  CUDF_EXPECTS(key_hashes.size() == keys.num_rows(), "Key hashes must have one row per key row");
+  flatten_keys(0);
+}
+
+void groupby::flatten_keys(cudaStream_t stream)
+{
+  if (std::none_of(_keys.begin(), _keys.end(), [](auto const& col) {
+        return col.type().id() == type_id::STRUCT;
+      })) {
+    return;
+  }
+  _nested_keys    = _keys;
+  _flattened_keys = std::make_unique<structs::detail::flattened_table>(
+    structs::detail::flatten_nested_columns(_keys, _column_order, _null_precedence, stream));
+  _keys            = _flattened_keys->columns;
+  _column_order    = _flattened_keys->column_order;
+  _null_precedence = _flattened_keys->null_precedence;
+}
+
+std::unique_ptr<table> groupby::unflatten_keys(std::unique_ptr<table>&& keys)
+{
+  if (not _flattened_keys) { return std::move(keys); }
+  return structs::detail::unflatten_nested_columns(std::move(keys), _nested_keys);
 }
 
 // Select hash vs. sort groupby implementation
@@ -61,17 +110,122 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::disp
   // all the aggs that can be done by hash groupby are efficiently done by
   // sort groupby as well.
   // Only use hash groupby if the keys aren't sorted and all requests can be
-  // satisfied with a hash implementation
-  if (_keys_are_sorted == sorted::NO and not _helper and
-      detail::hash::can_use_hash_groupby(_keys, requests)) {
-    return detail::hash::groupby(_keys, requests, _include_null_keys, stream, mr);
-  } else {
-    return sort_aggregate(requests, stream, mr);
+  // satisfied with a hash implementation. If only some of them can, the keys
+  // are sorted once and the rest is computed with a hash groupby over the
+  // resulting group labels.
+  if (_keys_are_sorted == sorted::NO and not _helper) {
+    if (detail::hash::can_use_hash_groupby(_keys, requests)) {
+      return detail::hash::groupby(_keys, requests, _include_null_keys, stream, mr, _key_hashes);
+    }
+    auto const has_hash_aggregation = [](aggregation_request const& request) {
+      return std::any_of(
+        request.aggregations.begin(), request.aggregations.end(), [](auto const& agg) {
+          return detail::hash::is_hash_aggregation(agg->kind);
+        });
+    };
+    if (std::any_of(requests.begin(), requests.end(), has_hash_aggregation)) {
+      return hybrid_aggregate(requests, stream, mr);
+    }
+  }
+  return sort_aggregate(requests, stream, mr);
+}
+
+namespace {
+/**
+ * @brief Maps row `i` of a result with `rows_per_group` consecutive rows per
+ * group to its row in the result of group `group_order[i / rows_per_group]`
+ */
+struct group_row {
+  size_type const* group_order;
+  size_type rows_per_group;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return group_order[i / rows_per_group] * rows_per_group + i % rows_per_group;
+  }
+};
+
+/**
+ * @brief Gathers the groups of the result of a hash aggregation in `group_order`
+ *
+ * Aggregations such as APPROX_QUANTILE return several consecutive rows per group.
+ */
+std::unique_ptr<column> gather_groups(column_view const& result,
+                                      rmm::device_vector<size_type> const& group_order,
+                                      cudaStream_t stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  auto const num_groups     = static_cast<size_type>(group_order.size());
+  auto const rows_per_group = num_groups == 0 ? 1 : result.size() / num_groups;
+  auto const rows           = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    group_row{group_order.data().get(), rows_per_group});
+  return std::move(
+    cudf::detail::gather(table_view{{result}}, rows, rows + result.size(), false, mr, stream)
+      ->release()[0]);
+}
+}  // namespace
+
+// Hybrid hash/sort groupby
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::hybrid_aggregate(
+  std::vector<aggregation_request> const& requests,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  std::vector<aggregation_request> hash_requests(requests.size());
+  std::vector<aggregation_request> sort_requests(requests.size());
+  for (size_t i = 0; i < requests.size(); i++) {
+    hash_requests[i].values = requests[i].values;
+    sort_requests[i].values = requests[i].values;
+    for (auto&& agg : requests[i].aggregations) {
+      auto& split = detail::hash::is_hash_aggregation(agg->kind) ? hash_requests : sort_requests;
+      split[i].aggregations.push_back(agg->clone());
+    }
+  }
+
+  auto sort_result = sort_aggregate(sort_requests, stream, mr);
+
+  // Every row is keyed by the label of its group in the sorted keys, which makes
+  // both implementations share one mapping from keys to groups. Rows excluded
+  // for having null keys have null labels.
+  auto const labels = helper().unsorted_keys_labels(stream);
+  auto hash_result  = detail::hash::groupby(table_view{{labels}},
+                                           hash_requests,
+                                           null_policy::EXCLUDE,
+                                           stream,
+                                           rmm::mr::get_default_resource());
+
+  // Order the hash results by label, i.e. in the order of the sorted groups
+  auto const hash_labels = hash_result.first->get_column(0).view();
+  rmm::device_vector<size_type> group_order(hash_labels.size());
+  thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(hash_labels.size()),
+                  hash_labels.begin<size_type>(),
+                  group_order.begin());
+
+  std::vector<aggregation_result> results(requests.size());
+  for (size_t i = 0; i < requests.size(); i++) {
+    std::vector<std::unique_ptr<column>> ordered;
+    for (auto const& col : hash_result.second[i].results) {
+      ordered.push_back(gather_groups(col->view(), group_order, stream, mr));
+    }
+
+    // Interleave both results back into the order of the requested aggregations
+    auto hash_it = ordered.begin();
+    auto sort_it = sort_result.second[i].results.begin();
+    for (auto&& agg : requests[i].aggregations) {
+      auto& result_it = detail::hash::is_hash_aggregation(agg->kind) ? hash_it : sort_it;
+      results[i].results.push_back(std::move(*result_it++));
+    }
   }
+
+  return std::make_pair(std::move(sort_result.first), std::move(results));
 }
 
 // Destructor
-// Needs to be in source file because sort_groupby_helper was forward declared
+// Needs to be in source file because sort_groupby_helper and flattened_table were forward
+// declared
 groupby::~groupby() = default;
 
 namespace {
@@ -89,6 +243,11 @@ auto empty_results(std::vector<aggregation_request> const& requests)
         request.aggregations.end(),
         std::back_inserter(results),
         [&request](auto const& agg) {
+          // The output type of a UDF is given by the aggregation, not by its kind
+          if (agg->kind == aggregation::PTX or agg->kind == aggregation::CUDA) {
+            return make_empty_column(
+              static_cast<cudf::detail::udf_aggregation const&>(*agg)._output_type);
+          }
           return make_empty_column(cudf::detail::target_type(request.values.type(), agg->kind));
         });
 
@@ -118,7 +277,9 @@ void verify_valid_requests(std::vector<aggregation_request> const& requests)
 
 // Compute aggregation requests
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggregate(
-  std::vector<aggregation_request> const& requests, rmm::mr::device_memory_resource* mr)
+  std::vector<aggregation_request> const& requests,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   CUDF_EXPECTS(
@@ -129,27 +290,76 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggr
 
   verify_valid_requests(requests);
 
-  if (_keys.num_rows() == 0) { return std::make_pair(empty_like(_keys), empty_results(requests)); }
+  if (_keys.num_rows() == 0) {
+    return std::make_pair(unflatten_keys(empty_like(_keys)), empty_results(requests));
+  }
+
+  auto result = dispatch_aggregation(requests, stream, mr);
+  return std::make_pair(unflatten_keys(std::move(result.first)), std::move(result.second));
+}
+
+memory_estimate groupby::estimate_memory(std::vector<aggregation_request> const& requests,
+                                         size_type num_groups,
+                                         cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+  if (_keys.num_rows() == 0) { return memory_estimate{}; }
+  if (num_groups < 0) { num_groups = detail::hash::estimate_num_groups(_keys, stream); }
+
+  if (_keys_are_sorted == sorted::NO and not _helper and
+      detail::hash::can_use_hash_groupby(_keys, requests)) {
+    return detail::hash::estimate_memory(_keys, requests, num_groups);
+  }
 
-  return dispatch_aggregation(requests, 0, mr);
+  // The sorted order, the group labels and offsets, and the values of every request in the
+  // sorted order are kept until the aggregations are computed
+  auto const num_rows = static_cast<std::size_t>(_keys.num_rows());
+  memory_estimate estimate;
+  estimate.output_bytes = cudf::detail::estimate_gather_bytes(_keys, num_groups);
+  estimate.scratch_bytes =
+    (num_rows + num_groups + 1) * sizeof(size_type) +
+    (_keys_are_sorted == sorted::YES
+       ? num_rows * sizeof(size_type)
+       : cudf::detail::estimate_sort_memory(_keys, _keys).scratch_bytes);
+  for (auto const& request : requests) {
+    estimate.scratch_bytes += cudf::detail::estimate_gather_bytes(table_view{{request.values}},
+                                                                  num_rows);
+    for (auto const& agg : request.aggregations) {
+      estimate.output_bytes += detail::estimate_result_bytes(request.values, agg->kind, num_groups);
+    }
+  }
+  return estimate;
 }
 
-groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_resource* mr)
+groupby::groups groupby::get_groups(table_view values,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  auto grouped_keys = helper().sorted_keys(mr, 0);
+  auto grouped_keys = unflatten_keys(helper().sorted_keys(mr, stream));
 
-  auto group_offsets = helper().group_offsets(0);
+  auto const& group_offsets = helper().group_offsets(stream);
   std::vector<size_type> group_offsets_vector(group_offsets.size());
-  thrust::copy(group_offsets.begin(), group_offsets.end(), group_offsets_vector.begin());
+  CUDA_TRY(cudaMemcpyAsync(group_offsets_vector.data(),
+                           group_offsets.data().get(),
+                           group_offsets.size() * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
 
   std::unique_ptr<table> grouped_values{nullptr};
   if (values.num_columns()) {
     grouped_values = cudf::detail::gather(values,
-                                          helper().key_sort_order(),
+                                          helper().key_sort_order(stream),
                                           cudf::detail::out_of_bounds_policy::NULLIFY,
                                           cudf::detail::negative_index_policy::NOT_ALLOWED,
-                                          mr);
+                                          mr,
+                                          stream);
     return groupby::groups{
       std::move(grouped_keys), std::move(group_offsets_vector), std::move(grouped_values)};
   } else {
@@ -157,6 +367,243 @@ groupby::groups groupby::get_groups(table_view values, rmm::mr::device_memory_re
   }
 }
 
+namespace {
+/**
+ * @brief Indicates if row `i` of the rows sorted by group label is among the
+ * first `k` rows of its group
+ */
+struct is_within_group_top_k {
+  column_device_view labels;
+  size_type const* sorted_rows;
+  size_type const* group_offsets;
+  size_type k;
+
+  __device__ bool operator()(size_type i) const
+  {
+    auto const row = sorted_rows[i];
+    return labels.is_valid(row) and i - group_offsets[labels.element<size_type>(row)] < k;
+  }
+};
+}  // namespace
+
+std::unique_ptr<column> groupby::top_k(table_view const& order_by,
+                                       size_type k,
+                                       std::vector<order> const& column_order,
+                                       std::vector<null_order> const& null_precedence,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(order_by.num_rows() == _keys.num_rows(),
+               "Mismatch in number of rows for keys and order_by");
+  CUDF_EXPECTS(k >= 0, "k must be non-negative");
+  CUDF_EXPECTS(column_order.empty() or column_order.size() == size_t(order_by.num_columns()),
+               "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(
+    null_precedence.empty() or null_precedence.size() == size_t(order_by.num_columns()),
+    "Mismatch between number of columns and null_precedence size.");
+
+  // Sorting by group label first keeps the groups at the offsets of the sort
+  // helper, with the rows of excluded null keys last
+  auto const labels = helper().unsorted_keys_labels(stream);
+  std::vector<column_view> columns{labels};
+  columns.insert(columns.end(), order_by.begin(), order_by.end());
+  std::vector<order> orders{order::ASCENDING};
+  if (column_order.empty()) {
+    orders.resize(columns.size(), order::ASCENDING);
+  } else {
+    orders.insert(orders.end(), column_order.begin(), column_order.end());
+  }
+  std::vector<null_order> nulls{null_order::AFTER};
+  if (null_precedence.empty()) {
+    nulls.resize(columns.size(), null_order::BEFORE);
+  } else {
+    nulls.insert(nulls.end(), null_precedence.begin(), null_precedence.end());
+  }
+  auto const sorted = cudf::detail::stable_sorted_order(
+    table_view{columns}, orders, nulls, rmm::mr::get_default_resource(), stream);
+
+  auto const d_labels = column_device_view::create(labels, stream);
+  is_within_group_top_k const is_selected{
+    *d_labels, sorted->view().data<size_type>(), helper().group_offsets(stream).data().get(), k};
+  auto const rows = thrust::make_counting_iterator<size_type>(0);
+  auto const num_selected = thrust::count_if(
+    rmm::exec_policy(stream)->on(stream), rows, rows + _keys.num_rows(), is_selected);
+
+  auto result = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_selected, mask_state::UNALLOCATED, stream, mr);
+  thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                  sorted->view().begin<size_type>(),
+                  sorted->view().end<size_type>(),
+                  rows,
+                  result->mutable_view().begin<size_type>(),
+                  is_selected);
+  return result;
+}
+
+namespace {
+/**
+ * @brief Gather map of a grouped shift: the row of the values `offset` rows
+ * before row `i` of the grouped rows, or -1 if that row is not in the group
+ */
+struct group_shift_source {
+  size_type const* sorted_rows;
+  size_type const* group_labels;
+  size_type const* group_offsets;
+  size_type offset;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    auto const label  = group_labels[i];
+    auto const source = static_cast<int64_t>(i) - offset;
+    return (source >= group_offsets[label] and source < group_offsets[label + 1])
+             ? sorted_rows[source]
+             : -1;
+  }
+};
+
+/**
+ * @brief Position of row `i` of the grouped rows if its value is valid, and
+ * `sentinel` otherwise
+ */
+struct grouped_valid_row_or_sentinel {
+  column_device_view values;
+  size_type const* sorted_rows;
+  size_type sentinel;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return values.is_valid(sorted_rows[i]) ? i : sentinel;
+  }
+};
+}  // namespace
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> groupby::shift(
+  column_view const& values,
+  size_type offset,
+  scalar const& fill_value,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(values.size() == _keys.num_rows(),
+               "Size mismatch between request values and groupby keys.");
+  CUDF_EXPECTS(values.type() == fill_value.type(), "Data type mismatch");
+
+  auto const sorted_rows = helper().stable_key_sort_order(stream);
+  auto const num_rows    = sorted_rows.size();
+  auto grouped_keys      = unflatten_keys(
+    cudf::detail::gather(_keys,
+                         sorted_rows,
+                         cudf::detail::out_of_bounds_policy::NULLIFY,
+                         cudf::detail::negative_index_policy::NOT_ALLOWED,
+                         mr,
+                         stream));
+
+  auto gather_map = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream);
+  group_shift_source const source{sorted_rows.data<size_type>(),
+                                  helper().group_labels(stream).data().get(),
+                                  helper().group_offsets(stream).data().get(),
+                                  offset};
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    gather_map->mutable_view().begin<size_type>(),
+                    source);
+
+  // Rows without a source gather a null, which is then filled unless the fill value is null
+  auto shifted =
+    cudf::detail::gather(table_view{{values}},
+                         gather_map->view(),
+                         cudf::detail::out_of_bounds_policy::NULLIFY,
+                         cudf::detail::negative_index_policy::NOT_ALLOWED,
+                         fill_value.is_valid() ? rmm::mr::get_default_resource() : mr,
+                         stream);
+  if (not fill_value.is_valid()) {
+    return std::make_pair(std::move(grouped_keys), std::move(shifted->release()[0]));
+  }
+
+  auto has_source = make_numeric_column(
+    data_type{type_id::BOOL8}, num_rows, mask_state::UNALLOCATED, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    gather_map->view().begin<size_type>(),
+                    gather_map->view().end<size_type>(),
+                    has_source->mutable_view().begin<bool>(),
+                    [] __device__(size_type row) { return row >= 0; });
+  return std::make_pair(std::move(grouped_keys),
+                        cudf::detail::copy_if_else(
+                          shifted->get_column(0), fill_value, has_source->view(), mr, stream));
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> groupby::replace_nulls(
+  column_view const& values,
+  replace_policy const& replace_policy,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(values.size() == _keys.num_rows(),
+               "Size mismatch between request values and groupby keys.");
+
+  auto const sorted_rows = helper().stable_key_sort_order(stream);
+  auto const num_rows    = sorted_rows.size();
+  auto grouped_keys      = unflatten_keys(
+    cudf::detail::gather(_keys,
+                         sorted_rows,
+                         cudf::detail::out_of_bounds_policy::NULLIFY,
+                         cudf::detail::negative_index_policy::NOT_ALLOWED,
+                         mr,
+                         stream));
+
+  // A scan by group label finds the nearest valid row in the group of every
+  // row, as in cudf::replace_nulls; rows left at the sentinel stay null
+  auto gather_map = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream);
+  auto map            = gather_map->mutable_view().begin<size_type>();
+  auto const d_values = column_device_view::create(values, stream);
+  auto const labels   = helper().group_labels(stream).data().get();
+  auto const rows     = thrust::make_counting_iterator<size_type>(0);
+  if (replace_policy == cudf::replace_policy::PRECEDING) {
+    auto const valid_rows = thrust::make_transform_iterator(
+      rows, grouped_valid_row_or_sentinel{*d_values, sorted_rows.data<size_type>(), -1});
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                  labels,
+                                  labels + num_rows,
+                                  valid_rows,
+                                  map,
+                                  thrust::equal_to<size_type>{},
+                                  thrust::maximum<size_type>{});
+  } else {
+    auto const valid_rows = thrust::make_transform_iterator(
+      rows, grouped_valid_row_or_sentinel{*d_values, sorted_rows.data<size_type>(), num_rows});
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                  thrust::make_reverse_iterator(labels + num_rows),
+                                  thrust::make_reverse_iterator(labels),
+                                  thrust::make_reverse_iterator(valid_rows + num_rows),
+                                  thrust::make_reverse_iterator(map + num_rows),
+                                  thrust::equal_to<size_type>{},
+                                  thrust::minimum<size_type>{});
+  }
+  // Map the positions in the grouped rows to rows of the values
+  auto const d_sorted_rows = sorted_rows.data<size_type>();
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    map,
+                    map + num_rows,
+                    map,
+                    [d_sorted_rows, num_rows] __device__(size_type i) {
+                      return (i < 0 or i >= num_rows) ? -1 : d_sorted_rows[i];
+                    });
+
+  auto replaced = cudf::detail::gather(table_view{{values}},
+                                       gather_map->view(),
+                                       cudf::detail::out_of_bounds_policy::NULLIFY,
+                                       cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                       mr,
+                                       stream);
+  return std::make_pair(std::move(grouped_keys), std::move(replaced->release()[0]));
+}
+
 // Get the sort helper object
 detail::sort::sort_groupby_helper& groupby::helper()
 {
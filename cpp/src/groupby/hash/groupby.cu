@@ -24,13 +24,20 @@
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/aggregation/result_cache.hpp>
+#include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/quantiles.hpp>
 #include <cudf/detail/replace.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/memory_estimate.hpp>
+#include <cudf/dictionary/detail/indices.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/partitioning.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
@@ -40,7 +47,18 @@
 #include <cudf/utilities/traits.hpp>
 #include <hash/concurrent_unordered_map.cuh>
 
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/reduce.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <numeric>
+#include <type_traits>
 #include <utility>
 
 namespace cudf {
@@ -52,10 +70,10 @@ namespace {
 // constexpr once cuda 10.2 becomes RAPIDS's minimum compiler version
 #if 0
 /**
- * @brief List of aggregation operations that can be computed with a hash-based
- * implementation.
+ * @brief List of aggregation operations that can be computed in a single pass
+ * with a hash-based implementation.
  */
-constexpr std::array<aggregation::Kind, 7> hash_aggregations{
+constexpr std::array<aggregation::Kind, 7> single_pass_hash_aggregations{
     aggregation::SUM, aggregation::MIN, aggregation::MAX,
     aggregation::COUNT_VALID, aggregation::COUNT_ALL,
     aggregation::ARGMIN, aggregation::ARGMAX};
@@ -70,18 +88,18 @@ constexpr bool array_contains(std::array<T, N> const& haystack, T needle) {
 #endif
 
 /**
- * @brief Indicates whether the specified aggregation operation can be computed
- * with a hash-based implementation.
+ * @brief Indicates whether the specified aggregation operation is computed by
+ * the single pass aggregation kernels of the hash-based implementation.
  *
  * @param t The aggregation operation to verify
- * @return true `t` is valid for a hash based groupby
- * @return false `t` is invalid for a hash based groupby
+ * @return true `t` is computed in a single pass over the hash map
+ * @return false `t` is not computed in a single pass over the hash map
  */
-bool constexpr is_hash_aggregation(aggregation::Kind t)
+bool constexpr is_single_pass_aggregation(aggregation::Kind t)
 {
   // this is a temporary fix due to compiler bug and we can resort back to
   // constexpr once cuda 10.2 becomes RAPIDS's minimum compiler version
-  // return array_contains(hash_aggregations, t);
+  // return array_contains(single_pass_hash_aggregations, t);
   return (t == aggregation::SUM) or (t == aggregation::MIN) or (t == aggregation::MAX) or
          (t == aggregation::COUNT_VALID) or (t == aggregation::COUNT_ALL) or
          (t == aggregation::ARGMIN) or (t == aggregation::ARGMAX);
@@ -106,7 +124,7 @@ flatten_single_pass_aggs(std::vector<aggregation_request> const& requests)
     };
 
     for (auto&& agg : agg_v) {
-      if (is_hash_aggregation(agg->kind)) {
+      if (is_single_pass_aggregation(agg->kind)) {
         if (is_fixed_width(request.values.type()) or agg->kind == aggregation::COUNT_VALID or
             agg->kind == aggregation::COUNT_ALL) {
           insert_agg(agg->kind);
@@ -199,9 +217,12 @@ void sparse_to_dense_results(std::vector<aggregation_request> const& requests,
 /**
  * @brief Construct hash map that uses row comparator and row hasher on
  * `d_keys` table and stores indices
+ *
+ * The rows are hashed unless their precomputed `key_hashes` are given.
  */
 template <bool keys_have_nulls>
 auto create_hash_map(table_device_view const& d_keys,
+                     column_view const& key_hashes,
                      null_policy include_null_keys,
                      cudaStream_t stream = 0)
 {
@@ -210,14 +231,14 @@ auto create_hash_map(table_device_view const& d_keys,
 
   using map_type = concurrent_unordered_map<size_type,
                                             size_type,
-                                            row_hasher<default_hash, keys_have_nulls>,
+                                            precomputed_row_hasher<default_hash, keys_have_nulls>,
                                             row_equality_comparator<keys_have_nulls>>;
 
   using allocator_type = typename map_type::allocator_type;
 
   bool const null_keys_are_equal{include_null_keys == null_policy::INCLUDE};
 
-  row_hasher<default_hash, keys_have_nulls> hasher{d_keys};
+  precomputed_row_hasher<default_hash, keys_have_nulls> hasher{d_keys, key_hashes};
   row_equality_comparator<keys_have_nulls> rows_equal{d_keys, d_keys, null_keys_are_equal};
 
   return map_type::create(compute_hash_table_size(d_keys.num_rows()),
@@ -229,6 +250,30 @@ auto create_hash_map(table_device_view const& d_keys,
                           stream);
 }
 
+constexpr int BLOCK_LOCAL_BLOCK_SIZE{256};
+
+/**
+ * @brief Returns the number of blocks to launch `kernel` with, at most as many
+ * as can be resident on the device at once
+ *
+ * Every block of `compute_block_local_aggs` needs its own rows of partial
+ * results, so the grid is capped at one wave and the blocks stride over the rows.
+ */
+template <typename Kernel>
+size_type block_local_grid_size(Kernel kernel, size_type num_rows)
+{
+  int device{0};
+  int num_sms{0};
+  int blocks_per_sm{0};
+  CUDA_TRY(cudaGetDevice(&device));
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device));
+  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &blocks_per_sm, kernel, BLOCK_LOCAL_BLOCK_SIZE, 0));
+  auto const max_blocks = std::max(1, num_sms * blocks_per_sm);
+  return std::max(
+    1, std::min(util::div_rounding_up_safe(num_rows, BLOCK_LOCAL_BLOCK_SIZE), max_blocks));
+}
+
 /**
  * @brief Computes all aggregations from `requests` that require a single pass
  * over the data and stores the results in `sparse_results`
@@ -237,10 +282,12 @@ auto create_hash_map(table_device_view const& d_keys,
  */
 template <bool keys_have_nulls, typename Map>
 void compute_single_pass_aggs(table_view const& keys,
+                              column_view const& key_hashes,
                               std::vector<aggregation_request> const& requests,
                               cudf::detail::result_cache* sparse_results,
                               Map& map,
                               null_policy include_null_keys,
+                              bool use_block_local_aggs,
                               cudaStream_t stream)
 {
   // flatten the aggs to a table that can be operated on by aggregate_row
@@ -251,24 +298,29 @@ void compute_single_pass_aggs(table_view const& keys,
 
   // make table that will hold sparse results
   std::vector<std::unique_ptr<column>> sparse_columns;
-  std::transform(flattened_values.begin(),
-                 flattened_values.end(),
-                 aggs.begin(),
-                 std::back_inserter(sparse_columns),
-                 [stream](auto const& col, auto const& agg) {
-                   bool nullable =
-                     (agg == aggregation::COUNT_VALID or agg == aggregation::COUNT_ALL)
-                       ? false
-                       : col.has_nulls();
-                   auto mask_flag = (nullable) ? mask_state::ALL_NULL : mask_state::UNALLOCATED;
-
-                   return make_fixed_width_column(
-                     cudf::detail::target_type(col.type(), agg), col.size(), mask_flag, stream);
-                 });
-
-  table sparse_table(std::move(sparse_columns));
-  mutable_table_view table_view = sparse_table.mutable_view();
-  cudf::detail::initialize_with_identity(table_view, aggs, stream);
+  auto make_result_table = [&](size_type num_rows) {
+    std::vector<std::unique_ptr<column>> columns;
+    std::transform(flattened_values.begin(),
+                   flattened_values.end(),
+                   aggs.begin(),
+                   std::back_inserter(columns),
+                   [num_rows, stream](auto const& col, auto const& agg) {
+                     bool nullable =
+                       (agg == aggregation::COUNT_VALID or agg == aggregation::COUNT_ALL)
+                         ? false
+                         : col.has_nulls();
+                     auto mask_flag = (nullable) ? mask_state::ALL_NULL : mask_state::UNALLOCATED;
+
+                     return make_fixed_width_column(
+                       cudf::detail::target_type(col.type(), agg), num_rows, mask_flag, stream);
+                   });
+
+    table result_table(std::move(columns));
+    mutable_table_view table_view = result_table.mutable_view();
+    cudf::detail::initialize_with_identity(table_view, aggs, stream);
+    return result_table;
+  };
+  table sparse_table = make_result_table(flattened_values.num_rows());
 
   // prepare to launch kernel to do the actual aggregation
   auto d_sparse_table = mutable_table_device_view::create(sparse_table);
@@ -277,7 +329,40 @@ void compute_single_pass_aggs(table_view const& keys,
 
   bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
 
-  if (skip_key_rows_with_nulls) {
+  if (use_block_local_aggs) {
+    auto row_bitmask =
+      skip_key_rows_with_nulls
+        ? bitmask_and(keys, rmm::mr::get_default_resource(), stream)
+        : rmm::device_buffer{};
+    auto d_keys = table_device_view::create(keys, stream);
+    precomputed_row_hasher<default_hash, keys_have_nulls> hasher{*d_keys, key_hashes};
+    row_equality_comparator<keys_have_nulls> rows_equal{
+      *d_keys, *d_keys, include_null_keys == null_policy::INCLUDE};
+
+    using Hasher      = decltype(hasher);
+    using KeyEqual    = decltype(rows_equal);
+    auto const kernel = skip_key_rows_with_nulls
+                          ? hash::compute_block_local_aggs<true, Map, Hasher, KeyEqual>
+                          : hash::compute_block_local_aggs<false, Map, Hasher, KeyEqual>;
+    auto const grid = block_local_grid_size(kernel, keys.num_rows());
+
+    // Each block aggregates into its own `BLOCK_LOCAL_MAP_SLOTS` rows of partial results
+    table partial_table    = make_result_table(grid * hash::BLOCK_LOCAL_MAP_SLOTS);
+    auto d_partial_table   = mutable_table_device_view::create(partial_table, stream);
+    auto d_partial_results = table_device_view::create(partial_table.view(), stream);
+    kernel<<<grid, BLOCK_LOCAL_BLOCK_SIZE, 0, stream>>>(
+      map,
+      hasher,
+      rows_equal,
+      keys.num_rows(),
+      *d_values,
+      *d_partial_table,
+      *d_partial_results,
+      *d_sparse_table,
+      d_aggs.data().get(),
+      static_cast<bitmask_type const*>(row_bitmask.data()));
+    CHECK_CUDA(stream);
+  } else if (skip_key_rows_with_nulls) {
     auto row_bitmask{bitmask_and(keys, rmm::mr::get_default_resource(), stream)};
     thrust::for_each_n(
       rmm::exec_policy(stream)->on(stream),
@@ -336,6 +421,147 @@ std::pair<rmm::device_vector<size_type>, size_type> extract_populated_keys(Map m
   return std::make_pair(std::move(populated_keys), map_size);
 }
 
+/**
+ * @brief Counts the distinct values of each group of `labels` in `values`
+ * into `counts`, using a hash set of (label, value) pairs
+ *
+ * @tparam nullable Indicates if `values` contains nulls
+ */
+template <bool nullable>
+void count_distinct_values(column_view const& labels,
+                           column_view const& values,
+                           bool skip_null_values,
+                           mutable_column_view counts,
+                           cudaStream_t stream)
+{
+  auto d_pairs  = table_device_view::create(table_view{{labels, values}}, stream);
+  auto d_values = column_device_view::create(values, stream);
+  // Null values are equal to each other, so that an included null is counted once per group
+  auto set = create_hash_map<nullable>(*d_pairs, {}, null_policy::INCLUDE, stream);
+
+  using set_type = std::remove_reference_t<decltype(*set)>;
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator(0),
+                     values.size(),
+                     hash::compute_nunique<set_type>{*set,
+                                                     labels.data<size_type>(),
+                                                     *d_values,
+                                                     skip_null_values,
+                                                     counts.data<size_type>()});
+}
+
+/**
+ * @brief Computes the NUNIQUE, APPROX_COUNT_DISTINCT and APPROX_QUANTILE
+ * aggregations in `requests` and stores their dense results in `dense_results`
+ *
+ * Every row is labelled with the dense index of its group by looking up its key
+ * in `map`. The distinct values of each NUNIQUE request are then counted in a
+ * single pass over a hash set of (label, value) pairs, while
+ * APPROX_COUNT_DISTINCT builds one HyperLogLog sketch per label and
+ * APPROX_QUANTILE one t-digest per label.
+ *
+ * @see groupby_null_templated()
+ */
+template <bool keys_have_nulls, typename Map>
+void compute_labelled_aggs(table_view const& keys,
+                                 std::vector<aggregation_request> const& requests,
+                                 cudf::detail::result_cache* dense_results,
+                                 Map const& map,
+                                 rmm::device_vector<size_type> const& gather_map,
+                                 size_type map_size,
+                                 null_policy include_null_keys,
+                                 cudaStream_t stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  auto const is_labelled = [](aggregation::Kind k) {
+    return k == aggregation::NUNIQUE or k == aggregation::APPROX_COUNT_DISTINCT or
+           k == aggregation::APPROX_QUANTILE;
+  };
+  auto const has_labelled = [is_labelled](aggregation_request const& request) {
+    return std::any_of(
+      request.aggregations.begin(), request.aggregations.end(), [&](auto const& agg) {
+        return is_labelled(agg->kind);
+      });
+  };
+  if (std::none_of(requests.begin(), requests.end(), has_labelled)) { return; }
+
+  // The sparse index of a group is the row index its key was inserted with
+  rmm::device_vector<size_type> sparse_to_dense(keys.num_rows());
+  thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(map_size),
+                  gather_map.begin(),
+                  sparse_to_dense.begin());
+
+  rmm::device_vector<size_type> labels(keys.num_rows());
+  if (keys_have_nulls and include_null_keys == null_policy::EXCLUDE) {
+    auto row_bitmask{bitmask_and(keys, rmm::mr::get_default_resource(), stream)};
+    thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                     labels.begin(),
+                     labels.end(),
+                     hash::compute_group_labels<true, Map>{
+                       map,
+                       sparse_to_dense.data().get(),
+                       static_cast<bitmask_type const*>(row_bitmask.data())});
+  } else {
+    thrust::tabulate(
+      rmm::exec_policy(stream)->on(stream),
+      labels.begin(),
+      labels.end(),
+      hash::compute_group_labels<false, Map>{map, sparse_to_dense.data().get(), nullptr});
+  }
+  column_view labels_view(data_type(type_to_id<size_type>()), keys.num_rows(), labels.data().get());
+
+  for (size_t i = 0; i < requests.size(); i++) {
+    auto const& values = requests[i].values;
+    for (auto&& agg : requests[i].aggregations) {
+      if (not is_labelled(agg->kind) or dense_results->has_result(i, *agg)) { continue; }
+      if (agg->kind == aggregation::APPROX_COUNT_DISTINCT) {
+        auto const& approx_agg =
+          static_cast<cudf::detail::approx_count_distinct_aggregation const&>(*agg);
+        dense_results->add_result(
+          i,
+          *agg,
+          cudf::detail::approx_count_distinct(
+            values, labels_view, map_size, approx_agg._precision, mr, stream));
+        continue;
+      }
+      if (agg->kind == aggregation::APPROX_QUANTILE) {
+        auto const& quantile_agg =
+          static_cast<cudf::detail::approx_quantile_aggregation const&>(*agg);
+        auto const digest = cudf::detail::tdigest(values,
+                                                  labels_view,
+                                                  map_size,
+                                                  quantile_agg._compression,
+                                                  rmm::mr::get_default_resource(),
+                                                  stream);
+        dense_results->add_result(
+          i,
+          *agg,
+          cudf::detail::tdigest_quantiles(
+            digest->view(), map_size, quantile_agg._quantiles, mr, stream));
+        continue;
+      }
+      auto const& nunique_agg = static_cast<cudf::detail::nunique_aggregation const&>(*agg);
+      bool const skip_null_values = nunique_agg._null_handling == null_policy::EXCLUDE;
+
+      auto counts = make_numeric_column(
+        data_type(type_to_id<size_type>()), map_size, mask_state::UNALLOCATED, stream, mr);
+      auto counts_view = counts->mutable_view();
+      thrust::fill(rmm::exec_policy(stream)->on(stream),
+                   counts_view.begin<size_type>(),
+                   counts_view.end<size_type>(),
+                   0);
+      if (values.has_nulls()) {
+        count_distinct_values<true>(labels_view, values, skip_null_values, counts_view, stream);
+      } else {
+        count_distinct_values<false>(labels_view, values, skip_null_values, counts_view, stream);
+      }
+      dense_results->add_result(i, *agg, std::move(counts));
+    }
+  }
+}
+
 /**
  * @brief Computes groupby using hash table.
  *
@@ -365,25 +591,30 @@ std::pair<rmm::device_vector<size_type>, size_type> extract_populated_keys(Map m
  */
 template <bool keys_have_nulls>
 std::unique_ptr<table> groupby_null_templated(table_view const& keys,
+                                              column_view const& key_hashes,
                                               std::vector<aggregation_request> const& requests,
                                               cudf::detail::result_cache* cache,
                                               null_policy include_null_keys,
+                                              bool use_block_local_aggs,
                                               cudaStream_t stream,
                                               rmm::mr::device_memory_resource* mr)
 {
   auto d_keys = table_device_view::create(keys);
-  auto map    = create_hash_map<keys_have_nulls>(*d_keys, include_null_keys, stream);
+  auto map    = create_hash_map<keys_have_nulls>(*d_keys, key_hashes, include_null_keys, stream);
 
   // Cache of sparse results where the location of aggregate value in each
   // column is indexed by the hash map
   cudf::detail::result_cache sparse_results(requests.size());
 
   // Compute all single pass aggs first
-  compute_single_pass_aggs<keys_have_nulls>(
-    keys, requests, &sparse_results, *map, include_null_keys, stream);
-
-  // Now continue with remaining multi-pass aggs
-  // <placeholder>
+  compute_single_pass_aggs<keys_have_nulls>(keys,
+                                            key_hashes,
+                                            requests,
+                                            &sparse_results,
+                                            *map,
+                                            include_null_keys,
+                                            use_block_local_aggs,
+                                            stream);
 
   // Extract the populated indices from the hash map and create a gather map.
   // Gathering using this map from sparse results will give dense results.
@@ -394,12 +625,323 @@ std::unique_ptr<table> groupby_null_templated(table_view const& keys,
   // Compact all results from sparse_results and insert into cache
   sparse_to_dense_results(requests, sparse_results, cache, gather_map, map_size, stream, mr);
 
+  // Now continue with remaining multi-pass aggs, which are computed dense
+  compute_labelled_aggs<keys_have_nulls>(
+    keys, requests, cache, *map, gather_map, map_size, include_null_keys, stream, mr);
+
   return cudf::detail::gather(
     keys, gather_map.begin(), gather_map.begin() + map_size, false, mr, stream);
 }
 
+/**
+ * @brief Number of rows sampled by `estimate_num_groups`
+ */
+constexpr size_type CARDINALITY_SAMPLE_SIZE{1 << 14};
+
+/**
+ * @brief Largest estimated number of groups for which rows are pre-aggregated
+ * in block-local hash tables
+ */
+constexpr size_type BLOCK_LOCAL_MAX_GROUPS{hash::BLOCK_LOCAL_MAP_SLOTS / 4};
+
+/**
+ * @brief Smallest number of L2-sized partitions worth the copy made by
+ * partitioning the input of a groupby
+ */
+constexpr size_type MIN_GROUPBY_PARTITIONS{8};
+constexpr size_type MAX_GROUPBY_PARTITIONS{1024};
+
+/**
+ * @brief Estimates the number of unique rows in `keys` from an evenly strided
+ * sample of its rows
+ *
+ * Uses the Guaranteed-Error Estimator on the row hashes of the sample: keys
+ * seen once in the sample are scaled up by `sqrt(num_rows / sample_size)`,
+ * while keys seen more than once are assumed to all have been found.
+ */
+template <bool keys_have_nulls>
+size_type estimate_num_groups(table_view const& keys, cudaStream_t stream)
+{
+  auto const num_rows    = keys.num_rows();
+  auto const sample_size = std::min(num_rows, CARDINALITY_SAMPLE_SIZE);
+  if (sample_size == 0) { return 0; }
+  auto const stride = num_rows / sample_size;
+
+  // 64-bit hashes keep distinct sampled keys from colliding
+  using hasher_type      = row_hasher<XXHash_64, keys_have_nulls>;
+  using sample_hash_type = typename hasher_type::result_type;
+  auto d_keys            = table_device_view::create(keys, stream);
+  rmm::device_vector<sample_hash_type> hashes(sample_size);
+  thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                   hashes.begin(),
+                   hashes.end(),
+                   [hasher = hasher_type{*d_keys}, stride] __device__(size_type i) {
+                     return hasher(i * stride);
+                   });
+  thrust::sort(rmm::exec_policy(stream)->on(stream), hashes.begin(), hashes.end());
+
+  rmm::device_vector<sample_hash_type> unique_hashes(sample_size);
+  rmm::device_vector<size_type> counts(sample_size);
+  auto const num_unique = thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
+                                                hashes.begin(),
+                                                hashes.end(),
+                                                thrust::make_constant_iterator<size_type>(1),
+                                                unique_hashes.begin(),
+                                                counts.begin())
+                            .first -
+                          unique_hashes.begin();
+  auto const num_singletons = thrust::count(
+    rmm::exec_policy(stream)->on(stream), counts.begin(), counts.begin() + num_unique, 1);
+
+  double const scale = std::sqrt(static_cast<double>(num_rows) / sample_size);
+  double const estimate = scale * num_singletons + (num_unique - num_singletons);
+  return static_cast<size_type>(std::min(estimate, static_cast<double>(num_rows)));
+}
+
+/**
+ * @brief Indicates whether the partial results of every single pass
+ * aggregation in `requests` can be merged by `compute_block_local_aggs`
+ */
+bool can_use_block_local_aggs(std::vector<aggregation_request> const& requests)
+{
+  table_view flattened_values;
+  std::vector<aggregation::Kind> aggs;
+  std::vector<size_t> col_ids;
+  std::tie(flattened_values, aggs, col_ids) = flatten_single_pass_aggs(requests);
+
+  for (size_t i = 0; i < aggs.size(); i++) {
+    auto const k = aggs[i];
+    if (k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) { continue; }
+    if (k != aggregation::SUM and k != aggregation::MIN and k != aggregation::MAX) {
+      return false;
+    }
+    auto const partial_type = cudf::detail::target_type(flattened_values.column(i).type(), k);
+    if (not cudf::detail::is_valid_aggregation(partial_type, k) or
+        not(cudf::detail::target_type(partial_type, k) == partial_type)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the number of partitions that keeps the hash map and results
+ * of each partition within the L2 cache, or 1 if the whole groupby is small
+ * enough that partitioning the input does not pay off
+ *
+ * @param requests The set of columns to aggregate and the aggregations to perform
+ * @param num_groups The estimated number of groups
+ */
+size_type groupby_partition_count(std::vector<aggregation_request> const& requests,
+                                  size_type num_groups)
+{
+  int device{0};
+  int l2_cache_size{0};
+  CUDA_TRY(cudaGetDevice(&device));
+  CUDA_TRY(cudaDeviceGetAttribute(&l2_cache_size, cudaDevAttrL2CacheSize, device));
+  if (l2_cache_size <= 0) { return 1; }
+
+  table_view flattened_values;
+  std::vector<aggregation::Kind> aggs;
+  std::vector<size_t> col_ids;
+  std::tie(flattened_values, aggs, col_ids) = flatten_single_pass_aggs(requests);
+
+  // Each group occupies two hash map slots at the default occupancy
+  size_t bytes_per_group = 2 * sizeof(thrust::pair<size_type, size_type>);
+  for (size_t i = 0; i < aggs.size(); i++) {
+    auto const result_type = cudf::detail::target_type(flattened_values.column(i).type(), aggs[i]);
+    bytes_per_group += size_of(result_type);
+  }
+
+  auto const bytes = static_cast<size_t>(num_groups) * bytes_per_group;
+  size_type num_partitions{1};
+  while (num_partitions < MAX_GROUPBY_PARTITIONS &&
+         bytes > static_cast<size_t>(num_partitions) * l2_cache_size) {
+    num_partitions *= 2;
+  }
+  return num_partitions >= MIN_GROUPBY_PARTITIONS ? num_partitions : 1;
+}
+
+/**
+ * @brief Replaces the valid row indices in `indices`, which index rows of one
+ * partition, with the rows of the unpartitioned input they came from
+ */
+void map_to_input_rows(mutable_column_view indices,
+                       column_view const& row_indices,
+                       cudaStream_t stream)
+{
+  auto d_indices = column_device_view::create(indices, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(indices.size()),
+                    indices.begin<size_type>(),
+                    [d_indices = *d_indices, rows = row_indices.data<size_type>()] __device__(
+                      size_type i) {
+                      auto const index = d_indices.element<size_type>(i);
+                      return d_indices.is_valid(i) ? rows[index] : index;
+                    });
+}
+
+/**
+ * @brief Computes groupby by hash partitioning the keys and values and
+ * aggregating each partition independently.
+ *
+ * All rows of a group land in the same partition, so the results of the
+ * partitions are concatenated without a merge step. Each partition builds a
+ * hash map of its own rows only, which keeps the working set of high
+ * cardinality groupbys cache sized. ARGMIN and ARGMAX results are mapped from
+ * partition rows back to rows of the input through a partitioned row index
+ * column.
+ */
+template <bool keys_have_nulls>
+std::unique_ptr<table> partitioned_groupby(table_view const& keys,
+                                           column_view const& key_hashes,
+                                           std::vector<aggregation_request> const& requests,
+                                           cudf::detail::result_cache* cache,
+                                           null_policy include_null_keys,
+                                           size_type num_partitions,
+                                           cudaStream_t stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  auto const num_keys = keys.num_columns();
+  auto row_indices    = make_numeric_column(
+    data_type(type_to_id<size_type>()), keys.num_rows(), mask_state::UNALLOCATED, stream);
+  auto row_indices_view = row_indices->mutable_view();
+  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                   row_indices_view.begin<size_type>(),
+                   row_indices_view.end<size_type>(),
+                   0);
+
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  std::transform(requests.begin(),
+                 requests.end(),
+                 std::back_inserter(columns),
+                 [](auto const& request) { return request.values; });
+  columns.push_back(row_indices->view());
+  // The precomputed hashes of the keys follow their rows into the partitions
+  bool const has_key_hashes = key_hashes.size() != 0;
+  if (has_key_hashes) { columns.push_back(key_hashes); }
+
+  std::vector<size_type> key_columns(num_keys);
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+  // Rows are partitioned with a hash independent of the hash map's, or the rows
+  // of a partition would only reach the slots of the map congruent to it. The
+  // map remixes precomputed hashes, so those can be partitioned on directly.
+  auto partitioned =
+    has_key_hashes
+      ? cudf::hash_partition(table_view{columns}, key_hashes, num_partitions)
+      : cudf::hash_partition(
+          table_view{columns}, key_columns, num_partitions, hash_id::HASH_XXHASH64);
+  auto& offsets    = partitioned.second;
+  offsets.push_back(keys.num_rows());
+
+  std::vector<std::unique_ptr<table>> partition_keys;
+  std::vector<std::vector<std::unique_ptr<column>>> partition_results(requests.size());
+  for (size_type p = 0; p < num_partitions; ++p) {
+    if (offsets[p] == offsets[p + 1]) { continue; }
+    auto const part = cudf::slice(partitioned.first->view(), {offsets[p], offsets[p + 1]}).front();
+
+    std::vector<aggregation_request> part_requests(requests.size());
+    for (size_t i = 0; i < requests.size(); i++) {
+      part_requests[i].values = part.column(num_keys + i);
+      for (auto&& agg : requests[i].aggregations) {
+        part_requests[i].aggregations.push_back(agg->clone());
+      }
+    }
+
+    cudf::detail::result_cache part_cache(requests.size());
+    auto const part_key_hashes =
+      has_key_hashes ? part.column(num_keys + requests.size() + 1) : column_view{};
+    partition_keys.push_back(groupby_null_templated<keys_have_nulls>(part.select(key_columns),
+                                                                     part_key_hashes,
+                                                                     part_requests,
+                                                                     &part_cache,
+                                                                     include_null_keys,
+                                                                     false,
+                                                                     stream,
+                                                                     mr));
+
+    auto const part_row_indices = part.column(num_keys + requests.size());
+    for (size_t i = 0; i < requests.size(); i++) {
+      for (auto&& agg : part_requests[i].aggregations) {
+        auto result = part_cache.release_result(i, *agg);
+        if (agg->kind == aggregation::ARGMIN or agg->kind == aggregation::ARGMAX) {
+          map_to_input_rows(result->mutable_view(), part_row_indices, stream);
+        }
+        partition_results[i].push_back(std::move(result));
+      }
+    }
+  }
+
+  // Results of the partitions are stored per request as [partition][aggregation]
+  for (size_t i = 0; i < requests.size(); i++) {
+    auto const num_aggs = requests[i].aggregations.size();
+    for (size_t a = 0; a < num_aggs; a++) {
+      std::vector<column_view> parts;
+      for (size_t p = a; p < partition_results[i].size(); p += num_aggs) {
+        parts.push_back(partition_results[i][p]->view());
+      }
+      cache->add_result(
+        i, *requests[i].aggregations[a], cudf::detail::concatenate(parts, mr, stream));
+    }
+  }
+
+  std::vector<table_view> key_views;
+  std::transform(partition_keys.begin(),
+                 partition_keys.end(),
+                 std::back_inserter(key_views),
+                 [](auto const& t) { return t->view(); });
+  return cudf::detail::concatenate(key_views, mr, stream);
+}
+
+/**
+ * @brief Computes groupby with the hash-based strategy suited to the estimated
+ * number of groups in `keys`.
+ *
+ * - Few groups: rows are pre-aggregated per thread block, which removes the
+ *   atomic contention of hot keys on the global results.
+ * - Groups whose hash map and results exceed the L2 cache several times over:
+ *   the input is hash partitioned and each partition is aggregated on its own.
+ * - Otherwise all rows are aggregated into one global hash map.
+ */
+template <bool keys_have_nulls>
+std::unique_ptr<table> hash_groupby(table_view const& keys,
+                                    column_view const& key_hashes,
+                                    std::vector<aggregation_request> const& requests,
+                                    cudf::detail::result_cache* cache,
+                                    null_policy include_null_keys,
+                                    cudaStream_t stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  auto const num_groups     = estimate_num_groups<keys_have_nulls>(keys, stream);
+  auto const num_partitions = groupby_partition_count(requests, num_groups);
+  if (num_partitions > 1) {
+    return partitioned_groupby<keys_have_nulls>(
+      keys, key_hashes, requests, cache, include_null_keys, num_partitions, stream, mr);
+  }
+
+  bool const use_block_local_aggs =
+    num_groups <= BLOCK_LOCAL_MAX_GROUPS and can_use_block_local_aggs(requests);
+  return groupby_null_templated<keys_have_nulls>(
+    keys, key_hashes, requests, cache, include_null_keys, use_block_local_aggs, stream, mr);
+}
+
 }  // namespace
 
+/**
+ * @brief Indicates whether the specified aggregation operation can be computed
+ * with a hash-based implementation.
+ *
+ * @param t The aggregation operation to verify
+ * @return true `t` is valid for a hash based groupby
+ * @return false `t` is invalid for a hash based groupby
+ */
+bool is_hash_aggregation(aggregation::Kind t)
+{
+  return is_single_pass_aggregation(t) or (t == aggregation::NUNIQUE) or
+         (t == aggregation::APPROX_COUNT_DISTINCT) or (t == aggregation::APPROX_QUANTILE);
+}
+
 /**
  * @brief Indicates if a set of aggregation requests can be satisfied with a
  * hash-based groupby implementation.
@@ -425,20 +967,80 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   std::vector<aggregation_request> const& requests,
   null_policy include_null_keys,
   cudaStream_t stream,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  column_view const& key_hashes)
 {
+  CUDF_EXPECTS(key_hashes.size() == 0 or key_hashes.size() == keys.num_rows(),
+               "Key hashes must have one row per key row");
+
   cudf::detail::result_cache cache(requests.size());
 
+  // Dictionary keys are grouped by their indices; only the unique keys get their keys back
+  auto const indices_keys = cudf::dictionary::detail::get_indices_annotated(keys);
+
   std::unique_ptr<table> unique_keys;
-  if (has_nulls(keys)) {
-    unique_keys =
-      groupby_null_templated<true>(keys, requests, &cache, include_null_keys, stream, mr);
+  if (has_nulls(indices_keys)) {
+    unique_keys = hash_groupby<true>(
+      indices_keys, key_hashes, requests, &cache, include_null_keys, stream, mr);
   } else {
-    unique_keys =
-      groupby_null_templated<false>(keys, requests, &cache, include_null_keys, stream, mr);
+    unique_keys = hash_groupby<false>(
+      indices_keys, key_hashes, requests, &cache, include_null_keys, stream, mr);
   }
 
-  return std::make_pair(std::move(unique_keys), extract_results(requests, cache));
+  return std::make_pair(
+    cudf::dictionary::detail::restore_dictionaries(std::move(unique_keys), keys, mr, stream),
+    extract_results(requests, cache));
+}
+
+size_type estimate_num_groups(table_view const& keys, cudaStream_t stream)
+{
+  auto const indices_keys = cudf::dictionary::detail::get_indices_annotated(keys);
+  return has_nulls(indices_keys) ? estimate_num_groups<true>(indices_keys, stream)
+                                 : estimate_num_groups<false>(indices_keys, stream);
+}
+
+memory_estimate estimate_memory(table_view const& keys,
+                                std::vector<aggregation_request> const& requests,
+                                size_type num_groups)
+{
+  memory_estimate estimate;
+  estimate.output_bytes = cudf::detail::estimate_gather_bytes(keys, num_groups);
+  for (auto const& request : requests) {
+    for (auto const& agg : request.aggregations) {
+      estimate.output_bytes += estimate_result_bytes(request.values, agg->kind, num_groups);
+    }
+  }
+
+  // The single pass aggregations write sparse results indexed like the rows of the keys
+  table_view flattened_values;
+  std::vector<aggregation::Kind> aggs;
+  std::vector<size_t> col_ids;
+  std::tie(flattened_values, aggs, col_ids) = flatten_single_pass_aggs(requests);
+  auto const num_rows        = keys.num_rows();
+  auto const aggregate_bytes = [&](size_type part_rows) {
+    // The hash map, the gather map of its populated slots and the sparse results
+    auto bytes = compute_hash_table_size(part_rows) * sizeof(thrust::pair<size_type, size_type>);
+    bytes += static_cast<std::size_t>(part_rows) * sizeof(size_type);
+    for (size_t i = 0; i < aggs.size(); i++) {
+      bytes += estimate_result_bytes(flattened_values.column(i), aggs[i], part_rows);
+    }
+    return bytes;
+  };
+
+  auto const num_partitions = groupby_partition_count(requests, num_groups);
+  if (num_partitions == 1) {
+    estimate.scratch_bytes = aggregate_bytes(num_rows);
+    return estimate;
+  }
+  // The partitioned copy of the keys, values and row indices and the results of the partitions
+  // are held until the results are concatenated
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  for (auto const& request : requests) { columns.push_back(request.values); }
+  estimate.scratch_bytes =
+    cudf::detail::estimate_gather_bytes(table_view{columns}, num_rows) +
+    static_cast<std::size_t>(num_rows) * sizeof(size_type) + estimate.output_bytes +
+    aggregate_bytes(util::div_rounding_up_safe(num_rows, num_partitions));
+  return estimate;
 }
 }  // namespace hash
 }  // namespace detail
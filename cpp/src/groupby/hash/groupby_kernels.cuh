@@ -21,6 +21,8 @@
 #include <cudf/groupby.hpp>
 #include <cudf/utilities/bit.hpp>
 
+#include <limits>
+
 namespace cudf {
 namespace groupby {
 namespace detail {
@@ -111,6 +113,167 @@ struct compute_single_pass_aggs {
   }
 };
 
+/**
+ * @brief Number of key slots in the shared memory hash table of each thread
+ * block of `compute_block_local_aggs`
+ */
+constexpr size_type BLOCK_LOCAL_MAP_SLOTS{512};
+
+/**
+ * @brief Number of slots probed in the shared memory hash table before a row
+ * bypasses it and is aggregated into the global results
+ */
+constexpr size_type BLOCK_LOCAL_MAX_PROBES{16};
+
+/**
+ * @brief Compute single-pass aggregations by first aggregating the rows of each
+ * thread block into block-private partial results, and then merging the
+ * partial results into `output_values` and `map`
+ *
+ * Each block keeps a small hash table in shared memory that maps the unique
+ * keys seen by the block to slots of its partial results, i.e. the rows
+ * `[blockIdx.x * BLOCK_LOCAL_MAP_SLOTS, (blockIdx.x + 1) * BLOCK_LOCAL_MAP_SLOTS)`
+ * of `partial_values`. Rows of a hot key are thus aggregated with atomics that
+ * only contend within one block instead of across the whole grid. Rows whose
+ * key finds no free slot within `BLOCK_LOCAL_MAX_PROBES` probes are aggregated
+ * directly into `output_values`, as done by `compute_single_pass_aggs`.
+ *
+ * Once the block has processed its rows, the partial result of every occupied
+ * slot is merged into the row of `output_values` that `map` assigns to the
+ * slot's key. Merging applies the same aggregation to the partial result, so
+ * only SUM, MIN and MAX whose target type aggregates into itself are supported,
+ * plus COUNT_VALID and COUNT_ALL whose partial counts are added.
+ *
+ * `partial_values` must be initialized like `output_values`, with the identity
+ * of each aggregation. `partial_results` is a read-only view of the same table.
+ *
+ * @tparam skip_rows_with_nulls Indicates if rows in `input_keys` containing
+ * null values should be skipped. It `true`, it is assumed `row_bitmask` is a
+ * bitmask where bit `i` indicates the presence of a null value in row `i`.
+ * @tparam Map The type of the hash map
+ * @tparam Hasher Row hasher of the input keys
+ * @tparam KeyEqual Row equality comparator of the input keys
+ */
+template <bool skip_rows_with_nulls, typename Map, typename Hasher, typename KeyEqual>
+__global__ void compute_block_local_aggs(Map map,
+                                         Hasher hasher,
+                                         KeyEqual key_equal,
+                                         size_type num_keys,
+                                         table_device_view input_values,
+                                         mutable_table_device_view partial_values,
+                                         table_device_view partial_results,
+                                         mutable_table_device_view output_values,
+                                         aggregation::Kind const* __restrict__ aggs,
+                                         bitmask_type const* __restrict__ row_bitmask)
+{
+  size_type constexpr empty_slot{std::numeric_limits<size_type>::max()};
+  __shared__ size_type slot_keys[BLOCK_LOCAL_MAP_SLOTS];
+
+  for (size_type s = threadIdx.x; s < BLOCK_LOCAL_MAP_SLOTS; s += blockDim.x) {
+    slot_keys[s] = empty_slot;
+  }
+  __syncthreads();
+
+  size_type const partial_begin = blockIdx.x * BLOCK_LOCAL_MAP_SLOTS;
+
+  for (size_type i = blockIdx.x * blockDim.x + threadIdx.x; i < num_keys;
+       i += blockDim.x * gridDim.x) {
+    if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, i)) { continue; }
+
+    auto slot  = static_cast<size_type>(hasher(i) % BLOCK_LOCAL_MAP_SLOTS);
+    bool found = false;
+    for (size_type probe = 0; probe < BLOCK_LOCAL_MAX_PROBES and not found; ++probe) {
+      auto const existing = atomicCAS(&slot_keys[slot], empty_slot, i);
+      found               = (existing == empty_slot) or key_equal(existing, i);
+      if (not found) { slot = (slot + 1) % BLOCK_LOCAL_MAP_SLOTS; }
+    }
+
+    if (found) {
+      cudf::detail::aggregate_row<true, true>(
+        partial_values, partial_begin + slot, input_values, i, aggs);
+    } else {
+      auto result = map.insert(thrust::make_pair(i, i));
+      cudf::detail::aggregate_row<true, true>(
+        output_values, result.first->second, input_values, i, aggs);
+    }
+  }
+  __syncthreads();
+
+  for (size_type s = threadIdx.x; s < BLOCK_LOCAL_MAP_SLOTS; s += blockDim.x) {
+    auto const key = slot_keys[s];
+    if (key == empty_slot) { continue; }
+
+    auto const target_index  = map.insert(thrust::make_pair(key, key)).first->second;
+    auto const partial_index = partial_begin + s;
+    for (size_type c = 0; c < output_values.num_columns(); ++c) {
+      if (aggs[c] == aggregation::COUNT_VALID or aggs[c] == aggregation::COUNT_ALL) {
+        atomicAdd(&output_values.column(c).element<size_type>(target_index),
+                  partial_results.column(c).element<size_type>(partial_index));
+      } else {
+        cudf::detail::dispatch_type_and_aggregation(partial_results.column(c).type(),
+                                                    aggs[c],
+                                                    cudf::detail::elementwise_aggregator<>{},
+                                                    output_values.column(c),
+                                                    target_index,
+                                                    partial_results.column(c),
+                                                    partial_index);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Computes the dense group index of every row of the input keys from
+ * the hash map populated by `compute_single_pass_aggs`
+ *
+ * The value stored in `map` for a key is the sparse index of its group, which
+ * `sparse_to_dense` maps to the index of the group in the dense results. Rows
+ * that were skipped for having a null key are labelled `-1`.
+ *
+ * @tparam skip_rows_with_nulls Indicates if rows in `input_keys` containing
+ * null values were skipped. It `true`, it is assumed `row_bitmask` is a
+ * bitmask where bit `i` indicates the presence of a null value in row `i`.
+ * @tparam Map The type of the hash map
+ */
+template <bool skip_rows_with_nulls, typename Map>
+struct compute_group_labels {
+  Map map;
+  size_type const* __restrict__ sparse_to_dense;
+  bitmask_type const* __restrict__ row_bitmask;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, i)) { return -1; }
+    return sparse_to_dense[map.find(i)->second];
+  }
+};
+
+/**
+ * @brief Counts the distinct values of each group by inserting every
+ * (group label, value) pair into the hash set `set`
+ *
+ * `set` is expected to hash and compare the rows of a two column table of
+ * group labels and values. A row is counted towards its group only by the
+ * thread that inserted the first occurrence of its pair.
+ *
+ * @tparam Map The type of the hash set
+ */
+template <typename Map>
+struct compute_nunique {
+  Map set;
+  size_type const* __restrict__ labels;
+  column_device_view values;
+  bool skip_null_values;
+  size_type* __restrict__ counts;
+
+  __device__ void operator()(size_type i)
+  {
+    auto const label = labels[i];
+    if (label < 0 or (skip_null_values and values.is_null(i))) { return; }
+    if (set.insert(thrust::make_pair(i, i)).second) { atomicAdd(counts + label, 1); }
+  }
+};
+
 // TODO (dm): variance kernel
 
 }  // namespace hash
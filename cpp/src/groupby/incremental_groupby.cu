@@ -0,0 +1,618 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/join.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf {
+namespace groupby {
+namespace {
+/**
+ * @brief Returns the aggregations computed on every batch to build the partial
+ * state of `agg`. NUNIQUE builds its state without an aggregation.
+ */
+std::vector<std::unique_ptr<aggregation>> batch_aggregations(aggregation const& agg)
+{
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  switch (agg.kind) {
+    case aggregation::SUM:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: aggs.push_back(agg.clone()); break;
+    case aggregation::MEAN:
+      aggs.push_back(make_sum_aggregation());
+      aggs.push_back(make_count_aggregation());
+      break;
+    case aggregation::VARIANCE:
+    case aggregation::STD:
+      aggs.push_back(make_count_aggregation());
+      aggs.push_back(make_mean_aggregation());
+      aggs.push_back(make_variance_aggregation(0));
+      break;
+    case aggregation::NUNIQUE: break;
+    default: CUDF_FAIL("Unsupported aggregation in incremental groupby");
+  }
+  return aggs;
+}
+
+/**
+ * @brief Converts the count, mean and population variance of the valid values
+ * of each group into the count, mean and M2 state of VARIANCE and STD
+ */
+std::unique_ptr<table> make_moments_state(std::unique_ptr<column>&& count,
+                                          std::unique_ptr<column>&& mean,
+                                          column_view const& variance,
+                                          cudaStream_t stream)
+{
+  auto m2 = make_numeric_column(
+    data_type{type_id::FLOAT64}, count->size(), mask_state::UNALLOCATED, stream);
+  auto d_variance = column_device_view::create(variance, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(count->size()),
+                    m2->mutable_view().begin<double>(),
+                    [d_variance = *d_variance,
+                     counts     = count->view().data<size_type>()] __device__(size_type i) {
+                      return d_variance.is_valid(i) ? d_variance.element<double>(i) * counts[i]
+                                                    : 0.0;
+                    });
+
+  std::vector<std::unique_ptr<column>> columns;
+  columns.push_back(std::move(count));
+  columns.push_back(std::move(mean));
+  columns.push_back(std::move(m2));
+  return std::make_unique<table>(std::move(columns));
+}
+
+/**
+ * @brief Returns the distinct pairs of key and value rows of a batch, the
+ * state of NUNIQUE
+ */
+std::unique_ptr<table> distinct_pairs(table_view const& keys,
+                                      column_view const& values,
+                                      null_policy include_null_keys)
+{
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  columns.push_back(values);
+  table_view const pairs{columns};
+
+  std::vector<size_type> all_columns(pairs.num_columns());
+  std::iota(all_columns.begin(), all_columns.end(), 0);
+
+  if (include_null_keys == null_policy::EXCLUDE and has_nulls(keys)) {
+    std::vector<size_type> key_columns(keys.num_columns());
+    std::iota(key_columns.begin(), key_columns.end(), 0);
+    auto const valid_pairs = drop_nulls(pairs, key_columns);
+    return drop_duplicates(valid_pairs->view(), all_columns, duplicate_keep_option::KEEP_FIRST);
+  }
+  return drop_duplicates(pairs, all_columns, duplicate_keep_option::KEEP_FIRST);
+}
+
+template <typename Op, typename T>
+constexpr bool is_mergeable()
+{
+  return is_fixed_width<T>() and
+         (not std::is_same<Op, DeviceSum>::value or std::is_arithmetic<T>::value);
+}
+
+/**
+ * @brief Combines two aligned state columns with `Op`.
+ *
+ * A null on one side means the group has no state on that side, so the result
+ * is the other side. The result is null only if both sides are null.
+ */
+template <typename Op>
+struct merge_state_column_fn {
+  template <typename T, std::enable_if_t<is_mergeable<Op, T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& lhs,
+                                     column_view const& rhs,
+                                     cudaStream_t stream)
+  {
+    auto d_lhs  = column_device_view::create(lhs, stream);
+    auto d_rhs  = column_device_view::create(rhs, stream);
+    auto result = make_fixed_width_column(lhs.type(), lhs.size(), mask_state::UNALLOCATED, stream);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(lhs.size()),
+                      result->mutable_view().begin<T>(),
+                      [d_lhs = *d_lhs, d_rhs = *d_rhs] __device__(size_type i) {
+                        if (d_lhs.is_null(i)) { return d_rhs.element<T>(i); }
+                        if (d_rhs.is_null(i)) { return d_lhs.element<T>(i); }
+                        return Op{}(d_lhs.element<T>(i), d_rhs.element<T>(i));
+                      });
+
+    auto null_mask = cudf::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(lhs.size()),
+      [d_lhs = *d_lhs, d_rhs = *d_rhs] __device__(size_type i) {
+        return d_lhs.is_valid(i) or d_rhs.is_valid(i);
+      },
+      stream);
+    result->set_null_mask(std::move(null_mask.first), null_mask.second);
+    return result;
+  }
+
+  template <typename T, std::enable_if_t<not is_mergeable<Op, T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&, column_view const&, cudaStream_t)
+  {
+    CUDF_FAIL("Unsupported value type in incremental groupby");
+  }
+};
+
+/**
+ * @brief Merges aligned SUM, MIN, MAX or COUNT state columns
+ */
+std::unique_ptr<column> merge_state_column(aggregation::Kind k,
+                                           column_view const& lhs,
+                                           column_view const& rhs,
+                                           cudaStream_t stream)
+{
+  switch (k) {
+    case aggregation::MIN:
+      return type_dispatcher(lhs.type(), merge_state_column_fn<DeviceMin>{}, lhs, rhs, stream);
+    case aggregation::MAX:
+      return type_dispatcher(lhs.type(), merge_state_column_fn<DeviceMax>{}, lhs, rhs, stream);
+    case aggregation::SUM:
+      return type_dispatcher(lhs.type(), merge_state_column_fn<DeviceSum>{}, lhs, rhs, stream);
+    default: {
+      // Every group has a count on at least one side, so merged counts are never null
+      auto counts =
+        type_dispatcher(lhs.type(), merge_state_column_fn<DeviceSum>{}, lhs, rhs, stream);
+      counts->set_null_mask(rmm::device_buffer{}, 0);
+      return counts;
+    }
+  }
+}
+
+/**
+ * @brief Merges aligned count, mean and M2 states of VARIANCE and STD
+ *
+ * Uses the pairwise update of Chan et al.:
+ * ```
+ * n     = n_l + n_r
+ * delta = mean_r - mean_l
+ * mean  = mean_l + delta * n_r / n
+ * M2    = M2_l + M2_r + delta^2 * n_l * n_r / n
+ * ```
+ */
+std::unique_ptr<table> merge_moments(table_view const& lhs,
+                                     table_view const& rhs,
+                                     cudaStream_t stream)
+{
+  auto const size = lhs.num_rows();
+  auto count      = make_numeric_column(
+    data_type{type_to_id<size_type>()}, size, mask_state::UNALLOCATED, stream);
+  auto mean =
+    make_numeric_column(data_type{type_id::FLOAT64}, size, mask_state::UNALLOCATED, stream);
+  auto m2 =
+    make_numeric_column(data_type{type_id::FLOAT64}, size, mask_state::UNALLOCATED, stream);
+
+  auto d_lhs = table_device_view::create(lhs, stream);
+  auto d_rhs = table_device_view::create(rhs, stream);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     size,
+                     [d_lhs  = *d_lhs,
+                      d_rhs  = *d_rhs,
+                      counts = count->mutable_view().data<size_type>(),
+                      means  = mean->mutable_view().data<double>(),
+                      m2s    = m2->mutable_view().data<double>()] __device__(size_type i) {
+                       auto const n_l = d_lhs.column(0).is_valid(i)
+                                          ? d_lhs.column(0).element<size_type>(i)
+                                          : size_type{0};
+                       auto const n_r = d_rhs.column(0).is_valid(i)
+                                          ? d_rhs.column(0).element<size_type>(i)
+                                          : size_type{0};
+                       auto const mean_l = n_l > 0 ? d_lhs.column(1).element<double>(i) : 0.0;
+                       auto const mean_r = n_r > 0 ? d_rhs.column(1).element<double>(i) : 0.0;
+                       auto const m2_l   = n_l > 0 ? d_lhs.column(2).element<double>(i) : 0.0;
+                       auto const m2_r   = n_r > 0 ? d_rhs.column(2).element<double>(i) : 0.0;
+
+                       auto const n     = n_l + n_r;
+                       auto const delta = mean_r - mean_l;
+                       counts[i]        = n;
+                       means[i]         = n > 0 ? mean_l + delta * n_r / n : 0.0;
+                       m2s[i]           = n > 0 ? m2_l + m2_r + delta * delta * n_l * n_r / n : 0.0;
+                     });
+
+  auto null_mask = cudf::detail::valid_if(
+    count->view().begin<size_type>(),
+    count->view().end<size_type>(),
+    [] __device__(size_type n) { return n > 0; },
+    stream);
+  mean->set_null_mask(std::move(null_mask.first), null_mask.second);
+
+  std::vector<std::unique_ptr<column>> columns;
+  columns.push_back(std::move(count));
+  columns.push_back(std::move(mean));
+  columns.push_back(std::move(m2));
+  return std::make_unique<table>(std::move(columns));
+}
+
+/**
+ * @brief Merges the aligned states of `agg`, where row `i` of `lhs` and `rhs`
+ * belong to the same group and a group missing on one side is all nulls
+ */
+std::unique_ptr<table> merge_states(aggregation const& agg,
+                                    table_view const& lhs,
+                                    table_view const& rhs,
+                                    cudaStream_t stream)
+{
+  if (agg.kind == aggregation::VARIANCE or agg.kind == aggregation::STD) {
+    return merge_moments(lhs, rhs, stream);
+  }
+
+  std::vector<std::unique_ptr<column>> columns;
+  if (agg.kind == aggregation::MEAN) {
+    columns.push_back(merge_state_column(aggregation::SUM, lhs.column(0), rhs.column(0), stream));
+    columns.push_back(
+      merge_state_column(aggregation::COUNT_VALID, lhs.column(1), rhs.column(1), stream));
+  } else {
+    columns.push_back(merge_state_column(agg.kind, lhs.column(0), rhs.column(0), stream));
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+/**
+ * @brief Computes VARIANCE or STD from the count, mean and M2 state
+ */
+std::unique_ptr<column> finalize_moments(table_view const& state,
+                                         size_type ddof,
+                                         bool standard_deviation,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  auto const counts = state.column(0);
+  auto result       = make_numeric_column(
+    data_type{type_id::FLOAT64}, state.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    counts.begin<size_type>(),
+                    counts.end<size_type>(),
+                    state.column(2).begin<double>(),
+                    result->mutable_view().begin<double>(),
+                    [ddof, standard_deviation] __device__(size_type n, double m2) {
+                      if (n - ddof <= 0) { return 0.0; }
+                      auto const variance = m2 / (n - ddof);
+                      return standard_deviation ? sqrt(variance) : variance;
+                    });
+
+  auto null_mask = cudf::detail::valid_if(
+    counts.begin<size_type>(),
+    counts.end<size_type>(),
+    [ddof] __device__(size_type n) { return n > 0 and n - ddof > 0; },
+    stream,
+    mr);
+  result->set_null_mask(std::move(null_mask.first), null_mask.second);
+  return result;
+}
+
+/**
+ * @brief Counts the distinct values of every group of `keys` from the distinct
+ * key and value pairs of the NUNIQUE state
+ */
+std::unique_ptr<column> finalize_nunique(table_view const& keys,
+                                         table_view const& pairs,
+                                         null_policy null_handling,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  std::vector<size_type> key_columns(keys.num_columns());
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+
+  // Null keys were already filtered out of the pairs if they are excluded
+  groupby pair_groupby(pairs.select(key_columns), null_policy::INCLUDE);
+  std::vector<aggregation_request> requests(1);
+  requests[0].values = pairs.column(keys.num_columns());
+  requests[0].aggregations.push_back(make_count_aggregation(null_handling));
+  auto counted = pair_groupby.aggregate(requests);
+
+  // Align the counts with the rows of `keys`
+  auto const maps = inner_join(keys, counted.first->view(), null_equality::EQUAL);
+  auto gather_map = make_numeric_column(
+    data_type{type_to_id<size_type>()}, keys.num_rows(), mask_state::UNALLOCATED, stream);
+  thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                  maps.second->view().begin<size_type>(),
+                  maps.second->view().end<size_type>(),
+                  maps.first->view().begin<size_type>(),
+                  gather_map->mutable_view().begin<size_type>());
+
+  auto result = cudf::detail::gather(table_view{{counted.second[0].results[0]->view()}},
+                                     gather_map->view(),
+                                     cudf::detail::out_of_bounds_policy::FAIL,
+                                     cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                     mr,
+                                     stream);
+  return std::move(result->release()[0]);
+}
+
+/**
+ * @brief Computes the result of `agg` from its partial state
+ */
+std::unique_ptr<column> finalize_state(aggregation const& agg,
+                                       data_type value_type,
+                                       table_view const& state,
+                                       table_view const& keys,
+                                       cudaStream_t stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  switch (agg.kind) {
+    case aggregation::MEAN:
+      return cudf::detail::binary_operation(state.column(0),
+                                            state.column(1),
+                                            binary_operator::DIV,
+                                            cudf::detail::target_type(value_type, agg.kind),
+                                            mr,
+                                            stream);
+    case aggregation::VARIANCE:
+    case aggregation::STD: {
+      auto const& var_agg = static_cast<cudf::detail::std_var_aggregation const&>(agg);
+      return finalize_moments(
+        state, var_agg._ddof, agg.kind == aggregation::STD, stream, mr);
+    }
+    case aggregation::NUNIQUE: {
+      auto const& nunique_agg = static_cast<cudf::detail::nunique_aggregation const&>(agg);
+      return finalize_nunique(keys, state, nunique_agg._null_handling, stream, mr);
+    }
+    default: return std::make_unique<column>(state.column(0), stream, mr);
+  }
+}
+
+}  // namespace
+
+incremental_groupby::incremental_groupby(null_policy include_null_keys)
+  : _include_null_keys{include_null_keys}
+{
+}
+
+incremental_groupby::~incremental_groupby() = default;
+
+void incremental_groupby::update(table_view const& keys,
+                                 std::vector<aggregation_request> const& requests)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(std::all_of(requests.begin(),
+                           requests.end(),
+                           [&keys](auto const& request) {
+                             return request.values.size() == keys.num_rows();
+                           }),
+               "Size mismatch between request values and groupby keys.");
+
+  if (_keys == nullptr) {
+    for (auto const& request : requests) {
+      std::vector<std::unique_ptr<aggregation>> aggs;
+      for (auto const& agg : request.aggregations) {
+        CUDF_EXPECTS((agg->kind != aggregation::MIN and agg->kind != aggregation::MAX) or
+                       is_fixed_width(request.values.type()),
+                     "MIN and MAX in incremental groupby require fixed-width values");
+        aggs.push_back(agg->clone());
+      }
+      _aggregations.push_back(std::move(aggs));
+      _value_types.push_back(request.values.type());
+    }
+  } else {
+    CUDF_EXPECTS(requests.size() == _aggregations.size(),
+                 "Number of requests differs from the first update");
+    for (size_t i = 0; i < requests.size(); i++) {
+      auto const& aggs = requests[i].aggregations;
+      CUDF_EXPECTS(requests[i].values.type() == _value_types[i],
+                   "Value type differs from the first update");
+      CUDF_EXPECTS(std::equal(aggs.begin(),
+                              aggs.end(),
+                              _aggregations[i].begin(),
+                              _aggregations[i].end(),
+                              [](auto const& lhs, auto const& rhs) { return lhs->is_equal(*rhs); }),
+                   "Aggregations differ from the first update");
+    }
+  }
+
+  // Aggregate the batch into the partial states of its own groups
+  std::vector<aggregation_request> batch_requests;
+  std::vector<size_t> batch_request_ids;
+  for (size_t i = 0; i < requests.size(); i++) {
+    aggregation_request batch_request;
+    batch_request.values = requests[i].values;
+    for (auto const& agg : requests[i].aggregations) {
+      for (auto&& batch_agg : batch_aggregations(*agg)) {
+        batch_request.aggregations.push_back(std::move(batch_agg));
+      }
+    }
+    if (not batch_request.aggregations.empty()) {
+      batch_requests.push_back(std::move(batch_request));
+      batch_request_ids.push_back(i);
+    }
+  }
+  groupby batch_groupby(keys, _include_null_keys);
+  auto batch = batch_groupby.aggregate(batch_requests);
+
+  std::vector<std::vector<std::unique_ptr<table>>> batch_states(requests.size());
+  for (size_t r = 0, i = 0; i < requests.size(); i++) {
+    bool const has_batch_results = r < batch_request_ids.size() and batch_request_ids[r] == i;
+    size_t next_result{0};
+    for (auto const& agg : requests[i].aggregations) {
+      if (agg->kind == aggregation::NUNIQUE) {
+        batch_states[i].push_back(distinct_pairs(keys, requests[i].values, _include_null_keys));
+        continue;
+      }
+      auto& results = batch.second[r].results;
+      if (agg->kind == aggregation::VARIANCE or agg->kind == aggregation::STD) {
+        batch_states[i].push_back(make_moments_state(std::move(results[next_result]),
+                                                     std::move(results[next_result + 1]),
+                                                     results[next_result + 2]->view(),
+                                                     0));
+      } else {
+        std::vector<std::unique_ptr<column>> columns;
+        auto const num_columns = agg->kind == aggregation::MEAN ? 2 : 1;
+        for (auto c = 0; c < num_columns; ++c) {
+          columns.push_back(std::move(results[next_result + c]));
+        }
+        batch_states[i].push_back(std::make_unique<table>(std::move(columns)));
+      }
+      next_result += batch_aggregations(*agg).size();
+    }
+    if (has_batch_results) { ++r; }
+  }
+
+  if (_keys == nullptr) {
+    _keys   = std::move(batch.first);
+    _states = std::move(batch_states);
+    return;
+  }
+
+  // Align the groups of the state and the batch. A group seen on only one side
+  // is paired with an index of -1, which gathers as nulls.
+  auto const maps       = full_join(_keys->view(), batch.first->view(), null_equality::EQUAL);
+  auto const num_groups = _keys->num_rows();
+  auto key_map          = make_numeric_column(
+    data_type{type_to_id<size_type>()}, maps.first->size(), mask_state::UNALLOCATED);
+  thrust::transform(rmm::exec_policy(0)->on(0),
+                    maps.first->view().begin<size_type>(),
+                    maps.first->view().end<size_type>(),
+                    maps.second->view().begin<size_type>(),
+                    key_map->mutable_view().begin<size_type>(),
+                    [num_groups] __device__(size_type state_row, size_type batch_row) {
+                      return state_row >= 0 ? state_row : num_groups + batch_row;
+                    });
+
+  auto align = [](table_view const& state, column_view const& map) {
+    return cudf::detail::gather(state,
+                                map,
+                                cudf::detail::out_of_bounds_policy::NULLIFY,
+                                cudf::detail::negative_index_policy::NOT_ALLOWED);
+  };
+
+  for (size_t i = 0; i < _aggregations.size(); i++) {
+    for (size_t a = 0; a < _aggregations[i].size(); a++) {
+      auto& state             = _states[i][a];
+      auto const& batch_state = batch_states[i][a];
+      if (_aggregations[i][a]->kind == aggregation::NUNIQUE) {
+        auto const pairs = concatenate(std::vector<table_view>{state->view(), batch_state->view()});
+        std::vector<size_type> all_columns(pairs->num_columns());
+        std::iota(all_columns.begin(), all_columns.end(), 0);
+        state = drop_duplicates(pairs->view(), all_columns, duplicate_keep_option::KEEP_FIRST);
+      } else {
+        auto const lhs = align(state->view(), maps.first->view());
+        auto const rhs = align(batch_state->view(), maps.second->view());
+        state          = merge_states(*_aggregations[i][a], lhs->view(), rhs->view(), 0);
+      }
+    }
+  }
+
+  auto const all_keys = concatenate(std::vector<table_view>{_keys->view(), batch.first->view()});
+  _keys               = gather(all_keys->view(), key_map->view());
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> incremental_groupby::finalize(
+  rmm::mr::device_memory_resource* mr, cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_keys != nullptr, "incremental_groupby::finalize requires a prior update");
+
+  std::vector<aggregation_result> results(_aggregations.size());
+  for (size_t i = 0; i < _aggregations.size(); i++) {
+    for (size_t a = 0; a < _aggregations[i].size(); a++) {
+      results[i].results.push_back(finalize_state(
+        *_aggregations[i][a], _value_types[i], _states[i][a]->view(), _keys->view(), stream, mr));
+    }
+  }
+  return std::make_pair(std::make_unique<table>(_keys->view(), stream, mr), std::move(results));
+}
+
+table_view incremental_groupby::keys() const
+{
+  return _keys == nullptr ? table_view{} : _keys->view();
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> incremental_groupby::evict(
+  column_view const& selection, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_keys != nullptr, "incremental_groupby::evict requires a prior update");
+  CUDF_EXPECTS(selection.type().id() == type_id::BOOL8, "Selection must be a BOOL8 column");
+  CUDF_EXPECTS(selection.size() == _keys->num_rows(), "Selection must have one row per group");
+
+  // The retained groups are the rows of the selection that are null or false
+  auto retained = make_numeric_column(
+    data_type{type_id::BOOL8}, selection.size(), mask_state::UNALLOCATED, stream);
+  auto d_selection = column_device_view::create(selection, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(selection.size()),
+                    retained->mutable_view().begin<bool>(),
+                    [d_selection = *d_selection] __device__(size_type i) {
+                      return d_selection.is_null(i) or not d_selection.element<bool>(i);
+                    });
+
+  auto evicted_keys = apply_boolean_mask(_keys->view(), selection, mr);
+  std::vector<size_type> key_columns(_keys->num_columns());
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+
+  std::vector<aggregation_result> results(_aggregations.size());
+  for (size_t i = 0; i < _aggregations.size(); i++) {
+    for (size_t a = 0; a < _aggregations[i].size(); a++) {
+      auto const& agg = *_aggregations[i][a];
+      auto& state     = _states[i][a];
+      if (agg.kind == aggregation::NUNIQUE) {
+        // The pairs of a group are the rows of the state with its key
+        std::vector<size_type> all_columns(state->num_columns());
+        std::iota(all_columns.begin(), all_columns.end(), 0);
+        auto const evicted_pairs = left_semi_join(
+          state->view(), evicted_keys->view(), key_columns, key_columns, all_columns);
+        results[i].results.push_back(finalize_state(
+          agg, _value_types[i], evicted_pairs->view(), evicted_keys->view(), stream, mr));
+        state = left_anti_join(
+          state->view(), evicted_keys->view(), key_columns, key_columns, all_columns);
+      } else {
+        auto const evicted_state = apply_boolean_mask(state->view(), selection);
+        results[i].results.push_back(finalize_state(
+          agg, _value_types[i], evicted_state->view(), evicted_keys->view(), stream, mr));
+        state = apply_boolean_mask(state->view(), retained->view());
+      }
+    }
+  }
+
+  _keys = apply_boolean_mask(_keys->view(), retained->view());
+  return std::make_pair(std::move(evicted_keys), std::move(results));
+}
+
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+std::unique_ptr<column> group_collect(column_view const& values,
+                                      rmm::device_vector<size_type> const& group_offsets,
+                                      size_type num_groups,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(static_cast<size_t>(num_groups + 1) == group_offsets.size(),
+               "Size of group offsets should be one more than the number of groups");
+
+  // The group offsets are the offsets of the lists, so the values are their child as is
+  auto offsets = make_numeric_column(
+    data_type(type_to_id<size_type>()), num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               group_offsets.begin(),
+               group_offsets.end(),
+               offsets->mutable_view().begin<size_type>());
+
+  // Rows of null keys excluded from the groups follow the last group and are dropped
+  size_type const num_values = group_offsets.back();
+  auto child = std::make_unique<column>(cudf::detail::slice(values, 0, num_values), stream, mr);
+
+  return make_lists_column(num_groups,
+                           std::move(offsets),
+                           std::move(child),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
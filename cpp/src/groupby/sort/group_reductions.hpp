@@ -18,6 +18,7 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 
@@ -219,6 +220,55 @@ std::unique_ptr<column> group_nth_element(column_view const& values,
                                           null_policy null_handling,
                                           rmm::mr::device_memory_resource* mr,
                                           cudaStream_t stream = 0);
+
+/**
+ * @brief Internal API to collect the values of each group into a list
+ *
+ * The list of group `i` holds the values `[group_offsets[i], group_offsets[i+1])` of @p values,
+ * including nulls, in their order in @p values.
+ *
+ * @code{.pseudo}
+ * values        = [2, 1, null, 4, 3]
+ * group_offsets = [0, 2, 5]
+ * num_groups    = 2
+ *
+ * group_collect = [{2, 1}, {null, 4, 3}]
+ * @endcode
+ *
+ * @param values Grouped values to collect
+ * @param group_offsets Offsets of groups' starting points within @p values
+ * @param num_groups Number of groups
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_collect(column_view const& values,
+                                      rmm::device_vector<size_type> const& group_offsets,
+                                      size_type num_groups,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream = 0);
+
+/**
+ * @brief Internal API to compute a groupwise aggregation with a user-defined function
+ *
+ * The UDF of @p agg is compiled at runtime and called once per group on the range
+ * `[group_offsets[i], group_offsets[i+1])` of @p values, with the same calling convention as the
+ * UDFs of `rolling_window`.
+ *
+ * @throws cudf::logic_error if @p values has nulls
+ *
+ * @param values Grouped values to aggregate
+ * @param group_offsets Offsets of groups' starting points within @p values
+ * @param num_groups Number of groups
+ * @param agg The PTX or CUDA UDF aggregation
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> group_udf(column_view const& values,
+                                  rmm::device_vector<size_type> const& group_offsets,
+                                  size_type num_groups,
+                                  cudf::detail::udf_aggregation const& agg,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream = 0);
 }  // namespace detail
 }  // namespace groupby
 }  // namespace cudf
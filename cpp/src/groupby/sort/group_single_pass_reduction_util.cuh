@@ -56,10 +56,9 @@ struct reduce_functor {
     cudaStream_t stream)
   {
     using OpType     = cudf::detail::corresponding_operator_t<K>;
-    using ResultType = cudf::detail::target_type_t<T, K>;
 
     std::unique_ptr<column> result =
-      make_fixed_width_column(data_type(type_to_id<ResultType>()),
+      make_fixed_width_column(cudf::detail::target_type(values.type(), K),
                               num_groups,
                               values.has_nulls() ? mask_state::ALL_NULL : mask_state::UNALLOCATED,
                               stream,
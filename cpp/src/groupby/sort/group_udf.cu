@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/sort/group_reductions.hpp>
+#include <groupby/sort/jit/code/code.h>
+#include <rolling/jit/code/code.h>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <jit/launcher.h>
+#include <jit/parser.h>
+#include <jit/type.h>
+
+#include <types.hpp.jit>
+
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+std::unique_ptr<column> group_udf(column_view const& values,
+                                  rmm::device_vector<size_type> const& group_offsets,
+                                  size_type num_groups,
+                                  cudf::detail::udf_aggregation const& agg,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  CUDF_EXPECTS(not values.has_nulls(), "UDF aggregations do not support values with nulls.");
+
+  auto output =
+    make_fixed_width_column(agg._output_type, num_groups, mask_state::UNALLOCATED, stream, mr);
+  if (num_groups == 0) { return output; }
+
+  std::string cuda_source = cudf::groupby::jit::code::kernel_headers;
+  switch (agg.kind) {
+    case aggregation::Kind::PTX:
+      cuda_source +=
+        cudf::jit::parse_single_function_ptx(agg._source,
+                                             agg._function_name,
+                                             cudf::jit::get_type_name(agg._output_type),
+                                             {0, 5});  // args 0 and 5 are pointers.
+      break;
+    case aggregation::Kind::CUDA:
+      cuda_source += cudf::jit::parse_single_function_cuda(agg._source, agg._function_name);
+      break;
+    default: CUDF_FAIL("Unsupported UDF type.");
+  }
+  cuda_source += cudf::groupby::jit::code::kernel;
+
+  // The UDF runs sequentially over a group in each thread; running the groups in decreasing order
+  // of size gives the threads of a warp similar amounts of work
+  rmm::device_vector<size_type> group_order(num_groups);
+  rmm::device_vector<size_type> group_sizes(num_groups);
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), group_order.begin(), group_order.end());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    group_offsets.begin() + 1,
+                    group_offsets.begin() + num_groups + 1,
+                    group_offsets.begin(),
+                    group_sizes.begin(),
+                    thrust::minus<size_type>());
+  thrust::sort_by_key(rmm::exec_policy(stream)->on(stream),
+                      group_sizes.begin(),
+                      group_sizes.end(),
+                      group_order.begin(),
+                      thrust::greater<size_type>());
+
+  std::string hash = "prog_group_udf." + std::to_string(std::hash<std::string>{}(agg._source));
+  const std::vector<std::string> compiler_flags{"-std=c++14",
+                                                // Have jitify prune unused global variables
+                                                "-remove-unused-globals",
+                                                // suppress all NVRTC warnings
+                                                "-w"};
+
+  auto output_view = output->mutable_view();
+  cudf::jit::launcher(hash,
+                      cuda_source,
+                      {cudf_types_hpp, cudf::rolling::jit::code::operation_h},
+                      compiler_flags,
+                      nullptr,
+                      stream)
+    .set_kernel_inst("gpu_group_udf",  // name of the kernel we are launching
+                     {cudf::jit::get_type_name(values.type()),  // list of template arguments
+                      cudf::jit::get_type_name(output->type()),
+                      agg._operator_name})
+    .launch(num_groups,
+            cudf::jit::get_data_ptr(values),
+            group_offsets.data().get(),
+            group_order.data().get(),
+            cudf::jit::get_data_ptr(output_view));
+
+  // The group order must outlive the kernel
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return output;
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
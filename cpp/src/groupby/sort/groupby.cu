@@ -27,6 +27,8 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/quantiles.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/table/table.hpp>
@@ -397,6 +399,76 @@ void store_result_functor::operator()<aggregation::NTH_ELEMENT>(aggregation cons
                                              mr,
                                              stream));
 }
+
+template <>
+void store_result_functor::operator()<aggregation::COLLECT>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  // The lists keep the order of the rows within each group, so the values are grouped without
+  // the sort within groups that `get_grouped_values()` may return
+  if (not grouped_values) grouped_values = helper.grouped_values(values);
+
+  cache.add_result(
+    col_idx,
+    agg,
+    detail::group_collect(
+      grouped_values->view(), helper.group_offsets(), helper.num_groups(), mr, stream));
+}
+
+template <>
+void store_result_functor::operator()<aggregation::APPROX_COUNT_DISTINCT>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto approx_agg = static_cast<cudf::detail::approx_count_distinct_aggregation const&>(agg);
+
+  // Sketches are built from the unsorted values, so they need no sorting or grouping
+  cache.add_result(col_idx,
+                   agg,
+                   cudf::detail::approx_count_distinct(values,
+                                                       helper.unsorted_keys_labels(stream),
+                                                       helper.num_groups(),
+                                                       approx_agg._precision,
+                                                       mr,
+                                                       stream));
+}
+
+template <>
+void store_result_functor::operator()<aggregation::APPROX_QUANTILE>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto quantile_agg = static_cast<cudf::detail::approx_quantile_aggregation const&>(agg);
+
+  // Digests are built from the unsorted values, a bounded number of rows at a time
+  auto digest = cudf::detail::tdigest(values,
+                                      helper.unsorted_keys_labels(stream),
+                                      helper.num_groups(),
+                                      quantile_agg._compression,
+                                      rmm::mr::get_default_resource(),
+                                      stream);
+  cache.add_result(
+    col_idx,
+    agg,
+    cudf::detail::tdigest_quantiles(
+      digest->view(), helper.num_groups(), quantile_agg._quantiles, mr, stream));
+}
+
+// Computes both PTX and CUDA UDF aggregations
+template <>
+void store_result_functor::operator()<aggregation::PTX>(aggregation const& agg)
+{
+  if (cache.has_result(col_idx, agg)) return;
+
+  auto udf_agg = static_cast<cudf::detail::udf_aggregation const&>(agg);
+
+  cache.add_result(
+    col_idx,
+    agg,
+    detail::group_udf(
+      get_grouped_values(), helper.group_offsets(), helper.num_groups(), udf_agg, mr, stream));
+}
 }  // namespace detail
 
 // Sort-based groupby
@@ -414,6 +486,17 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::sort
     auto store_functor =
       detail::store_result_functor(i, requests[i].values, helper(), cache, stream, mr);
     for (size_t j = 0; j < requests[i].aggregations.size(); j++) {
+      // COLLECT builds a lists column and is not dispatched with the reductions
+      if (requests[i].aggregations[j]->kind == aggregation::COLLECT) {
+        store_functor.operator()<aggregation::COLLECT>(*requests[i].aggregations[j]);
+        continue;
+      }
+      // UDFs are compiled at runtime and are not dispatched with the reductions either
+      if (requests[i].aggregations[j]->kind == aggregation::PTX or
+          requests[i].aggregations[j]->kind == aggregation::CUDA) {
+        store_functor.operator()<aggregation::PTX>(*requests[i].aggregations[j]);
+        continue;
+      }
       // TODO (dm): single pass compute all supported reductions
       cudf::detail::aggregation_dispatcher(
         requests[i].aggregations[j]->kind, store_functor, *requests[i].aggregations[j]);
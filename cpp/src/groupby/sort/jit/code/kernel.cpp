@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+namespace cudf {
+namespace groupby {
+namespace jit {
+namespace code {
+const char* kernel_headers =
+  R"***(
+#include <cudf/types.hpp>
+)***";
+
+// The UDF is called through the `agg_op` structs of the rolling window UDFs, which share the same
+// calling conventions
+const char* kernel =
+  R"***(
+#include "operation.h"
+
+template <typename InType, typename OutType, class agg_op>
+__global__
+void gpu_group_udf(cudf::size_type num_groups,
+                   InType const* const __restrict__ values,
+                   cudf::size_type const* const __restrict__ group_offsets,
+                   cudf::size_type const* const __restrict__ group_order,
+                   OutType* __restrict__ out_col)
+{
+  cudf::size_type stride = blockDim.x * gridDim.x;
+
+  // Consecutive threads run groups of similar sizes, as ordered by `group_order`
+  for (cudf::size_type i = blockIdx.x * blockDim.x + threadIdx.x; i < num_groups; i += stride) {
+    cudf::size_type group = group_order[i];
+    cudf::size_type start = group_offsets[group];
+    cudf::size_type count = group_offsets[group + 1] - start;
+    out_col[group] = agg_op::template operate<OutType, InType>(values, start, count);
+  }
+}
+)***";
+
+}  // namespace code
+}  // namespace jit
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/scratch_memory.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+/**
+ * @brief Maps a scan aggregation to the binary operator of the scan
+ */
+template <aggregation::Kind K>
+struct scan_operator;
+template <>
+struct scan_operator<aggregation::SUM> {
+  using type = DeviceSum;
+};
+template <>
+struct scan_operator<aggregation::MIN> {
+  using type = DeviceMin;
+};
+template <>
+struct scan_operator<aggregation::MAX> {
+  using type = DeviceMax;
+};
+
+/**
+ * @brief Element of the scan input: the value of a row, or the identity of the
+ * operator for a null row so that null rows do not change the running result
+ */
+template <typename Source, typename Result, typename Op>
+struct value_or_identity {
+  column_device_view values;
+
+  __device__ Result operator()(size_type i) const
+  {
+    return values.is_valid(i) ? static_cast<Result>(values.element<Source>(i))
+                              : Op::template identity<Result>();
+  }
+};
+
+/**
+ * @brief Computes the SUM, MIN or MAX scan of the grouped values
+ */
+template <aggregation::Kind K>
+struct scan_dispatcher {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return is_numeric<T>() and not std::is_void<cudf::detail::target_type_t<T, K>>::value;
+  }
+
+  template <typename T, typename std::enable_if_t<is_supported<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& values,
+                                     size_type const* group_labels,
+                                     scan_type inclusive,
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
+  {
+    using Result = cudf::detail::target_type_t<T, K>;
+    using Op     = typename scan_operator<K>::type;
+
+    auto result = make_fixed_width_column(data_type{type_to_id<Result>()},
+                                          values.size(),
+                                          copy_bitmask(values, stream, mr),
+                                          values.null_count(),
+                                          stream,
+                                          mr);
+    if (values.size() == 0) { return result; }
+
+    auto const d_values = column_device_view::create(values, stream);
+    auto const input    = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      value_or_identity<T, Result, Op>{*d_values});
+    auto output = result->mutable_view().begin<Result>();
+    if (inclusive == scan_type::INCLUSIVE) {
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                    group_labels,
+                                    group_labels + values.size(),
+                                    input,
+                                    output,
+                                    thrust::equal_to<size_type>{},
+                                    Op{});
+    } else {
+      thrust::exclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                    group_labels,
+                                    group_labels + values.size(),
+                                    input,
+                                    output,
+                                    Op::template identity<Result>(),
+                                    thrust::equal_to<size_type>{},
+                                    Op{});
+    }
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_supported<T>(), std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported type for groupby scan aggregation");
+  }
+};
+
+/**
+ * @brief Computes the COUNT_VALID or COUNT_ALL scan of the grouped values
+ */
+std::unique_ptr<column> count_scan(column_view const& values,
+                                   size_type const* group_labels,
+                                   bool count_nulls,
+                                   scan_type inclusive,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
+{
+  auto result = make_numeric_column(
+    data_type{type_to_id<size_type>()}, values.size(), mask_state::UNALLOCATED, stream, mr);
+  if (values.size() == 0) { return result; }
+
+  auto const d_values = column_device_view::create(values, stream);
+  auto const input    = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [d_values = *d_values, count_nulls] __device__(size_type i) -> size_type {
+      return count_nulls or d_values.is_valid(i);
+    });
+  auto output = result->mutable_view().begin<size_type>();
+  if (inclusive == scan_type::INCLUSIVE) {
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                  group_labels,
+                                  group_labels + values.size(),
+                                  input,
+                                  output);
+  } else {
+    thrust::exclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                  group_labels,
+                                  group_labels + values.size(),
+                                  input,
+                                  output,
+                                  size_type{0});
+  }
+  return result;
+}
+
+/**
+ * @brief Computes the RANK scan of the grouped values
+ *
+ * A row that starts its group or differs from the previous row gets its
+ * one-based position in the group, and the other rows get zero; a running
+ * maximum in each group then gives every row the rank of the first of its
+ * equal rows.
+ */
+std::unique_ptr<column> rank_scan(column_view const& values,
+                                  size_type const* group_labels,
+                                  size_type const* group_offsets,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  auto result = make_numeric_column(
+    data_type{type_to_id<size_type>()}, values.size(), mask_state::UNALLOCATED, stream, mr);
+  if (values.size() == 0) { return result; }
+
+  auto const d_values    = table_device_view::create(table_view{{values}}, stream);
+  auto const has_nulls   = values.has_nulls();
+  auto const first_ranks = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [d_values = *d_values, group_labels, group_offsets, has_nulls] __device__(size_type i) {
+      auto const position = i - group_offsets[group_labels[i]];
+      if (position == 0) { return size_type{1}; }
+      auto const equal = has_nulls ? row_equality_comparator<true>{d_values, d_values}(i, i - 1)
+                                   : row_equality_comparator<false>{d_values, d_values}(i, i - 1);
+      return equal ? size_type{0} : position + 1;
+    });
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                group_labels,
+                                group_labels + values.size(),
+                                first_ranks,
+                                result->mutable_view().begin<size_type>(),
+                                thrust::equal_to<size_type>{},
+                                thrust::maximum<size_type>{});
+  return result;
+}
+
+std::unique_ptr<column> group_scan(column_view const& values,
+                                   aggregation::Kind kind,
+                                   scan_type inclusive,
+                                   sort::sort_groupby_helper& helper,
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
+{
+  auto const group_labels = helper.group_labels(stream).data().get();
+  switch (kind) {
+    case aggregation::SUM:
+      return type_dispatcher(values.type(),
+                             scan_dispatcher<aggregation::SUM>{},
+                             values,
+                             group_labels,
+                             inclusive,
+                             mr,
+                             stream);
+    case aggregation::MIN:
+      return type_dispatcher(values.type(),
+                             scan_dispatcher<aggregation::MIN>{},
+                             values,
+                             group_labels,
+                             inclusive,
+                             mr,
+                             stream);
+    case aggregation::MAX:
+      return type_dispatcher(values.type(),
+                             scan_dispatcher<aggregation::MAX>{},
+                             values,
+                             group_labels,
+                             inclusive,
+                             mr,
+                             stream);
+    case aggregation::COUNT_VALID:
+      return count_scan(values, group_labels, false, inclusive, mr, stream);
+    case aggregation::COUNT_ALL:
+      return count_scan(values, group_labels, true, inclusive, mr, stream);
+    case aggregation::RANK:
+      return rank_scan(values, group_labels, helper.group_offsets(stream).data().get(), mr, stream);
+    default: CUDF_FAIL("Unsupported groupby scan aggregation");
+  }
+}
+
+}  // namespace
+}  // namespace detail
+
+// Compute scan requests
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::scan(
+  std::vector<aggregation_request> const& requests,
+  scan_type inclusive,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  // The rows of each group keep their order, so the scans follow the order of the rows in `keys`
+  auto const gather_map = helper().stable_key_sort_order(stream);
+  auto grouped_keys     = cudf::detail::gather(_keys,
+                                           gather_map,
+                                           cudf::detail::out_of_bounds_policy::NULLIFY,
+                                           cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                           mr,
+                                           stream);
+
+  std::vector<aggregation_result> results;
+  for (auto const& request : requests) {
+    auto grouped_values = cudf::detail::gather(table_view{{request.values}},
+                                               gather_map,
+                                               cudf::detail::out_of_bounds_policy::NULLIFY,
+                                               cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                               cudf::detail::get_scratch_resource(),
+                                               stream);
+    aggregation_result result;
+    for (auto const& agg : request.aggregations) {
+      result.results.push_back(detail::group_scan(
+        grouped_values->get_column(0).view(), agg->kind, inclusive, helper(), mr, stream));
+    }
+    results.push_back(std::move(result));
+  }
+  return std::make_pair(std::move(grouped_keys), std::move(results));
+}
+
+}  // namespace groupby
+}  // namespace cudf
@@ -22,6 +22,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/scatter.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/scratch_memory.cuh>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 
@@ -112,12 +113,15 @@ column_view sort_groupby_helper::key_sort_order(cudaStream_t stream)
   //            we still want all rows with nulls in the end. Sort is costly, so
   //            do a copy_if(counting, sorted_order, {bitmask.is_valid(i)})
   if (_keys_pre_sorted == sorted::YES) {
-    _key_sorted_order = make_numeric_column(
-      data_type(type_to_id<size_type>()), _keys.num_rows(), mask_state::UNALLOCATED, stream);
+    _key_sorted_order = make_numeric_column(data_type(type_to_id<size_type>()),
+                                            _keys.num_rows(),
+                                            mask_state::UNALLOCATED,
+                                            stream,
+                                            get_scratch_resource());
 
     auto d_key_sorted_order = _key_sorted_order->mutable_view().data<size_type>();
 
-    thrust::sequence(rmm::exec_policy(stream)->on(stream),
+    thrust::sequence(cudf::detail::scratch_policy(stream)->on(stream),
                      d_key_sorted_order,
                      d_key_sorted_order + _key_sorted_order->size(),
                      0);
@@ -130,7 +134,7 @@ column_view sort_groupby_helper::key_sort_order(cudaStream_t stream)
       cudf::detail::sorted_order(_keys,
                                  {},
                                  std::vector<null_order>(_keys.num_columns(), null_order::AFTER),
-                                 rmm::mr::get_default_resource(),
+                                 get_scratch_resource(),
                                  stream);
   } else {  // Pandas style
     // Temporarily prepend the keys table with a column that indicates the
@@ -143,7 +147,7 @@ column_view sort_groupby_helper::key_sort_order(cudaStream_t stream)
       augmented_keys,
       {},
       std::vector<null_order>(_keys.num_columns() + 1, null_order::AFTER),
-      rmm::mr::get_default_resource(),
+      get_scratch_resource(),
       stream);
 
     // All rows with one or more null values are at the end of the resulting sorted order.
@@ -152,16 +156,30 @@ column_view sort_groupby_helper::key_sort_order(cudaStream_t stream)
   return sliced_key_sorted_order();
 }
 
+column_view sort_groupby_helper::stable_key_sort_order(cudaStream_t stream)
+{
+  if (_keys_pre_sorted == sorted::YES) { return key_sort_order(stream); }
+  if (not _stable_key_sorted_order) {
+    // Group labels are ordered like the groups, so a stable sort of the labels
+    // orders the groups as key_sort_order and keeps the rows of each group in order
+    auto const labels        = table_view({unsorted_keys_labels(stream)});
+    _stable_key_sorted_order = cudf::detail::stable_sorted_order(
+      labels, {}, {null_order::AFTER}, get_scratch_resource(), stream);
+  }
+  return cudf::detail::slice(_stable_key_sorted_order->view(), 0, num_keys(stream));
+}
+
 sort_groupby_helper::index_vector const& sort_groupby_helper::group_offsets(cudaStream_t stream)
 {
   if (_group_offsets) return *_group_offsets;
 
-  _group_offsets = std::make_unique<index_vector>(num_keys(stream) + 1);
+  _group_offsets = std::make_unique<index_vector>(
+    cudf::detail::make_scratch_vector<size_type>(num_keys(stream) + 1, 0, stream));
 
   auto device_input_table = table_device_view::create(_keys, stream);
   auto sorted_order       = key_sort_order().data<size_type>();
   decltype(_group_offsets->begin()) result_end;
-  auto exec = rmm::exec_policy(stream);
+  auto exec = cudf::detail::scratch_policy(stream);
 
   if (has_nulls(_keys)) {
     result_end = thrust::unique_copy(
@@ -191,13 +209,14 @@ sort_groupby_helper::index_vector const& sort_groupby_helper::group_labels(cudaS
   if (_group_labels) return *_group_labels;
 
   // Get group labels for future use in segmented sorting
-  _group_labels = std::make_unique<index_vector>(num_keys(stream));
+  _group_labels = std::make_unique<index_vector>(
+    cudf::detail::make_scratch_vector<size_type>(num_keys(stream), 0, stream));
 
   auto& group_labels = *_group_labels;
 
   if (num_keys(stream) == 0) return group_labels;
 
-  auto exec = rmm::exec_policy(stream);
+  auto exec = cudf::detail::scratch_policy(stream);
   thrust::scatter(exec->on(stream),
                   thrust::make_constant_iterator(1, decltype(num_groups())(1)),
                   thrust::make_constant_iterator(1, num_groups()),
@@ -214,8 +233,11 @@ column_view sort_groupby_helper::unsorted_keys_labels(cudaStream_t stream)
 {
   if (_unsorted_keys_labels) return _unsorted_keys_labels->view();
 
-  column_ptr temp_labels = make_numeric_column(
-    data_type(type_to_id<size_type>()), _keys.num_rows(), mask_state::ALL_NULL, stream);
+  column_ptr temp_labels = make_numeric_column(data_type(type_to_id<size_type>()),
+                                               _keys.num_rows(),
+                                               mask_state::ALL_NULL,
+                                               stream,
+                                               get_scratch_resource());
 
   auto group_labels_view = cudf::column_view(
     data_type(type_to_id<size_type>()), group_labels().size(), group_labels().data().get());
@@ -227,7 +249,7 @@ column_view sort_groupby_helper::unsorted_keys_labels(cudaStream_t stream)
                           scatter_map,
                           table_view({temp_labels->view()}),
                           false,
-                          rmm::mr::get_default_resource(),
+                          get_scratch_resource(),
                           stream);
 
   _unsorted_keys_labels = std::move(t_unsorted_keys_labels->release()[0]);
@@ -239,17 +261,18 @@ column_view sort_groupby_helper::keys_bitmask_column(cudaStream_t stream)
 {
   if (_keys_bitmask_column) return _keys_bitmask_column->view();
 
-  auto row_bitmask = bitmask_and(_keys, rmm::mr::get_default_resource(), stream);
+  auto row_bitmask = bitmask_and(_keys, get_scratch_resource(), stream);
 
   _keys_bitmask_column = make_numeric_column(data_type(type_id::INT8),
                                              _keys.num_rows(),
                                              std::move(row_bitmask),
                                              cudf::UNKNOWN_NULL_COUNT,
-                                             stream);
+                                             stream,
+                                             get_scratch_resource());
 
   auto keys_bitmask_view = _keys_bitmask_column->mutable_view();
   using T                = id_to_type<type_id::INT8>;
-  thrust::fill(rmm::exec_policy(stream)->on(stream),
+  thrust::fill(cudf::detail::scratch_policy(stream)->on(stream),
                keys_bitmask_view.begin<T>(),
                keys_bitmask_view.end<T>(),
                0);
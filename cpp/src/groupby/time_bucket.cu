@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/groupby.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the start of the bucket of a timestamp, rounding towards negative infinity
+ */
+template <typename Rep>
+struct bucket_start_fn {
+  Rep const* timestamps;
+  Rep bucket_size;
+
+  __device__ Rep operator()(size_type i) const
+  {
+    auto const t = timestamps[i];
+    auto bucket  = t / bucket_size;
+    if (t % bucket_size != 0 and t < 0) { --bucket; }
+    return bucket * bucket_size;
+  }
+};
+
+/**
+ * @brief Computes the column of the bucket starts of the timestamps, of the type of the
+ * timestamps and with their null mask
+ */
+struct bucket_starts_dispatch {
+  template <typename T>
+  std::enable_if_t<cudf::is_timestamp<T>(), std::unique_ptr<column>> operator()(
+    column_view const& timestamps,
+    scalar const& bucket_size,
+    cudaStream_t stream,
+    rmm::mr::device_memory_resource* mr) const
+  {
+    using Duration = typename T::duration;
+    using Rep      = typename T::rep;
+    CUDF_EXPECTS(bucket_size.type() == data_type{type_to_id<Duration>()},
+                 "Bucket size must be a duration of the resolution of the timestamps");
+    CUDF_EXPECTS(bucket_size.is_valid(stream), "Bucket size must be valid");
+    auto const size =
+      static_cast<duration_scalar<Duration> const&>(bucket_size).value(stream).count();
+    CUDF_EXPECTS(size > 0, "Bucket size must be positive");
+
+    auto result = make_fixed_width_column(timestamps.type(),
+                                          timestamps.size(),
+                                          copy_bitmask(timestamps, stream, mr),
+                                          timestamps.null_count(),
+                                          stream,
+                                          mr);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(timestamps.size()),
+                      result->mutable_view().data<Rep>(),
+                      bucket_start_fn<Rep>{timestamps.data<Rep>(), static_cast<Rep>(size)});
+    return result;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not cudf::is_timestamp<T>(), std::unique_ptr<column>> operator()(
+    Args&&...) const
+  {
+    CUDF_FAIL("Time buckets require a timestamp column");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> time_bucket_starts(column_view const& timestamps,
+                                           scalar const& bucket_size,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  return type_dispatcher(
+    timestamps.type(), bucket_starts_dispatch{}, timestamps, bucket_size, stream, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> time_bucket_aggregate(
+  column_view const& timestamps,
+  scalar const& bucket_size,
+  table_view const& keys,
+  std::vector<aggregation_request> const& requests,
+  null_policy null_handling,
+  sorted timestamps_are_sorted,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_EXPECTS(keys.num_columns() == 0 or keys.num_rows() == timestamps.size(),
+               "Keys must have one row per timestamp");
+  for (auto const& request : requests) {
+    CUDF_EXPECTS(request.values.size() == timestamps.size(),
+                 "Size mismatch between request values and timestamps.");
+  }
+
+  // The buckets are a scratch key column, hashed and compared by the groupby like any other key
+  // column; the returned keys are gathered from them
+  auto const buckets =
+    time_bucket_starts(timestamps, bucket_size, rmm::mr::get_default_resource(), stream);
+
+  if (timestamps_are_sorted == sorted::NO or keys.num_columns() > 0) {
+    std::vector<column_view> key_columns{buckets->view()};
+    key_columns.insert(key_columns.end(), keys.begin(), keys.end());
+    cudf::groupby::groupby grouper(table_view{key_columns}, null_handling);
+    return grouper.aggregate(requests, mr, stream);
+  }
+
+  // The rows of each bucket are consecutive: the pre-sorted groupby finds the groups from the
+  // boundaries of the runs of equal buckets and aggregates them segment by segment. It expects
+  // excluded null keys after the valid ones, so the leading null timestamps are sliced off.
+  auto const begin = null_handling == null_policy::EXCLUDE ? timestamps.null_count() : 0;
+  auto const end   = timestamps.size();
+  std::vector<aggregation_request> sliced_requests(requests.size());
+  for (size_t i = 0; i < requests.size(); ++i) {
+    sliced_requests[i].values = cudf::detail::slice(requests[i].values, begin, end);
+    for (auto const& agg : requests[i].aggregations) {
+      sliced_requests[i].aggregations.push_back(agg->clone());
+    }
+  }
+  cudf::groupby::groupby grouper(table_view{{cudf::detail::slice(buckets->view(), begin, end)}},
+                                 null_handling,
+                                 sorted::YES,
+                                 {order::ASCENDING},
+                                 {null_order::BEFORE});
+  return grouper.aggregate(sliced_requests, mr, stream);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> time_bucket_aggregate(
+  column_view const& timestamps,
+  scalar const& bucket_size,
+  table_view const& keys,
+  std::vector<aggregation_request> const& requests,
+  null_policy null_handling,
+  sorted timestamps_are_sorted,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::time_bucket_aggregate(
+    timestamps, bucket_size, keys, requests, null_handling, timestamps_are_sorted, mr, stream);
+}
+
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr int MAX_BLOOM_FILTER_HASHES{32};
+constexpr size_type BLOOM_FILTER_WORD_BITS{32};
+
+/**
+ * @brief Returns the `i`-th bit of a row, from the two halves of its 64-bit hash
+ * by double hashing
+ */
+__device__ inline uint64_t bloom_filter_bit(uint64_t hash, int i, uint64_t num_bits)
+{
+  auto const h1 = hash & 0xffffffffu;
+  auto const h2 = (hash >> 32) | 1;
+  return (h1 + i * h2) % num_bits;
+}
+
+template <typename Hasher>
+struct bloom_filter_insert {
+  Hasher hasher;
+  uint32_t* words;
+  uint64_t num_bits;
+  int num_hashes;
+
+  __device__ void operator()(size_type row) const
+  {
+    auto const hash = hasher(row);
+    for (int i = 0; i < num_hashes; ++i) {
+      auto const bit = bloom_filter_bit(hash, i, num_bits);
+      atomicOr(words + bit / BLOOM_FILTER_WORD_BITS, 1u << (bit % BLOOM_FILTER_WORD_BITS));
+    }
+  }
+};
+
+template <typename Hasher>
+struct bloom_filter_probe {
+  Hasher hasher;
+  uint32_t const* words;
+  uint64_t num_bits;
+  int num_hashes;
+
+  __device__ bool operator()(size_type row) const
+  {
+    auto const hash = hasher(row);
+    for (int i = 0; i < num_hashes; ++i) {
+      auto const bit = bloom_filter_bit(hash, i, num_bits);
+      if ((words[bit / BLOOM_FILTER_WORD_BITS] & (1u << (bit % BLOOM_FILTER_WORD_BITS))) == 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+void expect_valid_filter(column_view const& filter)
+{
+  CUDF_EXPECTS(filter.type().id() == type_id::UINT32 and filter.size() > 0,
+               "A bloom filter must be a non-empty UINT32 column");
+  CUDF_EXPECTS(not filter.has_nulls(), "A bloom filter must not have nulls");
+}
+
+void expect_valid_num_hashes(int num_hashes)
+{
+  CUDF_EXPECTS(num_hashes > 0 and num_hashes <= MAX_BLOOM_FILTER_HASHES,
+               "The number of hashes of a bloom filter must be in [1, 32]");
+}
+
+}  // namespace
+
+std::unique_ptr<column> build_bloom_filter(table_view const& keys,
+                                           size_type num_bits,
+                                           int num_hashes,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  CUDF_EXPECTS(num_bits > 0, "A bloom filter must have at least one bit");
+  expect_valid_num_hashes(num_hashes);
+
+  auto const num_words = (num_bits + BLOOM_FILTER_WORD_BITS - 1) / BLOOM_FILTER_WORD_BITS;
+  auto filter          = make_numeric_column(
+    data_type{type_id::UINT32}, num_words, mask_state::UNALLOCATED, stream, mr);
+  auto const words = filter->mutable_view().data<uint32_t>();
+  CUDA_TRY(cudaMemsetAsync(words, 0, num_words * sizeof(uint32_t), stream));
+  if (keys.num_columns() == 0 or keys.num_rows() == 0) { return filter; }
+
+  auto const total_bits  = static_cast<uint64_t>(num_words) * BLOOM_FILTER_WORD_BITS;
+  auto const device_keys = table_device_view::create(keys, stream);
+  auto const rows        = thrust::make_counting_iterator<size_type>(0);
+  if (has_nulls(keys)) {
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     rows,
+                     rows + keys.num_rows(),
+                     bloom_filter_insert<row_hasher<XXHash_64, true>>{
+                       row_hasher<XXHash_64, true>{*device_keys}, words, total_bits, num_hashes});
+  } else {
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     rows,
+                     rows + keys.num_rows(),
+                     bloom_filter_insert<row_hasher<XXHash_64, false>>{
+                       row_hasher<XXHash_64, false>{*device_keys}, words, total_bits, num_hashes});
+  }
+  return filter;
+}
+
+std::unique_ptr<column> bloom_filter_contains(column_view const& filter,
+                                              table_view const& keys,
+                                              int num_hashes,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  expect_valid_filter(filter);
+  expect_valid_num_hashes(num_hashes);
+
+  auto result = make_numeric_column(
+    data_type{type_id::BOOL8}, keys.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (keys.num_columns() == 0 or keys.num_rows() == 0) { return result; }
+
+  auto const total_bits  = static_cast<uint64_t>(filter.size()) * BLOOM_FILTER_WORD_BITS;
+  auto const device_keys = table_device_view::create(keys, stream);
+  auto const rows        = thrust::make_counting_iterator<size_type>(0);
+  auto const words       = filter.data<uint32_t>();
+  auto output            = result->mutable_view().begin<bool>();
+  if (has_nulls(keys)) {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      rows,
+                      rows + keys.num_rows(),
+                      output,
+                      bloom_filter_probe<row_hasher<XXHash_64, true>>{
+                        row_hasher<XXHash_64, true>{*device_keys}, words, total_bits, num_hashes});
+  } else {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      rows,
+                      rows + keys.num_rows(),
+                      output,
+                      bloom_filter_probe<row_hasher<XXHash_64, false>>{
+                        row_hasher<XXHash_64, false>{*device_keys}, words, total_bits, num_hashes});
+  }
+  return result;
+}
+
+std::unique_ptr<column> merge_bloom_filters(std::vector<column_view> const& filters,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  CUDF_EXPECTS(not filters.empty(), "At least one bloom filter is required");
+  std::for_each(filters.begin(), filters.end(), expect_valid_filter);
+  CUDF_EXPECTS(std::all_of(filters.begin(),
+                           filters.end(),
+                           [&](auto const& f) { return f.size() == filters.front().size(); }),
+               "Only bloom filters of the same size can be merged");
+
+  auto merged = std::make_unique<column>(filters.front(), stream, mr);
+  auto words  = merged->mutable_view().begin<uint32_t>();
+  for (auto it = filters.begin() + 1; it != filters.end(); ++it) {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      words,
+                      words + merged->size(),
+                      it->begin<uint32_t>(),
+                      words,
+                      thrust::bit_or<uint32_t>{});
+  }
+  return merged;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> build_bloom_filter(table_view const& keys,
+                                           size_type num_bits,
+                                           int num_hashes,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::build_bloom_filter(keys, num_bits, num_hashes, mr);
+}
+
+std::unique_ptr<column> bloom_filter_contains(column_view const& filter,
+                                              table_view const& keys,
+                                              int num_hashes,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bloom_filter_contains(filter, keys, num_hashes, mr);
+}
+
+std::unique_ptr<column> merge_bloom_filters(std::vector<column_view> const& filters,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::merge_bloom_filters(filters, mr);
+}
+
+}  // namespace cudf
@@ -64,8 +64,10 @@ struct default_allocator {
 
   default_allocator() = default;
 
+  explicit default_allocator(rmm::mr::device_memory_resource* mr) : mr{mr} {}
+
   template <class U>
-  constexpr default_allocator(const default_allocator<U>&) noexcept
+  constexpr default_allocator(const default_allocator<U>& other) noexcept : mr{other.mr}
   {
   }
 
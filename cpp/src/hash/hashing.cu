@@ -22,11 +22,14 @@
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/partitioning.hpp>
+#include <cudf/structs/detail/flatten.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 
 #include <thrust/tabulate.h>
 
+#include <algorithm>
+
 namespace cudf {
 namespace {
 // Launch configuration for optimized hash partition
@@ -39,6 +42,16 @@ constexpr size_type THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL = 1024;
 constexpr size_type FALLBACK_BLOCK_SIZE      = 256;
 constexpr size_type FALLBACK_ROWS_PER_THREAD = 1;
 
+/**
+ * @brief Returns true if a column of the table is a struct column
+ */
+bool has_struct_columns(table_view const& input)
+{
+  return std::any_of(input.begin(), input.end(), [](auto const& col) {
+    return col.type().id() == type_id::STRUCT;
+  });
+}
+
 /**
  * @brief  Functor to map a hash value to a particular 'bin' or partition number
  * that uses the modulo operation.
@@ -135,7 +148,7 @@ __global__ void compute_row_partition_numbers(row_hasher_t the_hasher,
   // and compute the partition to which the hash value belongs and increment
   // the shared memory counter for that partition
   while (row_number < num_rows) {
-    const hash_value_type row_hash_value = the_hasher(row_number);
+    auto const row_hash_value = the_hasher(row_number);
 
     const size_type partition_number = the_partitioner(row_hash_value);
 
@@ -438,7 +451,7 @@ struct copy_block_partitions_dispatcher {
 };
 
 // NOTE hash_has_nulls must be true if table_to_hash has nulls
-template <bool hash_has_nulls>
+template <template <typename> class hash_function, bool hash_has_nulls>
 std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   table_view const& input,
   table_view const& table_to_hash,
@@ -476,13 +489,14 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   auto row_partition_offset = rmm::device_vector<size_type>(num_rows);
 
   auto const device_input = table_device_view::create(table_to_hash, stream);
-  auto const hasher       = row_hasher<MurmurHash3_32, hash_has_nulls>(*device_input);
+  auto const hasher       = row_hasher<hash_function, hash_has_nulls>(*device_input);
+  using hash_value_t      = typename row_hasher<hash_function, hash_has_nulls>::result_type;
 
   // If the number of partitions is a power of two, we can compute the partition
   // number of each row more efficiently with bitwise operations
   if (is_power_two(num_partitions)) {
     // Determines how the mapping between hash value and partition number is computed
-    using partitioner_type = bitwise_partitioner<hash_value_type>;
+    using partitioner_type = bitwise_partitioner<hash_value_t>;
 
     // Computes which partition each row belongs to by hashing the row and performing
     // a partitioning operator on the hash value. Also computes the number of
@@ -500,7 +514,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
                                               global_partition_sizes.data().get());
   } else {
     // Determines how the mapping between hash value and partition number is computed
-    using partitioner_type = modulo_partitioner<hash_value_type>;
+    using partitioner_type = modulo_partitioner<hash_value_t>;
 
     // Computes which partition each row belongs to by hashing the row and performing
     // a partitioning operator on the hash value. Also computes the number of
@@ -614,6 +628,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function,
   rmm::mr::device_memory_resource* mr,
   cudaStream_t stream)
 {
@@ -626,10 +641,22 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
     return std::make_pair(empty_like(input), std::vector<size_type>{});
   }
 
+  if (hash_function == hash_id::HASH_XXHASH64) {
+    if (has_nulls(table_to_hash)) {
+      return hash_partition_table<XXHash_64, true>(
+        input, table_to_hash, num_partitions, mr, stream);
+    } else {
+      return hash_partition_table<XXHash_64, false>(
+        input, table_to_hash, num_partitions, mr, stream);
+    }
+  }
+  CUDF_EXPECTS(hash_function == hash_id::HASH_MURMUR3, "Unsupported hash function");
   if (has_nulls(table_to_hash)) {
-    return hash_partition_table<true>(input, table_to_hash, num_partitions, mr, stream);
+    return hash_partition_table<MurmurHash3_32, true>(
+      input, table_to_hash, num_partitions, mr, stream);
   } else {
-    return hash_partition_table<false>(input, table_to_hash, num_partitions, mr, stream);
+    return hash_partition_table<MurmurHash3_32, false>(
+      input, table_to_hash, num_partitions, mr, stream);
   }
 }
 
@@ -645,6 +672,27 @@ std::unique_ptr<column> hash(table_view const& input,
   // Return early if there's nothing to hash
   if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
 
+  // The rows of a struct column hash like the rows of its fields, which get the initial hash
+  // value of the struct column
+  if (has_struct_columns(input)) {
+    CUDF_EXPECTS(initial_hash.empty() || initial_hash.size() == size_t(input.num_columns()),
+                 "Expected same size of initial hash values as number of columns");
+    std::vector<structs::detail::flattened_table> flattened;
+    std::vector<column_view> columns;
+    std::vector<uint32_t> flattened_initial_hash;
+    for (size_type i = 0; i < input.num_columns(); ++i) {
+      flattened.push_back(
+        structs::detail::flatten_nested_columns(table_view{{input.column(i)}}, {}, {}, stream));
+      auto const& fields = flattened.back().columns;
+      columns.insert(columns.end(), fields.begin(), fields.end());
+      if (!initial_hash.empty()) {
+        flattened_initial_hash.insert(
+          flattened_initial_hash.end(), fields.num_columns(), initial_hash[i]);
+      }
+    }
+    return hash(table_view{columns}, flattened_initial_hash, mr, stream);
+  }
+
   bool const nullable     = has_nulls(input);
   auto const device_input = table_device_view::create(input, stream);
   auto output_view        = output->mutable_view();
@@ -685,6 +733,45 @@ std::unique_ptr<column> hash(table_view const& input,
   return output;
 }
 
+std::unique_ptr<column> hash(table_view const& input,
+                             hash_id hash_function,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream)
+{
+  if (hash_function == hash_id::HASH_MURMUR3) {
+    return hash(input, std::vector<uint32_t>{}, mr, stream);
+  }
+  CUDF_EXPECTS(hash_function == hash_id::HASH_XXHASH64, "Unsupported hash function");
+
+  auto output = make_numeric_column(
+    data_type(type_id::UINT64), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+
+  // Return early if there's nothing to hash
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
+
+  if (has_struct_columns(input)) {
+    auto const flattened = structs::detail::flatten_nested_columns(input, {}, {}, stream);
+    return hash(flattened.columns, hash_function, mr, stream);
+  }
+
+  auto const device_input = table_device_view::create(input, stream);
+  auto output_view        = output->mutable_view();
+
+  if (has_nulls(input)) {
+    thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                     output_view.begin<uint64_t>(),
+                     output_view.end<uint64_t>(),
+                     row_hasher<XXHash_64, true>(*device_input));
+  } else {
+    thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                     output_view.begin<uint64_t>(),
+                     output_view.end<uint64_t>(),
+                     row_hasher<XXHash_64, false>(*device_input));
+  }
+
+  return output;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> hash(table_view const& input,
@@ -695,4 +782,12 @@ std::unique_ptr<column> hash(table_view const& input,
   return detail::hash(input, initial_hash, mr);
 }
 
+std::unique_ptr<column> hash(table_view const& input,
+                             hash_id hash_function,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash(input, hash_function, mr);
+}
+
 }  // namespace cudf
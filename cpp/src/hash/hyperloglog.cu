@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <cub/cub.cuh>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr int MIN_HLL_PRECISION{4};
+constexpr int MAX_HLL_PRECISION{18};
+
+// Seeds of the two 32-bit hashes that make up the 64-bit hash of a value
+constexpr uint32_t HLL_HASH_SEED_HIGH{0};
+constexpr uint32_t HLL_HASH_SEED_LOW{0x9747b28c};
+
+// Largest number of registers built at once by `approx_count_distinct`
+constexpr size_t MAX_HLL_CHUNK_REGISTERS{size_t{1} << 28};
+
+constexpr int HLL_ESTIMATE_BLOCK_SIZE{256};
+constexpr int HLL_ESTIMATE_MAX_BLOCKS{1 << 16};
+
+/**
+ * @brief Raises the register at `index` to `rank` if it is lower
+ *
+ * There is no atomic maximum of single bytes, so the aligned 4-byte word
+ * holding the register is updated with `atomicCAS`.
+ */
+__device__ inline void atomic_max_register(uint8_t* registers, size_t index, uint8_t rank)
+{
+  auto const word_address = reinterpret_cast<unsigned int*>(registers + (index & ~size_t{3}));
+  auto const shift        = 8 * static_cast<unsigned int>(index & 3);
+  unsigned int old        = *word_address;
+  unsigned int assumed;
+  do {
+    assumed = old;
+    if (((assumed >> shift) & 0xffu) >= rank) { return; }
+    auto const desired = (assumed & ~(0xffu << shift)) | (static_cast<unsigned int>(rank) << shift);
+    old                = atomicCAS(word_address, assumed, desired);
+  } while (assumed != old);
+}
+
+/**
+ * @brief Returns the group of `row` from group labels that may be absent
+ * (`labels == nullptr`, every row is in group 0) or null (returns -1)
+ */
+__device__ inline size_type group_of(size_type const* labels,
+                                     bitmask_type const* label_mask,
+                                     size_type label_offset,
+                                     size_type row)
+{
+  if (labels == nullptr) { return 0; }
+  if (label_mask != nullptr and not bit_is_set(label_mask, label_offset + row)) { return -1; }
+  return labels[row];
+}
+
+/**
+ * @brief Adds the non-null values whose group is in `[group_begin, group_end)`
+ * to the sketch of their group
+ *
+ * The top `precision` bits of the 64-bit hash of a value select its register,
+ * which keeps the largest position of the first set bit of the remaining bits.
+ */
+template <typename T>
+struct update_sketches {
+  column_device_view values;
+  size_type const* labels;
+  bitmask_type const* label_mask;
+  size_type label_offset;
+  size_type group_begin;
+  size_type group_end;
+  int precision;
+  uint8_t* registers;
+
+  __device__ void operator()(size_type i) const
+  {
+    if (not values.is_valid(i)) { return; }
+    auto const group = group_of(labels, label_mask, label_offset, i);
+    if (group < group_begin or group >= group_end) { return; }
+
+    auto const value = values.element<T>(i);
+    uint64_t const hash =
+      (static_cast<uint64_t>(MurmurHash3_32<T>{HLL_HASH_SEED_HIGH}(value)) << 32) |
+      MurmurHash3_32<T>{HLL_HASH_SEED_LOW}(value);
+    auto const index = hash >> (64 - precision);
+    auto const rank  = min(__clzll(static_cast<long long>(hash << precision)), 64 - precision) + 1;
+    atomic_max_register(
+      registers, (static_cast<size_t>(group - group_begin) << precision) + index, rank);
+  }
+};
+
+struct update_sketches_dispatch {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return is_fixed_width<T>() or std::is_same<T, string_view>::value;
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  void operator()(column_view const& values,
+                  column_view const& group_labels,
+                  size_type group_begin,
+                  size_type group_end,
+                  int precision,
+                  uint8_t* registers,
+                  cudaStream_t stream)
+  {
+    auto d_values = column_device_view::create(values, stream);
+    bool const has_labels{not group_labels.is_empty()};
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      values.size(),
+      update_sketches<T>{*d_values,
+                         has_labels ? group_labels.data<size_type>() : nullptr,
+                         has_labels ? group_labels.null_mask() : nullptr,
+                         group_labels.offset(),
+                         group_begin,
+                         group_end,
+                         precision,
+                         registers});
+  }
+
+  template <typename T, std::enable_if_t<not is_supported<T>()>* = nullptr>
+  void operator()(column_view const&,
+                  column_view const&,
+                  size_type,
+                  size_type,
+                  int,
+                  uint8_t*,
+                  cudaStream_t)
+  {
+    CUDF_FAIL("HyperLogLog sketches of this type are not supported");
+  }
+};
+
+/**
+ * @brief Builds the sketches of groups `[group_begin, group_end)` of `values`
+ * into `registers`
+ */
+void build_sketches(column_view const& values,
+                    column_view const& group_labels,
+                    size_type group_begin,
+                    size_type group_end,
+                    int precision,
+                    uint8_t* registers,
+                    cudaStream_t stream)
+{
+  auto const num_registers = static_cast<size_t>(group_end - group_begin) << precision;
+  CUDA_TRY(cudaMemsetAsync(registers, 0, num_registers, stream));
+  type_dispatcher(values.type(),
+                  update_sketches_dispatch{},
+                  values,
+                  group_labels,
+                  group_begin,
+                  group_end,
+                  precision,
+                  registers,
+                  stream);
+}
+
+/**
+ * @brief Merges each register of `sketches` into the register of the sketch of
+ * its group in `registers`, ignoring sketches whose group is not in `[0, num_groups)`
+ */
+struct merge_sketches {
+  uint8_t const* sketches;
+  size_type const* labels;
+  bitmask_type const* label_mask;
+  size_type label_offset;
+  size_type num_groups;
+  int precision;
+  uint8_t* registers;
+
+  __device__ void operator()(size_type i) const
+  {
+    auto const rank = sketches[i];
+    if (rank == 0) { return; }
+    auto const group = group_of(labels, label_mask, label_offset, i >> precision);
+    if (group < 0 or group >= num_groups) { return; }
+    auto const index = i & ((size_type{1} << precision) - 1);
+    atomic_max_register(registers, (static_cast<size_t>(group) << precision) + index, rank);
+  }
+};
+
+/**
+ * @brief Estimates the number of distinct values of `count` sketches with a
+ * block per sketch
+ *
+ * Uses the raw HyperLogLog estimate, corrected by linear counting of the empty
+ * registers for small cardinalities. The 64-bit hashes make a correction for
+ * hash collisions at large cardinalities unnecessary.
+ */
+template <int block_size>
+__global__ void estimate_sketches(uint8_t const* __restrict__ registers,
+                                  size_type count,
+                                  int precision,
+                                  int64_t* __restrict__ estimates)
+{
+  using SumReduce   = cub::BlockReduce<double, block_size>;
+  using CountReduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename SumReduce::TempStorage sum_storage;
+  __shared__ typename CountReduce::TempStorage count_storage;
+
+  size_type const num_registers = size_type{1} << precision;
+  double const m                = num_registers;
+  double const alpha            = precision == 4   ? 0.673
+                                  : precision == 5 ? 0.697
+                                  : precision == 6 ? 0.709
+                                                   : 0.7213 / (1.0 + 1.079 / m);
+
+  for (size_type sketch = blockIdx.x; sketch < count; sketch += gridDim.x) {
+    auto const sketch_registers = registers + (static_cast<size_t>(sketch) << precision);
+    double inverse_sum{0};
+    size_type num_zeros{0};
+    for (size_type r = threadIdx.x; r < num_registers; r += block_size) {
+      auto const rank = sketch_registers[r];
+      inverse_sum += ldexp(1.0, -static_cast<int>(rank));
+      num_zeros += (rank == 0);
+    }
+    inverse_sum = SumReduce(sum_storage).Sum(inverse_sum);
+    num_zeros   = CountReduce(count_storage).Sum(num_zeros);
+
+    if (threadIdx.x == 0) {
+      double const raw = alpha * m * m / inverse_sum;
+      estimates[sketch] =
+        (raw <= 2.5 * m and num_zeros > 0) ? llround(m * log(m / num_zeros)) : llround(raw);
+    }
+    __syncthreads();
+  }
+}
+
+void estimate(uint8_t const* registers,
+              size_type count,
+              int precision,
+              int64_t* estimates,
+              cudaStream_t stream)
+{
+  if (count == 0) { return; }
+  auto const grid = std::min(count, HLL_ESTIMATE_MAX_BLOCKS);
+  estimate_sketches<HLL_ESTIMATE_BLOCK_SIZE>
+    <<<grid, HLL_ESTIMATE_BLOCK_SIZE, 0, stream>>>(registers, count, precision, estimates);
+  CHECK_CUDA(stream);
+}
+
+void expects_valid_precision(int precision)
+{
+  CUDF_EXPECTS(precision >= MIN_HLL_PRECISION and precision <= MAX_HLL_PRECISION,
+               "HyperLogLog precision must be in [4, 18]");
+}
+
+void expects_valid_labels(column_view const& group_labels, size_type num_rows)
+{
+  CUDF_EXPECTS(group_labels.is_empty() or group_labels.type().id() == type_to_id<size_type>(),
+               "Group labels must be of type INT32");
+  CUDF_EXPECTS(group_labels.is_empty() or group_labels.size() == num_rows,
+               "Size mismatch between group labels and the rows they label");
+}
+
+void expects_valid_sketches(column_view const& sketches, int precision)
+{
+  CUDF_EXPECTS(sketches.type().id() == type_id::UINT8, "Sketches must be of type UINT8");
+  CUDF_EXPECTS(sketches.size() % (size_type{1} << precision) == 0,
+               "Sketches size must be a multiple of the number of registers of a sketch");
+}
+
+/**
+ * @brief Allocates the zeroed registers of `num_groups` sketches
+ */
+std::unique_ptr<column> make_sketches(size_type num_groups,
+                                      int precision,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(num_groups >= 0, "Number of groups must not be negative");
+  CUDF_EXPECTS(static_cast<int64_t>(num_groups) << precision <=
+                 std::numeric_limits<size_type>::max(),
+               "Sketches of all groups exceed the maximum size of a column");
+  auto sketches = make_numeric_column(
+    data_type{type_id::UINT8}, num_groups << precision, mask_state::UNALLOCATED, stream, mr);
+  auto view = sketches->mutable_view();
+  CUDA_TRY(cudaMemsetAsync(view.data<uint8_t>(), 0, view.size(), stream));
+  return sketches;
+}
+
+}  // namespace
+
+std::unique_ptr<column> hyperloglog_sketches(column_view const& values,
+                                             column_view const& group_labels,
+                                             size_type num_groups,
+                                             int precision,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  expects_valid_precision(precision);
+  expects_valid_labels(group_labels, values.size());
+  auto sketches = make_sketches(num_groups, precision, mr, stream);
+  if (num_groups > 0) {
+    build_sketches(values,
+                   group_labels,
+                   0,
+                   num_groups,
+                   precision,
+                   sketches->mutable_view().data<uint8_t>(),
+                   stream);
+  }
+  return sketches;
+}
+
+std::unique_ptr<column> merge_hyperloglog_sketches(column_view const& sketches,
+                                                   column_view const& group_labels,
+                                                   size_type num_groups,
+                                                   int precision,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream)
+{
+  expects_valid_precision(precision);
+  expects_valid_sketches(sketches, precision);
+  expects_valid_labels(group_labels, sketches.size() >> precision);
+  auto merged = make_sketches(num_groups, precision, mr, stream);
+  if (num_groups == 0) { return merged; }
+
+  bool const has_labels{not group_labels.is_empty()};
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     sketches.size(),
+                     merge_sketches{sketches.data<uint8_t>(),
+                                    has_labels ? group_labels.data<size_type>() : nullptr,
+                                    has_labels ? group_labels.null_mask() : nullptr,
+                                    group_labels.offset(),
+                                    num_groups,
+                                    precision,
+                                    merged->mutable_view().data<uint8_t>()});
+  return merged;
+}
+
+std::unique_ptr<column> hyperloglog_estimates(column_view const& sketches,
+                                              int precision,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  expects_valid_precision(precision);
+  expects_valid_sketches(sketches, precision);
+  auto const count = sketches.size() >> precision;
+  auto estimates   = make_numeric_column(
+    data_type{type_id::INT64}, count, mask_state::UNALLOCATED, stream, mr);
+  estimate(sketches.data<uint8_t>(),
+           count,
+           precision,
+           estimates->mutable_view().data<int64_t>(),
+           stream);
+  return estimates;
+}
+
+std::unique_ptr<column> approx_count_distinct(column_view const& values,
+                                              column_view const& group_labels,
+                                              size_type num_groups,
+                                              int precision,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  expects_valid_precision(precision);
+  expects_valid_labels(group_labels, values.size());
+  auto estimates = make_numeric_column(
+    data_type{type_id::INT64}, num_groups, mask_state::UNALLOCATED, stream, mr);
+  if (num_groups == 0) { return estimates; }
+
+  // Sketch a bounded number of groups at a time
+  auto const groups_per_chunk = static_cast<size_type>(
+    std::min<size_t>(num_groups, std::max<size_t>(1, MAX_HLL_CHUNK_REGISTERS >> precision)));
+  rmm::device_buffer registers(static_cast<size_t>(groups_per_chunk) << precision, stream);
+  auto const d_registers = static_cast<uint8_t*>(registers.data());
+  auto const d_estimates = estimates->mutable_view().data<int64_t>();
+  for (size_type begin = 0; begin < num_groups; begin += groups_per_chunk) {
+    auto const end = std::min(num_groups, begin + groups_per_chunk);
+    build_sketches(values, group_labels, begin, end, precision, d_registers, stream);
+    estimate(d_registers, end - begin, precision, d_estimates + begin, stream);
+  }
+  return estimates;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> hyperloglog_sketches(column_view const& values,
+                                             column_view const& group_labels,
+                                             size_type num_groups,
+                                             int precision,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hyperloglog_sketches(values, group_labels, num_groups, precision, mr);
+}
+
+std::unique_ptr<column> merge_hyperloglog_sketches(column_view const& sketches,
+                                                   column_view const& group_labels,
+                                                   size_type num_groups,
+                                                   int precision,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::merge_hyperloglog_sketches(sketches, group_labels, num_groups, precision, mr);
+}
+
+std::unique_ptr<column> hyperloglog_estimates(column_view const& sketches,
+                                              int precision,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hyperloglog_estimates(sketches, precision, mr);
+}
+
+}  // namespace cudf
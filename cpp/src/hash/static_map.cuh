@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <hash/helper_functions.cuh>
+
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/fill.h>
+#include <thrust/pair.h>
+
+#include <cooperative_groups.h>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Fixed-capacity open-addressing hash map on the device
+ *
+ * Unlike `concurrent_unordered_map`, the keys and the values are stored in separate arrays,
+ * allocated with a stream-ordered memory resource. The slots are grouped into windows of
+ * `tile_size` consecutive slots, each probed by a cooperative group of `tile_size` threads:
+ * the threads of a group load the keys of a window together, and vote for a match or an empty
+ * slot, so that a probe reads one coalesced segment of keys per window instead of one key at a
+ * time. Keys are claimed with a single `atomicCAS` of the key slot, and the value is written
+ * after, so that keys and values of any size can be used without packing them.
+ *
+ * The hash and equality functions are passed to each operation, which allows finding the keys
+ * of one table among those of another. A key equal to `empty_key` must not be inserted.
+ *
+ * Supports concurrent inserts, and concurrent finds, but not concurrent inserts and finds. The
+ * bulk operations are asynchronous on their stream.
+ *
+ * @tparam Key Type of the keys; 1, 2, 4 or 8 bytes for `atomicCAS`
+ * @tparam Value Type of the values
+ */
+template <typename Key, typename Value>
+class static_map {
+  static_assert(sizeof(Key) == 1 || sizeof(Key) == 2 || sizeof(Key) == 4 || sizeof(Key) == 8,
+                "Unsupported key size");
+
+ public:
+  using key_type    = Key;
+  using mapped_type = Value;
+
+  static constexpr uint32_t tile_size  = 4;    ///< Threads probing a window, and slots per window
+  static constexpr int block_size      = 128;  ///< Block size of the bulk operations
+  static constexpr int tiles_per_block = block_size / tile_size;
+
+  using tile_type = cooperative_groups::thread_block_tile<tile_size>;
+
+  /**
+   * @brief Non-owning view of the map for finds in device code
+   */
+  class device_view {
+   public:
+    device_view(Key const* keys, Value const* values, size_t num_windows, Key empty_key)
+      : _keys{keys}, _values{values}, _num_windows{num_windows}, _empty_key{empty_key}
+    {
+    }
+
+    /**
+     * @brief Returns the slot of a key, or -1 if the key is not in the map
+     *
+     * Called by all threads of `tile`, with the same key; returns the same result on all of
+     * them.
+     *
+     * @param tile Group of `tile_size` threads probing the map together
+     * @param key Key to find
+     * @param hash Hash function of the key
+     * @param equal Equality of the key with the keys of the map, called as `equal(key, stored)`
+     */
+    template <typename Tile, typename ProbeKey, typename Hash, typename Equal>
+    __device__ int64_t find_slot(Tile const& tile,
+                                 ProbeKey const& key,
+                                 Hash hash,
+                                 Equal equal) const
+    {
+      auto window = static_cast<size_t>(hash(key)) % _num_windows;
+      while (true) {
+        auto const slot     = window * tile_size + tile.thread_rank();
+        auto const existing = load_key(_keys, slot);
+        auto const is_empty = existing == _empty_key;
+        auto const matches  = tile.ballot(not is_empty and equal(key, existing));
+        if (matches != 0) { return window * tile_size + __ffs(matches) - 1; }
+        // Inserts fill the windows in probing order, so a key is never past an empty slot
+        if (tile.any(is_empty)) { return -1; }
+        window = (window + 1) % _num_windows;
+      }
+    }
+
+    /**
+     * @brief Returns whether a key is in the map; see `find_slot`
+     */
+    template <typename Tile, typename ProbeKey, typename Hash, typename Equal>
+    __device__ bool contains(Tile const& tile, ProbeKey const& key, Hash hash, Equal equal) const
+    {
+      return find_slot(tile, key, hash, equal) >= 0;
+    }
+
+    /**
+     * @brief Returns the value of a key, or `empty_value` if the key is not in the map; see
+     * `find_slot`
+     */
+    template <typename Tile, typename ProbeKey, typename Hash, typename Equal>
+    __device__ Value
+    find(Tile const& tile, ProbeKey const& key, Value empty_value, Hash hash, Equal equal) const
+    {
+      auto const slot = find_slot(tile, key, hash, equal);
+      return slot >= 0 ? _values[slot] : empty_value;
+    }
+
+   private:
+    Key const* _keys;
+    Value const* _values;
+    size_t _num_windows;
+    Key _empty_key;
+  };
+
+  /**
+   * @brief Non-owning view of the map for inserts in device code
+   */
+  class device_mutable_view {
+   public:
+    device_mutable_view(Key* keys, Value* values, size_t num_windows, Key empty_key)
+      : _keys{keys}, _values{values}, _num_windows{num_windows}, _empty_key{empty_key}
+    {
+    }
+
+    /**
+     * @brief Inserts a key and its value if the key is not in the map yet
+     *
+     * Called by all threads of `tile`, with the same key and value; returns the same result on
+     * all of them. The map must have an empty slot.
+     *
+     * @param tile Group of `tile_size` threads probing the map together
+     * @param key Key to insert
+     * @param value Value of the key
+     * @param hash Hash function of the key
+     * @param equal Equality of two keys
+     * @return The slot of the key, and whether the key was inserted
+     */
+    template <typename Tile, typename Hash, typename Equal>
+    __device__ thrust::pair<size_t, bool> insert(
+      Tile const& tile, Key key, Value value, Hash hash, Equal equal)
+    {
+      auto window = static_cast<size_t>(hash(key)) % _num_windows;
+      while (true) {
+        auto const slot     = window * tile_size + tile.thread_rank();
+        auto const existing = load_key(_keys, slot);
+        auto const is_empty = existing == _empty_key;
+        auto const matches  = tile.ballot(not is_empty and equal(key, existing));
+        if (matches != 0) { return {window * tile_size + __ffs(matches) - 1, false}; }
+
+        // Claim the empty slots of the window in order until one succeeds or holds the key
+        auto empty_lanes = tile.ballot(is_empty);
+        while (empty_lanes != 0) {
+          auto const lane = __ffs(empty_lanes) - 1;
+          int status      = 0;  // 1 if inserted, 2 if the slot was claimed by an equal key
+          if (tile.thread_rank() == lane) {
+            auto const old = atomicCAS(_keys + slot, _empty_key, key);
+            if (old == _empty_key) {
+              _values[slot] = value;
+              status        = 1;
+            } else if (equal(key, old)) {
+              status = 2;
+            }
+          }
+          status = tile.shfl(status, lane);
+          if (status != 0) { return {window * tile_size + lane, status == 1}; }
+          empty_lanes &= ~(1u << lane);
+        }
+        window = (window + 1) % _num_windows;
+      }
+    }
+
+   private:
+    Key* _keys;
+    Value* _values;
+    size_t _num_windows;
+    Key _empty_key;
+  };
+
+  /**
+   * @brief Constructs an empty map
+   *
+   * @param capacity Minimum number of slots; the load factor of the map should stay below 50%
+   * for short probes, see `compute_hash_table_size()`
+   * @param empty_key Key marking the empty slots, never inserted
+   * @param stream CUDA stream used to initialize the map
+   * @param mr Device memory resource used to allocate the slots
+   */
+  static_map(size_t capacity,
+             Key empty_key,
+             cudaStream_t stream                 = 0,
+             rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+    : _num_windows{std::max<size_t>(1, (capacity + tile_size - 1) / tile_size)},
+      _empty_key{empty_key},
+      _keys{_num_windows * tile_size * sizeof(Key), stream, mr},
+      _values{_num_windows * tile_size * sizeof(Value), stream, mr}
+  {
+    thrust::fill_n(rmm::exec_policy(stream)->on(stream), keys(), this->capacity(), empty_key);
+  }
+
+  /**
+   * @brief Returns the number of slots
+   */
+  size_t capacity() const { return _num_windows * tile_size; }
+
+  device_view get_device_view() const
+  {
+    return device_view{keys(), values(), _num_windows, _empty_key};
+  }
+
+  device_mutable_view get_device_mutable_view()
+  {
+    return device_mutable_view{keys(), values(), _num_windows, _empty_key};
+  }
+
+  /**
+   * @brief Inserts the keys of `[first, last)` with their values; keys that are already in the
+   * map keep their value
+   *
+   * @param first Beginning of the keys
+   * @param last End of the keys
+   * @param values Beginning of the values of the keys
+   * @param hash Hash function of the keys
+   * @param equal Equality of two keys
+   * @param stream CUDA stream used for the kernel launch
+   */
+  template <typename KeyIt, typename ValueIt, typename Hash, typename Equal>
+  void insert(
+    KeyIt first, KeyIt last, ValueIt values, Hash hash, Equal equal, cudaStream_t stream = 0);
+
+  /**
+   * @brief Writes the value of every key of `[first, last)` to `output`, or `empty_value`
+   * for the keys that are not in the map
+   *
+   * @param equal Equality of a key with the keys of the map, called as `equal(key, stored)`
+   */
+  template <typename KeyIt, typename OutputIt, typename Hash, typename Equal>
+  void find(KeyIt first,
+            KeyIt last,
+            OutputIt output,
+            Value empty_value,
+            Hash hash,
+            Equal equal,
+            cudaStream_t stream = 0) const;
+
+  /**
+   * @brief Writes whether every key of `[first, last)` is in the map to `output`
+   *
+   * @param equal Equality of a key with the keys of the map, called as `equal(key, stored)`
+   */
+  template <typename KeyIt, typename OutputIt, typename Hash, typename Equal>
+  void contains(KeyIt first,
+                KeyIt last,
+                OutputIt output,
+                Hash hash,
+                Equal equal,
+                cudaStream_t stream = 0) const;
+
+ private:
+  __device__ static Key load_key(Key const* keys, size_t slot)
+  {
+    return reinterpret_cast<Key const volatile*>(keys)[slot];
+  }
+
+  Key* keys() const { return static_cast<Key*>(const_cast<void*>(_keys.data())); }
+  Value* values() const { return static_cast<Value*>(const_cast<void*>(_values.data())); }
+
+  static int num_blocks(size_t num_keys)
+  {
+    return static_cast<int>(
+      std::max<size_t>(1, std::min<size_t>((num_keys + tiles_per_block - 1) / tiles_per_block,
+                                           std::numeric_limits<int32_t>::max())));
+  }
+
+  size_t _num_windows;
+  Key _empty_key;
+  rmm::device_buffer _keys;
+  rmm::device_buffer _values;
+};
+
+namespace static_map_kernels {
+namespace cg = cooperative_groups;
+
+/**
+ * @brief Runs `op(tile, i)` for every `i` of `[0, size)`, on one tile of threads per index
+ */
+template <uint32_t TileSize, typename Op>
+__global__ void for_each_tile(size_t size, Op op)
+{
+  auto tile            = cg::tiled_partition<TileSize>(cg::this_thread_block());
+  auto const num_tiles = static_cast<size_t>(gridDim.x) * blockDim.x / TileSize;
+  for (auto i = (static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x) / TileSize; i < size;
+       i += num_tiles) {
+    op(tile, i);
+  }
+}
+
+}  // namespace static_map_kernels
+
+template <typename Key, typename Value>
+template <typename KeyIt, typename ValueIt, typename Hash, typename Equal>
+void static_map<Key, Value>::insert(
+  KeyIt first, KeyIt last, ValueIt values, Hash hash, Equal equal, cudaStream_t stream)
+{
+  auto const num_keys = static_cast<size_t>(std::distance(first, last));
+  if (num_keys == 0) { return; }
+  auto view = get_device_mutable_view();
+  static_map_kernels::for_each_tile<tile_size><<<num_blocks(num_keys), block_size, 0, stream>>>(
+    num_keys,
+    [view, first, values, hash, equal] __device__(tile_type const& tile, size_t i) mutable {
+      view.insert(tile, first[i], values[i], hash, equal);
+    });
+  CHECK_CUDA(stream);
+}
+
+template <typename Key, typename Value>
+template <typename KeyIt, typename OutputIt, typename Hash, typename Equal>
+void static_map<Key, Value>::find(KeyIt first,
+                                  KeyIt last,
+                                  OutputIt output,
+                                  Value empty_value,
+                                  Hash hash,
+                                  Equal equal,
+                                  cudaStream_t stream) const
+{
+  auto const num_keys = static_cast<size_t>(std::distance(first, last));
+  if (num_keys == 0) { return; }
+  auto view = get_device_view();
+  static_map_kernels::for_each_tile<tile_size><<<num_blocks(num_keys), block_size, 0, stream>>>(
+    num_keys,
+    [view, first, output, empty_value, hash, equal] __device__(tile_type const& tile, size_t i) {
+      auto const value = view.find(tile, first[i], empty_value, hash, equal);
+      if (tile.thread_rank() == 0) { output[i] = value; }
+    });
+  CHECK_CUDA(stream);
+}
+
+template <typename Key, typename Value>
+template <typename KeyIt, typename OutputIt, typename Hash, typename Equal>
+void static_map<Key, Value>::contains(
+  KeyIt first, KeyIt last, OutputIt output, Hash hash, Equal equal, cudaStream_t stream) const
+{
+  auto const num_keys = static_cast<size_t>(std::distance(first, last));
+  if (num_keys == 0) { return; }
+  auto view = get_device_view();
+  static_map_kernels::for_each_tile<tile_size><<<num_blocks(num_keys), block_size, 0, stream>>>(
+    num_keys, [view, first, output, hash, equal] __device__(tile_type const& tile, size_t i) {
+      auto const found = view.contains(tile, first[i], hash, equal);
+      if (tile.thread_rank() == 0) { output[i] = found; }
+    });
+  CHECK_CUDA(stream);
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/interop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <arrow/array/concatenate.h>
+#include <arrow/gpu/cuda_api.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+data_type time_type(arrow::TimeUnit::type unit, bool duration)
+{
+  switch (unit) {
+    case arrow::TimeUnit::SECOND:
+      return data_type{duration ? type_id::DURATION_SECONDS : type_id::TIMESTAMP_SECONDS};
+    case arrow::TimeUnit::MILLI:
+      return data_type{duration ? type_id::DURATION_MILLISECONDS : type_id::TIMESTAMP_MILLISECONDS};
+    case arrow::TimeUnit::MICRO:
+      return data_type{duration ? type_id::DURATION_MICROSECONDS : type_id::TIMESTAMP_MICROSECONDS};
+    case arrow::TimeUnit::NANO:
+      return data_type{duration ? type_id::DURATION_NANOSECONDS : type_id::TIMESTAMP_NANOSECONDS};
+    default: CUDF_FAIL("Unsupported Arrow time unit");
+  }
+}
+
+data_type from_arrow_type(arrow::DataType const& type)
+{
+  switch (type.id()) {
+    case arrow::Type::INT8: return data_type{type_id::INT8};
+    case arrow::Type::INT16: return data_type{type_id::INT16};
+    case arrow::Type::INT32: return data_type{type_id::INT32};
+    case arrow::Type::INT64: return data_type{type_id::INT64};
+    case arrow::Type::UINT8: return data_type{type_id::UINT8};
+    case arrow::Type::UINT16: return data_type{type_id::UINT16};
+    case arrow::Type::UINT32: return data_type{type_id::UINT32};
+    case arrow::Type::UINT64: return data_type{type_id::UINT64};
+    case arrow::Type::FLOAT: return data_type{type_id::FLOAT32};
+    case arrow::Type::DOUBLE: return data_type{type_id::FLOAT64};
+    case arrow::Type::BOOL: return data_type{type_id::BOOL8};
+    case arrow::Type::DATE32: return data_type{type_id::TIMESTAMP_DAYS};
+    case arrow::Type::TIMESTAMP:
+      return time_type(static_cast<arrow::TimestampType const&>(type).unit(), false);
+    case arrow::Type::DURATION:
+      return time_type(static_cast<arrow::DurationType const&>(type).unit(), true);
+    case arrow::Type::STRING: return data_type{type_id::STRING};
+    case arrow::Type::LIST: return data_type{type_id::LIST};
+    case arrow::Type::DICTIONARY: return data_type{type_id::DICTIONARY32};
+    default: CUDF_FAIL("Unsupported type for conversion from Arrow");
+  }
+}
+
+/**
+ * @brief Copies the validity bitmap of a host array into a null mask starting
+ * at the first element of the array
+ */
+rmm::device_buffer null_mask_from_arrow(arrow::Array const& array,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
+{
+  if (array.null_bitmap_data() == nullptr) { return rmm::device_buffer{}; }
+  auto const end_bit = static_cast<size_type>(array.offset() + array.length());
+  // the Arrow bitmap may be shorter than the padding of a null mask
+  rmm::device_buffer mask(bitmask_allocation_size_bytes(end_bit), stream, mr);
+  CUDA_TRY(cudaMemcpyAsync(mask.data(),
+                           array.null_bitmap_data(),
+                           (end_bit + 7) / 8,
+                           cudaMemcpyHostToDevice,
+                           stream));
+  if (array.offset() == 0) { return mask; }
+  return copy_bitmask(static_cast<bitmask_type const*>(mask.data()),
+                      static_cast<size_type>(array.offset()),
+                      end_bit,
+                      stream,
+                      mr);
+}
+
+/**
+ * @brief Returns the offsets of a host `arrow::StringArray` or `arrow::ListArray`
+ * rebased to start at 0
+ */
+template <typename ArrayType>
+std::unique_ptr<column> offsets_from_arrow(ArrayType const& array,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  std::vector<size_type> offsets(array.length() + 1);
+  auto const first = array.value_offset(0);
+  for (size_t idx = 0; idx < offsets.size(); ++idx) {
+    offsets[idx] = array.value_offset(idx) - first;
+  }
+  auto const bytes = offsets.size() * sizeof(size_type);
+  auto column =
+    std::make_unique<cudf::column>(data_type{type_id::INT32},
+                                   static_cast<size_type>(offsets.size()),
+                                   rmm::device_buffer{offsets.data(), bytes, stream, mr});
+  // `offsets` is freed on return
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return column;
+}
+
+std::unique_ptr<column> from_arrow_array(arrow::Array const& array,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream);
+
+std::unique_ptr<column> fixed_width_from_arrow(arrow::Array const& array,
+                                               data_type type,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream)
+{
+  auto const width = size_of(type);
+  auto const data  = array.data()->buffers[1]->data() + array.offset() * width;
+  return std::make_unique<column>(type,
+                                  static_cast<size_type>(array.length()),
+                                  rmm::device_buffer{data, array.length() * width, stream, mr},
+                                  null_mask_from_arrow(array, mr, stream),
+                                  static_cast<size_type>(array.null_count()));
+}
+
+std::unique_ptr<column> bools_from_arrow(arrow::Array const& array,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  auto const& bools = static_cast<arrow::BooleanArray const&>(array);
+  std::vector<uint8_t> values(bools.length());
+  for (size_t idx = 0; idx < values.size(); ++idx) {
+    values[idx] = bools.Value(idx);
+  }
+  auto column = std::make_unique<cudf::column>(
+    data_type{type_id::BOOL8},
+    static_cast<size_type>(values.size()),
+    rmm::device_buffer{values.data(), values.size(), stream, mr},
+    null_mask_from_arrow(array, mr, stream),
+    static_cast<size_type>(array.null_count()));
+  // `values` is freed on return
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return column;
+}
+
+std::unique_ptr<column> strings_from_arrow(arrow::Array const& array,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  auto const& strings = static_cast<arrow::StringArray const&>(array);
+  auto const first    = strings.value_offset(0);
+  auto const bytes    = strings.value_offset(strings.length()) - first;
+  auto const data     = strings.value_data()->data() + first;
+  auto chars          = std::make_unique<column>(
+    data_type{type_id::INT8},
+    bytes,
+    rmm::device_buffer{data, static_cast<size_t>(bytes), stream, mr});
+  return make_strings_column(static_cast<size_type>(array.length()),
+                             offsets_from_arrow(strings, mr, stream),
+                             std::move(chars),
+                             static_cast<size_type>(array.null_count()),
+                             null_mask_from_arrow(array, mr, stream),
+                             stream,
+                             mr);
+}
+
+std::unique_ptr<column> lists_from_arrow(arrow::Array const& array,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  auto const& lists = static_cast<arrow::ListArray const&>(array);
+  auto const first  = lists.value_offset(0);
+  auto const values = lists.values()->Slice(first, lists.value_offset(lists.length()) - first);
+  return make_lists_column(static_cast<size_type>(array.length()),
+                           offsets_from_arrow(lists, mr, stream),
+                           from_arrow_array(*values, mr, stream),
+                           static_cast<size_type>(array.null_count()),
+                           null_mask_from_arrow(array, mr, stream),
+                           stream,
+                           mr);
+}
+
+/**
+ * @brief Converts an Arrow dictionary to a `DICTIONARY32` column
+ *
+ * Arrow does not require the dictionary to be sorted or unique, so the keys are
+ * encoded and the Arrow indices are mapped through the encoded indices of the keys.
+ */
+std::unique_ptr<column> dictionary_from_arrow(arrow::Array const& array,
+                                              rmm::mr::device_memory_resource* mr,
+                                              cudaStream_t stream)
+{
+  auto const& dictionary = static_cast<arrow::DictionaryArray const&>(array);
+  CUDF_EXPECTS(dictionary.dictionary()->null_count() == 0,
+               "Arrow dictionaries with null keys are not supported");
+  auto const keys    = from_arrow_array(*dictionary.dictionary(), mr, stream);
+  auto const indices = from_arrow_array(*dictionary.indices(), mr, stream);
+  auto const map     = cast(indices->view(), data_type{type_id::INT32}, mr, stream);
+  auto encoded = dictionary::detail::encode(keys->view(), data_type{type_id::INT32}, mr, stream);
+
+  auto contents = encoded->release();
+  // the values of the null rows are undefined and may be out of bounds
+  auto remapped = gather(table_view{{contents.children[0]->view()}},
+                         map->view(),
+                         out_of_bounds_policy::NULLIFY,
+                         negative_index_policy::NOT_ALLOWED,
+                         mr,
+                         stream)
+                    ->release();
+  auto remapped_contents = remapped[0]->release();
+  auto remapped_indices  = std::make_unique<column>(data_type{type_id::INT32},
+                                                   static_cast<size_type>(array.length()),
+                                                   std::move(*remapped_contents.data));
+  return make_dictionary_column(std::move(contents.children[1]),
+                                std::move(remapped_indices),
+                                null_mask_from_arrow(array, mr, stream),
+                                static_cast<size_type>(array.null_count()));
+}
+
+std::unique_ptr<column> from_arrow_array(arrow::Array const& array,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  auto const type = from_arrow_type(*array.type());
+  if (array.length() == 0) { return make_empty_column(type); }
+  switch (type.id()) {
+    case type_id::BOOL8: return bools_from_arrow(array, mr, stream);
+    case type_id::STRING: return strings_from_arrow(array, mr, stream);
+    case type_id::LIST: return lists_from_arrow(array, mr, stream);
+    case type_id::DICTIONARY32: return dictionary_from_arrow(array, mr, stream);
+    default: return fixed_width_from_arrow(array, type, mr, stream);
+  }
+}
+
+/**
+ * @brief Returns the device address of an Arrow buffer, or null if there is no buffer
+ *
+ * @throw cudf::logic_error if the buffer is not an `arrow::cuda::CudaBuffer`
+ */
+void const* device_address(std::shared_ptr<arrow::Buffer> const& buffer)
+{
+  if (buffer == nullptr) { return nullptr; }
+  auto const cuda_buffer = arrow::cuda::CudaBuffer::FromBuffer(buffer);
+  CUDF_EXPECTS(cuda_buffer.ok(), "Arrow buffer is not in device memory");
+  return reinterpret_cast<void const*>(cuda_buffer.ValueOrDie()->address());
+}
+
+/**
+ * @brief Returns a view of the offsets of a device string or list array
+ *
+ * The offset of the array indexes the offsets as in cudf, so all the offsets
+ * up to the end of the array are viewed.
+ */
+column_view offsets_from_arrow_device(arrow::ArrayData const& data)
+{
+  return column_view(data_type{type_id::INT32},
+                     static_cast<size_type>(data.offset + data.length + 1),
+                     device_address(data.buffers[1]));
+}
+
+column_view from_arrow_device_array(arrow::ArrayData const& data)
+{
+  auto const type = from_arrow_type(*data.type);
+  CUDF_EXPECTS(type.id() != type_id::BOOL8 && type.id() != type_id::DICTIONARY32,
+               "Arrow booleans and dictionaries cannot be viewed as cudf columns");
+
+  auto const null_mask = static_cast<bitmask_type const*>(device_address(data.buffers[0]));
+  CUDF_EXPECTS(reinterpret_cast<uintptr_t>(null_mask) % sizeof(bitmask_type) == 0,
+               "Arrow validity bitmap must be aligned to 4 bytes");
+  // an unknown Arrow null count has the value of UNKNOWN_NULL_COUNT
+  auto const null_count = null_mask == nullptr ? 0 : static_cast<size_type>(data.null_count);
+  auto const size   = static_cast<size_type>(data.length);
+  auto const offset = static_cast<size_type>(data.offset);
+
+  std::vector<column_view> children;
+  if (type.id() == type_id::STRING) {
+    children.push_back(offsets_from_arrow_device(data));
+    children.emplace_back(data_type{type_id::INT8},
+                          static_cast<size_type>(data.buffers[2]->size()),
+                          device_address(data.buffers[2]));
+  } else if (type.id() == type_id::LIST) {
+    children.push_back(offsets_from_arrow_device(data));
+    children.push_back(from_arrow_device_array(*data.child_data[0]));
+  } else {
+    return column_view(type, size, device_address(data.buffers[1]), null_mask, null_count, offset);
+  }
+  return column_view(type, size, nullptr, null_mask, null_count, offset, children);
+}
+
+}  // namespace
+
+std::unique_ptr<table> from_arrow(arrow::Table const& input,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  std::vector<std::unique_ptr<column>> columns;
+  for (auto const& chunked : input.columns()) {
+    std::shared_ptr<arrow::Array> array;
+    if (chunked->num_chunks() == 0) {
+      array = arrow::MakeArrayOfNull(chunked->type(), 0).ValueOrDie();
+    } else if (chunked->num_chunks() == 1) {
+      array = chunked->chunk(0);
+    } else {
+      array = arrow::Concatenate(chunked->chunks()).ValueOrDie();
+    }
+    columns.push_back(from_arrow_array(*array, mr, stream));
+  }
+  // the host memory of `input` may be freed on return
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> from_arrow(arrow::Table const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_arrow(input, mr);
+}
+
+std::unique_ptr<table> from_arrow(arrow::RecordBatch const& input,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_arrow(*arrow::Table::Make(input.schema(), input.columns(), input.num_rows()),
+                            mr);
+}
+
+table_view from_arrow_device(arrow::Table const& input)
+{
+  CUDF_FUNC_RANGE();
+  std::vector<column_view> columns;
+  for (auto const& chunked : input.columns()) {
+    CUDF_EXPECTS(chunked->num_chunks() == 1, "Arrow columns must have a single chunk");
+    columns.push_back(detail::from_arrow_device_array(*chunked->chunk(0)->data()));
+  }
+  return table_view(columns);
+}
+
+}  // namespace cudf
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/interop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <arrow/gpu/cuda_api.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief A `CudaBuffer` that owns the device memory it references
+ *
+ * Used for the buffers that are created by the conversion, so they live as
+ * long as the returned Arrow table.
+ */
+class owning_cuda_buffer : public arrow::cuda::CudaBuffer {
+ public:
+  owning_cuda_buffer(rmm::device_buffer&& buffer,
+                     std::shared_ptr<arrow::cuda::CudaContext> const& context)
+    : arrow::cuda::CudaBuffer(static_cast<uint8_t*>(buffer.data()),
+                              static_cast<int64_t>(buffer.size()),
+                              context),
+      _buffer{std::move(buffer)}
+  {
+  }
+
+ private:
+  rmm::device_buffer _buffer;
+};
+
+/**
+ * @brief Creates the Arrow buffers of the device memory of columns
+ *
+ * The buffers are host copies allocated from `ar_mr`, or views of the device
+ * memory when `ar_mr` is null.
+ */
+struct buffer_factory {
+  arrow::MemoryPool* ar_mr;
+  std::shared_ptr<arrow::cuda::CudaContext> context;
+  cudaStream_t stream;
+
+  bool on_device() const { return ar_mr == nullptr; }
+
+  /**
+   * @brief Returns a buffer for the `bytes` bytes of device memory at `data`
+   */
+  std::shared_ptr<arrow::Buffer> view(void const* data, int64_t bytes) const
+  {
+    if (on_device()) {
+      return std::make_shared<arrow::cuda::CudaBuffer>(
+        static_cast<uint8_t*>(const_cast<void*>(data)), bytes, context);
+    }
+    std::shared_ptr<arrow::Buffer> buffer = arrow::AllocateBuffer(bytes, ar_mr).ValueOrDie();
+    if (bytes > 0) {
+      CUDA_TRY(
+        cudaMemcpyAsync(buffer->mutable_data(), data, bytes, cudaMemcpyDeviceToHost, stream));
+    }
+    return buffer;
+  }
+
+  /**
+   * @brief Returns a buffer that takes over or copies the memory of `buffer`
+   */
+  std::shared_ptr<arrow::Buffer> own(rmm::device_buffer&& buffer) const
+  {
+    if (on_device()) { return std::make_shared<owning_cuda_buffer>(std::move(buffer), context); }
+    auto copy = view(buffer.data(), static_cast<int64_t>(buffer.size()));
+    // `buffer` is freed on return
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    return copy;
+  }
+
+  /**
+   * @brief Returns the validity buffer of `input`, or null if it has no null mask
+   *
+   * The mask covers the bits before the offset of `input`, which is also the
+   * offset of its Arrow array.
+   */
+  std::shared_ptr<arrow::Buffer> null_mask(column_view const& input) const
+  {
+    if (not input.nullable()) { return nullptr; }
+    auto const words = num_bitmask_words(input.offset() + input.size());
+    return view(input.null_mask(), static_cast<int64_t>(words) * sizeof(bitmask_type));
+  }
+};
+
+std::shared_ptr<arrow::DataType> to_arrow_type(column_view const& input);
+
+/**
+ * @brief Returns the Arrow type of the element type of a `LIST` or the keys of
+ * a `DICTIONARY32` column, or `arrow::null` for empty columns without children
+ */
+std::shared_ptr<arrow::DataType> child_arrow_type(column_view const& input, size_type child)
+{
+  return input.num_children() > child ? to_arrow_type(input.child(child)) : arrow::null();
+}
+
+std::shared_ptr<arrow::DataType> to_arrow_type(column_view const& input)
+{
+  switch (input.type().id()) {
+    case type_id::INT8: return arrow::int8();
+    case type_id::INT16: return arrow::int16();
+    case type_id::INT32: return arrow::int32();
+    case type_id::INT64: return arrow::int64();
+    case type_id::UINT8: return arrow::uint8();
+    case type_id::UINT16: return arrow::uint16();
+    case type_id::UINT32: return arrow::uint32();
+    case type_id::UINT64: return arrow::uint64();
+    case type_id::FLOAT32: return arrow::float32();
+    case type_id::FLOAT64: return arrow::float64();
+    case type_id::BOOL8: return arrow::boolean();
+    case type_id::TIMESTAMP_DAYS: return arrow::date32();
+    case type_id::TIMESTAMP_SECONDS: return arrow::timestamp(arrow::TimeUnit::SECOND);
+    case type_id::TIMESTAMP_MILLISECONDS: return arrow::timestamp(arrow::TimeUnit::MILLI);
+    case type_id::TIMESTAMP_MICROSECONDS: return arrow::timestamp(arrow::TimeUnit::MICRO);
+    case type_id::TIMESTAMP_NANOSECONDS: return arrow::timestamp(arrow::TimeUnit::NANO);
+    case type_id::DURATION_SECONDS: return arrow::duration(arrow::TimeUnit::SECOND);
+    case type_id::DURATION_MILLISECONDS: return arrow::duration(arrow::TimeUnit::MILLI);
+    case type_id::DURATION_MICROSECONDS: return arrow::duration(arrow::TimeUnit::MICRO);
+    case type_id::DURATION_NANOSECONDS: return arrow::duration(arrow::TimeUnit::NANO);
+    case type_id::STRING: return arrow::utf8();
+    case type_id::LIST:
+      return arrow::list(child_arrow_type(input, lists_column_view::child_column_index));
+    // the keys are sorted so the order of the indices is the order of the keys
+    case type_id::DICTIONARY32:
+      return arrow::dictionary(arrow::int32(), child_arrow_type(input, 1), true);
+    default: CUDF_FAIL("Unsupported type for conversion to Arrow");
+  }
+}
+
+std::shared_ptr<arrow::Array> to_arrow_array(column_view const& input,
+                                             buffer_factory const& factory);
+
+std::shared_ptr<arrow::Array> fixed_width_to_arrow(column_view const& input,
+                                                   std::shared_ptr<arrow::DataType> const& type,
+                                                   buffer_factory const& factory)
+{
+  auto const bytes = static_cast<int64_t>(input.offset() + input.size()) * size_of(input.type());
+  return arrow::MakeArray(arrow::ArrayData::Make(
+    type,
+    input.size(),
+    {factory.null_mask(input), factory.view(input.head(), bytes)},
+    input.null_count(),
+    input.offset()));
+}
+
+/**
+ * @brief Arrow packs booleans into bits, so the data and the null mask of
+ * `BOOL8` columns are packed into new buffers starting at bit 0
+ */
+std::shared_ptr<arrow::Array> bools_to_arrow(column_view const& input,
+                                             buffer_factory const& factory)
+{
+  auto data     = bools_to_mask(input, rmm::mr::get_default_resource(), factory.stream).first;
+  auto validity = input.nullable() ? factory.own(copy_bitmask(input, factory.stream)) : nullptr;
+  return arrow::MakeArray(arrow::ArrayData::Make(arrow::boolean(),
+                                                 input.size(),
+                                                 {validity, factory.own(std::move(*data))},
+                                                 input.null_count()));
+}
+
+/**
+ * @brief Returns the offsets buffer of a `STRING` or `LIST` column, which the
+ * offset of the column indexes as in Arrow
+ */
+std::shared_ptr<arrow::Buffer> offsets_to_arrow(column_view const& input,
+                                                column_view const& offsets,
+                                                buffer_factory const& factory)
+{
+  auto const bytes = static_cast<int64_t>(input.offset() + input.size() + 1) * sizeof(size_type);
+  return factory.view(offsets.data<size_type>(), bytes);
+}
+
+std::shared_ptr<arrow::Array> strings_to_arrow(column_view const& input,
+                                               buffer_factory const& factory)
+{
+  strings_column_view const strings(input);
+  auto const chars = strings.chars();
+  return arrow::MakeArray(
+    arrow::ArrayData::Make(arrow::utf8(),
+                           input.size(),
+                           {factory.null_mask(input),
+                            offsets_to_arrow(input, strings.offsets(), factory),
+                            factory.view(chars.data<char>(), chars.size())},
+                           input.null_count(),
+                           input.offset()));
+}
+
+std::shared_ptr<arrow::Array> lists_to_arrow(column_view const& input,
+                                             buffer_factory const& factory)
+{
+  lists_column_view const lists(input);
+  auto const child = to_arrow_array(lists.child(), factory);
+  return arrow::MakeArray(arrow::ArrayData::Make(
+    arrow::list(child->type()),
+    input.size(),
+    {factory.null_mask(input), offsets_to_arrow(input, lists.offsets(), factory)},
+    {child->data()},
+    input.null_count(),
+    input.offset()));
+}
+
+std::shared_ptr<arrow::Array> dictionary_to_arrow(column_view const& input,
+                                                  buffer_factory const& factory)
+{
+  dictionary_column_view const dictionary(input);
+  auto const indices =
+    fixed_width_to_arrow(dictionary.get_indices_annotated(), arrow::int32(), factory);
+  auto const keys = to_arrow_array(dictionary.keys(), factory);
+  return std::make_shared<arrow::DictionaryArray>(
+    arrow::dictionary(arrow::int32(), keys->type(), true), indices, keys);
+}
+
+std::shared_ptr<arrow::Array> to_arrow_array(column_view const& input,
+                                             buffer_factory const& factory)
+{
+  auto const type = to_arrow_type(input);
+  if (input.size() == 0) {
+    auto const pool = factory.on_device() ? arrow::default_memory_pool() : factory.ar_mr;
+    return arrow::MakeArrayOfNull(type, 0, pool).ValueOrDie();
+  }
+  switch (input.type().id()) {
+    case type_id::BOOL8: return bools_to_arrow(input, factory);
+    case type_id::STRING: return strings_to_arrow(input, factory);
+    case type_id::LIST: return lists_to_arrow(input, factory);
+    case type_id::DICTIONARY32: return dictionary_to_arrow(input, factory);
+    default: return fixed_width_to_arrow(input, type, factory);
+  }
+}
+
+std::shared_ptr<arrow::Table> to_arrow_table(table_view input,
+                                             std::vector<std::string> const& column_names,
+                                             buffer_factory const& factory)
+{
+  CUDF_EXPECTS(column_names.empty() ||
+                 column_names.size() == static_cast<size_t>(input.num_columns()),
+               "Number of column names does not match the number of columns");
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  for (size_type idx = 0; idx < input.num_columns(); ++idx) {
+    arrays.push_back(to_arrow_array(input.column(idx), factory));
+    auto name = column_names.empty() ? std::to_string(idx) : column_names[idx];
+    fields.push_back(arrow::field(std::move(name), arrays.back()->type()));
+  }
+  CUDA_TRY(cudaStreamSynchronize(factory.stream));
+  return arrow::Table::Make(arrow::schema(fields), arrays);
+}
+
+}  // namespace
+
+std::shared_ptr<arrow::Table> to_arrow(table_view input,
+                                       std::vector<std::string> const& column_names,
+                                       arrow::MemoryPool* ar_mr,
+                                       cudaStream_t stream)
+{
+  CUDF_EXPECTS(ar_mr != nullptr, "Arrow memory pool must not be null");
+  return to_arrow_table(input, column_names, buffer_factory{ar_mr, nullptr, stream});
+}
+
+std::shared_ptr<arrow::Table> to_arrow_device(table_view input,
+                                              std::vector<std::string> const& column_names,
+                                              cudaStream_t stream)
+{
+  int device;
+  CUDA_TRY(cudaGetDevice(&device));
+  auto const manager = arrow::cuda::CudaDeviceManager::Instance().ValueOrDie();
+  auto const context = manager->GetContext(device).ValueOrDie();
+  return to_arrow_table(input, column_names, buffer_factory{nullptr, context, stream});
+}
+
+}  // namespace detail
+
+std::shared_ptr<arrow::Table> to_arrow(table_view input,
+                                       std::vector<std::string> const& column_names,
+                                       arrow::MemoryPool* ar_mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow(input, column_names, ar_mr);
+}
+
+std::shared_ptr<arrow::Table> to_arrow_device(table_view input,
+                                              std::vector<std::string> const& column_names)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_device(input, column_names);
+}
+
+}  // namespace cudf
@@ -80,7 +80,10 @@ bool container::parse(file_metadata *md, size_t max_num_rows, size_t first_row)
       first_row -= object_count;
     }
     m_cur += block_size;
-    m_cur += 16;  // TODO: Validate sync marker
+    // Every block is followed by the file's sync marker; a mismatch means the block size was
+    // corrupted and the rest of the block index cannot be trusted
+    if (memcmp(m_cur, md->sync_marker, 16) != 0) { return false; }
+    m_cur += 16;
   }
   md->max_block_size  = max_block_size;
   md->num_rows        = total_object_count;
@@ -16,13 +16,19 @@
 #include <io/utilities/block_utils.cuh>
 #include "avro_gpu.h"
 
+#include <cudf/detail/utilities/launch_config.hpp>
+
 namespace cudf {
 namespace io {
 namespace avro {
 namespace gpu {
-#define NWARPS 16
+#define NWARPS 16  // Largest number of warps per block; the default
 #define MAX_SHARED_SCHEMA_LEN 1000
 
+// The block size is a multiple of the warp size, one data block per warp
+cudf::detail::tunable_kernel const decode_avro_column_data_config{
+  "avro_decode_column_data", NWARPS * 32, {128, 256, 512}};
+
 /*
  * Avro varint encoding - see
  * https://avro.apache.org/docs/1.2.0/spec.html#binary_encoding
@@ -224,7 +230,7 @@ static const uint8_t *__device__ avro_decode_row(const schemadesc_s *schema,
  * @param[in] first_row Crop all rows below first_row
  *
  **/
-// blockDim {32,NWARPS,1}
+// blockDim {32,num_warps,1}, num_warps <= NWARPS
 extern "C" __global__ void __launch_bounds__(NWARPS * 32, 2)
   gpuDecodeAvroColumnData(block_desc_s *blocks,
                           schemadesc_s *schema_g,
@@ -242,7 +248,7 @@ extern "C" __global__ void __launch_bounds__(NWARPS * 32, 2)
 
   schemadesc_s *schema;
   block_desc_s *const blk = &blk_g[threadIdx.y];
-  uint32_t block_id       = blockIdx.x * NWARPS + threadIdx.y;
+  uint32_t block_id       = blockIdx.x * blockDim.y + threadIdx.y;
   size_t cur_row;
   uint32_t rows_remaining;
   const uint8_t *cur, *end;
@@ -251,7 +257,7 @@ extern "C" __global__ void __launch_bounds__(NWARPS * 32, 2)
   if (schema_len <= MAX_SHARED_SCHEMA_LEN) {
     for (int i = threadIdx.y * 32 + threadIdx.x;
          i < schema_len * sizeof(schemadesc_s) / sizeof(uint32_t);
-         i += NWARPS * 32) {
+         i += blockDim.y * 32) {
       reinterpret_cast<uint32_t *>(&g_shared_schema)[i] =
         reinterpret_cast<const uint32_t *>(schema_g)[i];
     }
@@ -333,9 +339,11 @@ cudaError_t __host__ DecodeAvroColumnData(block_desc_s *blocks,
                                           uint32_t min_row_size,
                                           cudaStream_t stream)
 {
-  dim3 dim_block(32, NWARPS);  // NWARPS warps per threadblock
-  dim3 dim_grid((num_blocks + NWARPS - 1) / NWARPS,
-                1);  // 1 warp per datablock, NWARPS datablocks per threadblock
+  cudf::detail::tuned_launch launch(decode_avro_column_data_config, num_blocks, stream);
+  uint32_t const num_warps = launch.block_size() / 32;
+  dim3 dim_block(32, num_warps);  // num_warps warps per threadblock
+  dim3 dim_grid((num_blocks + num_warps - 1) / num_warps,
+                1);  // 1 warp per datablock, num_warps datablocks per threadblock
   gpuDecodeAvroColumnData<<<dim_grid, dim_block, 0, stream>>>(blocks,
                                                               schema,
                                                               global_dictionary,
@@ -21,7 +21,7 @@
 
 #include "reader_impl.hpp"
 
-#include <io/comp/gpuinflate.h>
+#include <io/comp/gpu_decompressor.h>
 
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
@@ -30,6 +30,8 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <numeric>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -134,23 +136,24 @@ class metadata : public file_metadata {
   datasource *const source;
 };
 
-rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_block_data,
+rmm::device_buffer reader::impl::decompress_data(const datasource::buffer &host_block_data,
+                                                 const rmm::device_buffer &comp_block_data,
                                                  cudaStream_t stream)
 {
   size_t uncompressed_data_size = 0;
-  hostdevice_vector<gpu_inflate_input_s> inflate_in(_metadata->block_list.size());
-  hostdevice_vector<gpu_inflate_status_s> inflate_out(_metadata->block_list.size());
+  std::vector<gpu_inflate_input_s> inflate_in(_metadata->block_list.size());
 
+  const auto base_offset = _metadata->block_list[0].offset;
   if (_metadata->codec == "deflate") {
     // Guess an initial maximum uncompressed block size
     uint32_t initial_blk_len = (_metadata->max_block_size * 2 + 0xfff) & ~0xfff;
     uncompressed_data_size   = initial_blk_len * _metadata->block_list.size();
     for (size_t i = 0; i < inflate_in.size(); ++i) { inflate_in[i].dstSize = initial_blk_len; }
   } else if (_metadata->codec == "snappy") {
-    // Extract the uncompressed length from the snappy stream
+    // Extract the uncompressed length from the snappy stream, using the host copy of the blocks
+    // rather than reading each block header from the source separately
     for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-      const auto buffer  = _source->host_read(_metadata->block_list[i].offset, 4);
-      const uint8_t *blk = buffer->data();
+      const uint8_t *blk = host_block_data.data() + (_metadata->block_list[i].offset - base_offset);
       uint32_t blk_len   = blk[0];
       if (blk_len > 0x7f) {
         blk_len = (blk_len & 0x7f) | (blk[1] << 7);
@@ -168,7 +171,6 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
 
   rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
 
-  const auto base_offset = _metadata->block_list[0].offset;
   for (size_t i = 0, dst_pos = 0; i < _metadata->block_list.size(); i++) {
     const auto src_pos = _metadata->block_list[i].offset - base_offset;
 
@@ -182,53 +184,46 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
     dst_pos += _metadata->block_list[i].size;
   }
 
+  // Blocks to (re)decompress: all of them at first, then only those whose output did not fit
+  std::vector<size_t> pending(_metadata->block_list.size());
+  std::iota(pending.begin(), pending.end(), 0);
+  auto const codec = (_metadata->codec == "deflate") ? gpu_codec::INFLATE : gpu_codec::SNAPPY;
   for (int loop_cnt = 0; loop_cnt < 2; loop_cnt++) {
-    CUDA_TRY(cudaMemcpyAsync(inflate_in.device_ptr(),
-                             inflate_in.host_ptr(),
-                             inflate_in.memory_size(),
-                             cudaMemcpyHostToDevice,
-                             stream));
-    CUDA_TRY(cudaMemsetAsync(inflate_out.device_ptr(), 0, inflate_out.memory_size(), stream));
-    if (_metadata->codec == "deflate") {
-      CUDA_TRY(gpuinflate(
-        inflate_in.device_ptr(), inflate_out.device_ptr(), inflate_in.size(), 0, stream));
-    } else if (_metadata->codec == "snappy") {
-      CUDA_TRY(
-        gpu_unsnap(inflate_in.device_ptr(), inflate_out.device_ptr(), inflate_in.size(), stream));
-    } else {
-      CUDF_FAIL("Unsupported compression codec\n");
-    }
-    CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(),
-                             inflate_out.device_ptr(),
-                             inflate_out.memory_size(),
-                             cudaMemcpyDeviceToHost,
-                             stream));
-    CUDA_TRY(cudaStreamSynchronize(stream));
+    std::vector<gpu_inflate_input_s> batch_in(pending.size());
+    std::vector<gpu_inflate_status_s> batch_out(pending.size());
+    for (size_t i = 0; i < pending.size(); ++i) { batch_in[i] = inflate_in[pending[i]]; }
+    _decompressor.decompress(codec, batch_in.data(), batch_out.data(), batch_in.size(), stream);
 
     // Check if larger output is required, as it's not known ahead of time
     if (_metadata->codec == "deflate" && !loop_cnt) {
-      size_t actual_uncompressed_size = 0;
-      for (size_t i = 0; i < _metadata->block_list.size(); i++) {
+      std::vector<size_t> overflowed;
+      size_t overflow_size = 0;
+      for (size_t i = 0; i < pending.size(); i++) {
         // If error status is 1 (buffer too small), the `bytes_written` field
         // is actually contains the uncompressed data size
-        if (inflate_out[i].status == 1 && inflate_out[i].bytes_written > inflate_in[i].dstSize) {
-          inflate_in[i].dstSize = inflate_out[i].bytes_written;
+        if (batch_out[i].status == 1 && batch_out[i].bytes_written > batch_in[i].dstSize) {
+          inflate_in[pending[i]].dstSize = batch_out[i].bytes_written;
+          overflowed.push_back(pending[i]);
+          overflow_size += batch_out[i].bytes_written;
         }
-        actual_uncompressed_size += inflate_in[i].dstSize;
       }
-      if (actual_uncompressed_size > uncompressed_data_size) {
-        decomp_block_data.resize(actual_uncompressed_size);
-        for (size_t i = 0, dst_pos = 0; i < _metadata->block_list.size(); i++) {
-          auto dst_base           = static_cast<uint8_t *>(decomp_block_data.data());
-          inflate_in[i].dstDevice = dst_base + dst_pos;
-
-          _metadata->block_list[i].offset = dst_pos;
-          _metadata->block_list[i].size   = static_cast<uint32_t>(inflate_in[i].dstSize);
-          dst_pos += _metadata->block_list[i].size;
-        }
-      } else {
-        break;
+      if (overflowed.empty()) { break; }
+
+      // Resizing keeps the blocks already decompressed in place; only the overflowed blocks are
+      // decompressed again, into new space appended at the end of the buffer
+      auto dst_pos = decomp_block_data.size();
+      decomp_block_data.resize(dst_pos + overflow_size);
+      auto dst_base = static_cast<uint8_t *>(decomp_block_data.data());
+      for (size_t i = 0; i < inflate_in.size(); i++) {
+        inflate_in[i].dstDevice = dst_base + _metadata->block_list[i].offset;
+      }
+      for (auto blk : overflowed) {
+        inflate_in[blk].dstDevice         = dst_base + dst_pos;
+        _metadata->block_list[blk].offset = dst_pos;
+        _metadata->block_list[blk].size   = static_cast<uint32_t>(inflate_in[blk].dstSize);
+        dst_pos += _metadata->block_list[blk].size;
       }
+      pending = std::move(overflowed);
     } else {
       break;
     }
@@ -383,7 +378,7 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, cudaStream_t
       rmm::device_buffer block_data(buffer->data(), buffer->size(), stream);
 
       if (_metadata->codec != "" && _metadata->codec != "null") {
-        auto decomp_block_data = decompress_data(block_data, stream);
+        auto decomp_block_data = decompress_data(*buffer, block_data, stream);
         block_data             = std::move(decomp_block_data);
       } else {
         auto dst_ofs = _metadata->block_list[0].offset;
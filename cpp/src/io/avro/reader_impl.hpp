@@ -24,6 +24,7 @@
 #include "avro.h"
 #include "avro_gpu.h"
 
+#include <io/comp/gpu_decompressor.h>
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 
@@ -76,12 +77,14 @@ class reader::impl {
   /**
    * @brief Decompresses the block data.
    *
+   * @param host_block_data Compressed block data in host memory
    * @param comp_block_data Compressed block data
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return Device buffer to decompressed block data
    */
-  rmm::device_buffer decompress_data(const rmm::device_buffer &comp_block_data,
+  rmm::device_buffer decompress_data(const datasource::buffer &host_block_data,
+                                     const rmm::device_buffer &comp_block_data,
                                      cudaStream_t stream);
 
   /**
@@ -109,6 +112,9 @@ class reader::impl {
   std::unique_ptr<metadata> _metadata;
 
   std::vector<std::string> _columns;
+
+  // Kept across the reads of the reader to reuse its scratch memory
+  gpu_decompressor _decompressor;
 };
 
 }  // namespace avro
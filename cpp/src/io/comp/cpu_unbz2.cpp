@@ -525,8 +525,12 @@ static void bzUnRLE(unbz_state_s *s)
   s->out = out;
 }
 
-int32_t cpu_bz2_uncompress(
-  const uint8_t *source, size_t sourceLen, uint8_t *dest, size_t *destLen, uint64_t *block_start)
+static int32_t bz2_uncompress(const uint8_t *source,
+                              size_t sourceLen,
+                              uint8_t *dest,
+                              size_t *destLen,
+                              uint64_t *block_start,
+                              bool single_block)
 {
   unbz_state_s s;
   uint32_t v;
@@ -586,13 +590,13 @@ int32_t cpu_bz2_uncompress(
         ret = (s.out < s.outend) ? BZ_UNEXPECTED_EOF : BZ_OUTBUFF_FULL;
       }
     }
-  } while (ret == BZ_OK);
+  } while (ret == BZ_OK && !single_block);
 
-  if (ret == BZ_STREAM_END) {
+  if (ret == BZ_STREAM_END || (single_block && ret == BZ_OK)) {
     // normal termination
     last_valid_block_in  = ((s.cur - s.base) << 3) + (s.bitpos);
     last_valid_block_out = s.out - s.outbase;
-    ret                  = BZ_OK;
+    if (!single_block) { ret = BZ_OK; }
   }
 
   *destLen = last_valid_block_out;
@@ -603,5 +607,18 @@ int32_t cpu_bz2_uncompress(
   return ret;
 }
 
+int32_t cpu_bz2_uncompress(
+  const uint8_t *source, size_t sourceLen, uint8_t *dest, size_t *destLen, uint64_t *block_start)
+{
+  return bz2_uncompress(source, sourceLen, dest, destLen, block_start, false);
+}
+
+int32_t cpu_bz2_uncompress_block(
+  const uint8_t *source, size_t sourceLen, uint8_t *dest, size_t *destLen, uint64_t *block_start)
+{
+  if (block_start == NULL) return BZ_PARAM_ERROR;
+  return bz2_uncompress(source, sourceLen, dest, destLen, block_start, true);
+}
+
 }  // namespace io
 }  // namespace cudf
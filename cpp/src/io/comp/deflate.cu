@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/block_utils.cuh>
+#include "gpuinflate.h"
+#include "lz77.cuh"
+
+namespace cudf {
+namespace io {
+#define MAX_COPY_LENGTH 64  // Same as snappy; DEFLATE allows up to 258
+
+/**
+ * @brief deflate compressor state
+ **/
+struct deflate_state_s {
+  const uint8_t *src;                 ///< Ptr to uncompressed data
+  uint32_t src_len;                   ///< Uncompressed data length
+  uint8_t *dst_base;                  ///< Base ptr to output compressed data
+  uint8_t *dst;                       ///< Current ptr to uncompressed data
+  uint8_t *end;                       ///< End of uncompressed data buffer
+  volatile uint32_t literal_length;   ///< Number of literal bytes
+  volatile uint32_t copy_length;      ///< Number of copy bytes
+  volatile uint32_t copy_distance;    ///< Distance for copy bytes
+  uint32_t bit_buf;                   ///< Pending output bits, not yet forming a complete byte
+  uint32_t bit_count;                 ///< Number of pending output bits (less than 8)
+  uint32_t lit_bits[10];              ///< Bit-packing area for up to 32 literal codes
+  uint32_t crc_table[256];            ///< CRC32 lookup table
+  uint32_t crc_shift[32];             ///< CRC32 of one slice of zeros for each initial CRC bit
+  uint32_t crc_slice[128];            ///< CRC32 of each slice of the uncompressed data
+  uint16_t hash_map[1 << HASH_BITS];  ///< Low 16-bit offset from hash
+};
+
+/**
+ * @brief Appends up to 24 bits to the output bitstream (assumed to be called by a single thread)
+ *
+ * @param s Compressor state
+ * @param dst Destination compressed byte stream
+ * @param end End of compressed data buffer
+ * @param v Bits to write, LSB first
+ * @param n Number of bits
+ *
+ * @return Updated pointer to compressed byte stream
+ **/
+static __device__ uint8_t *PutBits(
+  deflate_state_s *s, uint8_t *dst, uint8_t *end, uint32_t v, uint32_t n)
+{
+  uint32_t bit_buf   = s->bit_buf | (v << s->bit_count);
+  uint32_t bit_count = s->bit_count + n;
+  while (bit_count >= 8) {
+    if (dst < end) { dst[0] = bit_buf; }
+    dst++;
+    bit_buf >>= 8;
+    bit_count -= 8;
+  }
+  s->bit_buf   = bit_buf;
+  s->bit_count = bit_count;
+  return dst;
+}
+
+/**
+ * @brief Outputs literals with the fixed Huffman code (warp-wide)
+ *
+ * Each lane encodes one literal; the codes are packed into `lit_bits` at positions given by a
+ * warp-wide prefix sum of the code lengths.
+ *
+ * @param s Compressor state
+ * @param dst Destination compressed byte stream
+ * @param end End of compressed data buffer
+ * @param src Pointer to literal bytes
+ * @param len Number of literal bytes
+ * @param t Thread in warp
+ *
+ * @return Updated pointer to compressed byte stream
+ **/
+static __device__ uint8_t *StoreLiterals(
+  deflate_state_s *s, uint8_t *dst, uint8_t *end, const uint8_t *src, uint32_t len, uint32_t t)
+{
+  for (uint32_t i = 0; i < len; i += 32) {
+    uint32_t code = 0, nbits = 0;
+    if (i + t < len) {
+      uint32_t c = src[i + t];
+      if (c < 144) {
+        code  = __brev(0x30 + c) >> 24;
+        nbits = 8;
+      } else {
+        code  = __brev(0x190 + c - 144) >> 23;
+        nbits = 9;
+      }
+    }
+    uint32_t pos   = WarpReducePos32(nbits, t) - nbits + s->bit_count;
+    uint32_t total = SHFL(pos + nbits, 31);
+    if (t < 10) { s->lit_bits[t] = (t == 0) ? s->bit_buf : 0; }
+    SYNCWARP();
+    if (nbits != 0) {
+      uint32_t bit = pos & 0x1f;
+      atomicOr(&s->lit_bits[pos >> 5], code << bit);
+      if (bit + nbits > 32) { atomicOr(&s->lit_bits[(pos >> 5) + 1], code >> (32 - bit)); }
+    }
+    SYNCWARP();
+    uint32_t num_bytes = total >> 3;
+    for (uint32_t k = t; k < num_bytes; k += 32) {
+      if (dst + k < end) { dst[k] = s->lit_bits[k >> 2] >> ((k & 3) * 8); }
+    }
+    dst += num_bytes;
+    SYNCWARP();
+    if (t == 0) {
+      s->bit_buf   = (s->lit_bits[num_bytes >> 2] >> ((num_bytes & 3) * 8)) & 0xff;
+      s->bit_count = total & 7;
+    }
+    SYNCWARP();
+  }
+  return dst;
+}
+
+/**
+ * @brief Outputs a length/distance pair with the fixed Huffman code (assumed to be called by a
+ * single thread)
+ *
+ * @param s Compressor state
+ * @param dst Destination compressed byte stream
+ * @param end End of compressed data buffer
+ * @param copy_len Copy length (3..258)
+ * @param distance Copy distance (1..32768)
+ *
+ * @return Updated pointer to compressed byte stream
+ **/
+static __device__ uint8_t *StoreCopy(
+  deflate_state_s *s, uint8_t *dst, uint8_t *end, uint32_t copy_len, uint32_t distance)
+{
+  uint32_t len = copy_len - 3, code, extra_bits = 0, extra = 0;
+  if (len < 8) {
+    code = 257 + len;
+  } else if (copy_len == 258) {
+    code = 285;
+  } else {
+    uint32_t hb = 31 - __clz(len);
+    extra_bits  = hb - 2;
+    extra       = len & ((1 << extra_bits) - 1);
+    code        = 257 + 4 * (hb - 1) + ((len >> extra_bits) & 3);
+  }
+  // Length codes 256..279 use 7 bits, 280..287 use 8 bits
+  if (code < 280) {
+    dst = PutBits(s, dst, end, __brev(code - 256) >> 25, 7);
+  } else {
+    dst = PutBits(s, dst, end, __brev(0xc0 + code - 280) >> 24, 8);
+  }
+  if (extra_bits != 0) { dst = PutBits(s, dst, end, extra, extra_bits); }
+  uint32_t dist = distance - 1;
+  if (dist < 4) {
+    code       = dist;
+    extra_bits = 0;
+  } else {
+    uint32_t hb = 31 - __clz(dist);
+    extra_bits  = hb - 1;
+    extra       = dist & ((1 << extra_bits) - 1);
+    code        = 2 * hb + ((dist >> extra_bits) & 1);
+  }
+  dst = PutBits(s, dst, end, __brev(code) >> 27, 5);
+  if (extra_bits != 0) { dst = PutBits(s, dst, end, extra, extra_bits); }
+  return dst;
+}
+
+/**
+ * @brief Computes the CRC32 of the uncompressed data (block-wide)
+ *
+ * The input is split into 128 equal slices aligned to the end of the data (the first non-empty
+ * slice may be shorter). Each thread computes the CRC of its slice, and thread 0 combines them by
+ * advancing the running CRC over one slice of zeros before XORing in the next slice's CRC.
+ *
+ * @param s Compressor state
+ * @param t Thread in block
+ *
+ * @return CRC32 (valid in thread 0 only)
+ **/
+static __device__ uint32_t ComputeCRC32(deflate_state_s *s, uint32_t t)
+{
+  const uint8_t *src = s->src;
+  uint32_t len       = s->src_len;
+  uint32_t slice_len = (len + 127) >> 7;
+  int32_t padding    = slice_len * 128 - len;
+  int32_t lo         = static_cast<int32_t>(t * slice_len) - padding;
+  int32_t hi         = lo + slice_len;
+  uint32_t crc       = (lo <= 0) ? ~0 : 0;
+  for (int32_t i = max(lo, 0); i < hi; i++) {
+    crc = s->crc_table[(crc ^ src[i]) & 0xff] ^ (crc >> 8);
+  }
+  s->crc_slice[t] = (hi > 0) ? crc : 0;
+  if (t < 32) {
+    crc = 1 << t;
+    for (uint32_t i = 0; i < slice_len; i++) { crc = s->crc_table[crc & 0xff] ^ (crc >> 8); }
+    s->crc_shift[t] = crc;
+  }
+  __syncthreads();
+  crc = 0;
+  if (t == 0 && len != 0) {
+    for (uint32_t i = 0; i < 128; i++) {
+      uint32_t shifted = 0;
+      for (uint32_t b = 0; b < 32; b++) {
+        if (crc & (1 << b)) { shifted ^= s->crc_shift[b]; }
+      }
+      crc = shifted ^ s->crc_slice[i];
+    }
+    crc = ~crc;
+  }
+  return crc;
+}
+
+/**
+ * @brief DEFLATE compression kernel using the fixed Huffman codes
+ * See https://tools.ietf.org/html/rfc1951
+ *
+ * blockDim {128,1,1}
+ *
+ * @param[in] inputs Source/Destination buffer information per block
+ * @param[out] outputs Compression status per block
+ * @param[in] count Number of blocks to compress
+ **/
+extern "C" __global__ void __launch_bounds__(128)
+  deflate_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count)
+{
+  __shared__ __align__(16) deflate_state_s state_g;
+
+  deflate_state_s *const s = &state_g;
+  uint32_t t               = threadIdx.x;
+  uint32_t pos;
+  const uint8_t *src;
+
+  if (!t) {
+    uint8_t *dst      = reinterpret_cast<uint8_t *>(inputs[blockIdx.x].dstDevice);
+    uint32_t dst_len  = static_cast<uint32_t>(inputs[blockIdx.x].dstSize);
+    s->src            = reinterpret_cast<const uint8_t *>(inputs[blockIdx.x].srcDevice);
+    s->src_len        = static_cast<uint32_t>(inputs[blockIdx.x].srcSize);
+    s->dst_base       = dst;
+    s->dst            = dst;
+    s->end            = dst + dst_len;
+    s->literal_length = 0;
+    s->copy_length    = 0;
+    s->copy_distance  = 0;
+    s->bit_buf        = 1 << 1;  // BFINAL=0, BTYPE=01 (fixed Huffman codes)
+    s->bit_count      = 3;
+  }
+  for (uint32_t i = t; i < sizeof(s->hash_map) / sizeof(uint32_t); i += 128) {
+    *reinterpret_cast<volatile uint32_t *>(&s->hash_map[i * 2]) = 0;
+  }
+  for (uint32_t i = t; i < 256; i += 128) {
+    uint32_t c = i;
+    for (int k = 0; k < 8; k++) { c = (c & 1) ? 0xedb88320 ^ (c >> 1) : c >> 1; }
+    s->crc_table[i] = c;
+  }
+  __syncthreads();
+  src = s->src;
+  pos = 0;
+  while (pos < s->src_len) {
+    uint32_t literal_len = s->literal_length;
+    uint32_t copy_len    = s->copy_length;
+    uint32_t distance    = s->copy_distance;
+    __syncthreads();
+    if (t < 32) {
+      // WARP0: Encode literals and copies
+      uint8_t *dst = s->dst;
+      uint8_t *end = s->end;
+      if (literal_len > 0) {
+        dst = StoreLiterals(s, dst, end, src + pos, literal_len, t);
+        pos += literal_len;
+      }
+      if (copy_len > 0) {
+        if (t == 0) { dst = StoreCopy(s, dst, end, copy_len, distance); }
+        pos += copy_len;
+      }
+      SYNCWARP();
+      if (t == 0) { s->dst = dst; }
+    } else {
+      pos += literal_len + copy_len;
+      if (t < 32 * 2) {
+        // WARP1: Find a match using 12-bit hashes of 4-byte blocks
+        uint32_t t5 = t & 0x1f;
+        literal_len = FindFourByteMatch(s, src, pos, t5);
+        if (t5 == 0) { s->literal_length = literal_len; }
+        SYNCWARP();
+        copy_len = s->copy_length;
+        if (copy_len != 0) {
+          uint32_t match_pos = pos + literal_len + copy_len;  // NOTE: copy_len is always 4 here
+          copy_len += Match60(src + match_pos,
+                              src + match_pos - s->copy_distance,
+                              min(s->src_len - match_pos, MAX_COPY_LENGTH - copy_len),
+                              t5);
+          if (t5 == 0) { s->copy_length = copy_len; }
+        }
+      }
+    }
+    __syncthreads();
+  }
+  __syncthreads();
+  uint32_t crc = ComputeCRC32(s, t);
+  if (!t) {
+    uint8_t *dst = s->dst;
+    uint8_t *end = s->end;
+    // End-of-block code, then an empty stored block so that the output ends on a byte boundary
+    // and the compressed chunks can be concatenated into a single stream
+    dst = PutBits(s, dst, end, 0, 7);
+    dst = PutBits(s, dst, end, 0, 3);
+    if (s->bit_count != 0) { dst = PutBits(s, dst, end, 0, 8 - s->bit_count); }
+    for (uint32_t i = 0; i < 4; i++, dst++) {
+      if (dst < end) { dst[0] = (i < 2) ? 0x00 : 0xff; }
+    }
+    outputs[blockIdx.x].bytes_written = dst - s->dst_base;
+    outputs[blockIdx.x].status        = (dst > end) ? 1 : 0;
+    outputs[blockIdx.x].reserved      = crc;
+  }
+}
+
+cudaError_t __host__ gpu_deflate(gpu_inflate_input_s *inputs,
+                                 gpu_inflate_status_s *outputs,
+                                 int count,
+                                 cudaStream_t stream)
+{
+  dim3 dim_block(128, 1);  // 4 warps per stream, 1 stream per block
+  dim3 dim_grid(count, 1);
+  if (count > 0) { deflate_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count); }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpu_decompressor.h"
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf {
+namespace io {
+
+namespace {
+
+// Smallest uncompressed block size of each bucket, from the largest blocks to the smallest
+constexpr std::array<uint64_t, gpu_decompressor::num_buckets> bucket_min_size{
+  1024 * 1024, 64 * 1024, 0};
+
+int get_bucket(uint64_t uncompressed_size)
+{
+  int bucket = 0;
+  while (uncompressed_size < bucket_min_size[bucket]) { bucket++; }
+  return bucket;
+}
+
+}  // namespace
+
+const char *gpu_codec_name(gpu_codec codec)
+{
+  switch (codec) {
+    case gpu_codec::INFLATE: return "DEFLATE";
+    case gpu_codec::GZIP: return "GZIP";
+    case gpu_codec::SNAPPY: return "SNAPPY";
+    case gpu_codec::BROTLI: return "BROTLI";
+    case gpu_codec::ZSTD: return "ZSTD";
+    default: return "UNKNOWN";
+  }
+}
+
+gpu_decompressor::gpu_decompressor()
+{
+  for (auto &strm : _streams) { CUDA_TRY(cudaStreamCreateWithFlags(&strm, cudaStreamNonBlocking)); }
+  for (auto &event : _done) { CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming)); }
+  CUDA_TRY(cudaEventCreateWithFlags(&_ready, cudaEventDisableTiming));
+}
+
+gpu_decompressor::~gpu_decompressor()
+{
+  for (auto &timing : _pending) {
+    cudaEventSynchronize(timing.stop);
+    cudaEventDestroy(timing.start);
+    cudaEventDestroy(timing.stop);
+  }
+  for (auto strm : _streams) {
+    cudaStreamSynchronize(strm);
+    cudaStreamDestroy(strm);
+  }
+  for (auto event : _done) { cudaEventDestroy(event); }
+  cudaEventDestroy(_ready);
+}
+
+void gpu_decompressor::launch(gpu_codec codec,
+                              gpu_inflate_input_s *inputs,
+                              gpu_inflate_status_s *outputs,
+                              size_t count,
+                              int bucket,
+                              cudaStream_t stream)
+{
+  switch (codec) {
+    case gpu_codec::INFLATE: CUDA_TRY(gpuinflate(inputs, outputs, count, 0, stream)); break;
+    case gpu_codec::GZIP: CUDA_TRY(gpuinflate(inputs, outputs, count, 1, stream)); break;
+    case gpu_codec::SNAPPY: CUDA_TRY(gpu_unsnap(inputs, outputs, count, stream)); break;
+    case gpu_codec::BROTLI: {
+      // Concurrent launches each need their own heap
+      auto &scratch     = _brotli_scratch[bucket];
+      auto const needed = get_gpu_debrotli_scratch_size(count);
+      if (scratch.size() < needed) {
+        scratch = rmm::device_buffer(needed, stream, get_scratch_resource());
+      }
+      CUDA_TRY(gpu_debrotli(inputs, outputs, scratch.data(), scratch.size(), count, stream));
+      break;
+    }
+    case gpu_codec::ZSTD: CUDA_TRY(gpu_unzstd(inputs, outputs, count, stream)); break;
+    default: CUDF_FAIL("Unexpected decompression dispatch");
+  }
+}
+
+void gpu_decompressor::decompress(gpu_codec codec,
+                                  gpu_inflate_input_s const *inputs,
+                                  gpu_inflate_status_s *statuses,
+                                  size_t count,
+                                  cudaStream_t stream)
+{
+  if (count == 0) { return; }
+  if (!_inputs || _inputs->max_size() < count) {
+    _inputs   = std::make_unique<hostdevice_vector<gpu_inflate_input_s>>(count, stream);
+    _statuses = std::make_unique<hostdevice_vector<gpu_inflate_status_s>>(count, stream);
+  }
+
+  // Largest blocks first, so that the buckets are contiguous
+  std::vector<size_t> order(count);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return inputs[a].dstSize > inputs[b].dstSize;
+  });
+  auto &stats = _stats[static_cast<int>(codec)];
+  std::array<size_t, num_buckets + 1> bucket_start{};
+  for (size_t i = 0; i < count; i++) {
+    auto const &input = inputs[order[i]];
+    (*_inputs)[i]     = input;
+    bucket_start[get_bucket(input.dstSize) + 1] = i + 1;
+    stats.compressed_bytes += input.srcSize;
+    stats.uncompressed_bytes += input.dstSize;
+  }
+  for (int b = 0; b < num_buckets; b++) {
+    bucket_start[b + 1] = std::max(bucket_start[b + 1], bucket_start[b]);
+  }
+  stats.num_blocks += count;
+
+  CUDA_TRY(cudaMemcpyAsync(_inputs->device_ptr(),
+                           _inputs->host_ptr(),
+                           count * sizeof(gpu_inflate_input_s),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  CUDA_TRY(
+    cudaMemsetAsync(_statuses->device_ptr(), 0, count * sizeof(gpu_inflate_status_s), stream));
+  cudaEvent_t start, stop;
+  CUDA_TRY(cudaEventCreate(&start));
+  CUDA_TRY(cudaEventCreate(&stop));
+  CUDA_TRY(cudaEventRecord(start, stream));
+  CUDA_TRY(cudaEventRecord(_ready, stream));
+  for (int b = 0; b < num_buckets; b++) {
+    auto const first = bucket_start[b];
+    auto const num   = bucket_start[b + 1] - first;
+    if (num == 0) { continue; }
+    CUDA_TRY(cudaStreamWaitEvent(_streams[b], _ready, 0));
+    launch(codec, _inputs->device_ptr(first), _statuses->device_ptr(first), num, b, _streams[b]);
+    CUDA_TRY(cudaEventRecord(_done[b], _streams[b]));
+    CUDA_TRY(cudaStreamWaitEvent(stream, _done[b], 0));
+  }
+  CUDA_TRY(cudaEventRecord(stop, stream));
+  add_timing(codec, start, stop);
+
+  CUDA_TRY(cudaMemcpyAsync(_statuses->host_ptr(),
+                           _statuses->device_ptr(),
+                           count * sizeof(gpu_inflate_status_s),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  for (size_t i = 0; i < count; i++) {
+    if ((*_statuses)[i].status != 0) { stats.num_failed++; }
+    if (statuses != nullptr) { statuses[order[i]] = (*_statuses)[i]; }
+  }
+}
+
+void gpu_decompressor::decompress_async(gpu_codec codec,
+                                        gpu_inflate_input_s *inputs,
+                                        gpu_inflate_status_s *statuses,
+                                        size_t count,
+                                        size_t compressed_bytes,
+                                        size_t uncompressed_bytes,
+                                        cudaStream_t stream)
+{
+  if (count == 0) { return; }
+  auto &stats = _stats[static_cast<int>(codec)];
+  stats.num_blocks += count;
+  stats.compressed_bytes += compressed_bytes;
+  stats.uncompressed_bytes += uncompressed_bytes;
+
+  cudaEvent_t start, stop;
+  CUDA_TRY(cudaEventCreate(&start));
+  CUDA_TRY(cudaEventCreate(&stop));
+  CUDA_TRY(cudaEventRecord(start, stream));
+  launch(codec, inputs, statuses, count, 0, stream);
+  CUDA_TRY(cudaEventRecord(stop, stream));
+  add_timing(codec, start, stop);
+}
+
+void gpu_decompressor::add_timing(gpu_codec codec, cudaEvent_t start, cudaEvent_t stop)
+{
+  _pending.push_back({codec, start, stop});
+}
+
+void gpu_decompressor::resolve_timings()
+{
+  for (auto &timing : _pending) {
+    float elapsed_ms = 0;
+    CUDA_TRY(cudaEventSynchronize(timing.stop));
+    CUDA_TRY(cudaEventElapsedTime(&elapsed_ms, timing.start, timing.stop));
+    _stats[static_cast<int>(timing.codec)].elapsed_ms += elapsed_ms;
+    CUDA_TRY(cudaEventDestroy(timing.start));
+    CUDA_TRY(cudaEventDestroy(timing.stop));
+  }
+  _pending.clear();
+}
+
+decompression_stats const &gpu_decompressor::stats(gpu_codec codec)
+{
+  CUDF_EXPECTS(codec < gpu_codec::NUM_CODECS, "Invalid codec");
+  resolve_timings();
+  return _stats[static_cast<int>(codec)];
+}
+
+void gpu_decompressor::reset_stats()
+{
+  resolve_timings();
+  _stats.fill(decompression_stats{});
+}
+
+size_t gpu_decompressor::scratch_size() const
+{
+  size_t size = 0;
+  if (_inputs) {
+    size += _inputs->max_size() * (sizeof(gpu_inflate_input_s) + sizeof(gpu_inflate_status_s));
+  }
+  for (auto const &scratch : _brotli_scratch) { size += scratch.size(); }
+  return size;
+}
+
+}  // namespace io
+}  // namespace cudf
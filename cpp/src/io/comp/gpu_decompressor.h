@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <io/comp/gpuinflate.h>
+#include <io/utilities/hostdevice_vector.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief GPU decompression codecs
+ **/
+enum class gpu_codec : int {
+  INFLATE = 0,  ///< Raw DEFLATE stream
+  GZIP,         ///< DEFLATE stream with a GZIP header
+  SNAPPY,
+  BROTLI,
+  ZSTD,
+  NUM_CODECS
+};
+
+/**
+ * @brief Returns the name of a codec, for reporting
+ **/
+const char *gpu_codec_name(gpu_codec codec);
+
+/**
+ * @brief Decompression statistics of a codec, accumulated over all the calls of a decompressor
+ **/
+struct decompression_stats {
+  size_t num_blocks         = 0;  ///< Number of blocks decompressed
+  size_t num_failed         = 0;  ///< Number of blocks returning an error status, when known
+  size_t compressed_bytes   = 0;  ///< Compressed input size
+  size_t uncompressed_bytes = 0;  ///< Uncompressed output size, as described by the inputs
+  double elapsed_ms         = 0;  ///< GPU time from the first to the last launch of each call
+
+  /**
+   * @brief Returns the uncompressed output bytes per second, or zero if nothing was timed
+   **/
+  double throughput() const
+  {
+    return (elapsed_ms > 0) ? uncompressed_bytes * 1000.0 / elapsed_ms : 0.0;
+  }
+};
+
+/**
+ * @brief Batched decompression of many independent blocks, shared by the readers
+ *
+ * Each block is decompressed by one thread block, so a launch lasts as long as its largest
+ * blocks. The host-described blocks of a call are therefore sorted by uncompressed size and split
+ * into size buckets, and each bucket is launched on its own stream: small blocks no longer wait
+ * behind the largest ones and the buckets overlap on the device. Within a bucket, the largest
+ * blocks are launched first.
+ *
+ * The argument arrays and the Brotli scratch memory (several megabytes per launch) are kept from
+ * one call to the next, so a reader decompressing many batches only allocates them once.
+ **/
+class gpu_decompressor {
+ public:
+  static constexpr int num_buckets = 3;
+
+  gpu_decompressor();
+
+  ~gpu_decompressor();
+
+  gpu_decompressor(gpu_decompressor const &) = delete;
+  gpu_decompressor &operator=(gpu_decompressor const &) = delete;
+
+  /**
+   * @brief Decompresses blocks whose descriptions are known on the host
+   *
+   * Returns once all the blocks are decompressed. The work is ordered after the previous work of
+   * `stream`, and the outputs can be used by later work of `stream`.
+   *
+   * @param[in] codec Compression codec of all the blocks
+   * @param[in] inputs Host array of the block descriptions, pointing to device memory
+   * @param[out] statuses Host array receiving the status of each block, or nullptr
+   * @param[in] count Number of blocks
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void decompress(gpu_codec codec,
+                  gpu_inflate_input_s const *inputs,
+                  gpu_inflate_status_s *statuses,
+                  size_t count,
+                  cudaStream_t stream = 0);
+
+  /**
+   * @brief Decompresses blocks whose descriptions are only known in device memory
+   *
+   * The blocks are decompressed in a single launch on `stream`, and the call does not wait for
+   * it. The sizes are only used for the statistics.
+   *
+   * @param[in] codec Compression codec of all the blocks
+   * @param[in] inputs Device array of the block descriptions
+   * @param[out] statuses Device array receiving the status of each block
+   * @param[in] count Number of blocks
+   * @param[in] compressed_bytes Total compressed size of the blocks, if known
+   * @param[in] uncompressed_bytes Total uncompressed size of the blocks, if known
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void decompress_async(gpu_codec codec,
+                        gpu_inflate_input_s *inputs,
+                        gpu_inflate_status_s *statuses,
+                        size_t count,
+                        size_t compressed_bytes,
+                        size_t uncompressed_bytes,
+                        cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns the statistics of a codec, waiting for the pending launches to be timed
+   **/
+  decompression_stats const &stats(gpu_codec codec);
+
+  /**
+   * @brief Clears the statistics of all the codecs
+   **/
+  void reset_stats();
+
+  /**
+   * @brief Returns the size of the scratch memory currently held by the decompressor
+   **/
+  size_t scratch_size() const;
+
+ private:
+  /**
+   * @brief Launches the decompression kernel of a codec
+   **/
+  void launch(gpu_codec codec,
+              gpu_inflate_input_s *inputs,
+              gpu_inflate_status_s *outputs,
+              size_t count,
+              int bucket,
+              cudaStream_t stream);
+
+  /**
+   * @brief Records the start and end events of a call for its statistics
+   **/
+  void add_timing(gpu_codec codec, cudaEvent_t start, cudaEvent_t stop);
+
+  /**
+   * @brief Accumulates the elapsed time of the pending calls
+   **/
+  void resolve_timings();
+
+  struct pending_timing {
+    gpu_codec codec;
+    cudaEvent_t start;
+    cudaEvent_t stop;
+  };
+
+  std::array<cudaStream_t, num_buckets> _streams{};
+  std::array<cudaEvent_t, num_buckets> _done{};
+  cudaEvent_t _ready = nullptr;
+  std::unique_ptr<hostdevice_vector<gpu_inflate_input_s>> _inputs;
+  std::unique_ptr<hostdevice_vector<gpu_inflate_status_s>> _statuses;
+  std::array<rmm::device_buffer, num_buckets> _brotli_scratch;
+  std::vector<pending_timing> _pending;
+  std::array<decompression_stats, static_cast<int>(gpu_codec::NUM_CODECS)> _stats;
+};
+
+}  // namespace io
+}  // namespace cudf
@@ -130,6 +130,44 @@ cudaError_t gpu_snap(gpu_inflate_input_s *inputs,
                      int count           = 1,
                      cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Interface for decompressing Zstandard-compressed data
+ *
+ * Multiple, independent chunks of compressed data can be decompressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk. Each chunk
+ * may contain several frames; frames using a dictionary are not supported.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_unzstd(gpu_inflate_input_s *inputs,
+                       gpu_inflate_status_s *outputs,
+                       int count           = 1,
+                       cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Interface for compressing data with DEFLATE, using the fixed Huffman codes
+ *
+ * Multiple, independent chunks of data can be compressed by using
+ * separate gpu_inflate_input_s/gpu_inflate_status_s pairs for each chunk.
+ * Each output is a non-final block followed by an empty stored block, so the outputs can be
+ * concatenated into a single stream that is terminated by a final empty block. The CRC32 of
+ * each uncompressed chunk is returned in the `reserved` field of its status.
+ *
+ * The output buffer should be at least `srcSize + srcSize / 8 + 16` bytes.
+ *
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t gpu_deflate(gpu_inflate_input_s *inputs,
+                        gpu_inflate_status_s *outputs,
+                        int count           = 1,
+                        cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace io
 }  // namespace cudf
 
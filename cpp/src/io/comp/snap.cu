@@ -16,17 +16,11 @@
 
 #include <io/utilities/block_utils.cuh>
 #include "gpuinflate.h"
+#include "lz77.cuh"
 
 namespace cudf {
 namespace io {
-#define HASH_BITS 12
-
-// TBD: Tentatively limits to 2-byte codes to prevent long copy search followed by long literal
-// encoding
-#define MAX_LITERAL_LENGTH 256
-
-#define MAX_COPY_LENGTH 64       // Syntax limit
-#define MAX_COPY_DISTANCE 32768  // Matches encoder limit as described in snappy format description
+#define MAX_COPY_LENGTH 64  // Syntax limit
 
 /**
  * @brief snappy compressor state
@@ -43,25 +37,6 @@ struct snap_state_s {
   uint16_t hash_map[1 << HASH_BITS];  ///< Low 16-bit offset from hash
 };
 
-/**
- * @brief 12-bit hash from four consecutive bytes
- **/
-static inline __device__ uint32_t snap_hash(uint32_t v)
-{
-  return (v * ((1 << 20) + (0x2a00) + (0x6a) + 1)) >> (32 - HASH_BITS);
-}
-
-/**
- * @brief Fetches four consecutive bytes
- **/
-static inline __device__ uint32_t fetch4(const uint8_t *src)
-{
-  uint32_t src_align    = 3 & reinterpret_cast<uintptr_t>(src);
-  const uint32_t *src32 = reinterpret_cast<const uint32_t *>(src - src_align);
-  uint32_t v            = src32[0];
-  return (src_align) ? __funnelshift_r(v, src32[1], src_align * 8) : v;
-}
-
 /**
  * @brief Outputs a snappy literal symbol
  *
@@ -149,102 +124,6 @@ static __device__ uint8_t *StoreCopy(uint8_t *dst,
   }
 }
 
-/**
- * @brief Returns mask of any thread in the warp that has a hash value
- * equal to that of the calling thread
- **/
-static inline __device__ uint32_t HashMatchAny(uint32_t v, uint32_t t)
-{
-#if (__CUDA_ARCH__ >= 700)
-  return __match_any_sync(~0, v);
-#else
-  uint32_t err_map = 0;
-  for (uint32_t i = 0; i < HASH_BITS; i++, v >>= 1) {
-    uint32_t b       = v & 1;
-    uint32_t match_b = BALLOT(b);
-    err_map |= match_b ^ -(int32_t)b;
-  }
-  return ~err_map;
-#endif
-}
-
-/**
- * @brief Finds the first occurrence of a consecutive 4-byte match in the input sequence,
- * or at most MAX_LITERAL_LENGTH bytes
- *
- * @param s Compressor state (copy_length set to 4 if a match is found, zero otherwise)
- * @param src Uncompressed buffer
- * @param pos0 Position in uncompressed buffer
- * @param t thread in warp
- *
- * @return Number of bytes before first match (literal length)
- **/
-static __device__ uint32_t FindFourByteMatch(snap_state_s *s,
-                                             const uint8_t *src,
-                                             uint32_t pos0,
-                                             uint32_t t)
-{
-  uint32_t len    = s->src_len;
-  uint32_t pos    = pos0;
-  uint32_t maxpos = pos0 + MAX_LITERAL_LENGTH - 31;
-  uint32_t match_mask, literal_cnt;
-  if (t == 0) { s->copy_length = 0; }
-  do {
-    bool valid4               = (pos + t + 4 <= len);
-    uint32_t data32           = (valid4) ? fetch4(src + pos + t) : 0;
-    uint32_t hash             = (valid4) ? snap_hash(data32) : 0;
-    uint32_t local_match      = HashMatchAny(hash, t);
-    uint32_t local_match_lane = 31 - __clz(local_match & ((1 << t) - 1));
-    uint32_t local_match_data = SHFL(data32, min(local_match_lane, t));
-    uint32_t offset, match;
-    if (valid4) {
-      if (local_match_lane < t && local_match_data == data32) {
-        match  = 1;
-        offset = pos + local_match_lane;
-      } else {
-        offset = (pos & ~0xffff) | s->hash_map[hash];
-        if (offset >= pos) { offset = (offset >= 0x10000) ? offset - 0x10000 : pos; }
-        match =
-          (offset < pos && offset + MAX_COPY_DISTANCE >= pos + t && fetch4(src + offset) == data32);
-      }
-    } else {
-      match       = 0;
-      local_match = 0;
-      offset      = pos + t;
-    }
-    match_mask = BALLOT(match);
-    if (match_mask != 0) {
-      literal_cnt = __ffs(match_mask) - 1;
-      if (t == literal_cnt) {
-        s->copy_distance = pos + t - offset;
-        s->copy_length   = 4;
-      }
-    } else {
-      literal_cnt = 32;
-    }
-    // Update hash up to the first 4 bytes of the copy length
-    local_match &= (0x2 << literal_cnt) - 1;
-    if (t <= literal_cnt && t == 31 - __clz(local_match)) { s->hash_map[hash] = pos + t; }
-    pos += literal_cnt;
-  } while (literal_cnt == 32 && pos < maxpos);
-  return min(pos, len) - pos0;
-}
-
-/// @brief Returns the number of matching bytes for two byte sequences up to 63 bytes
-static __device__ uint32_t Match60(const uint8_t *src1,
-                                   const uint8_t *src2,
-                                   uint32_t len,
-                                   uint32_t t)
-{
-  uint32_t mismatch = BALLOT(t >= len || src1[t] != src2[t]);
-  if (mismatch == 0) {
-    mismatch = BALLOT(32 + t >= len || src1[32 + t] != src2[32 + t]);
-    return 31 + __ffs(mismatch);  // mismatch cannot be zero here if len <= 63
-  } else {
-    return __ffs(mismatch) - 1;
-  }
-}
-
 /**
  * @brief Snappy compression kernel
  * See http://github.com/google/snappy/blob/master/format_description.txt
@@ -103,5 +103,12 @@ int32_t cpu_bz2_uncompress(const uint8_t *input,
                            size_t *dstlen,
                            uint64_t *block_start = nullptr);
 
+// Decodes only the block starting at bit offset *block_start of the stream beginning at `input`.
+// Returns BZ_OK if the block is followed by another block, or BZ_STREAM_END if it is the last block
+// of the stream; in both cases, block_start is updated to the end of the block (after the
+// end-of-stream signature for the last block). BZ_OUTBUFF_FULL is returned if dst is too small.
+int32_t cpu_bz2_uncompress_block(
+  const uint8_t *input, size_t inlen, uint8_t *dst, size_t *dstlen, uint64_t *block_start);
+
 }  // namespace io
 }  // namespace cudf
@@ -22,6 +22,11 @@
 
 #include <cudf/utilities/error.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+
 namespace cudf {
 namespace io {
 #define GZ_FLG_FTEXT 0x01     // ASCII text hint
@@ -277,6 +282,284 @@ int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t
   return (zerr == Z_STREAM_END) ? Z_OK : zerr;
 }
 
+/**
+ * @Brief Uncompresses a (possibly multi-member) gzip file to a char vector.
+ * Members are decoded one after the other until the end of the input or until the data following
+ * a member is not a gzip header. The vector is grown as needed, starting from its initial size.
+ *
+ * @param dst[out] Destination vector
+ * @param src[in] Gzip file data
+ * @param src_len[in] Gzip file size
+ */
+int cpu_gunzip_vector(std::vector<char> &dst, const uint8_t *src, size_t src_len)
+{
+  int zerr;
+  z_stream strm;
+
+  memset(&strm, 0, sizeof(strm));
+  strm.next_in   = (Bytef *)src;
+  strm.avail_in  = src_len;
+  strm.next_out  = reinterpret_cast<uint8_t *>(dst.data());
+  strm.avail_out = dst.size();
+  zerr           = inflateInit2(&strm, 16 + 15);  // +16 to parse the GZIP header and trailer
+  if (zerr != 0) {
+    dst.resize(0);
+    return zerr;
+  }
+  size_t total_out = 0;
+  for (;;) {
+    if (strm.avail_out == 0) {
+      total_out = reinterpret_cast<char *>(strm.next_out) - dst.data();
+      dst.resize(total_out + std::min<size_t>(std::max<size_t>(total_out, 4096), 1 << 30));
+      strm.avail_out = dst.size() - total_out;
+      strm.next_out  = reinterpret_cast<uint8_t *>(dst.data()) + total_out;
+    }
+    zerr = inflate(&strm, Z_SYNC_FLUSH);
+    if (zerr == Z_STREAM_END) {
+      // Continue with the next member, if any
+      if (strm.avail_in < 2 || strm.next_in[0] != 0x1f || strm.next_in[1] != 0x8b) break;
+      zerr = inflateReset(&strm);
+    } else if (zerr == Z_BUF_ERROR && strm.avail_out != 0) {
+      break;  // Truncated input
+    }
+    if (zerr != Z_OK && zerr != Z_BUF_ERROR) break;
+  }
+  dst.resize(reinterpret_cast<char *>(strm.next_out) - dst.data());
+  inflateEnd(&strm);
+  return (zerr == Z_STREAM_END) ? Z_OK : zerr;
+}
+
+namespace {
+/**
+ * @Brief Returns the number of threads used for block-parallel decompression
+ */
+size_t decompression_thread_count()
+{
+  return std::max<unsigned>(1, std::thread::hardware_concurrency());
+}
+
+/**
+ * @Brief Calls `func(i)` for every i in [0, count), distributing the calls over a pool of threads
+ */
+template <typename Func>
+void parallel_for(size_t count, size_t num_threads, Func func)
+{
+  std::atomic<size_t> next_idx{0};
+  std::vector<std::future<void>> workers;
+  auto const num_workers = std::min(num_threads, count);
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers.emplace_back(std::async(std::launch::async, [&]() {
+      for (auto idx = next_idx++; idx < count; idx = next_idx++) { func(idx); }
+    }));
+  }
+  for (auto &worker : workers) { worker.get(); }
+}
+
+/**
+ * @Brief Returns the size of the BGZF (blocked gzip) member starting at `raw`, or zero if the
+ * member does not carry the BGZF block size extra subfield
+ */
+size_t bgzf_member_size(const uint8_t *raw, size_t len)
+{
+  if (len < sizeof(gz_file_header_s) + 2) return 0;
+  const gz_file_header_s *fhdr = (const gz_file_header_s *)raw;
+  if (fhdr->id1 != 0x1f || fhdr->id2 != 0x8b || !(fhdr->flags & GZ_FLG_FEXTRA)) return 0;
+  const uint8_t *xtra = raw + sizeof(gz_file_header_s);
+  uint32_t xlen       = xtra[0] | (xtra[1] << 8);
+  if (sizeof(gz_file_header_s) + 2 + xlen > len) return 0;
+  xtra += 2;
+  for (uint32_t pos = 0; pos + 4 <= xlen;) {
+    uint32_t slen = xtra[pos + 2] | (xtra[pos + 3] << 8);
+    if (xtra[pos] == 'B' && xtra[pos + 1] == 'C' && slen == 2 && pos + 6 <= xlen) {
+      return (xtra[pos + 4] | (xtra[pos + 5] << 8)) + 1;
+    }
+    pos += 4 + slen;
+  }
+  return 0;
+}
+
+}  // namespace
+
+/**
+ * @Brief Uncompresses a BGZF file (a sequence of gzip members whose compressed sizes are recorded
+ * in their headers) by inflating all members in parallel.
+ *
+ * @param dst[out] Destination vector
+ * @param src[in] Gzip file data
+ * @param src_len[in] Gzip file size
+ *
+ * @return true if the input is a BGZF file with more than one member and was fully decoded,
+ * false otherwise
+ */
+bool cpu_inflate_bgzf(std::vector<char> &dst, const uint8_t *src, size_t src_len)
+{
+  std::vector<gz_archive_s> members;
+  std::vector<size_t> dst_offsets;
+  size_t dst_size = 0;
+  for (size_t ofs = 0; ofs < src_len;) {
+    size_t const member_size = bgzf_member_size(src + ofs, src_len - ofs);
+    if (member_size == 0 || member_size > src_len - ofs) return false;
+    gz_archive_s gz;
+    if (ParseGZArchive(&gz, src + ofs, member_size)) {
+      members.push_back(gz);
+      dst_offsets.push_back(dst_size);
+      dst_size += gz.isize;
+    } else if (member_size != 28) {
+      return false;  // Only the empty end-of-file marker block has no compressed data
+    }
+    ofs += member_size;
+  }
+  if (members.size() < 2) return false;
+
+  dst.resize(dst_size);
+  std::atomic<bool> valid{true};
+  parallel_for(members.size(), decompression_thread_count(), [&](size_t i) {
+    size_t dst_len = members[i].isize;
+    auto const err = cpu_inflate(reinterpret_cast<uint8_t *>(dst.data()) + dst_offsets[i],
+                                 &dst_len,
+                                 members[i].comp_data,
+                                 members[i].comp_len);
+    if (err != Z_OK || dst_len != members[i].isize) { valid = false; }
+  });
+  if (!valid) { dst.clear(); }
+  return valid;
+}
+
+namespace {
+constexpr uint64_t bz2_block_magic = 0x314159265359ull;
+
+/**
+ * @Brief Returns the sorted bit offsets of all occurrences of the 48-bit bzip2 block signature
+ */
+std::vector<uint64_t> find_bz2_block_candidates(const uint8_t *src, size_t len, size_t num_threads)
+{
+  size_t const num_positions = (len >= 8) ? len - 7 : 0;
+  size_t const num_chunks = std::max<size_t>(1, std::min<size_t>(num_threads, num_positions >> 16));
+  std::vector<std::vector<uint64_t>> chunk_candidates(num_chunks);
+  parallel_for(num_chunks, num_threads, [&](size_t chunk) {
+    size_t const begin = num_positions * chunk / num_chunks;
+    size_t const end   = num_positions * (chunk + 1) / num_chunks;
+    uint64_t window    = 0;
+    for (size_t i = 0; i < 8 && begin + i < len; i++) { window = (window << 8) | src[begin + i]; }
+    for (size_t pos = begin; pos < end; pos++) {
+      for (uint32_t shift = 0; shift < 8; shift++) {
+        // The first block of a stream starts after the 32-bit stream header
+        if (((window >> (16 - shift)) & 0xffffffffffffull) == bz2_block_magic && pos * 8 >= 32) {
+          chunk_candidates[chunk].push_back(pos * 8 + shift);
+        }
+      }
+      if (pos + 8 < len) { window = (window << 8) | src[pos + 8]; }
+    }
+  });
+  std::vector<uint64_t> candidates;
+  for (auto const &chunk : chunk_candidates) {
+    candidates.insert(candidates.end(), chunk.begin(), chunk.end());
+  }
+  return candidates;
+}
+
+struct bz2_block_s {
+  size_t stream_start = 0;              // byte offset of the "BZh" header of the stream
+  uint64_t end_bit    = 0;              // absolute bit offset of the end of the block
+  int32_t status      = BZ_DATA_ERROR;  // status of the speculative block decode
+  std::vector<char> data;               // uncompressed block data
+};
+
+}  // namespace
+
+/**
+ * @Brief Uncompresses a bzip2 file by decoding its blocks in parallel.
+ *
+ * Block boundaries are not byte-aligned and are not indexed, so all occurrences of the block
+ * signature are decoded speculatively, and the decoded blocks are then chained together starting
+ * from the first block of the file. Concatenated streams (as written by parallel compressors) are
+ * decoded as well.
+ *
+ * @param dst[out] Destination vector
+ * @param src[in] Bzip2 file data
+ * @param src_len[in] Bzip2 file size
+ *
+ * @return true if the file was fully decoded, false if the caller should use the serial decoder
+ */
+bool cpu_bz2_uncompress_parallel(std::vector<char> &dst, const uint8_t *src, size_t src_len)
+{
+  auto const num_threads = decompression_thread_count();
+  auto const candidates = find_bz2_block_candidates(src, src_len, num_threads);
+  if (candidates.size() < 2) return false;
+
+  // Byte offsets of all stream headers that are immediately followed by a block
+  auto is_stream_header = [&](size_t ofs) {
+    return ofs + 4 <= src_len && src[ofs] == 'B' && src[ofs + 1] == 'Z' && src[ofs + 2] == 'h' &&
+           src[ofs + 3] >= '1' && src[ofs + 3] <= '9';
+  };
+  std::vector<size_t> stream_starts;
+  for (auto bit : candidates) {
+    if (bit % 8 == 0 && bit >= 32 && is_stream_header(bit / 8 - 4)) {
+      stream_starts.push_back(bit / 8 - 4);
+    }
+  }
+  if (stream_starts.empty() || stream_starts[0] != 0) return false;
+
+  std::vector<bz2_block_s> blocks(candidates.size());
+  parallel_for(candidates.size(), num_threads, [&](size_t i) {
+    auto &blk = blocks[i];
+    auto it =
+      std::upper_bound(stream_starts.begin(), stream_starts.end(), (candidates[i] - 32) / 8);
+    blk.stream_start        = *(it - 1);
+    const uint8_t *stream   = src + blk.stream_start;
+    size_t const stream_len = src_len - blk.stream_start;
+    size_t const block_size = (stream[3] - '0') * 100000;
+    size_t dst_len          = 0;
+    uint64_t bit            = 0;
+    for (size_t capacity = block_size + (block_size >> 2); capacity <= block_size * 64;
+         capacity *= 2) {
+      blk.data.resize(capacity);
+      dst_len    = capacity;
+      bit        = candidates[i] - blk.stream_start * 8;
+      blk.status = cpu_bz2_uncompress_block(
+        stream, stream_len, reinterpret_cast<uint8_t *>(blk.data.data()), &dst_len, &bit);
+      if (blk.status != BZ_OUTBUFF_FULL) break;
+    }
+    blk.data.resize((blk.status == BZ_OK || blk.status == BZ_STREAM_END) ? dst_len : 0);
+    blk.end_bit = blk.stream_start * 8 + bit;
+  });
+
+  // Chain the blocks starting from the first block of the first stream
+  std::vector<size_t> chain;
+  size_t dst_size = 0;
+  size_t stream   = 0;
+  uint64_t bit    = 32;
+  for (;;) {
+    auto it = std::lower_bound(candidates.begin(), candidates.end(), bit);
+    if (it == candidates.end() || *it != bit) return false;
+    auto const &blk = blocks[it - candidates.begin()];
+    if (blk.stream_start != stream || (blk.status != BZ_OK && blk.status != BZ_STREAM_END)) {
+      return false;
+    }
+    chain.push_back(it - candidates.begin());
+    dst_size += blk.data.size();
+    if (blk.status == BZ_OK) {
+      bit = blk.end_bit;
+    } else {
+      // Skip the combined stream CRC; the next stream (if any) starts at a byte boundary
+      size_t const next_stream = (blk.end_bit + 32 + 7) / 8;
+      if (!std::binary_search(stream_starts.begin(), stream_starts.end(), next_stream)) break;
+      stream = next_stream;
+      bit    = next_stream * 8 + 32;
+    }
+  }
+
+  dst.resize(dst_size);
+  size_t dst_ofs = 0;
+  for (auto idx : chain) {
+    auto &blk = blocks[idx];
+    memcpy(dst.data() + dst_ofs, blk.data.data(), blk.data.size());
+    dst_ofs += blk.data.size();
+    std::vector<char>().swap(blk.data);
+  }
+  return true;
+}
+
 /**
  * @Brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
  *
@@ -372,7 +655,14 @@ std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int
                                        // ~4:1 compression for initial size
   }
 
-  if (stream_type == IO_UNCOMP_STREAM_TYPE_GZIP || stream_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
+  if (stream_type == IO_UNCOMP_STREAM_TYPE_GZIP) {
+    std::vector<char> dst;
+    if (cpu_inflate_bgzf(dst, raw, src_size)) { return dst; }
+    dst.resize(uncomp_len);
+    CUDF_EXPECTS(cpu_gunzip_vector(dst, raw, src_size) == 0, "Decompression: error in stream");
+    return dst;
+  }
+  if (stream_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
     // INFLATE
     std::vector<char> dst(uncomp_len);
     CUDF_EXPECTS(cpu_inflate_vector(dst, comp_data, comp_len) == 0,
@@ -383,7 +673,9 @@ std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int
     size_t src_ofs = 0;
     size_t dst_ofs = 0;
     int bz_err     = 0;
-    std::vector<char> dst(uncomp_len);
+    std::vector<char> dst;
+    if (cpu_bz2_uncompress_parallel(dst, comp_data, comp_len)) { return dst; }
+    dst.resize(uncomp_len);
     do {
       size_t dst_len = uncomp_len - dst_ofs;
       bz_err         = cpu_bz2_uncompress(
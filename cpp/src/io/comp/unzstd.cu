@@ -0,0 +1,999 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file unzstd.cu
+ * @brief GPU decompressor for the Zstandard format (RFC 8878)
+ *
+ * Each input is decoded by a single warp: lane 0 parses the headers, builds the entropy tables
+ * and decodes the sequences, up to four lanes decode the Huffman literal streams in parallel,
+ * and the whole warp executes the literal and match copies.
+ *
+ * Dictionaries are not supported, and the content checksum is not verified.
+ **/
+
+#include <io/utilities/block_utils.cuh>
+#include "gpuinflate.h"
+
+namespace cudf {
+namespace io {
+#define ZSTD_MAGIC 0xfd2fb528
+#define ZSTD_SKIPPABLE_MAGIC 0x184d2a50   // Low 4 bits are user-defined
+#define ZSTD_MAX_BLOCK_SIZE (128 * 1024)  // Block_Maximum_Size upper bound
+
+#define ZSTD_MAX_HUF_LOG 11
+#define ZSTD_MAX_WEIGHT_LOG 6
+#define ZSTD_MAX_LL_LOG 9
+#define ZSTD_MAX_ML_LOG 9
+#define ZSTD_MAX_OF_LOG 8
+#define ZSTD_MAX_LL_SYMBOL 35
+#define ZSTD_MAX_ML_SYMBOL 52
+#define ZSTD_MAX_OF_SYMBOL 31
+#define ZSTD_MAX_FSE_SYMBOLS 64
+
+#define ZSTD_WARPS_PER_BLOCK 4
+#define ZSTD_SEQ_BATCH_SIZE 32
+
+/**
+ * @brief Decoding table entry for FSE-compressed symbols
+ **/
+struct zstd_fse_entry_s {
+  uint8_t symbol;
+  uint8_t num_bits;
+  uint16_t new_state;
+};
+
+/**
+ * @brief Decoding table entry for Huffman-compressed literals
+ **/
+struct zstd_huf_entry_s {
+  uint8_t symbol;
+  uint8_t num_bits;
+};
+
+/**
+ * @brief Single decoded sequence
+ **/
+struct zstd_sequence_s {
+  uint32_t literal_length;
+  uint32_t match_length;
+  uint32_t offset;
+};
+
+/**
+ * @brief Bit stream read from the end towards the start, as used by the entropy coded streams
+ **/
+struct zstd_bwd_bits_s {
+  const uint8_t *base;
+  int32_t len;     ///< Length in bytes
+  int32_t bitpos;  ///< Number of bits left to read; negative once read past the start
+};
+
+enum {
+  ZSTD_BLOCK_RAW        = 0,
+  ZSTD_BLOCK_RLE        = 1,
+  ZSTD_BLOCK_COMPRESSED = 2,
+};
+
+enum {
+  ZSTD_LIT_RAW        = 0,
+  ZSTD_LIT_RLE        = 1,
+  ZSTD_LIT_COMPRESSED = 2,
+  ZSTD_LIT_TREELESS   = 3,
+};
+
+enum {
+  ZSTD_MODE_PREDEFINED = 0,
+  ZSTD_MODE_RLE        = 1,
+  ZSTD_MODE_COMPRESSED = 2,
+  ZSTD_MODE_REPEAT     = 3,
+};
+
+/**
+ * @brief Zstandard decompression state, one per warp
+ **/
+struct unzstd_state_s {
+  const uint8_t *cur;         ///< Current position in the compressed stream
+  const uint8_t *end;         ///< End of the compressed stream
+  uint8_t *dst_base;          ///< Start of the output buffer
+  uint8_t *dst;               ///< Current output position
+  uint8_t *dst_end;           ///< End of the output buffer
+  uint8_t *frame_start;       ///< Output position of the start of the current frame
+  uint64_t frame_size;        ///< Frame_Content_Size or ~0 if unknown
+  int32_t error;              ///< Nonzero if the stream is invalid
+  int32_t done;               ///< Nonzero when all frames are decoded
+  int32_t in_frame;           ///< Nonzero between the frame header and the last block
+  int32_t last_block;         ///< Nonzero if the current block is the last of its frame
+  int32_t has_checksum;       ///< Nonzero if the frame ends with a content checksum
+  int32_t block_type;         ///< ZSTD_BLOCK_XXX
+  uint32_t block_size;        ///< Compressed size, or regenerated size of RLE blocks
+  const uint8_t *block_src;   ///< Block content
+  uint32_t rep[3];            ///< Repeated offsets
+  int32_t lit_type;           ///< ZSTD_LIT_XXX
+  uint32_t lit_size;          ///< Regenerated literals size
+  const uint8_t *lit_src;     ///< Literals data (raw literals in the source, or staged output)
+  uint8_t lit_byte;           ///< RLE literal value
+  int32_t num_streams;        ///< Number of Huffman streams
+  const uint8_t *huf_src[4];  ///< Huffman stream data
+  uint32_t huf_len[4];        ///< Huffman stream lengths
+  uint32_t huf_log;           ///< Huffman table log, 0 if no table is available yet
+  uint32_t ll_log;            ///< Literals length table log
+  uint32_t of_log;            ///< Offset table log
+  uint32_t ml_log;            ///< Match length table log
+  int32_t tables_valid;       ///< Nonzero once sequence tables have been defined in the frame
+  uint32_t num_seq;           ///< Number of sequences in the current block
+  uint32_t seq_count;         ///< Number of sequences in the current batch
+  zstd_sequence_s seq[ZSTD_SEQ_BATCH_SIZE];
+  zstd_huf_entry_s huf[1 << ZSTD_MAX_HUF_LOG];
+  zstd_fse_entry_s ll[1 << ZSTD_MAX_LL_LOG];
+  zstd_fse_entry_s ml[1 << ZSTD_MAX_ML_LOG];
+  zstd_fse_entry_s of[1 << ZSTD_MAX_OF_LOG];
+  zstd_fse_entry_s wfse[1 << ZSTD_MAX_WEIGHT_LOG];
+  int16_t norm[ZSTD_MAX_FSE_SYMBOLS];
+  uint16_t next_state[ZSTD_MAX_FSE_SYMBOLS];
+  uint8_t weights[256];
+};
+
+// Literals_Length_Code to baseline and number of extra bits
+static const uint32_t __device__ __constant__ k_ll_base[ZSTD_MAX_LL_SYMBOL + 1] = {
+  0,  1,  2,  3,  4,  5,  6,  7,  8,   9,   10,  11,   12,   13,   14,   15,   16,    18,
+  20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536};
+static const uint8_t __device__ __constant__ k_ll_bits[ZSTD_MAX_LL_SYMBOL + 1] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 4, 6, 7, 8, 9, 10, 11,
+  12, 13, 14, 15, 16};
+
+// Match_Length_Code to baseline and number of extra bits
+static const uint32_t __device__ __constant__ k_ml_base[ZSTD_MAX_ML_SYMBOL + 1] = {
+  3,   4,   5,   6,   7,    8,    9,    10,   11,    12,    13,    14,    15,    16,
+  17,  18,  19,  20,  21,   22,   23,   24,   25,    26,    27,    28,    29,    30,
+  31,  32,  33,  34,  35,   37,   39,   41,   43,    47,    51,    59,    67,    83,
+  99,  131, 259, 515, 1027, 2051, 4099, 8195, 16387, 32771, 65539};
+static const uint8_t __device__ __constant__ k_ml_bits[ZSTD_MAX_ML_SYMBOL + 1] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+// Predefined distributions
+static const int16_t __device__ __constant__ k_ll_default_norm[ZSTD_MAX_LL_SYMBOL + 1] = {
+  4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1,
+  -1, -1, -1, -1};
+static const int16_t __device__ __constant__ k_ml_default_norm[ZSTD_MAX_ML_SYMBOL + 1] = {
+  1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1};
+static const int16_t __device__ __constant__ k_of_default_norm[29] = {
+  1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1};
+
+/**
+ * @brief Returns the index of the highest set bit
+ **/
+inline __device__ uint32_t highbit(uint32_t v) { return 31 - __clz(v); }
+
+/**
+ * @brief Loads 8 bytes in little-endian order, reading zeros outside of [0, len)
+ **/
+inline __device__ uint64_t load_le64(const uint8_t *base, int32_t len, int32_t pos)
+{
+  uint64_t v = 0;
+  for (int32_t i = 0; i < 8; i++) {
+    if (pos + i >= 0 && pos + i < len) { v |= static_cast<uint64_t>(base[pos + i]) << (i * 8); }
+  }
+  return v;
+}
+
+/**
+ * @brief Reads `n` (up to 25) bits from a forward (LSB-first) bit stream
+ **/
+inline __device__ uint32_t fwd_read_bits(const uint8_t *base,
+                                         int32_t len,
+                                         uint32_t &bitpos,
+                                         uint32_t n)
+{
+  uint64_t v = load_le64(base, len, bitpos >> 3) >> (bitpos & 7);
+  bitpos += n;
+  return static_cast<uint32_t>(v & ((1u << n) - 1));
+}
+
+/**
+ * @brief Reads `n` (up to 25) bits from a forward bit stream without consuming them
+ **/
+inline __device__ uint32_t fwd_peek_bits(const uint8_t *base,
+                                         int32_t len,
+                                         uint32_t bitpos,
+                                         uint32_t n)
+{
+  return fwd_read_bits(base, len, bitpos, n);
+}
+
+/**
+ * @brief Initializes a backward bit stream, skipping the padding bits of its last byte
+ *
+ * @return false if the stream is empty or its last byte is zero
+ **/
+inline __device__ bool bwd_init(zstd_bwd_bits_s *b, const uint8_t *base, uint32_t len)
+{
+  b->base = base;
+  b->len  = len;
+  if (len == 0 || base[len - 1] == 0) { return false; }
+  b->bitpos = (len - 1) * 8 + highbit(base[len - 1]);
+  return true;
+}
+
+/**
+ * @brief Returns the next `n` (up to 32) bits of a backward bit stream without consuming them
+ *
+ * Bits before the start of the stream read as zero.
+ **/
+inline __device__ uint32_t bwd_peek(const zstd_bwd_bits_s *b, uint32_t n)
+{
+  if (n == 0) { return 0; }
+  int32_t lo   = b->bitpos - static_cast<int32_t>(n);
+  int32_t byte = (lo >= 0) ? (lo >> 3) : -((7 - lo) >> 3);
+  uint64_t v   = load_le64(b->base, b->len, byte) >> (lo - byte * 8);
+  return static_cast<uint32_t>(v & ((n < 32) ? (1u << n) - 1 : ~0u));
+}
+
+/**
+ * @brief Reads `n` (up to 32) bits from a backward bit stream
+ **/
+inline __device__ uint32_t bwd_read(zstd_bwd_bits_s *b, uint32_t n)
+{
+  uint32_t v = bwd_peek(b, n);
+  b->bitpos -= n;
+  return v;
+}
+
+/**
+ * @brief Decodes an FSE table description (normalized symbol counts)
+ *
+ * @param[in] src Table description
+ * @param[in] len Maximum length of the description in bytes
+ * @param[out] norm Normalized counts, -1 for "less than 1" probabilities
+ * @param[in] max_symbol Largest symbol value allowed
+ * @param[in] max_log Largest accuracy log allowed
+ * @param[out] log Accuracy log of the table
+ * @param[out] num_symbols Number of symbols with a normalized count
+ *
+ * @return Number of bytes of the description, 0 if invalid
+ **/
+static __device__ uint32_t read_fse_norm(const uint8_t *src,
+                                         uint32_t len,
+                                         int16_t *norm,
+                                         uint32_t max_symbol,
+                                         uint32_t max_log,
+                                         uint32_t *log,
+                                         uint32_t *num_symbols)
+{
+  if (len == 0) { return 0; }
+  uint32_t bitpos   = 0;
+  uint32_t accuracy = fwd_read_bits(src, len, bitpos, 4) + 5;
+  if (accuracy > max_log) { return 0; }
+  int32_t remaining = (1 << accuracy) + 1;
+  int32_t threshold = 1 << accuracy;
+  uint32_t nbits    = accuracy + 1;
+  uint32_t symbol   = 0;
+  while (remaining > 1 && symbol <= max_symbol) {
+    int32_t max   = (2 * threshold - 1) - remaining;
+    int32_t count = fwd_peek_bits(src, len, bitpos, nbits - 1);
+    if (count < max) {
+      bitpos += nbits - 1;
+    } else {
+      count = fwd_read_bits(src, len, bitpos, nbits);
+      if (count >= threshold) { count -= max; }
+    }
+    count--;
+    remaining -= (count < 0) ? -count : count;
+    norm[symbol++] = count;
+    if (count == 0) {
+      // Run of zero probabilities, in groups of 2-bit repeat flags
+      uint32_t repeat;
+      do {
+        repeat = fwd_read_bits(src, len, bitpos, 2);
+        for (uint32_t i = 0; i < repeat && symbol <= max_symbol; i++) { norm[symbol++] = 0; }
+      } while (repeat == 3 && symbol <= max_symbol);
+    }
+    while (remaining < threshold) {
+      nbits--;
+      threshold >>= 1;
+    }
+  }
+  if (remaining != 1 || bitpos > len * 8) { return 0; }
+  *log         = accuracy;
+  *num_symbols = symbol;
+  return (bitpos + 7) >> 3;
+}
+
+/**
+ * @brief Builds an FSE decoding table from normalized counts
+ *
+ * @return false if the counts do not describe a valid table
+ **/
+static __device__ bool build_fse_table(zstd_fse_entry_s *table,
+                                       const int16_t *norm,
+                                       uint32_t num_symbols,
+                                       uint32_t log,
+                                       uint16_t *next_state)
+{
+  uint32_t size = 1 << log;
+  uint32_t high = size - 1;
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    if (norm[s] == -1) {
+      table[high--].symbol = s;
+      next_state[s]        = 1;
+    } else {
+      next_state[s] = (norm[s] > 0) ? norm[s] : 0;
+    }
+  }
+  uint32_t step = (size >> 1) + (size >> 3) + 3;
+  uint32_t pos  = 0;
+  for (uint32_t s = 0; s < num_symbols; s++) {
+    for (int32_t i = 0; i < norm[s]; i++) {
+      table[pos].symbol = s;
+      do {
+        pos = (pos + step) & (size - 1);
+      } while (pos > high);
+    }
+  }
+  if (pos != 0) { return false; }
+  for (uint32_t u = 0; u < size; u++) {
+    uint32_t state       = next_state[table[u].symbol]++;
+    uint32_t nbits       = log - highbit(state);
+    table[u].num_bits    = nbits;
+    table[u].new_state   = (state << nbits) - size;
+  }
+  return true;
+}
+
+/**
+ * @brief Builds the decoding table for one sequence symbol type
+ *
+ * @param s Decompression state
+ * @param mode Symbol compression mode (ZSTD_MODE_XXX)
+ * @param src Table description
+ * @param len Maximum length of the description in bytes
+ * @param table Decoding table
+ * @param log Table accuracy log (input for repeat mode)
+ * @param default_norm Predefined distribution
+ * @param default_count Number of symbols of the predefined distribution
+ * @param default_log Accuracy log of the predefined distribution
+ * @param max_symbol Largest symbol value allowed
+ * @param max_log Largest accuracy log allowed
+ *
+ * @return Number of bytes of the table description, -1 if invalid
+ **/
+static __device__ int32_t build_seq_table(unzstd_state_s *s,
+                                          int32_t mode,
+                                          const uint8_t *src,
+                                          uint32_t len,
+                                          zstd_fse_entry_s *table,
+                                          uint32_t *log,
+                                          const int16_t *default_norm,
+                                          uint32_t default_count,
+                                          uint32_t default_log,
+                                          uint32_t max_symbol,
+                                          uint32_t max_log)
+{
+  switch (mode) {
+    case ZSTD_MODE_PREDEFINED:
+      for (uint32_t i = 0; i < default_count; i++) { s->norm[i] = default_norm[i]; }
+      *log = default_log;
+      return build_fse_table(table, s->norm, default_count, default_log, s->next_state) ? 0 : -1;
+    case ZSTD_MODE_RLE:
+      if (len < 1 || src[0] > max_symbol) { return -1; }
+      table[0].symbol    = src[0];
+      table[0].num_bits  = 0;
+      table[0].new_state = 0;
+      *log               = 0;
+      return 1;
+    case ZSTD_MODE_COMPRESSED: {
+      uint32_t num_symbols;
+      uint32_t bytes = read_fse_norm(src, len, s->norm, max_symbol, max_log, log, &num_symbols);
+      if (bytes == 0 || !build_fse_table(table, s->norm, num_symbols, *log, s->next_state)) {
+        return -1;
+      }
+      return bytes;
+    }
+    default: return s->tables_valid ? 0 : -1;
+  }
+}
+
+/**
+ * @brief Decodes the Huffman tree description and builds the literals decoding table
+ *
+ * @return Number of bytes of the tree description, 0 if invalid
+ **/
+static __device__ uint32_t read_huffman_table(unzstd_state_s *s, const uint8_t *src, uint32_t len)
+{
+  uint32_t num_weights;
+  uint32_t bytes;
+  if (len < 1) { return 0; }
+  if (src[0] >= 128) {
+    // Direct representation: 4-bit weights
+    num_weights = src[0] - 127;
+    bytes       = 1 + ((num_weights + 1) >> 1);
+    if (bytes > len) { return 0; }
+    for (uint32_t i = 0; i < num_weights; i++) {
+      uint8_t v     = src[1 + (i >> 1)];
+      s->weights[i] = (i & 1) ? (v & 0xf) : (v >> 4);
+    }
+  } else {
+    // FSE-compressed weights, decoded with two interleaved states
+    uint32_t csize = src[0];
+    uint32_t log, num_symbols;
+    bytes = 1 + csize;
+    if (bytes > len) { return 0; }
+    uint32_t hdr_len =
+      read_fse_norm(src + 1, csize, s->norm, ZSTD_MAX_HUF_LOG + 1, ZSTD_MAX_WEIGHT_LOG, &log,
+                    &num_symbols);
+    if (hdr_len == 0 || !build_fse_table(s->wfse, s->norm, num_symbols, log, s->next_state)) {
+      return 0;
+    }
+    zstd_bwd_bits_s b;
+    if (!bwd_init(&b, src + 1 + hdr_len, csize - hdr_len)) { return 0; }
+    uint32_t state1 = bwd_read(&b, log);
+    uint32_t state2 = bwd_read(&b, log);
+    num_weights     = 0;
+    for (;;) {
+      if (num_weights >= 254) { return 0; }
+      s->weights[num_weights++] = s->wfse[state1].symbol;
+      state1 = s->wfse[state1].new_state + bwd_read(&b, s->wfse[state1].num_bits);
+      if (b.bitpos < 0) {
+        s->weights[num_weights++] = s->wfse[state2].symbol;
+        break;
+      }
+      s->weights[num_weights++] = s->wfse[state2].symbol;
+      state2 = s->wfse[state2].new_state + bwd_read(&b, s->wfse[state2].num_bits);
+      if (b.bitpos < 0) {
+        s->weights[num_weights++] = s->wfse[state1].symbol;
+        break;
+      }
+    }
+  }
+  // The weight of the last symbol is implied by the others
+  uint32_t weight_sum = 0;
+  for (uint32_t i = 0; i < num_weights; i++) {
+    if (s->weights[i] > ZSTD_MAX_HUF_LOG) { return 0; }
+    weight_sum += (s->weights[i] > 0) ? 1u << (s->weights[i] - 1) : 0;
+  }
+  if (weight_sum == 0) { return 0; }
+  uint32_t max_bits = highbit(weight_sum) + 1;
+  uint32_t rest     = (1u << max_bits) - weight_sum;
+  if (max_bits > ZSTD_MAX_HUF_LOG || (rest & (rest - 1)) != 0) { return 0; }
+  s->weights[num_weights++] = highbit(rest) + 1;
+
+  // Codes are assigned by increasing weight, then by increasing symbol value
+  uint32_t rank_start[ZSTD_MAX_HUF_LOG + 2];
+  for (uint32_t w = 0; w <= max_bits; w++) { rank_start[w] = 0; }
+  for (uint32_t i = 0; i < num_weights; i++) { rank_start[s->weights[i]]++; }
+  for (uint32_t w = 1, pos = 0; w <= max_bits; w++) {
+    uint32_t count = rank_start[w];
+    rank_start[w]  = pos;
+    pos += count << (w - 1);
+  }
+  for (uint32_t i = 0; i < num_weights; i++) {
+    uint32_t w = s->weights[i];
+    if (w == 0) { continue; }
+    uint32_t n = 1u << (w - 1);
+    for (uint32_t j = 0; j < n; j++) {
+      s->huf[rank_start[w] + j].symbol   = i;
+      s->huf[rank_start[w] + j].num_bits = max_bits + 1 - w;
+    }
+    rank_start[w] += n;
+  }
+  s->huf_log = max_bits;
+  return bytes;
+}
+
+/**
+ * @brief Parses the literals section of a compressed block (lane 0)
+ *
+ * @return Number of bytes of the literals section, 0 if invalid
+ **/
+static __device__ uint32_t parse_literals_section(unzstd_state_s *s,
+                                                  const uint8_t *src,
+                                                  uint32_t len)
+{
+  if (len < 1) { return 0; }
+  uint32_t type        = src[0] & 3;
+  uint32_t size_format = (src[0] >> 2) & 3;
+  s->lit_type          = type;
+  if (type == ZSTD_LIT_RAW || type == ZSTD_LIT_RLE) {
+    uint32_t hdr_len;
+    if ((size_format & 1) == 0) {
+      hdr_len     = 1;
+      s->lit_size = src[0] >> 3;
+    } else if (size_format == 1) {
+      hdr_len     = 2;
+      s->lit_size = (src[0] >> 4) + (len > 1 ? src[1] << 4 : 0);
+    } else {
+      hdr_len     = 3;
+      s->lit_size = (src[0] >> 4) + (len > 2 ? (src[1] << 4) + (src[2] << 12) : 0);
+    }
+    if (type == ZSTD_LIT_RAW) {
+      if (hdr_len + s->lit_size > len) { return 0; }
+      s->lit_src = src + hdr_len;
+      return hdr_len + s->lit_size;
+    }
+    if (hdr_len + 1 > len) { return 0; }
+    s->lit_byte = src[hdr_len];
+    return hdr_len + 1;
+  }
+
+  // Huffman-compressed literals
+  uint32_t hdr_len, comp_size;
+  uint64_t hdr = load_le64(src, len, 0);
+  switch (size_format) {
+    case 0:
+    case 1:
+      hdr_len     = 3;
+      s->lit_size = (hdr >> 4) & 0x3ff;
+      comp_size   = (hdr >> 14) & 0x3ff;
+      break;
+    case 2:
+      hdr_len     = 4;
+      s->lit_size = (hdr >> 4) & 0x3fff;
+      comp_size   = (hdr >> 18) & 0x3fff;
+      break;
+    default:
+      hdr_len     = 5;
+      s->lit_size = (hdr >> 4) & 0x3ffff;
+      comp_size   = (hdr >> 22) & 0x3ffff;
+      break;
+  }
+  s->num_streams = (size_format == 0) ? 1 : 4;
+  if (hdr_len + comp_size > len || s->lit_size > ZSTD_MAX_BLOCK_SIZE) { return 0; }
+  const uint8_t *cur  = src + hdr_len;
+  uint32_t remaining  = comp_size;
+  if (type == ZSTD_LIT_COMPRESSED) {
+    uint32_t tree_len = read_huffman_table(s, cur, remaining);
+    if (tree_len == 0) { return 0; }
+    cur += tree_len;
+    remaining -= tree_len;
+  } else if (s->huf_log == 0) {
+    return 0;  // Treeless literals without a previous table
+  }
+  if (s->num_streams == 1) {
+    s->huf_src[0] = cur;
+    s->huf_len[0] = remaining;
+  } else {
+    if (remaining < 6) { return 0; }
+    uint32_t total = 6;
+    for (int i = 0; i < 3; i++) {
+      s->huf_len[i] = cur[i * 2] | (cur[i * 2 + 1] << 8);
+      total += s->huf_len[i];
+    }
+    if (total > remaining) { return 0; }
+    s->huf_len[3] = remaining - total;
+    s->huf_src[0] = cur + 6;
+    for (int i = 1; i < 4; i++) { s->huf_src[i] = s->huf_src[i - 1] + s->huf_len[i - 1]; }
+  }
+  // Literals are staged at the end of the output buffer; the output of the block can only
+  // overwrite them after they have been consumed
+  if (s->dst + s->lit_size > s->dst_end) { return 0; }
+  s->lit_src = s->dst_end - s->lit_size;
+  return hdr_len + comp_size;
+}
+
+/**
+ * @brief Decodes one Huffman literal stream into the staged literals buffer
+ *
+ * @return false if the stream is invalid
+ **/
+static __device__ bool decode_huffman_stream(const unzstd_state_s *s, int stream)
+{
+  uint32_t segment = (s->num_streams == 1) ? s->lit_size : (s->lit_size + 3) >> 2;
+  uint32_t start   = stream * segment;
+  uint32_t count   =
+    (stream == s->num_streams - 1) ? s->lit_size - min(start, s->lit_size) : segment;
+  uint8_t *out     = const_cast<uint8_t *>(s->lit_src) + start;
+  uint32_t log     = s->huf_log;
+  zstd_bwd_bits_s b;
+  if (start > s->lit_size || !bwd_init(&b, s->huf_src[stream], s->huf_len[stream])) {
+    return false;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    const zstd_huf_entry_s &e = s->huf[bwd_peek(&b, log)];
+    out[i]                    = e.symbol;
+    b.bitpos -= e.num_bits;
+  }
+  return b.bitpos == 0;
+}
+
+/**
+ * @brief Parses the sequences section header and builds the sequence tables (lane 0)
+ *
+ * @return Number of bytes of the header, 0 if invalid
+ **/
+static __device__ uint32_t parse_sequences_header(unzstd_state_s *s,
+                                                  const uint8_t *src,
+                                                  uint32_t len)
+{
+  uint32_t pos = 0;
+  if (len < 1) { return 0; }
+  uint32_t b0 = src[pos++];
+  if (b0 == 0) {
+    s->num_seq = 0;
+    return pos;
+  } else if (b0 < 128) {
+    s->num_seq = b0;
+  } else if (b0 < 255) {
+    if (pos + 1 > len) { return 0; }
+    s->num_seq = ((b0 - 128) << 8) + src[pos++];
+  } else {
+    if (pos + 2 > len) { return 0; }
+    s->num_seq = src[pos] + (src[pos + 1] << 8) + 0x7f00;
+    pos += 2;
+  }
+  if (pos + 1 > len) { return 0; }
+  uint32_t modes = src[pos++];
+  if (modes & 3) { return 0; }
+  int32_t bytes;
+  bytes = build_seq_table(s, (modes >> 6) & 3, src + pos, len - pos, s->ll, &s->ll_log,
+                          k_ll_default_norm, ZSTD_MAX_LL_SYMBOL + 1, 6, ZSTD_MAX_LL_SYMBOL,
+                          ZSTD_MAX_LL_LOG);
+  if (bytes < 0) { return 0; }
+  pos += bytes;
+  bytes = build_seq_table(s, (modes >> 4) & 3, src + pos, len - pos, s->of, &s->of_log,
+                          k_of_default_norm, 29, 5, ZSTD_MAX_OF_SYMBOL, ZSTD_MAX_OF_LOG);
+  if (bytes < 0) { return 0; }
+  pos += bytes;
+  bytes = build_seq_table(s, (modes >> 2) & 3, src + pos, len - pos, s->ml, &s->ml_log,
+                          k_ml_default_norm, ZSTD_MAX_ML_SYMBOL + 1, 6, ZSTD_MAX_ML_SYMBOL,
+                          ZSTD_MAX_ML_LOG);
+  if (bytes < 0) { return 0; }
+  pos += bytes;
+  s->tables_valid = 1;
+  return (pos <= len) ? pos : 0;
+}
+
+/**
+ * @brief Copies literals to the output (warp-wide)
+ *
+ * Staged literals may overlap the destination, so all lanes load before storing.
+ **/
+inline __device__ void copy_literals(
+  const unzstd_state_s *s, uint8_t *dst, uint32_t lit_pos, uint32_t len, int t)
+{
+  for (uint32_t i = 0; i < len; i += 32) {
+    uint8_t v = 0;
+    if (i + t < len) {
+      v = (s->lit_type == ZSTD_LIT_RLE) ? s->lit_byte : s->lit_src[lit_pos + i + t];
+    }
+    SYNCWARP();
+    if (i + t < len) { dst[i + t] = v; }
+  }
+  SYNCWARP();
+}
+
+/**
+ * @brief Copies an LZ77 match, possibly overlapping with its own output (warp-wide)
+ **/
+inline __device__ void copy_match(uint8_t *dst, uint32_t offset, uint32_t len, int t)
+{
+  const uint8_t *src = dst - offset;
+  uint32_t chunk     = min(offset, 32u);
+  for (uint32_t i = 0; i < len; i += chunk) {
+    if (t < chunk && i + t < len) { dst[i + t] = src[i + t]; }
+    SYNCWARP();
+  }
+}
+
+/**
+ * @brief Decodes a compressed block (warp-wide)
+ **/
+static __device__ void decode_compressed_block(unzstd_state_s *s, int t)
+{
+  const uint8_t *src = s->block_src;
+  uint32_t len       = s->block_size;
+  uint32_t seq_pos   = 0;
+  if (t == 0) {
+    seq_pos = parse_literals_section(s, src, len);
+    if (seq_pos == 0) { s->error = 1; }
+  }
+  SYNCWARP();
+  if (s->error) { return; }
+  if (s->lit_type >= ZSTD_LIT_COMPRESSED) {
+    if (t < s->num_streams && !decode_huffman_stream(s, t)) { s->error = 1; }
+    SYNCWARP();
+    if (s->error) { return; }
+  }
+
+  // Sequence decoding state, only used by lane 0
+  zstd_bwd_bits_s b;
+  uint32_t ll_state = 0, of_state = 0, ml_state = 0;
+  uint32_t seq_idx = 0;
+  if (t == 0) {
+    uint32_t hdr_len = parse_sequences_header(s, src + seq_pos, len - seq_pos);
+    if (hdr_len == 0) {
+      s->error = 1;
+    } else if (s->num_seq != 0) {
+      seq_pos += hdr_len;
+      if (!bwd_init(&b, src + seq_pos, len - seq_pos)) {
+        s->error = 1;
+      } else {
+        ll_state = bwd_read(&b, s->ll_log);
+        of_state = bwd_read(&b, s->of_log);
+        ml_state = bwd_read(&b, s->ml_log);
+      }
+    }
+  }
+  SYNCWARP();
+  if (s->error) { return; }
+
+  uint8_t *out      = s->dst;
+  uint32_t lit_pos  = 0;
+  uint32_t num_seq  = s->num_seq;
+  uint32_t lit_size = s->lit_size;
+  for (uint32_t batch = 0; batch < num_seq; batch += ZSTD_SEQ_BATCH_SIZE) {
+    if (t == 0) {
+      uint32_t count = min(num_seq - batch, ZSTD_SEQ_BATCH_SIZE);
+      for (uint32_t i = 0; i < count; i++, seq_idx++) {
+        uint32_t of_code = s->of[of_state].symbol;
+        uint32_t ml_code = s->ml[ml_state].symbol;
+        uint32_t ll_code = s->ll[ll_state].symbol;
+        uint32_t offset  = (1u << of_code) + bwd_read(&b, of_code);
+        uint32_t ml      = k_ml_base[ml_code] + bwd_read(&b, k_ml_bits[ml_code]);
+        uint32_t ll      = k_ll_base[ll_code] + bwd_read(&b, k_ll_bits[ll_code]);
+        if (offset > 3) {
+          offset -= 3;
+          s->rep[2] = s->rep[1];
+          s->rep[1] = s->rep[0];
+          s->rep[0] = offset;
+        } else {
+          uint32_t idx = offset - (ll != 0);
+          if (idx == 0) {
+            offset = s->rep[0];
+          } else {
+            offset = (idx < 3) ? s->rep[idx] : s->rep[0] - 1;
+            if (idx != 1) { s->rep[2] = s->rep[1]; }
+            s->rep[1] = s->rep[0];
+            s->rep[0] = offset;
+          }
+        }
+        s->seq[i].literal_length = ll;
+        s->seq[i].match_length   = ml;
+        s->seq[i].offset         = offset;
+        if (seq_idx + 1 < num_seq) {
+          ll_state = s->ll[ll_state].new_state + bwd_read(&b, s->ll[ll_state].num_bits);
+          ml_state = s->ml[ml_state].new_state + bwd_read(&b, s->ml[ml_state].num_bits);
+          of_state = s->of[of_state].new_state + bwd_read(&b, s->of[of_state].num_bits);
+        }
+      }
+      if (b.bitpos < 0 || (seq_idx == num_seq && b.bitpos != 0)) { s->error = 1; }
+      s->seq_count = count;
+    }
+    SYNCWARP();
+    if (s->error) { return; }
+    for (uint32_t i = 0; i < s->seq_count; i++) {
+      uint32_t ll     = s->seq[i].literal_length;
+      uint32_t ml     = s->seq[i].match_length;
+      uint32_t offset = s->seq[i].offset;
+      if (lit_pos + ll > lit_size || ll + ml > s->dst_end - out || offset == 0 ||
+          offset > (out - s->frame_start) + ll) {
+        if (t == 0) { s->error = 1; }
+        break;
+      }
+      copy_literals(s, out, lit_pos, ll, t);
+      lit_pos += ll;
+      out += ll;
+      copy_match(out, offset, ml, t);
+      out += ml;
+    }
+    SYNCWARP();
+    if (s->error) { return; }
+  }
+  // Remaining literals after the last sequence
+  if (lit_pos > lit_size || lit_size - lit_pos > s->dst_end - out) {
+    if (t == 0) { s->error = 1; }
+    return;
+  }
+  copy_literals(s, out, lit_pos, lit_size - lit_pos, t);
+  out += lit_size - lit_pos;
+  SYNCWARP();
+  if (t == 0) { s->dst = out; }
+}
+
+/**
+ * @brief Advances to the next block, parsing frame headers and trailers as needed (lane 0)
+ **/
+static __device__ void parse_next_block(unzstd_state_s *s)
+{
+  for (;;) {
+    const uint8_t *cur = s->cur;
+    uint32_t avail     = static_cast<uint32_t>(s->end - cur);
+    if (s->in_frame) {
+      if (!s->last_block) { break; }
+      // End of frame: skip the checksum and validate the content size
+      if (s->has_checksum) {
+        if (avail < 4) {
+          s->error = 1;
+          return;
+        }
+        cur += 4;
+        avail -= 4;
+      }
+      if (s->frame_size != ~0ull &&
+          s->frame_size != static_cast<uint64_t>(s->dst - s->frame_start)) {
+        s->error = 1;
+        return;
+      }
+      s->in_frame = 0;
+      s->cur      = cur;
+    }
+    if (avail == 0) {
+      s->done = 1;
+      return;
+    }
+    if (avail < 4) {
+      s->error = 1;
+      return;
+    }
+    uint32_t magic = cur[0] | (cur[1] << 8) | (cur[2] << 16) | (cur[3] << 24);
+    if ((magic & ~0xfu) == ZSTD_SKIPPABLE_MAGIC) {
+      if (avail < 8) {
+        s->error = 1;
+        return;
+      }
+      uint32_t skip = cur[4] | (cur[5] << 8) | (cur[6] << 16) | (cur[7] << 24);
+      if (skip > avail - 8) {
+        s->error = 1;
+        return;
+      }
+      s->cur = cur + 8 + skip;
+      continue;
+    }
+    if (magic != ZSTD_MAGIC || avail < 5) {
+      s->error = 1;
+      return;
+    }
+    // Frame header
+    uint32_t desc       = cur[4];
+    uint32_t fcs_flag   = desc >> 6;
+    uint32_t single_seg = (desc >> 5) & 1;
+    uint32_t dict_flag  = desc & 3;
+    uint32_t fcs_len    = (fcs_flag == 0) ? single_seg : (1 << fcs_flag);
+    uint32_t dict_len   = (dict_flag == 3) ? 4 : dict_flag;
+    uint32_t hdr_len    = 5 + (single_seg ? 0 : 1) + dict_len;
+    if ((desc & 0x08) || avail < hdr_len + fcs_len) {
+      s->error = 1;
+      return;
+    }
+    uint32_t dict_id = 0;
+    for (uint32_t i = 0; i < dict_len; i++) { dict_id |= cur[hdr_len - dict_len + i] << (8 * i); }
+    if (dict_id != 0) {
+      s->error = 1;  // Dictionaries are not supported
+      return;
+    }
+    uint64_t fcs = 0;
+    for (uint32_t i = 0; i < fcs_len; i++) {
+      fcs |= static_cast<uint64_t>(cur[hdr_len + i]) << (8 * i);
+    }
+    if (fcs_len == 2) { fcs += 256; }
+    s->frame_size   = (fcs_len != 0) ? fcs : ~0ull;
+    s->has_checksum = (desc >> 2) & 1;
+    s->frame_start  = s->dst;
+    s->in_frame     = 1;
+    s->last_block   = 0;
+    s->huf_log      = 0;
+    s->tables_valid = 0;
+    s->rep[0]       = 1;
+    s->rep[1]       = 4;
+    s->rep[2]       = 8;
+    s->cur          = cur + hdr_len + fcs_len;
+    break;
+  }
+  // Block header
+  const uint8_t *cur = s->cur;
+  if (s->end - cur < 3) {
+    s->error = 1;
+    return;
+  }
+  uint32_t hdr  = cur[0] | (cur[1] << 8) | (cur[2] << 16);
+  s->last_block = hdr & 1;
+  s->block_type = (hdr >> 1) & 3;
+  s->block_size = hdr >> 3;
+  s->block_src  = cur + 3;
+  uint32_t len  = (s->block_type == ZSTD_BLOCK_RLE) ? 1 : s->block_size;
+  if (s->block_type > ZSTD_BLOCK_COMPRESSED || s->block_size > ZSTD_MAX_BLOCK_SIZE ||
+      len > s->end - s->block_src ||
+      (s->block_type != ZSTD_BLOCK_COMPRESSED && s->block_size > s->dst_end - s->dst)) {
+    s->error = 1;
+    return;
+  }
+  s->cur = s->block_src + len;
+}
+
+/**
+ * @brief Decompresses a complete Zstandard stream (warp-wide)
+ **/
+static __device__ void unzstd_stream(unzstd_state_s *s,
+                                     const gpu_inflate_input_s *in,
+                                     gpu_inflate_status_s *out,
+                                     int t)
+{
+  if (t == 0) {
+    s->cur          = static_cast<const uint8_t *>(in->srcDevice);
+    s->end          = s->cur + in->srcSize;
+    s->dst_base     = static_cast<uint8_t *>(in->dstDevice);
+    s->dst          = s->dst_base;
+    s->dst_end      = s->dst_base + in->dstSize;
+    s->frame_start  = s->dst;
+    s->error        = (in->srcSize == 0);
+    s->done         = 0;
+    s->in_frame     = 0;
+    s->last_block   = 0;
+    s->huf_log      = 0;
+    s->tables_valid = 0;
+  }
+  SYNCWARP();
+  while (!s->error) {
+    if (t == 0) { parse_next_block(s); }
+    SYNCWARP();
+    if (s->error || s->done) { break; }
+    uint8_t *dst = s->dst;
+    uint32_t len = s->block_size;
+    if (s->block_type == ZSTD_BLOCK_RAW) {
+      for (uint32_t i = t; i < len; i += 32) { dst[i] = s->block_src[i]; }
+    } else if (s->block_type == ZSTD_BLOCK_RLE) {
+      uint8_t v = s->block_src[0];
+      for (uint32_t i = t; i < len; i += 32) { dst[i] = v; }
+    } else {
+      decode_compressed_block(s, t);
+    }
+    SYNCWARP();
+    if (t == 0 && s->block_type != ZSTD_BLOCK_COMPRESSED) { s->dst = dst + len; }
+    SYNCWARP();
+  }
+  if (t == 0) {
+    out->bytes_written = s->dst - s->dst_base;
+    out->status        = s->error;
+    out->reserved      = 0;
+  }
+}
+
+/**
+ * @brief Zstandard decompression kernel
+ * See https://tools.ietf.org/html/rfc8878
+ *
+ * blockDim {128,1,1}, one warp per stream
+ *
+ * @param[in] inputs Source & destination information per block
+ * @param[out] outputs Decompression status per block
+ * @param[in] count Number of blocks to decompress
+ **/
+extern "C" __global__ void __launch_bounds__(32 * ZSTD_WARPS_PER_BLOCK)
+  unzstd_kernel(gpu_inflate_input_s *inputs, gpu_inflate_status_s *outputs, int count)
+{
+  __shared__ __align__(16) unzstd_state_s state_g[ZSTD_WARPS_PER_BLOCK];
+
+  int t       = threadIdx.x & 0x1f;
+  int w       = threadIdx.x >> 5;
+  int strm_id = blockIdx.x * ZSTD_WARPS_PER_BLOCK + w;
+  if (strm_id < count) { unzstd_stream(&state_g[w], &inputs[strm_id], &outputs[strm_id], t); }
+}
+
+cudaError_t __host__ gpu_unzstd(gpu_inflate_input_s *inputs,
+                                gpu_inflate_status_s *outputs,
+                                int count,
+                                cudaStream_t stream)
+{
+  uint32_t count32 = (count > 0) ? count : 0;
+  dim3 dim_block(32 * ZSTD_WARPS_PER_BLOCK, 1);  // 1 warp per stream
+  dim3 dim_grid((count32 + ZSTD_WARPS_PER_BLOCK - 1) / ZSTD_WARPS_PER_BLOCK, 1);
+  if (count32 > 0) { unzstd_kernel<<<dim_grid, dim_block, 0, stream>>>(inputs, outputs, count); }
+  return cudaSuccess;
+}
+
+}  // namespace io
+}  // namespace cudf
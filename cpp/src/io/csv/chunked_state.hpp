@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file chunked_state.hpp
+ * @brief definition for chunked state structure used by CSV reader
+ */
+
+#pragma once
+
+#include <cudf/io/readers.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace csv {
+
+/**
+ * @brief Chunked reader state struct. Holds the reader, and thus the parsed header and column
+ *        types, across the begin() / read() / end() call process.
+ */
+struct csv_chunked_read_state {
+  /// The reader to be used
+  std::unique_ptr<reader> rp;
+  /// Cuda stream to be used
+  cudaStream_t stream = 0;
+};
+
+}  // namespace csv
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -19,8 +19,10 @@
 
 #include "datetime.cuh"
 
+#include <cudf/detail/utilities/launch_config.hpp>
 #include <cudf/detail/utilities/trie.cuh>
 #include <cudf/lists/list_view.cuh>
+#include <cudf/structs/struct_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/bit.hpp>
@@ -39,8 +41,15 @@ namespace io {
 namespace csv {
 namespace gpu {
 
-/// Block dimension for dtype detection and conversion kernels
+/// Default block dimension for dtype detection and conversion kernels
 constexpr uint32_t csvparse_block_dim = 128;
+/// Largest tunable block dimension of the kernels, which process one row per thread
+constexpr uint32_t csvparse_max_block_dim = 256;
+
+cudf::detail::tunable_kernel const data_type_detection_config{
+  "csv_data_type_detection", csvparse_block_dim, {64, 128, 256}};
+cudf::detail::tunable_kernel const convert_csv_to_cudf_config{
+  "csv_convert_csv_to_cudf", csvparse_block_dim, {64, 128, 256}};
 
 /*
  * @brief Checks whether the given character is a whitespace character.
@@ -166,6 +175,94 @@ __device__ __inline__ bool is_floatingpoint(
   return true;
 }
 
+/**
+ * @brief Adds the type of one field to the type histogram of its column
+ *
+ * @param raw_csv The entire CSV data to read
+ * @param opts A set of parsing options
+ * @param flags Parsing behavior flags of the column
+ * @param start Offset of the first character of the field
+ * @param pos Offset of the delimiter or terminator ending the field
+ * @param stats The type histogram of the column
+ */
+__device__ void detect_field_type(const char *raw_csv,
+                                  ParseOptions const &opts,
+                                  column_parse::flags flags,
+                                  long start,
+                                  long pos,
+                                  column_parse::stats *stats)
+{
+  long tempPos   = pos - 1;
+  long field_len = pos - start;
+
+  if (field_len <= 0 || serializedTrieContains(opts.naValuesTrie, raw_csv + start, field_len)) {
+    atomicAdd(&stats->countNULL, 1);
+  } else if (serializedTrieContains(opts.trueValuesTrie, raw_csv + start, field_len) ||
+             serializedTrieContains(opts.falseValuesTrie, raw_csv + start, field_len)) {
+    atomicAdd(&stats->countBool, 1);
+  } else {
+    long countNumber   = 0;
+    long countDecimal  = 0;
+    long countSlash    = 0;
+    long countDash     = 0;
+    long countPlus     = 0;
+    long countColon    = 0;
+    long countString   = 0;
+    long countExponent = 0;
+
+    // Modify start & end to ignore whitespace and quotechars
+    // This could possibly result in additional empty fields
+    trim_field_start_end(raw_csv, &start, &tempPos);
+    field_len = tempPos - start + 1;
+
+    for (long startPos = start; startPos <= tempPos; startPos++) {
+      if (is_digit(raw_csv[startPos])) {
+        countNumber++;
+        continue;
+      }
+      // Looking for unique characters that will help identify column types.
+      switch (raw_csv[startPos]) {
+        case '.': countDecimal++; break;
+        case '-': countDash++; break;
+        case '+': countPlus++; break;
+        case '/': countSlash++; break;
+        case ':': countColon++; break;
+        case 'e':
+        case 'E':
+          if (startPos > start && startPos < tempPos) countExponent++;
+          break;
+        default: countString++; break;
+      }
+    }
+
+    // Integers have to have the length of the string
+    long int_req_number_cnt = field_len;
+    // Off by one if they start with a minus sign
+    if ((raw_csv[start] == '-' || raw_csv[start] == '+') && field_len > 1) {
+      --int_req_number_cnt;
+    }
+
+    if (field_len == 0) {
+      // Ignoring whitespace and quotes can result in empty fields
+      atomicAdd(&stats->countNULL, 1);
+    } else if (flags & column_parse::as_datetime) {
+      // PANDAS uses `object` dtype if the date is unparseable
+      if (is_datetime(countString, countDecimal, countColon, countDash, countSlash)) {
+        atomicAdd(&stats->countDateAndTime, 1);
+      } else {
+        atomicAdd(&stats->countString, 1);
+      }
+    } else if (countNumber == int_req_number_cnt) {
+      atomicAdd(&stats->countInt64, 1);
+    } else if (is_floatingpoint(
+                 field_len, countNumber, countDecimal, countDash + countPlus, countExponent)) {
+      atomicAdd(&stats->countFloat, 1);
+    } else {
+      atomicAdd(&stats->countString, 1);
+    }
+  }
+}
+
 /*
  * @brief CUDA kernel that parses and converts CSV data into cuDF column data.
  *
@@ -178,15 +275,18 @@ __device__ __inline__ bool is_floatingpoint(
  * @param num_columns The number of columns of CSV data
  * @param column_flags Per-column parsing behavior flags
  * @param recStart The start the CSV data of interest
+ * @param row_indices Indices of the rows to process, or nullptr to process the first
+ * `num_records` rows
  * @param d_columnData The count for each column data type
  */
-__global__ void __launch_bounds__(csvparse_block_dim)
+__global__ void __launch_bounds__(csvparse_max_block_dim)
   data_type_detection(const char *raw_csv,
                       const ParseOptions opts,
                       size_t num_records,
                       int num_columns,
                       column_parse::flags *flags,
                       const uint64_t *recStart,
+                      const cudf::size_type *row_indices,
                       column_parse::stats *d_columnData)
 {
   // ThreadIds range per block, so also need the blockId
@@ -196,6 +296,7 @@ __global__ void __launch_bounds__(csvparse_block_dim)
   // we can have more threads than data, make sure we are not past the end of
   // the data
   if (rec_id >= num_records) { return; }
+  if (row_indices != nullptr) { rec_id = row_indices[rec_id]; }
 
   long start = recStart[rec_id];
   long stop  = recStart[rec_id + 1];
@@ -213,75 +314,7 @@ __global__ void __launch_bounds__(csvparse_block_dim)
     // Checking if this is a column that the user wants --- user can filter
     // columns
     if (flags[col] & column_parse::enabled) {
-      long tempPos   = pos - 1;
-      long field_len = pos - start;
-
-      if (field_len <= 0 || serializedTrieContains(opts.naValuesTrie, raw_csv + start, field_len)) {
-        atomicAdd(&d_columnData[actual_col].countNULL, 1);
-      } else if (serializedTrieContains(opts.trueValuesTrie, raw_csv + start, field_len) ||
-                 serializedTrieContains(opts.falseValuesTrie, raw_csv + start, field_len)) {
-        atomicAdd(&d_columnData[actual_col].countBool, 1);
-      } else {
-        long countNumber   = 0;
-        long countDecimal  = 0;
-        long countSlash    = 0;
-        long countDash     = 0;
-        long countPlus     = 0;
-        long countColon    = 0;
-        long countString   = 0;
-        long countExponent = 0;
-
-        // Modify start & end to ignore whitespace and quotechars
-        // This could possibly result in additional empty fields
-        trim_field_start_end(raw_csv, &start, &tempPos);
-        field_len = tempPos - start + 1;
-
-        for (long startPos = start; startPos <= tempPos; startPos++) {
-          if (is_digit(raw_csv[startPos])) {
-            countNumber++;
-            continue;
-          }
-          // Looking for unique characters that will help identify column types.
-          switch (raw_csv[startPos]) {
-            case '.': countDecimal++; break;
-            case '-': countDash++; break;
-            case '+': countPlus++; break;
-            case '/': countSlash++; break;
-            case ':': countColon++; break;
-            case 'e':
-            case 'E':
-              if (startPos > start && startPos < tempPos) countExponent++;
-              break;
-            default: countString++; break;
-          }
-        }
-
-        // Integers have to have the length of the string
-        long int_req_number_cnt = field_len;
-        // Off by one if they start with a minus sign
-        if ((raw_csv[start] == '-' || raw_csv[start] == '+') && field_len > 1) {
-          --int_req_number_cnt;
-        }
-
-        if (field_len == 0) {
-          // Ignoring whitespace and quotes can result in empty fields
-          atomicAdd(&d_columnData[actual_col].countNULL, 1);
-        } else if (flags[col] & column_parse::as_datetime) {
-          // PANDAS uses `object` dtype if the date is unparseable
-          if (is_datetime(countString, countDecimal, countColon, countDash, countSlash)) {
-            atomicAdd(&d_columnData[actual_col].countDateAndTime, 1);
-          } else {
-            atomicAdd(&d_columnData[actual_col].countString, 1);
-          }
-        } else if (countNumber == int_req_number_cnt) {
-          atomicAdd(&d_columnData[actual_col].countInt64, 1);
-        } else if (is_floatingpoint(
-                     field_len, countNumber, countDecimal, countDash + countPlus, countExponent)) {
-          atomicAdd(&d_columnData[actual_col].countFloat, 1);
-        } else {
-          atomicAdd(&d_columnData[actual_col].countString, 1);
-        }
-      }
+      detect_field_type(raw_csv, opts, flags[col], start, pos, &d_columnData[actual_col]);
       actual_col++;
     }
     pos++;
@@ -401,6 +434,14 @@ __inline__ __device__ cudf::list_view decode_value(const char *data,
 {
   return cudf::list_view{};
 }
+template <>
+__inline__ __device__ cudf::struct_view decode_value(const char *data,
+                                                     long start,
+                                                     long end,
+                                                     ParseOptions const &opts)
+{
+  return cudf::struct_view{};
+}
 
 /**
  * @brief Functor for converting CSV raw data to typed value.
@@ -524,9 +565,9 @@ struct decode_op {
  * @param[in] dtype The data type of the column
  * @param[out] data The output column data
  * @param[out] valid The bitmaps indicating whether column fields are valid
- * @param[out] num_valid The numbers of valid fields in columns
+ * @param[out] stats If not null, the type histograms of the columns, gathered while decoding
  **/
-__global__ void __launch_bounds__(csvparse_block_dim)
+__global__ void __launch_bounds__(csvparse_max_block_dim)
   convert_csv_to_cudf(const char *raw_csv,
                       const ParseOptions opts,
                       size_t num_records,
@@ -535,7 +576,8 @@ __global__ void __launch_bounds__(csvparse_block_dim)
                       const uint64_t *recStart,
                       cudf::data_type *dtype,
                       void **data,
-                      cudf::bitmask_type **valid)
+                      cudf::bitmask_type **valid,
+                      column_parse::stats *stats)
 {
   // thread IDs range per block, so also need the block id
   long rec_id =
@@ -559,6 +601,9 @@ __global__ void __launch_bounds__(csvparse_block_dim)
     pos = cudf::io::gpu::seek_field_end(raw_csv, opts, pos, stop);
 
     if (flags[col] & column_parse::enabled) {
+      if (stats != nullptr) {
+        detect_field_type(raw_csv, opts, flags[col], start, pos, &stats[actual_col]);
+      }
       // check if the entire field is a NaN string - consistent with pandas
       const bool is_na = serializedTrieContains(opts.naValuesTrie, raw_csv + start, pos - start);
 
@@ -986,15 +1031,17 @@ cudaError_t __host__ DetectColumnTypes(const char *data,
                                        size_t num_columns,
                                        const ParseOptions &options,
                                        column_parse::flags *flags,
+                                       const cudf::size_type *row_indices,
                                        column_parse::stats *stats,
                                        cudaStream_t stream)
 {
   // Calculate actual block count to use based on records count
-  const int block_size = csvparse_block_dim;
+  cudf::detail::tuned_launch launch(data_type_detection_config, num_rows, stream);
+  const int block_size = launch.block_size();
   const int grid_size  = (num_rows + block_size - 1) / block_size;
 
   data_type_detection<<<grid_size, block_size, 0, stream>>>(
-    data, options, num_rows, num_columns, flags, row_starts, stats);
+    data, options, num_rows, num_columns, flags, row_starts, row_indices, stats);
 
   return cudaSuccess;
 }
@@ -1008,14 +1055,16 @@ cudaError_t __host__ DecodeRowColumnData(const char *data,
                                          cudf::data_type *dtypes,
                                          void **columns,
                                          cudf::bitmask_type **valids,
+                                         column_parse::stats *stats,
                                          cudaStream_t stream)
 {
   // Calculate actual block count to use based on records count
-  const int block_size = csvparse_block_dim;
+  cudf::detail::tuned_launch launch(convert_csv_to_cudf_config, num_rows, stream);
+  const int block_size = launch.block_size();
   const int grid_size  = (num_rows + block_size - 1) / block_size;
 
   convert_csv_to_cudf<<<grid_size, block_size, 0, stream>>>(
-    data, options, num_rows, num_columns, flags, row_starts, dtypes, columns, valids);
+    data, options, num_rows, num_columns, flags, row_starts, dtypes, columns, valids, stats);
 
   return cudaSuccess;
 }
@@ -198,6 +198,8 @@ void remove_blank_rows(rmm::device_vector<uint64_t> &row_offsets,
  * @param[in] num_columns Number of columns
  * @param[in] options Options that control individual field data conversion
  * @param[in,out] flags Flags that control individual column parsing
+ * @param[in] row_indices Indices of the `num_rows` rows to process, or nullptr to process the
+ * first `num_rows` rows
  * @param[out] stats Histogram of each dtypes' occurrence for each column
  * @param[in] stream CUDA stream to use, default 0
  *
@@ -209,6 +211,7 @@ cudaError_t DetectColumnTypes(const char *data,
                               size_t num_columns,
                               const cudf::io::ParseOptions &options,
                               column_parse::flags *flags,
+                              const cudf::size_type *row_indices,
                               column_parse::stats *stats,
                               cudaStream_t stream = (cudaStream_t)0);
 
@@ -224,7 +227,8 @@ cudaError_t DetectColumnTypes(const char *data,
  * @param[in] dtypes List of dtype corresponding to each column
  * @param[out] columns Device memory output of column data
  * @param[out] valids Device memory output of column valids bitmap data
- * @param[out] num_valid Number of valid fields in each column
+ * @param[out] stats If not null, histogram of each dtypes' occurrence for each column, gathered
+ * while decoding
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -238,7 +242,8 @@ cudaError_t DecodeRowColumnData(const char *data,
                                 cudf::data_type *dtypes,
                                 void **columns,
                                 cudf::bitmask_type **valids,
-                                cudaStream_t stream = (cudaStream_t)0);
+                                column_parse::stats *stats = nullptr,
+                                cudaStream_t stream        = (cudaStream_t)0);
 
 }  // namespace gpu
 }  // namespace csv
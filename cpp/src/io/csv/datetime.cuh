@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cudf/detail/utilities/datetime_parsing.cuh>
+
 /**
  * @brief Returns location to the first occurrence of a character in a string
  *
@@ -317,6 +319,13 @@ __inline__ __device__ int32_t parseDateFormat(const char *data,
                                               long end_idx,
                                               bool dayfirst)
 {
+  // ISO-8601 dates are read at fixed offsets without searching for the separators
+  cudf::detail::iso_datetime iso;
+  if (end_idx - start_idx + 1 == cudf::detail::iso_date_length &&
+      cudf::detail::parse_iso_date(data + start_idx, iso)) {
+    return daysSinceEpoch(iso.year, iso.month, iso.day);
+  }
+
   int day, month, year;
   int32_t e = -1;
 
@@ -346,6 +355,34 @@ __inline__ __device__ int64_t parseDateTimeFormat(const char *data,
                                                   long end,
                                                   bool dayfirst)
 {
+  // ISO-8601 dates and times, optionally followed by a fraction of a second, are read at fixed
+  // offsets without searching for the separators
+  auto const length = end - start + 1;
+  cudf::detail::iso_datetime iso;
+  if (length == cudf::detail::iso_date_length && cudf::detail::parse_iso_date(data + start, iso)) {
+    return secondsSinceEpoch(iso.year, iso.month, iso.day, 0, 0, 0) * 1000;
+  }
+  if (length >= cudf::detail::iso_datetime_length &&
+      cudf::detail::parse_iso_datetime(data + start, iso)) {
+    auto const fraction_start = start + cudf::detail::iso_datetime_length;
+    bool is_iso               = (length == cudf::detail::iso_datetime_length);
+    if (!is_iso && data[fraction_start] == '.' && fraction_start < end) {
+      is_iso = true;
+      for (long i = fraction_start + 1; i <= end; ++i) {
+        if (data[i] < '0' || data[i] > '9') { is_iso = false; }
+      }
+    }
+    if (is_iso) {
+      auto const millisecond =
+        (length == cudf::detail::iso_datetime_length)
+          ? 0
+          : convertStrToInteger<int>(data, fraction_start + 1, end);
+      return secondsSinceEpoch(iso.year, iso.month, iso.day, iso.hour, iso.minute, iso.second) *
+               1000 +
+             millisecond;
+    }
+  }
+
   int day, month, year;
   int hour, minute, second, millisecond = 0;
   int64_t answer = -1;
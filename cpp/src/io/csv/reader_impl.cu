@@ -22,11 +22,15 @@
 #include "reader_impl.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cstring>
+#include <future>
 #include <iostream>
 #include <numeric>
 #include <tuple>
 #include <unordered_map>
 
+#include <cudf/detail/utilities/scratch_memory.cuh>
 #include <cudf/strings/replace.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
@@ -45,6 +49,116 @@ namespace csv {
 using namespace cudf::io::csv;
 using namespace cudf::io;
 
+namespace {
+/**
+ * @brief Copies host data to device memory in chunks on a background thread
+ *
+ * Each chunk is staged through one of two pinned buffers, so the copy of the next chunks overlaps
+ * with the kernels that process the current one. `wait_for` makes a stream wait until the data
+ * it is about to read has arrived.
+ **/
+class chunked_device_upload {
+ public:
+  chunked_device_upload(const char *h_data, size_t size, char *d_data, size_t chunk_bytes)
+    : num_chunks_((size + chunk_bytes - 1) / chunk_bytes),
+      chunk_bytes_(chunk_bytes),
+      recorded_(num_chunks_),
+      events_(num_chunks_)
+  {
+    CUDA_TRY(cudaStreamCreateWithFlags(&copy_stream_, cudaStreamNonBlocking));
+    for (auto &event : events_) {
+      CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    }
+    for (auto &stage : staging_) { CUDA_TRY(cudaMallocHost(&stage, std::min(chunk_bytes, size))); }
+    for (auto &recorded : recorded_) { ready_.push_back(recorded.get_future()); }
+    worker_ = std::async(std::launch::async, [=]() { upload(h_data, size, d_data); });
+  }
+
+  ~chunked_device_upload()
+  {
+    worker_.wait();
+    cudaStreamSynchronize(copy_stream_);
+    for (auto stage : staging_) { cudaFreeHost(stage); }
+    for (auto event : events_) { cudaEventDestroy(event); }
+    cudaStreamDestroy(copy_stream_);
+  }
+
+  /**
+   * @brief Makes `stream` wait until the first `end` bytes are in device memory
+   **/
+  void wait_for(size_t end, cudaStream_t stream)
+  {
+    auto const needed = std::min(num_chunks_, (end + chunk_bytes_ - 1) / chunk_bytes_);
+    for (; waited_ < needed; ++waited_) {
+      ready_[waited_].get();  // rethrows any exception from the upload
+      CUDA_TRY(cudaStreamWaitEvent(stream, events_[waited_], 0));
+    }
+  }
+
+ private:
+  void upload(const char *h_data, size_t size, char *d_data)
+  {
+    size_t chunk = 0;
+    try {
+      for (; chunk < num_chunks_; ++chunk) {
+        auto const offset = chunk * chunk_bytes_;
+        auto const bytes  = std::min(chunk_bytes_, size - offset);
+        auto const stage  = staging_[chunk % staging_.size()];
+        // The staging buffer is reused once its previous copy has completed
+        if (chunk >= staging_.size()) {
+          CUDA_TRY(cudaEventSynchronize(events_[chunk - staging_.size()]));
+        }
+        std::memcpy(stage, h_data + offset, bytes);
+        CUDA_TRY(
+          cudaMemcpyAsync(d_data + offset, stage, bytes, cudaMemcpyHostToDevice, copy_stream_));
+        CUDA_TRY(cudaEventRecord(events_[chunk], copy_stream_));
+        recorded_[chunk].set_value();
+      }
+    } catch (...) {
+      for (; chunk < num_chunks_; ++chunk) {
+        recorded_[chunk].set_exception(std::current_exception());
+      }
+    }
+  }
+
+  size_t const num_chunks_;
+  size_t const chunk_bytes_;
+  size_t waited_ = 0;
+  std::array<char *, 2> staging_{};
+  std::vector<std::promise<void>> recorded_;
+  std::vector<std::future<void>> ready_;
+  std::vector<cudaEvent_t> events_;
+  cudaStream_t copy_stream_ = 0;
+  std::future<void> worker_;
+};
+
+/**
+ * @brief Copies the serialized trie of a set of keys and its perfect hash table to the device
+ *
+ * @param keys Strings in the set
+ * @param d_trie Output device trie
+ * @param d_hash Output device hash table
+ *
+ * @return View of the device trie and hash table
+ */
+SerialTrieView make_trie_view(std::vector<std::string> const &keys,
+                              rmm::device_vector<SerialTrieNode> &d_trie,
+                              rmm::device_vector<SerialTrieHashSlot> &d_hash)
+{
+  d_trie          = createSerializedTrie(keys);
+  auto const hash = createSerializedTrieHash(keys);
+  SerialTrieView view{d_trie.data().get()};
+  if (not hash.slots.empty()) {
+    d_hash          = hash.slots;
+    view.hash_slots = d_hash.data().get();
+    view.hash_mask  = static_cast<uint32_t>(hash.slots.size() - 1);
+    view.hash_seed  = hash.seed;
+  }
+  return view;
+}
+
+}  // namespace
+
 /**
  * @brief Estimates the maximum expected length or a row, based on the number
  * of columns
@@ -182,6 +296,7 @@ table_with_metadata reader::impl::read(size_t range_offset,
 {
   std::vector<std::unique_ptr<column>> out_columns;
   table_metadata metadata;
+  auto metrics = args_.collect_metrics ? std::make_unique<io_metrics>() : nullptr;
 
   if (range_offset > 0 || range_size > 0) {
     CUDF_EXPECTS(compression_type_ == "none",
@@ -197,12 +312,13 @@ table_with_metadata reader::impl::read(size_t range_offset,
   // This allows only mapping of a subset of the file if using byte range
   if (source_ == nullptr) {
     assert(!filepath_.empty());
-    source_ = datasource::create(filepath_, range_offset, map_range_size);
+    set_source(datasource::create(filepath_, range_offset, map_range_size));
   }
 
   // Return an empty dataframe if no data and no column metadata to process
   if (source_->is_empty() && (args_.names.empty() || args_.dtype.empty())) {
-    return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
+    return {
+      std::make_unique<table>(std::move(out_columns)), std::move(metadata), std::move(metrics)};
   }
 
   // Transfer source data to GPU
@@ -219,6 +335,7 @@ table_with_metadata reader::impl::read(size_t range_offset,
       h_uncomp_data = reinterpret_cast<const char *>(buffer->data());
       h_uncomp_size = buffer->size();
     } else {
+      metrics_timer timer(metrics.get(), &io_metrics::decompression_ms, stream, false);
       h_uncomp_data_owner = getUncompressedHostData(
         reinterpret_cast<const char *>(buffer->data()), buffer->size(), compression_type_);
       h_uncomp_data = h_uncomp_data_owner.data();
@@ -244,6 +361,7 @@ table_with_metadata reader::impl::read(size_t range_offset,
                        (skip_rows > 0) ? skip_rows : 0,
                        num_rows,
                        load_whole_file,
+                       true,
                        stream);
 
     // Exclude the rows that are to be skipped from the end
@@ -258,6 +376,120 @@ table_with_metadata reader::impl::read(size_t range_offset,
     num_records = 0;
   }
 
+  return read_columns(std::move(metrics), stream);
+}
+
+void reader::impl::begin_chunked_read(size_t chunk_size)
+{
+  CUDF_EXPECTS(chunk_size > 0, "Chunk size must be positive");
+  CUDF_EXPECTS(compression_type_ == "none", "Reading compressed data in chunks is unsupported");
+
+  if (source_ == nullptr) {
+    assert(!filepath_.empty());
+    set_source(datasource::create(filepath_));
+  }
+  chunk_size_   = chunk_size;
+  chunk_offset_ = 0;
+  chunk_column_types_.clear();
+
+  if (has_next_chunk()) {
+    const auto num_columns = std::max(args_.names.size(), args_.dtype.size());
+    const auto read_size   = chunk_size_ + calculateMaxRowSize(num_columns);
+    prefetch_chunk_data(0, std::min(read_size, source_->size()));
+  }
+}
+
+bool reader::impl::has_next_chunk() const
+{
+  return chunk_size_ != 0 && chunk_offset_ < source_->size();
+}
+
+table_with_metadata reader::impl::read_next_chunk(cudaStream_t stream)
+{
+  CUDF_EXPECTS(has_next_chunk(), "No chunks left to read");
+
+  const auto source_size  = source_->size();
+  const auto num_columns  = std::max(args_.names.size(), args_.dtype.size());
+  const auto max_row_size = calculateMaxRowSize(num_columns);
+  auto metrics            = args_.collect_metrics ? std::make_unique<io_metrics>() : nullptr;
+
+  // The chunk holds the rows that start within `chunk_size_` bytes; the data past the chunk must
+  // hold the end of its last row, so it is read again with more data if the row was cut off
+  size_t next_offset = chunk_offset_;
+  for (auto extra_size = max_row_size;; extra_size *= 2) {
+    const auto read_size = std::min(chunk_size_ + extra_size, source_size - chunk_offset_);
+    const auto buffer    = read_chunk_data(chunk_offset_, read_size);
+    const auto row_end   = gather_row_offsets(reinterpret_cast<const char *>(buffer->data()),
+                                            buffer->size(),
+                                            0,
+                                            chunk_size_,
+                                            0,
+                                            -1,
+                                            false,
+                                            chunk_offset_ == 0,
+                                            stream);
+    if (row_end < buffer->size() || chunk_offset_ + buffer->size() == source_size) {
+      next_offset = chunk_offset_ + row_end;
+      break;
+    }
+  }
+  chunk_offset_ = next_offset;
+
+  // Load the next chunk while this one is converted
+  if (has_next_chunk()) {
+    prefetch_chunk_data(chunk_offset_,
+                        std::min(chunk_size_ + max_row_size, source_size - chunk_offset_));
+  }
+
+  // Exclude the end-of-data row from number of rows with actual data
+  num_records = row_offsets.size();
+  num_records -= (num_records > 0);
+
+  return read_columns(std::move(metrics), stream);
+}
+
+std::unique_ptr<datasource::buffer> reader::impl::read_chunk_data(size_t offset, size_t size)
+{
+  if (prefetch_.valid()) {
+    auto buffer = prefetch_.get();
+    if (prefetch_offset_ == offset && prefetch_size_ == size) { return buffer; }
+  }
+  return source_->host_read(offset, size);
+}
+
+void reader::impl::prefetch_chunk_data(size_t offset, size_t size)
+{
+  prefetch_offset_ = offset;
+  prefetch_size_   = size;
+  prefetch_        = std::async(std::launch::async, [source = source_.get(), offset, size]() {
+    auto buffer = source->host_read(offset, size);
+    // Touch every page so that memory-mapped data is loaded before the chunk is parsed
+    constexpr size_t page_size = 4096;
+    volatile uint8_t sink      = 0;
+    for (size_t pos = 0; pos < buffer->size(); pos += page_size) { sink = buffer->data()[pos]; }
+    return buffer;
+  });
+}
+
+void reader::impl::set_source(std::unique_ptr<datasource> source)
+{
+  if (args_.collect_metrics) {
+    auto metered    = std::make_unique<metered_source>(std::move(source));
+    metered_source_ = metered.get();
+    source          = std::move(metered);
+  }
+  source_ = std::move(source);
+}
+
+table_with_metadata reader::impl::read_columns(std::unique_ptr<io_metrics> metrics,
+                                               cudaStream_t stream)
+{
+  // The source reads of the rows gathered so far are part of this read
+  if (metrics && metered_source_ != nullptr) { metered_source_->take_metrics(*metrics); }
+
+  std::vector<std::unique_ptr<column>> out_columns;
+  table_metadata metadata;
+
   // Check if the user gave us a list of column names
   if (not args_.names.empty()) {
     h_column_flags.resize(args_.names.size(), column_parse::enabled);
@@ -333,34 +565,54 @@ table_with_metadata reader::impl::read(size_t range_offset,
 
   // Return empty table rather than exception if nothing to load
   if (num_active_cols == 0) {
-    return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
+    return {
+      std::make_unique<table>(std::move(out_columns)), std::move(metadata), std::move(metrics)};
   }
 
-  std::vector<data_type> column_types = gather_column_types(stream);
+  // Chunks after the first one with rows keep its inferred column types
+  const bool reuse_column_types = args_.dtype.empty() && !chunk_column_types_.empty();
+  std::vector<data_type> column_types =
+    reuse_column_types ? chunk_column_types_ : gather_column_types(stream);
 
   // Alloc output; columns' data memory is still expected for empty dataframe
-  std::vector<column_buffer> out_buffers;
-  out_buffers.reserve(column_types.size());
-  for (int col = 0, active_col = 0; col < num_actual_cols; ++col) {
+  auto out_buffers = allocate_column_buffers(column_types, stream);
+  for (int col = 0; col < num_actual_cols; ++col) {
     if (h_column_flags[col] & column_parse::enabled) {
-      // Replace EMPTY dtype with STRING
-      if (column_types[active_col].id() == type_id::EMPTY) {
-        column_types[active_col] = data_type{type_id::STRING};
-      }
-      const bool is_final_allocation = column_types[active_col].id() != type_id::STRING;
-      out_buffers.emplace_back(column_types[active_col],
-                               num_records,
-                               true,
-                               stream,
-                               is_final_allocation ? mr_ : rmm::mr::get_default_resource());
       metadata.column_names.emplace_back(col_names[col]);
-      active_col++;
     }
   }
 
   out_columns.reserve(column_types.size());
   if (num_records != 0) {
-    decode_data(column_types, out_buffers, stream);
+    metrics_timer timer(metrics.get(), &io_metrics::decode_ms, stream);
+    if (sampled_column_types_ && !reuse_column_types) {
+      // Check the types inferred from the sample against the type histograms of all rows, and
+      // decode again with the wider types if the sample did not represent some columns
+      hostdevice_vector<column_parse::stats> column_stats(num_active_cols);
+      CUDA_TRY(cudaMemsetAsync(column_stats.device_ptr(), 0, column_stats.memory_size(), stream));
+      decode_data(column_types, out_buffers, column_stats.device_ptr(), stream);
+      CUDA_TRY(cudaMemcpyAsync(column_stats.host_ptr(),
+                               column_stats.device_ptr(),
+                               column_stats.memory_size(),
+                               cudaMemcpyDeviceToHost,
+                               stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+
+      auto widened_types = infer_column_types(column_stats, num_records);
+      if (args_.timestamp_type.id() != cudf::type_id::EMPTY) {
+        for (auto &type : widened_types) {
+          if (cudf::is_timestamp(type)) { type = args_.timestamp_type; }
+        }
+      }
+      if (widened_types != column_types) {
+        column_types = std::move(widened_types);
+        out_buffers  = allocate_column_buffers(column_types, stream);
+        decode_data(column_types, out_buffers, nullptr, stream);
+      }
+    } else {
+      decode_data(column_types, out_buffers, nullptr, stream);
+    }
+    if (chunk_size_ != 0 && args_.dtype.empty()) { chunk_column_types_ = column_types; }
 
     for (size_t i = 0; i < column_types.size(); ++i) {
       if (column_types[i].id() == type_id::STRING && opts.quotechar != '\0' &&
@@ -385,7 +637,7 @@ table_with_metadata reader::impl::read(size_t range_offset,
       out_columns.emplace_back(make_empty_column(column_types[i]));
     }
   }
-  return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
+  return {std::make_unique<table>(std::move(out_columns)), std::move(metadata), std::move(metrics)};
 }
 
 size_t reader::impl::find_first_row_start(const char *h_data, size_t h_size)
@@ -397,14 +649,15 @@ size_t reader::impl::find_first_row_start(const char *h_data, size_t h_size)
   return std::min(pos + 1, h_size);
 }
 
-void reader::impl::gather_row_offsets(const char *h_data,
-                                      size_t h_size,
-                                      size_t range_begin,
-                                      size_t range_end,
-                                      size_t skip_rows,
-                                      int64_t num_rows,
-                                      bool load_whole_file,
-                                      cudaStream_t stream)
+size_t reader::impl::gather_row_offsets(const char *h_data,
+                                        size_t h_size,
+                                        size_t range_begin,
+                                        size_t range_end,
+                                        size_t skip_rows,
+                                        int64_t num_rows,
+                                        bool load_whole_file,
+                                        bool extract_header,
+                                        cudaStream_t stream)
 {
   constexpr size_t max_chunk_bytes = 64 * 1024 * 1024;  // 64MB
   size_t buffer_size               = std::min(max_chunk_bytes, h_size);
@@ -413,7 +666,7 @@ void reader::impl::gather_row_offsets(const char *h_data,
   hostdevice_vector<uint64_t> row_ctx(max_blocks);
   size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), h_size);
   size_t pos         = std::min(range_begin, h_size);
-  size_t header_rows = (args_.header >= 0) ? args_.header + 1 : 0;
+  size_t header_rows = (extract_header && args_.header >= 0) ? args_.header + 1 : 0;
   uint64_t ctx       = 0;
 
   // For compatibility with the previous parser, a row is considered in-range if the
@@ -422,11 +675,22 @@ void reader::impl::gather_row_offsets(const char *h_data,
   data_.resize(0);
   row_offsets.resize(0);
   data_.reserve((load_whole_file) ? h_size : std::min(buffer_size * 2, h_size));
+  // When all the data is needed, upload the next chunks while the current one is processed
+  std::unique_ptr<chunked_device_upload> upload;
+  if (load_whole_file && h_size > max_chunk_bytes) {
+    data_.resize(h_size);
+    upload = std::make_unique<chunked_device_upload>(
+      h_data, h_size, data_.data().get(), max_chunk_bytes);
+  }
   do {
     size_t target_pos = std::min(pos + max_chunk_bytes, h_size);
     size_t chunk_size = target_pos - pos;
 
-    data_.insert(data_.end(), h_data + buffer_pos + data_.size(), h_data + target_pos);
+    if (upload != nullptr) {
+      upload->wait_for(target_pos, stream);
+    } else {
+      data_.insert(data_.end(), h_data + buffer_pos + data_.size(), h_data + target_pos);
+    }
 
     // Pass 1: Count the potential number of rows in each character block for each
     // possible parser state at the beginning of the block.
@@ -510,7 +774,7 @@ void reader::impl::gather_row_offsets(const char *h_data,
           }
         }
       }
-    } else {
+    } else if (upload == nullptr) {
       // Discard data (all rows below skip_rows), keeping one character for history
       size_t discard_bytes = std::max(data_.size(), sizeof(char)) - sizeof(char);
       if (discard_bytes != 0) {
@@ -520,6 +784,20 @@ void reader::impl::gather_row_offsets(const char *h_data,
     }
     pos = target_pos;
   } while (pos < h_size);
+  if (upload != nullptr) { upload->wait_for(h_size, stream); }
+
+  // The last offset is the start of the first row that was not gathered
+  size_t row_end = h_size;
+  if (row_offsets.size() != 0) {
+    uint64_t last_offset = 0;
+    CUDA_TRY(cudaMemcpyAsync(&last_offset,
+                             row_offsets.data().get() + row_offsets.size() - 1,
+                             sizeof(uint64_t),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    row_end = std::min<size_t>(buffer_pos + last_offset, h_size);
+  }
 
   // Eliminate blank rows
   if (row_offsets.size() != 0) {
@@ -527,7 +805,7 @@ void reader::impl::gather_row_offsets(const char *h_data,
   }
   // Remove header rows and extract header
   const size_t header_row_index = std::max<size_t>(header_rows, 1) - 1;
-  if (header_row_index + 1 < row_offsets.size()) {
+  if (extract_header && header_row_index + 1 < row_offsets.size()) {
     CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
                              row_offsets.data().get() + header_row_index,
                              2 * sizeof(uint64_t),
@@ -544,6 +822,41 @@ void reader::impl::gather_row_offsets(const char *h_data,
   }
   // Apply num_rows limit
   if (num_rows >= 0) { row_offsets.resize(std::min<size_t>(row_offsets.size(), num_rows + 1)); }
+
+  return row_end;
+}
+
+std::vector<data_type> reader::impl::infer_column_types(
+  hostdevice_vector<column_parse::stats> const &column_stats, size_t num_rows)
+{
+  std::vector<data_type> dtypes;
+  for (int col = 0; col < num_active_cols; col++) {
+    unsigned long long countInt = column_stats[col].countInt8 + column_stats[col].countInt16 +
+                                  column_stats[col].countInt32 + column_stats[col].countInt64;
+
+    if (column_stats[col].countNULL == num_rows) {
+      // Entire column is NULL; allocate the smallest amount of memory
+      dtypes.emplace_back(cudf::type_id::INT8);
+    } else if (column_stats[col].countString > 0L) {
+      dtypes.emplace_back(cudf::type_id::STRING);
+    } else if (column_stats[col].countDateAndTime > 0L) {
+      dtypes.emplace_back(cudf::type_id::TIMESTAMP_NANOSECONDS);
+    } else if (column_stats[col].countBool > 0L) {
+      dtypes.emplace_back(cudf::type_id::BOOL8);
+    } else if (column_stats[col].countFloat > 0L ||
+               (column_stats[col].countFloat == 0L && countInt > 0L &&
+                column_stats[col].countNULL > 0L)) {
+      // The second condition has been added to conform to
+      // PANDAS which states that a column of integers with
+      // a single NULL record need to be treated as floats.
+      dtypes.emplace_back(cudf::type_id::FLOAT64);
+    } else {
+      // All other integers are stored as 64-bit to conform to PANDAS
+      dtypes.emplace_back(cudf::type_id::INT64);
+    }
+  }
+
+  return dtypes;
 }
 
 std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
@@ -556,14 +869,26 @@ std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
     } else {
       d_column_flags = h_column_flags;
 
+      // A sample of the rows is enough to infer the types in most datasets; the types are checked
+      // against all rows while decoding, and widened if the sample missed some fields
+      sampled_column_types_ = args_.type_inference_rows > 0 &&
+                              num_records > static_cast<size_t>(args_.type_inference_rows);
+      size_t const num_rows = sampled_column_types_ ? args_.type_inference_rows : num_records;
+      rmm::device_vector<size_type> row_indices;
+      if (sampled_column_types_) {
+        row_indices = sample_row_indices(num_records, args_.type_inference_rows, stream);
+      }
+      auto const d_row_indices = sampled_column_types_ ? row_indices.data().get() : nullptr;
+
       hostdevice_vector<column_parse::stats> column_stats(num_active_cols);
       CUDA_TRY(cudaMemsetAsync(column_stats.device_ptr(), 0, column_stats.memory_size(), stream));
       CUDA_TRY(cudf::io::csv::gpu::DetectColumnTypes(data_.data().get(),
                                                      row_offsets.data().get(),
-                                                     num_records,
+                                                     num_rows,
                                                      num_actual_cols,
                                                      opts,
                                                      d_column_flags.data().get(),
+                                                     d_row_indices,
                                                      column_stats.device_ptr(),
                                                      stream));
       CUDA_TRY(cudaMemcpyAsync(column_stats.host_ptr(),
@@ -573,31 +898,7 @@ std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
                                stream));
       CUDA_TRY(cudaStreamSynchronize(stream));
 
-      for (int col = 0; col < num_active_cols; col++) {
-        unsigned long long countInt = column_stats[col].countInt8 + column_stats[col].countInt16 +
-                                      column_stats[col].countInt32 + column_stats[col].countInt64;
-
-        if (column_stats[col].countNULL == num_records) {
-          // Entire column is NULL; allocate the smallest amount of memory
-          dtypes.emplace_back(cudf::type_id::INT8);
-        } else if (column_stats[col].countString > 0L) {
-          dtypes.emplace_back(cudf::type_id::STRING);
-        } else if (column_stats[col].countDateAndTime > 0L) {
-          dtypes.emplace_back(cudf::type_id::TIMESTAMP_NANOSECONDS);
-        } else if (column_stats[col].countBool > 0L) {
-          dtypes.emplace_back(cudf::type_id::BOOL8);
-        } else if (column_stats[col].countFloat > 0L ||
-                   (column_stats[col].countFloat == 0L && countInt > 0L &&
-                    column_stats[col].countNULL > 0L)) {
-          // The second condition has been added to conform to
-          // PANDAS which states that a column of integers with
-          // a single NULL record need to be treated as floats.
-          dtypes.emplace_back(cudf::type_id::FLOAT64);
-        } else {
-          // All other integers are stored as 64-bit to conform to PANDAS
-          dtypes.emplace_back(cudf::type_id::INT64);
-        }
-      }
+      dtypes = infer_column_types(column_stats, num_rows);
     }
   } else {
     const bool is_dict = std::all_of(args_.dtype.begin(), args_.dtype.end(), [](const auto &s) {
@@ -664,8 +965,27 @@ std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
   return dtypes;
 }
 
+std::vector<column_buffer> reader::impl::allocate_column_buffers(
+  std::vector<data_type> &column_types, cudaStream_t stream)
+{
+  std::vector<column_buffer> out_buffers;
+  out_buffers.reserve(column_types.size());
+  for (auto &type : column_types) {
+    // Replace EMPTY dtype with STRING
+    if (type.id() == type_id::EMPTY) { type = data_type{type_id::STRING}; }
+    const bool is_final_allocation = type.id() != type_id::STRING;
+    out_buffers.emplace_back(type,
+                             num_records,
+                             true,
+                             stream,
+                             is_final_allocation ? mr_ : rmm::mr::get_default_resource());
+  }
+  return out_buffers;
+}
+
 void reader::impl::decode_data(const std::vector<data_type> &column_types,
                                std::vector<column_buffer> &out_buffers,
+                               column_parse::stats *column_stats,
                                cudaStream_t stream)
 {
   thrust::host_vector<void *> h_data(num_active_cols);
@@ -690,6 +1010,7 @@ void reader::impl::decode_data(const std::vector<data_type> &column_types,
                                                    d_dtypes.data().get(),
                                                    d_data.data().get(),
                                                    d_valid.data().get(),
+                                                   column_stats,
                                                    stream));
   CUDA_TRY(cudaStreamSynchronize(stream));
 
@@ -700,8 +1021,14 @@ reader::impl::impl(std::unique_ptr<datasource> source,
                    std::string filepath,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
-  : source_(std::move(source)), mr_(mr), filepath_(filepath), args_(options)
+  : mr_(mr),
+    filepath_(filepath),
+    args_(options),
+    data_(cudf::detail::scratch_allocator<char>()),
+    row_offsets(cudf::detail::scratch_allocator<uint64_t>())
 {
+  if (source != nullptr) { set_source(std::move(source)); }
+
   num_actual_cols = args_.names.size();
   num_active_cols = args_.names.size();
 
@@ -737,21 +1064,18 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   // Handle user-defined false values, whereby field data is substituted with a
   // boolean true or numeric `1` value
   if (args_.true_values.size() != 0) {
-    d_trueTrie          = createSerializedTrie(args_.true_values);
-    opts.trueValuesTrie = d_trueTrie.data().get();
+    opts.trueValuesTrie = make_trie_view(args_.true_values, d_trueTrie, d_trueTrieHash);
   }
 
   // Handle user-defined false values, whereby field data is substituted with a
   // boolean false or numeric `0` value
   if (args_.false_values.size() != 0) {
-    d_falseTrie          = createSerializedTrie(args_.false_values);
-    opts.falseValuesTrie = d_falseTrie.data().get();
+    opts.falseValuesTrie = make_trie_view(args_.false_values, d_falseTrie, d_falseTrieHash);
   }
 
   // Handle user-defined N/A values, whereby field data is treated as null
   if (args_.na_values.size() != 0) {
-    d_naTrie          = createSerializedTrie(args_.na_values);
-    opts.naValuesTrie = d_naTrie.data().get();
+    opts.naValuesTrie = make_trie_view(args_.na_values, d_naTrie, d_naTrieHash);
   }
 }
 
@@ -790,6 +1114,18 @@ table_with_metadata reader::read_byte_range(size_t offset, size_t size, cudaStre
   return _impl->read(offset, size, 0, 0, -1, stream);
 }
 
+// Forward to implementation
+void reader::begin_chunked_read(size_t chunk_size) { _impl->begin_chunked_read(chunk_size); }
+
+// Forward to implementation
+bool reader::has_next_chunk() const { return _impl->has_next_chunk(); }
+
+// Forward to implementation
+table_with_metadata reader::read_next_chunk(cudaStream_t stream)
+{
+  return _impl->read_next_chunk(stream);
+}
+
 // Forward to implementation
 table_with_metadata reader::read_rows(size_type num_skip_header,
                                       size_type num_skip_footer,
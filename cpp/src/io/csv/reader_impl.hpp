@@ -27,10 +27,12 @@
 #include <cudf/detail/utilities/trie.cuh>
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/io_metrics.hpp>
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/readers.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
@@ -100,6 +102,27 @@ class reader::impl {
                            int num_rows,
                            cudaStream_t stream);
 
+  /**
+   * @brief Starts reading the source as a series of tables of about `chunk_size` bytes each.
+   *
+   * @param chunk_size Number of bytes in which each chunk's rows start
+   */
+  void begin_chunked_read(size_t chunk_size);
+
+  /**
+   * @brief Returns whether there is data left to read in chunks.
+   */
+  bool has_next_chunk() const;
+
+  /**
+   * @brief Reads the rows that start within the next chunk of the source.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_next_chunk(cudaStream_t stream);
+
  private:
   /**
    * @brief Finds row positions within the specified input data.
@@ -115,16 +138,53 @@ class reader::impl {
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read; -1: all remaining data
    * @param load_whole_file Hint that the entire data will be needed on gpu
+   * @param extract_header Whether the data starts with the header rows
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Position in `h_data` of the first row that was not gathered, or `h_size`
+   */
+  size_t gather_row_offsets(const char *h_data,
+                            size_t h_size,
+                            size_t range_begin,
+                            size_t range_end,
+                            size_t skip_rows,
+                            int64_t num_rows,
+                            bool load_whole_file,
+                            bool extract_header,
+                            cudaStream_t stream);
+
+  /**
+   * @brief Converts the gathered rows to columns, using the header to name them.
+   *
+   * @param metrics Metrics of the read, completed and returned with the columns; may be null
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
    */
-  void gather_row_offsets(const char *h_data,
-                          size_t h_size,
-                          size_t range_begin,
-                          size_t range_end,
-                          size_t skip_rows,
-                          int64_t num_rows,
-                          bool load_whole_file,
-                          cudaStream_t stream);
+  table_with_metadata read_columns(std::unique_ptr<io_metrics> metrics, cudaStream_t stream);
+
+  /**
+   * @brief Sets the data source, counting its reads if the metrics are collected
+   *
+   * @param source Data source
+   */
+  void set_source(std::unique_ptr<datasource> source);
+
+  /**
+   * @brief Returns the source data of a chunk, prefetched in the background if it was requested.
+   *
+   * @param offset Byte offset of the chunk in the source
+   * @param size Number of bytes to read
+   */
+  std::unique_ptr<datasource::buffer> read_chunk_data(size_t offset, size_t size);
+
+  /**
+   * @brief Starts loading the source data of the next chunk into host memory in the background.
+   *
+   * @param offset Byte offset of the chunk in the source
+   * @param size Number of bytes to read
+   */
+  void prefetch_chunk_data(size_t offset, size_t size);
 
   /**
    * @brief Find the start position of the first data row
@@ -145,20 +205,41 @@ class reader::impl {
    */
   std::vector<data_type> gather_column_types(cudaStream_t stream);
 
+  /**
+   * @brief Returns the column types matching the type histograms of the active columns.
+   *
+   * @param column_stats Type histograms of the active columns
+   * @param num_rows Number of rows counted in the histograms
+   */
+  std::vector<data_type> infer_column_types(
+    hostdevice_vector<column_parse::stats> const &column_stats, size_t num_rows);
+
+  /**
+   * @brief Allocates the output buffers of the active columns.
+   *
+   * @param column_types Column types; EMPTY types are replaced with STRING
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  std::vector<column_buffer> allocate_column_buffers(std::vector<data_type> &column_types,
+                                                     cudaStream_t stream);
+
   /**
    * @brief Converts the row-column data and outputs to columns.
    *
    * @param column_types Column types
    * @param out_buffers Output columns' device buffers
+   * @param column_stats If not null, the type histograms of the columns, gathered while decoding
    * @param stream CUDA stream used for device memory operations and kernel launches.
    */
   void decode_data(std::vector<data_type> const &column_types,
                    std::vector<column_buffer> &out_buffers,
+                   column_parse::stats *column_stats,
                    cudaStream_t stream);
 
  private:
   rmm::mr::device_memory_resource *mr_ = nullptr;
   std::unique_ptr<datasource> source_;
+  metered_source *metered_source_ = nullptr;  // Wrapper of source_ when collecting the metrics
   std::string filepath_;
   std::string compression_type_;
   const reader_options args_;
@@ -176,10 +257,22 @@ class reader::impl {
   rmm::device_vector<SerialTrieNode> d_trueTrie;
   rmm::device_vector<SerialTrieNode> d_falseTrie;
   rmm::device_vector<SerialTrieNode> d_naTrie;
+  rmm::device_vector<SerialTrieHashSlot> d_trueTrieHash;
+  rmm::device_vector<SerialTrieHashSlot> d_falseTrieHash;
+  rmm::device_vector<SerialTrieHashSlot> d_naTrieHash;
+  bool sampled_column_types_ = false;  // Whether the types were inferred from a sample of rows
 
   // Intermediate data
   std::vector<std::string> col_names;
   std::vector<char> header;
+
+  // Chunked reading state
+  size_t chunk_size_   = 0;  // Number of bytes in which each chunk's rows start; 0 if not chunked
+  size_t chunk_offset_ = 0;  // Position in the source of the next chunk's first row
+  std::vector<data_type> chunk_column_types_;  // Inferred by the first chunk with rows
+  size_t prefetch_offset_ = 0;
+  size_t prefetch_size_   = 0;
+  std::future<std::unique_ptr<datasource::buffer>> prefetch_;
 };
 
 }  // namespace csv
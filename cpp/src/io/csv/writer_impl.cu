@@ -21,8 +21,11 @@
 
 #include "writer_impl.hpp"
 
+#include <io/comp/gpuinflate.h>
+
 #include <cudf/copying.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table_device_view.cuh>
 
 #include <cudf/utilities/traits.hpp>
 
@@ -31,8 +34,6 @@
 #include <cudf/strings/convert/convert_floats.hpp>
 #include <cudf/strings/convert/convert_integers.hpp>
 
-#include <cudf/strings/combine.hpp>
-#include <cudf/strings/replace.hpp>
 
 #include <strings/utilities.cuh>
 
@@ -43,7 +44,6 @@
 #include <type_traits>
 #include <utility>
 
-#include <thrust/count.h>
 #include <thrust/execution_policy.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
@@ -53,8 +53,9 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <zlib.h>
+
 #include <cudf/scalar/scalar.hpp>
-#include <cudf/strings/detail/modify_strings.cuh>
 
 namespace cudf {
 namespace io {
@@ -70,10 +71,7 @@ using namespace cudf::strings;
 //{"\"", "\n", <delimiter>}
 //
 struct predicate_special_chars {
-  explicit predicate_special_chars(string_scalar const& delimiter, cudaStream_t stream = 0)
-    : delimiter_(delimiter.value(stream))
-  {
-  }
+  explicit predicate_special_chars(string_view const& delimiter) : delimiter_(delimiter) {}
 
   __device__ bool operator()(string_view const& str_view) const
   {
@@ -95,109 +93,71 @@ struct predicate_special_chars {
   string_view delimiter_;
 };
 
-struct probe_special_chars {
-  probe_special_chars(column_device_view const d_column, predicate_special_chars const& predicate)
-    : d_column_(d_column), predicate_(predicate)
+// formats each row of a table of strings columns into one CSV line: the fields are separated by
+// the delimiter, nulls are replaced by `na_rep`, and the line ends with the line terminator;
+// the fields of the (input) string columns containing special characters are surrounded by
+// double quotes, with their double quotes doubled;
+//
+// called twice by `make_strings_children()`: once for the size of each line, then to write it
+//
+struct format_rows_fn {
+  table_device_view const d_columns;
+  bool const* d_quote_columns;  ///< true for the columns whose fields are quoted as needed
+  predicate_special_chars const predicate;
+  string_view const d_delimiter;
+  string_view const d_narep;
+  string_view const d_terminator;
+  int32_t* d_offsets{};  ///< size of the output line stored here during first pass
+  char* d_chars{};       ///< this is null only during the first pass
+
+  __device__ void append(char*& out_ptr, size_type& bytes, string_view const& d_str) const
   {
+    if (out_ptr) out_ptr = cudf::strings::detail::copy_string(out_ptr, d_str);
+    bytes += d_str.size_bytes();
   }
 
-  __device__ int32_t operator()(size_type idx) const
+  // the quote is a single byte which never appears inside a multi-byte UTF-8 character,
+  // so the field is processed byte-wise
+  __device__ void append_quoted(char*& out_ptr, size_type& bytes, string_view const& d_str) const
   {
-    if (d_column_.is_null(idx)) {
-      return 0;  // null string, so no-op
-    }
-
-    string_view d_str = d_column_.template element<string_view>(idx);
-
-    if (predicate_(d_str)) {
-      constexpr char const quote_char = '\"';
-
-      // count number of quotes "\""
-      size_type num_quotes =
-        thrust::count_if(thrust::seq, d_str.begin(), d_str.end(), [quote_char](char_utf8 chr) {
-          return chr == quote_char;
-        });
-      return d_str.size_bytes() + num_quotes + 2;
-    } else {
-      return d_str.size_bytes();
+    constexpr char const quote_char = '\"';
+
+    auto const d_data = d_str.data();
+    auto nbytes       = d_str.size_bytes() + 2;
+    if (out_ptr) *out_ptr++ = quote_char;
+    for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+      auto const chr = d_data[i];
+      if (chr == quote_char) {
+        if (out_ptr) *out_ptr++ = quote_char;  // double the quote
+        ++nbytes;
+      }
+      if (out_ptr) *out_ptr++ = chr;
     }
+    if (out_ptr) *out_ptr++ = quote_char;
+    bytes += nbytes;
   }
 
- private:
-  column_device_view const d_column_;
-  predicate_special_chars predicate_;
-};
-
-struct modify_special_chars {
-  modify_special_chars(column_device_view const d_column,
-                       int32_t const* d_offsets,
-                       char* d_chars,
-                       predicate_special_chars const& predicate)
-    : d_column_(d_column), d_offsets_(d_offsets), d_chars_(d_chars), predicate_(predicate)
-  {
-  }
-
-  __device__ int32_t operator()(size_type idx)
+  __device__ void operator()(size_type idx) const
   {
-    using namespace cudf::strings::detail;
-
-    if (d_column_.is_null(idx)) {
-      return 0;  // null string, so no-op
-    }
-
-    string_view d_str        = d_column_.template element<string_view>(idx);
-    size_type str_size_bytes = d_str.size_bytes();
-
-    char* d_buffer = get_output_ptr(idx);
-    // assert( d_buffer != nullptr );
-
-    if (predicate_(d_str)) {
-      constexpr char const quote_char   = '\"';
-      constexpr char const* quote_str   = "\"";
-      constexpr char const* str_2quotes = "\"\"";
-
-      size_type len1quote{1};
-      size_type len2quotes{2};
-
-      // modify d_str by duplicating all 2bl quotes
-      // and surrounding whole string by 2bl quotes:
-      //
-      // pre-condition: `d_str` is _not_ modified by `d_buffer` manipulation
-      // because it's a copy of `idx` entry in `d_column_`
-      //(since `d_column` is const)
-      //
-      d_buffer = copy_and_increment(d_buffer, quote_str, len1quote);  // add the quote prefix
-
-      for (auto itr = d_str.begin(); itr != d_str.end(); ++itr) {
-        char_utf8 the_chr = *itr;
-
-        if (the_chr == quote_char) {
-          d_buffer = copy_and_increment(d_buffer, str_2quotes, len2quotes);  // double the quote;
-        } else {
-          d_buffer += from_char_utf8(the_chr, d_buffer);
-        }
+    char* out_ptr   = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes = 0;
+    for (size_type col = 0; col < d_columns.num_columns(); ++col) {
+      if (col > 0) append(out_ptr, bytes, d_delimiter);
+      auto const d_column = d_columns.column(col);
+      if (d_column.is_null(idx)) {
+        append(out_ptr, bytes, d_narep);
+        continue;
+      }
+      auto const d_str = d_column.element<string_view>(idx);
+      if (d_quote_columns[col] && predicate(d_str)) {
+        append_quoted(out_ptr, bytes, d_str);
+      } else {
+        append(out_ptr, bytes, d_str);
       }
-
-      d_buffer = copy_and_increment(d_buffer, quote_str, len1quote);  // add the quote suffix;
-    } else {
-      // copy the source string unmodified:
-      //(pass-through)
-      //
-      memcpy(get_output_ptr(idx), d_str.data(), str_size_bytes);
     }
-    return 0;
-  }
-
-  __device__ char* get_output_ptr(size_type idx)
-  {
-    return d_chars_ && d_offsets_ ? d_chars_ + d_offsets_[idx] : nullptr;
+    append(out_ptr, bytes, d_terminator);
+    if (!d_chars) d_offsets[idx] = bytes;
   }
-
- private:
-  column_device_view const d_column_;
-  int32_t const* d_offsets_;
-  char* d_chars_;
-  predicate_special_chars predicate_;
 };
 
 struct column_to_strings_fn {
@@ -208,14 +168,16 @@ struct column_to_strings_fn {
   // instead of a static function, but nvcc (10.0)
   // fails to compile var-templs);
   //
+  // Note: strings columns are not converted; their fields are quoted as needed while the rows are
+  // formatted (see format_rows_fn);
+  //
   template <typename column_type>
   constexpr static bool is_not_handled(void)
   {
     // Note: the case (not std::is_same<column_type, bool>::value)
     // is already covered by is_integral)
     //
-    return not((std::is_same<column_type, cudf::string_view>::value) ||
-               (std::is_integral<column_type>::value) ||
+    return not((std::is_integral<column_type>::value) ||
                (std::is_floating_point<column_type>::value) || (cudf::is_timestamp<column_type>()));
   }
 
@@ -226,7 +188,7 @@ struct column_to_strings_fn {
   {
   }
 
-  // Note: `null` replacement with `na_rep` deferred to `concatenate()`
+  // Note: `null` replacement with `na_rep` deferred to `format_rows_fn`
   // instead of column-wise; might be faster
   //
   // Note: Cannot pass `stream` to detail::<fname> version of <fname> calls below, because they are
@@ -246,35 +208,6 @@ struct column_to_strings_fn {
     return conv_col_ptr;
   }
 
-  // strings:
-  //
-  template <typename column_type>
-  std::enable_if_t<std::is_same<column_type, cudf::string_view>::value, std::unique_ptr<column>>
-  operator()(column_view const& column_v) const
-  {
-    using namespace cudf::strings::detail;
-
-    // handle special characters: {delimiter, '\n', "} in row:
-    //
-    // algorithm outline:
-    //
-    // target = "\"";
-    // repl = ""\"\";
-    //
-    // str_column_ref = {};
-    // for each str_row: column_v {
-    //    if ((not null str_row) &&
-    //        (str_row.find("\n") || str_row.find("\"") || str_row.find(delimiter) ))
-    //        str_column_modified = modify(str_row);
-    // where modify() = duplicate the double quotes, if any; add 2bl quotes prefix/suffix;
-    //}
-    //
-    std::string delimiter{options_.inter_column_delimiter()};
-    predicate_special_chars pred{delimiter, stream_};
-
-    return modify_strings<probe_special_chars, modify_special_chars>(column_v, mr_, stream_, pred);
-  }
-
   // ints:
   //
   template <typename column_type>
@@ -359,6 +292,93 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
                    rmm::mr::device_memory_resource* mr)
   : out_sink_(std::move(sink)), mr_(mr), options_(options)
 {
+  CUDF_EXPECTS(options_.compression() == compression_type::NONE ||
+                 options_.compression() == compression_type::GZIP,
+               "Unsupported compression type for the CSV writer");
+}
+
+// write bytes through the sink; with GZIP compression, as stored (uncompressed) DEFLATE blocks:
+//
+void writer::impl::write_host_bytes(char const* data, size_t size)
+{
+  if (options_.compression() != compression_type::GZIP) {
+    out_sink_->host_write(data, size);
+    return;
+  }
+
+  constexpr size_t max_stored_block_size = 0xffff;
+  for (size_t pos = 0; pos < size; pos += max_stored_block_size) {
+    auto const len = static_cast<uint16_t>(std::min(size - pos, max_stored_block_size));
+    // BFINAL=0, BTYPE=00 (stored), then LEN and its one's complement NLEN
+    uint8_t const header[5] = {0,
+                               static_cast<uint8_t>(len),
+                               static_cast<uint8_t>(len >> 8),
+                               static_cast<uint8_t>(~len),
+                               static_cast<uint8_t>(~len >> 8)};
+    out_sink_->host_write(header, sizeof(header));
+    out_sink_->host_write(data + pos, len);
+  }
+  gzip_crc32_ = crc32(gzip_crc32_, reinterpret_cast<Bytef const*>(data), size);
+  gzip_isize_ += size;
+}
+
+// compress device bytes in independent blocks on the GPU; each compressed block ends on a byte
+// boundary, so the blocks are written back-to-back to form a single DEFLATE stream:
+//
+void writer::impl::write_deflate_blocks(char const* data, size_t size, cudaStream_t stream)
+{
+  constexpr size_t block_size           = 64 * 1024;
+  constexpr size_t max_compressed_block = block_size + block_size / 8 + 16;
+
+  auto const num_blocks = cudf::util::div_rounding_up_safe(size, block_size);
+  rmm::device_buffer compressed(num_blocks * max_compressed_block, stream);
+  hostdevice_vector<gpu_inflate_input_s> comp_in(num_blocks, stream);
+  hostdevice_vector<gpu_inflate_status_s> comp_out(num_blocks, stream);
+  for (size_t i = 0; i < num_blocks; ++i) {
+    comp_in[i].srcDevice = data + i * block_size;
+    comp_in[i].srcSize   = std::min(block_size, size - i * block_size);
+    comp_in[i].dstDevice = static_cast<uint8_t*>(compressed.data()) + i * max_compressed_block;
+    comp_in[i].dstSize   = max_compressed_block;
+  }
+  CUDA_TRY(cudaMemcpyAsync(comp_in.device_ptr(),
+                           comp_in.host_ptr(),
+                           comp_in.memory_size(),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  CUDA_TRY(gpu_deflate(comp_in.device_ptr(), comp_out.device_ptr(), num_blocks, stream));
+  CUDA_TRY(cudaMemcpyAsync(comp_out.host_ptr(),
+                           comp_out.device_ptr(),
+                           comp_out.memory_size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  size_t total_compressed = 0;
+  for (size_t i = 0; i < num_blocks; ++i) {
+    CUDF_EXPECTS(comp_out[i].status == 0, "Error during CSV output compression");
+    total_compressed += comp_out[i].bytes_written;
+    gzip_crc32_ = crc32_combine(gzip_crc32_, comp_out[i].reserved, comp_in[i].srcSize);
+  }
+  gzip_isize_ += size;
+
+  if (out_sink_->supports_device_write()) {
+    for (size_t i = 0; i < num_blocks; ++i) {
+      out_sink_->device_write(comp_in[i].dstDevice, comp_out[i].bytes_written, stream);
+    }
+  } else {
+    thrust::host_vector<uint8_t> h_compressed(total_compressed);
+    size_t offset = 0;
+    for (size_t i = 0; i < num_blocks; ++i) {
+      CUDA_TRY(cudaMemcpyAsync(h_compressed.data() + offset,
+                               comp_in[i].dstDevice,
+                               comp_out[i].bytes_written,
+                               cudaMemcpyDeviceToHost,
+                               stream));
+      offset += comp_out[i].bytes_written;
+    }
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    out_sink_->host_write(h_compressed.data(), total_compressed);
+  }
 }
 
 // write the header: column names:
@@ -367,6 +387,14 @@ void writer::impl::write_chunked_begin(table_view const& table,
                                        const table_metadata* metadata,
                                        cudaStream_t stream)
 {
+  if (options_.compression() == compression_type::GZIP) {
+    // gzip member header: magic, CM=8 (deflate), no flags, no mtime, XFL=0, OS=255 (unknown)
+    uint8_t const gzip_header[10] = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff};
+    out_sink_->host_write(gzip_header, sizeof(gzip_header));
+    gzip_crc32_ = 0;
+    gzip_isize_ = 0;
+  }
+
   if ((metadata != nullptr) && (options_.include_header())) {
     CUDF_EXPECTS(metadata->column_names.size() == static_cast<size_t>(table.num_columns()),
                  "Mismatch between number of column headers and table columns.");
@@ -381,67 +409,51 @@ void writer::impl::write_chunked_begin(table_view const& table,
               std::ostream_iterator<std::string>(ss, delimiter_str.c_str()));
     ss << metadata->column_names.back() << options_.line_terminator();
 
-    out_sink_->host_write(ss.str().data(), ss.str().size());
+    write_host_bytes(ss.str().data(), ss.str().size());
   }
 }
 
-void writer::impl::write_chunked(strings_column_view const& str_column_view,
-                                 const table_metadata* metadata,
-                                 cudaStream_t stream)
+// write bytes from device memory through the sink; with GZIP compression, as DEFLATE blocks
+// compressed on the GPU:
+//
+void writer::impl::write_device_bytes(char const* data, size_t size, cudaStream_t stream)
 {
-  // algorithm outline:
-  //
-  //  for_each(strings_column.begin(), strings_column.end(),
-  //           [sink = out_sink_](auto str_row) mutable {
-  //               auto host_buffer = str_row.host_buffer();
-  //               sink->host_write(host_buffer_.data(), host_buffer_.size());
-  //           });//or...sink->device_write(device_buffer,...);
-  //
-  // added line_terminator functionality
-  //
-
-  CUDF_EXPECTS(str_column_view.size() > 0, "Unexpected empty strings column.");
-
-  cudf::string_scalar newline{options_.line_terminator()};
-  auto p_str_col_w_nl = cudf::strings::join_strings(str_column_view, newline);
-  strings_column_view strings_column{std::move(p_str_col_w_nl->view())};
-
-  auto total_num_bytes      = strings_column.chars_size();
-  char const* ptr_all_bytes = strings_column.chars().data<char>();
-
-  if (out_sink_->supports_device_write()) {
+  if (options_.compression() == compression_type::GZIP) {
+    write_deflate_blocks(data, size, stream);
+  } else if (out_sink_->supports_device_write()) {
     // host algorithm call, but the underlying call
     // is a device_write taking a device buffer;
     //
-    out_sink_->device_write(ptr_all_bytes, total_num_bytes, stream);
-    out_sink_->device_write(newline.data(),
-                            newline.size(),
-                            stream);  // needs newline at the end, to separate from next chunk
+    out_sink_->device_write(data, size, stream);
   } else {
     // no device write possible;
     //
     // copy the bytes to host, too:
     //
-    thrust::host_vector<char> h_bytes(total_num_bytes);
-    CUDA_TRY(cudaMemcpyAsync(h_bytes.data(),
-                             ptr_all_bytes,
-                             total_num_bytes * sizeof(char),
-                             cudaMemcpyDeviceToHost,
-                             stream));
+    thrust::host_vector<char> h_bytes(size);
+    CUDA_TRY(
+      cudaMemcpyAsync(h_bytes.data(), data, size * sizeof(char), cudaMemcpyDeviceToHost, stream));
 
     CUDA_TRY(cudaStreamSynchronize(stream));
 
     // host algorithm call, where the underlying call
     // is also host_write taking a host buffer;
     //
-    char const* ptr_h_bytes = h_bytes.data();
-    out_sink_->host_write(ptr_h_bytes, total_num_bytes);
-    out_sink_->host_write(
-      options_.line_terminator().data(),
-      options_.line_terminator().size());  // needs newline at the end, to separate from next chunk
+    out_sink_->host_write(h_bytes.data(), size);
   }
 }
 
+void writer::impl::write_chunked(column_view const& rows_chars,
+                                 const table_metadata* metadata,
+                                 cudaStream_t stream)
+{
+  // each row already ends with the line terminator, which separates it from the next chunk
+  //
+  CUDF_EXPECTS(rows_chars.size() > 0, "Unexpected empty chunk.");
+
+  write_device_bytes(rows_chars.data<char>(), rows_chars.size(), stream);
+}
+
 void writer::impl::write(table_view const& table,
                          const table_metadata* metadata,
                          cudaStream_t stream)
@@ -495,44 +507,84 @@ void writer::impl::write(table_view const& table,
       vector_views = cudf::split(table, splits);
     }
 
+    // formatting parameters, shared by all the chunks:
+    //
+    string_scalar const delimiter{std::string{options_.inter_column_delimiter()}, true, stream};
+    string_scalar const narep{options_.na_rep(), true, stream};
+    string_scalar const terminator{options_.line_terminator(), true, stream};
+    auto const d_delimiter = delimiter.value(stream);
+
     // convert each chunk to CSV:
     //
     column_to_strings_fn converter{options_, mr_};
     for (auto&& sub_view : vector_views) {
       // Skip if the table has no rows
       if (sub_view.num_rows() == 0) continue;
-      std::vector<std::unique_ptr<column>> str_column_vec;
 
-      // populate vector of string-converted columns:
-      //
-      std::transform(sub_view.begin(),
-                     sub_view.end(),
-                     std::back_inserter(str_column_vec),
-                     [converter](auto const& current_col) {
-                       return cudf::type_dispatcher(current_col.type(), converter, current_col);
-                     });
-
-      // create string table view from str_column_vec:
+      // string columns are formatted in place; the other columns are converted to strings:
       //
-      auto str_table_ptr  = std::make_unique<cudf::table>(std::move(str_column_vec));
-      auto str_table_view = str_table_ptr->view();
+      std::vector<std::unique_ptr<column>> converted_columns;
+      std::vector<column_view> str_columns;
+      thrust::host_vector<bool> quote_columns;
+      for (auto const& current_col : sub_view) {
+        if (current_col.type().id() == type_id::STRING) {
+          str_columns.push_back(current_col);
+          quote_columns.push_back(true);
+        } else {
+          converted_columns.push_back(
+            cudf::type_dispatcher(current_col.type(), converter, current_col));
+          str_columns.push_back(converted_columns.back()->view());
+          quote_columns.push_back(false);
+        }
+      }
+      rmm::device_vector<bool> d_quote_columns(quote_columns);
+      auto d_str_table = table_device_view::create(table_view{str_columns}, stream);
 
-      // concatenate columns in each row into one big string column
-      //(using null representation and delimiter):
+      // format all the rows of the chunk directly into one buffer
+      //(using null representation, delimiter and line terminator):
       //
-      std::string delimiter_str{options_.inter_column_delimiter()};
-      auto str_concat_col =
-        cudf::strings::concatenate(str_table_view, delimiter_str, options_.na_rep(), mr_);
-
-      write_chunked(str_concat_col->view(), metadata, stream);
+      format_rows_fn format_fn{*d_str_table,
+                               d_quote_columns.data().get(),
+                               predicate_special_chars{d_delimiter},
+                               d_delimiter,
+                               narep.value(stream),
+                               terminator.value(stream)};
+      auto rows = cudf::strings::detail::make_strings_children(
+        format_fn, sub_view.num_rows(), 0, mr_, stream);
+
+      write_chunked(rows.second->view(), metadata, stream);
     }
   }
 
-  // finalize (no-op, for now, but offers a hook for future extensions):
+  // finalize (terminates the compressed stream, if any):
   //
   write_chunked_end(table, metadata, stream);
 }
 
+// write the footer: with GZIP compression, the final DEFLATE block and the gzip trailer:
+//
+void writer::impl::write_chunked_end(table_view const& table,
+                                     const table_metadata* metadata,
+                                     cudaStream_t stream)
+{
+  if (options_.compression() == compression_type::GZIP) {
+    // BFINAL=1, BTYPE=01 (fixed Huffman codes) holding only the end-of-block code,
+    // followed by the CRC32 and size (modulo 2^32) of the uncompressed data
+    auto const isize              = static_cast<uint32_t>(gzip_isize_);
+    uint8_t const gzip_footer[10] = {0x03,
+                                     0x00,
+                                     static_cast<uint8_t>(gzip_crc32_),
+                                     static_cast<uint8_t>(gzip_crc32_ >> 8),
+                                     static_cast<uint8_t>(gzip_crc32_ >> 16),
+                                     static_cast<uint8_t>(gzip_crc32_ >> 24),
+                                     static_cast<uint8_t>(isize),
+                                     static_cast<uint8_t>(isize >> 8),
+                                     static_cast<uint8_t>(isize >> 16),
+                                     static_cast<uint8_t>(isize >> 24)};
+    out_sink_->host_write(gzip_footer, sizeof(gzip_footer));
+  }
+}
+
 void writer::write_all(table_view const& table, const table_metadata* metadata, cudaStream_t stream)
 {
   _impl->write(table, metadata, stream);
@@ -86,11 +86,12 @@ class writer::impl {
   /**
    * @brief Write dataset to CSV format without header.
    *
-   * @param strings_column Subset of columns converted to string to be written.
+   * @param rows_chars Characters of the formatted rows of a chunk, each ending with the line
+   * terminator.
    * @param metadata The metadata associated with the table
    * @param stream CUDA stream used for device memory operations and kernel launches.
    **/
-  void write_chunked(strings_column_view const& strings_column,
+  void write_chunked(column_view const& rows_chars,
                      const table_metadata* metadata = nullptr,
                      cudaStream_t stream            = nullptr);
 
@@ -103,15 +104,41 @@ class writer::impl {
    **/
   void write_chunked_end(table_view const& table,
                          const table_metadata* metadata = nullptr,
-                         cudaStream_t stream            = nullptr)
-  {
-    // purposely no-op (for now);
-  }
+                         cudaStream_t stream            = nullptr);
 
  private:
+  /**
+   * @brief Write bytes from host memory to the sink, compressing them if requested.
+   *
+   * @param data The bytes to write
+   * @param size Number of bytes
+   **/
+  void write_host_bytes(char const* data, size_t size);
+
+  /**
+   * @brief Write bytes from device memory to the sink, compressing them if requested.
+   *
+   * @param data The bytes to write
+   * @param size Number of bytes
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void write_device_bytes(char const* data, size_t size, cudaStream_t stream);
+
+  /**
+   * @brief Compress bytes in device memory into DEFLATE blocks and write them to the sink.
+   *
+   * @param data The bytes to compress
+   * @param size Number of bytes
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void write_deflate_blocks(char const* data, size_t size, cudaStream_t stream);
+
   std::unique_ptr<data_sink> out_sink_;
   rmm::mr::device_memory_resource* mr_ = nullptr;
   writer_options const options_;
+
+  uint32_t gzip_crc32_ = 0;  // CRC32 of the uncompressed output written so far
+  size_t gzip_isize_   = 0;  // Size of the uncompressed output written so far
 };
 
 }  // namespace csv
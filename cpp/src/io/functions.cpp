@@ -14,19 +14,39 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/groupby.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/io/readers.hpp>
 #include <cudf/io/writers.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
 
+#include "csv/chunked_state.hpp"
+#include "packed/packed.hpp"
 #include "orc/chunked_state.hpp"
 #include "parquet/chunked_state.hpp"
 
+#include <algorithm>
+
 namespace cudf {
 namespace io {
 namespace {
+std::vector<std::unique_ptr<datasource>> make_datasources(source_info const& src_info)
+{
+  switch (src_info.type) {
+    case io_type::FILEPATH: return cudf::io::datasource::create(src_info.filepaths);
+    case io_type::HOST_BUFFER: return cudf::io::datasource::create(src_info.buffers);
+    case io_type::ARROW_RANDOM_ACCESS_FILE: return cudf::io::datasource::create(src_info.files);
+    case io_type::USER_IMPLEMENTED: return cudf::io::datasource::create(src_info.user_sources);
+    default: CUDF_FAIL("Unsupported source type");
+  }
+}
+
 template <typename reader, typename reader_options>
 std::unique_ptr<reader> make_reader(source_info const& src_info,
                                     reader_options const& options,
@@ -35,19 +55,7 @@ std::unique_ptr<reader> make_reader(source_info const& src_info,
   if (src_info.type == io_type::FILEPATH) {
     return std::make_unique<reader>(src_info.filepaths, options, mr);
   }
-
-  std::vector<std::unique_ptr<datasource>> datasources;
-  if (src_info.type == io_type::HOST_BUFFER) {
-    datasources = cudf::io::datasource::create(src_info.buffers);
-  } else if (src_info.type == io_type::ARROW_RANDOM_ACCESS_FILE) {
-    datasources = cudf::io::datasource::create(src_info.files);
-  } else if (src_info.type == io_type::USER_IMPLEMENTED) {
-    datasources = cudf::io::datasource::create(src_info.user_sources);
-  } else {
-    CUDF_FAIL("Unsupported source type");
-  }
-
-  return std::make_unique<reader>(std::move(datasources), options, mr);
+  return std::make_unique<reader>(make_datasources(src_info), options, mr);
 }
 
 template <typename writer, typename writer_options>
@@ -94,7 +102,9 @@ table_with_metadata read_json(read_json_args const& args, rmm::mr::device_memory
   namespace json = cudf::io::detail::json;
 
   CUDF_FUNC_RANGE();
-  json::reader_options options{args.lines, args.compression, args.dtype, args.dayfirst};
+  json::reader_options options{
+    args.lines, args.compression, args.dtype, args.dayfirst, args.nested};
+  options.type_inference_rows = args.type_inference_rows;
   auto reader = make_reader<json::reader>(args.source, options, mr);
 
   if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
@@ -104,30 +114,28 @@ table_with_metadata read_json(read_json_args const& args, rmm::mr::device_memory
   }
 }
 
-// Freeform API wraps the detail reader class API
-table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_resource* mr)
+namespace {
+detail::csv::reader_options make_csv_reader_options(read_csv_args const& args)
 {
-  namespace csv = cudf::io::detail::csv;
-
-  CUDF_FUNC_RANGE();
-  csv::reader_options options{};
-  options.compression        = args.compression;
-  options.lineterminator     = args.lineterminator;
-  options.delimiter          = args.delimiter;
-  options.decimal            = args.decimal;
-  options.thousands          = args.thousands;
-  options.comment            = args.comment;
-  options.dayfirst           = args.dayfirst;
-  options.delim_whitespace   = args.delim_whitespace;
-  options.skipinitialspace   = args.skipinitialspace;
-  options.skip_blank_lines   = args.skip_blank_lines;
-  options.header             = args.header;
-  options.infer_date_names   = args.infer_date_names;
-  options.infer_date_indexes = args.infer_date_indexes;
-  options.names              = args.names;
-  options.dtype              = args.dtype;
-  options.use_cols_indexes   = args.use_cols_indexes;
-  options.use_cols_names     = args.use_cols_names;
+  detail::csv::reader_options options{};
+  options.compression         = args.compression;
+  options.lineterminator      = args.lineterminator;
+  options.delimiter           = args.delimiter;
+  options.decimal             = args.decimal;
+  options.thousands           = args.thousands;
+  options.comment             = args.comment;
+  options.dayfirst            = args.dayfirst;
+  options.delim_whitespace    = args.delim_whitespace;
+  options.skipinitialspace    = args.skipinitialspace;
+  options.skip_blank_lines    = args.skip_blank_lines;
+  options.header              = args.header;
+  options.infer_date_names    = args.infer_date_names;
+  options.infer_date_indexes  = args.infer_date_indexes;
+  options.names               = args.names;
+  options.dtype               = args.dtype;
+  options.type_inference_rows = args.type_inference_rows;
+  options.use_cols_indexes    = args.use_cols_indexes;
+  options.use_cols_names      = args.use_cols_names;
   options.true_values.insert(
     options.true_values.end(), args.true_values.begin(), args.true_values.end());
   options.false_values.insert(
@@ -145,7 +153,18 @@ table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_r
   options.quoting          = args.quoting;
   options.doublequote      = args.doublequote;
   options.timestamp_type   = args.timestamp_type;
-  auto reader              = make_reader<csv::reader>(args.source, options, mr);
+  options.collect_metrics  = args.collect_metrics;
+  return options;
+}
+}  // namespace
+
+// Freeform API wraps the detail reader class API
+table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  namespace csv = cudf::io::detail::csv;
+
+  CUDF_FUNC_RANGE();
+  auto reader = make_reader<csv::reader>(args.source, make_csv_reader_options(args), mr);
 
   if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
     return reader->read_byte_range(args.byte_range_offset, args.byte_range_size);
@@ -156,6 +175,55 @@ table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_r
   }
 }
 
+/**
+ * @copydoc cudf::io::read_csv_chunked_begin
+ *
+ **/
+std::shared_ptr<detail::csv::csv_chunked_read_state> read_csv_chunked_begin(
+  read_csv_args const& args, size_t chunk_size, rmm::mr::device_memory_resource* mr)
+{
+  namespace csv = cudf::io::detail::csv;
+
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(args.byte_range_offset == 0 && args.byte_range_size == 0,
+               "Byte range is not supported when reading in chunks");
+  CUDF_EXPECTS(args.skiprows == -1 && args.skipfooter == -1 && args.nrows == -1,
+               "Row selection is not supported when reading in chunks");
+
+  auto state = std::make_shared<csv::csv_chunked_read_state>();
+  state->rp  = make_reader<csv::reader>(args.source, make_csv_reader_options(args), mr);
+  state->rp->begin_chunked_read(chunk_size);
+  return state;
+}
+
+/**
+ * @copydoc cudf::io::read_csv_chunked_has_next
+ *
+ **/
+bool read_csv_chunked_has_next(std::shared_ptr<detail::csv::csv_chunked_read_state> state)
+{
+  return state->rp->has_next_chunk();
+}
+
+/**
+ * @copydoc cudf::io::read_csv_chunked
+ *
+ **/
+table_with_metadata read_csv_chunked(std::shared_ptr<detail::csv::csv_chunked_read_state> state)
+{
+  CUDF_FUNC_RANGE();
+  return state->rp->read_next_chunk(state->stream);
+}
+
+/**
+ * @copydoc cudf::io::read_csv_chunked_end
+ *
+ **/
+void read_csv_chunked_end(std::shared_ptr<detail::csv::csv_chunked_read_state>& state)
+{
+  state.reset();
+}
+
 // Freeform API wraps the detail writer class API
 void write_csv(write_csv_args const& args, rmm::mr::device_memory_resource* mr)
 {
@@ -166,6 +234,17 @@ void write_csv(write_csv_args const& args, rmm::mr::device_memory_resource* mr)
   writer->write_all(args.table(), args.metadata());
 }
 
+// Freeform API wraps the detail writer class API
+void write_json(write_json_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  using namespace cudf::io::detail;
+
+  auto writer = make_writer<json::writer>(args.sink(), args, mr);
+
+  writer->write_all(args.table(), args.metadata());
+}
+
 namespace detail_orc = cudf::io::detail::orc;
 
 // Freeform API wraps the detail reader class API
@@ -177,8 +256,12 @@ table_with_metadata read_orc(read_orc_args const& args, rmm::mr::device_memory_r
                                      args.use_np_dtypes,
                                      args.timestamp_type,
                                      args.decimals_as_float,
-                                     args.forced_decimals_scale};
-  auto reader = make_reader<detail_orc::reader>(args.source, options, mr);
+                                     args.forced_decimals_scale,
+                                     args.filter};
+  options.collect_metrics    = args.collect_metrics;
+  options.use_metadata_cache = args.use_metadata_cache;
+  options.row_mask           = args.row_mask;
+  auto reader                = make_reader<detail_orc::reader>(args.source, options, mr);
 
   if (args.stripe_list.size() > 0) {
     return reader->read_stripes(args.stripe_list);
@@ -191,11 +274,74 @@ table_with_metadata read_orc(read_orc_args const& args, rmm::mr::device_memory_r
   }
 }
 
+std::vector<file_metadata> read_orc_statistics(source_info const& src_info)
+{
+  CUDF_FUNC_RANGE();
+  std::vector<file_metadata> result;
+  for (auto const& source : make_datasources(src_info)) {
+    result.push_back(detail_orc::read_statistics(source.get()));
+  }
+  return result;
+}
+
+/**
+ * @copydoc cudf::io::read_orc_chunked_begin
+ *
+ **/
+std::shared_ptr<detail_orc::orc_chunked_read_state> read_orc_chunked_begin(
+  read_orc_chunked_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail_orc::reader_options options{args.columns,
+                                     args.use_index,
+                                     args.use_np_dtypes,
+                                     args.timestamp_type,
+                                     args.decimals_as_float,
+                                     args.forced_decimals_scale,
+                                     args.filter};
+
+  auto state = std::make_shared<detail_orc::orc_chunked_read_state>();
+  state->rp  = make_reader<detail_orc::reader>(args.source, options, mr);
+  state->rp->begin_chunked_read(args.chunk_read_limit, args.stripe_list);
+  return state;
+}
+
+/**
+ * @copydoc cudf::io::read_orc_chunked_has_next
+ *
+ **/
+bool read_orc_chunked_has_next(std::shared_ptr<detail_orc::orc_chunked_read_state> state)
+{
+  return state->rp->has_next_chunk();
+}
+
+/**
+ * @copydoc cudf::io::read_orc_chunked
+ *
+ **/
+table_with_metadata read_orc_chunked(std::shared_ptr<detail_orc::orc_chunked_read_state> state)
+{
+  CUDF_FUNC_RANGE();
+  return state->rp->read_next_chunk(state->stream);
+}
+
+/**
+ * @copydoc cudf::io::read_orc_chunked_end
+ *
+ **/
+void read_orc_chunked_end(std::shared_ptr<detail_orc::orc_chunked_read_state>& state)
+{
+  state.reset();
+}
+
 // Freeform API wraps the detail writer class API
 void write_orc(write_orc_args const& args, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   detail_orc::writer_options options{args.compression, args.enable_statistics};
+  options.bloom_filter_columns = args.bloom_filter_columns;
+  options.bloom_filter_fpp     = args.bloom_filter_fpp;
+  options.metrics              = args.metrics;
   auto writer = make_writer<detail_orc::writer>(args.sink, options, mr);
 
   writer->write_all(args.table, args.metadata);
@@ -210,6 +356,9 @@ std::shared_ptr<detail_orc::orc_chunked_state> write_orc_chunked_begin(
 {
   CUDF_FUNC_RANGE();
   detail_orc::writer_options options{args.compression, args.enable_statistics};
+  options.bloom_filter_columns = args.bloom_filter_columns;
+  options.bloom_filter_fpp     = args.bloom_filter_fpp;
+  options.metrics              = args.metrics;
 
   auto state = std::make_shared<detail_orc::orc_chunked_state>();
   state->wp  = make_writer<detail_orc::writer>(args.sink, options, mr);
@@ -254,9 +403,17 @@ namespace detail_parquet = cudf::io::detail::parquet;
 table_with_metadata read_parquet(read_parquet_args const& args, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  detail_parquet::reader_options options{
-    args.columns, args.strings_to_categorical, args.use_pandas_metadata, args.timestamp_type};
-  auto reader = make_reader<detail_parquet::reader>(args.source, options, mr);
+  detail_parquet::reader_options options{args.columns,
+                                         args.strings_to_categorical,
+                                         args.use_pandas_metadata,
+                                         args.timestamp_type,
+                                         args.filter,
+                                         args.strings_to_dictionary};
+  options.collect_metrics    = args.collect_metrics;
+  options.use_metadata_cache = args.use_metadata_cache;
+  options.row_mask           = args.row_mask;
+  options.decimals_as_float  = args.decimals_as_float;
+  auto reader                = make_reader<detail_parquet::reader>(args.source, options, mr);
 
   if (args.row_groups.size() > 0) {
     return reader->read_row_groups(args.row_groups);
@@ -267,18 +424,204 @@ table_with_metadata read_parquet(read_parquet_args const& args, rmm::mr::device_
   }
 }
 
+memory_estimate estimate_read_parquet_memory(read_parquet_args const& args)
+{
+  CUDF_FUNC_RANGE();
+  detail_parquet::reader_options options{args.columns,
+                                         args.strings_to_categorical,
+                                         args.use_pandas_metadata,
+                                         args.timestamp_type,
+                                         args.filter,
+                                         args.strings_to_dictionary};
+  options.use_metadata_cache = args.use_metadata_cache;
+  options.decimals_as_float  = args.decimals_as_float;
+  auto reader =
+    make_reader<detail_parquet::reader>(args.source, options, rmm::mr::get_default_resource());
+
+  if (args.row_groups.size() > 0) { return reader->estimate_memory(args.row_groups); }
+  return reader->estimate_memory({}, std::max(args.skip_rows, 0), std::max(args.num_rows, 0));
+}
+
+std::vector<file_metadata> read_parquet_metadata(source_info const& src_info)
+{
+  CUDF_FUNC_RANGE();
+  std::vector<file_metadata> result;
+  for (auto const& source : make_datasources(src_info)) {
+    result.push_back(detail_parquet::read_metadata(source.get()));
+  }
+  return result;
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_chunked_begin
+ *
+ **/
+std::shared_ptr<pq_chunked_read_state> read_parquet_chunked_begin(
+  read_parquet_chunked_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail_parquet::reader_options options{args.columns,
+                                         args.strings_to_categorical,
+                                         args.use_pandas_metadata,
+                                         args.timestamp_type,
+                                         args.filter,
+                                         args.strings_to_dictionary};
+  options.decimals_as_float = args.decimals_as_float;
+
+  auto state = std::make_shared<pq_chunked_read_state>();
+  state->rp  = make_reader<detail_parquet::reader>(args.source, options, mr);
+  state->rp->begin_chunked_read(args.chunk_read_limit, args.row_groups);
+  return state;
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_chunked_has_next
+ *
+ **/
+bool read_parquet_chunked_has_next(std::shared_ptr<pq_chunked_read_state> state)
+{
+  return state->rp->has_next_chunk();
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_chunked
+ *
+ **/
+table_with_metadata read_parquet_chunked(std::shared_ptr<pq_chunked_read_state> state)
+{
+  CUDF_FUNC_RANGE();
+  return state->rp->read_next_chunk(state->stream);
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_chunked_end
+ *
+ **/
+void read_parquet_chunked_end(std::shared_ptr<pq_chunked_read_state>& state) { state.reset(); }
+
 // Freeform API wraps the detail writer class API
 std::unique_ptr<std::vector<uint8_t>> write_parquet(write_parquet_args const& args,
                                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  detail_parquet::writer_options options{args.compression, args.stats_level};
+  detail_parquet::writer_options options{
+    args.compression, args.stats_level, args.delta_encoding};
+  options.max_page_size        = args.max_page_size;
+  options.max_dictionary_size  = args.max_dictionary_size;
+  options.column_encodings     = args.column_encodings;
+  options.bloom_filter_columns = args.bloom_filter_columns;
+  options.bloom_filter_fpp     = args.bloom_filter_fpp;
+  options.clustering           = args.clustering;
+  options.clustering_columns   = args.clustering_columns;
+  options.metrics              = args.metrics;
+
   auto writer = make_writer<detail_parquet::writer>(args.sink, options, mr);
 
   return writer->write_all(
     args.table, args.metadata, args.return_filemetadata, args.metadata_out_file_path);
 }
 
+/**
+ * @copydoc cudf::io::write_parquet_partitioned
+ *
+ **/
+std::unique_ptr<table> write_parquet_partitioned(write_parquet_partitioned_args const& args,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(!args.partition_columns.empty(), "No partition columns specified");
+  CUDF_EXPECTS(static_cast<bool>(args.sink_factory), "No sink factory specified");
+  auto const num_columns = args.table.num_columns();
+  std::vector<bool> is_key(num_columns, false);
+  for (auto col : args.partition_columns) {
+    CUDF_EXPECTS(col >= 0 && col < num_columns, "Invalid partition column index");
+    is_key[col] = true;
+  }
+  std::vector<size_type> value_columns;
+  table_metadata metadata;
+  for (size_type i = 0; i < num_columns; ++i) {
+    if (is_key[i]) { continue; }
+    value_columns.push_back(i);
+    if (args.metadata != nullptr && static_cast<size_t>(i) < args.metadata->column_names.size()) {
+      metadata.column_names.push_back(args.metadata->column_names[i]);
+    }
+  }
+  CUDF_EXPECTS(!value_columns.empty(), "No columns left to write after the partition columns");
+  if (args.metadata != nullptr) { metadata.user_data = args.metadata->user_data; }
+
+  // The per-column options apply to the value columns only
+  detail_parquet::writer_options options{
+    args.compression, args.stats_level, args.delta_encoding};
+  options.max_page_size       = args.max_page_size;
+  options.max_dictionary_size = args.max_dictionary_size;
+  CUDF_EXPECTS(args.column_encodings.empty() || args.column_encodings.size() == (size_t)num_columns,
+               "Number of column encodings does not match the number of columns");
+  CUDF_EXPECTS(
+    args.bloom_filter_columns.empty() || args.bloom_filter_columns.size() == (size_t)num_columns,
+    "Number of bloom filter flags does not match the number of columns");
+  for (auto col : value_columns) {
+    if (!args.column_encodings.empty()) {
+      options.column_encodings.push_back(args.column_encodings[col]);
+    }
+    if (!args.bloom_filter_columns.empty()) {
+      options.bloom_filter_columns.push_back(args.bloom_filter_columns[col]);
+    }
+  }
+  options.bloom_filter_fpp = args.bloom_filter_fpp;
+  options.clustering       = args.clustering;
+  for (auto col : args.clustering_columns) {
+    CUDF_EXPECTS(col >= 0 && col < num_columns, "Invalid clustering column index");
+    if (is_key[col]) { continue; }
+    options.clustering_columns.push_back(
+      std::lower_bound(value_columns.begin(), value_columns.end(), col) - value_columns.begin());
+  }
+  if (options.clustering_columns.empty()) { options.clustering = row_clustering::NONE; }
+  options.metrics = args.metrics;
+
+  // A single sort brings the rows of each partition together
+  cudaStream_t const stream = 0;
+  auto const keys           = args.table.select(args.partition_columns);
+  groupby::groupby grouper(keys, null_policy::INCLUDE);
+  auto groups =
+    grouper.get_groups(args.table.select(value_columns), get_scratch_resource(), stream);
+  auto const num_partitions =
+    (args.table.num_rows() > 0) ? static_cast<size_type>(groups.offsets.size()) - 1 : 0;
+
+  // The keys of a partition are those of its first row
+  auto first_rows = make_numeric_column(data_type{type_to_id<size_type>()},
+                                        num_partitions,
+                                        mask_state::UNALLOCATED,
+                                        stream,
+                                        get_scratch_resource());
+  CUDA_TRY(cudaMemcpyAsync(first_rows->mutable_view().data<size_type>(),
+                           groups.offsets.data(),
+                           num_partitions * sizeof(size_type),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  auto partition_keys = cudf::detail::gather(groups.keys->view(),
+                                             first_rows->view(),
+                                             cudf::detail::out_of_bounds_policy::NULLIFY,
+                                             cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                             mr,
+                                             stream);
+  if (num_partitions == 0) { return partition_keys; }
+
+  std::vector<size_type> slice_indices;
+  for (size_type i = 0; i < num_partitions; ++i) {
+    slice_indices.push_back(groups.offsets[i]);
+    slice_indices.push_back(groups.offsets[i + 1]);
+  }
+  auto const partitions = cudf::slice(groups.values->view(), slice_indices);
+
+  for (size_type i = 0; i < num_partitions; ++i) {
+    auto const sink = args.sink_factory(i, partition_keys->view());
+    auto writer     = make_writer<detail_parquet::writer>(sink, options, mr);
+    writer->write_all(
+      partitions[i], (args.metadata != nullptr) ? &metadata : nullptr, false, "", stream);
+  }
+  return partition_keys;
+}
+
 /**
  * @copydoc cudf::io::merge_rowgroup_metadata
  *
@@ -298,7 +641,16 @@ std::shared_ptr<pq_chunked_state> write_parquet_chunked_begin(
   write_parquet_chunked_args const& args, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  detail_parquet::writer_options options{args.compression, args.stats_level};
+  detail_parquet::writer_options options{
+    args.compression, args.stats_level, args.delta_encoding};
+  options.max_page_size        = args.max_page_size;
+  options.max_dictionary_size  = args.max_dictionary_size;
+  options.column_encodings     = args.column_encodings;
+  options.bloom_filter_columns = args.bloom_filter_columns;
+  options.bloom_filter_fpp     = args.bloom_filter_fpp;
+  options.clustering           = args.clustering;
+  options.clustering_columns   = args.clustering_columns;
+  options.metrics              = args.metrics;
 
   auto state = std::make_shared<pq_chunked_state>();
   state->wp  = make_writer<detail_parquet::writer>(args.sink, options, mr);
@@ -339,5 +691,32 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet_chunked_end(
   return meta;
 }
 
+void write_packed(write_packed_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  std::unique_ptr<data_sink> sink;
+  switch (args.sink.type) {
+    case io_type::FILEPATH: sink = data_sink::create(args.sink.filepath); break;
+    case io_type::HOST_BUFFER: sink = data_sink::create(args.sink.buffer); break;
+    case io_type::VOID: sink = data_sink::create(); break;
+    case io_type::USER_IMPLEMENTED: sink = data_sink::create(args.sink.user_sink); break;
+    default: CUDF_FAIL("Unsupported sink type");
+  }
+
+  if (args.packed != nullptr) {
+    detail::packed::write(sink.get(), *args.packed, 0);
+  } else {
+    detail::packed::write(sink.get(), pack(args.table, mr), 0);
+  }
+}
+
+packed_columns read_packed(read_packed_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto sources = make_datasources(args.source);
+  CUDF_EXPECTS(sources.size() == 1, "Packed tables are read from a single source");
+  return detail::packed::read(sources[0].get(), mr, 0);
+}
+
 }  // namespace io
 }  // namespace cudf
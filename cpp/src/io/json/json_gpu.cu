@@ -26,11 +26,23 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <cudf/lists/list_view.cuh>
+#include <cudf/structs/struct_view.hpp>
 #include <cudf/strings/string_view.cuh>
 
 #include <io/csv/datetime.cuh>
 #include <io/utilities/parsing_utils.cuh>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
 namespace cudf {
 namespace io {
 namespace json {
@@ -269,6 +281,14 @@ __inline__ __device__ cudf::list_view decode_value(const char *data,
 {
   return cudf::list_view{};
 }
+template <>
+__inline__ __device__ cudf::struct_view decode_value(const char *data,
+                                                     long start,
+                                                     long end,
+                                                     ParseOptions const &opts)
+{
+  return cudf::struct_view{};
+}
 
 /**
  * @brief Functor for converting plain text data to cuDF data type value.
@@ -418,6 +438,185 @@ __device__ __inline__ bool is_like_float(
   return true;
 }
 
+/**
+ * @brief Counts the data type that a field can be parsed as, in the field's column information.
+ *
+ * @param[in] data Input data buffer
+ * @param[in] opts A set of parsing options
+ * @param[in] field_start Position of the first character of the field
+ * @param[in] field_data_last Position of the last character of the field
+ * @param[in,out] info The count for each data type of the field's column
+ *
+ * @returns void
+ **/
+__device__ void update_column_info(const char *data,
+                                   const ParseOptions &opts,
+                                   long field_start,
+                                   long field_data_last,
+                                   ColumnInfo &info)
+{
+  const int field_len = field_data_last - field_start + 1;
+
+  // Checking if the field is empty
+  if (field_start > field_data_last ||
+      serializedTrieContains(opts.naValuesTrie, data + field_start, field_len)) {
+    atomicAdd(&info.null_count, 1);
+    return;
+  }
+  // Don't need counts to detect strings, any field in quotes is deduced to be a string
+  if (data[field_start] == opts.quotechar && data[field_data_last] == opts.quotechar) {
+    atomicAdd(&info.string_count, 1);
+    return;
+  }
+
+  int digit_count    = 0;
+  int decimal_count  = 0;
+  int slash_count    = 0;
+  int dash_count     = 0;
+  int colon_count    = 0;
+  int exponent_count = 0;
+  int other_count    = 0;
+
+  const bool maybe_hex =
+    ((field_len > 2 && data[field_start] == '0' && data[field_start + 1] == 'x') ||
+     (field_len > 3 && data[field_start] == '-' && data[field_start + 1] == '0' &&
+      data[field_start + 2] == 'x'));
+  for (long pos = field_start; pos <= field_data_last; pos++) {
+    if (is_digit(data[pos], maybe_hex)) {
+      digit_count++;
+      return;
+    }
+    // Looking for unique characters that will help identify column types
+    switch (data[pos]) {
+      case '.': decimal_count++; break;
+      case '-': dash_count++; break;
+      case '/': slash_count++; break;
+      case ':': colon_count++; break;
+      case 'e':
+      case 'E':
+        if (!maybe_hex && pos > field_start && pos < field_data_last) exponent_count++;
+        break;
+      default: other_count++; break;
+    }
+  }
+
+  // Integers have to have the length of the string
+  int int_req_number_cnt = field_len;
+  // Off by one if they start with a minus sign
+  if (data[field_start] == '-' && field_len > 1) { --int_req_number_cnt; }
+  // Off by one if they are a hexadecimal number
+  if (maybe_hex) { --int_req_number_cnt; }
+  if (serializedTrieContains(opts.trueValuesTrie, data + field_start, field_len) ||
+      serializedTrieContains(opts.falseValuesTrie, data + field_start, field_len)) {
+    atomicAdd(&info.bool_count, 1);
+  } else if (digit_count == int_req_number_cnt) {
+    atomicAdd(&info.int_count, 1);
+  } else if (is_like_float(field_len, digit_count, decimal_count, dash_count, exponent_count)) {
+    atomicAdd(&info.float_count, 1);
+  }
+  // A date-time field cannot have more than 3 non-special characters
+  // A number field cannot have more than one decimal point
+  else if (other_count > 3 || decimal_count > 1) {
+    atomicAdd(&info.string_count, 1);
+  } else {
+    // A date field can have either one or two '-' or '\'; A legal combination will only have one
+    // of them To simplify the process of auto column detection, we are not covering all the
+    // date-time formation permutations
+    if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
+        (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
+      if (colon_count <= 2) {
+        atomicAdd(&info.datetime_count, 1);
+      } else {
+        atomicAdd(&info.string_count, 1);
+      }
+    } else {
+      // Default field type is string
+      atomicAdd(&info.string_count, 1);
+    }
+  }
+}
+
+/**
+ * @brief Adds the types of the fields of one record to the column type counts.
+ *
+ * @param[in] data Input data buffer
+ * @param[in] data_size Size of the data buffer, in bytes
+ * @param[in] opts A set of parsing options
+ * @param[in] num_columns The number of columns of input data
+ * @param[in] rec_starts The start the input data of interest
+ * @param[in] num_records The number of lines/rows of input data
+ * @param[in] rec_id Index of the record
+ * @param[out] column_infos The count for each column data type
+ *
+ * @returns void
+ **/
+__device__ void detect_record_types(const char *data,
+                                    size_t data_size,
+                                    const ParseOptions &opts,
+                                    int num_columns,
+                                    const uint64_t *rec_starts,
+                                    cudf::size_type num_records,
+                                    long rec_id,
+                                    ColumnInfo *column_infos)
+{
+  long start = rec_starts[rec_id];
+  // has the same semantics as end() in STL containers (one past last element)
+  long stop = ((rec_id < num_records - 1) ? rec_starts[rec_id + 1] : data_size);
+
+  limit_range_to_brackets(data, start, stop);
+  const bool is_object = (data[start - 1] == '{');
+
+  for (int col = 0; col < num_columns; col++) {
+    if (is_object) { start = seek_field_name_end(data, opts, start, stop); }
+    auto field_start     = start;
+    const long field_end = cudf::io::gpu::seek_field_end(data, opts, field_start, stop);
+    long field_data_last = field_end - 1;
+    trim_field_start_end(data, &field_start, &field_data_last);
+    // Advance the start offset
+    start = field_end + 1;
+
+    update_column_info(data, opts, field_start, field_data_last, column_infos[col]);
+  }
+}
+
+/**
+ * @brief CUDA kernel that processes a buffer of data and determines information about the
+ * column types within.
+ *
+ * Data is processed in one row/record at a time, so the number of total
+ * threads (tid) is equal to the number of rows.
+ *
+ * @param[in] data Input data buffer
+ * @param[in] data_size Size of the data buffer, in bytes
+ * @param[in] opts A set of parsing options
+ * @param[in] num_columns The number of columns of input data
+ * @param[in] rec_starts The start the input data of interest
+ * @param[in] num_records The number of lines/rows of input data
+ * @param[in] row_indices Indices of the `num_rows` records to process, or nullptr to process all
+ * records
+ * @param[in] num_rows The number of records to process
+ * @param[out] column_infos The count for each column data type
+ *
+ * @returns void
+ **/
+__global__ void detect_json_data_types(const char *data,
+                                       size_t data_size,
+                                       const ParseOptions opts,
+                                       int num_columns,
+                                       const uint64_t *rec_starts,
+                                       cudf::size_type num_records,
+                                       const cudf::size_type *row_indices,
+                                       cudf::size_type num_rows,
+                                       ColumnInfo *column_infos)
+{
+  long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (rec_id >= num_rows) return;
+  if (row_indices != nullptr) { rec_id = row_indices[rec_id]; }
+
+  detect_record_types(
+    data, data_size, opts, num_columns, rec_starts, num_records, rec_id, column_infos);
+}
+
 /**
  * @brief CUDA kernel that parses and converts plain text data into cuDF column data.
  *
@@ -433,6 +632,8 @@ __device__ __inline__ bool is_like_float(
  * @param[in] num_columns The number of columns
  * @param[out] valid_fields The bitmaps indicating whether column fields are valid
  * @param[out] num_valid_fields The numbers of valid fields in columns
+ * @param[out] column_infos If not null, the count for each column data type, gathered while
+ * converting
  *
  * @return void
  **/
@@ -445,11 +646,17 @@ __global__ void convert_json_to_columns_kernel(const char *data,
                                                void *const *output_columns,
                                                int num_columns,
                                                bitmask_type *const *valid_fields,
-                                               cudf::size_type *num_valid_fields)
+                                               cudf::size_type *num_valid_fields,
+                                               ColumnInfo *column_infos)
 {
   const long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
   if (rec_id >= num_records) return;
 
+  if (column_infos != nullptr) {
+    detect_record_types(
+      data, data_size, opts, num_columns, rec_starts, num_records, rec_id, column_infos);
+  }
+
   long start = rec_starts[rec_id];
   // has the same semantics as end() in STL containers (one past last element)
   long stop = ((rec_id < num_records - 1) ? rec_starts[rec_id + 1] : data_size);
@@ -500,129 +707,419 @@ __global__ void convert_json_to_columns_kernel(const char *data,
 }
 
 /**
- * @brief CUDA kernel that processes a buffer of data and determines information about the
- * column types within.
- *
- * Data is processed in one row/record at a time, so the number of total
- * threads (tid) is equal to the number of rows.
- *
- * @param[in] data Input data buffer
- * @param[in] data_size Size of the data buffer, in bytes
- * @param[in] opts A set of parsing options
- * @param[in] num_columns The number of columns of input data
- * @param[in] rec_starts The start the input data of interest
- * @param[in] num_records The number of lines/rows of input data
- * @param[out] column_infos The count for each column data type
- *
- * @returns void
+ * @brief Nesting level keys are ordered by nesting level, then by position in the input.
  **/
-__global__ void detect_json_data_types(const char *data,
-                                       size_t data_size,
-                                       const ParseOptions opts,
-                                       int num_columns,
-                                       const uint64_t *rec_starts,
-                                       cudf::size_type num_records,
-                                       ColumnInfo *column_infos)
+constexpr int level_key_shift     = 40;
+constexpr uint64_t max_key_position = (uint64_t{1} << level_key_shift) - 1;
+
+__host__ __device__ inline uint64_t level_key(cudf::size_type level, uint64_t pos)
 {
-  long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
-  if (rec_id >= num_records) return;
+  return (static_cast<uint64_t>(level) << level_key_shift) | pos;
+}
 
-  long start = rec_starts[rec_id];
-  // has the same semantics as end() in STL containers (one past last element)
-  long stop = ((rec_id < num_records - 1) ? rec_starts[rec_id + 1] : data_size);
+/**
+ * @brief Path hashes of the records and of the elements of arrays.
+ **/
+constexpr uint64_t record_path_hash       = 0xcbf29ce484222325;
+constexpr uint64_t array_element_path_hash = 0x9ae16a3b2f90404f;
 
-  limit_range_to_brackets(data, start, stop);
-  const bool is_object = (data[start - 1] == '{');
+__device__ inline uint64_t hash_text(const char *data, text_range range)
+{
+  uint64_t hash = 0xcbf29ce484222325;  // FNV-1a
+  for (auto pos = range.begin; pos < range.end; ++pos) {
+    hash = (hash ^ static_cast<uint8_t>(data[pos])) * 0x100000001b3;
+  }
+  return hash;
+}
 
-  for (int col = 0; col < num_columns; col++) {
-    if (is_object) { start = seek_field_name_end(data, opts, start, stop); }
-    auto field_start     = start;
-    const long field_end = cudf::io::gpu::seek_field_end(data, opts, field_start, stop);
-    long field_data_last = field_end - 1;
-    trim_field_start_end(data, &field_start, &field_data_last);
-    const int field_len = field_data_last - field_start + 1;
-    // Advance the start offset
-    start = field_end + 1;
+__device__ inline uint64_t combine_path_hash(uint64_t path, uint64_t member)
+{
+  return path ^ (member + 0x9e3779b97f4a7c15 + (path << 6) + (path >> 2));
+}
+
+__device__ inline bool is_json_whitespace(char ch)
+{
+  return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
+}
+
+/**
+ * @brief Returns the range without the surrounding whitespace and, if `quotechar` is not null,
+ * without the surrounding quotes.
+ **/
+__device__ text_range trim_range(const char *data, uint64_t begin, uint64_t end, char quotechar)
+{
+  while (begin < end && is_json_whitespace(data[begin])) { ++begin; }
+  while (begin < end && is_json_whitespace(data[end - 1])) { --end; }
+  if (quotechar != '\0' && end - begin >= 2 && data[begin] == quotechar &&
+      data[end - 1] == quotechar) {
+    ++begin;
+    --end;
+  }
+  return text_range{begin, end};
+}
+
+__device__ inline bool is_open_bracket(char ch) { return ch == '{' || ch == '['; }
+
+__device__ inline bool is_close_bracket(char ch) { return ch == '}' || ch == ']'; }
 
-    // Checking if the field is empty
-    if (field_start > field_data_last ||
-        serializedTrieContains(opts.naValuesTrie, data + field_start, field_len)) {
-      atomicAdd(&column_infos[col].null_count, 1);
-      continue;
+/**
+ * @brief Returns 1 for the quote characters that are not escaped by a backslash.
+ **/
+struct quote_toggle_fn {
+  const char *data;
+  char quotechar;
+
+  __device__ uint8_t operator()(uint64_t pos) const
+  {
+    if (data[pos] != quotechar) { return 0; }
+    uint64_t num_backslashes = 0;
+    while (num_backslashes < pos && data[pos - num_backslashes - 1] == '\\') { ++num_backslashes; }
+    return num_backslashes % 2 == 0;
+  }
+};
+
+/**
+ * @brief Returns whether a character is a bracket, colon or comma outside of strings.
+ **/
+struct is_token_fn {
+  const char *data;
+  uint8_t const *in_string;
+
+  __device__ bool operator()(uint64_t pos) const
+  {
+    if (in_string[pos]) { return false; }
+    switch (data[pos]) {
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',': return true;
+      default: return false;
     }
-    // Don't need counts to detect strings, any field in quotes is deduced to be a string
-    if (data[field_start] == opts.quotechar && data[field_data_last] == opts.quotechar) {
-      atomicAdd(&column_infos[col].string_count, 1);
-      continue;
+  }
+};
+
+/**
+ * @brief Returns the change of nesting depth after a token.
+ **/
+struct bracket_delta_fn {
+  const char *data;
+
+  __device__ cudf::size_type operator()(uint64_t pos) const
+  {
+    return is_open_bracket(data[pos]) ? 1 : (is_close_bracket(data[pos]) ? -1 : 0);
+  }
+};
+
+/**
+ * @brief Returns the nesting level of the container that a token opens, closes or separates,
+ * from the nesting depth before the token.
+ **/
+struct token_level_fn {
+  const char *data;
+
+  __device__ cudf::size_type operator()(cudf::size_type depth, uint64_t pos) const
+  {
+    return is_open_bracket(data[pos]) ? depth : depth - 1;
+  }
+};
+
+struct is_negative_level_fn {
+  __device__ bool operator()(cudf::size_type level) const { return level < 0; }
+};
+
+/**
+ * @brief Returns the level key of the first container of a level.
+ **/
+struct level_begin_key_fn {
+  __device__ uint64_t operator()(cudf::size_type level) const { return level_key(level, 0); }
+};
+
+/**
+ * @brief Returns true for the tokens that open a container.
+ **/
+struct is_open_token_fn {
+  const char *data;
+
+  __device__ bool operator()(uint64_t pos) const { return is_open_bracket(data[pos]); }
+};
+
+/**
+ * @brief Returns true for the tokens that close a container.
+ **/
+struct is_close_token_fn {
+  const char *data;
+
+  __device__ bool operator()(uint64_t pos) const { return is_close_bracket(data[pos]); }
+};
+
+/**
+ * @brief Returns the level key of a token.
+ **/
+struct token_key_fn {
+  uint64_t const *token_pos;
+  cudf::size_type const *levels;
+
+  __device__ uint64_t operator()(cudf::size_type token) const
+  {
+    return level_key(levels[token], token_pos[token]);
+  }
+};
+
+/**
+ * @brief Returns the container that a token is directly within, or -1 outside of the records.
+ *
+ * The container is the last one that opens before the token at the token's level; the opening
+ * brackets are sorted by level key, so it is found with a binary search.
+ **/
+struct enclosing_container_fn {
+  const char *data;
+  uint64_t const *token_pos;
+  cudf::size_type const *levels;
+  uint64_t const *open_keys;
+  cudf::size_type const *sorted_containers;
+  cudf::size_type num_containers;
+
+  __device__ cudf::size_type operator()(cudf::size_type token) const
+  {
+    const auto pos   = token_pos[token];
+    const auto level = is_open_bracket(data[pos]) ? levels[token] - 1 : levels[token];
+    if (level < 0) { return -1; }
+    const auto key = level_key(level, pos);
+    const auto it  = thrust::upper_bound(thrust::seq, open_keys, open_keys + num_containers, key);
+    if (it == open_keys) { return -1; }
+    const auto idx = (it - open_keys) - 1;
+    if (static_cast<cudf::size_type>(open_keys[idx] >> level_key_shift) != level) { return -1; }
+    return sorted_containers[idx];
+  }
+};
+
+/**
+ * @brief Returns the field name before the colon token `token`.
+ **/
+__device__ inline text_range member_key(const char *data,
+                                        uint64_t const *token_pos,
+                                        cudf::size_type token,
+                                        char quotechar)
+{
+  return trim_range(data, token_pos[token - 1] + 1, token_pos[token], quotechar);
+}
+
+/**
+ * @brief Sets the parent, end position, field name and type of each container.
+ **/
+struct container_info_fn {
+  const char *data;
+  uint64_t const *token_pos;
+  cudf::size_type const *levels;
+  cudf::size_type const *token_containers;
+  cudf::size_type const *container_tokens;
+  uint64_t const *close_keys;
+  cudf::size_type num_containers;
+  char quotechar;
+  cudf::size_type *parents;
+  uint64_t *ends;
+  text_range *keys;
+  bool *is_array;
+
+  __device__ void operator()(cudf::size_type container) const
+  {
+    const auto token = container_tokens[container];
+    const auto pos   = token_pos[token];
+    parents[container]  = token_containers[token];
+    is_array[container] = data[pos] == '[';
+    // The matching bracket is the first closing bracket after this one at the same level
+    const auto it = thrust::lower_bound(
+      thrust::seq, close_keys, close_keys + num_containers, level_key(levels[token], pos));
+    ends[container] = *it & max_key_position;
+    keys[container] = (token > 0 && data[token_pos[token - 1]] == ':')
+                        ? member_key(data, token_pos, token - 1, quotechar)
+                        : text_range{0, 0};
+  }
+};
+
+/**
+ * @brief Sets the path hash and record of the containers of one level, from those of their
+ * parents; also finds the containers whose content is one value, those directly within arrays.
+ **/
+struct container_path_fn {
+  const char *data;
+  cudf::size_type const *sorted_containers;
+  cudf::size_type const *parents;
+  text_range const *keys;
+  bool const *is_array;
+  uint64_t *paths;
+  cudf::size_type *rows;
+  bool *in_arrays;
+  bool *opaque;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    const auto container = sorted_containers[idx];
+    const auto parent    = parents[container];
+    if (parent < 0) {
+      // The records come first in level key order, by position
+      paths[container]     = record_path_hash;
+      rows[container]      = idx;
+      in_arrays[container] = false;
+      opaque[container]    = false;
+    } else {
+      const auto member =
+        is_array[parent] ? array_element_path_hash : hash_text(data, keys[container]);
+      paths[container]     = combine_path_hash(paths[parent], member);
+      rows[container]      = rows[parent];
+      in_arrays[container] = in_arrays[parent] || is_array[parent];
+      opaque[container]    = opaque[parent] || (is_array[parent] && is_array[container]);
     }
+  }
+};
 
-    int digit_count    = 0;
-    int decimal_count  = 0;
-    int slash_count    = 0;
-    int dash_count     = 0;
-    int colon_count    = 0;
-    int exponent_count = 0;
-    int other_count    = 0;
-
-    const bool maybe_hex =
-      ((field_len > 2 && data[field_start] == '0' && data[field_start + 1] == 'x') ||
-       (field_len > 3 && data[field_start] == '-' && data[field_start + 1] == '0' &&
-        data[field_start + 2] == 'x'));
-    for (long pos = field_start; pos <= field_data_last; pos++) {
-      if (is_digit(data[pos], maybe_hex)) {
-        digit_count++;
-        continue;
-      }
-      // Looking for unique characters that will help identify column types
-      switch (data[pos]) {
-        case '.': decimal_count++; break;
-        case '-': dash_count++; break;
-        case '/': slash_count++; break;
-        case ':': colon_count++; break;
-        case 'e':
-        case 'E':
-          if (!maybe_hex && pos > field_start && pos < field_data_last) exponent_count++;
-          break;
-        default: other_count++; break;
-      }
+/**
+ * @brief Finds the scalar value that follows a token.
+ *
+ * Values follow the colons of objects, and the opening brackets and commas of arrays. An array
+ * directly within an array is a single value.
+ **/
+struct value_slot_fn {
+  const char *data;
+  uint64_t const *token_pos;
+  cudf::size_type num_tokens;
+  cudf::size_type const *token_containers;
+  cudf::size_type const *open_ranks;
+  uint64_t const *ends;
+  bool const *is_array;
+  bool const *opaque;
+
+  /**
+   * @brief Returns the container of the value that follows the token, or -1 if there is none
+   **/
+  __device__ cudf::size_type container(cudf::size_type token) const
+  {
+    const auto ch = data[token_pos[token]];
+    if (ch == ':') { return token_containers[token]; }
+    if (ch == '[') { return open_ranks[token]; }
+    if (ch == ',' && token_containers[token] >= 0 && is_array[token_containers[token]]) {
+      return token_containers[token];
     }
+    return -1;
+  }
 
-    // Integers have to have the length of the string
-    int int_req_number_cnt = field_len;
-    // Off by one if they start with a minus sign
-    if (data[field_start] == '-' && field_len > 1) { --int_req_number_cnt; }
-    // Off by one if they are a hexadecimal number
-    if (maybe_hex) { --int_req_number_cnt; }
-    if (serializedTrieContains(opts.trueValuesTrie, data + field_start, field_len) ||
-        serializedTrieContains(opts.falseValuesTrie, data + field_start, field_len)) {
-      atomicAdd(&column_infos[col].bool_count, 1);
-    } else if (digit_count == int_req_number_cnt) {
-      atomicAdd(&column_infos[col].int_count, 1);
-    } else if (is_like_float(field_len, digit_count, decimal_count, dash_count, exponent_count)) {
-      atomicAdd(&column_infos[col].float_count, 1);
+  __device__ text_range operator()(cudf::size_type token) const
+  {
+    const auto parent = container(token);
+    if (parent < 0 || opaque[parent] || token + 1 >= num_tokens) { return text_range{0, 0}; }
+    const auto next = token_pos[token + 1];
+    if (is_open_bracket(data[next])) {
+      const auto child = open_ranks[token + 1];
+      return (is_array[parent] && is_array[child]) ? text_range{next, ends[child] + 1}
+                                                   : text_range{0, 0};
     }
-    // A date-time field cannot have more than 3 non-special characters
-    // A number field cannot have more than one decimal point
-    else if (other_count > 3 || decimal_count > 1) {
-      atomicAdd(&column_infos[col].string_count, 1);
-    } else {
-      // A date field can have either one or two '-' or '\'; A legal combination will only have one
-      // of them To simplify the process of auto column detection, we are not covering all the
-      // date-time formation permutations
-      if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
-          (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
-        if (colon_count <= 2) {
-          atomicAdd(&column_infos[col].datetime_count, 1);
+    return trim_range(data, token_pos[token] + 1, next, '\0');
+  }
+};
+
+struct is_nonempty_range_fn {
+  __device__ bool operator()(text_range range) const { return range.begin < range.end; }
+};
+
+/**
+ * @brief Sets the field name, container, record, path and array flag of each value.
+ **/
+struct value_info_fn {
+  value_slot_fn slots;
+  cudf::size_type const *value_tokens;
+  uint64_t const *container_paths;
+  cudf::size_type const *container_rows;
+  bool const *container_in_arrays;
+  char quotechar;
+  text_range *keys;
+  cudf::size_type *parents;
+  cudf::size_type *rows;
+  uint64_t *paths;
+  bool *in_arrays;
+
+  __device__ void operator()(cudf::size_type value) const
+  {
+    const auto token  = value_tokens[value];
+    const auto parent = slots.container(token);
+    const bool in_object = slots.data[slots.token_pos[token]] == ':';
+    const auto key =
+      in_object ? member_key(slots.data, slots.token_pos, token, quotechar) : text_range{0, 0};
+    keys[value]      = key;
+    parents[value]   = parent;
+    rows[value]      = container_rows[parent];
+    in_arrays[value] = container_in_arrays[parent] || slots.is_array[parent];
+    paths[value]     = combine_path_hash(
+      container_paths[parent], in_object ? hash_text(slots.data, key) : array_element_path_hash);
+  }
+};
+
+/**
+ * @brief Counts the data type of each value in its column information.
+ **/
+struct detect_value_type_fn {
+  const char *data;
+  text_range const *values;
+  cudf::size_type const *value_columns;
+  ParseOptions opts;
+  ColumnInfo *column_infos;
+
+  __device__ void operator()(cudf::size_type value) const
+  {
+    long field_start     = values[value].begin;
+    long field_data_last = values[value].end - 1;
+    trim_field_start_end(data, &field_start, &field_data_last);
+    auto &info = column_infos[value_columns[value]];
+    update_column_info(data, opts, field_start, field_data_last, info);
+  }
+};
+
+/**
+ * @brief Converts the value of each element of a column.
+ **/
+struct convert_value_fn {
+  const char *data;
+  text_range const *values;
+  cudf::size_type const *value_ids;
+  data_type dtype;
+  void *output;
+  bitmask_type *valid;
+  cudf::size_type *num_valid;
+  ParseOptions opts;
+
+  __device__ void operator()(cudf::size_type element) const
+  {
+    const auto value = value_ids[element];
+    if (value >= 0) {
+      long start = values[value].begin;
+      long last  = values[value].end - 1;
+      trim_field_start_end(data, &start, &last, opts.quotechar);
+      const auto len = last - start + 1;
+      if (start <= last && !serializedTrieContains(opts.naValuesTrie, data + start, len)) {
+        bool is_valid = true;
+        if (dtype.id() == type_id::STRING) {
+          auto str_list             = static_cast<string_pair *>(output);
+          str_list[element].first  = data + start;
+          str_list[element].second = last - start + 1;
         } else {
-          atomicAdd(&column_infos[col].string_count, 1);
+          is_valid = cudf::type_dispatcher(
+            dtype, ConvertFunctor{}, data, output, element, start, last, opts);
         }
-      } else {
-        // Default field type is string
-        atomicAdd(&column_infos[col].string_count, 1);
+        if (is_valid) {
+          set_bit(valid, element);
+          atomicAdd(num_valid, 1);
+        }
+        return;
       }
     }
+    if (dtype.id() == type_id::STRING) {
+      auto str_list             = static_cast<string_pair *>(output);
+      str_list[element].first  = nullptr;
+      str_list[element].second = 0;
+    }
   }
-}
+};
 
 }  // namespace
 
@@ -639,6 +1136,7 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
                              bitmask_type *const *valid_fields,
                              cudf::size_type *num_valid_fields,
                              ParseOptions const &opts,
+                             ColumnInfo *column_infos,
                              cudaStream_t stream)
 {
   int block_size;
@@ -658,7 +1156,8 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
     output_columns,
     num_columns,
     valid_fields,
-    num_valid_fields);
+    num_valid_fields,
+    column_infos);
 
   CUDA_TRY(cudaGetLastError());
 }
@@ -674,6 +1173,8 @@ void detect_data_types(ColumnInfo *column_infos,
                        int num_columns,
                        const uint64_t *rec_starts,
                        cudf::size_type num_records,
+                       const cudf::size_type *row_indices,
+                       cudf::size_type num_rows,
                        cudaStream_t stream)
 {
   int block_size;
@@ -681,14 +1182,299 @@ void detect_data_types(ColumnInfo *column_infos,
   CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(&min_grid_size, &block_size, detect_json_data_types));
 
   // Calculate actual block count to use based on records count
-  const int grid_size = (num_records + block_size - 1) / block_size;
+  const int grid_size = (num_rows + block_size - 1) / block_size;
 
-  detect_json_data_types<<<grid_size, block_size, 0, stream>>>(
-    data, data_size, options, num_columns, rec_starts, num_records, column_infos);
+  detect_json_data_types<<<grid_size, block_size, 0, stream>>>(data,
+                                                               data_size,
+                                                               options,
+                                                               num_columns,
+                                                               rec_starts,
+                                                               num_records,
+                                                               row_indices,
+                                                               num_rows,
+                                                               column_infos);
 
   CUDA_TRY(cudaGetLastError());
 }
 
+/**
+ * @copydoc cudf::io::json::gpu::build_json_tree
+ *
+ **/
+json_tree build_json_tree(const char *data,
+                          size_t size,
+                          ParseOptions const &opts,
+                          cudaStream_t stream)
+{
+  CUDF_EXPECTS(size <= max_key_position, "Input data is too large for nested JSON parsing");
+  auto policy = rmm::exec_policy(stream);
+  json_tree tree;
+
+  // Characters within strings, from the running parity of the unescaped quotes
+  rmm::device_vector<uint8_t> in_string(size);
+  auto const toggles = thrust::make_transform_iterator(thrust::make_counting_iterator<uint64_t>(0),
+                                                       quote_toggle_fn{data, opts.quotechar});
+  thrust::inclusive_scan(
+    policy->on(stream), toggles, toggles + size, in_string.begin(), thrust::bit_xor<uint8_t>());
+
+  // Positions of the brackets, colons and commas
+  const is_token_fn is_token{data, in_string.data().get()};
+  const cudf::size_type num_tokens =
+    thrust::count_if(policy->on(stream),
+                     thrust::make_counting_iterator<uint64_t>(0),
+                     thrust::make_counting_iterator<uint64_t>(size),
+                     is_token);
+  if (num_tokens == 0) { return tree; }
+  rmm::device_vector<uint64_t> token_pos(num_tokens);
+  thrust::copy_if(policy->on(stream),
+                  thrust::make_counting_iterator<uint64_t>(0),
+                  thrust::make_counting_iterator<uint64_t>(size),
+                  token_pos.begin(),
+                  is_token);
+  in_string = rmm::device_vector<uint8_t>{};
+
+  // Nesting level of each token, from the running sum of the brackets
+  rmm::device_vector<cudf::size_type> levels(num_tokens);
+  auto const deltas = thrust::make_transform_iterator(token_pos.begin(), bracket_delta_fn{data});
+  thrust::exclusive_scan(policy->on(stream), deltas, deltas + num_tokens, levels.begin());
+  thrust::transform(policy->on(stream),
+                    levels.begin(),
+                    levels.end(),
+                    token_pos.begin(),
+                    levels.begin(),
+                    token_level_fn{data});
+  // Balanced input only has non-negative levels and ends with a record's closing bracket
+  const bool has_negative_level =
+    thrust::any_of(policy->on(stream), levels.begin(), levels.end(), is_negative_level_fn{});
+  const cudf::size_type last_level = levels.back();
+  char last_token                  = '\0';
+  CUDA_TRY(cudaMemcpyAsync(&last_token,
+                           data + static_cast<uint64_t>(token_pos.back()),
+                           sizeof(char),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDF_EXPECTS(!has_negative_level && last_level == 0 && (last_token == '}' || last_token == ']'),
+               "Unbalanced brackets in JSON input");
+
+  // Containers, numbered by the position of their opening bracket
+  rmm::device_vector<cudf::size_type> open_ranks(num_tokens);
+  auto const is_open_flags =
+    thrust::make_transform_iterator(token_pos.begin(), is_open_token_fn{data});
+  thrust::exclusive_scan(
+    policy->on(stream), is_open_flags, is_open_flags + num_tokens, open_ranks.begin());
+  const cudf::size_type num_containers = thrust::count_if(
+    policy->on(stream), token_pos.begin(), token_pos.end(), is_open_token_fn{data});
+  rmm::device_vector<cudf::size_type> container_tokens(num_containers);
+  thrust::copy_if(policy->on(stream),
+                  thrust::make_counting_iterator<cudf::size_type>(0),
+                  thrust::make_counting_iterator<cudf::size_type>(num_tokens),
+                  token_pos.begin(),
+                  container_tokens.begin(),
+                  is_open_token_fn{data});
+
+  // Opening and closing brackets in level key order
+  const token_key_fn token_key{token_pos.data().get(), levels.data().get()};
+  rmm::device_vector<uint64_t> open_keys(num_containers);
+  thrust::transform(policy->on(stream),
+                    container_tokens.begin(),
+                    container_tokens.end(),
+                    open_keys.begin(),
+                    token_key);
+  rmm::device_vector<cudf::size_type> sorted_containers(num_containers);
+  thrust::sequence(policy->on(stream), sorted_containers.begin(), sorted_containers.end());
+  thrust::sort_by_key(
+    policy->on(stream), open_keys.begin(), open_keys.end(), sorted_containers.begin());
+  rmm::device_vector<uint64_t> close_keys(num_containers);
+  auto const token_keys =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<cudf::size_type>(0), token_key);
+  thrust::copy_if(policy->on(stream),
+                  token_keys,
+                  token_keys + num_tokens,
+                  token_pos.begin(),
+                  close_keys.begin(),
+                  is_close_token_fn{data});
+  thrust::sort(policy->on(stream), close_keys.begin(), close_keys.end());
+
+  rmm::device_vector<cudf::size_type> token_containers(num_tokens);
+  thrust::transform(policy->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(num_tokens),
+                    token_containers.begin(),
+                    enclosing_container_fn{data,
+                                           token_pos.data().get(),
+                                           levels.data().get(),
+                                           open_keys.data().get(),
+                                           sorted_containers.data().get(),
+                                           num_containers});
+
+  tree.container_parents.resize(num_containers);
+  tree.container_keys.resize(num_containers);
+  rmm::device_vector<uint64_t> container_ends(num_containers);
+  rmm::device_vector<bool> container_is_array(num_containers);
+  thrust::for_each(policy->on(stream),
+                   thrust::make_counting_iterator<cudf::size_type>(0),
+                   thrust::make_counting_iterator<cudf::size_type>(num_containers),
+                   container_info_fn{data,
+                                     token_pos.data().get(),
+                                     levels.data().get(),
+                                     token_containers.data().get(),
+                                     container_tokens.data().get(),
+                                     close_keys.data().get(),
+                                     num_containers,
+                                     opts.quotechar,
+                                     tree.container_parents.data().get(),
+                                     container_ends.data().get(),
+                                     tree.container_keys.data().get(),
+                                     container_is_array.data().get()});
+
+  // Paths of the containers, one level after the other so that the parents' paths are known
+  const cudf::size_type num_levels = (open_keys.back() >> level_key_shift) + 1;
+  rmm::device_vector<uint64_t> level_begin_keys(num_levels + 1);
+  thrust::transform(policy->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(num_levels + 1),
+                    level_begin_keys.begin(),
+                    level_begin_key_fn{});
+  rmm::device_vector<cudf::size_type> level_begins(num_levels + 1);
+  thrust::lower_bound(policy->on(stream),
+                      open_keys.begin(),
+                      open_keys.end(),
+                      level_begin_keys.begin(),
+                      level_begin_keys.end(),
+                      level_begins.begin());
+  thrust::host_vector<cudf::size_type> h_level_begins = level_begins;
+  tree.num_records                                     = h_level_begins[1];
+
+  rmm::device_vector<uint64_t> container_paths(num_containers);
+  rmm::device_vector<cudf::size_type> container_rows(num_containers);
+  rmm::device_vector<bool> container_in_arrays(num_containers);
+  rmm::device_vector<bool> container_opaque(num_containers);
+  const container_path_fn container_path{data,
+                                         sorted_containers.data().get(),
+                                         tree.container_parents.data().get(),
+                                         tree.container_keys.data().get(),
+                                         container_is_array.data().get(),
+                                         container_paths.data().get(),
+                                         container_rows.data().get(),
+                                         container_in_arrays.data().get(),
+                                         container_opaque.data().get()};
+  for (cudf::size_type level = 0; level < num_levels; ++level) {
+    thrust::for_each(policy->on(stream),
+                     thrust::make_counting_iterator(h_level_begins[level]),
+                     thrust::make_counting_iterator(h_level_begins[level + 1]),
+                     container_path);
+  }
+
+  // Scalar values
+  const value_slot_fn slots{data,
+                            token_pos.data().get(),
+                            num_tokens,
+                            token_containers.data().get(),
+                            open_ranks.data().get(),
+                            container_ends.data().get(),
+                            container_is_array.data().get(),
+                            container_opaque.data().get()};
+  rmm::device_vector<text_range> slot_values(num_tokens);
+  thrust::transform(policy->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(num_tokens),
+                    slot_values.begin(),
+                    slots);
+  const cudf::size_type num_values = thrust::count_if(
+    policy->on(stream), slot_values.begin(), slot_values.end(), is_nonempty_range_fn{});
+  rmm::device_vector<cudf::size_type> value_tokens(num_values);
+  thrust::copy_if(policy->on(stream),
+                  thrust::make_counting_iterator<cudf::size_type>(0),
+                  thrust::make_counting_iterator<cudf::size_type>(num_tokens),
+                  slot_values.begin(),
+                  value_tokens.begin(),
+                  is_nonempty_range_fn{});
+
+  rmm::device_vector<text_range> values(num_values);
+  thrust::gather(policy->on(stream),
+                 value_tokens.begin(),
+                 value_tokens.end(),
+                 slot_values.begin(),
+                 values.begin());
+  rmm::device_vector<text_range> value_keys(num_values);
+  rmm::device_vector<cudf::size_type> value_parents(num_values);
+  rmm::device_vector<cudf::size_type> value_rows(num_values);
+  rmm::device_vector<bool> value_in_arrays(num_values);
+  tree.value_paths.resize(num_values);
+  thrust::for_each(policy->on(stream),
+                   thrust::make_counting_iterator<cudf::size_type>(0),
+                   thrust::make_counting_iterator<cudf::size_type>(num_values),
+                   value_info_fn{slots,
+                                 value_tokens.data().get(),
+                                 container_paths.data().get(),
+                                 container_rows.data().get(),
+                                 container_in_arrays.data().get(),
+                                 opts.quotechar,
+                                 value_keys.data().get(),
+                                 value_parents.data().get(),
+                                 value_rows.data().get(),
+                                 tree.value_paths.data().get(),
+                                 value_in_arrays.data().get()});
+
+  // Group the values by path, keeping the input order within each path
+  rmm::device_vector<cudf::size_type> order(num_values);
+  thrust::sequence(policy->on(stream), order.begin(), order.end());
+  thrust::stable_sort_by_key(
+    policy->on(stream), tree.value_paths.begin(), tree.value_paths.end(), order.begin());
+  auto gather_values = [&](auto const &input, auto &output) {
+    output.resize(num_values);
+    thrust::gather(policy->on(stream), order.begin(), order.end(), input.begin(), output.begin());
+  };
+  gather_values(values, tree.values);
+  gather_values(value_keys, tree.value_keys);
+  gather_values(value_parents, tree.value_parents);
+  gather_values(value_rows, tree.value_rows);
+  gather_values(value_in_arrays, tree.value_in_arrays);
+
+  return tree;
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::detect_value_types
+ *
+ **/
+void detect_value_types(ColumnInfo *column_infos,
+                        const char *data,
+                        text_range const *values,
+                        cudf::size_type const *value_columns,
+                        cudf::size_type num_values,
+                        ParseOptions const &opts,
+                        cudaStream_t stream)
+{
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<cudf::size_type>(0),
+                   thrust::make_counting_iterator<cudf::size_type>(num_values),
+                   detect_value_type_fn{data, values, value_columns, opts, column_infos});
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::convert_json_values
+ *
+ **/
+void convert_json_values(const char *data,
+                         text_range const *values,
+                         cudf::size_type const *value_ids,
+                         cudf::size_type num_elements,
+                         data_type dtype,
+                         void *output,
+                         bitmask_type *valid,
+                         cudf::size_type *num_valid,
+                         ParseOptions const &opts,
+                         cudaStream_t stream)
+{
+  thrust::for_each(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(num_elements),
+    convert_value_fn{data, values, value_ids, dtype, output, valid, num_valid, opts});
+}
+
 }  // namespace gpu
 }  // namespace json
 }  // namespace io
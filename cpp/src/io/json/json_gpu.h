@@ -19,6 +19,8 @@
 #include <cudf/types.hpp>
 #include <io/utilities/parsing_utils.cuh>
 
+#include <rmm/thrust_rmm_allocator.h>
+
 namespace cudf {
 namespace io {
 namespace json {
@@ -35,6 +37,8 @@ namespace gpu {
  * @param[out] valid_fields The bitmaps indicating whether column fields are valid
  * @param[out] num_valid_fields The numbers of valid fields in columns
  * @param[in] opts A set of parsing options
+ * @param[out] column_infos If not null, the count for each column data type, gathered while
+ * converting
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns void
@@ -48,7 +52,8 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
                              bitmask_type *const *valid_fields,
                              cudf::size_type *num_valid_fields,
                              ParseOptions const &opts,
-                             cudaStream_t stream = 0);
+                             ColumnInfo *column_infos = nullptr,
+                             cudaStream_t stream      = 0);
 
 /**
  * @brief Process a buffer of data and determine information about the column types within.
@@ -60,6 +65,9 @@ void convert_json_to_columns(rmm::device_buffer const &input_data,
  * @param[in] num_columns The number of columns of input data
  * @param[in] rec_starts The start the input data of interest
  * @param[in] num_records The number of lines/rows of input data
+ * @param[in] row_indices Indices of the `num_rows` records to process, or nullptr to process all
+ * records
+ * @param[in] num_rows The number of records to process
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  *
  * @returns void
@@ -71,8 +79,112 @@ void detect_data_types(ColumnInfo *column_infos,
                        int num_columns,
                        const uint64_t *rec_starts,
                        cudf::size_type num_records,
+                       const cudf::size_type *row_indices,
+                       cudf::size_type num_rows,
                        cudaStream_t stream = 0);
 
+/**
+ * @brief A range of characters of the input data; empty if `begin == end`
+ **/
+struct text_range {
+  uint64_t begin;
+  uint64_t end;
+};
+
+/**
+ * @brief The scalar values of a set of JSON records, with the objects and arrays that enclose
+ * them (the containers)
+ *
+ * The values are grouped by field path, the field names and arrays on the way from the record to
+ * the value, and are in input order within each path. An array nested directly within another
+ * array is a single value holding the text of the inner array.
+ **/
+struct json_tree {
+  cudf::size_type num_records = 0;
+  /// Enclosing container of each container, in input order; -1 for the records
+  rmm::device_vector<cudf::size_type> container_parents;
+  /// Field name of each container in the enclosing object; empty within an array
+  rmm::device_vector<text_range> container_keys;
+  /// Text of each value, without the surrounding whitespace
+  rmm::device_vector<text_range> values;
+  /// Field name of each value in the enclosing object; empty within an array
+  rmm::device_vector<text_range> value_keys;
+  /// Enclosing container of each value
+  rmm::device_vector<cudf::size_type> value_parents;
+  /// Record of each value
+  rmm::device_vector<cudf::size_type> value_rows;
+  /// Hash of the field path of each value
+  rmm::device_vector<uint64_t> value_paths;
+  /// Whether each value is within an array, directly or through objects
+  rmm::device_vector<bool> value_in_arrays;
+};
+
+/**
+ * @brief Tokenizes JSON records and builds the tree of their values.
+ *
+ * Every character is processed in parallel: a scan over the unescaped quotes finds the characters
+ * within strings, and a scan over the remaining brackets finds the nesting level of each bracket,
+ * colon and comma. Each token's enclosing container is then found by a binary search over the
+ * opening brackets sorted by level.
+ *
+ * @throw cudf::logic_error if the brackets are not balanced
+ *
+ * @param[in] data Input data buffer in device memory
+ * @param[in] size Size of the data buffer, in bytes
+ * @param[in] opts A set of parsing options
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @returns The values and containers of the records
+ **/
+json_tree build_json_tree(const char *data,
+                          size_t size,
+                          ParseOptions const &opts,
+                          cudaStream_t stream = 0);
+
+/**
+ * @brief Determines information about the data types of the values of each column.
+ *
+ * @param[out] column_infos The count for each column data type
+ * @param[in] data Input data buffer in device memory
+ * @param[in] values The text of each value
+ * @param[in] value_columns The column of each value
+ * @param[in] num_values The number of values
+ * @param[in] opts A set of parsing options
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ **/
+void detect_value_types(ColumnInfo *column_infos,
+                        const char *data,
+                        text_range const *values,
+                        cudf::size_type const *value_columns,
+                        cudf::size_type num_values,
+                        ParseOptions const &opts,
+                        cudaStream_t stream = 0);
+
+/**
+ * @brief Converts values to the elements of a column.
+ *
+ * @param[in] data Input data buffer in device memory
+ * @param[in] values The text of each value
+ * @param[in] value_ids The value of each element; negative for null elements
+ * @param[in] num_elements The number of elements
+ * @param[in] dtype The data type of the elements
+ * @param[out] output The element data
+ * @param[out] valid The bitmap indicating whether the elements are valid
+ * @param[out] num_valid The number of valid elements
+ * @param[in] opts A set of parsing options
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ **/
+void convert_json_values(const char *data,
+                         text_range const *values,
+                         cudf::size_type const *value_ids,
+                         cudf::size_type num_elements,
+                         data_type dtype,
+                         void *output,
+                         bitmask_type *valid,
+                         cudf::size_type *num_valid,
+                         ParseOptions const &opts,
+                         cudaStream_t stream = 0);
+
 }  // namespace gpu
 }  // namespace json
 }  // namespace io
@@ -31,8 +31,17 @@
 #include <io/utilities/parsing_utils.cuh>
 #include <io/utilities/type_conversion.cuh>
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/table/table.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/gather.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+
+#include <map>
+#include <numeric>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -108,6 +117,77 @@ constexpr size_t calculate_max_row_size(int num_columns = 0) noexcept
   }
 }
 
+/**
+ * @brief Parses data types given as `name:type` pairs
+ *
+ * @param[in] dtypes The name and type pairs
+ *
+ * @return Map from the column names to their data types
+ **/
+std::map<std::string, data_type> get_dtype_map(std::vector<std::string> const &dtypes)
+{
+  std::map<std::string, data_type> col_type_map;
+  for (const auto &ts : dtypes) {
+    const size_t colon_idx = ts.find(":");
+    const std::string col_name(ts.begin(), ts.begin() + colon_idx);
+    const std::string type_str(ts.begin() + colon_idx + 1, ts.end());
+
+    col_type_map[col_name] = convert_string_to_dtype(type_str);
+  }
+  return col_type_map;
+}
+
+/**
+ * @brief Selects the data type of a column from the counts of the types of its fields
+ *
+ * @param[in] cinfo The count of each data type
+ * @param[in] num_fields The number of fields of the column
+ *
+ * @return The column data type
+ **/
+data_type infer_data_type(cudf::io::json::ColumnInfo const &cinfo, cudf::size_type num_fields)
+{
+  if (cinfo.null_count == num_fields) {
+    // Entire column is NULL; allocate the smallest amount of memory
+    return data_type(type_id::INT8);
+  } else if (cinfo.string_count > 0) {
+    return data_type(type_id::STRING);
+  } else if (cinfo.datetime_count > 0) {
+    return data_type(type_id::TIMESTAMP_MILLISECONDS);
+  } else if (cinfo.float_count > 0 || (cinfo.int_count > 0 && cinfo.null_count > 0)) {
+    return data_type(type_id::FLOAT64);
+  } else if (cinfo.int_count > 0) {
+    return data_type(type_id::INT64);
+  } else if (cinfo.bool_count > 0) {
+    return data_type(type_id::BOOL8);
+  }
+  CUDF_FAIL("Data type detection failed.\n");
+}
+
+/**
+ * @brief Returns whether a value is the first of its field path
+ **/
+struct is_path_begin_fn {
+  uint64_t const *paths;
+
+  __device__ bool operator()(cudf::size_type value) const
+  {
+    return value == 0 || paths[value] != paths[value - 1];
+  }
+};
+
+/**
+ * @brief Returns 1 for the values that follow the last value of a field path
+ **/
+struct path_change_fn {
+  uint64_t const *paths;
+
+  __device__ cudf::size_type operator()(cudf::size_type value) const
+  {
+    return value != 0 && paths[value] != paths[value - 1];
+  }
+};
+
 }  // anonymous namespace
 
 /**
@@ -360,15 +440,7 @@ void reader::impl::set_data_types(cudaStream_t stream)
         return std::find(s.begin(), s.end(), ':') != s.end();
       });
     if (is_dict) {
-      std::map<std::string, data_type> col_type_map;
-
-      for (const auto &ts : args_.dtype) {
-        const size_t colon_idx = ts.find(":");
-        const std::string col_name(ts.begin(), ts.begin() + colon_idx);
-        const std::string type_str(ts.begin() + colon_idx + 1, ts.end());
-
-        col_type_map[col_name] = convert_string_to_dtype(type_str);
-      }
+      auto col_type_map = get_dtype_map(args_.dtype);
 
       // Using the map here allows O(n log n) complexity
       for (size_t col = 0; col < args_.dtype.size(); ++col) {
@@ -387,6 +459,17 @@ void reader::impl::set_data_types(cudaStream_t stream)
     CUDF_EXPECTS(rec_starts_.size() != 0, "No data available for data type inference.\n");
     const auto num_columns = metadata.column_names.size();
 
+    // The types inferred from a sample are checked against all records when converting them
+    sampled_dtypes_ = args_.type_inference_rows > 0 &&
+                      rec_starts_.size() > static_cast<size_t>(args_.type_inference_rows);
+    const cudf::size_type num_rows =
+      sampled_dtypes_ ? args_.type_inference_rows : rec_starts_.size();
+    rmm::device_vector<cudf::size_type> row_indices;
+    if (sampled_dtypes_) {
+      row_indices = sample_row_indices(rec_starts_.size(), args_.type_inference_rows, stream);
+    }
+    auto const d_row_indices = sampled_dtypes_ ? row_indices.data().get() : nullptr;
+
     rmm::device_vector<cudf::io::json::ColumnInfo> d_column_infos(num_columns,
                                                                   cudf::io::json::ColumnInfo{});
     cudf::io::json::gpu::detect_data_types(d_column_infos.data().get(),
@@ -396,26 +479,13 @@ void reader::impl::set_data_types(cudaStream_t stream)
                                            num_columns,
                                            rec_starts_.data().get(),
                                            rec_starts_.size(),
+                                           d_row_indices,
+                                           num_rows,
                                            stream);
     thrust::host_vector<cudf::io::json::ColumnInfo> h_column_infos = d_column_infos;
 
     for (const auto &cinfo : h_column_infos) {
-      if (cinfo.null_count == static_cast<int>(rec_starts_.size())) {
-        // Entire column is NULL; allocate the smallest amount of memory
-        dtypes_.push_back(data_type(type_id::INT8));
-      } else if (cinfo.string_count > 0) {
-        dtypes_.push_back(data_type(type_id::STRING));
-      } else if (cinfo.datetime_count > 0) {
-        dtypes_.push_back(data_type(type_id::TIMESTAMP_MILLISECONDS));
-      } else if (cinfo.float_count > 0 || (cinfo.int_count > 0 && cinfo.null_count > 0)) {
-        dtypes_.push_back(data_type(type_id::FLOAT64));
-      } else if (cinfo.int_count > 0) {
-        dtypes_.push_back(data_type(type_id::INT64));
-      } else if (cinfo.bool_count > 0) {
-        dtypes_.push_back(data_type(type_id::BOOL8));
-      } else {
-        CUDF_FAIL("Data type detection failed.\n");
-      }
+      dtypes_.push_back(infer_data_type(cinfo, num_rows));
     }
   }
 }
@@ -432,39 +502,60 @@ table_with_metadata reader::impl::convert_data_to_table(cudaStream_t stream)
   const auto num_columns = dtypes_.size();
   const auto num_records = rec_starts_.size();
 
-  // alloc output buffers.
   std::vector<column_buffer> out_buffers;
-  for (size_t col = 0; col < num_columns; ++col) {
-    out_buffers.emplace_back(dtypes_[col], num_records, true, stream, mr_);
-  }
+  rmm::device_vector<cudf::size_type> d_valid_counts;
+  rmm::device_vector<cudf::io::json::ColumnInfo> d_column_infos;
+  if (sampled_dtypes_) { d_column_infos.resize(num_columns, cudf::io::json::ColumnInfo{}); }
+  auto convert_columns = [&](cudf::io::json::ColumnInfo *column_infos) {
+    // alloc output buffers.
+    out_buffers.clear();
+    for (size_t col = 0; col < num_columns; ++col) {
+      out_buffers.emplace_back(dtypes_[col], num_records, true, stream, mr_);
+    }
 
-  thrust::host_vector<data_type> h_dtypes(num_columns);
-  thrust::host_vector<void *> h_data(num_columns);
-  thrust::host_vector<bitmask_type *> h_valid(num_columns);
+    thrust::host_vector<data_type> h_dtypes(num_columns);
+    thrust::host_vector<void *> h_data(num_columns);
+    thrust::host_vector<bitmask_type *> h_valid(num_columns);
 
-  for (size_t i = 0; i < num_columns; ++i) {
-    h_dtypes[i] = dtypes_[i];
-    h_data[i]   = out_buffers[i].data();
-    h_valid[i]  = out_buffers[i].null_mask();
-  }
+    for (size_t i = 0; i < num_columns; ++i) {
+      h_dtypes[i] = dtypes_[i];
+      h_data[i]   = out_buffers[i].data();
+      h_valid[i]  = out_buffers[i].null_mask();
+    }
 
-  rmm::device_vector<data_type> d_dtypes           = h_dtypes;
-  rmm::device_vector<void *> d_data                = h_data;
-  rmm::device_vector<cudf::bitmask_type *> d_valid = h_valid;
-  rmm::device_vector<cudf::size_type> d_valid_counts(num_columns, 0);
-
-  cudf::io::json::gpu::convert_json_to_columns(data_,
-                                               d_dtypes.data().get(),
-                                               d_data.data().get(),
-                                               num_records,
-                                               num_columns,
-                                               rec_starts_.data().get(),
-                                               d_valid.data().get(),
-                                               d_valid_counts.data().get(),
-                                               opts_,
-                                               stream);
-  CUDA_TRY(cudaStreamSynchronize(stream));
-  CUDA_TRY(cudaGetLastError());
+    rmm::device_vector<data_type> d_dtypes           = h_dtypes;
+    rmm::device_vector<void *> d_data                = h_data;
+    rmm::device_vector<cudf::bitmask_type *> d_valid = h_valid;
+    d_valid_counts.assign(num_columns, 0);
+
+    cudf::io::json::gpu::convert_json_to_columns(data_,
+                                                 d_dtypes.data().get(),
+                                                 d_data.data().get(),
+                                                 num_records,
+                                                 num_columns,
+                                                 rec_starts_.data().get(),
+                                                 d_valid.data().get(),
+                                                 d_valid_counts.data().get(),
+                                                 opts_,
+                                                 column_infos,
+                                                 stream);
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    CUDA_TRY(cudaGetLastError());
+  };
+  convert_columns(sampled_dtypes_ ? d_column_infos.data().get() : nullptr);
+
+  if (sampled_dtypes_) {
+    // Types that the sampled records did not represent are widened to fit all records
+    thrust::host_vector<cudf::io::json::ColumnInfo> h_column_infos = d_column_infos;
+    std::vector<data_type> widened_dtypes;
+    for (const auto &cinfo : h_column_infos) {
+      widened_dtypes.push_back(infer_data_type(cinfo, num_records));
+    }
+    if (widened_dtypes != dtypes_) {
+      dtypes_ = std::move(widened_dtypes);
+      convert_columns(nullptr);
+    }
+  }
 
   // postprocess columns
   thrust::host_vector<cudf::size_type> h_valid_counts = d_valid_counts;
@@ -480,6 +571,171 @@ table_with_metadata reader::impl::convert_data_to_table(cudaStream_t stream)
   return table_with_metadata{std::make_unique<table>(std::move(out_columns)), metadata};
 }
 
+/**
+ * @brief Parse the input data with nested objects and arrays and store results a table
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return table_with_metadata struct
+ **/
+table_with_metadata reader::impl::convert_nested_data_to_table(cudaStream_t stream)
+{
+  namespace gpu = cudf::io::json::gpu;
+
+  const auto d_data = static_cast<const char *>(data_.data());
+  auto tree         = gpu::build_json_tree(d_data, data_.size(), opts_, stream);
+
+  const cudf::size_type num_values  = tree.values.size();
+  const cudf::size_type num_records = tree.num_records;
+  CUDF_EXPECTS(num_values != 0, "Error determining column names.\n");
+  auto policy = rmm::exec_policy(stream);
+
+  // Each field path is a column; the values of a path are contiguous
+  rmm::device_vector<cudf::size_type> value_columns(num_values);
+  thrust::transform_inclusive_scan(policy->on(stream),
+                                   thrust::make_counting_iterator<cudf::size_type>(0),
+                                   thrust::make_counting_iterator<cudf::size_type>(num_values),
+                                   value_columns.begin(),
+                                   path_change_fn{tree.value_paths.data().get()},
+                                   thrust::plus<cudf::size_type>());
+  const cudf::size_type num_columns = value_columns.back() + 1;
+  rmm::device_vector<cudf::size_type> column_begins(num_columns);
+  thrust::copy_if(policy->on(stream),
+                  thrust::make_counting_iterator<cudf::size_type>(0),
+                  thrust::make_counting_iterator<cudf::size_type>(num_values),
+                  column_begins.begin(),
+                  is_path_begin_fn{tree.value_paths.data().get()});
+  rmm::device_vector<gpu::text_range> first_values(num_columns);
+  thrust::gather(policy->on(stream),
+                 column_begins.begin(),
+                 column_begins.end(),
+                 tree.values.begin(),
+                 first_values.begin());
+  rmm::device_vector<bool> column_in_arrays(num_columns);
+  thrust::gather(policy->on(stream),
+                 column_begins.begin(),
+                 column_begins.end(),
+                 tree.value_in_arrays.begin(),
+                 column_in_arrays.begin());
+  thrust::host_vector<cudf::size_type> h_column_begins = column_begins;
+  thrust::host_vector<gpu::text_range> h_first_values  = first_values;
+  thrust::host_vector<bool> h_column_in_arrays         = column_in_arrays;
+  h_column_begins.push_back(num_values);
+
+  // Name the columns by the field names on the path from the record to their first value
+  auto text_of = [&](gpu::text_range range) {
+    std::string text(range.end - range.begin, '\0');
+    CUDA_TRY(cudaMemcpyAsync(
+      &text[0], d_data + range.begin, text.size(), cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    return text;
+  };
+  std::vector<std::string> column_names(num_columns);
+  for (cudf::size_type col = 0; col < num_columns; ++col) {
+    std::vector<std::string> keys;
+    const gpu::text_range key = tree.value_keys[h_column_begins[col]];
+    if (key.begin != key.end) { keys.push_back(text_of(key)); }
+    cudf::size_type container = tree.value_parents[h_column_begins[col]];
+    while (container >= 0) {
+      const gpu::text_range container_key = tree.container_keys[container];
+      if (container_key.begin != container_key.end) { keys.push_back(text_of(container_key)); }
+      container = tree.container_parents[container];
+    }
+    for (auto it = keys.rbegin(); it != keys.rend(); ++it) {
+      if (!column_names[col].empty()) { column_names[col] += "."; }
+      column_names[col] += *it;
+    }
+  }
+
+  // Column types are given by name, or inferred from all the values of the column
+  std::vector<data_type> column_types(num_columns);
+  std::map<std::string, data_type> col_type_map;
+  if (!args_.dtype.empty()) {
+    CUDF_EXPECTS(std::all_of(args_.dtype.begin(),
+                             args_.dtype.end(),
+                             [](const std::string &s) { return s.find(':') != std::string::npos; }),
+                 "Nested JSON data types must be specified as name:type pairs.\n");
+    col_type_map = get_dtype_map(args_.dtype);
+  }
+  rmm::device_vector<cudf::io::json::ColumnInfo> d_column_infos(num_columns,
+                                                                cudf::io::json::ColumnInfo{});
+  gpu::detect_value_types(d_column_infos.data().get(),
+                          d_data,
+                          tree.values.data().get(),
+                          value_columns.data().get(),
+                          num_values,
+                          opts_,
+                          stream);
+  thrust::host_vector<cudf::io::json::ColumnInfo> h_column_infos = d_column_infos;
+  for (cudf::size_type col = 0; col < num_columns; ++col) {
+    const auto it     = col_type_map.find(column_names[col]);
+    column_types[col] = (it != col_type_map.end())
+                          ? it->second
+                          : infer_data_type(h_column_infos[col],
+                                            h_column_begins[col + 1] - h_column_begins[col]);
+  }
+
+  auto convert_values = [&](data_type dtype, rmm::device_vector<cudf::size_type> const &ids) {
+    const cudf::size_type num_elements = ids.size();
+    column_buffer buffer(dtype, num_elements, true, stream, mr_);
+    rmm::device_vector<cudf::size_type> num_valid(1, 0);
+    gpu::convert_json_values(d_data,
+                             tree.values.data().get(),
+                             ids.data().get(),
+                             num_elements,
+                             dtype,
+                             buffer.data(),
+                             buffer.null_mask(),
+                             num_valid.data().get(),
+                             opts_,
+                             stream);
+    buffer.null_count() = num_elements - num_valid[0];
+    return make_column(dtype, num_elements, buffer, stream, mr_);
+  };
+
+  // Output the columns in the order of their first value
+  std::vector<cudf::size_type> column_order(num_columns);
+  std::iota(column_order.begin(), column_order.end(), 0);
+  std::sort(column_order.begin(), column_order.end(), [&](auto lhs, auto rhs) {
+    return h_first_values[lhs].begin < h_first_values[rhs].begin;
+  });
+  std::vector<std::unique_ptr<column>> out_columns;
+  table_metadata nested_metadata;
+  for (const auto col : column_order) {
+    const auto begin = h_column_begins[col];
+    const auto end   = h_column_begins[col + 1];
+    const auto rows  = tree.value_rows.begin();
+    if (!h_column_in_arrays[col]) {
+      // One value per record; missing values are null
+      rmm::device_vector<cudf::size_type> value_ids(num_records, -1);
+      thrust::scatter(policy->on(stream),
+                      thrust::make_counting_iterator(begin),
+                      thrust::make_counting_iterator(end),
+                      rows + begin,
+                      value_ids.begin());
+      out_columns.emplace_back(convert_values(column_types[col], value_ids));
+    } else {
+      // One list of the values per record, in input order
+      rmm::device_vector<cudf::size_type> value_ids(end - begin);
+      thrust::sequence(policy->on(stream), value_ids.begin(), value_ids.end(), begin);
+      auto child   = convert_values(column_types[col], value_ids);
+      auto offsets = make_numeric_column(
+        data_type{type_id::INT32}, num_records + 1, mask_state::UNALLOCATED, stream, mr_);
+      thrust::lower_bound(policy->on(stream),
+                          rows + begin,
+                          rows + end,
+                          thrust::make_counting_iterator<cudf::size_type>(0),
+                          thrust::make_counting_iterator<cudf::size_type>(num_records + 1),
+                          offsets->mutable_view().data<cudf::size_type>());
+      out_columns.emplace_back(make_lists_column(
+        num_records, std::move(offsets), std::move(child), 0, rmm::device_buffer{}, stream, mr_));
+    }
+    nested_metadata.column_names.emplace_back(column_names[col]);
+  }
+
+  return table_with_metadata{std::make_unique<table>(std::move(out_columns)), nested_metadata};
+}
+
 reader::impl::impl(std::unique_ptr<datasource> source,
                    std::string filepath,
                    reader_options const &options,
@@ -488,14 +744,14 @@ reader::impl::impl(std::unique_ptr<datasource> source,
 {
   CUDF_EXPECTS(args_.lines, "Only JSON Lines format is currently supported.\n");
 
-  d_true_trie_         = createSerializedTrie({"true"});
-  opts_.trueValuesTrie = d_true_trie_.data().get();
+  d_true_trie_               = createSerializedTrie({"true"});
+  opts_.trueValuesTrie.nodes = d_true_trie_.data().get();
 
-  d_false_trie_         = createSerializedTrie({"false"});
-  opts_.falseValuesTrie = d_false_trie_.data().get();
+  d_false_trie_               = createSerializedTrie({"false"});
+  opts_.falseValuesTrie.nodes = d_false_trie_.data().get();
 
-  d_na_trie_         = createSerializedTrie({"null"});
-  opts_.naValuesTrie = d_na_trie_.data().get();
+  d_na_trie_               = createSerializedTrie({"null"});
+  opts_.naValuesTrie.nodes = d_na_trie_.data().get();
 
   opts_.dayfirst = options.dayfirst;
 }
@@ -524,6 +780,8 @@ table_with_metadata reader::impl::read(size_t range_offset, size_t range_size, c
   upload_data_to_device();
   CUDF_EXPECTS(data_.size() != 0, "Error uploading input data to the GPU.\n");
 
+  if (args_.nested) { return convert_nested_data_to_table(stream); }
+
   set_column_names(stream);
   CUDF_EXPECTS(!metadata.column_names.empty(), "Error determining column names.\n");
 
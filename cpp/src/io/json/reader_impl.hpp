@@ -68,6 +68,7 @@ class reader::impl {
 
   table_metadata metadata;
   std::vector<data_type> dtypes_;
+  bool sampled_dtypes_ = false;  // Whether the types were inferred from a sample of the records
 
   // parsing options
   const bool allow_newlines_in_strings_ = false;
@@ -150,6 +151,18 @@ class reader::impl {
    **/
   table_with_metadata convert_data_to_table(cudaStream_t stream);
 
+  /**
+   * @brief Parse the input data with nested objects and arrays and store results a table
+   *
+   * Each field path becomes a column, named by the dot-separated field names; the values within
+   * arrays become LIST columns, with one list per record
+   *
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return table_with_metadata struct
+   **/
+  table_with_metadata convert_nested_data_to_table(cudaStream_t stream);
+
  public:
   /**
    * @brief Constructor from a dataset source with reader options.
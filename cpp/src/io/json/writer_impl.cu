@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.cu
+ * @brief cuDF-IO JSON writer class implementation
+ */
+
+#include "writer_impl.hpp"
+
+#include <cudf/copying.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/convert/convert_booleans.hpp>
+#include <cudf/strings/convert/convert_datetime.hpp>
+#include <cudf/strings/convert/convert_floats.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
+
+#include <strings/utilities.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/host_vector.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+namespace {  // anonym.
+
+/**
+ * @brief How the (string-converted) fields of a column are written
+ */
+enum class field_kind : int8_t {
+  LITERAL,  ///< numbers and booleans, written as is
+  FLOAT,    ///< floats, written as is, except non-finite values written as null
+  STRING    ///< strings and timestamps, written as escaped JSON strings
+};
+
+/**
+ * @brief Converts the non-string columns to strings columns of their JSON text
+ */
+struct column_to_strings_fn {
+  template <typename column_type>
+  constexpr static bool is_not_handled(void)
+  {
+    return not((std::is_integral<column_type>::value) ||
+               (std::is_floating_point<column_type>::value) || (cudf::is_timestamp<column_type>()));
+  }
+
+  explicit column_to_strings_fn(rmm::mr::device_memory_resource* mr) : mr_(mr) {}
+
+  template <typename column_type>
+  std::enable_if_t<std::is_same<column_type, bool>::value, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::from_booleans(column, string_scalar("true"), string_scalar("false"), mr_);
+  }
+
+  template <typename column_type>
+  std::enable_if_t<std::is_integral<column_type>::value && !std::is_same<column_type, bool>::value,
+                   std::unique_ptr<column>>
+  operator()(column_view const& column) const
+  {
+    return cudf::strings::from_integers(column, mr_);
+  }
+
+  template <typename column_type>
+  std::enable_if_t<std::is_floating_point<column_type>::value, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::from_floats(column, mr_);
+  }
+
+  template <typename column_type>
+  std::enable_if_t<cudf::is_timestamp<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::from_timestamps(column, "%Y-%m-%dT%H:%M:%SZ", mr_);
+  }
+
+  template <typename column_type>
+  std::enable_if_t<is_not_handled<column_type>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    CUDF_FAIL("Unsupported column type.");
+  }
+
+ private:
+  rmm::mr::device_memory_resource* mr_;
+};
+
+/**
+ * @brief Escapes a string and surrounds it by double quotes, as a JSON string
+ */
+std::string escape_json_string(std::string const& str)
+{
+  std::string result{"\""};
+  for (unsigned char chr : str) {
+    switch (chr) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\r': result += "\\r"; break;
+      case '\t': result += "\\t"; break;
+      case '\b': result += "\\b"; break;
+      case '\f': result += "\\f"; break;
+      default:
+        if (chr < 0x20) {
+          char buffer[7];
+          std::snprintf(buffer, sizeof(buffer), "\\u%04x", chr);
+          result += buffer;
+        } else {
+          result += static_cast<char>(chr);
+        }
+    }
+  }
+  return result + "\"";
+}
+
+/**
+ * @brief Formats each row of a table of strings columns into one JSON object
+ *
+ * The object holds one `"key":value` field per column; null fields are written as `null`, or
+ * omitted if `include_nulls` is false. Each object is preceded by the row separator, except the
+ * first one of the output, and followed by the row terminator.
+ *
+ * Called twice by `make_strings_children()`: once for the size of each row, then to write it.
+ */
+struct format_rows_fn {
+  table_device_view const d_columns;
+  field_kind const* d_kinds;
+  char const* d_keys;              ///< escaped keys of the columns, each followed by a colon
+  size_type const* d_key_offsets;  ///< offsets of the keys in `d_keys`
+  bool const include_nulls;
+  bool const first_chunk;  ///< no separator before the first row of the first chunk
+  string_view const d_separator;
+  string_view const d_terminator;
+  int32_t* d_offsets{};  ///< size of the output row stored here during first pass
+  char* d_chars{};       ///< this is null only during the first pass
+
+  __device__ void append(char*& out_ptr, size_type& bytes, string_view const& d_str) const
+  {
+    if (out_ptr) out_ptr = cudf::strings::detail::copy_string(out_ptr, d_str);
+    bytes += d_str.size_bytes();
+  }
+
+  __device__ void append(char*& out_ptr, size_type& bytes, char chr) const
+  {
+    if (out_ptr) *out_ptr++ = chr;
+    ++bytes;
+  }
+
+  // the escaped characters are single bytes which never appear inside a multi-byte UTF-8
+  // character, so the field is processed byte-wise
+  __device__ void append_escaped(char*& out_ptr, size_type& bytes, string_view const& d_str) const
+  {
+    constexpr char const* hex_digits = "0123456789abcdef";
+
+    append(out_ptr, bytes, '\"');
+    auto const d_data = d_str.data();
+    for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+      auto const chr = static_cast<unsigned char>(d_data[i]);
+      char escaped   = 0;
+      switch (chr) {
+        case '\"': escaped = '\"'; break;
+        case '\\': escaped = '\\'; break;
+        case '\n': escaped = 'n'; break;
+        case '\r': escaped = 'r'; break;
+        case '\t': escaped = 't'; break;
+        case '\b': escaped = 'b'; break;
+        case '\f': escaped = 'f'; break;
+        default: break;
+      }
+      if (escaped) {
+        append(out_ptr, bytes, '\\');
+        append(out_ptr, bytes, escaped);
+      } else if (chr < 0x20) {
+        // other control characters as \u00XX
+        append(out_ptr, bytes, string_view("\\u00", 4));
+        append(out_ptr, bytes, hex_digits[chr >> 4]);
+        append(out_ptr, bytes, hex_digits[chr & 0xf]);
+      } else {
+        append(out_ptr, bytes, static_cast<char>(chr));
+      }
+    }
+    append(out_ptr, bytes, '\"');
+  }
+
+  // the strings written by from_floats() for NaN and infinities
+  __device__ bool is_non_finite(string_view const& d_str) const
+  {
+    return d_str == string_view("NaN", 3) || d_str == string_view("Inf", 3) ||
+           d_str == string_view("-Inf", 4);
+  }
+
+  __device__ void operator()(size_type idx) const
+  {
+    char* out_ptr   = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes = 0;
+    if (idx > 0 || !first_chunk) append(out_ptr, bytes, d_separator);
+    append(out_ptr, bytes, '{');
+    bool first_field = true;
+    for (size_type col = 0; col < d_columns.num_columns(); ++col) {
+      auto const d_column = d_columns.column(col);
+      auto const kind     = d_kinds[col];
+      bool is_null        = d_column.is_null(idx);
+      string_view d_str{};
+      if (!is_null) {
+        d_str   = d_column.element<string_view>(idx);
+        is_null = (kind == field_kind::FLOAT) && is_non_finite(d_str);
+      }
+      if (is_null && !include_nulls) continue;
+
+      if (!first_field) append(out_ptr, bytes, ',');
+      first_field = false;
+      append(out_ptr,
+             bytes,
+             string_view(d_keys + d_key_offsets[col], d_key_offsets[col + 1] - d_key_offsets[col]));
+      if (is_null) {
+        append(out_ptr, bytes, string_view("null", 4));
+      } else if (kind == field_kind::STRING) {
+        append_escaped(out_ptr, bytes, d_str);
+      } else {
+        append(out_ptr, bytes, d_str);
+      }
+    }
+    append(out_ptr, bytes, '}');
+    append(out_ptr, bytes, d_terminator);
+    if (!d_chars) d_offsets[idx] = bytes;
+  }
+};
+
+}  // unnamed namespace
+
+// Forward to implementation
+writer::writer(std::unique_ptr<data_sink> sink,
+               writer_options const& options,
+               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(std::move(sink), options, mr))
+{
+}
+
+// Destructor within this translation unit
+writer::~writer() = default;
+
+writer::impl::impl(std::unique_ptr<data_sink> sink,
+                   writer_options const& options,
+                   rmm::mr::device_memory_resource* mr)
+  : out_sink_(std::move(sink)), mr_(mr), options_(options)
+{
+}
+
+void writer::impl::write_device_bytes(char const* data, size_t size, cudaStream_t stream)
+{
+  if (out_sink_->supports_device_write()) {
+    out_sink_->device_write(data, size, stream);
+  } else {
+    thrust::host_vector<char> h_bytes(size);
+    CUDA_TRY(cudaMemcpyAsync(h_bytes.data(), data, size, cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    out_sink_->host_write(h_bytes.data(), size);
+  }
+}
+
+// in records orientation, the objects are the elements of a single array:
+//
+void writer::impl::write_chunked_begin(table_view const& table,
+                                       const table_metadata* metadata,
+                                       cudaStream_t stream)
+{
+  if (!options_.lines()) { out_sink_->host_write("[", 1); }
+}
+
+void writer::impl::write_chunked(column_view const& rows_chars,
+                                 const table_metadata* metadata,
+                                 cudaStream_t stream)
+{
+  CUDF_EXPECTS(rows_chars.size() > 0, "Unexpected empty chunk.");
+
+  write_device_bytes(rows_chars.data<char>(), rows_chars.size(), stream);
+}
+
+void writer::impl::write_chunked_end(table_view const& table,
+                                     const table_metadata* metadata,
+                                     cudaStream_t stream)
+{
+  if (!options_.lines()) { out_sink_->host_write("]", 1); }
+  out_sink_->flush();
+}
+
+void writer::impl::write(table_view const& table,
+                         const table_metadata* metadata,
+                         cudaStream_t stream)
+{
+  CUDF_EXPECTS(table.num_columns() > 0, "Empty table.");
+
+  write_chunked_begin(table, metadata, stream);
+
+  if (table.num_rows() > 0) {
+    // the keys of the objects: the column names, or the column indices without names
+    //
+    bool const has_names = (metadata != nullptr) && (not metadata->column_names.empty());
+    CUDF_EXPECTS(
+      !has_names || metadata->column_names.size() == static_cast<size_t>(table.num_columns()),
+      "Mismatch between number of column names and table columns.");
+    std::string keys;
+    std::vector<size_type> key_offsets{0};
+    for (size_type col = 0; col < table.num_columns(); ++col) {
+      keys += escape_json_string(has_names ? metadata->column_names[col] : std::to_string(col));
+      keys += ':';
+      key_offsets.push_back(static_cast<size_type>(keys.size()));
+    }
+    rmm::device_vector<char> d_keys(keys.begin(), keys.end());
+    rmm::device_vector<size_type> d_key_offsets(key_offsets);
+
+    // the kind of the fields of each column
+    //
+    thrust::host_vector<field_kind> kinds;
+    for (auto const& current_col : table) {
+      auto const type = current_col.type();
+      kinds.push_back((type.id() == type_id::STRING || cudf::is_timestamp(type))
+                        ? field_kind::STRING
+                        : cudf::is_floating_point(type) ? field_kind::FLOAT : field_kind::LITERAL);
+    }
+    rmm::device_vector<field_kind> d_kinds(kinds);
+
+    // lines mode terminates each object; records orientation separates the array elements
+    //
+    auto const lines = options_.lines();
+    string_scalar const separator{lines ? "" : ",", true, stream};
+    string_scalar const terminator{lines ? options_.line_terminator() : "", true, stream};
+
+    // split the table into chunks of rows, to bound the memory of the formatted rows
+    //
+    std::vector<table_view> vector_views{table};
+    auto const n_rows_per_chunk = options_.rows_per_chunk();
+    if (n_rows_per_chunk > 0 && table.num_rows() > n_rows_per_chunk) {
+      std::vector<size_type> splits;
+      for (size_type row = n_rows_per_chunk; row < table.num_rows(); row += n_rows_per_chunk) {
+        splits.push_back(row);
+      }
+      vector_views = cudf::split(table, splits);
+    }
+
+    // format each chunk to JSON:
+    //
+    column_to_strings_fn converter{mr_};
+    bool first_chunk = true;
+    for (auto&& sub_view : vector_views) {
+      // string columns are formatted in place; the other columns are converted to strings:
+      //
+      std::vector<std::unique_ptr<column>> converted_columns;
+      std::vector<column_view> str_columns;
+      for (auto const& current_col : sub_view) {
+        if (current_col.type().id() == type_id::STRING) {
+          str_columns.push_back(current_col);
+        } else {
+          converted_columns.push_back(
+            cudf::type_dispatcher(current_col.type(), converter, current_col));
+          str_columns.push_back(converted_columns.back()->view());
+        }
+      }
+      auto d_str_table = table_device_view::create(table_view{str_columns}, stream);
+
+      format_rows_fn format_fn{*d_str_table,
+                               d_kinds.data().get(),
+                               d_keys.data().get(),
+                               d_key_offsets.data().get(),
+                               options_.include_nulls(),
+                               first_chunk,
+                               separator.value(stream),
+                               terminator.value(stream)};
+      auto rows = cudf::strings::detail::make_strings_children(
+        format_fn, sub_view.num_rows(), 0, mr_, stream);
+
+      write_chunked(rows.second->view(), metadata, stream);
+      first_chunk = false;
+    }
+  }
+
+  write_chunked_end(table, metadata, stream);
+}
+
+void writer::write_all(table_view const& table, const table_metadata* metadata, cudaStream_t stream)
+{
+  _impl->write(table, metadata, stream);
+}
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
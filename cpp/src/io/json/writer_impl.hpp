@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file writer_impl.hpp
+ * @brief cuDF-IO JSON writer class implementation header
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/writers.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+using namespace cudf::io;
+
+/**
+ * @brief Implementation for JSON writer
+ **/
+class writer::impl {
+ public:
+  /**
+   * @brief Constructor with writer options.
+   *
+   * @param sink Output sink
+   * @param options Settings for controlling behavior
+   * @param mr Device memory resource to use for device memory allocation
+   **/
+  impl(std::unique_ptr<data_sink> sink,
+       writer_options const& options,
+       rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Write an entire dataset to JSON format.
+   *
+   * @param table The set of columns
+   * @param metadata The metadata associated with the table
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void write(table_view const& table,
+             const table_metadata* metadata = nullptr,
+             cudaStream_t stream            = nullptr);
+
+  /**
+   * @brief Write the opening of the JSON output: the array bracket in records orientation.
+   *
+   * @param table The set of columns
+   * @param metadata The metadata associated with the table
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void write_chunked_begin(table_view const& table,
+                           const table_metadata* metadata = nullptr,
+                           cudaStream_t stream            = nullptr);
+
+  /**
+   * @brief Write the formatted rows of a chunk.
+   *
+   * @param rows_chars Characters of the formatted rows of the chunk
+   * @param metadata The metadata associated with the table
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void write_chunked(column_view const& rows_chars,
+                     const table_metadata* metadata = nullptr,
+                     cudaStream_t stream            = nullptr);
+
+  /**
+   * @brief Write the closing of the JSON output: the array bracket in records orientation.
+   *
+   * @param table The set of columns
+   * @param metadata The metadata associated with the table
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void write_chunked_end(table_view const& table,
+                         const table_metadata* metadata = nullptr,
+                         cudaStream_t stream            = nullptr);
+
+ private:
+  /**
+   * @brief Write bytes from device memory to the sink.
+   *
+   * @param data The bytes to write
+   * @param size Number of bytes
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void write_device_bytes(char const* data, size_t size, cudaStream_t stream);
+
+  std::unique_ptr<data_sink> out_sink_;
+  rmm::mr::device_memory_resource* mr_ = nullptr;
+  writer_options const options_;
+};
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bloom_filter.cuh"
+#include "orc_common.h"
+#include "orc_gpu.h"
+
+namespace cudf {
+namespace io {
+namespace orc {
+namespace gpu {
+namespace {
+/**
+ * @brief Returns the bloom filter hash of a value of a column
+ */
+__device__ uint64_t hash_column_value(BloomFilterChunk const &ck, uint32_t row)
+{
+  auto const data = ck.column_data_base;
+  switch (ck.type_kind) {
+    case BYTE: return bloom_filter_hash_long(static_cast<int8_t const *>(data)[row]);
+    case SHORT: return bloom_filter_hash_long(static_cast<int16_t const *>(data)[row]);
+    case INT:
+    case DATE: return bloom_filter_hash_long(static_cast<int32_t const *>(data)[row]);
+    case LONG: return bloom_filter_hash_long(static_cast<int64_t const *>(data)[row]);
+    case FLOAT:
+      return bloom_filter_hash_long(
+        __double_as_longlong(static_cast<double>(static_cast<float const *>(data)[row])));
+    case DOUBLE: return bloom_filter_hash_long(static_cast<int64_t const *>(data)[row]);
+    case STRING: {
+      auto const &str = static_cast<nvstrdesc_s const *>(data)[row];
+      return bloom_filter_hash_bytes(reinterpret_cast<uint8_t const *>(str.ptr),
+                                     static_cast<uint32_t>(str.count));
+    }
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Inserts the non-null values of a row group into its filter; one block per row group
+ */
+__global__ void __launch_bounds__(256) gpuBuildBloomFilters(BloomFilterChunk const *chunks)
+{
+  auto const &ck = chunks[blockIdx.x];
+  for (uint32_t i = threadIdx.x; i < ck.num_rows; i += blockDim.x) {
+    auto const row = ck.start_row + i;
+    if (row >= ck.valid_rows) { break; }
+    auto const valid = ck.valid_map_base;
+    if (valid != nullptr && !((valid[row >> 5] >> (row & 0x1f)) & 1)) { continue; }
+    auto const hash = hash_column_value(ck, row);
+    for (uint32_t j = 1; j <= ck.num_hashes; ++j) {
+      auto const bit = bloom_filter_bit(hash, j, ck.num_bits);
+      atomicOr(ck.words + (bit >> 5), 1u << (bit & 0x1f));
+    }
+  }
+}
+
+}  // namespace
+
+cudaError_t BuildBloomFilters(BloomFilterChunk const *chunks,
+                              uint32_t num_chunks,
+                              cudaStream_t stream)
+{
+  gpuBuildBloomFilters<<<num_chunks, 256, 0, stream>>>(chunks);
+  return cudaSuccess;
+}
+
+}  // namespace gpu
+}  // namespace orc
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file bloom_filter.cuh
+ * @brief Bloom filters of the ORC format (BLOOM_FILTER_UTF8 streams)
+ *
+ * Each row group of a column has a filter of `num_bits` bits (a multiple of 64) stored as
+ * little-endian 64-bit words. Integer and date values are hashed with Thomas Wang's 64-bit integer
+ * hash, floating-point values with the same hash of the bits of their double representation, and
+ * strings with the 64-bit Murmur3 variant of the ORC Java writer. The two halves of the hash are
+ * combined into `num_hashes` bit positions with double hashing.
+ */
+
+namespace cudf {
+namespace io {
+namespace orc {
+CUDA_HOST_DEVICE_CALLABLE uint64_t bloom_filter_rotl(uint64_t x, int r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+/**
+ * @brief Returns the ORC bloom filter hash of a string
+ */
+CUDA_HOST_DEVICE_CALLABLE uint64_t bloom_filter_hash_bytes(uint8_t const *data, uint32_t length)
+{
+  constexpr uint64_t c1 = 0x87c37b91114253d5ull;
+  constexpr uint64_t c2 = 0x4cf5ad432745937full;
+  uint64_t hash         = 104729;  // Seed of the ORC writer
+  uint32_t const tail   = length & ~7u;
+  for (uint32_t pos = 0; pos < tail; pos += 8) {
+    uint64_t k = 0;
+    for (int b = 7; b >= 0; b--) { k = (k << 8) | data[pos + b]; }
+    hash ^= bloom_filter_rotl(k * c1, 31) * c2;
+    hash = bloom_filter_rotl(hash, 27) * 5 + 0x52dce729;
+  }
+  if (length > tail) {
+    uint64_t k = 0;
+    for (uint32_t b = length; b > tail; b--) { k = (k << 8) | data[b - 1]; }
+    hash ^= bloom_filter_rotl(k * c1, 31) * c2;
+  }
+  hash ^= length;
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/**
+ * @brief Returns the ORC bloom filter hash of an integer, or of the bits of a double
+ */
+CUDA_HOST_DEVICE_CALLABLE uint64_t bloom_filter_hash_long(int64_t value)
+{
+  auto key = static_cast<uint64_t>(value);
+  key      = (~key) + (key << 21);
+  key ^= key >> 24;
+  key = (key + (key << 3)) + (key << 8);
+  key ^= key >> 28;
+  key = (key + (key << 2)) + (key << 4);
+  key ^= key >> 28;
+  key += key << 31;
+  return key;
+}
+
+/**
+ * @brief Returns the position of the bit `i` (in `[1, num_hashes]`) of a hash in a filter
+ */
+CUDA_HOST_DEVICE_CALLABLE uint32_t bloom_filter_bit(uint64_t hash, uint32_t i, uint32_t num_bits)
+{
+  // 32-bit arithmetic wrapping around as in the Java writer
+  auto const h1       = static_cast<uint32_t>(hash);
+  auto const h2       = static_cast<uint32_t>(hash >> 32);
+  auto const combined = static_cast<int32_t>(h1 + i * h2);
+  return static_cast<uint32_t>(combined < 0 ? ~combined : combined) % num_bits;
+}
+
+/**
+ * @brief Returns the number of bits of a filter for a number of values
+ *
+ * @param num_values Number of values of a row group
+ * @param fpp False positive probability
+ */
+inline uint32_t bloom_filter_num_bits(size_t num_values, double fpp)
+{
+  auto const ln2  = std::log(2.0);
+  auto const bits = static_cast<uint64_t>(-std::log(fpp) * num_values / (ln2 * ln2));
+  return static_cast<uint32_t>((bits / 64 + 1) * 64);
+}
+
+/**
+ * @brief Returns the number of hash functions of a filter
+ *
+ * @param num_values Number of values of a row group
+ * @param num_bits Number of bits of the filter
+ */
+inline uint32_t bloom_filter_num_hashes(size_t num_values, uint32_t num_bits)
+{
+  auto const k = std::round(static_cast<double>(num_bits) / std::max<size_t>(num_values, 1) *
+                            std::log(2.0));
+  return std::max(1u, static_cast<uint32_t>(k));
+}
+
+/**
+ * @brief Returns whether a filter may contain a value, from the hash of the value
+ *
+ * @param bitset Little-endian words of the filter
+ * @param size Size of the filter in bytes
+ * @param num_hashes Number of hash functions of the filter
+ * @param hash Hash of the value
+ *
+ * @return `false` if the value was not inserted into the filter
+ */
+inline bool bloom_filter_may_contain(uint8_t const *bitset,
+                                     size_t size,
+                                     uint32_t num_hashes,
+                                     uint64_t hash)
+{
+  auto const num_bits = static_cast<uint32_t>(size * 8);
+  if (num_bits == 0) { return true; }
+  for (uint32_t i = 1; i <= num_hashes; ++i) {
+    auto const bit = bloom_filter_bit(hash, i, num_bits);
+    if (!((bitset[bit >> 3] >> (bit & 7)) & 1)) { return false; }
+  }
+  return true;
+}
+
+}  // namespace orc
+}  // namespace io
+}  // namespace cudf
@@ -16,7 +16,7 @@
 
 /**
  * @file chunked_state.hpp
- * @brief definition for chunked state structure used by ORC writer
+ * @brief definition for chunked state structures used by ORC writer and reader
  */
 
 #pragma once
@@ -24,6 +24,7 @@
 #include "orc.h"
 
 #include <cudf/io/data_sink.hpp>
+#include <cudf/io/readers.hpp>
 #include <cudf/io/writers.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
@@ -60,6 +61,17 @@ struct orc_chunked_state {
   bool single_write_mode = false;
 };
 
+/**
+ * @brief Chunked reader state struct. Holds the reader, and thus the parsed file metadata, across
+ *        the begin() / read() / end() call process.
+ */
+struct orc_chunked_read_state {
+  /// The reader to be used
+  std::unique_ptr<reader> rp;
+  /// Cuda stream to be used
+  cudaStream_t stream = 0;
+};
+
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
@@ -17,6 +17,9 @@
 #include "orc_common.h"
 #include "orc_gpu.h"
 
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
+
 #include <rmm/thrust_rmm_allocator.h>
 
 #include <thrust/device_ptr.h>
@@ -35,6 +38,7 @@ struct dictinit_state_s {
   uint32_t total_dupes;
   DictionaryChunk chunk;
   volatile uint32_t scratch_red[32];
+  uint32_t hll[dict_hll_registers];
   uint16_t dict[MAX_SHORT_DICT_ENTRIES];
   union {
     uint16_t u16[1 << (INIT_HASH_BITS)];
@@ -54,6 +58,21 @@ static inline __device__ uint32_t nvstr_init_hash(const uint8_t *ptr, uint32_t l
   }
 }
 
+/**
+ * @brief Adds a string to the HyperLogLog sketch of the chunk
+ *
+ * The top bits of the hash select the register, which keeps the largest position of the first set
+ * bit of the remaining bits.
+ **/
+static inline __device__ void hll_add_string(uint32_t *hll, const char *ptr, uint32_t len)
+{
+  uint32_t const hash =
+    cudf::detail::MurmurHash3_32<string_view>{}(string_view(ptr, static_cast<size_type>(len)));
+  uint32_t const rank =
+    min(__clz(hash << dict_hll_precision), static_cast<int>(32 - dict_hll_precision)) + 1;
+  atomicMax(&hll[hash >> (32 - dict_hll_precision)], rank);
+}
+
 /**
  * @brief Fill dictionary with the indices of non-null rows
  *
@@ -127,6 +146,7 @@ extern "C" __global__ void __launch_bounds__(512, 2)
   for (uint32_t i = 0; i < sizeof(s->map) / sizeof(uint32_t); i += 512) {
     if (i + t < sizeof(s->map) / sizeof(uint32_t)) s->map.u32[i + t] = 0;
   }
+  if (t < dict_hll_registers) { s->hll[t] = 0; }
   __syncthreads();
   // First, take care of NULLs, and count how many strings we have (TODO: bypass this step when
   // there are no nulls)
@@ -148,6 +168,7 @@ extern "C" __global__ void __launch_bounds__(512, 2)
       ptr    = reinterpret_cast<const uint8_t *>(ck_data[ck_row].ptr);
       len    = ck_data[ck_row].count;
       hash   = nvstr_init_hash(ptr, len);
+      hll_add_string(s->hll, ck_data[ck_row].ptr, len);
     }
     len                    = WarpReduceSum16(len);
     s->scratch_red[t >> 4] = len;
@@ -293,6 +314,9 @@ extern "C" __global__ void __launch_bounds__(512, 2)
     chunks[group_id * num_columns + col_id].num_dict_strings  = nnz - s->total_dupes;
     chunks[group_id * num_columns + col_id].dict_char_count   = dict_char_count;
   }
+  if (t < dict_hll_registers) {
+    chunks[group_id * num_columns + col_id].hll_registers[t] = static_cast<uint8_t>(s->hll[t]);
+  }
 }
 
 /**
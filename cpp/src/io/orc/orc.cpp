@@ -189,6 +189,89 @@ ORC_BEGIN_STRUCT(Metadata)
 ORC_FLD_REPEATED_STRUCT(1, stripeStats)
 ORC_END_STRUCT()
 
+ORC_BEGIN_STRUCT(BloomFilter)
+ORC_FLD_UINT32(1, numHashFunctions)
+ORC_FLD_STRING(3, utf8bitset)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(BloomFilterIndex)
+ORC_FLD_REPEATED_STRUCT(1, bloomFilter)
+ORC_END_STRUCT()
+
+/**
+ * @brief Decodes the min/max fields of an integer (2), double (3), string (4), date (7) or
+ * timestamp (9) statistics message; the min/max is kept only if both values are present
+ **/
+bool ProtobufReader::read_minmax(ColumnStatisticsSummary *s, int stats_kind, size_t maxlen)
+{
+  const uint8_t *end = std::min(m_cur + maxlen, m_end);
+  // Timestamps are compared in UTC, which is stored in fields 3 & 4
+  const int min_id = (stats_kind == 9) ? 3 : 1;
+  const int max_id = min_id + 1;
+  bool has_min = false, has_max = false;
+  while (m_cur < end) {
+    int fld       = get_u32();
+    const int id  = fld >> 3;
+    const int typ = fld & 7;
+    if (id != min_id && id != max_id) {
+      skip_struct_field(typ);
+      continue;
+    }
+    const bool is_min = (id == min_id);
+    if (stats_kind == 3 && typ == PB_TYPE_FIXED64) {
+      double v = 0;
+      if (end - m_cur < 8) return false;
+      memcpy(&v, m_cur, sizeof(v));
+      m_cur += 8;
+      (is_min ? s->double_min : s->double_max) = v;
+    } else if (stats_kind == 4 && typ == PB_TYPE_FIXEDLEN) {
+      uint32_t n = get_u32();
+      if (n > (size_t)(end - m_cur)) return false;
+      (is_min ? s->string_min : s->string_max).assign((const char *)m_cur, n);
+      m_cur += n;
+    } else if (stats_kind != 3 && stats_kind != 4 && typ == PB_TYPE_VARINT) {
+      (is_min ? s->int_min : s->int_max) = get_i64();
+    } else {
+      skip_struct_field(typ);
+      continue;
+    }
+    (is_min ? has_min : has_max) = true;
+  }
+  if (has_min && has_max) {
+    s->kind = (stats_kind == 3)   ? ColumnStatisticsSummary::MINMAX_DOUBLE
+              : (stats_kind == 4) ? ColumnStatisticsSummary::MINMAX_STRING
+                                  : ColumnStatisticsSummary::MINMAX_INT;
+  }
+  return m_cur <= end;
+}
+
+bool ProtobufReader::read(ColumnStatisticsSummary *s, size_t maxlen)
+{
+  const uint8_t *end = std::min(m_cur + maxlen, m_end);
+  while (m_cur < end) {
+    int fld = get_u32();
+    switch (fld) {
+      case 1 * 8 + PB_TYPE_VARINT:
+        s->numberOfValues       = get_u64();
+        s->has_number_of_values = true;
+        break;
+      case 10 * 8 + PB_TYPE_VARINT: s->hasNull = (get_u32() != 0); break;
+      case 2 * 8 + PB_TYPE_FIXEDLEN:  // intStatistics
+      case 3 * 8 + PB_TYPE_FIXEDLEN:  // doubleStatistics
+      case 4 * 8 + PB_TYPE_FIXEDLEN:  // stringStatistics
+      case 7 * 8 + PB_TYPE_FIXEDLEN:  // dateStatistics
+      case 9 * 8 + PB_TYPE_FIXEDLEN: {  // timestampStatistics
+        uint32_t n = get_u32();
+        if (n > (size_t)(end - m_cur)) return false;
+        if (!read_minmax(s, fld >> 3, n)) return false;
+        break;
+      }
+      default: skip_struct_field(fld & 7);
+    }
+  }
+  return m_cur <= end;
+}
+
 // return the column name
 std::string FileFooter::GetColumnName(uint32_t column_id)
 {
@@ -431,6 +514,15 @@ PBW_BEGIN_STRUCT(Metadata)
 PBW_FLD_REPEATED_STRUCT(1, stripeStats)
 PBW_END_STRUCT()
 
+PBW_BEGIN_STRUCT(BloomFilter)
+PBW_FLD_UINT(1, numHashFunctions)
+PBW_FLD_STRING(3, utf8bitset)
+PBW_END_STRUCT()
+
+PBW_BEGIN_STRUCT(BloomFilterIndex)
+PBW_FLD_REPEATED_STRUCT(1, bloomFilter)
+PBW_END_STRUCT()
+
 /* ----------------------------------------------------------------------------*/
 /**
  * @Brief ORC decompression class
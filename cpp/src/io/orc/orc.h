@@ -105,6 +105,36 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct BloomFilter {
+  uint32_t numHashFunctions = 0;  // the number of hash functions
+  std::string utf8bitset;         // the little-endian 64-bit words of the bitset
+};
+
+struct BloomFilterIndex {
+  std::vector<BloomFilter> bloomFilter;  // the bloom filter of each row group
+};
+
+/**
+ * @brief Subset of a decoded ColumnStatistics blob used to evaluate filters
+ *
+ * Only one of the min/max pairs is set, as indicated by `kind`. Date statistics are decoded as
+ * integers (days since epoch) and timestamp statistics as integers (UTC milliseconds since epoch).
+ **/
+struct ColumnStatisticsSummary {
+  enum minmax_kind { MINMAX_NONE, MINMAX_INT, MINMAX_DOUBLE, MINMAX_STRING };
+
+  bool has_number_of_values = false;
+  uint64_t numberOfValues   = 0;  // the number of non-null values
+  bool hasNull              = false;
+  minmax_kind kind          = MINMAX_NONE;
+  int64_t int_min           = 0;
+  int64_t int_max           = 0;
+  double double_min         = 0;
+  double double_max         = 0;
+  std::string string_min;
+  std::string string_max;
+};
+
 // Minimal protobuf reader for orc metadata
 
 /**
@@ -170,9 +200,13 @@ class ProtobufReader {
   DECL_ORC_STRUCT(ColumnEncoding);
   DECL_ORC_STRUCT(StripeStatistics);
   DECL_ORC_STRUCT(Metadata);
+  DECL_ORC_STRUCT(ColumnStatisticsSummary);
+  DECL_ORC_STRUCT(BloomFilter);
+  DECL_ORC_STRUCT(BloomFilterIndex);
 #undef DECL_ORC_STRUCT
  protected:
   bool InitSchema(FileFooter *);
+  bool read_minmax(ColumnStatisticsSummary *, int stats_kind, size_t maxlen);
 
  protected:
   const uint8_t *m_base;
@@ -225,6 +259,8 @@ class ProtobufWriter {
   DECL_PBW_STRUCT(ColumnEncoding);
   DECL_PBW_STRUCT(StripeStatistics);
   DECL_PBW_STRUCT(Metadata);
+  DECL_PBW_STRUCT(BloomFilter);
+  DECL_PBW_STRUCT(BloomFilterIndex);
 #undef DECL_PBW_STRUCT
  protected:
   std::vector<uint8_t> *m_buf;
@@ -133,6 +133,21 @@ struct EncChunk {
   uint8_t scale;                      // scale for decimals or timestamps
 };
 
+/**
+ * @brief Struct to describe the bloom filter of a row group of a column
+ **/
+struct BloomFilterChunk {
+  const uint32_t *valid_map_base;  // base ptr of input valid bit map
+  const void *column_data_base;    // base ptr of input column data (nvstrdesc_s for strings)
+  uint32_t start_row;              // start row of this chunk
+  uint32_t num_rows;               // number of rows in this chunk
+  uint32_t valid_rows;             // max number of valid rows
+  uint8_t type_kind;               // column data type (orc::TypeKind)
+  uint32_t num_hashes;             // number of hash functions of the filter
+  uint32_t num_bits;               // number of bits of the filter
+  uint32_t *words;                 // zero-initialized filter bitset
+};
+
 /**
  * @brief Struct to describe a column stream within a stripe
  **/
@@ -147,6 +162,10 @@ struct StripeStream {
   uint8_t pad[3];
 };
 
+// Number of registers of the HyperLogLog sketch estimating the distinct strings of a chunk
+constexpr uint32_t dict_hll_precision = 6;
+constexpr uint32_t dict_hll_registers = 1u << dict_hll_precision;
+
 /**
  * @brief Struct to describe a dictionary chunk
  **/
@@ -162,6 +181,7 @@ struct DictionaryChunk {
     string_char_count;  // total size of string data (NOTE: assumes less than 4G bytes per chunk)
   uint32_t num_dict_strings;  // number of strings in dictionary
   uint32_t dict_char_count;   // size of dictionary string data for this chunk
+  uint8_t hll_registers[dict_hll_registers];  // sketch of the distinct strings of this chunk
 };
 
 /**
@@ -401,18 +421,18 @@ cudaError_t BuildStripeDictionaries(StripeDictionary *stripes_dev,
  *
  * @param[out] groups Statistics groups (rowgroup-level)
  * @param[in] cols Column descriptors
+ * @param[in] chunks Column data chunks, holding the rows of each rowgroup
  * @param[in] num_columns Number of columns
  * @param[in] num_rowgroups Number of rowgroups
- * @param[in] row_index_stride Rowgroup size in rows
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
  **/
 cudaError_t orc_init_statistics_groups(statistics_group *groups,
                                        const stats_column_desc *cols,
+                                       const EncChunk *chunks,
                                        uint32_t num_columns,
                                        uint32_t num_rowgroups,
-                                       uint32_t row_index_stride,
                                        cudaStream_t stream = (cudaStream_t)0);
 
 /**
@@ -446,6 +466,21 @@ cudaError_t orc_encode_statistics(uint8_t *blob_bfr,
                                   uint32_t statistics_count,
                                   cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel to insert the values of row groups into their bloom filters
+ *
+ * Only BYTE, SHORT, INT, LONG, DATE, FLOAT, DOUBLE and STRING columns are supported.
+ *
+ * @param[in] chunks Bloom filters of the row groups
+ * @param[in] num_chunks Number of row groups
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t BuildBloomFilters(BloomFilterChunk const *chunks,
+                              uint32_t num_chunks,
+                              cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace gpu
 }  // namespace orc
 }  // namespace io
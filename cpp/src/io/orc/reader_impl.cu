@@ -19,20 +19,38 @@
  * @brief cuDF-IO ORC reader class implementation
  **/
 
+#include "bloom_filter.cuh"
 #include "reader_impl.hpp"
 #include "timezone.h"
 
-#include <io/comp/gpuinflate.h>
+#include <io/comp/gpu_decompressor.h>
+#include <io/statistics/stats_filter.hpp>
+#include <io/utilities/metadata_cache.hpp>
+#include <io/utilities/prefetching_source.hpp>
+#include <io/utilities/row_mask.hpp>
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/utilities/scratch_memory.cuh>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
 
 namespace cudf {
 namespace io {
@@ -72,8 +90,9 @@ constexpr type_id to_type_id(const orc::SchemaType &schema,
       // There isn't a (DAYS -> np.dtype) mapping
       return (use_np_dtypes) ? type_id::TIMESTAMP_MILLISECONDS : type_id::TIMESTAMP_DAYS;
     case orc::DECIMAL:
-      // There isn't an arbitrary-precision type in cuDF, so map as float or int
-      return (decimals_as_float) ? type_id::FLOAT64 : type_id::INT64;
+      // There isn't an arbitrary-precision type in cuDF, so map as float or 64-bit fixed-point
+      return (decimals_as_float) ? type_id::FLOAT64 : type_id::DECIMAL64;
+    case orc::STRUCT: return type_id::STRUCT;
     default: break;
   }
 
@@ -95,7 +114,7 @@ constexpr int32_t to_clockrate(type_id timestamp_type_id)
 }
 
 constexpr std::pair<gpu::StreamIndexType, uint32_t> get_index_type_and_pos(
-  const orc::StreamKind kind, uint32_t skip_count, bool non_child)
+  const orc::StreamKind kind, uint32_t skip_count)
 {
   switch (kind) {
     case orc::DATA:
@@ -109,7 +128,7 @@ constexpr std::pair<gpu::StreamIndexType, uint32_t> get_index_type_and_pos(
       return std::make_pair(gpu::CI_DATA2, skip_count);
     case orc::DICTIONARY_DATA: return std::make_pair(gpu::CI_DICTIONARY, skip_count);
     case orc::PRESENT:
-      skip_count += (non_child ? 1 : 0);
+      skip_count += 1;
       return std::make_pair(gpu::CI_PRESENT, skip_count);
     case orc::ROW_INDEX: return std::make_pair(gpu::CI_INDEX, skip_count);
     default:
@@ -118,6 +137,95 @@ constexpr std::pair<gpu::StreamIndexType, uint32_t> get_index_type_and_pos(
   }
 }
 
+/**
+ * @brief Converts the decoded statistics of a column into a host-side value range
+ *
+ * @param stats Column statistics decoded from the file
+ * @param num_rows Number of rows the statistics cover
+ *
+ * @return Value range usable by the statistics filter
+ **/
+column_value_range to_value_range(const orc::ColumnStatisticsSummary &stats, uint64_t num_rows)
+{
+  using kind = column_value_range::value_kind;
+  column_value_range range;
+  // `numberOfValues` only counts the non-null values
+  range.all_nulls = stats.has_number_of_values && stats.numberOfValues == 0 && num_rows > 0;
+  switch (stats.kind) {
+    case orc::ColumnStatisticsSummary::MINMAX_INT:
+      range.kind  = kind::SIGNED;
+      range.i_min = stats.int_min;
+      range.i_max = stats.int_max;
+      break;
+    case orc::ColumnStatisticsSummary::MINMAX_DOUBLE:
+      range.kind  = kind::FLOAT;
+      range.f_min = stats.double_min;
+      range.f_max = stats.double_max;
+      break;
+    case orc::ColumnStatisticsSummary::MINMAX_STRING:
+      range.kind  = kind::STRING;
+      range.s_min = stats.string_min;
+      range.s_max = stats.string_max;
+      break;
+    default: break;
+  }
+  return range;
+}
+
+/**
+ * @brief Returns the bloom filter hash of an equality literal for a column
+ *
+ * @param filter Equality comparison
+ * @param kind ORC type of the column
+ * @param[out] hash Hash of the literal, as a value of the column
+ *
+ * @return `false` if the literal has no hash for this column, e.g. a float literal for an integer
+ * column, in which case the bloom filters cannot be used
+ **/
+bool literal_hash(stats_filter const &filter, orc::TypeKind kind, uint64_t *hash)
+{
+  using literal_kind = stats_filter::literal_kind;
+  auto const lit     = filter.get_literal_kind();
+  switch (kind) {
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG:
+    case orc::DATE:
+      if (lit != literal_kind::INTEGER) { return false; }
+      *hash = bloom_filter_hash_long(filter.int_value());
+      return true;
+    case orc::FLOAT:
+    case orc::DOUBLE: {
+      if (lit == literal_kind::STRING) { return false; }
+      auto const v = filter.int_value();
+      auto const d = (lit == literal_kind::INTEGER) ? static_cast<double>(v) : filter.float_value();
+      if (std::isnan(d) || d == 0) { return false; }
+      // Integers beyond 2^53 may not convert exactly
+      constexpr int64_t max_exact_int = int64_t{1} << 53;
+      if (lit == literal_kind::INTEGER && (v > max_exact_int || v < -max_exact_int)) {
+        return false;
+      }
+      // Float values are inserted as doubles; other doubles cannot be in the column
+      if (kind == orc::FLOAT && static_cast<double>(static_cast<float>(d)) != d) { return false; }
+      int64_t bits;
+      std::memcpy(&bits, &d, sizeof(bits));
+      *hash = bloom_filter_hash_long(bits);
+      return true;
+    }
+    case orc::STRING:
+    case orc::VARCHAR:
+    case orc::CHAR: {
+      if (lit != literal_kind::STRING) { return false; }
+      auto const &str = filter.string_value();
+      *hash           = bloom_filter_hash_bytes(reinterpret_cast<uint8_t const *>(str.data()),
+                                                static_cast<uint32_t>(str.size()));
+      return true;
+    }
+    default: return false;
+  }
+}
+
 }  // namespace
 
 /**
@@ -127,9 +235,42 @@ constexpr std::pair<gpu::StreamIndexType, uint32_t> get_index_type_and_pos(
 class metadata {
   using OrcStripeInfo = std::pair<const StripeInformation *, const StripeFooter *>;
 
+  /**
+   * @brief Parsed file-level metadata, as held by the metadata cache
+   **/
+  struct cached_footer {
+    PostScript ps;
+    FileFooter ff;
+    Metadata md;
+    bool stripe_stats_read  = false;
+    size_t stripe_stats_end = 0;
+    size_t size             = 0;  ///< Uncompressed size of the postscript, footer and statistics
+  };
+
  public:
-  explicit metadata(datasource *const src) : source(src)
+  /**
+   * @brief Reads the postscript and the file footer, or copies them from the metadata cache
+   *
+   * @param src Dataset source
+   * @param cache_key Metadata cache key of the source; empty to bypass the cache
+   **/
+  explicit metadata(datasource *const src, std::string cache_key = {})
+    : source(src), cache_key(std::move(cache_key))
   {
+    if (!this->cache_key.empty()) {
+      auto const cached = metadata_cache<cached_footer>::instance().get(this->cache_key);
+      if (cached != nullptr) {
+        ps                = cached->ps;
+        ff                = cached->ff;
+        md                = cached->md;
+        stripe_stats_read = cached->stripe_stats_read;
+        stripe_stats_end  = cached->stripe_stats_end;
+        cached_size       = cached->size;
+        decompressor = std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize);
+        return;
+      }
+    }
+
     const auto len         = source->size();
     const auto max_ps_size = std::min(len, static_cast<size_t>(256));
 
@@ -153,6 +294,142 @@ class metadata {
     pb.init(ff_data, ff_length);
     CUDF_EXPECTS(pb.read(&ff, ff_length), "Cannot read filefooter");
     CUDF_EXPECTS(get_num_columns() > 0, "No columns found");
+
+    // The stripe statistics precede the filefooter; they are only read if a filter needs them
+    stripe_stats_end = len - ps_length - 1 - ps.footerLength;
+    cached_size      = ps_length + ff_length;
+    update_cache();
+  }
+
+  /**
+   * @brief Reads and decodes the per-stripe column statistics, if not already done
+   **/
+  void read_stripe_statistics()
+  {
+    if (stripe_stats_read) { return; }
+    stripe_stats_read = true;
+    if (ps.metadataLength == 0) { return; }
+    CUDF_EXPECTS(ps.metadataLength <= stripe_stats_end, "Invalid metadata length");
+
+    const auto buffer =
+      source->host_read(stripe_stats_end - ps.metadataLength, ps.metadataLength);
+    size_t md_length  = 0;
+    auto md_data      = decompressor->Decompress(buffer->data(), ps.metadataLength, &md_length);
+    ProtobufReader pb;
+    pb.init(md_data, md_length);
+    CUDF_EXPECTS(pb.read(&md, md_length), "Cannot read stripe statistics");
+    cached_size += md_length;
+    update_cache();
+  }
+
+  /**
+   * @brief Stores the parsed file-level metadata in the metadata cache, if the source has a key
+   **/
+  void update_cache() const
+  {
+    if (cache_key.empty()) { return; }
+    auto entry               = std::make_shared<cached_footer>();
+    entry->ps                = ps;
+    entry->ff                = ff;
+    entry->md                = md;
+    entry->stripe_stats_read = stripe_stats_read;
+    entry->stripe_stats_end  = stripe_stats_end;
+    entry->size              = cached_size;
+    metadata_cache<cached_footer>::instance().put(cache_key, std::move(entry), cached_size);
+  }
+
+  /**
+   * @brief Returns whether any row of the stripe can satisfy the filter, based on the stripe's
+   * column statistics
+   *
+   * @param filter Filter expression to evaluate
+   * @param stripe_idx Index of the stripe in the file
+   *
+   * @return `false` if the statistics show that no row of the stripe matches, `true` otherwise
+   **/
+  bool stripe_may_match(stats_filter const &filter, size_t stripe_idx)
+  {
+    read_stripe_statistics();
+    auto lookup = [&](std::string const &name) {
+      int col_id = -1;
+      for (int i = 0; i < get_num_columns() && col_id < 0; ++i) {
+        if (ff.GetColumnName(i) == name) { col_id = i; }
+      }
+      CUDF_EXPECTS(col_id >= 0, "Filter column not found: " + name);
+
+      ColumnStatisticsSummary stats;
+      if (stripe_idx < md.stripeStats.size() &&
+          static_cast<size_t>(col_id) < md.stripeStats[stripe_idx].colStats.size()) {
+        const auto &blob = md.stripeStats[stripe_idx].colStats[col_id];
+        ProtobufReader pb(blob.data(), blob.size());
+        if (!pb.read(&stats, blob.size())) { stats = ColumnStatisticsSummary{}; }
+      }
+      auto range        = to_value_range(stats, ff.stripes[stripe_idx].numberOfRows);
+      range.may_contain = [this, stripe_idx, col_id](stats_filter const &eq) {
+        return bloom_filters_may_contain(stripe_idx, col_id, eq);
+      };
+      return range;
+    };
+    return stats_filter_may_match(filter, lookup);
+  }
+
+  /**
+   * @brief Returns whether the bloom filters of a column of a stripe may contain a filter literal
+   *
+   * The stripe footer and the BLOOM_FILTER_UTF8 stream of the column are read from the source;
+   * columns without filters may contain any value.
+   *
+   * @param stripe_idx Index of the stripe in the file
+   * @param col_id Index of the column
+   * @param filter Equality comparison
+   **/
+  bool bloom_filters_may_contain(size_t stripe_idx, int col_id, stats_filter const &filter)
+  {
+    uint64_t hash = 0;
+    if (!literal_hash(filter, ff.types[col_id].kind, &hash)) { return true; }
+
+    StripeFooter sf;
+    read_stripe_footer(ff.stripes[stripe_idx], &sf);
+    uint64_t stream_offset = ff.stripes[stripe_idx].offset;
+    for (const auto &stream : sf.streams) {
+      if (stream.kind == BLOOM_FILTER_UTF8 && stream.column == static_cast<uint32_t>(col_id)) {
+        CUDF_EXPECTS(stream_offset + stream.length <= source->size(), "Invalid stream length");
+        const auto buffer = source->host_read(stream_offset, stream.length);
+        size_t length     = 0;
+        auto data         = decompressor->Decompress(buffer->data(), stream.length, &length);
+        BloomFilterIndex index;
+        ProtobufReader pb(data, length);
+        if (!pb.read(&index, length)) { return true; }
+        return std::any_of(
+          index.bloomFilter.begin(), index.bloomFilter.end(), [&](BloomFilter const &bf) {
+            return bloom_filter_may_contain(reinterpret_cast<uint8_t const *>(bf.utf8bitset.data()),
+                                            bf.utf8bitset.size(),
+                                            bf.numHashFunctions,
+                                            hash);
+          });
+      }
+      stream_offset += stream.length;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Reads and decodes the footer of a stripe
+   *
+   * @param stripe Stripe information from the file footer
+   * @param[out] sf Decoded stripe footer
+   **/
+  void read_stripe_footer(const StripeInformation &stripe, StripeFooter *sf)
+  {
+    const auto sf_comp_offset = stripe.offset + stripe.indexLength + stripe.dataLength;
+    const auto sf_comp_length = stripe.footerLength;
+    CUDF_EXPECTS(sf_comp_offset + sf_comp_length < source->size(), "Invalid stripe information");
+
+    const auto buffer = source->host_read(sf_comp_offset, sf_comp_length);
+    size_t sf_length  = 0;
+    auto sf_data      = decompressor->Decompress(buffer->data(), sf_comp_length, &sf_length);
+    ProtobufReader pb(sf_data, sf_length);
+    CUDF_EXPECTS(pb.read(sf, sf_length), "Cannot read stripefooter");
   }
 
   /**
@@ -163,6 +440,8 @@ class metadata {
    * @param[in] stripe_indices Indices of individual stripes [max_stripe_count]
    * @param[in] row_start Starting row of the selection
    * @param[in,out] row_count Total number of rows selected
+   * @param[in] filter Stripes whose statistics show that no row satisfies it are skipped
+   * @param[out] num_skipped Number of stripes skipped by the filter, if not null
    *
    * @return List of stripe info and total number of selected rows
    **/
@@ -170,7 +449,9 @@ class metadata {
                       size_type max_stripe_count,
                       const size_type *stripe_indices,
                       size_type &row_start,
-                      size_type &row_count)
+                      size_type &row_count,
+                      stats_filter const &filter,
+                      size_t *num_skipped = nullptr)
   {
     std::vector<OrcStripeInfo> selection;
 
@@ -217,23 +498,27 @@ class metadata {
       row_start = stripe_skip_rows;
     }
 
+    // Skip stripes that cannot contain rows satisfying the filter, before reading their data
+    if (not filter.empty()) {
+      auto const num_candidates = selection.size();
+      selection.erase(std::remove_if(selection.begin(),
+                                     selection.end(),
+                                     [&](const OrcStripeInfo &info) {
+                                       return !stripe_may_match(filter,
+                                                                info.first - ff.stripes.data());
+                                     }),
+                      selection.end());
+      size_t stripe_rows = 0;
+      for (const auto &info : selection) { stripe_rows += info.first->numberOfRows; }
+      row_count = static_cast<size_type>(stripe_rows);
+      if (num_skipped != nullptr) { *num_skipped = num_candidates - selection.size(); }
+    }
+
     // Read each stripe's stripefooter metadata
     if (not selection.empty()) {
-      orc::ProtobufReader pb;
-
       stripefooters.resize(selection.size());
       for (size_t i = 0; i < selection.size(); ++i) {
-        const auto stripe         = selection[i].first;
-        const auto sf_comp_offset = stripe->offset + stripe->indexLength + stripe->dataLength;
-        const auto sf_comp_length = stripe->footerLength;
-        CUDF_EXPECTS(sf_comp_offset + sf_comp_length < source->size(),
-                     "Invalid stripe information");
-
-        const auto buffer = source->host_read(sf_comp_offset, sf_comp_length);
-        size_t sf_length  = 0;
-        auto sf_data      = decompressor->Decompress(buffer->data(), sf_comp_length, &sf_length);
-        pb.init(sf_data, sf_length);
-        CUDF_EXPECTS(pb.read(&stripefooters[i], sf_length), "Cannot read stripefooter");
+        read_stripe_footer(*selection[i].first, &stripefooters[i]);
         selection[i].second = &stripefooters[i];
       }
     }
@@ -244,12 +529,14 @@ class metadata {
   /**
    * @brief Filters and reduces down to a selection of columns
    *
+   * A struct column, or one of its fields by its dotted path, can be selected by name. By default,
+   * the top-level columns are selected, except that the leaves of other nested types are read.
+   *
    * @param[in] use_names List of column names to select
-   * @param[out] has_timestamp_column Whether there is a orc::TIMESTAMP column
    *
    * @return List of ORC column indexes
    **/
-  auto select_columns(std::vector<std::string> use_names, bool &has_timestamp_column)
+  auto select_columns(std::vector<std::string> use_names)
   {
     std::vector<int> selection;
 
@@ -260,18 +547,19 @@ class metadata {
           if (index >= get_num_columns()) { index = 0; }
           if (ff.GetColumnName(index) == use_name) {
             selection.emplace_back(index);
-            if (ff.types[index].kind == orc::TIMESTAMP) { has_timestamp_column = true; }
             index++;
             break;
           }
         }
       }
+    } else if (ff.types[0].kind != orc::STRUCT) {
+      selection.emplace_back(0);
     } else {
-      // For now, only select all leaf nodes
-      for (int i = 0; i < get_num_columns(); ++i) {
-        if (ff.types[i].subtypes.size() == 0) {
+      for (int i = 1; i < get_num_columns(); ++i) {
+        auto top = i;
+        while (ff.types[top].parent_idx != 0) { top = ff.types[top].parent_idx; }
+        if (is_struct_tree(top) ? (i == top) : ff.types[i].subtypes.empty()) {
           selection.emplace_back(i);
-          if (ff.types[i].kind == orc::TIMESTAMP) { has_timestamp_column = true; }
         }
       }
     }
@@ -280,6 +568,54 @@ class metadata {
     return selection;
   }
 
+  /**
+   * @brief Returns the selected columns, followed by the ancestors and descendants of the
+   * selected columns, which are decoded to assemble the struct columns
+   *
+   * @param[in] selection List of selected ORC column indexes
+   * @param[out] has_timestamp_column Whether there is a orc::TIMESTAMP column
+   *
+   * @return List of ORC column indexes
+   **/
+  auto get_decoded_columns(std::vector<int> const &selection, bool &has_timestamp_column)
+  {
+    std::vector<bool> is_decoded(get_num_columns(), false);
+    for (auto const col : selection) {
+      for (auto idx = ff.types[col].parent_idx; idx != 0; idx = ff.types[idx].parent_idx) {
+        is_decoded[idx] = true;
+      }
+      std::vector<int> subtree{col};
+      while (!subtree.empty()) {
+        auto const idx = subtree.back();
+        subtree.pop_back();
+        is_decoded[idx] = true;
+        for (auto const child : ff.types[idx].subtypes) { subtree.push_back(child); }
+      }
+    }
+
+    auto decoded = selection;
+    for (auto const col : selection) { is_decoded[col] = false; }
+    for (int i = 0; i < get_num_columns(); ++i) {
+      if (is_decoded[i]) { decoded.push_back(i); }
+    }
+    for (auto const col : decoded) {
+      if (ff.types[col].kind == orc::TIMESTAMP) { has_timestamp_column = true; }
+    }
+    return decoded;
+  }
+
+  /**
+   * @brief Returns whether a column and its descendants are only structs and leaves
+   **/
+  bool is_struct_tree(int col) const
+  {
+    if (ff.types[col].subtypes.empty()) { return true; }
+    if (ff.types[col].kind != orc::STRUCT) { return false; }
+    return std::all_of(ff.types[col].subtypes.cbegin(),
+                       ff.types[col].subtypes.cend(),
+                       [&](uint32_t child) { return is_struct_tree(child); });
+  }
+
   inline size_t get_total_rows() const { return ff.numberOfRows; }
   inline int get_num_stripes() const { return ff.stripes.size(); }
   inline int get_num_columns() const { return ff.types.size(); }
@@ -288,11 +624,16 @@ class metadata {
  public:
   PostScript ps;
   FileFooter ff;
+  Metadata md;
   std::vector<StripeFooter> stripefooters;
   std::unique_ptr<OrcDecompressor> decompressor;
 
  private:
   datasource *const source;
+  std::string const cache_key;
+  size_t stripe_stats_end = 0;
+  bool stripe_stats_read  = false;
+  size_t cached_size      = 0;
 };
 
 namespace {
@@ -325,7 +666,6 @@ size_t gather_stream_info(const size_t stripe_index,
                           const orc::StripeFooter *stripefooter,
                           const std::vector<int> &orc2gdf,
                           const std::vector<int> &gdf2orc,
-                          const std::vector<orc::SchemaType> types,
                           bool use_index,
                           size_t *num_dictionary_entries,
                           hostdevice_vector<gpu::ColumnDesc> &chunks,
@@ -335,37 +675,23 @@ size_t gather_stream_info(const size_t stripe_index,
   uint64_t src_offset    = 0;
   uint64_t dst_offset    = 0;
   for (const auto &stream : stripefooter->streams) {
+    // Bloom filters are only used to select the stripes
+    if (stream.kind == orc::BLOOM_FILTER || stream.kind == orc::BLOOM_FILTER_UTF8) {
+      src_offset += stream.length;
+      continue;
+    }
     if (stream.column >= orc2gdf.size()) {
       dst_offset += stream.length;
       continue;
     }
 
+    // Struct columns are decoded as columns of their own, with only a PRESENT stream
     auto col = orc2gdf[stream.column];
-    if (col == -1) {
-      // A struct-type column has no data itself, but rather child columns
-      // for each of its fields. There is only a PRESENT stream, which
-      // needs to be included for the reader.
-      const auto schema_type = types[stream.column];
-      if (schema_type.subtypes.size() != 0) {
-        if (schema_type.kind == orc::STRUCT && stream.kind == orc::PRESENT) {
-          for (const auto &idx : schema_type.subtypes) {
-            auto child_idx = (idx < orc2gdf.size()) ? orc2gdf[idx] : -1;
-            if (child_idx >= 0) {
-              col                             = child_idx;
-              auto &chunk                     = chunks[stripe_index * num_columns + col];
-              chunk.strm_id[gpu::CI_PRESENT]  = stream_info.size();
-              chunk.strm_len[gpu::CI_PRESENT] = stream.length;
-            }
-          }
-        }
-      }
-    }
     if (col != -1) {
       if (src_offset >= stripeinfo->indexLength || use_index) {
         // NOTE: skip_count field is temporarily used to track index ordering
         auto &chunk = chunks[stripe_index * num_columns + col];
-        const auto idx =
-          get_index_type_and_pos(stream.kind, chunk.skip_count, col == orc2gdf[stream.column]);
+        const auto idx = get_index_type_and_pos(stream.kind, chunk.skip_count);
         if (idx.first < gpu::CI_NUM_STREAMS) {
           chunk.strm_id[idx.first]  = stream_info.size();
           chunk.strm_len[idx.first] = stream.length;
@@ -388,6 +714,102 @@ size_t gather_stream_info(const size_t stripe_index,
   return dst_offset;
 }
 
+struct is_valid_row {
+  bitmask_type const *valid;
+
+  __device__ size_type operator()(size_type row) const { return bit_is_set(valid, row) ? 1 : 0; }
+};
+
+struct field_row {
+  bitmask_type const *valid;
+  size_type num_values;
+
+  __device__ size_type operator()(size_type row, size_type value) const
+  {
+    return bit_is_set(valid, row) ? value : num_values;
+  }
+};
+
+/**
+ * @brief Gathers rows of a column, the rows mapped out of bounds being null
+ */
+std::unique_ptr<column> gather_column(column_view const &input,
+                                      rmm::device_vector<size_type> const &gather_map,
+                                      cudaStream_t stream,
+                                      rmm::mr::device_memory_resource *mr)
+{
+  column_view const gather_map_view(data_type{type_id::INT32},
+                                    static_cast<size_type>(gather_map.size()),
+                                    gather_map.data().get());
+  return std::move(cudf::detail::gather(table_view{{input}},
+                                        gather_map_view,
+                                        cudf::detail::out_of_bounds_policy::NULLIFY,
+                                        cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                        mr,
+                                        stream)
+                     ->release()[0]);
+}
+
+/**
+ * @brief Expands the values of a struct field to the rows of its struct
+ *
+ * The field holds one value per valid row of the struct, and is null in the null rows.
+ *
+ * @param field Values of the field
+ * @param valid Null mask of the struct
+ * @param num_rows Number of rows of the struct
+ * @param null_count Number of null rows of the struct
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> expand_field(std::unique_ptr<column> field,
+                                     bitmask_type const *valid,
+                                     size_type num_rows,
+                                     size_type null_count,
+                                     cudaStream_t stream,
+                                     rmm::mr::device_memory_resource *mr)
+{
+  if (null_count == 0) { return field; }
+
+  auto execpol    = cudf::detail::scratch_policy(stream);
+  auto const row  = thrust::make_counting_iterator<size_type>(0);
+  auto gather_map = cudf::detail::make_scratch_vector<size_type>(num_rows, 0, stream);
+  thrust::transform_exclusive_scan(execpol->on(stream),
+                                   row,
+                                   row + num_rows,
+                                   gather_map.begin(),
+                                   is_valid_row{valid},
+                                   0,
+                                   thrust::plus<size_type>());
+  thrust::transform(execpol->on(stream),
+                    row,
+                    row + num_rows,
+                    gather_map.begin(),
+                    gather_map.begin(),
+                    field_row{valid, field->size()});
+  return gather_column(field->view(), gather_map, stream, mr);
+}
+
+/**
+ * @brief Creates an empty decoded column, with the decoded fields of struct columns
+ */
+std::unique_ptr<column> make_empty_decoded_column(std::vector<orc::SchemaType> const &types,
+                                                  std::vector<int> const &decoded_columns,
+                                                  std::vector<data_type> const &column_types,
+                                                  size_t idx)
+{
+  if (column_types[idx].id() != type_id::STRUCT) { return make_empty_column(column_types[idx]); }
+  std::vector<std::unique_ptr<column>> fields;
+  for (auto const child : types[decoded_columns[idx]].subtypes) {
+    auto const it = std::find(decoded_columns.cbegin(), decoded_columns.cend(), child);
+    if (it != decoded_columns.cend()) {
+      fields.push_back(make_empty_decoded_column(
+        types, decoded_columns, column_types, it - decoded_columns.cbegin()));
+    }
+  }
+  return make_structs_column(0, std::move(fields), 0, rmm::device_buffer{});
+}
+
 }  // namespace
 
 rmm::device_buffer reader::impl::decompress_stripe_data(
@@ -428,17 +850,20 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
   size_t num_compressed_blocks   = 0;
   size_t num_uncompressed_blocks = 0;
   size_t total_decomp_size       = 0;
+  size_t total_comp_size         = 0;
   for (size_t i = 0; i < compinfo.size(); ++i) {
+    total_comp_size += stream_info[i].length;
     num_compressed_blocks += compinfo[i].num_compressed_blocks;
     num_uncompressed_blocks += compinfo[i].num_uncompressed_blocks;
     total_decomp_size += compinfo[i].max_uncompressed_size;
   }
   CUDF_EXPECTS(total_decomp_size > 0, "No decompressible data found");
 
-  rmm::device_buffer decomp_data(total_decomp_size, stream);
-  rmm::device_vector<gpu_inflate_input_s> inflate_in(num_compressed_blocks +
-                                                     num_uncompressed_blocks);
-  rmm::device_vector<gpu_inflate_status_s> inflate_out(num_compressed_blocks);
+  rmm::device_buffer decomp_data(total_decomp_size, stream, get_scratch_resource());
+  auto inflate_in = cudf::detail::make_scratch_vector<gpu_inflate_input_s>(
+    num_compressed_blocks + num_uncompressed_blocks, {}, stream);
+  auto inflate_out =
+    cudf::detail::make_scratch_vector<gpu_inflate_status_s>(num_compressed_blocks, {}, stream);
 
   // Parse again to populate the decompression input/output buffers
   size_t decomp_offset      = 0;
@@ -467,19 +892,21 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
                                           decompressor->GetLog2MaxCompressionRatio(),
                                           stream));
 
-  // Dispatch batches of blocks to decompress
+  // Dispatch batches of blocks to decompress; their sizes are only known in device memory
   if (num_compressed_blocks > 0) {
+    gpu_codec codec = gpu_codec::NUM_CODECS;
     switch (decompressor->GetKind()) {
-      case orc::ZLIB:
-        CUDA_TRY(gpuinflate(
-          inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, 0, stream));
-        break;
-      case orc::SNAPPY:
-        CUDA_TRY(gpu_unsnap(
-          inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, stream));
-        break;
+      case orc::ZLIB: codec = gpu_codec::INFLATE; break;
+      case orc::SNAPPY: codec = gpu_codec::SNAPPY; break;
       default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
     }
+    _decompressor.decompress_async(codec,
+                                   inflate_in.data().get(),
+                                   inflate_out.data().get(),
+                                   num_compressed_blocks,
+                                   total_comp_size,
+                                   total_decomp_size,
+                                   stream);
   }
   if (num_uncompressed_blocks > 0) {
     CUDA_TRY(gpu_copy_uncompressed_blocks(
@@ -555,7 +982,7 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
   }
 
   // Allocate global dictionary for deserializing
-  rmm::device_vector<gpu::DictionaryEntry> global_dict(num_dicts);
+  auto global_dict = cudf::detail::make_scratch_vector<gpu::DictionaryEntry>(num_dicts, {}, stream);
 
   // Allocate timezone transition table timestamp conversion
   rmm::device_vector<int64_t> tz_table = timezone_table;
@@ -594,14 +1021,27 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
 
 reader::impl::impl(std::unique_ptr<datasource> source,
                    reader_options const &options,
-                   rmm::mr::device_memory_resource *mr)
+                   rmm::mr::device_memory_resource *mr,
+                   std::string const &cache_key)
   : _source(std::move(source)), _mr(mr)
 {
+  // Count the reads of the source, including the metadata, if the metrics are requested
+  if (options.collect_metrics) {
+    auto metered    = std::make_unique<metered_source>(std::move(_source));
+    _metered_source = metered.get();
+    _source         = std::move(metered);
+  }
+
   // Open and parse the source dataset metadata
-  _metadata = std::make_unique<metadata>(_source.get());
+  _metadata = std::make_unique<metadata>(_source.get(), cache_key);
 
   // Select only columns required by the options
-  _selected_columns = _metadata->select_columns(options.columns, _has_timestamp_column);
+  _selected_columns = _metadata->select_columns(options.columns);
+  _decoded_columns  = _metadata->get_decoded_columns(_selected_columns, _has_timestamp_column);
+  _has_struct_column =
+    std::any_of(_decoded_columns.cbegin(), _decoded_columns.cend(), [&](int col) {
+      return _metadata->ff.types[col].kind == orc::STRUCT;
+    });
 
   // Override output timestamp resolution if requested
   if (options.timestamp_type.id() != type_id::EMPTY) { _timestamp_type = options.timestamp_type; }
@@ -612,9 +1052,18 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   // Enable or disable the conversion to numpy-compatible dtypes
   _use_np_dtypes = options.use_np_dtypes;
 
-  // Control decimals conversion (float64 or int64 with optional scale)
+  // Control decimals conversion (float64 or decimal64 with optional scale)
   _decimals_as_float     = options.decimals_as_float;
   _decimals_as_int_scale = options.forced_decimals_scale;
+
+  // Stripes excluded by their statistics are skipped before reading any data
+  _filter = options.filter;
+
+  // Only the stripes holding rows selected by the mask are decoded
+  if (has_row_mask(options.row_mask)) {
+    CUDF_EXPECTS(_filter.empty(), "A row mask cannot be combined with a statistics filter");
+    _row_mask = options.row_mask;
+  }
 }
 
 table_with_metadata reader::impl::read(size_type skip_rows,
@@ -624,197 +1073,365 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                        const size_type *stripe_indices,
                                        cudaStream_t stream)
 {
-  std::vector<std::unique_ptr<column>> out_columns;
-  table_metadata out_metadata;
+  if (has_row_mask(_row_mask)) {
+    return read_with_row_mask(
+      skip_rows, num_rows, stripe, max_stripe_count, stripe_indices, stream);
+  }
+  return read_selection(skip_rows, num_rows, stripe, max_stripe_count, stripe_indices, stream);
+}
 
-  // Select only stripes required (aka row groups)
-  const auto selected_stripes =
-    _metadata->select_stripes(stripe, max_stripe_count, stripe_indices, skip_rows, num_rows);
+table_with_metadata reader::impl::read_with_row_mask(size_type skip_rows,
+                                                     size_type num_rows,
+                                                     size_type stripe,
+                                                     size_type max_stripe_count,
+                                                     const size_type *stripe_indices,
+                                                     cudaStream_t stream)
+{
+  // The mask covers the rows that the same read without mask returns
+  auto row_start       = skip_rows;
+  auto row_count       = num_rows;
+  auto const selection = _metadata->select_stripes(
+    stripe, max_stripe_count, stripe_indices, row_start, row_count, stats_filter{});
+  int64_t selection_rows = 0;
+  for (auto const &info : selection) { selection_rows += info.first->numberOfRows; }
+  auto const mask_size = std::min<int64_t>(row_count, selection_rows - row_start);
+  CUDF_EXPECTS(_row_mask.size() == mask_size, "Row mask size must match the number of rows read");
+  auto const selected = row_mask_to_host(_row_mask, stream);
+
+  // Stripes are decoded in full, so keep the stripes holding any selected row
+  std::vector<size_type> kept_stripes;
+  std::vector<size_type> gather_map;
+  int64_t mask_row  = -row_start;  // Mask position of the first row of the stripe
+  size_type out_row = 0;
+  for (auto const &info : selection) {
+    int64_t const stripe_rows = info.first->numberOfRows;
+    auto const begin          = std::max<int64_t>(mask_row, 0);
+    auto const end            = std::min<int64_t>(mask_row + stripe_rows, mask_size);
+    auto const first          = selected.begin() + std::min(begin, end);
+    if (std::any_of(first, selected.begin() + end, [](uint8_t s) { return s != 0; })) {
+      kept_stripes.push_back(static_cast<size_type>(info.first - _metadata->ff.stripes.data()));
+      for (auto row = begin; row < end; ++row) {
+        if (selected[row]) {
+          gather_map.push_back(static_cast<size_type>(out_row + row - mask_row));
+        }
+      }
+      out_row += stripe_rows;
+    }
+    mask_row += stripe_rows;
+  }
 
-  // Association between each ORC column and its cudf::column
-  std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
+  // An empty stripe list still selects stripes by index, and returns no rows
+  size_type const no_stripe = 0;
+  auto result               = read_selection(0,
+                               -1,
+                               -1,
+                               static_cast<size_type>(kept_stripes.size()),
+                               kept_stripes.empty() ? &no_stripe : kept_stripes.data(),
+                               stream);
+  if (gather_map.size() != static_cast<size_t>(result.tbl->num_rows())) {
+    result.tbl = gather_rows(result.tbl->view(), gather_map, _mr, stream);
+  }
+  return result;
+}
 
-  // Get a list of column data types
+/**
+ * @brief Stream data of the stripes of a read, in device memory and decompressed
+ **/
+struct loaded_stripes {
   std::vector<data_type> column_types;
-  for (const auto &col : _selected_columns) {
+  std::vector<const StripeInformation *> stripes;
+  // Copies of the stripe footers, so that the next batch can be selected meanwhile
+  std::vector<StripeFooter> footers;
+  size_t num_skipped_stripes = 0;
+  size_type skip_rows        = 0;
+  size_type num_rows         = 0;
+  size_t num_dict_entries    = 0;
+  size_t stripe_data_size    = 0;
+  hostdevice_vector<gpu::ColumnDesc> chunks{0};
+  std::vector<rmm::device_buffer> stripe_data;
+  std::unique_ptr<rmm::device_vector<gpu::RowGroup>> row_groups;
+};
+
+reader::impl::~impl()
+{
+  if (_next_load.valid()) { _next_load.wait(); }
+  if (_load_stream != 0) { cudaStreamDestroy(_load_stream); }
+}
+
+std::vector<data_type> reader::impl::get_column_types(std::vector<int32_t> &orc_col_map) const
+{
+  orc_col_map.assign(_metadata->get_num_columns(), -1);
+  std::vector<data_type> column_types;
+  for (const auto &col : _decoded_columns) {
     auto col_type = to_type_id(
       _metadata->ff.types[col], _use_np_dtypes, _timestamp_type.id(), _decimals_as_float);
     CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-    column_types.emplace_back(col_type);
+    if (col_type == type_id::DECIMAL64) {
+      // Decimals are decoded to integers with `decimal_scale` fractional digits
+      auto const num_digits = (_decimals_as_int_scale < 0)
+                                ? static_cast<int32_t>(_metadata->ff.types[col].scale)
+                                : _decimals_as_int_scale;
+      column_types.emplace_back(col_type, -num_digits);
+    } else {
+      column_types.emplace_back(col_type);
+    }
 
     // Map each ORC column to its column
     orc_col_map[col] = column_types.size() - 1;
   }
+  return column_types;
+}
 
-  // If no rows or stripes to read, return empty columns
-  if (num_rows <= 0 || selected_stripes.size() == 0) {
-    std::transform(column_types.cbegin(),
-                   column_types.cend(),
-                   std::back_inserter(out_columns),
-                   [](auto const &dtype) { return make_empty_column(dtype); });
-  } else {
-    const auto num_columns = _selected_columns.size();
-    const auto num_chunks  = selected_stripes.size() * num_columns;
-    hostdevice_vector<gpu::ColumnDesc> chunks(num_chunks, stream);
-    memset(chunks.host_ptr(), 0, chunks.memory_size());
-
-    const bool use_index =
-      (_use_index == true) &&
-      // Only use if we don't have much work with complete columns & stripes
-      // TODO: Consider nrows, gpu, and tune the threshold
-      (num_rows > _metadata->get_row_index_stride() && !(_metadata->get_row_index_stride() & 7) &&
-       _metadata->get_row_index_stride() > 0 && num_columns * selected_stripes.size() < 8 * 128) &&
-      // Only use if first row is aligned to a stripe boundary
-      // TODO: Fix logic to handle unaligned rows
-      (skip_rows == 0);
-
-    // Logically view streams as columns
-    std::vector<orc_stream_info> stream_info;
-
-    // Tracker for eventually deallocating compressed and uncompressed data
-    std::vector<rmm::device_buffer> stripe_data;
-
-    size_t stripe_start_row = 0;
-    size_t num_dict_entries = 0;
-    size_t num_rowgroups    = 0;
-    for (size_t i = 0; i < selected_stripes.size(); ++i) {
-      const auto stripe_info   = selected_stripes[i].first;
-      const auto stripe_footer = selected_stripes[i].second;
-
-      auto stream_count          = stream_info.size();
-      const auto total_data_size = gather_stream_info(i,
-                                                      stripe_info,
-                                                      stripe_footer,
-                                                      orc_col_map,
-                                                      _selected_columns,
-                                                      _metadata->ff.types,
-                                                      use_index,
-                                                      &num_dict_entries,
-                                                      chunks,
-                                                      stream_info);
-      CUDF_EXPECTS(total_data_size > 0, "Expected streams data within stripe");
-
-      stripe_data.emplace_back(total_data_size, stream);
-      auto dst_base = static_cast<uint8_t *>(stripe_data.back().data());
-
-      // Coalesce consecutive streams into one read
-      while (stream_count < stream_info.size()) {
-        const auto d_dst  = dst_base + stream_info[stream_count].dst_pos;
-        const auto offset = stream_info[stream_count].offset;
-        auto len          = stream_info[stream_count].length;
-        stream_count++;
+std::unique_ptr<loaded_stripes> reader::impl::load_stripes(size_type skip_rows,
+                                                           size_type num_rows,
+                                                           size_type stripe,
+                                                           size_type max_stripe_count,
+                                                           const size_type *stripe_indices,
+                                                           stats_filter const &filter,
+                                                           io_metrics *metrics,
+                                                           cudaStream_t stream)
+{
+  auto batch = std::make_unique<loaded_stripes>();
 
-        while (stream_count < stream_info.size() &&
-               stream_info[stream_count].offset == offset + len) {
-          len += stream_info[stream_count].length;
-          stream_count++;
-        }
-        const auto buffer = _source->host_read(offset, len);
-        CUDA_TRY(cudaMemcpyAsync(d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream));
-        CUDA_TRY(cudaStreamSynchronize(stream));
-      }
+  // Select only stripes required (aka row groups)
+  const auto selected_stripes = _metadata->select_stripes(stripe,
+                                                          max_stripe_count,
+                                                          stripe_indices,
+                                                          skip_rows,
+                                                          num_rows,
+                                                          filter,
+                                                          &batch->num_skipped_stripes);
+  for (const auto &info : selected_stripes) {
+    batch->stripes.push_back(info.first);
+    batch->footers.push_back(*info.second);
+  }
+  batch->skip_rows = skip_rows;
+  batch->num_rows  = num_rows;
+  if (metrics) {
+    metrics->row_groups_read    = selected_stripes.size();
+    metrics->row_groups_skipped = batch->num_skipped_stripes;
+  }
 
-      // Update chunks to reference streams pointers
-      for (size_t j = 0; j < num_columns; j++) {
-        auto &chunk         = chunks[i * num_columns + j];
-        chunk.start_row     = stripe_start_row;
-        chunk.num_rows      = stripe_info->numberOfRows;
-        chunk.encoding_kind = stripe_footer->columns[_selected_columns[j]].kind;
-        chunk.type_kind     = _metadata->ff.types[_selected_columns[j]].kind;
-        if (_decimals_as_float) {
-          chunk.decimal_scale =
-            _metadata->ff.types[_selected_columns[j]].scale | ORC_DECIMAL2FLOAT64_SCALE;
-        } else if (_decimals_as_int_scale < 0) {
-          chunk.decimal_scale = _metadata->ff.types[_selected_columns[j]].scale;
-        } else {
-          chunk.decimal_scale = _decimals_as_int_scale;
-        }
-        chunk.rowgroup_id = num_rowgroups;
-        chunk.dtype_len   = (column_types[j].id() == type_id::STRING)
-                            ? sizeof(std::pair<const char *, size_t>)
-                            : cudf::size_of(column_types[j]);
-        if (chunk.type_kind == orc::TIMESTAMP) {
-          chunk.ts_clock_rate = to_clockrate(_timestamp_type.id());
-        }
-        for (int k = 0; k < gpu::CI_NUM_STREAMS; k++) {
-          if (chunk.strm_len[k] > 0) {
-            chunk.streams[k] = dst_base + stream_info[chunk.strm_id[k]].dst_pos;
-          }
-        }
-      }
-      stripe_start_row += stripe_info->numberOfRows;
-      if (use_index) {
-        num_rowgroups += (stripe_info->numberOfRows + _metadata->get_row_index_stride() - 1) /
-                         _metadata->get_row_index_stride();
+  // Association between each ORC column and its cudf::column
+  std::vector<int32_t> orc_col_map;
+
+  // Get a list of column data types
+  batch->column_types      = get_column_types(orc_col_map);
+  auto const &column_types = batch->column_types;
+
+  // If no rows or stripes to read, the output columns are empty
+  if (num_rows <= 0 || selected_stripes.size() == 0) { return batch; }
+
+  const auto num_columns = _decoded_columns.size();
+  const auto num_chunks  = selected_stripes.size() * num_columns;
+  batch->chunks          = hostdevice_vector<gpu::ColumnDesc>(num_chunks, stream);
+  auto &chunks           = batch->chunks;
+  memset(chunks.host_ptr(), 0, chunks.memory_size());
+
+  const bool use_index =
+    (_use_index == true) &&
+    // Only use if we don't have much work with complete columns & stripes
+    // TODO: Consider nrows, gpu, and tune the threshold
+    (num_rows > _metadata->get_row_index_stride() && !(_metadata->get_row_index_stride() & 7) &&
+     _metadata->get_row_index_stride() > 0 && num_columns * selected_stripes.size() < 8 * 128) &&
+    // Only use if first row is aligned to a stripe boundary
+    // TODO: Fix logic to handle unaligned rows
+    (skip_rows == 0) &&
+    // The rows of struct fields are only known once the nulls of their parents are decoded
+    !_has_struct_column;
+
+  // Logically view streams as columns
+  std::vector<orc_stream_info> stream_info;
+
+  // Tracker for eventually deallocating compressed and uncompressed data
+  auto &stripe_data = batch->stripe_data;
+
+  // Stream data of all stripes is read ahead in parallel and copied asynchronously
+  prefetching_source prefetcher(_source.get());
+  std::vector<device_read_range> stream_reads;
+
+  size_t stripe_start_row = 0;
+  size_t num_rowgroups    = 0;
+  for (size_t i = 0; i < selected_stripes.size(); ++i) {
+    const auto stripe_info   = batch->stripes[i];
+    const auto stripe_footer = &batch->footers[i];
+
+    auto stream_count          = stream_info.size();
+    const auto total_data_size = gather_stream_info(i,
+                                                    stripe_info,
+                                                    stripe_footer,
+                                                    orc_col_map,
+                                                    _decoded_columns,
+                                                    use_index,
+                                                    &batch->num_dict_entries,
+                                                    chunks,
+                                                    stream_info);
+    CUDF_EXPECTS(total_data_size > 0, "Expected streams data within stripe");
+
+    stripe_data.emplace_back(total_data_size, stream, get_scratch_resource());
+    auto dst_base = static_cast<uint8_t *>(stripe_data.back().data());
+
+    // Coalesce consecutive streams into one read
+    while (stream_count < stream_info.size()) {
+      const auto d_dst  = dst_base + stream_info[stream_count].dst_pos;
+      const auto offset = stream_info[stream_count].offset;
+      auto len          = stream_info[stream_count].length;
+      stream_count++;
+
+      while (stream_count < stream_info.size() &&
+             stream_info[stream_count].offset == offset + len) {
+        len += stream_info[stream_count].length;
+        stream_count++;
       }
+      stream_reads.push_back({offset, len, d_dst});
     }
 
-    // Process dataset chunk pages into output columns
-    if (stripe_data.size() != 0) {
-      // Setup row group descriptors if using indexes
-      rmm::device_vector<gpu::RowGroup> row_groups(num_rowgroups * num_columns);
-      if (_metadata->ps.compression != orc::NONE) {
-        auto decomp_data = decompress_stripe_data(chunks,
-                                                  stripe_data,
-                                                  _metadata->decompressor.get(),
-                                                  stream_info,
-                                                  selected_stripes.size(),
-                                                  row_groups,
-                                                  _metadata->get_row_index_stride(),
-                                                  stream);
-        stripe_data.clear();
-        stripe_data.push_back(std::move(decomp_data));
+    // Update chunks to reference streams pointers
+    for (size_t j = 0; j < num_columns; j++) {
+      auto &chunk         = chunks[i * num_columns + j];
+      chunk.start_row     = stripe_start_row;
+      chunk.num_rows      = stripe_info->numberOfRows;
+      chunk.encoding_kind = stripe_footer->columns[_decoded_columns[j]].kind;
+      chunk.type_kind     = _metadata->ff.types[_decoded_columns[j]].kind;
+      if (_decimals_as_float) {
+        chunk.decimal_scale =
+          _metadata->ff.types[_decoded_columns[j]].scale | ORC_DECIMAL2FLOAT64_SCALE;
+      } else if (_decimals_as_int_scale < 0) {
+        chunk.decimal_scale = _metadata->ff.types[_decoded_columns[j]].scale;
       } else {
-        if (not row_groups.empty()) {
-          CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(),
-                                   chunks.host_ptr(),
-                                   chunks.memory_size(),
-                                   cudaMemcpyHostToDevice,
-                                   stream));
-          CUDA_TRY(gpu::ParseRowGroupIndex(row_groups.data().get(),
-                                           nullptr,
-                                           chunks.device_ptr(),
-                                           num_columns,
-                                           selected_stripes.size(),
-                                           num_rowgroups,
-                                           _metadata->get_row_index_stride(),
-                                           stream));
+        chunk.decimal_scale = _decimals_as_int_scale;
+      }
+      chunk.rowgroup_id = num_rowgroups;
+      chunk.dtype_len   = (column_types[j].id() == type_id::STRING)
+                          ? sizeof(std::pair<const char *, size_t>)
+                          : (column_types[j].id() == type_id::STRUCT)
+                              ? 0
+                              : cudf::size_of(column_types[j]);
+      if (chunk.type_kind == orc::TIMESTAMP) {
+        chunk.ts_clock_rate = to_clockrate(_timestamp_type.id());
+      }
+      for (int k = 0; k < gpu::CI_NUM_STREAMS; k++) {
+        if (chunk.strm_len[k] > 0) {
+          chunk.streams[k] = dst_base + stream_info[chunk.strm_id[k]].dst_pos;
         }
       }
+    }
+    stripe_start_row += stripe_info->numberOfRows;
+    if (use_index) {
+      num_rowgroups += (stripe_info->numberOfRows + _metadata->get_row_index_stride() - 1) /
+                       _metadata->get_row_index_stride();
+    }
+  }
+
+  {
+    metrics_timer timer(metrics, &io_metrics::h2d_copy_ms, stream);
+    prefetcher.read_to_device(stream_reads, stream);
+    prefetcher.synchronize();
+  }
+  for (auto const &data : stripe_data) { batch->stripe_data_size += data.size(); }
+  if (metrics) { metrics->peak_scratch_bytes = batch->stripe_data_size; }
+
+  // Setup row group descriptors if using indexes
+  batch->row_groups = std::make_unique<rmm::device_vector<gpu::RowGroup>>(
+    cudf::detail::make_scratch_vector<gpu::RowGroup>(num_rowgroups * num_columns, {}, stream));
+  auto &row_groups = *batch->row_groups;
+  if (_metadata->ps.compression != orc::NONE) {
+    metrics_timer timer(metrics, &io_metrics::decompression_ms, stream);
+    auto decomp_data = decompress_stripe_data(chunks,
+                                              stripe_data,
+                                              _metadata->decompressor.get(),
+                                              stream_info,
+                                              selected_stripes.size(),
+                                              row_groups,
+                                              _metadata->get_row_index_stride(),
+                                              stream);
+    timer.stop();
+    if (metrics) {
+      metrics->peak_scratch_bytes =
+        batch->stripe_data_size + decomp_data.size() + _decompressor.scratch_size();
+    }
+    stripe_data.clear();
+    stripe_data.push_back(std::move(decomp_data));
+  } else {
+    if (not row_groups.empty()) {
+      CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(),
+                               chunks.host_ptr(),
+                               chunks.memory_size(),
+                               cudaMemcpyHostToDevice,
+                               stream));
+      CUDA_TRY(gpu::ParseRowGroupIndex(row_groups.data().get(),
+                                       nullptr,
+                                       chunks.device_ptr(),
+                                       num_columns,
+                                       selected_stripes.size(),
+                                       num_rowgroups,
+                                       _metadata->get_row_index_stride(),
+                                       stream));
+    }
+  }
+  return batch;
+}
+
+table_with_metadata reader::impl::decode_stripes(loaded_stripes &stripes,
+                                                 std::unique_ptr<io_metrics> metrics,
+                                                 cudaStream_t stream)
+{
+  std::vector<std::unique_ptr<column>> out_columns;
+  table_metadata out_metadata;
+  auto const &column_types = stripes.column_types;
 
-      // Setup table for converting timestamp columns from local to UTC time
-      std::vector<int64_t> tz_table;
-      if (_has_timestamp_column) {
-        CUDF_EXPECTS(
-          BuildTimezoneTransitionTable(tz_table, selected_stripes[0].second->writerTimezone),
-          "Cannot setup timezone LUT");
+  // If no rows or stripes to read, return empty columns
+  if (stripes.num_rows <= 0 || stripes.stripes.empty()) {
+    for (size_t i = 0; i < _selected_columns.size(); ++i) {
+      out_columns.push_back(
+        make_empty_decoded_column(_metadata->ff.types, _decoded_columns, column_types, i));
+    }
+  } else {
+    const auto num_columns = _decoded_columns.size();
+    auto &chunks           = stripes.chunks;
+
+    metrics_timer decode_timer(metrics.get(), &io_metrics::decode_ms, stream);
+
+    // Setup table for converting timestamp columns from local to UTC time, once per timezone
+    if (_has_timestamp_column) {
+      auto const &tz_name = stripes.footers[0].writerTimezone;
+      if (!_tz_table_built || tz_name != _tz_name) {
+        _tz_table.clear();
+        CUDF_EXPECTS(BuildTimezoneTransitionTable(_tz_table, tz_name),
+                     "Cannot setup timezone LUT");
+        _tz_name        = tz_name;
+        _tz_table_built = true;
       }
+    }
 
+    if (_has_struct_column) {
+      out_columns = decode_struct_stripes(stripes, stream);
+    } else {
       std::vector<column_buffer> out_buffers;
       for (size_t i = 0; i < column_types.size(); ++i) {
         bool is_nullable = false;
-        for (size_t j = 0; j < selected_stripes.size(); ++j) {
+        for (size_t j = 0; j < stripes.stripes.size(); ++j) {
           if (chunks[j * num_columns + i].strm_len[gpu::CI_PRESENT] != 0) {
             is_nullable = true;
             break;
           }
         }
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
+        out_buffers.emplace_back(column_types[i], stripes.num_rows, is_nullable, stream, _mr);
       }
 
       decode_stream_data(chunks,
-                         num_dict_entries,
-                         skip_rows,
-                         num_rows,
-                         tz_table,
-                         row_groups,
+                         stripes.num_dict_entries,
+                         stripes.skip_rows,
+                         stripes.num_rows,
+                         _tz_table,
+                         *stripes.row_groups,
                          _metadata->get_row_index_stride(),
                          out_buffers,
                          stream);
 
       for (size_t i = 0; i < column_types.size(); ++i) {
         out_columns.emplace_back(
-          make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+          make_column(column_types[i], stripes.num_rows, out_buffers[i], stream, _mr));
       }
     }
   }
@@ -829,7 +1446,322 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     out_metadata.user_data.insert({kv.name, kv.value});
   }
 
-  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+  if (metrics) {
+    take_decompression_metrics(_decompressor, *metrics);
+    _metered_source->take_metrics(*metrics);
+  }
+
+  return {std::make_unique<table>(std::move(out_columns)),
+          std::move(out_metadata),
+          std::move(metrics)};
+}
+
+std::vector<std::unique_ptr<column>> reader::impl::decode_struct_stripes(loaded_stripes &stripes,
+                                                                        cudaStream_t stream)
+{
+  auto const &types        = _metadata->ff.types;
+  auto const &column_types = stripes.column_types;
+  auto const num_columns   = _decoded_columns.size();
+  auto const num_stripes   = stripes.stripes.size();
+  auto &chunks             = stripes.chunks;
+
+  // Decoded parent of each decoded column, -1 for top-level columns
+  std::vector<int> parents(num_columns, -1);
+  std::vector<int> depths(num_columns, 0);
+  int max_depth = 0;
+  for (size_t j = 0; j < num_columns; ++j) {
+    auto const parent_idx = types[_decoded_columns[j]].parent_idx;
+    if (parent_idx != 0) {
+      parents[j] = std::find(_decoded_columns.cbegin(), _decoded_columns.cend(), parent_idx) -
+                   _decoded_columns.cbegin();
+    }
+  }
+  for (size_t j = 0; j < num_columns; ++j) {
+    for (auto p = parents[j]; p >= 0; p = parents[p]) { depths[j]++; }
+    max_depth = std::max(max_depth, depths[j]);
+  }
+
+  size_t total_rows = 0;
+  for (auto const &info : stripes.stripes) { total_rows += info->numberOfRows; }
+
+  // The rows of a field in each stripe are the valid rows of its struct in the stripe; the nulls
+  // of the structs at each depth are decoded once the rows of their chunks are known
+  std::vector<gpu::ColumnDesc> descs(chunks.host_ptr(), chunks.host_ptr() + chunks.size());
+  std::vector<size_t> column_rows(num_columns, 0);
+  auto global_dict =
+    cudf::detail::make_scratch_vector<gpu::DictionaryEntry>(stripes.num_dict_entries, {}, stream);
+  for (int depth = 0; depth <= max_depth; ++depth) {
+    for (size_t i = 0; i < num_stripes; ++i) {
+      for (size_t j = 0; j < num_columns; ++j) {
+        if (depths[j] != depth) { continue; }
+        auto &desc     = descs[i * num_columns + j];
+        desc.start_row = column_rows[j];
+        if (parents[j] >= 0) {
+          auto const &parent = descs[i * num_columns + parents[j]];
+          desc.num_rows      = parent.num_rows - parent.null_count;
+        }
+        column_rows[j] += desc.num_rows;
+      }
+    }
+    if (depth == max_depth) { break; }
+
+    std::vector<rmm::device_buffer> masks;
+    for (size_t j = 0; j < num_columns; ++j) {
+      auto const is_decoded = (depths[j] == depth && column_types[j].id() == type_id::STRUCT);
+      if (is_decoded) {
+        masks.emplace_back(
+          bitmask_allocation_size_bytes(column_rows[j]), stream, get_scratch_resource());
+      }
+      for (size_t i = 0; i < num_stripes; ++i) {
+        auto &chunk = chunks[i * num_columns + j];
+        chunk       = descs[i * num_columns + j];
+        if (is_decoded) {
+          chunk.valid_map_base = static_cast<uint32_t *>(masks.back().data());
+        } else {
+          chunk.num_rows       = 0;
+          chunk.valid_map_base = nullptr;
+        }
+        chunk.dict_len = 0;
+      }
+    }
+    CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(),
+                             chunks.host_ptr(),
+                             chunks.memory_size(),
+                             cudaMemcpyHostToDevice,
+                             stream));
+    CUDA_TRY(gpu::DecodeNullsAndStringDictionaries(chunks.device_ptr(),
+                                                   global_dict.data().get(),
+                                                   num_columns,
+                                                   num_stripes,
+                                                   total_rows,
+                                                   0,
+                                                   stream));
+    CUDA_TRY(cudaMemcpyAsync(chunks.host_ptr(),
+                             chunks.device_ptr(),
+                             chunks.memory_size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      if (chunks[i].valid_map_base != nullptr) { descs[i].null_count = chunks[i].null_count; }
+    }
+  }
+  std::copy(descs.cbegin(), descs.cend(), chunks.host_ptr());
+
+  std::vector<column_buffer> out_buffers;
+  for (size_t j = 0; j < num_columns; ++j) {
+    bool is_nullable = false;
+    for (size_t i = 0; i < num_stripes; ++i) {
+      if (chunks[i * num_columns + j].strm_len[gpu::CI_PRESENT] != 0) {
+        is_nullable = true;
+        break;
+      }
+    }
+    out_buffers.emplace_back(column_types[j], column_rows[j], is_nullable, stream, _mr);
+  }
+  decode_stream_data(chunks,
+                     stripes.num_dict_entries,
+                     0,
+                     total_rows,
+                     _tz_table,
+                     *stripes.row_groups,
+                     _metadata->get_row_index_stride(),
+                     out_buffers,
+                     stream);
+
+  // Struct columns are assembled from the columns of their fields, the deepest first, down to the
+  // selected columns; the other structs are only used to expand the selected fields
+  auto const num_selected = _selected_columns.size();
+  std::vector<bool> is_output(num_columns, false);
+  for (size_t j = 0; j < num_columns; ++j) {
+    for (auto p = static_cast<int>(j); p >= 0 && !is_output[j]; p = parents[p]) {
+      is_output[j] = (static_cast<size_t>(p) < num_selected);
+    }
+  }
+  std::vector<bitmask_type const *> valid(num_columns);
+  std::vector<size_type> null_counts(num_columns);
+  for (size_t j = 0; j < num_columns; ++j) {
+    valid[j]       = out_buffers[j].null_mask<bitmask_type>();
+    null_counts[j] = out_buffers[j].null_count();
+  }
+  std::vector<std::unique_ptr<column>> columns(num_columns);
+  for (int depth = max_depth; depth >= 0; --depth) {
+    for (size_t j = 0; j < num_columns; ++j) {
+      if (depths[j] != depth || !is_output[j]) { continue; }
+      auto const num_rows = static_cast<size_type>(column_rows[j]);
+      if (column_types[j].id() != type_id::STRUCT) {
+        columns[j] = make_column(column_types[j], num_rows, out_buffers[j], stream, _mr);
+        continue;
+      }
+      std::vector<std::unique_ptr<column>> fields;
+      for (auto const child : types[_decoded_columns[j]].subtypes) {
+        auto const it = std::find(_decoded_columns.cbegin(), _decoded_columns.cend(), child);
+        if (it == _decoded_columns.cend()) { continue; }
+        auto const k = it - _decoded_columns.cbegin();
+        // A field that is also selected on its own is kept for its output column
+        auto field = (static_cast<size_t>(k) < num_selected)
+                       ? std::make_unique<column>(columns[k]->view(), stream, _mr)
+                       : std::move(columns[k]);
+        fields.push_back(
+          expand_field(std::move(field), valid[j], num_rows, null_counts[j], stream, _mr));
+      }
+      // The mask of the buffer is kept to expand the selected fields of the struct
+      columns[j] = make_structs_column(num_rows,
+                                       std::move(fields),
+                                       null_counts[j],
+                                       rmm::device_buffer{out_buffers[j]._null_mask, stream, _mr},
+                                       stream,
+                                       _mr);
+    }
+  }
+
+  // The selected fields are expanded to the rows of the stripes, then cropped to the rows read
+  auto const is_cropped = (static_cast<size_t>(stripes.num_rows) != total_rows);
+  auto crop_map =
+    cudf::detail::make_scratch_vector<size_type>(is_cropped ? stripes.num_rows : 0, 0, stream);
+  if (is_cropped) {
+    auto execpol = cudf::detail::scratch_policy(stream);
+    thrust::sequence(execpol->on(stream), crop_map.begin(), crop_map.end(), stripes.skip_rows);
+  }
+  std::vector<std::unique_ptr<column>> out_columns;
+  for (size_t j = 0; j < num_selected; ++j) {
+    auto col = std::move(columns[j]);
+    for (auto p = parents[j]; p >= 0; p = parents[p]) {
+      auto const num_rows = static_cast<size_type>(column_rows[p]);
+      col = expand_field(std::move(col), valid[p], num_rows, null_counts[p], stream, _mr);
+    }
+    if (is_cropped) { col = gather_column(col->view(), crop_map, stream, _mr); }
+    out_columns.push_back(std::move(col));
+  }
+  return out_columns;
+}
+
+table_with_metadata reader::impl::read_selection(size_type skip_rows,
+                                                 size_type num_rows,
+                                                 size_type stripe,
+                                                 size_type max_stripe_count,
+                                                 const size_type *stripe_indices,
+                                                 cudaStream_t stream)
+{
+  auto metrics = (_metered_source != nullptr) ? std::make_unique<io_metrics>() : nullptr;
+
+  CUDF_EXPECTS(_filter.empty() || (skip_rows <= 0 && num_rows < 0),
+               "Statistics filter cannot be combined with a row range");
+
+  auto stripes = load_stripes(
+    skip_rows, num_rows, stripe, max_stripe_count, stripe_indices, _filter, metrics.get(), stream);
+  return decode_stripes(*stripes, std::move(metrics), stream);
+}
+
+void reader::impl::begin_chunked_read(size_t chunk_read_limit,
+                                      std::vector<size_type> const &stripe_list)
+{
+  CUDF_EXPECTS(!has_row_mask(_row_mask), "A row mask cannot be combined with a chunked read");
+  if (_next_load.valid()) { _next_load.get(); }
+
+  // Select the stripes once, applying the filter; the batches only contain stripes that may match
+  size_type row_start  = 0;
+  size_type row_count  = -1;
+  auto const selection = _metadata->select_stripes(
+    -1,
+    stripe_list.empty() ? -1 : static_cast<size_type>(stripe_list.size()),
+    stripe_list.empty() ? nullptr : stripe_list.data(),
+    row_start,
+    row_count,
+    _filter);
+  std::vector<int32_t> orc_col_map;
+  auto const column_types  = get_column_types(orc_col_map);
+  auto const is_compressed = (_metadata->ps.compression != orc::NONE);
+
+  // Estimate of the device memory needed to read a stripe: the streams of the selected columns,
+  // their decompressed copy and the decoded output. Decompressed sizes are only known once the
+  // data is read, so they are estimated with a fixed compression ratio.
+  constexpr size_t assumed_compression_ratio = 4;
+  std::vector<size_t> column_stream_sizes(column_types.size());
+  std::vector<bool> column_has_nulls(column_types.size());
+  auto const stripe_read_size = [&](StripeInformation const &info, StripeFooter const &footer) {
+    std::fill(column_stream_sizes.begin(), column_stream_sizes.end(), 0);
+    std::fill(column_has_nulls.begin(), column_has_nulls.end(), false);
+    for (auto const &strm : footer.streams) {
+      if (strm.column >= orc_col_map.size() || orc_col_map[strm.column] < 0) { continue; }
+      column_stream_sizes[orc_col_map[strm.column]] += strm.length;
+      if (strm.kind == orc::PRESENT) { column_has_nulls[orc_col_map[strm.column]] = true; }
+    }
+    size_t size = 0;
+    for (size_t i = 0; i < column_types.size(); ++i) {
+      auto const data_size =
+        column_stream_sizes[i] * (is_compressed ? assumed_compression_ratio : 1);
+      size += column_stream_sizes[i] + (is_compressed ? data_size : 0);
+      if (column_types[i].id() == type_id::STRING) {
+        // The string characters are about as large as the decompressed streams
+        size += data_size + (info.numberOfRows + 1) * sizeof(size_type) +
+                info.numberOfRows * sizeof(std::pair<const char *, size_t>);
+      } else if (column_types[i].id() != type_id::STRUCT) {
+        size += info.numberOfRows * size_of(column_types[i]);
+      }
+      if (column_has_nulls[i]) { size += bitmask_allocation_size_bytes(info.numberOfRows); }
+    }
+    return size;
+  };
+
+  _chunk_stripes.clear();
+  _next_chunk = 0;
+  std::vector<size_type> current;
+  size_t current_size = 0;
+  for (auto const &info : selection) {
+    auto const size = stripe_read_size(*info.first, *info.second);
+    if (chunk_read_limit != 0 && !current.empty() && current_size + size > chunk_read_limit) {
+      _chunk_stripes.push_back(std::move(current));
+      current.clear();
+      current_size = 0;
+    }
+    current.push_back(static_cast<size_type>(info.first - _metadata->ff.stripes.data()));
+    current_size += size;
+  }
+  // Always return at least one (possibly empty) table so that the schema can be retrieved
+  if (!current.empty() || _chunk_stripes.empty()) { _chunk_stripes.push_back(std::move(current)); }
+}
+
+table_with_metadata reader::impl::read_next_chunk(cudaStream_t stream)
+{
+  CUDF_EXPECTS(has_next_chunk(), "No more stripes to read");
+  auto metrics = (_metered_source != nullptr) ? std::make_unique<io_metrics>() : nullptr;
+
+  // The filter was applied when planning the batches
+  auto const load_chunk = [this](std::vector<size_type> const &stripe_list,
+                                 io_metrics *chunk_metrics,
+                                 cudaStream_t load_stream) {
+    // An empty stripe list still selects stripes by index, and returns no rows
+    size_type const no_stripe = 0;
+    return load_stripes(0,
+                        -1,
+                        -1,
+                        static_cast<size_type>(stripe_list.size()),
+                        stripe_list.empty() ? &no_stripe : stripe_list.data(),
+                        stats_filter{},
+                        chunk_metrics,
+                        load_stream);
+  };
+
+  auto stripes = _next_load.valid()
+                   ? _next_load.get()
+                   : load_chunk(_chunk_stripes[_next_chunk], metrics.get(), stream);
+  ++_next_chunk;
+
+  // Read and decompress the next batch on the second stream while this one is decoded. The reads
+  // are not overlapped when the metrics are collected, so that they are attributed to their chunk.
+  if (has_next_chunk() && metrics == nullptr) {
+    if (_load_stream == 0) {
+      CUDA_TRY(cudaStreamCreateWithFlags(&_load_stream, cudaStreamNonBlocking));
+    }
+    auto const &next_stripes = _chunk_stripes[_next_chunk];
+    _next_load = std::async(std::launch::async, [this, load_chunk, &next_stripes]() {
+      auto next = load_chunk(next_stripes, nullptr, _load_stream);
+      CUDA_TRY(cudaStreamSynchronize(_load_stream));
+      return next;
+    });
+  }
+  return decode_stripes(*stripes, std::move(metrics), stream);
 }
 
 // Forward to implementation
@@ -838,7 +1770,9 @@ reader::reader(std::vector<std::string> const &filepaths,
                rmm::mr::device_memory_resource *mr)
 {
   CUDF_EXPECTS(filepaths.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(datasource::create(filepaths[0]), options, mr);
+  // Only files have a version to key the metadata cache with
+  auto const cache_key = options.use_metadata_cache ? file_cache_key(filepaths[0]) : std::string{};
+  _impl = std::make_unique<impl>(datasource::create(filepaths[0]), options, mr, cache_key);
 }
 
 // Forward to implementation
@@ -881,6 +1815,76 @@ table_with_metadata reader::read_rows(size_type skip_rows, size_type num_rows, c
   return _impl->read(skip_rows, (num_rows != 0) ? num_rows : -1, -1, -1, nullptr, stream);
 }
 
+// Forward to implementation
+void reader::begin_chunked_read(size_t chunk_read_limit, std::vector<size_type> const &stripe_list)
+{
+  _impl->begin_chunked_read(chunk_read_limit, stripe_list);
+}
+
+// Forward to implementation
+bool reader::has_next_chunk() const { return _impl->has_next_chunk(); }
+
+// Forward to implementation
+table_with_metadata reader::read_next_chunk(cudaStream_t stream)
+{
+  return _impl->read_next_chunk(stream);
+}
+
+file_metadata read_statistics(datasource *source)
+{
+  metadata md(source);
+  md.read_stripe_statistics();
+
+  // Statistics that cannot be decoded are returned without min/max values
+  auto to_statistics = [&](std::vector<ColumnStatistics> const &blobs, int col, uint64_t num_rows) {
+    ColumnStatisticsSummary stats;
+    if (static_cast<size_t>(col) < blobs.size()) {
+      ProtobufReader pb(blobs[col].data(), blobs[col].size());
+      if (!pb.read(&stats, blobs[col].size())) { stats = ColumnStatisticsSummary{}; }
+    }
+    // `numberOfValues` only counts the non-null values
+    auto const null_count =
+      stats.has_number_of_values ? static_cast<int64_t>(num_rows - stats.numberOfValues) : -1;
+    return to_column_statistics(
+      md.ff.GetColumnName(col), to_value_range(stats, num_rows), num_rows, null_count);
+  };
+
+  // Only the leaf columns are returned, the fields of struct columns named by their dotted path
+  std::vector<int> columns;
+  for (int i = 0; i < md.get_num_columns(); ++i) {
+    if (md.ff.types[i].subtypes.empty()) { columns.push_back(i); }
+  }
+
+  file_metadata result;
+  result.num_rows = md.get_total_rows();
+  for (auto const col : columns) {
+    result.column_names.push_back(md.ff.GetColumnName(col));
+    // Types read with the default options of `read_orc_args`
+    result.column_types.emplace_back(to_type_id(md.ff.types[col], true, type_id::EMPTY, true));
+    result.columns.push_back(to_statistics(md.ff.statistics, col, md.ff.numberOfRows));
+  }
+  for (auto const &item : md.ff.metadata) { result.user_data[item.name] = item.value; }
+
+  int64_t first_row = 0;
+  for (size_t i = 0; i < md.ff.stripes.size(); ++i) {
+    auto const &stripe = md.ff.stripes[i];
+    row_block_metadata block;
+    block.first_row = first_row;
+    block.num_rows  = stripe.numberOfRows;
+    block.offset    = stripe.offset;
+    block.size      = stripe.indexLength + stripe.dataLength + stripe.footerLength;
+    for (auto const col : columns) {
+      block.columns.push_back(
+        (i < md.md.stripeStats.size())
+          ? to_statistics(md.md.stripeStats[i].colStats, col, stripe.numberOfRows)
+          : to_column_statistics(md.ff.GetColumnName(col), {}, stripe.numberOfRows, -1));
+    }
+    first_row += stripe.numberOfRows;
+    result.blocks.push_back(std::move(block));
+  }
+  return result;
+}
+
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
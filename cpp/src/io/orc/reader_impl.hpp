@@ -24,12 +24,15 @@
 #include "orc.h"
 #include "orc_gpu.h"
 
+#include <io/comp/gpu_decompressor.h>
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/io_metrics.hpp>
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/readers.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
@@ -44,6 +47,7 @@ using namespace cudf::io;
 
 // Forward declarations
 class metadata;
+struct loaded_stripes;
 namespace {
 class orc_stream_info;
 }
@@ -59,10 +63,17 @@ class reader::impl {
    * @param source Dataset source
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
+   * @param cache_key Metadata cache key of the source; empty to bypass the cache
    */
   explicit impl(std::unique_ptr<datasource> source,
                 reader_options const &options,
-                rmm::mr::device_memory_resource *mr);
+                rmm::mr::device_memory_resource *mr,
+                std::string const &cache_key = {});
+
+  /**
+   * @brief Waits for the stripes being loaded for the next chunk, if any
+   */
+  ~impl();
 
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
@@ -83,7 +94,115 @@ class reader::impl {
                            const size_type *stripe_indices,
                            cudaStream_t stream);
 
+  /**
+   * @brief Plans the batches of stripes returned by successive `read_next_chunk()` calls
+   *
+   * Stripes are grouped in file order so that the estimated device memory needed to read each
+   * batch (stream data of the selected columns, its decompressed copy and output columns) stays
+   * within the limit. A stripe that exceeds the limit on its own is returned as a single batch.
+   *
+   * @param chunk_read_limit Byte limit for each batch; 0 to read all stripes in one batch
+   * @param stripe_list Stripes to read; empty for all stripes
+   */
+  void begin_chunked_read(size_t chunk_read_limit, std::vector<size_type> const &stripe_list);
+
+  /**
+   * @brief Returns whether `read_next_chunk()` has any remaining batch to read
+   */
+  bool has_next_chunk() const { return _next_chunk < _chunk_stripes.size(); }
+
+  /**
+   * @brief Reads the next batch of stripes planned by `begin_chunked_read()`
+   *
+   * The stripes of the following batch are loaded on a second CUDA stream, by a worker thread,
+   * while this batch is decoded.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_next_chunk(cudaStream_t stream);
+
  private:
+  /**
+   * @brief Returns the output data types of the decoded columns
+   *
+   * @param[out] orc_col_map Decoded column index of each ORC column, -1 if not decoded
+   */
+  std::vector<data_type> get_column_types(std::vector<int32_t> &orc_col_map) const;
+
+  /**
+   * @brief Selects the stripes to read, reads their stream data to device memory and decompresses
+   * it
+   *
+   * Parameters are the same as `read()`, except for:
+   *
+   * @param filter Stripes whose statistics show that no row satisfies it are skipped
+   * @param metrics Metrics of the read to update; may be null
+   *
+   * @return The stripe data, ready to be decoded once `stream` is synchronized
+   */
+  std::unique_ptr<loaded_stripes> load_stripes(size_type skip_rows,
+                                               size_type num_rows,
+                                               size_type stripe,
+                                               size_type max_stripe_count,
+                                               const size_type *stripe_indices,
+                                               stats_filter const &filter,
+                                               io_metrics *metrics,
+                                               cudaStream_t stream);
+
+  /**
+   * @brief Decodes loaded stripe data into the output columns
+   *
+   * @param stripes Stripe data returned by `load_stripes()`
+   * @param metrics Metrics of the read, returned with the table; may be null
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata decode_stripes(loaded_stripes &stripes,
+                                     std::unique_ptr<io_metrics> metrics,
+                                     cudaStream_t stream);
+
+  /**
+   * @brief Decodes loaded stripe data holding struct columns into the selected columns
+   *
+   * The fields of a struct only hold values for the valid rows of the struct, so the rows of each
+   * column are counted from the nulls of its parent, one depth at a time. The columns are then
+   * decoded in full, expanded to the rows of their parents and cropped to the rows of the read.
+   *
+   * @param stripes Stripe data returned by `load_stripes()`
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The selected columns
+   */
+  std::vector<std::unique_ptr<column>> decode_struct_stripes(loaded_stripes &stripes,
+                                                             cudaStream_t stream);
+
+  /**
+   * @brief Reads the selected rows without applying the row mask
+   *
+   * Parameters are the same as `read()`.
+   */
+  table_with_metadata read_selection(size_type skip_rows,
+                                     size_type num_rows,
+                                     size_type stripe,
+                                     size_type max_stripe_count,
+                                     const size_type *stripe_indices,
+                                     cudaStream_t stream);
+
+  /**
+   * @brief Reads only the stripes holding rows selected by the row mask, and returns these rows
+   *
+   * Parameters are the same as `read()`.
+   */
+  table_with_metadata read_with_row_mask(size_type skip_rows,
+                                         size_type num_rows,
+                                         size_type stripe,
+                                         size_type max_stripe_count,
+                                         const size_type *stripe_indices,
+                                         cudaStream_t stream);
+
   /**
    * @brief Decompresses the stripe data, at stream granularity
    *
@@ -136,12 +255,34 @@ class reader::impl {
   std::unique_ptr<metadata> _metadata;
 
   std::vector<int> _selected_columns;
+  // Selected columns, followed by the other columns decoded to assemble their struct columns
+  std::vector<int> _decoded_columns;
+  bool _has_struct_column    = false;
   bool _use_index            = true;
   bool _use_np_dtypes        = true;
   bool _has_timestamp_column = false;
   bool _decimals_as_float    = true;
   int _decimals_as_int_scale = -1;
   data_type _timestamp_type{type_id::EMPTY};
+  stats_filter _filter;
+  column_view _row_mask;
+
+  // Kept across the reads of the reader to reuse its scratch memory
+  gpu_decompressor _decompressor;
+
+  // Wrapper of the source counting its reads, when the metrics are collected
+  metered_source *_metered_source = nullptr;
+
+  // Timezone transition table, built once for the writer timezone of the file
+  std::vector<int64_t> _tz_table;
+  std::string _tz_name;
+  bool _tz_table_built = false;
+
+  // Chunked reads: stripes of each batch, and the batch being loaded in the background
+  std::vector<std::vector<size_type>> _chunk_stripes;
+  size_t _next_chunk = 0;
+  std::future<std::unique_ptr<loaded_stripes>> _next_load;
+  cudaStream_t _load_stream = 0;
 };
 
 }  // namespace orc
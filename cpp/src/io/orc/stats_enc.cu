@@ -26,9 +26,9 @@ namespace gpu {
  *
  * @param[out] groups Statistics groups
  * @param[in] cols Column descriptors
+ * @param[in] chunks Column data chunks, holding the rows of each rowgroup
  * @param[in] num_columns Number of columns
  * @param[in] num_rowgroups Number of rowgroups
- * @param[in] row_index_stride Rowgroup size in rows
  *
  **/
 constexpr unsigned int init_threads_per_group = 32;
@@ -38,9 +38,9 @@ constexpr unsigned int init_threads_per_block = init_threads_per_group * init_gr
 __global__ void __launch_bounds__(init_threads_per_block)
   gpu_init_statistics_groups(statistics_group *groups,
                              const stats_column_desc *cols,
+                             const EncChunk *chunks,
                              uint32_t num_columns,
-                             uint32_t num_rowgroups,
-                             uint32_t row_index_stride)
+                             uint32_t num_rowgroups)
 {
   __shared__ __align__(4) volatile statistics_group group_g[init_groups_per_block];
   uint32_t col_id                  = blockIdx.y;
@@ -49,11 +49,10 @@ __global__ void __launch_bounds__(init_threads_per_block)
   volatile statistics_group *group = &group_g[threadIdx.y];
   if (chunk_id < num_rowgroups) {
     if (t == 0) {
-      uint32_t num_rows = cols[col_id].num_rows;
-      group->col        = &cols[col_id];
-      group->start_row  = chunk_id * row_index_stride;
-      group->num_rows =
-        min(num_rows - min(chunk_id * row_index_stride, num_rows), row_index_stride);
+      const EncChunk *ck = &chunks[chunk_id * num_columns + col_id];
+      group->col         = &cols[col_id];
+      group->start_row   = ck->start_row;
+      group->num_rows    = ck->num_rows;
     }
   }
   __syncthreads();
@@ -362,7 +361,7 @@ __global__ void __launch_bounds__(encode_threads_per_block)
         //  optional sint32 maximum = 2;
         // }
         if (s->chunk.has_minmax) {
-          cur[0] = 7 * 8 + PB_TYPE_FIXEDLEN;
+          cur[0] = 9 * 8 + PB_TYPE_FIXEDLEN;
           cur += 2;
           cur          = pb_put_int(cur, 1, s->chunk.min_value.i_val);
           cur          = pb_put_int(cur, 2, s->chunk.max_value.i_val);
@@ -396,24 +395,24 @@ __global__ void __launch_bounds__(encode_threads_per_block)
  *
  * @param[out] groups Statistics groups (rowgroup-level)
  * @param[in] cols Column descriptors
+ * @param[in] chunks Column data chunks, holding the rows of each rowgroup
  * @param[in] num_columns Number of columns
  * @param[in] num_rowgroups Number of rowgroups
- * @param[in] row_index_stride Rowgroup size in rows
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
  **/
 cudaError_t orc_init_statistics_groups(statistics_group *groups,
                                        const stats_column_desc *cols,
+                                       const EncChunk *chunks,
                                        uint32_t num_columns,
                                        uint32_t num_rowgroups,
-                                       uint32_t row_index_stride,
                                        cudaStream_t stream)
 {
   dim3 dim_grid((num_rowgroups + init_groups_per_block - 1) / init_groups_per_block, num_columns);
   dim3 dim_block(init_threads_per_group, init_groups_per_block);
   gpu_init_statistics_groups<<<dim_grid, dim_block, 0, stream>>>(
-    groups, cols, num_columns, num_rowgroups, row_index_stride);
+    groups, cols, chunks, num_columns, num_rowgroups);
 
   return cudaSuccess;
 }
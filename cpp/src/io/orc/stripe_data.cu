@@ -1481,6 +1481,8 @@ extern "C" __global__ void __launch_bounds__(NTHREADS)
     ((volatile uint32_t *)&s->chunk)[t] = ((const uint32_t *)&chunks[chunk_id])[t];
   }
   __syncthreads();
+  // Struct columns only have a PRESENT stream, decoded with the nulls
+  if (s->chunk.type_kind == STRUCT) { return; }
   if (t == 0) {
     // If we have an index, seek to the initial run and update row positions
     if (num_rowgroups > 0) {
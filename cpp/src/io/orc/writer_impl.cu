@@ -21,16 +21,32 @@
 
 #include "writer_impl.hpp"
 
+#include "bloom_filter.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/structs/structs_column_view.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstring>
+#include <memory>
 #include <utility>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -40,10 +56,97 @@ using namespace cudf::io;
 
 namespace {
 /**
- * @brief Helper for pinned host memory
+ * @brief Double-buffered pinned host memory used to stage stripe data for the sink
+ *
+ * The data streams of the next stripe are copied into one buffer while the current stripe,
+ * staged in the other buffer, is written to the sink. An event per buffer tracks its copies.
  **/
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
+class stripe_staging_buffers {
+ public:
+  explicit stripe_staging_buffers(size_t buffer_size)
+  {
+    for (auto &bfr : buffers_) { CUDA_TRY(cudaMallocHost(&bfr, std::max<size_t>(buffer_size, 1))); }
+    for (auto &event : events_) {
+      CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    }
+  }
+
+  ~stripe_staging_buffers()
+  {
+    for (auto event : events_) {
+      cudaEventSynchronize(event);
+      cudaEventDestroy(event);
+    }
+    for (auto bfr : buffers_) { cudaFreeHost(bfr); }
+  }
+
+  uint8_t *buffer(size_t stripe_id) const { return buffers_[stripe_id % buffers_.size()]; }
+
+  /**
+   * @brief Marks the end of the copies into the stripe's buffer
+   **/
+  void copies_issued(size_t stripe_id, cudaStream_t stream)
+  {
+    CUDA_TRY(cudaEventRecord(events_[stripe_id % events_.size()], stream));
+  }
+
+  /**
+   * @brief Waits until the stripe's data has arrived in its buffer
+   **/
+  void wait(size_t stripe_id) const
+  {
+    CUDA_TRY(cudaEventSynchronize(events_[stripe_id % events_.size()]));
+  }
+
+ private:
+  std::array<uint8_t *, 2> buffers_{};
+  std::array<cudaEvent_t, 2> events_{};
+};
+
+/**
+ * @brief Returns the number of bits of the dictionary indices of a column
+ **/
+uint32_t dictionary_index_bits(size_t num_dict_strings)
+{
+  uint32_t dict_bits = 0;
+  for (dict_bits = 1; dict_bits < 32; dict_bits <<= 1) {
+    if (num_dict_strings <= (1ull << dict_bits)) break;
+  }
+  return dict_bits;
+}
+
+/**
+ * @brief Returns the number of distinct strings estimated from a HyperLogLog sketch
+ **/
+double estimate_distinct_strings(std::array<uint8_t, gpu::dict_hll_registers> const &registers)
+{
+  constexpr double num_registers = gpu::dict_hll_registers;
+  constexpr double alpha         = 0.709;  // Bias correction for 64 registers
+  double inverse_sum             = 0;
+  uint32_t num_zeros             = 0;
+  for (auto reg : registers) {
+    inverse_sum += std::ldexp(1.0, -reg);
+    num_zeros += (reg == 0);
+  }
+  auto const raw = alpha * num_registers * num_registers / inverse_sum;
+  // Linear counting of the empty registers is more accurate for small cardinalities
+  if (raw <= 2.5 * num_registers && num_zeros != 0) {
+    return num_registers * std::log(num_registers / num_zeros);
+  }
+  return raw;
+}
+
+/**
+ * @brief Returns the device memory holding the data of a stream
+ **/
+uint8_t const *get_stream_data(gpu::StripeStream const &strm_desc,
+                               gpu::EncChunk const &chunk,
+                               uint8_t const *compressed_data,
+                               bool is_compressed)
+{
+  return is_compressed ? (compressed_data + strm_desc.bfr_offset)
+                       : chunk.streams[strm_desc.stream_type];
+}
 
 /**
  * @brief Function that translates GDF compression to ORC compression
@@ -77,6 +180,7 @@ constexpr orc::TypeKind to_orc_type(cudf::type_id id)
     case cudf::type_id::TIMESTAMP_MILLISECONDS:
     case cudf::type_id::TIMESTAMP_NANOSECONDS: return TypeKind::TIMESTAMP;
     case cudf::type_id::STRING: return TypeKind::STRING;
+    case cudf::type_id::STRUCT: return TypeKind::STRUCT;
     default: return TypeKind::INVALID_TYPE_KIND;
   }
 }
@@ -96,6 +200,223 @@ constexpr T to_clockscale(cudf::type_id timestamp_id)
   }
 }
 
+/**
+ * @brief Columns of the ORC schema, each STRUCT column being followed by its fields
+ **/
+struct orc_schema_columns {
+  std::vector<column_view> columns;
+  std::vector<int> parents;       // Struct of each field, -1 for the columns of the table
+  std::vector<size_t> table_ids;  // Column of the table holding each column
+  std::vector<std::string> names;
+};
+
+/**
+ * @brief Appends a column and the fields of a STRUCT column to the columns of the schema
+ **/
+void flatten_column(column_view const &col,
+                    int parent,
+                    size_t table_id,
+                    std::string name,
+                    orc_schema_columns &schema)
+{
+  auto const id = static_cast<int>(schema.columns.size());
+  schema.columns.push_back(col);
+  schema.parents.push_back(parent);
+  schema.table_ids.push_back(table_id);
+  schema.names.push_back(std::move(name));
+  if (col.type().id() == type_id::STRUCT) {
+    structs_column_view const structs(col);
+    for (size_type i = 0; i < structs.num_children(); ++i) {
+      flatten_column(structs.child(i), id, table_id, "_field" + std::to_string(i), schema);
+    }
+  }
+}
+
+/**
+ * @brief Returns whether a row of a column holds a valid struct, for the fields of the struct
+ *
+ * The rows of each rowgroup of the column are at the start of the rowgroup; `row_map` maps them
+ * to the rows of the table, or is null when the column holds the rows of the table.
+ **/
+struct is_struct_row {
+  uint32_t const *rowgroup_rows;
+  size_type const *row_map;
+  column_device_view structs;
+  size_type row_index_stride;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    auto const rowgroup_row = static_cast<uint32_t>(row % row_index_stride);
+    if (rowgroup_row >= rowgroup_rows[row / row_index_stride]) { return 0; }
+    auto const table_row = (row_map != nullptr) ? row_map[row] : row;
+    return (table_row < structs.size() && structs.is_valid(table_row)) ? 1 : 0;
+  }
+};
+
+/**
+ * @brief Returns the stripe of a row, from the stripe of each rowgroup
+ **/
+struct rowgroup_stripe {
+  uint32_t const *stripes;
+  size_type row_index_stride;
+
+  __device__ uint32_t operator()(size_type row) const { return stripes[row / row_index_stride]; }
+};
+
+/**
+ * @brief Maps the rows of a field to the rows of the table: the valid structs of each stripe,
+ * from the first row of the stripe
+ **/
+struct scatter_field_rows {
+  is_struct_row is_valid;
+  rowgroup_stripe stripe;
+  size_type const *stripe_first_rows;
+  size_type const *ranks;
+  size_type *field_map;
+
+  __device__ void operator()(size_type row) const
+  {
+    if (is_valid(row)) {
+      field_map[stripe_first_rows[stripe(row)] + ranks[row]] =
+        (is_valid.row_map != nullptr) ? is_valid.row_map[row] : row;
+    }
+  }
+};
+
+/**
+ * @brief Fields of structs with nulls, gathered to the valid rows of their struct
+ **/
+struct compacted_fields {
+  std::vector<column_view> columns;                  // Gathered columns, or the input columns
+  std::vector<std::vector<uint32_t>> rowgroup_rows;  // Rows of each rowgroup of gathered columns
+  std::vector<std::unique_ptr<column>> values;
+  std::vector<rmm::device_buffer> null_masks;
+};
+
+/**
+ * @brief Gathers the fields of the structs with nulls to the valid rows of the structs
+ *
+ * ORC only stores the values of fields for the valid rows of their struct. In each stripe, the
+ * values are gathered from the first row of the stripe: all the rowgroups of the stripe are full
+ * but the last ones, so that each stream of the stripe is encoded in consecutive chunks.
+ *
+ * @param schema Columns of the ORC schema
+ * @param stripe_list Number of rowgroups of each stripe
+ * @param row_index_stride Number of rows of a rowgroup
+ * @param num_rows Number of rows of the table
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+compacted_fields compact_struct_fields(orc_schema_columns const &schema,
+                                       std::vector<uint32_t> const &stripe_list,
+                                       size_type row_index_stride,
+                                       size_type num_rows,
+                                       cudaStream_t stream)
+{
+  auto const num_columns   = schema.columns.size();
+  auto const num_rowgroups = (num_rows + row_index_stride - 1) / row_index_stride;
+  compacted_fields fields;
+  fields.columns = schema.columns;
+  fields.rowgroup_rows.resize(num_columns);
+
+  std::vector<uint32_t> rowgroup_stripes;
+  std::vector<size_type> stripe_first_rows;
+  for (size_t s = 0; s < stripe_list.size(); ++s) {
+    stripe_first_rows.push_back(rowgroup_stripes.size() * row_index_stride);
+    rowgroup_stripes.insert(rowgroup_stripes.end(), stripe_list[s], s);
+  }
+  rmm::device_vector<uint32_t> const d_rowgroup_stripes = rowgroup_stripes;
+  rmm::device_vector<size_type> const d_stripe_first_rows = stripe_first_rows;
+  rowgroup_stripe const stripe{d_rowgroup_stripes.data().get(), row_index_stride};
+
+  // Table row of each row of the gathered columns, and rows of each rowgroup
+  std::vector<rmm::device_vector<size_type>> row_maps(num_columns);
+  std::vector<std::vector<uint32_t>> rows(num_columns);
+  auto execpol   = rmm::exec_policy(stream);
+  auto const row = thrust::make_counting_iterator<size_type>(0);
+  for (size_t i = 0; i < num_columns; ++i) {
+    auto const parent = schema.parents[i];
+    if (parent < 0) {
+      for (size_type g = 0; g < num_rowgroups; ++g) {
+        rows[i].push_back(std::min(row_index_stride, num_rows - g * row_index_stride));
+      }
+      continue;
+    }
+    if (schema.columns[parent].null_count() == 0) {
+      row_maps[i] = row_maps[parent];
+      rows[i]     = rows[parent];
+    } else {
+      rmm::device_vector<uint32_t> const parent_rows = rows[parent];
+      auto const structs = column_device_view::create(schema.columns[parent], stream);
+      is_struct_row const is_valid{
+        parent_rows.data().get(),
+        row_maps[parent].empty() ? nullptr : row_maps[parent].data().get(),
+        *structs,
+        row_index_stride};
+      auto const keys  = thrust::make_transform_iterator(row, stripe);
+      auto const flags = thrust::make_transform_iterator(row, is_valid);
+      rmm::device_vector<size_type> ranks(num_rows);
+      thrust::exclusive_scan_by_key(
+        execpol->on(stream), keys, keys + num_rows, flags, ranks.begin());
+      rmm::device_vector<size_type> counts(stripe_list.size());
+      thrust::reduce_by_key(execpol->on(stream),
+                            keys,
+                            keys + num_rows,
+                            flags,
+                            thrust::make_discard_iterator(),
+                            counts.begin());
+      row_maps[i] = rmm::device_vector<size_type>(num_rows, num_rows);
+      thrust::for_each(execpol->on(stream),
+                       row,
+                       row + num_rows,
+                       scatter_field_rows{is_valid,
+                                          stripe,
+                                          d_stripe_first_rows.data().get(),
+                                          ranks.data().get(),
+                                          row_maps[i].data().get()});
+      std::vector<size_type> stripe_counts(stripe_list.size());
+      CUDA_TRY(cudaMemcpyAsync(stripe_counts.data(),
+                               counts.data().get(),
+                               counts.size() * sizeof(size_type),
+                               cudaMemcpyDeviceToHost,
+                               stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+      for (size_type g = 0; g < num_rowgroups; ++g) {
+        auto const s          = rowgroup_stripes[g];
+        auto const stripe_row = g * row_index_stride - stripe_first_rows[s];
+        rows[i].push_back(std::min(row_index_stride, std::max(stripe_counts[s] - stripe_row, 0)));
+      }
+    }
+    if (row_maps[i].empty()) { continue; }
+
+    auto const &col         = schema.columns[i];
+    fields.rowgroup_rows[i] = rows[i];
+    if (col.type().id() == type_id::STRUCT) {
+      // Only the null mask of the struct is encoded, its fields being gathered on their own
+      rmm::device_vector<uint32_t> const struct_rows = rows[i];
+      auto const structs = column_device_view::create(col, stream);
+      is_struct_row const is_valid{
+        struct_rows.data().get(), row_maps[i].data().get(), *structs, row_index_stride};
+      auto valid = cudf::detail::valid_if(row, row + num_rows, is_valid, stream);
+      fields.null_masks.push_back(std::move(valid.first));
+      auto const null_mask = static_cast<bitmask_type const *>(fields.null_masks.back().data());
+      fields.columns[i] = column_view(col.type(), num_rows, nullptr, null_mask, valid.second);
+    } else {
+      column_view const gather_map(
+        data_type{type_id::INT32}, num_rows, row_maps[i].data().get());
+      fields.values.push_back(
+        std::move(cudf::detail::gather(table_view{{col}},
+                                       gather_map,
+                                       cudf::detail::out_of_bounds_policy::NULLIFY,
+                                       cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                       rmm::mr::get_default_resource(),
+                                       stream)
+                    ->release()[0]));
+      fields.columns[i] = fields.values.back()->view();
+    }
+  }
+  return fields;
+}
+
 }  // namespace
 
 /**
@@ -136,21 +457,30 @@ class orc_column_view {
   /**
    * @brief Constructor that extracts out the string position + length pairs
    * for building dictionaries for string columns
+   *
+   * The fields of a STRUCT column are columns of their own, following the struct; `parent` is the
+   * index of the struct column, -1 for the columns of the table.
    **/
   explicit orc_column_view(size_t id,
                            size_t str_id,
+                           size_t table_id,
+                           int parent,
                            column_view const &col,
-                           const table_metadata *metadata,
+                           std::string name,
                            cudaStream_t stream)
     : _id(id),
       _str_id(str_id),
+      _table_id(table_id),
+      _parent(parent),
       _string_type(col.type().id() == type_id::STRING),
-      _type_width(_string_type ? 0 : cudf::size_of(col.type())),
+      _type_width((_string_type || col.type().id() == type_id::STRUCT) ? 0
+                                                                       : cudf::size_of(col.type())),
       _data_count(col.size()),
       _null_count(col.null_count()),
       _data(col.head<uint8_t>() + col.offset() * _type_width),
       _nulls(col.nullable() ? col.null_mask() : nullptr),
       _clockscale(to_clockscale<uint8_t>(col.type().id())),
+      _name(std::move(name)),
       _type_kind(to_orc_type(col.type().id()))
   {
     if (_string_type && _data_count > 0) {
@@ -165,12 +495,6 @@ class orc_column_view {
       _data = _indexes.data();
       CUDA_TRY(cudaStreamSynchronize(stream));
     }
-    // Generating default name if name isn't present in metadata
-    if (metadata && _id < metadata->column_names.size()) {
-      _name = metadata->column_names[_id];
-    } else {
-      _name = "_col" + std::to_string(_id);
-    }
   }
 
   auto is_string() const noexcept { return _string_type; }
@@ -208,6 +532,22 @@ class orc_column_view {
   }
   auto device_stripe_dict() const { return d_stripe_dict; }
 
+  size_t table_id() const noexcept { return _table_id; }
+  int parent() const noexcept { return _parent; }
+
+  /**
+   * @brief Function that sets the number of rows of each rowgroup, for the fields of structs
+   * with nulls, which only hold values for the valid rows of the struct
+   **/
+  void set_rowgroup_rows(std::vector<uint32_t> rows) { _rowgroup_rows = std::move(rows); }
+  uint32_t rowgroup_rows(size_t rowgroup, size_t row_index_stride) const
+  {
+    if (!_rowgroup_rows.empty()) { return _rowgroup_rows[rowgroup]; }
+    auto const start_row = static_cast<int64_t>(rowgroup * row_index_stride);
+    return std::min<int64_t>(row_index_stride,
+                             std::max<int64_t>(static_cast<int64_t>(_data_count) - start_row, 0));
+  }
+
   size_t type_width() const noexcept { return _type_width; }
   size_t data_count() const noexcept { return _data_count; }
   size_t null_count() const noexcept { return _null_count; }
@@ -225,7 +565,10 @@ class orc_column_view {
   // Identifier within set of columns and string columns, respectively
   size_t _id        = 0;
   size_t _str_id    = 0;
+  size_t _table_id  = 0;  // Column of the table holding the column
+  int _parent       = -1;
   bool _string_type = false;
+  std::vector<uint32_t> _rowgroup_rows;
 
   size_t _type_width     = 0;
   size_t _data_count     = 0;
@@ -271,8 +614,7 @@ void writer::impl::init_dictionaries(orc_column_view *columns,
       ck->dict_data         = dict_data + i * num_rows + g * row_index_stride_;
       ck->dict_index        = dict_index + i * num_rows;  // Indexed by abs row
       ck->start_row         = g * row_index_stride_;
-      ck->num_rows          = std::min<uint32_t>(row_index_stride_,
-                                        std::max<int>(str_column.data_count() - ck->start_row, 0));
+      ck->num_rows          = str_column.rowgroup_rows(g, row_index_stride_);
       ck->num_strings       = 0;
       ck->string_char_count = 0;
       ck->num_dict_strings  = 0;
@@ -301,8 +643,10 @@ void writer::impl::build_dictionaries(orc_column_view *columns,
   const auto num_rowgroups = dict.size() / str_col_ids.size();
 
   for (size_t i = 0; i < str_col_ids.size(); i++) {
-    size_t direct_cost = 0, dict_cost = 0;
-    auto &str_column = columns[str_col_ids[i]];
+    size_t direct_cost  = 0;
+    double dict_chars   = 0;
+    double dict_strings = 0;
+    auto &str_column    = columns[str_col_ids[i]];
     str_column.attach_stripe_dict(stripe_dict.host_ptr(), stripe_dict.device_ptr());
 
     for (size_t j = 0, g = 0; j < stripe_list.size(); j++) {
@@ -316,17 +660,35 @@ void writer::impl::build_dictionaries(orc_column_view *columns,
       sd->num_chunks        = num_chunks;
       sd->num_strings       = 0;
       sd->dict_char_count   = 0;
+      std::array<uint8_t, gpu::dict_hll_registers> registers{};
+      size_t chunk_dict_chars = 0;
       for (size_t k = g; k < g + num_chunks; k++) {
         const auto &dt = dict[k * str_col_ids.size() + i];
         sd->num_strings += dt.num_dict_strings;
         direct_cost += dt.string_char_count;
-        dict_cost += dt.dict_char_count + dt.num_dict_strings;
+        chunk_dict_chars += dt.dict_char_count;
+        for (size_t r = 0; r < registers.size(); r++) {
+          registers[r] = std::max(registers[r], dt.hll_registers[r]);
+        }
+      }
+      // The chunks only detect some of their duplicates, so their dictionaries overestimate the
+      // stripe dictionary; scale them down to the distinct strings estimated by the sketch
+      if (sd->num_strings != 0) {
+        auto const distinct =
+          std::min<double>(std::max(estimate_distinct_strings(registers), 1.0), sd->num_strings);
+        dict_strings += distinct;
+        dict_chars += chunk_dict_chars * distinct / sd->num_strings;
       }
 
       g += num_chunks;
     }
 
-    // Early disable of dictionary if it doesn't look good at the chunk level
+    // Early disable of dictionary if its estimated size, including the indices, is not smaller
+    // than the string data; this skips the sort of high-cardinality stripe dictionaries
+    auto const valid_count = str_column.data_count() - str_column.null_count();
+    auto const dict_cost =
+      dict_chars + dict_strings +
+      dictionary_index_bits(static_cast<size_t>(dict_strings)) * valid_count / 8.0;
     if (enable_dictionary_ && dict_cost >= direct_cost) {
       for (size_t j = 0; j < stripe_list.size(); j++) {
         stripe_dict[j * str_col_ids.size() + i].dict_data = nullptr;
@@ -383,8 +745,11 @@ std::vector<Stream> writer::impl::gather_streams(orc_column_view *columns,
     if (state.single_write_mode) {
       is_nullable = (columns[i].nullable() || columns[i].data_count() < num_rows);
     } else {
-      is_nullable = (i < state.user_metadata_with_nullability.column_nullable.size())
-                      ? state.user_metadata_with_nullability.column_nullable[i]
+      // The nullability of the fields of structs is not specified
+      auto const table_id = columns[i].table_id();
+      is_nullable         = (columns[i].parent() < 0 &&
+                     table_id < state.user_metadata_with_nullability.column_nullable.size())
+                      ? state.user_metadata_with_nullability.column_nullable[table_id]
                       : true;
     }
     if (is_nullable) {
@@ -448,10 +813,7 @@ std::vector<Stream> writer::impl::gather_streams(orc_column_view *columns,
           }
         }
         if (enable_dict) {
-          uint32_t dict_bits = 0;
-          for (dict_bits = 1; dict_bits < 32; dict_bits <<= 1) {
-            if (dict_strings <= (1ull << dict_bits)) break;
-          }
+          const auto dict_bits   = dictionary_index_bits(dict_strings);
           const auto valid_count = columns[i].data_count() - columns[i].null_count();
           dict_data_size += (dict_bits * valid_count + 7) >> 3;
         }
@@ -475,6 +837,10 @@ std::vector<Stream> writer::impl::gather_streams(orc_column_view *columns,
         data2_kind        = SECONDARY;
         encoding_kind     = DIRECT_V2;
         break;
+      case TypeKind::STRUCT:
+        // Only the PRESENT stream; the fields are columns of their own
+        encoding_kind = DIRECT;
+        break;
       default: CUDF_FAIL("Unsupported ORC type kind");
     }
 
@@ -558,7 +924,7 @@ rmm::device_buffer writer::impl::encode_columns(orc_column_view *columns,
     for (size_t i = 0; i < num_columns; i++) {
       auto *ck          = &chunks[j * num_columns + i];
       ck->start_row     = (j * row_index_stride_);
-      ck->num_rows      = std::min<uint32_t>(row_index_stride_, num_rows - ck->start_row);
+      ck->num_rows      = columns[i].rowgroup_rows(j, row_index_stride_);
       ck->valid_rows    = columns[i].data_count();
       ck->encoding_kind = columns[i].orc_encoding();
       ck->type_kind     = columns[i].orc_kind();
@@ -775,9 +1141,9 @@ std::vector<std::vector<uint8_t>> writer::impl::gather_statistic_blobs(
                            stream));
   CUDA_TRY(gpu::orc_init_statistics_groups(stat_groups.data().get(),
                                            stat_desc.device_ptr(),
+                                           chunks.device_ptr(),
                                            num_columns,
                                            num_rowgroups,
-                                           row_index_stride_,
                                            stream));
   CUDA_TRY(
     GatherColumnStatistics(stat_chunks.data().get(), stat_groups.data().get(), num_chunks, stream));
@@ -826,6 +1192,59 @@ std::vector<std::vector<uint8_t>> writer::impl::gather_statistic_blobs(
   return stat_blobs;
 }
 
+std::vector<std::vector<uint8_t>> writer::impl::build_bloom_filters(
+  orc_column_view const *columns,
+  size_t num_columns,
+  size_t num_rowgroups,
+  std::vector<bool> const &has_filter,
+  uint32_t num_bits,
+  uint32_t num_hashes,
+  cudaStream_t stream)
+{
+  auto const num_filter_columns = std::count(has_filter.begin(), has_filter.end(), true);
+  auto const words_per_filter   = num_bits / 32;
+  rmm::device_buffer words(num_rowgroups * num_filter_columns * words_per_filter * 4, stream);
+  CUDA_TRY(cudaMemsetAsync(words.data(), 0, words.size(), stream));
+
+  std::vector<gpu::BloomFilterChunk> h_chunks;
+  h_chunks.reserve(num_rowgroups * num_filter_columns);
+  for (size_t g = 0; g < num_rowgroups; g++) {
+    for (size_t i = 0; i < num_columns; i++) {
+      if (!has_filter[i]) { continue; }
+      gpu::BloomFilterChunk ck{};
+      ck.valid_map_base   = columns[i].nulls();
+      ck.column_data_base = columns[i].data();
+      ck.start_row        = g * row_index_stride_;
+      ck.num_rows         = row_index_stride_;
+      ck.valid_rows       = columns[i].data_count();
+      ck.type_kind        = columns[i].orc_kind();
+      ck.num_hashes       = num_hashes;
+      ck.num_bits         = num_bits;
+      ck.words = static_cast<uint32_t *>(words.data()) + h_chunks.size() * words_per_filter;
+      h_chunks.push_back(ck);
+    }
+  }
+  rmm::device_vector<gpu::BloomFilterChunk> d_chunks = h_chunks;
+  CUDA_TRY(gpu::BuildBloomFilters(d_chunks.data().get(), h_chunks.size(), stream));
+
+  std::vector<uint8_t> h_words(words.size());
+  CUDA_TRY(cudaMemcpyAsync(
+    h_words.data(), words.data(), words.size(), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  std::vector<std::vector<uint8_t>> bitsets(num_rowgroups * num_columns);
+  size_t filter_idx = 0;
+  for (size_t g = 0; g < num_rowgroups; g++) {
+    for (size_t i = 0; i < num_columns; i++) {
+      if (!has_filter[i]) { continue; }
+      auto const first = h_words.begin() + filter_idx * words_per_filter * 4;
+      bitsets[g * num_columns + i].assign(first, first + words_per_filter * 4);
+      filter_idx++;
+    }
+  }
+  return bitsets;
+}
+
 void writer::impl::write_index_stream(int32_t stripe_id,
                                       int32_t stream_id,
                                       orc_column_view *columns,
@@ -916,7 +1335,7 @@ void writer::impl::write_index_stream(int32_t stripe_id,
 void writer::impl::write_data_stream(gpu::StripeStream const &strm_desc,
                                      gpu::EncChunk const &chunk,
                                      uint8_t const *compressed_data,
-                                     uint8_t *stream_out,
+                                     uint8_t const *staged_data,
                                      StripeInformation &stripe,
                                      std::vector<Stream> &streams,
                                      cudaStream_t stream)
@@ -924,12 +1343,14 @@ void writer::impl::write_data_stream(gpu::StripeStream const &strm_desc,
   const auto length                                    = strm_desc.stream_size;
   streams[chunk.strm_id[strm_desc.stream_type]].length = length;
   if (length != 0) {
-    const auto *stream_in = (compression_kind_ == NONE) ? chunk.streams[strm_desc.stream_type]
-                                                        : (compressed_data + strm_desc.bfr_offset);
-    CUDA_TRY(cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream));
-    CUDA_TRY(cudaStreamSynchronize(stream));
-
-    out_sink_->host_write(stream_out, length);
+    if (staged_data != nullptr) {
+      out_sink_->host_write(staged_data, length);
+    } else {
+      out_sink_->device_write(
+        get_stream_data(strm_desc, chunk, compressed_data, compression_kind_ != NONE),
+        length,
+        stream);
+    }
   }
   stripe.dataLength += length;
 }
@@ -959,9 +1380,17 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
                    rmm::mr::device_memory_resource *mr)
   : compression_kind_(to_orc_compression(options.compression)),
     enable_statistics_(options.enable_statistics),
+    bloom_filter_columns_(options.bloom_filter_columns),
+    bloom_filter_fpp_(options.bloom_filter_fpp),
     out_sink_(std::move(sink)),
-    _mr(mr)
+    _mr(mr),
+    metrics_(options.metrics)
 {
+  if (metrics_ != nullptr) {
+    auto metered  = std::make_unique<metered_sink>(std::move(out_sink_));
+    metered_sink_ = metered.get();
+    out_sink_     = std::move(metered);
+  }
 }
 
 void writer::impl::write(table_view const &table,
@@ -986,31 +1415,64 @@ void writer::impl::write_chunked_begin(orc_chunked_state &state)
 
 void writer::impl::write_chunked(table_view const &table, orc_chunked_state &state)
 {
-  size_type num_columns = table.num_columns();
-  size_type num_rows    = 0;
+  size_type num_rows = 0;
 
   // Mapping of string columns for quick look-up
   std::vector<int> str_col_ids;
 
+  CUDF_EXPECTS(bloom_filter_columns_.empty() ||
+                 bloom_filter_columns_.size() == static_cast<size_t>(table.num_columns()),
+               "Bloom filter flags must be specified for all columns");
+  CUDF_EXPECTS(bloom_filter_fpp_ > 0 && bloom_filter_fpp_ < 1,
+               "Bloom filter false positive probability must be in (0, 1)");
+
   if (state.user_metadata_with_nullability.column_nullable.size() > 0) {
     CUDF_EXPECTS(state.user_metadata_with_nullability.column_nullable.size() ==
-                   static_cast<size_t>(num_columns),
+                   static_cast<size_t>(table.num_columns()),
                  "When passing values in user_metadata_with_nullability, data for all columns must "
                  "be specified");
   }
 
-  // Wrapper around cudf columns to attach ORC-specific type info
-  std::vector<orc_column_view> orc_columns;
-  orc_columns.reserve(num_columns);  // Avoids unnecessary re-allocation
-  for (auto it = table.begin(); it < table.end(); ++it) {
-    const auto col            = *it;
-    const auto current_id     = orc_columns.size();
-    const auto current_str_id = str_col_ids.size();
-
+  // Columns of the schema, the fields of STRUCT columns following their struct
+  orc_schema_columns schema;
+  for (size_type i = 0; i < table.num_columns(); ++i) {
+    auto const &col = table.column(i);
+    // Generating default name if name isn't present in metadata
+    std::string name = "_col" + std::to_string(i);
+    if (state.user_metadata && static_cast<size_t>(i) < state.user_metadata->column_names.size()) {
+      name = state.user_metadata->column_names[i];
+    }
     num_rows = std::max<uint32_t>(num_rows, col.size());
-    orc_columns.emplace_back(current_id, current_str_id, col, state.user_metadata, state.stream);
-    if (orc_columns.back().is_string()) { str_col_ids.push_back(current_id); }
+    flatten_column(col, -1, i, std::move(name), schema);
   }
+  size_type const num_columns = schema.columns.size();
+  auto const is_struct = [](column_view const &col) { return col.type().id() == type_id::STRUCT; };
+  bool const has_struct = std::any_of(schema.columns.begin(), schema.columns.end(), is_struct);
+  bool const has_struct_nulls =
+    std::any_of(schema.columns.begin(), schema.columns.end(), [&](column_view const &col) {
+      return is_struct(col) && col.null_count() != 0;
+    });
+  CUDF_EXPECTS(!has_struct || bloom_filter_columns_.empty(),
+               "Bloom filters are not supported with struct columns");
+
+  // Wrapper around cudf columns to attach ORC-specific type info
+  std::vector<orc_column_view> orc_columns;
+  auto make_orc_columns = [&](std::vector<column_view> const &columns) {
+    orc_columns.clear();
+    str_col_ids.clear();
+    orc_columns.reserve(num_columns);  // Avoids unnecessary re-allocation
+    for (size_type i = 0; i < num_columns; ++i) {
+      orc_columns.emplace_back(i,
+                               str_col_ids.size(),
+                               schema.table_ids[i],
+                               schema.parents[i],
+                               columns[i],
+                               schema.names[i],
+                               state.stream);
+      if (orc_columns.back().is_string()) { str_col_ids.push_back(i); }
+    }
+  };
+  make_orc_columns(schema.columns);
 
   rmm::device_vector<uint32_t> dict_index(str_col_ids.size() * num_rows);
   rmm::device_vector<uint32_t> dict_data(str_col_ids.size() * num_rows);
@@ -1055,6 +1517,27 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
     if (g + 1 == num_rowgroups) { stripe_list.push_back(num_rowgroups - stripe_start); }
   }
 
+  // The fields of structs with nulls only hold the values of the valid structs
+  compacted_fields fields;
+  if (has_struct_nulls) {
+    fields = compact_struct_fields(schema, stripe_list, row_index_stride_, num_rows, state.stream);
+    make_orc_columns(fields.columns);
+    for (size_type i = 0; i < num_columns; ++i) {
+      if (!fields.rowgroup_rows[i].empty()) {
+        orc_columns[i].set_rowgroup_rows(fields.rowgroup_rows[i]);
+      }
+    }
+    if (str_col_ids.size() != 0) {
+      init_dictionaries(orc_columns.data(),
+                        num_rows,
+                        str_col_ids,
+                        dict_data.data().get(),
+                        dict_index.data().get(),
+                        dict,
+                        state.stream);
+    }
+  }
+
   // Build stripe-level dictionaries
   const auto num_stripe_dict = stripe_list.size() * str_col_ids.size();
   hostdevice_vector<gpu::StripeDictionary> stripe_dict(num_stripe_dict);
@@ -1075,6 +1558,7 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
     gather_streams(orc_columns.data(), orc_columns.size(), num_rows, stripe_list, strm_ids, state);
 
   // Encode column data chunks
+  metrics_timer encode_timer(metrics_, &io_metrics::encode_ms, state.stream);
   const auto num_chunks = num_rowgroups * num_columns;
   hostdevice_vector<gpu::EncChunk> chunks(num_chunks);
   auto output = encode_columns(orc_columns.data(),
@@ -1101,6 +1585,38 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
                                 chunks,
                                 strm_desc,
                                 state.stream);
+  encode_timer.stop();
+
+  // Build the bloom filters of the row groups of the selected columns
+  auto const bloom_filter_bits = bloom_filter_num_bits(row_index_stride_, bloom_filter_fpp_);
+  auto const bloom_filter_hashes =
+    bloom_filter_num_hashes(row_index_stride_, bloom_filter_bits);
+  std::vector<bool> has_bloom_filter(num_columns, false);
+  for (int i = 0; i < num_columns && !bloom_filter_columns_.empty(); i++) {
+    switch (orc_columns[i].orc_kind()) {
+      case BYTE:
+      case SHORT:
+      case INT:
+      case LONG:
+      case DATE:
+      case FLOAT:
+      case DOUBLE:
+      case STRING: has_bloom_filter[i] = bloom_filter_columns_[i]; break;
+      default: break;
+    }
+  }
+  std::vector<std::vector<uint8_t>> bloom_filters;
+  if (std::find(has_bloom_filter.begin(), has_bloom_filter.end(), true) !=
+        has_bloom_filter.end() &&
+      num_rows > 0) {
+    bloom_filters = build_bloom_filters(orc_columns.data(),
+                                        num_columns,
+                                        num_rowgroups,
+                                        has_bloom_filter,
+                                        bloom_filter_bits,
+                                        bloom_filter_hashes,
+                                        state.stream);
+  }
 
   // Gather column statistics
   std::vector<std::vector<uint8_t>> column_stats;
@@ -1118,40 +1634,33 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
   // Allocate intermediate output stream buffer
   size_t compressed_bfr_size   = 0;
   size_t num_compressed_blocks = 0;
-  auto stream_output           = [&]() {
-    size_t max_stream_size = 0;
-
+  size_t uncompressed_size     = 0;
+  if (compression_kind_ != NONE) {
     for (size_t stripe_id = 0; stripe_id < stripe_list.size(); stripe_id++) {
       for (size_t i = 0; i < num_data_streams; i++) {
         gpu::StripeStream *ss = &strm_desc[stripe_id * num_data_streams + i];
-        size_t stream_size    = ss->stream_size;
-        if (compression_kind_ != NONE) {
-          ss->first_block = num_compressed_blocks;
-          ss->bfr_offset  = compressed_bfr_size;
-
-          auto num_blocks = std::max<uint32_t>(
-            (stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
-          stream_size += num_blocks * 3;
-          num_compressed_blocks += num_blocks;
-          compressed_bfr_size += stream_size;
-        }
-        max_stream_size = std::max(max_stream_size, stream_size);
+        ss->first_block       = num_compressed_blocks;
+        ss->bfr_offset        = compressed_bfr_size;
+
+        auto num_blocks = std::max<uint32_t>(
+          (ss->stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
+        num_compressed_blocks += num_blocks;
+        compressed_bfr_size += ss->stream_size + num_blocks * 3;
+        uncompressed_size += ss->stream_size;
       }
     }
-
-    return pinned_buffer<uint8_t>{[](size_t size) {
-                                    uint8_t *ptr = nullptr;
-                                    CUDA_TRY(cudaMallocHost(&ptr, size));
-                                    return ptr;
-                                  }(max_stream_size),
-                                  cudaFreeHost};
-  }();
+  }
 
   // Compress the data streams
   rmm::device_buffer compressed_data(compressed_bfr_size, state.stream);
   hostdevice_vector<gpu_inflate_status_s> comp_out(num_compressed_blocks);
   hostdevice_vector<gpu_inflate_input_s> comp_in(num_compressed_blocks);
+  if (metrics_ != nullptr) {
+    metrics_->peak_scratch_bytes =
+      std::max(metrics_->peak_scratch_bytes, output.size() + compressed_bfr_size);
+  }
   if (compression_kind_ != NONE) {
+    metrics_timer timer(metrics_, &io_metrics::compression_ms, state.stream);
     CUDA_TRY(cudaMemcpyAsync(strm_desc.device_ptr(),
                              strm_desc.host_ptr(),
                              strm_desc.memory_size(),
@@ -1178,19 +1687,78 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
                              cudaMemcpyDeviceToHost,
                              state.stream));
     CUDA_TRY(cudaStreamSynchronize(state.stream));
+    timer.stop();
+    if (metrics_ != nullptr) {
+      auto &codec = metrics_->codecs[gpu_codec_name(gpu_codec::SNAPPY)];
+      codec.num_blocks += num_compressed_blocks;
+      codec.uncompressed_bytes += uncompressed_size;
+      for (size_t i = 0; i < num_stripe_streams; i++) {
+        codec.compressed_bytes += strm_desc[i].stream_size;
+      }
+    }
   }
 
   ProtobufWriter pbw_(&buffer_);
 
+  // First rowgroup of each stripe
+  std::vector<size_t> stripe_groups(stripes.size() + 1, 0);
+  for (size_t stripe_id = 0; stripe_id < stripes.size(); stripe_id++) {
+    stripe_groups[stripe_id + 1] =
+      stripe_groups[stripe_id] + div_by_rowgroups(stripes[stripe_id].numberOfRows);
+  }
+
+  // Unless the sink reads device memory itself, the final (compressed) data streams of each
+  // stripe are copied to pinned memory one stripe ahead of the sink writes, so that the
+  // device-to-host copies overlap with writing the previous stripe. The staging memory is
+  // bounded by two stripes instead of growing with the table.
+  const bool use_device_write = out_sink_->supports_device_write();
+  size_t max_stripe_data_size = 0;
+  for (size_t stripe_id = 0; stripe_id < stripes.size(); stripe_id++) {
+    size_t stripe_data_size = 0;
+    for (size_t i = 0; i < num_data_streams; i++) {
+      stripe_data_size += strm_desc[stripe_id * num_data_streams + i].stream_size;
+    }
+    max_stripe_data_size = std::max(max_stripe_data_size, stripe_data_size);
+  }
+  std::unique_ptr<stripe_staging_buffers> staging;
+  if (!use_device_write && !stripes.empty()) {
+    staging = std::make_unique<stripe_staging_buffers>(max_stripe_data_size);
+  }
+  auto stage_stripe_data = [&](size_t stripe_id) {
+    auto dst = staging->buffer(stripe_id);
+    for (size_t i = 0; i < num_data_streams; i++) {
+      const auto &ss = strm_desc[stripe_id * num_data_streams + i];
+      const auto &ck = chunks[stripe_groups[stripe_id] * num_columns + ss.column_id];
+      if (ss.stream_size != 0) {
+        CUDA_TRY(cudaMemcpyAsync(dst,
+                                 get_stream_data(ss,
+                                                 ck,
+                                                 static_cast<uint8_t *>(compressed_data.data()),
+                                                 compression_kind_ != NONE),
+                                 ss.stream_size,
+                                 cudaMemcpyDeviceToHost,
+                                 state.stream));
+        dst += ss.stream_size;
+      }
+    }
+    staging->copies_issued(stripe_id, state.stream);
+  };
+  if (staging) { stage_stripe_data(0); }
+
   // Write stripes
-  size_t group = 0;
   for (size_t stripe_id = 0; stripe_id < stripes.size(); stripe_id++) {
-    auto groups_in_stripe     = div_by_rowgroups(stripes[stripe_id].numberOfRows);
-    stripes[stripe_id].offset = out_sink_->bytes_written();
+    const auto group            = stripe_groups[stripe_id];
+    const auto groups_in_stripe = stripe_groups[stripe_id + 1] - group;
+    stripes[stripe_id].offset   = out_sink_->bytes_written();
+
+    // Start copying the next stripe's data while this one is being written
+    if (staging && stripe_id + 1 < stripes.size()) { stage_stripe_data(stripe_id + 1); }
 
     // Column (skippable) index streams appear at the start of the stripe
+    // Files with struct columns have no row index: the fields of structs with nulls hold fewer
+    // rows than the rowgroups of the table
     stripes[stripe_id].indexLength = 0;
-    for (size_t col_id = 0; col_id <= (size_t)num_columns; col_id++) {
+    for (size_t col_id = 0; col_id <= (size_t)num_columns && !has_struct; col_id++) {
       write_index_stream(stripe_id,
                          col_id,
                          orc_columns.data(),
@@ -1206,8 +1774,35 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
                          &pbw_);
     }
 
+    // Bloom filter streams follow the row index streams
+    std::vector<Stream> bloom_filter_streams;
+    for (int i = 0; i < num_columns && !bloom_filters.empty(); i++) {
+      if (!has_bloom_filter[i]) { continue; }
+      BloomFilterIndex index;
+      index.bloomFilter.resize(groups_in_stripe);
+      for (size_t g = 0; g < groups_in_stripe; g++) {
+        auto const &bitset                    = bloom_filters[(group + g) * num_columns + i];
+        index.bloomFilter[g].numHashFunctions = bloom_filter_hashes;
+        index.bloomFilter[g].utf8bitset.assign(bitset.begin(), bitset.end());
+      }
+      buffer_.resize((compression_kind_ != NONE) ? 3 : 0);
+      pbw_.write(&index);
+      add_uncompressed_block_headers(buffer_);
+      out_sink_->host_write(buffer_.data(), buffer_.size());
+      stripes[stripe_id].indexLength += buffer_.size();
+      bloom_filter_streams.push_back(
+        {BLOOM_FILTER_UTF8, static_cast<uint32_t>(i + 1), buffer_.size()});
+    }
+
     // Column data consisting one or more separate streams
     stripes[stripe_id].dataLength = 0;
+    const uint8_t *staged_data    = nullptr;
+    if (staging) {
+      // Only the part of the copy that is not hidden behind the previous writes is counted
+      metrics_timer timer(metrics_, &io_metrics::d2h_copy_ms, state.stream, false);
+      staging->wait(stripe_id);
+      staged_data = staging->buffer(stripe_id);
+    }
     for (size_t i = 0; i < num_data_streams; i++) {
       const auto &ss = strm_desc[stripe_id * num_data_streams + i];
       const auto &ck = chunks[group * num_columns + ss.column_id];
@@ -1215,15 +1810,22 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
       write_data_stream(ss,
                         ck,
                         static_cast<uint8_t *>(compressed_data.data()),
-                        stream_output.get(),
+                        staged_data,
                         stripes[stripe_id],
                         streams,
                         state.stream);
+      if (staged_data != nullptr) { staged_data += ss.stream_size; }
     }
 
     // Write stripefooter consisting of stream information
     StripeFooter sf;
     sf.streams = streams;
+    sf.streams.insert(sf.streams.begin() + num_index_streams,
+                      bloom_filter_streams.begin(),
+                      bloom_filter_streams.end());
+    if (has_struct) {
+      sf.streams.erase(sf.streams.begin(), sf.streams.begin() + num_index_streams);
+    }
     sf.columns.resize(num_columns + 1);
     sf.columns[0].kind           = DIRECT;
     sf.columns[0].dictionarySize = 0;
@@ -1244,8 +1846,6 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
       buffer_[2]             = static_cast<uint8_t>(uncomp_sf_len >> 16);
     }
     out_sink_->host_write(buffer_.data(), buffer_.size());
-
-    group += groups_in_stripe;
   }
 
   if (column_stats.size() != 0) {
@@ -1286,22 +1886,23 @@ void writer::impl::write_chunked(table_view const &table, orc_chunked_state &sta
   if (state.ff.headerLength == 0) {
     // First call
     state.ff.headerLength   = std::strlen(MAGIC);
-    state.ff.rowIndexStride = row_index_stride_;
+    state.ff.rowIndexStride = has_struct ? 0 : row_index_stride_;
     state.ff.types.resize(1 + num_columns);
     state.ff.types[0].kind = STRUCT;
-    state.ff.types[0].subtypes.resize(num_columns);
-    state.ff.types[0].fieldNames.resize(num_columns);
     for (int i = 0; i < num_columns; ++i) {
-      state.ff.types[1 + i].kind      = orc_columns[i].orc_kind();
-      state.ff.types[0].subtypes[i]   = 1 + i;
-      state.ff.types[0].fieldNames[i] = orc_columns[i].orc_name();
+      auto &parent_type          = state.ff.types[orc_columns[i].parent() + 1];
+      state.ff.types[1 + i].kind = orc_columns[i].orc_kind();
+      parent_type.subtypes.push_back(1 + i);
+      parent_type.fieldNames.push_back(orc_columns[i].orc_name());
     }
   } else {
     // verify the user isn't passing mismatched tables
     CUDF_EXPECTS(state.ff.types.size() == 1 + orc_columns.size(),
                  "Mismatch in table structure between multiple calls to write_chunked");
     for (auto i = 0; i < num_columns; i++) {
-      CUDF_EXPECTS(state.ff.types[1 + i].kind == orc_columns[i].orc_kind(),
+      auto const &subtypes = state.ff.types[orc_columns[i].parent() + 1].subtypes;
+      CUDF_EXPECTS(state.ff.types[1 + i].kind == orc_columns[i].orc_kind() &&
+                     std::find(subtypes.begin(), subtypes.end(), 1 + i) != subtypes.end(),
                    "Mismatch in column types between multiple calls to write_chunked");
     }
   }
@@ -1348,6 +1949,7 @@ void writer::impl::write_chunked_end(orc_chunked_state &state)
   buffer_.push_back(ps_length);
   out_sink_->host_write(buffer_.data(), buffer_.size());
   out_sink_->flush();
+  if (metered_sink_ != nullptr) { metered_sink_->take_metrics(*metrics_); }
 }
 
 // Forward to implementation
@@ -25,6 +25,7 @@
 #include "orc_gpu.h"
 
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/io_metrics.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/data_sink.hpp>
@@ -245,6 +246,28 @@ class writer::impl {
     hostdevice_vector<gpu::EncChunk>& chunks,
     cudaStream_t stream);
 
+  /**
+   * @brief Returns the bloom filter bitsets of the row groups of the columns
+   *
+   * @param columns List of columns
+   * @param num_columns Total number of columns
+   * @param num_rowgroups Total number of row groups
+   * @param has_filter Whether each column has a bloom filter
+   * @param num_bits Number of bits of each filter
+   * @param num_hashes Number of hash functions of each filter
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The bitsets, indexed by `rowgroup * num_columns + column` and empty for columns
+   * without a filter
+   **/
+  std::vector<std::vector<uint8_t>> build_bloom_filters(orc_column_view const* columns,
+                                                        size_t num_columns,
+                                                        size_t num_rowgroups,
+                                                        std::vector<bool> const& has_filter,
+                                                        uint32_t num_bits,
+                                                        uint32_t num_hashes,
+                                                        cudaStream_t stream);
+
   /**
    * @brief Write the specified column's row index stream
    *
@@ -281,7 +304,8 @@ class writer::impl {
    * @param strm_desc Stream's descriptor
    * @param chunk First column chunk of the stream
    * @param compressed_data Compressed stream data
-   * @param stream_out Temporary host output buffer
+   * @param staged_data Host copy of the stream data; nullptr to write from device memory with
+   * `data_sink::device_write`
    * @param stripe Stream's parent stripe
    * @param streams List of all streams
    * @param stream CUDA stream used for device memory operations and kernel launches.
@@ -289,7 +313,7 @@ class writer::impl {
   void write_data_stream(gpu::StripeStream const& strm_desc,
                          gpu::EncChunk const& chunk,
                          uint8_t const* compressed_data,
-                         uint8_t* stream_out,
+                         uint8_t const* staged_data,
                          StripeInformation& stripe,
                          std::vector<Stream>& streams,
                          cudaStream_t stream);
@@ -336,8 +360,15 @@ class writer::impl {
   bool enable_dictionary_ = true;
   bool enable_statistics_ = true;
 
+  std::vector<bool> bloom_filter_columns_;
+  double bloom_filter_fpp_ = 0.05;
+
   std::vector<uint8_t> buffer_;
   std::unique_ptr<data_sink> out_sink_;
+
+  // Metrics of the writes and the wrapper of the sink counting them, if requested
+  io_metrics* metrics_        = nullptr;
+  metered_sink* metered_sink_ = nullptr;
 };
 
 }  // namespace orc
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "packed.hpp"
+
+#include <io/utilities/pinned_memory_pool.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace packed {
+constexpr char file_header::expected_magic[8];
+constexpr uint32_t file_header::current_version;
+constexpr uint64_t file_header::data_alignment;
+
+namespace {
+/**
+ * @brief Pinned staging buffer from the pool, for the sinks and sources without device IO
+ */
+class staging_buffer {
+ public:
+  explicit staging_buffer(size_t size)
+    : _size{size}, _data{static_cast<uint8_t*>(pinned_memory_pool::instance().allocate(size))}
+  {
+  }
+  ~staging_buffer() { pinned_memory_pool::instance().deallocate(_data, _size); }
+  staging_buffer(staging_buffer const&) = delete;
+  staging_buffer& operator=(staging_buffer const&) = delete;
+
+  uint8_t* data() const { return _data; }
+  size_t size() const { return _size; }
+
+ private:
+  size_t _size;
+  uint8_t* _data;
+};
+
+}  // namespace
+
+void write(data_sink* sink, packed_columns const& packed, cudaStream_t stream)
+{
+  auto const& metadata = *packed.metadata;
+  auto const data_size = packed.gpu_data != nullptr ? packed.gpu_data->size() : 0;
+
+  auto const end_of_metadata = sizeof(file_header) + metadata.size();
+  auto const alignment       = file_header::data_alignment;
+
+  file_header header{};
+  std::copy(std::begin(file_header::expected_magic),
+            std::end(file_header::expected_magic),
+            std::begin(header.magic));
+  header.version       = file_header::current_version;
+  header.metadata_size = metadata.size();
+  header.data_offset   = (end_of_metadata + alignment - 1) / alignment * alignment;
+  header.data_size     = data_size;
+
+  sink->host_write(&header, sizeof(header));
+  sink->host_write(metadata.data(), metadata.size());
+  std::vector<uint8_t> const padding(header.data_offset - end_of_metadata, 0);
+  sink->host_write(padding.data(), padding.size());
+
+  if (data_size != 0) {
+    auto const gpu_data = static_cast<uint8_t const*>(packed.gpu_data->data());
+    if (sink->supports_device_write()) {
+      sink->device_write(gpu_data, data_size, stream);
+    } else {
+      staging_buffer staging(std::min<size_t>(data_size, pinned_memory_pool::max_block_size));
+      for (size_t offset = 0; offset < data_size; offset += staging.size()) {
+        auto const len = std::min(staging.size(), data_size - offset);
+        CUDA_TRY(cudaMemcpyAsync(
+          staging.data(), gpu_data + offset, len, cudaMemcpyDeviceToHost, stream));
+        CUDA_TRY(cudaStreamSynchronize(stream));
+        sink->host_write(staging.data(), len);
+      }
+    }
+  }
+  sink->flush();
+}
+
+packed_columns read(datasource* source, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  CUDF_EXPECTS(source->size() >= sizeof(file_header), "Not a packed table file");
+  file_header header{};
+  source->host_read(0, sizeof(header), reinterpret_cast<uint8_t*>(&header));
+  CUDF_EXPECTS(std::equal(std::begin(header.magic),
+                          std::end(header.magic),
+                          std::begin(file_header::expected_magic)),
+               "Not a packed table file");
+  CUDF_EXPECTS(header.version == file_header::current_version,
+               "Unsupported packed table file version");
+  CUDF_EXPECTS(header.data_offset >= sizeof(header) + header.metadata_size and
+                 header.data_offset + header.data_size <= source->size(),
+               "Truncated packed table file");
+
+  packed_columns result;
+  result.metadata = std::make_unique<std::vector<uint8_t>>(header.metadata_size);
+  source->host_read(sizeof(header), header.metadata_size, result.metadata->data());
+
+  result.gpu_data = std::make_unique<rmm::device_buffer>(header.data_size, stream, mr);
+  if (header.data_size == 0) { return result; }
+  auto const gpu_data = static_cast<uint8_t*>(result.gpu_data->data());
+  if (source->supports_device_read()) {
+    auto const read = source->device_read(header.data_offset, header.data_size, gpu_data);
+    CUDF_EXPECTS(read == header.data_size, "Truncated packed table file");
+  } else {
+    // File sources are memory mapped: the data is copied from the mapping without a
+    // host-side copy
+    auto const data = source->host_read(header.data_offset, header.data_size);
+    CUDA_TRY(cudaMemcpyAsync(
+      gpu_data, data->data(), header.data_size, cudaMemcpyHostToDevice, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+  return result;
+}
+
+}  // namespace packed
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
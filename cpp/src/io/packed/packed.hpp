@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace packed {
+/**
+ * @brief Header at the start of a packed table file
+ *
+ * The header is followed by the metadata blob of `pack` and, at `data_offset`, by the packed
+ * device data. The data is aligned on `data_alignment` bytes so that GPUDirect Storage can read
+ * it straight into device memory.
+ */
+struct file_header {
+  static constexpr char expected_magic[8] = {'C', 'U', 'D', 'F', 'P', 'A', 'C', 'K'};
+  static constexpr uint32_t current_version = 1;
+  static constexpr uint64_t data_alignment  = 4096;
+
+  char magic[8];
+  uint32_t version;
+  uint32_t reserved;
+  uint64_t metadata_size;
+  uint64_t data_offset;
+  uint64_t data_size;
+};
+
+/**
+ * @brief Writes a packed table to a sink, from device memory if the sink supports it
+ *
+ * @param sink Sink to append the file to
+ * @param packed The packed table
+ * @param stream CUDA stream used for device memory operations
+ */
+void write(data_sink* sink, packed_columns const& packed, cudaStream_t stream);
+
+/**
+ * @brief Reads a packed table from a source, into device memory if the source supports it
+ *
+ * @throws cudf::logic_error if the source does not hold a packed table file
+ *
+ * @param source Source holding the file
+ * @param mr Device memory resource used to allocate the returned device buffer
+ * @param stream CUDA stream used for device memory operations
+ * @return The packed table, whose view is returned by `unpack`
+ */
+packed_columns read(datasource* source, rmm::mr::device_memory_resource* mr, cudaStream_t stream);
+
+}  // namespace packed
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bloom_filter.cuh"
+#include "parquet_gpu.h"
+
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
+
+namespace cudf {
+namespace io {
+namespace parquet {
+namespace gpu {
+namespace {
+template <typename T>
+__device__ uint64_t hash_plain_value(T value)
+{
+  return XXHash_64<T>{}.compute(value);
+}
+
+/**
+ * @brief Returns the XXH64 hash of the plain encoding of a value of a column
+ *
+ * The values are first converted to their physical type, as done by the page encoder.
+ */
+__device__ uint64_t hash_column_value(EncColumnDesc const &col, uint32_t row)
+{
+  auto const data = col.column_data_base;
+  switch (col.stats_dtype) {
+    case dtype_int8:
+      return hash_plain_value(static_cast<int32_t>(static_cast<int8_t const *>(data)[row]));
+    case dtype_int16:
+      return hash_plain_value(static_cast<int32_t>(static_cast<int16_t const *>(data)[row]));
+    case dtype_int32:
+    case dtype_date32: return hash_plain_value(static_cast<int32_t const *>(data)[row]);
+    case dtype_int64: return hash_plain_value(static_cast<int64_t const *>(data)[row]);
+    case dtype_timestamp64: {
+      auto v = static_cast<int64_t const *>(data)[row];
+      if (col.ts_scale < 0) {
+        v /= -col.ts_scale;
+      } else if (col.ts_scale > 0) {
+        v *= col.ts_scale;
+      }
+      return hash_plain_value(v);
+    }
+    case dtype_float32: return hash_plain_value(static_cast<float const *>(data)[row]);
+    case dtype_float64: return hash_plain_value(static_cast<double const *>(data)[row]);
+    case dtype_string: {
+      auto const &str = static_cast<nvstrdesc_s const *>(data)[row];
+      return XXHash_64<string_view>{}(string_view(str.ptr, static_cast<size_type>(str.count)));
+    }
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Inserts the non-null values of a column chunk into its filter; one block per chunk
+ */
+__global__ void __launch_bounds__(256) gpuBuildBloomFilters(BloomFilterChunk const *chunks)
+{
+  auto const &ck  = chunks[blockIdx.x];
+  auto const &col = *ck.col_desc;
+  for (uint32_t i = threadIdx.x; i < ck.num_rows; i += blockDim.x) {
+    auto const row = ck.start_row + i;
+    if (row >= col.num_rows) { break; }
+    auto const valid = col.valid_map_base;
+    if (valid != nullptr && !((valid[row >> 5] >> (row & 0x1f)) & 1)) { continue; }
+    auto const hash = hash_column_value(col, row);
+    auto block      = ck.words + bloom_filter_block(hash, ck.num_blocks) * bloom_filter_block_words;
+    for (int j = 0; j < bloom_filter_block_words; ++j) {
+      atomicOr(block + j, bloom_filter_mask(hash, j));
+    }
+  }
+}
+
+}  // namespace
+
+cudaError_t BuildBloomFilters(BloomFilterChunk const *chunks,
+                              uint32_t num_chunks,
+                              cudaStream_t stream)
+{
+  gpuBuildBloomFilters<<<num_chunks, 256, 0, stream>>>(chunks);
+  return cudaSuccess;
+}
+
+}  // namespace gpu
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @file bloom_filter.cuh
+ * @brief Split-block bloom filters of the Parquet format
+ *
+ * A filter is an array of 256-bit blocks of eight 32-bit words. A value is inserted by hashing its
+ * plain encoding with XXH64 (null seed): the upper half of the hash selects a block, and the lower
+ * half multiplied by a different salt for each word selects one bit in each word of the block.
+ */
+
+namespace cudf {
+namespace io {
+namespace parquet {
+constexpr int bloom_filter_block_words    = 8;
+constexpr size_t bloom_filter_block_bytes = bloom_filter_block_words * sizeof(uint32_t);
+constexpr size_t min_bloom_filter_size    = 32;
+constexpr size_t max_bloom_filter_size    = 128 * 1024 * 1024;
+
+/**
+ * @brief Returns the index of the block of a filter holding the bits of a hash
+ */
+CUDA_HOST_DEVICE_CALLABLE uint32_t bloom_filter_block(uint64_t hash, uint32_t num_blocks)
+{
+  return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+/**
+ * @brief Returns the bit set by a hash in the word `i` of its block
+ */
+CUDA_HOST_DEVICE_CALLABLE uint32_t bloom_filter_mask(uint64_t hash, int i)
+{
+  constexpr uint32_t salt[bloom_filter_block_words] = {0x47b6137bu,
+                                                       0x44974d91u,
+                                                       0x8824ad5bu,
+                                                       0xa2b7289du,
+                                                       0x705495c7u,
+                                                       0x2df1424bu,
+                                                       0x9efc4947u,
+                                                       0x5c6bfb31u};
+  return 1u << ((static_cast<uint32_t>(hash) * salt[i]) >> 27);
+}
+
+/**
+ * @brief Returns the size in bytes of a filter for a number of distinct values
+ *
+ * The size is the smallest power of two that achieves the false positive probability, within the
+ * limits of the format.
+ *
+ * @param num_values Number of distinct values
+ * @param fpp False positive probability
+ */
+inline size_t bloom_filter_size(size_t num_values, double fpp)
+{
+  auto const num_bits = -8.0 * num_values / std::log(1.0 - std::pow(fpp, 1.0 / 8));
+  size_t size         = min_bloom_filter_size;
+  while (size < max_bloom_filter_size && size * 8 < num_bits) { size *= 2; }
+  return size;
+}
+
+/**
+ * @brief Returns whether a filter may contain a value, from the hash of the value
+ *
+ * @param bitset Little-endian words of the filter
+ * @param size Size of the filter in bytes
+ * @param hash XXH64 hash of the plain encoding of the value
+ *
+ * @return `false` if the value was not inserted into the filter
+ */
+inline bool bloom_filter_may_contain(uint8_t const *bitset, size_t size, uint64_t hash)
+{
+  auto const num_blocks = static_cast<uint32_t>(size / bloom_filter_block_bytes);
+  if (num_blocks == 0) { return true; }
+  auto const block = bitset + bloom_filter_block(hash, num_blocks) * bloom_filter_block_bytes;
+  for (int i = 0; i < bloom_filter_block_words; ++i) {
+    uint32_t word;
+    std::memcpy(&word, block + i * sizeof(uint32_t), sizeof(word));
+    if ((word & bloom_filter_mask(hash, i)) == 0) { return false; }
+  }
+  return true;
+}
+
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
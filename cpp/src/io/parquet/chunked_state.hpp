@@ -43,6 +43,12 @@ struct pq_chunked_state {
   cudf::io::parquet::FileMetaData md;
   /// current write position for rowgroups/chunks
   std::size_t current_chunk_offset;
+  /// Page indexes of each column chunk [rowgroup][column], written during write_chunked_end()
+  std::vector<cudf::io::parquet::ColumnIndex> column_indexes;
+  std::vector<cudf::io::parquet::OffsetIndex> offset_indexes;
+  /// Bloom filter bitset of each column chunk [rowgroup][column] (empty if none), written during
+  /// write_chunked_end()
+  std::vector<std::vector<uint8_t>> bloom_filters;
   /// optional user metadata
   table_metadata_with_nullability user_metadata_with_nullability;
   /// special parameter only used by detail::write() to indicate that we are guaranteeing
@@ -62,6 +68,17 @@ struct pq_chunked_state {
   }
 };
 
+/**
+ * @brief Chunked reader state struct. Holds the reader, and thus the parsed file metadata, across
+ *        the begin() / read() / end() call process.
+ */
+struct pq_chunked_read_state {
+  /// The reader to be used
+  std::unique_ptr<reader> rp;
+  /// Cuda stream to be used
+  cudaStream_t stream = 0;
+};
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
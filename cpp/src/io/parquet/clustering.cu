@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "clustering.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+namespace {
+// A Z-order code interleaves the leading bits of each clustering column into 64 bits, so that
+// each of 8 columns keeps at least 8 bits
+constexpr int z_order_code_bits      = 64;
+constexpr size_t max_z_order_columns = 8;
+
+/**
+ * @brief Maps a value to an unsigned integer that orders as the value does
+ */
+template <typename T, std::enable_if_t<std::is_unsigned<T>::value>* = nullptr>
+__device__ uint64_t ordered_bits(T value)
+{
+  return static_cast<uint64_t>(value);
+}
+
+template <typename T,
+          std::enable_if_t<std::is_integral<T>::value and std::is_signed<T>::value>* = nullptr>
+__device__ uint64_t ordered_bits(T value)
+{
+  return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ (uint64_t{1} << 63);
+}
+
+// Positive floats order as their bits with the sign bit set, negative floats as their inverted
+// bits
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+__device__ uint64_t ordered_bits(T value)
+{
+  using bits_type          = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+  constexpr bits_type sign = bits_type{1} << (8 * sizeof(T) - 1);
+  bits_type bits;
+  memcpy(&bits, &value, sizeof(T));
+  return (bits & sign) ? static_cast<bits_type>(~bits) : (bits | sign);
+}
+
+template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+__device__ uint64_t ordered_bits(T value)
+{
+  return ordered_bits(value.time_since_epoch().count());
+}
+
+template <typename T, std::enable_if_t<cudf::is_duration<T>()>* = nullptr>
+__device__ uint64_t ordered_bits(T value)
+{
+  return ordered_bits(value.count());
+}
+
+template <typename T>
+constexpr bool is_z_orderable()
+{
+  return cudf::is_numeric<T>() or cudf::is_timestamp<T>() or cudf::is_duration<T>();
+}
+
+/**
+ * @brief Range of the ordered bits of the valid values of a column
+ */
+struct key_range {
+  uint64_t min;
+  uint64_t max;
+};
+
+struct key_range_op {
+  __device__ key_range operator()(key_range const& lhs, key_range const& rhs) const
+  {
+    return {lhs.min < rhs.min ? lhs.min : rhs.min, lhs.max > rhs.max ? lhs.max : rhs.max};
+  }
+};
+
+template <typename T>
+struct key_range_fn {
+  column_device_view col;
+
+  __device__ key_range operator()(size_type i) const
+  {
+    if (col.is_null(i)) { return {std::numeric_limits<uint64_t>::max(), 0}; }
+    auto const key = ordered_bits(col.element<T>(i));
+    return {key, key};
+  }
+};
+
+/**
+ * @brief Adds the bits of the rank of each value of a column to the Z-order codes of its rows
+ *
+ * The rank is the offset of the value from the column minimum, reduced to `bits` bits. Bit `b`
+ * of the rank goes to bit `b * num_columns` of the code, plus an offset that gives the first
+ * clustering column the most significant bit of each group. Null values have rank 0.
+ */
+template <typename T>
+struct interleave_bits_fn {
+  column_device_view col;
+  uint64_t* codes;
+  uint64_t min_key;
+  int shift;
+  int bits;
+  int position;
+  int num_columns;
+
+  __device__ void operator()(size_type i) const
+  {
+    if (col.is_null(i)) { return; }
+    auto const rank = (ordered_bits(col.element<T>(i)) - min_key) >> shift;
+    uint64_t code   = 0;
+    for (int b = 0; b < bits; ++b) {
+      code |= ((rank >> b) & 1) << (b * num_columns + num_columns - 1 - position);
+    }
+    codes[i] |= code;
+  }
+};
+
+struct z_order_column_fn {
+  template <typename T>
+  std::enable_if_t<is_z_orderable<T>()> operator()(column_view const& col,
+                                                   int position,
+                                                   int num_columns,
+                                                   uint64_t* codes,
+                                                   cudaStream_t stream) const
+  {
+    auto const d_col = column_device_view::create(col, stream);
+    auto const range = thrust::transform_reduce(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(col.size()),
+      key_range_fn<T>{*d_col},
+      key_range{std::numeric_limits<uint64_t>::max(), 0},
+      key_range_op{});
+    if (range.min > range.max) { return; }  // all null
+
+    // Only the leading bits of the range of the column are kept
+    auto const span     = range.max - range.min;
+    int const span_bits = (span == 0) ? 0 : 64 - __builtin_clzll(span);
+    int const bits      = z_order_code_bits / num_columns;
+    int const shift     = std::max(0, span_bits - bits);
+    thrust::for_each(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(col.size()),
+      interleave_bits_fn<T>{*d_col, codes, range.min, shift, bits, position, num_columns});
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_z_orderable<T>()> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Z-order clustering requires numeric, timestamp or duration columns");
+  }
+};
+
+struct span_index_fn {
+  size_type segment_rows;
+
+  __device__ size_type operator()(size_type i) const { return i / segment_rows; }
+};
+
+}  // namespace
+
+std::unique_ptr<table> cluster_rows(table_view const& input,
+                                    std::vector<size_type> const& columns,
+                                    row_clustering clustering,
+                                    size_type segment_rows,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream)
+{
+  CUDF_EXPECTS(not columns.empty(), "Row clustering requires clustering columns");
+  for (auto col : columns) {
+    CUDF_EXPECTS(col >= 0 && col < input.num_columns(), "Invalid clustering column index");
+  }
+  auto const num_rows = input.num_rows();
+  if (num_rows == 0) { return std::make_unique<table>(input, stream, mr); }
+
+  // The rows are sorted by span first, so that they stay within their span
+  std::vector<column_view> keys;
+  std::unique_ptr<column> spans;
+  if (num_rows > segment_rows) {
+    spans = make_numeric_column(
+      data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_rows),
+                      spans->mutable_view().begin<size_type>(),
+                      span_index_fn{segment_rows});
+    keys.push_back(spans->view());
+  }
+
+  std::unique_ptr<column> codes;
+  if (clustering == row_clustering::Z_ORDER) {
+    CUDF_EXPECTS(columns.size() <= max_z_order_columns,
+                 "Z-order clustering supports up to 8 columns");
+    codes = make_numeric_column(
+      data_type{type_id::UINT64}, num_rows, mask_state::UNALLOCATED, stream);
+    auto const d_codes = codes->mutable_view().data<uint64_t>();
+    CUDA_TRY(cudaMemsetAsync(d_codes, 0, num_rows * sizeof(uint64_t), stream));
+    for (size_t j = 0; j < columns.size(); ++j) {
+      auto const col = input.column(columns[j]);
+      type_dispatcher(col.type(),
+                      z_order_column_fn{},
+                      col,
+                      static_cast<int>(j),
+                      static_cast<int>(columns.size()),
+                      d_codes,
+                      stream);
+    }
+    keys.push_back(codes->view());
+  } else {
+    for (auto col : columns) { keys.push_back(input.column(col)); }
+  }
+
+  auto const order = cudf::detail::sorted_order(
+    table_view{keys}, {}, {}, rmm::mr::get_default_resource(), stream);
+  return cudf::detail::gather(input,
+                              order->view(),
+                              cudf::detail::out_of_bounds_policy::IGNORE,
+                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                              mr,
+                              stream);
+}
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
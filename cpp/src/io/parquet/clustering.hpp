@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+/**
+ * @brief Reorders the rows of each span of `segment_rows` rows of a table by clustering columns
+ *
+ * Rows do not move between spans, so that a row group of at most `segment_rows` rows holds the
+ * rows of at most two spans, each in clustered order.
+ *
+ * @throws cudf::logic_error if there are no clustering columns or an index is out of range
+ * @throws cudf::logic_error if a `Z_ORDER` column is not numeric, timestamp or duration, or if
+ * there are more than 8 `Z_ORDER` columns
+ *
+ * @param input Table to cluster
+ * @param columns Indices of the clustering columns in `input`
+ * @param clustering `SORT` to sort the rows of a span lexicographically by the columns,
+ * `Z_ORDER` to sort them by the Morton code of the columns
+ * @param segment_rows Number of rows of each span
+ * @param mr Device memory resource used to allocate the returned table
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The clustered rows of `input`
+ */
+std::unique_ptr<table> cluster_rows(table_view const& input,
+                                    std::vector<size_type> const& columns,
+                                    row_clustering clustering,
+                                    size_type segment_rows,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream);
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -59,6 +59,7 @@ struct page_state_s {
   int32_t dict_pos;     // write position of dictionary indices
   int32_t out_pos;      // read position of final output
   int32_t ts_scale;     // timestamp scale: <0: divide by -ts_scale, >0: multiply by ts_scale
+  int32_t str_sizes;    // output the sizes of the strings instead of their characters
   uint32_t nz_idx[NZ_BFRSZ];    // circular buffer of non-null row positions
   uint32_t dict_idx[NZ_BFRSZ];  // Dictionary index, boolean, or string offset values
   uint32_t str_len[NZ_BFRSZ];   // String length for plain encoding of strings
@@ -536,17 +537,37 @@ __device__ void gpuInitStringDescriptors(volatile page_state_s *s, int target_po
 }
 
 /**
- * @brief Output a string descriptor
+ * @brief Returns whether a column chunk is output as a strings column, as opposed to 32-bit
+ * hashes or dictionary indices
+ **/
+inline __device__ bool is_string_output(ColumnChunkDesc const &col)
+{
+  return (col.data_type & 7) == BYTE_ARRAY && (col.data_type >> 3) != 4;
+}
+
+/**
+ * @brief Output a string
+ *
+ * Strings are output in two passes: the first one stores the size of each string at its row
+ * offset, and the second one, once the sizes are scanned into offsets, copies the characters of
+ * each string to `str_chars` at its offset.
  *
  * @param[in,out] s Page state input/output
  * @param[in] src_pos Source position
- * @param[in] dstv Pointer to row output data (string descriptor or 32-bit hash)
+ * @param[in] dstv Pointer to row output data (string offset, 32-bit hash or dictionary index)
  **/
 inline __device__ void gpuOutputString(volatile page_state_s *s, int src_pos, void *dstv)
 {
   const char *ptr = NULL;
   size_t len      = 0;
 
+  if ((s->col.data_type >> 3) == 4 && s->col.str_dict_base >= 0) {
+    // Output dictionary index, offset to the dictionaries of all the chunks of the column
+    uint32_t dict_idx = (s->dict_bits > 0) ? s->dict_idx[src_pos & (NZ_BFRSZ - 1)] : 0;
+    *reinterpret_cast<uint32_t *>(dstv) = s->col.str_dict_base + dict_idx;
+    return;
+  }
+
   if (s->dict_base) {
     // String dictionary
     uint32_t dict_pos =
@@ -564,14 +585,16 @@ inline __device__ void gpuOutputString(volatile page_state_s *s, int src_pos, vo
       len = s->str_len[src_pos & (NZ_BFRSZ - 1)];
     }
   }
-  if (s->dtype_len == 4) {
+  if ((s->col.data_type >> 3) == 4) {
     // Output hash
     *reinterpret_cast<uint32_t *>(dstv) = device_str2hash32(ptr, len);
+  } else if (s->str_sizes) {
+    // Output string size
+    *reinterpret_cast<int32_t *>(dstv) = len;
   } else {
-    // Output string descriptor
-    nvstrdesc_s *dst = reinterpret_cast<nvstrdesc_s *>(dstv);
-    dst->ptr         = ptr;
-    dst->count       = len;
+    // Output string characters
+    char *dst = s->col.str_chars + *reinterpret_cast<int32_t *>(dstv);
+    for (size_t i = 0; i < len; i++) { dst[i] = ptr[i]; }
   }
 }
 
@@ -938,10 +961,17 @@ static __device__ void gpuOutputGeneric(volatile page_state_s *s,
  * @param[in] min_row crop all rows below min_row
  * @param[in] num_rows Maximum number of rows to read
  * @param[in] num_chunks Number of column chunks
+ * @param[in] string_sizes Whether to only decode the string sizes of the string chunks, leaving
+ * the null masks and the page info unchanged
  **/
 // blockDim {NTHREADS,1,1}
-extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
-  PageInfo *pages, ColumnChunkDesc *chunks, size_t min_row, size_t num_rows, int32_t num_chunks)
+extern "C" __global__ void __launch_bounds__(NTHREADS)
+  gpuDecodePageData(PageInfo *pages,
+                    ColumnChunkDesc *chunks,
+                    size_t min_row,
+                    size_t num_rows,
+                    int32_t num_chunks,
+                    bool string_sizes)
 {
   __shared__ __align__(16) page_state_s state_g;
 
@@ -966,14 +996,22 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
     }
   }
   __syncthreads();
+  if (string_sizes && !is_string_output(s->col)) { return; }
   if (!t) {
     s->num_rows         = 0;
     s->page.valid_count = 0;
     s->error            = 0;
+    s->str_sizes        = string_sizes;
     if (s->page.num_values > 0 && s->page.num_rows > 0) {
       uint8_t *cur           = s->page.page_data;
       uint8_t *end           = cur + s->page.uncompressed_page_size;
       size_t page_start_row  = s->col.start_row + s->page.chunk_row;
+      // Columns with output levels (lists and struct fields) are output in full, one position
+      // per value, and the rows are assembled from their levels afterwards
+      if (s->col.level_data[0] != nullptr) {
+        min_row  = 0;
+        num_rows = s->col.start_row + s->col.num_values;
+      }
       uint32_t dtype_len_out = s->col.data_type >> 3;
       s->ts_scale            = 0;
       // Validate data type
@@ -998,7 +1036,7 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
           // Fall through to DOUBLE
         case DOUBLE: s->dtype_len = 8; break;
         case INT96: s->dtype_len = 12; break;
-        case BYTE_ARRAY: s->dtype_len = sizeof(nvstrdesc_s); break;
+        case BYTE_ARRAY: s->dtype_len = sizeof(int32_t); break;  // String offsets
         default:  // FIXED_LEN_BYTE_ARRAY:
           s->dtype_len = dtype_len_out;
           s->error |= (s->dtype_len <= 0);
@@ -1011,14 +1049,12 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
       } else if ((s->col.data_type & 7) == INT32) {
         if (dtype_len_out == 1) s->dtype_len = 1;  // INT8 output
         if (dtype_len_out == 2) s->dtype_len = 2;  // INT16 output
-      } else if ((s->col.data_type & 7) == BYTE_ARRAY && dtype_len_out == 4) {
-        s->dtype_len = 4;  // HASH32 output
       } else if ((s->col.data_type & 7) == INT96) {
         s->dtype_len = 8;  // Convert to 64-bit timestamp
       }
       // Setup local valid map and compute first & num rows relative to the current page
       s->data_out         = reinterpret_cast<uint8_t *>(s->col.column_data_base);
-      s->valid_map        = s->col.valid_map_base;
+      s->valid_map        = string_sizes ? nullptr : s->col.valid_map_base;
       s->valid_map_offset = 0;
       if (page_start_row >= min_row) {
         if (s->data_out) { s->data_out += (page_start_row - min_row) * s->dtype_len; }
@@ -1035,12 +1071,12 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
       if (page_start_row + s->num_rows > min_row + num_rows) {
         s->num_rows = (int32_t)max((int64_t)(min_row + num_rows - page_start_row), INT64_C(0));
       }
+      // Find the compressed size of repetition levels, stored before the definition levels
+      cur +=
+        InitLevelSection(s, cur, end, s->page.repetition_level_encoding, s->col.rep_level_bits, 1);
       // Find the compressed size of definition levels
       cur +=
         InitLevelSection(s, cur, end, s->page.definition_level_encoding, s->col.def_level_bits, 0);
-      // Find the compressed size of repetition levels
-      cur +=
-        InitLevelSection(s, cur, end, s->page.repetition_level_encoding, s->col.rep_level_bits, 1);
       s->dict_bits = 0;
       s->dict_base = 0;
       s->dict_size = 0;
@@ -1149,7 +1185,7 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
     __syncthreads();
   }
   __syncthreads();
-  if (!t) {
+  if (!t && !string_sizes) {
     // Update the number of rows (after cropping to [min_row, min_row+num_rows-1]), and number of
     // valid values
     pages[page_idx].num_rows    = s->num_rows - s->first_row;
@@ -1157,6 +1193,122 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
   }
 }
 
+/**
+ * @brief Decode a repetition or definition level section (single warp)
+ *
+ * @param[in] cur Start of the level section
+ * @param[in] end End of the page data
+ * @param[in] encoding The encoding type
+ * @param[in] level_bits The bits required
+ * @param[in] num_values Number of levels to decode
+ * @param[out] out Output levels
+ * @param[in] t Warp thread ID (0..31)
+ *
+ * @return The end of the level section
+ **/
+__device__ const uint8_t *DecodeLevelSection(const uint8_t *cur,
+                                             const uint8_t *end,
+                                             int encoding,
+                                             int level_bits,
+                                             int32_t num_values,
+                                             uint8_t *out,
+                                             int t)
+{
+  int32_t pos = 0;
+  if (level_bits != 0 && encoding == RLE && cur + 4 <= end) {
+    uint32_t len = (cur[0]) + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24);
+    cur += 4;
+    len = min(len, (uint32_t)(end - cur));
+    end = cur + len;
+    while (pos < num_values && cur < end) {
+      // All the threads parse the same run header
+      uint32_t run = get_vlq32(cur, end);
+      if (run & 1) {
+        // Literal run of bit-packed groups of 8 levels
+        int32_t batch_len = min((int32_t)(run >> 1) * 8, num_values - pos);
+        for (int i = t; i < batch_len; i += 32) {
+          uint32_t bitpos    = i * level_bits;
+          const uint8_t *src = cur + (bitpos >> 3);
+          uint32_t v         = (src < end) ? src[0] : 0;
+          if (src + 1 < end) { v |= src[1] << 8; }
+          out[pos + i] = (v >> (bitpos & 7)) & ((1 << level_bits) - 1);
+        }
+        cur += (run >> 1) * level_bits;
+        pos += batch_len;
+      } else {
+        // Repeated level
+        int32_t batch_len = min((int32_t)(run >> 1), num_values - pos);
+        uint32_t v        = (cur < end) ? cur[0] : 0;
+        cur += (level_bits + 7) >> 3;
+        for (int i = t; i < batch_len; i += 32) { out[pos + i] = v; }
+        pos += batch_len;
+      }
+    }
+  }
+  // Missing levels (no level section or truncated data) are output as zero
+  for (int i = pos + t; i < num_values; i += 32) { out[i] = 0; }
+  return end;
+}
+
+/**
+ * @brief Kernel for decoding the repetition and definition levels of the pages of the columns
+ * with output levels
+ *
+ * Columns without repetition levels (struct fields) only output their definition levels.
+ *
+ * @param[in] pages List of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_pages Number of pages
+ * @param[in] num_chunks Number of column chunks
+ **/
+// blockDim {128,1,1}
+extern "C" __global__ void __launch_bounds__(128) gpuDecodePageLevels(
+  PageInfo *pages, ColumnChunkDesc const *chunks, int32_t num_pages, int32_t num_chunks)
+{
+  int page_idx = blockIdx.x * 4 + (threadIdx.x >> 5);
+  int t        = threadIdx.x & 0x1f;
+
+  if (page_idx >= num_pages) { return; }
+  PageInfo const *page = &pages[page_idx];
+  if (page->flags & PAGEINFO_FLAGS_DICTIONARY) { return; }
+  if ((uint32_t)page->chunk_idx >= (uint32_t)num_chunks) { return; }
+  ColumnChunkDesc const *ck = &chunks[page->chunk_idx];
+  if (!ck->level_data[0] || page->num_values <= 0) { return; }
+  const uint8_t *cur = page->page_data;
+  const uint8_t *end = cur + page->uncompressed_page_size;
+  size_t const pos   = ck->start_row + page->chunk_row;
+  // Repetition levels are stored first, followed by the definition levels
+  if (ck->max_rep_level > 0) {
+    if (!ck->level_data[1]) { return; }
+    cur = DecodeLevelSection(cur,
+                             end,
+                             page->repetition_level_encoding,
+                             ck->rep_level_bits,
+                             page->num_values,
+                             ck->level_data[1] + pos,
+                             t);
+  }
+  DecodeLevelSection(cur,
+                     end,
+                     page->definition_level_encoding,
+                     ck->def_level_bits,
+                     page->num_values,
+                     ck->level_data[0] + pos,
+                     t);
+}
+
+cudaError_t __host__ DecodePageLevels(PageInfo *pages,
+                                      int32_t num_pages,
+                                      ColumnChunkDesc const *chunks,
+                                      int32_t num_chunks,
+                                      cudaStream_t stream)
+{
+  dim3 dim_block(128, 1);
+  dim3 dim_grid((num_pages + 3) >> 2, 1);  // 1 warp per page
+  gpuDecodePageLevels<<<dim_grid, dim_block, 0, stream>>>(pages, chunks, num_pages, num_chunks);
+  return cudaSuccess;
+}
+
 cudaError_t __host__ DecodePageData(PageInfo *pages,
                                     int32_t num_pages,
                                     ColumnChunkDesc *chunks,
@@ -1168,7 +1320,22 @@ cudaError_t __host__ DecodePageData(PageInfo *pages,
   dim3 dim_block(NTHREADS, 1);
   dim3 dim_grid(num_pages, 1);  // 1 threadblock per page
   gpuDecodePageData<<<dim_grid, dim_block, 0, stream>>>(
-    pages, chunks, min_row, num_rows, num_chunks);
+    pages, chunks, min_row, num_rows, num_chunks, false);
+  return cudaSuccess;
+}
+
+cudaError_t __host__ ComputePageStringSizes(PageInfo *pages,
+                                            int32_t num_pages,
+                                            ColumnChunkDesc *chunks,
+                                            int32_t num_chunks,
+                                            size_t num_rows,
+                                            size_t min_row,
+                                            cudaStream_t stream)
+{
+  dim3 dim_block(NTHREADS, 1);
+  dim3 dim_grid(num_pages, 1);  // 1 threadblock per page
+  gpuDecodePageData<<<dim_grid, dim_block, 0, stream>>>(
+    pages, chunks, min_row, num_rows, num_chunks, true);
   return cudaSuccess;
 }
 
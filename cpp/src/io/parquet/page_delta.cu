@@ -0,0 +1,544 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/block_utils.cuh>
+#include "parquet_gpu.h"
+
+// Threads per page, which is also the number of deltas decoded per batch
+#define DELTA_NTHREADS 128
+#define DELTA_NWARPS (DELTA_NTHREADS / 32)
+
+namespace cudf {
+namespace io {
+namespace parquet {
+namespace gpu {
+/**
+ * @brief State of a DELTA_BINARY_PACKED stream decoder
+ *
+ * The values are decoded in batches: the first batch is the first value, stored in the stream
+ * header, and every following batch holds up to DELTA_NTHREADS deltas. As block sizes are
+ * multiples of 128 deltas, all the deltas of a batch belong to the same block.
+ **/
+struct delta_binary_s {
+  const uint8_t *cur;        // next block header or miniblock
+  const uint8_t *end;        // end of the page data
+  const uint8_t *mb_widths;  // bit widths of the miniblocks of the current block
+  const uint8_t *last_mb;    // data of the last miniblock started
+  const uint8_t *mb_data[DELTA_NWARPS];  // miniblocks holding the deltas of the current batch
+  uint8_t mb_width[DELTA_NWARPS];        // bit widths of these miniblocks
+  uint32_t last_width;                   // bit width of the last miniblock started
+  uint32_t block_size;                   // number of deltas in a block
+  uint32_t mb_count;                     // number of miniblocks in a block
+  uint32_t values_per_mb;                // number of deltas in a miniblock
+  uint32_t total_count;                  // number of values in the stream
+  uint32_t value_count;                  // number of values decoded so far
+  uint32_t batch_size;                   // number of values in the current batch
+  uint32_t batch_first_mb;               // position in its block of the first batch miniblock
+  uint32_t mb_started;                   // number of miniblocks of the current block started
+  int64_t min_delta;                     // minimum delta of the current block
+  uint64_t last_value;                   // last value decoded
+  uint64_t warp_sums[DELTA_NWARPS];
+  int32_t error;
+};
+
+struct delta_page_state_s {
+  PageInfo page;
+  ColumnChunkDesc col;
+  const uint8_t *end;       // end of the page data
+  const uint8_t *str_data;  // string (or suffix) bytes
+  uint32_t levels_size;     // size of the definition and repetition level sections
+  uint32_t str_hdr_len;     // size of the length prefixed to each plain string (0 or 4)
+  uint64_t out_pos;         // output position of the next value, relative to its values section
+  uint64_t src_pos;         // position of the next string bytes in `str_data`
+  uint64_t prev_pos;        // output position of the last string
+  uint64_t batch_prev_pos;  // output position of the string preceding the current batch
+  uint32_t prev_len;        // length of the last string
+  int32_t error;
+  delta_binary_s lengths;   // values, string lengths or prefix lengths
+  delta_binary_s suffixes;  // suffix lengths (DELTA_BYTE_ARRAY)
+  uint32_t prefix_len[DELTA_NTHREADS];
+  uint32_t suffix_len[DELTA_NTHREADS];
+  uint64_t str_pos[DELTA_NTHREADS];
+  uint64_t suffix_pos[DELTA_NTHREADS];
+};
+
+/**
+ * @brief Read a 64-bit ULEB128 value; on truncated input, `cur` is moved past `end`
+ **/
+inline __device__ uint64_t get_vlq64(const uint8_t *&cur, const uint8_t *end)
+{
+  uint64_t v = 0;
+  for (uint32_t shift = 0; shift < 64; shift += 7) {
+    if (cur >= end) { break; }
+    uint64_t c = *cur++;
+    v |= (c & 0x7f) << shift;
+    if (c < 0x80) { return v; }
+  }
+  cur = end + 1;
+  return v;
+}
+
+inline __device__ int64_t zigzag_decode(uint64_t v)
+{
+  return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+}
+
+/**
+ * @brief Extract `width` (0..64) little-endian bit-packed bits starting at bit `bit_pos`
+ **/
+inline __device__ uint64_t unpack_bits(const uint8_t *p,
+                                       const uint8_t *end,
+                                       uint32_t bit_pos,
+                                       uint32_t width)
+{
+  if (width == 0) { return 0; }
+  p += bit_pos >> 3;
+  uint32_t shift  = bit_pos & 7;
+  uint32_t nbytes = min((shift + width + 7) >> 3, 8);
+  uint64_t v      = 0;
+  for (uint32_t i = 0; i < nbytes; i++) {
+    v |= static_cast<uint64_t>((p + i < end) ? p[i] : 0) << (i * 8);
+  }
+  v >>= shift;
+  if (shift + width > 64) { v |= static_cast<uint64_t>((p + 8 < end) ? p[8] : 0) << (64 - shift); }
+  return (width < 64) ? v & ((1ull << width) - 1) : v;
+}
+
+/**
+ * @brief Inclusive prefix sum across the DELTA_NTHREADS threads of the block
+ **/
+inline __device__ uint64_t BlockScan64(uint64_t v, uint64_t *warp_sums, uint32_t t)
+{
+  for (uint32_t d = 1; d < 32; d <<= 1) {
+    uint64_t n = __shfl_up_sync(~0, v, d);
+    if ((t & 0x1f) >= d) { v += n; }
+  }
+  if ((t & 0x1f) == 0x1f) { warp_sums[t >> 5] = v; }
+  __syncthreads();
+  for (uint32_t w = 0; w < (t >> 5); w++) { v += warp_sums[w]; }
+  __syncthreads();
+  return v;
+}
+
+/**
+ * @brief Parse the header of a DELTA_BINARY_PACKED stream (single thread)
+ **/
+__device__ void DeltaBinaryInit(delta_binary_s *d, const uint8_t *cur, const uint8_t *end)
+{
+  uint64_t block_size = get_vlq64(cur, end);
+  uint64_t mb_count   = get_vlq64(cur, end);
+  uint64_t num_values = get_vlq64(cur, end);
+  d->last_value       = zigzag_decode(get_vlq64(cur, end));
+  d->error = (cur > end || block_size == 0 || block_size % 128 != 0 || block_size > (1 << 20) ||
+              mb_count == 0 || block_size % mb_count != 0 || (block_size / mb_count) % 32 != 0 ||
+              num_values > 0x7fffffff);
+  d->block_size    = (d->error) ? 128 : static_cast<uint32_t>(block_size);
+  d->mb_count      = (d->error) ? 1 : static_cast<uint32_t>(mb_count);
+  d->values_per_mb = d->block_size / d->mb_count;
+  d->total_count   = (d->error) ? 0 : static_cast<uint32_t>(num_values);
+  d->value_count   = 0;
+  d->batch_size    = 0;
+  d->mb_started    = 0;
+  d->cur           = cur;
+  d->end           = end;
+}
+
+/**
+ * @brief Return the end of a DELTA_BINARY_PACKED stream whose header was just parsed, walking the
+ * block headers only (single thread)
+ **/
+__device__ const uint8_t *DeltaBinaryEnd(delta_binary_s *d)
+{
+  const uint8_t *cur = d->cur;
+  const uint8_t *end = d->end;
+  uint32_t remaining = (d->total_count > 0) ? d->total_count - 1 : 0;
+  while (remaining > 0 && cur <= end) {
+    get_vlq64(cur, end);  // min delta
+    const uint8_t *widths = cur;
+    cur += d->mb_count;
+    for (uint32_t mb = 0; mb < d->mb_count && remaining > 0 && cur <= end; mb++) {
+      cur += (widths[mb] * d->values_per_mb) >> 3;
+      remaining -= min(remaining, d->values_per_mb);
+    }
+  }
+  if (cur > end) { d->error = 1; }
+  return cur;
+}
+
+/**
+ * @brief Locate the miniblocks of the next batch of values (single thread)
+ **/
+__device__ void DeltaBinarySetupBatch(delta_binary_s *d)
+{
+  if (d->error || d->value_count >= d->total_count) {
+    d->batch_size = 0;
+    return;
+  }
+  if (d->value_count == 0) {
+    d->batch_size = 1;  // The first value is stored in the header
+    return;
+  }
+  uint32_t delta_idx = (d->value_count - 1) % d->block_size;
+  d->batch_size      = min(d->total_count - d->value_count, DELTA_NTHREADS);
+  if (delta_idx == 0) {
+    // Block header: min delta followed by the bit widths of the miniblocks
+    const uint8_t *cur = d->cur;
+    d->min_delta       = zigzag_decode(get_vlq64(cur, d->end));
+    d->mb_widths       = cur;
+    d->cur             = cur + d->mb_count;
+    d->mb_started      = 0;
+  }
+  uint32_t first_mb = delta_idx / d->values_per_mb;
+  uint32_t last_mb  = (delta_idx + d->batch_size - 1) / d->values_per_mb;
+  d->batch_first_mb = first_mb;
+  for (uint32_t mb = first_mb; mb <= last_mb; mb++) {
+    if (mb >= d->mb_started) {
+      uint32_t width = (d->mb_widths + mb < d->end) ? d->mb_widths[mb] : 0;
+      if (width > 64 || d->cur > d->end) { d->error = 1; }
+      d->last_mb    = d->cur;
+      d->last_width = min(width, 64);
+      d->cur += (d->last_width * d->values_per_mb) >> 3;
+      d->mb_started = mb + 1;
+    }
+    d->mb_data[mb - first_mb]  = d->last_mb;
+    d->mb_width[mb - first_mb] = d->last_width;
+  }
+}
+
+/**
+ * @brief Decode the current batch of values: thread t returns value t of the batch
+ **/
+__device__ uint64_t DeltaBinaryDecodeBatch(delta_binary_s *d, uint32_t t)
+{
+  uint32_t n = d->batch_size;
+  uint64_t v = d->last_value;
+  if (d->value_count != 0) {
+    uint64_t delta = 0;
+    if (t < n) {
+      uint32_t delta_idx = (d->value_count - 1) % d->block_size + t;
+      uint32_t mb        = delta_idx / d->values_per_mb - d->batch_first_mb;
+      uint32_t width     = d->mb_width[mb];
+      delta              = static_cast<uint64_t>(d->min_delta) +
+              unpack_bits(d->mb_data[mb], d->end, (delta_idx % d->values_per_mb) * width, width);
+    }
+    v += BlockScan64(delta, d->warp_sums, t);
+  }
+  __syncthreads();
+  if (t == n - 1) { d->last_value = v; }
+  if (t == 0) { d->value_count += n; }
+  __syncthreads();
+  return v;
+}
+
+/**
+ * @brief Return the size of a definition or repetition level section
+ **/
+__device__ uint32_t LevelSectionSize(const uint8_t *cur,
+                                     const uint8_t *end,
+                                     int encoding,
+                                     int level_bits,
+                                     int32_t num_values,
+                                     int32_t *error)
+{
+  if (level_bits == 0) { return 0; }
+  if (encoding == RLE) {
+    if (cur + 4 > end) {
+      *error = 1;
+      return 0;
+    }
+    return 4 + (cur[0] | (cur[1] << 8) | (cur[2] << 16) | (cur[3] << 24));
+  }
+  if (encoding == BIT_PACKED) { return (num_values * level_bits + 7) >> 3; }
+  *error = 1;
+  return 0;
+}
+
+/**
+ * @brief Load the page and parse its level sections and delta stream headers (single thread)
+ *
+ * @return false if the page is not a delta-encoded data page
+ **/
+__device__ bool SetupDeltaPage(delta_page_state_s *s,
+                               const PageInfo *page,
+                               const ColumnChunkDesc *chunks,
+                               int32_t num_chunks)
+{
+  s->page = *page;
+  if (!IsDeltaEncodedPage(s->page) || s->page.chunk_idx < 0 || s->page.chunk_idx >= num_chunks) {
+    return false;
+  }
+  s->col   = chunks[s->page.chunk_idx];
+  s->error = 0;
+
+  const uint8_t *cur       = s->page.page_data;
+  const uint8_t *end       = cur + s->page.uncompressed_page_size;
+  int32_t const num_values = s->page.num_values;
+  uint32_t def_size        = LevelSectionSize(
+    cur, end, s->page.definition_level_encoding, s->col.def_level_bits, num_values, &s->error);
+  uint32_t rep_size = LevelSectionSize(cur + def_size,
+                                       end,
+                                       s->page.repetition_level_encoding,
+                                       s->col.rep_level_bits,
+                                       num_values,
+                                       &s->error);
+  s->end            = end;
+  s->levels_size    = def_size + rep_size;
+  cur += s->levels_size;
+  if (cur > end) { s->error = 1; }
+
+  int dtype      = s->col.data_type & 7;
+  s->str_hdr_len = (dtype == FIXED_LEN_BYTE_ARRAY) ? 0 : 4;
+  s->out_pos     = 0;
+  s->src_pos     = 0;
+  s->prev_pos    = 0;
+  s->prev_len    = 0;
+  s->str_data    = end;
+
+  s->lengths.error  = 0;
+  s->suffixes.error = 0;
+  if (s->error) { return true; }
+  switch (s->page.encoding) {
+    case DELTA_BINARY_PACKED:
+      if (dtype != INT32 && dtype != INT64) { s->error = 1; }
+      DeltaBinaryInit(&s->lengths, cur, end);
+      break;
+    case DELTA_LENGTH_BYTE_ARRAY:
+      if (dtype != BYTE_ARRAY) { s->error = 1; }
+      DeltaBinaryInit(&s->lengths, cur, end);
+      s->str_data = DeltaBinaryEnd(&s->lengths);
+      break;
+    case DELTA_BYTE_ARRAY:
+      if (dtype != BYTE_ARRAY && dtype != FIXED_LEN_BYTE_ARRAY) { s->error = 1; }
+      DeltaBinaryInit(&s->lengths, cur, end);
+      DeltaBinaryInit(&s->suffixes, DeltaBinaryEnd(&s->lengths), end);
+      s->str_data = DeltaBinaryEnd(&s->suffixes);
+      if (s->suffixes.total_count != s->lengths.total_count) { s->error = 1; }
+      s->error |= s->suffixes.error;
+      break;
+  }
+  s->error |= s->lengths.error;
+  return true;
+}
+
+/**
+ * @brief Decode the string (or prefix) lengths of the next batch of a DELTA_LENGTH_BYTE_ARRAY
+ * or DELTA_BYTE_ARRAY page into `prefix_len` and `suffix_len`, together with the output position
+ * of each string and of its bytes in `str_data`
+ *
+ * @return number of strings in the batch
+ **/
+__device__ uint32_t DecodeStringLengths(delta_page_state_s *s, uint32_t t)
+{
+  bool const has_prefix = (s->page.encoding == DELTA_BYTE_ARRAY);
+  if (!t) {
+    DeltaBinarySetupBatch(&s->lengths);
+    if (has_prefix) { DeltaBinarySetupBatch(&s->suffixes); }
+  }
+  __syncthreads();
+  uint32_t n = s->lengths.batch_size;
+  if (n == 0 || (has_prefix && s->suffixes.batch_size != n)) { return 0; }
+  int64_t prefix = static_cast<int32_t>(DeltaBinaryDecodeBatch(&s->lengths, t));
+  int64_t suffix = (has_prefix) ? static_cast<int32_t>(DeltaBinaryDecodeBatch(&s->suffixes, t))
+                                : prefix;
+  if (!has_prefix) { prefix = 0; }
+  if (t < n) {
+    if (prefix < 0 || suffix < 0) { s->error = 1; }
+    s->prefix_len[t] = static_cast<uint32_t>(max(prefix, INT64_C(0)));
+    s->suffix_len[t] = static_cast<uint32_t>(max(suffix, INT64_C(0)));
+  }
+  __syncthreads();
+  uint32_t len        = (t < n) ? s->prefix_len[t] + s->suffix_len[t] : 0;
+  uint32_t prev_len   = (t == 0) ? s->prev_len : s->prefix_len[t - 1] + s->suffix_len[t - 1];
+  uint64_t str_size   = (t < n) ? s->str_hdr_len + len : 0;
+  uint64_t src_size   = (t < n) ? s->suffix_len[t] : 0;
+  uint64_t str_end    = BlockScan64(str_size, s->lengths.warp_sums, t);
+  uint64_t suffix_end = BlockScan64(src_size, s->lengths.warp_sums, t);
+  if (t < n) {
+    // A prefix is taken from the previous string, and fixed-length values have a known length
+    if (s->prefix_len[t] > prev_len ||
+        (s->str_hdr_len == 0 && len != static_cast<uint32_t>(s->col.data_type >> 3))) {
+      s->error = 1;
+    }
+    s->str_pos[t]    = s->out_pos + str_end - str_size;
+    s->suffix_pos[t] = s->src_pos + suffix_end - src_size;
+  }
+  __syncthreads();
+  if (t == n - 1) {
+    s->batch_prev_pos = s->prev_pos;
+    s->prev_pos       = s->str_pos[t];
+    s->prev_len       = len;
+    s->out_pos += str_end;
+    s->src_pos += suffix_end;
+  }
+  __syncthreads();
+  return n;
+}
+
+/**
+ * @brief Compute the size of each delta-encoded page once converted to PLAIN encoding
+ **/
+// blockDim {DELTA_NTHREADS,1,1}
+__global__ void __launch_bounds__(DELTA_NTHREADS)
+  gpuComputeDeltaPageSizes(const PageInfo *pages,
+                           const ColumnChunkDesc *chunks,
+                           int32_t num_chunks,
+                           int64_t *plain_sizes)
+{
+  __shared__ __align__(16) delta_page_state_s state_g;
+
+  delta_page_state_s *const s = &state_g;
+  uint32_t t                  = threadIdx.x;
+  __shared__ bool is_delta;
+
+  if (!t) { is_delta = SetupDeltaPage(s, &pages[blockIdx.x], chunks, num_chunks); }
+  __syncthreads();
+  if (!is_delta) {
+    if (!t) { plain_sizes[blockIdx.x] = 0; }
+    return;
+  }
+  if (s->page.encoding != DELTA_BINARY_PACKED) {
+    while (!s->error && DecodeStringLengths(s, t) != 0) { __syncthreads(); }
+    __syncthreads();
+  }
+  if (!t) {
+    int64_t size = s->levels_size;
+    if (s->page.encoding == DELTA_BINARY_PACKED) {
+      int64_t dtype_len = ((s->col.data_type & 7) == INT64) ? 8 : 4;
+      size += s->lengths.total_count * dtype_len;
+    } else {
+      // Every string must have been decoded and the suffix bytes must be within the page
+      if (s->lengths.error || s->suffixes.error ||
+          s->lengths.value_count != s->lengths.total_count ||
+          s->src_pos > static_cast<uint64_t>(s->end - s->str_data)) {
+        s->error = 1;
+      }
+      size += s->out_pos;
+    }
+    plain_sizes[blockIdx.x] = (s->error) ? -1 : size;
+  }
+}
+
+/**
+ * @brief Rewrite each delta-encoded page with PLAIN encoding
+ **/
+// blockDim {DELTA_NTHREADS,1,1}
+__global__ void __launch_bounds__(DELTA_NTHREADS) gpuDecodeDeltaPages(PageInfo *pages,
+                                                                      const ColumnChunkDesc *chunks,
+                                                                      int32_t num_chunks,
+                                                                      uint8_t *plain_data,
+                                                                      const int64_t *plain_offsets)
+{
+  __shared__ __align__(16) delta_page_state_s state_g;
+
+  delta_page_state_s *const s = &state_g;
+  uint32_t t                  = threadIdx.x;
+  __shared__ bool is_delta;
+
+  if (!t) { is_delta = SetupDeltaPage(s, &pages[blockIdx.x], chunks, num_chunks); }
+  __syncthreads();
+  if (!is_delta || s->error) { return; }
+
+  uint8_t *const dst = plain_data + plain_offsets[blockIdx.x];
+  uint8_t *const out = dst + s->levels_size;
+  memcpy_block<DELTA_NTHREADS, false>(dst, s->page.page_data, s->levels_size, t);
+  if (s->page.encoding == DELTA_BINARY_PACKED) {
+    uint32_t dtype_len = ((s->col.data_type & 7) == INT64) ? 8 : 4;
+    for (;;) {
+      if (!t) { DeltaBinarySetupBatch(&s->lengths); }
+      __syncthreads();
+      uint32_t n   = s->lengths.batch_size;
+      uint64_t pos = s->lengths.value_count;
+      if (n == 0) { break; }
+      uint64_t v = DeltaBinaryDecodeBatch(&s->lengths, t);
+      if (t < n) {
+        uint8_t *p = out + (pos + t) * dtype_len;
+        for (uint32_t i = 0; i < dtype_len; i++) { p[i] = static_cast<uint8_t>(v >> (i * 8)); }
+      }
+    }
+  } else {
+    bool const has_prefix = (s->page.encoding == DELTA_BYTE_ARRAY);
+    uint32_t n;
+    while ((n = DecodeStringLengths(s, t)) != 0) {
+      if (!has_prefix) {
+        if (t < n) {
+          uint8_t *p         = out + s->str_pos[t];
+          uint32_t len       = s->suffix_len[t];
+          const uint8_t *src = s->str_data + s->suffix_pos[t];
+          p[0]               = len;
+          p[1]               = len >> 8;
+          p[2]               = len >> 16;
+          p[3]               = len >> 24;
+          for (uint32_t i = 0; i < len; i++) { p[4 + i] = src[i]; }
+        }
+      } else {
+        // Each string starts with a prefix of the previous one, so the strings are rebuilt in
+        // order, with all the threads copying the bytes of one string
+        for (uint32_t i = 0; i < n; i++) {
+          uint8_t *p            = out + s->str_pos[i];
+          uint32_t prefix       = s->prefix_len[i];
+          uint32_t len          = prefix + s->suffix_len[i];
+          const uint8_t *prev   = (i > 0) ? out + s->str_pos[i - 1] : out + s->batch_prev_pos;
+          const uint8_t *suffix = s->str_data + s->suffix_pos[i];
+          if (s->str_hdr_len != 0 && t < 4) { p[t] = len >> (t * 8); }
+          p += s->str_hdr_len;
+          prev += s->str_hdr_len;
+          for (uint32_t b = t; b < len; b += DELTA_NTHREADS) {
+            p[b] = (b < prefix) ? prev[b] : suffix[b - prefix];
+          }
+          __syncthreads();
+        }
+      }
+      __syncthreads();
+    }
+  }
+  __syncthreads();
+  if (!t) {
+    pages[blockIdx.x].page_data = dst;
+    pages[blockIdx.x].uncompressed_page_size =
+      static_cast<int32_t>(plain_offsets[blockIdx.x + 1] - plain_offsets[blockIdx.x]);
+    pages[blockIdx.x].encoding = PLAIN;
+  }
+}
+
+cudaError_t __host__ ComputeDeltaPageSizes(const PageInfo *pages,
+                                           int32_t num_pages,
+                                           const ColumnChunkDesc *chunks,
+                                           int32_t num_chunks,
+                                           int64_t *plain_sizes,
+                                           cudaStream_t stream)
+{
+  gpuComputeDeltaPageSizes<<<num_pages, DELTA_NTHREADS, 0, stream>>>(
+    pages, chunks, num_chunks, plain_sizes);
+  return cudaSuccess;
+}
+
+cudaError_t __host__ DecodeDeltaPages(PageInfo *pages,
+                                      int32_t num_pages,
+                                      const ColumnChunkDesc *chunks,
+                                      int32_t num_chunks,
+                                      uint8_t *plain_data,
+                                      const int64_t *plain_offsets,
+                                      cudaStream_t stream)
+{
+  gpuDecodeDeltaPages<<<num_pages, DELTA_NTHREADS, 0, stream>>>(
+    pages, chunks, num_chunks, plain_data, plain_offsets);
+  return cudaSuccess;
+}
+
+}  // namespace gpu
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
@@ -184,6 +184,8 @@ __global__ void __launch_bounds__(1024, 1)
     uint32_t frag_start_row = s->ck.start_row + s->row_cnt, num_dict_entries, frag_dict_size;
     FetchDictionaryFragment(s, s->col.dict_data, frag_start_row, t);
     __syncthreads();
+    // Fragments of more than MAX_PAGE_FRAGMENT_SIZE values have no dictionary entries
+    if (s->frag.num_rows > MAX_PAGE_FRAGMENT_SIZE) { break; }
     num_dict_entries = s->frag.num_dict_vals;
     if (!t) {
       s->num_dict_entries = 0;
@@ -293,7 +295,7 @@ __global__ void __launch_bounds__(1024, 1)
     num_dict_entries = s->num_dict_entries;
     frag_dict_size   = s->frag_dict_size;
     if (s->total_dict_entries + num_dict_entries > 65536 ||
-        (s->dictionary_size != 0 && s->dictionary_size + frag_dict_size > 512 * 1024)) {
+        (s->dictionary_size != 0 && s->dictionary_size + frag_dict_size > s->ck.max_dict_size)) {
       break;
     }
     __syncthreads();
@@ -41,6 +41,10 @@ struct frag_init_state_s {
 #define RLE_BFRSZ (1 << LOG2_RLE_BFRSZ)
 #define RLE_MAX_LIT_RUN 0xfff8  // Maximum literal run for 2-byte run code
 
+// DELTA_BINARY_PACKED blocks of 128 deltas, one 32-delta miniblock per warp
+#define DELTA_BLOCK_SIZE 128
+#define DELTA_MINIBLOCKS 4
+
 struct page_enc_state_s {
   uint8_t *cur;          //!< current output ptr
   uint8_t *rle_out;      //!< current RLE write ptr
@@ -58,8 +62,27 @@ struct page_enc_state_s {
   gpu_inflate_input_s comp_in;
   gpu_inflate_status_s comp_out;
   uint16_t vals[RLE_BFRSZ];
+  uint8_t *delta_mb[DELTA_MINIBLOCKS];     //!< output position of the miniblocks of a block
+  uint32_t delta_width[DELTA_MINIBLOCKS];  //!< bit width of the miniblocks of a block
+  int64_t delta_min[DELTA_MINIBLOCKS];     //!< minimum delta of each warp
+  uint32_t delta_values;                   //!< number of values added to the delta stream
+  uint32_t delta_pending;                  //!< number of deltas waiting for a complete block
+  uint32_t delta_first;                    //!< position in `deltas` of the first pending delta
+  uint64_t delta_last;                     //!< last value added to the delta stream
+  uint64_t delta_vals[DELTA_BLOCK_SIZE];   //!< values of the current batch, then packed deltas
+  uint64_t deltas[2 * DELTA_BLOCK_SIZE];   //!< pending deltas (circular buffer)
 };
 
+/**
+ * @brief Return the worst-case size of a DELTA_BINARY_PACKED stream beyond the PLAIN size of its
+ * values: stream header, block headers and padding of the last miniblock
+ */
+inline __device__ uint32_t DeltaBinaryOverhead(uint32_t num_values)
+{
+  return 18 + ((num_values + DELTA_BLOCK_SIZE - 1) / DELTA_BLOCK_SIZE) * (10 + DELTA_MINIBLOCKS) +
+         31 * 8;
+}
+
 /**
  * @brief Return a 12-bit hash from a byte sequence
  */
@@ -114,9 +137,19 @@ __global__ void __launch_bounds__(512) gpuInitPageFragments(PageFragment *frag,
   }
   __syncthreads();
   start_row = blockIdx.y * fragment_size;
+  nrows     = min(fragment_size, max_num_rows - min(start_row, max_num_rows));
+  if (s->col.row_offsets) {
+    // Fragments of columns with repetition levels hold all the values of their rows
+    uint32_t end_row = min(start_row + fragment_size, max_num_rows);
+    start_row        = s->col.row_offsets[min(start_row, max_num_rows)];
+    nrows            = s->col.row_offsets[end_row] - start_row;
+  }
+  __syncthreads();
   if (!t) {
-    s->col.num_rows            = min(s->col.num_rows, max_num_rows);
-    s->frag.num_rows           = min(fragment_size, max_num_rows - min(start_row, max_num_rows));
+    if (!s->col.row_offsets) { s->col.num_rows = min(s->col.num_rows, max_num_rows); }
+    // Fragments too large for the dictionary hash map are left out of the dictionary
+    if (nrows > MAX_PAGE_FRAGMENT_SIZE) { s->col.dict_index = nullptr; }
+    s->frag.num_rows           = nrows;
     s->frag.non_nulls          = 0;
     s->frag.num_dict_vals      = 0;
     s->frag.fragment_data_size = 0;
@@ -363,7 +396,9 @@ __global__ void __launch_bounds__(128) gpuInitFragmentStats(statistics_group *gr
   statistics_group *const g = &group_g[threadIdx.x >> 5];
   if (!t && frag_id < num_fragments) {
     g->col       = &col_desc[column_id];
-    g->start_row = frag_id * fragment_size;
+    g->start_row = (col_desc[column_id].row_offsets)
+                     ? col_desc[column_id].row_offsets[frag_id * fragment_size]
+                     : frag_id * fragment_size;
     g->num_rows  = fragments[column_id * num_fragments + frag_id].num_rows;
   }
   __syncthreads();
@@ -469,9 +504,12 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
       } else {
         fragment_data_size = frag_g.fragment_data_size;
       }
+      // Lower the limit once the page holds a large part of the chunk, to balance page sizes
       max_page_size = (rows_in_page * 2 >= ck_g.num_rows)
-                        ? 256 * 1024
-                        : (rows_in_page * 3 >= ck_g.num_rows) ? 384 * 1024 : 512 * 1024;
+                        ? ck_g.max_page_size >> 1
+                        : (rows_in_page * 3 >= ck_g.num_rows)
+                            ? ck_g.max_page_size - (ck_g.max_page_size >> 2)
+                            : ck_g.max_page_size;
       if (num_rows >= ck_g.num_rows ||
           (rows_in_page > 0 &&
            (page_size + fragment_data_size > max_page_size ||
@@ -500,10 +538,15 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
         }
         if (!t) {
           uint32_t def_level_bits = col_g.level_bits & 0xf;
+          uint32_t rep_level_bits = col_g.level_bits >> 4;
           uint32_t def_level_size =
             (def_level_bits)
               ? 4 + 5 + ((def_level_bits * rows_in_page + 7) >> 3) + (rows_in_page >> 8)
               : 0;
+          if (rep_level_bits) {
+            def_level_size +=
+              4 + 5 + ((rep_level_bits * rows_in_page + 7) >> 3) + (rows_in_page >> 8);
+          }
           page_g.num_fragments   = fragments_in_chunk - page_start;
           page_g.chunk_id        = blockIdx.y * num_columns + blockIdx.x;
           page_g.page_type       = DATA_PAGE;
@@ -520,6 +563,9 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
             page_g.max_hdr_size += stats_hdr_len;
           }
           page_g.max_data_size    = page_size + def_level_size;
+          if (!dict_bits_plus1 && col_g.encoding == DELTA_BINARY_PACKED) {
+            page_g.max_data_size += DeltaBinaryOverhead(rows_in_page);
+          }
           page_g.page_data        = ck_g.uncompressed_bfr + page_offset;
           page_g.compressed_data  = ck_g.compressed_bfr + comp_page_offset;
           page_g.start_row        = cur_row;
@@ -599,6 +645,24 @@ inline __device__ uint8_t *VlqEncode(uint8_t *p, uint32_t v)
   return p;
 }
 
+/**
+ * @brief Variable-length encode a 64-bit integer
+ **/
+inline __device__ uint8_t *VlqEncode64(uint8_t *p, uint64_t v)
+{
+  while (v > 0x7f) {
+    *p++ = (v | 0x80);
+    v >>= 7;
+  }
+  *p++ = v;
+  return p;
+}
+
+inline __device__ uint64_t ZigZagEncode(int64_t v)
+{
+  return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
 /**
  * @brief Pack literal values in output bitstream (1,2,4,8,12 or 16 bits per value)
  **/
@@ -815,6 +879,95 @@ static __device__ void PlainBoolEncode(page_enc_state_s *s,
   }
 }
 
+/**
+ * @brief DELTA_BINARY_PACKED encoder
+ *
+ * Appends the deltas of the batch values to the pending deltas, and encodes the complete blocks
+ * (all the pending deltas when flushing).
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] numvals Count of input values in s->delta_vals
+ * @param[in] flush nonzero if last batch in page
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void DeltaBinaryEncode(page_enc_state_s *s,
+                                         uint32_t numvals,
+                                         uint32_t flush,
+                                         uint32_t t)
+{
+  constexpr uint32_t deltas_mask = 2 * DELTA_BLOCK_SIZE - 1;
+  // The first value of the page is stored in the stream header
+  uint32_t first = (s->delta_values == 0 && numvals != 0) ? 1 : 0;
+  if (t >= first && t < numvals) {
+    uint64_t delta = s->delta_vals[t] - ((t > 0) ? s->delta_vals[t - 1] : s->delta_last);
+    if (s->col.physical_type == INT32) {
+      // INT32 deltas wrap around like the 32-bit values they are added to
+      delta = static_cast<int64_t>(static_cast<int32_t>(static_cast<uint32_t>(delta)));
+    }
+    s->deltas[(s->delta_first + s->delta_pending + t - first) & deltas_mask] = delta;
+  }
+  __syncthreads();
+  if (!t) {
+    if (first) { s->cur = VlqEncode64(s->cur, ZigZagEncode(s->delta_vals[0])); }
+    if (numvals) { s->delta_last = s->delta_vals[numvals - 1]; }
+    s->delta_values += numvals;
+    s->delta_pending += numvals - first;
+  }
+  __syncthreads();
+  while (s->delta_pending >= DELTA_BLOCK_SIZE || (flush && s->delta_pending != 0)) {
+    uint32_t n      = min(s->delta_pending, DELTA_BLOCK_SIZE);
+    int64_t delta   = (t < n) ? s->deltas[(s->delta_first + t) & deltas_mask] : INT64_MAX;
+    int64_t min_val = delta;
+    for (uint32_t i = 1; i < 32; i <<= 1) { min_val = min(min_val, SHFL_XOR(min_val, i)); }
+    if (!(t & 0x1f)) { s->delta_min[t >> 5] = min_val; }
+    __syncthreads();
+    min_val = min(min(s->delta_min[0], s->delta_min[1]), min(s->delta_min[2], s->delta_min[3]));
+    // Deltas relative to the block minimum, and the bit width of each miniblock
+    uint64_t v =
+      (t < n) ? static_cast<uint64_t>(delta) - static_cast<uint64_t>(min_val) : UINT64_C(0);
+    uint32_t width = 64 - __clzll(static_cast<long long>(v));
+    for (uint32_t i = 1; i < 32; i <<= 1) { width = max(width, SHFL_XOR(width, i)); }
+    s->delta_vals[t] = v;
+    if (!(t & 0x1f)) { s->delta_width[t >> 5] = width; }
+    __syncthreads();
+    if (!t) {
+      uint8_t *dst = VlqEncode64(s->cur, ZigZagEncode(min_val));
+      for (uint32_t mb = 0; mb < DELTA_MINIBLOCKS; mb++) {
+        dst[mb] = (mb * 32 < n) ? s->delta_width[mb] : 0;
+      }
+      dst += DELTA_MINIBLOCKS;
+      // Unused miniblocks of the last block are omitted; the last one used is padded
+      for (uint32_t mb = 0; mb < DELTA_MINIBLOCKS; mb++) {
+        s->delta_mb[mb] = dst;
+        if (mb * 32 < n) { dst += 4 * s->delta_width[mb]; }
+      }
+      s->cur = dst;
+    }
+    __syncthreads();
+    // Each warp packs one miniblock of 32 deltas, 32 output bytes at a time
+    uint32_t mb = t >> 5;
+    if (mb * 32 < n) {
+      const uint64_t *src = &s->delta_vals[mb * 32];
+      uint8_t *dst        = s->delta_mb[mb];
+      width               = s->delta_width[mb];
+      for (uint32_t i = t & 0x1f; i < 4 * width; i += 32) {
+        uint32_t byte = 0;
+        for (uint32_t b = 0; b < 8; b++) {
+          uint32_t bit = i * 8 + b;
+          byte |= static_cast<uint32_t>((src[bit / width] >> (bit % width)) & 1) << b;
+        }
+        dst[i] = byte;
+      }
+    }
+    __syncthreads();
+    if (!t) {
+      s->delta_first = (s->delta_first + n) & deltas_mask;
+      s->delta_pending -= n;
+    }
+    __syncthreads();
+  }
+}
+
 // blockDim(128, 1, 1)
 __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
                                                          const EncColumnChunk *chunks,
@@ -828,6 +981,7 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
   uint32_t t                = threadIdx.x;
   uint32_t dtype, dtype_len_in, dtype_len_out;
   int32_t dict_bits;
+  bool is_delta;
 
   if (t < sizeof(EncPage) / sizeof(uint32_t)) {
     reinterpret_cast<uint32_t *>(&s->page)[t] =
@@ -846,11 +1000,12 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
   __syncthreads();
   if (!t) { s->cur = s->page.page_data + s->page.max_hdr_size; }
   __syncthreads();
-  // Encode NULLs
-  if (s->page.page_type != DICTIONARY_PAGE && s->col.level_bits != 0) {
+  // Encode the repetition levels, then the definition levels (NULLs)
+  for (int lvl = 1; lvl >= 0 && s->page.page_type != DICTIONARY_PAGE; lvl--) {
     const uint32_t *valid = s->col.valid_map_base;
-    uint32_t def_lvl_bits = s->col.level_bits & 0xf;
-    if (def_lvl_bits != 0) {
+    const uint8_t *levels = (lvl) ? s->col.rep_levels : s->col.def_levels;
+    uint32_t lvl_bits     = (lvl) ? s->col.level_bits >> 4 : s->col.level_bits & 0xf;
+    if (lvl_bits != 0) {
       if (!t) {
         s->rle_run     = 0;
         s->rle_pos     = 0;
@@ -862,13 +1017,14 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
         uint32_t rle_numvals = s->rle_numvals;
         uint32_t nrows       = min(s->page.num_rows - rle_numvals, 128);
         uint32_t row         = s->page.start_row + rle_numvals + t;
-        uint32_t def_lvl     = (rle_numvals + t < s->page.num_rows && row < s->col.num_rows)
-                             ? (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1
-                             : 0;
-        s->vals[(rle_numvals + t) & (RLE_BFRSZ - 1)] = def_lvl;
+        uint32_t level       = 0;
+        if (rle_numvals + t < s->page.num_rows && row < s->col.num_rows) {
+          level = (levels) ? levels[row] : (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1;
+        }
+        s->vals[(rle_numvals + t) & (RLE_BFRSZ - 1)] = level;
         __syncthreads();
         rle_numvals += nrows;
-        RleEncode(s, rle_numvals, def_lvl_bits, (rle_numvals == s->page.num_rows), t);
+        RleEncode(s, rle_numvals, lvl_bits, (rle_numvals == s->page.num_rows), t);
         __syncthreads();
       }
       if (t < 32) {
@@ -881,6 +1037,7 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
         SYNCWARP();
         if (t == 0) { s->cur = rle_out; }
       }
+      __syncthreads();
     }
   }
   // Encode data values
@@ -893,6 +1050,33 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
     dtype_len_in = (dtype == BYTE_ARRAY) ? sizeof(nvstrdesc_s) : dtype_len_out;
   }
   dict_bits = (dtype == BOOLEAN) ? 1 : (s->page.dict_bits_plus1 - 1);
+  is_delta  = (s->page.page_type == DATA_PAGE && dict_bits < 0 &&
+              s->col.encoding == DELTA_BINARY_PACKED && (dtype == INT32 || dtype == INT64));
+  if (is_delta) {
+    // The stream header holds the number of non-null values of the page
+    const uint32_t *valid = s->col.valid_map_base;
+    uint32_t num_valid    = 0;
+    for (uint32_t i = t; i < s->page.num_rows; i += 128) {
+      uint32_t row = s->page.start_row + i;
+      num_valid += (row < s->col.num_rows) ? (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1
+                                           : 0;
+    }
+    num_valid = WarpReduceSum32(num_valid);
+    if (!(t & 0x1f)) { s->scratch_red[t >> 5] = num_valid; }
+    __syncthreads();
+    if (t == 0) {
+      uint8_t *dst = VlqEncode(s->cur, DELTA_BLOCK_SIZE);
+      dst          = VlqEncode(dst, DELTA_MINIBLOCKS);
+      num_valid    = s->scratch_red[0] + s->scratch_red[1] + s->scratch_red[2] + s->scratch_red[3];
+      s->cur       = VlqEncode(dst, num_valid);
+
+      s->delta_values  = 0;
+      s->delta_pending = 0;
+      s->delta_first   = 0;
+      s->delta_last    = 0;
+    }
+    __syncthreads();
+  }
   if (t == 0) {
     uint8_t *dst   = s->cur;
     s->rle_run     = 0;
@@ -954,6 +1138,43 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
       }
       if (t == 0) { s->cur = s->rle_out; }
       __syncthreads();
+    } else if (is_delta) {
+      // DELTA_BINARY_PACKED encoding of the non-null values
+      uint32_t numvals;
+
+      pos = __popc(warp_valids & ((1 << (t & 0x1f)) - 1));
+      if (!(t & 0x1f)) { s->scratch_red[t >> 5] = __popc(warp_valids); }
+      __syncthreads();
+      if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+      __syncthreads();
+      pos = pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0);
+      if (is_valid) {
+        const uint8_t *src8 =
+          reinterpret_cast<const uint8_t *>(s->col.column_data_base) + row * (size_t)dtype_len_in;
+        int64_t v;
+        if (dtype == INT32) {
+          if (dtype_len_in == 4)
+            v = *reinterpret_cast<const int32_t *>(src8);
+          else if (dtype_len_in == 2)
+            v = *reinterpret_cast<const int16_t *>(src8);
+          else
+            v = *reinterpret_cast<const int8_t *>(src8);
+        } else {
+          int32_t ts_scale = s->col.ts_scale;
+          v                = *reinterpret_cast<const int64_t *>(src8);
+          if (ts_scale != 0) {
+            if (ts_scale < 0) {
+              v /= -ts_scale;
+            } else {
+              v *= ts_scale;
+            }
+          }
+        }
+        s->delta_vals[pos] = v;
+      }
+      numvals = s->scratch_red[3];
+      __syncthreads();
+      DeltaBinaryEncode(s, numvals, (cur_row == s->page.num_rows), t);
     } else {
       // Non-dictionary encoding
       uint8_t *dst = s->cur;
@@ -1026,6 +1247,9 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
       __syncthreads();
     }
   }
+  if (is_delta && t == 0 && s->delta_values == 0) {
+    *s->cur++ = 0;  // First value of an empty stream
+  }
   if (t == 0) {
     uint8_t *base                = s->page.page_data + s->page.max_hdr_size;
     uint32_t actual_data_size    = static_cast<uint32_t>(s->cur - base);
@@ -1303,6 +1527,10 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
     int encoding =
       (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0) ? PLAIN_DICTIONARY : PLAIN;
 #endif
+    if (encoding == PLAIN && page_type == DATA_PAGE && col_g.encoding == DELTA_BINARY_PACKED &&
+        (col_g.physical_type == INT32 || col_g.physical_type == INT64)) {
+      encoding = DELTA_BINARY_PACKED;
+    }
     CPW_FLD_INT32(1, page_type)
     CPW_FLD_INT32(2, uncompressed_page_size)
     CPW_FLD_INT32(3, compressed_page_size)
@@ -76,6 +76,18 @@ struct SchemaElement {
   }
 };
 
+/**
+ * @brief Thrift-derived struct describing the statistics of a column chunk or page
+ **/
+struct Statistics {
+  std::vector<uint8_t> max;        // Deprecated max value, in signed comparison order
+  std::vector<uint8_t> min;        // Deprecated min value, in signed comparison order
+  int64_t null_count     = -1;     // Count of null values in the column (-1 if not set)
+  int64_t distinct_count = -1;     // Count of distinct values occurring (-1 if not set)
+  std::vector<uint8_t> max_value;  // Max value of the column, determined by its ColumnOrder
+  std::vector<uint8_t> min_value;  // Min value of the column, determined by its ColumnOrder
+};
+
 /**
  * @brief Thrift-derived struct describing a column of data
  **/
@@ -94,6 +106,8 @@ struct ColumnMetaData {
   int64_t dictionary_page_offset =
     0;  // Byte offset from the beginning of file to first (only) dictionary page
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
+  int64_t bloom_filter_offset = 0;       // File offset of the chunk's bloom filter header
+  int32_t bloom_filter_length = 0;       // Size of the bloom filter header and bitset, in bytes
 };
 
 /**
@@ -162,6 +176,7 @@ struct DataPageHeader {
   Encoding encoding                  = PLAIN;  // Encoding used for this data page
   Encoding definition_level_encoding = PLAIN;  // Encoding used for definition levels
   Encoding repetition_level_encoding = PLAIN;  // Encoding used for repetition levels
+  Statistics statistics;                       // Optional page-level statistics
 };
 
 /**
@@ -189,6 +204,46 @@ struct PageHeader {
   DictionaryPageHeader dictionary_page_header;
 };
 
+/**
+ * @brief Thrift-derived struct describing the location of a data page within the file
+ **/
+struct PageLocation {
+  int64_t offset               = 0;  // File offset of the page header
+  int32_t compressed_page_size = 0;  // Compressed page size in bytes, including the header
+  int64_t first_row_index      = 0;  // Index of the first row of the page within the row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the data pages of a column chunk
+ *
+ * Along with the ColumnIndex, the OffsetIndex makes up the page index of a column chunk, stored
+ * outside of the row groups. It lets readers locate the pages that hold a given row range.
+ **/
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;
+};
+
+/**
+ * @brief Thrift-derived struct describing the min/max values of each data page of a column chunk
+ **/
+struct ColumnIndex {
+  std::vector<bool> null_pages;                  // Whether each page only holds nulls
+  std::vector<std::vector<uint8_t>> min_values;  // Page min values (empty for null pages)
+  std::vector<std::vector<uint8_t>> max_values;  // Page max values (empty for null pages)
+  BoundaryOrder boundary_order = UNORDERED;      // Ordering of the min/max values across pages
+  std::vector<int64_t> null_counts;              // Optional count of nulls in each page
+};
+
+/**
+ * @brief Thrift-derived struct describing the bloom filter of a column chunk
+ *
+ * The header is followed by the bitset of the filter. Only the split-block algorithm, the XXH64
+ * hash and uncompressed bitsets are defined by the format, so the union fields are implied.
+ **/
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bitset in bytes
+};
+
 /**
  * @brief Count the number of leading zeros in an unsigned integer
  **/
@@ -294,6 +349,11 @@ class CompactProtocolReader {
   DECL_PARQUET_STRUCT(DataPageHeader);
   DECL_PARQUET_STRUCT(DictionaryPageHeader);
   DECL_PARQUET_STRUCT(KeyValue);
+  DECL_PARQUET_STRUCT(Statistics);
+  DECL_PARQUET_STRUCT(PageLocation);
+  DECL_PARQUET_STRUCT(OffsetIndex);
+  DECL_PARQUET_STRUCT(ColumnIndex);
+  DECL_PARQUET_STRUCT(BloomFilterHeader);
 #undef DECL_PARQUET_STRUCT
 
  public:
@@ -365,6 +425,10 @@ class CompactProtocolWriter {
   DECL_CPW_STRUCT(KeyValue);
   DECL_CPW_STRUCT(ColumnChunk);
   DECL_CPW_STRUCT(ColumnMetaData);
+  DECL_CPW_STRUCT(PageLocation);
+  DECL_CPW_STRUCT(OffsetIndex);
+  DECL_CPW_STRUCT(ColumnIndex);
+  DECL_CPW_STRUCT(BloomFilterHeader);
 #undef DECL_CPW_STRUCT
 
  protected:
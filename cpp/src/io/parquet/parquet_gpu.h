@@ -61,6 +61,16 @@ struct PageInfo {
                         // data error)
 };
 
+/**
+ * @brief Return whether a page holds data values encoded with a DELTA_XXX encoding
+ **/
+inline __host__ __device__ bool IsDeltaEncodedPage(const PageInfo &page)
+{
+  return !(page.flags & PAGEINFO_FLAGS_DICTIONARY) &&
+         (page.encoding == DELTA_BINARY_PACKED || page.encoding == DELTA_LENGTH_BYTE_ARRAY ||
+          page.encoding == DELTA_BYTE_ARRAY);
+}
+
 /**
  * @brief Struct describing a particular chunk of column data
  **/
@@ -98,10 +108,13 @@ struct ColumnChunkDesc {
       str_dict_index(nullptr),
       valid_map_base(nullptr),
       column_data_base(nullptr),
+      str_chars(nullptr),
       codec(codec_),
       converted_type(converted_type_),
       decimal_scale(decimal_scale_),
-      ts_clock_rate(ts_clock_rate_)
+      ts_clock_rate(ts_clock_rate_),
+      str_dict_base(-1),
+      level_data{nullptr, nullptr}
   {
   }
 
@@ -123,11 +136,15 @@ struct ColumnChunkDesc {
                                 // num_data_pages (dictionary pages first)
   nvstrdesc_s *str_dict_index;  // index for string dictionary
   uint32_t *valid_map_base;     // base pointer of valid bit map for this column
-  void *column_data_base;       // base pointer of column data
+  void *column_data_base;       // base pointer of column data (string offsets for strings)
+  char *str_chars;              // base pointer of the characters of strings columns
   int8_t codec;                 // compressed codec enum
   int8_t converted_type;        // converted type enum
   int8_t decimal_scale;         // decimal scale pow(10, -decimal_scale)
   int32_t ts_clock_rate;  // output timestamp clock frequency (0=default, 1000=ms, 1000000000=ns)
+  int32_t str_dict_base;  // position of this chunk's string dictionary among the dictionaries of
+                          // the column, output with the dictionary indices (-1=output hashes)
+  uint8_t *level_data[2];  // [def,rep] levels of each value, for lists and struct fields
 };
 
 /**
@@ -140,21 +157,37 @@ struct EncColumnDesc : stats_column_desc {
   uint8_t converted_type;  //!< logical data type
   uint8_t level_bits;  //!< bits to encode max definition (lower nibble) & repetition (upper nibble)
                        //!< levels
-  uint8_t pad;
+  uint8_t encoding;    //!< encoding of non-dictionary data pages (PLAIN or DELTA_BINARY_PACKED)
+  const uint32_t *row_offsets;  //!< First value of each row, for columns with repetition levels
+  const uint8_t *rep_levels;    //!< Repetition level of each value (null if none)
+  const uint8_t *def_levels;    //!< Definition level of each value (null to use the valid map)
 };
 
-#define MAX_PAGE_FRAGMENT_SIZE 5000  //!< Max number of rows in a page fragment
+/**
+ * @brief Struct describing the bloom filter of an encoder column chunk
+ **/
+struct BloomFilterChunk {
+  const EncColumnDesc *col_desc;  //!< Column description
+  uint32_t start_row;             //!< First row of chunk
+  uint32_t num_rows;              //!< Number of rows in chunk
+  uint32_t *words;                //!< Zero-initialized filter bitset
+  uint32_t num_blocks;            //!< Number of 256-bit blocks of the filter
+};
+
+#define MAX_PAGE_FRAGMENT_SIZE 5000  //!< Max number of rows in a dictionary-encoded page fragment
 
 /**
  * @brief Struct describing an encoder page fragment
+ *
+ * Fragments of list columns with more than MAX_PAGE_FRAGMENT_SIZE values (which hold lists of more
+ * than MAX_PAGE_FRAGMENT_SIZE elements) are not dictionary-encoded.
  **/
 struct PageFragment {
   uint32_t fragment_data_size;  //!< Size of fragment data in bytes
   uint32_t dict_data_size;      //!< Size of dictionary for this fragment
-  uint16_t num_rows;            //!< Number of rows in fragment
-  uint16_t non_nulls;           //!< Number of non-null values
-  uint16_t num_dict_vals;       //!< Number of unique dictionary entries
-  uint16_t pad;
+  uint32_t num_rows;            //!< Number of rows in fragment
+  uint32_t non_nulls;           //!< Number of non-null values
+  uint32_t num_dict_vals;       //!< Number of unique dictionary entries
 };
 
 /**
@@ -224,6 +257,8 @@ struct EncColumnChunk {
   uint32_t dictionary_size;       //!< Size of dictionary
   uint32_t total_dict_entries;    //!< Total number of entries in dictionary
   uint32_t ck_stat_size;          //!< Size of chunk-level statistics (included in 1st page header)
+  uint32_t max_page_size;         //!< Target size of data pages
+  uint32_t max_dict_size;         //!< Maximum size of the dictionary page
 };
 
 /**
@@ -277,6 +312,99 @@ cudaError_t DecodePageData(PageInfo *pages,
                            size_t min_row      = 0,
                            cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel for computing the sizes of the strings stored in the pages
+ *
+ * For the column chunks output as strings, the size of each string is written to the output
+ * pointed to in the chunk, at the position of its row. Scanned into offsets, the sizes locate the
+ * characters written by `DecodePageData()`. The other chunks, the null masks and the page info
+ * are left unchanged.
+ *
+ * @param[in] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] num_rows Total number of rows to read
+ * @param[in] min_row Minimum number of rows to read, default 0
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t ComputePageStringSizes(PageInfo *pages,
+                                   int32_t num_pages,
+                                   ColumnChunkDesc *chunks,
+                                   int32_t num_chunks,
+                                   size_t num_rows,
+                                   size_t min_row      = 0,
+                                   cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Launches kernel for decoding the repetition and definition levels of the pages of the
+ * columns with repetition levels
+ *
+ * The levels of each page are written to the level arrays of its column chunk, at the position
+ * of the page values within the column (the chunk start row plus the page chunk row).
+ *
+ * @param[in] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t DecodePageLevels(PageInfo *pages,
+                             int32_t num_pages,
+                             ColumnChunkDesc const *chunks,
+                             int32_t num_chunks,
+                             cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Launches kernel for computing the size of the delta-encoded pages once converted to
+ * PLAIN encoding
+ *
+ * The size of the other pages is zero, and the size of an invalid page is negative.
+ *
+ * @param[in] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[out] plain_sizes Size of each page once converted [num_pages]
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t ComputeDeltaPageSizes(const PageInfo *pages,
+                                  int32_t num_pages,
+                                  const ColumnChunkDesc *chunks,
+                                  int32_t num_chunks,
+                                  int64_t *plain_sizes,
+                                  cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Launches kernel for converting the delta-encoded pages to PLAIN encoding
+ *
+ * Each page is rewritten, levels included, at its offset in `plain_data`, and its page
+ * information is updated to describe the PLAIN-encoded copy.
+ *
+ * @param[in,out] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[out] plain_data Output buffer for the converted pages
+ * @param[in] plain_offsets Offset of each converted page in `plain_data` [num_pages + 1]
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t DecodeDeltaPages(PageInfo *pages,
+                             int32_t num_pages,
+                             const ColumnChunkDesc *chunks,
+                             int32_t num_chunks,
+                             uint8_t *plain_data,
+                             const int64_t *plain_offsets,
+                             cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Launches kernel for initializing encoder page fragments
  *
@@ -438,6 +566,22 @@ cudaError_t BuildChunkDictionaries(EncColumnChunk *chunks,
                                    uint32_t num_chunks,
                                    cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel for inserting the values of column chunks into their bloom filters
+ *
+ * Only columns without repetition levels, whose statistics type is an integer, timestamp, float
+ * or string type, are supported.
+ *
+ * @param[in] chunks Bloom filters of the column chunks
+ * @param[in] num_chunks Number of column chunks
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t BuildBloomFilters(BloomFilterChunk const *chunks,
+                              uint32_t num_chunks,
+                              cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace gpu
 }  // namespace parquet
 }  // namespace io
@@ -20,18 +20,45 @@
  */
 
 #include "reader_impl.hpp"
-
-#include <io/comp/gpuinflate.h>
-
+#include "bloom_filter.cuh"
+
+#include <io/comp/gpu_decompressor.h>
+#include <io/utilities/metadata_cache.hpp>
+#include <io/utilities/parallel_for.hpp>
+#include <io/utilities/prefetching_source.hpp>
+#include <io/utilities/row_mask.hpp>
+#include <io/statistics/stats_filter.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/scratch_memory.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/string_view.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+
 #include <algorithm>
 #include <array>
+#include <cstring>
+#include <iterator>
+#include <limits>
 #include <numeric>
 #include <regex>
 
@@ -44,14 +71,30 @@ using namespace cudf::io::parquet;
 using namespace cudf::io;
 
 namespace {
+/**
+ * @brief Function that translates a Parquet compression codec to its GPU decompression codec
+ */
+gpu_codec to_gpu_codec(parquet::Compression codec)
+{
+  switch (codec) {
+    case parquet::GZIP: return gpu_codec::GZIP;
+    case parquet::SNAPPY: return gpu_codec::SNAPPY;
+    case parquet::BROTLI: return gpu_codec::BROTLI;
+    case parquet::ZSTD: return gpu_codec::ZSTD;
+    default: CUDF_FAIL("Unexpected decompression dispatch");
+  }
+}
+
 /**
  * @brief Function that translates Parquet datatype to cuDF type enum
  */
 constexpr type_id to_type_id(parquet::Type physical,
                              parquet::ConvertedType logical,
                              bool strings_to_categorical,
+                             bool strings_to_dictionary,
                              type_id timestamp_type_id,
-                             int32_t decimal_scale)
+                             int32_t decimal_scale,
+                             bool decimals_as_float)
 {
   // Logical type used for actual data interpretation; the legacy converted type
   // is superceded by 'logical' type whenever available.
@@ -70,6 +113,9 @@ constexpr type_id to_type_id(parquet::Type physical,
       return (timestamp_type_id != type_id::EMPTY) ? timestamp_type_id
                                                    : type_id::TIMESTAMP_MILLISECONDS;
     case parquet::DECIMAL:
+      // Integer decimals are read as fixed-point, other decimals are converted to float64
+      if (!decimals_as_float && physical == parquet::INT32) { return type_id::DECIMAL32; }
+      if (!decimals_as_float && physical == parquet::INT64) { return type_id::DECIMAL64; }
       if (decimal_scale != 0 || (physical != parquet::INT32 && physical != parquet::INT64)) {
         return type_id::FLOAT64;
       }
@@ -87,8 +133,9 @@ constexpr type_id to_type_id(parquet::Type physical,
     case parquet::DOUBLE: return type_id::FLOAT64;
     case parquet::BYTE_ARRAY:
     case parquet::FIXED_LEN_BYTE_ARRAY:
-      // Can be mapped to INT32 (32-bit hash) or STRING
-      return strings_to_categorical ? type_id::INT32 : type_id::STRING;
+      // Can be mapped to INT32 (32-bit hash), DICTIONARY32 or STRING
+      if (strings_to_categorical) { return type_id::INT32; }
+      return strings_to_dictionary ? type_id::DICTIONARY32 : type_id::STRING;
     case parquet::INT96:
       return (timestamp_type_id != type_id::EMPTY) ? timestamp_type_id
                                                    : type_id::TIMESTAMP_NANOSECONDS;
@@ -135,6 +182,8 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
     type_width = 2;  // I32 -> I16
   } else if (column_type_id == type_id::INT32) {
     type_width = 4;  // str -> hash32
+  } else if (column_type_id == type_id::DICTIONARY32) {
+    type_width = 4;  // str -> dictionary index
   } else if (is_timestamp(data_type{column_type_id})) {
     clock_rate = to_clockrate(timestamp_type_id);
   }
@@ -147,6 +196,810 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Returns true if the string dictionary of a chunk holds all of its values
+ *
+ * @param chunk Column chunk descriptor
+ * @param pages Pages of the chunk, dictionary page first
+ */
+bool is_dictionary_encoded(gpu::ColumnChunkDesc const &chunk, gpu::PageInfo const *pages)
+{
+  if (chunk.num_dict_pages == 0) { return false; }
+  return std::all_of(pages, pages + chunk.max_num_pages, [](auto const &page) {
+    return (page.flags & gpu::PAGEINFO_FLAGS_DICTIONARY) ||
+           page.encoding == parquet::PLAIN_DICTIONARY || page.encoding == parquet::RLE_DICTIONARY;
+  });
+}
+
+struct dict_entry_to_str_pair {
+  __device__ column_buffer::str_pair operator()(gpu::nvstrdesc_s const &entry) const
+  {
+    return {entry.ptr, static_cast<size_type>(entry.count)};
+  }
+};
+
+struct remap_dict_index {
+  size_type const *key_indices;
+  size_type num_entries;
+
+  __device__ size_type operator()(size_type entry) const
+  {
+    // null rows are not decoded and may hold any entry
+    return (entry >= 0 && entry < num_entries) ? key_indices[entry] : 0;
+  }
+};
+
+/**
+ * @brief Creates a DICTIONARY32 column from the dictionary entries of all the chunks of
+ * a column and from the decoded position of each row among these entries
+ *
+ * The entries of all the chunks are made unique and sorted to become the keys and the
+ * positions are replaced by the index of their key.
+ *
+ * @param dict_entries Index of the string dictionaries of all the chunks
+ * @param dict_ranges Offset and size of the dictionary of each chunk of the column
+ * @param num_rows Number of rows of the column
+ * @param buffer Decoded positions of the rows and their null mask
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> make_dictionary_from_chunks(
+  rmm::device_vector<gpu::nvstrdesc_s> const &dict_entries,
+  std::vector<std::pair<size_t, size_t>> const &dict_ranges,
+  size_type num_rows,
+  column_buffer &buffer,
+  cudaStream_t stream,
+  rmm::mr::device_memory_resource *mr)
+{
+  auto const num_entries = std::accumulate(
+    dict_ranges.begin(), dict_ranges.end(), size_t{0}, [](auto sum, auto const &range) {
+      return sum + range.second;
+    });
+  auto entries =
+    cudf::detail::make_scratch_vector<column_buffer::str_pair>(num_entries, {}, stream);
+  size_t pos = 0;
+  for (auto const &range : dict_ranges) {
+    thrust::transform(cudf::detail::scratch_policy(stream)->on(stream),
+                      dict_entries.begin() + range.first,
+                      dict_entries.begin() + range.first + range.second,
+                      entries.begin() + pos,
+                      dict_entry_to_str_pair{});
+    pos += range.second;
+  }
+  // the chunks may share entries; encoding them gives sorted unique keys and the key of each
+  auto const encoded_entries =
+    cudf::dictionary::detail::encode(make_strings_column(entries, stream)->view(),
+                                     data_type{type_id::INT32},
+                                     cudf::get_scratch_resource(),
+                                     stream);
+  dictionary_column_view const entries_view(encoded_entries->view());
+
+  auto const null_count = buffer.null_count();
+  auto indices          = make_column(data_type{type_id::INT32}, num_rows, buffer, stream, mr);
+  auto contents         = indices->release();
+  auto d_indices        = static_cast<size_type *>(contents.data->data());
+  thrust::transform(cudf::detail::scratch_policy(stream)->on(stream),
+                    d_indices,
+                    d_indices + num_rows,
+                    d_indices,
+                    remap_dict_index{entries_view.indices().data<size_type>(),
+                                     static_cast<size_type>(num_entries)});
+  return make_dictionary_column(
+    std::make_unique<column>(entries_view.keys(), stream, mr),
+    std::make_unique<column>(data_type{type_id::INT32}, num_rows, std::move(*contents.data)),
+    std::move(*contents.null_mask),
+    null_count);
+}
+
+/**
+ * @brief Definition levels that describe the entries of a list column
+ */
+struct list_def_levels {
+  int list_level;         // Entries of a lower level are null lists
+  int element_level;      // Entries of a lower level are empty lists, the others list elements
+  bool element_nullable;  // Whether the elements may be null
+};
+
+/**
+ * @brief Returns the definition levels of a list column from the schema of its leaf
+ *
+ * Both the three-level list structure of the specification and the legacy two-level structure,
+ * where the repeated node is the leaf, are supported, but only with one level of nesting.
+ *
+ * @param schema File schema
+ * @param leaf_idx Index of the leaf in the schema
+ */
+list_def_levels get_list_def_levels(std::vector<SchemaElement> const &schema, int leaf_idx)
+{
+  auto const &leaf = schema[leaf_idx];
+  CUDF_EXPECTS(leaf.max_repetition_level == 1, "Nested lists are not supported");
+  auto rep_idx = leaf_idx;
+  while (schema[rep_idx].repetition_type != REPEATED) {
+    rep_idx = schema[rep_idx].parent_idx;
+  }
+  CUDF_EXPECTS(rep_idx == leaf_idx || leaf.parent_idx == rep_idx,
+               "Lists of groups are not supported");
+  auto const list_idx = schema[rep_idx].parent_idx;
+  CUDF_EXPECTS(list_idx == 0 || schema[list_idx].parent_idx == 0,
+               "Lists within groups are not supported");
+  CUDF_EXPECTS(leaf.max_definition_level < 8, "Invalid list definition level");
+  auto const element_level = schema[rep_idx].max_definition_level;
+  return {(list_idx == 0) ? 0 : schema[list_idx].max_definition_level,
+          element_level,
+          leaf.max_definition_level > element_level};
+}
+
+struct is_row_start {
+  uint8_t const *rep_levels;
+  size_type num_entries;
+
+  __device__ bool operator()(size_type entry) const
+  {
+    return entry >= num_entries || rep_levels[entry] == 0;
+  }
+};
+
+struct is_list_element {
+  uint8_t const *def_levels;
+  size_type num_entries;
+  int element_level;
+
+  __device__ size_type operator()(size_type entry) const
+  {
+    return entry < num_entries && def_levels[entry] >= element_level;
+  }
+};
+
+struct row_offset_from_entries {
+  size_type const *row_starts;
+  size_type const *entry_elements;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    return entry_elements[row_starts[row]] - entry_elements[row_starts[0]];
+  }
+};
+
+struct is_valid_list {
+  size_type const *row_starts;
+  uint8_t const *def_levels;
+  int list_level;
+
+  __device__ bool operator()(size_type row) const
+  {
+    return def_levels[row_starts[row]] >= list_level;
+  }
+};
+
+/**
+ * @brief Creates a LIST column from the values and levels of a column with repetition levels
+ *
+ * The values hold one position per level entry, including the entries of the empty and null
+ * lists, which are not list elements. The elements are gathered into the child column and the
+ * offsets and validity of the lists are derived from the levels.
+ *
+ * @param values Decoded values, one per level entry
+ * @param rep_levels Repetition level of each entry
+ * @param def_levels Definition level of each entry
+ * @param levels Definition levels of the lists and of their elements
+ * @param first_row Number of leading rows to skip
+ * @param num_rows Number of rows to output
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> make_list_from_levels(column_view const &values,
+                                              uint8_t const *rep_levels,
+                                              uint8_t const *def_levels,
+                                              list_def_levels const &levels,
+                                              size_type first_row,
+                                              size_type num_rows,
+                                              cudaStream_t stream,
+                                              rmm::mr::device_memory_resource *mr)
+{
+  auto const num_entries = values.size();
+  auto execpol           = cudf::detail::scratch_policy(stream);
+  auto entries_begin     = thrust::make_counting_iterator<size_type>(0);
+  is_list_element const is_element{def_levels, num_entries, levels.element_level};
+
+  // First entry of each row, followed by the number of entries
+  auto row_starts = cudf::detail::make_scratch_vector<size_type>(num_entries + 1, 0, stream);
+  auto const row_starts_end = thrust::copy_if(execpol->on(stream),
+                                              entries_begin,
+                                              entries_begin + num_entries + 1,
+                                              row_starts.begin(),
+                                              is_row_start{rep_levels, num_entries});
+  CUDF_EXPECTS(first_row + num_rows < row_starts_end - row_starts.begin(),
+               "Repetition levels do not match the number of rows");
+  auto const d_row_starts = row_starts.data().get() + first_row;
+
+  // Number of list elements before each entry
+  auto entry_elements =
+    cudf::detail::make_scratch_vector<size_type>(num_entries + 1, 0, stream);
+  thrust::transform_exclusive_scan(execpol->on(stream),
+                                   entries_begin,
+                                   entries_begin + num_entries + 1,
+                                   entry_elements.begin(),
+                                   is_element,
+                                   0,
+                                   thrust::plus<size_type>());
+
+  auto offsets = make_numeric_column(
+    data_type{type_id::INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(execpol->on(stream),
+                    entries_begin,
+                    entries_begin + num_rows + 1,
+                    offsets->mutable_view().begin<size_type>(),
+                    row_offset_from_entries{d_row_starts, entry_elements.data().get()});
+
+  // Gather the elements of the output rows
+  std::array<size_type, 2> entry_range;
+  CUDA_TRY(cudaMemcpyAsync(
+    &entry_range[0], d_row_starts, sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    &entry_range[1], d_row_starts + num_rows, sizeof(size_type), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  auto gather_map =
+    cudf::detail::make_scratch_vector<size_type>(entry_range[1] - entry_range[0], 0, stream);
+  auto const gather_map_end = thrust::copy_if(execpol->on(stream),
+                                              entries_begin + entry_range[0],
+                                              entries_begin + entry_range[1],
+                                              gather_map.begin(),
+                                              is_element);
+  column_view const gather_map_view(data_type{type_id::INT32},
+                                    static_cast<size_type>(gather_map_end - gather_map.begin()),
+                                    gather_map.data().get());
+  auto child = std::move(cudf::detail::gather(table_view{{values}},
+                                              gather_map_view,
+                                              cudf::detail::out_of_bounds_policy::IGNORE,
+                                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                              mr,
+                                              stream)
+                           ->release()[0]);
+  if (!levels.element_nullable) { child->set_null_mask(rmm::device_buffer{}, 0); }
+
+  rmm::device_buffer null_mask{};
+  size_type null_count = 0;
+  if (levels.list_level > 0) {
+    std::tie(null_mask, null_count) =
+      cudf::detail::valid_if(entries_begin,
+                             entries_begin + num_rows,
+                             is_valid_list{d_row_starts, def_levels, levels.list_level},
+                             stream,
+                             mr);
+  }
+  return make_lists_column(
+    num_rows, std::move(offsets), std::move(child), null_count, std::move(null_mask), stream, mr);
+}
+
+/**
+ * @brief Returns whether a leaf is a field of a group without repetition, read as a field of a
+ * STRUCT column
+ */
+bool is_struct_field(std::vector<SchemaElement> const &schema, int leaf_idx)
+{
+  return schema[leaf_idx].parent_idx != 0 && schema[leaf_idx].max_repetition_level == 0;
+}
+
+struct is_defined_row {
+  uint8_t const *def_levels;
+  int level;
+
+  __device__ bool operator()(size_type row) const { return def_levels[row] >= level; }
+};
+
+/**
+ * @brief Creates the STRUCT column of a group node from the columns of some of its leaf fields
+ *
+ * The leaves `[begin, end)` share the node at `depth` of their paths. A struct is null where the
+ * definition level of its rows, as found in any of its leaves, is lower than its own.
+ *
+ * @param schema File schema
+ * @param depth Depth of the group node in the paths of the leaves
+ * @param paths Schema indices of the nodes of each leaf, from its top-level node to the leaf
+ * @param columns Column of each leaf, moved into the result
+ * @param def_levels Definition level of each row of each leaf
+ * @param begin First leaf of the group
+ * @param end Leaf after the last leaf of the group
+ * @param num_rows Number of rows of the columns
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> make_struct_from_levels(std::vector<SchemaElement> const &schema,
+                                                size_t depth,
+                                                std::vector<std::vector<int>> const &paths,
+                                                std::vector<std::unique_ptr<column>> &columns,
+                                                std::vector<uint8_t const *> const &def_levels,
+                                                size_t begin,
+                                                size_t end,
+                                                size_type num_rows,
+                                                cudaStream_t stream,
+                                                rmm::mr::device_memory_resource *mr)
+{
+  std::vector<std::unique_ptr<column>> fields;
+  for (auto i = begin; i < end;) {
+    auto next = i + 1;
+    while (next < end && paths[next][depth + 1] == paths[i][depth + 1]) { next++; }
+    if (paths[i].size() == depth + 2) {
+      fields.push_back(std::move(columns[i]));
+    } else {
+      fields.push_back(make_struct_from_levels(
+        schema, depth + 1, paths, columns, def_levels, i, next, num_rows, stream, mr));
+    }
+    i = next;
+  }
+
+  auto const &node = schema[paths[begin][depth]];
+  rmm::device_buffer null_mask{};
+  size_type null_count = 0;
+  if (node.repetition_type == OPTIONAL) {
+    auto const rows = thrust::make_counting_iterator<size_type>(0);
+    std::tie(null_mask, null_count) =
+      cudf::detail::valid_if(rows,
+                             rows + num_rows,
+                             is_defined_row{def_levels[begin], node.max_definition_level},
+                             stream,
+                             mr);
+  }
+  return make_structs_column(
+    num_rows, std::move(fields), null_count, std::move(null_mask), stream, mr);
+}
+
+/**
+ * @brief Replaces the columns of the fields of each top-level group by a STRUCT column named
+ * after the group
+ *
+ * The fields of a group are the consecutive columns whose leaves share its top-level node.
+ *
+ * @param schema File schema
+ * @param leaf_idx Index of the leaf of each column in the schema
+ * @param columns Columns, replaced by the STRUCT columns of their groups
+ * @param names Column names, replaced by the names of the STRUCT columns
+ * @param def_levels Definition level of each row of each struct field, null for other columns
+ * @param num_rows Number of rows of the columns
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ */
+void assemble_struct_columns(std::vector<SchemaElement> const &schema,
+                             std::vector<int> const &leaf_idx,
+                             std::vector<std::unique_ptr<column>> &columns,
+                             std::vector<std::string> &names,
+                             std::vector<uint8_t const *> const &def_levels,
+                             size_type num_rows,
+                             cudaStream_t stream,
+                             rmm::mr::device_memory_resource *mr)
+{
+  std::vector<std::vector<int>> paths(columns.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    for (auto idx = leaf_idx[i]; idx != 0; idx = schema[idx].parent_idx) {
+      paths[i].insert(paths[i].begin(), idx);
+    }
+  }
+
+  std::vector<std::unique_ptr<column>> out_columns;
+  std::vector<std::string> out_names;
+  for (size_t i = 0; i < columns.size();) {
+    if (!is_struct_field(schema, leaf_idx[i])) {
+      out_columns.push_back(std::move(columns[i]));
+      out_names.push_back(names[i]);
+      i++;
+      continue;
+    }
+    auto next = i + 1;
+    while (next < columns.size() && is_struct_field(schema, leaf_idx[next]) &&
+           paths[next][0] == paths[i][0]) {
+      next++;
+    }
+    out_columns.push_back(make_struct_from_levels(
+      schema, 0, paths, columns, def_levels, i, next, num_rows, stream, mr));
+    out_names.push_back(schema[paths[i][0]].name);
+    i = next;
+  }
+  columns = std::move(out_columns);
+  names   = std::move(out_names);
+}
+
+/**
+ * @brief Decodes a little-endian fixed-width statistics value
+ */
+template <typename T>
+bool decode_stats_value(std::vector<uint8_t> const &bytes, T &value)
+{
+  if (bytes.size() != sizeof(T)) { return false; }
+  memcpy(&value, bytes.data(), sizeof(T));
+  return true;
+}
+
+/**
+ * @brief Decodes plain-encoded min/max values into a host-side value range
+ *
+ * @param vmin Encoded min value
+ * @param vmax Encoded max value
+ * @param col_schema Schema element of the column
+ * @param is_unsigned Whether the values use an unsigned ordering
+ * @param range Value range to fill in; its kind is left to NONE if the values are invalid
+ */
+void decode_value_range(std::vector<uint8_t> const &vmin,
+                        std::vector<uint8_t> const &vmax,
+                        SchemaElement const &col_schema,
+                        bool is_unsigned,
+                        column_value_range &range)
+{
+  using kind = column_value_range::value_kind;
+  bool valid = false;
+  switch (col_schema.type) {
+    case parquet::BOOLEAN: {
+      uint8_t lo, hi;
+      valid       = decode_stats_value(vmin, lo) && decode_stats_value(vmax, hi);
+      range.kind  = kind::SIGNED;
+      range.i_min = lo;
+      range.i_max = hi;
+    } break;
+    case parquet::INT32:
+      if (is_unsigned) {
+        uint32_t lo, hi;
+        valid       = decode_stats_value(vmin, lo) && decode_stats_value(vmax, hi);
+        range.kind  = kind::UNSIGNED;
+        range.u_min = lo;
+        range.u_max = hi;
+      } else {
+        int32_t lo, hi;
+        valid       = decode_stats_value(vmin, lo) && decode_stats_value(vmax, hi);
+        range.kind  = kind::SIGNED;
+        range.i_min = lo;
+        range.i_max = hi;
+      }
+      break;
+    case parquet::INT64:
+      if (is_unsigned) {
+        uint64_t lo, hi;
+        valid       = decode_stats_value(vmin, lo) && decode_stats_value(vmax, hi);
+        range.kind  = kind::UNSIGNED;
+        range.u_min = lo;
+        range.u_max = hi;
+      } else {
+        int64_t lo, hi;
+        valid       = decode_stats_value(vmin, lo) && decode_stats_value(vmax, hi);
+        range.kind  = kind::SIGNED;
+        range.i_min = lo;
+        range.i_max = hi;
+      }
+      break;
+    case parquet::FLOAT: {
+      float lo, hi;
+      valid       = decode_stats_value(vmin, lo) && decode_stats_value(vmax, hi);
+      range.kind  = kind::FLOAT;
+      range.f_min = lo;
+      range.f_max = hi;
+    } break;
+    case parquet::DOUBLE: {
+      double lo, hi;
+      valid       = decode_stats_value(vmin, lo) && decode_stats_value(vmax, hi);
+      range.kind  = kind::FLOAT;
+      range.f_min = lo;
+      range.f_max = hi;
+    } break;
+    case parquet::BYTE_ARRAY:
+      range.kind  = kind::STRING;
+      range.s_min = std::string(vmin.begin(), vmin.end());
+      range.s_max = std::string(vmax.begin(), vmax.end());
+      valid       = true;
+      break;
+    default: break;
+  }
+  if (!valid) { range.kind = kind::NONE; }
+}
+
+/**
+ * @brief Returns whether the column values use an unsigned ordering
+ */
+bool is_unsigned_type(SchemaElement const &col_schema)
+{
+  return col_schema.converted_type == parquet::UINT_8 ||
+         col_schema.converted_type == parquet::UINT_16 ||
+         col_schema.converted_type == parquet::UINT_32 ||
+         col_schema.converted_type == parquet::UINT_64;
+}
+
+/**
+ * @brief Converts the chunk statistics of a column into a host-side value range
+ *
+ * @param col_meta Column chunk metadata containing the encoded statistics
+ * @param col_schema Schema element of the column
+ *
+ * @return Value range usable by the statistics filter
+ */
+column_value_range to_value_range(ColumnMetaData const &col_meta, SchemaElement const &col_schema)
+{
+  column_value_range range;
+  if (col_meta.statistics_blob.empty()) { return range; }
+
+  Statistics stats;
+  CompactProtocolReader cp(col_meta.statistics_blob.data(), col_meta.statistics_blob.size());
+  if (!cp.read(&stats)) { return range; }
+  range.all_nulls = (stats.null_count >= 0 && stats.null_count == col_meta.num_values);
+
+  // The deprecated min/max fields are only meaningful for signed orderings
+  auto const is_unsigned    = is_unsigned_type(col_schema);
+  bool const has_new_minmax = !stats.min_value.empty() && !stats.max_value.empty();
+  bool const signed_order   = !is_unsigned && col_schema.type != parquet::BYTE_ARRAY;
+  auto const &vmin          = has_new_minmax ? stats.min_value : stats.min;
+  auto const &vmax          = has_new_minmax ? stats.max_value : stats.max;
+  if (!has_new_minmax && !signed_order) { return range; }
+
+  decode_value_range(vmin, vmax, col_schema, is_unsigned, range);
+  return range;
+}
+
+/**
+ * @brief Converts the ColumnIndex entry of a page into a host-side value range
+ *
+ * @param column_index Page min/max values of the column chunk
+ * @param page Index of the data page
+ * @param col_schema Schema element of the column
+ *
+ * @return Value range usable by the statistics filter
+ */
+column_value_range to_value_range(ColumnIndex const &column_index,
+                                  size_t page,
+                                  SchemaElement const &col_schema)
+{
+  column_value_range range;
+  if (page >= column_index.null_pages.size() || page >= column_index.min_values.size() ||
+      page >= column_index.max_values.size()) {
+    return range;
+  }
+  range.all_nulls = column_index.null_pages[page];
+  if (!range.all_nulls) {
+    decode_value_range(column_index.min_values[page],
+                       column_index.max_values[page],
+                       col_schema,
+                       is_unsigned_type(col_schema),
+                       range);
+  }
+  return range;
+}
+
+/**
+ * @brief Returns the XXH64 hashes of the plain encodings a column may use for a filter literal
+ *
+ * Narrow unsigned values may be stored zero- or sign-extended, so both encodings are hashed.
+ * Returns no hash if the bloom filter cannot be used for the literal, for example if it is not
+ * exactly representable in the physical type of the column, or if it is a floating-point zero or
+ * NaN, whose encodings are not unique.
+ */
+std::vector<uint64_t> literal_hashes(stats_filter const &filter, SchemaElement const &col_schema)
+{
+  using literal_kind = stats_filter::literal_kind;
+  auto const lit     = filter.get_literal_kind();
+  auto const v       = filter.int_value();
+  switch (col_schema.type) {
+    case parquet::INT32: {
+      if (lit != literal_kind::INTEGER) { return {}; }
+      switch (col_schema.converted_type) {
+        case parquet::UINT_8:
+          if (v < 0 || v > std::numeric_limits<uint8_t>::max()) { return {}; }
+          return {XXHash_64<int32_t>{}.compute(static_cast<int32_t>(v)),
+                  XXHash_64<int32_t>{}.compute<int32_t>(static_cast<int8_t>(v))};
+        case parquet::UINT_16:
+          if (v < 0 || v > std::numeric_limits<uint16_t>::max()) { return {}; }
+          return {XXHash_64<int32_t>{}.compute(static_cast<int32_t>(v)),
+                  XXHash_64<int32_t>{}.compute<int32_t>(static_cast<int16_t>(v))};
+        case parquet::UINT_32:
+          if (v < 0 || v > std::numeric_limits<uint32_t>::max()) { return {}; }
+          return {XXHash_64<uint32_t>{}.compute(static_cast<uint32_t>(v))};
+        default:
+          if (v < std::numeric_limits<int32_t>::min() || v > std::numeric_limits<int32_t>::max()) {
+            return {};
+          }
+          return {XXHash_64<int32_t>{}.compute(static_cast<int32_t>(v))};
+      }
+    }
+    case parquet::INT64:
+      if (lit != literal_kind::INTEGER) { return {}; }
+      if (col_schema.converted_type == parquet::UINT_64 && v < 0) { return {}; }
+      return {XXHash_64<int64_t>{}.compute(v)};
+    case parquet::FLOAT:
+    case parquet::DOUBLE: {
+      if (lit == literal_kind::STRING) { return {}; }
+      auto const d = (lit == literal_kind::INTEGER) ? static_cast<double>(v) : filter.float_value();
+      if (std::isnan(d) || d == 0) { return {}; }
+      // Integers beyond 2^53 may not convert exactly
+      constexpr int64_t max_exact_int = int64_t{1} << 53;
+      if (lit == literal_kind::INTEGER && (v > max_exact_int || v < -max_exact_int)) { return {}; }
+      if (col_schema.type == parquet::DOUBLE) { return {XXHash_64<double>{}.compute(d)}; }
+      auto const f = static_cast<float>(d);
+      if (static_cast<double>(f) != d) { return {}; }
+      return {XXHash_64<float>{}.compute(f)};
+    }
+    case parquet::BYTE_ARRAY: {
+      if (lit != literal_kind::STRING) { return {}; }
+      auto const &str = filter.string_value();
+      auto const view = string_view(str.data(), static_cast<size_type>(str.size()));
+      return {XXHash_64<string_view>{}(view)};
+    }
+    default: return {};
+  }
+}
+
+/**
+ * @brief Returns whether the bloom filter of a column chunk may contain a filter literal
+ *
+ * The filter is read from the source; chunks without a readable filter may contain any value.
+ *
+ * @param source Source of the file
+ * @param col_meta Column chunk metadata
+ * @param col_schema Schema element of the column
+ * @param filter Equality comparison
+ */
+bool chunk_may_contain(datasource &source,
+                       ColumnMetaData const &col_meta,
+                       SchemaElement const &col_schema,
+                       stats_filter const &filter)
+{
+  if (col_meta.bloom_filter_offset <= 0) { return true; }
+  auto const hashes = literal_hashes(filter, col_schema);
+  if (hashes.empty()) { return true; }
+
+  // The length of the filter is optional; the header is small enough to be read speculatively
+  constexpr size_t max_header_size = 64;
+  auto const offset                = static_cast<size_t>(col_meta.bloom_filter_offset);
+  auto const read_size             = (col_meta.bloom_filter_length > 0)
+                           ? static_cast<size_t>(col_meta.bloom_filter_length)
+                           : max_header_size;
+  auto buffer = source.host_read(offset, read_size);
+  BloomFilterHeader header;
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  if (!cp.read(&header)) { return true; }
+  auto const size = static_cast<size_t>(header.num_bytes);
+  if (size < min_bloom_filter_size || size > max_bloom_filter_size ||
+      size % bloom_filter_block_bytes != 0) {
+    return true;
+  }
+  auto const header_size = static_cast<size_t>(cp.bytecount());
+  uint8_t const *bitset  = buffer->data() + header_size;
+  if (header_size + size > buffer->size()) {
+    buffer = source.host_read(offset + header_size, size);
+    if (buffer->size() != size) { return true; }
+    bitset = buffer->data();
+  }
+  return std::any_of(hashes.begin(), hashes.end(), [&](uint64_t hash) {
+    return bloom_filter_may_contain(bitset, size, hash);
+  });
+}
+
+/**
+ * @brief Appends the names of the columns referenced by a filter
+ */
+void collect_filter_columns(stats_filter const &filter, std::vector<std::string> &names)
+{
+  switch (filter.kind()) {
+    case stats_filter::node_kind::COMPARE:
+      if (std::find(names.begin(), names.end(), filter.column()) == names.end()) {
+        names.push_back(filter.column());
+      }
+      break;
+    case stats_filter::node_kind::AND:
+    case stats_filter::node_kind::OR:
+      collect_filter_columns(filter.left(), names);
+      collect_filter_columns(filter.right(), names);
+      break;
+    default: break;
+  }
+}
+
+/**
+ * @brief Page indexes of one column chunk; both are empty if the chunk has no page index
+ */
+struct chunk_page_index {
+  ColumnIndex column_index;
+  OffsetIndex offset_index;
+
+  bool has_offset_index() const { return !offset_index.page_locations.empty(); }
+  bool has_column_index() const
+  {
+    return has_offset_index() &&
+           column_index.null_pages.size() == offset_index.page_locations.size();
+  }
+};
+
+/**
+ * @brief Returns the first row of each data page of a chunk followed by the row group row count
+ */
+std::vector<int64_t> page_row_bounds(OffsetIndex const &offset_index, int64_t num_rows)
+{
+  std::vector<int64_t> bounds;
+  bounds.reserve(offset_index.page_locations.size() + 1);
+  for (auto const &loc : offset_index.page_locations) { bounds.push_back(loc.first_row_index); }
+  if (bounds.empty()) { bounds.push_back(0); }
+  bounds.push_back(num_rows);
+  return bounds;
+}
+
+/**
+ * @brief Returns the position of the page that holds `row`
+ */
+size_t page_of_row(std::vector<int64_t> const &bounds, int64_t row)
+{
+  return std::upper_bound(bounds.begin(), bounds.end() - 1, row) - bounds.begin() - 1;
+}
+
+/**
+ * @brief Returns whether the page locations are usable to read the pages of a row group
+ */
+bool is_valid_offset_index(OffsetIndex const &offset_index, int64_t num_rows)
+{
+  auto const &locs = offset_index.page_locations;
+  if (locs.empty() || locs[0].first_row_index != 0) { return false; }
+  for (size_t i = 0; i < locs.size(); ++i) {
+    if (locs[i].offset < 0 || locs[i].compressed_page_size <= 0) { return false; }
+    auto const next_row = (i + 1 < locs.size()) ? locs[i + 1].first_row_index : num_rows;
+    if (next_row <= locs[i].first_row_index) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Widens row ranges to the page boundaries of every column and merges the ranges that
+ * overlap or touch
+ *
+ * @param ranges [begin, end) row ranges
+ * @param column_bounds Page row bounds of each column, as returned by `page_row_bounds()`
+ */
+void align_row_ranges(std::vector<std::pair<int64_t, int64_t>> &ranges,
+                      std::vector<std::vector<int64_t>> const &column_bounds)
+{
+  for (auto &range : ranges) {
+    // Widening to the pages of one column may cross a page boundary of another one
+    bool widened = true;
+    while (widened) {
+      widened = false;
+      for (auto const &bounds : column_bounds) {
+        auto const begin = bounds[page_of_row(bounds, range.first)];
+        auto const end   = bounds[page_of_row(bounds, range.second - 1) + 1];
+        if (begin < range.first || end > range.second) {
+          range   = {std::min(begin, range.first), std::max(end, range.second)};
+          widened = true;
+        }
+      }
+    }
+  }
+  std::sort(ranges.begin(), ranges.end());
+  std::vector<std::pair<int64_t, int64_t>> merged;
+  for (auto const &range : ranges) {
+    if (!merged.empty() && range.first <= merged.back().second) {
+      merged.back().second = std::max(merged.back().second, range.second);
+    } else {
+      merged.push_back(range);
+    }
+  }
+  ranges = std::move(merged);
+}
+
+/**
+ * @brief Returns the [begin, end) runs of row group rows selected by a row mask
+ *
+ * @param selected Host copy of the row mask
+ * @param first_mask_row Position in the mask of the row group row `begin`
+ * @param begin First row group row covered by the mask
+ * @param end Row group row after the last row covered by the mask
+ */
+std::vector<std::pair<int64_t, int64_t>> selected_row_ranges(std::vector<uint8_t> const &selected,
+                                                             int64_t first_mask_row,
+                                                             int64_t begin,
+                                                             int64_t end)
+{
+  std::vector<std::pair<int64_t, int64_t>> ranges;
+  for (auto row = begin; row < end; ++row) {
+    if (!selected[first_mask_row + row - begin]) { continue; }
+    if (!ranges.empty() && ranges.back().second == row) {
+      ranges.back().second = row + 1;
+    } else {
+      ranges.emplace_back(row, row + 1);
+    }
+  }
+  return ranges;
+}
+
 }  // namespace
 
 std::string name_from_path(const std::vector<std::string> &path_in_schema)
@@ -156,10 +1009,24 @@ std::string name_from_path(const std::vector<std::string> &path_in_schema)
   return s;
 }
 
+/**
+ * @brief Returns the name of the output column of a column chunk
+ *
+ * List columns are named after their top-level node, the other columns after their path.
+ */
+std::string column_name(ColumnMetaData const &col_meta, SchemaElement const &col_schema)
+{
+  auto const &path = col_meta.path_in_schema;
+  if (col_schema.max_repetition_level > 0 && path.size() > 0) { return path[0]; }
+  return name_from_path(path);
+}
+
 /**
  * @brief Class for parsing dataset metadata
  */
 struct metadata : public FileMetaData {
+  metadata() = default;
+
   explicit metadata(datasource *source)
   {
     constexpr auto header_len = sizeof(file_header_s);
@@ -180,7 +1047,10 @@ struct metadata : public FileMetaData {
     CompactProtocolReader cp(buffer->data(), ender->footer_len);
     CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
     CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
+    footer_size = ender->footer_len;
   }
+
+  size_t footer_size = 0;  ///< Serialized size of the footer, charged in the metadata cache
 };
 
 class aggregate_metadata {
@@ -192,14 +1062,32 @@ class aggregate_metadata {
 
   /**
    * @brief Create a metadata object from each element in the source vector
+   *
+   * The footers are read and parsed in parallel, as datasets of many small files are dominated
+   * by the per-file latency. Footers already parsed by a previous reader of the same file
+   * version are copied from the metadata cache instead.
    */
-  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const &sources)
+  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const &sources,
+                              std::vector<std::string> const &cache_keys)
   {
-    std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const &source) {
-        return metadata(source.get());
-      });
+    std::vector<metadata> metadatas(sources.size());
+    auto &cache = metadata_cache<metadata>::instance();
+    parallel_for(sources.size(), [&](size_t i) {
+      auto const use_cache = i < cache_keys.size() && !cache_keys[i].empty();
+      if (use_cache) {
+        auto const cached = cache.get(cache_keys[i]);
+        if (cached != nullptr) {
+          metadatas[i] = *cached;
+          return;
+        }
+      }
+      metadatas[i] = metadata(sources[i].get());
+      if (use_cache) {
+        cache.put(cache_keys[i],
+                  std::make_shared<metadata const>(metadatas[i]),
+                  metadatas[i].footer_size);
+      }
+    });
     return metadatas;
   }
 
@@ -243,7 +1131,7 @@ class aggregate_metadata {
       if (pfm.row_groups.size() != 0) {
         std::vector<std::string> column_names;
         for (const auto &chunk : pfm.row_groups[0].columns) {
-          column_names.emplace_back(name_from_path(chunk.meta_data.path_in_schema));
+          column_names.emplace_back(column_name(chunk.meta_data, pfm.schema[chunk.schema_idx]));
         }
         return column_names;
       }
@@ -252,8 +1140,9 @@ class aggregate_metadata {
   }
 
  public:
-  aggregate_metadata(std::vector<std::unique_ptr<datasource>> const &sources)
-    : per_file_metadata(metadatas_from_sources(sources)),
+  aggregate_metadata(std::vector<std::unique_ptr<datasource>> const &sources,
+                     std::vector<std::string> const &cache_keys)
+    : per_file_metadata(metadatas_from_sources(sources, cache_keys)),
       agg_keyval_map(merge_keyval_metadata()),
       num_rows(calc_num_rows()),
       num_row_groups(calc_num_row_groups()),
@@ -290,6 +1179,8 @@ class aggregate_metadata {
 
   auto const &get_schema(int idx) const { return per_file_metadata[0].schema[idx]; }
 
+  auto const &get_schema() const { return per_file_metadata[0].schema; }
+
   auto const &get_key_value_metadata() const { return agg_keyval_map; }
 
   /**
@@ -415,9 +1306,243 @@ class aggregate_metadata {
     return selection;
   }
 
+  /**
+   * @brief Removes the row groups whose statistics show that no row can satisfy the filter
+   *
+   * Equality comparisons are also tested against the bloom filters of the column chunks, which
+   * are read from the sources on demand.
+   *
+   * @param sources Dataset sources
+   * @param filter Filter expression evaluated against the column chunk statistics
+   * @param row_groups Lists of row groups to filter, one per source; empty for all row groups
+   *
+   * @return Lists of the remaining row groups, one per source
+   */
+  std::vector<std::vector<size_type>> filter_row_groups(
+    std::vector<std::unique_ptr<datasource>> const &sources,
+    stats_filter const &filter,
+    std::vector<std::vector<size_type>> const &row_groups) const
+  {
+    std::vector<std::vector<size_type>> selection(per_file_metadata.size());
+    for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+      auto const &pfm = per_file_metadata[src_idx];
+      std::vector<size_type> candidates;
+      if (row_groups.empty()) {
+        candidates.resize(pfm.row_groups.size());
+        std::iota(candidates.begin(), candidates.end(), 0);
+      } else {
+        CUDF_EXPECTS(row_groups.size() == per_file_metadata.size(),
+                     "Must specify row groups for each source");
+        candidates = row_groups[src_idx];
+      }
+
+      for (auto const rg_idx : candidates) {
+        CUDF_EXPECTS(rg_idx >= 0 && rg_idx < static_cast<size_type>(pfm.row_groups.size()),
+                     "Invalid rowgroup index");
+        auto const &row_group = pfm.row_groups[rg_idx];
+        auto lookup           = [&](std::string const &name) {
+          auto const it = std::find_if(
+            row_group.columns.cbegin(), row_group.columns.cend(), [&](auto const &chunk) {
+              return name_from_path(chunk.meta_data.path_in_schema) == name;
+            });
+          CUDF_EXPECTS(it != row_group.columns.cend(), "Filter column not found: " + name);
+          auto const &col_schema = pfm.schema[it->schema_idx];
+          auto range             = to_value_range(it->meta_data, col_schema);
+          if (it->meta_data.bloom_filter_offset > 0) {
+            range.may_contain = [source = sources[src_idx].get(), it, schema = &col_schema](
+                                  stats_filter const &eq) {
+              return chunk_may_contain(*source, it->meta_data, *schema, eq);
+            };
+          }
+          return range;
+        };
+        if (stats_filter_may_match(filter, lookup)) { selection[src_idx].push_back(rg_idx); }
+      }
+    }
+    return selection;
+  }
+
+  /**
+   * @brief Reads the page indexes of some column chunks of the selected row groups
+   *
+   * Page indexes are usually stored back to back before the footer, so the indexes close to each
+   * other are fetched with a single read. Indexes that cannot be parsed are left empty.
+   *
+   * @param sources Dataset sources
+   * @param selection Selected row groups
+   * @param needed Whether the page indexes of each selected row group are needed
+   * @param columns Indexes of the column chunks whose page indexes to read
+   *
+   * @return Page indexes, indexed by [position in selection][position in columns]
+   */
+  std::vector<std::vector<chunk_page_index>> read_page_indexes(
+    std::vector<std::unique_ptr<datasource>> const &sources,
+    std::vector<row_group_info> const &selection,
+    std::vector<bool> const &needed,
+    std::vector<int> const &columns) const
+  {
+    constexpr size_t max_index_read_gap = 64 * 1024;
+
+    struct index_read {
+      size_t offset;
+      size_t size;
+      size_t rg;
+      size_t col;
+      bool is_column_index;
+    };
+    std::vector<std::vector<chunk_page_index>> indexes(
+      selection.size(), std::vector<chunk_page_index>(columns.size()));
+    std::vector<std::vector<index_read>> reads(sources.size());
+    for (size_t r = 0; r < selection.size(); ++r) {
+      if (!needed[r]) { continue; }
+      auto const &row_group = get_row_group(selection[r].index, selection[r].source_index);
+      auto &src_reads       = reads[selection[r].source_index];
+      for (size_t c = 0; c < columns.size(); ++c) {
+        auto const &chunk = row_group.columns[columns[c]];
+        if (chunk.column_index_length > 0) {
+          src_reads.push_back({static_cast<size_t>(chunk.column_index_offset),
+                               static_cast<size_t>(chunk.column_index_length),
+                               r,
+                               c,
+                               true});
+        }
+        if (chunk.offset_index_length > 0) {
+          src_reads.push_back({static_cast<size_t>(chunk.offset_index_offset),
+                               static_cast<size_t>(chunk.offset_index_length),
+                               r,
+                               c,
+                               false});
+        }
+      }
+    }
+
+    for (size_t src_idx = 0; src_idx < sources.size(); ++src_idx) {
+      auto &src_reads = reads[src_idx];
+      std::sort(src_reads.begin(), src_reads.end(), [](auto const &a, auto const &b) {
+        return a.offset < b.offset;
+      });
+      for (size_t first = 0; first < src_reads.size();) {
+        auto const read_offset = src_reads[first].offset;
+        auto read_end          = read_offset + src_reads[first].size;
+        auto last              = first + 1;
+        while (last < src_reads.size() && src_reads[last].offset <= read_end + max_index_read_gap) {
+          read_end = std::max(read_end, src_reads[last].offset + src_reads[last].size);
+          ++last;
+        }
+        auto const buffer = sources[src_idx]->host_read(read_offset, read_end - read_offset);
+        for (auto i = first; i < last; ++i) {
+          auto const &read = src_reads[i];
+          auto &index      = indexes[read.rg][read.col];
+          if (read.offset + read.size > read_offset + buffer->size()) { continue; }
+          CompactProtocolReader cp(buffer->data() + (read.offset - read_offset), read.size);
+          if (read.is_column_index) {
+            if (!cp.read(&index.column_index)) { index.column_index = ColumnIndex{}; }
+          } else {
+            if (!cp.read(&index.offset_index)) { index.offset_index = OffsetIndex{}; }
+          }
+        }
+        first = last;
+      }
+    }
+
+    // Drop the offset indexes that do not describe the row group pages
+    for (size_t r = 0; r < selection.size(); ++r) {
+      if (!needed[r]) { continue; }
+      auto const &row_group = get_row_group(selection[r].index, selection[r].source_index);
+      for (auto &index : indexes[r]) {
+        if (index.has_offset_index() &&
+            !is_valid_offset_index(index.offset_index, row_group.num_rows)) {
+          index = chunk_page_index{};
+        }
+      }
+    }
+    return indexes;
+  }
+
+  /**
+   * @brief Returns the row ranges of a row group whose page statistics show that they may
+   * satisfy the filter
+   *
+   * The row group is split at the page boundaries of the filter columns and the filter is
+   * evaluated against the statistics of the pages of each split. The matching ranges are then
+   * widened to the page boundaries of the columns to read, so that each of their chunks covers
+   * the same rows.
+   *
+   * @param filter Filter expression evaluated against the page statistics
+   * @param row_group Row group to filter
+   * @param columns Indexes of the column chunks whose page indexes were read; the columns to
+   * read come first, followed by the other filter columns
+   * @param indexes Page indexes of the chunks of `columns`
+   * @param num_read_columns Number of columns to read
+   *
+   * @return Sorted, non-overlapping [begin, end) row ranges within the row group
+   */
+  std::vector<std::pair<int64_t, int64_t>> filter_row_ranges(
+    stats_filter const &filter,
+    RowGroup const &row_group,
+    std::vector<int> const &columns,
+    std::vector<chunk_page_index> const &indexes,
+    size_t num_read_columns) const
+  {
+    auto const &schema = per_file_metadata[0].schema;
+    auto const num_rows = row_group.num_rows;
+    if (num_rows == 0) { return {}; }
+
+    std::vector<std::string> filter_columns;
+    collect_filter_columns(filter, filter_columns);
+
+    // Split the row group at the page boundaries of the filter columns
+    std::vector<std::vector<int64_t>> bounds(columns.size());
+    std::vector<int64_t> splits{0, num_rows};
+    for (size_t c = 0; c < columns.size(); ++c) {
+      auto const &chunk = row_group.columns[columns[c]];
+      auto const name   = name_from_path(chunk.meta_data.path_in_schema);
+      // Nested chunks are always read in full
+      bool const is_flat = schema[chunk.schema_idx].max_repetition_level == 0 &&
+                           !is_struct_field(schema, chunk.schema_idx);
+      bounds[c] = page_row_bounds(is_flat ? indexes[c].offset_index : OffsetIndex{}, num_rows);
+      if (indexes[c].has_column_index() &&
+          std::find(filter_columns.begin(), filter_columns.end(), name) != filter_columns.end()) {
+        splits.insert(splits.end(), bounds[c].begin(), bounds[c].end());
+      }
+    }
+    std::sort(splits.begin(), splits.end());
+    splits.erase(std::unique(splits.begin(), splits.end()), splits.end());
+
+    std::vector<std::pair<int64_t, int64_t>> ranges;
+    for (size_t s = 0; s + 1 < splits.size(); ++s) {
+      auto lookup = [&](std::string const &name) {
+        for (size_t c = 0; c < columns.size(); ++c) {
+          auto const &chunk = row_group.columns[columns[c]];
+          if (name_from_path(chunk.meta_data.path_in_schema) != name) { continue; }
+          if (indexes[c].has_column_index()) {
+            return to_value_range(indexes[c].column_index,
+                                  page_of_row(bounds[c], splits[s]),
+                                  schema[chunk.schema_idx]);
+          }
+          return to_value_range(chunk.meta_data, schema[chunk.schema_idx]);
+        }
+        CUDF_FAIL("Filter column not found: " + name);
+      };
+      if (stats_filter_may_match(filter, lookup)) {
+        if (!ranges.empty() && ranges.back().second == splits[s]) {
+          ranges.back().second = splits[s + 1];
+        } else {
+          ranges.emplace_back(splits[s], splits[s + 1]);
+        }
+      }
+    }
+
+    bounds.resize(num_read_columns);
+    align_row_ranges(ranges, bounds);
+    return ranges;
+  }
+
   /**
    * @brief Filters and reduces down to a selection of columns
    *
+   * The name of a group selects all of its fields, which are read as a STRUCT column.
+   *
    * @param use_names List of column names to select
    * @param include_index Whether to always include the PANDAS index column(s)
    *
@@ -433,10 +1558,15 @@ class aggregate_metadata {
       // Load subset of columns; include PANDAS index unless excluded
       if (include_index) { add_pandas_index_names(use_names); }
       for (const auto &use_name : use_names) {
+        auto const it = std::find(column_names.begin(), column_names.end(), use_name);
+        if (it != column_names.end()) {
+          selection.emplace_back(it - column_names.begin(), use_name);
+          continue;
+        }
+        auto const prefix = use_name + ".";
         for (size_t i = 0; i < column_names.size(); ++i) {
-          if (column_names[i] == use_name) {
+          if (column_names[i].compare(0, prefix.size(), prefix) == 0) {
             selection.emplace_back(i, column_names[i]);
-            break;
           }
         }
       }
@@ -451,41 +1581,82 @@ void reader::impl::read_column_chunks(
   hostdevice_vector<gpu::ColumnChunkDesc> &chunks,  // TODO const?
   size_t begin_chunk,
   size_t end_chunk,
-  const std::vector<size_t> &column_chunk_offsets,
+  const std::vector<std::vector<std::pair<size_t, size_t>>> &chunk_byte_ranges,
   std::vector<size_type> const &chunk_source_map,
   cudaStream_t stream)
 {
-  // Transfer chunk data, coalescing adjacent chunks
+  // Coalesce adjacent chunks into as few reads as possible
+  struct chunk_read {
+    size_t begin_chunk;
+    size_t end_chunk;
+    size_t size;
+    std::vector<std::pair<size_t, size_t>> ranges;
+  };
+  auto const append_range = [](std::vector<std::pair<size_t, size_t>> &ranges,
+                               std::pair<size_t, size_t> const &range) {
+    if (!ranges.empty() && ranges.back().first + ranges.back().second == range.first) {
+      ranges.back().second += range.second;
+    } else if (range.second != 0) {
+      ranges.push_back(range);
+    }
+  };
+  std::vector<chunk_read> reads;
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
-    const size_t io_offset   = column_chunk_offsets[chunk];
-    size_t io_size           = chunks[chunk].compressed_size;
-    size_t next_chunk        = chunk + 1;
+    chunk_read read{chunk, chunk + 1, chunks[chunk].compressed_size, {}};
+    for (auto const &range : chunk_byte_ranges[chunk]) { append_range(read.ranges, range); }
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
-    while (next_chunk < end_chunk) {
-      const size_t next_offset = column_chunk_offsets[next_chunk];
+    while (read.end_chunk < end_chunk) {
+      auto const next_chunk   = read.end_chunk;
+      auto const &next_ranges = chunk_byte_ranges[next_chunk];
       const bool is_next_compressed =
         (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
+      if (read.ranges.empty() || next_ranges.empty() ||
+          next_ranges.front().first != read.ranges.back().first + read.ranges.back().second ||
+          is_next_compressed != is_compressed ||
+          chunk_source_map[next_chunk] != chunk_source_map[chunk]) {
         // Can't merge if not contiguous or mixing compressed and uncompressed
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
         break;
       }
-      io_size += chunks[next_chunk].compressed_size;
-      next_chunk++;
-    }
-    if (io_size != 0) {
-      auto buffer         = _sources[chunk_source_map[chunk]]->host_read(io_offset, io_size);
-      page_data[chunk]    = rmm::device_buffer(buffer->data(), buffer->size(), stream);
-      uint8_t *d_compdata = reinterpret_cast<uint8_t *>(page_data[chunk].data());
-      do {
-        chunks[chunk].compressed_data = d_compdata;
-        d_compdata += chunks[chunk].compressed_size;
-      } while (++chunk != next_chunk);
-    } else {
-      chunk = next_chunk;
+      for (auto const &range : next_ranges) { append_range(read.ranges, range); }
+      read.size += chunks[next_chunk].compressed_size;
+      read.end_chunk++;
     }
+    chunk = read.end_chunk;
+    if (read.size != 0) { reads.push_back(std::move(read)); }
+  }
+
+  // Queue all host reads of each source up front so that they overlap with the device copies
+  std::map<size_type, std::vector<std::pair<size_t, size_t>>> source_ranges;
+  for (auto const &read : reads) {
+    auto &ranges = source_ranges[chunk_source_map[read.begin_chunk]];
+    ranges.insert(ranges.end(), read.ranges.begin(), read.ranges.end());
   }
+  std::map<size_type, std::unique_ptr<prefetching_source>> prefetchers;
+  for (auto const &ranges : source_ranges) {
+    auto prefetcher = std::make_unique<prefetching_source>(_sources[ranges.first].get());
+    prefetcher->prefetch(ranges.second);
+    prefetchers.emplace(ranges.first, std::move(prefetcher));
+  }
+
+  // The byte ranges of a read are copied back to back, so that the pages of each chunk are
+  // contiguous in device memory
+  for (auto const &read : reads) {
+    page_data[read.begin_chunk] = rmm::device_buffer(read.size, stream, get_scratch_resource());
+    uint8_t *d_compdata         = static_cast<uint8_t *>(page_data[read.begin_chunk].data());
+    auto &prefetcher            = prefetchers[chunk_source_map[read.begin_chunk]];
+    auto d_range                = d_compdata;
+    for (auto const &range : read.ranges) {
+      prefetcher->device_read_async(range.first, range.second, d_range, stream);
+      d_range += range.second;
+    }
+    for (size_t chunk = read.begin_chunk; chunk < read.end_chunk; ++chunk) {
+      chunks[chunk].compressed_data = d_compdata;
+      d_compdata += chunks[chunk].compressed_size;
+    }
+  }
+  for (auto &prefetcher : prefetchers) { prefetcher.second->synchronize(); }
 }
 
 size_t reader::impl::count_page_headers(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
@@ -540,15 +1711,13 @@ rmm::device_buffer reader::impl::decompress_page_data(
     }
   };
 
-  // Brotli scratch memory for decompressing
-  rmm::device_vector<uint8_t> debrotli_scratch;
-
   // Count the exact number of compressed pages
   size_t num_comp_pages    = 0;
   size_t total_decomp_size = 0;
-  std::array<std::pair<parquet::Compression, size_t>, 3> codecs{std::make_pair(parquet::GZIP, 0),
+  std::array<std::pair<parquet::Compression, size_t>, 4> codecs{std::make_pair(parquet::GZIP, 0),
                                                                 std::make_pair(parquet::SNAPPY, 0),
-                                                                std::make_pair(parquet::BROTLI, 0)};
+                                                                std::make_pair(parquet::BROTLI, 0),
+                                                                std::make_pair(parquet::ZSTD, 0)};
 
   for (auto &codec : codecs) {
     for_each_codec_page(codec.first, [&](size_t page) {
@@ -556,80 +1725,33 @@ rmm::device_buffer reader::impl::decompress_page_data(
       codec.second++;
       num_comp_pages++;
     });
-    if (codec.first == parquet::BROTLI && codec.second > 0) {
-      debrotli_scratch.resize(get_gpu_debrotli_scratch_size(codec.second));
-    }
   }
 
-  // Dispatch batches of pages to decompress for each codec
-  rmm::device_buffer decomp_pages(total_decomp_size, stream);
-  hostdevice_vector<gpu_inflate_input_s> inflate_in(0, num_comp_pages, stream);
-  hostdevice_vector<gpu_inflate_status_s> inflate_out(0, num_comp_pages, stream);
+  // Dispatch the pages to decompress for each codec
+  rmm::device_buffer decomp_pages(total_decomp_size, stream, get_scratch_resource());
+  std::vector<gpu_inflate_input_s> inflate_in;
+  inflate_in.reserve(num_comp_pages);
 
   size_t decomp_offset = 0;
-  int32_t argc         = 0;
   for (const auto &codec : codecs) {
     if (codec.second > 0) {
-      int32_t start_pos = argc;
-
+      inflate_in.clear();
       for_each_codec_page(codec.first, [&](size_t page) {
-        auto dst_base              = static_cast<uint8_t *>(decomp_pages.data());
-        inflate_in[argc].srcDevice = pages[page].page_data;
-        inflate_in[argc].srcSize   = pages[page].compressed_page_size;
-        inflate_in[argc].dstDevice = dst_base + decomp_offset;
-        inflate_in[argc].dstSize   = pages[page].uncompressed_page_size;
-
-        inflate_out[argc].bytes_written = 0;
-        inflate_out[argc].status        = static_cast<uint32_t>(-1000);
-        inflate_out[argc].reserved      = 0;
-
-        pages[page].page_data = (uint8_t *)inflate_in[argc].dstDevice;
-        decomp_offset += inflate_in[argc].dstSize;
-        argc++;
+        auto dst_base = static_cast<uint8_t *>(decomp_pages.data());
+        gpu_inflate_input_s input;
+        input.srcDevice = pages[page].page_data;
+        input.srcSize   = pages[page].compressed_page_size;
+        input.dstDevice = dst_base + decomp_offset;
+        input.dstSize   = pages[page].uncompressed_page_size;
+        inflate_in.push_back(input);
+
+        pages[page].page_data = static_cast<uint8_t *>(input.dstDevice);
+        decomp_offset += input.dstSize;
       });
-
-      CUDA_TRY(cudaMemcpyAsync(inflate_in.device_ptr(start_pos),
-                               inflate_in.host_ptr(start_pos),
-                               sizeof(decltype(inflate_in)::value_type) * (argc - start_pos),
-                               cudaMemcpyHostToDevice,
-                               stream));
-      CUDA_TRY(cudaMemcpyAsync(inflate_out.device_ptr(start_pos),
-                               inflate_out.host_ptr(start_pos),
-                               sizeof(decltype(inflate_out)::value_type) * (argc - start_pos),
-                               cudaMemcpyHostToDevice,
-                               stream));
-      switch (codec.first) {
-        case parquet::GZIP:
-          CUDA_TRY(gpuinflate(inflate_in.device_ptr(start_pos),
-                              inflate_out.device_ptr(start_pos),
-                              argc - start_pos,
-                              1,
-                              stream))
-          break;
-        case parquet::SNAPPY:
-          CUDA_TRY(gpu_unsnap(inflate_in.device_ptr(start_pos),
-                              inflate_out.device_ptr(start_pos),
-                              argc - start_pos,
-                              stream));
-          break;
-        case parquet::BROTLI:
-          CUDA_TRY(gpu_debrotli(inflate_in.device_ptr(start_pos),
-                                inflate_out.device_ptr(start_pos),
-                                debrotli_scratch.data().get(),
-                                debrotli_scratch.size(),
-                                argc - start_pos,
-                                stream));
-          break;
-        default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
-      }
-      CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
-                               inflate_out.device_ptr(start_pos),
-                               sizeof(decltype(inflate_out)::value_type) * (argc - start_pos),
-                               cudaMemcpyDeviceToHost,
-                               stream));
+      _decompressor.decompress(
+        to_gpu_codec(codec.first), inflate_in.data(), nullptr, inflate_in.size(), stream);
     }
   }
-  CUDA_TRY(cudaStreamSynchronize(stream));
 
   // Update the page information in device memory with the updated value of
   // page_data; it now points to the uncompressed data buffer
@@ -639,13 +1761,63 @@ rmm::device_buffer reader::impl::decompress_page_data(
   return decomp_pages;
 }
 
-void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
-                                    hostdevice_vector<gpu::PageInfo> &pages,
-                                    size_t min_row,
-                                    size_t total_rows,
-                                    const std::vector<int> &chunk_col_map,
-                                    std::vector<column_buffer> &out_buffers,
-                                    cudaStream_t stream)
+rmm::device_buffer reader::impl::decode_delta_pages(
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  hostdevice_vector<gpu::PageInfo> &pages,
+  cudaStream_t stream)
+{
+  // The sizes of the converted pages are turned into offsets in place
+  hostdevice_vector<int64_t> plain_offsets(pages.size() + 1, stream);
+  CUDA_TRY(gpu::ComputeDeltaPageSizes(pages.device_ptr(),
+                                      pages.size(),
+                                      chunks.device_ptr(),
+                                      chunks.size(),
+                                      plain_offsets.device_ptr(),
+                                      stream));
+  CUDA_TRY(cudaMemcpyAsync(plain_offsets.host_ptr(),
+                           plain_offsets.device_ptr(),
+                           pages.size() * sizeof(int64_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  int64_t total_size = 0;
+  for (size_t i = 0; i < pages.size(); i++) {
+    auto const size = plain_offsets[i];
+    CUDF_EXPECTS(size >= 0, "Invalid delta-encoded page data");
+    plain_offsets[i] = total_size;
+    total_size += size;
+  }
+  plain_offsets[pages.size()] = total_size;
+
+  rmm::device_buffer plain_pages(total_size, stream, get_scratch_resource());
+  CUDA_TRY(cudaMemcpyAsync(plain_offsets.device_ptr(),
+                           plain_offsets.host_ptr(),
+                           plain_offsets.memory_size(),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  CUDA_TRY(gpu::DecodeDeltaPages(pages.device_ptr(),
+                                 pages.size(),
+                                 chunks.device_ptr(),
+                                 chunks.size(),
+                                 static_cast<uint8_t *>(plain_pages.data()),
+                                 plain_offsets.device_ptr(),
+                                 stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    pages.host_ptr(), pages.device_ptr(), pages.memory_size(), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  return plain_pages;
+}
+
+rmm::device_vector<gpu::nvstrdesc_s> reader::impl::decode_page_data(
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  hostdevice_vector<gpu::PageInfo> &pages,
+  size_t min_row,
+  size_t total_rows,
+  const std::vector<int> &chunk_col_map,
+  std::vector<column_buffer> &out_buffers,
+  cudaStream_t stream)
 {
   auto is_dict_chunk = [](const gpu::ColumnChunkDesc &chunk) {
     return (chunk.data_type & 0x7) == BYTE_ARRAY && chunk.num_dict_pages > 0;
@@ -661,14 +1833,20 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
 
   // Build index for string dictionaries since they can't be indexed
   // directly due to variable-sized elements
-  rmm::device_vector<gpu::nvstrdesc_s> str_dict_index;
-  if (total_str_dict_indexes > 0) { str_dict_index.resize(total_str_dict_indexes); }
+  auto str_dict_index =
+    cudf::detail::make_scratch_vector<gpu::nvstrdesc_s>(total_str_dict_indexes, {}, stream);
 
   // Update chunks with pointers to column data
+  std::vector<int32_t> column_dict_entries(out_buffers.size(), 0);
   for (size_t c = 0, page_count = 0, str_ofs = 0; c < chunks.size(); c++) {
     if (is_dict_chunk(chunks[c])) {
       chunks[c].str_dict_index = str_dict_index.data().get() + str_ofs;
       str_ofs += pages[page_count].num_values;
+      // Dictionary indices are output relative to all the dictionaries of the column
+      if (chunks[c].str_dict_base >= 0) {
+        chunks[c].str_dict_base = column_dict_entries[chunk_col_map[c]];
+        column_dict_entries[chunk_col_map[c]] += pages[page_count].num_values;
+      }
     }
     chunks[c].column_data_base = out_buffers[chunk_col_map[c]].data();
     chunks[c].valid_map_base   = out_buffers[chunk_col_map[c]].null_mask();
@@ -680,6 +1858,53 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
   if (total_str_dict_indexes > 0) {
     CUDA_TRY(gpu::BuildStringDictionaryIndex(chunks.device_ptr(), chunks.size(), stream));
   }
+
+  // Strings are decoded straight into their offsets and characters: the sizes of the strings are
+  // decoded first and scanned into the offsets, then the characters are written at the offsets
+  if (std::any_of(out_buffers.begin(), out_buffers.end(), [](auto const &buffer) {
+        return buffer._string_offsets;
+      })) {
+    CUDA_TRY(gpu::ComputePageStringSizes(pages.device_ptr(),
+                                         pages.size(),
+                                         chunks.device_ptr(),
+                                         chunks.size(),
+                                         total_rows,
+                                         min_row,
+                                         stream));
+    std::vector<int32_t> num_chars(out_buffers.size(), 0);
+    for (size_t i = 0; i < out_buffers.size(); ++i) {
+      if (!out_buffers[i]._string_offsets) { continue; }
+      auto const d_offsets   = static_cast<int32_t *>(out_buffers[i]._data.data());
+      auto const num_offsets = out_buffers[i]._data.size() / sizeof(int32_t);
+      thrust::exclusive_scan(cudf::detail::scratch_policy(stream)->on(stream),
+                             d_offsets,
+                             d_offsets + num_offsets,
+                             d_offsets);
+      CUDA_TRY(cudaMemcpyAsync(&num_chars[i],
+                               d_offsets + num_offsets - 1,
+                               sizeof(int32_t),
+                               cudaMemcpyDeviceToHost,
+                               stream));
+    }
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    for (size_t i = 0; i < out_buffers.size(); ++i) {
+      if (out_buffers[i]._string_offsets) {
+        out_buffers[i]._chars = rmm::device_buffer(num_chars[i], stream, _mr);
+      }
+    }
+    for (size_t c = 0; c < chunks.size(); c++) {
+      auto &buffer = out_buffers[chunk_col_map[c]];
+      if (buffer._string_offsets) {
+        chunks[c].str_chars = static_cast<char *>(buffer._chars.data());
+      }
+    }
+    CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(),
+                             chunks.host_ptr(),
+                             chunks.memory_size(),
+                             cudaMemcpyHostToDevice,
+                             stream));
+  }
+
   CUDA_TRY(gpu::DecodePageData(pages.device_ptr(),
                                pages.size(),
                                chunks.device_ptr(),
@@ -699,15 +1924,28 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
       }
     }
   }
+
+  return str_dict_index;
 }
 
 reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
                    reader_options const &options,
-                   rmm::mr::device_memory_resource *mr)
+                   rmm::mr::device_memory_resource *mr,
+                   std::vector<std::string> const &cache_keys)
   : _sources(std::move(sources)), _mr(mr)
 {
+  // Count the reads of the sources, including the metadata, if the metrics are requested
+  _collect_metrics = options.collect_metrics;
+  if (_collect_metrics) {
+    for (auto &source : _sources) {
+      auto metered = std::make_unique<metered_source>(std::move(source));
+      _metered_sources.push_back(metered.get());
+      source = std::move(metered);
+    }
+  }
+
   // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_metadata>(_sources);
+  _metadata = std::make_unique<aggregate_metadata>(_sources, cache_keys);
 
   // Select only columns required by the options
   _selected_columns = _metadata->select_columns(options.columns, options.use_pandas_metadata);
@@ -715,42 +1953,354 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
   // Override output timestamp resolution if requested
   if (options.timestamp_type.id() != type_id::EMPTY) { _timestamp_type = options.timestamp_type; }
 
-  // Strings may be returned as either string or categorical columns
+  // Strings may be returned as either string, categorical or dictionary columns
   _strings_to_categorical = options.strings_to_categorical;
+  _strings_to_dictionary  = options.strings_to_dictionary;
+  CUDF_EXPECTS(!_strings_to_categorical || !_strings_to_dictionary,
+               "Strings can be returned as either categorical or dictionary columns, not both");
+
+  // Integer decimals may be returned as fixed-point columns instead of float64
+  _decimals_as_float = options.decimals_as_float;
+
+  // Row groups excluded by their statistics are skipped before reading any data
+  _filter = options.filter;
+
+  // Only the pages holding rows selected by the mask are decoded
+  if (has_row_mask(options.row_mask)) {
+    CUDF_EXPECTS(_filter.empty(), "A row mask cannot be combined with a statistics filter");
+    _row_mask = options.row_mask;
+  }
 }
 
-table_with_metadata reader::impl::read(size_type skip_rows,
-                                       size_type num_rows,
-                                       std::vector<std::vector<size_type>> const &row_group_list,
-                                       cudaStream_t stream)
+std::vector<data_type> reader::impl::get_column_types() const
 {
-  // Select only row groups required
-  const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
-
-  // Get a list of column data types
   std::vector<data_type> column_types;
   if (_metadata->get_num_row_groups() != 0) {
     for (const auto &col : _selected_columns) {
-      auto const &col_schema =
-        _metadata->get_schema(_metadata->get_row_group(0, 0).columns[col.first].schema_idx);
+      auto const col_schema_idx = _metadata->get_row_group(0, 0).columns[col.first].schema_idx;
+      auto const &col_schema    = _metadata->get_schema(col_schema_idx);
+      // The strings of list columns and struct fields are always returned as strings
+      bool const is_nested = col_schema.max_repetition_level > 0 ||
+                             is_struct_field(_metadata->get_schema(), col_schema_idx);
       auto const col_type = to_type_id(col_schema.type,
                                        col_schema.converted_type,
-                                       _strings_to_categorical,
+                                       _strings_to_categorical && !is_nested,
+                                       _strings_to_dictionary && !is_nested,
                                        _timestamp_type.id(),
-                                       col_schema.decimal_scale);
+                                       col_schema.decimal_scale,
+                                       _decimals_as_float);
       CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-      column_types.emplace_back(col_type);
+      if (col_type == type_id::DECIMAL32 || col_type == type_id::DECIMAL64) {
+        // The stored integers have `decimal_scale` fractional digits
+        column_types.emplace_back(col_type, -col_schema.decimal_scale);
+      } else {
+        column_types.emplace_back(col_type);
+      }
+    }
+  }
+  return column_types;
+}
+
+namespace {
+/**
+ * @brief Estimates the device memory needed to read the selected columns of a row group
+ *
+ * The output is the decoded columns, with the uncompressed size of the pages standing for the
+ * characters of the strings. The scratch memory is the compressed pages, the decompressed pages
+ * of the compressed chunks and the string descriptors decoded from the pages.
+ */
+memory_estimate estimate_row_group_memory(
+  aggregate_metadata const &metadata,
+  aggregate_metadata::row_group_info const &rg,
+  std::vector<std::pair<int, std::string>> const &selected_columns,
+  std::vector<data_type> const &column_types)
+{
+  auto const &row_group = metadata.get_row_group(rg.index, rg.source_index);
+  auto const num_rows   = static_cast<size_t>(row_group.num_rows);
+  memory_estimate estimate;
+  for (size_t i = 0; i < selected_columns.size(); ++i) {
+    auto const &chunk      = row_group.columns[selected_columns[i].first];
+    auto const &col_meta   = chunk.meta_data;
+    auto const &col_schema = metadata.get_schema(chunk.schema_idx);
+    estimate.scratch_bytes += col_meta.total_compressed_size;
+    if (col_meta.codec != Compression::UNCOMPRESSED) {
+      estimate.scratch_bytes += col_meta.total_uncompressed_size;
+    }
+    if (column_types[i].id() == type_id::STRING) {
+      estimate.output_bytes +=
+        col_meta.total_uncompressed_size + (num_rows + 1) * sizeof(size_type);
+      estimate.scratch_bytes += num_rows * sizeof(std::pair<const char *, size_t>);
+    } else if (column_types[i].id() == type_id::DICTIONARY32) {
+      estimate.output_bytes += num_rows * sizeof(size_type);
+    } else {
+      estimate.output_bytes += num_rows * size_of(column_types[i]);
+    }
+    if (col_schema.max_definition_level != 0) {
+      estimate.output_bytes += bitmask_allocation_size_bytes(row_group.num_rows);
+    }
+  }
+  return estimate;
+}
+
+}  // namespace
+
+memory_estimate reader::impl::estimate_memory(
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<std::vector<size_type>> const &row_group_list)
+{
+  auto const row_groups =
+    _filter.empty() ? row_group_list
+                    : _metadata->filter_row_groups(_sources, _filter, row_group_list);
+  auto const selection    = _metadata->select_row_groups(row_groups, skip_rows, num_rows);
+  auto const column_types = get_column_types();
+  memory_estimate estimate;
+  for (auto const &rg : selection) {
+    auto const rg_estimate =
+      estimate_row_group_memory(*_metadata, rg, _selected_columns, column_types);
+    estimate.output_bytes += rg_estimate.output_bytes;
+    estimate.scratch_bytes += rg_estimate.scratch_bytes;
+  }
+  return estimate;
+}
+
+void reader::impl::begin_chunked_read(size_t chunk_read_limit,
+                                      std::vector<std::vector<size_type>> const &row_group_list)
+{
+  // Apply the filter once up front; the batches only contain row groups that may match
+  auto const row_groups =
+    _filter.empty() ? row_group_list
+                    : _metadata->filter_row_groups(_sources, _filter, row_group_list);
+  size_type row_start     = 0;
+  size_type row_count     = -1;
+  auto const selection    = _metadata->select_row_groups(row_groups, row_start, row_count);
+  auto const column_types = get_column_types();
+  auto const num_sources  = _sources.size();
+
+  // Device memory needed to read a row group, outputs and temporaries included
+  auto const row_group_read_size = [&](aggregate_metadata::row_group_info const &rg) {
+    return estimate_row_group_memory(*_metadata, rg, _selected_columns, column_types).peak_bytes();
+  };
+
+  _chunk_row_groups.clear();
+  _next_chunk = 0;
+  std::vector<std::vector<size_type>> current(num_sources);
+  size_t current_size = 0;
+  bool current_empty  = true;
+  for (auto const &rg : selection) {
+    auto const rg_size = row_group_read_size(rg);
+    if (chunk_read_limit != 0 && !current_empty && current_size + rg_size > chunk_read_limit) {
+      _chunk_row_groups.push_back(std::move(current));
+      current.assign(num_sources, {});
+      current_size = 0;
+    }
+    current[rg.source_index].push_back(rg.index);
+    current_size += rg_size;
+    current_empty = false;
+  }
+  // Always return at least one (possibly empty) table so that the schema can be retrieved
+  if (!current_empty || _chunk_row_groups.empty()) {
+    _chunk_row_groups.push_back(std::move(current));
+  }
+}
+
+table_with_metadata reader::impl::read_next_chunk(cudaStream_t stream)
+{
+  CUDF_EXPECTS(has_next_chunk(), "No more row groups to read");
+  return read(0, -1, _chunk_row_groups[_next_chunk++], stream);
+}
+
+table_with_metadata reader::impl::read(size_type skip_rows,
+                                       size_type num_rows,
+                                       std::vector<std::vector<size_type>> const &row_group_list,
+                                       cudaStream_t stream)
+{
+  auto metrics = _collect_metrics ? std::make_unique<io_metrics>() : nullptr;
+
+  // Skip row groups that cannot contain rows satisfying the filter
+  std::vector<std::vector<size_type>> filtered_row_groups;
+  if (!_filter.empty()) {
+    CUDF_EXPECTS(skip_rows <= 0 && num_rows < 0,
+                 "Statistics filter cannot be combined with a row range");
+    filtered_row_groups = _metadata->filter_row_groups(_sources, _filter, row_group_list);
+  }
+
+  // Select only row groups required
+  const auto selected_row_groups = _metadata->select_row_groups(
+    _filter.empty() ? row_group_list : filtered_row_groups, skip_rows, num_rows);
+  if (metrics) {
+    auto const count_row_groups = [](std::vector<std::vector<size_type>> const &list) {
+      return std::accumulate(list.begin(), list.end(), size_t{0}, [](size_t sum, auto const &l) {
+        return sum + l.size();
+      });
+    };
+    metrics->row_groups_read = selected_row_groups.size();
+    if (!_filter.empty()) {
+      auto const num_candidates = row_group_list.empty() ? _metadata->get_num_row_groups()
+                                                         : count_row_groups(row_group_list);
+      metrics->row_groups_skipped = num_candidates - count_row_groups(filtered_row_groups);
+    }
+  }
+
+  // Get a list of column data types
+  auto const column_types = get_column_types();
+
+  // List columns are decoded in full, with one value per level entry, and their rows are then
+  // assembled from the levels. The fields of structs are also decoded in full, and the structs
+  // are assembled from their definition levels
+  std::vector<bool> is_list_column(column_types.size(), false);
+  std::vector<bool> is_field_column(column_types.size(), false);
+  std::vector<bool> is_nested_column(column_types.size(), false);
+  std::vector<list_def_levels> list_levels(column_types.size());
+  std::vector<int> leaf_schema_idx(column_types.size());
+  for (size_t i = 0; i < column_types.size(); ++i) {
+    auto const schema_idx =
+      _metadata->get_row_group(0, 0).columns[_selected_columns[i].first].schema_idx;
+    leaf_schema_idx[i]  = schema_idx;
+    is_list_column[i]   = (_metadata->get_schema(schema_idx).max_repetition_level > 0);
+    is_field_column[i]  = is_struct_field(_metadata->get_schema(), schema_idx);
+    is_nested_column[i] = is_list_column[i] || is_field_column[i];
+    if (is_list_column[i]) {
+      list_levels[i] = get_list_def_levels(_metadata->get_schema(), schema_idx);
+    }
+  }
+  // Definition levels of the output rows of the struct fields
+  std::vector<rmm::device_buffer> field_levels(column_types.size());
+  size_type field_levels_offset = 0;
+
+  // Rows to read from each selected row group, in row group coordinates
+  struct row_slice {
+    size_t rg;         // Position in the selected row groups
+    int64_t begin;     // First row group row to read
+    int64_t end;       // Row group row after the last row to read
+    int64_t base_row;  // Output row of the first row group row
+  };
+  std::vector<row_slice> slices;
+
+  // Page indexes allow reading only the pages that hold the rows of the slices
+  std::vector<int> index_columns;
+  for (auto const &col : _selected_columns) { index_columns.push_back(col.first); }
+  std::vector<std::vector<chunk_page_index>> page_indexes;
+  // Decoded rows selected by the row mask, if any
+  std::vector<size_type> mask_gather_map;
+  if (!_filter.empty()) {
+    if (!selected_row_groups.empty()) {
+      auto const &first_row_group = _metadata->get_row_group(selected_row_groups[0].index,
+                                                             selected_row_groups[0].source_index);
+      std::vector<std::string> filter_columns;
+      collect_filter_columns(_filter, filter_columns);
+      for (auto const &name : filter_columns) {
+        for (size_t c = 0; c < first_row_group.columns.size(); ++c) {
+          if (name_from_path(first_row_group.columns[c].meta_data.path_in_schema) == name &&
+              std::find(index_columns.begin(), index_columns.end(), static_cast<int>(c)) ==
+                index_columns.end()) {
+            index_columns.push_back(c);
+          }
+        }
+      }
+      page_indexes = _metadata->read_page_indexes(
+        _sources, selected_row_groups, std::vector<bool>(selected_row_groups.size(), true),
+        index_columns);
+    }
+    // The output only holds the row ranges that may match the filter
+    int64_t out_rows = 0;
+    for (size_t r = 0; r < selected_row_groups.size(); ++r) {
+      auto const &rg        = selected_row_groups[r];
+      auto const &row_group = _metadata->get_row_group(rg.index, rg.source_index);
+      auto const ranges     = _metadata->filter_row_ranges(
+        _filter, row_group, index_columns, page_indexes[r], _selected_columns.size());
+      for (auto const &range : ranges) {
+        slices.push_back({r, range.first, range.second, out_rows - range.first});
+        out_rows += range.second - range.first;
+      }
+    }
+    skip_rows = 0;
+    num_rows  = static_cast<size_type>(out_rows);
+  } else if (has_row_mask(_row_mask)) {
+    // Rows of each row group covered by the mask, as for a read without mask
+    std::vector<std::pair<int64_t, int64_t>> rg_rows_read;
+    int64_t mask_size = 0;
+    for (auto const &rg : selected_row_groups) {
+      int64_t const rg_rows   = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+      int64_t const start_row = rg.start_row;
+      int64_t const begin     = std::min(std::max<int64_t>(skip_rows - start_row, 0), rg_rows);
+      int64_t const end =
+        std::max(std::min<int64_t>(int64_t{skip_rows} + num_rows - start_row, rg_rows), begin);
+      rg_rows_read.emplace_back(begin, end);
+      mask_size += end - begin;
+    }
+    CUDF_EXPECTS(_row_mask.size() == mask_size, "Row mask size must match the number of rows read");
+    auto const selected = row_mask_to_host(_row_mask, stream);
+    if (!selected_row_groups.empty()) {
+      page_indexes = _metadata->read_page_indexes(
+        _sources, selected_row_groups, std::vector<bool>(selected_row_groups.size(), true),
+        index_columns);
+    }
+
+    // Decode the pages holding selected rows; the other rows of these pages are dropped after
+    int64_t out_rows = 0;
+    int64_t mask_row = 0;
+    for (size_t r = 0; r < selected_row_groups.size(); ++r) {
+      auto const &rg        = selected_row_groups[r];
+      auto const &row_group = _metadata->get_row_group(rg.index, rg.source_index);
+      int64_t const rg_rows = row_group.num_rows;
+      auto const begin      = rg_rows_read[r].first;
+      auto const end        = rg_rows_read[r].second;
+      auto ranges           = selected_row_ranges(selected, mask_row, begin, end);
+      if (ranges.empty()) {
+        mask_row += end - begin;
+        continue;
+      }
+
+      // Nested chunks are always read in full
+      std::vector<std::vector<int64_t>> bounds;
+      for (size_t i = 0; i < _selected_columns.size(); ++i) {
+        auto const &chunk  = row_group.columns[_selected_columns[i].first];
+        bool const is_flat =
+          _metadata->get_schema(chunk.schema_idx).max_repetition_level == 0 &&
+          !is_struct_field(_metadata->get_schema(), chunk.schema_idx);
+        bounds.push_back(
+          page_row_bounds(is_flat ? page_indexes[r][i].offset_index : OffsetIndex{}, rg_rows));
+      }
+      align_row_ranges(ranges, bounds);
+      for (auto const &range : ranges) {
+        slices.push_back({r, range.first, range.second, out_rows - range.first});
+        for (auto row = range.first; row < range.second; ++row) {
+          if (row >= begin && row < end && selected[mask_row + row - begin]) {
+            mask_gather_map.push_back(static_cast<size_type>(out_rows + row - range.first));
+          }
+        }
+        out_rows += range.second - range.first;
+      }
+      mask_row += end - begin;
+    }
+    skip_rows = 0;
+    num_rows  = static_cast<size_type>(out_rows);
+  } else {
+    std::vector<bool> partial(selected_row_groups.size(), false);
+    for (size_t r = 0; r < selected_row_groups.size(); ++r) {
+      auto const &rg          = selected_row_groups[r];
+      int64_t const rg_rows   = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+      int64_t const start_row = rg.start_row;
+      int64_t const begin     = std::min(std::max<int64_t>(skip_rows - start_row, 0), rg_rows);
+      int64_t const end =
+        std::max(std::min<int64_t>(int64_t{skip_rows} + num_rows - start_row, rg_rows), begin);
+      slices.push_back({r, begin, end, start_row});
+      partial[r] = (begin > 0 || end < rg_rows);
+    }
+    if (std::any_of(partial.begin(), partial.end(), [](bool p) { return p; })) {
+      page_indexes =
+        _metadata->read_page_indexes(_sources, selected_row_groups, partial, index_columns);
     }
   }
 
   std::vector<std::unique_ptr<column>> out_columns;
   out_columns.reserve(column_types.size());
 
-  if (selected_row_groups.size() != 0 && column_types.size() != 0) {
+  if (slices.size() != 0 && column_types.size() != 0) {
     // Descriptors for all the chunks that make up the selected columns
     const auto num_columns = _selected_columns.size();
-    const auto num_chunks  = selected_row_groups.size() * num_columns;
+    const auto num_chunks  = slices.size() * num_columns;
     hostdevice_vector<gpu::ColumnChunkDesc> chunks(0, num_chunks, stream);
 
     // Association between each column chunk and its column
@@ -761,18 +2311,19 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<rmm::device_buffer> page_data(num_chunks);
 
-    // Keep track of column chunk file offsets
-    std::vector<size_t> column_chunk_offsets(num_chunks);
+    // Keep track of the file byte ranges of each column chunk
+    std::vector<std::vector<std::pair<size_t, size_t>>> chunk_byte_ranges(num_chunks);
+
+    // Number of values of each list column
+    std::vector<size_t> list_values(num_columns, 0);
 
     // Initialize column chunk information
     size_t total_decompressed_size = 0;
-    auto remaining_rows            = num_rows;
-    for (const auto &rg : selected_row_groups) {
+    for (const auto &slice : slices) {
+      const auto &rg              = selected_row_groups[slice.rg];
       const auto &row_group       = _metadata->get_row_group(rg.index, rg.source_index);
-      auto const row_group_start  = rg.start_row;
       auto const row_group_source = rg.source_index;
-      auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
-      auto const io_chunk_idx     = chunks.size();
+      bool const is_partial       = (slice.begin > 0 || slice.end < row_group.num_rows);
 
       for (size_t i = 0; i < num_columns; ++i) {
         auto const col         = _selected_columns[i];
@@ -781,7 +2332,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
         // Spec requires each row group to contain exactly one chunk for every
         // column. If there are too many or too few, continue with best effort
-        if (col.second != name_from_path(col_meta.path_in_schema)) {
+        if (col.second != column_name(col_meta, col_schema)) {
           std::cerr << "Detected mismatched column chunk" << std::endl;
           continue;
         }
@@ -800,18 +2351,54 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                           col_schema.converted_type,
                           col_schema.type_length);
 
-        column_chunk_offsets[chunks.size()] =
+        size_t const chunk_offset =
           (col_meta.dictionary_page_offset != 0)
             ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
             : col_meta.data_page_offset;
 
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        // Read only the dictionary and the data pages that hold the rows of the slice
+        auto &byte_ranges  = chunk_byte_ranges[chunks.size()];
+        int64_t first_row  = 0;
+        int64_t chunk_rows = row_group.num_rows;
+        size_t num_values  = col_meta.num_values;
+        if (is_partial && !page_indexes.empty() && page_indexes[slice.rg][i].has_offset_index() &&
+            !is_nested_column[i]) {
+          auto const &offset_index = page_indexes[slice.rg][i].offset_index;
+          auto const &locs         = offset_index.page_locations;
+          auto const bounds        = page_row_bounds(offset_index, row_group.num_rows);
+          auto const first_page    = page_of_row(bounds, slice.begin);
+          auto const last_page     = page_of_row(bounds, slice.end - 1);
+          if (static_cast<size_t>(locs[0].offset) > chunk_offset) {
+            byte_ranges.emplace_back(chunk_offset, locs[0].offset - chunk_offset);
+          }
+          byte_ranges.emplace_back(locs[first_page].offset,
+                                   locs[last_page].offset + locs[last_page].compressed_page_size -
+                                     locs[first_page].offset);
+          first_row  = bounds[first_page];
+          chunk_rows = bounds[last_page + 1] - first_row;
+          num_values = chunk_rows;
+        } else {
+          byte_ranges.emplace_back(chunk_offset, col_meta.total_compressed_size);
+        }
+        // The values of nested chunks are output back to back
+        auto chunk_start_row = slice.base_row + first_row;
+        if (is_nested_column[i]) {
+          chunk_start_row = list_values[i];
+          chunk_rows      = num_values;
+          list_values[i] += num_values;
+        }
+        size_t const compressed_size = std::accumulate(
+          byte_ranges.begin(), byte_ranges.end(), size_t{0}, [](size_t sum, auto const &range) {
+            return sum + range.second;
+          });
+
+        chunks.insert(gpu::ColumnChunkDesc(compressed_size,
                                            nullptr,
-                                           col_meta.num_values,
+                                           num_values,
                                            col_schema.type,
                                            type_width,
-                                           row_group_start,
-                                           row_group_rows,
+                                           chunk_start_row,
+                                           chunk_rows,
                                            col_schema.max_definition_level,
                                            col_schema.max_repetition_level,
                                            required_bits(col_schema.max_definition_level),
@@ -821,6 +2408,11 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                            col_schema.decimal_scale,
                                            clock_rate));
 
+        // Strings of dictionary columns are output as indices into the chunk dictionaries
+        if (column_types[i].id() == type_id::DICTIONARY32) {
+          chunks[chunks.size() - 1].str_dict_base = 0;
+        }
+
         // Map each column chunk to its column index and its source index
         chunk_col_map[chunks.size() - 1]    = i;
         chunk_source_map[chunks.size() - 1] = row_group_source;
@@ -829,18 +2421,21 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           total_decompressed_size += col_meta.total_uncompressed_size;
         }
       }
-      // Read compressed chunk data to device memory
-      read_column_chunks(page_data,
-                         chunks,
-                         io_chunk_idx,
-                         chunks.size(),
-                         column_chunk_offsets,
-                         chunk_source_map,
-                         stream);
+    }
+
+    // Device memory held besides the outputs, for the metrics
+    auto const record_scratch = [&](size_t buffers_size) {
+      size_t size = _decompressor.scratch_size() + buffers_size;
+      for (auto const &data : page_data) { size += data.size(); }
+      metrics->peak_scratch_bytes = std::max(metrics->peak_scratch_bytes, size);
+    };
 
-      remaining_rows -= row_group.num_rows;
+    // Read compressed chunk data of all row groups to device memory
+    {
+      metrics_timer timer(metrics.get(), &io_metrics::h2d_copy_ms, stream);
+      read_column_chunks(
+        page_data, chunks, 0, chunks.size(), chunk_byte_ranges, chunk_source_map, stream);
     }
-    assert(remaining_rows <= 0);
 
     // Process dataset chunk pages into output columns
     const auto total_pages = count_page_headers(chunks, stream);
@@ -850,7 +2445,10 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
       decode_page_headers(chunks, pages, stream);
       if (total_decompressed_size > 0) {
+        metrics_timer timer(metrics.get(), &io_metrics::decompression_ms, stream);
         decomp_page_data = decompress_page_data(chunks, pages, stream);
+        timer.stop();
+        if (metrics) { record_scratch(decomp_page_data.size()); }
         // Free compressed data
         for (size_t c = 0; c < chunks.size(); c++) {
           if (chunks[c].codec != parquet::Compression::UNCOMPRESSED && page_data[c].size() != 0) {
@@ -860,6 +2458,35 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         }
       }
 
+      metrics_timer decode_timer(metrics.get(), &io_metrics::decode_ms, stream);
+
+      // Delta-encoded pages are converted to PLAIN encoding before decoding the values
+      rmm::device_buffer plain_page_data;
+      if (std::any_of(pages.host_ptr(), pages.host_ptr() + pages.size(), [](auto const &page) {
+            return gpu::IsDeltaEncodedPage(page);
+          })) {
+        plain_page_data = decode_delta_pages(chunks, pages, stream);
+      }
+
+      // Dictionary columns keep the dictionary indices only if the dictionaries of their
+      // chunks hold every value; the others are decoded as strings and encoded afterwards
+      std::vector<bool> decode_dict_indices(column_types.size(), false);
+      for (size_t i = 0; i < column_types.size(); ++i) {
+        decode_dict_indices[i] = (column_types[i].id() == type_id::DICTIONARY32);
+      }
+      for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+        if (!is_dictionary_encoded(chunks[c], pages.host_ptr(page_count))) {
+          decode_dict_indices[chunk_col_map[c]] = false;
+        }
+        page_count += chunks[c].max_num_pages;
+      }
+      for (size_t c = 0; c < chunks.size(); c++) {
+        if (chunks[c].str_dict_base >= 0 && !decode_dict_indices[chunk_col_map[c]]) {
+          chunks[c].data_type     = chunks[c].data_type & 7;  // strings output
+          chunks[c].str_dict_base = -1;
+        }
+      }
+
       std::vector<column_buffer> out_buffers;
       out_buffers.reserve(column_types.size());
       for (size_t i = 0; i < column_types.size(); ++i) {
@@ -868,21 +2495,115 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                                                selected_row_groups[0].source_index);
         auto &col_schema = _metadata->get_schema(first_row_group.columns[col.first].schema_idx);
         bool is_nullable = (col_schema.max_definition_level != 0);
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
+        auto const buffer_type =
+          column_types[i].id() != type_id::DICTIONARY32
+            ? column_types[i]
+            : data_type{decode_dict_indices[i] ? type_id::INT32 : type_id::STRING};
+        auto const buffer_size = is_nested_column[i] ? list_values[i] : num_rows;
+        // Variable-length strings are decoded straight into offsets and characters
+        bool const string_offsets = (col_schema.type == parquet::BYTE_ARRAY);
+        out_buffers.emplace_back(
+          buffer_type, buffer_size, is_nullable, stream, _mr, string_offsets);
       }
 
-      decode_page_data(chunks, pages, skip_rows, num_rows, chunk_col_map, out_buffers, stream);
+      // Definition then repetition levels of each value of the list columns, and definition
+      // levels of each value of the struct fields
+      std::vector<rmm::device_buffer> level_data(column_types.size());
+      for (size_t i = 0; i < column_types.size(); ++i) {
+        if (is_nested_column[i]) {
+          level_data[i] = rmm::device_buffer(
+            list_values[i] * (is_list_column[i] ? 2 : 1), stream, get_scratch_resource());
+        }
+      }
+      for (size_t c = 0; c < chunks.size(); c++) {
+        auto const i = chunk_col_map[c];
+        if (is_nested_column[i]) {
+          chunks[c].level_data[0] = static_cast<uint8_t *>(level_data[i].data());
+        }
+        if (is_list_column[i]) {
+          chunks[c].level_data[1] = chunks[c].level_data[0] + list_values[i];
+        }
+      }
+      if (metrics) {
+        size_t size = decomp_page_data.size() + plain_page_data.size();
+        for (auto const &levels : level_data) { size += levels.size(); }
+        record_scratch(size);
+      }
+
+      auto const str_dict_index =
+        decode_page_data(chunks, pages, skip_rows, num_rows, chunk_col_map, out_buffers, stream);
+      if (std::any_of(
+            is_nested_column.begin(), is_nested_column.end(), [](bool n) { return n; })) {
+        CUDA_TRY(gpu::DecodePageLevels(
+          pages.device_ptr(), pages.size(), chunks.device_ptr(), chunks.size(), stream));
+      }
 
       for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(
-          make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+        if (is_list_column[i]) {
+          auto const values =
+            make_column(column_types[i], list_values[i], out_buffers[i], stream);
+          auto const def_levels = static_cast<uint8_t const *>(level_data[i].data());
+          auto const first_row  = static_cast<size_type>(slices.front().begin);
+          out_columns.emplace_back(make_list_from_levels(values->view(),
+                                                         def_levels + list_values[i],
+                                                         def_levels,
+                                                         list_levels[i],
+                                                         first_row,
+                                                         num_rows,
+                                                         stream,
+                                                         _mr));
+        } else if (is_field_column[i]) {
+          // The rows of the fields start at the first row of the first slice, like the rows of
+          // the lists
+          auto const first_row = static_cast<size_type>(slices.front().begin);
+          if (first_row == 0 && list_values[i] == static_cast<size_t>(num_rows)) {
+            out_columns.emplace_back(
+              make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+          } else {
+            auto const values =
+              make_column(column_types[i], list_values[i], out_buffers[i], stream);
+            out_columns.emplace_back(std::make_unique<column>(
+              cudf::slice(values->view(), {first_row, first_row + num_rows}).front(),
+              stream,
+              _mr));
+          }
+          field_levels[i]     = std::move(level_data[i]);
+          field_levels_offset = first_row;
+        } else if (column_types[i].id() != type_id::DICTIONARY32) {
+          out_columns.emplace_back(
+            make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+        } else if (decode_dict_indices[i]) {
+          std::vector<std::pair<size_t, size_t>> dict_ranges;
+          for (size_t c = 0, page_count = 0; c < chunks.size(); c++) {
+            if (chunk_col_map[c] == static_cast<int>(i)) {
+              dict_ranges.emplace_back(chunks[c].str_dict_index - str_dict_index.data().get(),
+                                       pages[page_count].num_values);
+            }
+            page_count += chunks[c].max_num_pages;
+          }
+          out_columns.emplace_back(make_dictionary_from_chunks(
+            str_dict_index, dict_ranges, num_rows, out_buffers[i], stream, _mr));
+        } else {
+          auto const strings =
+            make_column(data_type{type_id::STRING}, num_rows, out_buffers[i], stream);
+          out_columns.emplace_back(cudf::dictionary::detail::encode(
+            strings->view(), data_type{type_id::INT32}, _mr, stream));
+        }
       }
     }
   }
 
   // Create empty columns as needed
   for (size_t i = out_columns.size(); i < column_types.size(); ++i) {
-    out_columns.emplace_back(make_empty_column(column_types[i]));
+    if (is_list_column[i]) {
+      out_columns.emplace_back(make_lists_column(0,
+                                                 make_empty_column(data_type{type_id::INT32}),
+                                                 make_empty_column(column_types[i]),
+                                                 0,
+                                                 rmm::device_buffer{}));
+    } else {
+      out_columns.emplace_back(make_empty_column(column_types[i]));
+    }
   }
 
   table_metadata out_metadata;
@@ -891,18 +2612,51 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   for (size_t i = 0; i < _selected_columns.size(); i++) {
     out_metadata.column_names[i] = _selected_columns[i].second;
   }
+  // The fields of groups are returned as STRUCT columns
+  if (std::any_of(is_field_column.begin(), is_field_column.end(), [](bool f) { return f; })) {
+    std::vector<uint8_t const *> def_levels(column_types.size(), nullptr);
+    for (size_t i = 0; i < column_types.size(); ++i) {
+      if (field_levels[i].size() != 0) {
+        def_levels[i] = static_cast<uint8_t const *>(field_levels[i].data()) + field_levels_offset;
+      }
+    }
+    assemble_struct_columns(_metadata->get_schema(),
+                            leaf_schema_idx,
+                            out_columns,
+                            out_metadata.column_names,
+                            def_levels,
+                            num_rows,
+                            stream,
+                            _mr);
+  }
   // Return user metadata
   out_metadata.user_data = _metadata->get_key_value_metadata();
 
-  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+  if (metrics) {
+    take_decompression_metrics(_decompressor, *metrics);
+    for (auto source : _metered_sources) { source->take_metrics(*metrics); }
+  }
+
+  auto out_table = std::make_unique<table>(std::move(out_columns));
+  if (has_row_mask(_row_mask) && mask_gather_map.size() != static_cast<size_t>(num_rows)) {
+    out_table = gather_rows(out_table->view(), mask_gather_map, _mr, stream);
+  }
+
+  return {std::move(out_table), std::move(out_metadata), std::move(metrics)};
 }
 
 // Forward to implementation
 reader::reader(std::vector<std::string> const &filepaths,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(filepaths), options, mr))
 {
+  // Only files have a version to key the metadata cache with
+  std::vector<std::string> cache_keys;
+  if (options.use_metadata_cache) {
+    std::transform(
+      filepaths.begin(), filepaths.end(), std::back_inserter(cache_keys), file_cache_key);
+  }
+  _impl = std::make_unique<impl>(datasource::create(filepaths), options, mr, cache_keys);
 }
 
 // Forward to implementation
@@ -926,12 +2680,96 @@ table_with_metadata reader::read_row_groups(std::vector<std::vector<size_type>>
   return _impl->read(0, -1, row_groups, stream);
 }
 
+// Forward to implementation
+void reader::begin_chunked_read(size_t chunk_read_limit,
+                                std::vector<std::vector<size_type>> const &row_groups)
+{
+  _impl->begin_chunked_read(chunk_read_limit, row_groups);
+}
+
+// Forward to implementation
+bool reader::has_next_chunk() const { return _impl->has_next_chunk(); }
+
+// Forward to implementation
+table_with_metadata reader::read_next_chunk(cudaStream_t stream)
+{
+  return _impl->read_next_chunk(stream);
+}
+
+// Forward to implementation
+memory_estimate reader::estimate_memory(std::vector<std::vector<size_type>> const &row_groups,
+                                        size_type skip_rows,
+                                        size_type num_rows)
+{
+  return _impl->estimate_memory(skip_rows, (num_rows > 0) ? num_rows : -1, row_groups);
+}
+
 // Forward to implementation
 table_with_metadata reader::read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream)
 {
   return _impl->read(skip_rows, (num_rows != 0) ? num_rows : -1, {}, stream);
 }
 
+file_metadata read_metadata(datasource *source)
+{
+  metadata const md(source);
+  file_metadata result;
+  result.num_rows = md.num_rows;
+  for (auto const &kv : md.key_value_metadata) { result.user_data[kv.key] = kv.value; }
+
+  int64_t first_row = 0;
+  for (auto const &row_group : md.row_groups) {
+    row_block_metadata block;
+    block.first_row = first_row;
+    block.num_rows  = row_group.num_rows;
+    block.offset    = std::numeric_limits<int64_t>::max();
+    for (auto const &chunk : row_group.columns) {
+      auto const &col_meta   = chunk.meta_data;
+      auto const &col_schema = md.schema[chunk.schema_idx];
+      auto const chunk_start = (col_meta.dictionary_page_offset > 0)
+                                 ? col_meta.dictionary_page_offset
+                                 : col_meta.data_page_offset;
+      block.offset = std::min(block.offset, chunk_start);
+      block.size += col_meta.total_compressed_size;
+
+      Statistics stats;
+      if (!col_meta.statistics_blob.empty()) {
+        CompactProtocolReader cp(col_meta.statistics_blob.data(), col_meta.statistics_blob.size());
+        if (!cp.read(&stats)) { stats = Statistics{}; }
+      }
+      block.columns.push_back(to_column_statistics(column_name(col_meta, col_schema),
+                                                   to_value_range(col_meta, col_schema),
+                                                   col_meta.num_values,
+                                                   stats.null_count));
+    }
+    if (row_group.columns.empty()) { block.offset = 0; }
+    first_row += row_group.num_rows;
+    result.blocks.push_back(std::move(block));
+  }
+
+  // The schema is described by the column chunks of the first row group
+  if (!md.row_groups.empty()) {
+    for (auto const &chunk : md.row_groups[0].columns) {
+      auto const &col_schema = md.schema[chunk.schema_idx];
+      result.column_names.push_back(column_name(chunk.meta_data, col_schema));
+      if (col_schema.max_repetition_level > 0) {
+        result.column_types.emplace_back(type_id::LIST);
+        continue;
+      }
+      // Types read with the default options of `read_parquet_args`
+      auto const col_type = to_type_id(col_schema.type,
+                                       col_schema.converted_type,
+                                       false,
+                                       false,
+                                       type_id::EMPTY,
+                                       col_schema.decimal_scale,
+                                       true);
+      result.column_types.emplace_back(col_type);
+    }
+  }
+  return result;
+}
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
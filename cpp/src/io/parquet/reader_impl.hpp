@@ -24,8 +24,10 @@
 #include "parquet.h"
 #include "parquet_gpu.h"
 
+#include <io/comp/gpu_decompressor.h>
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/io_metrics.hpp>
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/readers.hpp>
@@ -56,10 +58,12 @@ class reader::impl {
    * @param sources Dataset sources
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
+   * @param cache_keys Metadata cache key of each source; sources without a key are not cached
    */
   explicit impl(std::vector<std::unique_ptr<datasource>> &&sources,
                 reader_options const &options,
-                rmm::mr::device_memory_resource *mr);
+                rmm::mr::device_memory_resource *mr,
+                std::vector<std::string> const &cache_keys = {});
 
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
@@ -76,7 +80,55 @@ class reader::impl {
                            std::vector<std::vector<size_type>> const &row_group_indices,
                            cudaStream_t stream);
 
+  /**
+   * @brief Estimates the device memory needed by `read()` of the same row groups and rows
+   *
+   * Row groups are charged as a whole, with the sizing `begin_chunked_read()` plans batches with.
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; -1 for all
+   * @param row_group_indices Row groups to read, one list per source; empty for all row groups
+   *
+   * @return The estimated output and peak scratch bytes of the read
+   */
+  memory_estimate estimate_memory(size_type skip_rows,
+                                  size_type num_rows,
+                                  std::vector<std::vector<size_type>> const &row_group_indices);
+
+  /**
+   * @brief Plans the batches of row groups returned by successive `read_next_chunk()` calls
+   *
+   * Row groups are grouped in file order so that the estimated device memory needed to read each
+   * batch (compressed pages, decompression scratch and output columns) stays within the limit. A
+   * row group that exceeds the limit on its own is returned as a single batch.
+   *
+   * @param chunk_read_limit Byte limit for each batch; 0 to read all row groups in one batch
+   * @param row_group_indices Row groups to read, one list per source; empty for all row groups
+   */
+  void begin_chunked_read(size_t chunk_read_limit,
+                          std::vector<std::vector<size_type>> const &row_group_indices);
+
+  /**
+   * @brief Returns whether `read_next_chunk()` has any remaining batch to read
+   */
+  bool has_next_chunk() const { return _next_chunk < _chunk_row_groups.size(); }
+
+  /**
+   * @brief Reads the next batch of row groups planned by `begin_chunked_read()`
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_next_chunk(cudaStream_t stream);
+
  private:
+  /**
+   * @brief Returns the output data types of the selected columns, the element types for the
+   * list columns
+   */
+  std::vector<data_type> get_column_types() const;
+
   /**
    * @brief Reads compressed page data to device memory
    *
@@ -84,17 +136,19 @@ class reader::impl {
    * @param chunks List of column chunk descriptors
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
-   * @param column_chunk_offsets File offset for all chunks
+   * @param chunk_byte_ranges File byte ranges (offset, size) to read for all chunks
+   * @param chunk_source_map Source index of all chunks
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    */
-  void read_column_chunks(std::vector<rmm::device_buffer> &page_data,
-                          hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
-                          size_t begin_chunk,
-                          size_t end_chunk,
-                          const std::vector<size_t> &column_chunk_offsets,
-                          std::vector<size_type> const &chunk_source_map,
-                          cudaStream_t stream);
+  void read_column_chunks(
+    std::vector<rmm::device_buffer> &page_data,
+    hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+    size_t begin_chunk,
+    size_t end_chunk,
+    const std::vector<std::vector<std::pair<size_t, size_t>>> &chunk_byte_ranges,
+    std::vector<size_type> const &chunk_source_map,
+    cudaStream_t stream);
 
   /**
    * @brief Returns the number of total pages from the given column chunks
@@ -130,6 +184,19 @@ class reader::impl {
                                           hostdevice_vector<gpu::PageInfo> &pages,
                                           cudaStream_t stream);
 
+  /**
+   * @brief Converts the delta-encoded pages to PLAIN encoding, at page granularity.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Device buffer to the converted page data
+   */
+  rmm::device_buffer decode_delta_pages(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                                        hostdevice_vector<gpu::PageInfo> &pages,
+                                        cudaStream_t stream);
+
   /**
    * @brief Converts the page data and outputs to columns.
    *
@@ -140,14 +207,17 @@ class reader::impl {
    * @param chunk_map Mapping between chunk and column
    * @param out_buffers Output columns' device buffers
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Index of the string dictionaries of all the chunks
    */
-  void decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
-                        hostdevice_vector<gpu::PageInfo> &pages,
-                        size_t min_row,
-                        size_t total_rows,
-                        const std::vector<int> &chunk_map,
-                        std::vector<column_buffer> &out_buffers,
-                        cudaStream_t stream);
+  rmm::device_vector<gpu::nvstrdesc_s> decode_page_data(
+    hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+    hostdevice_vector<gpu::PageInfo> &pages,
+    size_t min_row,
+    size_t total_rows,
+    const std::vector<int> &chunk_map,
+    std::vector<column_buffer> &out_buffers,
+    cudaStream_t stream);
 
  private:
   rmm::mr::device_memory_resource *_mr = nullptr;
@@ -156,7 +226,21 @@ class reader::impl {
 
   std::vector<std::pair<int, std::string>> _selected_columns;
   bool _strings_to_categorical = false;
+  bool _strings_to_dictionary  = false;
+  bool _decimals_as_float      = true;
   data_type _timestamp_type{type_id::EMPTY};
+  stats_filter _filter;
+  column_view _row_mask;
+
+  std::vector<std::vector<std::vector<size_type>>> _chunk_row_groups;
+  size_t _next_chunk = 0;
+
+  // Kept across the reads of the reader to reuse its scratch memory
+  gpu_decompressor _decompressor;
+
+  // Wrappers of the sources counting their reads, when the metrics are collected
+  bool _collect_metrics = false;
+  std::vector<metered_source *> _metered_sources;
 };
 
 }  // namespace parquet
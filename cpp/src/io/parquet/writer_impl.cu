@@ -21,8 +21,18 @@
 
 #include "writer_impl.hpp"
 
+#include "bloom_filter.cuh"
+#include "clustering.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
 
 #include <algorithm>
 #include <cstring>
@@ -31,6 +41,12 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -60,6 +76,378 @@ parquet::Compression to_parquet_compression(compression_type compression)
   }
 }
 
+/**
+ * @brief Compares two plain-encoded statistics values in the sort order of the column type
+ *
+ * @return A negative, zero or positive value if `a` is less than, equal to or greater than `b`
+ **/
+int compare_stats_values(SchemaElement const &col_schema,
+                         std::vector<uint8_t> const &a,
+                         std::vector<uint8_t> const &b)
+{
+  auto const load = [](std::vector<uint8_t> const &bytes, auto value) {
+    memcpy(&value, bytes.data(), std::min(sizeof(value), bytes.size()));
+    return value;
+  };
+  auto const compare = [](auto x, auto y) { return (x < y) ? -1 : (y < x) ? 1 : 0; };
+  bool const is_unsigned =
+    col_schema.converted_type == UINT_8 || col_schema.converted_type == UINT_16 ||
+    col_schema.converted_type == UINT_32 || col_schema.converted_type == UINT_64;
+  switch (col_schema.type) {
+    case BOOLEAN: return compare(load(a, uint8_t{0}), load(b, uint8_t{0}));
+    case INT32:
+      return is_unsigned ? compare(load(a, uint32_t{0}), load(b, uint32_t{0}))
+                         : compare(load(a, int32_t{0}), load(b, int32_t{0}));
+    case INT64:
+      return is_unsigned ? compare(load(a, uint64_t{0}), load(b, uint64_t{0}))
+                         : compare(load(a, int64_t{0}), load(b, int64_t{0}));
+    case FLOAT: return compare(load(a, 0.0f), load(b, 0.0f));
+    case DOUBLE: return compare(load(a, 0.0), load(b, 0.0));
+    default:
+      // Byte arrays compare as unsigned bytes
+      return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end())
+               ? -1
+               : std::lexicographical_compare(b.begin(), b.end(), a.begin(), a.end()) ? 1 : 0;
+  }
+}
+
+/**
+ * @brief Returns the ordering of the page min/max values of a column index
+ **/
+BoundaryOrder get_boundary_order(ColumnIndex const &column_index, SchemaElement const &col_schema)
+{
+  bool ascending  = true;
+  bool descending = true;
+  int prev        = -1;
+  for (size_t p = 0; p < column_index.null_pages.size(); ++p) {
+    if (column_index.null_pages[p]) { continue; }
+    if (prev >= 0) {
+      auto const cmp_min =
+        compare_stats_values(col_schema, column_index.min_values[prev], column_index.min_values[p]);
+      auto const cmp_max =
+        compare_stats_values(col_schema, column_index.max_values[prev], column_index.max_values[p]);
+      if (cmp_min > 0 || cmp_max > 0) { ascending = false; }
+      if (cmp_min < 0 || cmp_max < 0) { descending = false; }
+    }
+    prev = p;
+  }
+  return ascending ? ASCENDING : descending ? DESCENDING : UNORDERED;
+}
+
+/**
+ * @brief Leaf values and levels of a LIST column
+ *
+ * Each row is written as one value per list element, or as a single null value for the null and
+ * empty lists, which are told apart by their definition level. The definition levels assume an
+ * optional list of optional elements (0: null list, 1: empty list, 2: null element, 3: element)
+ * until `set_list_definition` adapts them to the schema.
+ **/
+struct flat_list_column {
+  std::unique_ptr<column> values;            //!< Value of each level entry
+  rmm::device_vector<uint32_t> row_offsets;  //!< First entry of each row, then the entry count
+  rmm::device_vector<uint8_t> rep_levels;    //!< Repetition level of each entry
+  rmm::device_vector<uint8_t> def_levels;    //!< Definition level of each entry
+  bool nullable;                             //!< Whether the lists may be null
+  bool element_nullable;                     //!< Whether the list elements may be null
+};
+
+struct list_row_entries {
+  size_type const *offsets;
+  bitmask_type const *nulls;
+  size_type offset;
+  size_type num_rows;
+
+  __device__ uint32_t operator()(size_type row) const
+  {
+    if (row >= num_rows) { return 0; }
+    if (nulls && !bit_is_set(nulls, offset + row)) { return 1; }
+    return max(offsets[row + 1] - offsets[row], 1);
+  }
+};
+
+struct flatten_list_entry {
+  size_type const *offsets;
+  bitmask_type const *nulls;
+  size_type offset;
+  bitmask_type const *element_nulls;
+  size_type element_offset;
+  size_type num_elements;
+  uint32_t const *row_offsets;
+  uint32_t const *entry_rows;
+  size_type *gather_map;
+  uint8_t *rep_levels;
+  uint8_t *def_levels;
+
+  __device__ void operator()(size_type entry) const
+  {
+    size_type const row     = entry_rows[entry] - 1;
+    size_type const index   = entry - static_cast<size_type>(row_offsets[row]);
+    size_type const element = offsets[row] + index;
+    rep_levels[entry]       = (index == 0) ? 0 : 1;
+    if (nulls && !bit_is_set(nulls, offset + row)) {
+      gather_map[entry] = num_elements;
+      def_levels[entry] = 0;
+    } else if (element >= offsets[row + 1]) {
+      gather_map[entry] = num_elements;
+      def_levels[entry] = 1;
+    } else {
+      gather_map[entry] = element;
+      def_levels[entry] =
+        (element_nulls && !bit_is_set(element_nulls, element_offset + element)) ? 2 : 3;
+    }
+  }
+};
+
+struct list_definition_level {
+  uint8_t list_required;
+  uint8_t element_required;
+
+  __device__ uint8_t operator()(uint8_t def_level) const
+  {
+    return def_level - list_required - ((def_level == 3) ? element_required : 0);
+  }
+};
+
+/**
+ * @brief Flattens a LIST column into its leaf values and levels
+ *
+ * @param col The LIST column
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The leaf values and levels, or nullptr if the column is not a LIST column
+ **/
+std::unique_ptr<flat_list_column> flatten_list_column(column_view const &col, cudaStream_t stream)
+{
+  if (col.type().id() != type_id::LIST) { return nullptr; }
+  lists_column_view const lists(col);
+  auto const child = lists.child();
+  CUDF_EXPECTS(child.type().id() != type_id::LIST, "Nested lists are not supported");
+  CUDF_EXPECTS(child.type().id() != type_id::STRUCT, "Lists of structs are not supported");
+
+  auto list    = std::make_unique<flat_list_column>();
+  auto execpol = rmm::exec_policy(stream);
+  auto rows    = thrust::make_counting_iterator<size_type>(0);
+  list->nullable         = col.nullable();
+  list->element_nullable = child.nullable();
+
+  auto const offsets = lists.offsets().data<size_type>() + col.offset();
+  auto const nulls   = col.nullable() ? col.null_mask() : nullptr;
+  list->row_offsets.resize(col.size() + 1);
+  thrust::transform_exclusive_scan(execpol->on(stream),
+                                   rows,
+                                   rows + col.size() + 1,
+                                   list->row_offsets.begin(),
+                                   list_row_entries{offsets, nulls, col.offset(), col.size()},
+                                   uint32_t{0},
+                                   thrust::plus<uint32_t>());
+  uint32_t num_entries = 0;
+  CUDA_TRY(cudaMemcpyAsync(&num_entries,
+                           list->row_offsets.data().get() + col.size(),
+                           sizeof(uint32_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // Row of each entry, plus one
+  rmm::device_vector<uint32_t> entry_rows(num_entries);
+  thrust::upper_bound(execpol->on(stream),
+                      list->row_offsets.begin(),
+                      list->row_offsets.end(),
+                      thrust::make_counting_iterator<uint32_t>(0),
+                      thrust::make_counting_iterator<uint32_t>(num_entries),
+                      entry_rows.begin());
+  rmm::device_vector<size_type> gather_map(num_entries);
+  list->rep_levels.resize(num_entries);
+  list->def_levels.resize(num_entries);
+  thrust::for_each(execpol->on(stream),
+                   rows,
+                   rows + num_entries,
+                   flatten_list_entry{offsets,
+                                      nulls,
+                                      col.offset(),
+                                      child.nullable() ? child.null_mask() : nullptr,
+                                      child.offset(),
+                                      child.size(),
+                                      list->row_offsets.data().get(),
+                                      entry_rows.data().get(),
+                                      gather_map.data().get(),
+                                      list->rep_levels.data().get(),
+                                      list->def_levels.data().get()});
+
+  // Null and empty lists gather a null value
+  column_view const gather_map_view(
+    data_type{type_id::INT32}, static_cast<size_type>(num_entries), gather_map.data().get());
+  list->values = std::move(cudf::detail::gather(table_view{{child}},
+                                                gather_map_view,
+                                                cudf::detail::out_of_bounds_policy::NULLIFY,
+                                                cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                rmm::mr::get_default_resource(),
+                                                stream)
+                             ->release()[0]);
+  return list;
+}
+
+/**
+ * @brief Leaf values and definition levels of a field of a STRUCT column
+ *
+ * Each leaf field of a STRUCT column is written as a column of its own, below a group node for
+ * each struct of its path. The values are null where the field or any struct holding it is null.
+ * The definition levels are only known once the schema tells which nodes of the path are
+ * optional, see `set_struct_definition`.
+ **/
+struct flat_struct_field {
+  std::vector<column_view> path;           //!< Top-level struct, nested structs, then the field
+  std::vector<size_type> positions;        //!< Position of each node of the path in its parent
+  std::unique_ptr<column> values;          //!< Values with the nulls of the structs added
+  rmm::device_vector<uint8_t> def_levels;  //!< Definition level of each row
+};
+
+/**
+ * @brief Adds the definition level of a node of a struct path to the rows defined above it
+ *
+ * A row is defined down to the node if its level counts all the optional nodes above it.
+ **/
+struct struct_definition_level {
+  column_device_view node;
+  uint8_t level;  // Definition level of the nodes above `node`
+
+  __device__ uint8_t operator()(size_type row, uint8_t def_level) const
+  {
+    return (def_level == level && node.is_valid(row)) ? level + 1 : def_level;
+  }
+};
+
+/**
+ * @brief Appends the leaf fields of the struct, or the field, at the end of `path`
+ **/
+void flatten_struct_fields(std::vector<column_view> &path,
+                           std::vector<size_type> &positions,
+                           std::vector<std::unique_ptr<flat_struct_field>> &fields,
+                           cudaStream_t stream)
+{
+  auto const &col = path.back();
+  if (col.type().id() == type_id::STRUCT) {
+    structs_column_view const structs(col);
+    for (size_type i = 0; i < structs.num_children(); ++i) {
+      path.push_back(structs.child(i));
+      positions.push_back(i);
+      flatten_struct_fields(path, positions, fields, stream);
+      path.pop_back();
+      positions.pop_back();
+    }
+    return;
+  }
+  CUDF_EXPECTS(col.type().id() != type_id::LIST, "Lists in structs are not supported");
+
+  auto field       = std::make_unique<flat_struct_field>();
+  field->path      = path;
+  field->positions = positions;
+  // The copy starts at the first row of the field, like the null masks of the path combined
+  field->values = std::make_unique<column>(col, stream);
+  auto nulls    = cudf::detail::bitmask_and_with_null_count(
+    table_view{path}, rmm::mr::get_default_resource(), stream);
+  if (nulls.first.size() != 0) {
+    field->values->set_null_mask(std::move(nulls.first), nulls.second);
+  }
+  fields.push_back(std::move(field));
+}
+
+/**
+ * @brief Flattens a STRUCT column into its leaf fields, in the depth-first order of the schema
+ *
+ * @param col The STRUCT column
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return The leaf fields, or no field if the column is not a STRUCT column
+ **/
+std::vector<std::unique_ptr<flat_struct_field>> flatten_struct_column(column_view const &col,
+                                                                      cudaStream_t stream)
+{
+  std::vector<std::unique_ptr<flat_struct_field>> fields;
+  if (col.type().id() != type_id::STRUCT) { return fields; }
+  std::vector<column_view> path{col};
+  std::vector<size_type> positions;
+  flatten_struct_fields(path, positions, fields, stream);
+  CUDF_EXPECTS(!fields.empty(), "Structs without fields are not supported");
+  return fields;
+}
+
+struct short_row_entries {
+  uint32_t const *row_offsets;
+  uint32_t num_rows;
+
+  __device__ uint32_t operator()(uint32_t row) const
+  {
+    if (row >= num_rows) { return 0; }
+    uint32_t const num_entries = row_offsets[row + 1] - row_offsets[row];
+    return (num_entries > MAX_PAGE_FRAGMENT_SIZE) ? 0 : num_entries;
+  }
+};
+
+/**
+ * @brief Returns the first entry of each row of a list column, then the entry count, leaving out
+ * the entries of the rows that hold more than MAX_PAGE_FRAGMENT_SIZE entries
+ *
+ * @param row_offsets First entry of each row, then the entry count
+ * @param num_rows Number of rows
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+rmm::device_vector<uint32_t> get_short_row_offsets(uint32_t const *row_offsets,
+                                                   uint32_t num_rows,
+                                                   cudaStream_t stream)
+{
+  rmm::device_vector<uint32_t> offsets(num_rows + 1);
+  thrust::transform_exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                                   thrust::make_counting_iterator<uint32_t>(0),
+                                   thrust::make_counting_iterator<uint32_t>(num_rows + 1),
+                                   offsets.begin(),
+                                   short_row_entries{row_offsets, num_rows},
+                                   uint32_t{0},
+                                   thrust::plus<uint32_t>());
+  return offsets;
+}
+
+struct fragment_start {
+  uint32_t const *row_offsets;
+  uint32_t num_rows;
+  uint32_t fragment_size;
+
+  __device__ uint32_t operator()(uint32_t fragment) const
+  {
+    return row_offsets[min(fragment * fragment_size, num_rows)];
+  }
+};
+
+/**
+ * @brief Returns the first entry of each fragment of a list column, then the entry count
+ *
+ * @param row_offsets First entry of each row, then the entry count
+ * @param num_rows Number of rows
+ * @param fragment_size Number of rows per fragment
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::vector<uint32_t> get_fragment_offsets(uint32_t const *row_offsets,
+                                           uint32_t num_rows,
+                                           uint32_t fragment_size,
+                                           cudaStream_t stream)
+{
+  uint32_t const num_fragments = (num_rows + fragment_size - 1) / fragment_size;
+  rmm::device_vector<uint32_t> offsets(num_fragments + 1);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<uint32_t>(0),
+                    thrust::make_counting_iterator<uint32_t>(num_fragments + 1),
+                    offsets.begin(),
+                    fragment_start{row_offsets, num_rows, fragment_size});
+  std::vector<uint32_t> host_offsets(offsets.size());
+  CUDA_TRY(cudaMemcpyAsync(host_offsets.data(),
+                           offsets.data().get(),
+                           offsets.size() * sizeof(uint32_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return host_offsets;
+}
+
 }  // namespace
 
 /**
@@ -100,21 +488,51 @@ class parquet_column_view {
   /**
    * @brief Constructor that extracts out the string position + length pairs
    * for building dictionaries for string columns
+   *
+   * LIST columns are flattened into their leaf values and levels, the leaf values becoming the
+   * data of the column.
    **/
   explicit parquet_column_view(size_t id,
                                column_view const &col,
                                const table_metadata *metadata,
                                cudaStream_t stream)
+    : parquet_column_view(id, col, flatten_list_column(col, stream), nullptr, metadata, stream)
+  {
+  }
+
+  /**
+   * @brief Constructor for a leaf field of the STRUCT column `id`, whose values become the data
+   * of the column
+   **/
+  parquet_column_view(size_t id,
+                      std::unique_ptr<flat_struct_field> &&field,
+                      const table_metadata *metadata,
+                      cudaStream_t stream)
+    : parquet_column_view(id, field->path.front(), nullptr, std::move(field), metadata, stream)
+  {
+  }
+
+ private:
+  parquet_column_view(size_t id,
+                      column_view const &input,
+                      std::unique_ptr<flat_list_column> &&list,
+                      std::unique_ptr<flat_struct_field> &&field,
+                      const table_metadata *metadata,
+                      cudaStream_t stream)
     : _id(id),
-      _string_type(col.type().id() == type_id::STRING),
-      _type_width(_string_type ? 0 : cudf::size_of(col.type())),
+      _list(std::move(list)),
+      _field(std::move(field)),
+      _num_rows(input.size()),
+      _string_type(leaf(input).type().id() == type_id::STRING),
+      _type_width(_string_type ? 0 : cudf::size_of(leaf(input).type())),
       _converted_type(ConvertedType::UNKNOWN),
       _ts_scale(0),
-      _data_count(col.size()),
-      _null_count(col.null_count()),
-      _data(col.head<uint8_t>() + col.offset() * _type_width),
-      _nulls(col.nullable() ? col.null_mask() : nullptr)
+      _data_count(leaf(input).size()),
+      _null_count(leaf(input).null_count()),
+      _data(leaf(input).head<uint8_t>() + leaf(input).offset() * _type_width),
+      _nulls(leaf(input).nullable() ? leaf(input).null_mask() : nullptr)
   {
+    auto const col = leaf(input);
     switch (col.type().id()) {
       case cudf::type_id::INT8:
         _physical_type  = Type::INT32;
@@ -223,6 +641,15 @@ class parquet_column_view {
     }
   }
 
+  /**
+   * @brief Returns the column holding the values to encode
+   **/
+  column_view leaf(column_view const &col) const
+  {
+    return _list ? _list->values->view() : _field ? _field->values->view() : col;
+  }
+
+ public:
   auto is_string() const noexcept { return _string_type; }
   size_t type_width() const noexcept { return _type_width; }
   size_t data_count() const noexcept { return _data_count; }
@@ -237,6 +664,66 @@ class parquet_column_view {
   auto stats_type() const noexcept { return _stats_dtype; }
   int32_t ts_scale() const noexcept { return _ts_scale; }
 
+  // List management
+  auto is_list() const noexcept { return _list != nullptr; }
+  size_t num_rows() const noexcept { return _num_rows; }
+  bool list_nullable() const noexcept { return _list && _list->nullable; }
+  bool element_nullable() const noexcept { return _list && _list->element_nullable; }
+  uint32_t const *row_offsets() const noexcept
+  {
+    return _list ? _list->row_offsets.data().get() : nullptr;
+  }
+  uint8_t const *rep_levels() const noexcept
+  {
+    return _list ? _list->rep_levels.data().get() : nullptr;
+  }
+  uint8_t const *def_levels() const noexcept
+  {
+    return _list ? _list->def_levels.data().get()
+                 : _field ? _field->def_levels.data().get() : nullptr;
+  }
+  /**
+   * @brief Adapts the definition levels of a list column to the repetition of its list and
+   * element nodes in the schema; a required node has no null values to define
+   **/
+  void set_list_definition(bool list_optional, bool element_optional, cudaStream_t stream)
+  {
+    if (!_list || (list_optional && element_optional)) { return; }
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      _list->def_levels.begin(),
+                      _list->def_levels.end(),
+                      _list->def_levels.begin(),
+                      list_definition_level{!list_optional, !element_optional});
+  }
+
+  // Struct management
+  size_t id() const noexcept { return _id; }
+  auto is_struct_field() const noexcept { return _field != nullptr; }
+  std::vector<column_view> const &struct_path() const { return _field->path; }
+  std::vector<size_type> const &struct_positions() const { return _field->positions; }
+  /**
+   * @brief Computes the definition levels of a struct field from the repetition of the nodes of
+   * its path in the schema; only the optional nodes have a definition level
+   **/
+  void set_struct_definition(std::vector<bool> const &optional, cudaStream_t stream)
+  {
+    if (!_field) { return; }
+    auto &def_levels = _field->def_levels;
+    def_levels.assign(_num_rows, 0);
+    auto const rows = thrust::make_counting_iterator<size_type>(0);
+    uint8_t level   = 0;
+    for (size_t k = 0; k < optional.size(); ++k) {
+      if (!optional[k]) { continue; }
+      auto const node = column_device_view::create(_field->path[k], stream);
+      thrust::transform(rmm::exec_policy(stream)->on(stream),
+                        rows,
+                        rows + _num_rows,
+                        def_levels.begin(),
+                        def_levels.begin(),
+                        struct_definition_level{*node, level++});
+    }
+  }
+
   // Dictionary management
   uint32_t *get_dict_data() { return (_dict_data.size()) ? _dict_data.data().get() : nullptr; }
   uint32_t *get_dict_index() { return (_dict_index.size()) ? _dict_index.data().get() : nullptr; }
@@ -259,7 +746,14 @@ class parquet_column_view {
 
  private:
   // Identifier within set of columns
-  size_t _id        = 0;
+  size_t _id = 0;
+
+  // List-related members
+  std::unique_ptr<flat_list_column> _list;
+  // Struct-related members
+  std::unique_ptr<flat_struct_field> _field;
+  size_t _num_rows = 0;
+
   bool _string_type = false;
 
   size_t _type_width     = 0;
@@ -410,14 +904,19 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
                                 const statistics_chunk *chunk_stats,
                                 cudaStream_t stream)
 {
+  metrics_timer encode_timer(metrics_, &io_metrics::encode_ms, stream);
   CUDA_TRY(gpu::EncodePages(
     pages, chunks.device_ptr(), pages_in_batch, first_page_in_batch, comp_in, comp_out, stream));
+  encode_timer.stop();
   switch (compression_) {
-    case parquet::Compression::SNAPPY:
+    case parquet::Compression::SNAPPY: {
+      metrics_timer timer(metrics_, &io_metrics::compression_ms, stream);
       CUDA_TRY(gpu_snap(comp_in, comp_out, pages_in_batch, stream));
       break;
+    }
     default: break;
   }
+  metrics_timer gather_timer(metrics_, &io_metrics::encode_ms, stream);
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
   // chunk-level
   CUDA_TRY(DecideCompression(chunks.device_ptr() + first_rowgroup * num_columns,
@@ -446,14 +945,129 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
   CUDA_TRY(cudaStreamSynchronize(stream));
 }
 
+void writer::impl::build_page_index(gpu::EncColumnChunk const &ck,
+                                    gpu::EncPage const *pages,
+                                    uint8_t const *dev_bfr,
+                                    SchemaElement const &col_schema,
+                                    size_t chunk_offset,
+                                    ColumnIndex &column_index,
+                                    OffsetIndex &offset_index,
+                                    cudaStream_t stream)
+{
+  // Fetch the page headers, which hold the encoded page statistics
+  std::vector<size_t> page_offsets(ck.num_pages);
+  size_t headers_size = 0;
+  for (uint32_t p = 0, offset = 0; p < ck.num_pages; ++p) {
+    page_offsets[p] = offset;
+    offset += pages[p].hdr_size + pages[p].max_data_size;
+    headers_size += pages[p].hdr_size;
+  }
+  std::vector<uint8_t> headers(headers_size);
+  for (uint32_t p = 0, pos = 0; p < ck.num_pages; pos += pages[p++].hdr_size) {
+    CUDA_TRY(cudaMemcpyAsync(headers.data() + pos,
+                             dev_bfr + ck.ck_stat_size + page_offsets[p],
+                             pages[p].hdr_size,
+                             cudaMemcpyDeviceToHost,
+                             stream));
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  column_index = ColumnIndex{};
+  offset_index = OffsetIndex{};
+  for (uint32_t p = 0, pos = 0; p < ck.num_pages; pos += pages[p++].hdr_size) {
+    if (pages[p].page_type != DATA_PAGE) { continue; }
+    PageHeader header;
+    CompactProtocolReader cp(headers.data() + pos, pages[p].hdr_size);
+    CUDF_EXPECTS(cp.read(&header), "Cannot parse encoded page header");
+    auto const &stats = header.data_page_header.statistics;
+    column_index.null_pages.push_back(stats.null_count == header.data_page_header.num_values);
+    column_index.min_values.push_back(stats.min_value);
+    column_index.max_values.push_back(stats.max_value);
+    column_index.null_counts.push_back(std::max<int64_t>(stats.null_count, 0));
+    offset_index.page_locations.push_back(
+      PageLocation{static_cast<int64_t>(chunk_offset + page_offsets[p]),
+                   static_cast<int32_t>(pages[p].hdr_size + pages[p].max_data_size),
+                   static_cast<int64_t>(pages[p].start_row - ck.start_row)});
+  }
+  column_index.boundary_order = get_boundary_order(column_index, col_schema);
+}
+
+void writer::impl::build_bloom_filters(hostdevice_vector<gpu::EncColumnChunk> const &chunks,
+                                       std::vector<bool> const &has_filter,
+                                       uint32_t num_rowgroups,
+                                       uint32_t num_columns,
+                                       std::vector<uint8_t> *bloom_filters,
+                                       cudaStream_t stream)
+{
+  // All the filters are built in one buffer, sized for the number of rows of their chunk
+  std::vector<gpu::BloomFilterChunk> filter_chunks;
+  std::vector<size_t> filter_offsets;
+  std::vector<uint32_t> chunk_ids;
+  size_t total_size = 0;
+  for (uint32_t r = 0; r < num_rowgroups; r++) {
+    for (uint32_t i = 0; i < num_columns; i++) {
+      if (!has_filter[i]) { continue; }
+      auto const &ck        = chunks[r * num_columns + i];
+      auto const size       = bloom_filter_size(ck.num_rows, bloom_filter_fpp_);
+      auto const num_blocks = static_cast<uint32_t>(size / bloom_filter_block_bytes);
+      filter_chunks.push_back({ck.col_desc, ck.start_row, ck.num_rows, nullptr, num_blocks});
+      filter_offsets.push_back(total_size);
+      chunk_ids.push_back(r * num_columns + i);
+      total_size += size;
+    }
+  }
+  if (filter_chunks.empty()) { return; }
+
+  rmm::device_buffer bitsets(total_size, stream);
+  CUDA_TRY(cudaMemsetAsync(bitsets.data(), 0, total_size, stream));
+  for (size_t k = 0; k < filter_chunks.size(); k++) {
+    filter_chunks[k].words =
+      reinterpret_cast<uint32_t *>(static_cast<uint8_t *>(bitsets.data()) + filter_offsets[k]);
+  }
+  rmm::device_vector<gpu::BloomFilterChunk> dev_chunks(filter_chunks.size());
+  CUDA_TRY(cudaMemcpyAsync(dev_chunks.data().get(),
+                           filter_chunks.data(),
+                           filter_chunks.size() * sizeof(gpu::BloomFilterChunk),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  CUDA_TRY(gpu::BuildBloomFilters(dev_chunks.data().get(), filter_chunks.size(), stream));
+  std::vector<uint8_t> host_bitsets(total_size);
+  CUDA_TRY(cudaMemcpyAsync(
+    host_bitsets.data(), bitsets.data(), total_size, cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  for (size_t k = 0; k < filter_chunks.size(); k++) {
+    auto const begin = host_bitsets.begin() + filter_offsets[k];
+    auto const size  = filter_chunks[k].num_blocks * bloom_filter_block_bytes;
+    bloom_filters[chunk_ids[k]].assign(begin, begin + size);
+  }
+}
+
 writer::impl::impl(std::unique_ptr<data_sink> sink,
                    writer_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _mr(mr),
+    target_page_size_(options.max_page_size),
+    max_dict_size_(options.max_dictionary_size),
     compression_(to_parquet_compression(options.compression)),
     stats_granularity_(options.stats_granularity),
-    out_sink_(std::move(sink))
+    delta_encoding_(options.delta_encoding),
+    column_encodings_(options.column_encodings),
+    bloom_filter_columns_(options.bloom_filter_columns),
+    bloom_filter_fpp_(options.bloom_filter_fpp),
+    clustering_(options.clustering),
+    clustering_columns_(options.clustering_columns),
+    out_sink_(std::move(sink)),
+    metrics_(options.metrics)
 {
+  if (metrics_ != nullptr) {
+    auto metered  = std::make_unique<metered_sink>(std::move(out_sink_));
+    metered_sink_ = metered.get();
+    out_sink_     = std::move(metered);
+  }
+  CUDF_EXPECTS(target_page_size_ > 0 && target_page_size_ <= max_rowgroup_size_,
+               "Page size must be positive and at most the row group size");
+  CUDF_EXPECTS(max_dict_size_ > 0 && max_dict_size_ <= max_rowgroup_size_,
+               "Dictionary size limit must be positive and at most the row group size");
 }
 
 std::unique_ptr<std::vector<uint8_t>> writer::impl::write(table_view const &table,
@@ -478,28 +1092,49 @@ void writer::impl::write_chunked_begin(pq_chunked_state &state)
   state.current_chunk_offset = sizeof(file_header_s);
 }
 
-void writer::impl::write_chunked(table_view const &table, pq_chunked_state &state)
+void writer::impl::write_chunked(table_view const &input, pq_chunked_state &state)
 {
-  size_type num_columns = table.num_columns();
-  size_type num_rows    = 0;
+  // The rows are clustered within spans of the row count limit of the row groups, and the
+  // clustered copy is kept until the chunk is written
+  std::unique_ptr<cudf::table> clustered;
+  if (clustering_ != row_clustering::NONE) {
+    clustered = cluster_rows(input,
+                             clustering_columns_,
+                             clustering_,
+                             static_cast<size_type>(max_rowgroup_rows_),
+                             get_scratch_resource(),
+                             state.stream);
+  }
+  table_view const table = clustered ? clustered->view() : input;
+
+  size_type const num_table_columns = table.num_columns();
+  size_type num_rows                = 0;
 
   // Wrapper around cudf columns to attach parquet-specific type info.
   // Note : I wish we could do this in the begin() function but since the
   // metadata is optional we would have no way of knowing how many columns
   // we actually have.
+  // STRUCT columns are written as one column per leaf field.
   std::vector<parquet_column_view> parquet_columns;
-  parquet_columns.reserve(num_columns);  // Avoids unnecessary re-allocation
+  parquet_columns.reserve(num_table_columns);  // Avoids unnecessary re-allocation
   for (auto it = table.begin(); it < table.end(); ++it) {
     const auto col        = *it;
-    const auto current_id = parquet_columns.size();
+    const auto current_id = static_cast<size_t>(it - table.begin());
 
-    num_rows = std::max<uint32_t>(num_rows, col.size());
-    parquet_columns.emplace_back(current_id, col, state.user_metadata, state.stream);
+    num_rows    = std::max<uint32_t>(num_rows, col.size());
+    auto fields = flatten_struct_column(col, state.stream);
+    if (fields.empty()) {
+      parquet_columns.emplace_back(current_id, col, state.user_metadata, state.stream);
+    }
+    for (auto &field : fields) {
+      parquet_columns.emplace_back(current_id, std::move(field), state.user_metadata, state.stream);
+    }
   }
+  size_type const num_columns = parquet_columns.size();
 
   if (state.user_metadata_with_nullability.column_nullable.size() > 0) {
     CUDF_EXPECTS(state.user_metadata_with_nullability.column_nullable.size() ==
-                   static_cast<size_t>(num_columns),
+                   static_cast<size_t>(num_table_columns),
                  "When passing values in user_metadata_with_nullability, data for all columns must "
                  "be specified");
   }
@@ -509,11 +1144,11 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
   if (state.md.version == 0) {
     state.md.version  = 1;
     state.md.num_rows = num_rows;
-    state.md.schema.resize(1 + num_columns);
+    state.md.schema.resize(1);
     state.md.schema[0].type            = UNDEFINED_TYPE;
     state.md.schema[0].repetition_type = NO_REPETITION_TYPE;
     state.md.schema[0].name            = "schema";
-    state.md.schema[0].num_children    = num_columns;
+    state.md.schema[0].num_children    = num_table_columns;
     state.md.column_order_listsize =
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_columns : 0;
     if (state.user_metadata != nullptr) {
@@ -526,8 +1161,14 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     for (auto i = 0; i < num_columns; i++) {
       auto &col = parquet_columns[i];
       // Column metadata
-      state.md.schema[1 + i].type           = col.physical_type();
-      state.md.schema[1 + i].converted_type = col.converted_type();
+      SchemaElement col_schema;
+      col_schema.type           = col.physical_type();
+      col_schema.converted_type = col.converted_type();
+      col_schema.name           = col.name();
+      col_schema.num_children   = 0;  // Leaf node
+      bool const nullable       = col.is_list()           ? col.list_nullable()
+                                  : col.is_struct_field() ? col.struct_path().front().nullable()
+                                                          : col.nullable();
       // because the repetition type is global (in the sense of, not per-rowgroup or per
       // write_chunked() call) we cannot know up front if the user is going to end up passing tables
       // with nulls/no nulls in the multiple write_chunked() case.  so we'll do some special
@@ -536,36 +1177,134 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       // if the user is explicitly saying "I am only calling this once", fall back to the original
       // behavior and assume the columns in this one table tell us everything we need to know.
       if (state.single_write_mode) {
-        state.md.schema[1 + i].repetition_type =
-          (col.nullable() || col.data_count() < (size_t)num_rows) ? OPTIONAL : REQUIRED;
+        col_schema.repetition_type =
+          (nullable || col.num_rows() < (size_t)num_rows) ? OPTIONAL : REQUIRED;
       }
       // otherwise, if the user is explicitly telling us global information about all the tables
       // that will ever get passed in
       else if (state.user_metadata_with_nullability.column_nullable.size() > 0) {
-        state.md.schema[1 + i].repetition_type =
-          state.user_metadata_with_nullability.column_nullable[i] ? OPTIONAL : REQUIRED;
+        col_schema.repetition_type =
+          state.user_metadata_with_nullability.column_nullable[col.id()] ? OPTIONAL : REQUIRED;
       }
       // otherwise assume the worst case.
       else {
-        state.md.schema[1 + i].repetition_type = OPTIONAL;
+        col_schema.repetition_type = OPTIONAL;
+      }
+      if (col.is_list()) {
+        // Three-level list structure: <list-repetition> group <name> (LIST) {
+        //   repeated group list { <element-repetition> <element-type> element; } }
+        SchemaElement list_schema;
+        list_schema.converted_type  = LIST;
+        list_schema.repetition_type = col_schema.repetition_type;
+        list_schema.name            = col.name();
+        list_schema.num_children    = 1;
+        SchemaElement repeated_schema;
+        repeated_schema.repetition_type = REPEATED;
+        repeated_schema.name            = "list";
+        repeated_schema.num_children    = 1;
+        state.md.schema.push_back(list_schema);
+        state.md.schema.push_back(repeated_schema);
+        col_schema.name = "element";
+        col_schema.repetition_type =
+          (col.element_nullable() || !state.single_write_mode) ? OPTIONAL : REQUIRED;
+      }
+      if (col.is_struct_field()) {
+        // Group structure: <struct-repetition> group <name> { <fields> }, with the fields named
+        // after their position in the struct. The group nodes shared with the previous field of
+        // the same column are already written
+        auto const &path      = col.struct_path();
+        auto const &positions = col.struct_positions();
+        size_t depth          = 0;
+        if (i > 0 && parquet_columns[i - 1].is_struct_field() &&
+            parquet_columns[i - 1].id() == col.id()) {
+          auto const &prev = parquet_columns[i - 1].struct_positions();
+          depth            = 1;
+          while (depth < positions.size() && depth <= prev.size() &&
+                 prev[depth - 1] == positions[depth - 1]) {
+            depth++;
+          }
+        }
+        for (; depth + 1 < path.size(); depth++) {
+          SchemaElement struct_schema;
+          struct_schema.name =
+            (depth == 0) ? col.name() : "_field" + std::to_string(positions[depth - 1]);
+          struct_schema.repetition_type =
+            (depth == 0) ? col_schema.repetition_type
+                         : (path[depth].nullable() || !state.single_write_mode) ? OPTIONAL
+                                                                                 : REQUIRED;
+          struct_schema.num_children = path[depth].num_children();
+          state.md.schema.push_back(struct_schema);
+        }
+        col_schema.name = "_field" + std::to_string(positions.back());
+        col_schema.repetition_type =
+          (path.back().nullable() || !state.single_write_mode) ? OPTIONAL : REQUIRED;
       }
-      state.md.schema[1 + i].name         = col.name();
-      state.md.schema[1 + i].num_children = 0;  // Leaf node
+      state.md.schema.push_back(col_schema);
     }
   } else {
     // verify the user isn't passing mismatched tables
-    CUDF_EXPECTS(state.md.schema[0].num_children == num_columns,
+    CUDF_EXPECTS(state.md.schema[0].num_children == num_table_columns,
                  "Mismatch in table structure between multiple calls to write_chunked");
-    for (auto i = 0; i < num_columns; i++) {
-      auto &col = parquet_columns[i];
-      CUDF_EXPECTS(state.md.schema[1 + i].type == col.physical_type(),
-                   "Mismatch in column types between multiple calls to write_chunked");
-    }
 
     // increment num rows
     state.md.num_rows += num_rows;
   }
 
+  // Path of each column in the schema, from its top-level node to its leaf
+  std::vector<std::vector<size_t>> schema_paths;
+  {
+    std::vector<size_t> path;
+    std::vector<int32_t> children_left;
+    for (size_t idx = 1; idx < state.md.schema.size(); idx++) {
+      path.push_back(idx);
+      children_left.push_back(state.md.schema[idx].num_children);
+      if (children_left.back() != 0) { continue; }
+      schema_paths.push_back(path);
+      while (!children_left.empty() && children_left.back() == 0) {
+        path.pop_back();
+        children_left.pop_back();
+        if (!children_left.empty()) { children_left.back()--; }
+      }
+    }
+    CUDF_EXPECTS(path.empty(), "Invalid file schema");
+  }
+  CUDF_EXPECTS(schema_paths.size() == static_cast<size_t>(num_columns),
+               "Mismatch in table structure between multiple calls to write_chunked");
+  std::vector<size_t> top_schema_idx(num_columns);
+  std::vector<size_t> leaf_schema_idx(num_columns);
+  for (auto i = 0; i < num_columns; i++) {
+    auto &col          = parquet_columns[i];
+    top_schema_idx[i]  = schema_paths[i].front();
+    leaf_schema_idx[i] = schema_paths[i].back();
+    bool const is_list = state.md.schema[top_schema_idx[i]].converted_type == LIST;
+    CUDF_EXPECTS(state.md.schema[leaf_schema_idx[i]].type == col.physical_type() &&
+                   is_list == col.is_list() &&
+                   (schema_paths[i].size() > 1 && !is_list) == col.is_struct_field(),
+                 "Mismatch in column types between multiple calls to write_chunked");
+  }
+
+  CUDF_EXPECTS(
+    column_encodings_.empty() || column_encodings_.size() == (size_t)num_table_columns,
+    "Per-column encodings must be specified for all columns");
+  auto const requested_encoding = [&](int i) {
+    return column_encodings_.empty() ? column_encoding::USE_DEFAULT
+                                     : column_encodings_[parquet_columns[i].id()];
+  };
+  CUDF_EXPECTS(
+    bloom_filter_columns_.empty() || bloom_filter_columns_.size() == (size_t)num_table_columns,
+    "Bloom filter flags must be specified for all columns");
+  CUDF_EXPECTS(bloom_filter_fpp_ > 0 && bloom_filter_fpp_ < 1,
+               "Bloom filter false positive probability must be in (0, 1)");
+  // Only the values of flat columns are hashed; booleans and decimals have no filter
+  std::vector<bool> has_bloom_filter(num_columns, false);
+  for (auto i = 0; i < num_columns && !bloom_filter_columns_.empty(); i++) {
+    auto const dtype    = parquet_columns[i].stats_type();
+    has_bloom_filter[i] = bloom_filter_columns_[parquet_columns[i].id()] &&
+                          !parquet_columns[i].is_list() &&
+                          dtype != dtype_none && dtype != dtype_bool &&
+                          dtype != dtype_decimal64 && dtype != dtype_decimal128;
+  }
+
   // Initialize column description
   hostdevice_vector<gpu::EncColumnDesc> col_desc(num_columns);
 
@@ -579,8 +1318,20 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     desc->valid_map_base   = col.nulls();
     desc->stats_dtype      = col.stats_type();
     desc->ts_scale         = col.ts_scale();
-    if (state.md.schema[1 + i].type != BOOLEAN && state.md.schema[1 + i].type != UNDEFINED_TYPE) {
-      col.alloc_dictionary(num_rows);
+    // Delta-encoded and plain-only columns never use a dictionary
+    auto const &col_schema = state.md.schema[leaf_schema_idx[i]];
+    auto const type        = col_schema.type;
+    auto const encoding    = requested_encoding(i);
+    bool const is_integral = (type == INT32 || type == INT64);
+    CUDF_EXPECTS(encoding != column_encoding::DELTA_BINARY_PACKED || is_integral,
+                 "DELTA_BINARY_PACKED encoding requires an INT32 or INT64 column");
+    bool const use_delta =
+      encoding == column_encoding::DELTA_BINARY_PACKED ||
+      (encoding == column_encoding::USE_DEFAULT && delta_encoding_ && is_integral);
+    desc->encoding = use_delta ? DELTA_BINARY_PACKED : PLAIN;
+    if (!use_delta && encoding != column_encoding::PLAIN && type != BOOLEAN &&
+        type != UNDEFINED_TYPE) {
+      col.alloc_dictionary(col.is_list() ? col.data_count() : num_rows);
       desc->dict_index = col.get_dict_index();
       desc->dict_data  = col.get_dict_data();
     } else {
@@ -588,9 +1339,33 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       desc->dict_index = nullptr;
     }
     desc->num_rows       = col.data_count();
-    desc->physical_type  = static_cast<uint8_t>(state.md.schema[1 + i].type);
-    desc->converted_type = static_cast<uint8_t>(state.md.schema[1 + i].converted_type);
-    desc->level_bits     = (state.md.schema[1 + i].repetition_type == OPTIONAL) ? 1 : 0;
+    desc->physical_type  = static_cast<uint8_t>(col_schema.type);
+    desc->converted_type = static_cast<uint8_t>(col_schema.converted_type);
+    desc->level_bits     = (col_schema.repetition_type == OPTIONAL) ? 1 : 0;
+    desc->row_offsets    = col.row_offsets();
+    desc->rep_levels     = col.rep_levels();
+    desc->def_levels     = col.def_levels();
+    if (col.is_list()) {
+      // Lists have a repetition level of 1 and definition levels of up to 3 (null list, empty
+      // list, null element, element) encoded with 2 bits
+      bool const list_optional    = state.md.schema[top_schema_idx[i]].repetition_type == OPTIONAL;
+      bool const element_optional = col_schema.repetition_type == OPTIONAL;
+      col.set_list_definition(list_optional, element_optional, state.stream);
+      desc->level_bits = (1 << 4) | ((list_optional + 1 + element_optional > 1) ? 2 : 1);
+    }
+    if (col.is_struct_field()) {
+      // Struct fields have a definition level for each optional node of their path
+      std::vector<bool> optional;
+      for (auto const idx : schema_paths[i]) {
+        optional.push_back(state.md.schema[idx].repetition_type == OPTIONAL);
+      }
+      col.set_struct_definition(optional, state.stream);
+      auto const max_def_level = std::count(optional.begin(), optional.end(), true);
+      uint8_t def_level_bits   = 0;
+      while ((1 << def_level_bits) <= max_def_level) { def_level_bits++; }
+      desc->level_bits = def_level_bits;
+      desc->def_levels = col.def_levels();
+    }
   }
 
   // Init page fragments
@@ -599,7 +1374,38 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
   // iteratively reduce this value if the largest fragment exceeds the max page size limit (we
   // ideally want the page size to be below 1MB so as to have enough pages to get good
   // compression/decompression performance).
+  //
+  // Fragments hold at most 5000 values, so that list columns may require fewer rows per fragment.
+  // Lists of more than 5000 elements cannot fit into any fragment, so they are not counted: their
+  // fragments are not dictionary-encoded, whatever the fragment size.
   uint32_t fragment_size = 5000;
+  std::vector<rmm::device_vector<uint32_t>> short_row_offsets(num_columns);
+  for (auto i = 0; i < num_columns; i++) {
+    if (parquet_columns[i].is_list()) {
+      short_row_offsets[i] =
+        get_short_row_offsets(parquet_columns[i].row_offsets(), num_rows, state.stream);
+    }
+  }
+  for (bool fits = false; !fits;) {
+    fits = true;
+    for (auto i = 0; i < num_columns && fits; i++) {
+      if (!parquet_columns[i].is_list()) { continue; }
+      auto const offsets = get_fragment_offsets(
+        short_row_offsets[i].data().get(), num_rows, fragment_size, state.stream);
+      for (size_t f = 0; f + 1 < offsets.size() && fits; f++) {
+        fits = (offsets[f + 1] - offsets[f] <= MAX_PAGE_FRAGMENT_SIZE);
+      }
+    }
+    if (!fits) { fragment_size = (fragment_size + 1) / 2; }
+  }
+  std::vector<rmm::device_vector<uint32_t>>().swap(short_row_offsets);
+  std::vector<std::vector<uint32_t>> fragment_offsets(num_columns);
+  for (auto i = 0; i < num_columns; i++) {
+    if (parquet_columns[i].is_list()) {
+      fragment_offsets[i] = get_fragment_offsets(
+        parquet_columns[i].row_offsets(), num_rows, fragment_size, state.stream);
+    }
+  }
   uint32_t num_fragments = (uint32_t)((num_rows + fragment_size - 1) / fragment_size);
   hostdevice_vector<gpu::PageFragment> fragments(num_columns * num_fragments);
   if (fragments.size() != 0) {
@@ -675,40 +1481,62 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
         (frag_stats.size() != 0) ? frag_stats.data().get() + i * num_fragments + f : nullptr;
       ck->start_row      = start_row;
       ck->num_rows       = (uint32_t)state.md.row_groups[global_r].num_rows;
+      if (parquet_columns[i].is_list()) {
+        // The chunks of list columns hold all the values of their rows
+        ck->start_row = fragment_offsets[i][f];
+        ck->num_rows  = fragment_offsets[i][f + fragments_in_chunk] - ck->start_row;
+      }
       ck->first_fragment = i * num_fragments + f;
       ck->first_page     = 0;
       ck->num_pages      = 0;
       ck->is_compressed  = 0;
       ck->dictionary_id  = num_dictionaries;
       ck->ck_stat_size   = 0;
+      ck->max_page_size  = (uint32_t)target_page_size_;
+      ck->max_dict_size  = (uint32_t)max_dict_size_;
       if (col_desc[i].dict_data) {
+        // Only the fragments that fit into the dictionary are dictionary-encoded, the rest of the
+        // chunk falls back to plain encoding: compare both encodings over those fragments only
         const gpu::PageFragment *ck_frag = &fragments[i * num_fragments + f];
         size_t plain_size                = 0;
         size_t dict_size                 = 1;
+        size_t dict_data_size            = 0;
         uint32_t num_dict_vals           = 0;
+        uint32_t num_dict_fragments      = 0;
         for (uint32_t j = 0; j < fragments_in_chunk && num_dict_vals < 65536; j++) {
+          if (ck_frag[j].num_rows > MAX_PAGE_FRAGMENT_SIZE) { break; }
+          if (dict_data_size != 0 && dict_data_size + ck_frag[j].dict_data_size > max_dict_size_) {
+            break;
+          }
           plain_size += ck_frag[j].fragment_data_size;
           dict_size +=
             ck_frag[j].dict_data_size + ((num_dict_vals > 256) ? 2 : 1) * ck_frag[j].non_nulls;
+          dict_data_size += ck_frag[j].dict_data_size;
           num_dict_vals += ck_frag[j].num_dict_vals;
+          num_dict_fragments++;
         }
-        if (dict_size < plain_size) {
+        if (num_dict_fragments != 0 &&
+            (dict_size < plain_size || requested_encoding(i) == column_encoding::DICTIONARY)) {
           parquet_columns[i].use_dictionary(true);
           dict_enable = true;
           num_dictionaries++;
         }
       }
-      ck->has_dictionary                                           = dict_enable;
-      state.md.row_groups[global_r].columns[i].meta_data.type      = state.md.schema[1 + i].type;
-      state.md.row_groups[global_r].columns[i].meta_data.encodings = {PLAIN, RLE};
+      ck->has_dictionary = dict_enable;
+      state.md.row_groups[global_r].columns[i].meta_data.type =
+        state.md.schema[leaf_schema_idx[i]].type;
+      state.md.row_groups[global_r].columns[i].meta_data.encodings = {
+        static_cast<Encoding>(col_desc[i].encoding), RLE};
       if (dict_enable) {
         state.md.row_groups[global_r].columns[i].meta_data.encodings.push_back(PLAIN_DICTIONARY);
       }
-      state.md.row_groups[global_r].columns[i].meta_data.path_in_schema = {
-        state.md.schema[1 + i].name};
-      state.md.row_groups[global_r].columns[i].meta_data.codec = UNCOMPRESSED;
-      state.md.row_groups[global_r].columns[i].meta_data.num_values =
-        state.md.row_groups[global_r].num_rows;
+      auto &path_in_schema = state.md.row_groups[global_r].columns[i].meta_data.path_in_schema;
+      path_in_schema.clear();
+      for (auto const idx : schema_paths[i]) {
+        path_in_schema.push_back(state.md.schema[idx].name);
+      }
+      state.md.row_groups[global_r].columns[i].meta_data.codec      = UNCOMPRESSED;
+      state.md.row_groups[global_r].columns[i].meta_data.num_values = ck->num_rows;
     }
     f += fragments_in_chunk;
     start_row += (uint32_t)state.md.row_groups[global_r].num_rows;
@@ -717,6 +1545,18 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
   // Free unused dictionaries
   for (auto &col : parquet_columns) { col.check_dictionary_used(); }
 
+  // Bloom filters of the chunks, written after all the row groups
+  if (std::find(has_bloom_filter.begin(), has_bloom_filter.end(), true) !=
+      has_bloom_filter.end()) {
+    state.bloom_filters.resize(state.md.row_groups.size() * num_columns);
+    build_bloom_filters(chunks,
+                        has_bloom_filter,
+                        num_rowgroups,
+                        num_columns,
+                        state.bloom_filters.data() + global_rowgroup_base * num_columns,
+                        state.stream);
+  }
+
   // Build chunk dictionaries and count pages
   if (num_chunks != 0) {
     build_chunk_dictionaries(
@@ -771,6 +1611,10 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_pages + num_chunks : 0;
   rmm::device_buffer uncomp_bfr(max_uncomp_bfr_size, state.stream);
   rmm::device_buffer comp_bfr(max_comp_bfr_size, state.stream);
+  if (metrics_ != nullptr) {
+    metrics_->peak_scratch_bytes =
+      std::max(metrics_->peak_scratch_bytes, max_uncomp_bfr_size + max_comp_bfr_size);
+  }
   rmm::device_vector<gpu_inflate_input_s> comp_in(max_comp_pages);
   rmm::device_vector<gpu_inflate_status_s> comp_out(max_comp_pages);
   rmm::device_vector<gpu::EncPage> pages(num_pages);
@@ -816,6 +1660,13 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     }
   }();
 
+  // Page-level statistics are also written as the page index of each chunk
+  bool const write_page_index = (stats_granularity_ == statistics_freq::STATISTICS_PAGE);
+  if (write_page_index) {
+    state.column_indexes.resize(state.md.row_groups.size() * num_columns);
+    state.offset_indexes.resize(state.md.row_groups.size() * num_columns);
+  }
+
   // Encode row groups in batches
   for (uint32_t b = 0, r = 0, global_r = global_rowgroup_base; b < (uint32_t)batch_list.size();
        b++) {
@@ -839,6 +1690,17 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data().get() + num_pages
                                                                : nullptr,
       state.stream);
+    // The page index is built from the encoded page headers
+    std::vector<gpu::EncPage> batch_pages;
+    if (write_page_index) {
+      batch_pages.resize(pages_in_batch);
+      CUDA_TRY(cudaMemcpyAsync(batch_pages.data(),
+                               pages.data().get() + first_page_in_batch,
+                               pages_in_batch * sizeof(gpu::EncPage),
+                               cudaMemcpyDeviceToHost,
+                               state.stream));
+      CUDA_TRY(cudaStreamSynchronize(state.stream));
+    }
     for (; r < rnext; r++, global_r++) {
       for (auto i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
@@ -867,12 +1729,13 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
           }
         } else {
           // copy the full data
+          metrics_timer timer(metrics_, &io_metrics::d2h_copy_ms, state.stream);
           CUDA_TRY(cudaMemcpyAsync(host_bfr.get(),
                                    dev_bfr,
                                    ck->ck_stat_size + ck->compressed_size,
                                    cudaMemcpyDeviceToHost,
                                    state.stream));
-          CUDA_TRY(cudaStreamSynchronize(state.stream));
+          timer.stop();
           out_sink_->host_write(host_bfr.get() + ck->ck_stat_size, ck->compressed_size);
           if (ck->ck_stat_size != 0) {
             state.md.row_groups[global_r].columns[i].meta_data.statistics_blob.resize(
@@ -882,6 +1745,12 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
                    ck->ck_stat_size);
           }
         }
+        if (metrics_ != nullptr && compression_ == parquet::Compression::SNAPPY) {
+          auto &codec = metrics_->codecs[gpu_codec_name(gpu_codec::SNAPPY)];
+          codec.num_blocks += ck->num_pages;
+          codec.compressed_bytes += ck->compressed_size;
+          codec.uncompressed_bytes += ck->bfr_size;
+        }
         state.md.row_groups[global_r].total_byte_size += ck->compressed_size;
         state.md.row_groups[global_r].columns[i].meta_data.data_page_offset =
           state.current_chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
@@ -890,6 +1759,17 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
         state.md.row_groups[global_r].columns[i].meta_data.total_uncompressed_size = ck->bfr_size;
         state.md.row_groups[global_r].columns[i].meta_data.total_compressed_size =
           ck->compressed_size;
+        // The pages of list columns do not start at row boundaries: no page index is written
+        if (write_page_index && !parquet_columns[i].is_list()) {
+          build_page_index(*ck,
+                           batch_pages.data() + (ck->first_page - first_page_in_batch),
+                           dev_bfr,
+                           state.md.schema[leaf_schema_idx[i]],
+                           state.current_chunk_offset,
+                           state.column_indexes[global_r * num_columns + i],
+                           state.offset_indexes[global_r * num_columns + i],
+                           state.stream);
+        }
         state.current_chunk_offset += ck->compressed_size;
       }
     }
@@ -901,12 +1781,64 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::write_chunked_end(
 {
   CompactProtocolWriter cpw(&buffer_);
   file_ender_s fendr;
+
+  // The bloom filters follow the row groups, each as a header followed by the bitset
+  if (!state.bloom_filters.empty()) {
+    auto const num_columns = state.md.row_groups.front().columns.size();
+    for (size_t r = 0; r < state.md.row_groups.size(); ++r) {
+      for (size_t i = 0; i < num_columns && r * num_columns + i < state.bloom_filters.size();
+           ++i) {
+        auto const &bitset = state.bloom_filters[r * num_columns + i];
+        if (bitset.empty()) { continue; }
+        auto &meta_data = state.md.row_groups[r].columns[i].meta_data;
+        BloomFilterHeader header;
+        header.num_bytes = static_cast<int32_t>(bitset.size());
+        buffer_.resize(0);
+        auto const header_size        = cpw.write(&header);
+        meta_data.bloom_filter_offset = state.current_chunk_offset;
+        meta_data.bloom_filter_length = static_cast<int32_t>(header_size + bitset.size());
+        out_sink_->host_write(buffer_.data(), buffer_.size());
+        out_sink_->host_write(bitset.data(), bitset.size());
+        state.current_chunk_offset += header_size + bitset.size();
+      }
+    }
+  }
+
+  // The page indexes follow the row groups: all the column indexes, then all the offset indexes.
+  // Chunks without an index (list columns) keep null index lengths
+  if (!state.column_indexes.empty()) {
+    auto const num_columns = state.md.row_groups.front().columns.size();
+    for (size_t r = 0; r < state.md.row_groups.size(); ++r) {
+      for (size_t i = 0; i < num_columns; ++i) {
+        auto &chunk = state.md.row_groups[r].columns[i];
+        if (state.offset_indexes[r * num_columns + i].page_locations.empty()) { continue; }
+        buffer_.resize(0);
+        chunk.column_index_offset = state.current_chunk_offset;
+        chunk.column_index_length = cpw.write(&state.column_indexes[r * num_columns + i]);
+        out_sink_->host_write(buffer_.data(), buffer_.size());
+        state.current_chunk_offset += buffer_.size();
+      }
+    }
+    for (size_t r = 0; r < state.md.row_groups.size(); ++r) {
+      for (size_t i = 0; i < num_columns; ++i) {
+        auto &chunk = state.md.row_groups[r].columns[i];
+        if (state.offset_indexes[r * num_columns + i].page_locations.empty()) { continue; }
+        buffer_.resize(0);
+        chunk.offset_index_offset = state.current_chunk_offset;
+        chunk.offset_index_length = cpw.write(&state.offset_indexes[r * num_columns + i]);
+        out_sink_->host_write(buffer_.data(), buffer_.size());
+        state.current_chunk_offset += buffer_.size();
+      }
+    }
+  }
+
   buffer_.resize(0);
   fendr.footer_len = static_cast<uint32_t>(cpw.write(&state.md));
   fendr.magic      = PARQUET_MAGIC;
   out_sink_->host_write(buffer_.data(), buffer_.size());
   out_sink_->host_write(&fendr, sizeof(fendr));
   out_sink_->flush();
+  if (metered_sink_ != nullptr) { metered_sink_->take_metrics(*metrics_); }
 
   // Optionally output raw file metadata with the specified column chunk file path
   if (return_filemetadata) {
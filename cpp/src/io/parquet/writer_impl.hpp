@@ -26,6 +26,7 @@
 
 #include <cudf/io/data_sink.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/io_metrics.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/writers.hpp>
@@ -58,6 +59,8 @@ class writer::impl {
 
   // rowgroups are divided into pages
   static constexpr uint32_t DEFAULT_TARGET_PAGE_SIZE = 512 * 1024;
+  // chunks switch from dictionary to plain encoding once the dictionary reaches this size
+  static constexpr uint32_t DEFAULT_MAX_DICT_SIZE = 512 * 1024;
 
  public:
   /**
@@ -221,6 +224,42 @@ class writer::impl {
                     const statistics_chunk* page_stats,
                     const statistics_chunk* chunk_stats,
                     cudaStream_t stream);
+  /**
+   * @brief Builds the bloom filters of column chunks and copies them to the host
+   *
+   * @param chunks column chunk array
+   * @param has_filter whether each column gets a bloom filter
+   * @param num_rowgroups total number of rowgroups
+   * @param num_columns total number of columns
+   * @param bloom_filters output bitset of each chunk [rowgroup][column] (empty if none)
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void build_bloom_filters(hostdevice_vector<gpu::EncColumnChunk> const& chunks,
+                           std::vector<bool> const& has_filter,
+                           uint32_t num_rowgroups,
+                           uint32_t num_columns,
+                           std::vector<uint8_t>* bloom_filters,
+                           cudaStream_t stream);
+  /**
+   * @brief Builds the page index of an encoded column chunk from its page headers
+   *
+   * @param ck encoded column chunk
+   * @param pages host copy of the chunk's encoder pages
+   * @param dev_bfr device buffer holding the chunk's statistics and pages
+   * @param col_schema schema element of the column
+   * @param chunk_offset file offset of the chunk's first page
+   * @param column_index output min/max values of each data page
+   * @param offset_index output location of each data page
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   **/
+  void build_page_index(gpu::EncColumnChunk const& ck,
+                        gpu::EncPage const* pages,
+                        uint8_t const* dev_bfr,
+                        SchemaElement const& col_schema,
+                        size_t chunk_offset,
+                        ColumnIndex& column_index,
+                        OffsetIndex& offset_index,
+                        cudaStream_t stream);
 
  private:
   // TODO : figure out if we want to keep this. It is currently unused.
@@ -229,11 +268,22 @@ class writer::impl {
   size_t max_rowgroup_size_          = DEFAULT_ROWGROUP_MAXSIZE;
   size_t max_rowgroup_rows_          = DEFAULT_ROWGROUP_MAXROWS;
   size_t target_page_size_           = DEFAULT_TARGET_PAGE_SIZE;
+  size_t max_dict_size_              = DEFAULT_MAX_DICT_SIZE;
   Compression compression_           = Compression::UNCOMPRESSED;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
+  bool delta_encoding_               = false;
+  std::vector<column_encoding> column_encodings_;
+  std::vector<bool> bloom_filter_columns_;
+  double bloom_filter_fpp_    = 0.01;
+  row_clustering clustering_ = row_clustering::NONE;
+  std::vector<size_type> clustering_columns_;
 
   std::vector<uint8_t> buffer_;
   std::unique_ptr<data_sink> out_sink_;
+
+  // Metrics of the writes and the wrapper of the sink counting them, if requested
+  io_metrics* metrics_        = nullptr;
+  metered_sink* metered_sink_ = nullptr;
 };
 
 }  // namespace parquet
@@ -17,6 +17,11 @@
 #include <io/utilities/block_utils.cuh>
 #include "column_stats.h"
 
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/strings/string_view.cuh>
+
+#include <cub/cub.cuh>
+
 namespace cudf {
 namespace io {
 /**
@@ -355,12 +360,6 @@ void __device__ gatherFloatColumnStats(stats_state_s *s, statistics_dtype dtype,
   }
 }
 
-// FIXME: Use native libcudf string type
-struct nvstrdesc_s {
-  const char *ptr;
-  size_t count;
-};
-
 /**
  * @brief Gather statistics for string columns
  *
@@ -755,6 +754,98 @@ __global__ void __launch_bounds__(1024, 1)
   }
 }
 
+/**
+ * @brief Returns the 64-bit hash of a non-null value of a column
+ *
+ * Integer-like values are hashed as 64-bit integers and floating-point values as doubles, so that
+ * equal values hash equally whatever their storage type.
+ **/
+__device__ uint64_t hash_statistics_value(stats_column_desc const &col, uint32_t row)
+{
+  auto const data = col.column_data_base;
+  switch (col.stats_dtype) {
+    case dtype_bool:
+    case dtype_int8: return XXHash_64<int64_t>{}.compute(static_cast<int8_t const *>(data)[row]);
+    case dtype_int16: return XXHash_64<int64_t>{}.compute(static_cast<int16_t const *>(data)[row]);
+    case dtype_int32:
+    case dtype_date32: return XXHash_64<int64_t>{}.compute(static_cast<int32_t const *>(data)[row]);
+    case dtype_int64:
+    case dtype_timestamp64:
+    case dtype_decimal64:
+      return XXHash_64<int64_t>{}.compute(static_cast<int64_t const *>(data)[row]);
+    case dtype_float32: return XXHash_64<double>{}.compute(static_cast<float const *>(data)[row]);
+    case dtype_float64: return XXHash_64<double>{}.compute(static_cast<double const *>(data)[row]);
+    case dtype_string: {
+      auto const &str = static_cast<nvstrdesc_s const *>(data)[row];
+      return XXHash_64<string_view>{}(string_view(str.ptr, static_cast<size_type>(str.count)));
+    }
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Builds the HyperLogLog sketch of the non-null values of each group; one block per group
+ *
+ * The top `distinct_count_sketch_bits` bits of the hash of a value select a register, which keeps
+ * the maximum position of the first set bit among the remaining bits.
+ **/
+__global__ void __launch_bounds__(1024)
+  gpuGatherDistinctCountSketches(uint8_t *sketches, const statistics_group *groups)
+{
+  __shared__ uint32_t registers[distinct_count_sketch_size];
+  auto const &group = groups[blockIdx.x];
+  auto const &col   = *group.col;
+  for (uint32_t i = threadIdx.x; i < distinct_count_sketch_size; i += blockDim.x) {
+    registers[i] = 0;
+  }
+  __syncthreads();
+  for (uint32_t i = threadIdx.x; i < group.num_rows; i += blockDim.x) {
+    uint32_t row = group.start_row + i;
+    if (row >= col.num_rows) { break; }
+    const uint32_t *valid_map = col.valid_map_base;
+    if (valid_map && !((valid_map[row >> 5] >> (row & 0x1f)) & 1)) { continue; }
+    auto const hash = hash_statistics_value(col, row);
+    // The sentinel bit bounds the rank to the number of remaining bits plus one
+    auto const rest =
+      (hash << distinct_count_sketch_bits) | (1ull << (distinct_count_sketch_bits - 1));
+    atomicMax(&registers[hash >> (64 - distinct_count_sketch_bits)], __clzll(rest) + 1);
+  }
+  __syncthreads();
+  for (uint32_t i = threadIdx.x; i < distinct_count_sketch_size; i += blockDim.x) {
+    sketches[blockIdx.x * distinct_count_sketch_size + i] = static_cast<uint8_t>(registers[i]);
+  }
+}
+
+/**
+ * @brief Merges the sketches of each group of chunks and estimates their number of distinct
+ * values; one block per group, one thread per register
+ **/
+__global__ void __launch_bounds__(distinct_count_sketch_size)
+  gpuMergeDistinctCountSketches(uint64_t *counts,
+                                const uint8_t *sketches,
+                                const statistics_merge_group *groups)
+{
+  using block_reduce = cub::BlockReduce<double, distinct_count_sketch_size>;
+  __shared__ typename block_reduce::TempStorage temp_storage;
+  auto const &group = groups[blockIdx.x];
+  uint32_t t        = threadIdx.x;
+  uint32_t reg      = 0;
+  for (uint32_t i = 0; i < group.num_chunks; i++) {
+    reg = max(reg, sketches[(group.start_chunk + i) * distinct_count_sketch_size + t]);
+  }
+  double const inv_sum = block_reduce(temp_storage).Sum(ldexp(1.0, -static_cast<int>(reg)));
+  __syncthreads();
+  double const num_zeros = block_reduce(temp_storage).Sum(reg == 0 ? 1.0 : 0.0);
+  if (t == 0) {
+    // Estimate of Flajolet et al., with linear counting for small cardinalities
+    double const m     = distinct_count_sketch_size;
+    double const alpha = 0.7213 / (1.0 + 1.079 / m);
+    double estimate    = alpha * m * m / inv_sum;
+    if (estimate <= 2.5 * m && num_zeros > 0) { estimate = m * log(m / num_zeros); }
+    counts[blockIdx.x] = static_cast<uint64_t>(llround(estimate));
+  }
+}
+
 /**
  * @brief Launches kernel to gather column statistics
  *
@@ -795,5 +886,31 @@ cudaError_t MergeColumnStatistics(statistics_chunk *chunks_out,
   return cudaSuccess;
 }
 
+/**
+ * @copydoc cudf::io::GatherDistinctCountSketches
+ **/
+cudaError_t GatherDistinctCountSketches(uint8_t *sketches,
+                                        const statistics_group *groups,
+                                        uint32_t num_chunks,
+                                        cudaStream_t stream)
+{
+  gpuGatherDistinctCountSketches<<<num_chunks, 1024, 0, stream>>>(sketches, groups);
+  return cudaSuccess;
+}
+
+/**
+ * @copydoc cudf::io::MergeDistinctCountSketches
+ **/
+cudaError_t MergeDistinctCountSketches(uint64_t *counts,
+                                       const uint8_t *sketches,
+                                       const statistics_merge_group *groups,
+                                       uint32_t num_groups,
+                                       cudaStream_t stream)
+{
+  gpuMergeDistinctCountSketches<<<num_groups, distinct_count_sketch_size, 0, stream>>>(
+    counts, sketches, groups);
+  return cudaSuccess;
+}
+
 }  // namespace io
 }  // namespace cudf
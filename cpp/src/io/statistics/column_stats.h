@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #pragma once
+#include <stddef.h>
 #include <stdint.h>
 
 namespace cudf {
@@ -42,6 +43,12 @@ struct stats_column_desc {
   int32_t ts_scale;  //!< timestamp scale (>0: multiply by scale, <0: divide by -scale)
 };
 
+// FIXME: Use native libcudf string type
+struct nvstrdesc_s {
+  const char *ptr;  //!< ptr to character data, null for null strings
+  size_t count;     //!< length of string in bytes
+};
+
 struct string_stats {
   const char *ptr;  //!< ptr to character data
   uint32_t length;  //!< length of string
@@ -114,5 +121,42 @@ cudaError_t MergeColumnStatistics(statistics_chunk *chunks_out,
                                   uint32_t num_chunks,
                                   cudaStream_t stream = (cudaStream_t)0);
 
+/// Number of hash bits selecting the register of a distinct count sketch
+constexpr uint32_t distinct_count_sketch_bits = 10;
+/// Number of 1-byte registers of a distinct count sketch (relative error of about 3%)
+constexpr uint32_t distinct_count_sketch_size = 1 << distinct_count_sketch_bits;
+
+/**
+ * @brief Launches kernel to build the HyperLogLog sketches of the distinct values of row groups
+ *
+ * @param[out] sketches Sketches [num_chunks * distinct_count_sketch_size]
+ * @param[in] groups Statistics row groups [num_chunks]
+ * @param[in] num_chunks Number of chunks & rowgroups
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t GatherDistinctCountSketches(uint8_t *sketches,
+                                        const statistics_group *groups,
+                                        uint32_t num_chunks,
+                                        cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Launches kernel to merge sketches and estimate the number of distinct values of groups
+ *
+ * @param[out] counts Approximate number of distinct non-null values [num_groups]
+ * @param[in] sketches Sketches of the chunks from `GatherDistinctCountSketches`
+ * @param[in] groups Groups of chunks [num_groups]
+ * @param[in] num_groups Number of groups
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t MergeDistinctCountSketches(uint64_t *counts,
+                                       const uint8_t *sketches,
+                                       const statistics_merge_group *groups,
+                                       uint32_t num_groups,
+                                       cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "column_stats.h"
+
+#include <io/utilities/hostdevice_vector.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/describe.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <rmm/device_buffer.hpp>
+
+#include <cstring>
+
+namespace cudf {
+namespace detail {
+namespace {
+using io::statistics_chunk;
+using io::statistics_dtype;
+
+/**
+ * @brief Returns the statistics type of a column type
+ */
+statistics_dtype to_statistics_dtype(data_type type)
+{
+  switch (type.id()) {
+    case type_id::BOOL8: return io::dtype_bool;
+    case type_id::INT8: return io::dtype_int8;
+    case type_id::INT16: return io::dtype_int16;
+    case type_id::INT32:
+    case type_id::DURATION_DAYS: return io::dtype_int32;
+    case type_id::TIMESTAMP_DAYS: return io::dtype_date32;
+    case type_id::INT64:
+    case type_id::TIMESTAMP_SECONDS:
+    case type_id::TIMESTAMP_MILLISECONDS:
+    case type_id::TIMESTAMP_MICROSECONDS:
+    case type_id::TIMESTAMP_NANOSECONDS:
+    case type_id::DURATION_SECONDS:
+    case type_id::DURATION_MILLISECONDS:
+    case type_id::DURATION_MICROSECONDS:
+    case type_id::DURATION_NANOSECONDS: return io::dtype_int64;
+    case type_id::FLOAT32: return io::dtype_float32;
+    case type_id::FLOAT64: return io::dtype_float64;
+    case type_id::STRING: return io::dtype_string;
+    default: CUDF_FAIL("Unsupported column type for describe");
+  }
+}
+
+/**
+ * @brief Converts the rows of a strings column into the string descriptors of the statistics
+ * kernels; null rows get a null pointer
+ */
+__global__ void strings_to_nvstrdesc(io::nvstrdesc_s *dst,
+                                     size_type const *offsets,
+                                     char const *chars,
+                                     bitmask_type const *nulls,
+                                     size_type size)
+{
+  size_type row = blockIdx.x * blockDim.x + threadIdx.x;
+  if (row < size) {
+    bool const is_valid = (nulls == nullptr) || bit_is_set(nulls, row);
+    dst[row].ptr        = is_valid ? chars + offsets[row] : nullptr;
+    dst[row].count      = is_valid ? offsets[row + 1] - offsets[row] : 0;
+  }
+}
+
+/**
+ * @brief Returns a column of host values, with the rows whose `valid` flag is false set to null
+ *
+ * @param type Type of the column
+ * @param values Values of the rows, `size_of(type)` bytes each
+ * @param valid Validity of each row
+ */
+std::unique_ptr<column> make_host_column(data_type type,
+                                         std::vector<uint8_t> const &values,
+                                         std::vector<bool> const &valid,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource *mr)
+{
+  auto const size = static_cast<size_type>(valid.size());
+  std::vector<bitmask_type> mask(num_bitmask_words(size), 0);
+  size_type null_count = 0;
+  for (size_type i = 0; i < size; ++i) {
+    if (valid[i]) {
+      mask[word_index(i)] |= bitmask_type{1} << intra_word_index(i);
+    } else {
+      ++null_count;
+    }
+  }
+  rmm::device_buffer data(values.data(), values.size(), stream, mr);
+  rmm::device_buffer null_mask = (null_count > 0) ? rmm::device_buffer(mask.data(),
+                                                                       mask.size() *
+                                                                         sizeof(bitmask_type),
+                                                                       stream,
+                                                                       mr)
+                                                  : rmm::device_buffer{0, stream, mr};
+  return std::make_unique<column>(type, size, std::move(data), std::move(null_mask), null_count);
+}
+
+/**
+ * @brief Returns the minimum or maximum value of each chunk as a column of the input type
+ */
+std::unique_ptr<column> make_minmax_column(data_type type,
+                                           statistics_chunk const *stats,
+                                           size_type num_chunks,
+                                           bool is_min,
+                                           cudaStream_t stream,
+                                           rmm::mr::device_memory_resource *mr)
+{
+  if (type.id() == type_id::STRING) {
+    // Null pointers make null strings
+    std::vector<thrust::pair<const char *, size_type>> strings(num_chunks, {nullptr, 0});
+    for (size_type i = 0; i < num_chunks; ++i) {
+      auto const &val = is_min ? stats[i].min_value : stats[i].max_value;
+      if (stats[i].has_minmax) {
+        strings[i] = {val.str_val.ptr, static_cast<size_type>(val.str_val.length)};
+      }
+    }
+    rmm::device_vector<thrust::pair<const char *, size_type>> d_strings(strings);
+    return make_strings_column(d_strings, stream, mr);
+  }
+
+  // Integer values are truncated to the width of the type, floats are narrowed
+  auto const width = size_of(type);
+  std::vector<uint8_t> values(num_chunks * width);
+  std::vector<bool> valid(num_chunks);
+  for (size_type i = 0; i < num_chunks; ++i) {
+    auto const &val = is_min ? stats[i].min_value : stats[i].max_value;
+    auto dst        = values.data() + i * width;
+    valid[i]        = stats[i].has_minmax;
+    if (type.id() == type_id::FLOAT32) {
+      auto const f = static_cast<float>(val.fp_val);
+      std::memcpy(dst, &f, sizeof(f));
+    } else if (type.id() == type_id::FLOAT64) {
+      std::memcpy(dst, &val.fp_val, sizeof(double));
+    } else {
+      std::memcpy(dst, &val.i_val, width);
+    }
+  }
+  return make_host_column(type, values, valid, stream, mr);
+}
+
+/**
+ * @brief Returns the statistics of the chunks of a column
+ *
+ * @param type Type of the column
+ * @param stats Statistics of the chunks [num_chunks]
+ * @param distinct_counts Approximate distinct counts of the chunks [num_chunks]
+ * @param num_chunks Number of chunks
+ */
+segment_statistics make_segment_statistics(data_type type,
+                                           statistics_chunk const *stats,
+                                           uint64_t const *distinct_counts,
+                                           size_type num_chunks,
+                                           cudaStream_t stream,
+                                           rmm::mr::device_memory_resource *mr)
+{
+  bool const is_float = type.id() == type_id::FLOAT32 || type.id() == type_id::FLOAT64;
+  std::vector<uint8_t> null_counts(num_chunks * sizeof(size_type));
+  std::vector<uint8_t> sums(num_chunks * sizeof(int64_t));
+  std::vector<uint8_t> counts(num_chunks * sizeof(int64_t));
+  std::vector<bool> all_valid(num_chunks, true);
+  std::vector<bool> has_sum(num_chunks);
+  for (size_type i = 0; i < num_chunks; ++i) {
+    auto const null_count = static_cast<size_type>(stats[i].null_count);
+    auto const count      = static_cast<int64_t>(distinct_counts[i]);
+    std::memcpy(null_counts.data() + i * sizeof(size_type), &null_count, sizeof(size_type));
+    std::memcpy(counts.data() + i * sizeof(int64_t), &count, sizeof(int64_t));
+    // The sum union holds a double for floats and an integer otherwise
+    std::memcpy(sums.data() + i * sizeof(int64_t), &stats[i].sum, sizeof(int64_t));
+    has_sum[i] = stats[i].has_sum;
+  }
+
+  auto const int32_type = data_type{type_id::INT32};
+  auto const int64_type = data_type{type_id::INT64};
+  auto const sum_type   = is_float ? data_type{type_id::FLOAT64} : int64_type;
+  segment_statistics result;
+  result.min            = make_minmax_column(type, stats, num_chunks, true, stream, mr);
+  result.max            = make_minmax_column(type, stats, num_chunks, false, stream, mr);
+  result.null_count     = make_host_column(int32_type, null_counts, all_valid, stream, mr);
+  result.sum            = make_host_column(sum_type, sums, has_sum, stream, mr);
+  result.distinct_count = make_host_column(int64_type, counts, all_valid, stream, mr);
+  return result;
+}
+
+}  // namespace
+
+std::vector<column_description> describe(table_view const &input,
+                                         size_type segment_size,
+                                         rmm::mr::device_memory_resource *mr,
+                                         cudaStream_t stream)
+{
+  CUDF_EXPECTS(segment_size > 0, "Segment size must be positive");
+  auto const num_columns  = static_cast<size_t>(input.num_columns());
+  auto const num_rows     = input.num_rows();
+  auto const num_segments = (num_rows + segment_size - 1) / segment_size;
+  // Empty columns have no segments, but their totals are computed from an empty chunk
+  auto const num_chunks = std::max(num_segments, 1);
+  if (num_columns == 0) { return {}; }
+
+  // Describe the columns to the statistics kernels; their null masks and strings are converted
+  // to the layout of the kernels (bit 0 of the mask being the first row)
+  hostdevice_vector<io::stats_column_desc> col_desc(num_columns, stream);
+  std::vector<rmm::device_buffer> aligned_masks;
+  std::vector<rmm::device_buffer> string_descs;
+  for (size_t i = 0; i < num_columns; ++i) {
+    auto const col = input.column(i);
+    auto &desc            = col_desc[i];
+    desc.stats_dtype      = to_statistics_dtype(col.type());
+    desc.num_rows         = col.size();
+    desc.ts_scale         = 0;
+    desc.valid_map_base   = nullptr;
+    desc.column_data_base = nullptr;
+    if (col.nullable()) {
+      if (col.offset() == 0) {
+        desc.valid_map_base = col.null_mask();
+      } else {
+        aligned_masks.push_back(copy_bitmask(col, stream));
+        desc.valid_map_base = static_cast<uint32_t const *>(aligned_masks.back().data());
+      }
+    }
+    if (col.type().id() == type_id::STRING) {
+      if (col.size() > 0) {
+        strings_column_view const view(col);
+        string_descs.emplace_back(col.size() * sizeof(io::nvstrdesc_s), stream);
+        strings_to_nvstrdesc<<<(col.size() + 255) / 256, 256, 0, stream>>>(
+          static_cast<io::nvstrdesc_s *>(string_descs.back().data()),
+          view.offsets().data<size_type>() + view.offset(),
+          view.chars().data<char>(),
+          desc.valid_map_base,
+          col.size());
+        desc.column_data_base = string_descs.back().data();
+      }
+    } else {
+      desc.column_data_base =
+        static_cast<uint8_t const *>(col.head()) + col.offset() * size_of(col.type());
+    }
+  }
+
+  // One chunk per segment of each column, in column-major order
+  hostdevice_vector<io::statistics_group> groups(num_columns * num_chunks, stream);
+  for (size_t i = 0; i < num_columns; ++i) {
+    for (size_type s = 0; s < num_chunks; ++s) {
+      auto &group     = groups[i * num_chunks + s];
+      group.col       = col_desc.device_ptr(i);
+      group.start_row = s * segment_size;
+      group.num_rows  = std::min(segment_size, num_rows - s * segment_size);
+    }
+  }
+
+  // Merge groups: the whole columns for the statistics, then each chunk and each column for the
+  // distinct counts, which are only estimated once the sketches are merged
+  auto const num_count_groups = num_columns * num_chunks + num_columns;
+  hostdevice_vector<io::statistics_merge_group> merge_groups(num_count_groups, stream);
+  for (size_t i = 0; i < num_columns * num_chunks; ++i) {
+    merge_groups[i].col         = groups[i].col;
+    merge_groups[i].start_chunk = i;
+    merge_groups[i].num_chunks  = 1;
+  }
+  for (size_t i = 0; i < num_columns; ++i) {
+    auto &group       = merge_groups[num_columns * num_chunks + i];
+    group.col         = col_desc.device_ptr(i);
+    group.start_chunk = i * num_chunks;
+    group.num_chunks  = num_chunks;
+  }
+
+  hostdevice_vector<statistics_chunk> chunks(num_columns * num_chunks, stream);
+  hostdevice_vector<statistics_chunk> totals(num_columns, stream);
+  hostdevice_vector<uint64_t> distinct_counts(num_count_groups, stream);
+  rmm::device_buffer sketches(num_columns * num_chunks * io::distinct_count_sketch_size, stream);
+
+  CUDA_TRY(cudaMemcpyAsync(col_desc.device_ptr(),
+                           col_desc.host_ptr(),
+                           col_desc.memory_size(),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    groups.device_ptr(), groups.host_ptr(), groups.memory_size(), cudaMemcpyHostToDevice, stream));
+  CUDA_TRY(cudaMemcpyAsync(merge_groups.device_ptr(),
+                           merge_groups.host_ptr(),
+                           merge_groups.memory_size(),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  CUDA_TRY(io::GatherColumnStatistics(
+    chunks.device_ptr(), groups.device_ptr(), groups.size(), stream));
+  CUDA_TRY(io::MergeColumnStatistics(totals.device_ptr(),
+                                     chunks.device_ptr(),
+                                     merge_groups.device_ptr(num_columns * num_chunks),
+                                     num_columns,
+                                     stream));
+  CUDA_TRY(io::GatherDistinctCountSketches(
+    static_cast<uint8_t *>(sketches.data()), groups.device_ptr(), groups.size(), stream));
+  CUDA_TRY(io::MergeDistinctCountSketches(distinct_counts.device_ptr(),
+                                          static_cast<uint8_t const *>(sketches.data()),
+                                          merge_groups.device_ptr(),
+                                          num_count_groups,
+                                          stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    chunks.host_ptr(), chunks.device_ptr(), chunks.memory_size(), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaMemcpyAsync(
+    totals.host_ptr(), totals.device_ptr(), totals.memory_size(), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaMemcpyAsync(distinct_counts.host_ptr(),
+                           distinct_counts.device_ptr(),
+                           distinct_counts.memory_size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  std::vector<column_description> result(num_columns);
+  for (size_t i = 0; i < num_columns; ++i) {
+    auto const type    = input.column(i).type();
+    auto const total_idx = num_chunks * num_columns + i;
+    result[i].segments   = make_segment_statistics(type,
+                                                   chunks.host_ptr(i * num_chunks),
+                                                   distinct_counts.host_ptr(i * num_chunks),
+                                                   num_segments,
+                                                   stream,
+                                                   mr);
+    result[i].total      = make_segment_statistics(
+      type, totals.host_ptr(i), distinct_counts.host_ptr(total_idx), 1, stream, mr);
+  }
+  // The minimum and maximum strings are gathered from the input by the stream
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return result;
+}
+
+}  // namespace detail
+
+std::vector<column_description> describe(table_view const &input,
+                                         size_type segment_size,
+                                         rmm::mr::device_memory_resource *mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::describe(input, segment_size, mr, 0);
+}
+
+}  // namespace cudf
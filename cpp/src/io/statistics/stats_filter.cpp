@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stats_filter.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <cmath>
+
+namespace cudf {
+namespace io {
+namespace {
+template <typename T>
+int three_way_compare(T const &lhs, T const &rhs)
+{
+  return (lhs < rhs) ? -1 : (rhs < lhs) ? 1 : 0;
+}
+
+/**
+ * @brief Compares the min (`use_max == false`) or max value of a range against the literal
+ *
+ * @return Negative, zero or positive if the range value is less than, equal to or greater than
+ * the literal
+ */
+int compare_to_literal(column_value_range const &range, bool use_max, stats_filter const &filter)
+{
+  using kind         = column_value_range::value_kind;
+  using literal_kind = stats_filter::literal_kind;
+  auto const lit     = filter.get_literal_kind();
+  switch (range.kind) {
+    case kind::SIGNED: {
+      auto const v = use_max ? range.i_max : range.i_min;
+      CUDF_EXPECTS(lit != literal_kind::STRING, "Cannot compare a numeric column to a string");
+      return (lit == literal_kind::INTEGER)
+               ? three_way_compare(v, filter.int_value())
+               : three_way_compare(static_cast<double>(v), filter.float_value());
+    }
+    case kind::UNSIGNED: {
+      auto const v = use_max ? range.u_max : range.u_min;
+      CUDF_EXPECTS(lit != literal_kind::STRING, "Cannot compare a numeric column to a string");
+      if (lit == literal_kind::FLOAT) {
+        return three_way_compare(static_cast<double>(v), filter.float_value());
+      }
+      if (filter.int_value() < 0) { return 1; }
+      return three_way_compare(v, static_cast<uint64_t>(filter.int_value()));
+    }
+    case kind::FLOAT: {
+      auto const v = use_max ? range.f_max : range.f_min;
+      CUDF_EXPECTS(lit != literal_kind::STRING, "Cannot compare a numeric column to a string");
+      return three_way_compare(v,
+                               (lit == literal_kind::INTEGER)
+                                 ? static_cast<double>(filter.int_value())
+                                 : filter.float_value());
+    }
+    case kind::STRING: {
+      CUDF_EXPECTS(lit == literal_kind::STRING, "Cannot compare a string column to a number");
+      auto const &v = use_max ? range.s_max : range.s_min;
+      return v.compare(filter.string_value());
+    }
+    default: CUDF_FAIL("Unexpected value range kind");
+  }
+}
+
+bool comparison_may_match(stats_filter const &filter, column_value_range const &range)
+{
+  using kind = column_value_range::value_kind;
+  if (range.all_nulls) { return false; }  // null never compares true
+  if (filter.op() == filter_op::EQUAL && range.may_contain && !range.may_contain(filter)) {
+    return false;
+  }
+  if (range.kind == kind::NONE) { return true; }
+  if (range.kind == kind::FLOAT && (std::isnan(range.f_min) || std::isnan(range.f_max))) {
+    return true;
+  }
+
+  auto const cmp_min = [&]() { return compare_to_literal(range, false, filter); };
+  auto const cmp_max = [&]() { return compare_to_literal(range, true, filter); };
+  switch (filter.op()) {
+    case filter_op::EQUAL: return cmp_min() <= 0 && cmp_max() >= 0;
+    case filter_op::NOT_EQUAL: return !(cmp_min() == 0 && cmp_max() == 0);
+    case filter_op::LESS: return cmp_min() < 0;
+    case filter_op::LESS_EQUAL: return cmp_min() <= 0;
+    case filter_op::GREATER: return cmp_max() > 0;
+    case filter_op::GREATER_EQUAL: return cmp_max() >= 0;
+    default: CUDF_FAIL("Unsupported filter operator");
+  }
+}
+
+}  // namespace
+
+bool stats_filter_may_match(stats_filter const &filter, column_range_lookup const &lookup)
+{
+  switch (filter.kind()) {
+    case stats_filter::node_kind::NONE: return true;
+    case stats_filter::node_kind::COMPARE:
+      return comparison_may_match(filter, lookup(filter.column()));
+    case stats_filter::node_kind::AND:
+      return stats_filter_may_match(filter.left(), lookup) &&
+             stats_filter_may_match(filter.right(), lookup);
+    case stats_filter::node_kind::OR:
+      return stats_filter_may_match(filter.left(), lookup) ||
+             stats_filter_may_match(filter.right(), lookup);
+    default: CUDF_FAIL("Unexpected filter node");
+  }
+}
+
+column_statistics to_column_statistics(std::string const &name,
+                                       column_value_range const &range,
+                                       int64_t num_values,
+                                       int64_t null_count)
+{
+  // Both enums list the same orderings in the same order
+  column_statistics stats;
+  stats.name       = name;
+  stats.kind       = static_cast<column_statistics::value_kind>(range.kind);
+  stats.num_values = num_values;
+  stats.null_count = null_count;
+  stats.i_min      = range.i_min;
+  stats.i_max      = range.i_max;
+  stats.u_min      = range.u_min;
+  stats.u_max      = range.u_max;
+  stats.f_min      = range.f_min;
+  stats.f_max      = range.f_max;
+  stats.s_min      = range.s_min;
+  stats.s_max      = range.s_max;
+  return stats;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace cudf {
+namespace io {
+/**
+ * @brief Host-side summary of the values of one column within a block of rows
+ *
+ * Filled in by a format-specific reader from the decoded file statistics and consumed by
+ * `stats_filter_may_match()`.
+ */
+struct column_value_range {
+  /**
+   * @brief Ordering used to compare the min/max values
+   */
+  enum class value_kind : int8_t {
+    NONE,      ///< No usable min/max; the block cannot be excluded by value
+    SIGNED,    ///< Signed integer ordering (`i_min`/`i_max`)
+    UNSIGNED,  ///< Unsigned integer ordering (`u_min`/`u_max`)
+    FLOAT,     ///< Floating-point ordering (`f_min`/`f_max`)
+    STRING,    ///< Unsigned lexicographic byte ordering (`s_min`/`s_max`)
+  };
+
+  value_kind kind = value_kind::NONE;
+  bool all_nulls  = false;  ///< Every value of the block is null
+  int64_t i_min   = 0;
+  int64_t i_max   = 0;
+  uint64_t u_min  = 0;
+  uint64_t u_max  = 0;
+  double f_min    = 0;
+  double f_max    = 0;
+  std::string s_min;
+  std::string s_max;
+  /// Optional membership test of an equality literal, such as a bloom filter lookup; returns
+  /// `false` if no value of the block equals the literal
+  std::function<bool(stats_filter const &)> may_contain;
+};
+
+/**
+ * @brief Callback returning the value range of the named column for the block being tested
+ */
+using column_range_lookup = std::function<column_value_range(std::string const &)>;
+
+/**
+ * @brief Evaluates a filter against the statistics of a block of rows
+ *
+ * @param filter Filter expression to evaluate
+ * @param lookup Callback returning the value range of a column within the block
+ *
+ * @return `false` if no row of the block can satisfy the filter, `true` otherwise
+ *
+ * @throw cudf::logic_error if a literal type cannot be compared against the column values
+ */
+bool stats_filter_may_match(stats_filter const &filter, column_range_lookup const &lookup);
+
+/**
+ * @brief Converts the value range of a column into its public statistics
+ *
+ * @param name Name of the column
+ * @param range Value range decoded from the file
+ * @param num_values Number of values of the block, including nulls; -1 if unknown
+ * @param null_count Number of nulls of the block; -1 if unknown
+ */
+column_statistics to_column_statistics(std::string const &name,
+                                       column_value_range const &range,
+                                       int64_t num_values,
+                                       int64_t null_count);
+
+}  // namespace io
+}  // namespace cudf
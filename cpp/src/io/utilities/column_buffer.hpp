@@ -22,6 +22,7 @@
 #pragma once
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/scratch_memory.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -64,15 +65,29 @@ inline rmm::device_buffer create_data(
 struct column_buffer {
   using str_pair = thrust::pair<const char*, size_type>;
 
+  /**
+   * @brief Creates the buffers of a column
+   *
+   * Strings are held as (pointer, size) pairs gathered by `make_column()`, unless
+   * `string_offsets` is true; then the data is the zero-initialized offsets of the strings,
+   * holding their sizes until readers scan them, and readers write the characters in `_chars`.
+   * The pairs are temporaries, allocated from the scratch resource rather than from `mr`.
+   * Struct columns only hold a null mask.
+   */
   column_buffer(data_type type,
                 size_type size,
                 bool is_nullable                    = true,
                 cudaStream_t stream                 = 0,
-                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+                bool string_offsets                 = false)
+    : _strings(cudf::detail::scratch_allocator<str_pair>(stream))
   {
-    if (type.id() == type_id::STRING) {
+    if (type.id() == type_id::STRING && string_offsets) {
+      _data           = create_data(data_type{type_id::INT32}, size + 1, stream, mr);
+      _string_offsets = true;
+    } else if (type.id() == type_id::STRING) {
       _strings.resize(size);
-    } else {
+    } else if (type.id() != type_id::STRUCT) {
       _data = create_data(type, size, stream, mr);
     }
     if (is_nullable) { _null_mask = create_null_mask(size, mask_state::ALL_NULL, stream, mr); }
@@ -95,6 +110,8 @@ struct column_buffer {
   rmm::device_buffer _data{};
   rmm::device_buffer _null_mask{};
   size_type _null_count{0};
+  rmm::device_buffer _chars{};  ///< characters of the strings, with `_string_offsets`
+  bool _string_offsets{false};
 };
 
 namespace {
@@ -118,7 +135,20 @@ std::unique_ptr<column> make_column(
   cudaStream_t stream                 = 0,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource())
 {
-  if (type.id() == type_id::STRING) {
+  if (type.id() == type_id::STRING && buffer._string_offsets) {
+    auto offsets = std::make_unique<column>(
+      data_type{type_id::INT32}, size + 1, std::move(buffer._data), rmm::device_buffer{}, 0);
+    auto const num_chars = static_cast<size_type>(buffer._chars.size());
+    auto chars           = std::make_unique<column>(
+      data_type{type_id::INT8}, num_chars, std::move(buffer._chars), rmm::device_buffer{}, 0);
+    return make_strings_column(size,
+                               std::move(offsets),
+                               std::move(chars),
+                               buffer._null_count,
+                               std::move(buffer._null_mask),
+                               stream,
+                               mr);
+  } else if (type.id() == type_id::STRING) {
     return make_strings_column(buffer._strings, stream, mr);
   } else {
     return std::make_unique<column>(
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifdef CUFILE_FOUND
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cufile.h>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Process-wide state of the cuFile (GPUDirect Storage) driver
+ *
+ * The driver is opened on first use and closed at process exit. If the driver cannot be opened
+ * (e.g. no GDS support on this system), file sources and sinks fall back to host memory I/O.
+ */
+class cufile_driver {
+  bool _is_open = false;
+
+  cufile_driver() : _is_open(cuFileDriverOpen().err == CU_FILE_SUCCESS) {}
+
+ public:
+  ~cufile_driver()
+  {
+    if (_is_open) { cuFileDriverClose(); }
+  }
+
+  static bool is_available()
+  {
+    static cufile_driver driver;
+    return driver._is_open;
+  }
+};
+
+/**
+ * @brief cuFile handle of a file opened for direct I/O
+ *
+ * The handle is not registered if the driver is unavailable or the file cannot be opened with
+ * `O_DIRECT`; the user of the handle then falls back to host memory I/O.
+ */
+class cufile_handle {
+ public:
+  /**
+   * @brief Opens a file and registers it with the cuFile driver
+   *
+   * @param filepath Path of the file
+   * @param flags Flags to open the file with, besides `O_DIRECT`
+   */
+  cufile_handle(const char *filepath, int flags)
+  {
+    if (!cufile_driver::is_available()) { return; }
+    _fd = open(filepath, flags | O_DIRECT);
+    if (_fd == -1) { return; }
+    CUfileDescr_t descr{};
+    descr.handle.fd       = _fd;
+    descr.type            = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+    _is_handle_registered = cuFileHandleRegister(&_handle, &descr).err == CU_FILE_SUCCESS;
+  }
+
+  ~cufile_handle()
+  {
+    if (_is_handle_registered) { cuFileHandleDeregister(_handle); }
+    if (_fd != -1) { close(_fd); }
+  }
+
+  cufile_handle(cufile_handle const &) = delete;
+  cufile_handle &operator=(cufile_handle const &) = delete;
+
+  bool is_registered() const { return _is_handle_registered; }
+
+  CUfileHandle_t get() const { return _handle; }
+
+ private:
+  int _fd                    = -1;
+  CUfileHandle_t _handle     = nullptr;
+  bool _is_handle_registered = false;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
+
+#endif
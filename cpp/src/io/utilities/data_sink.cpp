@@ -14,16 +14,30 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <array>
 #include <fstream>
+#include <future>
 
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
+#include "cufile_driver.hpp"
 
 namespace cudf {
 namespace io {
+namespace {
+// Size of each pinned buffer staging the device data written to files
+constexpr size_t file_staging_size = 8 * 1024 * 1024;
+
+}  // namespace
+
 /**
  * @brief Implementation class for storing data into a local file.
  *
+ * Device data is written with GPUDirect Storage when available. Otherwise it is copied into one
+ * of two pinned staging buffers and written to the file by a background thread, so that the
+ * writer encodes and copies the next data while the previous data is written. Only one file write
+ * is in flight at a time, which keeps the writes in order.
  */
 class file_sink : public data_sink {
  public:
@@ -31,21 +45,100 @@ class file_sink : public data_sink {
   {
     outfile_.open(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
     CUDF_EXPECTS(outfile_.is_open(), "Cannot open output file");
+#ifdef CUFILE_FOUND
+    cufile_out_ = std::make_unique<detail::cufile_handle>(filepath.c_str(), O_WRONLY);
+#endif
   }
 
-  virtual ~file_sink() { flush(); }
+  virtual ~file_sink()
+  {
+    // Errors cannot be thrown from the destructor; flush() reports them when called explicitly
+    if (pending_write_.valid()) { pending_write_.wait(); }
+    outfile_.flush();
+    for (auto bfr : staging_) {
+      if (bfr != nullptr) { cudaFreeHost(bfr); }
+    }
+  }
 
   void host_write(void const* data, size_t size) override
   {
-    outfile_.write(reinterpret_cast<char const*>(data), size);
+    wait_for_pending_write();
+    write_to_file(data, size);
+    bytes_written_ += size;
+  }
+
+  bool supports_device_write() const override { return true; }
+
+  void device_write(void const* gpu_data, size_t size, cudaStream_t stream) override
+  {
+#ifdef CUFILE_FOUND
+    if (cufile_out_ != nullptr && cufile_out_->is_registered()) {
+      // The buffered host writes are flushed so that the device data lands after them
+      wait_for_pending_write();
+      outfile_.flush();
+      auto const result = cuFileWrite(cufile_out_->get(), gpu_data, size, bytes_written_, 0);
+      if (result >= 0 && static_cast<size_t>(result) == size) {
+        bytes_written_ += size;
+        outfile_.seekp(bytes_written_);
+        return;
+      }
+      // Direct writes can be refused (e.g. by the file system); the data is then staged through
+      // host memory, overwriting any partial direct write
+      cufile_out_.reset();
+    }
+#endif
+    auto src = static_cast<uint8_t const*>(gpu_data);
+    while (size != 0) {
+      // The buffer was last written by the write before the pending one, which has completed
+      auto& bfr = staging_[next_staging_];
+      if (bfr == nullptr) { CUDA_TRY(cudaMallocHost(&bfr, file_staging_size)); }
+      auto const len = std::min(size, file_staging_size);
+      CUDA_TRY(cudaMemcpyAsync(bfr, src, len, cudaMemcpyDeviceToHost, stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+
+      wait_for_pending_write();
+      pending_write_ =
+        std::async(std::launch::async, [this, data = bfr, len]() { write_to_file(data, len); });
+      bytes_written_ += len;
+      next_staging_ = (next_staging_ + 1) % staging_.size();
+      src += len;
+      size -= len;
+    }
   }
 
-  void flush() override { outfile_.flush(); }
+  void flush() override
+  {
+    wait_for_pending_write();
+    outfile_.flush();
+  }
 
-  size_t bytes_written() override { return outfile_.tellp(); }
+  size_t bytes_written() override { return bytes_written_; }
 
  private:
+  void write_to_file(void const* data, size_t size)
+  {
+    outfile_.write(reinterpret_cast<char const*>(data), size);
+    CUDF_EXPECTS(outfile_.good(), "Cannot write to output file");
+  }
+
+  /**
+   * @brief Waits for the background write, if any, and reports its errors
+   */
+  void wait_for_pending_write()
+  {
+    if (pending_write_.valid()) { pending_write_.get(); }
+  }
+
   std::ofstream outfile_;
+  size_t bytes_written_ = 0;  // Including the pending write
+
+  std::array<uint8_t*, 2> staging_{};
+  size_t next_staging_ = 0;
+  std::future<void> pending_write_;
+
+#ifdef CUFILE_FOUND
+  std::unique_ptr<detail::cufile_handle> cufile_out_;
+#endif
 };
 
 /**
@@ -22,9 +22,32 @@
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
+#include "cufile_driver.hpp"
+#include "parallel_for.hpp"
+#include "remote_source.hpp"
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstring>
 
 namespace cudf {
 namespace io {
+namespace {
+/**
+ * @brief Buffer returned from `device_read()`, holding the data in device memory
+ */
+class device_data_buffer : public datasource::buffer {
+  rmm::device_buffer _data;
+
+ public:
+  explicit device_data_buffer(rmm::device_buffer &&data) : _data(std::move(data)) {}
+  size_t size() const override { return _data.size(); }
+  const uint8_t *data() const override { return static_cast<const uint8_t *>(_data.data()); }
+};
+
+}  // namespace
+
 /**
  * @brief Implementation class for reading from an Apache Arrow file. The file
  * could be a memory-mapped file or other implementation supported by Arrow.
@@ -169,6 +192,122 @@ class memory_mapped_source : public datasource {
   size_t map_offset_ = 0;
 };
 
+#ifdef CUFILE_FOUND
+/**
+ * @brief Implementation class for reading from a file using GPUDirect Storage
+ *
+ * Host reads (e.g. of the file metadata) go through the memory mapping of the base class, while
+ * `device_read()` reads the file straight into device memory without a host bounce buffer.
+ */
+class cufile_source : public memory_mapped_source {
+ public:
+  explicit cufile_source(const char *filepath, size_t offset, size_t size)
+    : memory_mapped_source(filepath, offset, size), _handle(filepath, O_RDONLY)
+  {
+  }
+
+  bool supports_device_read() const override { return _handle.is_registered(); }
+
+  std::unique_ptr<buffer> device_read(size_t offset, size_t size) override
+  {
+    rmm::device_buffer out_data(size);
+    out_data.resize(device_read(offset, size, static_cast<uint8_t *>(out_data.data())));
+    return std::make_unique<device_data_buffer>(std::move(out_data));
+  }
+
+  size_t device_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    CUDF_EXPECTS(offset <= this->size(), "Requested offset is past end of file");
+    auto const read_size = std::min(size, this->size() - offset);
+    auto const result    = cuFileRead(_handle.get(), dst, read_size, offset, 0);
+    CUDF_EXPECTS(result >= 0, "cuFile read failed");
+    return result;
+  }
+
+ private:
+  detail::cufile_handle const _handle;
+};
+#endif
+
+/**
+ * @brief Implementation class for reading from a page-locked host memory buffer
+ *
+ * `device_read()` copies the data to the device with a single DMA transfer, without the pinned
+ * staging copy that pageable memory requires. A `REGISTERED` buffer is page-locked with
+ * `cudaHostRegister()` until the source is destroyed.
+ */
+class pinned_host_source : public datasource {
+ public:
+  explicit pinned_host_source(host_buffer const &buffer)
+    : _data(reinterpret_cast<const uint8_t *>(buffer.data)),
+      _size(buffer.size),
+      _is_pinned(buffer.memory == host_memory_kind::PINNED)
+  {
+    if (buffer.memory == host_memory_kind::REGISTERED && _size != 0) {
+      auto const result =
+        cudaHostRegister(const_cast<char *>(buffer.data), _size, cudaHostRegisterDefault);
+      // Memory that is already registered is page-locked as well; memory that cannot be
+      // registered is read as pageable memory
+      _is_registered = result == cudaSuccess;
+      _is_pinned     = _is_registered || result == cudaErrorHostMemoryAlreadyRegistered;
+      if (!_is_registered) { cudaGetLastError(); }
+    }
+  }
+
+  ~pinned_host_source() override
+  {
+    if (_is_registered) { cudaHostUnregister(const_cast<uint8_t *>(_data)); }
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto const read_size = clamped_size(offset, size);
+    return std::make_unique<non_owning_buffer>(const_cast<uint8_t *>(_data) + offset, read_size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    auto const read_size = clamped_size(offset, size);
+    std::memcpy(dst, _data + offset, read_size);
+    return read_size;
+  }
+
+  bool supports_device_read() const override { return _is_pinned; }
+
+  std::unique_ptr<buffer> device_read(size_t offset, size_t size) override
+  {
+    rmm::device_buffer out_data(clamped_size(offset, size));
+    device_read(offset, out_data.size(), static_cast<uint8_t *>(out_data.data()));
+    return std::make_unique<device_data_buffer>(std::move(out_data));
+  }
+
+  size_t device_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    CUDF_EXPECTS(_is_pinned, "Device reads require page-locked memory");
+    auto const read_size = clamped_size(offset, size);
+    // Like the other direct reads, the copy is complete when this returns
+    if (read_size != 0) {
+      CUDA_TRY(cudaMemcpyAsync(dst, _data + offset, read_size, cudaMemcpyHostToDevice, 0));
+      CUDA_TRY(cudaStreamSynchronize(0));
+    }
+    return read_size;
+  }
+
+  size_t size() const override { return _size; }
+
+ private:
+  size_t clamped_size(size_t offset, size_t size) const
+  {
+    CUDF_EXPECTS(offset <= _size, "Requested offset is past end of buffer");
+    return std::min(size, _size - offset);
+  }
+
+  const uint8_t *const _data;
+  size_t const _size;
+  bool _is_pinned     = false;
+  bool _is_registered = false;
+};
+
 /**
  * @brief Wrapper class for user implemented data sources
  *
@@ -202,6 +341,11 @@ class user_datasource_wrapper : public datasource {
     return source->device_read(offset, size);
   }
 
+  void prefetch(std::vector<std::pair<size_t, size_t>> const &ranges) override
+  {
+    source->prefetch(ranges);
+  }
+
   size_t size() const override { return source->size(); }
 
  private:
@@ -212,12 +356,30 @@ std::unique_ptr<datasource> datasource::create(const std::string &filepath,
                                                size_t offset,
                                                size_t size)
 {
+#ifdef CUFILE_FOUND
+  // Read column data straight into device memory when GPUDirect Storage is available
+  if (detail::cufile_driver::is_available()) {
+    return std::make_unique<cufile_source>(filepath.c_str(), offset, size);
+  }
+#endif
   // Use our own memory mapping implementation for direct file reads
   return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
 }
 
+std::vector<std::unique_ptr<datasource>> datasource::create(
+  std::vector<std::string> const &filepaths)
+{
+  // Opening and mapping many small files is dominated by system call latency
+  std::vector<std::unique_ptr<datasource>> sources(filepaths.size());
+  detail::parallel_for(filepaths.size(), [&](size_t i) { sources[i] = create(filepaths[i]); });
+  return sources;
+}
+
 std::unique_ptr<datasource> datasource::create(host_buffer const &buffer)
 {
+  if (buffer.memory != host_memory_kind::PAGEABLE) {
+    return std::make_unique<pinned_host_source>(buffer);
+  }
   // Use Arrow IO buffer class for zero-copy reads of host memory
   return std::make_unique<arrow_io_source>(std::make_shared<arrow::io::BufferReader>(
     reinterpret_cast<const uint8_t *>(buffer.data), buffer.size));
@@ -227,7 +389,14 @@ std::unique_ptr<datasource> datasource::create(
   std::shared_ptr<arrow::io::RandomAccessFile> arrow_file)
 {
   // Support derived classes of the top-level Arrow IO interface
-  return std::make_unique<arrow_io_source>(arrow_file);
+  auto source = std::make_unique<arrow_io_source>(arrow_file);
+  // Other implementations (S3, HDFS, ...) pay a round trip per read; coalesce and overlap them
+  if (std::dynamic_pointer_cast<arrow::io::ReadableFile>(arrow_file) != nullptr ||
+      std::dynamic_pointer_cast<arrow::io::MemoryMappedFile>(arrow_file) != nullptr ||
+      std::dynamic_pointer_cast<arrow::io::BufferReader>(arrow_file) != nullptr) {
+    return source;
+  }
+  return std::make_unique<detail::remote_source>(std::move(source));
 }
 
 std::unique_ptr<datasource> datasource::create(datasource *source)
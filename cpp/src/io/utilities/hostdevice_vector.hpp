@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <io/utilities/pinned_memory_pool.hpp>
+
 #include <rmm/device_buffer.hpp>
 
 #include <cudf/utilities/error.hpp>
@@ -27,7 +29,9 @@
  * This abstraction allocates a specified fixed chunk of device memory that can
  * initialized upfront, or gradually initialized as required.
  * The host-side memory can be used to manipulate data on the CPU before and
- * after operating on the same data on the GPU.
+ * after operating on the same data on the GPU. It is allocated from the
+ * process-wide `pinned_memory_pool`, so that the vectors built by each read or
+ * write do not call `cudaMallocHost`.
  **/
 template <typename T>
 class hostdevice_vector {
@@ -43,17 +47,12 @@ class hostdevice_vector {
     : num_elements(initial_size), max_elements(max_size)
   {
     if (max_elements != 0) {
-      CUDA_TRY(cudaMallocHost(&h_data, sizeof(T) * max_elements));
+      h_buffer = cudf::io::detail::pinned_buffer(sizeof(T) * max_elements);
+      h_data   = static_cast<T *>(h_buffer.data());
       d_data.resize(sizeof(T) * max_elements, stream);
     }
   }
 
-  ~hostdevice_vector()
-  {
-    auto const free_result = cudaFreeHost(h_data);
-    assert(free_result == cudaSuccess);
-  }
-
   bool insert(const T &data)
   {
     if (num_elements < max_elements) {
@@ -81,5 +80,6 @@ class hostdevice_vector {
   size_t max_elements = 0;
   size_t num_elements = 0;
   T *h_data           = nullptr;
+  cudf::io::detail::pinned_buffer h_buffer;
   rmm::device_buffer d_data;
 };
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io_metrics.hpp"
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the nanoseconds elapsed since `start`
+ */
+int64_t elapsed_ns(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                              start)
+    .count();
+}
+
+}  // namespace
+
+std::unique_ptr<datasource::buffer> metered_source::host_read(size_t offset, size_t size)
+{
+  auto const start = std::chrono::steady_clock::now();
+  auto buffer      = _source->host_read(offset, size);
+  _read_ns += elapsed_ns(start);
+  _bytes_read += buffer->size();
+  return buffer;
+}
+
+size_t metered_source::host_read(size_t offset, size_t size, uint8_t *dst)
+{
+  auto const start      = std::chrono::steady_clock::now();
+  auto const bytes_read = _source->host_read(offset, size, dst);
+  _read_ns += elapsed_ns(start);
+  _bytes_read += bytes_read;
+  return bytes_read;
+}
+
+std::unique_ptr<datasource::buffer> metered_source::device_read(size_t offset, size_t size)
+{
+  auto const start = std::chrono::steady_clock::now();
+  auto buffer      = _source->device_read(offset, size);
+  _read_ns += elapsed_ns(start);
+  _bytes_read += buffer->size();
+  return buffer;
+}
+
+size_t metered_source::device_read(size_t offset, size_t size, uint8_t *dst)
+{
+  auto const start      = std::chrono::steady_clock::now();
+  auto const bytes_read = _source->device_read(offset, size, dst);
+  _read_ns += elapsed_ns(start);
+  _bytes_read += bytes_read;
+  return bytes_read;
+}
+
+void metered_source::take_metrics(io_metrics &metrics)
+{
+  metrics.bytes_read += _bytes_read.exchange(0);
+  metrics.host_io_ms += _read_ns.exchange(0) * 1e-6;
+}
+
+void metered_sink::host_write(void const *data, size_t size)
+{
+  auto const start = std::chrono::steady_clock::now();
+  _sink->host_write(data, size);
+  _write_ns += elapsed_ns(start);
+  _bytes_written += size;
+}
+
+void metered_sink::device_write(void const *gpu_data, size_t size, cudaStream_t stream)
+{
+  auto const start = std::chrono::steady_clock::now();
+  _sink->device_write(gpu_data, size, stream);
+  _write_ns += elapsed_ns(start);
+  _bytes_written += size;
+}
+
+void metered_sink::flush()
+{
+  auto const start = std::chrono::steady_clock::now();
+  _sink->flush();
+  _write_ns += elapsed_ns(start);
+}
+
+void metered_sink::take_metrics(io_metrics &metrics)
+{
+  metrics.bytes_written += _bytes_written;
+  metrics.host_io_ms += _write_ns * 1e-6;
+  _bytes_written = 0;
+  _write_ns      = 0;
+}
+
+void take_decompression_metrics(gpu_decompressor &decompressor, io_metrics &metrics)
+{
+  for (int c = 0; c < static_cast<int>(gpu_codec::NUM_CODECS); c++) {
+    auto const codec  = static_cast<gpu_codec>(c);
+    auto const &stats = decompressor.stats(codec);
+    if (stats.num_blocks != 0) {
+      auto &codec_metrics = metrics.codecs[gpu_codec_name(codec)];
+      codec_metrics.num_blocks += stats.num_blocks;
+      codec_metrics.compressed_bytes += stats.compressed_bytes;
+      codec_metrics.uncompressed_bytes += stats.uncompressed_bytes;
+    }
+  }
+  decompressor.reset_stats();
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
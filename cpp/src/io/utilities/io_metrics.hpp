@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <io/comp/gpu_decompressor.h>
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Adds the duration of a phase to a metrics time once the phase's device work is done
+ *
+ * The timer does nothing if the target is null, so that the phases can be delimited whether or
+ * not the metrics are collected. The phase ends with `stop()` or at the end of the scope. Host
+ * phases that must not wait for the device (e.g. while copies are overlapped) pass
+ * `synchronize = false`.
+ */
+class metrics_timer {
+ public:
+  /**
+   * @brief Starts timing a phase
+   *
+   * @param target_ms Time in milliseconds to add the phase duration to, or nullptr
+   * @param stream CUDA stream holding the device work of the phase
+   * @param synchronize Whether the phase ends when the work of `stream` is done
+   */
+  explicit metrics_timer(double *target_ms, cudaStream_t stream = 0, bool synchronize = true)
+    : _target_ms(target_ms),
+      _stream(stream),
+      _synchronize(synchronize),
+      _start(std::chrono::steady_clock::now())
+  {
+  }
+
+  /**
+   * @brief Starts timing a phase into one of the times of `metrics`
+   *
+   * @param metrics Metrics receiving the phase duration, or nullptr
+   * @param time Member of `io_metrics` to add the phase duration to
+   * @param stream CUDA stream holding the device work of the phase
+   * @param synchronize Whether the phase ends when the work of `stream` is done
+   */
+  metrics_timer(io_metrics *metrics,
+                double io_metrics::*time,
+                cudaStream_t stream = 0,
+                bool synchronize    = true)
+    : metrics_timer((metrics != nullptr) ? &(metrics->*time) : nullptr, stream, synchronize)
+  {
+  }
+
+  ~metrics_timer()
+  {
+    // Errors cannot be thrown from the destructor; stop() reports them when called explicitly
+    if (_target_ms != nullptr) {
+      if (_synchronize) { cudaStreamSynchronize(_stream); }
+      add_elapsed();
+    }
+  }
+
+  /**
+   * @brief Waits for the device work of the phase and adds its duration
+   */
+  void stop()
+  {
+    if (_target_ms != nullptr) {
+      if (_synchronize) { CUDA_TRY(cudaStreamSynchronize(_stream)); }
+      add_elapsed();
+    }
+  }
+
+ private:
+  void add_elapsed()
+  {
+    *_target_ms +=
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _start).count();
+    _target_ms = nullptr;
+  }
+
+  double *_target_ms;
+  cudaStream_t _stream;
+  bool _synchronize;
+  std::chrono::steady_clock::time_point _start;
+};
+
+/**
+ * @brief Datasource wrapper that counts the bytes read and the time spent reading
+ *
+ * Safe to use from several threads if the wrapped source is.
+ */
+class metered_source : public datasource {
+ public:
+  explicit metered_source(std::unique_ptr<datasource> source) : _source(std::move(source)) {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override;
+
+  bool supports_device_read() const override { return _source->supports_device_read(); }
+
+  std::unique_ptr<buffer> device_read(size_t offset, size_t size) override;
+
+  size_t device_read(size_t offset, size_t size, uint8_t *dst) override;
+
+  void prefetch(std::vector<std::pair<size_t, size_t>> const &ranges) override
+  {
+    _source->prefetch(ranges);
+  }
+
+  size_t size() const override { return _source->size(); }
+
+  /**
+   * @brief Adds the bytes read and the read time since the previous call
+   */
+  void take_metrics(io_metrics &metrics);
+
+ private:
+  std::unique_ptr<datasource> _source;
+  std::atomic<size_t> _bytes_read{0};
+  std::atomic<int64_t> _read_ns{0};
+};
+
+/**
+ * @brief Data sink wrapper that counts the bytes written and the time spent writing
+ */
+class metered_sink : public data_sink {
+ public:
+  explicit metered_sink(std::unique_ptr<data_sink> sink) : _sink(std::move(sink)) {}
+
+  void host_write(void const *data, size_t size) override;
+
+  bool supports_device_write() const override { return _sink->supports_device_write(); }
+
+  void device_write(void const *gpu_data, size_t size, cudaStream_t stream) override;
+
+  void flush() override;
+
+  size_t bytes_written() override { return _sink->bytes_written(); }
+
+  /**
+   * @brief Adds the bytes written and the write time since the previous call
+   */
+  void take_metrics(io_metrics &metrics);
+
+ private:
+  std::unique_ptr<data_sink> _sink;
+  size_t _bytes_written = 0;
+  int64_t _write_ns     = 0;
+};
+
+/**
+ * @brief Adds the data decompressed by a decompressor to `metrics`, and resets its statistics
+ */
+void take_decompression_metrics(gpu_decompressor &decompressor, io_metrics &metrics);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Returns the key identifying the current version of a file in a metadata cache
+ *
+ * The key combines the path with the size and modification time of the file, so that a file
+ * rewritten in place gets a new key. Returns an empty string if the file cannot be queried.
+ *
+ * @param filepath Path of the file
+ */
+std::string file_cache_key(std::string const &filepath);
+
+/**
+ * @brief Process-wide, size-bounded LRU cache of parsed file metadata
+ *
+ * Readers that opt in look up the parsed footer of a file before reading it, and insert it after
+ * parsing it. Each entry is charged an approximate size (the uncompressed size of the footer); once
+ * the total exceeds the capacity, the least recently used entries are evicted. Entries are
+ * immutable and shared, so a reader keeps its metadata alive after eviction. All functions are
+ * thread-safe.
+ *
+ * @tparam Metadata Parsed metadata type; each type has its own cache
+ */
+template <typename Metadata>
+class metadata_cache {
+ public:
+  static constexpr size_t default_capacity = 256 * 1024 * 1024;
+
+  /**
+   * @brief Returns the cache of `Metadata` objects
+   */
+  static metadata_cache &instance()
+  {
+    static metadata_cache cache;
+    return cache;
+  }
+
+  /**
+   * @brief Returns the metadata of a key and marks it as recently used, or nullptr
+   */
+  std::shared_ptr<Metadata const> get(std::string const &key)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _index.find(key);
+    if (it == _index.end()) { return nullptr; }
+    _entries.splice(_entries.begin(), _entries, it->second);
+    return it->second->metadata;
+  }
+
+  /**
+   * @brief Inserts or replaces the metadata of a key
+   *
+   * @param key Cache key, typically from `file_cache_key()`
+   * @param metadata Parsed metadata
+   * @param size Approximate size of the metadata in bytes
+   */
+  void put(std::string const &key, std::shared_ptr<Metadata const> metadata, size_t size)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    erase_entry(key);
+    if (size > _capacity) { return; }
+    _entries.push_front({key, std::move(metadata), size});
+    _index.emplace(key, _entries.begin());
+    _size += size;
+    evict();
+  }
+
+  /**
+   * @brief Sets the maximum total size of the entries, evicting entries as needed
+   */
+  void set_capacity(size_t capacity)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacity;
+    evict();
+  }
+
+  /**
+   * @brief Removes all entries
+   */
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _index.clear();
+    _entries.clear();
+    _size = 0;
+  }
+
+  /**
+   * @brief Returns the number of entries
+   */
+  size_t num_entries()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+  }
+
+ private:
+  struct entry {
+    std::string key;
+    std::shared_ptr<Metadata const> metadata;
+    size_t size;
+  };
+
+  metadata_cache() = default;
+
+  void erase_entry(std::string const &key)
+  {
+    auto it = _index.find(key);
+    if (it == _index.end()) { return; }
+    _size -= it->second->size;
+    _entries.erase(it->second);
+    _index.erase(it);
+  }
+
+  void evict()
+  {
+    while (_size > _capacity) {
+      auto const key = _entries.back().key;
+      erase_entry(key);
+    }
+  }
+
+  std::mutex _mutex;
+  std::list<entry> _entries;  ///< Most recently used first
+  std::unordered_map<std::string, typename std::list<entry>::iterator> _index;
+  size_t _size     = 0;
+  size_t _capacity = default_capacity;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Returns the default number of host threads used for parallel I/O
+ */
+inline size_t default_num_io_threads()
+{
+  return std::min<size_t>(8, std::max<unsigned>(1, std::thread::hardware_concurrency()));
+}
+
+/**
+ * @brief Calls `func(i)` for each `i` in `[0, count)` on up to `num_threads` host threads
+ *
+ * The threads pull indices in order, so work is balanced across tasks of uneven cost such as
+ * opening files or parsing their footers. The first exception thrown by `func` is rethrown once
+ * all threads have finished.
+ *
+ * @param count Number of tasks
+ * @param func Task function; must be safe to call concurrently for different indices
+ * @param num_threads Maximum number of threads; 0 to pick based on the host
+ */
+template <typename Func>
+void parallel_for(size_t count, Func func, size_t num_threads = 0)
+{
+  if (num_threads == 0) { num_threads = default_num_io_threads(); }
+  num_threads = std::min(num_threads, count);
+  if (num_threads <= 1) {
+    for (size_t i = 0; i < count; ++i) { func(i); }
+    return;
+  }
+
+  std::atomic<size_t> next_task{0};
+  std::vector<std::future<void>> workers;
+  for (size_t t = 0; t < num_threads; ++t) {
+    workers.emplace_back(std::async(std::launch::async, [&]() {
+      for (auto idx = next_task++; idx < count; idx = next_task++) { func(idx); }
+    }));
+  }
+  // wait for every worker before rethrowing, since they reference this frame
+  for (auto &worker : workers) { worker.wait(); }
+  for (auto &worker : workers) { worker.get(); }
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
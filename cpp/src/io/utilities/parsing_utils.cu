@@ -2,6 +2,7 @@
 
 #include <thrust/device_vector.h>
 #include <thrust/pair.h>
+#include <thrust/tabulate.h>
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
@@ -197,6 +198,25 @@ cudf::size_type count_all_from_set(const char* h_data, size_t h_size, const std:
   return find_all_from_set<void>(h_data, h_size, keys, 0, nullptr);
 }
 
+rmm::device_vector<size_type> sample_row_indices(size_t num_rows,
+                                                 size_type sample_size,
+                                                 cudaStream_t stream)
+{
+  size_type const num_head = sample_size / 2;
+  size_t const stride      = (num_rows - num_head) / (sample_size - num_head);
+  rmm::device_vector<size_type> row_indices(sample_size);
+  thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                   row_indices.begin(),
+                   row_indices.end(),
+                   [num_head, stride] __device__(size_type i) {
+                     if (i < num_head) { return i; }
+                     size_t const j = i - num_head;
+                     return static_cast<size_type>(num_head + j * stride +
+                                                   (j * 2654435761u) % stride);
+                   });
+  return row_indices;
+}
+
 std::string infer_compression_type(
   const compression_type& compression_arg,
   const std::string& filename,
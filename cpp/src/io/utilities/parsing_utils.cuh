@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <cudf/detail/utilities/number_parsing.cuh>
 #include <cudf/detail/utilities/trie.cuh>
 #include <cudf/io/types.hpp>
 
+#include <rmm/thrust_rmm_allocator.h>
+
 namespace cudf {
 namespace io {
 /**
@@ -36,9 +39,9 @@ struct ParseOptions {
   bool doublequote;
   bool dayfirst;
   bool skipblanklines;
-  SerialTrieNode* trueValuesTrie;
-  SerialTrieNode* falseValuesTrie;
-  SerialTrieNode* naValuesTrie;
+  SerialTrieView trueValuesTrie;
+  SerialTrieView falseValuesTrie;
+  SerialTrieView naValuesTrie;
   bool multi_delimiter;
 };
 
@@ -130,6 +133,10 @@ __device__ __forceinline__ uint8_t decode_digit(char c, bool* valid_flag)
 /**
  * @brief Parses a character string and returns its numeric value.
  *
+ * Runs of 8 decimal digits are consumed at once. Floating-point values are
+ * accumulated as a decimal mantissa and exponent and are correctly rounded
+ * whenever the mantissa and exponent are exact doubles.
+ *
  * @param data The character string for parse
  * @param start The index within data to start parsing from
  * @param end The end index within data to end parsing
@@ -157,30 +164,31 @@ parse_numeric(const char* data, long start, long end, ParseOptions const& opts)
     start += 2;
   }
 
-  // Handle the whole part of the number
-  long index = start;
-  while (index <= end) {
-    if (data[index] == opts.decimal) {
-      ++index;
-      break;
-    } else if (base == 10 && (data[index] == 'e' || data[index] == 'E')) {
-      break;
-    } else if (data[index] != opts.thousands && data[index] != '+') {
-      value = (value * base) + decode_digit<T>(data[index], &all_digits_valid);
-    }
-    ++index;
-  }
-
   if (std::is_floating_point<T>::value) {
-    // Handle fractional part of the number if necessary
-    double divisor = 1;
+    uint64_t mantissa = 0;
+    int32_t exponent  = 0;
+    bool truncated    = false;
+    bool fraction     = false;
+    // Handle the whole and fractional parts of the number
+    long index = start;
     while (index <= end) {
-      if (data[index] == 'e' || data[index] == 'E') {
+      if (data[index] == opts.decimal && !fraction) {
+        fraction = true;
+      } else if (data[index] == 'e' || data[index] == 'E') {
         ++index;
         break;
       } else if (data[index] != opts.thousands && data[index] != '+') {
-        divisor /= base;
-        value += decode_digit<T>(data[index], &all_digits_valid) * divisor;
+        if (end - index >= 7 && mantissa < 100000000000ul) {
+          auto const chars = cudf::detail::load_eight_chars(data + index);
+          if (cudf::detail::is_eight_digits(chars)) {
+            mantissa = mantissa * 100000000ul + cudf::detail::parse_eight_digits(chars);
+            exponent -= fraction ? 8 : 0;
+            index += 8;
+            continue;
+          }
+        }
+        auto const digit = decode_digit<T>(data[index], &all_digits_valid);
+        cudf::detail::add_decimal_digit(digit, fraction, mantissa, exponent, truncated);
       }
       ++index;
     }
@@ -189,11 +197,35 @@ parse_numeric(const char* data, long start, long end, ParseOptions const& opts)
     if (index <= end) {
       const int32_t exponent_sign = data[index] == '-' ? -1 : 1;
       if (data[index] == '-' || data[index] == '+') { ++index; }
-      int32_t exponent = 0;
+      int32_t exp_ten = 0;
       while (index <= end) {
-        exponent = (exponent * 10) + decode_digit<T>(data[index++], &all_digits_valid);
+        exp_ten = (exp_ten * 10) + decode_digit<T>(data[index++], &all_digits_valid);
+      }
+      exponent += exp_ten * exponent_sign;
+    }
+    value = cudf::detail::decimal_to_double(mantissa, exponent, truncated);
+  } else {
+    // Handle the whole part of the number
+    long index = start;
+    while (index <= end) {
+      if (data[index] == opts.decimal) {
+        break;
+      } else if (base == 10 && (data[index] == 'e' || data[index] == 'E')) {
+        break;
+      } else if (data[index] != opts.thousands && data[index] != '+') {
+        if (base == 10 && end - index >= 7) {
+          auto const chars = cudf::detail::load_eight_chars(data + index);
+          if (cudf::detail::is_eight_digits(chars)) {
+            // wraps around like the digit by digit accumulation below
+            value = static_cast<T>(static_cast<uint64_t>(value) * 100000000ul +
+                                   cudf::detail::parse_eight_digits(chars));
+            index += 8;
+            continue;
+          }
+        }
+        value = (value * base) + decode_digit<T>(data[index], &all_digits_valid);
       }
-      if (exponent != 0) { value *= exp10(double(exponent * exponent_sign)); }
+      ++index;
     }
   }
   if (!all_digits_valid) { return std::numeric_limits<T>::quiet_NaN(); }
@@ -272,6 +304,21 @@ cudf::size_type count_all_from_set(const char* h_data,
                                    size_t h_size,
                                    const std::vector<char>& keys);
 
+/**
+ * @brief Returns the indices of the rows sampled for type inference
+ *
+ * Half of the sample is the first rows, so that a small file or the head of a sorted file is
+ * fully covered; the other half is one row at a pseudo-random position in each of the equal
+ * strides of the remaining rows.
+ *
+ * @param num_rows Number of rows
+ * @param sample_size Number of rows to sample, less than `num_rows`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+rmm::device_vector<cudf::size_type> sample_row_indices(size_t num_rows,
+                                                       cudf::size_type sample_size,
+                                                       cudaStream_t stream = 0);
+
 /**
  * @brief Infer file compression type based on user supplied arguments.
  *
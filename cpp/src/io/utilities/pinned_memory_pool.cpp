@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pinned_memory_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstdlib>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the size class of an allocation of `size` bytes, at most `max_block_size`
+ */
+size_t size_class(size_t size)
+{
+  size_t cls        = 0;
+  size_t block_size = pinned_memory_pool::min_block_size;
+  while (block_size < size) {
+    block_size *= 2;
+    ++cls;
+  }
+  return cls;
+}
+
+size_t class_block_size(size_t cls) { return pinned_memory_pool::min_block_size << cls; }
+
+}  // namespace
+
+pinned_memory_pool::pinned_memory_pool()
+  : _free_blocks(size_class(max_block_size) + 1)
+{
+  auto const pool_size_env = std::getenv("LIBCUDF_PINNED_POOL_SIZE");
+  if (pool_size_env != nullptr) { _max_cached_bytes = std::stoull(pool_size_env); }
+}
+
+pinned_memory_pool &pinned_memory_pool::instance()
+{
+  // Never destroyed: the CUDA runtime may be shut down before static destructors run
+  static pinned_memory_pool *pool = new pinned_memory_pool;
+  return *pool;
+}
+
+void *pinned_memory_pool::allocate(size_t size)
+{
+  if (size == 0) { return nullptr; }
+  void *ptr = nullptr;
+  if (size > max_block_size) {
+    CUDA_TRY(cudaMallocHost(&ptr, size));
+    return ptr;
+  }
+  auto const cls = size_class(size);
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto &blocks = _free_blocks[cls];
+    if (not blocks.empty()) {
+      ptr = blocks.back();
+      blocks.pop_back();
+      _cached_bytes -= class_block_size(cls);
+      return ptr;
+    }
+  }
+  CUDA_TRY(cudaMallocHost(&ptr, class_block_size(cls)));
+  return ptr;
+}
+
+void pinned_memory_pool::deallocate(void *ptr, size_t size)
+{
+  if (ptr == nullptr) { return; }
+  if (size <= max_block_size) {
+    auto const cls        = size_class(size);
+    auto const block_size = class_block_size(cls);
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_cached_bytes + block_size <= _max_cached_bytes) {
+      _free_blocks[cls].push_back(ptr);
+      _cached_bytes += block_size;
+      return;
+    }
+  }
+  cudaFreeHost(ptr);
+}
+
+void pinned_memory_pool::set_max_cached_bytes(size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _max_cached_bytes = bytes;
+  trim(bytes);
+}
+
+size_t pinned_memory_pool::max_cached_bytes()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _max_cached_bytes;
+}
+
+size_t pinned_memory_pool::cached_bytes()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _cached_bytes;
+}
+
+void pinned_memory_pool::release()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  trim(0);
+}
+
+void pinned_memory_pool::trim(size_t max_cached_bytes)
+{
+  for (auto cls = _free_blocks.size(); cls > 0 && _cached_bytes > max_cached_bytes; --cls) {
+    auto &blocks = _free_blocks[cls - 1];
+    while (not blocks.empty() && _cached_bytes > max_cached_bytes) {
+      cudaFreeHost(blocks.back());
+      blocks.pop_back();
+      _cached_bytes -= class_block_size(cls - 1);
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
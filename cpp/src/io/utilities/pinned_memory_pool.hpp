@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Process-wide pool of pinned host memory for the staging buffers of the readers and
+ * writers
+ *
+ * `cudaMallocHost` and `cudaFreeHost` are slow driver calls that synchronize the device, so
+ * allocating the small pinned buffers of each read serializes concurrent readers. The pool keeps
+ * freed blocks in power-of-two size classes from `min_block_size` to `max_block_size` and hands
+ * them out again; larger allocations are not pooled. At most `max_cached_bytes()` bytes of free
+ * blocks are kept, `default_max_cached_bytes` unless set by the `LIBCUDF_PINNED_POOL_SIZE`
+ * environment variable or `set_max_cached_bytes()`. All functions are thread-safe.
+ */
+class pinned_memory_pool {
+ public:
+  static constexpr size_t min_block_size           = 256;
+  static constexpr size_t max_block_size           = 64 * 1024 * 1024;
+  static constexpr size_t default_max_cached_bytes = 256 * 1024 * 1024;
+
+  /**
+   * @brief Returns the pool of the process
+   */
+  static pinned_memory_pool &instance();
+
+  /**
+   * @brief Allocates at least `size` bytes of pinned host memory
+   *
+   * @param size Number of bytes; must be passed again to `deallocate()`
+   * @return Pointer to the memory, or nullptr if `size` is 0
+   */
+  void *allocate(size_t size);
+
+  /**
+   * @brief Returns memory from `allocate()` to the pool
+   *
+   * @param ptr Pointer returned by `allocate(size)`
+   * @param size Size passed to `allocate()`
+   */
+  void deallocate(void *ptr, size_t size);
+
+  /**
+   * @brief Sets the maximum total size of the free blocks kept, freeing blocks as needed
+   */
+  void set_max_cached_bytes(size_t bytes);
+
+  /**
+   * @brief Returns the maximum total size of the free blocks kept
+   */
+  size_t max_cached_bytes();
+
+  /**
+   * @brief Returns the total size of the free blocks kept
+   */
+  size_t cached_bytes();
+
+  /**
+   * @brief Frees all the free blocks kept
+   */
+  void release();
+
+ private:
+  pinned_memory_pool();
+
+  /**
+   * @brief Frees free blocks, largest first, until at most `max_cached_bytes` are kept
+   */
+  void trim(size_t max_cached_bytes);
+
+  std::mutex _mutex;
+  std::vector<std::vector<void *>> _free_blocks;  ///< Free blocks of each size class
+  size_t _cached_bytes     = 0;
+  size_t _max_cached_bytes = default_max_cached_bytes;
+};
+
+/**
+ * @brief Pinned host buffer allocated from the `pinned_memory_pool`
+ */
+class pinned_buffer {
+ public:
+  pinned_buffer() = default;
+
+  explicit pinned_buffer(size_t size)
+    : _data(pinned_memory_pool::instance().allocate(size)), _size(size)
+  {
+  }
+
+  pinned_buffer(pinned_buffer &&other) noexcept : _data(other._data), _size(other._size)
+  {
+    other._data = nullptr;
+    other._size = 0;
+  }
+
+  pinned_buffer &operator=(pinned_buffer &&other) noexcept
+  {
+    if (this != &other) {
+      reset();
+      _data       = other._data;
+      _size       = other._size;
+      other._data = nullptr;
+      other._size = 0;
+    }
+    return *this;
+  }
+
+  pinned_buffer(pinned_buffer const &) = delete;
+  pinned_buffer &operator=(pinned_buffer const &) = delete;
+
+  ~pinned_buffer() { reset(); }
+
+  void *data() const noexcept { return _data; }
+  size_t size() const noexcept { return _size; }
+
+ private:
+  void reset()
+  {
+    if (_data != nullptr) { pinned_memory_pool::instance().deallocate(_data, _size); }
+    _data = nullptr;
+    _size = 0;
+  }
+
+  void *_data  = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
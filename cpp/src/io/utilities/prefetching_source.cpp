@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "prefetching_source.hpp"
+#include "parallel_for.hpp"
+#include "pinned_memory_pool.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <mutex>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Ranges waiting to be read and the staging memory held by the read ranges
+ *
+ * Shared by the source, its threads and the staged ranges, which release their staging memory
+ * when they are destroyed.
+ */
+struct prefetching_source::read_queue {
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<std::shared_ptr<staged_range>> pending;  ///< Ranges no thread has started reading
+  size_t const budget;
+  size_t staged_bytes = 0;  ///< Staging memory reserved by the started ranges
+  bool stop           = false;
+
+  explicit read_queue(size_t budget) : budget(budget) {}
+
+  // A range larger than the budget is read once no other range holds staging memory
+  bool fits(size_t size) const { return staged_bytes == 0 || staged_bytes + size <= budget; }
+};
+
+/**
+ * @brief Pinned host staging buffer for one byte range
+ */
+struct prefetching_source::staged_range {
+  size_t offset     = 0;
+  size_t size       = 0;
+  size_t bytes_read = 0;
+  pinned_buffer data;
+  std::shared_ptr<read_queue> queue;
+  bool reserved = false;  ///< Whether `size` bytes of the budget are held
+  std::promise<void> done;
+  std::shared_future<void> ready;
+
+  staged_range(size_t offset, size_t size, std::shared_ptr<read_queue> queue)
+    : offset(offset), size(size), queue(std::move(queue)), ready(done.get_future())
+  {
+  }
+
+  ~staged_range()
+  {
+    data = pinned_buffer{};
+    if (reserved) {
+      std::lock_guard<std::mutex> lock(queue->mutex);
+      queue->staged_bytes -= size;
+      queue->cv.notify_all();
+    }
+  }
+
+  /**
+   * @brief Reads the range into a new staging buffer; the budget must be reserved
+   */
+  void read(datasource *source)
+  {
+    try {
+      if (size != 0) {
+        data       = pinned_buffer(size);
+        bytes_read = source->host_read(offset, size, static_cast<uint8_t *>(data.data()));
+      }
+      done.set_value();
+    } catch (...) {
+      done.set_exception(std::current_exception());
+    }
+  }
+};
+
+/**
+ * @brief Buffer returned from `host_read()` that keeps the staging memory alive
+ */
+class prefetching_source::staged_buffer : public datasource::buffer {
+  std::shared_ptr<staged_range> _range;
+
+ public:
+  explicit staged_buffer(std::shared_ptr<staged_range> range) : _range(std::move(range)) {}
+  size_t size() const override { return _range->bytes_read; }
+  const uint8_t *data() const override { return static_cast<uint8_t *>(_range->data.data()); }
+};
+
+void prefetching_source::read_pending_ranges(datasource *source, std::shared_ptr<read_queue> queue)
+{
+  while (true) {
+    std::shared_ptr<staged_range> range;
+    {
+      std::unique_lock<std::mutex> lock(queue->mutex);
+      queue->cv.wait(lock, [&]() {
+        return queue->stop ||
+               (!queue->pending.empty() && queue->fits(queue->pending.front()->size));
+      });
+      if (queue->stop) { return; }
+      range = std::move(queue->pending.front());
+      queue->pending.pop_front();
+      queue->staged_bytes += range->size;
+      range->reserved = true;
+    }
+    range->read(source);
+  }
+}
+
+prefetching_source::prefetching_source(datasource *source, size_t num_threads, size_t staging_bytes)
+  : _source(source),
+    _num_threads(num_threads != 0 ? num_threads : default_num_io_threads()),
+    _queue(std::make_shared<read_queue>(staging_bytes))
+{
+}
+
+prefetching_source::~prefetching_source()
+{
+  for (auto &copy : _in_flight) {
+    cudaEventSynchronize(copy.first);
+    cudaEventDestroy(copy.first);
+  }
+  std::deque<std::shared_ptr<staged_range>> pending;
+  {
+    std::lock_guard<std::mutex> lock(_queue->mutex);
+    _queue->stop = true;
+    pending.swap(_queue->pending);
+  }
+  _queue->cv.notify_all();
+  for (auto &worker : _workers) { worker.join(); }
+}
+
+void prefetching_source::prefetch(std::vector<std::pair<size_t, size_t>> const &ranges)
+{
+  // The device reads of the ranges bypass the staging buffers
+  if (_source->supports_device_read()) {
+    _source->prefetch(ranges);
+    return;
+  }
+  std::vector<std::shared_ptr<staged_range>> new_ranges;
+  std::vector<std::pair<size_t, size_t>> source_ranges;
+  for (auto const &range : ranges) {
+    if (_staged.find(range) != _staged.end()) { continue; }
+    auto staged = std::make_shared<staged_range>(range.first, range.second, _queue);
+    _staged.emplace(range, staged);
+    new_ranges.push_back(std::move(staged));
+    source_ranges.push_back(range);
+  }
+  if (new_ranges.empty()) { return; }
+  _source->prefetch(source_ranges);
+
+  {
+    std::lock_guard<std::mutex> lock(_queue->mutex);
+    _queue->pending.insert(_queue->pending.end(), new_ranges.begin(), new_ranges.end());
+  }
+  _queue->cv.notify_all();
+  while (_workers.size() < _num_threads) {
+    _workers.emplace_back(read_pending_ranges, _source, _queue);
+  }
+}
+
+std::shared_ptr<prefetching_source::staged_range> prefetching_source::take(size_t offset,
+                                                                           size_t size)
+{
+  auto const key        = std::make_pair(offset, size);
+  auto it               = _staged.find(key);
+  bool const prefetched = (it != _staged.end());
+  std::shared_ptr<staged_range> staged;
+  if (prefetched) {
+    staged = it->second;
+    _staged.erase(it);
+  } else {
+    staged = std::make_shared<staged_range>(offset, size, _queue);
+  }
+
+  // Copies still holding staging memory would otherwise keep the threads waiting
+  if (staged->ready.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+    release_copied(true);
+  }
+  bool read_here = not prefetched;
+  {
+    std::lock_guard<std::mutex> lock(_queue->mutex);
+    auto const pending = std::find(_queue->pending.begin(), _queue->pending.end(), staged);
+    if (pending != _queue->pending.end()) {
+      _queue->pending.erase(pending);
+      read_here = true;
+    }
+    if (read_here) {
+      _queue->staged_bytes += staged->size;
+      staged->reserved = true;
+    }
+  }
+  if (read_here) { staged->read(_source); }
+  staged->ready.get();  // rethrows any exception from the read
+  return staged;
+}
+
+size_t prefetching_source::device_read_async(size_t offset,
+                                             size_t size,
+                                             uint8_t *dst,
+                                             cudaStream_t stream)
+{
+  if (_source->supports_device_read()) { return _source->device_read(offset, size, dst); }
+
+  release_copied(false);
+  auto staged           = take(offset, size);
+  auto const bytes_read = staged->bytes_read;
+  if (bytes_read != 0) {
+    CUDA_TRY(cudaMemcpyAsync(dst, staged->data.data(), bytes_read, cudaMemcpyHostToDevice, stream));
+    cudaEvent_t copied{};
+    CUDA_TRY(cudaEventCreateWithFlags(&copied, cudaEventDisableTiming));
+    CUDA_TRY(cudaEventRecord(copied, stream));
+    _in_flight.emplace_back(copied, std::move(staged));
+  }
+  return bytes_read;
+}
+
+void prefetching_source::read_to_device(std::vector<device_read_range> const &ranges,
+                                        cudaStream_t stream)
+{
+  if (_source->supports_device_read()) {
+    // Direct reads are not stream-ordered; the destinations must be ready before writing to them
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    std::atomic<size_t> next_range{0};
+    std::vector<std::future<void>> readers;
+    auto const num_readers = std::min(_num_threads, ranges.size());
+    for (size_t i = 0; i < num_readers; ++i) {
+      readers.emplace_back(std::async(std::launch::async, [&]() {
+        for (auto idx = next_range++; idx < ranges.size(); idx = next_range++) {
+          _source->device_read(ranges[idx].offset, ranges[idx].size, ranges[idx].dst);
+        }
+      }));
+    }
+    for (auto &reader : readers) { reader.get(); }
+    return;
+  }
+
+  std::vector<std::pair<size_t, size_t>> host_ranges;
+  host_ranges.reserve(ranges.size());
+  for (auto const &range : ranges) { host_ranges.emplace_back(range.offset, range.size); }
+  prefetch(host_ranges);
+  for (auto const &range : ranges) {
+    device_read_async(range.offset, range.size, range.dst, stream);
+  }
+}
+
+void prefetching_source::release_copied(bool wait)
+{
+  std::vector<std::pair<cudaEvent_t, std::shared_ptr<staged_range>>> remaining;
+  for (auto &copy : _in_flight) {
+    auto const status = wait ? cudaEventSynchronize(copy.first) : cudaEventQuery(copy.first);
+    if (status == cudaErrorNotReady) {
+      remaining.push_back(std::move(copy));
+      continue;
+    }
+    CUDA_TRY(status);
+    CUDA_TRY(cudaEventDestroy(copy.first));
+  }
+  _in_flight = std::move(remaining);
+}
+
+void prefetching_source::synchronize() { release_copied(true); }
+
+std::unique_ptr<datasource::buffer> prefetching_source::host_read(size_t offset, size_t size)
+{
+  if (_staged.find(std::make_pair(offset, size)) == _staged.end()) {
+    return _source->host_read(offset, size);
+  }
+  return std::make_unique<staged_buffer>(take(offset, size));
+}
+
+size_t prefetching_source::host_read(size_t offset, size_t size, uint8_t *dst)
+{
+  if (_staged.find(std::make_pair(offset, size)) == _staged.end()) {
+    return _source->host_read(offset, size, dst);
+  }
+  auto staged = take(offset, size);
+  std::memcpy(dst, staged->data.data(), staged->bytes_read);
+  return staged->bytes_read;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
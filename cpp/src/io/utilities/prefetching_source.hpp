@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <map>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Byte range of a source and the device memory it is copied to
+ */
+struct device_read_range {
+  size_t offset;  ///< Bytes from the start of the source
+  size_t size;    ///< Bytes to read
+  uint8_t *dst;   ///< Device memory destination
+};
+
+/**
+ * @brief Datasource wrapper that reads planned byte ranges ahead of time
+ *
+ * The reader passes the list of byte ranges it is about to read (column chunks, stripes) to
+ * `prefetch()`; the ranges are then read in order by a fixed set of host threads into pinned
+ * staging buffers from the `pinned_memory_pool`. `device_read_async()` copies a prefetched range
+ * to device memory on the caller's stream without blocking, so the host reads of later ranges
+ * overlap the H2D copies of earlier ones. If the wrapped source supports `device_read()`, the
+ * staging is bypassed entirely.
+ *
+ * At most `staging_bytes` of staging buffers are held at a time, so the pinned memory does not
+ * grow with the size of the file: the threads wait for the buffers of the copied ranges to be
+ * released before reading further. A single range larger than the budget is still read, alone.
+ *
+ * The wrapped source must allow concurrent `host_read()` calls from multiple threads.
+ */
+class prefetching_source : public datasource {
+ public:
+  static constexpr size_t default_staging_bytes = 64 * 1024 * 1024;
+
+  /**
+   * @brief Constructor
+   *
+   * @param source Non-owning pointer to the wrapped source
+   * @param num_threads Number of host threads reading ahead; 0 to pick based on the host
+   * @param staging_bytes Maximum size of the staging buffers held at a time
+   */
+  explicit prefetching_source(datasource *source,
+                              size_t num_threads   = 0,
+                              size_t staging_bytes = default_staging_bytes);
+
+  /**
+   * @brief Waits for outstanding reads and copies before releasing the staging buffers
+   */
+  ~prefetching_source() override;
+
+  /**
+   * @brief Queues the given byte ranges to be read in the background, in order
+   *
+   * Ranges that are already prefetched are ignored. The ranges are also passed on to the wrapped
+   * source, which may fetch them ahead in larger requests. Readers should pass all the ranges they
+   * plan to read in one call, so that the wrapped source sees them together.
+   *
+   * @param ranges List of (offset, size) pairs to read
+   */
+  void prefetch(std::vector<std::pair<size_t, size_t>> const &ranges) override;
+
+  /**
+   * @brief Copies a byte range to device memory asynchronously on `stream`
+   *
+   * The range is read first if it was not prefetched. The copy may still be in progress when this
+   * function returns; call `synchronize()` before using the data on another stream.
+   *
+   * @param offset Bytes from the start
+   * @param size Bytes to read
+   * @param dst Address of the existing device memory
+   * @param stream CUDA stream used for the copy
+   *
+   * @return The number of bytes read (can be smaller than size)
+   */
+  size_t device_read_async(size_t offset, size_t size, uint8_t *dst, cudaStream_t stream);
+
+  /**
+   * @brief Prefetches all ranges and copies them to device memory on `stream`
+   *
+   * @param ranges Byte ranges and their device destinations
+   * @param stream CUDA stream used for the copies
+   */
+  void read_to_device(std::vector<device_read_range> const &ranges, cudaStream_t stream);
+
+  /**
+   * @brief Waits for all copies issued by `device_read_async()` and releases their staging buffers
+   */
+  void synchronize();
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override;
+
+  bool supports_device_read() const override { return _source->supports_device_read(); }
+
+  std::unique_ptr<buffer> device_read(size_t offset, size_t size) override
+  {
+    return _source->device_read(offset, size);
+  }
+
+  size_t device_read(size_t offset, size_t size, uint8_t *dst) override
+  {
+    return _source->device_read(offset, size, dst);
+  }
+
+  size_t size() const override { return _source->size(); }
+
+ private:
+  struct staged_range;
+  struct read_queue;
+  class staged_buffer;
+
+  /**
+   * @brief Removes a prefetched range and returns it once it is read
+   *
+   * A range that was not prefetched, or that no thread has started reading yet, is read on the
+   * calling thread.
+   */
+  std::shared_ptr<staged_range> take(size_t offset, size_t size);
+
+  /**
+   * @brief Releases the staging buffers of the completed copies, waiting for all copies if `wait`
+   */
+  void release_copied(bool wait);
+
+  /**
+   * @brief Reads the pending ranges of `queue` in order while the staging budget allows, until
+   * the queue is stopped
+   */
+  static void read_pending_ranges(datasource *source, std::shared_ptr<read_queue> queue);
+
+  datasource *const _source;
+  size_t const _num_threads;
+  std::shared_ptr<read_queue> const _queue;
+  std::map<std::pair<size_t, size_t>, std::shared_ptr<staged_range>> _staged;
+  std::vector<std::thread> _workers;
+  std::vector<std::pair<cudaEvent_t, std::shared_ptr<staged_range>>> _in_flight;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
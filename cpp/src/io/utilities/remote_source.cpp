@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "remote_source.hpp"
+#include "parallel_for.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Coalesced byte range of the source, fetched with one request per part
+ */
+struct remote_source::block {
+  size_t offset = 0;
+  std::vector<uint8_t> data;
+  size_t part_size = 0;
+  std::vector<std::promise<void>> parts_done;
+  std::vector<std::shared_future<void>> parts_ready;
+  size_t unread = 0;  ///< Bytes of the planned ranges not read yet; guarded by the source mutex
+
+  block(size_t offset, size_t size, size_t part_size)
+    : offset(offset),
+      data(size),
+      part_size(part_size),
+      parts_done((size + part_size - 1) / part_size)
+  {
+    for (auto &done : parts_done) { parts_ready.emplace_back(done.get_future()); }
+  }
+
+  size_t end() const { return offset + data.size(); }
+
+  /**
+   * @brief Waits for the requests overlapping the byte range, rethrowing any error
+   */
+  void wait(size_t range_offset, size_t range_size) const
+  {
+    if (range_size == 0) { return; }
+    auto const first = (range_offset - offset) / part_size;
+    auto const last  = (range_offset - offset + range_size - 1) / part_size;
+    for (auto part = first; part <= last; ++part) { parts_ready[part].get(); }
+  }
+};
+
+/**
+ * @brief Buffer returned from `host_read()` that keeps the block alive
+ */
+class remote_source::block_buffer : public datasource::buffer {
+  std::shared_ptr<block> _block;
+  size_t const _offset;
+  size_t const _size;
+
+ public:
+  block_buffer(std::shared_ptr<block> blk, size_t offset, size_t size)
+    : _block(std::move(blk)), _offset(offset), _size(size)
+  {
+  }
+  size_t size() const override { return _size; }
+  const uint8_t *data() const override { return _block->data.data() + _offset - _block->offset; }
+};
+
+namespace {
+/**
+ * @brief Buffer owning its host memory, for reads that are not served from a block
+ */
+class vector_buffer : public datasource::buffer {
+  std::vector<uint8_t> _data;
+
+ public:
+  explicit vector_buffer(std::vector<uint8_t> &&data) : _data(std::move(data)) {}
+  size_t size() const override { return _data.size(); }
+  const uint8_t *data() const override { return _data.data(); }
+};
+
+}  // namespace
+
+remote_source::remote_source(std::unique_ptr<datasource> source,
+                             remote_source_options const &options)
+  : _source(std::move(source)), _options(options), _size(_source->size())
+{
+  CUDF_EXPECTS(_options.num_threads > 0 && _options.request_size > 0,
+               "Invalid remote source options");
+}
+
+remote_source::~remote_source()
+{
+  for (auto &worker : _workers) { worker.wait(); }
+}
+
+void remote_source::prefetch(std::vector<std::pair<size_t, size_t>> const &ranges)
+{
+  auto const tail_start = _size - std::min(_size, _options.tail_size);
+  std::vector<std::pair<size_t, size_t>> sorted;
+  for (auto const &range : ranges) {
+    auto const end = std::min(range.first + range.second, _size);
+    // Ranges inside the cached tail are served without a request
+    if (range.first < end && range.first < tail_start) {
+      sorted.emplace_back(range.first, end - range.first);
+    }
+  }
+  std::sort(sorted.begin(), sorted.end());
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  // Merge ranges separated by small gaps; reading through a gap is cheaper than a round trip
+  std::vector<std::shared_ptr<block>> new_blocks;
+  size_t block_start = 0, block_end = 0, block_unread = 0;
+  auto flush_block = [&]() {
+    if (block_end == block_start) { return; }
+    auto blk =
+      std::make_shared<block>(block_start, block_end - block_start, _options.request_size);
+    blk->unread = block_unread;
+    _blocks.emplace(block_start, blk);
+    new_blocks.push_back(std::move(blk));
+  };
+  for (auto const &range : sorted) {
+    if (find_block(range.first, range.second) != nullptr) { continue; }
+    auto const end = range.first + range.second;
+    if (block_end != block_start && range.first <= block_end + _options.coalesce_gap) {
+      block_end = std::max(block_end, end);
+    } else {
+      flush_block();
+      block_start  = range.first;
+      block_end    = end;
+      block_unread = 0;
+    }
+    block_unread += range.second;
+  }
+  flush_block();
+  if (new_blocks.empty()) { return; }
+
+  // Workers pull the requests in offset order so that the earliest ranges become ready first
+  using part_task = std::pair<std::shared_ptr<block>, size_t>;
+  auto tasks      = std::make_shared<std::vector<part_task>>();
+  for (auto const &blk : new_blocks) {
+    for (size_t part = 0; part < blk->parts_done.size(); ++part) { tasks->emplace_back(blk, part); }
+  }
+  auto next_task         = std::make_shared<std::atomic<size_t>>(0);
+  auto const num_workers = std::min(_options.num_threads, tasks->size());
+  for (size_t i = 0; i < num_workers; ++i) {
+    _workers.emplace_back(
+      std::async(std::launch::async, [source = _source.get(), tasks, next_task]() {
+        for (auto idx = (*next_task)++; idx < tasks->size(); idx = (*next_task)++) {
+          auto &blk        = *(*tasks)[idx].first;
+          auto const part  = (*tasks)[idx].second;
+          auto const start = part * blk.part_size;
+          auto const size  = std::min(blk.part_size, blk.data.size() - start);
+          try {
+            auto const bytes_read =
+              source->host_read(blk.offset + start, size, blk.data.data() + start);
+            CUDF_EXPECTS(bytes_read == size, "Unexpected end of remote source");
+            blk.parts_done[part].set_value();
+          } catch (...) {
+            blk.parts_done[part].set_exception(std::current_exception());
+          }
+        }
+      }));
+  }
+}
+
+std::shared_ptr<remote_source::block> remote_source::find_block(size_t offset, size_t size)
+{
+  auto it = _blocks.upper_bound(offset);
+  if (it == _blocks.begin()) { return nullptr; }
+  --it;
+  return (offset + size <= it->second->end()) ? it->second : nullptr;
+}
+
+void remote_source::release(std::shared_ptr<block> const &blk, size_t size)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  blk->unread -= std::min(blk->unread, size);
+  if (blk->unread == 0) {
+    auto it = _blocks.find(blk->offset);
+    if (it != _blocks.end() && it->second == blk) { _blocks.erase(it); }
+  }
+}
+
+size_t remote_source::read_parallel(size_t offset, size_t size, uint8_t *dst)
+{
+  auto const num_parts = (size + _options.request_size - 1) / _options.request_size;
+  std::vector<size_t> bytes_read(num_parts);
+  parallel_for(
+    num_parts,
+    [&](size_t part) {
+      auto const start = part * _options.request_size;
+      auto const len   = std::min(_options.request_size, size - start);
+      bytes_read[part] = _source->host_read(offset + start, len, dst + start);
+    },
+    _options.num_threads);
+  // A short part ends the data; anything read after it is not contiguous
+  size_t total = 0;
+  for (size_t part = 0; part < num_parts; ++part) {
+    total += bytes_read[part];
+    if (bytes_read[part] != std::min(_options.request_size, size - part * _options.request_size)) {
+      break;
+    }
+  }
+  return total;
+}
+
+std::vector<uint8_t> const &remote_source::tail()
+{
+  std::call_once(_tail_read, [&]() {
+    auto const tail_size = std::min(_size, _options.tail_size);
+    _tail.resize(tail_size);
+    _tail.resize(_source->host_read(_size - tail_size, tail_size, _tail.data()));
+  });
+  return _tail;
+}
+
+std::unique_ptr<datasource::buffer> remote_source::host_read(size_t offset, size_t size)
+{
+  size = std::min(size, _size - std::min(offset, _size));
+  std::shared_ptr<block> blk;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    blk = find_block(offset, size);
+  }
+  if (blk != nullptr) {
+    blk->wait(offset, size);
+    release(blk, size);
+    return std::make_unique<block_buffer>(std::move(blk), offset, size);
+  }
+  std::vector<uint8_t> data(size);
+  data.resize(host_read(offset, size, data.data()));
+  return std::make_unique<vector_buffer>(std::move(data));
+}
+
+size_t remote_source::host_read(size_t offset, size_t size, uint8_t *dst)
+{
+  size = std::min(size, _size - std::min(offset, _size));
+  if (size == 0) { return 0; }
+
+  std::shared_ptr<block> blk;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    blk = find_block(offset, size);
+  }
+  if (blk != nullptr) {
+    blk->wait(offset, size);
+    std::memcpy(dst, blk->data.data() + offset - blk->offset, size);
+    release(blk, size);
+    return size;
+  }
+
+  auto const tail_start = _size - std::min(_size, _options.tail_size);
+  if (offset >= tail_start) {
+    auto const &cached = tail();
+    if (offset - tail_start + size <= cached.size()) {
+      std::memcpy(dst, cached.data() + offset - tail_start, size);
+      return size;
+    }
+  }
+  return read_parallel(offset, size, dst);
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Tuning parameters of a `remote_source`
+ */
+struct remote_source_options {
+  size_t num_threads  = 16;                ///< Maximum number of concurrent requests
+  size_t request_size = 8 * 1024 * 1024;   ///< Size of each request of a large read
+  size_t coalesce_gap = 1024 * 1024;       ///< Largest gap read through to merge two ranges
+  size_t tail_size    = 1024 * 1024;       ///< Bytes cached at the end of the source
+};
+
+/**
+ * @brief Datasource wrapper for sources with a high per-request latency, such as object stores
+ *
+ * Every read of a remote source pays the round trip of a request, so a reader issuing one small
+ * synchronous read per column chunk is latency-bound. This wrapper:
+ * - caches the size of the source and its last `tail_size` bytes, which hold the file footer and
+ *   metadata of the columnar formats, so that parsing the metadata costs a single request;
+ * - on `prefetch()`, merges the ranges that are at most `coalesce_gap` bytes apart into blocks,
+ *   splits the blocks into `request_size` requests and issues them concurrently in the
+ *   background; later reads of the ranges wait for the requests they overlap only;
+ * - splits other large reads into concurrent requests.
+ *
+ * A block is released once all of its ranges have been read. The wrapped source must allow
+ * concurrent `host_read()` calls from multiple threads.
+ */
+class remote_source : public datasource {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param source The wrapped source
+   * @param options Tuning parameters
+   */
+  explicit remote_source(std::unique_ptr<datasource> source,
+                         remote_source_options const &options = remote_source_options{});
+
+  /**
+   * @brief Waits for the outstanding requests
+   */
+  ~remote_source() override;
+
+  void prefetch(std::vector<std::pair<size_t, size_t>> const &ranges) override;
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t *dst) override;
+
+  size_t size() const override { return _size; }
+
+ private:
+  struct block;
+  class block_buffer;
+
+  /**
+   * @brief Returns the block holding the byte range, or nullptr
+   */
+  std::shared_ptr<block> find_block(size_t offset, size_t size);
+
+  /**
+   * @brief Marks a range of a block as read, releasing the block once it is fully read
+   */
+  void release(std::shared_ptr<block> const &blk, size_t size);
+
+  /**
+   * @brief Reads the byte range with up to `num_threads` concurrent requests
+   */
+  size_t read_parallel(size_t offset, size_t size, uint8_t *dst);
+
+  /**
+   * @brief Returns the cached end of the source, reading it on first use
+   */
+  std::vector<uint8_t> const &tail();
+
+  std::unique_ptr<datasource> const _source;
+  remote_source_options const _options;
+  size_t const _size;
+
+  std::once_flag _tail_read;
+  std::vector<uint8_t> _tail;
+
+  std::mutex _mutex;
+  std::map<size_t, std::shared_ptr<block>> _blocks;  ///< Prefetched blocks by starting offset
+  std::vector<std::future<void>> _workers;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "row_mask.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace io {
+namespace detail {
+bool has_row_mask(column_view const &row_mask)
+{
+  if (row_mask.type().id() == type_id::EMPTY) { return false; }
+  CUDF_EXPECTS(row_mask.type().id() == type_id::BOOL8, "Row mask must be a BOOL8 column");
+  return true;
+}
+
+std::vector<uint8_t> row_mask_to_host(column_view const &row_mask, cudaStream_t stream)
+{
+  std::vector<uint8_t> selected(row_mask.size());
+  if (row_mask.size() == 0) { return selected; }
+
+  auto const d_mask = column_device_view::create(row_mask, stream);
+  rmm::device_vector<uint8_t> d_selected(row_mask.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(row_mask.size()),
+                    d_selected.begin(),
+                    [mask = *d_mask] __device__(size_type row) -> uint8_t {
+                      return mask.is_valid(row) && mask.element<bool>(row);
+                    });
+  CUDA_TRY(cudaMemcpyAsync(selected.data(),
+                           d_selected.data().get(),
+                           selected.size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return selected;
+}
+
+std::unique_ptr<table> gather_rows(table_view const &input,
+                                   std::vector<size_type> const &rows,
+                                   rmm::mr::device_memory_resource *mr,
+                                   cudaStream_t stream)
+{
+  rmm::device_vector<size_type> d_rows(rows.size());
+  if (!rows.empty()) {
+    CUDA_TRY(cudaMemcpyAsync(d_rows.data().get(),
+                             rows.data(),
+                             rows.size() * sizeof(size_type),
+                             cudaMemcpyHostToDevice,
+                             stream));
+  }
+  column_view const gather_map(
+    data_type{type_id::INT32}, static_cast<size_type>(rows.size()), d_rows.data().get());
+  return cudf::detail::gather(input,
+                              gather_map,
+                              cudf::detail::out_of_bounds_policy::NULLIFY,
+                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                              mr,
+                              stream);
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
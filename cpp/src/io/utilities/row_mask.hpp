@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Returns whether a reader was given a row mask to apply
+ *
+ * @throw cudf::logic_error if the mask is set but is not a BOOL8 column
+ */
+bool has_row_mask(column_view const &row_mask);
+
+/**
+ * @brief Copies a row mask to host memory, with null rows as not selected
+ *
+ * The readers plan the pages or stripes to decode from the mask on the host.
+ *
+ * @param row_mask BOOL8 column with one value per row
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return One byte per row, nonzero if the row is selected
+ */
+std::vector<uint8_t> row_mask_to_host(column_view const &row_mask, cudaStream_t stream);
+
+/**
+ * @brief Gathers the given rows of a table
+ *
+ * @param input Table to gather from
+ * @param rows Host list of the row indices to gather, in output order
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> gather_rows(table_view const &input,
+                                   std::vector<size_type> const &rows,
+                                   rmm::mr::device_memory_resource *mr,
+                                   cudaStream_t stream);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
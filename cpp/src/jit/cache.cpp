@@ -25,6 +25,8 @@
 #include <boost/filesystem.hpp>
 
 #include <cuda.h>
+#include <cstdint>
+#include <string>
 
 namespace cudf {
 namespace jit {
@@ -85,12 +87,96 @@ boost::filesystem::path getCacheDir()
   return kernel_cache_path;
 }
 
+std::string getDeviceArch()
+{
+  int device = 0;
+  int major  = 0;
+  int minor  = 0;
+  CUDA_TRY(cudaGetDevice(&device));
+  CUDA_TRY(cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor, device));
+  CUDA_TRY(cudaDeviceGetAttribute(&minor, cudaDevAttrComputeCapabilityMinor, device));
+  return "sm_" + std::to_string(major * 10 + minor);
+}
+
+cubin_kernel::cubin_kernel(std::string cubin, std::string mangled_name)
+  : _cubin{std::move(cubin)}, _mangled_name{std::move(mangled_name)}
+{
+}
+
+cubin_kernel::cubin_kernel(cubin_kernel&& other)
+  : _cubin{std::move(other._cubin)},
+    _mangled_name{std::move(other._mangled_name)},
+    _module{other._module},
+    _function{other._function}
+{
+  other._module   = nullptr;
+  other._function = nullptr;
+}
+
+cubin_kernel::~cubin_kernel()
+{
+  if (_module != nullptr) { cuModuleUnload(_module); }
+}
+
+cubin_kernel cubin_kernel::link(jitify::experimental::KernelInstantiation const& instantiation)
+{
+  std::string const& ptx = instantiation.ptx();
+
+  CUlinkState link_state;
+  CUDF_EXPECTS(cuLinkCreate(0, nullptr, nullptr, &link_state) == CUDA_SUCCESS,
+               "Failed to create JIT linker");
+  auto result = cuLinkAddData(link_state,
+                              CU_JIT_INPUT_PTX,
+                              const_cast<char*>(ptx.c_str()),
+                              ptx.size() + 1,
+                              "kernel.ptx",
+                              0,
+                              nullptr,
+                              nullptr);
+
+  void* cubin       = nullptr;
+  size_t cubin_size = 0;
+  if (result == CUDA_SUCCESS) { result = cuLinkComplete(link_state, &cubin, &cubin_size); }
+  // The cubin is owned by the linker, copy it before destroying the linker
+  std::string linked(static_cast<char const*>(cubin), cubin != nullptr ? cubin_size : 0);
+  cuLinkDestroy(link_state);
+  CUDF_EXPECTS(result == CUDA_SUCCESS, "Failed to link JIT kernel");
+
+  return cubin_kernel{std::move(linked), instantiation.mangled_name()};
+}
+
+std::string cubin_kernel::serialize() const { return _mangled_name + '\n' + _cubin; }
+
+cubin_kernel cubin_kernel::deserialize(std::string const& serialized)
+{
+  auto const name_end = serialized.find('\n');
+  CUDF_EXPECTS(name_end != std::string::npos, "Invalid serialized cubin");
+  return cubin_kernel{serialized.substr(name_end + 1), serialized.substr(0, name_end)};
+}
+
+CUfunction cubin_kernel::function()
+{
+  if (_function == nullptr) {
+    CUDF_EXPECTS(cuModuleLoadData(&_module, _cubin.data()) == CUDA_SUCCESS,
+                 "Failed to load JIT kernel binary");
+    CUDF_EXPECTS(cuModuleGetFunction(&_function, _module, _mangled_name.c_str()) == CUDA_SUCCESS,
+                 "JIT kernel function not found in binary");
+  }
+  return _function;
+}
+
 cudfJitCache::cudfJitCache() {}
 
 cudfJitCache::~cudfJitCache() {}
 
-std::mutex cudfJitCache::_kernel_cache_mutex;
-std::mutex cudfJitCache::_program_cache_mutex;
+std::mutex cudfJitCache::_file_cache_mutex;
+
+std::string cudfJitCache::contextKey(std::string const& name)
+{
+  CUcontext c;
+  cuCtxGetCurrent(&c);
+  return std::to_string(reinterpret_cast<std::uintptr_t>(c)) + ':' + name;
+}
 
 named_prog<jitify::experimental::Program> cudfJitCache::getProgram(
   std::string const& prog_name,
@@ -99,10 +185,7 @@ named_prog<jitify::experimental::Program> cudfJitCache::getProgram(
   std::vector<std::string> const& given_options,
   jitify::experimental::file_callback_type file_callback)
 {
-  // Lock for thread safety
-  std::lock_guard<std::mutex> lock(_program_cache_mutex);
-
-  return getCached(prog_name, program_map, [&]() {
+  return getCached(prog_name, prog_name, program_cache, [&]() {
     CUDF_EXPECTS(not cuda_source.empty(), "Program not found in cache, Needs source string.");
     return jitify::experimental::Program(cuda_source, given_headers, given_options, file_callback);
   });
@@ -113,9 +196,6 @@ named_prog<jitify::experimental::KernelInstantiation> cudfJitCache::getKernelIns
   named_prog<jitify::experimental::Program> const& named_program,
   std::vector<std::string> const& arguments)
 {
-  // Lock for thread safety
-  std::lock_guard<std::mutex> lock(_kernel_cache_mutex);
-
   std::string prog_name                  = std::get<0>(named_program);
   jitify::experimental::Program& program = *std::get<1>(named_program);
 
@@ -123,16 +203,27 @@ named_prog<jitify::experimental::KernelInstantiation> cudfJitCache::getKernelIns
   std::string kern_inst_name = prog_name + '.' + kern_name;
   for (auto&& arg : arguments) kern_inst_name += '_' + arg;
 
-  CUcontext c;
-  cuCtxGetCurrent(&c);
-
-  auto& kernel_inst_map = kernel_inst_context_map[c];
-
-  return getCached(kern_inst_name, kernel_inst_map, [&]() {
+  return getCached(kern_inst_name, contextKey(kern_inst_name), kernel_inst_cache, [&]() {
     return program.kernel(kern_name).instantiate(arguments);
   });
 }
 
+named_prog<cubin_kernel> cudfJitCache::getKernel(
+  std::string const& kern_name,
+  named_prog<jitify::experimental::Program> const& named_program,
+  std::vector<std::string> const& arguments)
+{
+  // Make binary name e.g. "prog_binop.kernel_v_v_int_int_long int_Add.sm_70.cubin"
+  std::string cubin_name = std::get<0>(named_program) + '.' + kern_name;
+  for (auto&& arg : arguments) cubin_name += '_' + arg;
+  cubin_name += '.' + getDeviceArch() + ".cubin";
+
+  return getCached(cubin_name, contextKey(cubin_name), cubin_cache, [&]() {
+    auto instantiation = getKernelInstantiation(kern_name, named_program, arguments);
+    return cubin_kernel::link(*std::get<1>(instantiation));
+  });
+}
+
 // Another overload for getKernelInstantiation which might be useful to get
 // kernel instantiations in one step
 // ------------------------------------------------------------------------
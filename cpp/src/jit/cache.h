@@ -20,8 +20,12 @@
 #include <boost/filesystem.hpp>
 #include <cudf/utilities/error.hpp>
 #include <jitify.hpp>
+#include <array>
+#include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 
@@ -44,6 +48,132 @@ using named_prog = std::pair<std::string, std::shared_ptr<Tv>>;
  **/
 boost::filesystem::path getCacheDir();
 
+/**
+ * @brief Get the name of the architecture of the current device, e.g. `sm_70`.
+ **/
+std::string getDeviceArch();
+
+/**
+ * @brief A fully linked kernel binary (cubin) for one kernel instantiation
+ *
+ * The module is loaded into the current context the first time the kernel function is requested,
+ * so a `cubin_kernel` must only be used with the context it was first used in. Loading is not
+ * thread safe: `cudfJitCache` loads the modules of the kernels it caches before sharing them.
+ **/
+class cubin_kernel {
+ public:
+  cubin_kernel(std::string cubin, std::string mangled_name);
+  cubin_kernel(cubin_kernel&& other);
+  cubin_kernel(cubin_kernel const&) = delete;
+  cubin_kernel& operator=(cubin_kernel&&) = delete;
+  cubin_kernel& operator=(cubin_kernel const&) = delete;
+  ~cubin_kernel();
+
+  /**
+   * @brief Link the PTX of a kernel instantiation into a cubin for the current device
+   *
+   * @param instantiation JIT compiled kernel instantiation
+   * @return cubin_kernel containing the linked binary
+   **/
+  static cubin_kernel link(jitify::experimental::KernelInstantiation const& instantiation);
+
+  /**
+   * @brief Serialize the mangled kernel name and the cubin to a string
+   **/
+  std::string serialize() const;
+
+  /**
+   * @brief Create a cubin_kernel from a string returned by `serialize()`
+   **/
+  static cubin_kernel deserialize(std::string const& serialized);
+
+  /**
+   * @brief Get the kernel function, loading the cubin into the current context if needed
+   **/
+  CUfunction function();
+
+ private:
+  std::string _cubin;
+  std::string _mangled_name;
+  CUmodule _module     = nullptr;
+  CUfunction _function = nullptr;
+};
+
+/**
+ * @brief A thread safe map from names to the objects built from them
+ *
+ * The map is split in shards, each guarded by its own reader/writer lock, so that the lookups of
+ * cached objects by many threads take shared locks spread over the shards instead of one mutex.
+ *
+ * An object missing from the map is built by the first thread looking it up, outside of the
+ * locks, and the threads looking it up meanwhile wait for that build instead of repeating it. A
+ * failed build is rethrown to all of them and removed from the map, so that the next lookup
+ * builds the object again.
+ **/
+template <typename T>
+class concurrent_cache {
+ public:
+  /**
+   * @brief Get the object of `key`, building it with `build()` if it is not cached
+   *
+   * @param key    name of the object
+   * @param build  function returning a `std::shared_ptr<T>` to the built object
+   * @return  The cached or built object
+   **/
+  template <typename BuildFunc>
+  std::shared_ptr<T> get_or_build(std::string const& key, BuildFunc build)
+  {
+    auto& shard = shard_of(key);
+    {
+      std::shared_lock<std::shared_timed_mutex> lock(shard.mutex);
+      auto it = shard.map.find(key);
+      if (it != shard.map.end()) { return it->second.get(); }
+    }
+
+    std::promise<std::shared_ptr<T>> promise;
+    std::shared_future<std::shared_ptr<T>> pending;
+    {
+      std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+      auto it = shard.map.find(key);
+      if (it != shard.map.end()) {
+        pending = it->second;
+      } else {
+        shard.map.emplace(key, promise.get_future().share());
+      }
+    }
+    // Another thread is building the object
+    if (pending.valid()) { return pending.get(); }
+
+    try {
+      auto object = build();
+      promise.set_value(object);
+      return object;
+    } catch (...) {
+      {
+        std::lock_guard<std::shared_timed_mutex> lock(shard.mutex);
+        shard.map.erase(key);
+      }
+      promise.set_exception(std::current_exception());
+      throw;
+    }
+  }
+
+ private:
+  struct shard {
+    std::shared_timed_mutex mutex;
+    std::unordered_map<std::string, std::shared_future<std::shared_ptr<T>>> map;
+  };
+
+  static constexpr std::size_t num_shards = 16;
+
+  shard& shard_of(std::string const& key)
+  {
+    return _shards[std::hash<std::string>{}(key) % num_shards];
+  }
+
+  std::array<shard, num_shards> _shards;
+};
+
 class cudfJitCache {
  public:
   /**
@@ -67,6 +197,9 @@ class cudfJitCache {
    * Searches an internal in-memory cache and file based cache for the kernel
    * and if not found, JIT compiles and returns the kernel
    *
+   * All the getters are thread safe. Lookups of cached objects do not serialize threads, and
+   * concurrent lookups of a missing object compile it only once.
+   *
    * @param kern_name  name of kernel to return
    * @param program    Jitify preprocessed program to get the kernel from
    * @param arguments  template arguments for kernel in vector of strings
@@ -77,6 +210,23 @@ class cudfJitCache {
     named_prog<jitify::experimental::Program> const& program,
     std::vector<std::string> const& arguments);
 
+  /**
+   * @brief Get the linked kernel binary for the current device
+   *
+   * Searches an internal in-memory cache and file based cache for a cubin of the kernel compiled
+   * for the architecture of the current device. If not found, the kernel instantiation is
+   * retrieved using `getKernelInstantiation` and linked, and the cubin is saved to the file cache.
+   * Loading a cached cubin requires neither NVRTC nor PTX compilation.
+   *
+   * @param kern_name  name of kernel to return
+   * @param program    Jitify preprocessed program to get the kernel from
+   * @param arguments  template arguments for kernel in vector of strings
+   * @return  Pair of string kernel identifier and linked kernel object
+   **/
+  named_prog<cubin_kernel> getKernel(std::string const& kern_name,
+                                     named_prog<jitify::experimental::Program> const& program,
+                                     std::vector<std::string> const& arguments);
+
   /**
    * @brief Get the Jitify preprocessed Program object
    *
@@ -99,12 +249,10 @@ class cudfJitCache {
     jitify::experimental::file_callback_type file_callback = nullptr);
 
  private:
-  template <typename Tv>
-  using umap_str_shptr = std::unordered_map<std::string, std::shared_ptr<Tv>>;
-
-  std::unordered_map<CUcontext, umap_str_shptr<jitify::experimental::KernelInstantiation>>
-    kernel_inst_context_map;
-  umap_str_shptr<jitify::experimental::Program> program_map;
+  // Kernel instantiations and cubins are keyed by context and name
+  concurrent_cache<jitify::experimental::KernelInstantiation> kernel_inst_cache;
+  concurrent_cache<cubin_kernel> cubin_cache;
+  concurrent_cache<jitify::experimental::Program> program_cache;
 
   /*
     Even though this class can be used as a non-singleton, the file cache
@@ -112,10 +260,10 @@ class cudfJitCache {
     prevent multiple processes from accessing the file but are ineffective in
     preventing multiple threads from doing so as the lock is shared by the
     entire process.
-    Therefore the mutexes are static.
+    Therefore the mutex is static. It is only held while reading or writing a
+    file, not while compiling.
     */
-  static std::mutex _kernel_cache_mutex;
-  static std::mutex _program_cache_mutex;
+  static std::mutex _file_cache_mutex;
 
  private:
   /**
@@ -162,20 +310,33 @@ class cudfJitCache {
   };
 
  private:
+  /**
+   * @brief Make the key of an object of the current context in the in-memory caches
+   **/
+  static std::string contextKey(std::string const& name);
+
+  /**
+   * @brief Prepare a deserialized object to be shared by threads
+   **/
+  static void prepare(jitify::experimental::Program&) {}
+  static void prepare(jitify::experimental::KernelInstantiation&) {}
+  static void prepare(cubin_kernel& kernel) { kernel.function(); }
+
   template <typename T, typename FallbackFunc>
-  named_prog<T> getCached(std::string const& name, umap_str_shptr<T>& map, FallbackFunc func)
+  named_prog<T> getCached(std::string const& name,
+                          std::string const& key,
+                          concurrent_cache<T>& cache,
+                          FallbackFunc func)
   {
-    // Find memory cached T object
-    auto it = map.find(name);
-    if (it != map.end()) {
-      return std::make_pair(name, it->second);
-    } else {  // Find file cached T object
+    // Find memory cached T object, or else file cached T object
+    auto program = cache.get_or_build(key, [&]() {
       bool successful_read = false;
       std::string serialized;
 #if defined(JITIFY_USE_CACHE)
       boost::filesystem::path cache_dir = getCacheDir();
       if (not cache_dir.empty()) {
         boost::filesystem::path file_name = cache_dir / name;
+        std::lock_guard<std::mutex> lock(_file_cache_mutex);
         cacheFile file{file_name.string()};
         serialized      = file.read();
         successful_read = file.is_read_successful();
@@ -187,16 +348,18 @@ class cudfJitCache {
 #if defined(JITIFY_USE_CACHE)
         if (not cache_dir.empty()) {
           boost::filesystem::path file_name = cache_dir / name;
+          std::lock_guard<std::mutex> lock(_file_cache_mutex);
           cacheFile file{file_name.string()};
           file.write(serialized);
         }
 #endif
       }
       // Add deserialized T to cache and return
-      auto program = std::make_shared<T>(T::deserialize(serialized));
-      map[name]    = program;
-      return std::make_pair(name, program);
-    }
+      auto object = std::make_shared<T>(T::deserialize(serialized));
+      prepare(*object);
+      return object;
+    });
+    return std::make_pair(name, program);
   }
 };
 
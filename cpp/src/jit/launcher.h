@@ -26,6 +26,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace cudf {
 namespace jit {
@@ -78,29 +79,69 @@ class launcher {
   launcher& set_kernel_inst(const std::string& kernel_name,
                             const std::vector<std::string>& arguments)
   {
-    kernel_inst = cache_instance.getKernelInstantiation(kernel_name, program, arguments);
+    kernel_inst = cache_instance.getKernel(kernel_name, program, arguments);
     return *this;
   }
 
   /**
-   * @brief Handle the Jitify API to launch using information
-   *  contained in the members of `this`
+   * @brief Launch the kernel with a 1D configuration that maximizes occupancy
    *
    * @tparam All parameters to launch the kernel
    */
   template <typename... Args>
   void launch(Args... args)
   {
-    get_kernel().configure_1d_max_occupancy(0, 0, 0, stream).launch(args...);
+    void* kernel_args[] = {&args...};
+    launch_kernel(kernel_args, 0);
+  }
+
+  /**
+   * @brief Launch the kernel with a 1D configuration that maximizes occupancy
+   *
+   * Unlike `launch()`, takes pointers to the arguments, so that the number of arguments of a
+   * variadic kernel can be decided at runtime.
+   *
+   * @param kernel_args Pointers to the arguments of the kernel
+   * @param shared_memory_bytes Dynamic shared memory of each block, in bytes
+   */
+  void launch_with_args(std::vector<void*>& kernel_args, size_t shared_memory_bytes = 0)
+  {
+    launch_kernel(kernel_args.data(), shared_memory_bytes);
   }
 
  private:
+  void launch_kernel(void** kernel_args, size_t shared_memory_bytes)
+  {
+    CUfunction function = get_kernel().function();
+    int grid_size       = 0;
+    int block_size      = 0;
+    CUDF_EXPECTS(cuOccupancyMaxPotentialBlockSize(&grid_size,
+                                                  &block_size,
+                                                  function,
+                                                  nullptr,
+                                                  shared_memory_bytes,
+                                                  0) == CUDA_SUCCESS,
+                 "Failed to compute the JIT kernel launch configuration");
+    CUDF_EXPECTS(cuLaunchKernel(function,
+                                grid_size,
+                                1,
+                                1,
+                                block_size,
+                                1,
+                                1,
+                                shared_memory_bytes,
+                                stream,
+                                kernel_args,
+                                nullptr) == CUDA_SUCCESS,
+                 "JIT kernel launch failed");
+  }
+
   cudf::jit::cudfJitCache& cache_instance;
   cudf::jit::named_prog<jitify::experimental::Program> program;
-  cudf::jit::named_prog<jitify::experimental::KernelInstantiation> kernel_inst;
+  cudf::jit::named_prog<cudf::jit::cubin_kernel> kernel_inst;
   cudaStream_t stream;
 
-  jitify::experimental::KernelInstantiation& get_kernel() { return *std::get<1>(kernel_inst); }
+  cudf::jit::cubin_kernel& get_kernel() { return *std::get<1>(kernel_inst); }
 };
 
 }  // namespace jit
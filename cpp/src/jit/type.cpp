@@ -75,6 +75,8 @@ std::string get_type_name(data_type type)
 
     case type_id::LIST: return CUDF_STRINGIFY(List);
 
+    case type_id::STRUCT: return CUDF_STRINGIFY(Struct);
+
     default: break;
   }
 
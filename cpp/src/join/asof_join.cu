@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include "join_common_utils.hpp"
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+using gather_map_pair = std::pair<std::unique_ptr<column>, std::unique_ptr<column>>;
+
+/**
+ * @brief Returns the integer representation of an `on` key
+ *
+ * The representation is returned as a `uint64_t`, so that the difference of the representations of
+ * two keys `a >= b` is their exact distance for every key type, whether signed or not.
+ */
+template <typename T, std::enable_if_t<cudf::is_index_type<T>()>* = nullptr>
+__device__ uint64_t key_rep(T key)
+{
+  return static_cast<uint64_t>(key);
+}
+
+template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+__device__ uint64_t key_rep(T key)
+{
+  return static_cast<uint64_t>(key.time_since_epoch().count());
+}
+
+template <typename T, std::enable_if_t<cudf::is_duration<T>()>* = nullptr>
+__device__ uint64_t key_rep(T key)
+{
+  return static_cast<uint64_t>(key.count());
+}
+
+/**
+ * @brief Returns the first index of `[begin, end)` for which `pred` is false, `pred` being true
+ * for a prefix of the range
+ */
+template <typename Predicate>
+__device__ size_type partition_point(size_type begin, size_type end, Predicate pred)
+{
+  while (begin < end) {
+    auto const mid = begin + (end - begin) / 2;
+    if (pred(mid)) {
+      begin = mid + 1;
+    } else {
+      end = mid;
+    }
+  }
+  return begin;
+}
+
+/**
+ * @brief Finds the right row matched with each left row
+ *
+ * The right rows are visited through `right_order`, which sorts them by their `by` keys and keeps
+ * the rows of a group in their input order, that is sorted by `on`. The group of a left row and
+ * its match within the group are both found by binary search.
+ */
+template <typename T, bool has_nulls>
+struct asof_match_fn {
+  row_lexicographic_comparator<has_nulls> left_less;   ///< left row < right row
+  row_lexicographic_comparator<has_nulls> right_less;  ///< right row < left row
+  size_type const* right_order;  ///< Sorted order of the right rows, or nullptr for identity
+  size_type num_right;
+  T const* left_on;
+  T const* right_on;
+  bitmask_type const* left_valid;  ///< Rows without null `by` keys, or nullptr if all match
+  asof_direction direction;
+  uint64_t tolerance;
+
+  __device__ size_type right_row(size_type idx) const
+  {
+    return right_order == nullptr ? idx : right_order[idx];
+  }
+
+  __device__ size_type operator()(size_type left_row) const
+  {
+    if (left_valid != nullptr && not bit_is_set(left_valid, left_row)) { return JoinNoneValue; }
+    auto const group_begin = partition_point(
+      0, num_right, [&](size_type idx) { return right_less(right_row(idx), left_row); });
+    auto const group_end   = partition_point(group_begin, num_right, [&](size_type idx) {
+      return not left_less(left_row, right_row(idx));
+    });
+
+    auto const key = left_on[left_row];
+    // The rows of the group whose keys are less than, and not greater than, the left key
+    auto const less_end = partition_point(
+      group_begin, group_end, [&](size_type idx) { return right_on[right_row(idx)] < key; });
+    auto const not_greater_end = partition_point(
+      less_end, group_end, [&](size_type idx) { return not(key < right_on[right_row(idx)]); });
+
+    auto const key_bits = key_rep(key);
+    auto backward       = JoinNoneValue;
+    auto backward_dist  = uint64_t{0};
+    if (direction != asof_direction::FORWARD && not_greater_end > group_begin) {
+      backward      = right_row(not_greater_end - 1);
+      backward_dist = key_bits - key_rep(right_on[backward]);
+    }
+    auto forward      = JoinNoneValue;
+    auto forward_dist = uint64_t{0};
+    if (direction != asof_direction::BACKWARD && less_end < group_end) {
+      forward      = right_row(less_end);
+      forward_dist = key_rep(right_on[forward]) - key_bits;
+    }
+
+    if (backward != JoinNoneValue && (forward == JoinNoneValue || backward_dist <= forward_dist)) {
+      return backward_dist <= tolerance ? backward : JoinNoneValue;
+    }
+    if (forward != JoinNoneValue) { return forward_dist <= tolerance ? forward : JoinNoneValue; }
+    return JoinNoneValue;
+  }
+};
+
+/**
+ * @brief Type-dispatched functor writing the right gather map of an as-of join
+ */
+struct asof_join_dispatch {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_index_type<T>() or cudf::is_chrono<T>();
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  void operator()(table_view const& left_by,
+                  column_view const& left_on,
+                  table_view const& right_by,
+                  column_view const& right_on,
+                  size_type const* right_order,
+                  bitmask_type const* left_valid,
+                  asof_direction direction,
+                  uint64_t tolerance,
+                  size_type* output,
+                  cudaStream_t stream)
+  {
+    auto const d_left_by  = table_device_view::create(left_by, stream);
+    auto const d_right_by = table_device_view::create(right_by, stream);
+    auto const nullable   = has_nulls(left_by) or has_nulls(right_by);
+    auto const begin      = thrust::make_counting_iterator<size_type>(0);
+    auto const end        = begin + left_on.size();
+    auto launch           = [&](auto nulls_tag) {
+      constexpr bool nulls = decltype(nulls_tag)::value;
+      asof_match_fn<T, nulls> fn{row_lexicographic_comparator<nulls>{*d_left_by, *d_right_by},
+                                 row_lexicographic_comparator<nulls>{*d_right_by, *d_left_by},
+                                 right_order,
+                                 right_on.size(),
+                                 left_on.data<T>(),
+                                 right_on.data<T>(),
+                                 left_valid,
+                                 direction,
+                                 tolerance};
+      thrust::transform(rmm::exec_policy(stream)->on(stream), begin, end, output, fn);
+    };
+    if (nullable) {
+      launch(std::true_type{});
+    } else {
+      launch(std::false_type{});
+    }
+  }
+
+  template <typename T, typename... Args, std::enable_if_t<not is_supported<T>()>* = nullptr>
+  void operator()(Args&&...)
+  {
+    CUDF_FAIL("As-of join keys must be of an integral, timestamp or duration type");
+  }
+};
+
+}  // namespace
+
+gather_map_pair asof_join(table_view const& left_by,
+                          column_view const& left_on,
+                          table_view const& right_by,
+                          column_view const& right_on,
+                          asof_direction direction,
+                          int64_t tolerance,
+                          null_equality compare_nulls,
+                          rmm::mr::device_memory_resource* mr,
+                          cudaStream_t stream)
+{
+  CUDF_EXPECTS(left_by.num_columns() == right_by.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(std::equal(std::cbegin(left_by),
+                          std::cend(left_by),
+                          std::cbegin(right_by),
+                          std::cend(right_by),
+                          [](auto const& l, auto const& r) { return l.type() == r.type(); }),
+               "Mismatch in joining column data types");
+  CUDF_EXPECTS(left_by.num_columns() == 0 || left_by.num_rows() == left_on.size(),
+               "Mismatch in number of left rows");
+  CUDF_EXPECTS(right_by.num_columns() == 0 || right_by.num_rows() == right_on.size(),
+               "Mismatch in number of right rows");
+  CUDF_EXPECTS(left_on.type() == right_on.type(), "Mismatch in as-of key data types");
+  CUDF_EXPECTS(not left_on.has_nulls() && not right_on.has_nulls(),
+               "As-of keys must not contain nulls");
+  CUDF_EXPECTS(tolerance >= 0, "As-of join tolerance must not be negative");
+
+  auto const num_left = left_on.size();
+  gather_map_pair maps{
+    make_numeric_column(data_type(type_id::INT32), num_left, mask_state::UNALLOCATED, stream, mr),
+    make_numeric_column(data_type(type_id::INT32), num_left, mask_state::UNALLOCATED, stream, mr)};
+  if (num_left == 0) { return maps; }
+  auto left_indices = maps.first->mutable_view();
+  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                   left_indices.begin<size_type>(),
+                   left_indices.end<size_type>());
+
+  // Rows of equal `by` keys become a contiguous range of the right order, still sorted by `on`
+  std::unique_ptr<column> right_order;
+  if (right_by.num_columns() > 0 && right_on.size() > 0) {
+    right_order =
+      detail::stable_sorted_order(right_by, {}, {}, rmm::mr::get_default_resource(), stream);
+  }
+  rmm::device_buffer left_valid;
+  if (compare_nulls == null_equality::UNEQUAL && has_nulls(left_by)) {
+    left_valid = bitmask_and(left_by, rmm::mr::get_default_resource(), stream);
+  }
+
+  type_dispatcher(left_on.type(),
+                  asof_join_dispatch{},
+                  left_by,
+                  left_on,
+                  right_by,
+                  right_on,
+                  right_order ? right_order->view().data<size_type>() : nullptr,
+                  left_valid.is_empty() ? nullptr
+                                        : static_cast<bitmask_type const*>(left_valid.data()),
+                  direction,
+                  static_cast<uint64_t>(tolerance),
+                  maps.second->mutable_view().data<size_type>(),
+                  stream);
+  CHECK_CUDA(stream);
+  return maps;
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> asof_join(
+  table_view const& left_by,
+  column_view const& left_on,
+  table_view const& right_by,
+  column_view const& right_on,
+  asof_direction direction,
+  int64_t tolerance,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::asof_join(
+    left_by, left_on, right_by, right_on, direction, tolerance, compare_nulls, mr, stream);
+}
+
+}  // namespace cudf
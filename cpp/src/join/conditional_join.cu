@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ast/evaluator.cuh>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/join.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include "join_common_utils.hpp"
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+using ast::detail::is_true;
+using ast::detail::plan_view;
+using ast::detail::value;
+
+/**
+ * @brief Collects the equalities between a left and a right column among the top-level
+ * conjunctions of a predicate
+ *
+ * Only integer and BOOL8 columns are collected, whose hash join matches exactly the pairs for
+ * which the equality is true.
+ */
+void find_equality_keys(ast::expression const& expr,
+                        table_view const& left,
+                        table_view const& right,
+                        std::vector<size_type>& left_on,
+                        std::vector<size_type>& right_on)
+{
+  auto const op = dynamic_cast<ast::operation const*>(&expr);
+  if (op == nullptr) { return; }
+  auto const& operands = op->get_operands();
+  if (op->get_operator() == ast::ast_operator::LOGICAL_AND) {
+    for (auto const& operand : operands) {
+      find_equality_keys(operand.get(), left, right, left_on, right_on);
+    }
+    return;
+  }
+  if (op->get_operator() != ast::ast_operator::EQUAL) { return; }
+  auto lhs = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+  auto rhs = dynamic_cast<ast::column_reference const*>(&operands[1].get());
+  if (lhs == nullptr || rhs == nullptr || lhs->get_table() == rhs->get_table()) { return; }
+  if (lhs->get_table() == ast::table_reference::RIGHT) { std::swap(lhs, rhs); }
+  auto const type = left.column(lhs->get_column_index()).type();
+  if (type != right.column(rhs->get_column_index()).type() || is_floating_point(type)) { return; }
+  left_on.push_back(lhs->get_column_index());
+  right_on.push_back(rhs->get_column_index());
+}
+
+/**
+ * @brief Counts the matches of each row of the outer table in the inner table
+ *
+ * All the threads of a block walk the inner table in the same order, so that each inner row is
+ * read from memory once per block and served from the cache to the other threads.
+ *
+ * @tparam LeftJoin Whether rows without a match count as one output row
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param plan The linearized predicate
+ * @param swapped Whether the right table is the outer table
+ * @param counts Number of output rows of each outer row
+ */
+template <bool LeftJoin>
+__global__ void count_matches(table_device_view left,
+                              table_device_view right,
+                              plan_view plan,
+                              bool swapped,
+                              size_type* counts)
+{
+  extern __shared__ int64_t shared_plan[];
+  auto const staged = ast::detail::stage_plan(plan, shared_plan);
+  value registers[ast::detail::max_intermediates];
+
+  auto const outer_rows = swapped ? right.num_rows() : left.num_rows();
+  auto const inner_rows = swapped ? left.num_rows() : right.num_rows();
+  for (size_type outer = blockIdx.x * blockDim.x + threadIdx.x; outer < outer_rows;
+       outer += blockDim.x * gridDim.x) {
+    size_type count = 0;
+    for (size_type inner = 0; inner < inner_rows; ++inner) {
+      auto const result = swapped
+                            ? evaluate_plan(staged, left, right, inner, outer, registers)
+                            : evaluate_plan(staged, left, right, outer, inner, registers);
+      if (is_true(result, staged.result.type)) { ++count; }
+    }
+    counts[outer] = (LeftJoin && count == 0) ? 1 : count;
+  }
+}
+
+/**
+ * @brief Writes the matches of each row of the outer table at the offsets computed from
+ * `count_matches`
+ *
+ * @copydetails count_matches
+ *
+ * @param offsets Position of the first output row of each outer row
+ * @param left_indices Output left table indices
+ * @param right_indices Output right table indices
+ */
+template <bool LeftJoin>
+__global__ void write_matches(table_device_view left,
+                              table_device_view right,
+                              plan_view plan,
+                              bool swapped,
+                              size_type const* offsets,
+                              size_type* left_indices,
+                              size_type* right_indices)
+{
+  extern __shared__ int64_t shared_plan[];
+  auto const staged = ast::detail::stage_plan(plan, shared_plan);
+  value registers[ast::detail::max_intermediates];
+
+  auto const outer_rows = swapped ? right.num_rows() : left.num_rows();
+  auto const inner_rows = swapped ? left.num_rows() : right.num_rows();
+  auto const outer_out  = swapped ? right_indices : left_indices;
+  auto const inner_out  = swapped ? left_indices : right_indices;
+  for (size_type outer = blockIdx.x * blockDim.x + threadIdx.x; outer < outer_rows;
+       outer += blockDim.x * gridDim.x) {
+    auto position = offsets[outer];
+    for (size_type inner = 0; inner < inner_rows; ++inner) {
+      auto const result = swapped
+                            ? evaluate_plan(staged, left, right, inner, outer, registers)
+                            : evaluate_plan(staged, left, right, outer, inner, registers);
+      if (is_true(result, staged.result.type)) {
+        outer_out[position] = outer;
+        inner_out[position] = inner;
+        ++position;
+      }
+    }
+    if (LeftJoin && position == offsets[outer]) {
+      outer_out[position] = outer;
+      inner_out[position] = JoinNoneValue;
+    }
+  }
+}
+
+/**
+ * @brief Device functor evaluating the predicate on a pair of row indices
+ */
+struct pair_predicate {
+  table_device_view left;
+  table_device_view right;
+  plan_view plan;
+
+  __device__ bool operator()(thrust::tuple<size_type, size_type> const& rows) const
+  {
+    value registers[ast::detail::max_intermediates];
+    return is_true(ast::detail::evaluate_plan(
+                     plan, left, right, thrust::get<0>(rows), thrust::get<1>(rows), registers),
+                   plan.result.type);
+  }
+};
+
+using gather_map_pair = std::pair<std::unique_ptr<column>, std::unique_ptr<column>>;
+
+gather_map_pair make_gather_maps(size_type size,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream)
+{
+  return std::make_pair(
+    make_numeric_column(data_type(type_id::INT32), size, mask_state::UNALLOCATED, stream, mr),
+    make_numeric_column(data_type(type_id::INT32), size, mask_state::UNALLOCATED, stream, mr));
+}
+
+/**
+ * @brief Computes the join by evaluating the predicate on every pair of rows
+ */
+template <join_kind JoinKind>
+gather_map_pair nested_loop_conditional_join(table_view const& left,
+                                             table_view const& right,
+                                             plan_view const& plan,
+                                             rmm::mr::device_memory_resource* mr,
+                                             cudaStream_t stream)
+{
+  constexpr bool left_join = JoinKind == join_kind::LEFT_JOIN;
+  // The outer loop is split across the threads; for inner joins, make it the larger table
+  bool const swapped     = !left_join && right.num_rows() > left.num_rows();
+  auto const outer_rows  = swapped ? right.num_rows() : left.num_rows();
+  auto const inner_rows  = swapped ? left.num_rows() : right.num_rows();
+  if (outer_rows == 0 || (!left_join && inner_rows == 0)) {
+    return make_gather_maps(0, mr, stream);
+  }
+
+  auto const d_left  = table_device_view::create(left, stream);
+  auto const d_right = table_device_view::create(right, stream);
+  rmm::device_vector<size_type> offsets(outer_rows);
+  grid_1d const grid{outer_rows, DEFAULT_JOIN_BLOCK_SIZE};
+  count_matches<left_join>
+    <<<grid.num_blocks, grid.num_threads_per_block, plan.size(), stream>>>(
+      *d_left, *d_right, plan, swapped, offsets.data().get());
+  CHECK_CUDA(stream);
+
+  auto const total = thrust::reduce(rmm::exec_policy(stream)->on(stream),
+                                    offsets.begin(),
+                                    offsets.end(),
+                                    int64_t{0},
+                                    thrust::plus<int64_t>());
+  CUDF_EXPECTS(total < MAX_JOIN_SIZE, "The join output is too large");
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream), offsets.begin(), offsets.end(), offsets.begin());
+
+  auto maps = make_gather_maps(static_cast<size_type>(total), mr, stream);
+  if (total == 0) { return maps; }
+  write_matches<left_join>
+    <<<grid.num_blocks, grid.num_threads_per_block, plan.size(), stream>>>(
+      *d_left,
+      *d_right,
+      plan,
+      swapped,
+      offsets.data().get(),
+      maps.first->mutable_view().data<size_type>(),
+      maps.second->mutable_view().data<size_type>());
+  CHECK_CUDA(stream);
+  return maps;
+}
+
+/**
+ * @brief Computes the join by hash joining on the equality keys and filtering the candidate
+ * pairs with the predicate
+ */
+template <join_kind JoinKind>
+gather_map_pair hash_conditional_join(table_view const& left,
+                                      table_view const& right,
+                                      std::vector<size_type> const& left_on,
+                                      std::vector<size_type> const& right_on,
+                                      plan_view const& plan,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  // A null key makes the equality null, hence the pair does not match
+  auto const candidates = cudf::inner_join(left.select(left_on),
+                                           right.select(right_on),
+                                           null_equality::UNEQUAL,
+                                           sorted::NO,
+                                           rmm::mr::get_default_resource());
+  auto const num_candidates = candidates.first->size();
+  auto const d_left         = table_device_view::create(left, stream);
+  auto const d_right        = table_device_view::create(right, stream);
+
+  auto const candidates_begin = thrust::make_zip_iterator(
+    thrust::make_tuple(candidates.first->view().begin<size_type>(),
+                       candidates.second->view().begin<size_type>()));
+  rmm::device_vector<size_type> left_matches(num_candidates);
+  rmm::device_vector<size_type> right_matches(num_candidates);
+  auto const matches_begin = thrust::make_zip_iterator(
+    thrust::make_tuple(left_matches.begin(), right_matches.begin()));
+  auto const matches_end = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                           candidates_begin,
+                                           candidates_begin + num_candidates,
+                                           matches_begin,
+                                           pair_predicate{*d_left, *d_right, plan});
+  auto num_matches = static_cast<size_type>(thrust::distance(matches_begin, matches_end));
+
+  rmm::device_vector<size_type> unmatched;
+  if (JoinKind == join_kind::LEFT_JOIN) {
+    rmm::device_vector<bool> matched(left.num_rows(), false);
+    auto d_matched = matched.data().get();
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     left_matches.begin(),
+                     left_matches.begin() + num_matches,
+                     [d_matched] __device__(size_type row) { d_matched[row] = true; });
+    unmatched.resize(left.num_rows());
+    auto const unmatched_end =
+      thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(left.num_rows()),
+                      unmatched.begin(),
+                      [d_matched] __device__(size_type row) { return !d_matched[row]; });
+    unmatched.resize(thrust::distance(unmatched.begin(), unmatched_end));
+  }
+  auto const num_unmatched = static_cast<size_type>(unmatched.size());
+  CUDF_EXPECTS(static_cast<int64_t>(num_matches) + num_unmatched < MAX_JOIN_SIZE,
+               "The join output is too large");
+
+  auto maps         = make_gather_maps(num_matches + num_unmatched, mr, stream);
+  auto left_output  = maps.first->mutable_view().data<size_type>();
+  auto right_output = maps.second->mutable_view().data<size_type>();
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               left_matches.begin(),
+               left_matches.begin() + num_matches,
+               left_output);
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               right_matches.begin(),
+               right_matches.begin() + num_matches,
+               right_output);
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               unmatched.begin(),
+               unmatched.end(),
+               left_output + num_matches);
+  thrust::fill(rmm::exec_policy(stream)->on(stream),
+               right_output + num_matches,
+               right_output + num_matches + num_unmatched,
+               JoinNoneValue);
+  return maps;
+}
+
+}  // namespace
+
+/**
+ * @brief Computes the gather maps of a join between two tables on a predicate
+ *
+ * @tparam JoinKind The type of join to be performed, INNER_JOIN or LEFT_JOIN
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param predicate The join predicate
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Pair of left and right table gather map columns
+ */
+template <join_kind JoinKind>
+gather_map_pair conditional_join(table_view const& left,
+                                 table_view const& right,
+                                 ast::expression const& predicate,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(left.num_rows() < MAX_JOIN_SIZE, "Left column size is too big");
+  CUDF_EXPECTS(right.num_rows() < MAX_JOIN_SIZE, "Right column size is too big");
+  ast::detail::expression_linearizer const linearizer(predicate, left, right);
+  CUDF_EXPECTS(linearizer.result().type == ast::detail::value_class::BOOL,
+               "The join predicate must be boolean");
+  ast::detail::device_plan const plan(linearizer, stream);
+
+  std::vector<size_type> left_on, right_on;
+  find_equality_keys(predicate, left, right, left_on, right_on);
+  if (!left_on.empty() && left.num_rows() > 0 && right.num_rows() > 0) {
+    return hash_conditional_join<JoinKind>(left, right, left_on, right_on, plan.view(), mr, stream);
+  }
+  return nested_loop_conditional_join<JoinKind>(left, right, plan.view(), mr, stream);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> conditional_inner_join(
+  table_view const& left,
+  table_view const& right,
+  ast::expression const& predicate,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::conditional_join<detail::join_kind::INNER_JOIN>(
+    left, right, predicate, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> conditional_left_join(
+  table_view const& left,
+  table_view const& right,
+  ast::expression const& predicate,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::conditional_join<detail::join_kind::LEFT_JOIN>(
+    left, right, predicate, mr, stream);
+}
+
+}  // namespace cudf
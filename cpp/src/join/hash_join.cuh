@@ -16,8 +16,11 @@
 #pragma once
 
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/scratch_memory.cuh>
+#include <cudf/join.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/structs/detail/flatten.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -26,16 +29,20 @@
 #include "join_common_utils.hpp"
 #include "join_kernels.cuh"
 
+#include <thrust/binary_search.h>
+#include <thrust/fill.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 /**
- * @brief Gives an estimate of the size of the join output produced when
- * joining two tables together.
- *
- * If the two tables are of relatively equal size, then the returned output
- * size will be the exact output size. However, if the probe table is
- * significantly larger than the build table, then we attempt to estimate the
- * output size by using only a subset of the rows in the probe table.
+ * @brief Computes the exact size of the join output produced when probing
+ * the hash table of `build_table` with every row of `probe_table`.
  *
  * @throw cudf::logic_error if JoinKind is not INNER_JOIN or LEFT_JOIN
  *
@@ -46,31 +53,27 @@ namespace detail {
  * @param probe_table The left hand table
  * @param hash_table A hash table built on the build table that maps the index
  * of every row to the hash value of that row.
+ * @param probe_hashes Precomputed hash of each row of `probe_table`, or an empty column to hash
+ * the rows
  * @param compare_nulls Controls whether null join-key values should match or not.
  * @param stream CUDA stream used for device memory operations and kernel launches
  *
- * @return An estimate of the size of the output of the join operation
+ * @return The size of the output of the join operation, which may exceed the maximum column size
  */
 template <join_kind JoinKind, typename multimap_type>
-size_type estimate_join_output_size(table_device_view build_table,
-                                    table_device_view probe_table,
-                                    multimap_type const& hash_table,
-                                    null_equality compare_nulls,
-                                    cudaStream_t stream)
+std::size_t get_join_output_size(table_device_view build_table,
+                                 table_device_view probe_table,
+                                 multimap_type const& hash_table,
+                                 column_view const& probe_hashes,
+                                 null_equality compare_nulls,
+                                 cudaStream_t stream)
 {
   const size_type build_table_num_rows{build_table.num_rows()};
   const size_type probe_table_num_rows{probe_table.num_rows()};
 
-  // If the probe table is significantly larger (5x) than the build table,
-  // then we attempt to only use a subset of the probe table rows to compute an
-  // estimate of the join output size.
-  size_type probe_to_build_ratio{0};
-  if (build_table_num_rows > 0) {
-    probe_to_build_ratio = static_cast<size_type>(
-      std::ceil(static_cast<float>(probe_table_num_rows) / build_table_num_rows));
-  } else {
-    // If the build table is empty, we know exactly how large the output
-    // will be for the different types of joins and can return immediately
+  // If the build table is empty, we know exactly how large the output
+  // will be for the different types of joins and can return immediately
+  if (build_table_num_rows == 0) {
     switch (JoinKind) {
       // Inner join with an empty table will have no output
       case join_kind::INNER_JOIN: return 0;
@@ -82,14 +85,10 @@ size_type estimate_join_output_size(table_device_view build_table,
       default: CUDF_FAIL("Unsupported join type");
     }
   }
-
-  size_type sample_probe_num_rows{probe_table_num_rows};
-  constexpr size_type MAX_RATIO{5};
-  if (probe_to_build_ratio > MAX_RATIO) { sample_probe_num_rows = build_table_num_rows; }
+  if (probe_table_num_rows == 0) { return 0; }
 
   // Allocate storage for the counter used to get the size of the join output
-  size_type h_size_estimate{0};
-  rmm::device_scalar<size_type> size_estimate(0, stream);
+  rmm::device_scalar<unsigned long long> size(0, stream, get_scratch_resource());
 
   CHECK_CUDA(stream);
 
@@ -105,55 +104,93 @@ size_type estimate_join_output_size(table_device_view build_table,
   int num_sms{-1};
   CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev_id));
 
-  // Continue probing with a subset of the probe table until either:
-  // a non-zero output size estimate is found OR
-  // all of the rows in the probe table have been sampled
-  do {
-    sample_probe_num_rows = std::min(sample_probe_num_rows, probe_table_num_rows);
+  row_hash hash_probe{probe_table, probe_hashes};
+  row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
+  // Probe the hash table without actually building the output to simply
+  // find what the size of the output will be.
+  compute_join_output_size<JoinKind, multimap_type, block_size>
+    <<<numBlocks * num_sms, block_size, 0, stream>>>(hash_table,
+                                                     build_table,
+                                                     probe_table,
+                                                     hash_probe,
+                                                     equality,
+                                                     probe_table_num_rows,
+                                                     size.data());
+  CHECK_CUDA(stream);
 
-    size_estimate.set_value(0);
+  return size.value();
+}
 
-    row_hash hash_probe{probe_table};
+/**
+ * @brief Splits the probe table into consecutive row ranges whose join outputs each have at most
+ * `max_output_rows` rows
+ *
+ * The ranges are grown greedily from the exact output size of every probe row. A probe row with
+ * more than `max_output_rows` output rows gets a range of its own.
+ *
+ * @tparam JoinKind The type of join to be performed, INNER_JOIN or LEFT_JOIN
+ * @tparam multimap_type The type of the hash table
+ *
+ * @param build_table The right hand table
+ * @param probe_table The left hand table
+ * @param hash_table A hash table built on the build table
+ * @param probe_hashes Precomputed hash of each row of `probe_table`, or an empty column to hash
+ * the rows
+ * @param max_output_rows The maximum number of output rows of a range
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return The first row of every range but the first, as expected by `cudf::split`
+ */
+template <join_kind JoinKind, typename multimap_type>
+std::vector<size_type> get_join_probe_splits(table_device_view build_table,
+                                             table_device_view probe_table,
+                                             multimap_type const& hash_table,
+                                             column_view const& probe_hashes,
+                                             std::size_t max_output_rows,
+                                             null_equality compare_nulls,
+                                             cudaStream_t stream)
+{
+  size_type const probe_table_num_rows{probe_table.num_rows()};
+  if (probe_table_num_rows == 0) { return {}; }
+
+  // Output rows up to and including each probe row
+  auto row_offsets = make_scratch_vector<std::size_t>(probe_table_num_rows, 0, stream);
+  if (build_table.num_rows() == 0) {
+    // Only a left join has output rows, one per probe row
+    if (JoinKind == join_kind::INNER_JOIN) { return {}; }
+    thrust::fill(scratch_policy(stream)->on(stream), row_offsets.begin(), row_offsets.end(), 1);
+  } else {
+    constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+    detail::grid_1d config(probe_table_num_rows, block_size);
+    row_hash hash_probe{probe_table, probe_hashes};
     row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
-    // Probe the hash table without actually building the output to simply
-    // find what the size of the output will be.
-    compute_join_output_size<JoinKind, multimap_type, block_size>
-      <<<numBlocks * num_sms, block_size, 0, stream>>>(hash_table,
-                                                       build_table,
-                                                       probe_table,
-                                                       hash_probe,
-                                                       equality,
-                                                       sample_probe_num_rows,
-                                                       size_estimate.data());
+    compute_join_row_output_sizes<JoinKind, multimap_type>
+      <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+        hash_table, hash_probe, equality, probe_table_num_rows, row_offsets.data().get());
     CHECK_CUDA(stream);
-
-    // Only in case subset of probe table is chosen,
-    // increase the estimated output size by a factor of the ratio between the
-    // probe and build tables
-    if (sample_probe_num_rows < probe_table_num_rows) {
-      h_size_estimate = size_estimate.value() * probe_to_build_ratio;
-    } else {
-      h_size_estimate = size_estimate.value();
-    }
-
-    // If the size estimate is non-zero, then we have a valid estimate and can break
-    // If sample_probe_num_rows >= probe_table_num_rows, then we've sampled the entire
-    // probe table, in which case the estimate is exact and we can break
-    if ((h_size_estimate > 0) || (sample_probe_num_rows >= probe_table_num_rows)) { break; }
-
-    // If the size estimate is zero, then double the number of sampled rows in the probe
-    // table. Reduce the ratio of the number of probe rows sampled to the number of rows
-    // in the build table by the same factor
-    if (0 == h_size_estimate) {
-      constexpr size_type GROW_RATIO{2};
-      sample_probe_num_rows *= GROW_RATIO;
-      probe_to_build_ratio =
-        static_cast<size_type>(std::ceil(static_cast<float>(probe_to_build_ratio) / GROW_RATIO));
-    }
-
-  } while (true);
-
-  return h_size_estimate;
+  }
+  thrust::inclusive_scan(scratch_policy(stream)->on(stream),
+                         row_offsets.begin(),
+                         row_offsets.end(),
+                         row_offsets.begin());
+
+  std::vector<size_type> splits;
+  size_type range_start    = 0;
+  std::size_t range_offset = 0;  // Output rows before the range
+  while (true) {
+    auto const range_end = thrust::upper_bound(scratch_policy(stream)->on(stream),
+                                               row_offsets.begin() + range_start,
+                                               row_offsets.end(),
+                                               range_offset + max_output_rows) -
+                           row_offsets.begin();
+    auto const split = std::max<size_type>(range_end, range_start + 1);
+    if (split >= probe_table_num_rows) { break; }
+    splits.push_back(split);
+    range_start  = split;
+    range_offset = row_offsets[split - 1];
+  }
+  return splits;
 }
 
 /**
@@ -170,14 +207,214 @@ size_type estimate_join_output_size(table_device_view build_table,
 inline std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>
 get_trivial_left_join_indices(table_view const& left, cudaStream_t stream)
 {
-  rmm::device_vector<size_type> left_indices(left.num_rows());
-  thrust::sequence(
-    rmm::exec_policy(stream)->on(stream), left_indices.begin(), left_indices.end(), 0);
-  rmm::device_vector<size_type> right_indices(left.num_rows());
-  thrust::fill(rmm::exec_policy(stream)->on(stream),
-               right_indices.begin(),
-               right_indices.end(),
-               JoinNoneValue);
+  auto left_indices = make_scratch_vector<size_type>(left.num_rows(), 0, stream);
+  thrust::sequence(scratch_policy(stream)->on(stream), left_indices.begin(), left_indices.end(), 0);
+  auto right_indices = make_scratch_vector<size_type>(left.num_rows(), JoinNoneValue, stream);
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+/**
+ * @brief Returns the number of slots of the hash table built on `build_table_num_rows` rows
+ *
+ * An odd size keeps the buckets spread out when all build row hashes share their low bits, as
+ * they do within one partition of `get_partitioned_join_indices`.
+ */
+inline size_t join_hash_table_size(size_type build_table_num_rows)
+{
+  return compute_hash_table_size(build_table_num_rows) | 1;
+}
+
+/**
+ * @brief Builds the hash table used to probe the join keys of `build_table`.
+ *
+ * @param build_table Table of build side key columns
+ * @param build_hashes Precomputed hash of each row of `build_table`, or an empty column to hash
+ * the rows
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Hash table mapping the hash value of every row of `build_table` to its row index
+ */
+inline std::unique_ptr<multimap_type, std::function<void(multimap_type*)>> build_join_hash_table(
+  table_device_view build_table, column_view const& build_hashes, cudaStream_t stream)
+{
+  const size_type build_table_num_rows{build_table.num_rows()};
+  size_t const hash_table_size = join_hash_table_size(build_table_num_rows);
+
+  auto hash_table = multimap_type::create(hash_table_size,
+                                          true,
+                                          multimap_type::hasher(),
+                                          multimap_type::key_equal(),
+                                          multimap_type::allocator_type(get_scratch_resource()),
+                                          stream);
+
+  // build the hash table
+  if (build_table_num_rows > 0) {
+    row_hash hash_build{build_table, build_hashes};
+    rmm::device_scalar<int> failure(0, stream, get_scratch_resource());
+    constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+    detail::grid_1d config(build_table_num_rows, block_size);
+    build_hash_table<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+      *hash_table, hash_build, build_table_num_rows, failure.data());
+    // Check error code from the kernel
+    if (failure.value() == 1) { CUDF_FAIL("Hash Table insert failure."); }
+  }
+  return hash_table;
+}
+
+/**
+ * @brief Probes the hash table of `build_table` with the rows of `probe_table` and returns the
+ * output indices of the probe and build tables
+ *
+ * @tparam JoinKind The type of join to be performed
+ *
+ * @param build_table Table of build side key columns
+ * @param probe_table Table of probe side key columns
+ * @param hash_table Hash table built on `build_table` by `build_join_hash_table`
+ * @param probe_hashes Precomputed hash of each row of `probe_table`, or an empty column to hash
+ * the rows
+ * @param flip_join_indices Flag that indicates whether the output indices should be flipped, i.e.
+ * the first vector contains the build indices and the second vector the probe indices
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Join output indices vector pair
+ */
+template <join_kind JoinKind>
+std::enable_if_t<(JoinKind == join_kind::INNER_JOIN || JoinKind == join_kind::LEFT_JOIN),
+                 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>>
+probe_join_hash_table(table_device_view build_table,
+                      table_device_view probe_table,
+                      multimap_type const& hash_table,
+                      column_view const& probe_hashes,
+                      bool flip_join_indices,
+                      null_equality compare_nulls,
+                      cudaStream_t stream)
+{
+  auto const output_size = get_join_output_size<JoinKind, multimap_type>(
+    build_table, probe_table, hash_table, probe_hashes, compare_nulls, stream);
+  CUDF_EXPECTS(output_size <= static_cast<std::size_t>(std::numeric_limits<size_type>::max()),
+               "The output of the join exceeds the maximum column size");
+  auto const join_size = static_cast<size_type>(output_size);
+
+  // If the output size is zero, return immediately
+  if (join_size == 0) {
+    return std::make_pair(make_scratch_vector<size_type>(0, 0, stream),
+                          make_scratch_vector<size_type>(0, 0, stream));
+  }
+
+  // The output size is exact, so a single probe pass fills the output
+  rmm::device_scalar<size_type> write_index(0, stream, get_scratch_resource());
+  auto left_indices  = make_scratch_vector<size_type>(join_size, 0, stream);
+  auto right_indices = make_scratch_vector<size_type>(join_size, 0, stream);
+
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  detail::grid_1d config(probe_table.num_rows(), block_size);
+
+  row_hash hash_probe{probe_table, probe_hashes};
+  row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
+  const auto& join_output_l =
+    flip_join_indices ? right_indices.data().get() : left_indices.data().get();
+  const auto& join_output_r =
+    flip_join_indices ? left_indices.data().get() : right_indices.data().get();
+  probe_hash_table<JoinKind, multimap_type, block_size, DEFAULT_JOIN_CACHE_SIZE>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(hash_table,
+                                                                     build_table,
+                                                                     probe_table,
+                                                                     hash_probe,
+                                                                     equality,
+                                                                     join_output_l,
+                                                                     join_output_r,
+                                                                     write_index.data(),
+                                                                     join_size);
+
+  CHECK_CUDA(stream);
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+/**
+ * @brief Joins the probe table to a build table of at most `SHARED_JOIN_MAX_BUILD_ROWS` rows with
+ * per-block hash tables in shared memory and returns the output indices of both tables
+ *
+ * @tparam JoinKind The type of join to be performed
+ *
+ * @param build_table Table of build side key columns
+ * @param probe_table Table of probe side key columns
+ * @param flip_join_indices Flag that indicates whether the output indices should be flipped, i.e.
+ * the first vector contains the build indices and the second vector the probe indices
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Join output indices vector pair
+ */
+template <join_kind JoinKind>
+std::enable_if_t<(JoinKind == join_kind::INNER_JOIN || JoinKind == join_kind::LEFT_JOIN),
+                 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>>
+shared_hash_join_indices(table_device_view build_table,
+                         table_device_view probe_table,
+                         bool flip_join_indices,
+                         null_equality compare_nulls,
+                         cudaStream_t stream)
+{
+  size_type const probe_table_num_rows{probe_table.num_rows()};
+  if (probe_table_num_rows == 0) {
+    return std::make_pair(make_scratch_vector<size_type>(0, 0, stream),
+                          make_scratch_vector<size_type>(0, 0, stream));
+  }
+
+  // Every block builds its own hash table, so the grid is limited to the resident blocks
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  int blocks_per_sm{-1};
+  CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &blocks_per_sm, shared_hash_join<JoinKind, block_size, false>, block_size, 0));
+  int dev_id{-1};
+  CUDA_TRY(cudaGetDevice(&dev_id));
+  int num_sms{-1};
+  CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, dev_id));
+  auto const num_blocks =
+    std::min(blocks_per_sm * num_sms, util::div_rounding_up_safe(probe_table_num_rows, block_size));
+
+  row_hash hash_build{build_table};
+  row_hash hash_probe{probe_table};
+  row_equality equality{probe_table, build_table, compare_nulls == null_equality::EQUAL};
+
+  rmm::device_scalar<unsigned long long> output_size(0, stream, get_scratch_resource());
+  shared_hash_join<JoinKind, block_size, true>
+    <<<num_blocks, block_size, 0, stream>>>(hash_build,
+                                            build_table.num_rows(),
+                                            hash_probe,
+                                            equality,
+                                            probe_table_num_rows,
+                                            output_size.data(),
+                                            nullptr,
+                                            nullptr,
+                                            nullptr);
+  CHECK_CUDA(stream);
+  auto const join_size = output_size.value();
+  CUDF_EXPECTS(join_size <= static_cast<std::size_t>(std::numeric_limits<size_type>::max()),
+               "The output of the join exceeds the maximum column size");
+
+  auto left_indices  = make_scratch_vector<size_type>(join_size, 0, stream);
+  auto right_indices = make_scratch_vector<size_type>(join_size, 0, stream);
+  if (join_size == 0) { return std::make_pair(std::move(left_indices), std::move(right_indices)); }
+
+  rmm::device_scalar<size_type> write_index(0, stream, get_scratch_resource());
+  auto const join_output_l =
+    flip_join_indices ? right_indices.data().get() : left_indices.data().get();
+  auto const join_output_r =
+    flip_join_indices ? left_indices.data().get() : right_indices.data().get();
+  shared_hash_join<JoinKind, block_size, false>
+    <<<num_blocks, block_size, 0, stream>>>(hash_build,
+                                            build_table.num_rows(),
+                                            hash_probe,
+                                            equality,
+                                            probe_table_num_rows,
+                                            nullptr,
+                                            write_index.data(),
+                                            join_output_l,
+                                            join_output_r);
+  CHECK_CUDA(stream);
+
   return std::make_pair(std::move(left_indices), std::move(right_indices));
 }
 
@@ -216,87 +453,127 @@ get_base_hash_join_indices(table_view const& left,
   }
 
   auto build_table = table_device_view::create(right, stream);
-  const size_type build_table_num_rows{build_table->num_rows()};
 
   // Probe with the left table
   auto probe_table = table_device_view::create(left, stream);
 
-  size_t const hash_table_size = compute_hash_table_size(build_table_num_rows);
-
-  auto hash_table = multimap_type::create(hash_table_size,
-                                          true,
-                                          multimap_type::hasher(),
-                                          multimap_type::key_equal(),
-                                          multimap_type::allocator_type(),
-                                          stream);
-
-  // build the hash table
-  if (build_table_num_rows > 0) {
-    row_hash hash_build{*build_table};
-    rmm::device_scalar<int> failure(0, stream);
-    constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-    detail::grid_1d config(build_table_num_rows, block_size);
-    build_hash_table<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-      *hash_table, hash_build, build_table_num_rows, failure.data());
-    // Check error code from the kernel
-    if (failure.value() == 1) { CUDF_FAIL("Hash Table insert failure."); }
+  // Lookups into small tables, e.g. dimension tables, probe a shared memory copy of the table
+  if (right.num_rows() <= SHARED_JOIN_MAX_BUILD_ROWS) {
+    return shared_hash_join_indices<JoinKind>(
+      *build_table, *probe_table, flip_join_indices, compare_nulls, stream);
   }
 
-  size_type estimated_size = estimate_join_output_size<JoinKind, multimap_type>(
-    *build_table, *probe_table, *hash_table, compare_nulls, stream);
+  auto hash_table = build_join_hash_table(*build_table, {}, stream);
 
-  // If the estimated output size is zero, return immediately
-  if (estimated_size == 0) {
-    return std::make_pair(rmm::device_vector<size_type>{}, rmm::device_vector<size_type>{});
-  }
-
-  // Because we are approximating the number of joined elements, our approximation
-  // might be incorrect and we might have underestimated the number of joined elements.
-  // As such we will need to de-allocate memory and re-allocate memory to ensure
-  // that the final output is correct.
-  rmm::device_scalar<size_type> write_index(0, stream);
-  size_type join_size{0};
-
-  rmm::device_vector<size_type> left_indices;
-  rmm::device_vector<size_type> right_indices;
-  auto current_estimated_size = estimated_size;
-  do {
-    left_indices.resize(estimated_size);
-    right_indices.resize(estimated_size);
-
-    constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-    detail::grid_1d config(probe_table->num_rows(), block_size);
-    write_index.set_value(0);
-
-    row_hash hash_probe{*probe_table};
-    row_equality equality{*probe_table, *build_table, compare_nulls == null_equality::EQUAL};
-    const auto& join_output_l =
-      flip_join_indices ? right_indices.data().get() : left_indices.data().get();
-    const auto& join_output_r =
-      flip_join_indices ? left_indices.data().get() : right_indices.data().get();
-    probe_hash_table<JoinKind, multimap_type, block_size, DEFAULT_JOIN_CACHE_SIZE>
-      <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(*hash_table,
-                                                                       *build_table,
-                                                                       *probe_table,
-                                                                       hash_probe,
-                                                                       equality,
-                                                                       join_output_l,
-                                                                       join_output_r,
-                                                                       write_index.data(),
-                                                                       estimated_size);
-
-    CHECK_CUDA(stream);
-
-    join_size              = write_index.value();
-    current_estimated_size = estimated_size;
-    estimated_size *= 2;
-  } while ((current_estimated_size < join_size));
-
-  left_indices.resize(join_size);
-  right_indices.resize(join_size);
-  return std::make_pair(std::move(left_indices), std::move(right_indices));
+  return probe_join_hash_table<JoinKind>(
+    *build_table, *probe_table, *hash_table, {}, flip_join_indices, compare_nulls, stream);
 }
 
 }  // namespace detail
 
+/**
+ * @brief Hash table and build side key columns of a `cudf::hash_join`
+ */
+struct hash_join::hash_join_impl {
+ public:
+  hash_join_impl() = delete;
+  ~hash_join_impl();
+  hash_join_impl(hash_join_impl const&) = delete;
+  hash_join_impl(hash_join_impl&&)      = delete;
+  hash_join_impl& operator=(hash_join_impl const&) = delete;
+  hash_join_impl& operator=(hash_join_impl&&) = delete;
+
+  /**
+   * @brief Constructs the hash table of the `build_on` columns of `build`
+   *
+   * @param build The build table
+   * @param build_on The column indices from `build` to join on
+   * @param build_hashes Precomputed hash of each build row, or an empty column to hash the rows
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_join_impl(table_view const& build,
+                 std::vector<size_type> const& build_on,
+                 column_view const& build_hashes,
+                 cudaStream_t stream = 0);
+
+  /**
+   * @brief Probes the hash table with the `probe_on` columns of `probe`
+   *
+   * @tparam JoinKind The type of join to be performed
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on
+   * @param probe_hashes Precomputed hash of each probe row, or an empty column to hash the rows
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return Pair of probe and build table row indices of the join output
+   */
+  template <detail::join_kind JoinKind>
+  detail::VectorPair compute_join_indices(table_view const& probe,
+                                          std::vector<size_type> const& probe_on,
+                                          column_view const& probe_hashes,
+                                          null_equality compare_nulls,
+                                          cudaStream_t stream) const;
+
+  /**
+   * @brief Computes the exact number of rows of a join between the probe table and the build table
+   *
+   * @tparam JoinKind The type of join to be performed, INNER_JOIN or LEFT_JOIN
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on
+   * @param probe_hashes Precomputed hash of each probe row, or an empty column to hash the rows
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return Number of rows of the join output
+   */
+  template <detail::join_kind JoinKind>
+  std::size_t join_output_size(table_view const& probe,
+                               std::vector<size_type> const& probe_on,
+                               column_view const& probe_hashes,
+                               null_equality compare_nulls,
+                               cudaStream_t stream) const;
+
+  /**
+   * @brief Splits the probe table into row ranges whose join outputs have at most
+   * `max_output_rows` rows each
+   *
+   * @tparam JoinKind The type of join to be performed, INNER_JOIN or LEFT_JOIN
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on
+   * @param max_output_rows The maximum number of output rows of a range
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The split points of the probe table, as expected by `cudf::split`
+   */
+  template <detail::join_kind JoinKind>
+  std::vector<size_type> join_probe_splits(table_view const& probe,
+                                           std::vector<size_type> const& probe_on,
+                                           std::size_t max_output_rows,
+                                           null_equality compare_nulls,
+                                           cudaStream_t stream) const;
+
+ private:
+  /**
+   * @brief Selects the `probe_on` columns of `probe` and checks that they match the build keys
+   * and that the probe rows are hashed like the build rows
+   *
+   * @return The selected columns, with their struct columns flattened like the build keys
+   */
+  structs::detail::flattened_table select_probe_keys(table_view const& probe,
+                                                     std::vector<size_type> const& probe_on,
+                                                     column_view const& probe_hashes,
+                                                     cudaStream_t stream) const;
+
+  structs::detail::flattened_table _flattened_build_keys;  ///< Build keys with flattened structs
+  table_view _build_keys;
+  bool _has_build_hashes;  ///< Whether the build rows have precomputed hashes
+  std::unique_ptr<table_device_view, std::function<void(table_device_view*)>> _build_table;
+  std::unique_ptr<detail::multimap_type, std::function<void(detail::multimap_type*)>> _hash_table;
+};
+
 }  // namespace cudf
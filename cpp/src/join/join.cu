@@ -14,19 +14,27 @@
  * limitations under the License.
  */
 #include <cudf/copying.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/memory_estimate.hpp>
+#include <cudf/dictionary/detail/indices.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/structs/detail/flatten.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include "cudf/detail/utilities/cuda.cuh"
+#include "cudf/detail/utilities/scratch_memory.cuh"
 #include "cudf/types.hpp"
 #include "hash_join.cuh"
 #include "join_common_utils.hpp"
+#include "merge_join.cuh"
 #include "nested_loop_join.cuh"
 
 namespace cudf {
@@ -81,7 +89,7 @@ std::unique_ptr<table> get_empty_joined_table(
   return std::make_unique<table>(tmp_table);
 }
 
-VectorPair concatenate_vector_pairs(VectorPair& a, VectorPair& b)
+VectorPair concatenate_vector_pairs(VectorPair& a, VectorPair& b, cudaStream_t stream)
 {
   CUDF_EXPECTS((a.first.size() == a.second.size()),
                "Mismatch between sizes of vectors in vector pair");
@@ -95,8 +103,14 @@ VectorPair concatenate_vector_pairs(VectorPair& a, VectorPair& b)
   auto original_size = a.first.size();
   a.first.resize(a.first.size() + b.first.size());
   a.second.resize(a.second.size() + b.second.size());
-  thrust::copy(b.first.begin(), b.first.end(), a.first.begin() + original_size);
-  thrust::copy(b.second.begin(), b.second.end(), a.second.begin() + original_size);
+  thrust::copy(scratch_policy(stream)->on(stream),
+               b.first.begin(),
+               b.first.end(),
+               a.first.begin() + original_size);
+  thrust::copy(scratch_policy(stream)->on(stream),
+               b.second.begin(),
+               b.second.end(),
+               a.second.begin() + original_size);
   return a;
 }
 
@@ -133,7 +147,7 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
   // Get array of indices that do not appear in right_indices
 
   // Vector allocated for unmatched result
-  rmm::device_vector<size_type> right_indices_complement(right_table_row_count);
+  auto right_indices_complement = make_scratch_vector<size_type>(right_table_row_count, 0, stream);
 
   // If left table is empty in a full join call then all rows of the right table
   // should be represented in the joined indices. This is an optimization since
@@ -141,19 +155,19 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
   // right_indices will be JoinNoneValue, i.e. -1. This if path should
   // produce exactly the same result as the else path but will be faster.
   if (left_table_row_count == 0) {
-    thrust::sequence(rmm::exec_policy(stream)->on(stream),
+    thrust::sequence(scratch_policy(stream)->on(stream),
                      right_indices_complement.begin(),
                      right_indices_complement.end(),
                      0);
   } else {
     // Assume all the indices in invalid_index_map are invalid
-    rmm::device_vector<size_type> invalid_index_map(right_table_row_count, 1);
+    auto invalid_index_map = make_scratch_vector<size_type>(right_table_row_count, 1, stream);
     // Functor to check for index validity since left joins can create invalid indices
     valid_range<size_type> valid(0, right_table_row_count);
 
     // invalid_index_map[index_ptr[i]] = 0 for i = 0 to right_table_row_count
     // Thus specifying that those locations are valid
-    thrust::scatter_if(rmm::exec_policy(stream)->on(stream),
+    thrust::scatter_if(scratch_policy(stream)->on(stream),
                        thrust::make_constant_iterator(0),
                        thrust::make_constant_iterator(0) + right_indices.size(),
                        right_indices.begin(),      // Index locations
@@ -164,7 +178,7 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
     size_type end_counter   = static_cast<size_type>(right_table_row_count);
 
     // Create list of indices that have been marked as invalid
-    size_type indices_count = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+    size_type indices_count = thrust::copy_if(scratch_policy(stream)->on(stream),
                                               thrust::make_counting_iterator(begin_counter),
                                               thrust::make_counting_iterator(end_counter),
                                               invalid_index_map.begin(),
@@ -174,8 +188,8 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
     right_indices_complement.resize(indices_count);
   }
 
-  rmm::device_vector<size_type> left_invalid_indices(right_indices_complement.size(),
-                                                     JoinNoneValue);
+  auto left_invalid_indices =
+    make_scratch_vector<size_type>(right_indices_complement.size(), JoinNoneValue, stream);
 
   return std::make_pair(std::move(left_invalid_indices), std::move(right_indices_complement));
 }
@@ -193,13 +207,19 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
  * @param left  Table of left columns to join
  * @param right Table of right  columns to join
  * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param keys_sorted Whether both tables are sorted on their join keys, in which case they are
+ * merge joined instead of hash joined
  * @param stream CUDA stream used for device memory operations and kernel launches.
  *
  * @return Join output indices vector pair
  */
 template <join_kind JoinKind>
 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> get_base_join_indices(
-  table_view const& left, table_view const& right, null_equality compare_nulls, cudaStream_t stream)
+  table_view const& left,
+  table_view const& right,
+  null_equality compare_nulls,
+  sorted keys_sorted,
+  cudaStream_t stream)
 {
   CUDF_EXPECTS(0 != left.num_columns(), "Selected left dataset is empty");
   CUDF_EXPECTS(0 != right.num_columns(), "Selected right dataset is empty");
@@ -210,9 +230,38 @@ std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> get_base
                           [](const auto& l, const auto& r) { return l.type() == r.type(); }),
                "Mismatch in joining column data types");
 
+  // Struct keys are joined on their fields, which line up on both sides whatever the nullability
+  // of the structs since every struct gets a null indicator
+  auto const is_struct = [](column_view const& col) { return col.type().id() == type_id::STRUCT; };
+  if (std::any_of(left.begin(), left.end(), is_struct)) {
+    auto const flattened_left =
+      structs::detail::flatten_nested_columns_with_null_indicators(left, stream);
+    auto const flattened_right =
+      structs::detail::flatten_nested_columns_with_null_indicators(right, stream);
+    return get_base_join_indices<JoinKind>(
+      flattened_left.columns, flattened_right.columns, compare_nulls, keys_sorted, stream);
+  }
+
   constexpr join_kind BaseJoinKind =
     (JoinKind == join_kind::FULL_JOIN) ? join_kind::LEFT_JOIN : JoinKind;
-  return get_base_hash_join_indices<BaseJoinKind>(left, right, false, compare_nulls, stream);
+
+  // Dictionary indices are not ordered like the keys, so dictionaries are always hash joined
+  auto const is_dictionary = [](column_view const& col) {
+    return col.type().id() == type_id::DICTIONARY32;
+  };
+  if (keys_sorted == sorted::YES && std::none_of(left.begin(), left.end(), is_dictionary)) {
+    return get_base_merge_join_indices<BaseJoinKind>(left, right, compare_nulls, stream);
+  }
+
+  // Dictionary keys are joined on their indices into keys shared by both sides
+  auto const matched = cudf::dictionary::detail::match_dictionaries(
+    {left, right}, get_scratch_resource(), stream);
+  return get_base_hash_join_indices<BaseJoinKind>(
+    cudf::dictionary::detail::get_indices_annotated(matched.second[0]),
+    cudf::dictionary::detail::get_indices_annotated(matched.second[1]),
+    false,
+    compare_nulls,
+    stream);
 }
 
 /**
@@ -311,18 +360,18 @@ std::unique_ptr<table> construct_join_output_df(
                                               complement_indices.second.begin(),
                                               complement_indices.second.end(),
                                               nullify_out_of_bounds,
-                                              rmm::mr::get_default_resource(),
+                                              get_scratch_resource(),
                                               stream);
       auto common_from_left  = detail::gather(left.select(left_common_col),
                                              joined_indices.first.begin(),
                                              joined_indices.first.end(),
                                              nullify_out_of_bounds,
-                                             rmm::mr::get_default_resource(),
+                                             get_scratch_resource(),
                                              stream);
       common_table           = cudf::detail::concatenate(
         {common_from_right->view(), common_from_left->view()}, mr, stream);
     }
-    joined_indices = concatenate_vector_pairs(complement_indices, joined_indices);
+    joined_indices = concatenate_vector_pairs(complement_indices, joined_indices, stream);
   } else {
     if (not columns_in_common.empty()) {
       common_table = detail::gather(left.select(left_common_col),
@@ -432,14 +481,666 @@ std::unique_ptr<table> join_call_compute_df(
   }
 
   auto joined_indices = get_base_join_indices<JoinKind>(
-    left.select(left_on), right.select(right_on), compare_nulls, stream);
+    left.select(left_on), right.select(right_on), compare_nulls, sorted::NO, stream);
 
   return construct_join_output_df<JoinKind>(
     left, right, joined_indices, columns_in_common, mr, stream);
 }
 
+/**
+ * @brief Moves a pair of join index vectors into a pair of INT32 gather map columns
+ *
+ * @param indices Join output indices vector pair
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Pair of gather map columns
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_gather_map_columns(
+  VectorPair const& indices, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  auto make_column = [&](rmm::device_vector<size_type> const& map) {
+    auto const size = static_cast<size_type>(map.size());
+    auto col        = make_numeric_column(
+      data_type(type_id::INT32), size, mask_state::UNALLOCATED, stream, mr);
+    if (size > 0) {
+      CUDA_TRY(cudaMemcpyAsync(col->mutable_view().data<size_type>(),
+                               map.data().get(),
+                               size * sizeof(size_type),
+                               cudaMemcpyDeviceToDevice,
+                               stream));
+    }
+    return col;
+  };
+  return std::make_pair(make_column(indices.first), make_column(indices.second));
+}
+
+/**
+ * @brief Computes the gather maps of a join between the key columns of two tables
+ *
+ * @tparam JoinKind The type of join to be performed
+ *
+ * @param left_keys The left table key columns
+ * @param right_keys The right table key columns
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param keys_sorted Whether both tables are sorted on their key columns
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Pair of left and right table gather map columns
+ */
+template <join_kind JoinKind>
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> join_gather_maps(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  null_equality compare_nulls,
+  sorted keys_sorted,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(left_keys.num_rows() < MAX_JOIN_SIZE, "Left column size is too big");
+  CUDF_EXPECTS(right_keys.num_rows() < MAX_JOIN_SIZE, "Right column size is too big");
+
+  auto indices =
+    get_base_join_indices<JoinKind>(left_keys, right_keys, compare_nulls, keys_sorted, stream);
+  if (JoinKind == join_kind::FULL_JOIN) {
+    auto complement_indices = get_left_join_indices_complement(
+      indices.second, left_keys.num_rows(), right_keys.num_rows(), stream);
+    indices = concatenate_vector_pairs(indices, complement_indices, stream);
+  }
+  return make_gather_map_columns(indices, mr, stream);
+}
+
+/**
+ * @brief Chooses a number of partitions for which the hash table built on one partition of
+ * `right_keys` fits in the L2 cache of the current device
+ *
+ * @param right_keys The right table key columns, the build side of every partition join
+ *
+ * @return Number of partitions, a power of two
+ */
+size_type default_join_partition_count(table_view const& right_keys)
+{
+  int device{0};
+  int l2_cache_size{0};
+  CUDA_TRY(cudaGetDevice(&device));
+  CUDA_TRY(cudaDeviceGetAttribute(&l2_cache_size, cudaDevAttrL2CacheSize, device));
+  if (l2_cache_size <= 0) { return 1; }
+
+  auto const hash_table_bytes =
+    join_hash_table_size(right_keys.num_rows()) * sizeof(multimap_type::value_type);
+  size_type num_partitions{1};
+  while (num_partitions < MAX_JOIN_PARTITIONS &&
+         hash_table_bytes > static_cast<size_t>(num_partitions) * l2_cache_size) {
+    num_partitions *= 2;
+  }
+  return num_partitions;
+}
+
+/**
+ * @brief Replaces partition-local join indices with the input table rows they came from
+ *
+ * @param indices Join indices into one partition; `JoinNoneValue` entries are kept
+ * @param row_indices Input table row index of each row of the partition
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void map_to_input_rows(rmm::device_vector<size_type>& indices,
+                       column_view const& row_indices,
+                       cudaStream_t stream)
+{
+  auto const rows = row_indices.data<size_type>();
+  thrust::transform(scratch_policy(stream)->on(stream),
+                    indices.begin(),
+                    indices.end(),
+                    indices.begin(),
+                    [rows] __device__(size_type index) {
+                      return index == JoinNoneValue ? JoinNoneValue : rows[index];
+                    });
+}
+
+/**
+ * @brief Computes the join indices of two tables by hash partitioning both tables on their
+ * keys and joining each pair of partitions independently.
+ *
+ * Rows with equal keys hash to the same partition in both tables, so the union of the
+ * partition joins is the join of the whole tables. A column of row indices is partitioned
+ * along with the keys to map the partition-local join indices back to rows of the inputs.
+ *
+ * @tparam JoinKind The type of join to be performed
+ *
+ * @param left_keys The left table key columns
+ * @param right_keys The right table key columns
+ * @param num_partitions The number of partitions to split both tables into
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Join output indices vector pair
+ */
+template <join_kind JoinKind>
+VectorPair get_partitioned_join_indices(table_view const& left_keys,
+                                        table_view const& right_keys,
+                                        size_type num_partitions,
+                                        null_equality compare_nulls,
+                                        cudaStream_t stream)
+{
+  std::vector<size_type> key_columns(left_keys.num_columns());
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+
+  auto partition = [&](table_view const& keys) {
+    auto row_indices = make_numeric_column(data_type(type_id::INT32),
+                                           keys.num_rows(),
+                                           mask_state::UNALLOCATED,
+                                           stream,
+                                           get_scratch_resource());
+    auto row_indices_view = row_indices->mutable_view();
+    thrust::sequence(scratch_policy(stream)->on(stream),
+                     row_indices_view.begin<size_type>(),
+                     row_indices_view.end<size_type>(),
+                     0);
+    std::vector<column_view> columns(keys.begin(), keys.end());
+    columns.push_back(row_indices->view());
+    auto result = cudf::hash_partition(table_view{columns},
+                                       key_columns,
+                                       num_partitions,
+                                       hash_id::HASH_MURMUR3,
+                                       get_scratch_resource());
+    result.second.push_back(keys.num_rows());
+    return result;
+  };
+  auto const left_partitions  = partition(left_keys);
+  auto const right_partitions = partition(right_keys);
+
+  constexpr join_kind BaseJoinKind =
+    (JoinKind == join_kind::FULL_JOIN) ? join_kind::LEFT_JOIN : JoinKind;
+  auto const num_keys = left_keys.num_columns();
+
+  std::vector<VectorPair> partition_indices;
+  size_t output_size{0};
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const left_part = cudf::slice(left_partitions.first->view(),
+                                       {left_partitions.second[p], left_partitions.second[p + 1]})
+                             .front();
+    auto const right_part =
+      cudf::slice(right_partitions.first->view(),
+                  {right_partitions.second[p], right_partitions.second[p + 1]})
+        .front();
+    auto const left_part_keys  = left_part.select(key_columns);
+    auto const right_part_keys = right_part.select(key_columns);
+
+    VectorPair indices{make_scratch_vector<size_type>(0, 0, stream),
+                       make_scratch_vector<size_type>(0, 0, stream)};
+    if (BaseJoinKind == join_kind::LEFT_JOIN && right_part.num_rows() == 0) {
+      indices = get_trivial_left_join_indices(left_part_keys, stream);
+    } else if (left_part.num_rows() != 0 && right_part.num_rows() != 0) {
+      indices = get_base_hash_join_indices<BaseJoinKind>(
+        left_part_keys, right_part_keys, false, compare_nulls, stream);
+    }
+    if (JoinKind == join_kind::FULL_JOIN) {
+      auto complement_indices = get_left_join_indices_complement(
+        indices.second, left_part.num_rows(), right_part.num_rows(), stream);
+      indices = concatenate_vector_pairs(indices, complement_indices, stream);
+    }
+    if (indices.first.empty()) { continue; }
+
+    map_to_input_rows(indices.first, left_part.column(num_keys), stream);
+    map_to_input_rows(indices.second, right_part.column(num_keys), stream);
+    output_size += indices.first.size();
+    partition_indices.push_back(std::move(indices));
+  }
+
+  VectorPair result{make_scratch_vector<size_type>(output_size, 0, stream),
+                    make_scratch_vector<size_type>(output_size, 0, stream)};
+  size_t offset{0};
+  for (auto const& indices : partition_indices) {
+    thrust::copy(scratch_policy(stream)->on(stream),
+                 indices.first.begin(),
+                 indices.first.end(),
+                 result.first.begin() + offset);
+    thrust::copy(scratch_policy(stream)->on(stream),
+                 indices.second.begin(),
+                 indices.second.end(),
+                 result.second.begin() + offset);
+    offset += indices.first.size();
+  }
+  return result;
+}
+
+/**
+ * @brief Computes the gather maps of a join between the key columns of two tables, one hash
+ * partition at a time
+ *
+ * @tparam JoinKind The type of join to be performed
+ *
+ * @param left_keys The left table key columns
+ * @param right_keys The right table key columns
+ * @param num_partitions The number of partitions, or 0 to size partitions for the L2 cache
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Pair of left and right table gather map columns
+ */
+template <join_kind JoinKind>
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> partitioned_join_gather_maps(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  size_type num_partitions,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(num_partitions >= 0, "Number of partitions must not be negative");
+  if (num_partitions == 0) { num_partitions = default_join_partition_count(right_keys); }
+  if (num_partitions == 1 || left_keys.num_rows() == 0 || right_keys.num_rows() == 0) {
+    return join_gather_maps<JoinKind>(
+      left_keys, right_keys, compare_nulls, sorted::NO, mr, stream);
+  }
+
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Selected left dataset is empty");
+  CUDF_EXPECTS(left_keys.num_rows() < MAX_JOIN_SIZE, "Left column size is too big");
+  CUDF_EXPECTS(right_keys.num_rows() < MAX_JOIN_SIZE, "Right column size is too big");
+  CUDF_EXPECTS(std::equal(std::cbegin(left_keys),
+                          std::cend(left_keys),
+                          std::cbegin(right_keys),
+                          std::cend(right_keys),
+                          [](const auto& l, const auto& r) { return l.type() == r.type(); }),
+               "Mismatch in joining column data types");
+
+  // Struct keys are partitioned and joined on their fields
+  auto const flattened_left =
+    structs::detail::flatten_nested_columns_with_null_indicators(left_keys, stream);
+  auto const flattened_right =
+    structs::detail::flatten_nested_columns_with_null_indicators(right_keys, stream);
+  auto indices = get_partitioned_join_indices<JoinKind>(
+    flattened_left.columns, flattened_right.columns, num_partitions, compare_nulls, stream);
+  return make_gather_map_columns(indices, mr, stream);
+}
+
+memory_estimate estimate_join_memory(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  std::size_t output_rows)
+{
+  CUDF_EXPECTS(left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+  std::vector<size_type> right_common_indices(columns_in_common.size());
+  std::transform(columns_in_common.begin(),
+                 columns_in_common.end(),
+                 right_common_indices.begin(),
+                 [](auto const& common) { return common.second; });
+  auto const right_noncommon =
+    right.select(non_common_column_indices(right.num_columns(), right_common_indices));
+
+  memory_estimate estimate;
+  // The columns of either side get nulls for the unmatched rows of outer joins
+  estimate.output_bytes = estimate_gather_bytes(left, output_rows, true) +
+                          estimate_gather_bytes(right_noncommon, output_rows, true);
+
+  // Small build tables are probed from shared memory, without a hash table in device memory
+  auto const build_rows = right.num_rows();
+  if (build_rows > SHARED_JOIN_MAX_BUILD_ROWS) {
+    estimate.scratch_bytes += join_hash_table_size(build_rows) * sizeof(multimap_type::value_type);
+  }
+  // The join indices of both sides are kept until the output columns are gathered
+  estimate.scratch_bytes += 2 * output_rows * sizeof(size_type);
+  return estimate;
+}
+
 }  // namespace detail
 
+hash_join::hash_join_impl::~hash_join_impl() = default;
+
+hash_join::hash_join_impl::hash_join_impl(table_view const& build,
+                                          std::vector<size_type> const& build_on,
+                                          column_view const& build_hashes,
+                                          cudaStream_t stream)
+  : _flattened_build_keys(
+      structs::detail::flatten_nested_columns_with_null_indicators(build.select(build_on), stream)),
+    _build_keys(_flattened_build_keys.columns),
+    _has_build_hashes(build_hashes.size() != 0)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(0 != _build_keys.num_columns(), "Hash join build table is empty");
+  CUDF_EXPECTS(_build_keys.num_rows() < detail::MAX_JOIN_SIZE,
+               "Build column size is too big for hash join");
+
+  _build_table = table_device_view::create(_build_keys, stream);
+  _hash_table  = detail::build_join_hash_table(*_build_table, build_hashes, stream);
+}
+
+structs::detail::flattened_table hash_join::hash_join_impl::select_probe_keys(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  column_view const& probe_hashes,
+  cudaStream_t stream) const
+{
+  // Struct keys are matched on their fields, as in the flattened build keys
+  auto flattened =
+    structs::detail::flatten_nested_columns_with_null_indicators(probe.select(probe_on), stream);
+  auto const& probe_keys = flattened.columns;
+  CUDF_EXPECTS(probe_keys.num_columns() == _build_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(probe_keys.num_rows() < detail::MAX_JOIN_SIZE, "Probe column size is too big");
+  CUDF_EXPECTS(std::equal(std::cbegin(probe_keys),
+                          std::cend(probe_keys),
+                          std::cbegin(_build_keys),
+                          std::cend(_build_keys),
+                          [](const auto& p, const auto& b) { return p.type() == b.type(); }),
+               "Mismatch in joining column data types");
+  // Rows hashed differently never match, so both sides must be hashed alike
+  CUDF_EXPECTS(probe_keys.num_rows() == 0 or _build_keys.num_rows() == 0 or
+                 (probe_hashes.size() != 0) == _has_build_hashes,
+               "Probe rows must have precomputed hashes if and only if the build rows do");
+  return flattened;
+}
+
+template <detail::join_kind JoinKind>
+std::size_t hash_join::hash_join_impl::join_output_size(table_view const& probe,
+                                                        std::vector<size_type> const& probe_on,
+                                                        column_view const& probe_hashes,
+                                                        null_equality compare_nulls,
+                                                        cudaStream_t stream) const
+{
+  auto const flattened_probe = select_probe_keys(probe, probe_on, probe_hashes, stream);
+  auto const probe_table     = table_device_view::create(flattened_probe.columns, stream);
+  return detail::get_join_output_size<JoinKind, detail::multimap_type>(
+    *_build_table, *probe_table, *_hash_table, probe_hashes, compare_nulls, stream);
+}
+
+template <detail::join_kind JoinKind>
+std::vector<size_type> hash_join::hash_join_impl::join_probe_splits(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  std::size_t max_output_rows,
+  null_equality compare_nulls,
+  cudaStream_t stream) const
+{
+  CUDF_EXPECTS(max_output_rows > 0, "The maximum number of output rows must be positive");
+  auto const flattened_probe = select_probe_keys(probe, probe_on, {}, stream);
+  auto const probe_table     = table_device_view::create(flattened_probe.columns, stream);
+  return detail::get_join_probe_splits<JoinKind, detail::multimap_type>(
+    *_build_table, *probe_table, *_hash_table, {}, max_output_rows, compare_nulls, stream);
+}
+
+template <detail::join_kind JoinKind>
+detail::VectorPair hash_join::hash_join_impl::compute_join_indices(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  column_view const& probe_hashes,
+  null_equality compare_nulls,
+  cudaStream_t stream) const
+{
+  auto const flattened_probe = select_probe_keys(probe, probe_on, probe_hashes, stream);
+  auto const& probe_keys     = flattened_probe.columns;
+
+  constexpr auto BaseJoinKind = (JoinKind == detail::join_kind::FULL_JOIN)
+                                  ? detail::join_kind::LEFT_JOIN
+                                  : JoinKind;
+
+  detail::VectorPair indices{detail::make_scratch_vector<size_type>(0, 0, stream),
+                             detail::make_scratch_vector<size_type>(0, 0, stream)};
+  if (BaseJoinKind == detail::join_kind::LEFT_JOIN && _build_keys.num_rows() == 0) {
+    indices = detail::get_trivial_left_join_indices(probe_keys, stream);
+  } else if (probe_keys.num_rows() != 0 && _build_keys.num_rows() != 0) {
+    auto probe_table = table_device_view::create(probe_keys, stream);
+    indices          = detail::probe_join_hash_table<BaseJoinKind>(
+      *_build_table, *probe_table, *_hash_table, probe_hashes, false, compare_nulls, stream);
+  }
+
+  if (JoinKind == detail::join_kind::FULL_JOIN) {
+    auto complement_indices = detail::get_left_join_indices_complement(
+      indices.second, probe_keys.num_rows(), _build_keys.num_rows(), stream);
+    indices = detail::concatenate_vector_pairs(indices, complement_indices, stream);
+  }
+  return indices;
+}
+
+hash_join::~hash_join() = default;
+
+hash_join::hash_join(cudf::table_view const& build,
+                     std::vector<size_type> const& build_on,
+                     cudaStream_t stream)
+  : impl{std::make_unique<const hash_join_impl>(build, build_on, column_view{}, stream)}
+{
+}
+
+hash_join::hash_join(cudf::table_view const& build,
+                     std::vector<size_type> const& build_on,
+                     cudf::column_view const& build_hashes,
+                     cudaStream_t stream)
+  : impl{std::make_unique<const hash_join_impl>(build, build_on, build_hashes, stream)}
+{
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> hash_join::inner_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  auto indices = impl->compute_join_indices<detail::join_kind::INNER_JOIN>(
+    probe, probe_on, column_view{}, compare_nulls, stream);
+  return detail::make_gather_map_columns(indices, mr, stream);
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> hash_join::inner_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  cudf::column_view const& probe_hashes,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  auto indices = impl->compute_join_indices<detail::join_kind::INNER_JOIN>(
+    probe, probe_on, probe_hashes, compare_nulls, stream);
+  return detail::make_gather_map_columns(indices, mr, stream);
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> hash_join::left_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  auto indices = impl->compute_join_indices<detail::join_kind::LEFT_JOIN>(
+    probe, probe_on, column_view{}, compare_nulls, stream);
+  return detail::make_gather_map_columns(indices, mr, stream);
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> hash_join::left_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  cudf::column_view const& probe_hashes,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  auto indices = impl->compute_join_indices<detail::join_kind::LEFT_JOIN>(
+    probe, probe_on, probe_hashes, compare_nulls, stream);
+  return detail::make_gather_map_columns(indices, mr, stream);
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> hash_join::full_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  auto indices = impl->compute_join_indices<detail::join_kind::FULL_JOIN>(
+    probe, probe_on, column_view{}, compare_nulls, stream);
+  return detail::make_gather_map_columns(indices, mr, stream);
+}
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> hash_join::full_join(
+  cudf::table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  cudf::column_view const& probe_hashes,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  auto indices = impl->compute_join_indices<detail::join_kind::FULL_JOIN>(
+    probe, probe_on, probe_hashes, compare_nulls, stream);
+  return detail::make_gather_map_columns(indices, mr, stream);
+}
+
+std::size_t hash_join::inner_join_size(cudf::table_view const& probe,
+                                       std::vector<size_type> const& probe_on,
+                                       null_equality compare_nulls,
+                                       cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->join_output_size<detail::join_kind::INNER_JOIN>(
+    probe, probe_on, column_view{}, compare_nulls, stream);
+}
+
+std::size_t hash_join::inner_join_size(cudf::table_view const& probe,
+                                       std::vector<size_type> const& probe_on,
+                                       cudf::column_view const& probe_hashes,
+                                       null_equality compare_nulls,
+                                       cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->join_output_size<detail::join_kind::INNER_JOIN>(
+    probe, probe_on, probe_hashes, compare_nulls, stream);
+}
+
+std::size_t hash_join::left_join_size(cudf::table_view const& probe,
+                                      std::vector<size_type> const& probe_on,
+                                      null_equality compare_nulls,
+                                      cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->join_output_size<detail::join_kind::LEFT_JOIN>(
+    probe, probe_on, column_view{}, compare_nulls, stream);
+}
+
+std::size_t hash_join::left_join_size(cudf::table_view const& probe,
+                                      std::vector<size_type> const& probe_on,
+                                      cudf::column_view const& probe_hashes,
+                                      null_equality compare_nulls,
+                                      cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->join_output_size<detail::join_kind::LEFT_JOIN>(
+    probe, probe_on, probe_hashes, compare_nulls, stream);
+}
+
+std::vector<size_type> hash_join::inner_join_splits(cudf::table_view const& probe,
+                                                    std::vector<size_type> const& probe_on,
+                                                    std::size_t max_output_rows,
+                                                    null_equality compare_nulls,
+                                                    cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->join_probe_splits<detail::join_kind::INNER_JOIN>(
+    probe, probe_on, max_output_rows, compare_nulls, stream);
+}
+
+std::vector<size_type> hash_join::left_join_splits(cudf::table_view const& probe,
+                                                   std::vector<size_type> const& probe_on,
+                                                   std::size_t max_output_rows,
+                                                   null_equality compare_nulls,
+                                                   cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->join_probe_splits<detail::join_kind::LEFT_JOIN>(
+    probe, probe_on, max_output_rows, compare_nulls, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> inner_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  null_equality compare_nulls,
+  sorted keys_sorted,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::join_gather_maps<detail::join_kind::INNER_JOIN>(
+    left_keys, right_keys, compare_nulls, keys_sorted, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> left_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  null_equality compare_nulls,
+  sorted keys_sorted,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::join_gather_maps<detail::join_kind::LEFT_JOIN>(
+    left_keys, right_keys, compare_nulls, keys_sorted, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> full_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  null_equality compare_nulls,
+  sorted keys_sorted,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::join_gather_maps<detail::join_kind::FULL_JOIN>(
+    left_keys, right_keys, compare_nulls, keys_sorted, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> partitioned_inner_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  size_type num_partitions,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join_gather_maps<detail::join_kind::INNER_JOIN>(
+    left_keys, right_keys, num_partitions, compare_nulls, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> partitioned_left_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  size_type num_partitions,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join_gather_maps<detail::join_kind::LEFT_JOIN>(
+    left_keys, right_keys, num_partitions, compare_nulls, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> partitioned_full_join(
+  table_view const& left_keys,
+  table_view const& right_keys,
+  size_type num_partitions,
+  null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join_gather_maps<detail::join_kind::FULL_JOIN>(
+    left_keys, right_keys, num_partitions, compare_nulls, mr, stream);
+}
+
 std::unique_ptr<table> inner_join(
   table_view const& left,
   table_view const& right,
@@ -447,11 +1148,12 @@ std::unique_ptr<table> inner_join(
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::detail::join_kind::INNER_JOIN>(
-    left, right, left_on, right_on, columns_in_common, compare_nulls, mr);
+    left, right, left_on, right_on, columns_in_common, compare_nulls, mr, stream);
 }
 
 std::unique_ptr<table> left_join(
@@ -461,11 +1163,12 @@ std::unique_ptr<table> left_join(
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::detail::join_kind::LEFT_JOIN>(
-    left, right, left_on, right_on, columns_in_common, compare_nulls, mr);
+    left, right, left_on, right_on, columns_in_common, compare_nulls, mr, stream);
 }
 
 std::unique_ptr<table> full_join(
@@ -475,11 +1178,25 @@ std::unique_ptr<table> full_join(
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
   null_equality compare_nulls,
-  rmm::mr::device_memory_resource* mr)
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::detail::join_kind::FULL_JOIN>(
-    left, right, left_on, right_on, columns_in_common, compare_nulls, mr);
+    left, right, left_on, right_on, columns_in_common, compare_nulls, mr, stream);
+}
+
+memory_estimate estimate_join_memory(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  std::size_t output_rows)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_join_memory(
+    left, right, left_on, right_on, columns_in_common, output_rows);
 }
 
 }  // namespace cudf
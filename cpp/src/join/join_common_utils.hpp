@@ -29,24 +29,35 @@
 namespace cudf {
 namespace detail {
 constexpr size_type MAX_JOIN_SIZE{std::numeric_limits<size_type>::max()};
+constexpr size_type MAX_JOIN_PARTITIONS{1024};
 
 constexpr int DEFAULT_JOIN_BLOCK_SIZE = 128;
 constexpr int DEFAULT_JOIN_CACHE_SIZE = 128;
 constexpr size_type JoinNoneValue     = -1;
 
+// Build tables of up to this many rows are joined with a hash table in shared memory, which
+// each block builds and probes on its own; its slots are twice as many, a power of two
+constexpr size_type SHARED_JOIN_MAX_BUILD_ROWS = 2048;
+constexpr int SHARED_JOIN_TABLE_BITS           = 12;
+
 using VectorPair = std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>;
 
+// Rows are keyed by a 64-bit hash so that distinct rows of large tables rarely
+// share a key, which would cost a row comparison for every match of either row.
+// The hashes may be precomputed, in which case both tables must be hashed alike.
+using row_hash = cudf::precomputed_row_hasher<XXHash_64>;
+
+using row_hash_value_type = row_hash::result_type;
+
 using multimap_type =
-  concurrent_unordered_multimap<hash_value_type,
+  concurrent_unordered_multimap<row_hash_value_type,
                                 size_type,
                                 size_t,
-                                std::numeric_limits<hash_value_type>::max(),
+                                std::numeric_limits<row_hash_value_type>::max(),
                                 std::numeric_limits<size_type>::max(),
-                                default_hash<hash_value_type>,
-                                equal_to<hash_value_type>,
-                                default_allocator<thrust::pair<hash_value_type, size_type>>>;
-
-using row_hash = cudf::row_hasher<default_hash>;
+                                default_hash<row_hash_value_type>,
+                                equal_to<row_hash_value_type>,
+                                default_allocator<thrust::pair<row_hash_value_type, size_type>>>;
 
 using row_equality = cudf::row_equality_comparator<true>;
 
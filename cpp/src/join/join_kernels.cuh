@@ -70,7 +70,7 @@ __global__ void build_hash_table(multimap_type multi_map,
 
   while (i < build_table_num_rows) {
     // Compute the hash value of this row
-    const hash_value_type row_hash_value{hash_build(i)};
+    const row_hash_value_type row_hash_value{hash_build(i)};
 
     // Insert the (row hash value, row index) into the map
     // using the row hash value to determine the location in the
@@ -84,10 +84,59 @@ __global__ void build_hash_table(multimap_type multi_map,
   }
 }
 
+/**
+ * @brief Returns the number of output rows of one probe row, i.e. its number of matches in the
+ * build table, or 1 for a left join row without a match
+ *
+ * @tparam JoinKind The type of join to be performed
+ * @tparam multimap_type The datatype of the hash table
+ *
+ * @param[in] multi_map The hash table built on the build table
+ * @param[in] hash_probe Row hasher for the probe table
+ * @param[in] check_row_equality The row equality comparator
+ * @param[in] probe_row_index The index of the probe row
+ */
+template <join_kind JoinKind, typename multimap_type>
+__device__ cudf::size_type count_probe_row_matches(multimap_type const& multi_map,
+                                                   row_hash const& hash_probe,
+                                                   row_equality const& check_row_equality,
+                                                   cudf::size_type probe_row_index)
+{
+  cudf::size_type num_matches{0};
+  const auto unused_key = multi_map.get_unused_key();
+  const auto end        = multi_map.end();
+
+  // Search the hash map for the hash value of the probe row using the row's
+  // hash value to determine the location where to search for the row in the hash map
+  row_hash_value_type const probe_row_hash_value = hash_probe(probe_row_index);
+  auto found = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+
+  // Continue searching for matching rows until hitting an empty hash map entry
+  if (end != found) {
+    while (unused_key != found->first) {
+      // First check that the hash values of the two rows match, then that the rows are equal
+      if (found->first == probe_row_hash_value &&
+          check_row_equality(probe_row_index, found->second)) {
+        ++num_matches;
+      }
+      ++found;
+      // If you hit the end of the hash map, wrap around to the beginning
+      if (end == found) found = multi_map.begin();
+    }
+  }
+
+  // Left joins always have an entry in the output
+  if (JoinKind == join_kind::LEFT_JOIN && num_matches == 0) { num_matches = 1; }
+  return num_matches;
+}
+
 /**
  * @brief Computes the output size of joining the probe table to the build table
  * by probing the hash map with the probe table and counting the number of matches.
  *
+ * The size is counted in 64 bits, so that outputs exceeding the maximum column size are reported
+ * exactly instead of overflowing.
+ *
  * @tparam JoinKind The type of join to be performed
  * @tparam multimap_type The datatype of the hash table
  * @tparam block_size The number of threads per block for this kernel
@@ -107,7 +156,7 @@ __global__ void compute_join_output_size(multimap_type multi_map,
                                          row_hash hash_probe,
                                          row_equality check_row_equality,
                                          const cudf::size_type probe_table_num_rows,
-                                         size_type* output_size)
+                                         unsigned long long* output_size)
 {
   // This kernel probes multiple elements in the probe_table and store the number of matches found
   // inside a register. A block reduction is used at the end to calculate the matches per thread
@@ -115,71 +164,170 @@ __global__ void compute_join_output_size(multimap_type multi_map,
   // thread, this implementation improves performance by reducing atomic adds to the shared memory
   // counter.
 
-  cudf::size_type thread_counter{0};
+  unsigned long long thread_counter{0};
   const cudf::size_type start_idx = threadIdx.x + blockIdx.x * blockDim.x;
   const cudf::size_type stride    = blockDim.x * gridDim.x;
-  const auto unused_key           = multi_map.get_unused_key();
-  const auto end                  = multi_map.end();
 
   for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_table_num_rows;
        probe_row_index += stride) {
-    auto found = end;
-
-    // Search the hash map for the hash value of the probe row using the row's
-    // hash value to determine the location where to search for the row in the hash map
-    hash_value_type probe_row_hash_value{0};
-    // Search the hash map for the hash value of the probe row
-    probe_row_hash_value = hash_probe(probe_row_index);
-    found                = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+    thread_counter += count_probe_row_matches<JoinKind>(
+      multi_map, hash_probe, check_row_equality, probe_row_index);
+  }
 
-    // for left-joins we always need to add an output
-    bool running     = (JoinKind == join_kind::LEFT_JOIN) || (end != found);
-    bool found_match = false;
+  using BlockReduce = cub::BlockReduce<unsigned long long, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  unsigned long long block_counter = BlockReduce(temp_storage).Sum(thread_counter);
 
-    while (running) {
-      // TODO Simplify this logic...
+  // Add block counter to global counter
+  if (threadIdx.x == 0) atomicAdd(output_size, block_counter);
+}
 
-      // Left joins always have an entry in the output
-      if (JoinKind == join_kind::LEFT_JOIN && (end == found)) {
-        running = false;
-      }
-      // Stop searching after encountering an empty hash table entry
-      else if (unused_key == found->first) {
-        running = false;
-      }
-      // First check that the hash values of the two rows match
-      else if (found->first == probe_row_hash_value) {
-        // If the hash values are equal, check that the rows are equal
-        if (check_row_equality(probe_row_index, found->second)) {
-          // If the rows are equal, then we have found a true match
-          found_match = true;
-          ++thread_counter;
-        }
-        // Continue searching for matching rows until you hit an empty hash map entry
-        ++found;
-        // If you hit the end of the hash map, wrap around to the beginning
-        if (end == found) found = multi_map.begin();
-        // Next entry is empty, stop searching
-        if (unused_key == found->first) running = false;
-      } else {
-        // Continue searching for matching rows until you hit an empty hash table entry
-        ++found;
-        // If you hit the end of the hash map, wrap around to the beginning
-        if (end == found) found = multi_map.begin();
-        // Next entry is empty, stop searching
-        if (unused_key == found->first) running = false;
+/**
+ * @brief Joins the probe table to a small build table through a hash table in shared memory
+ *
+ * Every block inserts the build rows into its own open-addressing table of
+ * `1 << SHARED_JOIN_TABLE_BITS` slots, then probes it with a grid-stride range of probe rows, so
+ * that the probes never touch global memory. Launched twice: a counting pass that adds the exact
+ * output size to `output_size`, and a writing pass that fills the output. In the writing pass,
+ * each warp reserves the output of its rows with one atomic add.
+ *
+ * @tparam JoinKind The type of join to be performed, INNER_JOIN or LEFT_JOIN
+ * @tparam block_size The number of threads per block, a multiple of the warp size
+ * @tparam count_only Whether this is the counting pass
+ *
+ * @param[in] hash_build Row hasher for the build table
+ * @param[in] build_table_num_rows The number of rows in the build table, at most
+ * `SHARED_JOIN_MAX_BUILD_ROWS`
+ * @param[in] hash_probe Row hasher for the probe table
+ * @param[in] check_row_equality The row equality comparator of probe and build rows
+ * @param[in] probe_table_num_rows The number of rows in the probe table
+ * @param[out] output_size The output size, in the counting pass
+ * @param[in,out] write_index Number of output rows reserved so far, in the writing pass
+ * @param[out] join_output_l The probe row indices of the output, in the writing pass
+ * @param[out] join_output_r The build row indices of the output, in the writing pass
+ */
+template <join_kind JoinKind, int block_size, bool count_only>
+__global__ void shared_hash_join(row_hash hash_build,
+                                 const cudf::size_type build_table_num_rows,
+                                 row_hash hash_probe,
+                                 row_equality check_row_equality,
+                                 const cudf::size_type probe_table_num_rows,
+                                 unsigned long long* output_size,
+                                 cudf::size_type* write_index,
+                                 cudf::size_type* join_output_l,
+                                 cudf::size_type* join_output_r)
+{
+  constexpr int table_size = 1 << SHARED_JOIN_TABLE_BITS;
+  constexpr uint32_t mask  = table_size - 1;
+  __shared__ uint32_t slot_hashes[table_size];
+  __shared__ cudf::size_type slot_rows[table_size];
+
+  // The slot is taken from the high bits of the hash and the low bits are kept to compare
+  constexpr int slot_shift = 8 * sizeof(row_hash_value_type) - SHARED_JOIN_TABLE_BITS;
+  auto const slot_of       = [](row_hash_value_type hash) {
+    return static_cast<uint32_t>(hash >> slot_shift);
+  };
+
+  for (int i = threadIdx.x; i < table_size; i += block_size) { slot_rows[i] = JoinNoneValue; }
+  __syncthreads();
+  for (cudf::size_type row = threadIdx.x; row < build_table_num_rows; row += block_size) {
+    auto const hash = hash_build(row);
+    auto slot       = slot_of(hash);
+    while (atomicCAS(&slot_rows[slot], JoinNoneValue, row) != JoinNoneValue) {
+      slot = (slot + 1) & mask;
+    }
+    slot_hashes[slot] = static_cast<uint32_t>(hash);
+  }
+  __syncthreads();
+
+  // Calls `f` with the build row of every match of a probe row
+  auto const for_each_match = [&](cudf::size_type probe_row, auto f) {
+    auto const hash       = hash_probe(probe_row);
+    auto const short_hash = static_cast<uint32_t>(hash);
+    for (auto slot = slot_of(hash); slot_rows[slot] != JoinNoneValue; slot = (slot + 1) & mask) {
+      if (slot_hashes[slot] == short_hash && check_row_equality(probe_row, slot_rows[slot])) {
+        f(slot_rows[slot]);
       }
+    }
+  };
+
+  unsigned long long thread_counter{0};
+  const int lane_id = threadIdx.x % detail::warp_size;
+  // The loop bounds are uniform across the block, so that whole warps take part in the shuffles
+  for (cudf::size_type first_row = blockIdx.x * block_size; first_row < probe_table_num_rows;
+       first_row += block_size * gridDim.x) {
+    auto const probe_row = first_row + static_cast<cudf::size_type>(threadIdx.x);
+    cudf::size_type num_matches{0};
+    if (probe_row < probe_table_num_rows) {
+      for_each_match(probe_row, [&](cudf::size_type) { ++num_matches; });
+      if (JoinKind == join_kind::LEFT_JOIN && num_matches == 0) { num_matches = 1; }
+    }
+    if (count_only) {
+      thread_counter += num_matches;
+      continue;
+    }
 
-      if ((JoinKind == join_kind::LEFT_JOIN) && (!running) && (!found_match)) { ++thread_counter; }
+    // Warp-wide inclusive scan of the output rows, reserved with one atomic add
+    cudf::size_type offset = num_matches;
+    for (int delta = 1; delta < detail::warp_size; delta *= 2) {
+      auto const value = __shfl_up_sync(0xffffffff, offset, delta);
+      if (lane_id >= delta) { offset += value; }
+    }
+    auto const warp_total = __shfl_sync(0xffffffff, offset, detail::warp_size - 1);
+    cudf::size_type warp_start{0};
+    if (lane_id == detail::warp_size - 1 && warp_total > 0) {
+      warp_start = atomicAdd(write_index, warp_total);
+    }
+    auto pos = __shfl_sync(0xffffffff, warp_start, detail::warp_size - 1) + offset - num_matches;
+
+    if (num_matches == 0) { continue; }
+    bool found_match = false;
+    for_each_match(probe_row, [&](cudf::size_type build_row) {
+      join_output_l[pos] = probe_row;
+      join_output_r[pos] = build_row;
+      ++pos;
+      found_match = true;
+    });
+    if (JoinKind == join_kind::LEFT_JOIN && !found_match) {
+      join_output_l[pos] = probe_row;
+      join_output_r[pos] = JoinNoneValue;
     }
   }
 
-  using BlockReduce = cub::BlockReduce<cudf::size_type, block_size>;
-  __shared__ typename BlockReduce::TempStorage temp_storage;
-  cudf::size_type block_counter = BlockReduce(temp_storage).Sum(thread_counter);
+  if (count_only) {
+    using BlockReduce = cub::BlockReduce<unsigned long long, block_size>;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    unsigned long long block_counter = BlockReduce(temp_storage).Sum(thread_counter);
+    if (threadIdx.x == 0) atomicAdd(output_size, block_counter);
+  }
+}
 
-  // Add block counter to global counter
-  if (threadIdx.x == 0) atomicAdd(output_size, block_counter);
+/**
+ * @brief Computes the number of output rows of every probe row of a join
+ *
+ * @tparam JoinKind The type of join to be performed
+ * @tparam multimap_type The datatype of the hash table
+ *
+ * @param[in] multi_map The hash table built on the build table
+ * @param[in] hash_probe Row hasher for the probe table
+ * @param[in] check_row_equality The row equality comparator
+ * @param[in] probe_table_num_rows The number of rows in the probe table
+ * @param[out] row_output_sizes The number of output rows of each probe row
+ */
+template <join_kind JoinKind, typename multimap_type>
+__global__ void compute_join_row_output_sizes(multimap_type multi_map,
+                                              row_hash hash_probe,
+                                              row_equality check_row_equality,
+                                              const cudf::size_type probe_table_num_rows,
+                                              std::size_t* row_output_sizes)
+{
+  const cudf::size_type start_idx = threadIdx.x + blockIdx.x * blockDim.x;
+  const cudf::size_type stride    = blockDim.x * gridDim.x;
+  for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_table_num_rows;
+       probe_row_index += stride) {
+    row_output_sizes[probe_row_index] = count_probe_row_matches<JoinKind>(
+      multi_map, hash_probe, check_row_equality, probe_row_index);
+  }
 }
 
 /**
@@ -319,7 +467,7 @@ __global__ void probe_hash_table(multimap_type multi_map,
     // hash value to determine the location where to search for the row in the hash map
 
     // Only probe the hash table if the probe row is valid
-    hash_value_type probe_row_hash_value{0};
+    row_hash_value_type probe_row_hash_value{0};
     // Search the hash map for the hash value of the probe row
     probe_row_hash_value = hash_probe(probe_row_index);
     found                = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+
+#include "hash_join.cuh"
+#include "join_common_utils.hpp"
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Finds the range of rows of `right` equal to each row of `left`
+ *
+ * @param left The left table key columns
+ * @param right The right table key columns, sorted
+ * @param lower Output: first row of `right` not less than each row of `left`
+ * @param upper Output: first row of `right` greater than each row of `left`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+template <bool has_nulls>
+void find_equal_ranges(table_device_view const& left,
+                       table_device_view const& right,
+                       size_type* lower,
+                       size_type* upper,
+                       cudaStream_t stream)
+{
+  // Consecutive left rows are sorted too, so neighbouring searches visit the same right rows
+  auto const rows = thrust::make_counting_iterator<size_type>(0);
+  thrust::lower_bound(scratch_policy(stream)->on(stream),
+                      rows,
+                      rows + right.num_rows(),
+                      rows,
+                      rows + left.num_rows(),
+                      lower,
+                      row_lexicographic_comparator<has_nulls>(right, left));
+  thrust::upper_bound(scratch_policy(stream)->on(stream),
+                      rows,
+                      rows + right.num_rows(),
+                      rows,
+                      rows + left.num_rows(),
+                      upper,
+                      row_lexicographic_comparator<has_nulls>(left, right));
+}
+
+/**
+ * @brief Computes the join of two tables sorted on their key columns
+ *
+ * Instead of building a hash table, every left row binary searches its range of equal right
+ * rows. The ranges are turned into output offsets, and each output row then finds its left row
+ * with a search of the offsets, so that long ranges of duplicates are spread evenly across
+ * the threads. Besides the output, the join allocates only two indices per left row.
+ *
+ * Both tables must be sorted in the default order of `cudf::sort`: ascending, with nulls first.
+ *
+ * @throw cudf::logic_error if the output exceeds the maximum column size
+ *
+ * @tparam JoinKind The type of join to be performed, INNER_JOIN or LEFT_JOIN
+ *
+ * @param left The left table key columns, sorted
+ * @param right The right table key columns, sorted
+ * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Join output indices vector pair
+ */
+template <join_kind JoinKind>
+VectorPair get_base_merge_join_indices(table_view const& left,
+                                       table_view const& right,
+                                       null_equality compare_nulls,
+                                       cudaStream_t stream)
+{
+  static_assert(JoinKind == join_kind::INNER_JOIN || JoinKind == join_kind::LEFT_JOIN,
+                "Unsupported join type");
+  if (JoinKind == join_kind::LEFT_JOIN && right.num_rows() == 0) {
+    return get_trivial_left_join_indices(left, stream);
+  }
+  if (left.num_rows() == 0 || right.num_rows() == 0) { return VectorPair{}; }
+
+  auto const d_left  = table_device_view::create(left, stream);
+  auto const d_right = table_device_view::create(right, stream);
+  auto lower   = make_scratch_vector<size_type>(left.num_rows(), 0, stream);
+  auto offsets = make_scratch_vector<size_type>(left.num_rows(), 0, stream);
+  if (has_nulls(left) || has_nulls(right)) {
+    find_equal_ranges<true>(*d_left, *d_right, lower.data().get(), offsets.data().get(), stream);
+  } else {
+    find_equal_ranges<false>(*d_left, *d_right, lower.data().get(), offsets.data().get(), stream);
+  }
+
+  // Turn the ranges into output row counts; unmatched rows are marked with JoinNoneValue
+  bool const skip_nulls = compare_nulls == null_equality::UNEQUAL && has_nulls(left);
+  thrust::for_each(
+    scratch_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(left.num_rows()),
+    [left   = *d_left,
+     lower  = lower.data().get(),
+     counts = offsets.data().get(),
+     skip_nulls] __device__(size_type row) {
+      auto count = counts[row] - lower[row];
+      if (skip_nulls) {
+        for (size_type i = 0; i < left.num_columns(); ++i) {
+          if (left.column(i).is_null(row)) { count = 0; }
+        }
+      }
+      if (count == 0) { lower[row] = JoinNoneValue; }
+      counts[row] = (JoinKind == join_kind::LEFT_JOIN && count == 0) ? 1 : count;
+    });
+  auto const join_size = thrust::reduce(scratch_policy(stream)->on(stream),
+                                        offsets.begin(),
+                                        offsets.end(),
+                                        int64_t{0},
+                                        thrust::plus<int64_t>());
+  CUDF_EXPECTS(join_size < MAX_JOIN_SIZE, "The join output is too large");
+  if (join_size == 0) { return VectorPair{}; }
+  thrust::exclusive_scan(
+    scratch_policy(stream)->on(stream), offsets.begin(), offsets.end(), offsets.begin());
+
+  // The left row of an output row is the last one whose offset does not exceed it
+  auto left_indices  = make_scratch_vector<size_type>(join_size, 0, stream);
+  auto right_indices = make_scratch_vector<size_type>(join_size, 0, stream);
+  auto const outputs = thrust::make_counting_iterator<size_type>(0);
+  thrust::upper_bound(scratch_policy(stream)->on(stream),
+                      offsets.begin(),
+                      offsets.end(),
+                      outputs,
+                      outputs + join_size,
+                      left_indices.begin());
+  thrust::for_each(scratch_policy(stream)->on(stream),
+                   outputs,
+                   outputs + join_size,
+                   [left_out  = left_indices.data().get(),
+                    right_out = right_indices.data().get(),
+                    lower     = lower.data().get(),
+                    offsets   = offsets.data().get()] __device__(size_type idx) {
+                     auto const row = left_out[idx] - 1;
+                     left_out[idx]  = row;
+                     right_out[idx] = (lower[row] == JoinNoneValue)
+                                        ? JoinNoneValue
+                                        : lower[row] + (idx - offsets[row]);
+                   });
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+}  // namespace cudf
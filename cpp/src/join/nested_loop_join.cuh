@@ -70,7 +70,7 @@ size_type estimate_nested_loop_join_output_size(table_device_view left,
 
   // Allocate storage for the counter used to get the size of the join output
   size_type h_size_estimate{0};
-  rmm::device_scalar<size_type> size_estimate(0, stream);
+  rmm::device_scalar<size_type> size_estimate(0, stream, get_scratch_resource());
 
   CHECK_CUDA(stream);
 
@@ -140,18 +140,19 @@ get_base_nested_loop_join_indices(table_view const& left,
 
   // If the estimated output size is zero, return immediately
   if (estimated_size == 0) {
-    return std::make_pair(rmm::device_vector<size_type>{}, rmm::device_vector<size_type>{});
+    return std::make_pair(make_scratch_vector<size_type>(0, 0, stream),
+                          make_scratch_vector<size_type>(0, 0, stream));
   }
 
   // Because we are approximating the number of joined elements, our approximation
   // might be incorrect and we might have underestimated the number of joined elements.
   // As such we will need to de-allocate memory and re-allocate memory to ensure
   // that the final output is correct.
-  rmm::device_scalar<size_type> write_index(0, stream);
+  rmm::device_scalar<size_type> write_index(0, stream, get_scratch_resource());
   size_type join_size{0};
 
-  rmm::device_vector<size_type> left_indices;
-  rmm::device_vector<size_type> right_indices;
+  auto left_indices  = make_scratch_vector<size_type>(0, 0, stream);
+  auto right_indices = make_scratch_vector<size_type>(0, 0, stream);
   auto current_estimated_size = estimated_size;
   do {
     left_indices.resize(estimated_size);
@@ -22,7 +22,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
-#include <hash/concurrent_unordered_map.cuh>
+#include <hash/static_map.cuh>
 
 #include <join/join_common_utils.hpp>
 
@@ -30,6 +30,8 @@
 #include <join/hash_join.cuh>
 #include "cudf/types.hpp"
 
+#include <thrust/iterator/constant_iterator.h>
+
 namespace cudf {
 namespace detail {
 /**
@@ -76,6 +78,8 @@ std::unique_ptr<cudf::table> left_semi_anti_join(
   cudf::table_view const& right,
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
+  column_view const& left_hashes,
+  column_view const& right_hashes,
   std::vector<cudf::size_type> const& return_columns,
   null_equality compare_nulls,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
@@ -96,33 +100,34 @@ std::unique_ptr<cudf::table> left_semi_anti_join(
     return std::make_unique<table>(left.select(return_columns), stream, mr);
   }
 
-  // Only care about existence, so we'll use an unordered map (other joins need a multimap)
-  using hash_table_type = concurrent_unordered_map<cudf::size_type, bool, row_hash, row_equality>;
+  // Rows hashed differently never match, so both sides must be hashed alike
+  CUDF_EXPECTS(left.num_rows() == 0 or (left_hashes.size() == 0) == (right_hashes.size() == 0),
+               "Either both or neither of the tables must have precomputed hashes");
+
+  // Only care about existence, so we'll use a map of unique keys (other joins need a multimap)
+  using hash_table_type = static_map<cudf::size_type, bool>;
 
   // Create hash table containing all keys found in right table
   auto right_rows_d            = table_device_view::create(right.select(right_on), stream);
   size_t const hash_table_size = compute_hash_table_size(right.num_rows());
-  row_hash hash_build{*right_rows_d};
+  row_hash hash_build{*right_rows_d, right_hashes};
   row_equality equality_build{*right_rows_d, *right_rows_d, compare_nulls == null_equality::EQUAL};
 
   // Going to join it with left table
   auto left_rows_d = table_device_view::create(left.select(left_on), stream);
-  row_hash hash_probe{*left_rows_d};
+  row_hash hash_probe{*left_rows_d, left_hashes};
   row_equality equality_probe{*left_rows_d, *right_rows_d, compare_nulls == null_equality::EQUAL};
 
-  auto hash_table_ptr = hash_table_type::create(hash_table_size,
-                                                std::numeric_limits<bool>::max(),
-                                                std::numeric_limits<cudf::size_type>::max(),
-                                                hash_build,
-                                                equality_build);
-  auto hash_table     = *hash_table_ptr;
-
-  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
-                     thrust::make_counting_iterator<size_type>(0),
-                     right.num_rows(),
-                     [hash_table] __device__(size_type idx) mutable {
-                       hash_table.insert(thrust::make_pair(idx, true));
-                     });
+  hash_table_type hash_table(hash_table_size,
+                             std::numeric_limits<cudf::size_type>::max(),
+                             stream,
+                             get_scratch_resource());
+  hash_table.insert(thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(right.num_rows()),
+                    thrust::make_constant_iterator(true),
+                    hash_build,
+                    equality_build,
+                    stream);
 
   //
   // Now we have a hash table, we need to iterate over the rows of the left table
@@ -132,21 +137,28 @@ std::unique_ptr<cudf::table> left_semi_anti_join(
   // For semi join we want contains to be true, for anti join we want contains to be false
   bool join_type_boolean = (JoinKind == join_kind::LEFT_SEMI_JOIN);
 
-  rmm::device_vector<size_type> gather_map(left.num_rows());
+  auto contained = make_scratch_vector<bool>(left.num_rows(), false, stream);
+  hash_table.contains(thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(left.num_rows()),
+                      contained.begin(),
+                      hash_probe,
+                      equality_probe,
+                      stream);
+
+  auto gather_map = make_scratch_vector<size_type>(left.num_rows(), 0, stream);
 
   // gather_map_end will be the end of valid data in gather_map
-  auto gather_map_end = thrust::copy_if(
-    rmm::exec_policy(stream)->on(stream),
-    thrust::make_counting_iterator<size_type>(0),
-    thrust::make_counting_iterator<size_type>(left.num_rows()),
-    gather_map.begin(),
-    [hash_table, join_type_boolean, hash_probe, equality_probe] __device__(size_type idx) {
-      auto pos = hash_table.find(idx, hash_probe, equality_probe);
-      return (pos != hash_table.end()) == join_type_boolean;
-    });
+  auto gather_map_end = thrust::copy_if(scratch_policy(stream)->on(stream),
+                                        thrust::make_counting_iterator<size_type>(0),
+                                        thrust::make_counting_iterator<size_type>(left.num_rows()),
+                                        contained.begin(),
+                                        gather_map.begin(),
+                                        [join_type_boolean] __device__(bool found) {
+                                          return found == join_type_boolean;
+                                        });
 
   return cudf::detail::gather(
-    left.select(return_columns), gather_map.begin(), gather_map_end, false, mr);
+    left.select(return_columns), gather_map.begin(), gather_map_end, false, mr, stream);
 }
 }  // namespace detail
 
@@ -156,11 +168,36 @@ std::unique_ptr<cudf::table> left_semi_join(cudf::table_view const& left,
                                             std::vector<cudf::size_type> const& right_on,
                                             std::vector<cudf::size_type> const& return_columns,
                                             null_equality compare_nulls,
-                                            rmm::mr::device_memory_resource* mr)
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   return detail::left_semi_anti_join<detail::join_kind::LEFT_SEMI_JOIN>(
-    left, right, left_on, right_on, return_columns, compare_nulls, mr, 0);
+    left, right, left_on, right_on, {}, {}, return_columns, compare_nulls, mr, stream);
+}
+
+std::unique_ptr<cudf::table> left_semi_join(cudf::table_view const& left,
+                                            cudf::table_view const& right,
+                                            std::vector<cudf::size_type> const& left_on,
+                                            std::vector<cudf::size_type> const& right_on,
+                                            cudf::column_view const& left_hashes,
+                                            cudf::column_view const& right_hashes,
+                                            std::vector<cudf::size_type> const& return_columns,
+                                            null_equality compare_nulls,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::left_semi_anti_join<detail::join_kind::LEFT_SEMI_JOIN>(left,
+                                                               right,
+                                                               left_on,
+                                                               right_on,
+                                                               left_hashes,
+                                                               right_hashes,
+                                                               return_columns,
+                                                               compare_nulls,
+                                                               mr,
+                                                               stream);
 }
 
 std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
@@ -169,11 +206,36 @@ std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
                                             std::vector<cudf::size_type> const& right_on,
                                             std::vector<cudf::size_type> const& return_columns,
                                             null_equality compare_nulls,
-                                            rmm::mr::device_memory_resource* mr)
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   return detail::left_semi_anti_join<detail::join_kind::LEFT_ANTI_JOIN>(
-    left, right, left_on, right_on, return_columns, compare_nulls, mr, 0);
+    left, right, left_on, right_on, {}, {}, return_columns, compare_nulls, mr, stream);
+}
+
+std::unique_ptr<cudf::table> left_anti_join(cudf::table_view const& left,
+                                            cudf::table_view const& right,
+                                            std::vector<cudf::size_type> const& left_on,
+                                            std::vector<cudf::size_type> const& right_on,
+                                            cudf::column_view const& left_hashes,
+                                            cudf::column_view const& right_hashes,
+                                            std::vector<cudf::size_type> const& return_columns,
+                                            null_equality compare_nulls,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::left_semi_anti_join<detail::join_kind::LEFT_ANTI_JOIN>(left,
+                                                               right,
+                                                               left_on,
+                                                               right_on,
+                                                               left_hashes,
+                                                               right_hashes,
+                                                               return_columns,
+                                                               compare_nulls,
+                                                               mr,
+                                                               stream);
 }
 
 }  // namespace cudf
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/lists/contains.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+namespace {
+/**
+ * @brief Searches each list for a key of the element type `Element`
+ *
+ * Each row scans its own list, so the work is proportional to the number of elements.
+ */
+template <typename Element>
+std::unique_ptr<column> search_lists(lists_column_view const& lists,
+                                     Element key,
+                                     cudaStream_t stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = lists.size();
+
+  auto output = make_numeric_column(data_type{type_id::BOOL8},
+                                   num_rows,
+                                   copy_bitmask(lists.parent(), stream, mr),
+                                   lists.null_count(),
+                                   stream,
+                                   mr);
+  auto const d_child   = column_device_view::create(lists.child(), stream);
+  auto const d_offsets = lists.offsets().data<size_type>() + lists.offset();
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    output->mutable_view().begin<bool>(),
+                    [d_child = *d_child, d_offsets, key] __device__(size_type idx) {
+                      for (auto i = d_offsets[idx]; i < d_offsets[idx + 1]; ++i) {
+                        if (d_child.is_valid(i) && d_child.element<Element>(i) == key) {
+                          return true;
+                        }
+                      }
+                      return false;
+                    });
+  return output;
+}
+
+struct contains_fn {
+  template <typename Element, std::enable_if_t<is_fixed_width<Element>()>* = nullptr>
+  std::unique_ptr<column> operator()(lists_column_view const& lists,
+                                     cudf::scalar const& search_key,
+                                     cudaStream_t stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto const key = static_cast<scalar_type_t<Element> const&>(search_key).value(stream);
+    return search_lists(lists, key, stream, mr);
+  }
+
+  template <typename Element,
+            std::enable_if_t<std::is_same<Element, string_view>::value>* = nullptr>
+  std::unique_ptr<column> operator()(lists_column_view const& lists,
+                                     cudf::scalar const& search_key,
+                                     cudaStream_t stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto const& key = static_cast<string_scalar const&>(search_key);
+    return search_lists(lists, string_view{key.data(), key.size()}, stream, mr);
+  }
+
+  template <typename Element,
+            std::enable_if_t<not is_fixed_width<Element>() and
+                             not std::is_same<Element, string_view>::value>* = nullptr>
+  std::unique_ptr<column> operator()(lists_column_view const&,
+                                     cudf::scalar const&,
+                                     cudaStream_t,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unsupported list element type for contains");
+  }
+};
+
+}  // namespace
+
+/**
+ * @copydoc cudf::lists::contains
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<column> contains(lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 cudaStream_t stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = lists.size();
+  if (num_rows == 0) { return make_empty_column(data_type{type_id::BOOL8}); }
+  CUDF_EXPECTS(search_key.type() == lists.child().type(),
+               "Type of the search key must match the type of the list elements");
+  if (not search_key.is_valid(stream)) {
+    return make_numeric_column(
+      data_type{type_id::BOOL8}, num_rows, mask_state::ALL_NULL, stream, mr);
+  }
+  return type_dispatcher(lists.child().type(), contains_fn{}, lists, search_key, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> contains(lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains(lists, search_key, 0, mr);
+}
+
+}  // namespace lists
+}  // namespace cudf
@@ -20,20 +20,56 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <memory>
 
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
 namespace cudf {
 namespace lists {
 namespace detail {
 
 namespace {
 
+/**
+ * @brief Offsets of one input lists column and its position in the output
+ */
+struct offsets_partition {
+  size_type const* offsets;  ///< Offsets child of the column
+  size_type first_list;      ///< Index of the first list of the column in the output
+  size_type shift;           ///< Index of the first child element of the column in the output
+};
+
+/**
+ * @brief Computes one merged offset, finding its source column with a binary search
+ */
+struct merge_offsets_fn {
+  offsets_partition const* partitions;
+  size_type num_partitions;
+
+  __device__ size_type operator()(size_type index) const
+  {
+    // The final offset of the output falls in the last column and is its end offset
+    auto const it = thrust::upper_bound(
+      thrust::seq,
+      partitions,
+      partitions + num_partitions,
+      index,
+      [](size_type index, offsets_partition const& p) { return index < p.first_list; });
+    auto const& partition = *(it - 1);
+    return partition.offsets[index - partition.first_list] + partition.shift;
+  }
+};
+
 /**
  * @brief Merges the offsets child columns of multiple list columns into one.
  *
  * Since offsets are all relative to the start of their respective column,
- * all offsets are shifted to account for the new starting position
+ * all offsets are shifted to account for the new starting position. All the
+ * columns are merged with a single transform.
  *
  * @param[in] columns               Vector of lists columns to concatenate
  * @param[in] total_list_count      Total number of lists contained in the columns
@@ -50,24 +86,31 @@ std::unique_ptr<column> merge_offsets(std::vector<lists_column_view> const& colu
   // outgoing offsets
   auto merged_offsets = cudf::make_fixed_width_column(
     data_type{type_id::INT32}, total_list_count + 1, mask_state::UNALLOCATED, stream, mr);
-  mutable_column_device_view d_merged_offsets(*merged_offsets, 0, 0);
+  auto d_merged_offsets = merged_offsets->mutable_view().data<size_type>();
 
-  // merge offsets
-  // TODO : this could probably be done as a single gpu operation if done as a kernel.
+  // empty columns may not have an offsets child
+  std::vector<offsets_partition> partitions;
   size_type shift = 0;
   size_type count = 0;
-  std::for_each(columns.begin(), columns.end(), [&](lists_column_view const& c) {
+  for (auto const& c : columns) {
     if (c.size() > 0) {
-      column_device_view offsets(c.offsets(), 0, 0);
-      thrust::transform(rmm::exec_policy(stream)->on(stream),
-                        offsets.begin<size_type>(),
-                        offsets.end<size_type>(),
-                        d_merged_offsets.begin<size_type>() + count,
-                        [shift] __device__(size_type offset) { return offset + shift; });
+      partitions.push_back({c.offsets().data<size_type>(), count, shift});
       shift += c.child().size();
-      count += offsets.size() - 1;
+      count += c.size();
     }
-  });
+  }
+  if (partitions.empty()) {
+    CUDA_TRY(cudaMemsetAsync(d_merged_offsets, 0, sizeof(size_type), stream));
+    return merged_offsets;
+  }
+
+  auto const d_partitions   = cudf::detail::make_device_uvector_async(partitions, stream);
+  auto const num_partitions = static_cast<size_type>(partitions.size());
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(total_list_count + 1),
+                    d_merged_offsets,
+                    merge_offsets_fn{d_partitions.data(), num_partitions});
 
   return merged_offsets;
 }
@@ -111,10 +154,9 @@ std::unique_ptr<column> concatenate(
   auto offsets = merge_offsets(lists_columns, total_list_count, stream, mr);
 
   // if any of the input columns have nulls, construct the output mask
-  bool const has_nulls =
-    std::any_of(columns.cbegin(), columns.cend(), [](auto const& col) { return col.has_nulls(); });
+  bool const has_nulls        = cudf::detail::may_have_nulls(columns);
   rmm::device_buffer null_mask = create_null_mask(
-    total_list_count, has_nulls ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED);
+    total_list_count, has_nulls ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED, stream, mr);
   if (has_nulls) {
     cudf::detail::concatenate_masks(columns, static_cast<bitmask_type*>(null_mask.data()), stream);
   }
@@ -123,7 +165,7 @@ std::unique_ptr<column> concatenate(
   return make_lists_column(total_list_count,
                            std::move(offsets),
                            std::move(data),
-                           has_nulls ? UNKNOWN_NULL_COUNT : 0,
+                           has_nulls ? cudf::detail::concatenated_null_count(columns) : 0,
                            std::move(null_mask),
                            stream,
                            mr);
@@ -13,22 +13,162 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-#include <thrust/binary_search.h>
-#include <thrust/iterator/iterator_facade.h>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/lists/detail/gather.cuh>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/copy.h>
+
+#include <limits>
 
 namespace cudf {
 namespace lists {
 namespace detail {
+namespace {
+constexpr size_type block_size = 256;
+// Lists shorter than this many elements are copied by one thread, longer ones by a warp
+constexpr size_type warp_list_size = 32;
+// Lists of at least this many elements are copied by a whole block
+constexpr size_type block_list_size = 4096;
+
+/**
+ * @brief Returns true for the rows whose gathered list has a size in `[min_size, max_size)`
+ */
+struct list_size_in_range {
+  size_type const* offsets;
+  size_type min_size;
+  size_type max_size;
+
+  __device__ bool operator()(size_type row) const
+  {
+    auto const size = offsets[row + 1] - offsets[row];
+    return size >= min_size && size < max_size;
+  }
+};
 
 /**
- * @brief List gatherer function object.
+ * @brief Copies the child elements of a subset of the gathered lists, `group_size` threads per
+ * list
+ *
+ * Element `i` of the list of `row` goes from `base_offsets[row] + i` in the source child to
+ * `offsets[row] + i` in the gathered child. The range of a list is contiguous in both, so the
+ * threads of a group process consecutive elements and no element looks up its list.
  *
- * The iterator needed for gathering at level N+1 needs to reference the offsets
- * from level N and the "base" offsets used from level N-1.  An example of
- * the gather map needed for level N+1 (see documentation for make_gather_data for
- * the full example)
+ * @param rows The rows of the gathered lists to copy
+ * @param num_rows The number of rows in `rows`
+ * @param offsets The offsets of the gathered lists
+ * @param base_offsets The offset of each gathered list in the source child
+ * @param copy Function object called with the gathered and source indices of each element
+ */
+template <size_type group_size, typename Copier>
+__launch_bounds__(block_size) __global__
+  void copy_list_elements_kernel(size_type const* rows,
+                                 size_type num_rows,
+                                 size_type const* offsets,
+                                 int32_t const* base_offsets,
+                                 Copier copy)
+{
+  constexpr size_type groups_per_block = block_size / group_size;
+  auto const lane                      = static_cast<size_type>(threadIdx.x) % group_size;
+  auto idx = static_cast<size_type>(blockIdx.x * groups_per_block + threadIdx.x / group_size);
+  for (; idx < num_rows; idx += gridDim.x * groups_per_block) {
+    auto const row    = rows[idx];
+    auto const begin  = offsets[row];
+    auto const size   = offsets[row + 1] - begin;
+    auto const source = base_offsets[row];
+    for (size_type i = lane; i < size; i += group_size) { copy(begin + i, source + i); }
+  }
+}
+
+template <size_type group_size, typename Copier>
+void copy_list_elements(size_type const* rows,
+                        size_type num_rows,
+                        gather_data const& gd,
+                        Copier copy,
+                        cudaStream_t stream)
+{
+  if (num_rows == 0) { return; }
+  cudf::detail::grid_1d grid{num_rows * group_size, block_size};
+  copy_list_elements_kernel<group_size><<<grid.num_blocks, block_size, 0, stream>>>(
+    rows, num_rows, gd.offsets->view().data<size_type>(), gd.base_offsets.data(), copy);
+}
+
+/**
+ * @brief Calls `copy(index, source_index)` for each element of the child of the gathered lists,
+ * with its index in the gathered child and in the source child
+ *
+ * The rows are binned by the size of their list and each bin is copied with as many threads per
+ * list as suits its sizes, so that a few very long lists do not serialize on single threads and
+ * short lists do not leave most of a warp idle.
+ */
+template <typename Copier>
+void for_each_list_element(gather_data const& gd, Copier copy, cudaStream_t stream)
+{
+  auto const num_rows = static_cast<size_type>(gd.base_offsets.size());
+  if (num_rows == 0 || gd.gather_map_size == 0) { return; }
+  auto const offsets = gd.offsets->view().data<size_type>();
+
+  rmm::device_uvector<size_type> rows(num_rows, stream);
+  auto const count_begin = thrust::make_counting_iterator<size_type>(0);
+  auto const count_end   = count_begin + num_rows;
+  auto bin_rows = [&](size_type* bin_begin, size_type min_size, size_type max_size) {
+    return thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                           count_begin,
+                           count_end,
+                           bin_begin,
+                           list_size_in_range{offsets, min_size, max_size});
+  };
+  auto const thread_end = bin_rows(rows.data(), 1, warp_list_size);
+  auto const warp_end   = bin_rows(thread_end, warp_list_size, block_list_size);
+  auto const block_end =
+    bin_rows(warp_end, block_list_size, std::numeric_limits<size_type>::max());
+
+  auto const num_thread_rows = static_cast<size_type>(thread_end - rows.data());
+  auto const num_warp_rows   = static_cast<size_type>(warp_end - thread_end);
+  auto const num_block_rows  = static_cast<size_type>(block_end - warp_end);
+  copy_list_elements<1>(rows.data(), num_thread_rows, gd, copy, stream);
+  copy_list_elements<warp_size>(rows.data() + num_thread_rows, num_warp_rows, gd, copy, stream);
+  copy_list_elements<block_size>(
+    rows.data() + num_thread_rows + num_warp_rows, num_block_rows, gd, copy, stream);
+}
+
+/**
+ * @brief Writes the source index of each element of the gathered child
+ */
+struct gather_map_writer {
+  size_type* gather_map;
+
+  __device__ void operator()(size_type index, size_type source_index) const
+  {
+    gather_map[index] = source_index;
+  }
+};
+
+/**
+ * @brief Copies the fixed-width elements of the gathered child
+ */
+struct fixed_width_element_copier {
+  char* output;
+  char const* input;
+  int element_size;
+
+  __device__ void operator()(size_type index, size_type source_index) const
+  {
+    cudf::detail::copy_fixed_width_element(
+      output + static_cast<int64_t>(index) * element_size,
+      input + static_cast<int64_t>(source_index) * element_size,
+      element_size);
+  }
+};
+
+/**
+ * @brief Returns the gather map of the child of the gathered lists
+ *
+ * The gather map for level N+1 is built from the offsets from level N and the "base" offsets
+ * from level N-1. For example (see documentation for make_gather_data for the full example)
  *
  * @code{.pseudo}
  * level N-1 offsets               : [0, 2, 5, 10], gather map[0, 2]
@@ -36,49 +176,39 @@ namespace detail {
  * level N offsets                 : [0, 2, 7]
  * "base" offsets from level N-1   : [0, 5]
  *
- * desired output sequence for the level N+1 gather map
- * [0, 1, 5, 6, 7, 8, 9]
- *
- * The generation of this sequence in this functor works as follows
- *
- * step 1, generate row index sequence
- * [0, 0, 1, 1, 1, 1, 1]
- * step 2, generate row subindex sequence
- * [0, 1, 0, 1, 2, 3, 4]
- * step 3, add base offsets to get the final sequence
- * [0, 1, 5, 6, 7, 8, 9]
+ * gather map for level N+1        : [0, 1, 5, 6, 7, 8, 9]
  * @endcode
  *
+ * Each list is a contiguous range of both maps, so the ranges are written one list at a time.
  */
-struct list_gatherer {
-  typedef size_type argument_type;
-  typedef size_type result_type;
-
-  size_t offset_count;
-  size_type const* base_offsets;
-  size_type const* offsets;
+rmm::device_uvector<size_type> make_child_gather_map(gather_data const& gd,
+                                                     cudaStream_t stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  rmm::device_uvector<size_type> gather_map(gd.gather_map_size, stream, mr);
+  for_each_list_element(gd, gather_map_writer{gather_map.data()}, stream);
+  return gather_map;
+}
 
-  list_gatherer(gather_data const& gd)
-    : offset_count{gd.base_offsets.size()},
-      base_offsets{gd.base_offsets.data()},
-      offsets{gd.offsets->mutable_view().data<size_type>()}
-  {
-  }
+/**
+ * @brief Returns the null mask of the rows of `column` in `gather_map`, and its null count
+ */
+std::pair<rmm::device_buffer, size_type> gather_null_mask(column_view const& column,
+                                                          size_type const* gather_map,
+                                                          size_type gather_map_size,
+                                                          cudaStream_t stream,
+                                                          rmm::mr::device_memory_resource* mr)
+{
+  auto list_cdv = column_device_view::create(column, stream);
+  return cudf::detail::valid_if(
+    gather_map,
+    gather_map + gather_map_size,
+    [cdv = *list_cdv] __device__(int index) { return cdv.is_valid(index) ? true : false; },
+    stream,
+    mr);
+}
 
-  __device__ result_type operator()(argument_type index)
-  {
-    // the "upper bound" of the span for a given offset is always offsets+1;
-    size_type const* upper_bound_start = offsets + 1;
-    // "step 1" from above
-    auto const bound =
-      thrust::upper_bound(thrust::seq, upper_bound_start, upper_bound_start + offset_count, index);
-    size_type offset_index = thrust::distance(upper_bound_start, bound);
-    // "step 2" from above
-    size_type offset_subindex = offset_index == 0 ? index : index - offsets[offset_index];
-    // "step 3" from above
-    return offset_subindex + base_offsets[offset_index];
-  }
-};
+}  // namespace
 
 /**
  * @copydoc cudf::lists::detail::gather_list_leaf
@@ -89,18 +219,35 @@ std::unique_ptr<column> gather_list_leaf(column_view const& column,
                                          cudaStream_t stream,
                                          rmm::mr::device_memory_resource* mr)
 {
-  // gather map iterator for this level (N)
-  auto gather_map_begin = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<size_type>(0), list_gatherer{gd});
   size_type gather_map_size = gd.gather_map_size;
 
+  // fixed-width elements are copied list by list, without a gather map unless the nulls need one
+  if (is_fixed_width(column.type())) {
+    auto leaf_column = make_fixed_width_column(
+      column.type(), gather_map_size, mask_state::UNALLOCATED, stream, mr);
+    auto const element_size = static_cast<int>(size_of(column.type()));
+    auto const input  = static_cast<char const*>(column.head()) +
+                       static_cast<int64_t>(column.offset()) * element_size;
+    auto const output = static_cast<char*>(leaf_column->mutable_view().head());
+    for_each_list_element(gd, fixed_width_element_copier{output, input, element_size}, stream);
+    if (column.null_count() > 0) {
+      auto const gather_map = make_child_gather_map(gd, stream, rmm::mr::get_default_resource());
+      auto validity = gather_null_mask(column, gather_map.data(), gather_map_size, stream, mr);
+      leaf_column->set_null_mask(std::move(validity.first), validity.second);
+    }
+    return leaf_column;
+  }
+
+  // gather map for this level (N)
+  auto const gather_map = make_child_gather_map(gd, stream, rmm::mr::get_default_resource());
+
   // call the normal gather
   auto leaf_column =
     cudf::type_dispatcher(column.type(),
                           cudf::detail::column_gatherer{},
                           column,
-                          gather_map_begin,
-                          gather_map_begin + gather_map_size,
+                          gather_map.data(),
+                          gather_map.data() + gather_map_size,
                           // note : we don't need to bother checking for out-of-bounds here since
                           // our inputs at this stage aren't coming from the user.
                           false,
@@ -115,14 +262,7 @@ std::unique_ptr<column> gather_list_leaf(column_view const& column,
   // returns a column that does this work correctly.
   size_type null_count = column.null_count();
   if (null_count > 0) {
-    auto list_cdv = column_device_view::create(column);
-    auto validity = cudf::detail::valid_if(
-      gather_map_begin,
-      gather_map_begin + gd.gather_map_size,
-      [cdv = *list_cdv] __device__(int index) { return cdv.is_valid(index) ? true : false; },
-      stream,
-      mr);
-
+    auto validity = gather_null_mask(column, gather_map.data(), gather_map_size, stream, mr);
     leaf_column->set_null_mask(std::move(validity.first), validity.second);
   }
 
@@ -138,22 +278,16 @@ std::unique_ptr<column> gather_list_nested(cudf::lists_column_view const& list,
                                            cudaStream_t stream,
                                            rmm::mr::device_memory_resource* mr)
 {
-  // gather map iterator for this level (N)
-  auto gather_map_begin = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<size_type>(0), list_gatherer{gd});
+  // gather map for this level (N)
+  auto const gather_map     = make_child_gather_map(gd, stream, rmm::mr::get_default_resource());
   size_type gather_map_size = gd.gather_map_size;
 
   // gather the bitmask, if relevant
   rmm::device_buffer null_mask{0, stream, mr};
   size_type null_count = list.null_count();
   if (null_count > 0) {
-    auto list_cdv = column_device_view::create(list.parent());
-    auto validity = cudf::detail::valid_if(
-      gather_map_begin,
-      gather_map_begin + gather_map_size,
-      [cdv = *list_cdv] __device__(int index) { return cdv.is_valid(index) ? true : false; },
-      stream,
-      mr);
+    auto validity =
+      gather_null_mask(list.parent(), gather_map.data(), gather_map_size, stream, mr);
     null_mask  = std::move(validity.first);
     null_count = validity.second;
   }
@@ -161,7 +295,7 @@ std::unique_ptr<column> gather_list_nested(cudf::lists_column_view const& list,
   // generate gather_data for next level (N+1), potentially recycling the temporary
   // base_offsets buffer.
   gather_data child_gd = make_gather_data<false>(
-    list, gather_map_begin, gather_map_size, stream, mr, std::move(gd.base_offsets));
+    list, gather_map.data(), gather_map_size, stream, mr, std::move(gd.base_offsets));
 
   // the nesting case.
   if (list.child().type() == cudf::data_type{type_id::LIST}) {
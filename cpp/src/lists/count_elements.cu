@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/lists/count_elements.hpp>
+#include <cudf/null_mask.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+/**
+ * @copydoc cudf::lists::count_elements
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<column> count_elements(lists_column_view const& input,
+                                       cudaStream_t stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = input.size();
+  if (num_rows == 0) { return make_empty_column(data_type{type_to_id<size_type>()}); }
+
+  auto output = make_numeric_column(data_type{type_to_id<size_type>()},
+                                   num_rows,
+                                   copy_bitmask(input.parent(), stream, mr),
+                                   input.null_count(),
+                                   stream,
+                                   mr);
+  auto const d_offsets = input.offsets().data<size_type>() + input.offset();
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    output->mutable_view().begin<size_type>(),
+                    [d_offsets] __device__(size_type idx) {
+                      return d_offsets[idx + 1] - d_offsets[idx];
+                    });
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> count_elements(lists_column_view const& input,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::count_elements(input, 0, mr);
+}
+
+}  // namespace lists
+}  // namespace cudf
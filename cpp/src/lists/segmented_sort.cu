@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/lists/sorting.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+/**
+ * @copydoc cudf::lists::sort_lists
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<column> sort_lists(lists_column_view const& input,
+                                   order column_order,
+                                   null_order null_precedence,
+                                   cudaStream_t stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = input.size();
+  if (num_rows == 0) { return empty_like(input.parent()); }
+  CUDF_EXPECTS(input.child().type().id() != type_id::LIST, "Nested lists are not supported");
+
+  // Only the elements of the rows of the view are sorted
+  auto const d_offsets = input.offsets().data<size_type>() + input.offset();
+  auto const first =
+    cudf::detail::get_value<size_type>(input.offsets(), input.offset(), stream);
+  auto const last =
+    cudf::detail::get_value<size_type>(input.offsets(), input.offset() + num_rows, stream);
+  auto const elements = cudf::detail::slice(input.child(), first, last);
+
+  // The list of each element is its segment label; sorting on (label, element) sorts each
+  // list in place, the same way the sort groupby sorts the values within each group
+  rmm::device_vector<size_type> labels(last - first);
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      d_offsets + 1,
+                      d_offsets + num_rows + 1,
+                      thrust::make_counting_iterator<size_type>(first),
+                      thrust::make_counting_iterator<size_type>(last),
+                      labels.begin());
+  auto const labels_view =
+    column_view(data_type{type_to_id<size_type>()}, last - first, labels.data().get());
+  auto const sort_order =
+    cudf::detail::stable_sorted_order(table_view{{labels_view, elements}},
+                                      {order::ASCENDING, column_order},
+                                      {null_order::AFTER, null_precedence},
+                                      rmm::mr::get_default_resource(),
+                                      stream);
+  auto sorted = cudf::detail::gather(table_view{{elements}},
+                                     sort_order->view(),
+                                     cudf::detail::out_of_bounds_policy::NULLIFY,
+                                     cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                     mr,
+                                     stream);
+
+  // The offsets of the view are rebased on its first element
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    d_offsets,
+                    d_offsets + num_rows + 1,
+                    offsets->mutable_view().begin<size_type>(),
+                    [first] __device__(size_type offset) { return offset - first; });
+
+  return make_lists_column(num_rows,
+                           std::move(offsets),
+                           std::move(sorted->release()[0]),
+                           input.null_count(),
+                           copy_bitmask(input.parent(), stream, mr),
+                           stream,
+                           mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> sort_lists(lists_column_view const& input,
+                                   order column_order,
+                                   null_order null_precedence,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_lists(input, column_order, null_precedence, 0, mr);
+}
+
+}  // namespace lists
+}  // namespace cudf
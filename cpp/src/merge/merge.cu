@@ -15,19 +15,27 @@
  */
 #include <rmm/thrust_rmm_allocator.h>
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/merge.hpp>
 #include <cudf/strings/detail/merge.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
+#include <thrust/transform.h>
 #include <thrust/tuple.h>
 
-#include <queue>
+#include <algorithm>
 #include <vector>
 
 namespace {  // anonym.
@@ -380,41 +388,131 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
-struct merge_queue_item {
-  table_view view;
-  table_ptr_type table;
-  // Priority is a separate member to ensure that moving from an object
-  // does not change its priority (which would ruin the queue invariant)
-  cudf::size_type priority = 0;
+/**
+ * @brief Computes the row of the merged output of each row of the concatenated inputs.
+ *
+ * A row of input `t` lands at its index within `t` plus, for each other input, the number of rows
+ * ordered before it: the rows less than or equal to it for the inputs before `t`, and the rows
+ * less than it for the inputs after `t`, so that equal rows are ordered by input.
+ */
+template <bool has_nulls>
+struct merged_position_fn {
+  row_lexicographic_comparator<has_nulls> less;
+  size_type const* input_offsets;
+  size_type num_inputs;
 
-  merge_queue_item(table_view const& view, table_ptr_type&& table)
-    : view{view}, table{std::move(table)}, priority{-view.num_rows()}
+  __device__ size_type operator()(size_type row) const
   {
+    auto const input =
+      thrust::upper_bound(thrust::seq, input_offsets, input_offsets + num_inputs, row) -
+      input_offsets - 1;
+    size_type position = row - input_offsets[input];
+    for (size_type other = 0; other < num_inputs; ++other) {
+      if (other == input) { continue; }
+      auto const begin = thrust::make_counting_iterator(input_offsets[other]);
+      auto const end   = thrust::make_counting_iterator(input_offsets[other + 1]);
+      auto const it    = (other < input) ? thrust::upper_bound(thrust::seq, begin, end, row, less)
+                                      : thrust::lower_bound(thrust::seq, begin, end, row, less);
+      position += thrust::distance(begin, it);
+    }
+    return position;
   }
-
-  bool operator<(merge_queue_item const& other) const { return priority < other.priority; }
 };
 
-// Helper function to ensure that moving out of the priority_queue is "atomic"
-template <typename T>
-T top_and_pop(std::priority_queue<T>& q)
+/**
+ * @brief Computes the row of the merged output of each row of the concatenated inputs.
+ *
+ * @param keys Key columns of all the inputs, concatenated
+ * @param input_offsets Index of the first row of each input in `keys`, and the number of rows
+ * @param column_order Sort order types of the key columns
+ * @param null_precedence Array indicating the order of nulls with respect to non-nulls
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+rmm::device_vector<size_type> merged_positions(table_view const& keys,
+                                               std::vector<size_type> const& input_offsets,
+                                               std::vector<order> const& column_order,
+                                               std::vector<null_order> const& null_precedence,
+                                               cudaStream_t stream)
 {
-  auto moved = std::move(const_cast<T&>(q.top()));
-  q.pop();
-  return moved;
+  auto const num_rows = keys.num_rows();
+  rmm::device_vector<size_type> positions(num_rows);
+  if (num_rows == 0) { return positions; }
+
+  auto const d_keys            = table_device_view::create(keys, stream);
+  auto const d_column_order    = make_device_uvector_async(column_order, stream);
+  auto const d_null_precedence = make_device_uvector_async(null_precedence, stream);
+  auto const d_input_offsets   = make_device_uvector_async(input_offsets, stream);
+  auto const num_inputs        = static_cast<size_type>(input_offsets.size() - 1);
+  auto const* p_null_precedence = null_precedence.empty() ? nullptr : d_null_precedence.data();
+
+  auto const counting = thrust::make_counting_iterator<size_type>(0);
+  if (has_nulls(keys)) {
+    auto const less = row_lexicographic_comparator<true>(
+      *d_keys, *d_keys, d_column_order.data(), p_null_precedence);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      counting,
+                      counting + num_rows,
+                      positions.begin(),
+                      merged_position_fn<true>{less, d_input_offsets.data(), num_inputs});
+  } else {
+    auto const less = row_lexicographic_comparator<false>(
+      *d_keys, *d_keys, d_column_order.data(), p_null_precedence);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      counting,
+                      counting + num_rows,
+                      positions.begin(),
+                      merged_position_fn<false>{less, d_input_offsets.data(), num_inputs});
+  }
+  CHECK_CUDA(stream);
+  return positions;
 }
 
-}  // namespace
+/**
+ * @brief Reorders the rows of `input` so that row `i` lands at row `positions[i] - base`.
+ */
+table_ptr_type gather_merged(table_view const& input,
+                             size_type const* positions,
+                             size_type base,
+                             rmm::mr::device_memory_resource* mr,
+                             cudaStream_t stream)
+{
+  auto const num_rows = input.num_rows();
+  rmm::device_vector<size_type> gather_map(num_rows);
+  auto d_gather_map = gather_map.data().get();
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_rows,
+                     [positions, base, d_gather_map] __device__(size_type row) {
+                       d_gather_map[positions[row] - base] = row;
+                     });
+  return detail::gather(input, gather_map.begin(), gather_map.end(), false, mr, stream);
+}
 
-table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
-                     std::vector<cudf::size_type> const& key_cols,
-                     std::vector<cudf::order> const& column_order,
-                     std::vector<cudf::null_order> const& null_precedence,
-                     rmm::mr::device_memory_resource* mr,
-                     cudaStream_t stream = 0)
+/**
+ * @brief Merges sorted tables in a single pass.
+ */
+table_ptr_type multiway_merge(std::vector<table_view> const& tables_to_merge,
+                              std::vector<cudf::size_type> const& key_cols,
+                              std::vector<cudf::order> const& column_order,
+                              std::vector<cudf::null_order> const& null_precedence,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
 {
-  if (tables_to_merge.empty()) { return std::make_unique<cudf::table>(); }
+  std::vector<size_type> input_offsets{0};
+  for (auto const& table : tables_to_merge) {
+    input_offsets.push_back(input_offsets.back() + table.num_rows());
+  }
+  auto const concatenated =
+    detail::concatenate(tables_to_merge, rmm::mr::get_default_resource(), stream);
+  auto const positions = merged_positions(
+    concatenated->view().select(key_cols), input_offsets, column_order, null_precedence, stream);
+  return gather_merged(concatenated->view(), positions.data().get(), 0, mr, stream);
+}
 
+void validate_merge_inputs(std::vector<table_view> const& tables_to_merge,
+                           std::vector<cudf::size_type> const& key_cols,
+                           std::vector<cudf::order> const& column_order)
+{
   auto const& first_table = tables_to_merge.front();
   auto const n_cols       = first_table.num_columns();
 
@@ -433,46 +531,209 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
 
   CUDF_EXPECTS(key_cols.size() == column_order.size(),
                "Mismatched size between key_cols and column_order");
+}
 
-  // A queue of (table view, table) pairs
-  std::priority_queue<merge_queue_item> merge_queue;
-  // The table pointer is null if we do not own the table (input tables)
-  std::for_each(tables_to_merge.begin(), tables_to_merge.end(), [&](auto const& table) {
-    if (table.num_rows() > 0) merge_queue.emplace(table, table_ptr_type());
-  });
+}  // namespace
+
+// Maximum number of tables merged in a single pass; ranking a row costs one binary search per
+// other table, so very large sets of tables are merged in groups
+constexpr size_t max_merge_ways = 32;
+
+table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
+                     std::vector<cudf::size_type> const& key_cols,
+                     std::vector<cudf::order> const& column_order,
+                     std::vector<cudf::null_order> const& null_precedence,
+                     rmm::mr::device_memory_resource* mr,
+                     cudaStream_t stream = 0)
+{
+  if (tables_to_merge.empty()) { return std::make_unique<cudf::table>(); }
+  validate_merge_inputs(tables_to_merge, key_cols, column_order);
+
+  std::vector<table_view> inputs;
+  std::copy_if(tables_to_merge.begin(),
+               tables_to_merge.end(),
+               std::back_inserter(inputs),
+               [](auto const& table) { return table.num_rows() > 0; });
 
   // If there is only one non-empty table_view, return its copy
-  if (merge_queue.size() == 1) { return std::make_unique<cudf::table>(merge_queue.top().view); }
+  if (inputs.size() == 1) { return std::make_unique<cudf::table>(inputs.front()); }
   // No inputs have rows, return a table with same columns as the first one
-  if (merge_queue.empty()) { return empty_like(first_table); }
-
-  // Pick the two smallest tables and merge them
-  // Until there is only one table left in the queue
-  while (merge_queue.size() > 1) {
-    // To delete the intermediate table at the end of the block
-    auto const left_table = top_and_pop(merge_queue);
-    // Deallocated at the end of the block
-    auto const right_table = top_and_pop(merge_queue);
-
-    // Only use mr for the output table
-    auto const& new_tbl_rm = merge_queue.empty() ? mr : rmm::mr::get_default_resource();
-    auto merged_table      = merge(left_table.view,
-                              right_table.view,
-                              key_cols,
-                              column_order,
-                              null_precedence,
-                              new_tbl_rm,
-                              stream);
-
-    auto const merged_table_view = merged_table->view();
-    merge_queue.emplace(merged_table_view, std::move(merged_table));
+  if (inputs.empty()) { return empty_like(tables_to_merge.front()); }
+
+  if (inputs.size() == 2) {
+    return merge(inputs[0], inputs[1], key_cols, column_order, null_precedence, mr, stream);
+  }
+
+  // Merge groups of tables until a single pass can merge the remaining ones; the intermediate
+  // tables keep the order of the inputs so that equal rows stay ordered by input
+  std::vector<table_ptr_type> intermediates;
+  while (inputs.size() > max_merge_ways) {
+    std::vector<table_ptr_type> merged;
+    for (size_t begin = 0; begin < inputs.size(); begin += max_merge_ways) {
+      auto const end = std::min(begin + max_merge_ways, inputs.size());
+      std::vector<table_view> group(inputs.begin() + begin, inputs.begin() + end);
+      if (group.size() == 1) {
+        merged.push_back(std::make_unique<cudf::table>(group.front(), stream));
+      } else {
+        merged.push_back(multiway_merge(
+          group, key_cols, column_order, null_precedence, rmm::mr::get_default_resource(), stream));
+      }
+    }
+    intermediates = std::move(merged);
+    inputs.clear();
+    std::transform(intermediates.begin(),
+                   intermediates.end(),
+                   std::back_inserter(inputs),
+                   [](auto const& table) { return table->view(); });
   }
 
-  return std::move(top_and_pop(merge_queue).table);
+  return multiway_merge(inputs, key_cols, column_order, null_precedence, mr, stream);
 }
 
+namespace {
+/**
+ * @brief Computes the number of rows of an input that land before a chunk boundary.
+ *
+ * Since the rows of an input are sorted, their merged positions are increasing, and the rows of the
+ * input falling in a chunk are contiguous.
+ */
+struct chunk_split_fn {
+  size_type const* positions;
+  size_type const* input_offsets;
+  size_type num_bounds;
+  size_type chunk_rows;
+
+  __device__ size_type operator()(size_type index) const
+  {
+    // The last bound may exceed the size_type range
+    auto const input = index / num_bounds;
+    auto const bound = static_cast<int64_t>(index % num_bounds) * chunk_rows;
+    auto const begin = positions + input_offsets[input];
+    auto const end   = positions + input_offsets[input + 1];
+    return thrust::lower_bound(thrust::seq, begin, end, bound) - begin;
+  }
+};
+
+}  // namespace
 }  // namespace detail
 
+struct chunked_merge::impl {
+  impl(std::vector<table_view> const& tables_to_merge,
+       std::vector<cudf::size_type> const& key_cols,
+       std::vector<cudf::order> const& column_order,
+       std::vector<cudf::null_order> const& null_precedence,
+       size_type chunk_rows,
+       cudaStream_t stream)
+    : _tables(tables_to_merge), _chunk_rows(chunk_rows)
+  {
+    CUDF_EXPECTS(not tables_to_merge.empty(), "Empty list of tables to merge");
+    CUDF_EXPECTS(chunk_rows > 0, "Invalid number of rows per chunk");
+    detail::validate_merge_inputs(tables_to_merge, key_cols, column_order);
+
+    _input_offsets.push_back(0);
+    std::vector<table_view> keys;
+    for (auto const& table : _tables) {
+      _input_offsets.push_back(_input_offsets.back() + table.num_rows());
+      keys.push_back(table.select(key_cols));
+    }
+    _num_rows   = _input_offsets.back();
+    _num_chunks = static_cast<size_type>((int64_t{_num_rows} + chunk_rows - 1) / chunk_rows);
+    if (_num_rows == 0) { return; }
+
+    // The key columns are concatenated only to rank the rows
+    _positions = detail::merged_positions(
+      detail::concatenate(keys, rmm::mr::get_default_resource(), stream)->view(),
+      _input_offsets,
+      column_order,
+      null_precedence,
+      stream);
+
+    // Find the rows of each input in each chunk once for all chunks
+    auto const num_bounds = _num_chunks + 1;
+    auto const d_offsets  = detail::make_device_uvector_async(_input_offsets, stream);
+    auto const num_splits = static_cast<size_type>(_tables.size()) * num_bounds;
+    rmm::device_vector<size_type> d_splits(num_splits);
+    thrust::transform(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_splits),
+      d_splits.begin(),
+      detail::chunk_split_fn{_positions.data().get(), d_offsets.data(), num_bounds, chunk_rows});
+    _splits.resize(num_splits);
+    CUDA_TRY(cudaMemcpyAsync(_splits.data(),
+                             d_splits.data().get(),
+                             num_splits * sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+
+  bool has_next() const { return _next_chunk < _num_chunks; }
+
+  std::unique_ptr<table> next(rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+  {
+    CUDF_EXPECTS(has_next(), "No chunks left to merge");
+    auto const chunk      = _next_chunk++;
+    auto const num_bounds = _num_chunks + 1;
+    auto const first_row  = chunk * _chunk_rows;
+    auto const chunk_size = std::min(_chunk_rows, _num_rows - first_row);
+
+    // Gather the rows of each input in the chunk, along with their merged positions
+    std::vector<table_view> slices;
+    rmm::device_vector<size_type> positions(chunk_size);
+    size_type count = 0;
+    for (size_t input = 0; input < _tables.size(); ++input) {
+      auto const begin = _splits[input * num_bounds + chunk];
+      auto const end   = _splits[input * num_bounds + chunk + 1];
+      if (begin == end) { continue; }
+      slices.push_back(cudf::slice(_tables[input], {begin, end}).front());
+      CUDA_TRY(cudaMemcpyAsync(positions.data().get() + count,
+                               _positions.data().get() + _input_offsets[input] + begin,
+                               (end - begin) * sizeof(size_type),
+                               cudaMemcpyDeviceToDevice,
+                               stream));
+      count += end - begin;
+    }
+
+    if (slices.size() == 1) { return std::make_unique<table>(slices.front(), stream, mr); }
+    auto const concatenated = detail::concatenate(slices, rmm::mr::get_default_resource(), stream);
+    return detail::gather_merged(
+      concatenated->view(), positions.data().get(), first_row, mr, stream);
+  }
+
+ private:
+  std::vector<table_view> _tables;
+  std::vector<size_type> _input_offsets;
+  rmm::device_vector<size_type> _positions;  ///< Merged position of each row of the inputs
+  std::vector<size_type> _splits;            ///< First row of each input in each chunk
+  size_type _chunk_rows;
+  size_type _num_rows{};
+  size_type _num_chunks{};
+  size_type _next_chunk{};
+};
+
+chunked_merge::chunked_merge(std::vector<table_view> const& tables_to_merge,
+                             std::vector<cudf::size_type> const& key_cols,
+                             std::vector<cudf::order> const& column_order,
+                             std::vector<cudf::null_order> const& null_precedence,
+                             size_type chunk_rows,
+                             cudaStream_t stream)
+  : _impl(std::make_unique<impl>(
+      tables_to_merge, key_cols, column_order, null_precedence, chunk_rows, stream))
+{
+}
+
+chunked_merge::~chunked_merge() = default;
+
+bool chunked_merge::has_next() const { return _impl->has_next(); }
+
+std::unique_ptr<cudf::table> chunked_merge::next(rmm::mr::device_memory_resource* mr,
+                                                 cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->next(mr, stream);
+}
+
 std::unique_ptr<cudf::table> merge(std::vector<table_view> const& tables_to_merge,
                                    std::vector<cudf::size_type> const& key_cols,
                                    std::vector<cudf::order> const& column_order,
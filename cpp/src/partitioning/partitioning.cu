@@ -17,15 +17,31 @@
 #include <cub/cub.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/hashing.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/partitioning.hpp>
 #include <cudf/detail/scatter.cuh>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/partitioning.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 
+#include <thrust/binary_search.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <numeric>
+
 namespace cudf {
 namespace {
 // Launch configuration for optimized hash partition
@@ -38,6 +54,10 @@ constexpr size_type THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL = 1024;
 constexpr size_type FALLBACK_BLOCK_SIZE      = 256;
 constexpr size_type FALLBACK_ROWS_PER_THREAD = 1;
 
+// Above this many partitions, the per-block histograms of the fallback kernels no longer fit in
+// shared memory, so the rows are radix sorted by partition number instead
+constexpr size_type THRESHOLD_FOR_RADIX_PARTITIONING = 4096;
+
 /**
  * @brief  Functor to map a hash value to a particular 'bin' or partition number
  * that uses the modulo operation.
@@ -138,7 +158,7 @@ __global__ void compute_row_partition_numbers(row_hasher_t the_hasher,
   // and compute the partition to which the hash value belongs and increment
   // the shared memory counter for that partition
   while (row_number < num_rows) {
-    const hash_value_type row_hash_value = the_hasher(row_number);
+    auto const row_hash_value = the_hasher(row_number);
 
     const size_type partition_number = the_partitioner(row_hash_value);
 
@@ -446,17 +466,134 @@ struct copy_block_partitions_dispatcher {
   }
 };
 
+/**
+ * @brief The assignment of the rows of a table to hash partitions computed by
+ * `compute_row_partition_numbers`, from which the partitioned rows are copied
+ *
+ * With more than `THRESHOLD_FOR_RADIX_PARTITIONING` partitions, only
+ * `gather_map` and `partition_offsets` are set.
+ */
+struct hash_partitioning {
+  bool use_optimization;
+  size_type block_size;
+  size_type grid_size;
+  rmm::device_vector<size_type> row_partition_numbers;
+  rmm::device_vector<size_type> row_partition_offset;
+  rmm::device_vector<size_type> block_partition_sizes;
+  rmm::device_vector<size_type> scanned_block_partition_sizes;
+  std::vector<size_type> partition_offsets;
+  bool use_radix_partitioning;
+  rmm::device_vector<size_type> gather_map;  ///< Input row of every partitioned row
+};
+
+/**
+ * @brief Computes the hash partitioning of the rows by radix sorting them by partition number
+ *
+ * The sort makes one pass per digit of the partition numbers, e.g. two passes for up to 65536
+ * partitions: the rows are first distributed into buckets by the high digit of their partition,
+ * and each bucket is then divided by the low digit. The histograms of a pass have one counter per
+ * digit value, so the shared memory use does not depend on the number of partitions.
+ */
+template <typename row_hasher_t, typename partitioner_type>
+hash_partitioning compute_radix_partitioning(row_hasher_t const& hasher,
+                                             size_type num_rows,
+                                             size_type num_partitions,
+                                             partitioner_type const& partitioner,
+                                             cudaStream_t stream)
+{
+  rmm::device_vector<size_type> row_partition_numbers(num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    row_partition_numbers.begin(),
+                    [hasher, partitioner] __device__(size_type row) {
+                      return partitioner(hasher(row));
+                    });
+  rmm::device_vector<size_type> row_indices(num_rows);
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), row_indices.begin(), row_indices.end());
+
+  // Only the bits of the largest partition number are sorted
+  int end_bit = 0;
+  while (end_bit < 31 && (num_partitions - 1) >> end_bit != 0) { ++end_bit; }
+
+  rmm::device_vector<size_type> sorted_partition_numbers(num_rows);
+  rmm::device_vector<size_type> gather_map(num_rows);
+  std::size_t temp_storage_bytes{};
+  cub::DeviceRadixSort::SortPairs(nullptr,
+                                  temp_storage_bytes,
+                                  row_partition_numbers.data().get(),
+                                  sorted_partition_numbers.data().get(),
+                                  row_indices.data().get(),
+                                  gather_map.data().get(),
+                                  num_rows,
+                                  0,
+                                  end_bit,
+                                  stream);
+  rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+  cub::DeviceRadixSort::SortPairs(temp_storage.data(),
+                                  temp_storage_bytes,
+                                  row_partition_numbers.data().get(),
+                                  sorted_partition_numbers.data().get(),
+                                  row_indices.data().get(),
+                                  gather_map.data().get(),
+                                  num_rows,
+                                  0,
+                                  end_bit,
+                                  stream);
+
+  // Each partition starts at the first row with its number
+  rmm::device_vector<size_type> d_partition_offsets(num_partitions);
+  thrust::lower_bound(rmm::exec_policy(stream)->on(stream),
+                      sorted_partition_numbers.begin(),
+                      sorted_partition_numbers.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_partitions),
+                      d_partition_offsets.begin());
+  std::vector<size_type> partition_offsets(num_partitions);
+  CUDA_TRY(cudaMemcpyAsync(partition_offsets.data(),
+                           d_partition_offsets.data().get(),
+                           num_partitions * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  // The device offsets must outlive the copy
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  return hash_partitioning{false,
+                           FALLBACK_BLOCK_SIZE,
+                           0,
+                           {},
+                           {},
+                           {},
+                           {},
+                           std::move(partition_offsets),
+                           true,
+                           std::move(gather_map)};
+}
+
 // NOTE hash_has_nulls must be true if table_to_hash has nulls
-template <bool hash_has_nulls>
-std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
-  table_view const& input,
-  table_view const& table_to_hash,
-  size_type num_partitions,
-  rmm::mr::device_memory_resource* mr,
-  cudaStream_t stream)
+// The rows are hashed with hash_function unless their precomputed row_hashes are given
+template <template <typename> class hash_function, bool hash_has_nulls>
+hash_partitioning compute_hash_partitioning(table_view const& table_to_hash,
+                                            size_type num_partitions,
+                                            column_view const& row_hashes,
+                                            cudaStream_t stream)
 {
+  using hasher_type  = precomputed_row_hasher<hash_function, hash_has_nulls>;
+  using hash_value_t = typename hasher_type::result_type;
   auto const num_rows = table_to_hash.num_rows();
 
+  if (num_partitions > THRESHOLD_FOR_RADIX_PARTITIONING) {
+    auto const device_input = table_device_view::create(table_to_hash, stream);
+    // The partition of a row must not depend on whether its hash was precomputed
+    auto const hasher = hasher_type(*device_input, row_hashes, false);
+    if (is_power_two(num_partitions)) {
+      auto const partitioner = bitwise_partitioner<hash_value_t>(num_partitions);
+      return compute_radix_partitioning(hasher, num_rows, num_partitions, partitioner, stream);
+    }
+    auto const partitioner = modulo_partitioner<hash_value_t>(num_partitions);
+    return compute_radix_partitioning(hasher, num_rows, num_partitions, partitioner, stream);
+  }
+
   bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
   auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
   auto const rows_per_thread =
@@ -485,14 +622,14 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   auto row_partition_offset = rmm::device_vector<size_type>(num_rows);
 
   auto const device_input = table_device_view::create(table_to_hash, stream);
-  auto const hasher       = row_hasher<MurmurHash3_32, hash_has_nulls>(*device_input);
+  auto const hasher       = hasher_type(*device_input, row_hashes, false);
 
   // If the number of partitions is a power of two, we can compute the partition
   // number of each row more efficiently with bitwise operations
   if (is_power_two(num_partitions)) {
     // Determines how the mapping between hash value and partition number is
     // computed
-    using partitioner_type = bitwise_partitioner<hash_value_type>;
+    using partitioner_type = bitwise_partitioner<hash_value_t>;
 
     // Computes which partition each row belongs to by hashing the row and
     // performing a partitioning operator on the hash value. Also computes the
@@ -512,7 +649,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   } else {
     // Determines how the mapping between hash value and partition number is
     // computed
-    using partitioner_type = modulo_partitioner<hash_value_type>;
+    using partitioner_type = modulo_partitioner<hash_value_t>;
 
     // Computes which partition each row belongs to by hashing the row and
     // performing a partitioning operator on the hash value. Also computes the
@@ -556,10 +693,95 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
                            cudaMemcpyDeviceToHost,
                            stream));
 
+  return hash_partitioning{use_optimization,
+                           block_size,
+                           grid_size,
+                           std::move(row_partition_numbers),
+                           std::move(row_partition_offset),
+                           std::move(block_partition_sizes),
+                           std::move(scanned_block_partition_sizes),
+                           std::move(partition_offsets),
+                           false,
+                           {}};
+}
+
+/**
+ * @brief Computes the hash partitioning of the rows of `table_to_hash` with `hash_function`
+ */
+hash_partitioning partition_rows(table_view const& table_to_hash,
+                                 size_type num_partitions,
+                                 hash_id hash_function,
+                                 cudaStream_t stream)
+{
+  if (hash_function == hash_id::HASH_XXHASH64) {
+    if (has_nulls(table_to_hash)) {
+      return compute_hash_partitioning<XXHash_64, true>(table_to_hash, num_partitions, {}, stream);
+    } else {
+      return compute_hash_partitioning<XXHash_64, false>(
+        table_to_hash, num_partitions, {}, stream);
+    }
+  }
+  CUDF_EXPECTS(hash_function == hash_id::HASH_MURMUR3, "Unsupported hash function");
+  if (has_nulls(table_to_hash)) {
+    return compute_hash_partitioning<MurmurHash3_32, true>(
+      table_to_hash, num_partitions, {}, stream);
+  } else {
+    return compute_hash_partitioning<MurmurHash3_32, false>(
+      table_to_hash, num_partitions, {}, stream);
+  }
+}
+
+/**
+ * @brief Computes the hash partitioning of rows from their precomputed `row_hashes`
+ *
+ * 32-bit hashes are partitioned like `HASH_MURMUR3` hashes and 64-bit hashes like
+ * `HASH_XXHASH64` hashes.
+ */
+hash_partitioning partition_rows(column_view const& row_hashes,
+                                 size_type num_partitions,
+                                 cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_index_type(row_hashes.type()) and not row_hashes.nullable(),
+               "Row hashes must be a non-nullable integer column");
+  // The hasher only reads the hashes, the table just gives it the number of rows
+  auto const hashes_table = table_view{{row_hashes}};
+  if (size_of(row_hashes.type()) == sizeof(uint64_t)) {
+    return compute_hash_partitioning<XXHash_64, false>(
+      hashes_table, num_partitions, row_hashes, stream);
+  }
+  CUDF_EXPECTS(size_of(row_hashes.type()) == sizeof(uint32_t),
+               "Row hashes must be 32- or 64-bit integers");
+  return compute_hash_partitioning<MurmurHash3_32, false>(
+    hashes_table, num_partitions, row_hashes, stream);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
+  table_view const& input,
+  hash_partitioning& partitioning,
+  size_type num_partitions,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto const num_rows   = input.num_rows();
+  auto const block_size = partitioning.block_size;
+  // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
+  auto grid_size                      = partitioning.grid_size;
+  auto& row_partition_numbers         = partitioning.row_partition_numbers;
+  auto& row_partition_offset          = partitioning.row_partition_offset;
+  auto& block_partition_sizes         = partitioning.block_partition_sizes;
+  auto& scanned_block_partition_sizes = partitioning.scanned_block_partition_sizes;
+  auto& partition_offsets             = partitioning.partition_offsets;
+
+  if (partitioning.use_radix_partitioning) {
+    auto& gather_map = partitioning.gather_map;
+    auto output = detail::gather(input, gather_map.begin(), gather_map.end(), false, mr, stream);
+    return std::make_pair(std::move(output), std::move(partition_offsets));
+  }
+
   // When the number of partitions is less than a threshold, we can apply an
   // optimization using shared memory to copy values to the output buffer.
   // Otherwise, fallback to using scatter.
-  if (use_optimization) {
+  if (partitioning.use_optimization) {
     std::vector<std::unique_ptr<column>> output_cols(input.num_columns());
 
     // NOTE these pointers are non-const to workaround lambda capture bug in
@@ -720,6 +942,456 @@ struct dispatch_map_type {
     CUDF_FAIL("Unexpected, non-integral partition map.");
   }
 };
+/**
+ * @brief Computes the gather map from the partitioned rows to the rows of the input
+ */
+rmm::device_vector<size_type> partitioned_gather_map(hash_partitioning& partitioning,
+                                                     size_type num_rows,
+                                                     size_type num_partitions,
+                                                     cudaStream_t stream)
+{
+  if (partitioning.use_radix_partitioning) { return std::move(partitioning.gather_map); }
+  if (partitioning.use_optimization) {
+    return compute_gather_map(num_rows,
+                              num_partitions,
+                              partitioning.row_partition_numbers.data().get(),
+                              partitioning.row_partition_offset.data().get(),
+                              partitioning.block_partition_sizes.data().get(),
+                              partitioning.scanned_block_partition_sizes.data().get(),
+                              partitioning.grid_size,
+                              stream);
+  }
+  // invert the scatter map of the fallback path
+  auto row_output_locations{partitioning.row_partition_numbers.data().get()};
+  compute_row_output_locations<<<partitioning.grid_size,
+                                 partitioning.block_size,
+                                 num_partitions * sizeof(size_type),
+                                 stream>>>(row_output_locations,
+                                           num_rows,
+                                           num_partitions,
+                                           partitioning.scanned_block_partition_sizes.data().get());
+  rmm::device_vector<size_type> gather_map(num_rows);
+  thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_rows),
+                  partitioning.row_partition_numbers.begin(),
+                  gather_map.begin());
+  return gather_map;
+}
+
+// align the buffers of the packed partitions like those of contiguous_split
+constexpr size_t pack_align = 64;
+
+/**
+ * @brief Device pointers to the buffers of one column of one packed partition
+ */
+struct partition_column_buffers {
+  uint8_t* data;
+  bitmask_type* validity;
+  size_type* offsets;
+};
+
+/**
+ * @brief Returns the partition that contains `index`, given the `num_partitions + 1`
+ * offsets of the partitions
+ */
+__device__ size_type partition_of(size_type const* offsets,
+                                  size_type num_partitions,
+                                  size_type index)
+{
+  auto const ends = offsets + 1;
+  return static_cast<size_type>(
+    thrust::upper_bound(thrust::seq, ends, ends + num_partitions, index) - ends);
+}
+
+/**
+ * @brief Copies each partitioned row of a fixed-width column into its packed partition
+ */
+template <typename T>
+struct pack_fixed_width_fn {
+  T const* input;
+  size_type const* gather_map;
+  size_type const* partition_offsets;
+  size_type num_partitions;
+  partition_column_buffers const* buffers;
+
+  __device__ void operator()(size_type row) const
+  {
+    auto const partition = partition_of(partition_offsets, num_partitions, row);
+    auto const output    = reinterpret_cast<T*>(buffers[partition].data);
+    output[row - partition_offsets[partition]] = input[gather_map[row]];
+  }
+};
+
+struct pack_fixed_width_dispatcher {
+  template <typename T, std::enable_if_t<is_fixed_width<T>()>* = nullptr>
+  void operator()(column_view const& input,
+                  size_type const* gather_map,
+                  size_type const* partition_offsets,
+                  size_type num_partitions,
+                  partition_column_buffers const* buffers,
+                  cudaStream_t stream)
+  {
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.size(),
+      pack_fixed_width_fn<T>{
+        input.data<T>(), gather_map, partition_offsets, num_partitions, buffers});
+  }
+
+  template <typename T, std::enable_if_t<not is_fixed_width<T>()>* = nullptr>
+  void operator()(column_view const&,
+                  size_type const*,
+                  size_type const*,
+                  size_type,
+                  partition_column_buffers const*,
+                  cudaStream_t)
+  {
+    CUDF_FAIL("Unsupported type for hash_partition_and_pack");
+  }
+};
+
+/**
+ * @brief Builds each word of the null masks of the packed partitions of a column
+ *
+ * The words of all partitions are numbered consecutively by `word_offsets`. The
+ * set bits are counted in `valid_counts`, one counter per partition.
+ */
+struct pack_validity_fn {
+  bitmask_type const* input;
+  size_type input_offset;
+  size_type const* gather_map;
+  size_type const* partition_offsets;
+  size_type const* word_offsets;
+  size_type num_partitions;
+  partition_column_buffers const* buffers;
+  size_type* valid_counts;
+
+  __device__ void operator()(size_type word) const
+  {
+    auto const partition = partition_of(word_offsets, num_partitions, word);
+    auto const index     = word - word_offsets[partition];
+    auto const word_bits = static_cast<size_type>(detail::size_in_bits<bitmask_type>());
+    auto const begin     = partition_offsets[partition] + index * word_bits;
+    auto const end       = min(begin + word_bits, partition_offsets[partition + 1]);
+    bitmask_type bits = 0;
+    for (auto row = begin; row < end; ++row) {
+      if (bit_is_set(input, input_offset + gather_map[row])) {
+        bits |= bitmask_type{1} << (row - begin);
+      }
+    }
+    buffers[partition].validity[index] = bits;
+    atomicAdd(valid_counts + partition, __popc(bits));
+  }
+};
+
+/**
+ * @brief Returns the size of the string of each partitioned row
+ */
+struct partitioned_string_size_fn {
+  size_type const* offsets;
+  size_type const* gather_map;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    auto const source = gather_map[row];
+    return offsets[source + 1] - offsets[source];
+  }
+};
+
+/**
+ * @brief Copies each partitioned row of a strings column into its packed partition
+ *
+ * `output_offsets` are the offsets of the strings of all partitions; each partition
+ * rebases them to its first string.
+ */
+struct pack_strings_fn {
+  size_type const* input_offsets;
+  char const* input_chars;
+  size_type const* gather_map;
+  size_type const* output_offsets;
+  size_type const* partition_offsets;
+  size_type num_partitions;
+  partition_column_buffers const* buffers;
+
+  __device__ void operator()(size_type row) const
+  {
+    auto const partition = partition_of(partition_offsets, num_partitions, row);
+    auto const first_row = partition_offsets[partition];
+    auto const base      = output_offsets[first_row];
+    auto const& output   = buffers[partition];
+    auto const index     = row - first_row;
+    output.offsets[index] = output_offsets[row] - base;
+    // the last row of the partition also writes the end offset
+    if (row + 1 == partition_offsets[partition + 1]) {
+      output.offsets[index + 1] = output_offsets[row + 1] - base;
+    }
+    auto const source = gather_map[row];
+    auto const begin  = input_offsets[source];
+    memcpy(output.data + output_offsets[row] - base,
+           input_chars + begin,
+           input_offsets[source + 1] - begin);
+  }
+};
+
+/**
+ * @brief Writes the single offset of the strings columns of empty partitions
+ */
+struct empty_partition_offsets_fn {
+  size_type const* partition_offsets;
+  partition_column_buffers const* buffers;
+
+  __device__ void operator()(size_type partition) const
+  {
+    if (partition_offsets[partition] == partition_offsets[partition + 1]) {
+      buffers[partition].offsets[0] = 0;
+    }
+  }
+};
+
+/**
+ * @brief Copies the partitioned rows of `input` directly into one packed buffer per
+ * partition
+ *
+ * @param input The table to partition
+ * @param gather_map The input row of each partitioned row
+ * @param partition_offsets The first partitioned row of each partition
+ */
+std::vector<packed_columns> pack_partitions(table_view const& input,
+                                            rmm::device_vector<size_type> const& gather_map,
+                                            std::vector<size_type> partition_offsets,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  auto const num_rows       = input.num_rows();
+  auto const num_columns    = input.num_columns();
+  auto const num_partitions = static_cast<size_type>(partition_offsets.size());
+  partition_offsets.push_back(num_rows);
+  rmm::device_vector<size_type> const d_partition_offsets(partition_offsets);
+  auto const map = gather_map.data().get();
+
+  // offsets of the strings of each strings column in partitioned order, and their
+  // values at the partition boundaries, which give the chars size of each partition
+  std::vector<rmm::device_vector<size_type>> string_offsets(num_columns);
+  std::vector<thrust::host_vector<size_type>> chars_boundaries(num_columns);
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const& col = input.column(c);
+    CUDF_EXPECTS(is_fixed_width(col.type()) || col.type().id() == type_id::STRING,
+                 "hash_partition_and_pack supports only fixed-width and string columns");
+    if (col.type().id() != type_id::STRING) { continue; }
+    auto const offsets = strings_column_view(col).offsets().data<size_type>() + col.offset();
+    string_offsets[c]  = rmm::device_vector<size_type>(num_rows + 1, 0);
+    auto sizes         = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                 partitioned_string_size_fn{offsets, map});
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream)->on(stream), sizes, sizes + num_rows, string_offsets[c].begin() + 1);
+    rmm::device_vector<size_type> boundaries(num_partitions + 1);
+    thrust::gather(rmm::exec_policy(stream)->on(stream),
+                   d_partition_offsets.begin(),
+                   d_partition_offsets.end(),
+                   string_offsets[c].begin(),
+                   boundaries.begin());
+    chars_boundaries[c] = boundaries;
+  }
+
+  // lay out and allocate the buffer of each partition
+  std::vector<bool> has_nulls(num_columns);
+  std::transform(input.begin(), input.end(), has_nulls.begin(), [](column_view const& col) {
+    return col.has_nulls();
+  });
+  std::vector<std::unique_ptr<rmm::device_buffer>> buffers;
+  // per column, the buffers of each partition and the scan of their null mask words
+  std::vector<partition_column_buffers> h_buffers(num_columns * num_partitions);
+  std::vector<size_type> word_offsets(num_columns * (num_partitions + 1), 0);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const size = partition_offsets[p + 1] - partition_offsets[p];
+    std::vector<size_t> column_sizes(num_columns * 3);
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col = input.column(c);
+      auto const is_string = col.type().id() == type_id::STRING;
+      auto const data_size = is_string ? chars_boundaries[c][p + 1] - chars_boundaries[c][p]
+                                       : size * cudf::size_of(col.type());
+      column_sizes[c * 3] = cudf::util::round_up_safe(static_cast<size_t>(data_size), pack_align);
+      column_sizes[c * 3 + 1] =
+        has_nulls[c] ? cudf::bitmask_allocation_size_bytes(size, pack_align) : 0;
+      column_sizes[c * 3 + 2] =
+        is_string ? cudf::util::round_up_safe((size + 1) * sizeof(size_type), pack_align) : 0;
+      word_offsets[c * (num_partitions + 1) + p + 1] =
+        word_offsets[c * (num_partitions + 1) + p] + (has_nulls[c] ? num_bitmask_words(size) : 0);
+    }
+    auto const total = std::accumulate(column_sizes.begin(), column_sizes.end(), size_t{0});
+    buffers.push_back(std::make_unique<rmm::device_buffer>(total, stream, mr));
+    auto dst = static_cast<uint8_t*>(buffers.back()->data());
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto& b    = h_buffers[c * num_partitions + p];
+      b.data     = dst;
+      b.validity = column_sizes[c * 3 + 1] == 0
+                     ? nullptr
+                     : reinterpret_cast<bitmask_type*>(dst + column_sizes[c * 3]);
+      dst += column_sizes[c * 3] + column_sizes[c * 3 + 1];
+      b.offsets = reinterpret_cast<size_type*>(dst);
+      dst += column_sizes[c * 3 + 2];
+    }
+  }
+  rmm::device_vector<partition_column_buffers> const d_buffers(h_buffers);
+  rmm::device_vector<size_type> const d_word_offsets(word_offsets);
+  rmm::device_vector<size_type> valid_counts(num_columns * num_partitions, 0);
+
+  // copy the rows of each column straight into the packed partitions
+  auto const partition_offsets_ptr = d_partition_offsets.data().get();
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const& col    = input.column(c);
+    auto const buffers = d_buffers.data().get() + c * num_partitions;
+    if (col.type().id() == type_id::STRING) {
+      strings_column_view const strings(col);
+      thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         num_rows,
+                         pack_strings_fn{strings.offsets().data<size_type>() + col.offset(),
+                                         strings.chars().data<char>(),
+                                         map,
+                                         string_offsets[c].data().get(),
+                                         partition_offsets_ptr,
+                                         num_partitions,
+                                         buffers});
+      thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         num_partitions,
+                         empty_partition_offsets_fn{partition_offsets_ptr, buffers});
+    } else {
+      type_dispatcher(col.type(),
+                      pack_fixed_width_dispatcher{},
+                      col,
+                      map,
+                      partition_offsets_ptr,
+                      num_partitions,
+                      buffers,
+                      stream);
+    }
+    if (has_nulls[c]) {
+      auto const col_word_offsets = d_word_offsets.data().get() + c * (num_partitions + 1);
+      thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         word_offsets[c * (num_partitions + 1) + num_partitions],
+                         pack_validity_fn{col.null_mask(),
+                                          col.offset(),
+                                          map,
+                                          partition_offsets_ptr,
+                                          col_word_offsets,
+                                          num_partitions,
+                                          buffers,
+                                          valid_counts.data().get() + c * num_partitions});
+    }
+  }
+  thrust::host_vector<size_type> const h_valid_counts(valid_counts);
+
+  // describe each packed partition
+  std::vector<packed_columns> result;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const size = partition_offsets[p + 1] - partition_offsets[p];
+    std::vector<column_view> columns;
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col = input.column(c);
+      auto const& b   = h_buffers[c * num_partitions + p];
+      auto const null_count =
+        b.validity == nullptr ? 0 : size - h_valid_counts[c * num_partitions + p];
+      if (col.type().id() == type_id::STRING) {
+        column_view offsets{data_type{type_id::INT32}, size + 1, b.offsets};
+        column_view chars{data_type{type_id::INT8},
+                          chars_boundaries[c][p + 1] - chars_boundaries[c][p],
+                          b.data};
+        columns.push_back(
+          column_view(col.type(), size, nullptr, b.validity, null_count, 0, {offsets, chars}));
+      } else {
+        columns.push_back(column_view(col.type(), size, b.data, b.validity, null_count));
+      }
+    }
+    auto const& buffer = buffers[p];
+    auto metadata      = pack_metadata(
+      table_view{columns}, static_cast<uint8_t const*>(buffer->data()), buffer->size());
+    result.push_back(packed_columns{std::make_unique<std::vector<uint8_t>>(std::move(metadata)),
+                                    std::move(buffers[p])});
+  }
+  return result;
+}
+
+/**
+ * @brief Computes the gather map and the partition offsets of the rows of a partition map
+ *
+ * The rows of each partition keep their order in the input.
+ */
+std::pair<rmm::device_vector<size_type>, std::vector<size_type>> partition_map_gather_map(
+  column_view const& partition_map, size_type num_partitions, cudaStream_t stream)
+{
+  auto const num_rows = partition_map.size();
+  rmm::device_vector<size_type> partition_numbers(partition_map.begin<size_type>(),
+                                                  partition_map.end<size_type>());
+  rmm::device_vector<size_type> gather_map(num_rows);
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), gather_map.begin(), gather_map.end());
+  thrust::stable_sort_by_key(rmm::exec_policy(stream)->on(stream),
+                             partition_numbers.begin(),
+                             partition_numbers.end(),
+                             gather_map.begin());
+  rmm::device_vector<size_type> d_partition_offsets(num_partitions);
+  thrust::lower_bound(rmm::exec_policy(stream)->on(stream),
+                      partition_numbers.begin(),
+                      partition_numbers.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_partitions),
+                      d_partition_offsets.begin());
+  std::vector<size_type> partition_offsets(num_partitions);
+  CUDA_TRY(cudaMemcpyAsync(partition_offsets.data(),
+                           d_partition_offsets.data().get(),
+                           num_partitions * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return std::make_pair(std::move(gather_map), std::move(partition_offsets));
+}
+
+/**
+ * @brief Returns the sample at each of the evenly spaced quantiles of the sorted samples
+ */
+struct splitter_index_fn {
+  size_type const* sorted_order;
+  size_type num_samples;
+  size_type num_partitions;
+
+  __device__ size_type operator()(size_type splitter) const
+  {
+    auto const position = (static_cast<int64_t>(splitter) + 1) * num_samples / num_partitions;
+    return sorted_order[position];
+  }
+};
+
+/**
+ * @brief Returns the partition of each row of `keys`, the number of `splitters` that
+ * sort before it
+ */
+std::unique_ptr<column> range_partition_map(table_view const& keys,
+                                            table_view const& splitters,
+                                            std::vector<order> const& column_order,
+                                            std::vector<null_order> const& null_precedence,
+                                            cudaStream_t stream)
+{
+  CUDF_EXPECTS(keys.num_columns() == splitters.num_columns(),
+               "Mismatch in number of key columns and splitter columns");
+  CUDF_EXPECTS(std::equal(keys.begin(),
+                          keys.end(),
+                          splitters.begin(),
+                          [](column_view const& lhs, column_view const& rhs) {
+                            return lhs.type() == rhs.type();
+                          }),
+               "Mismatch in key and splitter column types");
+  return detail::lower_bound(splitters,
+                             keys,
+                             column_order,
+                             null_precedence,
+                             rmm::mr::get_default_resource(),
+                             stream);
+}
+
 }  // namespace
 
 namespace detail {
@@ -728,6 +1400,7 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function,
   rmm::mr::device_memory_resource* mr,
   cudaStream_t stream = 0)
 {
@@ -738,14 +1411,97 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
     return std::make_pair(empty_like(input), std::vector<size_type>{});
   }
 
-  if (has_nulls(table_to_hash)) {
-    return hash_partition_table<true>(input, table_to_hash, num_partitions, mr, stream);
-  } else {
-    return hash_partition_table<false>(input, table_to_hash, num_partitions, mr, stream);
+  auto partitioning = partition_rows(table_to_hash, num_partitions, hash_function, stream);
+  return hash_partition_table(input, partitioning, num_partitions, mr, stream);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
+  table_view const& input,
+  column_view const& row_hashes,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(row_hashes.size() == input.num_rows(), "Row hashes must have one row per input row");
+
+  // Return empty result if there are no partitions or nothing to hash
+  if (num_partitions <= 0 || input.num_rows() == 0) {
+    return std::make_pair(empty_like(input), std::vector<size_type>{});
   }
+
+  auto partitioning = partition_rows(row_hashes, num_partitions, stream);
+  return hash_partition_table(input, partitioning, num_partitions, mr, stream);
 }
 }  // namespace local
 
+namespace {
+/**
+ * @brief Returns `num_partitions` packed empty tables like `input`
+ */
+std::vector<packed_columns> pack_empty_partitions(table_view const& input,
+                                                  int num_partitions,
+                                                  rmm::mr::device_memory_resource* mr,
+                                                  cudaStream_t stream)
+{
+  auto const empty = empty_like(input);
+  std::vector<packed_columns> result;
+  for (int p = 0; p < num_partitions; ++p) {
+    result.push_back(pack(empty->view(), mr, stream));
+  }
+  return result;
+}
+
+/**
+ * @brief Packs the partitions of `input` computed by `partition_rows`
+ */
+std::vector<packed_columns> pack_hash_partitions(table_view const& input,
+                                                 hash_partitioning& partitioning,
+                                                 int num_partitions,
+                                                 rmm::mr::device_memory_resource* mr,
+                                                 cudaStream_t stream)
+{
+  auto const gather_map =
+    partitioned_gather_map(partitioning, input.num_rows(), num_partitions, stream);
+  // partition_offsets is copied back asynchronously by partition_rows
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return pack_partitions(input, gather_map, std::move(partitioning.partition_offsets), mr, stream);
+}
+}  // namespace
+
+std::vector<packed_columns> hash_partition_and_pack(table_view const& input,
+                                                    std::vector<size_type> const& columns_to_hash,
+                                                    int num_partitions,
+                                                    hash_id hash_function,
+                                                    rmm::mr::device_memory_resource* mr,
+                                                    cudaStream_t stream)
+{
+  if (num_partitions <= 0) { return {}; }
+
+  auto table_to_hash = input.select(columns_to_hash);
+
+  // Return empty partitions if there is nothing to hash, like `hash_partition`
+  if (input.num_rows() == 0 || table_to_hash.num_columns() == 0) {
+    return pack_empty_partitions(input, num_partitions, mr, stream);
+  }
+
+  auto partitioning = partition_rows(table_to_hash, num_partitions, hash_function, stream);
+  return pack_hash_partitions(input, partitioning, num_partitions, mr, stream);
+}
+
+std::vector<packed_columns> hash_partition_and_pack(table_view const& input,
+                                                    column_view const& row_hashes,
+                                                    int num_partitions,
+                                                    rmm::mr::device_memory_resource* mr,
+                                                    cudaStream_t stream)
+{
+  CUDF_EXPECTS(row_hashes.size() == input.num_rows(), "Row hashes must have one row per input row");
+  if (num_partitions <= 0) { return {}; }
+  if (input.num_rows() == 0) { return pack_empty_partitions(input, num_partitions, mr, stream); }
+
+  auto partitioning = partition_rows(row_hashes, num_partitions, stream);
+  return pack_hash_partitions(input, partitioning, num_partitions, mr, stream);
+}
+
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
   column_view const& partition_map,
@@ -764,6 +1520,86 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   return cudf::type_dispatcher(
     partition_map.type(), dispatch_map_type{}, t, partition_map, num_partitions, mr, stream);
 }
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto const partition_map = range_partition_map(
+    input.select(key_columns), splitters, column_order, null_precedence, stream);
+  return partition(input, partition_map->view(), splitters.num_rows() + 1, mr, stream);
+}
+
+std::vector<packed_columns> range_partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  auto const num_partitions = splitters.num_rows() + 1;
+  auto const partition_map  = range_partition_map(
+    input.select(key_columns), splitters, column_order, null_precedence, stream);
+  if (input.num_rows() == 0) {
+    auto const empty = empty_like(input);
+    std::vector<packed_columns> result;
+    for (size_type p = 0; p < num_partitions; ++p) {
+      result.push_back(pack(empty->view(), mr, stream));
+    }
+    return result;
+  }
+
+  rmm::device_vector<size_type> gather_map;
+  std::vector<size_type> partition_offsets;
+  std::tie(gather_map, partition_offsets) =
+    partition_map_gather_map(partition_map->view(), num_partitions, stream);
+  return pack_partitions(input, gather_map, std::move(partition_offsets), mr, stream);
+}
+
+std::unique_ptr<table> sample_splitters(table_view const& keys,
+                                        size_type num_partitions,
+                                        size_type num_samples,
+                                        std::vector<order> const& column_order,
+                                        std::vector<null_order> const& null_precedence,
+                                        int64_t seed,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive");
+  num_samples = std::min(num_samples, keys.num_rows());
+  if (num_partitions == 1 || num_samples == 0) { return empty_like(keys); }
+
+  auto const samples = sample(keys,
+                              num_samples,
+                              sample_with_replacement::FALSE,
+                              seed,
+                              rmm::mr::get_default_resource(),
+                              stream);
+  auto const sorted  = sorted_order(
+    samples->view(), column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+
+  auto splitter_indices = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_partitions - 1, mask_state::UNALLOCATED, stream);
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_partitions - 1),
+    splitter_indices->mutable_view().begin<size_type>(),
+    splitter_index_fn{sorted->view().data<size_type>(), num_samples, num_partitions});
+  return gather(samples->view(),
+                splitter_indices->view(),
+                out_of_bounds_policy::NULLIFY,
+                negative_index_policy::NOT_ALLOWED,
+                mr,
+                stream);
+}
 }  // namespace detail
 
 // Partition based on hash values
@@ -771,10 +1607,40 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   table_view const& input,
   std::vector<size_type> const& columns_to_hash,
   int num_partitions,
+  hash_id hash_function,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::local::hash_partition(input, columns_to_hash, num_partitions, mr);
+  return detail::local::hash_partition(input, columns_to_hash, num_partitions, hash_function, mr);
+}
+
+std::vector<packed_columns> hash_partition_and_pack(table_view const& input,
+                                                    std::vector<size_type> const& columns_to_hash,
+                                                    int num_partitions,
+                                                    hash_id hash_function,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_partition_and_pack(input, columns_to_hash, num_partitions, hash_function, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
+  table_view const& input,
+  column_view const& row_hashes,
+  int num_partitions,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::local::hash_partition(input, row_hashes, num_partitions, mr);
+}
+
+std::vector<packed_columns> hash_partition_and_pack(table_view const& input,
+                                                    column_view const& row_hashes,
+                                                    int num_partitions,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_partition_and_pack(input, row_hashes, num_partitions, mr);
 }
 
 // Partition based on an explicit partition map
@@ -788,4 +1654,44 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   return detail::partition(t, partition_map, num_partitions, mr);
 }
 
+// Partition based on ranges of sorted splitters
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition(
+    input, key_columns, splitters, column_order, null_precedence, mr);
+}
+
+std::vector<packed_columns> range_partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition_and_pack(
+    input, key_columns, splitters, column_order, null_precedence, mr);
+}
+
+std::unique_ptr<table> sample_splitters(table_view const& keys,
+                                        size_type num_partitions,
+                                        size_type num_samples,
+                                        std::vector<order> const& column_order,
+                                        std::vector<null_order> const& null_precedence,
+                                        int64_t seed,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sample_splitters(
+    keys, num_partitions, num_samples, column_order, null_precedence, seed, mr);
+}
+
 }  // namespace cudf
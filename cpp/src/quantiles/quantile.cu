@@ -14,17 +14,25 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <vector>
 
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/quantiles.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/scratch_memory.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <quantiles/quantiles_util.hpp>
+#include <sort/radix_sort.cuh>
+
+#include <thrust/host_vector.h>
 
 namespace cudf {
 namespace detail {
@@ -116,6 +124,249 @@ std::unique_ptr<column> quantile(column_view const& input,
   return type_dispatcher(input.type(), functor, input);
 }
 
+namespace {
+constexpr int select_radix_bits = 8;
+constexpr int select_radix_size = 1 << select_radix_bits;
+// Ranks selected in the same pass; more quantiles than this are answered by sorting
+constexpr int max_select_ranks      = 8;
+constexpr int select_block_size     = 256;
+constexpr int max_select_num_blocks = 1024;
+
+/**
+ * @brief Inverse of `to_radix_key()`
+ */
+template <typename T, typename Key = radix_key_t<T>>
+std::enable_if_t<std::is_floating_point<T>::value, T> from_radix_key(Key key)
+{
+  Key const sign_bit = Key{1} << (8 * sizeof(Key) - 1);
+  Key const bits     = (key & sign_bit) ? static_cast<Key>(key ^ sign_bit) : static_cast<Key>(~key);
+  T value;
+  std::memcpy(&value, &bits, sizeof(Key));
+  return value;
+}
+
+template <typename T, typename Key = radix_key_t<T>>
+std::enable_if_t<std::is_integral<T>::value, T> from_radix_key(Key key)
+{
+  Key const sign_bit = std::is_signed<T>::value ? Key{1} << (8 * sizeof(Key) - 1) : Key{0};
+  return static_cast<T>(static_cast<Key>(key ^ sign_bit));
+}
+
+/**
+ * @brief Prefixes of the keys of the ranks selected in a pass
+ */
+template <typename Key>
+struct select_prefixes {
+  Key values[max_select_ranks];
+};
+
+/**
+ * @brief Counts the digits of the valid keys under the prefix of every selected rank
+ *
+ * Each block counts into a shared memory histogram per rank, which is added to the global
+ * histograms once the block is done.
+ *
+ * @param input The column
+ * @param num_ranks Number of selected ranks
+ * @param prefixes Bits of every rank's key above `shift` that are known from the previous passes
+ * @param prefix_mask Mask of the known bits
+ * @param shift Position of the digit counted in this pass
+ * @param histograms `num_ranks` histograms of `select_radix_size` counts
+ */
+template <typename T, typename Key = radix_key_t<T>>
+__global__ void radix_select_histograms(column_device_view input,
+                                        int num_ranks,
+                                        select_prefixes<Key> prefixes,
+                                        Key prefix_mask,
+                                        int shift,
+                                        uint32_t* histograms)
+{
+  __shared__ uint32_t block_histograms[max_select_ranks * select_radix_size];
+  for (int i = threadIdx.x; i < num_ranks * select_radix_size; i += blockDim.x) {
+    block_histograms[i] = 0;
+  }
+  __syncthreads();
+
+  for (size_type row = threadIdx.x + blockIdx.x * blockDim.x; row < input.size();
+       row += blockDim.x * gridDim.x) {
+    if (input.is_null(row)) { continue; }
+    auto const key   = to_radix_key(input.element<T>(row));
+    auto const digit = static_cast<int>((key >> shift) & (select_radix_size - 1));
+    for (int r = 0; r < num_ranks; ++r) {
+      if ((key & prefix_mask) == prefixes.values[r]) {
+        atomicAdd(&block_histograms[r * select_radix_size + digit], 1);
+      }
+    }
+  }
+  __syncthreads();
+
+  for (int i = threadIdx.x; i < num_ranks * select_radix_size; i += blockDim.x) {
+    if (block_histograms[i] != 0) { atomicAdd(&histograms[i], block_histograms[i]); }
+  }
+}
+
+/**
+ * @brief Returns the valid values of `input` at the given ranks of its sorted order
+ *
+ * Runs one pass over the column per digit of the keys, each pass narrowing down the prefix of the
+ * key at every rank, so that the column is read `sizeof(T)` times instead of being sorted.
+ *
+ * @param input The column
+ * @param ranks Sorted, unique ranks in `[0, valid count)`, at most `max_select_ranks`
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename T, typename Key = radix_key_t<T>>
+thrust::host_vector<T> radix_select(column_view const& input,
+                                    std::vector<size_type> const& ranks,
+                                    cudaStream_t stream)
+{
+  auto const num_ranks = static_cast<int>(ranks.size());
+  auto d_input         = column_device_view::create(input, stream);
+  auto histograms      = make_scratch_vector<uint32_t>(num_ranks * select_radix_size, 0, stream);
+  std::vector<uint32_t> h_histograms(histograms.size());
+
+  grid_1d const grid{input.size(), select_block_size};
+  auto const num_blocks = std::min(grid.num_blocks, max_select_num_blocks);
+
+  select_prefixes<Key> prefixes{};
+  std::vector<size_type> remaining(ranks);
+  Key prefix_mask = 0;
+  for (int shift = static_cast<int>(sizeof(Key) * 8) - select_radix_bits; shift >= 0;
+       shift -= select_radix_bits) {
+    CUDA_TRY(cudaMemsetAsync(
+      histograms.data().get(), 0, histograms.size() * sizeof(uint32_t), stream));
+    radix_select_histograms<T><<<num_blocks, select_block_size, 0, stream>>>(
+      *d_input, num_ranks, prefixes, prefix_mask, shift, histograms.data().get());
+    CUDA_TRY(cudaMemcpyAsync(h_histograms.data(),
+                             histograms.data().get(),
+                             histograms.size() * sizeof(uint32_t),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+
+    // The digit of every rank is the bin holding it; the rank becomes its position in the bin
+    for (int r = 0; r < num_ranks; ++r) {
+      auto const* histogram = h_histograms.data() + r * select_radix_size;
+      int digit             = 0;
+      while (remaining[r] >= static_cast<size_type>(histogram[digit])) {
+        remaining[r] -= histogram[digit++];
+      }
+      prefixes.values[r] |= static_cast<Key>(digit) << shift;
+    }
+    prefix_mask |= static_cast<Key>(select_radix_size - 1) << shift;
+  }
+
+  thrust::host_vector<T> values(num_ranks);
+  std::transform(prefixes.values, prefixes.values + num_ranks, values.begin(), [](Key key) {
+    return from_radix_key<T>(key);
+  });
+  return values;
+}
+
+/**
+ * @brief Returns the ranks of the valid values needed to compute the quantiles
+ */
+std::vector<size_type> quantile_ranks(size_type size,
+                                      std::vector<double> const& q,
+                                      interpolation interp)
+{
+  std::vector<size_type> ranks;
+  for (auto const quantile : q) {
+    quantile_index const idx(size, quantile);
+    switch (interp) {
+      case interpolation::LOWER: ranks.push_back(idx.lower); break;
+      case interpolation::HIGHER: ranks.push_back(idx.higher); break;
+      case interpolation::NEAREST: ranks.push_back(idx.nearest); break;
+      default:
+        ranks.push_back(idx.lower);
+        ranks.push_back(idx.higher);
+    }
+  }
+  std::sort(ranks.begin(), ranks.end());
+  ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+  return ranks;
+}
+
+template <bool exact>
+struct quantile_select_functor {
+  template <typename T>
+  std::enable_if_t<not std::is_arithmetic<T>::value, std::unique_ptr<column>> operator()(
+    column_view const&,
+    std::vector<double> const&,
+    interpolation,
+    rmm::mr::device_memory_resource*,
+    cudaStream_t)
+  {
+    CUDF_FAIL("quantile does not support non-numeric types");
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_arithmetic<T>::value, std::unique_ptr<column>> operator()(
+    column_view const& input,
+    std::vector<double> const& q,
+    interpolation interp,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream)
+  {
+    using Result = std::conditional_t<exact, double, T>;
+
+    auto const valid_count = input.size() - input.null_count();
+    if (valid_count == 0 || q.empty()) {
+      return make_fixed_width_column(
+        data_type{type_to_id<Result>()}, q.size(), mask_state::ALL_NULL, stream, mr);
+    }
+
+    auto const ranks = quantile_ranks(valid_count, q, interp);
+    if (static_cast<int>(ranks.size()) > max_select_ranks) {
+      // Past a few ranks, sorting once is cheaper than a selection pass per digit
+      auto const sorted_idx = sorted_order(table_view{{input}},
+                                           {order::ASCENDING},
+                                           {null_order::AFTER},
+                                           get_scratch_resource(),
+                                           stream);
+      return quantile<exact>(
+        input, sorted_idx->view().data<size_type>(), valid_count, q, interp, exact, mr, stream);
+    }
+
+    auto const values = radix_select<T>(input, ranks, stream);
+    auto value_at     = [&](size_type rank) {
+      return values[std::lower_bound(ranks.begin(), ranks.end(), rank) - ranks.begin()];
+    };
+    thrust::host_vector<Result> h_output(q.size());
+    std::transform(q.begin(), q.end(), h_output.begin(), [&](double quantile) {
+      return select_quantile<Result>(value_at, valid_count, quantile, interp);
+    });
+
+    auto output = make_fixed_width_column(
+      data_type{type_to_id<Result>()}, q.size(), mask_state::UNALLOCATED, stream, mr);
+    CUDA_TRY(cudaMemcpyAsync(output->mutable_view().template data<Result>(),
+                             h_output.data(),
+                             h_output.size() * sizeof(Result),
+                             cudaMemcpyHostToDevice,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    return output;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> quantile_unsorted(column_view const& input,
+                                          std::vector<double> const& q,
+                                          interpolation interp,
+                                          bool exact,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  if (exact) {
+    return type_dispatcher(
+      input.type(), quantile_select_functor<true>{}, input, q, interp, mr, stream);
+  } else {
+    return type_dispatcher(
+      input.type(), quantile_select_functor<false>{}, input, q, interp, mr, stream);
+  }
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> quantile(column_view const& input,
@@ -150,4 +401,14 @@ std::unique_ptr<column> quantile(column_view const& input,
   }
 }
 
+std::unique_ptr<column> quantile_unsorted(column_view const& input,
+                                          std::vector<double> const& q,
+                                          interpolation interp,
+                                          bool exact,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::quantile_unsorted(input, q, interp, exact, mr, 0);
+}
+
 }  // namespace cudf
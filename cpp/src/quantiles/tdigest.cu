@@ -0,0 +1,537 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/quantiles.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+// Largest number of rows sorted at once by `tdigest`
+constexpr size_type TDIGEST_CHUNK_ROWS{1 << 24};
+
+constexpr double TDIGEST_PI{3.14159265358979323846};
+
+/**
+ * @brief The group, mean and weight of a set of centroids
+ */
+struct centroids {
+  rmm::device_vector<size_type> groups;
+  rmm::device_vector<double> means;
+  rmm::device_vector<double> weights;
+
+  explicit centroids(size_t size) : groups(size), means(size), weights(size) {}
+
+  size_t size() const { return means.size(); }
+
+  void resize(size_t size)
+  {
+    groups.resize(size);
+    means.resize(size);
+    weights.resize(size);
+  }
+};
+
+/**
+ * @brief Returns the group of a row from group labels that may be absent
+ * (`labels == nullptr`, every row is in group 0) or null (returns -1)
+ */
+struct row_group {
+  size_type const* labels;
+  bitmask_type const* label_mask;
+  size_type label_offset;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    if (labels == nullptr) { return 0; }
+    if (label_mask != nullptr and not bit_is_set(label_mask, label_offset + row)) { return -1; }
+    return labels[row];
+  }
+};
+
+/**
+ * @brief Indicates if a row has a valid, non-NaN value and a group in
+ * `[0, num_groups)`
+ */
+struct is_digested_row {
+  column_device_view values;
+  row_group group;
+  size_type num_groups;
+
+  __device__ bool operator()(size_type row) const
+  {
+    if (values.is_null(row) or isnan(values.element<double>(row))) { return false; }
+    auto const g = group(row);
+    return g >= 0 and g < num_groups;
+  }
+};
+
+/**
+ * @brief Returns the bucket of a centroid along the k1 scale function of
+ * t-digest, `k(q) = compression / (2 * pi) * asin(2 * q - 1) + compression / 4`
+ *
+ * `q` is the fraction of the weight of the group that lies before the middle
+ * of the centroid. k1 increases by one over a small range of `q` near 0 and 1,
+ * which keeps clusters small at the tails of the distribution.
+ */
+struct centroid_bucket {
+  double compression;
+
+  __device__ int operator()(thrust::tuple<double, double, double> centroid) const
+  {
+    auto const weight_before = thrust::get<0>(centroid);
+    auto const weight_after  = thrust::get<1>(centroid);  // includes the centroid
+    auto const weight        = thrust::get<2>(centroid);
+    auto const q = (weight_before + weight / 2) / (weight_before + weight_after);
+    auto const k = compression / (2 * TDIGEST_PI) * asin(2 * q - 1) + compression / 4;
+    return max(0, static_cast<int>(floor(k)));
+  }
+};
+
+/**
+ * @brief Returns the weight of a centroid and the sum of the values it summarizes
+ */
+struct weight_and_sum {
+  __device__ thrust::tuple<double, double> operator()(thrust::tuple<double, double> centroid) const
+  {
+    auto const weight = thrust::get<0>(centroid);
+    return thrust::make_tuple(weight, weight * thrust::get<1>(centroid));
+  }
+};
+
+struct add_weight_and_sum {
+  __device__ thrust::tuple<double, double> operator()(thrust::tuple<double, double> lhs,
+                                                      thrust::tuple<double, double> rhs) const
+  {
+    return thrust::make_tuple(thrust::get<0>(lhs) + thrust::get<0>(rhs),
+                              thrust::get<1>(lhs) + thrust::get<1>(rhs));
+  }
+};
+
+/**
+ * @brief Sorts centroids by group, and then by mean
+ */
+void sort_centroids(centroids& c, cudaStream_t stream)
+{
+  thrust::stable_sort_by_key(rmm::exec_policy(stream)->on(stream),
+                             c.means.begin(),
+                             c.means.end(),
+                             thrust::make_zip_iterator(
+                               thrust::make_tuple(c.groups.begin(), c.weights.begin())));
+  thrust::stable_sort_by_key(rmm::exec_policy(stream)->on(stream),
+                             c.groups.begin(),
+                             c.groups.end(),
+                             thrust::make_zip_iterator(
+                               thrust::make_tuple(c.means.begin(), c.weights.begin())));
+}
+
+/**
+ * @brief Merges adjacent centroids of the same group and k1 bucket into their
+ * weighted mean
+ *
+ * `c` must be sorted by group and then by mean, which the result also is. Since
+ * k1 spans `[0, compression / 2]`, every group keeps at most about
+ * `compression / 2` centroids.
+ */
+centroids compress(centroids const& c, double compression, cudaStream_t stream)
+{
+  auto const size = c.size();
+  rmm::device_vector<double> weight_before(size);
+  rmm::device_vector<double> weight_after(size);
+  thrust::exclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                c.groups.begin(),
+                                c.groups.end(),
+                                c.weights.begin(),
+                                weight_before.begin());
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                c.groups.rbegin(),
+                                c.groups.rend(),
+                                c.weights.rbegin(),
+                                weight_after.rbegin());
+
+  rmm::device_vector<int> buckets(size);
+  auto const bucket_input = thrust::make_zip_iterator(
+    thrust::make_tuple(weight_before.begin(), weight_after.begin(), c.weights.begin()));
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    bucket_input,
+                    bucket_input + size,
+                    buckets.begin(),
+                    centroid_bucket{compression});
+
+  centroids compressed(size);
+  rmm::device_vector<double> sums(size);
+  auto const keys =
+    thrust::make_zip_iterator(thrust::make_tuple(c.groups.begin(), buckets.begin()));
+  auto const values = thrust::make_transform_iterator(
+    thrust::make_zip_iterator(thrust::make_tuple(c.weights.begin(), c.means.begin())),
+    weight_and_sum{});
+  auto const ends = thrust::reduce_by_key(
+    rmm::exec_policy(stream)->on(stream),
+    keys,
+    keys + size,
+    values,
+    thrust::make_zip_iterator(
+      thrust::make_tuple(compressed.groups.begin(), thrust::make_discard_iterator())),
+    thrust::make_zip_iterator(thrust::make_tuple(compressed.weights.begin(), sums.begin())),
+    thrust::equal_to<thrust::tuple<size_type, int>>{},
+    add_weight_and_sum{});
+  auto const compressed_size = thrust::distance(
+    thrust::make_zip_iterator(thrust::make_tuple(compressed.weights.begin(), sums.begin())),
+    ends.second);
+
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    sums.begin(),
+                    sums.begin() + compressed_size,
+                    compressed.weights.begin(),
+                    compressed.means.begin(),
+                    thrust::divides<double>{});
+  compressed.resize(compressed_size);
+  return compressed;
+}
+
+/**
+ * @brief Merges two sets of centroids sorted by group and then by mean into one
+ * set sorted the same way
+ */
+centroids merge_sorted(centroids const& lhs, centroids const& rhs, cudaStream_t stream)
+{
+  centroids merged(lhs.size() + rhs.size());
+  thrust::merge_by_key(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_zip_iterator(thrust::make_tuple(lhs.groups.begin(), lhs.means.begin())),
+    thrust::make_zip_iterator(thrust::make_tuple(lhs.groups.end(), lhs.means.end())),
+    thrust::make_zip_iterator(thrust::make_tuple(rhs.groups.begin(), rhs.means.begin())),
+    thrust::make_zip_iterator(thrust::make_tuple(rhs.groups.end(), rhs.means.end())),
+    lhs.weights.begin(),
+    rhs.weights.begin(),
+    thrust::make_zip_iterator(thrust::make_tuple(merged.groups.begin(), merged.means.begin())),
+    merged.weights.begin());
+  return merged;
+}
+
+/**
+ * @brief Builds the digests of the rows `[begin, end)` of `values`
+ */
+centroids digest_rows(column_view const& values,
+                      column_view const& group_labels,
+                      size_type begin,
+                      size_type end,
+                      size_type num_groups,
+                      double compression,
+                      cudaStream_t stream)
+{
+  auto const rows = end - begin;
+  auto const doubles = cast(cudf::slice(values, {begin, end})[0],
+                            data_type{type_id::FLOAT64},
+                            rmm::mr::get_default_resource(),
+                            stream);
+  auto const d_values = column_device_view::create(doubles->view(), stream);
+
+  bool const has_labels{not group_labels.is_empty()};
+  row_group const group{has_labels ? group_labels.data<size_type>() + begin : nullptr,
+                        has_labels ? group_labels.null_mask() : nullptr,
+                        group_labels.offset() + begin};
+
+  centroids c(rows);
+  auto const input = thrust::make_zip_iterator(thrust::make_tuple(
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), group),
+    doubles->view().begin<double>()));
+  auto const output =
+    thrust::make_zip_iterator(thrust::make_tuple(c.groups.begin(), c.means.begin()));
+  auto const output_end = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                          input,
+                                          input + rows,
+                                          thrust::make_counting_iterator<size_type>(0),
+                                          output,
+                                          is_digested_row{*d_values, group, num_groups});
+  c.resize(thrust::distance(output, output_end));
+
+  // Every value starts as a centroid of its own
+  thrust::fill(rmm::exec_policy(stream)->on(stream), c.weights.begin(), c.weights.end(), 1.0);
+  sort_centroids(c, stream);
+  return compress(c, compression, stream);
+}
+
+void expects_valid_compression(double compression)
+{
+  CUDF_EXPECTS(compression >= 1, "t-digest compression must be at least 1");
+}
+
+void expects_valid_digests(table_view const& digests)
+{
+  CUDF_EXPECTS(digests.num_columns() == 3, "Digests must have group, mean and weight columns");
+  CUDF_EXPECTS(digests.column(0).type().id() == type_to_id<size_type>(),
+               "Digest groups must be of type INT32");
+  CUDF_EXPECTS(digests.column(1).type().id() == type_id::FLOAT64 and
+                 digests.column(2).type().id() == type_id::FLOAT64,
+               "Digest means and weights must be of type FLOAT64");
+  CUDF_EXPECTS(not has_nulls(digests), "Digests must not have nulls");
+}
+
+centroids from_table(table_view const& digests, cudaStream_t stream)
+{
+  centroids c(digests.num_rows());
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               digests.column(0).begin<size_type>(),
+               digests.column(0).end<size_type>(),
+               c.groups.begin());
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               digests.column(1).begin<double>(),
+               digests.column(1).end<double>(),
+               c.means.begin());
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               digests.column(2).begin<double>(),
+               digests.column(2).end<double>(),
+               c.weights.begin());
+  return c;
+}
+
+std::unique_ptr<table> to_table(centroids const& c,
+                                rmm::mr::device_memory_resource* mr,
+                                cudaStream_t stream)
+{
+  auto const size = static_cast<size_type>(c.size());
+  std::vector<std::unique_ptr<column>> columns;
+  columns.push_back(make_numeric_column(
+    data_type(type_to_id<size_type>()), size, mask_state::UNALLOCATED, stream, mr));
+  columns.push_back(
+    make_numeric_column(data_type{type_id::FLOAT64}, size, mask_state::UNALLOCATED, stream, mr));
+  columns.push_back(
+    make_numeric_column(data_type{type_id::FLOAT64}, size, mask_state::UNALLOCATED, stream, mr));
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               c.groups.begin(),
+               c.groups.end(),
+               columns[0]->mutable_view().begin<size_type>());
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               c.means.begin(),
+               c.means.end(),
+               columns[1]->mutable_view().begin<double>());
+  thrust::copy(rmm::exec_policy(stream)->on(stream),
+               c.weights.begin(),
+               c.weights.end(),
+               columns[2]->mutable_view().begin<double>());
+  return std::make_unique<table>(std::move(columns));
+}
+
+/**
+ * @brief Interpolates quantile `q[i % num_quantiles]` of group
+ * `i / num_quantiles` between the centers of the group's centroids
+ *
+ * The center of a centroid is the weight of the group before it plus half its
+ * own weight.
+ */
+struct interpolate_quantile {
+  size_type const* offsets;
+  double const* means;
+  double const* weights;
+  double const* weight_before;
+  double const* q;
+  size_type num_quantiles;
+
+  __device__ double center(size_type c) const { return weight_before[c] + weights[c] / 2; }
+
+  __device__ double operator()(size_type i) const
+  {
+    auto const group = i / num_quantiles;
+    auto const first = offsets[group];
+    auto const last  = offsets[group + 1] - 1;
+    if (last < first) { return 0; }
+
+    auto const rank = q[i % num_quantiles] * (weight_before[last] + weights[last]);
+    if (rank <= center(first)) { return means[first]; }
+    if (rank >= center(last)) { return means[last]; }
+
+    // Find the adjacent centroids with center(lo) <= rank < center(hi)
+    size_type lo = first;
+    size_type hi = last;
+    while (hi - lo > 1) {
+      auto const mid = lo + (hi - lo) / 2;
+      if (center(mid) <= rank) {
+        lo = mid;
+      } else {
+        hi = mid;
+      }
+    }
+    auto const t = (rank - center(lo)) / (center(hi) - center(lo));
+    return means[lo] + t * (means[hi] - means[lo]);
+  }
+};
+
+struct group_has_centroids {
+  size_type const* offsets;
+  size_type num_quantiles;
+
+  __device__ bool operator()(size_type i) const
+  {
+    auto const group = i / num_quantiles;
+    return offsets[group + 1] > offsets[group];
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<table> tdigest(column_view const& values,
+                               column_view const& group_labels,
+                               size_type num_groups,
+                               double compression,
+                               rmm::mr::device_memory_resource* mr,
+                               cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_numeric(values.type()), "t-digest requires numeric values");
+  CUDF_EXPECTS(group_labels.is_empty() or group_labels.type().id() == type_to_id<size_type>(),
+               "Group labels must be of type INT32");
+  CUDF_EXPECTS(group_labels.is_empty() or group_labels.size() == values.size(),
+               "Size mismatch between group labels and the rows they label");
+  expects_valid_compression(compression);
+
+  // Digest a bounded number of rows at a time, merging each chunk into the
+  // digests of the previous chunks
+  centroids digest(0);
+  size_type const num_rows = num_groups > 0 ? values.size() : 0;
+  for (size_type begin = 0, end = 0; begin < num_rows; begin = end) {
+    end = begin + std::min(num_rows - begin, TDIGEST_CHUNK_ROWS);
+    auto chunk = digest_rows(values, group_labels, begin, end, num_groups, compression, stream);
+    if (begin == 0) {
+      digest = std::move(chunk);
+    } else {
+      digest = compress(merge_sorted(digest, chunk, stream), compression, stream);
+    }
+  }
+  return to_table(digest, mr, stream);
+}
+
+std::unique_ptr<table> merge_tdigests(table_view const& digests,
+                                      double compression,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream)
+{
+  expects_valid_digests(digests);
+  expects_valid_compression(compression);
+  auto c = from_table(digests, stream);
+  sort_centroids(c, stream);
+  return to_table(compress(c, compression, stream), mr, stream);
+}
+
+std::unique_ptr<column> tdigest_quantiles(table_view const& digests,
+                                          size_type num_groups,
+                                          std::vector<double> const& q,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream)
+{
+  expects_valid_digests(digests);
+  CUDF_EXPECTS(num_groups >= 0, "Number of groups must not be negative");
+  CUDF_EXPECTS(std::all_of(q.begin(), q.end(), [](double p) { return p >= 0 and p <= 1; }),
+               "Quantiles must be in [0, 1]");
+
+  auto const num_rows = num_groups * static_cast<size_type>(q.size());
+  auto result         = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  if (num_rows == 0) { return result; }
+
+  auto const groups = digests.column(0);
+  rmm::device_vector<size_type> offsets(num_groups + 1);
+  thrust::lower_bound(rmm::exec_policy(stream)->on(stream),
+                      groups.begin<size_type>(),
+                      groups.end<size_type>(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_groups + 1),
+                      offsets.begin());
+
+  auto const weights = digests.column(2);
+  rmm::device_vector<double> weight_before(digests.num_rows());
+  thrust::exclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                groups.begin<size_type>(),
+                                groups.end<size_type>(),
+                                weights.begin<double>(),
+                                weight_before.begin());
+
+  rmm::device_vector<double> d_q(q);
+  auto const num_quantiles = static_cast<size_type>(q.size());
+  thrust::tabulate(rmm::exec_policy(stream)->on(stream),
+                   result->mutable_view().begin<double>(),
+                   result->mutable_view().end<double>(),
+                   interpolate_quantile{offsets.data().get(),
+                                        digests.column(1).data<double>(),
+                                        weights.data<double>(),
+                                        weight_before.data().get(),
+                                        d_q.data().get(),
+                                        num_quantiles});
+
+  auto null_mask = valid_if(thrust::make_counting_iterator<size_type>(0),
+                            thrust::make_counting_iterator<size_type>(num_rows),
+                            group_has_centroids{offsets.data().get(), num_quantiles},
+                            stream,
+                            mr);
+  if (null_mask.second > 0) { result->set_null_mask(std::move(null_mask.first), null_mask.second); }
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> tdigest(column_view const& values,
+                               column_view const& group_labels,
+                               size_type num_groups,
+                               double compression,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tdigest(values, group_labels, num_groups, compression, mr);
+}
+
+std::unique_ptr<table> merge_tdigests(table_view const& digests,
+                                      double compression,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::merge_tdigests(digests, compression, mr);
+}
+
+std::unique_ptr<column> tdigest_quantiles(table_view const& digests,
+                                          size_type num_groups,
+                                          std::vector<double> const& q,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tdigest_quantiles(digests, num_groups, q, mr);
+}
+
+}  // namespace cudf
@@ -17,11 +17,14 @@
 #include <cudf/column/column.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/quantiles.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/quantiles.hpp>
 #include <cudf/sorting.hpp>
 
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
 #include <cudf/detail/reduction_functions.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -92,18 +95,81 @@ struct reduce_dispatch_functor {
           stream,
           mr);
       } break;
+      case aggregation::APPROX_COUNT_DISTINCT: {
+        auto approx_agg = static_cast<approx_count_distinct_aggregation const *>(agg.get());
+        auto estimate =
+          detail::approx_count_distinct(col, {}, 1, approx_agg->_precision, mr, stream);
+        return get_element(*estimate, 0, mr);
+      } break;
+      case aggregation::APPROX_QUANTILE: {
+        auto quantile_agg = static_cast<approx_quantile_aggregation const *>(agg.get());
+        CUDF_EXPECTS(quantile_agg->_quantiles.size() == 1,
+                     "Reduction quantile accepts only one quantile value");
+        auto digest = detail::tdigest(
+          col, {}, 1, quantile_agg->_compression, rmm::mr::get_default_resource(), stream);
+        auto col_ptr =
+          detail::tdigest_quantiles(digest->view(), 1, quantile_agg->_quantiles, mr, stream);
+        return get_element(*col_ptr, 0, mr);
+      } break;
       default: CUDF_FAIL("Unsupported reduction operator");
     }
   }
 };
 
-std::unique_ptr<scalar> reduce(
-  column_view const &col,
-  std::unique_ptr<aggregation> const &agg,
-  data_type output_dtype,
-  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource(),
-  cudaStream_t stream                 = 0)
+namespace {
+/**
+ * @brief Reduces a fixed-point column by reducing its stored integers
+ *
+ * Only the reductions whose result on the stored integers represents the result with the scale
+ * of the column are supported: SUM, MIN and MAX.
+ */
+std::unique_ptr<scalar> fixed_point_reduce(column_view const &col,
+                                           std::unique_ptr<aggregation> const &agg,
+                                           data_type output_dtype,
+                                           rmm::mr::device_memory_resource *mr,
+                                           cudaStream_t stream)
 {
+  CUDF_EXPECTS(agg->kind == aggregation::SUM || agg->kind == aggregation::MIN ||
+                 agg->kind == aggregation::MAX,
+               "Unsupported reduction operator for fixed-point type");
+  CUDF_EXPECTS(output_dtype == target_type(col.type(), agg->kind),
+               "Invalid output type for fixed-point reduction");
+
+  auto const storage_id = [](data_type type) {
+    return type.id() == type_id::DECIMAL32 ? type_id::INT32 : type_id::INT64;
+  };
+  column_view const storage{data_type{storage_id(col.type())},
+                            col.size(),
+                            col.head(),
+                            col.null_mask(),
+                            col.null_count(),
+                            col.offset()};
+  auto const storage_result =
+    reduce(storage, agg, data_type{storage_id(output_dtype)}, mr, stream);
+
+  auto const scale    = numeric::scale_type{output_dtype.scale()};
+  auto const is_valid = storage_result->is_valid(stream);
+  if (output_dtype.id() == type_id::DECIMAL32) {
+    auto const value =
+      static_cast<numeric_scalar<int32_t> const *>(storage_result.get())->value(stream);
+    return std::make_unique<fixed_point_scalar<numeric::decimal32>>(
+      value, scale, is_valid, stream, mr);
+  }
+  auto const value =
+    static_cast<numeric_scalar<int64_t> const *>(storage_result.get())->value(stream);
+  return std::make_unique<fixed_point_scalar<numeric::decimal64>>(
+    value, scale, is_valid, stream, mr);
+}
+}  // namespace
+
+std::unique_ptr<scalar> reduce(column_view const &col,
+                               std::unique_ptr<aggregation> const &agg,
+                               data_type output_dtype,
+                               rmm::mr::device_memory_resource *mr,
+                               cudaStream_t stream)
+{
+  if (is_fixed_point(col.type())) { return fixed_point_reduce(col, agg, output_dtype, mr, stream); }
+
   std::unique_ptr<scalar> result = make_default_constructed_scalar(output_dtype);
   result->set_valid(false, stream);
 
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_vector.hpp>
+
+#include <cub/device/device_segmented_reduce.cuh>
+#include <cub/warp/warp_reduce.cuh>
+
+namespace cudf {
+namespace reduction {
+namespace detail {
+namespace {
+// Segments shorter than this on average are reduced by one warp each rather than one block each
+constexpr size_type warp_per_segment_max_average_size = 64;
+
+/**
+ * @brief Reduces each segment with one warp, for columns of many short segments
+ */
+template <int block_size, typename InputIterator, typename OutputType, typename BinaryOp>
+__launch_bounds__(block_size) __global__
+  void warp_segmented_reduce_kernel(InputIterator d_in,
+                                    size_type const* __restrict__ offsets,
+                                    size_type num_segments,
+                                    OutputType* __restrict__ d_out,
+                                    BinaryOp op,
+                                    OutputType identity)
+{
+  constexpr size_type warps_per_block = block_size / cudf::detail::warp_size;
+  using WarpReduce                    = cub::WarpReduce<OutputType>;
+  __shared__ typename WarpReduce::TempStorage temp_storage[warps_per_block];
+
+  auto const warp_id = threadIdx.x / cudf::detail::warp_size;
+  auto const lane_id = threadIdx.x % cudf::detail::warp_size;
+  for (size_type segment = blockIdx.x * warps_per_block + warp_id; segment < num_segments;
+       segment += gridDim.x * warps_per_block) {
+    OutputType value = identity;
+    for (size_type i = offsets[segment] + lane_id; i < offsets[segment + 1];
+         i += cudf::detail::warp_size) {
+      value = op(value, static_cast<OutputType>(d_in[i]));
+    }
+    value = WarpReduce(temp_storage[warp_id]).Reduce(value, op);
+    if (lane_id == 0) { d_out[segment] = value; }
+    __syncwarp();
+  }
+}
+
+/**
+ * @brief Reduces the segments of `d_in` defined by `offsets` into `d_out`
+ */
+template <typename InputIterator, typename OutputType, typename BinaryOp>
+void segmented_reduce(InputIterator d_in,
+                      size_type num_values,
+                      column_view const& offsets,
+                      OutputType* d_out,
+                      BinaryOp op,
+                      OutputType identity,
+                      cudaStream_t stream)
+{
+  auto const num_segments = offsets.size() - 1;
+  auto const d_offsets    = offsets.data<size_type>();
+  if (num_values / num_segments < warp_per_segment_max_average_size) {
+    constexpr int block_size = 256;
+    auto const num_blocks =
+      util::div_rounding_up_safe(num_segments, block_size / cudf::detail::warp_size);
+    warp_segmented_reduce_kernel<block_size><<<num_blocks, block_size, 0, stream>>>(
+      d_in, d_offsets, num_segments, d_out, op, identity);
+    CHECK_CUDA(stream);
+    return;
+  }
+
+  rmm::device_buffer d_temp_storage;
+  size_t temp_storage_bytes = 0;
+  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
+                                     temp_storage_bytes,
+                                     d_in,
+                                     d_out,
+                                     num_segments,
+                                     d_offsets,
+                                     d_offsets + 1,
+                                     op,
+                                     identity,
+                                     stream);
+  d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
+                                     temp_storage_bytes,
+                                     d_in,
+                                     d_out,
+                                     num_segments,
+                                     d_offsets,
+                                     d_offsets + 1,
+                                     op,
+                                     identity,
+                                     stream);
+}
+
+template <typename ElementType, typename Op>
+struct segmented_result_type_dispatcher {
+  // The combinations of input and output types of simple::result_type_dispatcher
+  template <typename ResultType>
+  static constexpr bool is_supported_v()
+  {
+    return cudf::is_convertible<ElementType, ResultType>::value &&
+           (std::is_arithmetic<ResultType>::value ||
+            std::is_same<Op, cudf::reduction::op::min>::value ||
+            std::is_same<Op, cudf::reduction::op::max>::value) &&
+           cudf::is_fixed_width<ResultType>();
+  }
+
+  template <typename ResultType, std::enable_if_t<is_supported_v<ResultType>()>* = nullptr>
+  void operator()(column_view const& values,
+                  column_view const& offsets,
+                  mutable_column_view& output,
+                  cudaStream_t stream)
+  {
+    auto d_values = column_device_view::create(values, stream);
+    Op simple_op{};
+    auto const identity = simple_op.template get_identity<ResultType>();
+    if (values.has_nulls()) {
+      auto it = thrust::make_transform_iterator(
+        d_values->pair_begin<ElementType, true>(),
+        simple_op.template get_null_replacing_element_transformer<ResultType>());
+      segmented_reduce(it,
+                       values.size(),
+                       offsets,
+                       output.data<ResultType>(),
+                       simple_op.get_binary_op(),
+                       identity,
+                       stream);
+    } else {
+      auto it = thrust::make_transform_iterator(
+        d_values->begin<ElementType>(), simple_op.template get_element_transformer<ResultType>());
+      segmented_reduce(it,
+                       values.size(),
+                       offsets,
+                       output.data<ResultType>(),
+                       simple_op.get_binary_op(),
+                       identity,
+                       stream);
+    }
+  }
+
+  template <typename ResultType, std::enable_if_t<not is_supported_v<ResultType>()>* = nullptr>
+  void operator()(column_view const&, column_view const&, mutable_column_view&, cudaStream_t)
+  {
+    CUDF_FAIL("input data type is not convertible to output data type");
+  }
+};
+
+template <typename Op>
+struct segmented_element_type_dispatcher {
+  template <typename ElementType>
+  static constexpr bool is_supported_v()
+  {
+    return cudf::is_fixed_width<ElementType>() &&
+           (std::is_arithmetic<ElementType>::value ||
+            std::is_same<Op, cudf::reduction::op::min>::value ||
+            std::is_same<Op, cudf::reduction::op::max>::value);
+  }
+
+  template <typename ElementType, std::enable_if_t<is_supported_v<ElementType>()>* = nullptr>
+  void operator()(column_view const& values,
+                  column_view const& offsets,
+                  mutable_column_view& output,
+                  cudaStream_t stream)
+  {
+    cudf::type_dispatcher(output.type(),
+                          segmented_result_type_dispatcher<ElementType, Op>{},
+                          values,
+                          offsets,
+                          output,
+                          stream);
+  }
+
+  template <typename ElementType, std::enable_if_t<not is_supported_v<ElementType>()>* = nullptr>
+  void operator()(column_view const&, column_view const&, mutable_column_view&, cudaStream_t)
+  {
+    CUDF_FAIL("Unsupported data type for a segmented reduction");
+  }
+};
+
+template <typename Op>
+void reduce_segments(column_view const& values,
+                     column_view const& offsets,
+                     mutable_column_view& output,
+                     cudaStream_t stream)
+{
+  cudf::type_dispatcher(
+    values.type(), segmented_element_type_dispatcher<Op>{}, values, offsets, output, stream);
+}
+
+/**
+ * @brief Returns whether the output row of a segment is valid, from its number of valid values
+ */
+struct segment_validity {
+  size_type const* offsets;
+  size_type const* valid_counts;  ///< nullptr if the values have no nulls
+  bool include_nulls;
+
+  __device__ bool operator()(size_type segment) const
+  {
+    auto const size        = offsets[segment + 1] - offsets[segment];
+    auto const valid_count = (valid_counts != nullptr) ? valid_counts[segment] : size;
+    return include_nulls ? (size > 0 && valid_count == size) : (valid_count > 0);
+  }
+};
+
+}  // namespace
+}  // namespace detail
+}  // namespace reduction
+
+namespace detail {
+std::unique_ptr<column> segmented_reduce(column_view const& values,
+                                         column_view const& offsets,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         null_policy null_handling,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  CUDF_EXPECTS(offsets.type().id() == type_id::INT32 && not offsets.has_nulls(),
+               "Segment offsets must be a non-nullable INT32 column");
+  if (agg->kind == aggregation::ANY || agg->kind == aggregation::ALL) {
+    CUDF_EXPECTS(output_dtype.id() == type_id::BOOL8,
+                 "any() and all() can be applied with output type `bool8` only");
+  }
+  CUDF_EXPECTS(is_fixed_width(output_dtype), "Invalid/Unsupported output datatype");
+
+  auto const num_segments = std::max(offsets.size(), 1) - 1;
+  auto output             = make_fixed_width_column(
+    output_dtype, num_segments, mask_state::UNALLOCATED, stream, mr);
+  if (num_segments == 0) { return output; }
+
+  if (values.size() > 0) {
+    auto output_view = output->mutable_view();
+    switch (agg->kind) {
+      case aggregation::SUM:
+        reduction::detail::reduce_segments<reduction::op::sum>(
+          values, offsets, output_view, stream);
+        break;
+      case aggregation::PRODUCT:
+        reduction::detail::reduce_segments<reduction::op::product>(
+          values, offsets, output_view, stream);
+        break;
+      case aggregation::MIN:
+      case aggregation::ALL:
+        reduction::detail::reduce_segments<reduction::op::min>(
+          values, offsets, output_view, stream);
+        break;
+      case aggregation::MAX:
+      case aggregation::ANY:
+        reduction::detail::reduce_segments<reduction::op::max>(
+          values, offsets, output_view, stream);
+        break;
+      case aggregation::SUM_OF_SQUARES:
+        reduction::detail::reduce_segments<reduction::op::sum_of_squares>(
+          values, offsets, output_view, stream);
+        break;
+      default: CUDF_FAIL("Unsupported segmented reduction operator");
+    }
+  }
+
+  // Count the valid values of each segment to find the null output rows
+  rmm::device_vector<size_type> valid_counts;
+  if (values.has_nulls()) {
+    valid_counts.resize(num_segments);
+    auto d_values = column_device_view::create(values, stream);
+    auto it       = thrust::make_transform_iterator(
+      make_validity_iterator(*d_values), [] __device__(bool valid) -> size_type { return valid; });
+    reduction::detail::segmented_reduce(it,
+                                        values.size(),
+                                        offsets,
+                                        valid_counts.data().get(),
+                                        cudf::DeviceSum{},
+                                        size_type{0},
+                                        stream);
+  }
+  auto null_mask = valid_if(thrust::make_counting_iterator<size_type>(0),
+                            thrust::make_counting_iterator<size_type>(num_segments),
+                            reduction::detail::segment_validity{
+                              offsets.data<size_type>(),
+                              values.has_nulls() ? valid_counts.data().get() : nullptr,
+                              null_handling == null_policy::INCLUDE},
+                            stream,
+                            mr);
+  if (null_mask.second > 0) { output->set_null_mask(std::move(null_mask.first), null_mask.second); }
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> segmented_reduce(column_view const& values,
+                                         column_view const& offsets,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         data_type output_dtype,
+                                         null_policy null_handling,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_reduce(values, offsets, agg, output_dtype, null_handling, mr);
+}
+
+}  // namespace cudf
@@ -80,7 +80,7 @@ struct result_type_dispatcher {
            (std::is_arithmetic<ResultType>::value ||
             std::is_same<Op, cudf::reduction::op::min>::value ||
             std::is_same<Op, cudf::reduction::op::max>::value) &&
-           !std::is_same<ResultType, cudf::list_view>::value;
+           !cudf::is_nested<ResultType>();
   }
 
  public:
@@ -116,8 +116,8 @@ struct element_type_dispatcher {
     return !((std::is_same<ElementType, cudf::string_view>::value &&
               !(std::is_same<Op, cudf::reduction::op::min>::value ||
                 std::is_same<Op, cudf::reduction::op::max>::value))
-             // disable for list views
-             || std::is_same<ElementType, cudf::list_view>::value);
+             // disable for nested views
+             || cudf::is_nested<ElementType>());
   }
 
  public:
@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reduction.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_vector.hpp>
+
+#include <cub/block/block_reduce.cuh>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr int block_size               = 256;
+constexpr int max_blocks_per_column    = 32;
+constexpr size_type min_rows_per_block = 4 * block_size;
+
+/**
+ * @brief Statistics of the valid values of a column, from which the fused aggregations derive
+ *
+ * Integral and chrono values are accumulated in the `int_` members, so that their sums wrap like
+ * the INT64 reductions and their extrema are exact. All numeric values are also accumulated as
+ * doubles for the mean, variance and standard deviation.
+ */
+struct column_moments {
+  size_type valid_count;
+  double sum;
+  double sum_of_squares;
+  double min;
+  double max;
+  int64_t int_sum;
+  int64_t int_sum_of_squares;
+  int64_t int_min;
+  int64_t int_max;
+};
+
+CUDA_HOST_DEVICE_CALLABLE column_moments empty_moments()
+{
+  return column_moments{0,
+                        0,
+                        0,
+                        cudf::DeviceMin::identity<double>(),
+                        cudf::DeviceMax::identity<double>(),
+                        0,
+                        0,
+                        cudf::DeviceMin::identity<int64_t>(),
+                        cudf::DeviceMax::identity<int64_t>()};
+}
+
+struct combine_moments {
+  CUDA_HOST_DEVICE_CALLABLE column_moments operator()(column_moments const& lhs,
+                                                      column_moments const& rhs) const
+  {
+    return column_moments{lhs.valid_count + rhs.valid_count,
+                          lhs.sum + rhs.sum,
+                          lhs.sum_of_squares + rhs.sum_of_squares,
+                          cudf::DeviceMin{}(lhs.min, rhs.min),
+                          cudf::DeviceMax{}(lhs.max, rhs.max),
+                          lhs.int_sum + rhs.int_sum,
+                          lhs.int_sum_of_squares + rhs.int_sum_of_squares,
+                          cudf::DeviceMin{}(lhs.int_min, rhs.int_min),
+                          cudf::DeviceMax{}(lhs.int_max, rhs.int_max)};
+  }
+};
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+__device__ void add_value(column_moments& moments, T element)
+{
+  double const value = element;
+  moments.sum += value;
+  moments.sum_of_squares += value * value;
+  moments.min = cudf::DeviceMin{}(moments.min, value);
+  moments.max = cudf::DeviceMax{}(moments.max, value);
+}
+
+template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+__device__ void add_value(column_moments& moments, T element)
+{
+  int64_t const value = element;
+  moments.sum += static_cast<double>(value);
+  moments.sum_of_squares += static_cast<double>(value) * static_cast<double>(value);
+  moments.int_sum += value;
+  moments.int_sum_of_squares += value * value;
+  moments.int_min = cudf::DeviceMin{}(moments.int_min, value);
+  moments.int_max = cudf::DeviceMax{}(moments.int_max, value);
+}
+
+template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+__device__ void add_value(column_moments& moments, T element)
+{
+  int64_t const value = element.time_since_epoch().count();
+  moments.int_min     = cudf::DeviceMin{}(moments.int_min, value);
+  moments.int_max     = cudf::DeviceMax{}(moments.int_max, value);
+}
+
+template <typename T, std::enable_if_t<cudf::is_duration<T>()>* = nullptr>
+__device__ void add_value(column_moments& moments, T element)
+{
+  int64_t const value = element.count();
+  moments.int_min     = cudf::DeviceMin{}(moments.int_min, value);
+  moments.int_max     = cudf::DeviceMax{}(moments.int_max, value);
+}
+
+/**
+ * @brief Accumulates the valid values of every `stride`-th row of a column from `begin`
+ */
+struct accumulate_rows {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>() or cudf::is_chrono<T>()>* = nullptr>
+  __device__ void operator()(column_device_view const& col,
+                             size_type begin,
+                             size_type stride,
+                             column_moments& moments)
+  {
+    for (size_type row = begin; row < col.size(); row += stride) {
+      if (col.is_null(row)) { continue; }
+      ++moments.valid_count;
+      add_value(moments, col.element<T>(row));
+    }
+  }
+
+  template <typename T,
+            std::enable_if_t<not(cudf::is_numeric<T>() or cudf::is_chrono<T>())>* = nullptr>
+  __device__ void operator()(column_device_view const&, size_type, size_type, column_moments&)
+  {
+  }
+};
+
+/**
+ * @brief Computes the moments of a part of a column per block
+ *
+ * Block `(c, b)` accumulates the rows `b * block_size + k * gridDim.y * block_size` of column
+ * `c` into `partials[c * gridDim.y + b]`.
+ */
+__global__ void column_moments_kernel(table_device_view table, column_moments* partials)
+{
+  auto const& col = table.column(blockIdx.x);
+  auto moments    = empty_moments();
+  cudf::type_dispatcher(col.type(),
+                        accumulate_rows{},
+                        col,
+                        static_cast<size_type>(blockIdx.y * block_size + threadIdx.x),
+                        static_cast<size_type>(gridDim.y * block_size),
+                        moments);
+
+  using BlockReduce = cub::BlockReduce<column_moments, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  auto const block_moments = BlockReduce(temp_storage).Reduce(moments, combine_moments{});
+  if (threadIdx.x == 0) { partials[blockIdx.x * gridDim.y + blockIdx.y] = block_moments; }
+}
+
+/**
+ * @brief Combines the `num_partials` moments of each column computed by one block each
+ */
+__global__ void combine_partials_kernel(column_moments const* partials,
+                                        int num_partials,
+                                        column_moments* results)
+{
+  auto moments = empty_moments();
+  for (int i = threadIdx.x; i < num_partials; i += block_size) {
+    moments = combine_moments{}(moments, partials[blockIdx.x * num_partials + i]);
+  }
+
+  using BlockReduce = cub::BlockReduce<column_moments, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  auto const column_result = BlockReduce(temp_storage).Reduce(moments, combine_moments{});
+  if (threadIdx.x == 0) { results[blockIdx.x] = column_result; }
+}
+
+/**
+ * @brief Returns whether an aggregation of a column is derived from its moments
+ */
+bool is_fused(aggregation::Kind kind, data_type type)
+{
+  if (is_chrono(type)) { return kind == aggregation::MIN || kind == aggregation::MAX; }
+  if (not is_numeric(type) || type.id() == type_id::UINT64) { return false; }
+  switch (kind) {
+    case aggregation::SUM:
+    case aggregation::SUM_OF_SQUARES:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::MEAN:
+    case aggregation::VARIANCE:
+    case aggregation::STD: return true;
+    default: return false;
+  }
+}
+
+data_type result_type(aggregation::Kind kind, data_type type)
+{
+  switch (kind) {
+    case aggregation::SUM:
+    case aggregation::PRODUCT:
+    case aggregation::SUM_OF_SQUARES:
+      return data_type{is_floating_point(type) ? type_id::FLOAT64 : type_id::INT64};
+    case aggregation::MIN:
+    case aggregation::MAX: return type;
+    case aggregation::ANY:
+    case aggregation::ALL: return data_type{type_id::BOOL8};
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+    case aggregation::NUNIQUE: return data_type{type_to_id<size_type>()};
+    default: return data_type{type_id::FLOAT64};
+  }
+}
+
+/**
+ * @brief Makes the scalar of the minimum or maximum of a column from its moments
+ */
+struct extremum_scalar_maker {
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  std::unique_ptr<scalar> operator()(column_moments const& moments,
+                                     bool minimum,
+                                     cudaStream_t stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    return make_fixed_width_scalar(static_cast<T>(minimum ? moments.min : moments.max), stream, mr);
+  }
+
+  template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  std::unique_ptr<scalar> operator()(column_moments const& moments,
+                                     bool minimum,
+                                     cudaStream_t stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    return make_fixed_width_scalar(static_cast<T>(minimum ? moments.int_min : moments.int_max),
+                                   stream,
+                                   mr);
+  }
+
+  template <typename T, std::enable_if_t<cudf::is_chrono<T>()>* = nullptr>
+  std::unique_ptr<scalar> operator()(column_moments const& moments,
+                                     bool minimum,
+                                     cudaStream_t stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto const ticks = static_cast<typename T::rep>(minimum ? moments.int_min : moments.int_max);
+    return std::make_unique<scalar_type_t<T>>(ticks, true, stream, mr);
+  }
+
+  template <typename T,
+            std::enable_if_t<not(cudf::is_numeric<T>() or cudf::is_chrono<T>())>* = nullptr>
+  std::unique_ptr<scalar> operator()(column_moments const&,
+                                     bool,
+                                     cudaStream_t,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unsupported type for a fused reduction");
+  }
+};
+
+/**
+ * @brief Computes a fused aggregation of a column from its moments
+ */
+std::unique_ptr<scalar> moments_result(aggregation const& agg,
+                                       data_type type,
+                                       column_moments const& moments,
+                                       rmm::mr::device_memory_resource* mr,
+                                       cudaStream_t stream)
+{
+  if (moments.valid_count == 0) {
+    auto result = make_default_constructed_scalar(result_type(agg.kind, type));
+    result->set_valid(false, stream);
+    return result;
+  }
+  bool const floating = is_floating_point(type);
+  auto const count    = moments.valid_count;
+  reduction::var_std<double> const sums{moments.sum, moments.sum_of_squares};
+  switch (agg.kind) {
+    case aggregation::SUM:
+      return floating ? make_fixed_width_scalar(moments.sum, stream, mr)
+                      : make_fixed_width_scalar(moments.int_sum, stream, mr);
+    case aggregation::SUM_OF_SQUARES:
+      return floating ? make_fixed_width_scalar(moments.sum_of_squares, stream, mr)
+                      : make_fixed_width_scalar(moments.int_sum_of_squares, stream, mr);
+    case aggregation::MIN:
+    case aggregation::MAX:
+      return cudf::type_dispatcher(
+        type, extremum_scalar_maker{}, moments, agg.kind == aggregation::MIN, stream, mr);
+    case aggregation::MEAN:
+      return make_fixed_width_scalar(
+        reduction::op::mean::intermediate<double>::compute_result(moments.sum, count, 0),
+        stream,
+        mr);
+    case aggregation::VARIANCE: {
+      using variance  = reduction::op::variance::intermediate<double>;
+      auto const ddof = static_cast<std_var_aggregation const&>(agg)._ddof;
+      return make_fixed_width_scalar(variance::compute_result(sums, count, ddof), stream, mr);
+    }
+    case aggregation::STD: {
+      using standard_deviation = reduction::op::standard_deviation::intermediate<double>;
+      auto const ddof          = static_cast<std_var_aggregation const&>(agg)._ddof;
+      return make_fixed_width_scalar(
+        standard_deviation::compute_result(sums, count, ddof), stream, mr);
+    }
+    default: CUDF_FAIL("Unsupported fused reduction");
+  }
+}
+
+}  // namespace
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const& table,
+  std::vector<std::vector<std::unique_ptr<aggregation>>> const& aggs,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_EXPECTS(static_cast<size_type>(aggs.size()) == table.num_columns(),
+               "Expected one list of aggregations per column");
+
+  // Columns with at least one aggregation derived from the moments
+  std::vector<column_view> fused_columns;
+  std::vector<size_type> fused_index(table.num_columns(), -1);
+  for (size_type i = 0; i < table.num_columns(); ++i) {
+    auto const type = table.column(i).type();
+    if (std::any_of(aggs[i].begin(), aggs[i].end(), [type](auto const& agg) {
+          return is_fused(agg->kind, type);
+        })) {
+      fused_index[i] = fused_columns.size();
+      fused_columns.push_back(table.column(i));
+    }
+  }
+
+  std::vector<column_moments> moments(fused_columns.size());
+  if (not fused_columns.empty()) {
+    table_view const fused_table{fused_columns};
+    auto const d_table    = table_device_view::create(fused_table, stream);
+    auto const num_blocks = std::max(
+      1, std::min(max_blocks_per_column, table.num_rows() / min_rows_per_block));
+
+    rmm::device_vector<column_moments> partials(fused_columns.size() * num_blocks);
+    rmm::device_vector<column_moments> d_moments(fused_columns.size());
+    dim3 const grid(fused_columns.size(), num_blocks);
+    column_moments_kernel<<<grid, block_size, 0, stream>>>(*d_table, partials.data().get());
+    combine_partials_kernel<<<fused_columns.size(), block_size, 0, stream>>>(
+      partials.data().get(), num_blocks, d_moments.data().get());
+    CUDA_TRY(cudaMemcpyAsync(moments.data(),
+                             d_moments.data().get(),
+                             moments.size() * sizeof(column_moments),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+  }
+
+  std::vector<std::vector<std::unique_ptr<scalar>>> results(table.num_columns());
+  for (size_type i = 0; i < table.num_columns(); ++i) {
+    auto const col = table.column(i);
+    for (auto const& agg : aggs[i]) {
+      if (is_fused(agg->kind, col.type())) {
+        results[i].push_back(
+          moments_result(*agg, col.type(), moments[fused_index[i]], mr, stream));
+      } else if (agg->kind == aggregation::COUNT_VALID || agg->kind == aggregation::COUNT_ALL) {
+        auto const count =
+          (agg->kind == aggregation::COUNT_VALID) ? col.size() - col.null_count() : col.size();
+        results[i].push_back(make_fixed_width_scalar(count, stream, mr));
+      } else {
+        results[i].push_back(
+          detail::reduce(col, agg, result_type(agg->kind, col.type()), mr, stream));
+      }
+    }
+  }
+  return results;
+}
+
+}  // namespace detail
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const& table,
+  std::vector<std::vector<std::unique_ptr<aggregation>>> const& aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(table, aggs, mr);
+}
+
+}  // namespace cudf
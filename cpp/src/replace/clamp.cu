@@ -286,6 +286,19 @@ std::unique_ptr<column> dispatch_clamp::operator()<cudf::list_view>(
   CUDF_FAIL("clamp for list_view not supported");
 }
 
+template <>
+std::unique_ptr<column> dispatch_clamp::operator()<cudf::struct_view>(
+  column_view const& input,
+  scalar const& lo,
+  scalar const& lo_replace,
+  scalar const& hi,
+  scalar const& hi_replace,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FAIL("clamp for struct_view not supported");
+}
+
 /**
  * @copydoc cudf::clamp(column_view const& input,
                                       scalar const& lo,
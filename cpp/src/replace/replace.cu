@@ -38,43 +38,67 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/copy_if_else.cuh>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/replace.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/warp_bitmask.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/replace.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/replace.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <thrust/device_ptr.h>
 #include <thrust/execution_policy.h>
+#include <thrust/binary_search.h>
 #include <thrust/find.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
 #include <cub/cub.cuh>
 
 namespace {  // anonymous
 
 static constexpr int BLOCK_SIZE = 256;
 
+// Longer lists of values to replace are sorted and binary searched instead of linearly searched
+static constexpr cudf::size_type LINEAR_SEARCH_MAX_VALUES = 16;
+
 // return the new_value for output column at index `idx`
 template <class T, bool replacement_has_nulls>
 __device__ auto get_new_value(cudf::size_type idx,
                               const T* __restrict__ input_data,
                               const T* __restrict__ values_to_replace_begin,
                               const T* __restrict__ values_to_replace_end,
+                              bool values_are_sorted,
                               const T* __restrict__ d_replacement_values,
                               cudf::bitmask_type const* __restrict__ replacement_valid)
 {
-  auto found_ptr =
-    thrust::find(thrust::seq, values_to_replace_begin, values_to_replace_end, input_data[idx]);
+  auto found_ptr = values_to_replace_end;
+  if (values_are_sorted) {
+    found_ptr = thrust::lower_bound(
+      thrust::seq, values_to_replace_begin, values_to_replace_end, input_data[idx]);
+    if (found_ptr != values_to_replace_end && !(*found_ptr == input_data[idx])) {
+      found_ptr = values_to_replace_end;
+    }
+  } else {
+    found_ptr =
+      thrust::find(thrust::seq, values_to_replace_begin, values_to_replace_end, input_data[idx]);
+  }
   T new_value{0};
   bool output_is_valid{true};
 
@@ -91,10 +115,28 @@ __device__ auto get_new_value(cudf::size_type idx,
 __device__ int get_new_string_value(cudf::size_type idx,
                                     cudf::column_device_view& input,
                                     cudf::column_device_view& values_to_replace,
+                                    bool values_are_sorted,
                                     cudf::column_device_view& replacement_values)
 {
   cudf::string_view input_string = input.element<cudf::string_view>(idx);
-  int match                      = -1;
+  if (values_are_sorted) {
+    // lower bound of the input string in the sorted values
+    int begin = 0;
+    int end   = values_to_replace.size();
+    while (begin < end) {
+      int const mid = begin + (end - begin) / 2;
+      if (values_to_replace.element<cudf::string_view>(mid) < input_string) {
+        begin = mid + 1;
+      } else {
+        end = mid;
+      }
+    }
+    return (begin < values_to_replace.size() &&
+            values_to_replace.element<cudf::string_view>(begin) == input_string)
+             ? begin
+             : -1;
+  }
+  int match = -1;
   for (int i = 0; i < values_to_replace.size(); i++) {
     cudf::string_view value_string = values_to_replace.element<cudf::string_view>(i);
     if (input_string == value_string) {
@@ -111,6 +153,7 @@ __device__ int get_new_string_value(cudf::size_type idx,
  *
  * @param input The input column to replace strings in.
  * @param values_to_replace The string values to replace.
+ * @param values_are_sorted Whether `values_to_replace` is sorted, to binary search it
  * @param replacement The replacement values.
  * @param offsets The column which will contain the offsets of the new string column
  * @param indices Temporary column used to store the replacement indices
@@ -120,6 +163,7 @@ __device__ int get_new_string_value(cudf::size_type idx,
 template <bool input_has_nulls, bool replacement_has_nulls>
 __global__ void replace_strings_first_pass(cudf::column_device_view input,
                                            cudf::column_device_view values_to_replace,
+                                           bool values_are_sorted,
                                            cudf::column_device_view replacement,
                                            cudf::mutable_column_device_view offsets,
                                            cudf::mutable_column_device_view indices,
@@ -130,17 +174,20 @@ __global__ void replace_strings_first_pass(cudf::column_device_view input,
   cudf::size_type i     = blockIdx.x * blockDim.x + threadIdx.x;
   uint32_t active_mask  = 0xffffffff;
   active_mask           = __ballot_sync(active_mask, i < nrows);
-  auto const lane_id{threadIdx.x % cudf::detail::warp_size};
   uint32_t valid_sum{0};
 
   while (i < nrows) {
     bool input_is_valid = true;
 
-    if (input_has_nulls) input_is_valid = input.is_valid_nocheck(i);
+    if (input_has_nulls) {
+      input_is_valid = cudf::detail::is_valid_in_word(
+        cudf::detail::get_validity_word(input, cudf::word_index(i)), i);
+    }
     bool output_is_valid = input_is_valid;
 
     if (input_is_valid) {
-      int result               = get_new_string_value(i, input, values_to_replace, replacement);
+      int result =
+        get_new_string_value(i, input, values_to_replace, values_are_sorted, replacement);
       cudf::string_view output = (result == -1) ? input.element<cudf::string_view>(i)
                                                 : replacement.element<cudf::string_view>(result);
       offsets.data<cudf::size_type>()[i] = output.size_bytes();
@@ -153,11 +200,8 @@ __global__ void replace_strings_first_pass(cudf::column_device_view input,
       indices.data<cudf::size_type>()[i] = -1;
     }
 
-    uint32_t bitmask = __ballot_sync(active_mask, output_is_valid);
-    if (0 == lane_id) {
-      output_valid[cudf::word_index(i)] = bitmask;
-      valid_sum += __popc(bitmask);
-    }
+    valid_sum +=
+      cudf::detail::warp_set_validity_word(output_valid, i, output_is_valid, active_mask);
 
     i += blockDim.x * gridDim.x;
     active_mask = __ballot_sync(active_mask, i < nrows);
@@ -232,6 +276,7 @@ __global__ void replace_strings_second_pass(cudf::column_device_view input,
  * of old values to be replaced
  * @param[in] values_to_replace_end  Device pointer to the end of the sequence
  * of old values to be replaced
+ * @param[in] values_are_sorted Whether the old values are sorted, to binary search them
  * @param[in] d_replacement_values Device array with the new values
  * @param[in] replacement_valid Valid mask associated with d_replacement_values
  *
@@ -244,6 +289,7 @@ __global__ void replace_kernel(cudf::column_device_view input,
                                cudf::size_type* __restrict__ output_valid_count,
                                cudf::size_type nrows,
                                cudf::column_device_view values_to_replace,
+                               bool values_are_sorted,
                                cudf::column_device_view replacement)
 {
   T* __restrict__ output_data = output.data<T>();
@@ -252,14 +298,14 @@ __global__ void replace_kernel(cudf::column_device_view input,
 
   uint32_t active_mask = 0xffffffff;
   active_mask          = __ballot_sync(active_mask, i < nrows);
-  auto const lane_id{threadIdx.x % cudf::detail::warp_size};
   uint32_t valid_sum{0};
 
   while (i < nrows) {
     bool output_is_valid{true};
     bool input_is_valid{true};
     if (input_has_nulls) {
-      input_is_valid  = input.is_valid_nocheck(i);
+      input_is_valid = cudf::detail::is_valid_in_word(
+        cudf::detail::get_validity_word(input, cudf::word_index(i)), i);
       output_is_valid = input_is_valid;
     }
     if (input_is_valid)
@@ -268,16 +314,14 @@ __global__ void replace_kernel(cudf::column_device_view input,
         input.data<T>(),
         values_to_replace.data<T>(),
         values_to_replace.data<T>() + values_to_replace.size(),
+        values_are_sorted,
         replacement.data<T>(),
         replacement.null_mask());
 
     /* output valid counts calculations*/
     if (input_has_nulls or replacement_has_nulls) {
-      uint32_t bitmask = __ballot_sync(active_mask, output_is_valid);
-      if (0 == lane_id) {
-        output.set_mask_word(cudf::word_index(i), bitmask);
-        valid_sum += __popc(bitmask);
-      }
+      valid_sum += cudf::detail::warp_set_validity_word(
+        output.null_mask(), i, output_is_valid, active_mask);
     }
 
     i += blockDim.x * gridDim.x;
@@ -300,11 +344,12 @@ struct replace_kernel_forwarder {
   template <typename col_type, std::enable_if_t<cudf::is_fixed_width<col_type>()>* = nullptr>
   std::unique_ptr<cudf::column> operator()(cudf::column_view const& input_col,
                                            cudf::column_view const& values_to_replace,
+                                           bool values_are_sorted,
                                            cudf::column_view const& replacement_values,
                                            rmm::mr::device_memory_resource* mr,
                                            cudaStream_t stream = 0)
   {
-    rmm::device_scalar<cudf::size_type> valid_counter(0, stream);
+    rmm::device_scalar<cudf::size_type> valid_counter(0, stream, cudf::get_scratch_resource());
     cudf::size_type* valid_count = valid_counter.data();
 
     auto replace = replace_kernel<col_type, true, true>;
@@ -345,6 +390,7 @@ struct replace_kernel_forwarder {
                                                         valid_count,
                                                         outputView.size(),
                                                         *device_values_to_replace,
+                                                        values_are_sorted,
                                                         *device_replacement_values);
 
     if (outputView.nullable()) {
@@ -356,6 +402,7 @@ struct replace_kernel_forwarder {
   template <typename col_type, std::enable_if_t<not cudf::is_fixed_width<col_type>()>* = nullptr>
   std::unique_ptr<cudf::column> operator()(cudf::column_view const& input_col,
                                            cudf::column_view const& values_to_replace,
+                                           bool values_are_sorted,
                                            cudf::column_view const& replacement_values,
                                            rmm::mr::device_memory_resource* mr,
                                            cudaStream_t stream = 0)
@@ -368,11 +415,12 @@ template <>
 std::unique_ptr<cudf::column> replace_kernel_forwarder::operator()<cudf::string_view>(
   cudf::column_view const& input_col,
   cudf::column_view const& values_to_replace,
+  bool values_are_sorted,
   cudf::column_view const& replacement_values,
   rmm::mr::device_memory_resource* mr,
   cudaStream_t stream)
 {
-  rmm::device_scalar<cudf::size_type> valid_counter(0, stream);
+  rmm::device_scalar<cudf::size_type> valid_counter(0, stream, cudf::get_scratch_resource());
   cudf::size_type* valid_count = valid_counter.data();
 
   auto replace_first  = replace_strings_first_pass<true, false>;
@@ -415,6 +463,7 @@ std::unique_ptr<cudf::column> replace_kernel_forwarder::operator()<cudf::string_
   replace_first<<<grid.num_blocks, BLOCK_SIZE, 0, stream>>>(
     *device_in,
     *device_values_to_replace,
+    values_are_sorted,
     *device_replacement,
     *device_sizes,
     *device_indices,
@@ -471,10 +520,33 @@ std::unique_ptr<cudf::column> find_and_replace_all(cudf::column_view const& inpu
     return std::make_unique<cudf::column>(input_col);
   }
 
+  // A long list of values is sorted, so that each element binary searches it. The sort is stable,
+  // so that the first of duplicate values is found, as with a linear search.
+  if (values_to_replace.size() > LINEAR_SEARCH_MAX_VALUES) {
+    auto const sorted_order = cudf::detail::stable_sorted_order(
+      cudf::table_view{{values_to_replace}}, {}, {}, rmm::mr::get_default_resource(), stream);
+    auto const sorted =
+      cudf::detail::gather(cudf::table_view{{values_to_replace, replacement_values}},
+                           sorted_order->view(),
+                           cudf::detail::out_of_bounds_policy::IGNORE,
+                           cudf::detail::negative_index_policy::NOT_ALLOWED,
+                           rmm::mr::get_default_resource(),
+                           stream);
+    return cudf::type_dispatcher(input_col.type(),
+                                 replace_kernel_forwarder{},
+                                 input_col,
+                                 sorted->get_column(0).view(),
+                                 true,
+                                 sorted->get_column(1).view(),
+                                 mr,
+                                 stream);
+  }
+
   return cudf::type_dispatcher(input_col.type(),
                                replace_kernel_forwarder{},
                                input_col,
                                values_to_replace,
+                               false,
                                replacement_values,
                                mr,
                                stream);
@@ -520,11 +592,11 @@ __global__ void replace_nulls_strings(cudf::column_device_view input,
 
   uint32_t active_mask = 0xffffffff;
   active_mask          = __ballot_sync(active_mask, i < nrows);
-  auto const lane_id{threadIdx.x % cudf::detail::warp_size};
   uint32_t valid_sum{0};
 
   while (i < nrows) {
-    bool input_is_valid  = input.is_valid_nocheck(i);
+    bool input_is_valid = cudf::detail::is_valid_in_word(
+      cudf::detail::get_validity_word(input, cudf::word_index(i)), i);
     bool output_is_valid = true;
 
     if (replacement_has_nulls && !input_is_valid) {
@@ -541,12 +613,9 @@ __global__ void replace_nulls_strings(cudf::column_device_view input,
     bool nonzero_output = (input_is_valid || output_is_valid);
 
     if (phase == 0) {
-      offsets[i]       = nonzero_output ? out.size_bytes() : 0;
-      uint32_t bitmask = __ballot_sync(active_mask, output_is_valid);
-      if (0 == lane_id) {
-        output_valid[cudf::word_index(i)] = bitmask;
-        valid_sum += __popc(bitmask);
-      }
+      offsets[i] = nonzero_output ? out.size_bytes() : 0;
+      valid_sum +=
+        cudf::detail::warp_set_validity_word(output_valid, i, output_is_valid, active_mask);
     } else if (phase == 1) {
       if (nonzero_output) std::memcpy(chars + offsets[i], out.data(), out.size_bytes());
     }
@@ -572,12 +641,12 @@ __global__ void replace_nulls(cudf::column_device_view input,
 
   uint32_t active_mask = 0xffffffff;
   active_mask          = __ballot_sync(active_mask, i < nrows);
-  auto const lane_id{threadIdx.x % cudf::detail::warp_size};
   uint32_t valid_sum{0};
 
   while (i < nrows) {
-    bool input_is_valid  = input.is_valid_nocheck(i);
-    bool output_is_valid = true;
+    auto const input_valid = cudf::detail::get_validity_word(input, cudf::word_index(i));
+    bool input_is_valid    = cudf::detail::is_valid_in_word(input_valid, i);
+    bool output_is_valid   = true;
     if (input_is_valid) {
       output.data<Type>()[i] = input.element<Type>(i);
     } else {
@@ -587,10 +656,15 @@ __global__ void replace_nulls(cudf::column_device_view input,
 
     /* output valid counts calculations*/
     if (replacement_has_nulls) {
-      uint32_t bitmask = __ballot_sync(active_mask, output_is_valid);
-      if (0 == lane_id) {
-        output.set_mask_word(cudf::word_index(i), bitmask);
-        valid_sum += __popc(bitmask);
+      if (input_valid == cudf::detail::all_valid_word) {
+        // Every row of the word keeps its input value
+        if (threadIdx.x % cudf::detail::warp_size == 0) {
+          output.set_mask_word(cudf::word_index(i), cudf::detail::all_valid_word);
+          valid_sum += __popc(active_mask);
+        }
+      } else {
+        valid_sum += cudf::detail::warp_set_validity_word(
+          output.null_mask(), i, output_is_valid, active_mask);
       }
     }
 
@@ -638,7 +712,7 @@ struct replace_nulls_column_kernel_forwarder {
     auto device_out         = cudf::mutable_column_device_view::create(output_view);
     auto device_replacement = cudf::column_device_view::create(replacement);
 
-    rmm::device_scalar<cudf::size_type> valid_counter(0, stream);
+    rmm::device_scalar<cudf::size_type> valid_counter(0, stream, cudf::get_scratch_resource());
     cudf::size_type* valid_count = valid_counter.data();
 
     replace<<<grid.num_blocks, BLOCK_SIZE, 0, stream>>>(
@@ -668,7 +742,7 @@ std::unique_ptr<cudf::column> replace_nulls_column_kernel_forwarder::operator()<
   rmm::mr::device_memory_resource* mr,
   cudaStream_t stream)
 {
-  rmm::device_scalar<cudf::size_type> valid_counter(0, stream);
+  rmm::device_scalar<cudf::size_type> valid_counter(0, stream, cudf::get_scratch_resource());
   cudf::size_type* valid_count = valid_counter.data();
 
   auto replace_first  = replace_nulls_strings<0, false>;
@@ -791,6 +865,20 @@ std::unique_ptr<cudf::column> replace_nulls_scalar_kernel_forwarder::operator()<
   return cudf::strings::replace_nulls(input_s, repl, mr);
 }
 
+/**
+ * @brief Row of a fill gather map before the scan: the row itself if it is valid, and a
+ * sentinel out of the bounds of the column that loses the scan otherwise
+ */
+struct valid_row_or_sentinel {
+  cudf::column_device_view input;
+  cudf::size_type sentinel;
+
+  __device__ cudf::size_type operator()(cudf::size_type i) const
+  {
+    return input.is_valid_nocheck(i) ? i : sentinel;
+  }
+};
+
 }  // end anonymous namespace
 
 namespace cudf {
@@ -828,6 +916,52 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
     input.type(), replace_nulls_scalar_kernel_forwarder{}, input, replacement, mr, stream);
 }
 
+std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
+                                            cudf::replace_policy const& replace_policy,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream)
+{
+  if (input.size() == 0) { return cudf::empty_like(input); }
+
+  if (!input.has_nulls()) { return std::make_unique<cudf::column>(input, stream, mr); }
+
+  // A single scan over the validity finds the nearest valid row of every row; gathering those
+  // rows fills the nulls of any type. Rows left at the out-of-bounds sentinel gather a null.
+  auto gather_map = make_numeric_column(data_type{type_to_id<size_type>()},
+                                        input.size(),
+                                        mask_state::UNALLOCATED,
+                                        stream,
+                                        rmm::mr::get_default_resource());
+  auto const d_input = column_device_view::create(input, stream);
+  auto const rows    = thrust::make_counting_iterator<size_type>(0);
+  auto map           = gather_map->mutable_view().begin<size_type>();
+  if (replace_policy == cudf::replace_policy::PRECEDING) {
+    auto const valid_rows =
+      thrust::make_transform_iterator(rows, valid_row_or_sentinel{*d_input, -1});
+    thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                           valid_rows,
+                           valid_rows + input.size(),
+                           map,
+                           thrust::maximum<size_type>{});
+  } else {
+    auto const valid_rows =
+      thrust::make_transform_iterator(rows, valid_row_or_sentinel{*d_input, input.size()});
+    thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                           thrust::make_reverse_iterator(valid_rows + input.size()),
+                           thrust::make_reverse_iterator(valid_rows),
+                           thrust::make_reverse_iterator(map + input.size()),
+                           thrust::minimum<size_type>{});
+  }
+
+  auto output = cudf::detail::gather(table_view{{input}},
+                                     gather_map->view(),
+                                     out_of_bounds_policy::NULLIFY,
+                                     negative_index_policy::NOT_ALLOWED,
+                                     mr,
+                                     stream);
+  return std::move(output->release()[0]);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
@@ -845,6 +979,14 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
   CUDF_FUNC_RANGE();
   return cudf::detail::replace_nulls(input, replacement, mr, 0);
 }
+
+std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
+                                            cudf::replace_policy const& replace_policy,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::detail::replace_nulls(input, replace_policy, mr, 0);
+}
 }  // namespace cudf
 
 namespace cudf {
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Explodes the lists column `explode_column_idx` of `input`, adding the column of the
+ * positions of the elements in their lists if `include_position` is true
+ */
+std::unique_ptr<table> explode_lists(table_view const& input,
+                                     size_type explode_column_idx,
+                                     bool include_position,
+                                     cudaStream_t stream,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(explode_column_idx >= 0 && explode_column_idx < input.num_columns(),
+               "Invalid explode column index");
+  lists_column_view const lists{input.column(explode_column_idx)};
+  auto const num_rows = lists.size();
+
+  std::vector<size_type> other_columns(input.num_columns() - 1);
+  std::iota(other_columns.begin(), other_columns.begin() + explode_column_idx, 0);
+  std::iota(
+    other_columns.begin() + explode_column_idx, other_columns.end(), explode_column_idx + 1);
+
+  // Output rows of each list; null lists produce no rows even if their offsets span elements
+  rmm::device_vector<size_type> row_offsets(num_rows + 1, 0);
+  auto const d_offsets =
+    (num_rows > 0) ? lists.offsets().data<size_type>() + lists.offset() : nullptr;
+  auto const list_size = [d_offsets,
+                          null_mask = lists.null_mask(),
+                          offset    = lists.offset(),
+                          num_rows] __device__(size_type row) {
+    if (row == num_rows) { return size_type{0}; }
+    auto const valid = (null_mask == nullptr) || bit_is_set(null_mask, offset + row);
+    return valid ? d_offsets[row + 1] - d_offsets[row] : size_type{0};
+  };
+  if (num_rows > 0) {
+    thrust::exclusive_scan(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), list_size),
+      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(num_rows + 1),
+                                      list_size),
+      row_offsets.begin());
+  }
+  size_type const num_output_rows = row_offsets.back();
+
+  // Each output row gathers the row of its list from the other columns and its element from
+  // the child column
+  rmm::device_vector<size_type> parent_map(num_output_rows);
+  rmm::device_vector<size_type> child_map(num_output_rows);
+  auto position = make_numeric_column(data_type{type_to_id<size_type>()},
+                                      include_position ? num_output_rows : 0,
+                                      mask_state::UNALLOCATED,
+                                      stream,
+                                      mr);
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_output_rows,
+    [d_row_offsets = row_offsets.data().get(),
+     d_offsets,
+     num_rows,
+     d_parent   = parent_map.data().get(),
+     d_child    = child_map.data().get(),
+     d_position = include_position ? position->mutable_view().data<size_type>()
+                                   : nullptr] __device__(size_type idx) {
+      auto const row_end =
+        thrust::upper_bound(thrust::seq, d_row_offsets, d_row_offsets + num_rows + 1, idx);
+      auto const row = static_cast<size_type>(thrust::distance(d_row_offsets, row_end) - 1);
+      auto const pos = idx - d_row_offsets[row];
+      d_parent[idx]  = row;
+      d_child[idx]   = d_offsets[row] + pos;
+      if (d_position != nullptr) { d_position[idx] = pos; }
+    });
+
+  auto const d_parent_map =
+    column_view(data_type{type_to_id<size_type>()}, num_output_rows, parent_map.data().get());
+  auto gathered = cudf::detail::gather(input.select(other_columns),
+                                       d_parent_map,
+                                       out_of_bounds_policy::IGNORE,
+                                       negative_index_policy::NOT_ALLOWED,
+                                       mr,
+                                       stream)
+                    ->release();
+
+  // A lists column without rows may have no child column
+  std::unique_ptr<column> exploded;
+  if (num_rows > 0) {
+    auto const d_child_map = column_view(
+      data_type{type_to_id<size_type>()}, num_output_rows, child_map.data().get());
+    exploded = std::move(cudf::detail::gather(table_view{{lists.child()}},
+                                              d_child_map,
+                                              out_of_bounds_policy::IGNORE,
+                                              negative_index_policy::NOT_ALLOWED,
+                                              mr,
+                                              stream)
+                           ->release()[0]);
+  } else if (lists.parent().num_children() > 0) {
+    exploded = empty_like(lists.child());
+  } else {
+    exploded = make_empty_column(data_type{type_id::EMPTY});
+  }
+
+  std::vector<std::unique_ptr<column>> columns;
+  for (size_type i = 0, other = 0; i < input.num_columns(); ++i) {
+    if (i != explode_column_idx) {
+      columns.push_back(std::move(gathered[other++]));
+      continue;
+    }
+    if (include_position) { columns.push_back(std::move(position)); }
+    columns.push_back(std::move(exploded));
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace
+
+std::unique_ptr<table> explode(table_view const& input,
+                               size_type explode_column_idx,
+                               cudaStream_t stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  return explode_lists(input, explode_column_idx, false, stream, mr);
+}
+
+std::unique_ptr<table> explode_position(table_view const& input,
+                                        size_type explode_column_idx,
+                                        cudaStream_t stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  return explode_lists(input, explode_column_idx, true, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> explode(table_view const& input,
+                               size_type explode_column_idx,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::explode(input, explode_column_idx, 0, mr);
+}
+
+std::unique_ptr<table> explode_position(table_view const& input,
+                                        size_type explode_column_idx,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::explode_position(input, explode_column_idx, 0, mr);
+}
+
+}  // namespace cudf
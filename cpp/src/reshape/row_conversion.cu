@@ -0,0 +1,385 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+// Rows are staged in shared memory in tiles of at most this size, which fits the default limit
+constexpr size_type max_tile_bytes = 32 * 1024;
+constexpr size_type block_size     = 256;
+
+/**
+ * @brief Device description of a fixed-width column and of its field in the rows
+ */
+struct row_field {
+  int8_t* data;          ///< First element of the column
+  bitmask_type* mask;    ///< Null mask of the column, or nullptr
+  size_type mask_offset; ///< Bit of the mask holding the validity of the first element
+  size_type size;        ///< Size of an element in bytes
+  size_type row_offset;  ///< Offset of the field in a row
+};
+
+/**
+ * @brief Offsets of the fields and of the validity bytes of a row
+ */
+struct row_layout {
+  std::vector<size_type> field_offsets;
+  size_type validity_offset;
+  size_type row_size;
+};
+
+size_type align_up(size_type offset, size_type alignment)
+{
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+row_layout compute_row_layout(std::vector<data_type> const& schema)
+{
+  row_layout layout;
+  size_type offset = 0;
+  for (auto const& type : schema) {
+    CUDF_EXPECTS(is_fixed_width(type), "Row conversion supports fixed-width types only");
+    auto const size = static_cast<size_type>(size_of(type));
+    offset          = align_up(offset, size);
+    layout.field_offsets.push_back(offset);
+    offset += size;
+  }
+  layout.validity_offset = offset;
+  offset += (static_cast<size_type>(schema.size()) + 7) / 8;
+  layout.row_size = align_up(offset, sizeof(int64_t));
+  return layout;
+}
+
+/**
+ * @brief Returns the number of rows of a shared-memory tile, or 0 if the rows are too large to be
+ * staged
+ *
+ * Tiles hold a multiple of 32 rows, so that the validity words of the columns are not shared by
+ * two tiles.
+ */
+size_type rows_per_tile(size_type row_size)
+{
+  return max_tile_bytes / row_size / warp_size * warp_size;
+}
+
+__device__ inline void copy_element(int8_t* dst, int8_t const* src, size_type size)
+{
+  switch (size) {
+    case 1: *dst = *src; break;
+    case 2: *reinterpret_cast<int16_t*>(dst) = *reinterpret_cast<int16_t const*>(src); break;
+    case 4: *reinterpret_cast<int32_t*>(dst) = *reinterpret_cast<int32_t const*>(src); break;
+    case 8: *reinterpret_cast<int64_t*>(dst) = *reinterpret_cast<int64_t const*>(src); break;
+    default:
+      for (size_type i = 0; i < size; ++i) { dst[i] = src[i]; }
+  }
+}
+
+__device__ inline void copy_words(int64_t* dst, int64_t const* src, size_type num_words)
+{
+  for (auto i = static_cast<size_type>(threadIdx.x); i < num_words; i += blockDim.x) {
+    dst[i] = src[i];
+  }
+}
+
+/**
+ * @brief Writes the rows of the columns to `output`
+ *
+ * Each block builds a tile of `tile_rows` rows at a time. The threads of a block read the
+ * consecutive elements of a column, which is coalesced, and scatter them into the rows of the
+ * tile. If `staged`, the tile is built in shared memory and then copied to `output` in words,
+ * so that the writes are coalesced as well; otherwise the tile is built in place.
+ */
+__global__ void copy_to_rows(row_field const* fields,
+                             size_type num_columns,
+                             size_type num_rows,
+                             size_type row_size,
+                             size_type validity_offset,
+                             size_type tile_rows,
+                             bool staged,
+                             int8_t* output)
+{
+  extern __shared__ int64_t shared_tile[];
+  auto const num_validity_bytes = (num_columns + 7) / 8;
+  auto const row_words          = row_size / static_cast<size_type>(sizeof(int64_t));
+
+  for (size_type tile_start = blockIdx.x * tile_rows; tile_start < num_rows;
+       tile_start += gridDim.x * tile_rows) {
+    auto const num_tile_rows = min(tile_rows, num_rows - tile_start);
+    auto const tile_words    = num_tile_rows * row_words;
+    auto const global_tile   = reinterpret_cast<int64_t*>(output) + tile_start * row_words;
+    auto const tile          = staged ? shared_tile : global_tile;
+    auto const tile_bytes    = reinterpret_cast<int8_t*>(tile);
+
+    // Padding bytes are zeroed, so that equal rows have equal bytes
+    for (auto i = static_cast<size_type>(threadIdx.x); i < tile_words; i += blockDim.x) {
+      tile[i] = 0;
+    }
+    __syncthreads();
+
+    for (auto i = static_cast<size_type>(threadIdx.x); i < num_tile_rows * num_columns;
+         i += blockDim.x) {
+      auto const& field = fields[i / num_tile_rows];
+      auto const row    = i % num_tile_rows;
+      copy_element(tile_bytes + row * row_size + field.row_offset,
+                   field.data + (tile_start + row) * field.size,
+                   field.size);
+    }
+    for (auto i = static_cast<size_type>(threadIdx.x); i < num_tile_rows * num_validity_bytes;
+         i += blockDim.x) {
+      auto const byte_idx = i / num_tile_rows;
+      auto const row      = i % num_tile_rows;
+      auto const last_col = min(num_columns, (byte_idx + 1) * 8);
+      uint8_t byte        = 0;
+      for (auto col = byte_idx * 8; col < last_col; ++col) {
+        auto const& field = fields[col];
+        if (field.mask == nullptr || bit_is_set(field.mask, field.mask_offset + tile_start + row)) {
+          byte |= 1 << (col % 8);
+        }
+      }
+      tile_bytes[row * row_size + validity_offset + byte_idx] = byte;
+    }
+    __syncthreads();
+
+    if (staged) {
+      copy_words(global_tile, tile, tile_words);
+      __syncthreads();
+    }
+  }
+}
+
+/**
+ * @brief Reads the rows of `input` into the columns
+ *
+ * The inverse of `copy_to_rows`: a tile is loaded into shared memory with coalesced reads if
+ * `staged`, and its fields are gathered into the consecutive elements of the columns. Each
+ * thread builds whole validity words, and adds the number of nulls of its words to
+ * `null_counts`.
+ */
+__global__ void copy_from_rows(row_field const* fields,
+                               size_type num_columns,
+                               size_type num_rows,
+                               size_type row_size,
+                               size_type validity_offset,
+                               size_type tile_rows,
+                               bool staged,
+                               int8_t const* input,
+                               size_type* null_counts)
+{
+  extern __shared__ int64_t shared_tile[];
+  auto const row_words = row_size / static_cast<size_type>(sizeof(int64_t));
+
+  for (size_type tile_start = blockIdx.x * tile_rows; tile_start < num_rows;
+       tile_start += gridDim.x * tile_rows) {
+    auto const num_tile_rows = min(tile_rows, num_rows - tile_start);
+    auto const global_tile   = reinterpret_cast<int64_t const*>(input) + tile_start * row_words;
+    if (staged) {
+      copy_words(shared_tile, global_tile, num_tile_rows * row_words);
+      __syncthreads();
+    }
+    auto const tile_bytes = reinterpret_cast<int8_t const*>(staged ? shared_tile : global_tile);
+
+    for (auto i = static_cast<size_type>(threadIdx.x); i < num_tile_rows * num_columns;
+         i += blockDim.x) {
+      auto const& field = fields[i / num_tile_rows];
+      auto const row    = i % num_tile_rows;
+      copy_element(field.data + (tile_start + row) * field.size,
+                   tile_bytes + row * row_size + field.row_offset,
+                   field.size);
+    }
+    auto const num_words = (num_tile_rows + warp_size - 1) / warp_size;
+    for (auto i = static_cast<size_type>(threadIdx.x); i < num_words * num_columns;
+         i += blockDim.x) {
+      auto const col       = i / num_words;
+      auto const first_row = (i % num_words) * warp_size;
+      auto const word_rows = min(warp_size, num_tile_rows - first_row);
+      auto const validity  = tile_bytes + validity_offset + col / 8;
+      bitmask_type word    = 0;
+      for (size_type j = 0; j < word_rows; ++j) {
+        word |= static_cast<bitmask_type>((validity[(first_row + j) * row_size] >> (col % 8)) & 1)
+                << j;
+      }
+      fields[col].mask[word_index(tile_start + first_row)] = word;
+      auto const nulls = word_rows - __popc(word);
+      if (nulls > 0) { atomicAdd(null_counts + col, nulls); }
+    }
+    if (staged) { __syncthreads(); }
+  }
+}
+
+/**
+ * @brief Launches a row conversion kernel over the rows, staging tiles in shared memory when the
+ * rows are small enough
+ */
+template <typename Kernel, typename... Args>
+void launch_row_kernel(Kernel kernel,
+                       rmm::device_vector<row_field> const& fields,
+                       size_type num_rows,
+                       row_layout const& layout,
+                       cudaStream_t stream,
+                       Args... args)
+{
+  auto const staged_rows = rows_per_tile(layout.row_size);
+  auto const staged      = staged_rows > 0;
+  auto const tile_rows   = staged ? staged_rows : block_size;
+  auto const num_tiles   = (num_rows + tile_rows - 1) / tile_rows;
+  auto const shared_size = staged ? tile_rows * layout.row_size : 0;
+  kernel<<<num_tiles, block_size, shared_size, stream>>>(fields.data().get(),
+                                                         static_cast<size_type>(fields.size()),
+                                                         num_rows,
+                                                         layout.row_size,
+                                                         layout.validity_offset,
+                                                         tile_rows,
+                                                         staged,
+                                                         args...);
+  CHECK_CUDA(stream);
+}
+
+}  // namespace
+
+std::unique_ptr<column> convert_to_rows(table_view const& input,
+                                        cudaStream_t stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  std::vector<data_type> schema;
+  std::transform(input.begin(), input.end(), std::back_inserter(schema), [](auto const& col) {
+    return col.type();
+  });
+  auto const layout   = compute_row_layout(schema);
+  auto const num_rows = input.num_rows();
+  CUDF_EXPECTS(static_cast<int64_t>(num_rows) * layout.row_size <=
+                 std::numeric_limits<size_type>::max(),
+               "Size of the rows exceeds the column size limit");
+
+  auto offsets = make_numeric_column(
+    data_type{type_id::INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows + 1),
+                    offsets->mutable_view().begin<size_type>(),
+                    [row_size = layout.row_size] __device__(size_type row) {
+                      return row * row_size;
+                    });
+  auto rows = make_numeric_column(
+    data_type{type_id::INT8}, num_rows * layout.row_size, mask_state::UNALLOCATED, stream, mr);
+
+  if (num_rows > 0 && input.num_columns() > 0) {
+    std::vector<row_field> h_fields;
+    for (size_type i = 0; i < input.num_columns(); ++i) {
+      auto const& col = input.column(i);
+      auto const size = static_cast<size_type>(size_of(col.type()));
+      h_fields.push_back({const_cast<int8_t*>(col.head<int8_t>()) + col.offset() * size,
+                          const_cast<bitmask_type*>(col.nullable() ? col.null_mask() : nullptr),
+                          col.offset(),
+                          size,
+                          layout.field_offsets[i]});
+    }
+    rmm::device_vector<row_field> fields(h_fields);
+    launch_row_kernel(
+      copy_to_rows, fields, num_rows, layout, stream, rows->mutable_view().data<int8_t>());
+  }
+
+  return make_lists_column(num_rows,
+                           std::move(offsets),
+                           std::move(rows),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         cudaStream_t stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  auto const layout   = compute_row_layout(schema);
+  auto const num_rows = input.size();
+  CUDF_EXPECTS(input.child().type().id() == type_id::INT8, "Rows must be lists of INT8");
+  CUDF_EXPECTS(input.child().size() >=
+                 static_cast<int64_t>(input.offset() + num_rows) * layout.row_size,
+               "Size of the rows does not match the schema");
+
+  std::vector<std::unique_ptr<column>> columns;
+  std::vector<row_field> h_fields;
+  for (size_t i = 0; i < schema.size(); ++i) {
+    columns.push_back(
+      make_fixed_width_column(schema[i], num_rows, mask_state::UNINITIALIZED, stream, mr));
+    auto col = columns.back()->mutable_view();
+    h_fields.push_back({col.head<int8_t>(),
+                        col.null_mask(),
+                        0,
+                        static_cast<size_type>(size_of(schema[i])),
+                        layout.field_offsets[i]});
+  }
+
+  if (num_rows > 0 && !schema.empty()) {
+    rmm::device_vector<row_field> fields(h_fields);
+    rmm::device_vector<size_type> null_counts(schema.size(), 0);
+    launch_row_kernel(copy_from_rows,
+                      fields,
+                      num_rows,
+                      layout,
+                      stream,
+                      input.child().data<int8_t>() + input.offset() * layout.row_size,
+                      null_counts.data().get());
+    thrust::host_vector<size_type> h_null_counts(null_counts);
+    for (size_t i = 0; i < columns.size(); ++i) { columns[i]->set_null_count(h_null_counts[i]); }
+  }
+  // Columns without nulls do not keep a null mask
+  for (auto& col : columns) {
+    if (num_rows == 0 || col->null_count() == 0) { col->set_null_mask(rmm::device_buffer{0}, 0); }
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> convert_to_rows(table_view const& input,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_to_rows(input, 0, mr);
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         std::vector<data_type> const& schema,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_from_rows(input, schema, 0, mr);
+}
+
+}  // namespace cudf
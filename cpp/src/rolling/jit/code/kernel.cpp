@@ -35,51 +35,132 @@ cudf::size_type __device__ get_window(WindowType window, cudf::size_type index)
 template <>
 cudf::size_type __device__ get_window(cudf::size_type window, cudf::size_type index) { return window; }
 
-template <typename InType, typename OutType, class agg_op, typename PrecedingWindowType, typename FollowingWindowType>
-__global__
-void gpu_rolling_new(cudf::size_type nrows,
-                 InType const* const __restrict__ in_col, 
-                 cudf::bitmask_type const* const __restrict__ in_col_valid,
-                 OutType* __restrict__ out_col, 
-                 cudf::bitmask_type* __restrict__ out_col_valid,
-                 cudf::size_type * __restrict__ output_valid_count,
-                 PrecedingWindowType preceding_window_begin,
-                 FollowingWindowType following_window_begin,
-                 cudf::size_type min_periods)
+template <int... Is>
+struct indices {
+};
+
+template <int N, int... Is>
+struct make_indices : make_indices<N - 1, N - 1, Is...> {
+};
+
+template <int... Is>
+struct make_indices<0, Is...> {
+  using type = indices<Is...>;
+};
+
+__device__ cudf::size_type warp_min(cudf::size_type value)
 {
-  cudf::size_type i = blockIdx.x * blockDim.x + threadIdx.x;
-  cudf::size_type stride = blockDim.x * gridDim.x;
+  for (int offset = 16; offset > 0; offset /= 2) {
+    value = min(value, __shfl_down_sync(0xffffffff, value, offset));
+  }
+  return value;
+}
+
+__device__ cudf::size_type warp_max(cudf::size_type value)
+{
+  for (int offset = 16; offset > 0; offset /= 2) {
+    value = max(value, __shfl_down_sync(0xffffffff, value, offset));
+  }
+  return value;
+}
+
+template <typename InType>
+__device__ void stage_input(InType const* in_col, char* slot, cudf::size_type begin, cudf::size_type size)
+{
+  InType* staged = reinterpret_cast<InType*>(slot);
+  for (cudf::size_type j = threadIdx.x; j < size; j += blockDim.x) {
+    staged[j] = in_col[begin + j];
+  }
+}
 
+// Each iteration of a block computes the rows [first, first + blockDim.x). When the union of
+// their windows fits in the shared memory slots of `tile_capacity` elements, the inputs of that
+// span are staged in the slots, one per input column, and the UDF reads its window from there
+// instead of reading the overlapping windows again from global memory.
+template <typename OutType, class agg_op, typename PrecedingWindowType, typename FollowingWindowType, int... Is, typename... InTypes>
+__device__
+void rolling_tiles(indices<Is...>,
+                   cudf::size_type nrows,
+                   OutType* __restrict__ out_col,
+                   cudf::bitmask_type* __restrict__ out_col_valid,
+                   cudf::size_type * __restrict__ output_valid_count,
+                   PrecedingWindowType preceding_window_begin,
+                   FollowingWindowType following_window_begin,
+                   cudf::size_type min_periods,
+                   cudf::size_type tile_capacity,
+                   InTypes const* __restrict__... in_cols)
+{
+  // Slots of 8 bytes per element, so that every slot is aligned for any input type
+  extern __shared__ double shared_tiles[];
+  __shared__ cudf::size_type span_begin;
+  __shared__ cudf::size_type span_end;
+  char* const tiles = reinterpret_cast<char*>(shared_tiles);
+  cudf::size_type const slot_bytes = tile_capacity * 8;
+
+  cudf::size_type stride = blockDim.x * gridDim.x;
   cudf::size_type warp_valid_count{0};
 
-  auto active_threads = __ballot_sync(0xffffffff, i < nrows);
-  while(i < nrows)
+  // All the threads of a block run every iteration, so that they can synchronize on the tiles
+  for (cudf::size_type first = blockIdx.x * blockDim.x; first < nrows; first += stride)
   {
+    cudf::size_type i = first + threadIdx.x;
+    bool const active = i < nrows;
+
     // declare this as volatile to avoid some compiler optimizations that lead to incorrect results
     // for CUDA 10.0 and below (fixed in CUDA 10.1)
     volatile cudf::size_type count = 0;
 
-    cudf::size_type preceding_window = get_window(preceding_window_begin, i);
-    cudf::size_type following_window = get_window(following_window_begin, i);
-
     // compute bounds
-    cudf::size_type start = min(nrows, max(0, i - preceding_window + 1));
-    cudf::size_type end = min(nrows, max(0, i + following_window + 1));
-    cudf::size_type start_index = min(start, end);
-    cudf::size_type end_index = max(start, end);
+    cudf::size_type start_index = nrows;
+    cudf::size_type end_index = 0;
+    if (active) {
+      cudf::size_type preceding_window = get_window(preceding_window_begin, i);
+      cudf::size_type following_window = get_window(following_window_begin, i);
+      cudf::size_type start = min(nrows, max(0, i - preceding_window + 1));
+      cudf::size_type end = min(nrows, max(0, i + following_window + 1));
+      start_index = min(start, end);
+      end_index = max(start, end);
+      count = end_index - start_index;
+    }
+
+    // find the union of the windows of the block
+    if (threadIdx.x == 0) {
+      span_begin = nrows;
+      span_end = 0;
+    }
+    __syncthreads();
+    cudf::size_type const warp_begin = warp_min(start_index);
+    cudf::size_type const warp_end = warp_max(end_index);
+    if (0 == cudf::intra_word_index(threadIdx.x)) {
+      atomicMin(&span_begin, warp_begin);
+      atomicMax(&span_end, warp_end);
+    }
+    __syncthreads();
+
+    cudf::size_type const span_size = span_end - span_begin;
+    bool const staged = span_size > 0 and span_size <= tile_capacity;
+    if (staged) {
+      int staging[] = {(stage_input(in_cols, tiles + Is * slot_bytes, span_begin, span_size), 0)...};
+      (void)staging;
+      __syncthreads();
+    }
 
     // aggregate
-    // TODO: We should explore using shared memory to avoid redundant loads.
-    //       This might require separating the kernel into a special version
-    //       for dynamic and static sizes.
-    count = end_index - start_index;
-    OutType val = agg_op::template operate<OutType, InType>(in_col, start_index, count);
+    OutType val;
+    if (active) {
+      if (staged) {
+        val = agg_op::template operate<OutType>(
+          start_index - span_begin, count, reinterpret_cast<InTypes const*>(tiles + Is * slot_bytes)...);
+      } else {
+        val = agg_op::template operate<OutType>(start_index, count, in_cols...);
+      }
+    }
 
     // check if we have enough input samples
-    bool output_is_valid = (count >= min_periods);
+    bool output_is_valid = active and (count >= min_periods);
 
     // set the mask
-    const unsigned int result_mask = __ballot_sync(active_threads, output_is_valid);
+    const unsigned int result_mask = __ballot_sync(0xffffffff, output_is_valid);
 
     // store the output value, one per thread
     if (output_is_valid) {
@@ -87,14 +168,13 @@ void gpu_rolling_new(cudf::size_type nrows,
     }
 
     // only one thread writes the mask
-    if (0 == cudf::intra_word_index(i)) {
+    if (active and 0 == cudf::intra_word_index(i)) {
       out_col_valid[cudf::word_index(i)] = result_mask;
       warp_valid_count += __popc(result_mask);
     }
 
-    // process next element 
-    i += stride;
-    active_threads = __ballot_sync(active_threads, i < nrows);
+    // the next iteration overwrites the span and the tiles
+    __syncthreads();
   }
 
   // TODO: likely faster to do a single_lane_block_reduce and a single
@@ -103,6 +183,30 @@ void gpu_rolling_new(cudf::size_type nrows,
     atomicAdd(output_valid_count, warp_valid_count);
   }
 }
+
+template <typename OutType, class agg_op, typename PrecedingWindowType, typename FollowingWindowType, typename... InTypes>
+__global__
+void gpu_rolling_new(cudf::size_type nrows,
+                     OutType* __restrict__ out_col,
+                     cudf::bitmask_type* __restrict__ out_col_valid,
+                     cudf::size_type * __restrict__ output_valid_count,
+                     PrecedingWindowType preceding_window_begin,
+                     FollowingWindowType following_window_begin,
+                     cudf::size_type min_periods,
+                     cudf::size_type tile_capacity,
+                     InTypes const* __restrict__... in_cols)
+{
+  rolling_tiles<OutType, agg_op>(typename make_indices<sizeof...(InTypes)>::type{},
+                                 nrows,
+                                 out_col,
+                                 out_col_valid,
+                                 output_valid_count,
+                                 preceding_window_begin,
+                                 following_window_begin,
+                                 min_periods,
+                                 tile_capacity,
+                                 in_cols...);
+}
 )***";
 
 }  // namespace code
@@ -24,22 +24,62 @@ namespace code {
 const char* operation_h =
   R"***(operation.h
 #pragma once
+  // The UDF gets the window [start, start + count) of each input column. A PTX UDF takes an
+  // array argument per column, as the meminfo, parent, nitems, itemsize, data, shape and stride
+  // fields of a Numba array; its arity is known after parsing, so there is an overload per
+  // number of input columns.
   struct rolling_udf_ptx {
     template <typename OutType, typename InType>
-    static OutType operate(const InType* in_col, cudf::size_type start, cudf::size_type count) {
+    static OutType operate(cudf::size_type start, cudf::size_type count, const InType* in_col) {
       OutType ret;
       rolling_udf(
         &ret, 0, 0, 0, 0, &in_col[start], count, sizeof(InType));
       return ret;
     }
+
+    template <typename OutType, typename InType0, typename InType1>
+    static OutType operate(cudf::size_type start, cudf::size_type count,
+                           const InType0* in_col0, const InType1* in_col1) {
+      OutType ret;
+      rolling_udf(
+        &ret, 0, 0, 0, 0, &in_col0[start], count, sizeof(InType0),
+        0, 0, 0, 0, &in_col1[start], count, sizeof(InType1));
+      return ret;
+    }
+
+    template <typename OutType, typename InType0, typename InType1, typename InType2>
+    static OutType operate(cudf::size_type start, cudf::size_type count,
+                           const InType0* in_col0, const InType1* in_col1,
+                           const InType2* in_col2) {
+      OutType ret;
+      rolling_udf(
+        &ret, 0, 0, 0, 0, &in_col0[start], count, sizeof(InType0),
+        0, 0, 0, 0, &in_col1[start], count, sizeof(InType1),
+        0, 0, 0, 0, &in_col2[start], count, sizeof(InType2));
+      return ret;
+    }
+
+    template <typename OutType, typename InType0, typename InType1, typename InType2,
+              typename InType3>
+    static OutType operate(cudf::size_type start, cudf::size_type count,
+                           const InType0* in_col0, const InType1* in_col1,
+                           const InType2* in_col2, const InType3* in_col3) {
+      OutType ret;
+      rolling_udf(
+        &ret, 0, 0, 0, 0, &in_col0[start], count, sizeof(InType0),
+        0, 0, 0, 0, &in_col1[start], count, sizeof(InType1),
+        0, 0, 0, 0, &in_col2[start], count, sizeof(InType2),
+        0, 0, 0, 0, &in_col3[start], count, sizeof(InType3));
+      return ret;
+    }
   };
 
   struct rolling_udf_cuda {
-    template <typename OutType, typename InType>
-    static OutType operate(const InType* in_col, cudf::size_type start, cudf::size_type count) {
+    template <typename OutType, typename... InTypes>
+    static OutType operate(cudf::size_type start, cudf::size_type count, const InTypes*... in_cols) {
       OutType ret;
       rolling_udf(
-        &ret, in_col, start, count);
+        &ret, in_cols..., start, count);
       return ret;
     }
   };
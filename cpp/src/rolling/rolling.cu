@@ -22,14 +22,20 @@
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/rolling.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <rolling/rolling_detail.hpp>
 #include <rolling/rolling_jit_detail.hpp>
+#include <rolling/sliding_window.cuh>
 
 #include <jit/launcher.h>
 #include <jit/parser.h>
@@ -44,6 +50,8 @@
 #include <rmm/device_scalar.hpp>
 
 #include <memory>
+#include <set>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -70,8 +78,12 @@ process_rolling_window(column_device_view input,
   // for CUDA 10.0 and below (fixed in CUDA 10.1)
   volatile cudf::size_type count = 0;
 
-  for (size_type j = start_index; j < end_index; j++) {
-    if (op == aggregation::COUNT_ALL || !has_nulls || input.is_valid(j)) { count++; }
+  if (op == aggregation::COUNT_ALL || !has_nulls) {
+    count = end_index - start_index;
+  } else {
+    for (size_type j = start_index; j < end_index; j++) {
+      if (input.is_valid(j)) { count++; }
+    }
   }
 
   bool output_is_valid                      = (count >= min_periods);
@@ -105,24 +117,22 @@ process_rolling_window(column_device_view input,
 }
 
 /**
- * @brief Only used for `string_view` type to get ARGMIN and ARGMAX, which
- *        will be used to gather MIN and MAX. And returns true if the
- *        operation was valid, else false.
+ * @brief Calculates the index of the minimum or maximum row within [start_index, end_index).
+ *        For `string_view` the indices are also used to gather MIN and MAX.
+ *        Returns true if the operation was valid, else false.
  */
 template <typename InputType,
           typename OutputType,
           typename agg_op,
           aggregation::Kind op,
           bool has_nulls>
-std::enable_if_t<(op == aggregation::ARGMIN or op == aggregation::ARGMAX) and
-                   std::is_same<InputType, cudf::string_view>::value,
-                 bool>
-  __device__ process_rolling_window(column_device_view input,
-                                    mutable_column_device_view output,
-                                    size_type start_index,
-                                    size_type end_index,
-                                    size_type current_index,
-                                    size_type min_periods)
+std::enable_if_t<(op == aggregation::ARGMIN or op == aggregation::ARGMAX), bool> __device__
+process_rolling_window(column_device_view input,
+                       mutable_column_device_view output,
+                       size_type start_index,
+                       size_type end_index,
+                       size_type current_index,
+                       size_type min_periods)
 {
   // declare this as volatile to avoid some compiler optimizations that lead to incorrect results
   // for CUDA 10.0 and below (fixed in CUDA 10.1)
@@ -133,8 +143,11 @@ std::enable_if_t<(op == aggregation::ARGMIN or op == aggregation::ARGMAX) and
   for (size_type j = start_index; j < end_index; j++) {
     if (!has_nulls || input.is_valid(j)) {
       InputType element = input.element<InputType>(j);
-      val               = agg_op{}(element, val);
-      if (val == element) { val_index = j; }
+      // Keep the first of equal elements
+      if (count == 0 or not(agg_op{}(element, val) == val)) {
+        val       = element;
+        val_index = j;
+      }
       count++;
     }
   }
@@ -144,9 +157,7 @@ std::enable_if_t<(op == aggregation::ARGMIN or op == aggregation::ARGMAX) and
   // In case of count, this would be null, so doesn't matter.
   output.element<OutputType>(current_index) = (output_is_valid) ? val_index : -1;
 
-  // The gather mask shouldn't contain null values, so
-  // always return zero
-  return true;
+  return output_is_valid;
 }
 
 /**
@@ -160,7 +171,8 @@ template <typename InputType,
           bool has_nulls>
 std::enable_if_t<!std::is_same<InputType, cudf::string_view>::value and
                    !(op == aggregation::COUNT_VALID || op == aggregation::COUNT_ALL ||
-                     op == aggregation::ROW_NUMBER),
+                     op == aggregation::ROW_NUMBER || op == aggregation::ARGMIN ||
+                     op == aggregation::ARGMAX),
                  bool>
   __device__ process_rolling_window(column_device_view input,
                                     mutable_column_device_view output,
@@ -235,14 +247,11 @@ __launch_bounds__(block_size) __global__
 
   auto active_threads = __ballot_sync(0xffffffff, i < input.size());
   while (i < input.size()) {
-    size_type preceding_window = preceding_window_begin[i];
-    size_type following_window = following_window_begin[i];
-
     // compute bounds
-    size_type start       = min(input.size(), max(0, i - preceding_window + 1));
-    size_type end         = min(input.size(), max(0, i + following_window + 1));
-    size_type start_index = min(start, end);
-    size_type end_index   = max(start, end);
+    auto const bounds =
+      window_bounds(i, preceding_window_begin[i], following_window_begin[i], input.size());
+    size_type start_index = bounds.first;
+    size_type end_index   = bounds.second;
 
     // aggregate
     // TODO: We should explore using shared memory to avoid redundant loads.
@@ -274,6 +283,71 @@ __launch_bounds__(block_size) __global__
   if (threadIdx.x == 0) { atomicAdd(output_valid_count, block_valid_count); }
 }
 
+/**
+ * @brief Computes the rolling variance or standard deviation with Welford's online algorithm
+ *
+ * The output of a row is valid if its window has at least `min_periods` observations and more
+ * than `ddof` observations.
+ *
+ * @param ddof Delta degrees of freedom: the divisor of the variance is `count - ddof`
+ */
+template <typename InputType,
+          aggregation::Kind op,
+          int block_size,
+          bool has_nulls,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+__launch_bounds__(block_size) __global__
+  void gpu_rolling_std_var(column_device_view input,
+                           mutable_column_device_view output,
+                           size_type* __restrict__ output_valid_count,
+                           PrecedingWindowIterator preceding_window_begin,
+                           FollowingWindowIterator following_window_begin,
+                           size_type min_periods,
+                           size_type ddof)
+{
+  size_type i      = blockIdx.x * block_size + threadIdx.x;
+  size_type stride = block_size * gridDim.x;
+
+  size_type warp_valid_count{0};
+
+  auto active_threads = __ballot_sync(0xffffffff, i < input.size());
+  while (i < input.size()) {
+    auto const bounds =
+      window_bounds(i, preceding_window_begin[i], following_window_begin[i], input.size());
+
+    size_type count{0};
+    double mean{0};
+    double m2{0};
+    for (size_type j = bounds.first; j < bounds.second; j++) {
+      if (!has_nulls || input.is_valid(j)) {
+        auto const x     = static_cast<double>(input.element<InputType>(j));
+        auto const delta = x - mean;
+        count++;
+        mean += delta / count;
+        m2 += delta * (x - mean);
+      }
+    }
+
+    bool const output_is_valid = (count >= min_periods) and (count > ddof);
+    auto const variance        = output_is_valid ? m2 / (count - ddof) : 0.0;
+    output.element<double>(i)  = (op == aggregation::STD) ? sqrt(variance) : variance;
+
+    warp_valid_count +=
+      warp_set_validity_word(output.null_mask(), i, output_is_valid, active_threads);
+
+    // process next element
+    i += stride;
+    active_threads = __ballot_sync(active_threads, i < input.size());
+  }
+
+  // sum the valid counts across the whole block
+  size_type block_valid_count =
+    cudf::detail::single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
+
+  if (threadIdx.x == 0) { atomicAdd(output_valid_count, block_valid_count); }
+}
+
 template <typename InputType>
 struct rolling_window_launcher {
   template <typename T,
@@ -349,15 +423,25 @@ struct rolling_window_launcher {
       target_type(input.type(), op), input.size(), mask_state::UNINITIALIZED, stream, mr);
 
     cudf::mutable_column_view output_view = output->mutable_view();
-    auto valid_count =
-      kernel_launcher<T, agg_op, op, PrecedingWindowIterator, FollowingWindowIterator>(
-        input,
-        output_view,
-        preceding_window_begin,
-        following_window_begin,
-        min_periods,
-        agg,
-        stream);
+
+    // Large windows are aggregated with algorithms whose cost does not depend on the window size
+    size_type valid_count{0};
+    if (has_sliding_window_algorithm<T, op>() and
+        use_sliding_window_algorithm(
+          input.size(), preceding_window_begin, following_window_begin, stream)) {
+      valid_count = sliding_window_rolling<T, target_type_t<InputType, op>, agg_op, op>(
+        input, output_view, preceding_window_begin, following_window_begin, min_periods, stream);
+    } else {
+      valid_count =
+        kernel_launcher<T, agg_op, op, PrecedingWindowIterator, FollowingWindowIterator>(
+          input,
+          output_view,
+          preceding_window_begin,
+          following_window_begin,
+          min_periods,
+          agg,
+          stream);
+    }
 
     output->set_null_count(output->size() - valid_count);
 
@@ -421,8 +505,10 @@ struct rolling_window_launcher {
       CUDF_FAIL("MIN and MAX are the only supported aggregation types for string columns");
     }
 
-    // The rows that represent null elements will be having negative values in gather map,
-    // and that's why nullify_out_of_bounds/ignore_out_of_bounds is true.
+    // The gather map must not contain nulls: the rows that represent null elements have negative
+    // values in the gather map instead, and that's why nullify_out_of_bounds/ignore_out_of_bounds
+    // is true.
+    output->set_null_mask(rmm::device_buffer{}, 0);
     auto output_table = detail::gather(table_view{{input}},
                                        output->view(),
                                        detail::out_of_bounds_policy::IGNORE,
@@ -432,6 +518,78 @@ struct rolling_window_launcher {
     return std::make_unique<cudf::column>(std::move(output_table->get_column(0)));
   }
 
+  // This launch is only for VARIANCE and STD of numeric columns
+  template <typename T,
+            aggregation::Kind op,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator>
+  std::enable_if_t<cudf::detail::is_rolling_supported<T, void, op>(), std::unique_ptr<column>>
+  launch_std_var(column_view const& input,
+                 PrecedingWindowIterator preceding_window_begin,
+                 FollowingWindowIterator following_window_begin,
+                 size_type min_periods,
+                 std::unique_ptr<aggregation> const& agg,
+                 rmm::mr::device_memory_resource* mr,
+                 cudaStream_t stream)
+  {
+    if (input.is_empty()) return empty_like(input);
+
+    auto output = make_fixed_width_column(
+      target_type(input.type(), op), input.size(), mask_state::UNINITIALIZED, stream, mr);
+
+    constexpr cudf::size_type block_size = 256;
+    cudf::detail::grid_1d grid(input.size(), block_size);
+
+    auto input_device_view  = column_device_view::create(input, stream);
+    auto output_device_view = mutable_column_device_view::create(output->mutable_view(), stream);
+    auto const ddof         = static_cast<std_var_aggregation const*>(agg.get())->_ddof;
+
+    rmm::device_scalar<size_type> device_valid_count{0, stream};
+
+    if (input.has_nulls()) {
+      gpu_rolling_std_var<T, op, block_size, true>
+        <<<grid.num_blocks, block_size, 0, stream>>>(*input_device_view,
+                                                     *output_device_view,
+                                                     device_valid_count.data(),
+                                                     preceding_window_begin,
+                                                     following_window_begin,
+                                                     min_periods,
+                                                     ddof);
+    } else {
+      gpu_rolling_std_var<T, op, block_size, false>
+        <<<grid.num_blocks, block_size, 0, stream>>>(*input_device_view,
+                                                     *output_device_view,
+                                                     device_valid_count.data(),
+                                                     preceding_window_begin,
+                                                     following_window_begin,
+                                                     min_periods,
+                                                     ddof);
+    }
+
+    output->set_null_count(output->size() - device_valid_count.value(stream));
+
+    // check the stream for debugging
+    CHECK_CUDA(stream);
+
+    return output;
+  }
+
+  template <typename T,
+            aggregation::Kind op,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator>
+  std::enable_if_t<!cudf::detail::is_rolling_supported<T, void, op>(), std::unique_ptr<column>>
+  launch_std_var(column_view const& input,
+                 PrecedingWindowIterator preceding_window_begin,
+                 FollowingWindowIterator following_window_begin,
+                 size_type min_periods,
+                 std::unique_ptr<aggregation> const& agg,
+                 rmm::mr::device_memory_resource* mr,
+                 cudaStream_t stream)
+  {
+    CUDF_FAIL("VARIANCE and STD are only supported for numeric columns");
+  }
+
   // Deals with invalid column and/or aggregation options
   template <typename T,
             typename agg_op,
@@ -455,7 +613,11 @@ struct rolling_window_launcher {
   template <aggregation::Kind op,
             typename PrecedingWindowIterator,
             typename FollowingWindowIterator>
-  std::enable_if_t<!(op == aggregation::MEAN), std::unique_ptr<column>> operator()(
+  std::enable_if_t<!(op == aggregation::MEAN or op == aggregation::ARGMIN or
+                     op == aggregation::ARGMAX or op == aggregation::VARIANCE or
+                     op == aggregation::STD),
+                   std::unique_ptr<column>>
+  operator()(
     column_view const& input,
     PrecedingWindowIterator preceding_window_begin,
     FollowingWindowIterator following_window_begin,
@@ -488,6 +650,43 @@ struct rolling_window_launcher {
     return launch<InputType, cudf::DeviceSum, op, PrecedingWindowIterator, FollowingWindowIterator>(
       input, preceding_window_begin, following_window_begin, min_periods, agg, mr, stream);
   }
+
+  // This variant handles ARGMIN and ARGMAX, which have no corresponding operator
+  template <aggregation::Kind op,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator>
+  std::enable_if_t<(op == aggregation::ARGMIN or op == aggregation::ARGMAX),
+                   std::unique_ptr<column>>
+  operator()(column_view const& input,
+             PrecedingWindowIterator preceding_window_begin,
+             FollowingWindowIterator following_window_begin,
+             size_type min_periods,
+             std::unique_ptr<aggregation> const& agg,
+             rmm::mr::device_memory_resource* mr,
+             cudaStream_t stream)
+  {
+    using agg_op = std::conditional_t<op == aggregation::ARGMIN, DeviceMin, DeviceMax>;
+    return launch<InputType, agg_op, op, PrecedingWindowIterator, FollowingWindowIterator>(
+      input, preceding_window_begin, following_window_begin, min_periods, agg, mr, stream);
+  }
+
+  // This variant handles VARIANCE and STD
+  template <aggregation::Kind op,
+            typename PrecedingWindowIterator,
+            typename FollowingWindowIterator>
+  std::enable_if_t<(op == aggregation::VARIANCE or op == aggregation::STD),
+                   std::unique_ptr<column>>
+  operator()(column_view const& input,
+             PrecedingWindowIterator preceding_window_begin,
+             FollowingWindowIterator following_window_begin,
+             size_type min_periods,
+             std::unique_ptr<aggregation> const& agg,
+             rmm::mr::device_memory_resource* mr,
+             cudaStream_t stream)
+  {
+    return launch_std_var<InputType, op>(
+      input, preceding_window_begin, following_window_begin, min_periods, agg, mr, stream);
+  }
 };
 
 struct dispatch_rolling {
@@ -512,12 +711,145 @@ struct dispatch_rolling {
   }
 };
 
-}  // namespace
+/**
+ * @brief Computes the LEAD or LAG of each row: the row `row_offset` rows after or before it if
+ * that row is in its window, else null
+ *
+ * The rows are gathered with a gather map in which the rows outside of the windows are out of
+ * bounds, so that columns of any type are supported.
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+std::unique_ptr<column> rolling_lead_lag(column_view const& input,
+                                         PrecedingWindowIterator preceding_window_begin,
+                                         FollowingWindowIterator following_window_begin,
+                                         std::unique_ptr<aggregation> const& agg,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  auto const row_offset = static_cast<lead_lag_aggregation const*>(agg.get())->row_offset;
+  auto const offset     = (agg->kind == aggregation::LEAD) ? row_offset : -row_offset;
+
+  auto gather_map = make_numeric_column(
+    data_type{type_to_id<size_type>()}, input.size(), mask_state::UNALLOCATED, stream);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    gather_map->mutable_view().begin<size_type>(),
+                    [num_rows = input.size(),
+                     offset,
+                     preceding_window_begin,
+                     following_window_begin] __device__(size_type i) {
+                      auto const bounds = window_bounds(
+                        i, preceding_window_begin[i], following_window_begin[i], num_rows);
+                      auto const row = i + offset;
+                      return (row >= bounds.first and row < bounds.second) ? row : num_rows;
+                    });
+
+  auto output_table = detail::gather(table_view{{input}},
+                                     gather_map->view(),
+                                     detail::out_of_bounds_policy::NULLIFY,
+                                     detail::negative_index_policy::NOT_ALLOWED,
+                                     mr,
+                                     stream);
+  return std::make_unique<cudf::column>(std::move(output_table->get_column(0)));
+}
 
-// Applies a user-defined rolling window function to the values in a column.
+/**
+ * @brief Collects the rows of the window of each row into a list
+ *
+ * The list of a row whose window has fewer than `min_periods` rows is null and empty. Null rows of
+ * the input are collected as null elements.
+ */
 template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
-std::unique_ptr<column> rolling_window_udf(column_view const& input,
+std::unique_ptr<column> rolling_collect(column_view const& input,
+                                        PrecedingWindowIterator preceding_window_begin,
+                                        FollowingWindowIterator following_window_begin,
+                                        size_type min_periods,
+                                        rmm::mr::device_memory_resource* mr,
+                                        cudaStream_t stream)
+{
+  auto const num_rows = input.size();
+
+  auto list_size = [num_rows,
+                    min_periods,
+                    preceding_window_begin,
+                    following_window_begin] __device__(size_type i) {
+    if (i == num_rows) { return size_type{0}; }
+    auto const bounds =
+      window_bounds(i, preceding_window_begin[i], following_window_begin[i], num_rows);
+    auto const size = bounds.second - bounds.first;
+    return (size >= min_periods) ? size : size_type{0};
+  };
+
+  // offsets are the exclusive scan of the list sizes
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets->mutable_view().begin<size_type>();
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), list_size),
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(num_rows + 1),
+                                    list_size),
+    d_offsets);
+  auto const num_elements = get_value<size_type>(offsets->view(), num_rows, stream);
+
+  // each element of the child column is a row of the window of its list
+  auto gather_map = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_elements, mask_state::UNALLOCATED, stream);
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_elements),
+    gather_map->mutable_view().begin<size_type>(),
+    [d_offsets, num_rows, preceding_window_begin, following_window_begin] __device__(
+      size_type idx) {
+      auto const list_end =
+        thrust::upper_bound(thrust::seq, d_offsets, d_offsets + num_rows + 1, idx);
+      auto const row      = static_cast<size_type>(thrust::distance(d_offsets, list_end) - 1);
+      auto const bounds =
+        window_bounds(row, preceding_window_begin[row], following_window_begin[row], num_rows);
+      return bounds.first + (idx - d_offsets[row]);
+    });
+  auto child = detail::gather(table_view{{input}},
+                              gather_map->view(),
+                              detail::out_of_bounds_policy::IGNORE,
+                              detail::negative_index_policy::NOT_ALLOWED,
+                              mr,
+                              stream);
+
+  auto null_mask = valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [num_rows, min_periods, preceding_window_begin, following_window_begin] __device__(
+      size_type i) {
+      auto const bounds =
+        window_bounds(i, preceding_window_begin[i], following_window_begin[i], num_rows);
+      return bounds.second - bounds.first >= min_periods;
+    },
+    stream,
+    mr);
 
+  return make_lists_column(num_rows,
+                           std::move(offsets),
+                           std::make_unique<cudf::column>(std::move(child->get_column(0))),
+                           null_mask.second,
+                           std::move(null_mask.first),
+                           stream,
+                           mr);
+}
+
+}  // namespace
+
+// Dynamic shared memory of each block of the UDF kernel, in which it stages the union of the
+// windows of its rows
+constexpr size_t rolling_udf_tile_bytes = 16 * 1024;
+
+// Largest number of input columns of a UDF; the PTX adaptor has an overload per number of columns
+constexpr size_type rolling_udf_max_inputs = 4;
+
+// Applies a user-defined rolling window function to the rows of one or more columns.
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+std::unique_ptr<column> rolling_window_udf(table_view const& inputs,
                                            PrecedingWindowIterator preceding_window,
                                            std::string const& preceding_window_str,
                                            FollowingWindowIterator following_window,
@@ -530,8 +862,15 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
   static_assert(warp_size == cudf::detail::size_in_bits<cudf::bitmask_type>(),
                 "bitmask_type size does not match CUDA warp size");
 
-  if (input.has_nulls())
-    CUDF_FAIL("Currently the UDF version of rolling window does NOT support inputs with nulls.");
+  CUDF_EXPECTS(inputs.num_columns() > 0 && inputs.num_columns() <= rolling_udf_max_inputs,
+               "A rolling window UDF takes 1 to 4 input columns.");
+  for (auto const& input : inputs) {
+    if (input.has_nulls())
+      CUDF_FAIL("Currently the UDF version of rolling window does NOT support inputs with nulls.");
+    // The kernel stages the inputs in slots of 8 bytes per element
+    CUDF_EXPECTS(is_fixed_width(input.type()) && size_of(input.type()) <= 8,
+                 "A rolling window UDF takes fixed-width input columns.");
+  }
 
   min_periods = std::max(min_periods, 0);
 
@@ -541,15 +880,19 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
 
   std::string cuda_source;
   switch (udf_agg->kind) {
-    case aggregation::Kind::PTX:
+    case aggregation::Kind::PTX: {
+      // The output and the data of each input array are pointers
+      std::set<int> pointer_args{0};
+      for (size_type i = 0; i < inputs.num_columns(); ++i) { pointer_args.insert(5 + 7 * i); }
       cuda_source = cudf::rolling::jit::code::kernel_headers;
       cuda_source +=
         cudf::jit::parse_single_function_ptx(udf_agg->_source,
                                              udf_agg->_function_name,
                                              cudf::jit::get_type_name(udf_agg->_output_type),
-                                             {0, 5});  // args 0 and 5 are pointers.
+                                             pointer_args);
       cuda_source += cudf::rolling::jit::code::kernel;
       break;
+    }
     case aggregation::Kind::CUDA:
       cuda_source = cudf::rolling::jit::code::kernel_headers;
       cuda_source +=
@@ -560,10 +903,10 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
   }
 
   std::unique_ptr<column> output = make_numeric_column(
-    udf_agg->_output_type, input.size(), cudf::mask_state::UNINITIALIZED, stream, mr);
+    udf_agg->_output_type, inputs.num_rows(), cudf::mask_state::UNINITIALIZED, stream, mr);
 
   auto output_view = output->mutable_view();
-  rmm::device_scalar<size_type> device_valid_count{0, stream};
+  rmm::device_scalar<size_type> device_valid_count{0, stream, get_scratch_resource()};
 
   const std::vector<std::string> compiler_flags{"-std=c++14",
                                                 // Have jitify prune unused global variables
@@ -571,6 +914,32 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
                                                 // suppress all NVRTC warnings
                                                 "-w"};
 
+  std::vector<std::string> template_args{cudf::jit::get_type_name(output->type()),
+                                         udf_agg->_operator_name,
+                                         preceding_window_str,
+                                         following_window_str};
+  for (auto const& input : inputs) {
+    template_args.push_back(cudf::jit::get_type_name(input.type()));
+  }
+
+  // The kernel takes the input columns last, as a parameter pack
+  size_type nrows         = inputs.num_rows();
+  void* out_col           = const_cast<void*>(cudf::jit::get_data_ptr(output_view));
+  bitmask_type* out_valid = output_view.null_mask();
+  size_type* valid_count  = device_valid_count.data();
+  size_type tile_capacity = rolling_udf_tile_bytes / (8 * inputs.num_columns());
+  std::vector<void const*> in_cols;
+  for (auto const& input : inputs) { in_cols.push_back(cudf::jit::get_data_ptr(input)); }
+  std::vector<void*> kernel_args{&nrows,
+                                 &out_col,
+                                 &out_valid,
+                                 &valid_count,
+                                 &preceding_window,
+                                 &following_window,
+                                 &min_periods,
+                                 &tile_capacity};
+  for (auto& in_col : in_cols) { kernel_args.push_back(&in_col); }
+
   // Launch the jitify kernel
   cudf::jit::launcher(hash,
                       cuda_source,
@@ -581,21 +950,8 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
                       compiler_flags,
                       nullptr,
                       stream)
-    .set_kernel_inst("gpu_rolling_new",  // name of the kernel we are launching
-                     {cudf::jit::get_type_name(input.type()),  // list of template arguments
-                      cudf::jit::get_type_name(output->type()),
-                      udf_agg->_operator_name,
-                      preceding_window_str.c_str(),
-                      following_window_str.c_str()})
-    .launch(input.size(),
-            cudf::jit::get_data_ptr(input),
-            input.null_mask(),
-            cudf::jit::get_data_ptr(output_view),
-            output_view.null_mask(),
-            device_valid_count.data(),
-            preceding_window,
-            following_window,
-            min_periods);
+    .set_kernel_inst("gpu_rolling_new", template_args)
+    .launch_with_args(kernel_args, rolling_udf_tile_bytes);
 
   output->set_null_count(output->size() - device_valid_count.value(stream));
 
@@ -629,6 +985,14 @@ std::unique_ptr<column> rolling_window(column_view const& input,
 
   min_periods = std::max(min_periods, 0);
 
+  if (agg->kind == aggregation::LEAD || agg->kind == aggregation::LAG) {
+    return rolling_lead_lag(
+      input, preceding_window_begin, following_window_begin, agg, mr, stream);
+  } else if (agg->kind == aggregation::COLLECT) {
+    return rolling_collect(
+      input, preceding_window_begin, following_window_begin, min_periods, mr, stream);
+  }
+
   return cudf::type_dispatcher(input.type(),
                                dispatch_rolling{},
                                input,
@@ -656,7 +1020,7 @@ std::unique_ptr<column> rolling_window(column_view const& input,
   CUDF_EXPECTS((min_periods >= 0), "min_periods must be non-negative");
 
   if (agg->kind == aggregation::CUDA || agg->kind == aggregation::PTX) {
-    return cudf::detail::rolling_window_udf(input,
+    return cudf::detail::rolling_window_udf(table_view{{input}},
                                             preceding_window,
                                             "cudf::size_type",
                                             following_window,
@@ -695,7 +1059,7 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                "preceding_window/following_window size must match input size");
 
   if (agg->kind == aggregation::CUDA || agg->kind == aggregation::PTX) {
-    return cudf::detail::rolling_window_udf(input,
+    return cudf::detail::rolling_window_udf(table_view{{input}},
                                             preceding_window.begin<size_type>(),
                                             "cudf::size_type*",
                                             following_window.begin<size_type>(),
@@ -715,6 +1079,67 @@ std::unique_ptr<column> rolling_window(column_view const& input,
   }
 }
 
+// Applies a fixed-size user-defined rolling window function to the rows of several columns.
+std::unique_ptr<column> rolling_window(table_view const& inputs,
+                                       size_type preceding_window,
+                                       size_type following_window,
+                                       size_type min_periods,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS(agg->kind == aggregation::CUDA || agg->kind == aggregation::PTX,
+               "Rolling windows of several columns require a UDF aggregation.");
+  CUDF_EXPECTS((min_periods >= 0), "min_periods must be non-negative");
+  if (inputs.num_columns() > 0 && inputs.num_rows() == 0)
+    return make_empty_column(static_cast<udf_aggregation*>(agg.get())->_output_type);
+
+  return cudf::detail::rolling_window_udf(inputs,
+                                          preceding_window,
+                                          "cudf::size_type",
+                                          following_window,
+                                          "cudf::size_type",
+                                          min_periods,
+                                          agg,
+                                          mr,
+                                          0);
+}
+
+// Applies a variable-size user-defined rolling window function to the rows of several columns.
+std::unique_ptr<column> rolling_window(table_view const& inputs,
+                                       column_view const& preceding_window,
+                                       column_view const& following_window,
+                                       size_type min_periods,
+                                       std::unique_ptr<aggregation> const& agg,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS(agg->kind == aggregation::CUDA || agg->kind == aggregation::PTX,
+               "Rolling windows of several columns require a UDF aggregation.");
+  if (inputs.num_columns() > 0 && inputs.num_rows() == 0)
+    return make_empty_column(static_cast<udf_aggregation*>(agg.get())->_output_type);
+
+  CUDF_EXPECTS(preceding_window.type().id() == type_id::INT32 &&
+                 following_window.type().id() == type_id::INT32,
+               "preceding_window/following_window must have type_id::INT32 type");
+
+  CUDF_EXPECTS(
+    preceding_window.size() == inputs.num_rows() && following_window.size() == inputs.num_rows(),
+    "preceding_window/following_window size must match input size");
+
+  return cudf::detail::rolling_window_udf(inputs,
+                                          preceding_window.begin<size_type>(),
+                                          "cudf::size_type*",
+                                          following_window.begin<size_type>(),
+                                          "cudf::size_type*",
+                                          min_periods,
+                                          agg,
+                                          mr,
+                                          0);
+}
+
 std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
                                                column_view const& input,
                                                size_type preceding_window,
@@ -787,7 +1212,7 @@ std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
     cudf::detail::following_window_wrapper grouped_following_window{
       group_offsets.data().get(), group_labels.data().get(), following_window};
 
-    return cudf::detail::rolling_window_udf(input,
+    return cudf::detail::rolling_window_udf(table_view{{input}},
                                             grouped_preceding_window,
                                             "cudf::detail::preceding_window_wrapper",
                                             grouped_following_window,
@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/utilities/warp_bitmask.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <rolling/rolling_detail.hpp>
+
+#include <rmm/device_scalar.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+/**
+ * @file sliding_window.cuh
+ * @brief Rolling window algorithms whose cost does not depend on the window size
+ *
+ * The generic rolling kernel aggregates every window from scratch, which costs
+ * O(num_rows * window). For large windows:
+ * - SUM and MEAN of integral columns and COUNT_VALID are computed from prefix sums of the values
+ *   and of the validity, as the difference of the prefix sums at the two ends of each window;
+ * - MIN and MAX are computed from a sparse table over blocks of 32 rows: the minimum of a window
+ *   spanning several blocks combines the suffix minimum of its first block, the prefix minimum of
+ *   its last block and two overlapping sparse table entries covering the blocks in between.
+ *   Windows inside a single block are aggregated directly.
+ *
+ * Both handle the variable windows of the grouped and time-range rolling windows, since they only
+ * need the bounds of each window. Floating-point SUM and MEAN always use the generic kernel: a
+ * difference of floating-point prefix sums loses the small values after a large one, and a single
+ * infinity or NaN would make every later window NaN.
+ */
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Mean window size from which the sliding-window algorithms are used
+ */
+constexpr size_type sliding_window_threshold = 128;
+
+/**
+ * @brief Returns the bounds `[start, end)` of the window of a row
+ *
+ * @param row Index of the row
+ * @param preceding_window Size of the window before the row, including the row
+ * @param following_window Size of the window after the row
+ * @param num_rows Number of rows of the column
+ */
+__device__ inline thrust::pair<size_type, size_type> window_bounds(size_type row,
+                                                                   size_type preceding_window,
+                                                                   size_type following_window,
+                                                                   size_type num_rows)
+{
+  size_type start = min(num_rows, max(0, row - preceding_window + 1));
+  size_type end   = min(num_rows, max(0, row + following_window + 1));
+  return {min(start, end), max(start, end)};
+}
+
+/**
+ * @brief Returns true if the rolling aggregation of `T` has a prefix-sum algorithm
+ */
+template <typename T, aggregation::Kind op>
+constexpr bool is_prefix_sum_rolling_op()
+{
+  return (op == aggregation::COUNT_VALID) or
+         ((op == aggregation::SUM or op == aggregation::MEAN) and std::is_integral<T>::value);
+}
+
+/**
+ * @brief Returns true if the rolling aggregation of `T` has a sparse table algorithm
+ */
+template <typename T, aggregation::Kind op>
+constexpr bool is_sparse_table_rolling_op()
+{
+  return (op == aggregation::MIN or op == aggregation::MAX) and cudf::is_fixed_width<T>();
+}
+
+/**
+ * @brief Returns true if the rolling aggregation of `T` has a sliding-window algorithm
+ */
+template <typename T, aggregation::Kind op>
+constexpr bool has_sliding_window_algorithm()
+{
+  return is_prefix_sum_rolling_op<T, op>() or is_sparse_table_rolling_op<T, op>();
+}
+
+/**
+ * @brief Returns true if the mean window size reaches `sliding_window_threshold`
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+bool use_sliding_window_algorithm(size_type num_rows,
+                                  PrecedingWindowIterator preceding_window_begin,
+                                  FollowingWindowIterator following_window_begin,
+                                  cudaStream_t stream)
+{
+  auto const total_window_size = thrust::transform_reduce(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [num_rows, preceding_window_begin, following_window_begin] __device__(size_type i) {
+      auto const bounds =
+        window_bounds(i, preceding_window_begin[i], following_window_begin[i], num_rows);
+      return static_cast<int64_t>(bounds.second - bounds.first);
+    },
+    int64_t{0},
+    thrust::plus<int64_t>());
+  return total_window_size >= static_cast<int64_t>(num_rows) * sliding_window_threshold;
+}
+
+/**
+ * @brief Computes the rolling SUM, MEAN or COUNT_VALID of each row from prefix sums
+ *
+ * @param sums Inclusive prefix sums of the values, with nulls as 0, preceded by a 0; unused for
+ * COUNT_VALID
+ * @param valid_counts Prefix counts of the valid rows preceded by a 0, or nullptr if the input has
+ * no nulls
+ */
+template <typename OutputType,
+          typename Accumulator,
+          aggregation::Kind op,
+          int block_size,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+__launch_bounds__(block_size) __global__
+  void gpu_rolling_prefix_sum(size_type num_rows,
+                              Accumulator const* __restrict__ sums,
+                              size_type const* __restrict__ valid_counts,
+                              mutable_column_device_view output,
+                              size_type* __restrict__ output_valid_count,
+                              PrecedingWindowIterator preceding_window_begin,
+                              FollowingWindowIterator following_window_begin,
+                              size_type min_periods)
+{
+  size_type i      = blockIdx.x * block_size + threadIdx.x;
+  size_type stride = block_size * gridDim.x;
+
+  size_type warp_valid_count{0};
+
+  auto active_threads = __ballot_sync(0xffffffff, i < num_rows);
+  while (i < num_rows) {
+    auto const bounds =
+      window_bounds(i, preceding_window_begin[i], following_window_begin[i], num_rows);
+    size_type const count = (valid_counts == nullptr)
+                              ? bounds.second - bounds.first
+                              : valid_counts[bounds.second] - valid_counts[bounds.first];
+
+    if (op == aggregation::COUNT_VALID) {
+      output.element<OutputType>(i) = count;
+    } else {
+      OutputType val = static_cast<OutputType>(sums[bounds.second] - sums[bounds.first]);
+      rolling_store_output_functor<OutputType, op == aggregation::MEAN>{}(
+        output.element<OutputType>(i), val, count);
+    }
+
+    warp_valid_count +=
+      warp_set_validity_word(output.null_mask(), i, count >= min_periods, active_threads);
+
+    i += stride;
+    active_threads = __ballot_sync(active_threads, i < num_rows);
+  }
+
+  size_type block_valid_count = single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
+  if (threadIdx.x == 0) { atomicAdd(output_valid_count, block_valid_count); }
+}
+
+/**
+ * @brief Computes the rolling MIN or MAX of each row from a sparse table over blocks of rows
+ *
+ * @param block_prefix Aggregate of each row and the preceding rows of its block
+ * @param block_suffix Aggregate of each row and the following rows of its block
+ * @param table Sparse table: entry `k * num_blocks + b` aggregates the blocks
+ * `[b, b + 2^k)`
+ * @param num_blocks Number of blocks of `warp_size` rows
+ * @param valid_counts Prefix counts of the valid rows preceded by a 0, or nullptr if the input has
+ * no nulls
+ */
+template <typename T,
+          typename agg_op,
+          int block_size,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+__launch_bounds__(block_size) __global__
+  void gpu_rolling_sparse_table(column_device_view input,
+                                T const* __restrict__ block_prefix,
+                                T const* __restrict__ block_suffix,
+                                T const* __restrict__ table,
+                                size_type num_blocks,
+                                size_type const* __restrict__ valid_counts,
+                                mutable_column_device_view output,
+                                size_type* __restrict__ output_valid_count,
+                                PrecedingWindowIterator preceding_window_begin,
+                                FollowingWindowIterator following_window_begin,
+                                size_type min_periods)
+{
+  size_type i      = blockIdx.x * block_size + threadIdx.x;
+  size_type stride = block_size * gridDim.x;
+
+  size_type warp_valid_count{0};
+
+  auto active_threads = __ballot_sync(0xffffffff, i < input.size());
+  while (i < input.size()) {
+    auto const bounds =
+      window_bounds(i, preceding_window_begin[i], following_window_begin[i], input.size());
+    size_type const count = (valid_counts == nullptr)
+                              ? bounds.second - bounds.first
+                              : valid_counts[bounds.second] - valid_counts[bounds.first];
+
+    T val = agg_op::template identity<T>();
+    if (bounds.first < bounds.second) {
+      auto const first_block = bounds.first / warp_size;
+      auto const last_block  = (bounds.second - 1) / warp_size;
+      if (first_block == last_block) {
+        for (size_type j = bounds.first; j < bounds.second; j++) {
+          if (input.is_valid(j)) { val = agg_op{}(input.element<T>(j), val); }
+        }
+      } else {
+        val = agg_op{}(block_suffix[bounds.first], block_prefix[bounds.second - 1]);
+        if (last_block - first_block > 1) {
+          auto const num_inner = last_block - first_block - 1;
+          auto const level     = 31 - __clz(num_inner);
+          auto const entries   = table + level * num_blocks;
+          val                  = agg_op{}(val, entries[first_block + 1]);
+          val                  = agg_op{}(val, entries[last_block - (1 << level)]);
+        }
+      }
+    }
+    output.element<T>(i) = val;
+
+    warp_valid_count +=
+      warp_set_validity_word(output.null_mask(), i, count >= min_periods, active_threads);
+
+    i += stride;
+    active_threads = __ballot_sync(active_threads, i < input.size());
+  }
+
+  size_type block_valid_count = single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
+  if (threadIdx.x == 0) { atomicAdd(output_valid_count, block_valid_count); }
+}
+
+/**
+ * @brief Returns the prefix counts of the valid rows of a column, preceded by a 0
+ */
+inline rmm::device_vector<size_type> prefix_valid_counts(column_device_view const& d_input,
+                                                         cudaStream_t stream)
+{
+  rmm::device_vector<size_type> valid_counts(d_input.size() + 1, 0);
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(d_input.size()),
+    valid_counts.begin() + 1,
+    [d_input] __device__(size_type i) { return static_cast<size_type>(d_input.is_valid(i)); },
+    thrust::plus<size_type>());
+  return valid_counts;
+}
+
+/**
+ * @brief Returns the prefix sums of the values of a column, with nulls as 0, preceded by a 0
+ */
+template <typename T, typename Accumulator>
+std::enable_if_t<std::is_integral<T>::value, rmm::device_vector<Accumulator>> prefix_sums(
+  column_device_view const& d_input, cudaStream_t stream)
+{
+  rmm::device_vector<Accumulator> sums(d_input.size() + 1, Accumulator{0});
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(d_input.size()),
+    sums.begin() + 1,
+    [d_input] __device__(size_type i) {
+      return d_input.is_valid(i) ? static_cast<Accumulator>(d_input.element<T>(i))
+                                 : Accumulator{0};
+    },
+    thrust::plus<Accumulator>());
+  return sums;
+}
+
+// COUNT_VALID of non-integral columns only needs the valid counts
+template <typename T, typename Accumulator>
+std::enable_if_t<!std::is_integral<T>::value, rmm::device_vector<Accumulator>> prefix_sums(
+  column_device_view const& d_input, cudaStream_t stream)
+{
+  return rmm::device_vector<Accumulator>{};
+}
+
+/**
+ * @brief Computes a rolling SUM, MEAN or COUNT_VALID with prefix sums
+ *
+ * @return The number of valid output rows
+ */
+template <typename T,
+          typename OutputType,
+          typename agg_op,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<is_prefix_sum_rolling_op<T, op>(), size_type> sliding_window_rolling(
+  column_view const& input,
+  mutable_column_view& output,
+  PrecedingWindowIterator preceding_window_begin,
+  FollowingWindowIterator following_window_begin,
+  size_type min_periods,
+  cudaStream_t stream)
+{
+  using Accumulator              = int64_t;
+  constexpr size_type block_size = 256;
+
+  auto d_input  = column_device_view::create(input, stream);
+  auto d_output = mutable_column_device_view::create(output, stream);
+
+  auto const sums = (op == aggregation::COUNT_VALID)
+                      ? rmm::device_vector<Accumulator>{}
+                      : prefix_sums<T, Accumulator>(*d_input, stream);
+  rmm::device_vector<size_type> valid_counts;
+  if (input.has_nulls()) { valid_counts = prefix_valid_counts(*d_input, stream); }
+
+  rmm::device_scalar<size_type> device_valid_count{0, stream};
+  grid_1d grid(input.size(), block_size);
+  gpu_rolling_prefix_sum<OutputType, Accumulator, op, block_size>
+    <<<grid.num_blocks, block_size, 0, stream>>>(
+      input.size(),
+      sums.data().get(),
+      input.has_nulls() ? valid_counts.data().get() : nullptr,
+      *d_output,
+      device_valid_count.data(),
+      preceding_window_begin,
+      following_window_begin,
+      min_periods);
+
+  size_type valid_count = device_valid_count.value(stream);
+
+  CHECK_CUDA(stream);
+
+  return valid_count;
+}
+
+/**
+ * @brief Computes a rolling MIN or MAX with a sparse table over blocks of rows
+ *
+ * @return The number of valid output rows
+ */
+template <typename T,
+          typename OutputType,
+          typename agg_op,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<is_sparse_table_rolling_op<T, op>(), size_type> sliding_window_rolling(
+  column_view const& input,
+  mutable_column_view& output,
+  PrecedingWindowIterator preceding_window_begin,
+  FollowingWindowIterator following_window_begin,
+  size_type min_periods,
+  cudaStream_t stream)
+{
+  constexpr size_type block_size = 256;
+
+  auto d_input     = column_device_view::create(input, stream);
+  auto d_output    = mutable_column_device_view::create(output, stream);
+  auto const count = input.size();
+
+  // Nulls are replaced with the identity, so that they do not change the aggregates
+  auto values = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), [d_input = *d_input] __device__(size_type i) {
+      return d_input.is_valid(i) ? d_input.element<T>(i) : agg_op::template identity<T>();
+    });
+  auto block_keys = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [] __device__(size_type i) { return i / warp_size; });
+
+  rmm::device_vector<T> block_prefix(count);
+  rmm::device_vector<T> block_suffix(count);
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                block_keys,
+                                block_keys + count,
+                                values,
+                                block_prefix.begin(),
+                                thrust::equal_to<size_type>{},
+                                agg_op{});
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream)->on(stream),
+                                thrust::make_reverse_iterator(block_keys + count),
+                                thrust::make_reverse_iterator(block_keys),
+                                thrust::make_reverse_iterator(values + count),
+                                thrust::make_reverse_iterator(block_suffix.end()),
+                                thrust::equal_to<size_type>{},
+                                agg_op{});
+
+  // Level 0 holds the aggregate of each block, level k the aggregate of 2^k consecutive blocks
+  auto const num_blocks = (count + warp_size - 1) / warp_size;
+  size_type num_levels  = 1;
+  while ((size_type{1} << num_levels) <= num_blocks) { ++num_levels; }
+  rmm::device_vector<T> table(static_cast<size_t>(num_levels) * num_blocks);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_blocks),
+                    table.begin(),
+                    [d_prefix = block_prefix.data().get(), count] __device__(size_type b) {
+                      return d_prefix[min(count, (b + 1) * warp_size) - 1];
+                    });
+  for (size_type level = 1; level < num_levels; ++level) {
+    auto const half = size_type{1} << (level - 1);
+    auto d_previous = table.data().get() + (level - 1) * num_blocks;
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_blocks - 2 * half + 1),
+                      table.begin() + level * num_blocks,
+                      [d_previous, half] __device__(size_type b) {
+                        return agg_op{}(d_previous[b], d_previous[b + half]);
+                      });
+  }
+  rmm::device_vector<size_type> valid_counts;
+  if (input.has_nulls()) { valid_counts = prefix_valid_counts(*d_input, stream); }
+
+  rmm::device_scalar<size_type> device_valid_count{0, stream};
+  grid_1d grid(count, block_size);
+  gpu_rolling_sparse_table<T, agg_op, block_size>
+    <<<grid.num_blocks, block_size, 0, stream>>>(
+      *d_input,
+      block_prefix.data().get(),
+      block_suffix.data().get(),
+      table.data().get(),
+      num_blocks,
+      input.has_nulls() ? valid_counts.data().get() : nullptr,
+      *d_output,
+      device_valid_count.data(),
+      preceding_window_begin,
+      following_window_begin,
+      min_periods);
+
+  size_type valid_count = device_valid_count.value(stream);
+
+  CHECK_CUDA(stream);
+
+  return valid_count;
+}
+
+template <typename T,
+          typename OutputType,
+          typename agg_op,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::enable_if_t<!has_sliding_window_algorithm<T, op>(), size_type> sliding_window_rolling(
+  column_view const& input,
+  mutable_column_view& output,
+  PrecedingWindowIterator preceding_window_begin,
+  FollowingWindowIterator following_window_begin,
+  size_type min_periods,
+  cudaStream_t stream)
+{
+  CUDF_FAIL("No sliding-window algorithm for this aggregation and type");
+}
+
+}  // namespace detail
+}  // namespace cudf
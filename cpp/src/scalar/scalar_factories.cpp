@@ -37,6 +37,18 @@ struct scalar_construction_helper {
     CUDF_FAIL("Invalid type.");
   }
 };
+
+// Fixed-point scalars hold their scale in their type, which the storage type does not carry
+std::unique_ptr<scalar> make_fixed_point_scalar(data_type type,
+                                                cudaStream_t stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  auto const scale = numeric::scale_type{type.scale()};
+  if (type.id() == type_id::DECIMAL32) {
+    return std::make_unique<fixed_point_scalar<numeric::decimal32>>(0, scale, false, stream, mr);
+  }
+  return std::make_unique<fixed_point_scalar<numeric::decimal64>>(0, scale, false, stream, mr);
+}
 }  // namespace
 
 // Allocate storage for a single numeric element
@@ -76,6 +88,7 @@ std::unique_ptr<scalar> make_fixed_width_scalar(data_type type,
 {
   CUDF_EXPECTS(is_fixed_width(type), "Invalid, non-fixed-width type.");
 
+  if (is_fixed_point(type)) { return make_fixed_point_scalar(type, stream, mr); }
   return type_dispatcher(type, scalar_construction_helper{}, stream, mr);
 }
 
@@ -101,10 +114,19 @@ std::unique_ptr<cudf::scalar> default_scalar_functor::operator()<list_view>()
   CUDF_FAIL("list_view type not supported");
 }
 
+template <>
+std::unique_ptr<cudf::scalar> default_scalar_functor::operator()<struct_view>()
+{
+  CUDF_FAIL("struct_view type not supported");
+}
+
 }  // namespace
 
 std::unique_ptr<scalar> make_default_constructed_scalar(data_type type)
 {
+  if (is_fixed_point(type)) {
+    return make_fixed_point_scalar(type, 0, rmm::mr::get_default_resource());
+  }
   return type_dispatcher(type, default_scalar_functor{});
 }
 
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/warp_bitmask.cuh>
+#include <cudf/search.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_scalar.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr size_type bin_block_size = 256;
+
+// The histogram threads count more elements each, so that fewer blocks flush their counters
+constexpr size_type histogram_elements_per_thread = 16;
+
+// Edges and counters up to this size are staged in shared memory, which leaves room below the
+// 48 KiB a kernel can use without opting in
+constexpr std::size_t max_shared_bin_bytes = 32 * 1024;
+
+/**
+ * @brief Returns true if `edge` is at or below the start of the bins holding `value`: if it is
+ * at most `value` for bins closed on the left, and less than `value` for bins closed on the right
+ */
+template <bool left_closed, typename T>
+__device__ inline bool edge_below(T const& edge, T const& value)
+{
+  return left_closed ? edge <= value : edge < value;
+}
+
+/**
+ * @brief Returns the number of edges below `value`, as of `edge_below()`
+ *
+ * The binary search halves the range without branching: the condition only selects the offset
+ * of the next range, so the threads of a warp do not diverge whatever their values.
+ * `value` is in bin `result - 1` if `0 < result < num_edges`.
+ */
+template <bool left_closed, typename T>
+__device__ inline size_type edges_below(T const* edges, size_type num_edges, T const& value)
+{
+  T const* base = edges;
+  auto size     = num_edges;
+  while (size > 1) {
+    auto const half = size / 2;
+    base += edge_below<left_closed>(base[half], value) ? half : 0;
+    size -= half;
+  }
+  return static_cast<size_type>(base - edges) + edge_below<left_closed>(*base, value);
+}
+
+/**
+ * @brief Copies the edges to the shared memory of the block if `staged`, returning the edges to
+ * search
+ */
+template <bool staged, typename T>
+__device__ T const* stage_bin_edges(T const* d_edges, size_type num_edges, T* shared_edges)
+{
+  if (not staged) return d_edges;
+  for (size_type j = threadIdx.x; j < num_edges; j += blockDim.x) {
+    shared_edges[j] = d_edges[j];
+  }
+  return shared_edges;
+}
+
+/**
+ * @brief Returns the offset of the histogram counters in shared memory, after the edges
+ */
+template <typename T>
+__host__ __device__ inline std::size_t shared_counts_offset(size_type num_edges)
+{
+  return (num_edges * sizeof(T) + 7) / 8 * 8;
+}
+
+/**
+ * @brief Stores the bin of each element of `input` and the validity of the bins
+ *
+ * @tparam staged Whether the edges are read from shared memory
+ */
+template <typename T, bool left_closed, bool staged>
+__launch_bounds__(bin_block_size) __global__
+  void bucketize_kernel(column_device_view input,
+                        T const* __restrict__ d_edges,
+                        size_type num_edges,
+                        mutable_column_device_view output,
+                        size_type* __restrict__ output_valid_count)
+{
+  extern __shared__ __align__(8) unsigned char bin_shared_memory[];
+  auto const edges =
+    stage_bin_edges<staged>(d_edges, num_edges, reinterpret_cast<T*>(bin_shared_memory));
+  if (staged) { __syncthreads(); }
+
+  size_type i      = blockIdx.x * bin_block_size + threadIdx.x;
+  size_type stride = bin_block_size * gridDim.x;
+
+  size_type warp_valid_count{0};
+
+  auto active_threads = __ballot_sync(0xffffffff, i < input.size());
+  while (i < input.size()) {
+    auto const below =
+      input.is_valid(i) ? edges_below<left_closed>(edges, num_edges, input.element<T>(i)) : 0;
+    bool const output_is_valid   = below > 0 and below < num_edges;
+    output.element<size_type>(i) = output_is_valid ? below - 1 : 0;
+    warp_valid_count +=
+      warp_set_validity_word(output.null_mask(), i, output_is_valid, active_threads);
+
+    i += stride;
+    active_threads = __ballot_sync(active_threads, i < input.size());
+  }
+
+  // sum the valid counts across the whole block
+  size_type block_valid_count = single_lane_block_sum_reduce<bin_block_size, 0>(warp_valid_count);
+
+  if (threadIdx.x == 0) { atomicAdd(output_valid_count, block_valid_count); }
+}
+
+/**
+ * @brief Counts the elements of `input` in each bin
+ *
+ * @tparam staged Whether the edges and the counters of the block are in shared memory; the
+ * counters of the blocks are then added to `counts` once per block and bin instead of once per
+ * element
+ */
+template <typename T, bool left_closed, bool staged>
+__launch_bounds__(bin_block_size) __global__
+  void histogram_kernel(column_device_view input,
+                        T const* __restrict__ d_edges,
+                        size_type num_edges,
+                        int64_t* __restrict__ counts)
+{
+  extern __shared__ __align__(8) unsigned char bin_shared_memory[];
+  auto const edges =
+    stage_bin_edges<staged>(d_edges, num_edges, reinterpret_cast<T*>(bin_shared_memory));
+  auto const num_bins      = num_edges - 1;
+  auto const shared_counts =
+    reinterpret_cast<uint32_t*>(bin_shared_memory + shared_counts_offset<T>(num_edges));
+  if (staged) {
+    for (size_type j = threadIdx.x; j < num_bins; j += blockDim.x) { shared_counts[j] = 0; }
+    __syncthreads();
+  }
+
+  for (size_type i = blockIdx.x * bin_block_size + threadIdx.x; i < input.size();
+       i += bin_block_size * gridDim.x) {
+    if (input.is_null(i)) continue;
+    auto const below = edges_below<left_closed>(edges, num_edges, input.element<T>(i));
+    if (below == 0 or below == num_edges) continue;
+    if (staged) {
+      atomicAdd(shared_counts + below - 1, uint32_t{1});
+    } else {
+      atomicAdd(counts + below - 1, int64_t{1});
+    }
+  }
+
+  if (staged) {
+    __syncthreads();
+    for (size_type j = threadIdx.x; j < num_bins; j += blockDim.x) {
+      if (shared_counts[j] != 0) { atomicAdd(counts + j, static_cast<int64_t>(shared_counts[j])); }
+    }
+  }
+}
+
+template <typename T>
+constexpr bool is_binnable()
+{
+  return cudf::is_numeric<T>() or cudf::is_timestamp<T>() or cudf::is_duration<T>();
+}
+
+// Stores the bins of the elements of `input` in `output`, returning their null count
+struct bucketize_dispatch {
+  template <typename T>
+  std::enable_if_t<is_binnable<T>(), size_type> operator()(column_view const& input,
+                                                           column_view const& bin_edges,
+                                                           closed_side closed,
+                                                           mutable_column_view& output,
+                                                           cudaStream_t stream) const
+  {
+    auto const edge_bytes = bin_edges.size() * sizeof(T);
+    auto const staged     = edge_bytes <= max_shared_bin_bytes;
+    auto const d_input    = column_device_view::create(input, stream);
+    auto const d_output   = mutable_column_device_view::create(output, stream);
+    grid_1d const grid(input.size(), bin_block_size);
+    rmm::device_scalar<size_type> valid_count{0, stream};
+
+    auto const launch = [&](auto kernel, std::size_t shared_memory_bytes) {
+      kernel<<<grid.num_blocks, bin_block_size, shared_memory_bytes, stream>>>(
+        *d_input, bin_edges.data<T>(), bin_edges.size(), *d_output, valid_count.data());
+    };
+    if (closed == closed_side::LEFT) {
+      if (staged) {
+        launch(bucketize_kernel<T, true, true>, edge_bytes);
+      } else {
+        launch(bucketize_kernel<T, true, false>, 0);
+      }
+    } else {
+      if (staged) {
+        launch(bucketize_kernel<T, false, true>, edge_bytes);
+      } else {
+        launch(bucketize_kernel<T, false, false>, 0);
+      }
+    }
+    CHECK_CUDA(stream);
+    return input.size() - valid_count.value(stream);
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_binnable<T>(), size_type> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Bins require numeric, timestamp or duration columns");
+  }
+};
+
+// Adds the counts of the elements of `input` in each bin to `counts`
+struct histogram_dispatch {
+  template <typename T>
+  std::enable_if_t<is_binnable<T>()> operator()(column_view const& input,
+                                                column_view const& bin_edges,
+                                                closed_side closed,
+                                                mutable_column_view& counts,
+                                                cudaStream_t stream) const
+  {
+    auto const shared_memory_bytes =
+      shared_counts_offset<T>(bin_edges.size()) + counts.size() * sizeof(uint32_t);
+    auto const staged  = shared_memory_bytes <= max_shared_bin_bytes;
+    auto const d_input = column_device_view::create(input, stream);
+    grid_1d const grid(input.size(), bin_block_size, histogram_elements_per_thread);
+
+    auto const launch = [&](auto kernel, std::size_t shared_bytes) {
+      kernel<<<grid.num_blocks, bin_block_size, shared_bytes, stream>>>(
+        *d_input, bin_edges.data<T>(), bin_edges.size(), counts.data<int64_t>());
+    };
+    if (closed == closed_side::LEFT) {
+      if (staged) {
+        launch(histogram_kernel<T, true, true>, shared_memory_bytes);
+      } else {
+        launch(histogram_kernel<T, true, false>, 0);
+      }
+    } else {
+      if (staged) {
+        launch(histogram_kernel<T, false, true>, shared_memory_bytes);
+      } else {
+        launch(histogram_kernel<T, false, false>, 0);
+      }
+    }
+    CHECK_CUDA(stream);
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_binnable<T>()> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Bins require numeric, timestamp or duration columns");
+  }
+};
+
+void validate_bins(column_view const& input, column_view const& bin_edges)
+{
+  CUDF_EXPECTS(input.type() == bin_edges.type(), "Bin edges must have the type of the input");
+  CUDF_EXPECTS(bin_edges.size() >= 2, "There must be at least 2 bin edges");
+  CUDF_EXPECTS(not bin_edges.has_nulls(), "Bin edges must not be null");
+}
+
+}  // namespace
+
+std::unique_ptr<column> bucketize(column_view const& input,
+                                  column_view const& bin_edges,
+                                  closed_side closed,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  validate_bins(input, bin_edges);
+  auto output = make_numeric_column(
+    data_type{type_id::INT32}, input.size(), mask_state::UNINITIALIZED, stream, mr);
+  if (input.size() == 0) return output;
+
+  auto output_view       = output->mutable_view();
+  auto const null_count = type_dispatcher(
+    input.type(), bucketize_dispatch{}, input, bin_edges, closed, output_view, stream);
+  output->set_null_count(null_count);
+  return output;
+}
+
+std::unique_ptr<column> histogram(column_view const& input,
+                                  column_view const& bin_edges,
+                                  closed_side closed,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  validate_bins(input, bin_edges);
+  auto counts = make_numeric_column(
+    data_type{type_id::INT64}, bin_edges.size() - 1, mask_state::UNALLOCATED, stream, mr);
+  auto counts_view = counts->mutable_view();
+  CUDA_TRY(cudaMemsetAsync(
+    counts_view.data<int64_t>(), 0, counts_view.size() * sizeof(int64_t), stream));
+  if (input.size() == 0) return counts;
+
+  type_dispatcher(
+    input.type(), histogram_dispatch{}, input, bin_edges, closed, counts_view, stream);
+  return counts;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> bucketize(column_view const& input,
+                                  column_view const& bin_edges,
+                                  closed_side closed,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bucketize(input, bin_edges, closed, mr);
+}
+
+std::unique_ptr<column> histogram(column_view const& input,
+                                  column_view const& bin_edges,
+                                  closed_side closed,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::histogram(input, bin_edges, closed, mr);
+}
+
+}  // namespace cudf
@@ -30,8 +30,12 @@
 #include <cudf/strings/detail/utilities.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/for_each.h>
 #include <thrust/logical.h>
 
+#include <functional>
+#include <type_traits>
+
 namespace cudf {
 namespace {
 template <typename DataIterator,
@@ -66,6 +70,67 @@ void launch_search(DataIterator it_data,
   }
 }
 
+/**
+ * @brief Searches the rows of `values` in the sorted table of `d_t` with the row comparator.
+ */
+void search_ordered(table_device_view const& d_t,
+                    bool t_has_nulls,
+                    table_view const& values,
+                    bool find_first,
+                    order const* d_column_order,
+                    null_order const* d_null_precedence,
+                    size_type* output,
+                    cudaStream_t stream)
+{
+  auto d_values = table_device_view::create(values, stream);
+  auto count_it = thrust::make_counting_iterator<size_type>(0);
+
+  if (t_has_nulls or has_nulls(values)) {
+    auto ineq_op = (find_first) ? row_lexicographic_comparator<true>(
+                                    d_t, *d_values, d_column_order, d_null_precedence)
+                                : row_lexicographic_comparator<true>(
+                                    *d_values, d_t, d_column_order, d_null_precedence);
+
+    launch_search(count_it,
+                  count_it,
+                  d_t.num_rows(),
+                  values.num_rows(),
+                  output,
+                  ineq_op,
+                  find_first,
+                  stream);
+  } else {
+    auto ineq_op = (find_first) ? row_lexicographic_comparator<false>(
+                                    d_t, *d_values, d_column_order, d_null_precedence)
+                                : row_lexicographic_comparator<false>(
+                                    *d_values, d_t, d_column_order, d_null_precedence);
+
+    launch_search(count_it,
+                  count_it,
+                  d_t.num_rows(),
+                  values.num_rows(),
+                  output,
+                  ineq_op,
+                  find_first,
+                  stream);
+  }
+}
+
+void validate_search_order(table_view const& t,
+                           std::vector<order> const& column_order,
+                           std::vector<null_order> const& null_precedence)
+{
+  if (not column_order.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(t.num_columns()) == column_order.size(),
+                 "Mismatch between number of columns and column order.");
+  }
+
+  if (not null_precedence.empty()) {
+    CUDF_EXPECTS(static_cast<std::size_t>(t.num_columns()) == null_precedence.size(),
+                 "Mismatch between number of columns and null precedence.");
+  }
+}
+
 std::unique_ptr<column> search_ordered(table_view const& t,
                                        table_view const& values,
                                        bool find_first,
@@ -82,64 +147,168 @@ std::unique_ptr<column> search_ordered(table_view const& t,
 
   // Handle empty inputs
   if (t.num_rows() == 0) {
-    CUDA_TRY(cudaMemset(result_view.data<size_type>(), 0, values.num_rows() * sizeof(size_type)));
+    CUDA_TRY(cudaMemsetAsync(
+      result_view.data<size_type>(), 0, values.num_rows() * sizeof(size_type), stream));
     return result;
   }
 
-  if (not column_order.empty()) {
-    CUDF_EXPECTS(static_cast<std::size_t>(t.num_columns()) == column_order.size(),
-                 "Mismatch between number of columns and column order.");
-  }
+  validate_search_order(t, column_order, null_precedence);
 
-  if (not null_precedence.empty()) {
-    CUDF_EXPECTS(static_cast<std::size_t>(t.num_columns()) == null_precedence.size(),
-                 "Mismatch between number of columns and null precedence.");
-  }
-
-  auto d_t      = table_device_view::create(t, stream);
-  auto d_values = table_device_view::create(values, stream);
-  auto count_it = thrust::make_counting_iterator<size_type>(0);
+  auto d_t = table_device_view::create(t, stream);
 
   rmm::device_vector<order> d_column_order(column_order.begin(), column_order.end());
   rmm::device_vector<null_order> d_null_precedence(null_precedence.begin(), null_precedence.end());
 
-  if (has_nulls(t) or has_nulls(values)) {
-    auto ineq_op =
-      (find_first)
-        ? row_lexicographic_comparator<true>(
-            *d_t, *d_values, d_column_order.data().get(), d_null_precedence.data().get())
-        : row_lexicographic_comparator<true>(
-            *d_values, *d_t, d_column_order.data().get(), d_null_precedence.data().get());
+  search_ordered(*d_t,
+                 has_nulls(t),
+                 values,
+                 find_first,
+                 d_column_order.data().get(),
+                 d_null_precedence.data().get(),
+                 result_view.data<size_type>(),
+                 stream);
 
-    launch_search(count_it,
-                  count_it,
-                  t.num_rows(),
-                  values.num_rows(),
-                  result_view.data<size_type>(),
-                  ineq_op,
-                  find_first,
-                  stream);
-  } else {
-    auto ineq_op =
-      (find_first)
-        ? row_lexicographic_comparator<false>(
-            *d_t, *d_values, d_column_order.data().get(), d_null_precedence.data().get())
-        : row_lexicographic_comparator<false>(
-            *d_values, *d_t, d_column_order.data().get(), d_null_precedence.data().get());
+  return result;
+}
 
-    launch_search(count_it,
-                  count_it,
-                  t.num_rows(),
-                  values.num_rows(),
-                  result_view.data<size_type>(),
-                  ineq_op,
-                  find_first,
-                  stream);
-  }
+/**
+ * @brief Returns whether the keys of a type can be searched in an Eytzinger layout.
+ *
+ * Floating-point keys are excluded since the row comparator orders NaNs.
+ */
+template <typename T>
+constexpr bool is_eytzinger_searchable()
+{
+  return std::is_integral<T>::value or cudf::is_chrono<T>();
+}
 
-  return result;
+/**
+ * @brief Returns the position in sorted order of element `k` of an Eytzinger layout.
+ *
+ * The layout is a complete binary tree of `height` levels stored in breadth-first order from
+ * index 1. The in-order rank of the `p`-th node of level `l` is
+ * `(2p + 1) * 2^(height - 1 - l) - 1`.
+ */
+__device__ inline uint64_t eytzinger_rank(uint64_t k, int height)
+{
+  int const level      = 63 - __clzll(k);
+  uint64_t const index = k - (uint64_t{1} << level);
+  return ((2 * index + 1) << (height - 1 - level)) - 1;
 }
 
+/**
+ * @brief Copies sorted keys into an Eytzinger layout.
+ *
+ * Padding nodes, whose rank is past the keys, are never read by the search.
+ */
+template <typename T>
+struct eytzinger_build_fn {
+  T const* keys;
+  T* layout;
+  size_type num_keys;
+  int height;
+
+  __device__ void operator()(uint64_t k) const
+  {
+    auto const rank = eytzinger_rank(k, height);
+    if (rank < static_cast<uint64_t>(num_keys)) { layout[k] = keys[rank]; }
+  }
+};
+
+/**
+ * @brief Searches a value in an Eytzinger layout of sorted keys.
+ *
+ * The search descends to the right while the node is ordered before the value (before, or not
+ * after, for the upper bound). The answer is the last node where it descended to the left, which
+ * is recovered from the path by removing the trailing right turns.
+ */
+template <typename T>
+struct eytzinger_search_fn {
+  T const* layout;
+  size_type num_keys;
+  int height;
+  bool descending;
+  bool find_first;
+
+  __device__ bool is_before(T const& key, T const& value) const
+  {
+    if (find_first) { return descending ? value < key : key < value; }
+    return descending ? !(key < value) : !(value < key);
+  }
+
+  __device__ size_type operator()(T const& value) const
+  {
+    uint64_t const num_nodes = uint64_t{1} << height;
+    uint64_t k               = 1;
+    while (k < num_nodes) {
+      bool const right =
+        eytzinger_rank(k, height) < static_cast<uint64_t>(num_keys) && is_before(layout[k], value);
+      k = 2 * k + right;
+    }
+    k >>= __ffsll(static_cast<long long>(~k));
+    // Every key is ordered before the value, or the answer is a padding node
+    if (k == 0) { return num_keys; }
+    auto const rank = eytzinger_rank(k, height);
+    return rank < static_cast<uint64_t>(num_keys) ? static_cast<size_type>(rank) : num_keys;
+  }
+};
+
+struct eytzinger_build_dispatch {
+  template <typename T>
+  std::enable_if_t<is_eytzinger_searchable<T>(), bool> operator()(column_view const& keys,
+                                                                    int height,
+                                                                    rmm::device_buffer& layout,
+                                                                    cudaStream_t stream)
+  {
+    uint64_t const num_nodes = uint64_t{1} << height;
+    layout                   = rmm::device_buffer(num_nodes * sizeof(T), stream);
+    thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<uint64_t>(1),
+                     thrust::make_counting_iterator<uint64_t>(num_nodes),
+                     eytzinger_build_fn<T>{
+                       keys.data<T>(), static_cast<T*>(layout.data()), keys.size(), height});
+    return true;
+  }
+
+  template <typename T>
+  std::enable_if_t<not is_eytzinger_searchable<T>(), bool> operator()(column_view const&,
+                                                                        int,
+                                                                        rmm::device_buffer&,
+                                                                        cudaStream_t)
+  {
+    return false;
+  }
+};
+
+struct eytzinger_search_dispatch {
+  template <typename T>
+  std::enable_if_t<is_eytzinger_searchable<T>()> operator()(column_view const& values,
+                                                            rmm::device_buffer const& layout,
+                                                            size_type num_keys,
+                                                            int height,
+                                                            bool descending,
+                                                            bool find_first,
+                                                            size_type* output,
+                                                            cudaStream_t stream)
+  {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      values.begin<T>(),
+                      values.end<T>(),
+                      output,
+                      eytzinger_search_fn<T>{static_cast<T const*>(layout.data()),
+                                             num_keys,
+                                             height,
+                                             descending,
+                                             find_first});
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_eytzinger_searchable<T>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported Eytzinger search key type");
+  }
+};
+
 struct contains_scalar_dispatch {
   template <typename Element>
   bool operator()(column_view const& col,
@@ -187,6 +356,15 @@ bool contains_scalar_dispatch::operator()<cudf::list_view>(column_view const& co
   CUDF_FAIL("list_view type not supported yet");
 }
 
+template <>
+bool contains_scalar_dispatch::operator()<cudf::struct_view>(column_view const& col,
+                                                             scalar const& value,
+                                                             cudaStream_t stream,
+                                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FAIL("struct_view type not supported yet");
+}
+
 }  // namespace
 
 namespace detail {
@@ -279,6 +457,16 @@ std::unique_ptr<column> multi_contains_dispatch::operator()<list_view>(
   CUDF_FAIL("list_view type not supported");
 }
 
+template <>
+std::unique_ptr<column> multi_contains_dispatch::operator()<struct_view>(
+  column_view const& haystack,
+  column_view const& needles,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream)
+{
+  CUDF_FAIL("struct_view type not supported");
+}
+
 std::unique_ptr<column> contains(column_view const& haystack,
                                  column_view const& needles,
                                  rmm::mr::device_memory_resource* mr,
@@ -312,6 +500,103 @@ std::unique_ptr<column> upper_bound(table_view const& t,
 
 }  // namespace detail
 
+struct search_index::search_index_impl {
+  search_index_impl(table_view const& t,
+                    std::vector<order> const& column_order,
+                    std::vector<null_order> const& null_precedence,
+                    cudaStream_t stream)
+    : _t(t),
+      _t_has_nulls(has_nulls(t)),
+      _d_t(table_device_view::create(t, stream)),
+      _d_column_order(column_order.begin(), column_order.end()),
+      _d_null_precedence(null_precedence.begin(), null_precedence.end()),
+      _descending(not column_order.empty() and column_order.front() == order::DESCENDING)
+  {
+    validate_search_order(t, column_order, null_precedence);
+    if (t.num_columns() != 1 or t.num_rows() == 0 or _t_has_nulls) { return; }
+
+    // Smallest complete binary tree holding all the keys
+    while ((uint64_t{1} << _height) - 1 < static_cast<uint64_t>(t.num_rows())) { ++_height; }
+    _has_layout = type_dispatcher(
+      t.column(0).type(), eytzinger_build_dispatch{}, t.column(0), _height, _layout, stream);
+  }
+
+  std::unique_ptr<column> search(table_view const& values,
+                                 bool find_first,
+                                 rmm::mr::device_memory_resource* mr,
+                                 cudaStream_t stream) const
+  {
+    CUDF_EXPECTS(values.num_columns() == _t.num_columns(),
+                 "Mismatch between number of columns of the table and of the values.");
+    std::unique_ptr<column> result = make_numeric_column(
+      data_type{type_to_id<size_type>()}, values.num_rows(), mask_state::UNALLOCATED, stream, mr);
+    auto* output = result->mutable_view().data<size_type>();
+
+    if (_t.num_rows() == 0 or values.num_rows() == 0) {
+      CUDA_TRY(cudaMemsetAsync(output, 0, values.num_rows() * sizeof(size_type), stream));
+    } else if (_has_layout and values.column(0).type() == _t.column(0).type() and
+               not values.column(0).has_nulls()) {
+      type_dispatcher(values.column(0).type(),
+                      eytzinger_search_dispatch{},
+                      values.column(0),
+                      _layout,
+                      _t.num_rows(),
+                      _height,
+                      _descending,
+                      find_first,
+                      output,
+                      stream);
+    } else {
+      search_ordered(*_d_t,
+                     _t_has_nulls,
+                     values,
+                     find_first,
+                     _d_column_order.data().get(),
+                     _d_null_precedence.data().get(),
+                     output,
+                     stream);
+    }
+    return result;
+  }
+
+ private:
+  table_view _t;
+  bool _t_has_nulls;
+  std::unique_ptr<table_device_view, std::function<void(table_device_view*)>> _d_t;
+  rmm::device_vector<order> _d_column_order;
+  rmm::device_vector<null_order> _d_null_precedence;
+  bool _descending;
+  bool _has_layout{false};
+  int _height{0};
+  rmm::device_buffer _layout{};  ///< Keys in Eytzinger layout from index 1
+};
+
+search_index::search_index(table_view const& t,
+                           std::vector<order> const& column_order,
+                           std::vector<null_order> const& null_precedence,
+                           cudaStream_t stream)
+  : impl{std::make_unique<const search_index_impl>(t, column_order, null_precedence, stream)}
+{
+}
+
+search_index::~search_index() = default;
+
+std::unique_ptr<column> search_index::lower_bound(table_view const& values,
+                                                  rmm::mr::device_memory_resource* mr,
+                                                  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->search(values, true, mr, stream);
+}
+
+std::unique_ptr<column> search_index::upper_bound(table_view const& values,
+                                                  rmm::mr::device_memory_resource* mr,
+                                                  cudaStream_t stream) const
+{
+  CUDF_FUNC_RANGE();
+  return impl->search(values, false, mr, stream);
+}
+
 // external APIs
 
 std::unique_ptr<column> lower_bound(table_view const& t,
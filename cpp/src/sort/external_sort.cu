@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/comp/gpuinflate.h>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/external_sort.hpp>
+#include <cudf/merge.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+
+namespace cudf {
+namespace {
+// Size of the pages a spilled block is cut into for compression
+constexpr size_t SPILL_PAGE_SIZE{64 * 1024};
+
+using pinned_buffer = std::unique_ptr<uint8_t, decltype(&cudaFreeHost)>;
+
+pinned_buffer make_pinned_buffer(size_t size)
+{
+  uint8_t* ptr = nullptr;
+  if (size != 0) { CUDA_TRY(cudaMallocHost(&ptr, size)); }
+  return pinned_buffer{ptr, cudaFreeHost};
+}
+
+/**
+ * @brief Position of a column's buffers within the packed data of a spilled block
+ */
+struct column_layout {
+  data_type type;
+  size_type size;
+  size_type null_count;
+  size_type offset;
+  int64_t data_offset;  ///< -1 if the column has no data
+  int64_t mask_offset;  ///< -1 if the column has no null mask
+  std::vector<column_layout> children;
+};
+
+int64_t offset_in(void const* ptr, uint8_t const* base)
+{
+  return ptr == nullptr ? -1 : static_cast<uint8_t const*>(ptr) - base;
+}
+
+column_layout describe(column_view const& col, uint8_t const* base)
+{
+  column_layout layout{col.type(),
+                       col.size(),
+                       col.null_count(),
+                       col.offset(),
+                       offset_in(col.head(), base),
+                       offset_in(col.null_mask(), base),
+                       {}};
+  for (size_type i = 0; i < col.num_children(); ++i) {
+    layout.children.push_back(describe(col.child(i), base));
+  }
+  return layout;
+}
+
+column_view rebuild(column_layout const& layout, uint8_t const* base)
+{
+  std::vector<column_view> children;
+  for (auto const& child : layout.children) { children.push_back(rebuild(child, base)); }
+  auto const data = layout.data_offset < 0 ? nullptr : base + layout.data_offset;
+  auto const mask = layout.mask_offset < 0
+                      ? nullptr
+                      : reinterpret_cast<bitmask_type const*>(base + layout.mask_offset);
+  return column_view(
+    layout.type, layout.size, data, mask, layout.null_count, layout.offset, children);
+}
+
+/**
+ * @brief A page of the packed data of a spilled block, as it is stored
+ */
+struct spilled_page {
+  size_t packed_offset;  ///< Offset of the page in the packed data
+  size_t packed_size;
+  size_t stored_offset;  ///< Offset of the page in the stored payload
+  size_t stored_size;
+  bool compressed;
+};
+
+/**
+ * @brief A sorted block of rows of a run, packed into one buffer and spilled
+ */
+struct spilled_block {
+  std::vector<column_layout> columns;
+  size_t packed_size;
+  std::vector<spilled_page> pages;
+  size_t stored_size;
+  pinned_buffer host_data{nullptr, cudaFreeHost};  ///< Payload for `spill_location::HOST`
+  int64_t file_offset{-1};                         ///< Payload for `spill_location::DISK`
+};
+
+/**
+ * @brief A sorted run being merged: its spilled blocks not loaded yet, and the
+ * rows of the loaded block not merged yet
+ */
+struct merge_run {
+  std::deque<spilled_block> blocks;
+  std::unique_ptr<rmm::device_buffer> window_data;
+  table_view window;
+  size_type window_begin{0};
+
+  size_type window_rows() const { return window.num_rows() - window_begin; }
+
+  table_view remaining() const
+  {
+    return cudf::slice(window, {window_begin, window.num_rows()})[0];
+  }
+};
+
+}  // namespace
+
+class external_sorter::impl {
+ public:
+  explicit impl(external_sort_options const& options) : _options{options}
+  {
+    CUDF_EXPECTS(_options.compression == io::compression_type::NONE or
+                   _options.compression == io::compression_type::SNAPPY,
+                 "Spilled runs can only be compressed with SNAPPY");
+    CUDF_EXPECTS(_options.spill_block_rows > 0, "Spilled blocks must have at least one row");
+    CUDF_EXPECTS(_options.output_chunk_rows > 0, "Output chunks must have at least one row");
+    if (_options.location == spill_location::DISK) {
+      auto path = _options.spill_directory + "/cudf_external_sort_XXXXXX";
+      _fd       = mkstemp(&path[0]);
+      CUDF_EXPECTS(_fd >= 0, "Cannot create the spill file in " + _options.spill_directory);
+      // The file is removed as soon as its descriptor is closed
+      unlink(path.c_str());
+    }
+  }
+
+  ~impl()
+  {
+    if (_fd >= 0) { close(_fd); }
+  }
+
+  void append(table_view const& run)
+  {
+    CUDF_EXPECTS(not _merging, "Cannot append runs once sorted rows have been returned");
+    if (_schema.empty()) {
+      std::transform(run.begin(), run.end(), std::back_inserter(_schema), [](auto const& c) {
+        return c.type();
+      });
+      init_keys(run.num_columns());
+    }
+    CUDF_EXPECTS(std::equal(_schema.begin(),
+                            _schema.end(),
+                            run.begin(),
+                            run.end(),
+                            [](data_type t, column_view const& c) { return t == c.type(); }),
+                 "Columns of the run do not match the columns of the previous runs");
+    if (run.num_rows() == 0) { return; }
+
+    auto const sorted =
+      detail::sort_by_key(run, run.select(_keys), _column_order, _options.null_precedence);
+
+    merge_run spilled;
+    for (size_type begin = 0; begin < sorted->num_rows(); begin += _options.spill_block_rows) {
+      auto const end = begin + std::min(_options.spill_block_rows, sorted->num_rows() - begin);
+      spilled.blocks.push_back(spill(cudf::slice(sorted->view(), {begin, end})[0]));
+    }
+    _runs.push_back(std::move(spilled));
+  }
+
+  bool has_next()
+  {
+    _merging = true;
+    while (pending_rows() == 0 and merge_step()) {}
+    return pending_rows() > 0;
+  }
+
+  std::unique_ptr<table> next(rmm::mr::device_memory_resource* mr)
+  {
+    CUDF_EXPECTS(has_next(), "All sorted rows have been returned");
+    auto const rows = std::min(pending_rows(), _options.output_chunk_rows);
+    if (_pending_begin == 0 and rows == _pending->num_rows() and
+        mr == rmm::mr::get_default_resource()) {
+      return std::move(_pending);
+    }
+    auto const chunk = cudf::slice(_pending->view(), {_pending_begin, _pending_begin + rows})[0];
+    _pending_begin += rows;
+    return std::make_unique<table>(chunk, 0, mr);
+  }
+
+ private:
+  void init_keys(size_type num_columns)
+  {
+    _keys = _options.key_columns;
+    if (_keys.empty()) {
+      _keys.resize(num_columns);
+      std::iota(_keys.begin(), _keys.end(), 0);
+    }
+    CUDF_EXPECTS(std::all_of(_keys.begin(),
+                             _keys.end(),
+                             [num_columns](auto k) { return k >= 0 and k < num_columns; }),
+                 "Key column index out of range");
+    _column_order = _options.column_order;
+    if (_column_order.empty()) { _column_order.resize(_keys.size(), order::ASCENDING); }
+    CUDF_EXPECTS(_column_order.size() == _keys.size(),
+                 "Mismatch between number of key columns and column order");
+    CUDF_EXPECTS(_options.null_precedence.empty() or
+                   _options.null_precedence.size() == _keys.size(),
+                 "Mismatch between number of key columns and null precedence");
+  }
+
+  size_type pending_rows() const
+  {
+    return _pending == nullptr ? 0 : _pending->num_rows() - _pending_begin;
+  }
+
+  /**
+   * @brief Packs `block` into one device buffer, compresses it if requested
+   * and moves it to its spill location
+   */
+  spilled_block spill(table_view const& block)
+  {
+    auto packed = cudf::contiguous_split(block, {});
+    auto const base = static_cast<uint8_t const*>(packed[0].all_data->data());
+
+    spilled_block spilled;
+    std::transform(packed[0].table.begin(),
+                   packed[0].table.end(),
+                   std::back_inserter(spilled.columns),
+                   [base](auto const& col) { return describe(col, base); });
+    spilled.packed_size = packed[0].all_data->size();
+
+    for (size_t offset = 0; offset < spilled.packed_size; offset += SPILL_PAGE_SIZE) {
+      auto const size = std::min(SPILL_PAGE_SIZE, spilled.packed_size - offset);
+      spilled.pages.push_back(spilled_page{offset, size, offset, size, false});
+    }
+    spilled.stored_size = spilled.packed_size;
+
+    auto payload = make_pinned_buffer(spilled.packed_size);
+    if (_options.compression == io::compression_type::SNAPPY) {
+      compress(base, spilled, payload);
+    } else {
+      CUDA_TRY(
+        cudaMemcpyAsync(payload.get(), base, spilled.packed_size, cudaMemcpyDeviceToHost, 0));
+      CUDA_TRY(cudaStreamSynchronize(0));
+    }
+
+    if (_options.location == spill_location::HOST) {
+      spilled.host_data = std::move(payload);
+    } else {
+      spilled.file_offset = _file_size;
+      write_file(payload.get(), spilled.stored_size, _file_size);
+      _file_size += spilled.stored_size;
+    }
+    return spilled;
+  }
+
+  /**
+   * @brief Compresses the pages of a packed block with snappy into `payload`
+   *
+   * Pages that do not shrink are stored as they are.
+   */
+  void compress(uint8_t const* base, spilled_block& spilled, pinned_buffer& payload)
+  {
+    auto const num_pages = spilled.pages.size();
+    // Worst case size of snappy output
+    auto const max_page_size = 32 + SPILL_PAGE_SIZE + SPILL_PAGE_SIZE / 6;
+    rmm::device_buffer compressed(num_pages * max_page_size);
+
+    std::vector<io::gpu_inflate_input_s> inputs(num_pages);
+    for (size_t p = 0; p < num_pages; ++p) {
+      inputs[p].srcDevice = base + spilled.pages[p].packed_offset;
+      inputs[p].srcSize   = spilled.pages[p].packed_size;
+      inputs[p].dstDevice = static_cast<uint8_t*>(compressed.data()) + p * max_page_size;
+      inputs[p].dstSize   = max_page_size;
+    }
+    rmm::device_vector<io::gpu_inflate_input_s> d_inputs(inputs);
+    rmm::device_vector<io::gpu_inflate_status_s> d_statuses(num_pages);
+    CUDA_TRY(io::gpu_snap(d_inputs.data().get(), d_statuses.data().get(), num_pages, 0));
+    thrust::host_vector<io::gpu_inflate_status_s> statuses(d_statuses);
+
+    size_t stored_offset = 0;
+    for (size_t p = 0; p < num_pages; ++p) {
+      auto& page      = spilled.pages[p];
+      page.compressed = statuses[p].status == 0 and statuses[p].bytes_written < page.packed_size;
+      page.stored_offset = stored_offset;
+      page.stored_size   = page.compressed ? statuses[p].bytes_written : page.packed_size;
+      CUDA_TRY(cudaMemcpyAsync(payload.get() + stored_offset,
+                               page.compressed ? inputs[p].dstDevice : inputs[p].srcDevice,
+                               page.stored_size,
+                               cudaMemcpyDeviceToHost,
+                               0));
+      stored_offset += page.stored_size;
+    }
+    CUDA_TRY(cudaStreamSynchronize(0));
+    spilled.stored_size = stored_offset;
+  }
+
+  /**
+   * @brief Moves a spilled block back to device memory as the window of `run`
+   */
+  void load(merge_run& run)
+  {
+    auto const spilled = std::move(run.blocks.front());
+    run.blocks.pop_front();
+
+    pinned_buffer staging{nullptr, cudaFreeHost};
+    uint8_t const* payload = spilled.host_data.get();
+    if (_options.location == spill_location::DISK) {
+      staging = make_pinned_buffer(spilled.stored_size);
+      read_file(staging.get(), spilled.stored_size, spilled.file_offset);
+      payload = staging.get();
+    }
+
+    auto data = std::make_unique<rmm::device_buffer>(spilled.packed_size);
+    auto const packed = static_cast<uint8_t*>(data->data());
+    if (_options.compression == io::compression_type::SNAPPY) {
+      rmm::device_buffer stored(payload, spilled.stored_size);
+      auto const d_stored = static_cast<uint8_t const*>(stored.data());
+      std::vector<io::gpu_inflate_input_s> compressed_pages;
+      std::vector<io::gpu_inflate_input_s> raw_pages;
+      for (auto const& page : spilled.pages) {
+        io::gpu_inflate_input_s input{d_stored + page.stored_offset,
+                                      page.stored_size,
+                                      packed + page.packed_offset,
+                                      page.packed_size};
+        (page.compressed ? compressed_pages : raw_pages).push_back(input);
+      }
+      rmm::device_vector<io::gpu_inflate_input_s> d_compressed(compressed_pages);
+      rmm::device_vector<io::gpu_inflate_input_s> d_raw(raw_pages);
+      rmm::device_vector<io::gpu_inflate_status_s> d_statuses(compressed_pages.size());
+      CUDA_TRY(io::gpu_unsnap(
+        d_compressed.data().get(), d_statuses.data().get(), compressed_pages.size(), 0));
+      CUDA_TRY(io::gpu_copy_uncompressed_blocks(d_raw.data().get(), raw_pages.size(), 0));
+      thrust::host_vector<io::gpu_inflate_status_s> statuses(d_statuses);
+      CUDF_EXPECTS(std::all_of(statuses.begin(),
+                               statuses.end(),
+                               [](auto const& s) { return s.status == 0; }),
+                   "Failed to decompress a spilled block");
+    } else {
+      CUDA_TRY(cudaMemcpyAsync(packed, payload, spilled.packed_size, cudaMemcpyHostToDevice, 0));
+      CUDA_TRY(cudaStreamSynchronize(0));
+    }
+
+    std::vector<column_view> columns;
+    for (auto const& layout : spilled.columns) { columns.push_back(rebuild(layout, packed)); }
+    run.window_data  = std::move(data);
+    run.window       = table_view{columns};
+    run.window_begin = 0;
+  }
+
+  /**
+   * @brief Merges the rows of the loaded blocks that precede every row not
+   * loaded yet into `_pending`
+   *
+   * The loaded block whose last key is the smallest bounds the rows that can
+   * be merged: every row not loaded yet follows it. That block is merged
+   * entirely, so the next step loads the following block of its run.
+   *
+   * @return false once all rows have been merged
+   */
+  bool merge_step()
+  {
+    std::vector<merge_run*> active;
+    for (auto& run : _runs) {
+      if (run.window_rows() == 0 and not run.blocks.empty()) { load(run); }
+      if (run.window_rows() > 0) { active.push_back(&run); }
+    }
+    if (active.empty()) { return false; }
+
+    // The smallest of the last keys of the loaded blocks
+    std::vector<table_view> last_keys;
+    for (auto run : active) {
+      auto const rows = run->window.num_rows();
+      last_keys.push_back(cudf::slice(run->window.select(_keys), {rows - 1, rows})[0]);
+    }
+    auto const candidates = cudf::concatenate(last_keys);
+    auto const order      = detail::sorted_order(
+      candidates->view(), _column_order, _options.null_precedence);
+    size_type smallest{};
+    CUDA_TRY(cudaMemcpy(
+      &smallest, order->view().data<size_type>(), sizeof(size_type), cudaMemcpyDeviceToHost));
+    auto const bound = cudf::slice(candidates->view(), {smallest, smallest + 1})[0];
+
+    std::vector<table_view> prefixes;
+    for (auto run : active) {
+      auto const remaining = run->remaining();
+      auto const position  = detail::upper_bound(
+        remaining.select(_keys), bound, _column_order, _options.null_precedence);
+      size_type rows{};
+      CUDA_TRY(cudaMemcpy(
+        &rows, position->view().data<size_type>(), sizeof(size_type), cudaMemcpyDeviceToHost));
+      if (rows > 0) {
+        prefixes.push_back(cudf::slice(remaining, {0, rows})[0]);
+        run->window_begin += rows;
+      }
+    }
+
+    _pending       = cudf::merge(prefixes, _keys, _column_order, _options.null_precedence);
+    _pending_begin = 0;
+    return true;
+  }
+
+  void write_file(uint8_t const* data, size_t size, int64_t offset)
+  {
+    while (size > 0) {
+      auto const written = pwrite(_fd, data, size, offset);
+      CUDF_EXPECTS(written > 0, "Failed to write to the spill file");
+      data += written;
+      size -= written;
+      offset += written;
+    }
+  }
+
+  void read_file(uint8_t* data, size_t size, int64_t offset)
+  {
+    while (size > 0) {
+      auto const read = pread(_fd, data, size, offset);
+      CUDF_EXPECTS(read > 0, "Failed to read from the spill file");
+      data += read;
+      size -= read;
+      offset += read;
+    }
+  }
+
+  external_sort_options _options;
+  std::vector<data_type> _schema;
+  std::vector<size_type> _keys;
+  std::vector<order> _column_order;
+  std::vector<merge_run> _runs;
+  bool _merging{false};
+  int _fd{-1};
+  int64_t _file_size{0};
+
+  std::unique_ptr<table> _pending;
+  size_type _pending_begin{0};
+};
+
+external_sorter::external_sorter(external_sort_options const& options)
+  : _impl{std::make_unique<impl>(options)}
+{
+}
+
+external_sorter::~external_sorter() = default;
+
+void external_sorter::append(table_view const& run)
+{
+  CUDF_FUNC_RANGE();
+  _impl->append(run);
+}
+
+bool external_sorter::has_next() { return _impl->has_next(); }
+
+std::unique_ptr<table> external_sorter::next(rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->next(mr);
+}
+
+}  // namespace cudf
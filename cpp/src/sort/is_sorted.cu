@@ -15,6 +15,7 @@
  */
 
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -28,16 +29,16 @@ namespace detail {
 template <bool has_nulls>
 auto is_sorted(cudf::table_view const& in,
                std::vector<order> const& column_order,
-               std::vector<null_order> const& null_precedence)
+               std::vector<null_order> const& null_precedence,
+               cudaStream_t stream)
 {
-  cudaStream_t stream = 0;
-  auto in_d           = table_device_view::create(in);
-  rmm::device_vector<order> d_column_order(column_order);
-  rmm::device_vector<null_order> const d_null_precedence =
-    (has_nulls) ? rmm::device_vector<null_order>{null_precedence}
-                : rmm::device_vector<null_order>{};
+  auto in_d                    = table_device_view::create(in, stream);
+  auto const d_column_order    = make_device_uvector_async(column_order, stream);
+  auto const d_null_precedence = has_nulls
+                                   ? make_device_uvector_async(null_precedence, stream)
+                                   : rmm::device_uvector<null_order>(0, stream);
   auto ineq_op = row_lexicographic_comparator<has_nulls>(
-    *in_d, *in_d, d_column_order.data().get(), d_null_precedence.data().get());
+    *in_d, *in_d, d_column_order.data(), d_null_precedence.data());
 
   auto sorted = thrust::is_sorted(rmm::exec_policy(stream)->on(stream),
                                   thrust::make_counting_iterator(0),
@@ -51,7 +52,8 @@ auto is_sorted(cudf::table_view const& in,
 
 bool is_sorted(cudf::table_view const& in,
                std::vector<order> const& column_order,
-               std::vector<null_order> const& null_precedence)
+               std::vector<null_order> const& null_precedence,
+               cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
   if (in.num_columns() == 0 || in.num_rows() == 0) { return true; }
@@ -68,9 +70,9 @@ bool is_sorted(cudf::table_view const& in,
   }
 
   if (has_nulls(in)) {
-    return detail::is_sorted<true>(in, column_order, null_precedence);
+    return detail::is_sorted<true>(in, column_order, null_precedence, stream);
   } else {
-    return detail::is_sorted<false>(in, column_order, null_precedence);
+    return detail::is_sorted<false>(in, column_order, null_precedence, stream);
   }
 }
 
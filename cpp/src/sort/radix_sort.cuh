@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/transform.h>
+
+#include <cub/cub.cuh>
+
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Largest total width of the key columns sorted by radix sort passes
+ *
+ * Beyond it, the passes over every key column cost more than one comparison
+ * sort of the rows.
+ */
+constexpr std::size_t MAX_RADIX_SORT_KEY_BYTES{16};
+
+template <std::size_t size>
+struct radix_key_of_size {
+};
+template <>
+struct radix_key_of_size<1> {
+  using type = uint8_t;
+};
+template <>
+struct radix_key_of_size<2> {
+  using type = uint16_t;
+};
+template <>
+struct radix_key_of_size<4> {
+  using type = uint32_t;
+};
+template <>
+struct radix_key_of_size<8> {
+  using type = uint64_t;
+};
+
+/**
+ * @brief The unsigned integer of the same width as `T` whose order the radix
+ * key of a `T` follows
+ */
+template <typename T>
+using radix_key_t = typename radix_key_of_size<sizeof(T)>::type;
+
+template <typename T>
+constexpr inline bool is_radix_sortable()
+{
+  return cudf::is_numeric<T>() or cudf::is_chrono<T>();
+}
+
+/**
+ * @brief Maps unsigned integers and booleans to themselves
+ */
+template <typename T,
+          std::enable_if_t<std::is_integral<T>::value and not std::is_signed<T>::value>* = nullptr>
+__device__ inline radix_key_t<T> to_radix_key(T value)
+{
+  return static_cast<radix_key_t<T>>(value);
+}
+
+/**
+ * @brief Flips the sign bit of signed integers, which moves negative values
+ * below positive values
+ */
+template <typename T,
+          std::enable_if_t<std::is_integral<T>::value and std::is_signed<T>::value>* = nullptr>
+__device__ inline radix_key_t<T> to_radix_key(T value)
+{
+  using Key = radix_key_t<T>;
+  return static_cast<Key>(value) ^ (Key{1} << (8 * sizeof(Key) - 1));
+}
+
+/**
+ * @brief Flips the sign bit of positive floats and all bits of negative floats
+ *
+ * `-0.0` is mapped to `0.0` and every NaN to the same positive NaN, which
+ * orders NaN after `+Inf` and keeps equivalent values in their input order, as
+ * `row_lexicographic_comparator` does.
+ */
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+__device__ inline radix_key_t<T> to_radix_key(T value)
+{
+  using Key = radix_key_t<T>;
+  if (isnan(value)) {
+    value = std::numeric_limits<T>::quiet_NaN();
+  } else if (value == 0) {
+    value = 0;
+  }
+  Key bits;
+  std::memcpy(&bits, &value, sizeof(Key));
+  Key const sign_bit = Key{1} << (8 * sizeof(Key) - 1);
+  return (bits & sign_bit) ? static_cast<Key>(~bits) : static_cast<Key>(bits | sign_bit);
+}
+
+template <typename T, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+__device__ inline radix_key_t<T> to_radix_key(T value)
+{
+  return to_radix_key(value.time_since_epoch().count());
+}
+
+template <typename T, std::enable_if_t<cudf::is_duration<T>()>* = nullptr>
+__device__ inline radix_key_t<T> to_radix_key(T value)
+{
+  return to_radix_key(value.count());
+}
+
+/**
+ * @brief Returns the radix key of a row of `col`, with all bits inverted for
+ * a descending order
+ *
+ * Null rows have the same key so that their order is kept; they are ordered
+ * among valid rows by a separate pass over `null_radix_key`.
+ */
+template <typename T>
+struct element_radix_key {
+  column_device_view col;
+  bool descending;
+
+  __device__ radix_key_t<T> operator()(size_type row) const
+  {
+    if (col.is_null(row)) { return 0; }
+    auto const key = to_radix_key(col.element<T>(row));
+    return descending ? static_cast<radix_key_t<T>>(~key) : key;
+  }
+};
+
+/**
+ * @brief Returns `null_key` for null rows of `col` and `1 - null_key` for
+ * valid rows
+ */
+struct null_radix_key {
+  column_device_view col;
+  uint8_t null_key;
+
+  __device__ uint8_t operator()(size_type row) const
+  {
+    return col.is_null(row) ? null_key : static_cast<uint8_t>(1 - null_key);
+  }
+};
+
+/**
+ * @brief Stably sorts the row indices in `indices` by the lowest `end_bit` bits
+ * of the key of each row
+ *
+ * `indices.Current()` holds the sorted indices once this returns.
+ */
+template <typename Key, typename KeyFunctor>
+void radix_sort_pass(cub::DoubleBuffer<size_type>& indices,
+                     size_type num_rows,
+                     KeyFunctor row_key,
+                     int end_bit,
+                     cudaStream_t stream)
+{
+  rmm::device_vector<Key> keys(num_rows);
+  rmm::device_vector<Key> sorted_keys(num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    indices.Current(),
+                    indices.Current() + num_rows,
+                    keys.begin(),
+                    row_key);
+  cub::DoubleBuffer<Key> d_keys(keys.data().get(), sorted_keys.data().get());
+
+  std::size_t temp_storage_bytes{};
+  cub::DeviceRadixSort::SortPairs(
+    nullptr, temp_storage_bytes, d_keys, indices, num_rows, 0, end_bit, stream);
+  rmm::device_buffer temp_storage(temp_storage_bytes, stream);
+  cub::DeviceRadixSort::SortPairs(
+    temp_storage.data(), temp_storage_bytes, d_keys, indices, num_rows, 0, end_bit, stream);
+}
+
+struct radix_sort_column_pass {
+  template <typename T, std::enable_if_t<is_radix_sortable<T>()>* = nullptr>
+  void operator()(column_device_view const& col,
+                  bool descending,
+                  cub::DoubleBuffer<size_type>& indices,
+                  cudaStream_t stream) const
+  {
+    using Key = radix_key_t<T>;
+    radix_sort_pass<Key>(
+      indices, col.size(), element_radix_key<T>{col, descending}, 8 * sizeof(Key), stream);
+  }
+
+  template <typename T, std::enable_if_t<not is_radix_sortable<T>()>* = nullptr>
+  void operator()(column_device_view const&,
+                  bool,
+                  cub::DoubleBuffer<size_type>&,
+                  cudaStream_t) const
+  {
+    CUDF_FAIL("Radix sort requires numeric, timestamp or duration keys");
+  }
+};
+
+/**
+ * @brief Indicates if the rows of `input` can be ordered by radix sort passes
+ * over its columns
+ */
+inline bool can_radix_sort(table_view const& input)
+{
+  std::size_t key_bytes{0};
+  for (auto const& col : input) {
+    if (not(is_numeric(col.type()) or is_chrono(col.type()))) { return false; }
+    key_bytes += size_of(col.type());
+  }
+  return key_bytes <= MAX_RADIX_SORT_KEY_BYTES;
+}
+
+/**
+ * @brief Sorts the row indices in `sorted_indices` into the lexicographic order
+ * of the rows of `input` with least-significant-column-first radix sorts
+ *
+ * Every column is sorted by one stable pass over the order-preserving bits of
+ * its values, followed by a one-bit pass over its validity if it has nulls.
+ * Starting from the last column, each pass orders the rows by one more key
+ * while keeping the order of the rows its key does not distinguish, so rows
+ * that compare equal on all columns stay in their input order. The result thus
+ * matches a stable sort with `row_lexicographic_comparator`.
+ *
+ * @param sorted_indices The indices `[0, input.num_rows())` to sort
+ */
+inline void radix_sorted_order(table_view const& input,
+                               std::vector<order> const& column_order,
+                               std::vector<null_order> const& null_precedence,
+                               mutable_column_view& sorted_indices,
+                               cudaStream_t stream)
+{
+  auto const num_rows = input.num_rows();
+  rmm::device_vector<size_type> alternate_indices(num_rows);
+  cub::DoubleBuffer<size_type> indices(sorted_indices.data<size_type>(),
+                                       alternate_indices.data().get());
+
+  for (auto c = input.num_columns() - 1; c >= 0; --c) {
+    auto const col        = input.column(c);
+    auto const d_col      = column_device_view::create(col, stream);
+    bool const descending = not column_order.empty() and column_order[c] == order::DESCENDING;
+    type_dispatcher(col.type(), radix_sort_column_pass{}, *d_col, descending, indices, stream);
+
+    if (col.has_nulls()) {
+      auto const precedence = null_precedence.empty() ? null_order::BEFORE : null_precedence[c];
+      // Nulls compare less than all values for null_order::BEFORE, which puts
+      // them first in ascending order and last in descending order
+      uint8_t const null_key = (precedence == null_order::BEFORE) != descending ? 0 : 1;
+      radix_sort_pass<uint8_t>(indices, num_rows, null_radix_key{*d_col, null_key}, 1, stream);
+    }
+  }
+
+  if (indices.Current() != sorted_indices.data<size_type>()) {
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 indices.Current(),
+                 indices.Current() + num_rows,
+                 sorted_indices.begin<size_type>());
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
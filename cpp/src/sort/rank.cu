@@ -16,6 +16,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/row_operators.cuh>
@@ -25,204 +26,166 @@
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/thrust_rmm_allocator.h>
-#include <thrust/iterator/discard_iterator.h>
-#include <thrust/iterator/permutation_iterator.h>
-#include <thrust/sequence.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
 
 namespace cudf {
 namespace detail {
 namespace {
-// Functor to identify unique elements in a sorted order table/column
-template <bool has_nulls, typename ReturnType, typename Iterator>
-struct unique_comparator {
-  unique_comparator(table_device_view device_table, Iterator const sorted_order)
-    : comparator(device_table, device_table, true), permute(sorted_order)
+/**
+ * @brief Functor returning the scan input of a sorted position to compute its tie group
+ *
+ * Rows are compared with their neighbours in sorted order, so equal value groups are found without
+ * materializing a group key per row. For the `group_start` kind, returns the 1-based rank of the
+ * position if it starts a group and 0 otherwise, so that an inclusive max scan yields the min rank
+ * of the group. For the `group_end` kind, position `k` is the `k`-th from the end and the functor
+ * returns its 1-based rank if it ends a group and `size` otherwise, so that an inclusive min scan
+ * in reverse yields the max rank of the group. For the `group_count` kind, returns 1 if the
+ * position starts a group, so that an inclusive sum scan yields the dense rank.
+ */
+template <bool has_nulls>
+struct tie_group_scan_input {
+  enum class kind { group_count, group_start, group_end };
+
+  row_equality_comparator<has_nulls> comparator;
+  size_type const *sorted_order;
+  size_type size;
+  kind scan_kind;
+
+  __device__ size_type operator()(size_type k) const noexcept
   {
+    if (scan_kind == kind::group_end) {
+      auto const i      = size - 1 - k;
+      bool const is_end = i == size - 1 || not comparator(sorted_order[i], sorted_order[i + 1]);
+      return is_end ? i + 1 : size;
+    }
+    bool const is_start = k == 0 || not comparator(sorted_order[k], sorted_order[k - 1]);
+    if (scan_kind == kind::group_count) { return is_start; }
+    return is_start ? k + 1 : 0;
   }
-  __device__ ReturnType operator()(size_type index) const noexcept
-  {
-    return index == 0 || not comparator(permute[index], permute[index - 1]);
-  };
+};
 
- private:
-  row_equality_comparator<has_nulls> comparator;
-  Iterator const permute;
+/**
+ * @brief Per sorted position results of the tie group scans
+ *
+ * Only the scans needed by the rank method are computed; the others are left empty.
+ */
+struct tie_groups {
+  rmm::device_vector<size_type> dense;  ///< Dense rank of each sorted position
+  rmm::device_vector<size_type> start;  ///< Min rank of the group of each sorted position
+  rmm::device_vector<size_type> end;    ///< Max rank of the group of each sorted position
 };
 
-// Assign rank from 1 to n unique values. Equal values get same rank value.
-rmm::device_vector<size_type> sorted_dense_rank(column_view input_col,
-                                                column_view sorted_order_view,
-                                                cudaStream_t stream)
+template <bool has_nulls>
+tie_groups scan_tie_groups(table_device_view const &device_table,
+                           column_view const &sorted_order_view,
+                           rank_method method,
+                           cudaStream_t stream)
 {
-  auto device_table     = table_device_view::create(table_view{{input_col}}, stream);
-  auto const input_size = input_col.size();
-  rmm::device_vector<size_type> dense_rank_sorted(input_size);
-  auto sorted_index_order = thrust::make_permutation_iterator(
-    sorted_order_view.begin<size_type>(), thrust::make_counting_iterator<size_type>(0));
-  if (input_col.has_nulls()) {
-    auto conv = unique_comparator<true, size_type, decltype(sorted_index_order)>(
-      *device_table, sorted_index_order);
-    auto unique_it =
-      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), conv);
+  using scan_input = tie_group_scan_input<has_nulls>;
+  using kind       = typename scan_input::kind;
+  auto const size  = sorted_order_view.size();
+  auto const make_input_it = [&](kind scan_kind) {
+    return thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      scan_input{row_equality_comparator<has_nulls>(device_table, device_table, true),
+                 sorted_order_view.data<size_type>(),
+                 size,
+                 scan_kind});
+  };
 
+  tie_groups groups;
+  if (method == rank_method::DENSE) {
+    groups.dense.resize(size);
+    auto input_it = make_input_it(kind::group_count);
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream)->on(stream), input_it, input_it + size, groups.dense.begin());
+  }
+  if (method == rank_method::MIN or method == rank_method::AVERAGE) {
+    groups.start.resize(size);
+    auto input_it = make_input_it(kind::group_start);
     thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
-                           unique_it,
-                           unique_it + input_size,
-                           dense_rank_sorted.data().get());
-  } else {
-    auto conv = unique_comparator<false, size_type, decltype(sorted_index_order)>(
-      *device_table, sorted_index_order);
-    auto unique_it =
-      thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), conv);
-
+                           input_it,
+                           input_it + size,
+                           groups.start.begin(),
+                           thrust::maximum<size_type>{});
+  }
+  if (method == rank_method::MAX or method == rank_method::AVERAGE) {
+    groups.end.resize(size);
+    auto input_it = make_input_it(kind::group_end);
     thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
-                           unique_it,
-                           unique_it + input_size,
-                           dense_rank_sorted.data().get());
+                           input_it,
+                           input_it + size,
+                           thrust::make_reverse_iterator(groups.end.end()),
+                           thrust::minimum<size_type>{});
   }
-  return dense_rank_sorted;
+  return groups;
 }
 
 /**
- * @brief Breaks the ties among equal value groups using binary operator and
- * transform this tied value to final rank.
+ * @brief Functor computing the rank of a sorted position from its tie group, scaled to a
+ * percentage if requested
  *
- * @param dense_rank dense rank of sorted input column (acts as key for value
- * groups).
- * @param tie_iter  iterator of rank to break ties among equal value groups.
- * @param sorted_order_view sorted order indices of input column
- * @param rank_iter output rank iterator
- * @param tie_breaker tie breaking operator. For example, maximum & minimum.
- * @param transformer transform after tie breaking (useful for average).
- * @param stream CUDA stream used for device memory operations and kernel launches.
+ * The result is scattered to the row of the position, so the tie breaking and the percentage
+ * transform are fused into a single pass over the output.
  */
-template <typename TieType,
-          typename outputIterator,
-          typename TieBreaker,
-          typename Transformer,
-          typename TieIterator>
-void tie_break_ranks_transform(rmm::device_vector<size_type> const &dense_rank_sorted,
-                               TieIterator tie_iter,
-                               column_view const &sorted_order_view,
-                               outputIterator rank_iter,
-                               TieBreaker tie_breaker,
-                               Transformer transformer,
-                               cudaStream_t stream)
-{
-  auto const input_size = sorted_order_view.size();
-  rmm::device_vector<TieType> tie_sorted(input_size, 0);
-  // algorithm: reduce_by_key(dense_rank, 1, n, reduction_tie_breaker)
-  // reduction_tie_breaker = min, max, min_count
-  thrust::reduce_by_key(rmm::exec_policy(stream)->on(stream),
-                        dense_rank_sorted.begin(),
-                        dense_rank_sorted.end(),
-                        tie_iter,
-                        thrust::make_discard_iterator(),
-                        tie_sorted.begin(),
-                        thrust::equal_to<size_type>{},
-                        tie_breaker);
-  auto sorted_tied_rank = thrust::make_transform_iterator(
-    dense_rank_sorted.begin(),
-    [tied_rank = tie_sorted.begin(), transformer] __device__(auto dense_pos) {
-      return transformer(tied_rank[dense_pos - 1]);
-    });
-  thrust::scatter(rmm::exec_policy(stream)->on(stream),
-                  sorted_tied_rank,
-                  sorted_tied_rank + input_size,
-                  sorted_order_view.begin<size_type>(),
-                  rank_iter);
-}
+template <typename OutputType>
+struct sorted_position_rank {
+  rank_method method;
+  size_type const *dense;
+  size_type const *start;
+  size_type const *end;
+  bool percentage;
+  size_type count;  ///< Number of ranked rows, the divisor of the percentage
 
-template <typename outputType>
-void rank_first(column_view sorted_order_view,
-                mutable_column_view rank_mutable_view,
-                cudaStream_t stream)
-{
-  // stable sort order ranking (no ties)
-  thrust::scatter(rmm::exec_policy(stream)->on(stream),
-                  thrust::make_counting_iterator<size_type>(1),
-                  thrust::make_counting_iterator<size_type>(rank_mutable_view.size() + 1),
-                  sorted_order_view.begin<size_type>(),
-                  rank_mutable_view.begin<outputType>());
-}
+  __device__ OutputType operator()(size_type i) const noexcept
+  {
+    switch (method) {
+      case rank_method::FIRST: return finalize(i + 1);
+      case rank_method::DENSE: return finalize(dense[i]);
+      case rank_method::MIN: return finalize(start[i]);
+      case rank_method::MAX: return finalize(end[i]);
+      default: return finalize((start[i] + end[i]) / 2.0);
+    }
+  }
+
+ private:
+  template <typename T>
+  __device__ OutputType finalize(T rank) const noexcept
+  {
+    if (not percentage or count == 0) { return static_cast<OutputType>(rank); }
+    // The dense ranks are scaled by the number of groups rather than the number of rows
+    double const divisor = (method == rank_method::DENSE) ? dense[count - 1] : count;
+    return static_cast<OutputType>(rank / divisor);
+  }
+};
 
-template <typename outputType>
-void rank_dense(rmm::device_vector<size_type> const &dense_rank_sorted,
-                column_view sorted_order_view,
-                mutable_column_view rank_mutable_view,
-                cudaStream_t stream)
+template <typename OutputType>
+void scatter_ranks(tie_groups const &groups,
+                   column_view const &sorted_order_view,
+                   mutable_column_view rank_mutable_view,
+                   rank_method method,
+                   bool percentage,
+                   size_type count,
+                   cudaStream_t stream)
 {
-  // All equal values have same rank and rank always increases by 1 between groups
+  auto rank_it = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    sorted_position_rank<OutputType>{method,
+                                     groups.dense.data().get(),
+                                     groups.start.data().get(),
+                                     groups.end.data().get(),
+                                     percentage,
+                                     count});
   thrust::scatter(rmm::exec_policy(stream)->on(stream),
-                  dense_rank_sorted.begin(),
-                  dense_rank_sorted.end(),
+                  rank_it,
+                  rank_it + sorted_order_view.size(),
                   sorted_order_view.begin<size_type>(),
-                  rank_mutable_view.begin<outputType>());
-}
-
-template <typename outputType>
-void rank_min(rmm::device_vector<size_type> const &group_keys,
-              column_view sorted_order_view,
-              mutable_column_view rank_mutable_view,
-              cudaStream_t stream)
-{
-  // min of first in the group
-  // All equal values have min of ranks among them.
-  // algorithm: reduce_by_key(dense_rank, 1, n, min), scatter
-  tie_break_ranks_transform<size_type>(group_keys,
-                                       thrust::make_counting_iterator<size_type>(1),
-                                       sorted_order_view,
-                                       rank_mutable_view.begin<outputType>(),
-                                       thrust::minimum<size_type>{},
-                                       thrust::identity<outputType>{},
-                                       stream);
-}
-
-template <typename outputType>
-void rank_max(rmm::device_vector<size_type> const &group_keys,
-              column_view sorted_order_view,
-              mutable_column_view rank_mutable_view,
-              cudaStream_t stream)
-{
-  // max of first in the group
-  // All equal values have max of ranks among them.
-  // algorithm: reduce_by_key(dense_rank, 1, n, max), scatter
-  tie_break_ranks_transform<size_type>(group_keys,
-                                       thrust::make_counting_iterator<size_type>(1),
-                                       sorted_order_view,
-                                       rank_mutable_view.begin<outputType>(),
-                                       thrust::maximum<size_type>{},
-                                       thrust::identity<outputType>{},
-                                       stream);
-}
-
-void rank_average(rmm::device_vector<size_type> const &group_keys,
-                  column_view sorted_order_view,
-                  mutable_column_view rank_mutable_view,
-                  cudaStream_t stream)
-{
-  // k, k+1, .. k+n-1
-  // average = (n*k+ n*(n-1)/2)/n
-  // average = k + (n-1)/2 = min + (count-1)/2
-  // Calculate Min of ranks and Count of equal values
-  // algorithm: reduce_by_key(dense_rank, 1, n, min_count)
-  //            transform(min+(count-1)/2), scatter
-  using MinCount = thrust::tuple<size_type, size_type>;
-  tie_break_ranks_transform<MinCount>(
-    group_keys,
-    thrust::make_zip_iterator(thrust::make_tuple(thrust::make_counting_iterator<size_type>(1),
-                                                 thrust::make_constant_iterator<size_type>(1))),
-    sorted_order_view,
-    rank_mutable_view.begin<double>(),
-    [] __device__(auto rank_count1, auto rank_count2) {
-      return MinCount{std::min(thrust::get<0>(rank_count1), thrust::get<0>(rank_count2)),
-                      thrust::get<1>(rank_count1) + thrust::get<1>(rank_count2)};
-    },
-    [] __device__(MinCount minrank_count) {  // min+(count-1)/2
-      return static_cast<double>(thrust::get<0>(minrank_count)) +
-             (static_cast<double>(thrust::get<1>(minrank_count)) - 1) / 2.0;
-    },
-    stream);
+                  rank_mutable_view.begin<OutputType>());
 }
 
 }  // anonymous namespace
@@ -248,6 +211,7 @@ std::unique_ptr<column> rank(column_view const &input,
       return make_numeric_column(output_type, input.size(), mask_state::UNALLOCATED, stream, mr);
   }();
   auto rank_mutable_view = rank_column->mutable_view();
+  if (input.size() == 0) { return rank_column; }
 
   std::unique_ptr<column> sorted_order =
     (method == rank_method::FIRST)
@@ -256,70 +220,24 @@ std::unique_ptr<column> rank(column_view const &input,
       : detail::sorted_order(table_view{{input}}, {column_order}, {null_precedence}, mr, stream);
   column_view sorted_order_view = sorted_order->view();
 
-  // dense: All equal values have same rank and rank always increases by 1 between groups
-  // acts as key for min, max, average to denote equal value groups
-  rmm::device_vector<size_type> const dense_rank_sorted =
-    [&method, &input, &sorted_order_view, &stream] {
-      if (method != rank_method::FIRST)
-        return sorted_dense_rank(input, sorted_order_view, stream);
-      else
-        return rmm::device_vector<size_type>();
-    }();
+  // Equal value groups are found from the sorted order in one scan per needed bound; FIRST has
+  // no ties since the sort is stable
+  auto device_table = table_device_view::create(table_view{{input}}, stream);
+  tie_groups const groups =
+    (method == rank_method::FIRST)
+      ? tie_groups{}
+      : input.has_nulls()
+          ? scan_tie_groups<true>(*device_table, sorted_order_view, method, stream)
+          : scan_tie_groups<false>(*device_table, sorted_order_view, method, stream);
 
+  size_type const count =
+    (null_handling == null_policy::EXCLUDE) ? input.size() - input.null_count() : input.size();
   if (output_type.id() == type_id::FLOAT64) {
-    switch (method) {
-      case rank_method::FIRST:
-        rank_first<double>(sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::DENSE:
-        rank_dense<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::MIN:
-        rank_min<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::MAX:
-        rank_max<double>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::AVERAGE:
-        rank_average(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      default: CUDF_FAIL("Unexpected rank_method for rank()");
-    }
+    scatter_ranks<double>(
+      groups, sorted_order_view, rank_mutable_view, method, percentage, count, stream);
   } else {
-    switch (method) {
-      case rank_method::FIRST:
-        rank_first<size_type>(sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::DENSE:
-        rank_dense<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::MIN:
-        rank_min<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::MAX:
-        rank_max<size_type>(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      case rank_method::AVERAGE:
-        rank_average(dense_rank_sorted, sorted_order_view, rank_mutable_view, stream);
-        break;
-      default: CUDF_FAIL("Unexpected rank_method for rank()");
-    }
-  }
-
-  // pct inplace transform
-  if (percentage) {
-    auto rank_iter = rank_mutable_view.begin<double>();
-    size_type const count =
-      (null_handling == null_policy::EXCLUDE) ? input.size() - input.null_count() : input.size();
-    auto drs            = dense_rank_sorted.data().get();
-    bool const is_dense = (method == rank_method::DENSE);
-    thrust::transform(rmm::exec_policy(stream)->on(stream),
-                      rank_iter,
-                      rank_iter + input.size(),
-                      rank_iter,
-                      [is_dense, drs, count] __device__(double r) -> double {
-                        return is_dense ? r / drs[count - 1] : r / count;
-                      });
+    scatter_ranks<size_type>(
+      groups, sorted_order_view, rank_mutable_view, method, percentage, count, stream);
   }
   return rank_column;
 }
@@ -331,8 +249,11 @@ std::unique_ptr<column> rank(column_view const &input,
                              null_policy null_handling,
                              null_order null_precedence,
                              bool percentage,
-                             rmm::mr::device_memory_resource *mr)
+                             rmm::mr::device_memory_resource *mr,
+                             cudaStream_t stream)
 {
-  return detail::rank(input, method, column_order, null_handling, null_precedence, percentage, mr);
+  CUDF_FUNC_RANGE();
+  return detail::rank(
+    input, method, column_order, null_handling, null_precedence, percentage, mr, stream);
 }
 }  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/memory_estimate.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -53,34 +54,53 @@ std::unique_ptr<table> sort_by_key(table_view const& values,
                         stream);
 }
 
+memory_estimate estimate_sort_memory(table_view const& values, table_view const& keys)
+{
+  CUDF_EXPECTS(values.num_rows() == keys.num_rows(),
+               "Mismatch in number of rows for values and keys");
+  memory_estimate estimate;
+  estimate.output_bytes  = estimate_gather_bytes(values, values.num_rows());
+  estimate.scratch_bytes = keys.num_rows() * sizeof(size_type) + sorted_order_scratch_bytes(keys);
+  return estimate;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> sorted_order(table_view input,
                                      std::vector<order> const& column_order,
                                      std::vector<null_order> const& null_precedence,
-                                     rmm::mr::device_memory_resource* mr)
+                                     rmm::mr::device_memory_resource* mr,
+                                     cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::sorted_order(input, column_order, null_precedence, mr);
+  return detail::sorted_order(input, column_order, null_precedence, mr, stream);
 }
 
 std::unique_ptr<table> sort(table_view input,
                             std::vector<order> const& column_order,
                             std::vector<null_order> const& null_precedence,
-                            rmm::mr::device_memory_resource* mr)
+                            rmm::mr::device_memory_resource* mr,
+                            cudaStream_t stream)
 {
   CUDF_FUNC_RANGE();
-  return detail::sort_by_key(input, input, column_order, null_precedence, mr);
+  return detail::sort_by_key(input, input, column_order, null_precedence, mr, stream);
 }
 
 std::unique_ptr<table> sort_by_key(table_view const& values,
                                    table_view const& keys,
                                    std::vector<order> const& column_order,
                                    std::vector<null_order> const& null_precedence,
-                                   rmm::mr::device_memory_resource* mr)
+                                   rmm::mr::device_memory_resource* mr,
+                                   cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_by_key(values, keys, column_order, null_precedence, mr, stream);
+}
+
+memory_estimate estimate_sort_memory(table_view const& values, table_view const& keys)
 {
   CUDF_FUNC_RANGE();
-  return detail::sort_by_key(values, keys, column_order, null_precedence, mr);
+  return detail::estimate_sort_memory(values, keys);
 }
 
 }  // namespace cudf
@@ -16,8 +16,14 @@
 
 #pragma once
 
+#include "radix_sort.cuh"
+#include "string_prefix_sort.cuh"
+
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/indices.hpp>
+#include <cudf/structs/detail/flatten.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
@@ -25,6 +31,8 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <thrust/sequence.h>
 
+#include <algorithm>
+
 namespace cudf {
 namespace detail {
 // Create permuted row indices that would materialize sorted order
@@ -49,24 +57,56 @@ std::unique_ptr<column> sorted_order(table_view input,
                  "Mismatch between number of columns and null_precedence size.");
   }
 
+  // The rows of a struct column sort like the rows of its fields
+  if (std::any_of(input.begin(), input.end(), [](auto const& col) {
+        return col.type().id() == type_id::STRUCT;
+      })) {
+    auto const flattened =
+      structs::detail::flatten_nested_columns(input, column_order, null_precedence, stream);
+    return sorted_order<stable>(
+      flattened.columns, flattened.column_order, flattened.null_precedence, mr, stream);
+  }
+
+  // The keys of a dictionary are sorted, so its rows sort like its indices, which
+  // are also eligible for the radix sort
+  input = dictionary::detail::get_indices_annotated(input);
+
   std::unique_ptr<column> sorted_indices = cudf::make_numeric_column(
     data_type(type_to_id<size_type>()), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
 
   mutable_column_view mutable_indices_view = sorted_indices->mutable_view();
 
-  auto device_table = table_device_view::create(input, stream);
-
   thrust::sequence(rmm::exec_policy(stream)->on(stream),
                    mutable_indices_view.begin<size_type>(),
                    mutable_indices_view.end<size_type>(),
                    0);
 
-  rmm::device_vector<order> d_column_order(column_order);
+  // Radix sorts are stable, so they serve both stable and unstable sorts
+  if (can_radix_sort(input)) {
+    radix_sorted_order(input, column_order, null_precedence, mutable_indices_view, stream);
+    return sorted_indices;
+  }
+
+  // A strings column is radix sorted by the prefixes of its strings, comparing strings only to
+  // order the rows with equal prefixes
+  if (input.num_columns() == 1 and input.column(0).type().id() == type_id::STRING) {
+    auto const precedence = null_precedence.empty() ? null_order::BEFORE : null_precedence.front();
+    string_prefix_sorted_order(input.column(0),
+                               column_order.empty() ? order::ASCENDING : column_order.front(),
+                               precedence,
+                               mutable_indices_view,
+                               stream);
+    return sorted_indices;
+  }
+
+  auto device_table = table_device_view::create(input, stream);
+
+  auto const d_column_order = make_device_uvector_async(column_order, stream);
 
   if (has_nulls(input)) {
-    rmm::device_vector<null_order> d_null_precedence(null_precedence);
-    auto comparator = row_lexicographic_comparator<true>(
-      *device_table, *device_table, d_column_order.data().get(), d_null_precedence.data().get());
+    auto const d_null_precedence = make_device_uvector_async(null_precedence, stream);
+    auto comparator              = row_lexicographic_comparator<true>(
+      *device_table, *device_table, d_column_order.data(), d_null_precedence.data());
     if (stable) {
       thrust::stable_sort(rmm::exec_policy(stream)->on(stream),
                           mutable_indices_view.begin<size_type>(),
@@ -80,7 +120,7 @@ std::unique_ptr<column> sorted_order(table_view input,
     }
   } else {
     auto comparator = row_lexicographic_comparator<false>(
-      *device_table, *device_table, d_column_order.data().get());
+      *device_table, *device_table, d_column_order.data());
     if (stable) {
       thrust::stable_sort(rmm::exec_policy(stream)->on(stream),
                           mutable_indices_view.begin<size_type>(),
@@ -97,5 +137,28 @@ std::unique_ptr<column> sorted_order(table_view input,
   return sorted_indices;
 }
 
+/**
+ * @brief Returns the peak bytes of the temporaries of `sorted_order(input)`, the returned
+ * indices excluded
+ */
+inline std::size_t sorted_order_scratch_bytes(table_view input)
+{
+  auto const num_rows = static_cast<std::size_t>(input.num_rows());
+  if (num_rows == 0 or input.num_columns() == 0) { return 0; }
+  input = dictionary::detail::get_indices_annotated(input);
+
+  // Every radix pass sorts a copy of its keys, alternating the indices with a second buffer
+  if (can_radix_sort(input)) {
+    std::size_t key_bytes{sizeof(uint8_t)};
+    for (auto const& col : input) { key_bytes = std::max(key_bytes, size_of(col.type())); }
+    return num_rows * (sizeof(size_type) + 2 * key_bytes);
+  }
+  if (input.num_columns() == 1 and input.column(0).type().id() == type_id::STRING) {
+    return num_rows * (sizeof(size_type) + 2 * sizeof(uint64_t));
+  }
+  // The merge sort of the comparison sort keeps a second buffer of indices
+  return num_rows * sizeof(size_type);
+}
+
 }  // namespace detail
 }  // namespace cudf
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "radix_sort.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/types.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <cub/cub.cuh>
+
+namespace cudf {
+namespace detail {
+/**
+ * @brief Returns the first 8 bytes of a string as a big-endian integer, padded with zeros
+ *
+ * The prefixes of two strings order them like the strings themselves, unless the prefixes are
+ * equal: strings sharing their first 8 bytes, or shorter strings differing only by trailing zero
+ * bytes, such as `"a"` and `"a\0"`, have the same prefix.
+ */
+__device__ inline uint64_t string_prefix(string_view const& str)
+{
+  auto const data = reinterpret_cast<uint8_t const*>(str.data());
+  auto const size = str.size_bytes() < 8 ? str.size_bytes() : 8;
+  uint64_t prefix = 0;
+  for (size_type i = 0; i < size; ++i) { prefix |= uint64_t{data[i]} << (8 * (7 - i)); }
+  return prefix;
+}
+
+/**
+ * @brief Returns the prefix of a row of a strings column, with all bits inverted for a
+ * descending order
+ */
+struct string_prefix_radix_key {
+  column_device_view col;
+  bool descending;
+
+  __device__ uint64_t operator()(size_type row) const
+  {
+    if (col.is_null(row)) { return 0; }
+    auto const key = string_prefix(col.element<string_view>(row));
+    return descending ? ~key : key;
+  }
+};
+
+/**
+ * @brief Indicates if the row at a position of the prefix-sorted rows has a different prefix or
+ * validity than the row before it
+ */
+struct prefix_segment_start {
+  column_device_view col;
+  size_type const* sorted_rows;
+
+  __device__ size_type operator()(size_type pos) const
+  {
+    if (pos == 0) { return 1; }
+    auto const lhs       = sorted_rows[pos - 1];
+    auto const rhs       = sorted_rows[pos];
+    bool const lhs_valid = col.is_valid(lhs);
+    if (lhs_valid != col.is_valid(rhs)) { return 1; }
+    if (not lhs_valid) { return 0; }
+    return string_prefix(col.element<string_view>(lhs)) !=
+           string_prefix(col.element<string_view>(rhs));
+  }
+};
+
+/**
+ * @brief Indicates if a position of the prefix-sorted rows is in a segment of two or more rows
+ */
+struct is_tied_position {
+  size_type const* segment_ids;
+  size_type num_rows;
+
+  __device__ bool operator()(size_type pos) const
+  {
+    return (pos > 0 and segment_ids[pos - 1] == segment_ids[pos]) or
+           (pos + 1 < num_rows and segment_ids[pos + 1] == segment_ids[pos]);
+  }
+};
+
+/**
+ * @brief Orders the tied rows by their segment, then by their full strings
+ *
+ * The rows of a segment are either all null, and equivalent, or all valid with the same prefix.
+ */
+struct tied_rows_comparator {
+  column_device_view col;
+  size_type const* rows;
+  size_type const* segment_ids;
+  bool descending;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    if (segment_ids[lhs] != segment_ids[rhs]) { return segment_ids[lhs] < segment_ids[rhs]; }
+    if (col.is_null(rows[lhs])) { return false; }
+    auto const cmp =
+      col.element<string_view>(rows[lhs]).compare(col.element<string_view>(rows[rhs]));
+    return descending ? cmp > 0 : cmp < 0;
+  }
+};
+
+/**
+ * @brief Sorts the row indices in `sorted_indices` into the stable order of the rows of a strings
+ * column, with a radix sort of the 8-byte prefixes of the strings
+ *
+ * Comparing two strings chases two pointers into the chars, so a comparison sort of strings is
+ * much slower than a sort of integers. Here the rows are instead radix sorted by their prefixes,
+ * which orders all rows whose prefixes differ. Only the rows in runs of equal prefixes are then
+ * ordered by comparing their strings, with a sort that keeps the runs in place.
+ *
+ * @param sorted_indices The indices `[0, input.size())` to sort
+ */
+inline void string_prefix_sorted_order(column_view const& input,
+                                       order column_order,
+                                       null_order null_precedence,
+                                       mutable_column_view& sorted_indices,
+                                       cudaStream_t stream)
+{
+  auto const num_rows   = input.size();
+  auto const d_col      = column_device_view::create(input, stream);
+  bool const descending = column_order == order::DESCENDING;
+  rmm::device_vector<size_type> alternate_indices(num_rows);
+  cub::DoubleBuffer<size_type> indices(sorted_indices.data<size_type>(),
+                                       alternate_indices.data().get());
+
+  radix_sort_pass<uint64_t>(
+    indices, num_rows, string_prefix_radix_key{*d_col, descending}, 64, stream);
+  if (input.has_nulls()) {
+    uint8_t const null_key = (null_precedence == null_order::BEFORE) != descending ? 0 : 1;
+    radix_sort_pass<uint8_t>(indices, num_rows, null_radix_key{*d_col, null_key}, 1, stream);
+  }
+  if (indices.Current() != sorted_indices.data<size_type>()) {
+    thrust::copy(rmm::exec_policy(stream)->on(stream),
+                 indices.Current(),
+                 indices.Current() + num_rows,
+                 sorted_indices.begin<size_type>());
+  }
+  auto const d_sorted = sorted_indices.data<size_type>();
+
+  // Number the runs of rows with equal prefixes and find the rows sharing their run
+  rmm::device_vector<size_type> segment_ids(num_rows);
+  auto const segment_starts = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), prefix_segment_start{*d_col, d_sorted});
+  thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         segment_starts,
+                         segment_starts + num_rows,
+                         segment_ids.begin());
+  rmm::device_vector<size_type> tied_positions(num_rows);
+  auto const tied_end =
+    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    tied_positions.begin(),
+                    is_tied_position{segment_ids.data().get(), num_rows});
+  auto const num_tied = static_cast<size_type>(thrust::distance(tied_positions.begin(), tied_end));
+  if (num_tied == 0) { return; }
+
+  // Sort the tied rows by full comparisons; the runs are contiguous in position order, so sorting
+  // by run first keeps every run at its positions
+  rmm::device_vector<size_type> tied_rows(num_tied);
+  rmm::device_vector<size_type> tied_segment_ids(num_tied);
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 tied_positions.begin(),
+                 tied_end,
+                 d_sorted,
+                 tied_rows.begin());
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 tied_positions.begin(),
+                 tied_end,
+                 segment_ids.begin(),
+                 tied_segment_ids.begin());
+  rmm::device_vector<size_type> tied_order(num_tied);
+  thrust::sequence(rmm::exec_policy(stream)->on(stream), tied_order.begin(), tied_order.end());
+  thrust::stable_sort(rmm::exec_policy(stream)->on(stream),
+                      tied_order.begin(),
+                      tied_order.end(),
+                      tied_rows_comparator{*d_col,
+                                           tied_rows.data().get(),
+                                           tied_segment_ids.data().get(),
+                                           descending});
+  thrust::scatter(rmm::exec_policy(stream)->on(stream),
+                  thrust::make_permutation_iterator(tied_rows.begin(), tied_order.begin()),
+                  thrust::make_permutation_iterator(tied_rows.begin(), tied_order.end()),
+                  tied_positions.begin(),
+                  d_sorted);
+}
+
+}  // namespace detail
+}  // namespace cudf
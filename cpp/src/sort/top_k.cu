@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "radix_sort.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/gather.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sequence.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+constexpr int RADIX_SELECT_BITS{8};
+constexpr size_type RADIX_SELECT_BUCKETS{1 << RADIX_SELECT_BITS};
+constexpr size_type RADIX_SELECT_BLOCK_SIZE{256};
+
+/**
+ * @brief Counts the keys whose bits above `shift` match `prefix` in each
+ * bucket of their next `RADIX_SELECT_BITS` bits
+ */
+template <typename Key>
+__global__ void radix_select_histogram(Key const* keys,
+                                       size_type num_keys,
+                                       Key prefix,
+                                       Key prefix_mask,
+                                       int shift,
+                                       size_type* bucket_counts)
+{
+  __shared__ size_type block_counts[RADIX_SELECT_BUCKETS];
+  for (size_type b = threadIdx.x; b < RADIX_SELECT_BUCKETS; b += blockDim.x) {
+    block_counts[b] = 0;
+  }
+  __syncthreads();
+
+  for (size_type i = threadIdx.x + blockIdx.x * blockDim.x; i < num_keys;
+       i += blockDim.x * gridDim.x) {
+    auto const key = keys[i];
+    if ((key & prefix_mask) == prefix) {
+      atomicAdd(&block_counts[(key >> shift) & (RADIX_SELECT_BUCKETS - 1)], 1);
+    }
+  }
+  __syncthreads();
+
+  for (size_type b = threadIdx.x; b < RADIX_SELECT_BUCKETS; b += blockDim.x) {
+    if (block_counts[b] != 0) { atomicAdd(&bucket_counts[b], block_counts[b]); }
+  }
+}
+
+/**
+ * @brief Returns the key of rank `rank` in ascending order of `keys`
+ *
+ * Each pass narrows the bits of the selected key by `RADIX_SELECT_BITS`, from
+ * the most significant bits down, by counting the keys of the current prefix
+ * in each bucket of their next bits.
+ */
+template <typename Key>
+Key radix_select(rmm::device_vector<Key> const& keys, size_type rank, cudaStream_t stream)
+{
+  auto const num_keys = static_cast<size_type>(keys.size());
+  cudf::detail::grid_1d grid{num_keys, RADIX_SELECT_BLOCK_SIZE};
+  rmm::device_vector<size_type> bucket_counts(RADIX_SELECT_BUCKETS);
+
+  Key prefix{0};
+  Key prefix_mask{0};
+  for (int shift = 8 * sizeof(Key) - RADIX_SELECT_BITS; shift >= 0; shift -= RADIX_SELECT_BITS) {
+    thrust::fill(
+      rmm::exec_policy(stream)->on(stream), bucket_counts.begin(), bucket_counts.end(), 0);
+    radix_select_histogram<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+      keys.data().get(), num_keys, prefix, prefix_mask, shift, bucket_counts.data().get());
+    CHECK_CUDA(stream);
+    thrust::host_vector<size_type> counts(bucket_counts);
+
+    size_type bucket{0};
+    while (rank >= counts[bucket]) { rank -= counts[bucket++]; }
+    prefix |= static_cast<Key>(static_cast<Key>(bucket) << shift);
+    prefix_mask |= static_cast<Key>(static_cast<Key>(RADIX_SELECT_BUCKETS - 1) << shift);
+  }
+  return prefix;
+}
+
+struct is_valid_row {
+  column_device_view col;
+
+  __device__ bool operator()(size_type row) const { return col.is_valid(row); }
+};
+
+struct is_null_row {
+  column_device_view col;
+
+  __device__ bool operator()(size_type row) const { return col.is_null(row); }
+};
+
+/**
+ * @brief Indicates if a row may be among the first rows in sorted order: a
+ * null row if nulls come first, or a valid row whose key does not follow the
+ * key of rank `k - 1`
+ */
+template <typename T>
+struct is_top_k_candidate {
+  element_radix_key<T> row_key;
+  radix_key_t<T> threshold;
+  bool nulls_first;
+
+  __device__ bool operator()(size_type row) const
+  {
+    return row_key.col.is_null(row) ? nulls_first : row_key(row) <= threshold;
+  }
+};
+
+/**
+ * @brief Returns the rows that may be among the first `k` rows in sorted order
+ * according to the values of a radix sortable column only
+ *
+ * These are all rows up to the `k`-th key of the column, including all rows
+ * equal to it, whose order is decided by the remaining key columns.
+ */
+struct top_k_candidates_fn {
+  template <typename T, std::enable_if_t<is_radix_sortable<T>()>* = nullptr>
+  rmm::device_vector<size_type> operator()(
+    column_view const& col, size_type k, bool descending, bool nulls_first, cudaStream_t stream)
+  {
+    auto const d_col      = column_device_view::create(col, stream);
+    auto const num_rows   = col.size();
+    auto const null_count = col.null_count();
+    auto const rows       = thrust::make_counting_iterator<size_type>(0);
+
+    auto const candidates = [&](auto predicate) {
+      rmm::device_vector<size_type> result(num_rows);
+      auto const end = thrust::copy_if(
+        rmm::exec_policy(stream)->on(stream), rows, rows + num_rows, result.begin(), predicate);
+      result.resize(thrust::distance(result.begin(), end));
+      return result;
+    };
+
+    if (nulls_first and null_count >= k) { return candidates(is_null_row{*d_col}); }
+    auto const rank = nulls_first ? k - null_count - 1 : k - 1;
+    if (rank >= num_rows - null_count) {
+      rmm::device_vector<size_type> result(num_rows);
+      thrust::sequence(rmm::exec_policy(stream)->on(stream), result.begin(), result.end());
+      return result;
+    }
+
+    using Key = radix_key_t<T>;
+    element_radix_key<T> const row_key{*d_col, descending};
+    rmm::device_vector<Key> keys(num_rows - null_count);
+    thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_transform_iterator(rows, row_key),
+                    thrust::make_transform_iterator(rows + num_rows, row_key),
+                    rows,
+                    keys.begin(),
+                    is_valid_row{*d_col});
+    auto const threshold = radix_select(keys, rank, stream);
+    return candidates(is_top_k_candidate<T>{row_key, threshold, nulls_first});
+  }
+
+  template <typename T, std::enable_if_t<not is_radix_sortable<T>()>* = nullptr>
+  rmm::device_vector<size_type> operator()(
+    column_view const&, size_type, bool, bool, cudaStream_t)
+  {
+    CUDF_FAIL("Radix select requires numeric, timestamp or duration keys");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> top_k(table_view const& keys,
+                              size_type k,
+                              std::vector<order> const& column_order,
+                              std::vector<null_order> const& null_precedence,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
+{
+  CUDF_EXPECTS(k >= 0, "k must be non-negative");
+  CUDF_EXPECTS(column_order.empty() or column_order.size() == size_t(keys.num_columns()),
+               "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or null_precedence.size() == size_t(keys.num_columns()),
+               "Mismatch between number of columns and null_precedence size.");
+
+  k = std::min(k, keys.num_rows());
+  if (k == 0) { return make_empty_column(data_type{type_to_id<size_type>()}); }
+
+  // Without a radix sortable leading key, the first rows are taken from a full sort
+  auto const first = keys.column(0);
+  if (k == keys.num_rows() or not(is_numeric(first.type()) or is_chrono(first.type()))) {
+    auto const sorted = detail::stable_sorted_order(
+      keys, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+    return std::make_unique<column>(cudf::slice(sorted->view(), {0, k})[0], stream, mr);
+  }
+
+  bool const descending = not column_order.empty() and column_order[0] == order::DESCENDING;
+  auto const precedence = null_precedence.empty() ? null_order::BEFORE : null_precedence[0];
+  bool const nulls_first = (precedence == null_order::BEFORE) != descending;
+  auto const candidates  = type_dispatcher(
+    first.type(), top_k_candidates_fn{}, first, k, descending, nulls_first, stream);
+
+  // Rows equal on the leading key are ordered by a sort of the candidates only
+  column_view const candidate_map(
+    data_type{type_to_id<size_type>()}, candidates.size(), candidates.data().get());
+  auto const candidate_keys = detail::gather(keys,
+                                             candidate_map,
+                                             detail::out_of_bounds_policy::NULLIFY,
+                                             detail::negative_index_policy::NOT_ALLOWED,
+                                             rmm::mr::get_default_resource(),
+                                             stream);
+  auto const candidate_order = detail::stable_sorted_order(
+    candidate_keys->view(), column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+
+  auto result = make_numeric_column(
+    data_type{type_to_id<size_type>()}, k, mask_state::UNALLOCATED, stream, mr);
+  thrust::gather(rmm::exec_policy(stream)->on(stream),
+                 candidate_order->view().begin<size_type>(),
+                 candidate_order->view().begin<size_type>() + k,
+                 candidates.begin(),
+                 result->mutable_view().begin<size_type>());
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> top_k(table_view const& keys,
+                              size_type k,
+                              std::vector<order> const& column_order,
+                              std::vector<null_order> const& null_precedence,
+                              rmm::mr::device_memory_resource* mr,
+                              cudaStream_t stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k(keys, k, column_order, null_precedence, mr, stream);
+}
+
+}  // namespace cudf
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <hash/concurrent_unordered_map.cuh>
+#include <hash/helper_functions.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <limits>
+
+namespace cudf {
+namespace detail {
+template <bool has_nulls>
+using distinct_rows_map =
+  concurrent_unordered_map<size_type,
+                           size_type,
+                           precomputed_row_hasher<MurmurHash3_32, has_nulls>,
+                           row_equality_comparator<has_nulls>>;
+
+/**
+ * @brief Returns a hash set of the rows of `d_keys`, keyed by row index
+ *
+ * Among equal rows the set keeps the first index inserted, the representative of the rows. The
+ * rows are hashed unless their precomputed `key_hashes` are given.
+ */
+template <bool has_nulls>
+auto create_distinct_rows_set(table_device_view const& d_keys,
+                              column_view const& key_hashes,
+                              null_equality nulls_equal,
+                              cudaStream_t stream)
+{
+  using map_type = distinct_rows_map<has_nulls>;
+  precomputed_row_hasher<MurmurHash3_32, has_nulls> hasher{d_keys, key_hashes};
+  row_equality_comparator<has_nulls> rows_equal{
+    d_keys, d_keys, nulls_equal == null_equality::EQUAL};
+  auto set = map_type::create(compute_hash_table_size(d_keys.num_rows()),
+                              std::numeric_limits<size_type>::max(),
+                              std::numeric_limits<size_type>::max(),
+                              hasher,
+                              rows_equal,
+                              typename map_type::allocator_type(),
+                              stream);
+  auto d_set = *set;
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     d_keys.num_rows(),
+                     [d_set] __device__(size_type i) mutable {
+                       d_set.insert(thrust::make_pair(i, i));
+                     });
+  return set;
+}
+
+/**
+ * @brief Predicate selecting the representative rows of a set from `create_distinct_rows_set()`
+ */
+template <bool has_nulls>
+struct is_representative_row {
+  distinct_rows_map<has_nulls> set;
+
+  __device__ bool operator()(size_type i) const { return set.find(i)->first == i; }
+};
+
+}  // namespace detail
+}  // namespace cudf
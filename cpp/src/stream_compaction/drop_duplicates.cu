@@ -22,12 +22,16 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/dictionary/detail/indices.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
+#include <hash/concurrent_unordered_map.cuh>
+#include <stream_compaction/distinct_rows.cuh>
 
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
@@ -145,39 +149,61 @@ column_view get_unique_ordered_indices(cudf::table_view const& keys,
   }
 }
 
+namespace {
+/**
+ * @brief Copies the index of one row of each set of equal rows of `keys` to `distinct_indices`,
+ * in increasing order
+ *
+ * @return The slice of `distinct_indices` holding the indices
+ */
+template <bool has_nulls>
+column_view get_distinct_indices(table_view const& keys,
+                                 column_view const& key_hashes,
+                                 mutable_column_view& distinct_indices,
+                                 null_equality nulls_equal,
+                                 cudaStream_t stream)
+{
+  auto d_keys = table_device_view::create(keys, stream);
+  auto set    = create_distinct_rows_set<has_nulls>(*d_keys, key_hashes, nulls_equal, stream);
+
+  auto result_end = thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                                    thrust::make_counting_iterator<size_type>(0),
+                                    thrust::make_counting_iterator<size_type>(keys.num_rows()),
+                                    distinct_indices.begin<size_type>(),
+                                    is_representative_row<has_nulls>{*set});
+  return cudf::detail::slice(
+    column_view(distinct_indices),
+    0,
+    thrust::distance(distinct_indices.begin<size_type>(), result_end));
+}
+
+/**
+ * @brief Returns the number of distinct rows of `keys` counted with a hash set of rows
+ */
+template <bool has_nulls>
+size_type hash_distinct_count(table_view const& keys,
+                              null_equality nulls_equal,
+                              cudaStream_t stream)
+{
+  auto d_keys = table_device_view::create(keys, stream);
+  auto set    = create_distinct_rows_set<has_nulls>(*d_keys, column_view{}, nulls_equal, stream);
+  return thrust::count_if(rmm::exec_policy(stream)->on(stream),
+                          thrust::make_counting_iterator<size_type>(0),
+                          thrust::make_counting_iterator<size_type>(keys.num_rows()),
+                          is_representative_row<has_nulls>{*set});
+}
+
+}  // namespace
+
 cudf::size_type distinct_count(table_view const& keys,
                                null_equality nulls_equal,
                                cudaStream_t stream)
 {
-  // sort only indices
-  auto sorted_indices = sorted_order(
-    keys, std::vector<order>{}, std::vector<null_order>{}, rmm::mr::get_default_resource(), stream);
-
-  // count unique elements
-  auto sorted_row_index   = sorted_indices->view().data<cudf::size_type>();
-  auto device_input_table = cudf::table_device_view::create(keys, stream);
-
-  if (cudf::has_nulls(keys)) {
-    row_equality_comparator<true> comp(
-      *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
-    return thrust::count_if(
-      rmm::exec_policy(stream)->on(stream),
-      thrust::counting_iterator<cudf::size_type>(0),
-      thrust::counting_iterator<cudf::size_type>(keys.num_rows()),
-      [sorted_row_index, comp] __device__(cudf::size_type i) {
-        return (i == 0 || not comp(sorted_row_index[i], sorted_row_index[i - 1]));
-      });
-  } else {
-    row_equality_comparator<false> comp(
-      *device_input_table, *device_input_table, nulls_equal == null_equality::EQUAL);
-    return thrust::count_if(
-      rmm::exec_policy(stream)->on(stream),
-      thrust::counting_iterator<cudf::size_type>(0),
-      thrust::counting_iterator<cudf::size_type>(keys.num_rows()),
-      [sorted_row_index, comp] __device__(cudf::size_type i) {
-        return (i == 0 || not comp(sorted_row_index[i], sorted_row_index[i - 1]));
-      });
-  }
+  if (keys.num_rows() == 0 || keys.num_columns() == 0) { return 0; }
+  // Unique dictionary keys compare like their indices
+  auto const keys_view = dictionary::detail::get_indices_annotated(keys);
+  return cudf::has_nulls(keys_view) ? hash_distinct_count<true>(keys_view, nulls_equal, stream)
+                                    : hash_distinct_count<false>(keys_view, nulls_equal, stream);
 }
 
 std::unique_ptr<table> drop_duplicates(table_view const& input,
@@ -211,6 +237,50 @@ std::unique_ptr<table> drop_duplicates(table_view const& input,
                         stream);
 }
 
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                null_equality nulls_equal,
+                                rmm::mr::device_memory_resource* mr,
+                                cudaStream_t stream)
+{
+  return distinct(input, keys, column_view{}, nulls_equal, mr, stream);
+}
+
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                column_view const& key_hashes,
+                                null_equality nulls_equal,
+                                rmm::mr::device_memory_resource* mr,
+                                cudaStream_t stream)
+{
+  CUDF_EXPECTS(key_hashes.size() == 0 or key_hashes.size() == input.num_rows(),
+               "Key hashes must have one row per input row");
+  if (0 == input.num_rows() || 0 == input.num_columns() || 0 == keys.size()) {
+    return empty_like(input);
+  }
+
+  // Unique dictionary keys compare like their indices
+  auto const keys_view = dictionary::detail::get_indices_annotated(input.select(keys));
+
+  // The values will be filled into this column
+  auto distinct_indices = cudf::make_numeric_column(
+    data_type{type_id::INT32}, keys_view.num_rows(), mask_state::UNALLOCATED, stream);
+  auto mutable_distinct_indices_view = distinct_indices->mutable_view();
+  auto const distinct_indices_view =
+    cudf::has_nulls(keys_view)
+      ? get_distinct_indices<true>(
+          keys_view, key_hashes, mutable_distinct_indices_view, nulls_equal, stream)
+      : get_distinct_indices<false>(
+          keys_view, key_hashes, mutable_distinct_indices_view, nulls_equal, stream);
+
+  return detail::gather(input,
+                        distinct_indices_view,
+                        detail::out_of_bounds_policy::NULLIFY,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        mr,
+                        stream);
+}
+
 /**
  * @brief Functor to check for `NAN` at an index in a `column_device_view`.
  *
@@ -329,6 +399,25 @@ std::unique_ptr<table> drop_duplicates(table_view const& input,
   return detail::drop_duplicates(input, keys, keep, nulls_equal, mr);
 }
 
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                null_equality nulls_equal,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct(input, keys, nulls_equal, mr);
+}
+
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                column_view const& key_hashes,
+                                null_equality nulls_equal,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct(input, keys, key_hashes, nulls_equal, mr);
+}
+
 cudf::size_type distinct_count(column_view const& input,
                                null_policy null_handling,
                                nan_policy nan_handling)
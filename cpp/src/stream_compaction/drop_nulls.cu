@@ -15,12 +15,14 @@
  */
 
 #include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
 
 namespace {
 // Returns true if the mask is true for index i in at least keep_threshold
@@ -51,6 +53,13 @@ struct valid_table_filter {
   cudf::table_device_view keys_device_view;
 };
 
+// Returns true if the bit of row i is set in the combined mask of the key columns
+struct valid_bit_filter {
+  __device__ inline bool operator()(cudf::size_type i) { return cudf::bit_is_set(mask, i); }
+
+  cudf::bitmask_type const* mask;
+};
+
 }  // namespace
 
 namespace cudf {
@@ -69,6 +78,21 @@ std::unique_ptr<table> drop_nulls(table_view const& input,
     return std::make_unique<table>(input, stream, mr);
   }
 
+  // A row is kept if all, or one, of its keys are valid: the combined mask of the keys and its
+  // null count are computed at once instead of counting the valid keys of each row
+  if (keep_threshold == keys_view.num_columns() or keep_threshold == 1) {
+    auto const scratch_mr = rmm::mr::get_default_resource();
+    auto const combined   = keep_threshold == keys_view.num_columns()
+                              ? detail::bitmask_and_with_null_count(keys_view, scratch_mr, stream)
+                              : detail::bitmask_or_with_null_count(keys_view, scratch_mr, stream);
+    if (combined.second == 0) { return std::make_unique<table>(input, stream, mr); }
+    return cudf::detail::copy_if(
+      input,
+      valid_bit_filter{static_cast<bitmask_type const*>(combined.first.data())},
+      mr,
+      stream);
+  }
+
   auto keys_device_view = cudf::table_device_view::create(keys_view, stream);
 
   return cudf::detail::copy_if(
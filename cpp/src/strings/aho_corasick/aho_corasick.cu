@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <strings/aho_corasick/aho_corasick.cuh>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <map>
+#include <queue>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+constexpr size_type ROOT_NODE{0};
+
+struct trie_node {
+  std::map<uint8_t, size_type> children;
+  size_type failure{ROOT_NODE};
+  size_type target{-1};
+  size_type output{-1};
+  size_type depth{0};
+};
+
+template <typename T>
+rmm::device_vector<T> to_device(std::vector<T> const& values)
+{
+  return rmm::device_vector<T>(values.begin(), values.end());
+}
+
+}  // namespace
+
+aho_corasick::aho_corasick(strings_column_view const& targets, cudaStream_t stream)
+{
+  auto const targets_count = targets.size();
+  CUDF_EXPECTS(targets_count > 0, "Must include at least one search target");
+  CUDF_EXPECTS(!targets.has_nulls(), "Search targets cannot contain null strings");
+
+  // copy the targets to the host
+  std::vector<int32_t> h_offsets(targets_count + 1);
+  CUDA_TRY(cudaMemcpyAsync(h_offsets.data(),
+                           targets.offsets().data<int32_t>() + targets.offset(),
+                           h_offsets.size() * sizeof(int32_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  std::string h_chars(h_offsets.back() - h_offsets.front(), 0);
+  CUDA_TRY(cudaMemcpyAsync(&h_chars[0],
+                           targets.chars().data<char>() + h_offsets.front(),
+                           h_chars.size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // build the trie of the targets
+  std::vector<trie_node> nodes(1);
+  for (size_type idx = 0; idx < targets_count; ++idx) {
+    auto const begin = h_offsets[idx] - h_offsets.front();
+    auto const end   = h_offsets[idx + 1] - h_offsets.front();
+    CUDF_EXPECTS(begin < end, "Search targets cannot contain empty strings");
+    size_type node = ROOT_NODE;
+    for (auto pos = begin; pos < end; ++pos) {
+      auto const byte = static_cast<uint8_t>(h_chars[pos]);
+      auto const itr  = nodes[node].children.find(byte);
+      if (itr != nodes[node].children.end()) {
+        node = itr->second;
+        continue;
+      }
+      auto const child           = static_cast<size_type>(nodes.size());
+      nodes[node].children[byte] = child;
+      nodes.emplace_back();
+      nodes[child].depth = nodes[node].depth + 1;
+      node               = child;
+    }
+    if (nodes[node].target < 0) nodes[node].target = idx;
+  }
+
+  // compute the failure and output links breadth first
+  std::queue<size_type> pending;
+  for (auto const& child : nodes[ROOT_NODE].children) pending.push(child.second);
+  while (!pending.empty()) {
+    auto const node = pending.front();
+    pending.pop();
+    for (auto const& child : nodes[node].children) {
+      auto failure = nodes[node].failure;
+      while (failure != ROOT_NODE && nodes[failure].children.count(child.first) == 0) {
+        failure = nodes[failure].failure;
+      }
+      auto const itr = nodes[failure].children.find(child.first);
+      if (itr != nodes[failure].children.end()) failure = itr->second;
+      auto& next   = nodes[child.second];
+      next.failure = failure;
+      next.output  = nodes[failure].target >= 0 ? failure : nodes[failure].output;
+      pending.push(child.second);
+    }
+  }
+
+  // flatten the nodes for the device
+  std::vector<size_type> root_transitions(256, ROOT_NODE);
+  for (auto const& child : nodes[ROOT_NODE].children) root_transitions[child.first] = child.second;
+  std::vector<size_type> child_offsets{0};
+  std::vector<uint8_t> child_bytes;
+  std::vector<size_type> child_nodes;
+  std::vector<size_type> failures;
+  std::vector<size_type> node_targets;
+  std::vector<size_type> outputs;
+  std::vector<size_type> depths;
+  for (auto const& node : nodes) {
+    for (auto const& child : node.children) {
+      child_bytes.push_back(child.first);
+      child_nodes.push_back(child.second);
+    }
+    child_offsets.push_back(static_cast<size_type>(child_bytes.size()));
+    failures.push_back(node.failure);
+    node_targets.push_back(node.target);
+    outputs.push_back(node.output);
+    depths.push_back(node.depth);
+  }
+  _root_transitions = to_device(root_transitions);
+  _child_offsets    = to_device(child_offsets);
+  _child_bytes      = to_device(child_bytes);
+  _child_nodes      = to_device(child_nodes);
+  _failures         = to_device(failures);
+  _targets          = to_device(node_targets);
+  _outputs          = to_device(outputs);
+  _depths           = to_device(depths);
+}
+
+aho_corasick_device aho_corasick::view() const
+{
+  return aho_corasick_device{_root_transitions.data().get(),
+                             _child_offsets.data().get(),
+                             _child_bytes.data().get(),
+                             _child_nodes.data().get(),
+                             _failures.data().get(),
+                             _targets.data().get(),
+                             _outputs.data().get(),
+                             _depths.data().get()};
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
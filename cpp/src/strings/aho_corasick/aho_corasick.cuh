@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+/**
+ * @brief Aho-Corasick automaton of a set of target strings stored on the device.
+ *
+ * Node 0 is the root of the trie of the targets. The children of each node are
+ * sorted by byte, and the children of the root are also available through a
+ * table of the 256 bytes. A string is scanned once, a byte at a time, no matter
+ * how many targets there are.
+ */
+struct aho_corasick_device {
+  size_type const* root_transitions;  // child of the root for each byte, or 0
+  size_type const* child_offsets;     // offset of the children of each node
+  uint8_t const* child_bytes;         // byte of each child
+  size_type const* child_nodes;       // node of each child
+  size_type const* failures;          // node of the longest proper suffix in the trie
+  size_type const* targets;           // first target that ends at each node, or -1
+  size_type const* outputs;           // next node with a target along the failures, or -1
+  size_type const* depths;            // number of bytes of each node
+
+  /**
+   * @brief Returns the child of `node` for `byte`, or -1 if it has none.
+   */
+  __device__ size_type child(size_type node, uint8_t byte) const
+  {
+    if (node == 0) {
+      auto const root_child = root_transitions[byte];
+      return root_child == 0 ? -1 : root_child;
+    }
+    auto const begin = child_bytes + child_offsets[node];
+    auto const end   = child_bytes + child_offsets[node + 1];
+    auto const itr   = thrust::lower_bound(thrust::seq, begin, end, byte);
+    return (itr != end && *itr == byte) ? child_nodes[itr - child_bytes] : -1;
+  }
+
+  /**
+   * @brief Returns the node reached from `node` by reading `byte`.
+   */
+  __device__ size_type next(size_type node, uint8_t byte) const
+  {
+    while (node != 0) {
+      auto const node_child = child(node, byte);
+      if (node_child >= 0) return node_child;
+      node = failures[node];
+    }
+    return root_transitions[byte];
+  }
+
+  /**
+   * @brief Returns true if any target ends at `node`.
+   */
+  __device__ bool has_match(size_type node) const
+  {
+    return targets[node] >= 0 || outputs[node] >= 0;
+  }
+
+  /**
+   * @brief Returns true if any target is found in the given bytes.
+   */
+  __device__ bool contains(char const* data, size_type bytes) const
+  {
+    size_type node = 0;
+    for (size_type idx = 0; idx < bytes; ++idx) {
+      node = next(node, static_cast<uint8_t>(data[idx]));
+      if (has_match(node)) return true;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Returns the node of the first listed target that the given bytes
+   * begin with, or -1 if they begin with no target.
+   */
+  __device__ size_type first_prefix(char const* data, size_type bytes) const
+  {
+    size_type node   = 0;
+    size_type result = -1;
+    for (size_type idx = 0; idx < bytes; ++idx) {
+      node = child(node, static_cast<uint8_t>(data[idx]));
+      if (node < 0) break;
+      if (targets[node] >= 0 && (result < 0 || targets[node] < targets[result])) result = node;
+    }
+    return result;
+  }
+
+  /**
+   * @brief Calls `fn(target, size, end)` for each occurrence of a target in
+   * the given bytes, where `size` is the number of bytes of the target and
+   * `end` is the byte position past the occurrence.
+   *
+   * Occurrences are visited in the order of their end position.
+   */
+  template <typename Fn>
+  __device__ void for_each_match(char const* data, size_type bytes, Fn fn) const
+  {
+    size_type node = 0;
+    for (size_type idx = 0; idx < bytes; ++idx) {
+      node = next(node, static_cast<uint8_t>(data[idx]));
+      auto match = targets[node] >= 0 ? node : outputs[node];
+      while (match >= 0) {
+        fn(targets[match], depths[match], idx + 1);
+        match = outputs[match];
+      }
+    }
+  }
+};
+
+/**
+ * @brief Aho-Corasick automaton of a set of target strings.
+ *
+ * The automaton is built on the host and copied to the device once, so that it
+ * can be used by any number of kernels through `view()`.
+ */
+class aho_corasick {
+ public:
+  /**
+   * @brief Builds the automaton of the given targets.
+   *
+   * When a target is listed more than once, its first index is reported.
+   *
+   * @throw cudf::logic_error if `targets` is empty or contains nulls or empty strings
+   *
+   * @param targets Strings to search for.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  aho_corasick(strings_column_view const& targets, cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns the device view of this automaton.
+   */
+  aho_corasick_device view() const;
+
+ private:
+  rmm::device_vector<size_type> _root_transitions;
+  rmm::device_vector<size_type> _child_offsets;
+  rmm::device_vector<uint8_t> _child_bytes;
+  rmm::device_vector<size_type> _child_nodes;
+  rmm::device_vector<size_type> _failures;
+  rmm::device_vector<size_type> _targets;
+  rmm::device_vector<size_type> _outputs;
+  rmm::device_vector<size_type> _depths;
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
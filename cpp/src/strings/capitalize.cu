@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <strings/char_types/ascii_flags.cuh>
 #include <strings/char_types/is_flags.h>
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
@@ -53,15 +54,16 @@ struct probe_execute_base {
 
   __host__ __device__ column_device_view const get_column(void) const { return d_column_; }
 
+  // the tables are only read for multi-byte characters
   __device__ char_info get_char_info(char_utf8 chr) const
   {
-    uint32_t code_point                     = detail::utf8_to_codepoint(chr);
-    detail::character_flags_table_type flag = code_point <= 0x00FFFF ? d_flags_[code_point] : 0;
-    return char_info{code_point, flag};
+    uint32_t code_point = detail::utf8_to_codepoint(chr);
+    return char_info{code_point, character_flags(code_point, d_flags_)};
   }
 
   __device__ char_utf8 convert_char(char_info const& info) const
   {
+    if (info.first < 0x80) return info.first ^ 0x20;  // ASCII cases differ by 0x20
     return detail::codepoint_to_utf8(d_case_table_[info.first]);
   }
 
@@ -127,7 +129,8 @@ struct probe_capitalize : private probe_execute_capitalize {
     if (get_column().is_null(idx)) return 0;  // null string
 
     string_view d_str = get_column().template element<string_view>(idx);
-    int32_t bytes     = 0;
+    if (is_ascii(d_str)) return d_str.size_bytes();  // ASCII conversions keep the size
+    int32_t bytes = 0;
 
     for (auto itr = d_str.begin(); itr != d_str.end(); ++itr) {
       bytes += detail::bytes_in_char_utf8(generate_chr(itr, d_str));
@@ -208,7 +211,8 @@ struct probe_title : private probe_execute_title {
     if (get_column().is_null(idx)) return 0;  // null string
 
     string_view d_str = get_column().template element<string_view>(idx);
-    int32_t bytes     = 0;
+    if (is_ascii(d_str)) return d_str.size_bytes();  // ASCII conversions keep the size
+    int32_t bytes = 0;
 
     bool bcapnext = true;
     for (auto itr = d_str.begin(); itr != d_str.end(); ++itr) {
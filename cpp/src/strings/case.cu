@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <strings/char_types/ascii_flags.cuh>
 #include <strings/char_types/char_cases.h>
 #include <strings/char_types/is_flags.h>
 #include <cudf/column/column.hpp>
@@ -21,6 +22,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/case.hpp>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -32,86 +34,82 @@ namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
-/**
- * @brief Used as template parameter to divide size calculation from
- * the actual string operation within a function.
- *
- * Useful when most of the logic is identical for both passes.
- */
-enum TwoPass {
-  SizeOnly = 0,  ///< calculate the size only
-  ExecuteOp      ///< run the string operation
-};
-
 /**
  * @brief Per string logic for case conversion functions.
  *
- * @tparam Pass Determines if size calculation or output write is begin performed.
+ * Computes the converted size of a string and writes the converted characters that fit in
+ * the output buffer, for `make_strings_children_bounded()`.
+ *
+ * Runs of 8 ASCII bytes are converted together with arithmetic, and other ASCII characters
+ * without the lookup tables, which are only read for multi-byte characters.
  */
-template <TwoPass Pass = SizeOnly>
 struct upper_lower_fn {
   const column_device_view d_column;
   character_flags_table_type case_flag;  // flag to check with on each character
   const character_flags_table_type* d_flags;
   const character_cases_table_type* d_case_table;
   const special_case_mapping* d_special_case_mapping;
-  const int32_t* d_offsets{};
-  char* d_chars{};
 
   __device__ special_case_mapping get_special_case_mapping(uint32_t code_point)
   {
     return d_special_case_mapping[get_special_case_hash_index(code_point)];
   }
 
-  // compute-size / copy the bytes representing the special case mapping for this codepoint
-  __device__ int32_t handle_special_case_bytes(uint32_t code_point,
-                                               char*& d_buffer,
-                                               detail::character_flags_table_type flag)
+  // append the characters of the special case mapping for this codepoint
+  __device__ void handle_special_case_bytes(uint32_t code_point,
+                                            char* d_buffer,
+                                            size_type capacity,
+                                            size_type& bytes,
+                                            detail::character_flags_table_type flag)
   {
     special_case_mapping m = get_special_case_mapping(code_point);
-    size_type bytes        = 0;
 
     auto const count  = IS_LOWER(flag) ? m.num_upper_chars : m.num_lower_chars;
     auto const* chars = IS_LOWER(flag) ? m.upper : m.lower;
     for (uint16_t idx = 0; idx < count; idx++) {
-      if (Pass == SizeOnly) {
-        bytes += detail::bytes_in_char_utf8(detail::codepoint_to_utf8(chars[idx]));
-      } else {
-        bytes += detail::from_char_utf8(detail::codepoint_to_utf8(chars[idx]), d_buffer + bytes);
-      }
+      append_bounded(d_buffer, capacity, bytes, detail::codepoint_to_utf8(chars[idx]));
     }
-    if (d_buffer != nullptr) { d_buffer += bytes; }
-    return bytes;
   }
 
-  __device__ int32_t operator()(size_type idx)
+  __device__ size_type operator()(size_type idx, char* d_buffer, size_type capacity)
   {
     if (d_column.is_null(idx)) return 0;  // null string
     string_view d_str = d_column.template element<string_view>(idx);
-    int32_t bytes     = 0;
-    char* d_buffer    = nullptr;
-    if (Pass == ExecuteOp) d_buffer = d_chars + d_offsets[idx];
-    for (auto itr = d_str.begin(); itr != d_str.end(); ++itr) {
-      uint32_t code_point                     = detail::utf8_to_codepoint(*itr);
-      detail::character_flags_table_type flag = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
+    auto const d_in   = d_str.data();
+    auto const size   = d_str.size_bytes();
+    size_type bytes   = 0;
+    size_type pos     = 0;
+    while (pos < size) {
+      if (pos + 8 <= size) {
+        uint64_t word;
+        memcpy(&word, d_in + pos, sizeof(word));
+        if (is_ascii_word(word)) {
+          word = convert_ascii_word_case(word, IS_UPPER(case_flag), IS_LOWER(case_flag));
+          if (bytes + 8 <= capacity) { memcpy(d_buffer + bytes, &word, sizeof(word)); }
+          bytes += 8;
+          pos += 8;
+          continue;
+        }
+      }
+      // other characters are decoded one at a time
+      char_utf8 chr = 0;
+      pos += to_char_utf8(d_in + pos, chr);
+      uint32_t code_point                     = detail::utf8_to_codepoint(chr);
+      detail::character_flags_table_type flag = character_flags(code_point, d_flags);
 
       // we apply special mapping in two cases:
       // - uncased characters with the special mapping flag, always
       // - cased characters with the special mapping flag, when matching the input case_flag
       //
       if (IS_SPECIAL(flag) && ((flag & case_flag) || !IS_UPPER_OR_LOWER(flag))) {
-        bytes += handle_special_case_bytes(code_point, d_buffer, case_flag);
+        handle_special_case_bytes(code_point, d_buffer, capacity, bytes, case_flag);
+      } else if ((flag & case_flag) && code_point < 0x80) {
+        append_bounded(d_buffer, capacity, bytes, chr ^ 0x20);  // ASCII cases differ by 0x20
       } else if (flag & case_flag) {
-        if (Pass == SizeOnly)
-          bytes += detail::bytes_in_char_utf8(detail::codepoint_to_utf8(d_case_table[code_point]));
-        else
-          d_buffer +=
-            detail::from_char_utf8(detail::codepoint_to_utf8(d_case_table[code_point]), d_buffer);
+        append_bounded(
+          d_buffer, capacity, bytes, detail::codepoint_to_utf8(d_case_table[code_point]));
       } else {
-        if (Pass == SizeOnly)
-          bytes += detail::bytes_in_char_utf8(*itr);
-        else
-          d_buffer += detail::from_char_utf8(*itr, d_buffer);
+        append_bounded(d_buffer, capacity, bytes, chr);
       }
     }
     return bytes;
@@ -122,6 +120,10 @@ struct upper_lower_fn {
  * @brief Utility method for converting upper and lower case characters
  * in a strings column.
  *
+ * Each string is converted once: case conversion rarely changes the size of a string, so the
+ * output is written into a scratch buffer the size of the input and then compacted. The few
+ * strings that grow are converted again directly into the output.
+ *
  * @param strings Strings to convert.
  * @param case_flag The character type to convert (upper, lower, or both)
  * @param mr Device memory resource used to allocate the returned column's device memory.
@@ -136,7 +138,6 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
   auto strings_count = strings.size();
   if (strings_count == 0) return detail::make_empty_strings_column(mr, stream);
 
-  auto execpol         = rmm::exec_policy(stream);
   auto strings_column  = column_device_view::create(strings.parent(), stream);
   auto d_column        = *strings_column;
   size_type null_count = strings.null_count();
@@ -149,32 +150,16 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
   auto d_case_table           = get_character_cases_table();
   auto d_special_case_mapping = get_special_case_mapping_table();
 
-  // build offsets column -- calculate the size of each output string
-  auto offsets_transformer_itr = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<size_type>(0),
-    upper_lower_fn<SizeOnly>{d_column, case_flag, d_flags, d_case_table, d_special_case_mapping});
-  auto offsets_column = detail::make_offsets_child_column(
-    offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
-  auto offsets_view  = offsets_column->view();
-  auto d_new_offsets = offsets_view.data<int32_t>();
-
-  // build the chars column -- convert characters based on case_flag parameter
-  size_type bytes = thrust::device_pointer_cast(d_new_offsets)[strings_count];
-  auto chars_column =
-    strings::detail::create_chars_child_column(strings_count, null_count, bytes, mr, stream);
-  auto chars_view = chars_column->mutable_view();
-  auto d_chars    = chars_view.data<char>();
-
-  thrust::for_each_n(
-    execpol->on(stream),
-    thrust::make_counting_iterator<size_type>(0),
-    strings_count,
-    upper_lower_fn<ExecuteOp>{
-      d_column, case_flag, d_flags, d_case_table, d_special_case_mapping, d_new_offsets, d_chars});
+  auto children = make_strings_children_bounded(
+    upper_lower_fn{d_column, case_flag, d_flags, d_case_table, d_special_case_mapping},
+    strings,
+    1,
+    mr,
+    stream);
   //
   return make_strings_column(strings_count,
-                             std::move(offsets_column),
-                             std::move(chars_column),
+                             std::move(children.first),
+                             std::move(children.second),
                              null_count,
                              std::move(null_mask),
                              stream,
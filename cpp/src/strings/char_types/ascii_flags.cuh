@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/string_view.cuh>
+#include <strings/utilities.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+/**
+ * @brief Returns the flags of an ASCII code point, as `get_character_flags_table()` has them.
+ *
+ * No ASCII character has the special casing flag, and the other flags follow from the ranges
+ * of digits, letters and spaces, so the most common code points need no table lookup.
+ */
+__device__ inline character_flags_table_type ascii_character_flags(uint32_t code_point)
+{
+  if (code_point >= '0' && code_point <= '9') return 0x07;  // decimal, numeric and digit
+  if (code_point >= 'A' && code_point <= 'Z') return 0x28;  // alpha and upper
+  if (code_point >= 'a' && code_point <= 'z') return 0x48;  // alpha and lower
+  // the table follows Python's isspace(), which includes the separators 0x1C to 0x1F
+  if (code_point == ' ' || (code_point >= 0x09 && code_point <= 0x0D) ||
+      (code_point >= 0x1C && code_point <= 0x1F))
+    return 0x10;
+  return 0;
+}
+
+/**
+ * @brief Returns the flags of a code point, reading the flags table only if it is not ASCII.
+ *
+ * @param code_point Code point of the character.
+ * @param d_flags Table returned by `get_character_flags_table()`.
+ */
+__device__ inline character_flags_table_type character_flags(
+  uint32_t code_point, character_flags_table_type const* d_flags)
+{
+  if (code_point < 0x80) return ascii_character_flags(code_point);
+  return code_point <= 0x00FFFF ? d_flags[code_point] : 0;
+}
+
+/**
+ * @brief The high bit of each byte of a word.
+ */
+constexpr uint64_t ascii_word_high_bits = 0x8080808080808080;
+
+/**
+ * @brief Returns true if all the bytes of a word are ASCII characters.
+ */
+__device__ inline bool is_ascii_word(uint64_t word) { return (word & ascii_word_high_bits) == 0; }
+
+/**
+ * @brief Returns true if all the bytes of a string are ASCII characters, checking 8 at a time.
+ */
+__device__ inline bool is_ascii(string_view const& d_str)
+{
+  auto const d_in = d_str.data();
+  auto const size = d_str.size_bytes();
+  size_type pos   = 0;
+  for (; pos + 8 <= size; pos += 8) {
+    uint64_t word;
+    memcpy(&word, d_in + pos, sizeof(word));
+    if (!is_ascii_word(word)) return false;
+  }
+  for (; pos < size; ++pos) {
+    if (static_cast<uint8_t>(d_in[pos]) >= 0x80) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the high bit of each byte of an ASCII word that is within `[first, last]`.
+ *
+ * Adding `0x80 - first` to a byte sets its high bit if it is at least `first`, and adding
+ * `0x7F - last` if it is greater than `last`. The bytes are less than 0x80 so neither sum carries
+ * into the next byte.
+ */
+__device__ inline uint64_t ascii_word_range_mask(uint64_t word, uint8_t first, uint8_t last)
+{
+  constexpr uint64_t ones = 0x0101010101010101;
+  auto const at_least     = word + ones * (0x80 - first);
+  auto const greater      = word + ones * (0x7F - last);
+  return (at_least ^ greater) & ascii_word_high_bits;
+}
+
+/**
+ * @brief Returns an ASCII word with the case of its upper case letters swapped if `upper` is set
+ * and of its lower case letters if `lower` is set.
+ *
+ * The cases of an ASCII letter differ by the 0x20 bit, which is the high bit shifted by 2.
+ */
+__device__ inline uint64_t convert_ascii_word_case(uint64_t word, bool upper, bool lower)
+{
+  uint64_t mask = 0;
+  if (upper) mask |= ascii_word_range_mask(word, 'A', 'Z');
+  if (lower) mask |= ascii_word_range_mask(word, 'a', 'z');
+  return word ^ (mask >> 2);
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
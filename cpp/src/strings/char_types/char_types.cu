@@ -23,6 +23,7 @@
 #include <cudf/strings/string.cuh>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <strings/char_types/ascii_flags.cuh>
 #include <strings/utilities.cuh>
 #include <strings/utilities.hpp>
 
@@ -67,8 +68,8 @@ std::unique_ptr<column> all_characters_of_type(
                       size_type check_count = 0;
                       for (auto itr = d_str.begin(); check && (itr != d_str.end()); ++itr) {
                         auto code_point = detail::utf8_to_codepoint(*itr);
-                        // lookup flags in table by code-point
-                        auto flag = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
+                        // lookup flags in table by code-point, unless it is ASCII
+                        auto flag = character_flags(code_point, d_flags);
                         if ((verify_types & flag) ||                   // should flag be verified
                             (flag == 0 && verify_types == ALL_TYPES))  // special edge case
                         {
@@ -109,7 +110,7 @@ struct filter_chars_fn {
   __device__ bool replace_char(char_utf8 ch)
   {
     auto const code_point = detail::utf8_to_codepoint(ch);
-    auto const flag       = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
+    auto const flag       = character_flags(code_point, d_flags);
     if (flag == 0)  // all types pass unless specifically identified
       return (types_to_remove == ALL_TYPES);
     if (types_to_keep == ALL_TYPES)  // filter case
@@ -29,14 +29,185 @@
 #include <strings/utilities.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
-#include <thrust/logical.h>
-#include <thrust/transform_reduce.h>
 #include <thrust/transform_scan.h>
 #include <algorithm>
 
 namespace cudf {
 namespace strings {
 namespace detail {
+namespace {
+/**
+ * @brief Separator of every row of a row-wise concatenation.
+ */
+struct scalar_separator {
+  string_view const d_separator;
+
+  __device__ bool is_valid(size_type) const { return true; }
+  __device__ string_view value(size_type) const { return d_separator; }
+};
+
+/**
+ * @brief Separators of each row, with an optional replacement for the null ones.
+ */
+struct column_separator {
+  column_device_view const d_separators;
+  string_scalar_device_view const d_narep;
+
+  __device__ bool is_valid(size_type ridx) const
+  {
+    return d_separators.is_valid(ridx) || d_narep.is_valid();
+  }
+  __device__ string_view value(size_type ridx) const
+  {
+    return d_separators.is_valid(ridx) ? d_separators.element<string_view>(ridx)
+                                       : d_narep.value();
+  }
+};
+
+/**
+ * @brief Replacement of the null strings of every column.
+ */
+struct scalar_narep {
+  string_scalar_device_view const d_narep;
+
+  __device__ bool is_valid(size_type) const { return d_narep.is_valid(); }
+  __device__ string_view value(size_type) const { return d_narep.value(); }
+};
+
+/**
+ * @brief Replacement of the null strings of each column; a null entry means the nulls of the
+ * column have no replacement.
+ */
+struct column_narep {
+  column_device_view const d_nareps;
+
+  __device__ bool is_valid(size_type col_idx) const { return d_nareps.is_valid(col_idx); }
+  __device__ string_view value(size_type col_idx) const
+  {
+    return d_nareps.element<string_view>(col_idx);
+  }
+};
+
+/**
+ * @brief Row-wise concatenation of the strings of a table.
+ *
+ * The separator and the replacement of the null strings of each column are provided by
+ * `Separator` and `Narep`. A null string without a replacement makes the row null, or with
+ * `skip_nulls` is skipped along with its separator. A row is also null if its separator is, or
+ * if all of its strings are skipped.
+ *
+ * This is called twice by `make_strings_children`. The first pass calculates the size of each
+ * output string. The final pass copies the results to the output strings column memory.
+ */
+template <typename Separator, typename Narep>
+struct concat_strings_fn {
+  table_device_view const d_table;
+  Separator const separator;
+  Narep const narep;
+  bool const skip_nulls;
+  int32_t* d_offsets{};  ///< size of the output string stored here during first pass
+  char* d_chars{};       ///< this is null only during the first pass
+
+  __device__ bool is_null_row(size_type ridx) const
+  {
+    if (!separator.is_valid(ridx)) return true;
+    bool all_skipped = true;
+    for (size_type col_idx = 0; col_idx < d_table.num_columns(); ++col_idx) {
+      bool const has_value = d_table.column(col_idx).is_valid(ridx) || narep.is_valid(col_idx);
+      if (!has_value && !skip_nulls) return true;
+      all_skipped = all_skipped && !has_value;
+    }
+    return all_skipped;
+  }
+
+  __device__ void operator()(size_type ridx)
+  {
+    if (is_null_row(ridx)) {
+      if (!d_chars) d_offsets[ridx] = 0;
+      return;
+    }
+    auto const d_separator = separator.value(ridx);
+    char* d_buffer         = d_chars ? d_chars + d_offsets[ridx] : nullptr;
+    size_type bytes        = 0;
+    bool colval_written    = false;
+    for (size_type col_idx = 0; col_idx < d_table.num_columns(); ++col_idx) {
+      auto const d_column = d_table.column(col_idx);
+      if (d_column.is_null(ridx) && !narep.is_valid(col_idx)) continue;
+      // separator goes only in between elements
+      if (colval_written) {
+        bytes += d_separator.size_bytes();
+        if (d_buffer) d_buffer = copy_string(d_buffer, d_separator);
+      }
+      auto const d_str =
+        d_column.is_null(ridx) ? narep.value(col_idx) : d_column.element<string_view>(ridx);
+      bytes += d_str.size_bytes();
+      if (d_buffer) d_buffer = copy_string(d_buffer, d_str);
+      colval_written = true;
+    }
+    if (!d_chars) d_offsets[ridx] = bytes;
+  }
+};
+
+/**
+ * @brief Returns true for the valid rows of the concatenation.
+ */
+template <typename ConcatFunction>
+struct concat_valid_fn {
+  ConcatFunction const fn;
+
+  __device__ bool operator()(size_type ridx) const { return !fn.is_null_row(ridx); }
+};
+
+/**
+ * @brief Builds the row-wise concatenation of the strings columns of a table in a single pass
+ * over the table for the sizes and a single pass for the chars.
+ */
+template <typename Separator, typename Narep>
+std::unique_ptr<column> concatenate_rows(table_view const& strings_columns,
+                                         Separator separator,
+                                         Narep narep,
+                                         bool skip_nulls,
+                                         rmm::mr::device_memory_resource* mr,
+                                         cudaStream_t stream)
+{
+  using concat_function = concat_strings_fn<Separator, Narep>;
+
+  auto const strings_count = strings_columns.num_rows();
+  auto const table         = table_device_view::create(strings_columns, stream);
+  auto const concat_fn     = concat_function{*table, separator, narep, skip_nulls};
+
+  auto valid_mask = cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                                           thrust::make_counting_iterator<size_type>(strings_count),
+                                           concat_valid_fn<concat_function>{concat_fn},
+                                           stream,
+                                           mr);
+  auto const null_count = valid_mask.second;
+
+  auto children = make_strings_children(concat_fn, strings_count, null_count, mr, stream);
+  return make_strings_column(strings_count,
+                             std::move(children.first),
+                             std::move(children.second),
+                             null_count,
+                             (null_count) ? std::move(valid_mask.first) : rmm::device_buffer{},
+                             stream,
+                             mr);
+}
+
+/**
+ * @brief Checks the strings columns of a row-wise concatenation.
+ */
+void validate_strings_columns(table_view const& strings_columns)
+{
+  CUDF_EXPECTS(strings_columns.num_columns() > 0, "At least one column must be specified");
+  // check all columns are of type string
+  CUDF_EXPECTS(std::all_of(strings_columns.begin(),
+                           strings_columns.end(),
+                           [](auto c) { return c.type().id() == type_id::STRING; }),
+               "All columns must be of type string");
+}
+
+}  // namespace
+
 //
 std::unique_ptr<column> concatenate(table_view const& strings_columns,
                                     string_scalar const& separator,
@@ -44,110 +215,18 @@ std::unique_ptr<column> concatenate(table_view const& strings_columns,
                                     rmm::mr::device_memory_resource* mr,
                                     cudaStream_t stream = 0)
 {
-  auto num_columns = strings_columns.num_columns();
-  CUDF_EXPECTS(num_columns > 0, "At least one column must be specified");
-  // check all columns are of type string
-  CUDF_EXPECTS(std::all_of(strings_columns.begin(),
-                           strings_columns.end(),
-                           [](auto c) { return c.type().id() == type_id::STRING; }),
-               "All columns must be of type string");
-  if (num_columns == 1)  // single strings column returns a copy
+  validate_strings_columns(strings_columns);
+  if (strings_columns.num_columns() == 1)  // single strings column returns a copy
     return std::make_unique<column>(*(strings_columns.begin()), stream, mr);
-  auto strings_count = strings_columns.num_rows();
-  if (strings_count == 0)  // empty begets empty
+  if (strings_columns.num_rows() == 0)  // empty begets empty
     return detail::make_empty_strings_column(mr, stream);
 
   CUDF_EXPECTS(separator.is_valid(), "Parameter separator must be a valid string_scalar");
   string_view d_separator(separator.data(), separator.size());
   auto d_narep = get_scalar_device_view(const_cast<string_scalar&>(narep));
 
-  // Create device views from the strings columns.
-  auto table   = table_device_view::create(strings_columns, stream);
-  auto d_table = *table;
-
-  // create resulting null mask
-  auto valid_mask = cudf::detail::valid_if(
-    thrust::make_counting_iterator<size_type>(0),
-    thrust::make_counting_iterator<size_type>(strings_count),
-    [d_table, d_narep] __device__(size_type idx) {
-      bool null_element = thrust::any_of(
-        thrust::seq, d_table.begin(), d_table.end(), [idx](auto col) { return col.is_null(idx); });
-      return (!null_element || d_narep.is_valid());
-    },
-    stream,
-    mr);
-  auto& null_mask       = valid_mask.first;
-  auto const null_count = valid_mask.second;
-
-  // build offsets column by computing sizes of each string in the output
-  auto offsets_transformer = [d_table, num_columns, d_separator, d_narep] __device__(
-                               size_type row_idx) {
-    // for this row (idx), iterate over each column and add up the bytes
-    bool null_element =
-      thrust::any_of(thrust::seq, d_table.begin(), d_table.end(), [row_idx](auto const& d_column) {
-        return d_column.is_null(row_idx);
-      });
-    if (null_element && !d_narep.is_valid()) return 0;
-    size_type bytes = thrust::transform_reduce(
-      thrust::seq,
-      d_table.begin(),
-      d_table.end(),
-      [row_idx, d_separator, d_narep] __device__(column_device_view const& d_column) {
-        return d_separator.size_bytes() + (d_column.is_null(row_idx)
-                                             ? d_narep.size()
-                                             : d_column.element<string_view>(row_idx).size_bytes());
-      },
-      0,
-      thrust::plus<size_type>());
-    // separator goes only in between elements
-    if (bytes > 0)                        // if not null
-      bytes -= d_separator.size_bytes();  // remove the last separator
-    return bytes;
-  };
-  auto offsets_transformer_itr = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<size_type>(0), offsets_transformer);
-  auto offsets_column = detail::make_offsets_child_column(
-    offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
-  auto d_results_offsets = offsets_column->view().data<int32_t>();
-
-  // create the chars column
-  size_type bytes = thrust::device_pointer_cast(d_results_offsets)[strings_count];
-  auto chars_column =
-    strings::detail::create_chars_child_column(strings_count, null_count, bytes, mr, stream);
-  // fill the chars column
-  auto d_results_chars = chars_column->mutable_view().data<char>();
-  thrust::for_each_n(
-    rmm::exec_policy(stream)->on(stream),
-    thrust::make_counting_iterator<size_type>(0),
-    strings_count,
-    [d_table, num_columns, d_separator, d_narep, d_results_offsets, d_results_chars] __device__(
-      size_type idx) {
-      bool null_element = thrust::any_of(
-        thrust::seq, d_table.begin(), d_table.end(), [idx](column_device_view const& col) {
-          return col.is_null(idx);
-        });
-      if (null_element && !d_narep.is_valid())
-        return;  // do not write to buffer at all if any column element for this row is null
-      size_type offset = d_results_offsets[idx];
-      char* d_buffer   = d_results_chars + offset;
-      // write out each column's entry for this row
-      for (size_type col_idx = 0; col_idx < num_columns; ++col_idx) {
-        auto d_column = d_table.column(col_idx);
-        string_view d_str =
-          d_column.is_null(idx) ? d_narep.value() : d_column.element<string_view>(idx);
-        d_buffer = detail::copy_string(d_buffer, d_str);
-        // separator goes only in between elements
-        if (col_idx + 1 < num_columns) d_buffer = detail::copy_string(d_buffer, d_separator);
-      }
-    });
-
-  return make_strings_column(strings_count,
-                             std::move(offsets_column),
-                             std::move(chars_column),
-                             null_count,
-                             std::move(null_mask),
-                             stream,
-                             mr);
+  return concatenate_rows(
+    strings_columns, scalar_separator{d_separator}, scalar_narep{d_narep}, false, mr, stream);
 }
 
 //
@@ -252,191 +331,52 @@ std::unique_ptr<column> concatenate(table_view const& strings_columns,
                                     rmm::mr::device_memory_resource* mr,
                                     cudaStream_t stream = 0)
 {
-  auto num_columns = strings_columns.num_columns();
-  CUDF_EXPECTS(num_columns > 0, "At least one column must be specified");
-  // Check if all columns are of type string
-  CUDF_EXPECTS(std::all_of(strings_columns.begin(),
-                           strings_columns.end(),
-                           [](auto c) { return c.type().id() == type_id::STRING; }),
-               "All columns must be of type string");
-
+  validate_strings_columns(strings_columns);
   auto strings_count = strings_columns.num_rows();
   CUDF_EXPECTS(strings_count == separators.size(),
                "Separators column should be the same size as the strings columns");
   if (strings_count == 0)  // Empty begets empty
     return detail::make_empty_strings_column(mr, stream);
 
-  // Invalid output column strings - null rows
-  string_view const invalid_str{nullptr, 0};
-  auto const separator_rep = get_scalar_device_view(const_cast<string_scalar&>(separator_narep));
-  auto const col_rep       = get_scalar_device_view(const_cast<string_scalar&>(col_narep));
-  auto const separator_col_view_ptr = column_device_view::create(separators.parent(), stream);
-  auto const separator_col_view     = *separator_col_view_ptr;
-
-  if (num_columns == 1) {
-    // Shallow copy of the resultant strings
-    rmm::device_vector<string_view> out_col_strings(strings_count);
-
-    // Device view of the only column in the table view
-    auto const col0_ptr = column_device_view::create(strings_columns.column(0), stream);
-    auto const col0     = *col0_ptr;
-
-    // Execute it on every element
-    thrust::transform(
-      rmm::exec_policy(stream)->on(stream),
-      thrust::make_counting_iterator(0),
-      thrust::make_counting_iterator(strings_count),
-      out_col_strings.data().get(),
-      // Output depends on the separator
-      [col0, invalid_str, separator_col_view, separator_rep, col_rep] __device__(auto ridx) {
-        if (!separator_col_view.is_valid(ridx) && !separator_rep.is_valid()) return invalid_str;
-        if (col0.is_valid(ridx)) {
-          auto sv = col0.element<string_view>(ridx);
-          return sv.empty() ? string_view{} : sv;
-        } else if (col_rep.is_valid()) {
-          auto cv = col_rep.value();
-          return cv.empty() ? string_view{} : cv;
-        } else
-          return invalid_str;
-      });
-
-    return make_strings_column(out_col_strings, invalid_str, stream, mr);
-  }
+  auto const separator_rep  = get_scalar_device_view(const_cast<string_scalar&>(separator_narep));
+  auto const col_rep        = get_scalar_device_view(const_cast<string_scalar&>(col_narep));
+  auto const separators_ptr = column_device_view::create(separators.parent(), stream);
 
-  // Create device views from the strings columns.
-  auto table   = table_device_view::create(strings_columns, stream);
-  auto d_table = *table;
+  return concatenate_rows(strings_columns,
+                          column_separator{*separators_ptr, separator_rep},
+                          scalar_narep{col_rep},
+                          true,
+                          mr,
+                          stream);
+}
 
-  // Create resulting null mask
-  auto valid_mask = cudf::detail::valid_if(
-    thrust::make_counting_iterator<size_type>(0),
-    thrust::make_counting_iterator<size_type>(strings_count),
-    [d_table, separator_col_view, separator_rep, col_rep] __device__(size_type ridx) {
-      if (!separator_col_view.is_valid(ridx) && !separator_rep.is_valid()) return false;
-      bool all_nulls =
-        thrust::all_of(thrust::seq, d_table.begin(), d_table.end(), [ridx](auto const& col) {
-          return col.is_null(ridx);
-        });
-      return all_nulls ? col_rep.is_valid() : true;
-    },
-    stream,
-    mr);
-
-  auto null_count = valid_mask.second;
-
-  // Build offsets column by computing sizes of each string in the output
-  auto offsets_transformer = [d_table, separator_col_view, separator_rep, col_rep] __device__(
-                               size_type ridx) {
-    // If the separator value for the row is null and if there aren't global separator
-    // replacements, this row does not have any value - null row
-    if (!separator_col_view.is_valid(ridx) && !separator_rep.is_valid()) return 0;
-
-    // For this row (idx), iterate over each column and add up the bytes
-    bool all_nulls =
-      thrust::all_of(thrust::seq, d_table.begin(), d_table.end(), [ridx](auto const& d_column) {
-        return d_column.is_null(ridx);
-      });
-    // If all column values are null and there isn't a global column replacement value, this row
-    // is a null row
-    if (all_nulls && !col_rep.is_valid()) return 0;
-
-    // There is at least one non-null column value (it can still be empty though)
-    auto separator_str = separator_col_view.is_valid(ridx)
-                           ? separator_col_view.element<string_view>(ridx)
-                           : separator_rep.value();
-
-    size_type bytes = thrust::transform_reduce(
-      thrust::seq,
-      d_table.begin(),
-      d_table.end(),
-      [ridx, separator_str, col_rep] __device__(column_device_view const& d_column) {
-        // If column is null and there isn't a valid column replacement, this isn't used in
-        // final string concatenate
-        if (d_column.is_null(ridx) && !col_rep.is_valid()) return 0;
-        return separator_str.size_bytes() + (d_column.is_null(ridx)
-                                               ? col_rep.size()
-                                               : d_column.element<string_view>(ridx).size_bytes());
-      },
-      0,
-      thrust::plus<size_type>());
-
-    // Null/empty separator and columns doesn't produce a non-empty string
-    if (bytes == 0) assert(separator_str.size_bytes() == 0);
-
-    // Separator goes only in between elements
-    return bytes - separator_str.size_bytes();
-  };
-  auto offsets_transformer_itr = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<size_type>(0), offsets_transformer);
-  auto offsets_column = detail::make_offsets_child_column(
-    offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
-  auto d_results_offsets = offsets_column->view().data<int32_t>();
-
-  // Create the chars column
-  size_type bytes = thrust::device_pointer_cast(d_results_offsets)[strings_count];
-  auto chars_column =
-    strings::detail::create_chars_child_column(strings_count, null_count, bytes, mr, stream);
-
-  // Fill the chars column
-  auto d_results_chars = chars_column->mutable_view().data<char>();
-  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
-                     thrust::make_counting_iterator<size_type>(0),
-                     strings_count,
-                     [d_table,
-                      num_columns,
-                      d_results_offsets,
-                      d_results_chars,
-                      separator_col_view,
-                      separator_rep,
-                      col_rep] __device__(size_type ridx) {
-                       // If the separator for this row is null and if there isn't a valid separator
-                       // to replace, do not write anything for this row
-                       if (!separator_col_view.is_valid(ridx) && !separator_rep.is_valid()) return;
-
-                       bool all_nulls = thrust::all_of(
-                         thrust::seq, d_table.begin(), d_table.end(), [ridx](auto const& col) {
-                           return col.is_null(ridx);
-                         });
-
-                       // If all column values are null and there isn't a valid column replacement,
-                       // skip this row
-                       if (all_nulls && !col_rep.is_valid()) return;
-
-                       size_type offset    = d_results_offsets[ridx];
-                       char* d_buffer      = d_results_chars + offset;
-                       bool colval_written = false;
-
-                       // There is at least one non-null column value (it can still be empty though)
-                       auto separator_str = separator_col_view.is_valid(ridx)
-                                              ? separator_col_view.element<string_view>(ridx)
-                                              : separator_rep.value();
-
-                       // Write out each column's entry for this row
-                       for (size_type col_idx = 0; col_idx < num_columns; ++col_idx) {
-                         auto d_column = d_table.column(col_idx);
-                         // If the column isn't valid and if there isn't a replacement for it, skip
-                         // it
-                         if (d_column.is_null(ridx) && !col_rep.is_valid()) continue;
-
-                         // Separator goes only in between elements
-                         if (colval_written)
-                           d_buffer = detail::copy_string(d_buffer, separator_str);
-
-                         string_view d_str = d_column.is_null(ridx)
-                                               ? col_rep.value()
-                                               : d_column.element<string_view>(ridx);
-                         d_buffer       = detail::copy_string(d_buffer, d_str);
-                         colval_written = true;
-                       }
-                     });
+//
+std::unique_ptr<column> concatenate(table_view const& strings_columns,
+                                    strings_column_view const& separators,
+                                    strings_column_view const& col_nareps,
+                                    string_scalar const& separator_narep,
+                                    rmm::mr::device_memory_resource* mr,
+                                    cudaStream_t stream = 0)
+{
+  validate_strings_columns(strings_columns);
+  auto strings_count = strings_columns.num_rows();
+  CUDF_EXPECTS(strings_count == separators.size(),
+               "Separators column should be the same size as the strings columns");
+  CUDF_EXPECTS(strings_columns.num_columns() == col_nareps.size(),
+               "Column replacements should have one string per strings column");
+  if (strings_count == 0)  // Empty begets empty
+    return detail::make_empty_strings_column(mr, stream);
 
-  return make_strings_column(strings_count,
-                             std::move(offsets_column),
-                             std::move(chars_column),
-                             null_count,
-                             (null_count) ? std::move(valid_mask.first) : rmm::device_buffer{},
-                             stream,
-                             mr);
+  auto const separator_rep  = get_scalar_device_view(const_cast<string_scalar&>(separator_narep));
+  auto const separators_ptr = column_device_view::create(separators.parent(), stream);
+  auto const nareps_ptr     = column_device_view::create(col_nareps.parent(), stream);
+
+  return concatenate_rows(strings_columns,
+                          column_separator{*separators_ptr, separator_rep},
+                          column_narep{*nareps_ptr},
+                          true,
+                          mr,
+                          stream);
 }
 
 }  // namespace detail
@@ -471,5 +411,15 @@ std::unique_ptr<column> concatenate(table_view const& strings_columns,
   return detail::concatenate(strings_columns, separators, separator_narep, col_narep, mr);
 }
 
+std::unique_ptr<column> concatenate(table_view const& strings_columns,
+                                    strings_column_view const& separators,
+                                    strings_column_view const& col_nareps,
+                                    string_scalar const& separator_narep,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::concatenate(strings_columns, separators, col_nareps, separator_narep, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -18,6 +18,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/contains.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -26,6 +27,9 @@
 #include <strings/regex/regex.cuh>
 #include <strings/utilities.hpp>
 
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -62,6 +66,34 @@ struct contains_fn {
   }
 };
 
+constexpr size_type DFA_BLOCK_SIZE{256};
+
+/**
+ * @brief Kernel that evaluates each string with the automaton of the pattern
+ * after copying it into shared memory.
+ *
+ * Strings the automaton cannot classify are marked in `d_undecided` so that
+ * they can be evaluated by the regex instructions.
+ */
+__global__ void contains_dfa_kernel(redfa_device dfa,
+                                    column_device_view d_strings,
+                                    bool* d_results,
+                                    bool* d_undecided)
+{
+  extern __shared__ u_char shared_dfa[];
+  for (size_t i = threadIdx.x; i < dfa.size(); i += blockDim.x) shared_dfa[i] = dfa.data()[i];
+  __syncthreads();
+  auto const d_dfa = dfa.with_data(shared_dfa);
+
+  for (size_type idx = threadIdx.x + blockIdx.x * blockDim.x; idx < d_strings.size();
+       idx += blockDim.x * gridDim.x) {
+    auto const match =
+      d_strings.is_null(idx) ? 0 : d_dfa.is_match(d_strings.element<string_view>(idx));
+    d_results[idx]   = match > 0;
+    d_undecided[idx] = match < 0;
+  }
+}
+
 //
 std::unique_ptr<column> contains_util(
   strings_column_view const& strings,
@@ -87,27 +119,45 @@ std::unique_ptr<column> contains_util(
                                      mr);
   auto d_results = results->mutable_view().data<bool>();
 
-  // fill the output column
+  // fill the output column with the automaton of the pattern if it has one;
+  // the rows it could not evaluate are evaluated by the regex instructions
+  rmm::device_vector<bool> undecided(strings_count, true);
+  auto dfa = d_prog.dfa(beginning_only);
+  if (!dfa.empty() && strings_count > 0) {
+    cudf::detail::grid_1d grid{strings_count, DFA_BLOCK_SIZE};
+    contains_dfa_kernel<<<grid.num_blocks, grid.num_threads_per_block, dfa.size(), stream>>>(
+      dfa, d_column, d_results, undecided.data().get());
+    CHECK_CUDA(stream);
+  }
+
   auto execpol    = rmm::exec_policy(stream);
   int regex_insts = d_prog.insts_counts();
-  if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      contains_fn<RX_STACK_SMALL>{d_prog, d_column, beginning_only});
-  else if (regex_insts <= RX_MEDIUM_INSTS)
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      contains_fn<RX_STACK_MEDIUM>{d_prog, d_column, beginning_only});
-  else
-    thrust::transform(execpol->on(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(strings_count),
-                      d_results,
-                      contains_fn<RX_STACK_LARGE>{d_prog, d_column, beginning_only});
+  if (dfa.empty() || dfa.ascii_only) {
+    if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
+      thrust::transform_if(execpol->on(stream),
+                           thrust::make_counting_iterator<size_type>(0),
+                           thrust::make_counting_iterator<size_type>(strings_count),
+                           undecided.begin(),
+                           d_results,
+                           contains_fn<RX_STACK_SMALL>{d_prog, d_column, beginning_only},
+                           thrust::identity<bool>{});
+    else if (regex_insts <= RX_MEDIUM_INSTS)
+      thrust::transform_if(execpol->on(stream),
+                           thrust::make_counting_iterator<size_type>(0),
+                           thrust::make_counting_iterator<size_type>(strings_count),
+                           undecided.begin(),
+                           d_results,
+                           contains_fn<RX_STACK_MEDIUM>{d_prog, d_column, beginning_only},
+                           thrust::identity<bool>{});
+    else
+      thrust::transform_if(execpol->on(stream),
+                           thrust::make_counting_iterator<size_type>(0),
+                           thrust::make_counting_iterator<size_type>(strings_count),
+                           undecided.begin(),
+                           d_results,
+                           contains_fn<RX_STACK_LARGE>{d_prog, d_column, beginning_only},
+                           thrust::identity<bool>{});
+  }
 
   results->set_null_count(strings.null_count());
   return results;
@@ -153,6 +203,119 @@ std::unique_ptr<column> matches_re(strings_column_view const& strings,
   return detail::matches_re(strings, pattern, mr);
 }
 
+namespace detail {
+namespace {
+/**
+ * @brief This functor evaluates each string against all the given regex patterns.
+ *
+ * Patterns are evaluated with their automaton when they have one, and with
+ * their regex instructions otherwise or when the automaton cannot classify a
+ * character of the string.
+ */
+template <size_t stack_size>
+struct contains_multi_fn {
+  column_device_view const d_strings;
+  reprog_device* progs;  // array of regex progs
+  size_type number_of_patterns;
+  bool** d_results;  // output array of each pattern
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) {
+      for (size_type ptn_idx = 0; ptn_idx < number_of_patterns; ++ptn_idx)
+        d_results[ptn_idx][idx] = false;
+      return;
+    }
+    u_char data1[stack_size], data2[stack_size];
+    string_view d_str = d_strings.element<string_view>(idx);
+    for (size_type ptn_idx = 0; ptn_idx < number_of_patterns; ++ptn_idx) {
+      reprog_device prog = progs[ptn_idx];
+      auto const& dfa    = prog.dfa(false);
+      int32_t match      = dfa.empty() ? -1 : dfa.is_match(d_str);
+      if (match < 0) {
+        prog.set_stack_mem(data1, data2);
+        int32_t begin = 0;
+        int32_t end   = -1;
+        match         = prog.find(idx, d_str, begin, end);
+      }
+      d_results[ptn_idx][idx] = match > 0;
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<table> contains_re(
+  strings_column_view const& strings,
+  std::vector<std::string> const& patterns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  auto strings_count  = strings.size();
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+  auto d_flags        = get_character_flags_table();
+
+  // compile regexes into device objects and create an output column for each
+  size_type regex_insts = 0;
+  std::vector<std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>> h_progs;
+  rmm::device_vector<reprog_device> progs;
+  std::vector<std::unique_ptr<column>> results;
+  thrust::host_vector<bool*> h_results;
+  for (auto itr = patterns.begin(); itr != patterns.end(); ++itr) {
+    auto prog  = reprog_device::create(*itr, d_flags, strings_count, stream);
+    auto insts = prog->insts_counts();
+    if (insts > regex_insts) regex_insts = insts;
+    progs.push_back(*prog);
+    h_progs.emplace_back(std::move(prog));
+    results.emplace_back(make_numeric_column(data_type{type_id::BOOL8},
+                                             strings_count,
+                                             copy_bitmask(strings.parent(), stream, mr),
+                                             strings.null_count(),
+                                             stream,
+                                             mr));
+    h_results.push_back(results.back()->mutable_view().data<bool>());
+  }
+  if (patterns.empty() || strings_count == 0) return std::make_unique<table>(std::move(results));
+  rmm::device_vector<bool*> d_results(h_results);
+
+  // evaluate all the patterns in one pass over the strings
+  auto execpol        = rmm::exec_policy(stream);
+  auto d_progs        = progs.data().get();
+  auto patterns_count = static_cast<size_type>(progs.size());
+  auto d_results_ptrs = d_results.data().get();
+  if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
+    thrust::for_each_n(
+      execpol->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      contains_multi_fn<RX_STACK_SMALL>{d_strings, d_progs, patterns_count, d_results_ptrs});
+  else if (regex_insts <= RX_MEDIUM_INSTS)
+    thrust::for_each_n(
+      execpol->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      contains_multi_fn<RX_STACK_MEDIUM>{d_strings, d_progs, patterns_count, d_results_ptrs});
+  else
+    thrust::for_each_n(
+      execpol->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      contains_multi_fn<RX_STACK_LARGE>{d_strings, d_progs, patterns_count, d_results_ptrs});
+
+  return std::make_unique<table>(std::move(results));
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> contains_re(strings_column_view const& strings,
+                                   std::vector<std::string> const& patterns,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_re(strings, patterns, mr);
+}
+
 namespace detail {
 namespace {
 /**
@@ -17,6 +17,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/datetime_parsing.cuh>
 #include <cudf/strings/convert/convert_datetime.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -103,6 +104,7 @@ struct format_compiler {
   std::string template_string;
   timestamp_units units;
   rmm::device_vector<format_item> d_items;
+  size_type iso_items = 0;
 
   std::map<char, int8_t> specifier_lengths = {{'Y', 4},
                                               {'y', 2},
@@ -156,6 +158,7 @@ struct format_compiler {
       items.push_back(format_item::new_specifier(ch, spec_length));
       template_string.append((size_t)spec_length, ch);
     }
+    iso_items = count_iso_items(items);
     // create program in device memory
     d_items.resize(items.size());
     CUDA_TRY(cudaMemcpyAsync(
@@ -167,6 +170,29 @@ struct format_compiler {
   size_type template_bytes() const { return static_cast<size_type>(template_string.size()); }
   size_type items_count() const { return static_cast<size_type>(d_items.size()); }
   int8_t subsecond_precision() const { return specifier_lengths.at('f'); }
+  // number of leading items forming an ISO-8601 date (5) or date and time (11); 0 if neither
+  size_type iso_prefix_items() const { return iso_items; }
+
+ private:
+  // the leading items of a format that can be parsed at fixed offsets
+  static size_type count_iso_items(std::vector<format_item> const& items)
+  {
+    auto matches = [&items](size_t idx, format_char_type type, char value) {
+      return idx < items.size() && items[idx].item_type == type && items[idx].value == value;
+    };
+    auto const specifier = format_char_type::specifier;
+    auto const literal   = format_char_type::literal;
+    if (!(matches(0, specifier, 'Y') && matches(1, literal, '-') && matches(2, specifier, 'm') &&
+          matches(3, literal, '-') && matches(4, specifier, 'd'))) {
+      return 0;
+    }
+    if ((matches(5, literal, 'T') || matches(5, literal, ' ')) && matches(6, specifier, 'H') &&
+        matches(7, literal, ':') && matches(8, specifier, 'M') && matches(9, literal, ':') &&
+        matches(10, specifier, 'S')) {
+      return 11;
+    }
+    return 5;
+  }
 };
 
 // this parses date/time characters into a timestamp integer
@@ -177,6 +203,7 @@ struct parse_datetime {
   size_type items_count;
   timestamp_units units;
   int8_t subsecond_precision;
+  size_type iso_items;  // leading items parsed at fixed offsets when the string allows it
 
   //
   __device__ int32_t str2int(const char* str, size_type bytes)
@@ -191,13 +218,43 @@ struct parse_datetime {
     return value;
   }
 
+  // Read an ISO-8601 date or date and time at the start of the string at fixed offsets.
+  // Returns the number of bytes read; 0 if the string does not have the ISO layout.
+  __device__ size_type parse_iso_prefix(char const* ptr, size_type length, int32_t* timeparts)
+  {
+    cudf::detail::iso_datetime parts;
+    if (iso_items == 11) {
+      if (length < cudf::detail::iso_datetime_length ||
+          !cudf::detail::parse_iso_datetime(ptr, parts))
+        return 0;
+    } else if (length < cudf::detail::iso_date_length || !cudf::detail::parse_iso_date(ptr, parts))
+      return 0;
+    timeparts[TP_YEAR]   = parts.year;
+    timeparts[TP_MONTH]  = parts.month;
+    timeparts[TP_DAY]    = parts.day;
+    timeparts[TP_HOUR]   = parts.hour;
+    timeparts[TP_MINUTE] = parts.minute;
+    timeparts[TP_SECOND] = parts.second;
+    return iso_items == 11 ? cudf::detail::iso_datetime_length : cudf::detail::iso_date_length;
+  }
+
   // Walk the format_items to read the datetime string.
   // Returns 0 if all ok.
   __device__ int parse_into_parts(string_view const& d_string, int32_t* timeparts)
   {
     auto ptr    = d_string.data();
     auto length = d_string.size_bytes();
-    for (size_t idx = 0; idx < items_count; ++idx) {
+    size_t idx  = 0;
+    // Strings not matching the ISO layout exactly are parsed item by item from the start
+    if (iso_items > 0) {
+      auto const bytes = parse_iso_prefix(ptr, length, timeparts);
+      if (bytes > 0) {
+        ptr += bytes;
+        length -= bytes;
+        idx = iso_items;
+      }
+    }
+    for (; idx < items_count; ++idx) {
       auto item = d_format_items[idx];
       if (length < item.length) return 1;
       if (item.item_type == format_char_type::literal) {  // static character we'll just skip;
@@ -358,8 +415,12 @@ struct dispatch_to_timestamps_fn {
     format_compiler compiler(format.c_str(), units);
     auto d_items   = compiler.compile_to_device();
     auto d_results = results_view.data<T>();
-    parse_datetime<T> pfn{
-      d_strings, d_items, compiler.items_count(), units, compiler.subsecond_precision()};
+    parse_datetime<T> pfn{d_strings,
+                          d_items,
+                          compiler.items_count(),
+                          units,
+                          compiler.subsecond_precision(),
+                          compiler.iso_prefix_items()};
     thrust::transform(rmm::exec_policy(stream)->on(stream),
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(results_view.size()),
@@ -17,6 +17,8 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/number_parsing.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/strings/convert/convert_floats.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -28,6 +30,7 @@
 
 #include <memory.h>
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 #include <cmath>
@@ -37,101 +40,31 @@ namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
-/**
- * @brief This function converts the given string into a
- * floating point double value.
- *
- * This will also map strings containing "NaN", "Inf" and "-Inf"
- * to the appropriate float values.
- *
- * This function will also handle scientific notation format.
- */
-__device__ inline double stod(string_view const& d_str)
-{
-  const char* in_ptr = d_str.data();
-  const char* end    = in_ptr + d_str.size_bytes();
-  if (end == in_ptr) return 0.0;
-  // special strings
-  if (d_str.compare("NaN", 3) == 0) return std::numeric_limits<double>::quiet_NaN();
-  if (d_str.compare("Inf", 3) == 0) return std::numeric_limits<double>::infinity();
-  if (d_str.compare("-Inf", 4) == 0) return -std::numeric_limits<double>::infinity();
-  double sign = 1.0;
-  if (*in_ptr == '-' || *in_ptr == '+') {
-    sign = (*in_ptr == '-' ? -1 : 1);
-    ++in_ptr;
-  }
-  unsigned long max_mantissa = 0x0FFFFFFFFFFFFF;
-  unsigned long digits       = 0;
-  int exp_off                = 0;
-  bool decimal               = false;
-  while (in_ptr < end) {
-    char ch = *in_ptr;
-    if (ch == '.') {
-      decimal = true;
-      ++in_ptr;
-      continue;
-    }
-    if (ch < '0' || ch > '9') break;
-    if (digits > max_mantissa)
-      exp_off += (int)!decimal;
-    else {
-      digits = (digits * 10L) + (unsigned long)(ch - '0');
-      if (digits > max_mantissa) {
-        digits = digits / 10L;
-        exp_off += (int)!decimal;
-      } else
-        exp_off -= (int)decimal;
-    }
-    ++in_ptr;
-  }
-  // check for exponent char
-  int exp_ten  = 0;
-  int exp_sign = 1;
-  if (in_ptr < end) {
-    char ch = *in_ptr++;
-    if (ch == 'e' || ch == 'E') {
-      if (in_ptr < end) {
-        ch = *in_ptr;
-        if (ch == '-' || ch == '+') {
-          exp_sign = (ch == '-' ? -1 : 1);
-          ++in_ptr;
-        }
-        while (in_ptr < end) {
-          ch = *in_ptr++;
-          if (ch < '0' || ch > '9') break;
-          exp_ten = (exp_ten * 10) + (int)(ch - '0');
-        }
-      }
-    }
-  }
-  exp_ten *= exp_sign;
-  exp_ten += exp_off;
-  if (exp_ten > 308)
-    return sign > 0 ? std::numeric_limits<double>::infinity()
-                    : -std::numeric_limits<double>::infinity();
-  else if (exp_ten < -308)
-    return 0.0;
-  // using exp10() since the pow(10.0,exp_ten) function is
-  // very inaccurate in 10.2: http://nvbugs/2971187
-  double value = static_cast<double>(digits) * exp10(static_cast<double>(exp_ten));
-  return (value * sign);
-}
-
 /**
  * @brief Converts strings column entries into floats.
  *
  * Used by the dispatch method to convert to different float types.
+ *
+ * Strings containing "NaN", "Inf" and "-Inf" are mapped to the appropriate
+ * float values and scientific notation is also handled.
  */
 template <typename FloatType>
 struct string_to_float_fn {
   const column_device_view strings_column;  // strings to convert
+  bool* d_valids;                           // optional: false for null or malformed strings
 
   __device__ FloatType operator()(size_type idx)
   {
-    if (strings_column.is_null(idx)) return static_cast<FloatType>(0);
+    double value = 0;
+    bool valid   = false;
+    if (!strings_column.is_null(idx)) {
+      auto const d_str = strings_column.element<string_view>(idx);
+      valid = cudf::detail::parse_double(d_str.data(), d_str.data() + d_str.size_bytes(), value);
+    }
+    if (d_valids) d_valids[idx] = valid;
     // the cast to FloatType will create predictable results
     // for floats that are larger than the FloatType can hold
-    return static_cast<FloatType>(stod(strings_column.element<string_view>(idx)));
+    return static_cast<FloatType>(value);
   }
 };
 
@@ -145,6 +78,7 @@ struct dispatch_to_floats_fn {
             std::enable_if_t<std::is_floating_point<FloatType>::value>* = nullptr>
   void operator()(column_device_view const& strings_column,
                   mutable_column_view& output_column,
+                  bool* d_valids,
                   cudaStream_t stream) const
   {
     auto d_results = output_column.data<FloatType>();
@@ -152,11 +86,11 @@ struct dispatch_to_floats_fn {
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_column.size()),
                       d_results,
-                      string_to_float_fn<FloatType>{strings_column});
+                      string_to_float_fn<FloatType>{strings_column, d_valids});
   }
   // non-integral types throw an exception
   template <typename T, std::enable_if_t<not std::is_floating_point<T>::value>* = nullptr>
-  void operator()(column_device_view const&, mutable_column_view&, cudaStream_t) const
+  void operator()(column_device_view const&, mutable_column_view&, bool*, cudaStream_t) const
   {
     CUDF_FAIL("Output for to_floats must be a float type.");
   }
@@ -167,6 +101,7 @@ struct dispatch_to_floats_fn {
 // This will convert a strings column into any float column type.
 std::unique_ptr<column> to_floats(strings_column_view const& strings,
                                   data_type output_type,
+                                  bool invalid_as_null,
                                   cudaStream_t stream,
                                   rmm::mr::device_memory_resource* mr)
 {
@@ -182,9 +117,18 @@ std::unique_ptr<column> to_floats(strings_column_view const& strings,
                                      stream,
                                      mr);
   auto results_view = results->mutable_view();
+  // flags null and malformed strings when these should become null entries
+  rmm::device_vector<bool> valids(invalid_as_null ? strings_count : 0);
+  auto d_valids = invalid_as_null ? valids.data().get() : nullptr;
   // fill output column with floats
-  type_dispatcher(output_type, dispatch_to_floats_fn{}, d_strings, results_view, stream);
-  results->set_null_count(strings.null_count());
+  type_dispatcher(output_type, dispatch_to_floats_fn{}, d_strings, results_view, d_valids, stream);
+  if (invalid_as_null) {
+    auto null_mask = cudf::detail::valid_if(
+      valids.begin(), valids.end(), thrust::identity<bool>{}, stream, mr);
+    results->set_null_mask(std::move(null_mask.first), null_mask.second);
+  } else {
+    results->set_null_count(strings.null_count());
+  }
   return results;
 }
 
@@ -197,7 +141,16 @@ std::unique_ptr<column> to_floats(strings_column_view const& strings,
                                   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::to_floats(strings, output_type, cudaStream_t{}, mr);
+  return detail::to_floats(strings, output_type, false, cudaStream_t{}, mr);
+}
+
+std::unique_ptr<column> to_floats(strings_column_view const& strings,
+                                  data_type output_type,
+                                  bool invalid_as_null,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_floats(strings, output_type, invalid_as_null, cudaStream_t{}, mr);
 }
 
 namespace detail {
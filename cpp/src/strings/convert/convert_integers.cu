@@ -18,6 +18,8 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/number_parsing.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/strings/convert/convert_integers.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -28,6 +30,7 @@
 #include <strings/utilities.cuh>
 
 #include <rmm/thrust_rmm_allocator.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
@@ -43,6 +46,7 @@ namespace {
 template <typename IntegerType>
 struct string_to_integer_fn {
   const column_device_view strings_column;  // strings to convert
+  bool* d_valids;                           // optional: false for null or malformed strings
 
   /**
    * @brief Converts a single string into an integer.
@@ -50,34 +54,19 @@ struct string_to_integer_fn {
    * The '+' and '-' are allowed but only at the beginning of the string.
    * The string is expected to contain base-10 [0-9] characters only.
    * Any other character will end the parse.
-   * Overflow of the int64 type is not detected.
    */
-  __device__ int64_t string_to_integer(string_view const& d_str)
-  {
-    int64_t value   = 0;
-    size_type bytes = d_str.size_bytes();
-    if (bytes == 0) return value;
-    const char* ptr = d_str.data();
-    int sign        = 1;
-    if (*ptr == '-' || *ptr == '+') {
-      sign = (*ptr == '-' ? -1 : 1);
-      ++ptr;
-      --bytes;
-    }
-    for (size_type idx = 0; idx < bytes; ++idx) {
-      char chr = *ptr++;
-      if (chr < '0' || chr > '9') break;
-      value = (value * 10) + static_cast<int64_t>(chr - '0');
-    }
-    return value * static_cast<int64_t>(sign);
-  }
-
   __device__ IntegerType operator()(size_type idx)
   {
-    if (strings_column.is_null(idx)) return static_cast<IntegerType>(0);
-    // the cast to IntegerType will create predictable results
-    // for integers that are larger than the IntegerType can hold
-    return static_cast<IntegerType>(string_to_integer(strings_column.element<string_view>(idx)));
+    IntegerType value = 0;
+    bool valid        = false;
+    if (!strings_column.is_null(idx)) {
+      auto const d_str = strings_column.element<string_view>(idx);
+      // the cast to IntegerType will create predictable results
+      // for integers that are larger than the IntegerType can hold
+      valid = cudf::detail::parse_integer(d_str.data(), d_str.data() + d_str.size_bytes(), value);
+    }
+    if (d_valids) d_valids[idx] = valid;
+    return value;
   }
 };
 
@@ -90,6 +79,7 @@ struct dispatch_to_integers_fn {
   template <typename IntegerType, std::enable_if_t<std::is_integral<IntegerType>::value>* = nullptr>
   void operator()(column_device_view const& strings_column,
                   mutable_column_view& output_column,
+                  bool* d_valids,
                   cudaStream_t stream) const
   {
     auto d_results = output_column.data<IntegerType>();
@@ -97,11 +87,11 @@ struct dispatch_to_integers_fn {
                       thrust::make_counting_iterator<size_type>(0),
                       thrust::make_counting_iterator<size_type>(strings_column.size()),
                       d_results,
-                      string_to_integer_fn<IntegerType>{strings_column});
+                      string_to_integer_fn<IntegerType>{strings_column, d_valids});
   }
   // non-integral types throw an exception
   template <typename T, std::enable_if_t<not std::is_integral<T>::value>* = nullptr>
-  void operator()(column_device_view const&, mutable_column_view&, cudaStream_t) const
+  void operator()(column_device_view const&, mutable_column_view&, bool*, cudaStream_t) const
   {
     CUDF_FAIL("Output for to_integers must be an integral type.");
   }
@@ -110,6 +100,7 @@ struct dispatch_to_integers_fn {
 template <>
 void dispatch_to_integers_fn::operator()<bool>(column_device_view const&,
                                                mutable_column_view&,
+                                               bool*,
                                                cudaStream_t) const
 {
   CUDF_FAIL("Output for to_integers must not be a boolean type.");
@@ -120,6 +111,7 @@ void dispatch_to_integers_fn::operator()<bool>(column_device_view const&,
 // This will convert a strings column into any integer column type.
 std::unique_ptr<column> to_integers(strings_column_view const& strings,
                                     data_type output_type,
+                                    bool invalid_as_null,
                                     cudaStream_t stream,
                                     rmm::mr::device_memory_resource* mr)
 {
@@ -135,9 +127,19 @@ std::unique_ptr<column> to_integers(strings_column_view const& strings,
                                      stream,
                                      mr);
   auto results_view = results->mutable_view();
+  // flags null and malformed strings when these should become null entries
+  rmm::device_vector<bool> valids(invalid_as_null ? strings_count : 0);
+  auto d_valids = invalid_as_null ? valids.data().get() : nullptr;
   // fill output column with integers
-  type_dispatcher(output_type, dispatch_to_integers_fn{}, d_strings, results_view, stream);
-  results->set_null_count(strings.null_count());
+  type_dispatcher(
+    output_type, dispatch_to_integers_fn{}, d_strings, results_view, d_valids, stream);
+  if (invalid_as_null) {
+    auto null_mask = cudf::detail::valid_if(
+      valids.begin(), valids.end(), thrust::identity<bool>{}, stream, mr);
+    results->set_null_mask(std::move(null_mask.first), null_mask.second);
+  } else {
+    results->set_null_count(strings.null_count());
+  }
   return results;
 }
 
@@ -149,7 +151,16 @@ std::unique_ptr<column> to_integers(strings_column_view const& strings,
                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::to_integers(strings, output_type, cudaStream_t{}, mr);
+  return detail::to_integers(strings, output_type, false, cudaStream_t{}, mr);
+}
+
+std::unique_ptr<column> to_integers(strings_column_view const& strings,
+                                    data_type output_type,
+                                    bool invalid_as_null,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_integers(strings, output_type, invalid_as_null, cudaStream_t{}, mr);
 }
 
 namespace detail {
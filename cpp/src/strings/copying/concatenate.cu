@@ -22,6 +22,9 @@
 #include <cudf/strings/detail/concatenate.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
+
+#include <rmm/device_uvector.hpp>
 
 #include <thrust/binary_search.h>
 #include <thrust/for_each.h>
@@ -44,9 +47,6 @@ constexpr bool use_fused_kernel_heuristic(bool const has_nulls,
                    : total_bytes < num_columns * 393216;  // midpoint of 262144 and 524288
 }
 
-// Using a functor instead of a lambda as a workaround for:
-// error: The enclosing parent function ("create_strings_device_views") for an
-// extended __device__ lambda must not have deduced return type
 struct chars_size_transform {
   __device__ size_t operator()(column_device_view const& col) const
   {
@@ -60,63 +60,37 @@ struct chars_size_transform {
   }
 };
 
-auto create_strings_device_views(std::vector<column_view> const& views, cudaStream_t stream)
+/**
+ * @brief Computes the prefix sum of the sizes of the chars of the strings columns
+ *
+ * @param d_views Device views of the strings columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The `num_views + 1` partition offsets and the total size of the chars
+ */
+std::pair<rmm::device_uvector<size_t>, size_t> create_partition_offsets(
+  cudf::detail::concatenate_device_views const& d_views, cudaStream_t stream)
 {
-  // Create device views for each input view
-  using CDViewPtr =
-    decltype(column_device_view::create(std::declval<column_view>(), std::declval<cudaStream_t>()));
-  auto device_view_owners = std::vector<CDViewPtr>(views.size());
-  std::transform(
-    views.cbegin(), views.cend(), device_view_owners.begin(), [stream](auto const& col) {
-      return column_device_view::create(col, stream);
-    });
-
-  // Assemble contiguous array of device views
-  auto device_views = thrust::host_vector<column_device_view>();
-  device_views.reserve(views.size());
-  std::transform(device_view_owners.cbegin(),
-                 device_view_owners.cend(),
-                 std::back_inserter(device_views),
-                 [](auto const& col) { return *col; });
-  auto d_views = rmm::device_vector<column_device_view>{device_views};
-
-  // Compute the partition offsets and size of offset column
   // Note: Using 64-bit size_t so we can detect overflow of 32-bit size_type
-  auto input_offsets = thrust::host_vector<size_t>(views.size() + 1);
-  thrust::transform_inclusive_scan(
-    thrust::host,
-    device_views.cbegin(),
-    device_views.cend(),
-    std::next(input_offsets.begin()),
-    [](auto const& col) { return static_cast<size_t>(col.size()); },
-    thrust::plus<size_t>{});
-  auto const d_input_offsets = rmm::device_vector<size_t>{input_offsets};
-  auto const output_size     = input_offsets.back();
-
-  // Compute the partition offsets and size of chars column
-  // Note: Using 64-bit size_t so we can detect overflow of 32-bit size_type
-  // Note: Using separate transform and inclusive_scan because
-  // transform_inclusive_scan fails to compile with:
-  // error: the default constructor of "cudf::column_device_view" cannot be
-  // referenced -- it is a deleted function
-  auto d_partition_offsets = rmm::device_vector<size_t>(views.size() + 1);
+  rmm::device_uvector<size_t> d_partition_offsets(d_views.num_views + 1, stream);
+  CUDA_TRY(cudaMemsetAsync(d_partition_offsets.data(), 0, sizeof(size_t), stream));
   thrust::transform(rmm::exec_policy(stream)->on(stream),
-                    d_views.cbegin(),
-                    d_views.cend(),
-                    std::next(d_partition_offsets.begin()),
+                    d_views.views,
+                    d_views.views + d_views.num_views,
+                    d_partition_offsets.data() + 1,
                     chars_size_transform{});
   thrust::inclusive_scan(rmm::exec_policy(stream)->on(stream),
-                         d_partition_offsets.cbegin(),
-                         d_partition_offsets.cend(),
-                         d_partition_offsets.begin());
-  auto const output_chars_size = d_partition_offsets.back();
-
-  return std::make_tuple(std::move(device_view_owners),
-                         std::move(d_views),
-                         std::move(d_input_offsets),
-                         std::move(d_partition_offsets),
-                         output_size,
-                         output_chars_size);
+                         d_partition_offsets.data() + 1,
+                         d_partition_offsets.data() + d_partition_offsets.size(),
+                         d_partition_offsets.data() + 1);
+
+  size_t output_chars_size{};
+  CUDA_TRY(cudaMemcpyAsync(&output_chars_size,
+                           d_partition_offsets.data() + d_views.num_views,
+                           sizeof(size_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return std::make_pair(std::move(d_partition_offsets), output_chars_size);
 }
 
 template <size_type block_size, bool Nullable>
@@ -216,12 +190,12 @@ std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
                                     cudaStream_t stream)
 {
   // Compute output sizes
-  auto const device_views         = create_strings_device_views(columns, stream);
-  auto const& d_views             = std::get<1>(device_views);
-  auto const& d_input_offsets     = std::get<2>(device_views);
-  auto const& d_partition_offsets = std::get<3>(device_views);
-  auto const strings_count        = std::get<4>(device_views);
-  auto const total_bytes          = std::get<5>(device_views);
+  auto const d_views              = cudf::detail::create_device_views(columns, stream);
+  auto const partitions           = create_partition_offsets(d_views, stream);
+  auto const* d_input_offsets     = d_views.offsets;
+  auto const* d_partition_offsets = partitions.first.data();
+  auto const strings_count        = d_views.output_size;
+  auto const total_bytes          = partitions.second;
   auto const offsets_count        = strings_count + 1;
 
   if (strings_count == 0) { return make_empty_strings_column(mr, stream); }
@@ -231,8 +205,7 @@ std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
   CUDF_EXPECTS(total_bytes <= std::numeric_limits<size_type>::max(),
                "total size of strings is too large for cudf column");
 
-  bool const has_nulls =
-    std::any_of(columns.begin(), columns.end(), [](auto const& col) { return col.has_nulls(); });
+  bool const has_nulls = cudf::detail::may_have_nulls(columns);
 
   // create chars column
   auto chars_column =
@@ -253,23 +226,28 @@ std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
   }
 
   {  // Copy offsets columns with single kernel launch
-    rmm::device_scalar<size_type> d_valid_count(0);
+    rmm::device_scalar<size_type> d_valid_count(0, stream, get_scratch_resource());
 
     constexpr size_type block_size{256};
     cudf::detail::grid_1d config(offsets_count, block_size);
     auto const kernel = has_nulls ? fused_concatenate_string_offset_kernel<block_size, true>
                                   : fused_concatenate_string_offset_kernel<block_size, false>;
     kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-      d_views.data().get(),
-      d_input_offsets.data().get(),
-      d_partition_offsets.data().get(),
-      static_cast<size_type>(d_views.size()),
+      d_views.views,
+      d_input_offsets,
+      d_partition_offsets,
+      d_views.num_views,
       strings_count,
       d_new_offsets,
       reinterpret_cast<bitmask_type*>(null_mask.data()),
       d_valid_count.data());
 
-    if (has_nulls) { null_count = strings_count - d_valid_count.value(stream); }
+    if (has_nulls) {
+      null_count = cudf::detail::concatenated_null_count(columns);
+      if (null_count == cudf::UNKNOWN_NULL_COUNT) {
+        null_count = strings_count - d_valid_count.value(stream);
+      }
+    }
   }
 
   if (total_bytes > 0) {
@@ -280,11 +258,7 @@ std::unique_ptr<column> concatenate(std::vector<column_view> const& columns,
       cudf::detail::grid_1d config(total_bytes, block_size);
       auto const kernel = fused_concatenate_string_chars_kernel;
       kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
-        d_views.data().get(),
-        d_partition_offsets.data().get(),
-        static_cast<size_type>(d_views.size()),
-        total_bytes,
-        d_new_chars);
+        d_views.views, d_partition_offsets, d_views.num_views, total_bytes, d_new_chars);
     } else {
       // Memcpy each input chars column (more efficient for very large strings)
       for (auto column = columns.begin(); column != columns.end(); ++column) {
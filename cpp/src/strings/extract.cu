@@ -17,8 +17,10 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/extract.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -26,6 +28,9 @@
 #include <strings/regex/regex.cuh>
 #include <strings/utilities.hpp>
 
+#include <thrust/for_each.h>
+#include <thrust/scan.h>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -36,6 +41,10 @@ namespace {
  * @brief This functor handles extracting strings by applying the compiled regex pattern
  * and creating string_index_pairs for all the substrings.
  *
+ * The pairs of all the groups of a string are written by one thread, the pair of the group
+ * `column_index` at `d_indices[column_index * strings_count + idx]`, so that the pattern is found
+ * once per string rather than once per group.
+ *
  * @tparam stack_size Correlates to the regex instructions state to maintain for each string.
  *         Each instruction requires a fixed amount of overhead data.
  */
@@ -43,27 +52,108 @@ template <size_t stack_size>
 struct extract_fn {
   reprog_device prog;
   column_device_view d_strings;
-  size_type column_index;
+  size_type groups;
+  string_index_pair* d_indices;
+
+  __device__ void operator()(size_type idx)
+  {
+    u_char data1[stack_size], data2[stack_size];
+    prog.set_stack_mem(data1, data2);
+    size_t const strings_count = d_strings.size();
+    for (size_type column_index = 0; column_index < groups; ++column_index)
+      d_indices[column_index * strings_count + idx] = string_index_pair{nullptr, 0};
+    if (d_strings.is_null(idx)) return;
+    string_view d_str = d_strings.element<string_view>(idx);
+    int32_t begin     = 0;
+    int32_t end       = -1;  // handles empty strings automatically
+    if (prog.find(idx, d_str, begin, end) <= 0) return;
+    for (size_type column_index = 0; column_index < groups; ++column_index) {
+      int32_t group_begin = begin;
+      int32_t group_end   = end;
+      if (prog.extract(idx, d_str, group_begin, group_end, column_index) > 0) {
+        auto offset = d_str.byte_offset(group_begin);
+        // build index-pair
+        d_indices[column_index * strings_count + idx] =
+          string_index_pair{d_str.data() + offset, d_str.byte_offset(group_end) - offset};
+      }
+    }
+  }
+};
+
+/**
+ * @brief Counts the groups of all the matches of the regex pattern within each string or, if
+ * `d_groups` is set, writes their string_index_pairs at the offset of the string.
+ *
+ * The groups of each match are written in order, followed by those of the next match.
+ */
+template <size_t stack_size>
+struct extract_all_fn {
+  reprog_device prog;
+  column_device_view d_strings;
+  size_type groups;
+  int32_t const* d_offsets{};
+  string_index_pair* d_groups{};
 
-  __device__ string_index_pair operator()(size_type idx)
+  __device__ size_type operator()(size_type idx)
   {
+    if (d_strings.is_null(idx)) return 0;
     u_char data1[stack_size], data2[stack_size];
     prog.set_stack_mem(data1, data2);
-    if (d_strings.is_null(idx)) return string_index_pair{nullptr, 0};
     string_view d_str = d_strings.element<string_view>(idx);
-    string_index_pair result{nullptr, 0};
-    int32_t begin = 0;
-    int32_t end   = -1;  // handles empty strings automatically
-    if ((prog.find(idx, d_str, begin, end) > 0) &&
-        (prog.extract(idx, d_str, begin, end, column_index) > 0)) {
-      auto offset = d_str.byte_offset(begin);
-      // build index-pair
-      result = string_index_pair{d_str.data() + offset, d_str.byte_offset(end) - offset};
+    auto d_output     = d_groups ? d_groups + d_offsets[idx] : nullptr;
+    auto nchars       = d_str.length();
+    int32_t spos      = 0;
+    int32_t epos      = nchars;
+    size_type count   = 0;
+    while (spos <= nchars) {
+      if (prog.find(idx, d_str, spos, epos) <= 0) break;  // no more matches found
+      for (size_type column_index = 0; d_output && column_index < groups; ++column_index) {
+        int32_t group_begin = spos;
+        int32_t group_end   = epos;
+        string_index_pair result{nullptr, 0};
+        if (prog.extract(idx, d_str, group_begin, group_end, column_index) > 0) {
+          auto const offset = d_str.byte_offset(group_begin);
+          auto const size   = d_str.byte_offset(group_end) - offset;
+          result            = string_index_pair{d_str.data() + offset, size};
+        }
+        d_output[count + column_index] = result;
+      }
+      count += groups;
+      spos  = epos > spos ? epos : spos + 1;
+      epos  = nchars;
     }
-    return result;
+    return count;
   }
 };
 
+/**
+ * @brief Runs `extract_all_fn` over every string: counts the groups into `d_offsets` if
+ * `d_groups` is null and writes them otherwise
+ */
+template <size_t stack_size>
+void extract_all_pass(reprog_device& d_prog,
+                      column_device_view const& d_strings,
+                      size_type groups,
+                      int32_t* d_offsets,
+                      string_index_pair* d_groups,
+                      cudaStream_t stream)
+{
+  auto const strings_count = d_strings.size();
+  if (d_groups == nullptr) {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(strings_count),
+                      d_offsets,
+                      extract_all_fn<stack_size>{d_prog, d_strings, groups});
+  } else {
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      strings_count,
+      extract_all_fn<stack_size>{d_prog, d_strings, groups, d_offsets, d_groups});
+  }
+}
+
 }  // namespace
 
 //
@@ -84,36 +174,84 @@ std::unique_ptr<table> extract(
   int groups = d_prog.group_counts();
   CUDF_EXPECTS(groups > 0, "Group indicators not found in regex pattern");
 
-  // build a result column for each group
-  std::vector<std::unique_ptr<column>> results;
+  // extract all the groups of each string at once
   auto execpol     = rmm::exec_policy(stream);
   auto regex_insts = d_prog.insts_counts();
+  rmm::device_vector<string_index_pair> indices(static_cast<size_t>(strings_count) * groups);
+  string_index_pair* d_indices = indices.data().get();
+
+  if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
+    thrust::for_each_n(execpol->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       strings_count,
+                       extract_fn<RX_STACK_SMALL>{d_prog, d_strings, groups, d_indices});
+  else if (regex_insts <= RX_MEDIUM_INSTS)
+    thrust::for_each_n(execpol->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       strings_count,
+                       extract_fn<RX_STACK_MEDIUM>{d_prog, d_strings, groups, d_indices});
+  else
+    thrust::for_each_n(execpol->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       strings_count,
+                       extract_fn<RX_STACK_LARGE>{d_prog, d_strings, groups, d_indices});
+
+  // build a result column for each group
+  std::vector<std::unique_ptr<column>> results;
   for (int32_t column_index = 0; column_index < groups; ++column_index) {
-    rmm::device_vector<string_index_pair> indices(strings_count);
-    string_index_pair* d_indices = indices.data().get();
+    auto const begin = indices.begin() + static_cast<size_t>(column_index) * strings_count;
+    results.emplace_back(make_strings_column(begin, begin + strings_count, mr, stream));
+  }
+  return std::make_unique<table>(std::move(results));
+}
 
+//
+std::unique_ptr<column> extract_all(
+  strings_column_view const& strings,
+  std::string const& pattern,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  auto strings_count  = strings.size();
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+
+  // compile regex into device object
+  auto prog   = reprog_device::create(pattern, get_character_flags_table(), strings_count, stream);
+  auto d_prog = *prog;
+  // extract should include groups
+  int groups = d_prog.group_counts();
+  CUDF_EXPECTS(groups > 0, "Group indicators not found in regex pattern");
+
+  // the first pass counts the groups of each string and the second writes them
+  auto regex_insts    = d_prog.insts_counts();
+  auto const run_pass = [&](int32_t* d_offsets, string_index_pair* d_groups) {
     if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
-      thrust::transform(execpol->on(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(strings_count),
-                        d_indices,
-                        extract_fn<RX_STACK_SMALL>{d_prog, d_strings, column_index});
+      extract_all_pass<RX_STACK_SMALL>(d_prog, d_strings, groups, d_offsets, d_groups, stream);
     else if (regex_insts <= RX_MEDIUM_INSTS)
-      thrust::transform(execpol->on(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(strings_count),
-                        d_indices,
-                        extract_fn<RX_STACK_MEDIUM>{d_prog, d_strings, column_index});
+      extract_all_pass<RX_STACK_MEDIUM>(d_prog, d_strings, groups, d_offsets, d_groups, stream);
     else
-      thrust::transform(execpol->on(stream),
-                        thrust::make_counting_iterator<size_type>(0),
-                        thrust::make_counting_iterator<size_type>(strings_count),
-                        d_indices,
-                        extract_fn<RX_STACK_LARGE>{d_prog, d_strings, column_index});
-    //
-    results.emplace_back(make_strings_column(indices, stream, mr));
-  }
-  return std::make_unique<table>(std::move(results));
+      extract_all_pass<RX_STACK_LARGE>(d_prog, d_strings, groups, d_offsets, d_groups, stream);
+  };
+
+  auto offsets = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  run_pass(d_offsets, nullptr);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream), d_offsets, d_offsets + strings_count + 1, d_offsets);
+
+  // last entry is the total number of groups
+  auto total_groups = cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+  rmm::device_vector<string_index_pair> extracted(total_groups);
+  run_pass(d_offsets, extracted.data().get());
+
+  auto strings_output = make_strings_column(extracted.begin(), extracted.end(), mr, stream);
+  return make_lists_column(strings_count,
+                           std::move(offsets),
+                           std::move(strings_output),
+                           strings.null_count(),
+                           copy_bitmask(strings.parent(), stream, mr));
 }
 
 }  // namespace detail
@@ -128,5 +266,13 @@ std::unique_ptr<table> extract(strings_column_view const& strings,
   return detail::extract(strings, pattern, mr);
 }
 
+std::unique_ptr<column> extract_all(strings_column_view const& strings,
+                                    std::string const& pattern,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_all(strings, pattern, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
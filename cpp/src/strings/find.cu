@@ -17,19 +17,123 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/find.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <thrust/iterator/permutation_iterator.h>
 #include <thrust/transform.h>
 
 namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
+constexpr int WARP_PER_STRING_BLOCK_SIZE{256};
+
+/**
+ * @brief Returns the byte position of the first (or last) occurrence of a non-empty
+ * `d_target` in `d_string` using all the lanes of a warp.
+ *
+ * Each iteration tests 32 consecutive candidate positions, one per lane; a ballot
+ * selects the candidate closest to the search origin. All lanes of the warp
+ * must call this with the same arguments.
+ *
+ * @return Byte position of the match or -1 if not found
+ */
+__device__ size_type warp_find(string_view const d_string, string_view const d_target, bool forward)
+{
+  auto const lane  = static_cast<size_type>(threadIdx.x % cudf::detail::warp_size);
+  auto const bytes = d_target.size_bytes();
+  auto const last  = d_string.size_bytes() - bytes;
+  for (size_type base = 0; base <= last; base += cudf::detail::warp_size) {
+    auto const pos = forward ? base + lane : last - base - lane;
+    bool const found =
+      (base + lane <= last) && (d_target.compare(d_string.data() + pos, bytes) == 0);
+    auto const ballot = __ballot_sync(0xffffffff, found);
+    if (ballot) {
+      auto const first_lane = __ffs(ballot) - 1;
+      return forward ? base + first_lane : last - base - first_lane;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief Returns the number of characters in the first `bytes` bytes of `data`
+ * counted by all the lanes of a warp. The result is valid in every lane.
+ */
+__device__ size_type warp_characters_in_bytes(char const* data, size_type bytes)
+{
+  auto const lane = static_cast<size_type>(threadIdx.x % cudf::detail::warp_size);
+  size_type count = 0;
+  for (size_type idx = lane; idx < bytes; idx += cudf::detail::warp_size) {
+    count += (static_cast<uint8_t>(data[idx]) & 0xC0) != 0x80;
+  }
+  for (int offset = cudf::detail::warp_size / 2; offset > 0; offset /= 2) {
+    count += __shfl_xor_sync(0xffffffff, count, offset);
+  }
+  return count;
+}
+
+/**
+ * @brief Sets the character position of `d_target` in each of the given long strings,
+ * processing one string per warp.
+ */
+__global__ void find_long_strings_kernel(column_device_view const d_strings,
+                                         string_view const d_target,
+                                         size_type const* rows,
+                                         size_type rows_count,
+                                         bool forward,
+                                         int32_t* d_results)
+{
+  auto const warps_count = static_cast<size_type>(gridDim.x * blockDim.x / cudf::detail::warp_size);
+  auto const lane        = threadIdx.x % cudf::detail::warp_size;
+  for (size_type warp_idx = (blockIdx.x * blockDim.x + threadIdx.x) / cudf::detail::warp_size;
+       warp_idx < rows_count;
+       warp_idx += warps_count) {
+    auto const idx      = rows[warp_idx];
+    auto const d_string = d_strings.element<string_view>(idx);
+    auto const pos      = warp_find(d_string, d_target, forward);
+    auto const position = pos < 0 ? pos : warp_characters_in_bytes(d_string.data(), pos);
+    if (lane == 0) d_results[idx] = position;
+  }
+}
+
+/**
+ * @brief Sets whether `d_target` is found in each of the given long strings,
+ * processing one string per warp.
+ */
+__global__ void contains_long_strings_kernel(column_device_view const d_strings,
+                                             string_view const d_target,
+                                             size_type const* rows,
+                                             size_type rows_count,
+                                             bool* d_results)
+{
+  auto const warps_count = static_cast<size_type>(gridDim.x * blockDim.x / cudf::detail::warp_size);
+  auto const lane        = threadIdx.x % cudf::detail::warp_size;
+  for (size_type warp_idx = (blockIdx.x * blockDim.x + threadIdx.x) / cudf::detail::warp_size;
+       warp_idx < rows_count;
+       warp_idx += warps_count) {
+    auto const idx   = rows[warp_idx];
+    bool const found = warp_find(d_strings.element<string_view>(idx), d_target, true) >= 0;
+    if (lane == 0) d_results[idx] = found;
+  }
+}
+
+/**
+ * @brief Returns true if some string in the column may be long enough to be
+ * processed by a warp per string.
+ */
+bool has_long_strings(strings_column_view const& strings)
+{
+  return strings.chars_size() >= LONG_STRING_THRESHOLD;
+}
+
 /**
  * @brief Utility to return integer column indicating the postion of
  * target string within each string in a strings column.
@@ -43,6 +147,7 @@ namespace {
  * @param start First character position to start the search.
  * @param stop Last character position (exclusive) to end the search.
  * @param pfn Functor used for locating `target` in each string.
+ * @param forward True to locate the first occurrence of `target`, false for the last.
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return New integer column with character position values.
@@ -53,6 +158,7 @@ std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                 size_type start,
                                 size_type stop,
                                 FindFunction& pfn,
+                                bool forward,
                                 rmm::mr::device_memory_resource* mr,
                                 cudaStream_t stream)
 {
@@ -73,18 +179,37 @@ std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                      mr);
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<int32_t>();
-  // set the position values by evaluating the passed function
-  thrust::transform(rmm::exec_policy(stream)->on(stream),
-                    thrust::make_counting_iterator<size_type>(0),
-                    thrust::make_counting_iterator<size_type>(strings_count),
-                    d_results,
-                    [d_strings, pfn, d_target, start, stop] __device__(size_type idx) {
-                      int32_t position = -1;
-                      if (!d_strings.is_null(idx))
-                        position = static_cast<int32_t>(
-                          pfn(d_strings.element<string_view>(idx), d_target, start, stop));
-                      return position;
-                    });
+  auto find_string  = [d_strings, pfn, d_target, start, stop] __device__(size_type idx) {
+    int32_t position = -1;
+    if (!d_strings.is_null(idx))
+      position =
+        static_cast<int32_t>(pfn(d_strings.element<string_view>(idx), d_target, start, stop));
+    return position;
+  };
+  // long strings searched over their entire length are handled by a warp per string
+  if (start == 0 && stop < 0 && !d_target.empty() && has_long_strings(strings)) {
+    auto const bins = bin_strings_by_length(d_strings, LONG_STRING_THRESHOLD, stream);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      bins.short_rows.begin(),
+                      bins.short_rows.end(),
+                      thrust::make_permutation_iterator(d_results, bins.short_rows.begin()),
+                      find_string);
+    auto const long_count = static_cast<size_type>(bins.long_rows.size());
+    if (long_count > 0) {
+      cudf::detail::grid_1d grid{long_count * cudf::detail::warp_size,
+                                 WARP_PER_STRING_BLOCK_SIZE};
+      find_long_strings_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+        d_strings, d_target, bins.long_rows.data().get(), long_count, forward, d_results);
+      CHECK_CUDA(stream);
+    }
+  } else {
+    // set the position values by evaluating the passed function
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(strings_count),
+                      d_results,
+                      find_string);
+  }
   results->set_null_count(strings.null_count());
   return results;
 }
@@ -107,7 +232,7 @@ std::unique_ptr<column> find(strings_column_view const& strings,
     return d_string.find(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, mr, stream);
+  return find_fn(strings, target, start, stop, pfn, true, mr, stream);
 }
 
 std::unique_ptr<column> rfind(strings_column_view const& strings,
@@ -126,7 +251,7 @@ std::unique_ptr<column> rfind(strings_column_view const& strings,
     return d_string.rfind(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, mr, stream);
+  return find_fn(strings, target, start, stop, pfn, false, mr, stream);
 }
 
 }  // namespace detail
@@ -166,6 +291,8 @@ namespace {
  * @param strings Column of strings to check for target.
  * @param target UTF-8 encoded string to check in strings column.
  * @param pfn Returns bool value if target is found in the given string.
+ * @param anywhere True if `pfn` searches the entire string for `target`.
+ *        Long strings are then searched by a warp per string instead.
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @return New BOOL column.
@@ -174,6 +301,7 @@ template <typename BoolFunction>
 std::unique_ptr<column> contains_fn(strings_column_view const& strings,
                                     string_scalar const& target,
                                     BoolFunction pfn,
+                                    bool anywhere,
                                     rmm::mr::device_memory_resource* mr,
                                     cudaStream_t stream)
 {
@@ -201,16 +329,33 @@ std::unique_ptr<column> contains_fn(strings_column_view const& strings,
                                      mr);
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<bool>();
-  // set the bool values by evaluating the passed function
-  thrust::transform(rmm::exec_policy(stream)->on(stream),
-                    thrust::make_counting_iterator<size_type>(0),
-                    thrust::make_counting_iterator<size_type>(strings_count),
-                    d_results,
-                    [d_strings, pfn, d_target] __device__(size_type idx) {
-                      if (!d_strings.is_null(idx))
-                        return bool{pfn(d_strings.element<string_view>(idx), d_target)};
-                      return false;
-                    });
+  auto check_string = [d_strings, pfn, d_target] __device__(size_type idx) {
+    if (!d_strings.is_null(idx)) return bool{pfn(d_strings.element<string_view>(idx), d_target)};
+    return false;
+  };
+  if (anywhere && has_long_strings(strings)) {
+    auto const bins = bin_strings_by_length(d_strings, LONG_STRING_THRESHOLD, stream);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      bins.short_rows.begin(),
+                      bins.short_rows.end(),
+                      thrust::make_permutation_iterator(d_results, bins.short_rows.begin()),
+                      check_string);
+    auto const long_count = static_cast<size_type>(bins.long_rows.size());
+    if (long_count > 0) {
+      cudf::detail::grid_1d grid{long_count * cudf::detail::warp_size,
+                                 WARP_PER_STRING_BLOCK_SIZE};
+      contains_long_strings_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+        d_strings, d_target, bins.long_rows.data().get(), long_count, d_results);
+      CHECK_CUDA(stream);
+    }
+  } else {
+    // set the bool values by evaluating the passed function
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(strings_count),
+                      d_results,
+                      check_string);
+  }
   results->set_null_count(strings.null_count());
   return results;
 }
@@ -287,7 +432,7 @@ std::unique_ptr<column> contains(
   auto pfn = [] __device__(string_view d_string, string_view d_target) {
     return d_string.find(d_target) >= 0;
   };
-  return contains_fn(strings, target, pfn, mr, stream);
+  return contains_fn(strings, target, pfn, true, mr, stream);
 }
 
 std::unique_ptr<column> starts_with(
@@ -299,7 +444,7 @@ std::unique_ptr<column> starts_with(
   auto pfn = [] __device__(string_view d_string, string_view d_target) {
     return d_string.find(d_target) == 0;
   };
-  return contains_fn(strings, target, pfn, mr, stream);
+  return contains_fn(strings, target, pfn, false, mr, stream);
 }
 
 std::unique_ptr<column> starts_with(
@@ -327,7 +472,7 @@ std::unique_ptr<column> ends_with(
     return d_string.find(d_target, str_length - tgt_length) >= 0;
   };
 
-  return contains_fn(strings, target, pfn, mr, stream);
+  return contains_fn(strings, target, pfn, false, mr, stream);
 }
 
 std::unique_ptr<column> ends_with(
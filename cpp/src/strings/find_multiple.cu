@@ -20,8 +20,12 @@
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/utilities/error.hpp>
+#include <strings/aho_corasick/aho_corasick.cuh>
 
+#include <thrust/for_each.h>
+#include <thrust/scan.h>
 #include <thrust/transform.h>
 
 namespace cudf {
@@ -70,6 +74,120 @@ std::unique_ptr<column> find_multiple(
   return results;
 }
 
+std::unique_ptr<column> contains_any(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  aho_corasick const automaton(targets, stream);
+  auto d_automaton    = automaton.view();
+  auto strings_count  = strings.size();
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+
+  auto results   = make_numeric_column(data_type{type_id::BOOL8},
+                                     strings_count,
+                                     copy_bitmask(strings.parent(), stream, mr),
+                                     strings.null_count(),
+                                     stream,
+                                     mr);
+  auto d_results = results->mutable_view().data<bool>();
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    d_results,
+                    [d_strings, d_automaton] __device__(size_type idx) {
+                      if (d_strings.is_null(idx)) return false;
+                      string_view d_str = d_strings.element<string_view>(idx);
+                      return d_automaton.contains(d_str.data(), d_str.size_bytes());
+                    });
+  results->set_null_count(strings.null_count());
+  return results;
+}
+
+namespace {
+/**
+ * @brief Counts the occurrences of the targets in each string, or writes them
+ * when the output columns are set.
+ */
+struct find_all_literals_fn {
+  column_device_view const d_strings;
+  aho_corasick_device const d_automaton;
+  size_type const* d_offsets{};
+  size_type* d_string_indices{};
+  size_type* d_target_indices{};
+  size_type* d_positions{};
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return 0;
+    string_view d_str = d_strings.element<string_view>(idx);
+    auto const data   = d_str.data();
+    size_type count   = 0;
+    // character position of the last occurrence, moved to each new occurrence
+    size_type last_byte  = 0;
+    size_type last_chars = 0;
+    d_automaton.for_each_match(
+      data, d_str.size_bytes(), [&](size_type target, size_type size, size_type end) {
+        if (d_positions) {
+          auto const begin = end - size;
+          for (; last_byte < begin; ++last_byte)
+            last_chars += is_begin_utf8_char(static_cast<uint8_t>(data[last_byte]));
+          for (; last_byte > begin; --last_byte)
+            last_chars -= is_begin_utf8_char(static_cast<uint8_t>(data[last_byte - 1]));
+          auto const out_idx        = d_offsets[idx] + count;
+          d_string_indices[out_idx] = idx;
+          d_target_indices[out_idx] = target;
+          d_positions[out_idx]      = last_chars;
+        }
+        ++count;
+      });
+    return count;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<table> find_all_literals(
+  strings_column_view const& strings,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  aho_corasick const automaton(targets, stream);
+  auto strings_count  = strings.size();
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  find_all_literals_fn count_fn{*strings_column, automaton.view()};
+
+  // the occurrences of each string begin at the sum of the counts of the previous strings
+  rmm::device_vector<size_type> offsets(strings_count + 1, 0);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(strings_count),
+                    offsets.begin(),
+                    count_fn);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream), offsets.begin(), offsets.end(), offsets.begin());
+  size_type const total_count = offsets.back();
+
+  std::vector<std::unique_ptr<column>> results;
+  for (int i = 0; i < 3; ++i) {
+    results.emplace_back(make_numeric_column(
+      data_type{type_id::INT32}, total_count, mask_state::UNALLOCATED, stream, mr));
+  }
+  auto write_fn             = count_fn;
+  write_fn.d_offsets        = offsets.data().get();
+  write_fn.d_string_indices = results[0]->mutable_view().data<size_type>();
+  write_fn.d_target_indices = results[1]->mutable_view().data<size_type>();
+  write_fn.d_positions      = results[2]->mutable_view().data<size_type>();
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     strings_count,
+                     write_fn);
+  return std::make_unique<table>(std::move(results));
+}
+
 }  // namespace detail
 
 // external API
@@ -81,5 +199,21 @@ std::unique_ptr<column> find_multiple(strings_column_view const& strings,
   return detail::find_multiple(strings, targets, mr);
 }
 
+std::unique_ptr<column> contains_any(strings_column_view const& strings,
+                                     strings_column_view const& targets,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_any(strings, targets, mr);
+}
+
+std::unique_ptr<table> find_all_literals(strings_column_view const& strings,
+                                         strings_column_view const& targets,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::find_all_literals(strings, targets, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -17,8 +17,10 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/findall.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -27,6 +29,8 @@
 #include <strings/utilities.hpp>
 
 #include <thrust/extrema.h>
+#include <thrust/for_each.h>
+#include <thrust/scan.h>
 
 namespace cudf {
 namespace strings {
@@ -105,6 +109,69 @@ struct findall_count_fn : public findall_fn<stack_size> {
   }
 };
 
+/**
+ * @brief Counts the matches of the regex pattern within each string or, if `d_matches` is set,
+ * writes their string_index_pairs at the offset of the string.
+ */
+template <size_t stack_size>
+struct findall_record_fn {
+  column_device_view const d_strings;
+  reprog_device prog;
+  int32_t const* d_offsets{};
+  string_index_pair* d_matches{};
+
+  __device__ size_type operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) return 0;
+    u_char data1[stack_size];
+    u_char data2[stack_size];
+    prog.set_stack_mem(data1, data2);
+    string_view d_str = d_strings.element<string_view>(idx);
+    auto d_output     = d_matches ? d_matches + d_offsets[idx] : nullptr;
+    auto nchars       = d_str.length();
+    size_type spos    = 0;
+    size_type epos    = nchars;
+    size_type count   = 0;
+    while (spos <= nchars) {
+      if (prog.find(idx, d_str, spos, epos) <= 0) break;  // no more matches found
+      if (d_output) {
+        auto const begin = d_str.byte_offset(spos);
+        d_output[count]  = string_index_pair{d_str.data() + begin, d_str.byte_offset(epos) - begin};
+      }
+      ++count;
+      spos = epos > spos ? epos : spos + 1;
+      epos = nchars;
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief Runs `findall_record_fn` over every string: counts the matches into `d_offsets` if
+ * `d_matches` is null and writes them otherwise
+ */
+template <size_t stack_size>
+void findall_record_pass(column_device_view const& d_strings,
+                         reprog_device& d_prog,
+                         int32_t* d_offsets,
+                         string_index_pair* d_matches,
+                         cudaStream_t stream)
+{
+  auto const strings_count = d_strings.size();
+  if (d_matches == nullptr) {
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(strings_count),
+                      d_offsets,
+                      findall_record_fn<stack_size>{d_strings, d_prog});
+  } else {
+    thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       strings_count,
+                       findall_record_fn<stack_size>{d_strings, d_prog, d_offsets, d_matches});
+  }
+}
+
 }  // namespace
 
 //
@@ -189,6 +256,53 @@ std::unique_ptr<table> findall_re(
   return std::make_unique<table>(std::move(results));
 }
 
+//
+std::unique_ptr<column> findall_record(
+  strings_column_view const& strings,
+  std::string const& pattern,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource(),
+  cudaStream_t stream                 = 0)
+{
+  auto strings_count  = strings.size();
+  auto strings_column = column_device_view::create(strings.parent(), stream);
+  auto d_strings      = *strings_column;
+
+  auto d_flags = detail::get_character_flags_table();
+  // compile regex into device object
+  auto prog        = reprog_device::create(pattern, d_flags, strings_count, stream);
+  auto d_prog      = *prog;
+  auto regex_insts = d_prog.insts_counts();
+
+  // the first pass counts the matches of each string and the second writes them
+  auto const run_pass = [&](int32_t* d_offsets, string_index_pair* d_matches) {
+    if ((regex_insts > MAX_STACK_INSTS) || (regex_insts <= RX_SMALL_INSTS))
+      findall_record_pass<RX_STACK_SMALL>(d_strings, d_prog, d_offsets, d_matches, stream);
+    else if (regex_insts <= RX_MEDIUM_INSTS)
+      findall_record_pass<RX_STACK_MEDIUM>(d_strings, d_prog, d_offsets, d_matches, stream);
+    else
+      findall_record_pass<RX_STACK_LARGE>(d_strings, d_prog, d_offsets, d_matches, stream);
+  };
+
+  auto offsets = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  run_pass(d_offsets, nullptr);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream)->on(stream), d_offsets, d_offsets + strings_count + 1, d_offsets);
+
+  // last entry is the total number of matches
+  auto total_matches = cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+  rmm::device_vector<string_index_pair> matches(total_matches);
+  run_pass(d_offsets, matches.data().get());
+
+  auto strings_output = make_strings_column(matches.begin(), matches.end(), mr, stream);
+  return make_lists_column(strings_count,
+                           std::move(offsets),
+                           std::move(strings_output),
+                           strings.null_count(),
+                           copy_bitmask(strings.parent(), stream, mr));
+}
+
 }  // namespace detail
 
 // external API
@@ -201,5 +315,13 @@ std::unique_ptr<table> findall_re(strings_column_view const& strings,
   return detail::findall_re(strings, pattern, mr);
 }
 
+std::unique_ptr<column> findall_record(strings_column_view const& strings,
+                                       std::string const& pattern,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::findall_record(strings, pattern, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
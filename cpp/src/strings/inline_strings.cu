@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/detail/inline_strings.cuh>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/transform_scan.h>
+
+#include <limits>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+/**
+ * @brief Builds the view of each string and copies the long strings to the data buffer
+ */
+struct inline_view_fn {
+  column_device_view const d_strings;
+  int64_t const* d_offsets;  ///< Offset of each long string in the data buffer
+  inline_string* d_views;
+  char* d_data;
+
+  __device__ void operator()(size_type idx) const
+  {
+    inline_string view{};
+    if (d_strings.is_valid(idx)) {
+      auto const d_str = d_strings.element<string_view>(idx);
+      view.length      = d_str.size_bytes();
+      auto const head  = min(view.length, inline_string::prefix_bytes);
+      memcpy(view.prefix, d_str.data(), head);
+      if (view.is_inline()) {
+        memcpy(view.suffix, d_str.data() + head, view.length - head);
+      } else {
+        view.offset = d_offsets[idx];
+        memcpy(d_data + view.offset, d_str.data(), view.length);
+      }
+    }
+    d_views[idx] = view;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<inline_strings> to_inline_strings(strings_column_view const& strings,
+                                                  cudaStream_t stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  auto const strings_count = strings.size();
+  auto execpol             = rmm::exec_policy(stream);
+  auto strings_column      = column_device_view::create(strings.parent(), stream);
+  auto d_strings           = *strings_column;
+
+  // offsets of the long strings in the data buffer
+  rmm::device_vector<int64_t> offsets(strings_count + 1, 0);
+  thrust::transform_inclusive_scan(
+    execpol->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings_count),
+    offsets.begin() + 1,
+    [d_strings] __device__(size_type idx) -> int64_t {
+      if (d_strings.is_null(idx)) { return 0; }
+      auto const bytes = d_strings.element<string_view>(idx).size_bytes();
+      return bytes > inline_string::max_inline_bytes ? bytes : 0;
+    },
+    thrust::plus<int64_t>());
+  int64_t const data_bytes = offsets.back();
+
+  rmm::device_buffer views(strings_count * sizeof(inline_string), stream, mr);
+  rmm::device_buffer data(data_bytes, stream, mr);
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     strings_count,
+                     inline_view_fn{d_strings,
+                                    offsets.data().get(),
+                                    static_cast<inline_string*>(views.data()),
+                                    static_cast<char*>(data.data())});
+
+  return std::make_unique<inline_strings>(strings_count,
+                                          std::move(views),
+                                          std::move(data),
+                                          copy_bitmask(strings.parent(), stream, mr),
+                                          strings.null_count());
+}
+
+std::unique_ptr<column> from_inline_strings(inline_strings const& strings,
+                                            cudaStream_t stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  auto const strings_count = strings.size();
+  if (strings_count == 0) { return make_empty_strings_column(mr, stream); }
+  auto execpol = rmm::exec_policy(stream);
+
+  auto const d_views = strings.views();
+  auto lengths       = thrust::make_transform_iterator(
+    d_views, [] __device__(inline_string const& view) { return view.length; });
+  auto const bytes = thrust::transform_reduce(
+    execpol->on(stream),
+    lengths,
+    lengths + strings_count,
+    [] __device__(size_type length) { return static_cast<int64_t>(length); },
+    int64_t{0},
+    thrust::plus<int64_t>());
+  CUDF_EXPECTS(bytes <= std::numeric_limits<size_type>::max(),
+               "Size of the strings exceeds the column size limit");
+
+  auto offsets_column = make_offsets_child_column(lengths, lengths + strings_count, mr, stream);
+  auto d_offsets      = offsets_column->view().data<int32_t>();
+  auto chars_column   = create_chars_child_column(
+    strings_count, strings.null_count(), static_cast<size_type>(bytes), mr, stream);
+  auto d_chars = chars_column->mutable_view().data<char>();
+
+  auto const d_strings = inline_strings_device_view{strings};
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     strings_count,
+                     [d_strings, d_offsets, d_chars] __device__(size_type idx) {
+                       auto const d_str = d_strings.element(idx);
+                       memcpy(d_chars + d_offsets[idx], d_str.data(), d_str.size_bytes());
+                     });
+
+  auto null_mask = strings.null_mask() != nullptr
+                     ? copy_bitmask(strings.null_mask(), 0, strings_count, stream, mr)
+                     : rmm::device_buffer{0, stream, mr};
+  return make_strings_column(strings_count,
+                             std::move(offsets_column),
+                             std::move(chars_column),
+                             strings.null_count(),
+                             std::move(null_mask),
+                             stream,
+                             mr);
+}
+
+}  // namespace detail
+
+// external APIs
+
+std::unique_ptr<inline_strings> to_inline_strings(strings_column_view const& strings,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_inline_strings(strings, 0, mr);
+}
+
+std::unique_ptr<column> from_inline_strings(inline_strings const& strings,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_inline_strings(strings, 0, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
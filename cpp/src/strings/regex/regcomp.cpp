@@ -15,11 +15,14 @@
  */
 
 #include <strings/regex/regcomp.h>
+#include <strings/char_types/is_flags.h>
 #include <cudf/utilities/error.hpp>
 
 #include <string.h>
 #include <algorithm>
 #include <array>
+#include <limits>
+#include <map>
 
 namespace cudf {
 namespace strings {
@@ -905,6 +908,205 @@ void reprog::optimize2()
   _startinst_ids.push_back(-1);  // terminator mark
 }
 
+namespace {
+// Limits that keep an automaton small enough to be kept in shared memory
+constexpr size_t MAX_DFA_STATES{128};
+constexpr size_t MAX_DFA_CLASSES{256};
+constexpr size_t MAX_DFA_TRANSITIONS{8192};
+constexpr size_t MAX_DFA_RANGES{1024};
+constexpr char32_t ASCII_END{0x80};
+
+bool is_consuming(int32_t type)
+{
+  return type == CHAR || type == ANY || type == ANYNL || type == CCLASS || type == NCCLASS;
+}
+
+/**
+ * @brief Host version of `reclass_device::is_match` for the characters an
+ * automaton can classify: any character for a class without builtins and
+ * ASCII characters otherwise.
+ */
+bool class_matches(const reclass& cls, char32_t ch, const uint8_t* ascii_flags)
+{
+  for (size_t i = 0; i + 1 < cls.literals.size(); i += 2) {
+    if ((ch >= cls.literals[i]) && (ch <= cls.literals[i + 1])) return true;
+  }
+  if (!cls.builtins || ch >= ASCII_END) return false;
+  uint8_t fl = ascii_flags[ch];
+  if ((cls.builtins & 1) && ((ch == '_') || IS_ALPHANUM(fl))) return true;                 // \w
+  if ((cls.builtins & 2) && IS_SPACE(fl)) return true;                                     // \s
+  if ((cls.builtins & 4) && IS_DIGIT(fl)) return true;                                     // \d
+  if ((cls.builtins & 8) && ((ch != '\n') && (ch != '_') && !IS_ALPHANUM(fl))) return true;  // \W
+  if ((cls.builtins & 16) && !IS_SPACE(fl)) return true;                                   // \S
+  if ((cls.builtins & 32) && ((ch != '\n') && !IS_DIGIT(fl))) return true;                 // \D
+  return false;
+}
+
+bool inst_matches(const reinst& inst,
+                  const std::vector<reclass>& classes,
+                  char32_t ch,
+                  const uint8_t* ascii_flags)
+{
+  switch (inst.type) {
+    case CHAR: return inst.u1.c == ch;
+    case ANY: return ch != '\n';
+    case ANYNL: return true;
+    case CCLASS: return class_matches(classes[inst.u1.cls_id], ch, ascii_flags);
+    case NCCLASS: return !class_matches(classes[inst.u1.cls_id], ch, ascii_flags);
+  }
+  return false;
+}
+
+/**
+ * @brief Returns the sorted ids of the consuming and END instructions reached
+ * from the given instructions through ORs and brackets.
+ */
+std::vector<int32_t> dfa_closure(const std::vector<reinst>& insts, std::vector<int32_t> ids)
+{
+  std::vector<bool> visited(insts.size());
+  std::vector<int32_t> result;
+  while (!ids.empty()) {
+    int32_t id = ids.back();
+    ids.pop_back();
+    if (visited[id]) continue;
+    visited[id]        = true;
+    const reinst& inst = insts[id];
+    if (inst.type == OR) {
+      ids.push_back(inst.u1.right_id);
+      ids.push_back(inst.u2.left_id);
+    } else if (inst.type == LBRA || inst.type == RBRA) {
+      ids.push_back(inst.u2.next_id);
+    } else {
+      result.push_back(id);
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+}  // namespace
+
+std::u32string reprog::required_literal() const
+{
+  // Every match runs the instructions from the start up to the first OR, and
+  // consecutive CHARs separated by zero-width instructions match consecutive
+  // characters of the string.
+  std::u32string longest;
+  std::u32string current;
+  int32_t id = _startinst_id;
+  for (int32_t steps = 0; steps < insts_count(); ++steps) {
+    const reinst& inst = _insts[id];
+    if (inst.type == OR || inst.type == END) break;
+    if (inst.type == CHAR) {
+      current.push_back(inst.u1.c);
+      if (current.size() > longest.size()) longest = current;
+    } else if (is_consuming(inst.type)) {
+      current.clear();
+    }
+    id = inst.u2.next_id;
+  }
+  return longest;
+}
+
+redfa reprog::build_dfa(bool anchored, const uint8_t* ascii_flags) const
+{
+  redfa dfa;
+  std::vector<int32_t> consuming;
+  for (int32_t id = 0; id < insts_count(); ++id) {
+    int32_t type = _insts[id].type;
+    if (is_consuming(type))
+      consuming.push_back(id);
+    else if (type != OR && type != LBRA && type != RBRA && type != END)
+      return redfa{};  // anchors and word boundaries depend on the previous character
+    if ((type == CCLASS || type == NCCLASS) && _classes[_insts[id].u1.cls_id].builtins)
+      dfa.ascii_only = true;  // builtin classes of other characters need the flags table
+  }
+
+  // characters that match the same consuming instructions are in the same class
+  std::map<std::vector<bool>, int32_t> class_ids;
+  std::vector<char32_t> representatives;
+  auto class_of = [&](char32_t ch) {
+    std::vector<bool> signature(consuming.size());
+    std::transform(consuming.begin(), consuming.end(), signature.begin(), [&](int32_t id) {
+      return inst_matches(_insts[id], _classes, ch, ascii_flags);
+    });
+    auto result = class_ids.insert({signature, static_cast<int32_t>(representatives.size())});
+    if (result.second) representatives.push_back(ch);
+    return static_cast<uint8_t>(result.first->second);
+  };
+  for (char32_t ch = 0; ch < ASCII_END; ++ch) dfa.ascii_classes.push_back(class_of(ch));
+  if (!dfa.ascii_only) {
+    // the instructions match the same characters between consecutive boundaries
+    std::vector<char32_t> starts{ASCII_END};
+    for (int32_t id : consuming) {
+      const reinst& inst = _insts[id];
+      if (inst.type == CHAR) {
+        starts.push_back(inst.u1.c);
+        starts.push_back(inst.u1.c + 1);
+      } else if (inst.type == CCLASS || inst.type == NCCLASS) {
+        const std::u32string& literals = _classes[inst.u1.cls_id].literals;
+        for (size_t i = 0; i + 1 < literals.size(); i += 2) {
+          starts.push_back(literals[i]);
+          if (literals[i + 1] < std::numeric_limits<char32_t>::max())
+            starts.push_back(literals[i + 1] + 1);
+        }
+      }
+    }
+    starts.erase(std::remove_if(starts.begin(), starts.end(), [](char32_t ch) {
+                   return ch < ASCII_END;
+                 }),
+                 starts.end());
+    starts.push_back(ASCII_END);
+    std::sort(starts.begin(), starts.end());
+    starts.erase(std::unique(starts.begin(), starts.end()), starts.end());
+    for (char32_t start : starts) {
+      uint8_t cls = class_of(start);
+      if (!dfa.range_classes.empty() && dfa.range_classes.back() == cls) continue;
+      dfa.range_starts.push_back(start);
+      dfa.range_classes.push_back(cls);
+    }
+  }
+  if (representatives.size() > MAX_DFA_CLASSES || dfa.range_starts.size() > MAX_DFA_RANGES)
+    return redfa{};
+
+  // subset construction; unanchored automata restart a match at every character
+  std::vector<std::vector<int32_t>> states{dfa_closure(_insts, {_startinst_id})};
+  std::map<std::vector<int32_t>, int16_t> state_ids{{states.front(), 0}};
+  for (size_t idx = 0; idx < states.size(); ++idx) {
+    const std::vector<int32_t> state = states[idx];
+    bool accepting                   = std::any_of(
+      state.begin(), state.end(), [&](int32_t id) { return _insts[id].type == END; });
+    dfa.accepting.push_back(accepting);
+    for (char32_t ch : representatives) {
+      if (accepting) {  // a match was found, so the rest of the string is ignored
+        dfa.transitions.push_back(static_cast<int16_t>(idx));
+        continue;
+      }
+      std::vector<int32_t> next_ids;
+      for (int32_t id : state) {
+        if (is_consuming(_insts[id].type) && inst_matches(_insts[id], _classes, ch, ascii_flags))
+          next_ids.push_back(_insts[id].u2.next_id);
+      }
+      if (!anchored) next_ids.push_back(_startinst_id);
+      std::vector<int32_t> next = dfa_closure(_insts, next_ids);
+      if (next.empty()) {
+        dfa.transitions.push_back(-1);
+        continue;
+      }
+      auto result = state_ids.insert({next, static_cast<int16_t>(states.size())});
+      if (result.second) {
+        if (states.size() == MAX_DFA_STATES) return redfa{};
+        states.push_back(next);
+      }
+      dfa.transitions.push_back(result.first->second);
+    }
+    if (dfa.transitions.size() > MAX_DFA_TRANSITIONS) return redfa{};
+  }
+  dfa.states_count  = static_cast<int32_t>(states.size());
+  dfa.classes_count = static_cast<int32_t>(representatives.size());
+  return dfa;
+}
+
 void reprog::print()
 {
   printf("Instructions:\n");
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -72,6 +73,27 @@ struct reinst {
   int32_t reserved4;
 };
 
+/**
+ * @brief Deterministic automaton compiled from a regex program.
+ *
+ * Characters are mapped to classes of characters that match the same
+ * instructions. ASCII characters are mapped through `ascii_classes` and other
+ * characters through the class of the range in `range_starts` they belong to.
+ * A transition to -1 is a transition to the dead state.
+ */
+struct redfa {
+  int32_t states_count{};
+  int32_t classes_count{};
+  bool ascii_only{};                   // non-ASCII characters cannot be classified
+  std::vector<char32_t> range_starts;  // first character of each non-ASCII range
+  std::vector<int16_t> transitions;    // next state per state and class
+  std::vector<uint8_t> ascii_classes;  // class of each ASCII character
+  std::vector<uint8_t> range_classes;  // class of each non-ASCII range
+  std::vector<uint8_t> accepting;      // 1 for each state that found a match
+
+  bool empty() const { return states_count == 0; }
+};
+
 /**
  * @brief Regex program handles parsing a pattern in to individual set
  * of chained instructions.
@@ -113,6 +135,26 @@ class reprog {
 
   void optimize1();
   void optimize2();
+
+  /**
+   * @brief Returns the longest run of literal characters that every match of
+   * this program must contain, or an empty string if there is none.
+   */
+  std::u32string required_literal() const;
+
+  /**
+   * @brief Compiles this program into a deterministic automaton that tells
+   * whether a string has a match.
+   *
+   * Returns an empty automaton if the program has instructions an automaton
+   * cannot evaluate (anchors and word boundaries), or if the automaton is too
+   * large.
+   *
+   * @param anchored Only find matches that begin at the start of the string
+   * @param ascii_flags Character type flags of the 128 ASCII characters,
+   * used to evaluate builtin classes like `\d`
+   */
+  redfa build_dfa(bool anchored, const uint8_t* ascii_flags) const;
   void print();  // for debugging
 
  private:
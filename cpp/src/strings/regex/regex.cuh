@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cuda_runtime.h>
+#include <rmm/mr/device/device_memory_resource.hpp>
 #include <strings/regex/regcomp.h>
 #include <functional>
 #include <memory>
@@ -28,6 +29,7 @@ namespace detail {
 struct reljunk;
 struct reinst;
 class reprog;
+struct compiled_reprog;
 
 /**
  * @brief Regex class stored on the device and executed by reprog_device.
@@ -43,6 +45,60 @@ class reclass_device {
   __device__ bool is_match(char32_t ch, const uint8_t* flags);
 };
 
+/**
+ * @brief Deterministic automaton stored on the device that tells whether a regex
+ * pattern matches a string.
+ *
+ * All arrays are stored in one buffer of `size()` bytes, so the automaton can be
+ * copied into shared memory and used from there with `with_data()`.
+ */
+class redfa_device {
+ public:
+  int32_t states_count{};
+  int32_t classes_count{};
+  int32_t ranges_count{};
+  bool ascii_only{};
+
+  /**
+   * @brief Returns true if the pattern has no automaton.
+   */
+  __host__ __device__ bool empty() const { return states_count == 0; }
+
+  /**
+   * @brief Returns the number of bytes of the buffer of the automaton.
+   */
+  __host__ __device__ size_t size() const { return _size; }
+
+  /**
+   * @brief Returns the buffer of the automaton.
+   */
+  __host__ __device__ const u_char* data() const { return _data; }
+
+  /**
+   * @brief Returns a copy of this automaton that reads its arrays from a copy
+   * of its buffer.
+   */
+  __device__ inline redfa_device with_data(const u_char* data) const;
+
+  /**
+   * @brief Returns 1 if the string has a match, 0 if it has none, and -1 if
+   * the string has a character this automaton cannot classify.
+   */
+  __device__ inline int32_t is_match(string_view const& d_str) const;
+
+ private:
+  friend class reprog_device;
+
+  const u_char* _data{};
+  size_t _size{};
+  size_t _transitions_offset{};
+  size_t _ascii_classes_offset{};
+  size_t _range_classes_offset{};
+  size_t _accepting_offset{};
+
+  __device__ inline int32_t class_of(char32_t ch) const;
+};
+
 /**
  * @brief Regex program of instructions/data for a specific regex pattern.
  *
@@ -64,6 +120,9 @@ class reprog_device {
    * The number of strings is needed to compute the state data size required when evaluating the
    * regex.
    *
+   * Compiled programs are cached by device, `cp_flags` and pattern, so that only the execution
+   * state is allocated when the same pattern is used again.
+   *
    * @param pattern The regex pattern to compile.
    * @param cp_flags The code-point lookup table for character types.
    * @param strings_count Number of strings that will be evaluated.
@@ -97,6 +156,18 @@ class reprog_device {
    */
   int32_t group_counts() const { return _num_capturing_groups; }
 
+  /**
+   * @brief Returns the automaton that finds a match anywhere in a string, or
+   * only at its beginning if `anchored` is true.
+   *
+   * The automaton is empty if the pattern cannot be compiled into a small
+   * enough automaton.
+   */
+  __host__ __device__ redfa_device const& dfa(bool anchored) const
+  {
+    return anchored ? _anchored_dfa : _dfa;
+  }
+
   /**
    * @brief This sets up the memory used for keeping track of the regex progress.
    *
@@ -164,6 +235,10 @@ class reprog_device {
   void* _relists_mem{};               // runtime relist memory for regexec
   u_char* _stack_mem1{};              // memory for relist object 1
   u_char* _stack_mem2{};              // memory for relist object 2
+  const char* _prefilter{};           // literal that every match contains
+  int32_t _prefilter_bytes{};         // size of the literal in bytes
+  redfa_device _dfa;                  // automaton for matches anywhere
+  redfa_device _anchored_dfa;         // automaton for matches at the beginning
 
   /**
    * @brief Executes the regex pattern on the given string.
@@ -178,6 +253,16 @@ class reprog_device {
     int32_t idx, string_view const& d_str, int32_t& begin, int32_t& end, int32_t groupid = 0);
 
   reprog_device(reprog&);  // must use create()
+
+  /**
+   * @brief Compiles a pattern and copies its program to device memory allocated from `mr`
+   *
+   * Returns once the copy on `stream` is complete.
+   */
+  static std::shared_ptr<compiled_reprog const> compile(std::string const& pattern,
+                                                        const uint8_t* cp_flags,
+                                                        rmm::mr::device_memory_resource* mr,
+                                                        cudaStream_t stream);
 };
 
 // 10128 ≈ 1000 instructions
@@ -22,6 +22,7 @@
 #include <memory.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
+#include <thrust/binary_search.h>
 #include <thrust/logical.h>
 
 namespace cudf {
@@ -157,6 +158,51 @@ __device__ inline bool reclass_device::is_match(char32_t ch, const uint8_t* code
   return false;
 }
 
+__device__ inline redfa_device redfa_device::with_data(const u_char* data) const
+{
+  redfa_device result = *this;
+  result._data        = data;
+  return result;
+}
+
+__device__ inline int32_t redfa_device::class_of(char32_t ch) const
+{
+  if (ch < 0x80) return _data[_ascii_classes_offset + ch];
+  // the range starts are the first array of the buffer
+  auto const starts = reinterpret_cast<const char32_t*>(_data);
+  auto const range  = thrust::upper_bound(thrust::seq, starts, starts + ranges_count, ch) - 1;
+  return _data[_range_classes_offset + thrust::distance(starts, range)];
+}
+
+/**
+ * @brief Runs the automaton over the characters of the string until it finds a
+ * match or reaches the dead state.
+ *
+ * ASCII characters are read a byte at a time without decoding. Like `regexec`,
+ * the evaluation stops at the first null character.
+ */
+__device__ inline int32_t redfa_device::is_match(string_view const& d_str) const
+{
+  auto const transitions = reinterpret_cast<const int16_t*>(_data + _transitions_offset);
+  auto const accepting   = _data + _accepting_offset;
+  int32_t state          = 0;
+  auto ptr               = d_str.data();
+  auto const end         = ptr + d_str.size_bytes();
+  while (!accepting[state] && ptr < end) {
+    char_utf8 ch = static_cast<u_char>(*ptr);
+    if (ch < 0x80) {
+      ++ptr;
+    } else {
+      if (ascii_only) return -1;
+      ptr += to_char_utf8(ptr, ch);
+    }
+    if (ch == 0) break;
+    state = transitions[state * classes_count + class_of(ch)];
+    if (state < 0) return 0;
+  }
+  return accepting[state];
+}
+
 /**
  * @brief Set the device data to be used for holding the state data of a string.
  *
@@ -389,6 +435,9 @@ __device__ inline int32_t reprog_device::extract(
 __device__ inline int32_t reprog_device::call_regexec(
   int32_t idx, string_view const& dstr, int32_t& begin, int32_t& end, int32_t group_id)
 {
+  // rows without the literal that every match contains cannot match
+  if (_prefilter_bytes > 0 && dstr.find(_prefilter, _prefilter_bytes, begin) < 0) return 0;
+
   reljunk jnk;
   jnk.starttype = 0;
   jnk.startchar = 0;
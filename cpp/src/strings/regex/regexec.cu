@@ -17,8 +17,18 @@
 #include <strings/regex/regcomp.h>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
 #include <strings/regex/regex.cuh>
 
+#include <array>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -54,6 +64,117 @@ std::vector<char32_t> string_to_char32_vector(std::string const& pattern)
 
 }  // namespace
 
+/**
+ * @brief A compiled program and the device memory holding its instructions and automata
+ *
+ * The program has no execution memory; each `reprog_device::create()` call allocates its own.
+ */
+struct compiled_reprog {
+  compiled_reprog(reprog_device const& prog, std::unique_ptr<rmm::device_buffer>&& buffer)
+    : prog(prog), buffer(std::move(buffer))
+  {
+  }
+  reprog_device const prog;
+  std::unique_ptr<rmm::device_buffer> const buffer;
+};
+
+namespace {
+/**
+ * @brief Process-wide LRU cache of compiled programs
+ *
+ * Applying the same patterns to many small columns would otherwise spend most of its time
+ * compiling each pattern and uploading the program. Programs are keyed by device, character flags
+ * table and pattern, so a program is shared by all the streams of its device.
+ *
+ * The program memory does not depend on the caller: it comes from a `cuda_memory_resource` owned
+ * by the cache, and is uploaded on a stream of the cache, which is synchronized before the program
+ * is used. Since `cudaFree` synchronizes the device, a program freed once it is evicted and no
+ * longer used is never freed while a kernel reads it. The cache is intentionally leaked, so that
+ * no program is freed during static destruction, after the CUDA context may have been torn down.
+ * All functions are thread-safe.
+ */
+class reprog_cache {
+ public:
+  static constexpr size_t capacity = 128;
+
+  static reprog_cache& instance()
+  {
+    static reprog_cache* cache = new reprog_cache();
+    return *cache;
+  }
+
+  static std::string key(std::string const& pattern, uint8_t const* flags)
+  {
+    int device = 0;
+    CUDA_TRY(cudaGetDevice(&device));
+    return std::to_string(device) + ':' + std::to_string(reinterpret_cast<uintptr_t>(flags)) +
+           ':' + pattern;
+  }
+
+  /**
+   * @brief Returns the resource the programs are allocated from
+   */
+  rmm::mr::device_memory_resource* resource() { return &_mr; }
+
+  /**
+   * @brief Returns the stream the programs of the current device are uploaded on
+   */
+  cudaStream_t stream()
+  {
+    int device = 0;
+    CUDA_TRY(cudaGetDevice(&device));
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _streams.find(device);
+    if (it == _streams.end()) {
+      cudaStream_t stream{};
+      CUDA_TRY(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+      it = _streams.emplace(device, stream).first;
+    }
+    return it->second;
+  }
+
+  /**
+   * @brief Returns the program of a key and marks it as recently used, or nullptr
+   */
+  std::shared_ptr<compiled_reprog const> get(std::string const& key)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _index.find(key);
+    if (it == _index.end()) { return nullptr; }
+    _entries.splice(_entries.begin(), _entries, it->second);
+    return it->second->second;
+  }
+
+  /**
+   * @brief Inserts the program of a key, evicting the least recently used program if needed
+   */
+  void put(std::string const& key, std::shared_ptr<compiled_reprog const> prog)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    // Another thread may have compiled the same pattern meanwhile
+    if (_index.find(key) != _index.end()) { return; }
+    _entries.emplace_front(key, std::move(prog));
+    _index.emplace(key, _entries.begin());
+    if (_entries.size() > capacity) {
+      _index.erase(_entries.back().first);
+      _entries.pop_back();
+    }
+  }
+
+ private:
+  using entry = std::pair<std::string, std::shared_ptr<compiled_reprog const>>;
+
+  reprog_cache() = default;
+
+  std::mutex _mutex;
+  std::list<entry> _entries;  ///< Most recently used first
+  std::unordered_map<std::string, std::list<entry>::iterator> _index;
+  std::map<int, cudaStream_t> _streams;  ///< Upload stream of each device
+  rmm::mr::cuda_memory_resource _mr;
+};
+
+}  // namespace
+
 // Copy reprog primitive values
 reprog_device::reprog_device(reprog& prog)
   : _startinst_id{prog.get_start_inst()},
@@ -73,6 +194,40 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
   const uint8_t* codepoint_flags,
   size_type strings_count,
   cudaStream_t stream)
+{
+  auto& cache    = reprog_cache::instance();
+  auto const key = reprog_cache::key(pattern, codepoint_flags);
+  auto compiled  = cache.get(key);
+  if (compiled == nullptr) {
+    compiled = compile(pattern, codepoint_flags, cache.resource(), cache.stream());
+    cache.put(key, compiled);
+  }
+
+  auto* d_prog = new reprog_device(compiled->prog);
+  // allocate execute memory if needed
+  rmm::device_buffer* d_relists{};
+  if (d_prog->_insts_count > MAX_STACK_INSTS) {
+    auto relist_alloc_size = relist::alloc_size(d_prog->_insts_count);
+    auto rlm_size          = relist_alloc_size * 2L * strings_count;  // reljunk has 2 relist ptrs
+    if (rlm_size > 0) {
+      d_relists            = new rmm::device_buffer(rlm_size, stream);
+      d_prog->_relists_mem = d_relists->data();
+    }
+  }
+
+  // the program memory is released with the last user of the compiled program
+  auto deleter = [compiled, d_relists](reprog_device* t) {
+    t->destroy();
+    delete d_relists;
+  };
+  return std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>(d_prog, deleter);
+}
+
+// Compile a pattern and copy the program to device memory
+std::shared_ptr<compiled_reprog const> reprog_device::compile(std::string const& pattern,
+                                                              const uint8_t* codepoint_flags,
+                                                              rmm::mr::device_memory_resource* mr,
+                                                              cudaStream_t stream)
 {
   std::vector<char32_t> pattern32 = string_to_char32_vector(pattern);
   // compile pattern into host object
@@ -90,21 +245,47 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     cudf::util::round_up_safe<size_t>(classes_count * sizeof(_classes[0]), sizeof(size_t));
   for (int32_t idx = 0; idx < classes_count; ++idx)
     classes_size += static_cast<int32_t>((h_prog.class_at(idx).literals.size()) * sizeof(char32_t));
-  size_t memsize  = insts_size + startids_size + classes_size;
-  size_t rlm_size = 0;
-  // check memory size needed for executing regex
-  if (insts_count > MAX_STACK_INSTS) {
-    auto relist_alloc_size = relist::alloc_size(insts_count);
-    rlm_size               = relist_alloc_size * 2L * strings_count;  // reljunk has 2 relist ptrs
+  // compile the pattern into automata and find the literal that every match contains
+  std::vector<uint8_t> ascii_flags(0x80);
+  CUDA_TRY(cudaMemcpy(
+    ascii_flags.data(), codepoint_flags, ascii_flags.size(), cudaMemcpyDeviceToHost));
+  std::array<redfa, 2> h_dfas{
+    {h_prog.build_dfa(false, ascii_flags.data()), h_prog.build_dfa(true, ascii_flags.data())}};
+  std::string prefilter;
+  for (char32_t ch : h_prog.required_literal()) {
+    char bytes[4];
+    prefilter.append(bytes, from_char_utf8(ch, bytes));
   }
+  // an automaton is [range starts][transitions][ascii classes][range classes][accepting]
+  auto layout_dfa = [](redfa const& h_dfa, redfa_device& d_dfa) {
+    d_dfa.states_count  = h_dfa.states_count;
+    d_dfa.classes_count = h_dfa.classes_count;
+    d_dfa.ranges_count  = static_cast<int32_t>(h_dfa.range_starts.size());
+    d_dfa.ascii_only    = h_dfa.ascii_only;
+    if (h_dfa.empty()) return size_t{0};
+    d_dfa._transitions_offset = h_dfa.range_starts.size() * sizeof(char32_t);
+    d_dfa._ascii_classes_offset =
+      d_dfa._transitions_offset + h_dfa.transitions.size() * sizeof(int16_t);
+    d_dfa._range_classes_offset = d_dfa._ascii_classes_offset + h_dfa.ascii_classes.size();
+    d_dfa._accepting_offset     = d_dfa._range_classes_offset + h_dfa.range_classes.size();
+    d_dfa._size                 = cudf::util::round_up_safe<size_t>(
+      d_dfa._accepting_offset + h_dfa.accepting.size(), sizeof(size_t));
+    return d_dfa._size;
+  };
+  std::array<redfa_device, 2> d_dfas;
+  auto dfas_offset =
+    cudf::util::round_up_safe<size_t>(insts_size + startids_size + classes_size, sizeof(size_t));
+  auto dfas_size = layout_dfa(h_dfas[0], d_dfas[0]) + layout_dfa(h_dfas[1], d_dfas[1]);
+
+  size_t memsize = dfas_offset + dfas_size + prefilter.size();
 
   // allocate memory to store prog data
   std::vector<u_char> h_buffer(memsize);
   u_char* h_ptr  = h_buffer.data();  // running pointer
-  auto* d_buffer = new rmm::device_buffer(memsize, stream);
+  auto d_buffer = std::make_unique<rmm::device_buffer>(memsize, stream, mr);
   u_char* d_ptr  = reinterpret_cast<u_char*>(d_buffer->data());  // running device pointer
   // put everything into a flat host buffer first
-  reprog_device* d_prog = new reprog_device(h_prog);
+  std::unique_ptr<reprog_device> d_prog(new reprog_device(h_prog));
   // copy the instructions array first (fixed-size structs)
   reinst* insts = reinterpret_cast<reinst*>(h_ptr);
   memcpy(insts, h_prog.insts_data(), insts_size);
@@ -135,27 +316,44 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     h_end += h_class.literals.size() * sizeof(char32_t);
     d_end += h_class.literals.size() * sizeof(char32_t);
   }
+  // copy the automata and the prefilter literal last
+  h_ptr = h_buffer.data() + dfas_offset;
+  d_ptr = reinterpret_cast<u_char*>(d_buffer->data()) + dfas_offset;
+  for (size_t idx = 0; idx < h_dfas.size(); ++idx) {
+    redfa const& h_dfa  = h_dfas[idx];
+    redfa_device& d_dfa = d_dfas[idx];
+    if (h_dfa.empty()) continue;
+    memcpy(h_ptr, h_dfa.range_starts.data(), d_dfa._transitions_offset);
+    memcpy(h_ptr + d_dfa._transitions_offset,
+           h_dfa.transitions.data(),
+           h_dfa.transitions.size() * sizeof(int16_t));
+    memcpy(h_ptr + d_dfa._ascii_classes_offset,
+           h_dfa.ascii_classes.data(),
+           h_dfa.ascii_classes.size());
+    memcpy(h_ptr + d_dfa._range_classes_offset,
+           h_dfa.range_classes.data(),
+           h_dfa.range_classes.size());
+    memcpy(h_ptr + d_dfa._accepting_offset, h_dfa.accepting.data(), h_dfa.accepting.size());
+    d_dfa._data = d_ptr;
+    h_ptr += d_dfa._size;
+    d_ptr += d_dfa._size;
+  }
+  memcpy(h_ptr, prefilter.data(), prefilter.size());
+  d_prog->_dfa             = d_dfas[0];
+  d_prog->_anchored_dfa    = d_dfas[1];
+  d_prog->_prefilter       = reinterpret_cast<const char*>(d_ptr);
+  d_prog->_prefilter_bytes = static_cast<int32_t>(prefilter.size());
   // initialize the rest of the elements
   d_prog->_insts_count     = insts_count;
   d_prog->_starts_count    = starts_count;
   d_prog->_classes_count   = classes_count;
   d_prog->_codepoint_flags = codepoint_flags;
-  // allocate execute memory if needed
-  rmm::device_buffer* d_relists{};
-  if (rlm_size > 0) {
-    d_relists            = new rmm::device_buffer(rlm_size, stream);
-    d_prog->_relists_mem = d_relists->data();
-  }
 
   // copy flat prog to device memory
-  CUDA_TRY(cudaMemcpy(d_buffer->data(), h_buffer.data(), memsize, cudaMemcpyHostToDevice));
-  //
-  auto deleter = [d_buffer, d_relists](reprog_device* t) {
-    t->destroy();
-    delete d_buffer;
-    delete d_relists;
-  };
-  return std::unique_ptr<reprog_device, std::function<void(reprog_device*)>>(d_prog, deleter);
+  CUDA_TRY(cudaMemcpyAsync(
+    d_buffer->data(), h_buffer.data(), memsize, cudaMemcpyHostToDevice, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return std::make_shared<compiled_reprog const>(*d_prog, std::move(d_buffer));
 }
 
 void reprog_device::destroy() { delete this; }
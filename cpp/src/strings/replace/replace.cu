@@ -21,9 +21,12 @@
 #include <cudf/strings/replace.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <strings/aho_corasick/aho_corasick.cuh>
 #include <strings/utilities.cuh>
 #include <strings/utilities.hpp>
 
+#include <algorithm>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -42,44 +45,35 @@ enum class two_pass {
 /**
  * @brief Function logic for the replace API.
  *
- * This will perform a replace operation on each string.
+ * This will perform a replace operation on each string, writing the bytes of the
+ * result that fit in the output buffer, for `make_strings_children_bounded()`.
  */
-template <two_pass Pass = two_pass::SIZE_ONLY>
 struct replace_fn {
   column_device_view const d_strings;
   string_view const d_target;
   string_view const d_repl;
   int32_t max_repl;
-  const int32_t* d_offsets{};
-  char* d_chars{};
 
-  __device__ size_type operator()(size_type idx)
+  __device__ size_type operator()(size_type idx, char* d_buffer, size_type capacity)
   {
     if (d_strings.is_null(idx)) return 0;  // null string
     string_view d_str = d_strings.element<string_view>(idx);
     auto max_n        = max_repl;
     if (max_n < 0) max_n = d_str.length();  // max possible replacements
-    char* out_ptr = nullptr;
-    if (Pass == two_pass::EXECUTE_OP) out_ptr = d_chars + d_offsets[idx];
     const char* in_ptr = d_str.data();
-    size_type bytes    = d_str.size_bytes();
+    size_type bytes    = 0;
     auto position      = d_str.find(d_target);
     size_type last_pos = 0;
     while ((position >= 0) && (max_n > 0)) {
-      if (Pass == two_pass::SIZE_ONLY)
-        bytes += d_repl.size_bytes() - d_target.size_bytes();
-      else  // EXECUTE_OP
-      {
-        size_type curr_pos = d_str.byte_offset(position);
-        out_ptr = copy_and_increment(out_ptr, in_ptr + last_pos, curr_pos - last_pos);  // copy left
-        out_ptr = copy_string(out_ptr, d_repl);                                         // copy repl
-        last_pos = curr_pos + d_target.size_bytes();
-      }
+      size_type curr_pos = d_str.byte_offset(position);
+      append_bounded(d_buffer, capacity, bytes, in_ptr + last_pos, curr_pos - last_pos);  // left
+      append_bounded(d_buffer, capacity, bytes, d_repl.data(), d_repl.size_bytes());      // repl
+      last_pos = curr_pos + d_target.size_bytes();
       position = d_str.find(d_target, position + d_target.size_bytes());
       --max_n;
     }
-    if (Pass == two_pass::EXECUTE_OP)  // copy whats left (or right depending on your point of view)
-      memcpy(out_ptr, in_ptr + last_pos, d_str.size_bytes() - last_pos);
+    // copy whats left (or right depending on your point of view)
+    append_bounded(d_buffer, capacity, bytes, in_ptr + last_pos, d_str.size_bytes() - last_pos);
     return bytes;
   }
 };
@@ -109,28 +103,15 @@ std::unique_ptr<column> replace(
 
   // copy the null mask
   rmm::device_buffer null_mask = copy_bitmask(strings.parent(), stream, mr);
-  // build offsets column
-  auto offsets_transformer_itr = thrust::make_transform_iterator(
-    thrust::make_counting_iterator<int32_t>(0),
-    replace_fn<two_pass::SIZE_ONLY>{d_strings, d_target, d_repl, maxrepl});
-  auto offsets_column = make_offsets_child_column(
-    offsets_transformer_itr, offsets_transformer_itr + strings_count, mr, stream);
-  auto d_offsets = offsets_column->view().data<int32_t>();
-
-  // build chars column
-  size_type bytes = thrust::device_pointer_cast(d_offsets)[strings_count];
-  auto chars_column =
-    create_chars_child_column(strings_count, strings.null_count(), bytes, mr, stream);
-  auto d_chars = chars_column->mutable_view().data<char>();
-  thrust::for_each_n(
-    rmm::exec_policy(stream)->on(stream),
-    thrust::make_counting_iterator<size_type>(0),
-    strings_count,
-    replace_fn<two_pass::EXECUTE_OP>{d_strings, d_target, d_repl, maxrepl, d_offsets, d_chars});
+  // each replacement grows a string by at most `repl / target` times the bytes it replaces,
+  // so the strings are written in a single pass into a buffer bounded by that ratio
+  auto const max_expansion = std::max(1, (repl.size() + target.size() - 1) / target.size());
+  auto children            = make_strings_children_bounded(
+    replace_fn{d_strings, d_target, d_repl, maxrepl}, strings, max_expansion, mr, stream);
   //
   return make_strings_column(strings_count,
-                             std::move(offsets_column),
-                             std::move(chars_column),
+                             std::move(children.first),
+                             std::move(children.second),
                              strings.null_count(),
                              std::move(null_mask),
                              stream,
@@ -231,11 +212,13 @@ namespace {
  * @brief Function logic for the replace_multi API.
  *
  * This will perform the multi-replace operation on each string.
+ * At each position, the first listed target that matches is found by walking
+ * the trie of the targets, so the cost does not depend on the number of targets.
  */
 template <two_pass Pass = two_pass::SIZE_ONLY>
 struct replace_multi_fn {
   column_device_view const d_strings;
-  column_device_view const d_targets;
+  aho_corasick_device const d_targets;
   column_device_view const d_repls;
   const int32_t* d_offsets{};
   char* d_chars{};
@@ -249,27 +232,24 @@ struct replace_multi_fn {
     const char* in_ptr = d_str.data();
     size_type size     = d_str.size_bytes();
     size_type bytes = size, spos = 0, lpos = 0;
-    while (spos < size) {  // check each character against each target
-      for (int tgt_idx = 0; tgt_idx < d_targets.size(); ++tgt_idx) {
-        string_view d_tgt = d_targets.element<string_view>(tgt_idx);
-        if ((d_tgt.size_bytes() <= (size - spos)) &&                  // check fit
-            (d_tgt.compare(in_ptr + spos, d_tgt.size_bytes()) == 0))  // does it match
-        {                                                             // found one
-          string_view d_repl;
-          if (d_repls.size() == 1)
-            d_repl = d_repls.element<string_view>(0);
-          else
-            d_repl = d_repls.element<string_view>(tgt_idx);
-          if (Pass == two_pass::SIZE_ONLY)
-            bytes += d_repl.size_bytes() - d_tgt.size_bytes();
-          else {
-            out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
-            out_ptr = copy_string(out_ptr, d_repl);
-            lpos    = spos + d_tgt.size_bytes();
-          }
-          spos += d_tgt.size_bytes() - 1;
-          break;
+    while (spos < size) {  // check each character against the targets
+      auto const node = d_targets.first_prefix(in_ptr + spos, size - spos);
+      if (node >= 0) {  // found one
+        auto const tgt_idx  = d_targets.targets[node];
+        auto const tgt_size = d_targets.depths[node];
+        string_view d_repl;
+        if (d_repls.size() == 1)
+          d_repl = d_repls.element<string_view>(0);
+        else
+          d_repl = d_repls.element<string_view>(tgt_idx);
+        if (Pass == two_pass::SIZE_ONLY)
+          bytes += d_repl.size_bytes() - tgt_size;
+        else {
+          out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
+          out_ptr = copy_string(out_ptr, d_repl);
+          lpos    = spos + tgt_size;
         }
+        spos += tgt_size - 1;
       }
       ++spos;
     }
@@ -299,10 +279,10 @@ std::unique_ptr<column> replace(
 
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
-  auto targets_column = column_device_view::create(targets.parent(), stream);
-  auto d_targets      = *targets_column;
-  auto repls_column   = column_device_view::create(repls.parent(), stream);
-  auto d_repls        = *repls_column;
+  aho_corasick const targets_automaton(targets, stream);
+  auto d_targets    = targets_automaton.view();
+  auto repls_column = column_device_view::create(repls.parent(), stream);
+  auto d_repls      = *repls_column;
 
   // copy the null mask
   rmm::device_buffer null_mask = copy_bitmask(strings.parent(), stream, mr);
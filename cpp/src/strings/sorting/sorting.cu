@@ -16,6 +16,7 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/strings/sorting.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -35,6 +36,29 @@ std::unique_ptr<cudf::column> sort(strings_column_view strings,
                                    cudaStream_t stream,
                                    rmm::mr::device_memory_resource* mr)
 {
+  if (stype == sort_type::name) {
+    // Sorting by name alone is a sort of the column, which radix sorts the prefixes of the
+    // strings. Nulls are placed here regardless of the order, so the null order is flipped for
+    // a descending sort.
+    bool const ascending      = order == cudf::order::ASCENDING;
+    auto const precedence     = ascending == (null_order == cudf::null_order::BEFORE)
+                                  ? cudf::null_order::BEFORE
+                                  : cudf::null_order::AFTER;
+    auto const sorted_indices = cudf::detail::sorted_order(table_view{{strings.parent()}},
+                                                           {order},
+                                                           {precedence},
+                                                           rmm::mr::get_default_resource(),
+                                                           stream);
+    auto table_sorted = cudf::detail::gather(table_view{{strings.parent()}},
+                                             sorted_indices->view(),
+                                             cudf::detail::out_of_bounds_policy::NULLIFY,
+                                             cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                             mr,
+                                             stream)
+                          ->release();
+    return std::move(table_sorted.front());
+  }
+
   auto execpol        = rmm::exec_policy(stream);
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
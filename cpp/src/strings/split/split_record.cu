@@ -135,6 +135,140 @@ struct token_reader_fn {
   }
 };
 
+/**
+ * @brief Returns a word with the high bit of every byte of `word` that equals the byte
+ * repeated in `pattern` set, and the other bits clear
+ *
+ * Unlike the usual zero-byte test, no carry crosses the bytes, so every match is exact.
+ */
+__device__ inline uint32_t match_bytes(uint32_t word, uint32_t pattern)
+{
+  auto const x = word ^ pattern;
+  return ~(((x & 0x7F7F7F7Fu) + 0x7F7F7F7Fu) | x | 0x7F7F7F7Fu);
+}
+
+/**
+ * @brief Returns the position of the first `delimiter` byte in `[begin, end)`, or `end`
+ *
+ * The aligned part of the range is read 4 bytes at a time.
+ */
+__device__ inline size_type find_byte(char const* data,
+                                      size_type begin,
+                                      size_type end,
+                                      char delimiter)
+{
+  auto pos = begin;
+  for (; pos < end && (reinterpret_cast<uintptr_t>(data + pos) % 4) != 0; ++pos) {
+    if (data[pos] == delimiter) { return pos; }
+  }
+  auto const pattern = 0x01010101u * static_cast<uint8_t>(delimiter);
+  for (; pos + 4 <= end; pos += 4) {
+    auto const matches = match_bytes(*reinterpret_cast<uint32_t const*>(data + pos), pattern);
+    // The first byte in memory is the least significant byte of the word
+    if (matches != 0) { return pos + (__ffs(matches) - 1) / 8; }
+  }
+  for (; pos < end; ++pos) {
+    if (data[pos] == delimiter) { return pos; }
+  }
+  return end;
+}
+
+/**
+ * @brief Returns the position of the last `delimiter` byte in `[0, end)`, or -1
+ *
+ * The aligned part of the range is read 4 bytes at a time.
+ */
+__device__ inline size_type rfind_byte(char const* data, size_type end, char delimiter)
+{
+  auto pos = end;
+  while (pos > 0 && (reinterpret_cast<uintptr_t>(data + pos) % 4) != 0) {
+    if (data[--pos] == delimiter) { return pos; }
+  }
+  auto const pattern = 0x01010101u * static_cast<uint8_t>(delimiter);
+  for (; pos >= 4; pos -= 4) {
+    auto const matches = match_bytes(*reinterpret_cast<uint32_t const*>(data + pos - 4), pattern);
+    if (matches != 0) { return pos - 4 + (31 - __clz(matches)) / 8; }
+  }
+  while (pos > 0) {
+    if (data[--pos] == delimiter) { return pos; }
+  }
+  return -1;
+}
+
+/**
+ * @brief Compute the number of tokens for the `idx'th` string element of `d_strings` when the
+ * delimiter is a single byte.
+ *
+ * A single-byte delimiter is an ASCII character, which never occurs inside the encoding of
+ * another UTF-8 character, so the strings are scanned as bytes without decoding characters.
+ */
+struct single_byte_token_counter_fn {
+  column_device_view const d_strings;  // strings to split
+  char const delimiter;                // delimiter for split
+  size_type const max_tokens = std::numeric_limits<size_type>::max();
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) { return 0; }
+
+    auto const d_str      = d_strings.element<string_view>(idx);
+    auto const size       = d_str.size_bytes();
+    size_type token_count = 0;
+    size_type pos         = find_byte(d_str.data(), 0, size, delimiter);
+    while (pos < size && token_count < max_tokens - 1) {
+      token_count++;
+      pos = find_byte(d_str.data(), pos + 1, size, delimiter);
+    }
+    return token_count + 1;  // always at least one token
+  }
+};
+
+/**
+ * @brief Identify the tokens from the `idx'th` string element of `d_strings` when the delimiter
+ * is a single byte.
+ */
+template <Dir dir>
+struct single_byte_token_reader_fn {
+  column_device_view const d_strings;  // strings to split
+  char const delimiter;                // delimiter for split
+  int32_t* d_token_offsets{};          // for locating tokens in d_tokens
+  string_index_pair* d_tokens{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) { return; }
+
+    auto const token_offset = d_token_offsets[idx];
+    auto const token_count  = d_token_offsets[idx + 1] - token_offset;
+    auto d_result           = d_tokens + token_offset;
+    auto const d_str        = d_strings.element<string_view>(idx);
+    if (d_str.empty()) {
+      // Pandas str.split("") for non-whitespace delimiter is an empty string
+      *d_result = string_index_pair{"", 0};
+      return;
+    }
+
+    auto const data = d_str.data();
+    if (dir == Dir::FORWARD) {
+      size_type start = 0;
+      for (size_type token_idx = 0; token_idx < token_count - 1; ++token_idx) {
+        auto const pos      = find_byte(data, start, d_str.size_bytes(), delimiter);
+        d_result[token_idx] = string_index_pair{data + start, pos - start};
+        start               = pos + 1;
+      }
+      d_result[token_count - 1] = string_index_pair{data + start, d_str.size_bytes() - start};
+    } else {
+      size_type end = d_str.size_bytes();
+      for (size_type token_idx = token_count - 1; token_idx > 0; --token_idx) {
+        auto const pos      = rfind_byte(data, end, delimiter);
+        d_result[token_idx] = string_index_pair{data + pos + 1, end - pos - 1};
+        end                 = pos;
+      }
+      d_result[0] = string_index_pair{data, end};
+    }
+  }
+};
+
 /**
  * @brief Compute the number of tokens for the `idx'th` string element of `d_strings`.
  */
@@ -277,6 +411,15 @@ std::unique_ptr<column> split_record(
                            whitespace_token_reader_fn<dir>{*d_strings_column_ptr, max_tokens},
                            mr,
                            stream);
+  } else if (delimiter.size() == 1) {
+    // A one-byte delimiter is ASCII, so the strings are scanned as bytes
+    auto const d_delimiter = delimiter.to_string(stream).front();
+    return split_record_fn(
+      strings,
+      single_byte_token_counter_fn{*d_strings_column_ptr, d_delimiter, max_tokens},
+      single_byte_token_reader_fn<dir>{*d_strings_column_ptr, d_delimiter},
+      mr,
+      stream);
   } else {
     string_view d_delimiter(delimiter.data(), delimiter.size());
     return split_record_fn(strings,
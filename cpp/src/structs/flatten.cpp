@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/structs/detail/flatten.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace structs {
+namespace detail {
+namespace {
+/**
+ * @brief Accumulates the flattened columns of a table
+ */
+struct flattener {
+  flattened_table result;
+  bool const with_order;
+  bool const with_null_precedence;
+  bool const with_null_indicators;
+  cudaStream_t stream;
+  std::vector<column_view> columns;
+
+  void append(column_view const& col, order col_order, null_order col_null_precedence)
+  {
+    columns.push_back(col);
+    if (with_order) { result.column_order.push_back(col_order); }
+    if (with_null_precedence) { result.null_precedence.push_back(col_null_precedence); }
+  }
+
+  /**
+   * @brief Returns a view of `child` with the nulls of `parent` added to its own
+   *
+   * The mask of the result starts at its first row. Fixed-width data and the fields of structs
+   * are viewed at the offset of `child`; other children are copied.
+   */
+  column_view superimpose_nulls(column_view const& parent, column_view const& child)
+  {
+    auto mask = cudf::detail::bitmask_and_with_null_count(
+      table_view{{parent, child}}, rmm::mr::get_default_resource(), stream);
+    auto const null_mask  = static_cast<bitmask_type const*>(mask.first.data());
+    auto const null_count = mask.second;
+
+    if (is_fixed_width(child.type())) {
+      auto const head =
+        static_cast<char const*>(child.head()) + child.offset() * size_of(child.type());
+      result.owned_masks.push_back(std::move(mask.first));
+      return column_view(child.type(), child.size(), head, null_mask, null_count);
+    }
+    if (child.type().id() == type_id::STRUCT) {
+      structs_column_view structs(child);
+      std::vector<column_view> fields;
+      for (size_type i = 0; i < structs.num_children(); ++i) {
+        fields.push_back(structs.child(i));
+      }
+      result.owned_masks.push_back(std::move(mask.first));
+      return column_view(
+        child.type(), child.size(), nullptr, null_mask, null_count, 0, std::move(fields));
+    }
+    auto copy = std::make_unique<column>(child, stream);
+    copy->set_null_mask(std::move(mask.first), null_count);
+    result.owned_columns.push_back(std::move(copy));
+    return result.owned_columns.back()->view();
+  }
+
+  void flatten(column_view const& col, order col_order, null_order col_null_precedence)
+  {
+    if (col.type().id() != type_id::STRUCT) {
+      append(col, col_order, col_null_precedence);
+      return;
+    }
+    if (col.nullable() or with_null_indicators) {
+      // all the valid rows of the null indicator are equal, so that only nulls are ordered
+      auto nulls = make_numeric_column(data_type{type_id::BOOL8},
+                                       col.size(),
+                                       copy_bitmask(col, stream),
+                                       col.null_count(),
+                                       stream);
+      auto nulls_view = nulls->mutable_view();
+      CUDA_TRY(cudaMemsetAsync(nulls_view.head(), 0, col.size(), stream));
+      append(nulls->view(), col_order, col_null_precedence);
+      result.owned_columns.push_back(std::move(nulls));
+    }
+    structs_column_view structs(col);
+    for (size_type i = 0; i < structs.num_children(); ++i) {
+      auto const field = structs.child(i);
+      flatten(col.nullable() ? superimpose_nulls(col, field) : field,
+              col_order,
+              col_null_precedence);
+    }
+  }
+};
+
+}  // namespace
+
+flattened_table flatten_nested_columns(table_view const& input,
+                                       std::vector<order> const& column_order,
+                                       std::vector<null_order> const& null_precedence,
+                                       cudaStream_t stream)
+{
+  if (std::none_of(input.begin(), input.end(), [](auto const& col) {
+        return col.type().id() == type_id::STRUCT;
+      })) {
+    return flattened_table{input, column_order, null_precedence, {}, {}};
+  }
+
+  flattener flat{{}, not column_order.empty(), not null_precedence.empty(), false, stream, {}};
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    flat.flatten(input.column(i),
+                 flat.with_order ? column_order[i] : order::ASCENDING,
+                 flat.with_null_precedence ? null_precedence[i] : null_order::BEFORE);
+  }
+  flat.result.columns = table_view{flat.columns};
+  return std::move(flat.result);
+}
+
+flattened_table flatten_nested_columns_with_null_indicators(table_view const& input,
+                                                            cudaStream_t stream)
+{
+  if (std::none_of(input.begin(), input.end(), [](auto const& col) {
+        return col.type().id() == type_id::STRUCT;
+      })) {
+    return flattened_table{input, {}, {}, {}, {}};
+  }
+
+  flattener flat{{}, false, false, true, stream, {}};
+  for (auto const& col : input) { flat.flatten(col, order::ASCENDING, null_order::BEFORE); }
+  flat.result.columns = table_view{flat.columns};
+  return std::move(flat.result);
+}
+
+namespace {
+/**
+ * @brief Rebuilds the column of `schema` from the flattened columns starting at `flattened`
+ *
+ * @param flattened Next flattened column, advanced past the columns of `schema`
+ * @param schema Column whose flattened columns start at `flattened`
+ * @param parent_nullable Whether a struct holding `schema` is nullable, which makes the struct
+ * columns of `schema` nullable when flattened
+ * @param num_rows Number of rows of the flattened columns
+ */
+std::unique_ptr<column> unflatten(std::vector<std::unique_ptr<column>>::iterator& flattened,
+                                  column_view const& schema,
+                                  bool parent_nullable,
+                                  size_type num_rows)
+{
+  if (schema.type().id() != type_id::STRUCT) { return std::move(*flattened++); }
+  bool const nullable = schema.nullable() or parent_nullable;
+  size_type null_count{0};
+  rmm::device_buffer null_mask{};
+  if (nullable) {
+    auto const indicator = std::move(*flattened++);
+    null_count           = indicator->null_count();
+    null_mask            = std::move(*indicator->release().null_mask);
+  }
+  std::vector<std::unique_ptr<column>> fields;
+  for (size_type i = 0; i < schema.num_children(); ++i) {
+    fields.push_back(unflatten(flattened, schema.child(i), nullable, num_rows));
+  }
+  return make_structs_column(num_rows, std::move(fields), null_count, std::move(null_mask));
+}
+
+}  // namespace
+
+std::unique_ptr<table> unflatten_nested_columns(std::unique_ptr<table>&& flattened,
+                                                table_view const& schema)
+{
+  if (std::none_of(schema.begin(), schema.end(), [](auto const& col) {
+        return col.type().id() == type_id::STRUCT;
+      })) {
+    return std::move(flattened);
+  }
+
+  auto const num_rows = flattened->num_rows();
+  auto columns        = flattened->release();
+  auto next           = columns.begin();
+  std::vector<std::unique_ptr<column>> result;
+  for (auto const& col : schema) { result.push_back(unflatten(next, col, false, num_rows)); }
+  CUDF_EXPECTS(next == columns.end(), "Flattened columns do not match the struct columns");
+  return std::make_unique<table>(std::move(result));
+}
+
+}  // namespace detail
+}  // namespace structs
+}  // namespace cudf
@@ -18,6 +18,7 @@
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
 
 #include <algorithm>
 #include <numeric>
@@ -60,7 +61,7 @@ table_device_view_base<ColumnDeviceView, HostTableView>::table_device_view_base(
     // We need this pointer in order to pass it down when creating the
     // ColumnDeviceViews so the column can set the pointer(s) for any
     // of its child objects.
-    _descendant_storage = new rmm::device_buffer(views_size_bytes, stream);
+    _descendant_storage = new rmm::device_buffer(views_size_bytes, stream, get_scratch_resource());
     _columns            = reinterpret_cast<ColumnDeviceView*>(_descendant_storage->data());
     // The beginning of the memory must be the fixed-sized ColumnDeviceView
     // objects in order for _columns to be used as an array. Therefore,
@@ -0,0 +1,645 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <nvtext/edit_distance.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/pair.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+// Longest string kept in the bits of a single word
+constexpr cudf::size_type max_register_length = 64;
+
+/**
+ * @brief Returns the string of a row, or an empty string for a null row
+ */
+__device__ cudf::string_view value_or_empty(cudf::column_device_view const& d_strings,
+                                            cudf::size_type idx)
+{
+  return d_strings.is_null(idx) ? cudf::string_view{}
+                                : d_strings.element<cudf::string_view>(idx);
+}
+
+/**
+ * @brief Returns the pairs of rows of two strings columns
+ */
+struct column_pairs_fn {
+  cudf::column_device_view const d_strings;
+  cudf::column_device_view const d_targets;
+  __device__ thrust::pair<cudf::string_view, cudf::string_view> operator()(
+    cudf::size_type idx) const
+  {
+    return {value_or_empty(d_strings, idx), value_or_empty(d_targets, idx)};
+  }
+};
+
+/**
+ * @brief Returns the pairs of each row of a strings column with a single string
+ */
+struct scalar_pairs_fn {
+  cudf::column_device_view const d_strings;
+  cudf::string_view const d_target;
+  __device__ thrust::pair<cudf::string_view, cudf::string_view> operator()(
+    cudf::size_type idx) const
+  {
+    return {value_or_empty(d_strings, idx), d_target};
+  }
+};
+
+/**
+ * @brief Returns the pairs of rows `(i, j)` with `i < j` of a strings column, for pair
+ * `i * size + j`. The other pairs are empty.
+ */
+struct matrix_pairs_fn {
+  cudf::column_device_view const d_strings;
+  __device__ thrust::pair<cudf::string_view, cudf::string_view> operator()(
+    cudf::size_type idx) const
+  {
+    auto const row    = idx / d_strings.size();
+    auto const column = idx % d_strings.size();
+    if (row >= column) { return {cudf::string_view{}, cudf::string_view{}}; }
+    return {value_or_empty(d_strings, row), value_or_empty(d_strings, column)};
+  }
+};
+
+/**
+ * @brief Returns the offsets of the working memory of each pair and the working memory
+ *
+ * @param num_pairs Number of pairs
+ * @param size_fn Returns the number of elements of working memory of a pair
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename T, typename SizeFn>
+std::pair<rmm::device_vector<std::size_t>, rmm::device_vector<T>> make_working_memory(
+  cudf::size_type num_pairs, SizeFn size_fn, cudaStream_t stream)
+{
+  rmm::device_vector<std::size_t> offsets(num_pairs + 1);
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(num_pairs + 1),
+    offsets.begin(),
+    [size_fn, num_pairs] __device__(cudf::size_type idx) {
+      return (idx < num_pairs) ? size_fn(idx) : std::size_t{0};
+    },
+    std::size_t{0},
+    thrust::plus<std::size_t>());
+  std::size_t total = 0;
+  CUDA_TRY(cudaMemcpyAsync(&total,
+                           offsets.data().get() + num_pairs,
+                           sizeof(std::size_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return {std::move(offsets), rmm::device_vector<T>(total)};
+}
+
+/**
+ * @brief Computes the edit distance of two strings with Myers' bit-parallel algorithm
+ *
+ * The bit `i` of the vertical delta vectors `pv` and `mv` describes row `i` of the dynamic
+ * programming matrix, so that a column of the matrix is computed with a few word operations.
+ * The match mask of each character of `text` is built by comparing it with the characters
+ * of `pattern`.
+ *
+ * @param pattern The shorter string, with 1 to 64 characters
+ * @param length Number of characters of `pattern`
+ * @param text The other string
+ */
+__device__ cudf::size_type myers_distance(cudf::string_view const& pattern,
+                                          cudf::size_type length,
+                                          cudf::string_view const& text)
+{
+  uint64_t const high_bit = uint64_t{1} << (length - 1);
+  uint64_t pv             = ~uint64_t{0};
+  uint64_t mv             = 0;
+  auto score              = length;
+  for (auto const chr : text) {
+    uint64_t eq  = 0;
+    uint64_t bit = 1;
+    for (auto const pattern_chr : pattern) {
+      if (pattern_chr == chr) { eq |= bit; }
+      bit <<= 1;
+    }
+    auto const xv = eq | mv;
+    auto const xh = (((eq & pv) + pv) ^ pv) | eq;
+    auto ph       = mv | ~(xh | pv);
+    auto mh       = pv & xh;
+    if (ph & high_bit) {
+      ++score;
+    } else if (mh & high_bit) {
+      --score;
+    }
+    ph = (ph << 1) | 1;
+    mh <<= 1;
+    pv = mh | ~(xv | ph);
+    mv = ph & xv;
+  }
+  return score;
+}
+
+/**
+ * @brief Computes the edit distance of two strings over a single row of working memory
+ *
+ * @param pattern The shorter string
+ * @param length Number of characters of `pattern`
+ * @param text The other string
+ * @param d_row Working memory of `length + 1` elements
+ */
+__device__ cudf::size_type row_distance(cudf::string_view const& pattern,
+                                        cudf::size_type length,
+                                        cudf::string_view const& text,
+                                        cudf::size_type* d_row)
+{
+  for (cudf::size_type i = 0; i <= length; ++i) { d_row[i] = i; }
+  cudf::size_type row = 0;
+  for (auto const chr : text) {
+    auto diagonal     = d_row[0];
+    d_row[0]          = ++row;
+    cudf::size_type i = 1;
+    for (auto const pattern_chr : pattern) {
+      auto const above = d_row[i];
+      auto const cost  = static_cast<cudf::size_type>(pattern_chr != chr);
+      d_row[i]         = thrust::min(thrust::min(above, d_row[i - 1]) + 1, diagonal + cost);
+      diagonal         = above;
+      ++i;
+    }
+  }
+  return d_row[length];
+}
+
+/**
+ * @brief Number of elements of working memory for the edit distance of a pair
+ */
+__device__ std::size_t edit_distance_working_size(cudf::string_view const& lhs,
+                                                  cudf::string_view const& rhs)
+{
+  auto const length = thrust::min(lhs.length(), rhs.length());
+  return (length > max_register_length) ? static_cast<std::size_t>(length + 1) : 0;
+}
+
+/**
+ * @brief Computes the edit distance of a pair
+ *
+ * @param d_row Working memory of `edit_distance_working_size()` elements
+ */
+__device__ cudf::size_type compute_distance(cudf::string_view const& lhs,
+                                            cudf::string_view const& rhs,
+                                            cudf::size_type* d_row)
+{
+  auto const lhs_length = lhs.length();
+  auto const rhs_length = rhs.length();
+  auto const swap       = lhs_length > rhs_length;
+  auto const& pattern   = swap ? rhs : lhs;
+  auto const& text      = swap ? lhs : rhs;
+  auto const length     = thrust::min(lhs_length, rhs_length);
+  if (length == 0) { return thrust::max(lhs_length, rhs_length); }
+  return (length <= max_register_length) ? myers_distance(pattern, length, text)
+                                         : row_distance(pattern, length, text, d_row);
+}
+
+/**
+ * @brief Computes the edit distance of each pair into `d_output`
+ */
+template <typename PairsFn>
+void compute_edit_distances(cudf::size_type num_pairs,
+                            PairsFn pairs_fn,
+                            int32_t* d_output,
+                            cudaStream_t stream)
+{
+  auto working_memory = make_working_memory<cudf::size_type>(
+    num_pairs,
+    [pairs_fn] __device__(cudf::size_type idx) {
+      auto const pair = pairs_fn(idx);
+      return edit_distance_working_size(pair.first, pair.second);
+    },
+    stream);
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(num_pairs),
+    d_output,
+    [pairs_fn,
+     d_offsets = working_memory.first.data().get(),
+     d_memory  = working_memory.second.data().get()] __device__(cudf::size_type idx) {
+      auto const pair = pairs_fn(idx);
+      return compute_distance(pair.first, pair.second, d_memory + d_offsets[idx]);
+    });
+}
+
+/**
+ * @brief Flags of the characters of a string with at most 64 characters, in a register
+ */
+struct register_flags {
+  uint64_t bits = 0;
+  __device__ void set(cudf::size_type idx) { bits |= uint64_t{1} << idx; }
+  __device__ bool test(cudf::size_type idx) const { return (bits >> idx) & 1; }
+};
+
+/**
+ * @brief Flags of the characters of a string, in working memory initialized to 0
+ */
+struct memory_flags {
+  uint8_t* d_flags;
+  __device__ void set(cudf::size_type idx) { d_flags[idx] = 1; }
+  __device__ bool test(cudf::size_type idx) const { return d_flags[idx] != 0; }
+};
+
+/**
+ * @brief Computes the Jaro-Winkler similarity of two non-empty strings
+ */
+template <typename Flags>
+__device__ double jaro_winkler_similarity(cudf::string_view const& lhs,
+                                          cudf::size_type lhs_length,
+                                          cudf::string_view const& rhs,
+                                          cudf::size_type rhs_length,
+                                          double prefix_weight,
+                                          Flags lhs_flags,
+                                          Flags rhs_flags)
+{
+  // characters match if they are equal and at most `window` characters apart
+  auto const window            = thrust::max(0, thrust::max(lhs_length, rhs_length) / 2 - 1);
+  cudf::size_type matches      = 0;
+  cudf::size_type window_begin = 0;
+  auto window_itr              = rhs.begin();
+  cudf::size_type i            = 0;
+  for (auto lhs_itr = lhs.begin(); lhs_itr != lhs.end(); ++lhs_itr, ++i) {
+    auto const first = thrust::min(i - window, rhs_length);
+    for (; window_begin < first; ++window_begin) { ++window_itr; }
+    auto const window_end = thrust::min(rhs_length, i + window + 1);
+    auto rhs_itr          = window_itr;
+    for (auto j = window_begin; j < window_end; ++j, ++rhs_itr) {
+      if (!rhs_flags.test(j) && (*lhs_itr == *rhs_itr)) {
+        lhs_flags.set(i);
+        rhs_flags.set(j);
+        ++matches;
+        break;
+      }
+    }
+  }
+  if (matches == 0) { return 0.0; }
+
+  // the matching characters that are not in the same order are transpositions
+  cudf::size_type transpositions = 0;
+  auto rhs_itr                   = rhs.begin();
+  cudf::size_type j              = 0;
+  i                              = 0;
+  for (auto lhs_itr = lhs.begin(); lhs_itr != lhs.end(); ++lhs_itr, ++i) {
+    if (!lhs_flags.test(i)) { continue; }
+    for (; !rhs_flags.test(j); ++j) { ++rhs_itr; }
+    if (*lhs_itr != *rhs_itr) { ++transpositions; }
+    ++j;
+    ++rhs_itr;
+  }
+
+  double const m         = matches;
+  auto const jaro        = (m / lhs_length + m / rhs_length + (m - transpositions / 2.0) / m) / 3.0;
+  cudf::size_type prefix = 0;
+  auto const max_prefix  = thrust::min(4, thrust::min(lhs_length, rhs_length));
+  for (auto l = lhs.begin(), r = rhs.begin(); (prefix < max_prefix) && (*l == *r); ++l, ++r) {
+    ++prefix;
+  }
+  return jaro + prefix * prefix_weight * (1.0 - jaro);
+}
+
+/**
+ * @brief Number of bytes of working memory for the Jaro-Winkler similarity of a pair
+ */
+__device__ std::size_t jaro_winkler_working_size(cudf::string_view const& lhs,
+                                                 cudf::string_view const& rhs)
+{
+  auto const lhs_length = lhs.length();
+  auto const rhs_length = rhs.length();
+  return ((lhs_length > max_register_length) || (rhs_length > max_register_length))
+           ? static_cast<std::size_t>(lhs_length + rhs_length)
+           : 0;
+}
+
+/**
+ * @brief Computes the Jaro-Winkler similarity of a pair
+ *
+ * @param d_flags Working memory of `jaro_winkler_working_size()` bytes
+ */
+__device__ double compute_similarity(cudf::string_view const& lhs,
+                                     cudf::string_view const& rhs,
+                                     double prefix_weight,
+                                     uint8_t* d_flags)
+{
+  auto const lhs_length = lhs.length();
+  auto const rhs_length = rhs.length();
+  if ((lhs_length == 0) || (rhs_length == 0)) { return (lhs_length == rhs_length) ? 1.0 : 0.0; }
+  if ((lhs_length <= max_register_length) && (rhs_length <= max_register_length)) {
+    return jaro_winkler_similarity(
+      lhs, lhs_length, rhs, rhs_length, prefix_weight, register_flags{}, register_flags{});
+  }
+  return jaro_winkler_similarity(lhs,
+                                 lhs_length,
+                                 rhs,
+                                 rhs_length,
+                                 prefix_weight,
+                                 memory_flags{d_flags},
+                                 memory_flags{d_flags + lhs_length});
+}
+
+/**
+ * @brief Computes the Jaro-Winkler similarity of each pair into `d_output`
+ */
+template <typename PairsFn>
+void compute_similarities(cudf::size_type num_pairs,
+                          PairsFn pairs_fn,
+                          double prefix_weight,
+                          double* d_output,
+                          cudaStream_t stream)
+{
+  auto working_memory = make_working_memory<uint8_t>(
+    num_pairs,
+    [pairs_fn] __device__(cudf::size_type idx) {
+      auto const pair = pairs_fn(idx);
+      return jaro_winkler_working_size(pair.first, pair.second);
+    },
+    stream);
+  thrust::transform(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(num_pairs),
+    d_output,
+    [pairs_fn,
+     prefix_weight,
+     d_offsets = working_memory.first.data().get(),
+     d_memory  = working_memory.second.data().get()] __device__(cudf::size_type idx) {
+      auto const pair = pairs_fn(idx);
+      return compute_similarity(pair.first, pair.second, prefix_weight, d_memory + d_offsets[idx]);
+    });
+}
+
+/**
+ * @brief Returns a column of `size` rows for the pairs of two strings columns
+ */
+std::unique_ptr<cudf::column> make_pairs_output(cudf::data_type type,
+                                                cudf::strings_column_view const& strings,
+                                                cudf::strings_column_view const& targets,
+                                                rmm::mr::device_memory_resource* mr,
+                                                cudaStream_t stream)
+{
+  return cudf::make_fixed_width_column(
+    type,
+    strings.size(),
+    cudf::bitmask_and(cudf::table_view({strings.parent(), targets.parent()}), mr, stream),
+    cudf::UNKNOWN_NULL_COUNT,
+    stream,
+    mr);
+}
+
+/**
+ * @brief Returns a column of `size` rows for the pairs of a strings column with a scalar
+ */
+std::unique_ptr<cudf::column> make_scalar_output(cudf::data_type type,
+                                                 cudf::strings_column_view const& strings,
+                                                 cudf::string_scalar const& target,
+                                                 rmm::mr::device_memory_resource* mr,
+                                                 cudaStream_t stream)
+{
+  if (!target.is_valid()) {
+    return cudf::make_fixed_width_column(
+      type, strings.size(), cudf::mask_state::ALL_NULL, stream, mr);
+  }
+  return cudf::make_fixed_width_column(type,
+                                       strings.size(),
+                                       cudf::copy_bitmask(strings.parent(), stream, mr),
+                                       strings.null_count(),
+                                       stream,
+                                       mr);
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
+                                            cudf::strings_column_view const& targets,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(strings.size() == targets.size(), "strings and targets must have the same size");
+  auto const strings_count = strings.size();
+  auto results =
+    make_pairs_output(cudf::data_type{cudf::type_id::INT32}, strings, targets, mr, stream);
+  if (strings_count == 0) { return results; }
+
+  auto const d_strings = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_targets = cudf::column_device_view::create(targets.parent(), stream);
+  compute_edit_distances(strings_count,
+                         column_pairs_fn{*d_strings, *d_targets},
+                         results->mutable_view().data<int32_t>(),
+                         stream);
+  return results;
+}
+
+std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
+                                            cudf::string_scalar const& target,
+                                            rmm::mr::device_memory_resource* mr,
+                                            cudaStream_t stream = 0)
+{
+  auto const strings_count = strings.size();
+  auto results =
+    make_scalar_output(cudf::data_type{cudf::type_id::INT32}, strings, target, mr, stream);
+  if ((strings_count == 0) || !target.is_valid()) { return results; }
+
+  auto const d_strings = cudf::column_device_view::create(strings.parent(), stream);
+  cudf::string_view const d_target(target.data(), target.size());
+  compute_edit_distances(strings_count,
+                         scalar_pairs_fn{*d_strings, d_target},
+                         results->mutable_view().data<int32_t>(),
+                         stream);
+  return results;
+}
+
+std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view const& strings,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream = 0)
+{
+  auto const strings_count = strings.size();
+  CUDF_EXPECTS(static_cast<int64_t>(strings_count) * strings_count <
+                 static_cast<int64_t>(std::numeric_limits<cudf::size_type>::max()),
+               "too many strings to create the distance matrix");
+  auto const num_pairs = strings_count * strings_count;
+
+  auto distances = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                             num_pairs,
+                                             cudf::mask_state::UNALLOCATED,
+                                             stream,
+                                             mr);
+  if (strings_count > 0) {
+    // only the pairs of the upper triangle are computed
+    auto const d_strings = cudf::column_device_view::create(strings.parent(), stream);
+    matrix_pairs_fn const pairs_fn{*d_strings};
+    auto working_memory = make_working_memory<cudf::size_type>(
+      num_pairs,
+      [pairs_fn] __device__(cudf::size_type idx) {
+        auto const pair = pairs_fn(idx);
+        return edit_distance_working_size(pair.first, pair.second);
+      },
+      stream);
+    thrust::for_each_n(
+      rmm::exec_policy(stream)->on(stream),
+      thrust::make_counting_iterator<cudf::size_type>(0),
+      num_pairs,
+      [pairs_fn,
+       strings_count,
+       d_offsets = working_memory.first.data().get(),
+       d_memory  = working_memory.second.data().get(),
+       d_output  = distances->mutable_view().data<int32_t>()] __device__(cudf::size_type idx) {
+        auto const row    = idx / strings_count;
+        auto const column = idx % strings_count;
+        if (row > column) { return; }
+        if (row == column) {
+          d_output[idx] = 0;
+          return;
+        }
+        auto const pair     = pairs_fn(idx);
+        auto const distance = compute_distance(pair.first, pair.second, d_memory + d_offsets[idx]);
+        d_output[idx]                          = distance;
+        d_output[column * strings_count + row] = distance;
+      });
+  }
+
+  // each row is a list of strings_count distances
+  auto offsets = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           strings_count + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto const d_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                   d_offsets,
+                   d_offsets + strings_count + 1,
+                   0,
+                   strings_count);
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(distances),
+                                 0,
+                                 rmm::device_buffer{0, stream, mr},
+                                 stream,
+                                 mr);
+}
+
+std::unique_ptr<cudf::column> jaro_winkler(cudf::strings_column_view const& strings,
+                                           cudf::strings_column_view const& targets,
+                                           double prefix_weight,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(strings.size() == targets.size(), "strings and targets must have the same size");
+  CUDF_EXPECTS(prefix_weight >= 0.0 && prefix_weight <= 0.25,
+               "prefix_weight must be within [0, 0.25]");
+  auto const strings_count = strings.size();
+  auto results =
+    make_pairs_output(cudf::data_type{cudf::type_id::FLOAT64}, strings, targets, mr, stream);
+  if (strings_count == 0) { return results; }
+
+  auto const d_strings = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_targets = cudf::column_device_view::create(targets.parent(), stream);
+  compute_similarities(strings_count,
+                       column_pairs_fn{*d_strings, *d_targets},
+                       prefix_weight,
+                       results->mutable_view().data<double>(),
+                       stream);
+  return results;
+}
+
+std::unique_ptr<cudf::column> jaro_winkler(cudf::strings_column_view const& strings,
+                                           cudf::string_scalar const& target,
+                                           double prefix_weight,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(prefix_weight >= 0.0 && prefix_weight <= 0.25,
+               "prefix_weight must be within [0, 0.25]");
+  auto const strings_count = strings.size();
+  auto results =
+    make_scalar_output(cudf::data_type{cudf::type_id::FLOAT64}, strings, target, mr, stream);
+  if ((strings_count == 0) || !target.is_valid()) { return results; }
+
+  auto const d_strings = cudf::column_device_view::create(strings.parent(), stream);
+  cudf::string_view const d_target(target.data(), target.size());
+  compute_similarities(strings_count,
+                       scalar_pairs_fn{*d_strings, d_target},
+                       prefix_weight,
+                       results->mutable_view().data<double>(),
+                       stream);
+  return results;
+}
+
+}  // namespace detail
+
+std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
+                                            cudf::strings_column_view const& targets,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance(strings, targets, mr);
+}
+
+std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& strings,
+                                            cudf::string_scalar const& target,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance(strings, target, mr);
+}
+
+std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view const& strings,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance_matrix(strings, mr);
+}
+
+std::unique_ptr<cudf::column> jaro_winkler(cudf::strings_column_view const& strings,
+                                           cudf::strings_column_view const& targets,
+                                           double prefix_weight,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::jaro_winkler(strings, targets, prefix_weight, mr);
+}
+
+std::unique_ptr<cudf::column> jaro_winkler(cudf::strings_column_view const& strings,
+                                           cudf::string_scalar const& target,
+                                           double prefix_weight,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::jaro_winkler(strings, target, prefix_weight, mr);
+}
+
+}  // namespace nvtext
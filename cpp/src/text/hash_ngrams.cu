@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <nvtext/hash_ngrams.hpp>
+#include <text/utilities/tokenize_ops.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_scan.h>
+
+namespace nvtext {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the feature index of a hash value
+ */
+__device__ int32_t feature_index(uint32_t hash, cudf::size_type num_features)
+{
+  return static_cast<int32_t>(hash % static_cast<uint32_t>(num_features));
+}
+
+/**
+ * @brief Counts the character ngrams of each string
+ */
+struct character_ngrams_counter_fn {
+  cudf::column_device_view const d_strings;  // strings to count the ngrams of
+  cudf::size_type ngrams;                    // number of characters of each ngram
+
+  __device__ cudf::size_type operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return 0;
+    auto const length = d_strings.element<cudf::string_view>(idx).length();
+    return (length >= ngrams) ? length - ngrams + 1 : 0;
+  }
+};
+
+/**
+ * @brief Hashes the character ngrams of each string into their feature indices
+ *
+ * A window of `ngrams` characters slides over each string; the ngram in the window is
+ * hashed in place in the chars of the column.
+ */
+struct character_ngrams_hasher_fn {
+  cudf::column_device_view const d_strings;  // strings to hash the ngrams of
+  cudf::size_type ngrams;                    // number of characters of each ngram
+  cudf::size_type num_features;              // number of features to map the hashes to
+  uint32_t seed;                             // seed of the hash function
+  int32_t const* d_offsets;                  // offsets of the features of each string
+  int32_t* d_features;                       // output feature indices
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    auto const count = d_offsets[idx + 1] - d_offsets[idx];
+    if (count == 0) return;
+    auto const d_str    = d_strings.element<cudf::string_view>(idx);
+    auto const features = d_features + d_offsets[idx];
+    cudf::detail::MurmurHash3_32<cudf::string_view> const hasher(seed);
+    auto begin = d_str.begin();
+    auto end   = begin + ngrams;
+    for (cudf::size_type i = 0; i < count; ++i) {
+      auto const position = begin.byte_offset();
+      auto const ngram = cudf::string_view(d_str.data() + position, end.byte_offset() - position);
+      features[i]      = feature_index(hasher(ngram), num_features);
+      // the iterators are not moved past the end of the string
+      if (i + 1 < count) {
+        ++begin;
+        ++end;
+      }
+    }
+  }
+};
+
+/**
+ * @brief Hashes the tokens of each string
+ */
+struct token_hasher_fn {
+  cudf::column_device_view const d_strings;  // strings to tokenize
+  cudf::string_view const d_delimiter;       // delimiter to tokenize around
+  uint32_t seed;                             // seed of the hash function
+  int32_t const* d_token_offsets;            // offsets of the tokens of each string
+  uint32_t* d_token_hashes;                  // output token hashes
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return;
+    auto const d_str = d_strings.element<cudf::string_view>(idx);
+    cudf::detail::MurmurHash3_32<cudf::string_view> const hasher(seed);
+    characters_tokenizer tokenizer(d_str, d_delimiter);
+    auto token_hashes = d_token_hashes + d_token_offsets[idx];
+    while (tokenizer.next_token()) {
+      auto const pos  = tokenizer.token_byte_positions();
+      *token_hashes++ = hasher(cudf::string_view(d_str.data() + pos.first, pos.second - pos.first));
+    }
+  }
+};
+
+/**
+ * @brief Combines the hashes of the token ngrams of each string into their feature indices
+ */
+struct token_ngrams_hasher_fn {
+  cudf::size_type ngrams;          // number of tokens of each ngram
+  cudf::size_type num_features;    // number of features to map the hashes to
+  int32_t const* d_token_offsets;  // offsets of the tokens of each string
+  uint32_t const* d_token_hashes;  // hashes of the tokens
+  int32_t const* d_offsets;        // offsets of the features of each string
+  int32_t* d_features;             // output feature indices
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    auto const token_hashes = d_token_hashes + d_token_offsets[idx];
+    auto const features     = d_features + d_offsets[idx];
+    auto const count        = d_offsets[idx + 1] - d_offsets[idx];
+    cudf::detail::MurmurHash3_32<cudf::string_view> hasher;
+    for (cudf::size_type i = 0; i < count; ++i) {
+      auto hash = token_hashes[i];
+      for (cudf::size_type n = 1; n < ngrams; ++n) {
+        hash = hasher.hash_combine(hash, token_hashes[i + n]);
+      }
+      features[i] = feature_index(hash, num_features);
+    }
+  }
+};
+
+/**
+ * @brief Creates an INT32 offsets column from the counts returned by `count_fn` for each row
+ */
+template <typename CountFn>
+std::unique_ptr<cudf::column> make_counts_offsets(cudf::size_type num_rows,
+                                                  CountFn count_fn,
+                                                  rmm::mr::device_memory_resource* mr,
+                                                  cudaStream_t stream)
+{
+  auto offsets = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           num_rows + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto const d_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::transform_inclusive_scan(rmm::exec_policy(stream)->on(stream),
+                                   thrust::make_counting_iterator<cudf::size_type>(0),
+                                   thrust::make_counting_iterator<cudf::size_type>(num_rows),
+                                   d_offsets + 1,
+                                   count_fn,
+                                   thrust::plus<int32_t>());
+  CUDA_TRY(cudaMemsetAsync(d_offsets, 0, sizeof(int32_t), stream));
+  return offsets;
+}
+
+/**
+ * @brief Creates the LIST column of the features of each string
+ *
+ * The features are computed by `features_fn`, called for each string with the output
+ * offsets and feature indices pointers.
+ */
+template <typename FeaturesFn>
+std::unique_ptr<cudf::column> make_features_column(cudf::strings_column_view const& strings,
+                                                   std::unique_ptr<cudf::column> offsets,
+                                                   FeaturesFn features_fn,
+                                                   rmm::mr::device_memory_resource* mr,
+                                                   cudaStream_t stream)
+{
+  auto const strings_count = strings.size();
+  auto const total_features =
+    cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+  auto features = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                            total_features,
+                                            cudf::mask_state::UNALLOCATED,
+                                            stream,
+                                            mr);
+  features_fn.d_offsets  = offsets->view().data<int32_t>();
+  features_fn.d_features = features->mutable_view().data<int32_t>();
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     features_fn);
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(features),
+                                 strings.null_count(),
+                                 cudf::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::column> hash_ngrams(cudf::strings_column_view const& strings,
+                                          cudf::size_type ngrams,
+                                          cudf::size_type num_features,
+                                          uint32_t seed,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(ngrams >= 1, "Parameter ngrams should be an integer value of 1 or greater");
+  CUDF_EXPECTS(num_features >= 1, "Parameter num_features should be 1 or greater");
+
+  auto const strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_strings      = *strings_column;
+
+  // Ex. ngrams=2: ["abab","ab","a"] => ngram-counts = [3,1,0]; offsets = [0,3,4,4]
+  auto offsets = make_counts_offsets(
+    strings.size(), character_ngrams_counter_fn{d_strings, ngrams}, mr, stream);
+  return make_features_column(
+    strings,
+    std::move(offsets),
+    character_ngrams_hasher_fn{d_strings, ngrams, num_features, seed, nullptr, nullptr},
+    mr,
+    stream);
+}
+
+std::unique_ptr<cudf::column> hash_tokens(cudf::strings_column_view const& strings,
+                                          cudf::size_type ngrams,
+                                          cudf::size_type num_features,
+                                          cudf::string_scalar const& delimiter,
+                                          uint32_t seed,
+                                          rmm::mr::device_memory_resource* mr,
+                                          cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(ngrams >= 1, "Parameter ngrams should be an integer value of 1 or greater");
+  CUDF_EXPECTS(num_features >= 1, "Parameter num_features should be 1 or greater");
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+  cudf::string_view d_delimiter(delimiter.data(), delimiter.size());
+
+  auto const strings_count  = strings.size();
+  auto const execpol        = rmm::exec_policy(stream);
+  auto const strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_strings      = *strings_column;
+
+  // Example for comments with ngrams=2
+  // ["a b a b","b a"] => token-offsets = [0,4,6]; ngram-offsets = [0,3,4]
+
+  // the tokens are hashed once; each token is part of up to `ngrams` ngrams
+  rmm::device_vector<int32_t> token_offsets(strings_count + 1);
+  auto d_token_offsets = token_offsets.data().get();
+  thrust::transform_inclusive_scan(execpol->on(stream),
+                                   thrust::make_counting_iterator<cudf::size_type>(0),
+                                   thrust::make_counting_iterator<cudf::size_type>(strings_count),
+                                   d_token_offsets + 1,
+                                   strings_tokenizer{d_strings, d_delimiter},
+                                   thrust::plus<int32_t>());
+  CUDA_TRY(cudaMemsetAsync(d_token_offsets, 0, sizeof(int32_t), stream));
+  rmm::device_vector<uint32_t> token_hashes(token_offsets.back());
+  auto d_token_hashes = token_hashes.data().get();
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    strings_count,
+    token_hasher_fn{d_strings, d_delimiter, seed, d_token_offsets, d_token_hashes});
+
+  auto offsets = make_counts_offsets(
+    strings_count,
+    [d_token_offsets, ngrams] __device__(cudf::size_type idx) {
+      auto token_count = d_token_offsets[idx + 1] - d_token_offsets[idx];
+      return (token_count >= ngrams) ? token_count - ngrams + 1 : 0;
+    },
+    mr,
+    stream);
+  return make_features_column(
+    strings,
+    std::move(offsets),
+    token_ngrams_hasher_fn{ngrams, num_features, d_token_offsets, d_token_hashes, nullptr, nullptr},
+    mr,
+    stream);
+}
+
+}  // namespace detail
+
+// external APIs
+
+std::unique_ptr<cudf::column> hash_ngrams(cudf::strings_column_view const& strings,
+                                          cudf::size_type ngrams,
+                                          cudf::size_type num_features,
+                                          uint32_t seed,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_ngrams(strings, ngrams, num_features, seed, mr);
+}
+
+std::unique_ptr<cudf::column> hash_tokens(cudf::strings_column_view const& strings,
+                                          cudf::size_type ngrams,
+                                          cudf::size_type num_features,
+                                          cudf::string_scalar const& delimiter,
+                                          uint32_t seed,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_tokens(strings, ngrams, num_features, delimiter, seed, mr);
+}
+
+}  // namespace nvtext
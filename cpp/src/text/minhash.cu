@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <nvtext/minhash.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <cub/warp/warp_reduce.cuh>
+
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+constexpr int minhash_block_size = 256;
+
+/**
+ * @brief Computes the minhash values of each string for each seed
+ *
+ * Each string is processed by one warp. The lanes hash the ngrams starting at the characters of
+ * their bytes and the minimum of each seed is reduced across the warp, so long strings do not
+ * serialize on a single thread. The ngrams are hashed in place in the chars of the column.
+ *
+ * @param d_strings Strings to hash
+ * @param d_seeds Seeds of the hash functions
+ * @param num_seeds Number of seeds
+ * @param width Number of characters of each ngram
+ * @param d_hashes Output minhash values; `num_seeds` consecutive values per string
+ */
+__launch_bounds__(minhash_block_size) __global__
+  void minhash_kernel(cudf::column_device_view const d_strings,
+                      uint32_t const* __restrict__ d_seeds,
+                      cudf::size_type num_seeds,
+                      cudf::size_type width,
+                      uint32_t* __restrict__ d_hashes)
+{
+  constexpr cudf::size_type warps_per_block = minhash_block_size / cudf::detail::warp_size;
+  using WarpReduce                          = cub::WarpReduce<uint32_t>;
+  __shared__ typename WarpReduce::TempStorage temp_storage[warps_per_block];
+
+  auto const warp_id = threadIdx.x / cudf::detail::warp_size;
+  auto const lane_id = static_cast<cudf::size_type>(threadIdx.x % cudf::detail::warp_size);
+  for (cudf::size_type idx = blockIdx.x * warps_per_block + warp_id; idx < d_strings.size();
+       idx += gridDim.x * warps_per_block) {
+    auto const d_output = d_hashes + static_cast<std::size_t>(idx) * num_seeds;
+    if (d_strings.is_null(idx)) {
+      for (auto s = lane_id; s < num_seeds; s += cudf::detail::warp_size) { d_output[s] = 0; }
+      continue;
+    }
+    auto const d_str = d_strings.element<cudf::string_view>(idx);
+    auto const data  = d_str.data();
+    auto const bytes = d_str.size_bytes();
+
+    for (cudf::size_type s = 0; s < num_seeds; ++s) {
+      cudf::detail::MurmurHash3_32<cudf::string_view> const hasher(d_seeds[s]);
+      // an empty string is hashed as a single empty ngram
+      auto mh = ((bytes == 0) && (lane_id == 0)) ? hasher(d_str)
+                                                 : std::numeric_limits<uint32_t>::max();
+      for (auto begin = lane_id; begin < bytes; begin += cudf::detail::warp_size) {
+        if (!cudf::strings::detail::is_begin_utf8_char(static_cast<uint8_t>(data[begin]))) {
+          continue;
+        }
+        auto end              = begin + 1;
+        cudf::size_type chars = 1;
+        while (end < bytes) {
+          if (cudf::strings::detail::is_begin_utf8_char(static_cast<uint8_t>(data[end]))) {
+            if (chars == width) { break; }
+            ++chars;
+          }
+          ++end;
+        }
+        // the short ngrams at the end of a string are skipped, unless the whole string is short
+        if ((chars < width) && (begin > 0)) { continue; }
+        mh = cub::Min()(mh, hasher(cudf::string_view(data + begin, end - begin)));
+      }
+      mh = WarpReduce(temp_storage[warp_id]).Reduce(mh, cub::Min());
+      if (lane_id == 0) { d_output[s] = mh; }
+      __syncwarp();
+    }
+  }
+}
+
+/**
+ * @brief Computes the minhash values of the strings into `d_hashes`
+ */
+void compute_minhash(cudf::strings_column_view const& strings,
+                     uint32_t const* d_seeds,
+                     cudf::size_type num_seeds,
+                     cudf::size_type width,
+                     uint32_t* d_hashes,
+                     cudaStream_t stream)
+{
+  if (strings.size() == 0) { return; }
+  auto const d_strings = cudf::column_device_view::create(strings.parent(), stream);
+  auto const num_blocks =
+    cudf::util::div_rounding_up_safe(strings.size(), minhash_block_size / cudf::detail::warp_size);
+  minhash_kernel<<<num_blocks, minhash_block_size, 0, stream>>>(
+    *d_strings, d_seeds, num_seeds, width, d_hashes);
+  CHECK_CUDA(stream);
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::numeric_scalar<uint32_t> const& seed,
+                                      cudf::size_type width,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(width >= 2, "Parameter width should be an integer value of 2 or greater");
+  CUDF_EXPECTS(seed.is_valid(), "Parameter seed must be valid");
+  auto output = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          strings.size(),
+                                          cudf::copy_bitmask(strings.parent(), stream, mr),
+                                          strings.null_count(),
+                                          stream,
+                                          mr);
+  compute_minhash(
+    strings, seed.data(), 1, width, output->mutable_view().data<uint32_t>(), stream);
+  return output;
+}
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      rmm::mr::device_memory_resource* mr,
+                                      cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(width >= 2, "Parameter width should be an integer value of 2 or greater");
+  CUDF_EXPECTS(seeds.type().id() == cudf::type_id::UINT32, "Parameter seeds must be UINT32");
+  CUDF_EXPECTS(!seeds.is_empty(), "Parameter seeds must not be empty");
+  CUDF_EXPECTS(!seeds.has_nulls(), "Parameter seeds must not have nulls");
+
+  auto const strings_count = strings.size();
+  auto const num_seeds     = seeds.size();
+  auto hashes              = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          strings_count * num_seeds,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  compute_minhash(strings,
+                  seeds.data<uint32_t>(),
+                  num_seeds,
+                  width,
+                  hashes->mutable_view().data<uint32_t>(),
+                  stream);
+
+  // every row has num_seeds values
+  auto offsets = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           strings_count + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto const d_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::sequence(rmm::exec_policy(stream)->on(stream),
+                   d_offsets,
+                   d_offsets + strings_count + 1,
+                   0,
+                   num_seeds);
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(hashes),
+                                 strings.null_count(),
+                                 cudf::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+std::unique_ptr<cudf::column> minhash_lsh_buckets(cudf::lists_column_view const& signatures,
+                                                  cudf::size_type num_bands,
+                                                  rmm::mr::device_memory_resource* mr,
+                                                  cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(signatures.child().type().id() == cudf::type_id::UINT32,
+               "Signatures must be a LIST column of UINT32 values");
+  auto const num_rows = signatures.size();
+  auto const execpol  = rmm::exec_policy(stream);
+
+  auto const d_offsets  = signatures.offsets().data<int32_t>() + signatures.offset();
+  cudf::size_type num_hashes = num_bands;
+  if (num_rows > 0) {
+    auto const offsets = signatures.offsets();
+    num_hashes = cudf::detail::get_value<int32_t>(offsets, signatures.offset() + 1, stream) -
+                 cudf::detail::get_value<int32_t>(offsets, signatures.offset(), stream);
+  }
+  CUDF_EXPECTS(thrust::all_of(execpol->on(stream),
+                              thrust::make_counting_iterator<cudf::size_type>(0),
+                              thrust::make_counting_iterator<cudf::size_type>(num_rows),
+                              [d_offsets, num_hashes] __device__(cudf::size_type idx) {
+                                return d_offsets[idx + 1] - d_offsets[idx] == num_hashes;
+                              }),
+               "Signatures must all have the same number of values");
+  CUDF_EXPECTS(num_bands > 0 && num_hashes % num_bands == 0,
+               "Parameter num_bands must divide the number of values of the signatures");
+
+  auto const rows_per_band = num_hashes / num_bands;
+  auto const num_buckets   = num_rows * num_bands;
+  auto buckets             = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                           num_buckets,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto const d_values = signatures.child().data<uint32_t>();
+  thrust::transform(execpol->on(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(num_buckets),
+                    buckets->mutable_view().begin<uint32_t>(),
+                    [d_offsets, d_values, num_bands, rows_per_band] __device__(
+                      cudf::size_type idx) {
+                      auto const band  = idx % num_bands;
+                      auto const row   = idx / num_bands;
+                      auto const begin = d_values + d_offsets[row] + band * rows_per_band;
+                      cudf::detail::MurmurHash3_32<uint32_t> hasher(band);
+                      auto bucket = hasher(begin[0]);
+                      for (cudf::size_type i = 1; i < rows_per_band; ++i) {
+                        bucket = hasher.hash_combine(bucket, hasher(begin[i]));
+                      }
+                      return bucket;
+                    });
+
+  auto offsets = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           num_rows + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto const d_bucket_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::sequence(
+    execpol->on(stream), d_bucket_offsets, d_bucket_offsets + num_rows + 1, 0, num_bands);
+  return cudf::make_lists_column(num_rows,
+                                 std::move(offsets),
+                                 std::move(buckets),
+                                 signatures.null_count(),
+                                 cudf::copy_bitmask(signatures.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::numeric_scalar<uint32_t> const& seed,
+                                      cudf::size_type width,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash(strings, seed, width, mr);
+}
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& strings,
+                                      cudf::column_view const& seeds,
+                                      cudf::size_type width,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash(strings, seeds, width, mr);
+}
+
+std::unique_ptr<cudf::column> minhash_lsh_buckets(cudf::lists_column_view const& signatures,
+                                                  cudf::size_type num_bands,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash_lsh_buckets(signatures, num_bands, mr);
+}
+
+}  // namespace nvtext
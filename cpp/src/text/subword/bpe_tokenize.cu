@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <text/subword/detail/cp_data.h>
+#include <text/subword/detail/data_normalizer.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <hash/concurrent_unordered_map.cuh>
+#include <nvtext/bpe_tokenize.hpp>
+#include <strings/utilities.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace nvtext {
+namespace detail {
+/**
+ * @brief Device hash table of the merge rules of a `bpe_vocabulary`
+ *
+ * The key is the pair of token ids of a merge rule, with the left id in the high 32 bits.
+ * The value is the rank of the rule in the high 32 bits and the id of the merged token in
+ * the low 32 bits, so that comparing two values compares their ranks.
+ */
+struct bpe_merge_table {
+  using map_type = concurrent_unordered_map<uint64_t, uint64_t>;
+  std::unique_ptr<map_type, std::function<void(map_type*)>> map;
+};
+
+namespace {
+__host__ __device__ inline uint64_t make_merge_key(uint32_t left, uint32_t right)
+{
+  return (static_cast<uint64_t>(left) << 32) | right;
+}
+
+/**
+ * @brief Returns the byte of each code point of the byte-level encoding of GPT-2
+ *
+ * The printable bytes are represented by the character of the same code point and the other
+ * bytes by the code points from 256 on, in order.
+ */
+std::unordered_map<uint32_t, char> make_unicode_to_byte()
+{
+  std::unordered_map<uint32_t, char> result;
+  uint32_t next_code_point = 256;
+  for (uint32_t byte = 0; byte < 256; ++byte) {
+    bool const printable = ((byte >= '!') && (byte <= '~')) || ((byte >= 0xA1) && (byte <= 0xAC)) ||
+                           (byte >= 0xAE);
+    result[printable ? byte : next_code_point++] = static_cast<char>(byte);
+  }
+  return result;
+}
+
+/**
+ * @brief Converts a token in the byte-level encoding to the bytes it represents
+ */
+std::string decode_token(std::string const& token,
+                         std::unordered_map<uint32_t, char> const& unicode_to_byte)
+{
+  std::string result;
+  for (std::size_t pos = 0; pos < token.size();) {
+    auto const lead      = static_cast<uint8_t>(token[pos]);
+    auto const num_bytes = (lead < 0x80) ? 1 : (lead < 0xE0) ? 2 : (lead < 0xF0) ? 3 : 4;
+    uint32_t code_point  = (num_bytes == 1) ? lead : (lead & (0xFF >> (num_bytes + 1)));
+    for (int i = 1; (i < num_bytes) && (pos + i < token.size()); ++i) {
+      code_point = (code_point << 6) | (static_cast<uint8_t>(token[pos + i]) & 0x3F);
+    }
+    auto const itr = unicode_to_byte.find(code_point);
+    CUDF_EXPECTS(itr != unicode_to_byte.end(), "Invalid byte-level token: " + token);
+    result.push_back(itr->second);
+    pos += num_bytes;
+  }
+  return result;
+}
+
+enum class char_class : uint8_t { WHITESPACE, PUNCTUATION, OTHER };
+
+/**
+ * @brief Returns the class of a character from its code point metadata
+ */
+__device__ char_class classify(codepoint_metadata_type const* d_cp_metadata, cudf::char_utf8 chr)
+{
+  auto const metadata = d_cp_metadata[cudf::strings::detail::utf8_to_codepoint(chr)];
+  auto const category = (metadata >> TOKEN_CAT_SHIFT) & TOKEN_CAT_MASK;
+  if (category == TOKEN_CAT_ALWAYS_REPLACE) { return char_class::WHITESPACE; }
+  return (category == TOKEN_CAT_ADD_SPACE) ? char_class::PUNCTUATION : char_class::OTHER;
+}
+
+/**
+ * @brief Splits each string into words
+ *
+ * A word begins at each whitespace character and where the class of the characters changes
+ * after a character that is not whitespace. This is called twice: first to count the words of
+ * each string and then to store the byte range of each word.
+ */
+struct word_splitter_fn {
+  cudf::column_device_view const d_strings;
+  codepoint_metadata_type const* d_cp_metadata;
+  char const* d_chars;  ///< positions of the words are relative to this
+  int32_t const* d_word_offsets{};
+  cudf::size_type* d_word_begins{};
+  cudf::size_type* d_word_ends{};
+
+  __device__ cudf::size_type operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return 0;
+    auto const d_str      = d_strings.element<cudf::string_view>(idx);
+    auto const base       = static_cast<cudf::size_type>(d_str.data() - d_chars);
+    auto d_begins         = d_word_begins ? d_word_begins + d_word_offsets[idx] : nullptr;
+    auto d_ends           = d_word_ends ? d_word_ends + d_word_offsets[idx] : nullptr;
+    cudf::size_type count = 0;
+    auto prev             = char_class::WHITESPACE;
+    for (auto itr = d_str.begin(); itr != d_str.end(); ++itr) {
+      auto const cls = classify(d_cp_metadata, *itr);
+      if ((itr.position() == 0) || (cls == char_class::WHITESPACE) ||
+          ((prev != char_class::WHITESPACE) && (cls != prev))) {
+        auto const position = base + itr.byte_offset();
+        if (d_begins) {
+          if (count > 0) { d_ends[count - 1] = position; }
+          d_begins[count] = position;
+        }
+        ++count;
+      }
+      prev = cls;
+    }
+    if (d_ends && (count > 0)) { d_ends[count - 1] = base + d_str.size_bytes(); }
+    return count;
+  }
+};
+
+/**
+ * @brief Applies the merge rules to each word
+ *
+ * The tokens of a word are kept in place in `d_tokens` at the byte positions of the word,
+ * starting with one token per byte. Each step merges the leftmost adjacent pair with the
+ * lowest rank, which gives the same tokens as merging all pairs of a rank at once.
+ *
+ * @return The number of tokens of the word
+ */
+struct bpe_merge_fn {
+  char const* d_chars;
+  cudf::size_type const* d_word_begins;
+  cudf::size_type const* d_word_ends;
+  uint32_t const* d_byte_token_ids;
+  bpe_merge_table::map_type const d_merges;
+  uint32_t* d_tokens;
+
+  __device__ cudf::size_type operator()(cudf::size_type idx) const
+  {
+    auto const begin = d_word_begins[idx];
+    auto tokens      = d_tokens + begin;
+    auto num_tokens  = d_word_ends[idx] - begin;
+    for (cudf::size_type i = 0; i < num_tokens; ++i) {
+      tokens[i] = d_byte_token_ids[static_cast<uint8_t>(d_chars[begin + i])];
+    }
+    while (num_tokens > 1) {
+      auto best_merge          = std::numeric_limits<uint64_t>::max();
+      cudf::size_type best_pos = -1;
+      for (cudf::size_type i = 0; i + 1 < num_tokens; ++i) {
+        auto const found = d_merges.find(make_merge_key(tokens[i], tokens[i + 1]));
+        if ((found != d_merges.end()) && ((*found).second < best_merge)) {
+          best_merge = (*found).second;
+          best_pos   = i;
+        }
+      }
+      if (best_pos < 0) break;
+      tokens[best_pos] = static_cast<uint32_t>(best_merge);
+      for (auto i = best_pos + 1; i + 1 < num_tokens; ++i) { tokens[i] = tokens[i + 1]; }
+      --num_tokens;
+    }
+    return num_tokens;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<bpe_vocabulary> load_bpe_vocabulary(std::string const& filename_vocabulary,
+                                                    std::string const& filename_merges,
+                                                    cudaStream_t stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  auto const unicode_to_byte = make_unicode_to_byte();
+
+  std::ifstream vocabulary_file(filename_vocabulary);
+  CUDF_EXPECTS(vocabulary_file.good(), "Could not open " + filename_vocabulary);
+  std::unordered_map<std::string, uint32_t> token_ids;
+  uint32_t token_id = 0;
+  std::string line;
+  while (std::getline(vocabulary_file, line)) {
+    if (!line.empty()) { token_ids.emplace(decode_token(line, unicode_to_byte), token_id); }
+    ++token_id;
+  }
+
+  auto result             = std::make_unique<bpe_vocabulary>();
+  result->vocabulary_size = static_cast<cudf::size_type>(token_id);
+
+  std::vector<uint32_t> byte_token_ids(256);
+  for (int byte = 0; byte < 256; ++byte) {
+    auto const itr = token_ids.find(std::string(1, static_cast<char>(byte)));
+    CUDF_EXPECTS(itr != token_ids.end(), "The vocabulary must have a token for each byte");
+    byte_token_ids[byte] = itr->second;
+  }
+  result->byte_token_ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                                     byte_token_ids.size(),
+                                                     cudf::mask_state::UNALLOCATED,
+                                                     stream,
+                                                     mr);
+  CUDA_TRY(cudaMemcpyAsync(result->byte_token_ids->mutable_view().data<uint32_t>(),
+                           byte_token_ids.data(),
+                           byte_token_ids.size() * sizeof(uint32_t),
+                           cudaMemcpyHostToDevice,
+                           stream));
+
+  std::ifstream merges_file(filename_merges);
+  CUDF_EXPECTS(merges_file.good(), "Could not open " + filename_merges);
+  std::vector<uint64_t> keys;
+  std::vector<uint64_t> values;
+  std::unordered_set<uint64_t> unique_keys;
+  auto find_token = [&token_ids, &line](std::string const& token) {
+    auto const itr = token_ids.find(token);
+    CUDF_EXPECTS(itr != token_ids.end(), "Merge pair is not in the vocabulary: " + line);
+    return itr->second;
+  };
+  while (std::getline(merges_file, line)) {
+    if (line.empty() || (line.compare(0, 8, "#version") == 0)) continue;
+    auto const space = line.find(' ');
+    CUDF_EXPECTS(space != std::string::npos, "Invalid merge pair: " + line);
+    auto const left      = decode_token(line.substr(0, space), unicode_to_byte);
+    auto const right     = decode_token(line.substr(space + 1), unicode_to_byte);
+    auto const key       = make_merge_key(find_token(left), find_token(right));
+    auto const merged_id = find_token(left + right);
+    // the first rule of a pair has the priority
+    if (!unique_keys.insert(key).second) continue;
+    values.push_back((static_cast<uint64_t>(keys.size()) << 32) | merged_id);
+    keys.push_back(key);
+  }
+  result->num_merges = static_cast<cudf::size_type>(keys.size());
+
+  using map_type = bpe_merge_table::map_type;
+  result->merges = std::make_unique<bpe_merge_table>();
+  result->merges->map =
+    map_type::create(std::max<std::size_t>(2 * keys.size(), 1),
+                     std::numeric_limits<uint64_t>::max(),
+                     std::numeric_limits<uint64_t>::max(),
+                     map_type::hasher{},
+                     map_type::key_equal{},
+                     map_type::allocator_type{},
+                     stream);
+  rmm::device_vector<uint64_t> d_keys(keys);
+  rmm::device_vector<uint64_t> d_values(values);
+  thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     result->num_merges,
+                     [d_map    = *result->merges->map,
+                      d_keys   = d_keys.data().get(),
+                      d_values = d_values.data().get()] __device__(cudf::size_type idx) mutable {
+                       d_map.insert(thrust::make_pair(d_keys[idx], d_values[idx]));
+                     });
+  // the temporary vectors are freed on return
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return result;
+}
+
+std::unique_ptr<cudf::column> bpe_tokenize(cudf::strings_column_view const& strings,
+                                           bpe_vocabulary const& vocabulary,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream = 0)
+{
+  auto const strings_count = strings.size();
+  auto const execpol       = rmm::exec_policy(stream);
+
+  // the words are located by their byte position relative to the first string
+  cudf::size_type chars_begin = 0;
+  cudf::size_type chars_end   = 0;
+  char const* d_chars         = nullptr;
+  if (strings_count > 0) {
+    chars_begin = cudf::detail::get_value<int32_t>(strings.offsets(), strings.offset(), stream);
+    chars_end   = cudf::detail::get_value<int32_t>(
+      strings.offsets(), strings.offset() + strings_count, stream);
+    d_chars = strings.chars().data<char>() + chars_begin;
+  }
+
+  auto const strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_strings      = *strings_column;
+  word_splitter_fn splitter{d_strings, get_codepoint_metadata(stream), d_chars};
+
+  // count the words of each string
+  rmm::device_vector<int32_t> word_offsets(strings_count + 1);
+  thrust::transform_exclusive_scan(
+    execpol->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count + 1),
+    word_offsets.begin(),
+    [splitter, strings_count] __device__(cudf::size_type idx) {
+      return (idx == strings_count) ? 0 : splitter(idx);
+    },
+    int32_t{0},
+    thrust::plus<int32_t>());
+  auto const d_word_offsets = word_offsets.data().get();
+  auto const total_words    = cudf::detail::get_value<int32_t>(
+    cudf::column_view(cudf::data_type{cudf::type_id::INT32}, strings_count + 1, d_word_offsets),
+    strings_count,
+    stream);
+
+  // locate the words
+  rmm::device_vector<cudf::size_type> word_begins(total_words);
+  rmm::device_vector<cudf::size_type> word_ends(total_words);
+  splitter.d_word_offsets = d_word_offsets;
+  splitter.d_word_begins  = word_begins.data().get();
+  splitter.d_word_ends    = word_ends.data().get();
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     splitter);
+
+  // merge the tokens of each word in place
+  rmm::device_vector<uint32_t> tokens(chars_end - chars_begin);
+  rmm::device_vector<int32_t> token_offsets(total_words + 1);
+  bpe_merge_fn merger{d_chars,
+                      word_begins.data().get(),
+                      word_ends.data().get(),
+                      vocabulary.byte_token_ids->view().data<uint32_t>(),
+                      *vocabulary.merges->map,
+                      tokens.data().get()};
+  thrust::transform_exclusive_scan(
+    execpol->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(total_words + 1),
+    token_offsets.begin(),
+    [merger, total_words] __device__(cudf::size_type idx) {
+      return (idx == total_words) ? 0 : merger(idx);
+    },
+    int32_t{0},
+    thrust::plus<int32_t>());
+  auto const d_token_offsets = token_offsets.data().get();
+  auto const total_tokens    = cudf::detail::get_value<int32_t>(
+    cudf::column_view(cudf::data_type{cudf::type_id::INT32}, total_words + 1, d_token_offsets),
+    total_words,
+    stream);
+
+  // gather the tokens of the words into the output
+  auto token_ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                             total_tokens,
+                                             cudf::mask_state::UNALLOCATED,
+                                             stream,
+                                             mr);
+  thrust::for_each_n(
+    execpol->on(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    total_words,
+    [d_tokens   = tokens.data().get(),
+     d_begins   = word_begins.data().get(),
+     d_token_offsets,
+     d_output = token_ids->mutable_view().data<uint32_t>()] __device__(cudf::size_type idx) {
+      auto const offset = d_token_offsets[idx];
+      auto const count  = d_token_offsets[idx + 1] - offset;
+      for (cudf::size_type i = 0; i < count; ++i) {
+        d_output[offset + i] = d_tokens[d_begins[idx] + i];
+      }
+    });
+
+  auto offsets = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           strings_count + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  thrust::transform(execpol->on(stream),
+                    word_offsets.begin(),
+                    word_offsets.end(),
+                    offsets->mutable_view().begin<int32_t>(),
+                    [d_token_offsets] __device__(int32_t word) { return d_token_offsets[word]; });
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(token_ids),
+                                 strings.null_count(),
+                                 cudf::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+bpe_vocabulary::bpe_vocabulary()  = default;
+bpe_vocabulary::~bpe_vocabulary() = default;
+
+std::unique_ptr<bpe_vocabulary> load_bpe_vocabulary(std::string const& filename_vocabulary,
+                                                    std::string const& filename_merges,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::load_bpe_vocabulary(filename_vocabulary, filename_merges, 0, mr);
+}
+
+std::unique_ptr<cudf::column> bpe_tokenize(cudf::strings_column_view const& strings,
+                                           bpe_vocabulary const& vocabulary,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bpe_tokenize(strings, vocabulary, mr);
+}
+
+}  // namespace nvtext
@@ -268,39 +268,6 @@ __global__ void kernel_data_normalizer(unsigned char const* strings,
   BlockStore(temp_storage).Store(block_base, replacement_code_points);
 }
 
-/**
- * @brief Retrieve the code point metadata table.
- *
- * Build the code point metadata table in device memory
- * using the vector pieces from codepoint_metadata.ah
- */
-const codepoint_metadata_type* get_codepoint_metadata(cudaStream_t stream)
-{
-  static cudf::strings::detail::thread_safe_per_context_cache<codepoint_metadata_type>
-    g_codepoint_metadata;
-  return g_codepoint_metadata.find_or_initialize([stream](void) {
-    codepoint_metadata_type* table =
-      static_cast<codepoint_metadata_type*>(rmm::mr::get_default_resource()->allocate(
-        codepoint_metadata_size * sizeof(codepoint_metadata_type), stream));
-    thrust::fill(rmm::exec_policy(stream)->on(stream),
-                 table + cp_section1_end,
-                 table + codepoint_metadata_size,
-                 codepoint_metadata_default_value);
-    CUDA_TRY(cudaMemcpyAsync(table,
-                             codepoint_metadata,
-                             cp_section1_end * sizeof(codepoint_metadata[0]),  // 1st section
-                             cudaMemcpyHostToDevice,
-                             stream));
-    CUDA_TRY(cudaMemcpyAsync(
-      table + cp_section2_begin,
-      cp_metadata_917505_917999,
-      (cp_section2_end - cp_section2_begin + 1) * sizeof(codepoint_metadata[0]),  // 2nd section
-      cudaMemcpyHostToDevice,
-      stream));
-    return table;
-  });
-}
-
 /**
  * @brief Retrieve the aux code point data table.
  *
@@ -348,6 +315,39 @@ const aux_codepoint_data_type* get_aux_codepoint_data(cudaStream_t stream)
 
 }  // namespace
 
+/**
+ * @brief Retrieve the code point metadata table.
+ *
+ * Build the code point metadata table in device memory
+ * using the vector pieces from codepoint_metadata.ah
+ */
+const codepoint_metadata_type* get_codepoint_metadata(cudaStream_t stream)
+{
+  static cudf::strings::detail::thread_safe_per_context_cache<codepoint_metadata_type>
+    g_codepoint_metadata;
+  return g_codepoint_metadata.find_or_initialize([stream](void) {
+    codepoint_metadata_type* table =
+      static_cast<codepoint_metadata_type*>(rmm::mr::get_default_resource()->allocate(
+        codepoint_metadata_size * sizeof(codepoint_metadata_type), stream));
+    thrust::fill(rmm::exec_policy(stream)->on(stream),
+                 table + cp_section1_end,
+                 table + codepoint_metadata_size,
+                 codepoint_metadata_default_value);
+    CUDA_TRY(cudaMemcpyAsync(table,
+                             codepoint_metadata,
+                             cp_section1_end * sizeof(codepoint_metadata[0]),  // 1st section
+                             cudaMemcpyHostToDevice,
+                             stream));
+    CUDA_TRY(cudaMemcpyAsync(
+      table + cp_section2_begin,
+      cp_metadata_917505_917999,
+      (cp_section2_end - cp_section2_begin + 1) * sizeof(codepoint_metadata[0]),  // 2nd section
+      cudaMemcpyHostToDevice,
+      stream));
+    return table;
+  });
+}
+
 data_normalizer::data_normalizer(uint32_t max_num_strings,
                                  uint32_t max_num_chars,
                                  cudaStream_t stream,
@@ -27,6 +27,16 @@ using aux_codepoint_data_type = uint64_t;
 namespace nvtext {
 namespace detail {
 
+/**
+ * @brief Retrieve the code point metadata table.
+ *
+ * The table is built in device memory on first use and cached per context. It holds the
+ * `codepoint_metadata_type` value of every unicode code point.
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+codepoint_metadata_type const* get_codepoint_metadata(cudaStream_t stream);
+
 struct ptr_length_pair {
   uint32_t* gpu_ptr{};
   size_t length{};
@@ -127,47 +127,35 @@ __global__ void kernel_compute_tensor_metadata(
   }
 }
 
-}  // namespace
+/**
+ * @brief Token-ids of a batch of strings and the map of the output rows to the strings.
+ */
+struct tokenized_strings {
+  uint32_t const* token_ids{};  ///< Token-ids of all the strings
+  uint32_t const* offsets{};    ///< Offsets of the token-ids of each string
+  uint32_t nrows_tensor{};      ///< Number of output rows
+  rmm::device_uvector<uint32_t> row2tensor;             ///< String of each output row
+  rmm::device_uvector<uint32_t> row2row_within_tensor;  ///< Row of each output row in its string
+};
 
-tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
-                                  hashed_vocabulary const& vocab_table,
-                                  uint32_t max_sequence_length,
-                                  uint32_t stride,
-                                  bool do_lower_case,
-                                  bool do_truncate,
-                                  uint32_t max_num_strings,
-                                  uint32_t max_num_chars,
-                                  uint32_t max_rows_tensor,
-                                  cudaStream_t stream,
-                                  rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Runs the tokenizer on the strings and maps each output row to its string.
+ *
+ * The token-ids live in the working memory of `tokenizer` until its next call.
+ */
+tokenized_strings tokenize_strings(wordpiece_tokenizer& tokenizer,
+                                   cudf::strings_column_view const& strings,
+                                   uint32_t max_sequence_length,
+                                   uint32_t stride,
+                                   bool do_truncate,
+                                   cudaStream_t stream)
 {
-  CUDF_EXPECTS(stride <= max_sequence_length,
-               "stride must be less than or equal to max_sequence_length");
-  CUDF_EXPECTS(max_sequence_length * max_rows_tensor < std::numeric_limits<cudf::size_type>::max(),
-               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
   auto const strings_count = strings.size();
-  if (strings_count == 0)
-    return tokenizer_result{0,
-                            max_sequence_length,
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
-
-  auto const offsets   = strings.offsets();
-  auto const d_offsets = offsets.data<uint32_t>() + strings.offset();
-  auto const offset    = cudf::detail::get_value<int32_t>(offsets, strings.offset(), stream);
-  auto const d_chars   = strings.chars().data<char>() + offset;
+  auto const offsets       = strings.offsets();
+  auto const d_offsets     = offsets.data<uint32_t>() + strings.offset();
+  auto const offset        = cudf::detail::get_value<int32_t>(offsets, strings.offset(), stream);
+  auto const d_chars       = strings.chars().data<char>() + offset;
 
-  // Create tokenizer
-  wordpiece_tokenizer tokenizer(vocab_table,
-                                max_num_strings,
-                                max_num_chars,
-                                max_rows_tensor,
-                                max_sequence_length,
-                                stride,
-                                do_truncate,
-                                do_lower_case,
-                                stream);
   // Run tokenizer
   auto const tokens = tokenizer.tokenize(d_chars, d_offsets, strings_count, stream);
   // assign output components
@@ -214,6 +202,62 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
       }
     });
 
+  return tokenized_strings{device_token_ids,
+                           device_offsets,
+                           nrows_tensor_token_ids,
+                           std::move(row2tensor),
+                           std::move(row2row_within_tensor)};
+}
+
+/**
+ * @brief Writes the final tensor, the attention mask and the metadata of the tokenized strings.
+ *
+ * Each output buffer must have room for `tokens.nrows_tensor` rows.
+ */
+void compute_tensors(tokenized_strings const& tokens,
+                     uint32_t max_sequence_length,
+                     uint32_t stride,
+                     bool do_truncate,
+                     uint32_t* tensor_token_ids,
+                     uint32_t* tensor_attention_mask,
+                     uint32_t* tensor_metadata,
+                     cudaStream_t stream)
+{
+  if (tokens.nrows_tensor == 0) return;
+  // compute final-tensor, mask, and metadata
+  constexpr int block_size = 256;
+  cudf::detail::grid_1d const grid{
+    static_cast<cudf::size_type>(tokens.nrows_tensor * max_sequence_length), block_size};
+  kernel_compute_tensor_metadata<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
+    tokens.token_ids,
+    tokens.offsets,
+    tokens.row2tensor.data(),
+    tokens.row2row_within_tensor.data(),
+    max_sequence_length,
+    tokens.nrows_tensor,
+    stride,
+    do_truncate,
+    tensor_token_ids,
+    tensor_attention_mask,
+    tensor_metadata);
+  CHECK_CUDA(stream);
+}
+
+/**
+ * @brief Tokenizes the strings into new output columns.
+ */
+tokenizer_result make_tokenizer_result(wordpiece_tokenizer& tokenizer,
+                                       cudf::strings_column_view const& strings,
+                                       uint32_t max_sequence_length,
+                                       uint32_t stride,
+                                       bool do_truncate,
+                                       cudaStream_t stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  auto const tokens =
+    tokenize_strings(tokenizer, strings, max_sequence_length, stride, do_truncate, stream);
+  auto const nrows_tensor_token_ids = tokens.nrows_tensor;
+
   // create output data columns
   auto tensor_token_ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
                                                     nrows_tensor_token_ids * max_sequence_length,
@@ -232,22 +276,14 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                                    stream,
                                                    mr);
 
-  // compute final-tensor, mask, and metadata
-  constexpr int block_size = 256;
-  cudf::detail::grid_1d const grid{
-    static_cast<cudf::size_type>(nrows_tensor_token_ids * max_sequence_length), block_size};
-  kernel_compute_tensor_metadata<<<grid.num_blocks, grid.num_threads_per_block, 0, stream>>>(
-    device_token_ids,
-    device_offsets,
-    d_row2tensor,
-    d_row2row_within_tensor,
-    max_sequence_length,
-    nrows_tensor_token_ids,
-    stride,
-    do_truncate,
-    tensor_token_ids->mutable_view().data<uint32_t>(),
-    tensor_attention_mask->mutable_view().data<uint32_t>(),
-    tensor_metadata->mutable_view().data<uint32_t>());
+  compute_tensors(tokens,
+                  max_sequence_length,
+                  stride,
+                  do_truncate,
+                  tensor_token_ids->mutable_view().data<uint32_t>(),
+                  tensor_attention_mask->mutable_view().data<uint32_t>(),
+                  tensor_metadata->mutable_view().data<uint32_t>(),
+                  stream);
 
   return tokenizer_result{nrows_tensor_token_ids,
                           max_sequence_length,
@@ -256,6 +292,74 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                           std::move(tensor_metadata)};
 }
 
+/**
+ * @brief Returns an empty result for an empty batch of strings.
+ */
+tokenizer_result make_empty_result(uint32_t max_sequence_length)
+{
+  return tokenizer_result{0,
+                          max_sequence_length,
+                          cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                          cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                          cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
+}
+
+void validate_parameters(uint32_t max_sequence_length, uint32_t stride, uint32_t max_rows_tensor)
+{
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  CUDF_EXPECTS(max_sequence_length * max_rows_tensor < std::numeric_limits<cudf::size_type>::max(),
+               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
+}
+
+/**
+ * @brief Verifies that a batch of strings fits the working memory of a tokenizer.
+ */
+void validate_batch(cudf::strings_column_view const& strings,
+                    uint32_t max_num_strings,
+                    uint32_t max_num_chars)
+{
+  CUDF_EXPECTS(static_cast<uint32_t>(strings.size()) <= max_num_strings,
+               "number of strings exceeds the max_num_strings of the tokenizer");
+  auto const offsets = strings.offsets();
+  auto const num_chars =
+    cudf::detail::get_value<int32_t>(offsets, strings.offset() + strings.size(), 0) -
+    cudf::detail::get_value<int32_t>(offsets, strings.offset(), 0);
+  CUDF_EXPECTS(static_cast<uint32_t>(num_chars) <= max_num_chars,
+               "number of characters exceeds the max_num_chars of the tokenizer");
+}
+
+}  // namespace
+
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  hashed_vocabulary const& vocab_table,
+                                  uint32_t max_sequence_length,
+                                  uint32_t stride,
+                                  bool do_lower_case,
+                                  bool do_truncate,
+                                  uint32_t max_num_strings,
+                                  uint32_t max_num_chars,
+                                  uint32_t max_rows_tensor,
+                                  cudaStream_t stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  validate_parameters(max_sequence_length, stride, max_rows_tensor);
+  if (strings.size() == 0) return make_empty_result(max_sequence_length);
+
+  // Create tokenizer
+  wordpiece_tokenizer tokenizer(vocab_table,
+                                max_num_strings,
+                                max_num_chars,
+                                max_rows_tensor,
+                                max_sequence_length,
+                                stride,
+                                do_truncate,
+                                do_lower_case,
+                                stream);
+  return make_tokenizer_result(
+    tokenizer, strings, max_sequence_length, stride, do_truncate, stream, mr);
+}
+
 }  // namespace detail
 
 tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
@@ -309,4 +413,74 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   mr);
 }
 
+subword_tokenizer::subword_tokenizer(hashed_vocabulary const& vocabulary_table,
+                                     uint32_t max_sequence_length,
+                                     uint32_t stride,
+                                     bool do_lower_case,
+                                     bool do_truncate,
+                                     uint32_t max_num_strings,
+                                     uint32_t max_num_chars,
+                                     uint32_t max_rows_tensor)
+  : _max_sequence_length{max_sequence_length},
+    _stride{stride},
+    _do_truncate{do_truncate},
+    _max_num_strings{max_num_strings},
+    _max_num_chars{max_num_chars}
+{
+  CUDF_FUNC_RANGE();
+  detail::validate_parameters(max_sequence_length, stride, max_rows_tensor);
+  _tokenizer = std::make_unique<detail::wordpiece_tokenizer>(vocabulary_table,
+                                                             max_num_strings,
+                                                             max_num_chars,
+                                                             max_rows_tensor,
+                                                             max_sequence_length,
+                                                             stride,
+                                                             do_truncate,
+                                                             do_lower_case);
+}
+
+subword_tokenizer::~subword_tokenizer() = default;
+
+tokenizer_result subword_tokenizer::tokenize(cudf::strings_column_view const& strings,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  if (strings.size() == 0) return detail::make_empty_result(_max_sequence_length);
+  detail::validate_batch(strings, _max_num_strings, _max_num_chars);
+  return detail::make_tokenizer_result(
+    *_tokenizer, strings, _max_sequence_length, _stride, _do_truncate, 0, mr);
+}
+
+uint32_t subword_tokenizer::tokenize(cudf::strings_column_view const& strings,
+                                     tokenizer_buffers const& output)
+{
+  CUDF_FUNC_RANGE();
+  auto const is_uint32 = [](cudf::mutable_column_view const& col) {
+    return col.type().id() == cudf::type_id::UINT32;
+  };
+  CUDF_EXPECTS(is_uint32(output.tensor_token_ids) && is_uint32(output.tensor_attention_mask) &&
+                 is_uint32(output.tensor_metadata),
+               "output buffers must be UINT32 columns");
+  if (strings.size() == 0) return 0;
+  detail::validate_batch(strings, _max_num_strings, _max_num_chars);
+
+  auto const tokens = detail::tokenize_strings(
+    *_tokenizer, strings, _max_sequence_length, _stride, _do_truncate, 0);
+  auto const num_tokens = static_cast<cudf::size_type>(tokens.nrows_tensor * _max_sequence_length);
+  auto const num_metadata = static_cast<cudf::size_type>(tokens.nrows_tensor * 3);
+  CUDF_EXPECTS(output.tensor_token_ids.size() >= num_tokens &&
+                 output.tensor_attention_mask.size() >= num_tokens &&
+                 output.tensor_metadata.size() >= num_metadata,
+               "output buffers are too small for the tokenized strings");
+  detail::compute_tensors(tokens,
+                          _max_sequence_length,
+                          _stride,
+                          _do_truncate,
+                          output.tensor_token_ids.data<uint32_t>(),
+                          output.tensor_attention_mask.data<uint32_t>(),
+                          output.tensor_metadata.data<uint32_t>(),
+                          0);
+  return tokens.nrows_tensor;
+}
+
 }  // namespace nvtext
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <nvtext/tokenize.hpp>
+#include <text/utilities/tokenize_ops.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_scan.h>
+
+namespace nvtext {
+namespace detail {
+namespace {
+constexpr cudf::size_type empty_slot = -1;
+
+/**
+ * @brief Open-addressing hash table of the rows of a vocabulary
+ *
+ * Each slot holds the row of a vocabulary string, or `empty_slot`. Collisions are resolved
+ * by linear probing; the table has at least twice as many slots as the vocabulary so the
+ * probe sequences stay short.
+ */
+struct vocabulary_table_fn {
+  cudf::column_device_view const d_vocabulary;  // vocabulary strings
+  cudf::size_type* d_slots;                     // rows of the vocabulary strings
+  uint32_t mask;                                // number of slots - 1; a power of 2 minus 1
+
+  /**
+   * @brief Inserts the string of a vocabulary row, keeping the first row of duplicates
+   */
+  __device__ void operator()(cudf::size_type row) const
+  {
+    auto const d_str = d_vocabulary.element<cudf::string_view>(row);
+    auto slot        = cudf::detail::MurmurHash3_32<cudf::string_view>{}(d_str) & mask;
+    while (true) {
+      auto const existing = atomicCAS(d_slots + slot, empty_slot, row);
+      if (existing == empty_slot) return;
+      if (d_vocabulary.element<cudf::string_view>(existing) == d_str) {
+        atomicMin(d_slots + slot, row);
+        return;
+      }
+      slot = (slot + 1) & mask;
+    }
+  }
+
+  /**
+   * @brief Returns the row of a string in the vocabulary, or `empty_slot`
+   */
+  __device__ cudf::size_type find(cudf::string_view const& d_str) const
+  {
+    auto slot = cudf::detail::MurmurHash3_32<cudf::string_view>{}(d_str) & mask;
+    while (true) {
+      auto const row = d_slots[slot];
+      if (row == empty_slot || d_vocabulary.element<cudf::string_view>(row) == d_str) {
+        return row;
+      }
+      slot = (slot + 1) & mask;
+    }
+  }
+};
+
+/**
+ * @brief Tokenizes each string and writes the vocabulary IDs of its tokens
+ */
+struct vocabulary_tokenizer_fn {
+  cudf::column_device_view const d_strings;  // strings to tokenize
+  cudf::string_view const d_delimiter;       // delimiter to tokenize around
+  vocabulary_table_fn const table;           // vocabulary to look up the tokens in
+  cudf::size_type default_id;                // ID of the tokens not in the vocabulary
+  int32_t const* d_offsets;                  // offsets of the IDs of each string
+  int32_t* d_ids;                            // output token IDs
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return;
+    auto const d_str = d_strings.element<cudf::string_view>(idx);
+    characters_tokenizer tokenizer(d_str, d_delimiter);
+    auto ids = d_ids + d_offsets[idx];
+    while (tokenizer.next_token()) {
+      auto const pos = tokenizer.token_byte_positions();
+      auto const row =
+        table.find(cudf::string_view(d_str.data() + pos.first, pos.second - pos.first));
+      *ids++ = (row == empty_slot) ? default_id : row;
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& strings,
+                                                       cudf::strings_column_view const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::mr::device_memory_resource* mr,
+                                                       cudaStream_t stream = 0)
+{
+  CUDF_EXPECTS(!vocabulary.has_nulls(), "Vocabulary must not contain nulls");
+  CUDF_EXPECTS(delimiter.is_valid(), "Parameter delimiter must be valid");
+  cudf::string_view d_delimiter(delimiter.data(), delimiter.size());
+
+  auto const strings_count = strings.size();
+  auto const execpol       = rmm::exec_policy(stream);
+
+  // build the hash table of the vocabulary
+  auto const vocabulary_column = cudf::column_device_view::create(vocabulary.parent(), stream);
+  uint32_t num_slots           = 2;
+  while (num_slots < 2 * static_cast<uint32_t>(vocabulary.size())) { num_slots *= 2; }
+  rmm::device_vector<cudf::size_type> slots(num_slots, empty_slot);
+  vocabulary_table_fn const table{*vocabulary_column, slots.data().get(), num_slots - 1};
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     vocabulary.size(),
+                     table);
+
+  // the first pass counts the tokens of each string to build the output offsets
+  auto const strings_column = cudf::column_device_view::create(strings.parent(), stream);
+  auto const d_strings      = *strings_column;
+
+  auto offsets = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           strings_count + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto const d_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::transform_inclusive_scan(execpol->on(stream),
+                                   thrust::make_counting_iterator<cudf::size_type>(0),
+                                   thrust::make_counting_iterator<cudf::size_type>(strings_count),
+                                   d_offsets + 1,
+                                   strings_tokenizer{d_strings, d_delimiter},
+                                   thrust::plus<int32_t>());
+  CUDA_TRY(cudaMemsetAsync(d_offsets, 0, sizeof(int32_t), stream));
+  auto const total_tokens =
+    cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+
+  // the second pass tokenizes the strings again and looks up each token
+  auto ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                       total_tokens,
+                                       cudf::mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     vocabulary_tokenizer_fn{d_strings,
+                                             d_delimiter,
+                                             table,
+                                             default_id,
+                                             d_offsets,
+                                             ids->mutable_view().data<int32_t>()});
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(ids),
+                                 strings.null_count(),
+                                 cudf::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+// external APIs
+
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& strings,
+                                                       cudf::strings_column_view const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tokenize_with_vocabulary(strings, vocabulary, delimiter, default_id, mr);
+}
+
+}  // namespace nvtext
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <stream_compaction/distinct_rows.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Encodes the rows of `input` with the distinct values found by a hash set
+ *
+ * Only the distinct values are sorted to build the keys, so the cost of a low-cardinality
+ * column is one hash set insert and one lookup per row.
+ */
+template <bool has_nulls>
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_encode(
+  column_view const& input, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  auto const num_rows = input.size();
+  auto const execpol  = rmm::exec_policy(stream);
+  auto const d_input  = table_device_view::create(table_view{{input}}, stream);
+  auto const set =
+    create_distinct_rows_set<has_nulls>(*d_input, column_view{}, null_equality::EQUAL, stream);
+  auto const d_set    = *set;
+  auto const d_column = d_input->column(0);
+
+  // the representative row of each distinct non-null value
+  // Ex. input = [c,a,c,null,b,a] => key-rows = [0,1,4]
+  auto const is_key_row = [d_set, d_column] __device__(size_type i) {
+    return d_column.is_valid(i) && d_set.find(i)->first == i;
+  };
+  size_type const num_keys = thrust::count_if(execpol->on(stream),
+                                              thrust::make_counting_iterator<size_type>(0),
+                                              thrust::make_counting_iterator<size_type>(num_rows),
+                                              is_key_row);
+  rmm::device_vector<size_type> key_rows(num_keys);
+  thrust::copy_if(execpol->on(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_rows),
+                  key_rows.begin(),
+                  is_key_row);
+
+  // sort the small set of distinct values to build the keys
+  // Ex. unsorted keys = [c,a,b]; order = [1,2,0]; keys = [a,b,c]
+  column_view const key_rows_view(data_type{type_id::INT32}, num_keys, key_rows.data().get());
+  auto const unsorted_keys = detail::gather(table_view{{input}},
+                                            key_rows_view,
+                                            detail::out_of_bounds_policy::IGNORE,
+                                            detail::negative_index_policy::NOT_ALLOWED,
+                                            rmm::mr::get_default_resource(),
+                                            stream);
+  auto const keys_order = detail::sorted_order(unsorted_keys->view(),
+                                               std::vector<order>{order::ASCENDING},
+                                               std::vector<null_order>{null_order::AFTER},
+                                               rmm::mr::get_default_resource(),
+                                               stream);
+  auto table_keys       = detail::gather(unsorted_keys->view(),
+                                   keys_order->view(),
+                                   detail::out_of_bounds_policy::IGNORE,
+                                   detail::negative_index_policy::NOT_ALLOWED,
+                                   mr,
+                                   stream)
+                      ->release();
+  std::unique_ptr<column> keys_column(std::move(table_keys.front()));
+  keys_column->set_null_mask(rmm::device_buffer{0, stream, mr}, 0);  // remove the null-mask
+
+  // the representative rows get the index of their key
+  // Ex. indices = [2,0,_,_,1,_]
+  auto indices = make_numeric_column(
+    data_type{type_id::INT32}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto const d_indices  = indices->mutable_view().data<int32_t>();
+  auto const d_key_rows = key_rows.data().get();
+  auto const d_order    = keys_order->view().data<size_type>();
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_keys,
+                     [d_indices, d_key_rows, d_order] __device__(size_type idx) {
+                       d_indices[d_key_rows[d_order[idx]]] = idx;
+                     });
+  // the other rows copy the index of their representative row; nulls are encoded as num_keys
+  // Ex. indices = [2,0,2,3,1,0]
+  thrust::for_each_n(execpol->on(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_rows,
+                     [d_set, d_column, d_indices, num_keys] __device__(size_type i) {
+                       if (d_column.is_null(i)) {
+                         d_indices[i] = num_keys;
+                         return;
+                       }
+                       auto const row = d_set.find(i)->first;
+                       if (row != i) { d_indices[i] = d_indices[row]; }
+                     });
+  return std::make_pair(std::move(keys_column), std::move(indices));
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> encode(
+  column_view const& input_column, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  // side effects of this function we are now dependent on:
+  // - resulting column elements are sorted ascending
+  // - nulls are encoded as the number of keys
+  return input_column.has_nulls() ? hash_encode<true>(input_column, mr, stream)
+                                  : hash_encode<false>(input_column, mr, stream);
+}
+}  // namespace detail
+
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> encode(
+  cudf::column_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  return detail::encode(input, mr, 0);
+}
+
+}  // namespace cudf
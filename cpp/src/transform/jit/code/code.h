@@ -22,6 +22,7 @@ namespace jit {
 namespace code {
 extern const char* kernel_header;
 extern const char* kernel;
+extern const char* multi_input_kernel_helpers;
 extern const char* traits;
 extern const char* operation;
 
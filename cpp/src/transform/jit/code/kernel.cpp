@@ -46,6 +46,13 @@ const char* kernel =
     }
   )***";
 
+const char* multi_input_kernel_helpers =
+  R"***(
+    __device__ inline bool is_valid_row(cudf::bitmask_type const* mask, cudf::size_type row) {
+      return mask == nullptr || ((mask[row / 32] >> (row % 32)) & 1);
+    }
+  )***";
+
 }  // namespace code
 }  // namespace jit
 }  // namespace transformation
@@ -19,6 +19,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -31,6 +32,11 @@
 #include <timestamps.hpp.jit>
 #include <types.hpp.jit>
 
+#include <rmm/thrust_rmm_allocator.h>
+
+#include <algorithm>
+#include <set>
+
 namespace cudf {
 namespace transformation {
 //! Jit functions
@@ -78,6 +84,129 @@ void unary_operation(mutable_column_view output,
     .launch(output.size(), cudf::jit::get_data_ptr(output), cudf::jit::get_data_ptr(input));
 }
 
+/**
+ * @brief Returns the source of the kernel applying a UDF of `num_inputs` columns
+ *
+ * The kernel reads one element and the validity of each input per row. With
+ * `null_policy::EXCLUDE`, the UDF is called as `f(&out, in0, in1, ...)` only for the rows where
+ * every input is valid, and the other rows are null. With `null_policy::INCLUDE`, it is called as
+ * `f(&out, &out_valid, in0, valid0, in1, valid1, ...)` for every row, and sets the validity of the
+ * output. Each warp stores the validity of its 32 consecutive rows with one ballot.
+ */
+std::string multi_input_kernel(size_type num_inputs, null_policy nulls)
+{
+  auto const include_nulls    = nulls == null_policy::INCLUDE;
+  std::string template_params = "typename TypeOut";
+  std::string load_inputs;
+  std::string all_valid = "true";
+  std::string udf_args  = include_nulls ? "&out_data[i], &valid" : "&out_data[i]";
+  for (size_type c = 0; c < num_inputs; ++c) {
+    auto const col = std::to_string(c);
+    template_params += ", typename TypeIn" + col;
+    load_inputs += "          bool const valid" + col + " = is_valid_row(in_masks[" + col +
+                   "], in_offsets[" + col + "] + i);\n";
+    load_inputs += "          TypeIn" + col + " const in" + col + " = static_cast<TypeIn" + col +
+                   " const*>(in_data[" + col + "])[i];\n";
+    all_valid += " && valid" + col;
+    udf_args += ", in" + col + (include_nulls ? ", valid" + col : "");
+  }
+  auto const call_udf = include_nulls
+                          ? "          GENERIC_TRANSFORM_OP(" + udf_args + ");\n"
+                          : "          valid = " + all_valid +
+                              ";\n          if (valid) { GENERIC_TRANSFORM_OP(" + udf_args +
+                              "); }\n";
+
+  return code::multi_input_kernel_helpers + std::string{"template <"} + template_params + ">\n" +
+         R"***(
+    __global__
+    void kernel(cudf::size_type size,
+                TypeOut* out_data,
+                cudf::bitmask_type* out_mask,
+                void const* const* in_data,
+                cudf::bitmask_type const* const* in_masks,
+                cudf::size_type const* in_offsets) {
+        int tid = threadIdx.x;
+        int blkid = blockIdx.x;
+        int blksz = blockDim.x;
+        int gridsz = gridDim.x;
+
+        int start = tid + blkid * blksz;
+        int step = blksz * gridsz;
+
+        // Whole warps loop over the rows, rounded up to a multiple of the warp size; the block
+        // size is a multiple of the warp size, so the rows of a warp share a validity word
+        cudf::size_type padded_size = (size + 31) / 32 * 32;
+        for (cudf::size_type i=start; i<padded_size; i+=step) {
+          bool valid = false;
+          if (i < size) {
+)***" + load_inputs +
+         call_udf + R"***(
+          }
+          if (out_mask != nullptr) {
+            cudf::bitmask_type word = __ballot_sync(0xffffffff, valid);
+            if (tid % 32 == 0 && i < size) { out_mask[i / 32] = word; }
+          }
+        }
+    }
+  )***";
+}
+
+void multi_input_operation(mutable_column_view output,
+                           table_view const& inputs,
+                           std::string const& udf,
+                           data_type output_type,
+                           bool is_ptx,
+                           null_policy nulls,
+                           cudaStream_t stream)
+{
+  auto const num_inputs  = inputs.num_columns();
+  auto const policy_name = (nulls == null_policy::INCLUDE) ? "_include_nulls" : "_exclude_nulls";
+  std::string hash = "prog_transform" + std::to_string(std::hash<std::string>{}(udf)) + "_" +
+                     std::to_string(num_inputs) + policy_name;
+
+  // The output and, with null_policy::INCLUDE, its validity are pointer arguments of the UDF
+  std::set<int> const pointer_args =
+    (nulls == null_policy::INCLUDE) ? std::set<int>{0, 1} : std::set<int>{0};
+  std::string cuda_source = code::kernel_header;
+  if (is_ptx) {
+    cuda_source += cudf::jit::parse_single_function_ptx(
+      udf, "GENERIC_TRANSFORM_OP", cudf::jit::get_type_name(output_type), pointer_args);
+  } else {
+    cuda_source += cudf::jit::parse_single_function_cuda(udf, "GENERIC_TRANSFORM_OP");
+  }
+  cuda_source += multi_input_kernel(num_inputs, nulls);
+
+  std::vector<std::string> template_types{cudf::jit::get_type_name(output.type())};
+  std::vector<void const*> h_data;
+  std::vector<bitmask_type const*> h_masks;
+  std::vector<size_type> h_offsets;
+  for (auto const& col : inputs) {
+    template_types.push_back(cudf::jit::get_type_name(col.type()));
+    h_data.push_back(cudf::jit::get_data_ptr(col));
+    h_masks.push_back(col.null_mask());
+    h_offsets.push_back(col.offset());
+  }
+  rmm::device_vector<void const*> d_data(h_data);
+  rmm::device_vector<bitmask_type const*> d_masks(h_masks);
+  rmm::device_vector<size_type> d_offsets(h_offsets);
+
+  cudf::jit::launcher(hash,
+                      cuda_source,
+                      header_names,
+                      cudf::jit::compiler_flags,
+                      headers_code,
+                      stream)
+    .set_kernel_inst("kernel", template_types)
+    .launch(output.size(),
+            cudf::jit::get_data_ptr(output),
+            output.null_mask(),
+            d_data.data().get(),
+            d_masks.data().get(),
+            d_offsets.data().get());
+  // The argument arrays must outlive the kernel
+  CUDA_TRY(cudaStreamSynchronize(stream));
+}
+
 }  // namespace jit
 }  // namespace transformation
 
@@ -104,6 +233,35 @@ std::unique_ptr<column> transform(column_view const& input,
   return output;
 }
 
+std::unique_ptr<column> transform(table_view const& inputs,
+                                  std::string const& udf,
+                                  data_type output_type,
+                                  bool is_ptx,
+                                  null_policy nulls,
+                                  rmm::mr::device_memory_resource* mr,
+                                  cudaStream_t stream)
+{
+  CUDF_EXPECTS(inputs.num_columns() > 0, "Expected at least one input column.");
+  CUDF_EXPECTS(std::all_of(inputs.begin(),
+                           inputs.end(),
+                           [](auto const& col) { return is_fixed_width(col.type()); }),
+               "Unexpected non-fixed-width type.");
+  auto const size = inputs.num_rows();
+
+  // Rows are only null if an input is null, unless the UDF sets the validity
+  bool const nullable = (nulls == null_policy::INCLUDE) || has_nulls(inputs);
+  auto const state    = nullable ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED;
+  auto output         = make_fixed_width_column(output_type, size, state, stream, mr);
+
+  if (size == 0) { return output; }
+
+  mutable_column_view output_view = *output;
+  transformation::jit::multi_input_operation(
+    output_view, inputs, udf, output_type, is_ptx, nulls, stream);
+
+  return output;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> transform(column_view const& input,
@@ -116,4 +274,15 @@ std::unique_ptr<column> transform(column_view const& input,
   return detail::transform(input, unary_udf, output_type, is_ptx, mr);
 }
 
+std::unique_ptr<column> transform(table_view const& inputs,
+                                  std::string const& udf,
+                                  data_type output_type,
+                                  bool is_ptx,
+                                  null_policy nulls,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transform(inputs, udf, output_type, is_ptx, nulls, mr);
+}
+
 }  // namespace cudf
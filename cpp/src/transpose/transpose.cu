@@ -13,19 +13,113 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transpose.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
-#include <cudf/reshape.hpp>
+#include <cudf/detail/utilities/warp_bitmask.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/transpose.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/traits.hpp>
-#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
 
 namespace cudf {
 namespace detail {
+namespace {
+constexpr size_type tile_dim  = 32;  ///< Rows and columns of the tile transposed by a block
+constexpr size_type tile_rows = 8;   ///< Warps per block; each copies every 8th row of the tile
+
+/**
+ * @brief Transposes the columns of a table into the row-major values of a single column
+ *
+ * Each block transposes 32x32 tiles of the table through shared memory: the warps read 32
+ * consecutive rows of a column and write 32 consecutive values of an output row, so that both the
+ * reads and the writes are coalesced. The validity of a tile is read as one word per column and
+ * written as one ballot per output row; since an output row of the tile need not start at a word
+ * boundary, the ballot is merged into the zero-initialized output mask with atomic ORs.
+ *
+ * @tparam T Unsigned integer type of the size of the elements; only the bits are copied
+ * @tparam has_nulls Whether any column of the table has a null mask
+ * @param input The table to transpose
+ * @param output Output values; value `r * num_columns + c` is row `r` of column `c`
+ * @param output_mask Zero-initialized output null mask, or nullptr if no column has nulls
+ * @param num_row_tiles Number of tiles along the rows of the table
+ */
+template <typename T, bool has_nulls>
+__global__ void transpose_tiles(table_device_view input,
+                                T* __restrict__ output,
+                                bitmask_type* __restrict__ output_mask,
+                                size_type num_row_tiles)
+{
+  __shared__ T tile[tile_dim][tile_dim + 1];  // padded to avoid shared memory bank conflicts
+  __shared__ bitmask_type tile_valid[tile_dim];
+
+  auto const num_columns = input.num_columns();
+  auto const num_rows    = input.num_rows();
+  auto const first_col   = static_cast<size_type>(blockIdx.x) * tile_dim;
+  for (size_type row_tile = blockIdx.y; row_tile < num_row_tiles; row_tile += gridDim.y) {
+    auto const first_row = row_tile * tile_dim;
+    for (size_type j = threadIdx.y; j < tile_dim && first_col + j < num_columns; j += tile_rows) {
+      auto const col = input.column(first_col + j);
+      auto const row = first_row + static_cast<size_type>(threadIdx.x);
+      if (row < num_rows) { tile[j][threadIdx.x] = col.data<T>()[row]; }
+      if (has_nulls && threadIdx.x == 0) { tile_valid[j] = get_validity_word(col, row_tile); }
+    }
+    __syncthreads();
+
+    // The row of a warp is uniform, so that whole warps leave the loop
+    for (size_type j = threadIdx.y; j < tile_dim && first_row + j < num_rows; j += tile_rows) {
+      auto const col       = first_col + static_cast<size_type>(threadIdx.x);
+      auto const first_out = (first_row + j) * num_columns + first_col;
+      if (col < num_columns) { output[first_out + threadIdx.x] = tile[threadIdx.x][j]; }
+      if (has_nulls) {
+        auto const valid = col < num_columns && ((tile_valid[threadIdx.x] >> j) & 1);
+        auto const word  = __ballot_sync(0xffffffff, valid);
+        if (threadIdx.x == 0 && word != 0) {
+          auto const idx   = word_index(first_out);
+          auto const shift = intra_word_index(first_out);
+          atomicOr(output_mask + idx, word << shift);
+          if (shift != 0 && (word >> (size_in_bits<bitmask_type>() - shift)) != 0) {
+            atomicOr(output_mask + idx + 1, word >> (size_in_bits<bitmask_type>() - shift));
+          }
+        }
+      }
+    }
+    __syncthreads();
+  }
+}
+
+template <typename T>
+void launch_transpose(table_device_view const& input,
+                      mutable_column_view& output,
+                      bool has_nulls,
+                      cudaStream_t stream)
+{
+  auto const num_row_tiles = (input.num_rows() + tile_dim - 1) / tile_dim;
+  dim3 const grid((input.num_columns() + tile_dim - 1) / tile_dim,
+                  std::min(num_row_tiles, size_type{65535}));
+  dim3 const block(tile_dim, tile_rows);
+  if (has_nulls) {
+    transpose_tiles<T, true><<<grid, block, 0, stream>>>(
+      input, output.data<T>(), output.null_mask(), num_row_tiles);
+  } else {
+    transpose_tiles<T, false>
+      <<<grid, block, 0, stream>>>(input, output.data<T>(), nullptr, num_row_tiles);
+  }
+  CHECK_CUDA(stream);
+}
+
+}  // namespace
+
 std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input,
                                                          rmm::mr::device_memory_resource* mr,
                                                          cudaStream_t stream)
@@ -41,10 +135,37 @@ std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input
     std::all_of(
       input.begin(), input.end(), [dtype](auto const& col) { return dtype == col.type(); }),
     "Column type mismatch");
+  CUDF_EXPECTS(is_fixed_width(dtype), "Invalid, non-fixed-width type.");
+  CUDF_EXPECTS(static_cast<int64_t>(input.num_rows()) * input.num_columns() <=
+                 std::numeric_limits<size_type>::max(),
+               "The transposed table is too large");
+
+  auto const nullable =
+    std::any_of(input.begin(), input.end(), [](auto const& col) { return col.nullable(); });
+  auto output_column = make_fixed_width_column(dtype,
+                                               input.num_rows() * input.num_columns(),
+                                               nullable ? mask_state::ALL_NULL
+                                                        : mask_state::UNALLOCATED,
+                                               stream,
+                                               mr);
+  auto output  = output_column->mutable_view();
+  auto d_input = table_device_view::create(input, stream);
+  switch (size_of(dtype)) {
+    case 1: launch_transpose<uint8_t>(*d_input, output, nullable, stream); break;
+    case 2: launch_transpose<uint16_t>(*d_input, output, nullable, stream); break;
+    case 4: launch_transpose<uint32_t>(*d_input, output, nullable, stream); break;
+    case 8: launch_transpose<uint64_t>(*d_input, output, nullable, stream); break;
+    default: CUDF_FAIL("Unsupported element size");
+  }
+  if (nullable) {
+    output_column->set_null_count(std::accumulate(
+      input.begin(), input.end(), size_type{0}, [](size_type count, column_view const& col) {
+        return count + col.null_count();
+      }));
+  }
 
-  auto output_column = cudf::interleave_columns(input, mr);
-  auto one_iter      = thrust::make_counting_iterator<size_type>(1);
-  auto splits_iter   = thrust::make_transform_iterator(
+  auto one_iter    = thrust::make_counting_iterator<size_type>(1);
+  auto splits_iter = thrust::make_transform_iterator(
     one_iter, [width = input.num_columns()](size_type idx) { return idx * width; });
   auto splits = std::vector<size_type>(splits_iter, splits_iter + input.num_rows() - 1);
   auto output_column_views = cudf::split(output_column->view(), splits);
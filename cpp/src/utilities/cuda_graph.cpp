@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/cuda_graph.hpp>
+#include <cudf/utilities/error.hpp>
+
+namespace cudf {
+captured_graph::~captured_graph()
+{
+  if (_exec != nullptr) { cudaGraphExecDestroy(_exec); }
+}
+
+void captured_graph::launch(cudaStream_t stream) const
+{
+  CUDA_TRY(cudaGraphLaunch(_exec, stream));
+}
+
+void captured_graph::begin_capture(cudaStream_t stream)
+{
+  CUDF_EXPECTS(stream != 0, "The default stream cannot be captured");
+  // thread-local mode makes the calls of this thread that are illegal during a capture, such as
+  // synchronizations and cudaMalloc, fail instead of racing with it
+  CUDA_TRY(cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal));
+}
+
+cudaGraph_t captured_graph::end_capture(cudaStream_t stream)
+{
+  cudaGraph_t graph{};
+  CUDA_TRY(cudaStreamEndCapture(stream, &graph));
+  return graph;
+}
+
+void captured_graph::abort_capture(cudaStream_t stream) noexcept
+{
+  cudaGraph_t graph{};
+  cudaStreamEndCapture(stream, &graph);
+  if (graph != nullptr) { cudaGraphDestroy(graph); }
+  cudaGetLastError();  // clear the error of an invalidated capture
+}
+
+cudaGraphExec_t captured_graph::instantiate(cudaGraph_t graph)
+{
+  cudaGraphExec_t exec{};
+  auto const status = cudaGraphInstantiate(&exec, graph, nullptr, nullptr, 0);
+  cudaGraphDestroy(graph);
+  CUDA_TRY(status);
+  return exec;
+}
+
+void captured_graph::update_graph(cudaGraph_t graph)
+{
+#if CUDART_VERSION >= 10020
+  cudaGraphNode_t error_node{};
+  cudaGraphExecUpdateResult result{};
+  if (cudaGraphExecUpdate(_exec, graph, &error_node, &result) == cudaSuccess) {
+    cudaGraphDestroy(graph);
+    return;
+  }
+  cudaGetLastError();  // the topology changed; fall back to a new executable graph
+#endif
+  auto exec = instantiate(graph);
+  cudaGraphExecDestroy(_exec);
+  _exec = exec;
+}
+
+}  // namespace cudf
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/launch_config.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <tuple>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Total time and work of the timed launches of a kernel with one block size
+ */
+struct launch_timing {
+  double time_ms   = 0;
+  double work      = 0;
+  int64_t launches = 0;
+};
+
+/**
+ * @brief Timed launch whose time is not known yet
+ */
+struct pending_launch {
+  int arch;
+  std::string kernel;
+  int block_size;
+  std::size_t work;
+  cudaEvent_t start;
+  cudaEvent_t stop;
+};
+
+/**
+ * @brief Process-wide configuration and tuning state, guarded by `mutex`
+ */
+struct launch_config_state {
+  static constexpr std::size_t max_pending_launches = 1024;
+
+  std::mutex mutex;
+  std::map<std::pair<int, std::string>, int> block_sizes;  ///< (arch, kernel) -> block size
+  std::vector<int> device_archs;                           ///< Compute capability by device
+  std::string tune_path;                                   ///< Empty unless tuning
+  std::map<std::pair<int, std::string>, std::size_t> next_candidate;
+  std::map<std::tuple<int, std::string, int>, launch_timing> timings;
+  std::vector<pending_launch> pending;
+  std::vector<cudaEvent_t> free_events;
+
+  /**
+   * @brief Returns the compute capability of the current device, e.g. 80 for 8.0
+   */
+  int current_arch()
+  {
+    int device = 0;
+    CUDA_TRY(cudaGetDevice(&device));
+    if (device >= static_cast<int>(device_archs.size())) { device_archs.resize(device + 1, 0); }
+    if (device_archs[device] == 0) {
+      int major = 0;
+      int minor = 0;
+      CUDA_TRY(cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor, device));
+      CUDA_TRY(cudaDeviceGetAttribute(&minor, cudaDevAttrComputeCapabilityMinor, device));
+      device_archs[device] = major * 10 + minor;
+    }
+    return device_archs[device];
+  }
+
+  void load(std::string const& path)
+  {
+    std::ifstream file(path);
+    CUDF_EXPECTS(file.is_open(), "Cannot open launch configuration file");
+    std::string line;
+    while (std::getline(file, line)) {
+      line = line.substr(0, line.find('#'));
+      std::istringstream entry(line);
+      int arch = 0;
+      std::string kernel;
+      int block_size = 0;
+      if (not(entry >> arch)) { continue; }  // blank or comment line
+      CUDF_EXPECTS(entry >> kernel >> block_size and block_size > 0,
+                   "Invalid launch configuration entry");
+      block_sizes[{arch, kernel}] = block_size;
+    }
+  }
+
+  /**
+   * @brief Returns an event recorded on `stream`, or nullptr on error
+   *
+   * Does not throw, as launches end in destructors.
+   */
+  cudaEvent_t record_event(cudaStream_t stream)
+  {
+    cudaEvent_t event = nullptr;
+    if (not free_events.empty()) {
+      event = free_events.back();
+      free_events.pop_back();
+    } else if (cudaEventCreate(&event) != cudaSuccess) {
+      return nullptr;
+    }
+    if (cudaEventRecord(event, stream) != cudaSuccess) {
+      free_events.push_back(event);
+      return nullptr;
+    }
+    return event;
+  }
+
+  /**
+   * @brief Adds the time of the pending launches, waiting for them if `wait` is true
+   */
+  void resolve_pending(bool wait)
+  {
+    auto const is_done = [&](pending_launch const& launch) {
+      if (wait) {
+        CUDA_TRY(cudaEventSynchronize(launch.stop));
+      } else if (cudaEventQuery(launch.stop) != cudaSuccess) {
+        return false;
+      }
+      float ms = 0;
+      if (cudaEventElapsedTime(&ms, launch.start, launch.stop) == cudaSuccess) {
+        auto& timing = timings[std::make_tuple(launch.arch, launch.kernel, launch.block_size)];
+        timing.time_ms += ms;
+        timing.work += launch.work;
+        timing.launches += 1;
+      }
+      free_events.push_back(launch.start);
+      free_events.push_back(launch.stop);
+      return true;
+    };
+    pending.erase(std::remove_if(pending.begin(), pending.end(), is_done), pending.end());
+    // Clears the error of `cudaEventQuery()` for launches not done yet
+    cudaGetLastError();
+  }
+
+  /**
+   * @brief Returns the configured block sizes updated with the fastest timed candidates
+   */
+  std::map<std::pair<int, std::string>, int> tuned_block_sizes() const
+  {
+    auto result = block_sizes;
+    std::map<std::pair<int, std::string>, double> best_time;
+    for (auto const& entry : timings) {
+      auto const& timing = entry.second;
+      if (timing.work == 0) { continue; }
+      auto const key        = std::make_pair(std::get<0>(entry.first), std::get<1>(entry.first));
+      auto const block_size = std::get<2>(entry.first);
+      auto const time       = timing.time_ms / timing.work;
+      auto const best       = best_time.find(key);
+      if (best == best_time.end() or time < best->second) {
+        best_time[key] = time;
+        result[key]    = block_size;
+      }
+    }
+    return result;
+  }
+};
+
+launch_config_state& state()
+{
+  // Never destroyed, so that launches ending during static destruction are safe
+  static auto* instance = [] {
+    auto* s               = new launch_config_state;
+    auto const config_env = std::getenv("LIBCUDF_LAUNCH_CONFIG");
+    if (config_env != nullptr) { s->load(config_env); }
+    auto const tune_env = std::getenv("LIBCUDF_LAUNCH_CONFIG_TUNE");
+    if (tune_env != nullptr) { s->tune_path = tune_env; }
+    return s;
+  }();
+  return *instance;
+}
+
+bool is_candidate(tunable_kernel const& kernel, int block_size)
+{
+  return std::find(kernel.candidates.begin(), kernel.candidates.end(), block_size) !=
+         kernel.candidates.end();
+}
+
+// Configured block size of a kernel; the caller holds the lock
+int configured_block_size(launch_config_state& s, tunable_kernel const& kernel, int arch)
+{
+  auto const entry = s.block_sizes.find({arch, kernel.name});
+  if (entry == s.block_sizes.end() or not is_candidate(kernel, entry->second)) {
+    return kernel.default_block_size;
+  }
+  return entry->second;
+}
+
+}  // namespace
+
+int launch_block_size(tunable_kernel const& kernel)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  return configured_block_size(s, kernel, s.current_arch());
+}
+
+void set_launch_block_size(std::string const& kernel, int block_size)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.block_sizes[{s.current_arch(), kernel}] = block_size;
+}
+
+void load_launch_configs(std::string const& path)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.load(path);
+}
+
+bool write_tuned_launch_configs()
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  if (s.tune_path.empty()) { return false; }
+  s.resolve_pending(true);
+  std::ofstream file(s.tune_path);
+  CUDF_EXPECTS(file.is_open(), "Cannot write launch configuration file");
+  file << "# libcudf launch configuration: <compute capability> <kernel> <block size>\n";
+  for (auto const& entry : s.tuned_block_sizes()) {
+    file << entry.first.first << " " << entry.first.second << " " << entry.second << "\n";
+  }
+  return true;
+}
+
+tuned_launch::tuned_launch(tunable_kernel const& kernel, std::size_t work, cudaStream_t stream)
+  : _kernel{kernel}, _work{work}, _stream{stream}
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  _arch = s.current_arch();
+  if (s.tune_path.empty() or kernel.candidates.empty()) {
+    _block_size = configured_block_size(s, kernel, _arch);
+    return;
+  }
+  auto& next  = s.next_candidate[{_arch, kernel.name}];
+  _block_size = kernel.candidates[next++ % kernel.candidates.size()];
+  _start      = s.record_event(stream);
+}
+
+tuned_launch::~tuned_launch()
+{
+  if (_start == nullptr) { return; }
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  // The launch is not timed if an event could not be recorded
+  auto const stop = s.record_event(_stream);
+  if (stop == nullptr) {
+    s.free_events.push_back(_start);
+    return;
+  }
+  s.pending.push_back(pending_launch{_arch, _kernel.name, _block_size, _work, _start, stop});
+  if (s.pending.size() > launch_config_state::max_pending_launches) { s.resolve_pending(false); }
+}
+
+}  // namespace detail
+}  // namespace cudf
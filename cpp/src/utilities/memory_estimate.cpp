@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/memory_estimate.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+/**
+ * @brief Returns the number of child rows of `num_rows` gathered rows of an offsets-based column,
+ * scaling the size of its child by the number of rows of its parent
+ */
+std::size_t scaled_child_rows(column_view const& offsets,
+                              size_type child_size,
+                              std::size_t num_rows)
+{
+  auto const parent_rows = static_cast<std::size_t>(std::max(offsets.size() - 1, 1));
+  return (static_cast<std::size_t>(child_size) * num_rows + parent_rows - 1) / parent_rows;
+}
+
+std::size_t estimate_column_bytes(column_view const& col, std::size_t num_rows, bool nullable)
+{
+  std::size_t bytes = (nullable || col.nullable())
+                        ? bitmask_allocation_size_bytes(static_cast<size_type>(num_rows))
+                        : 0;
+  auto const offsets_bytes = (num_rows + 1) * sizeof(size_type);
+  switch (col.type().id()) {
+    case type_id::STRING: {
+      if (col.num_children() == 0) { return bytes; }
+      auto const offsets = col.child(strings_column_view::offsets_column_index);
+      auto const chars   = col.child(strings_column_view::chars_column_index);
+      return bytes + offsets_bytes + scaled_child_rows(offsets, chars.size(), num_rows);
+    }
+    case type_id::LIST: {
+      if (col.num_children() == 0) { return bytes; }
+      auto const offsets = col.child(lists_column_view::offsets_column_index);
+      auto const child   = col.child(lists_column_view::child_column_index);
+      auto const child_rows = scaled_child_rows(offsets, child.size(), num_rows);
+      return bytes + offsets_bytes + estimate_column_bytes(child, child_rows, false);
+    }
+    case type_id::DICTIONARY32: {
+      if (col.num_children() == 0) { return bytes; }
+      dictionary_column_view const dictionary(col);
+      return bytes + num_rows * size_of(dictionary.indices().type()) +
+             estimate_column_bytes(dictionary.keys(), dictionary.keys_size(), false);
+    }
+    default:
+      if (is_fixed_width(col.type())) { return bytes + num_rows * size_of(col.type()); }
+      // Struct columns gather each of their children
+      for (size_type i = 0; i < col.num_children(); ++i) {
+        bytes += estimate_column_bytes(col.child(i), num_rows, false);
+      }
+      return bytes;
+  }
+}
+
+}  // namespace
+
+std::size_t estimate_gather_bytes(table_view const& input, std::size_t num_rows, bool nullable)
+{
+  return std::accumulate(input.begin(),
+                         input.end(),
+                         std::size_t{0},
+                         [num_rows, nullable](std::size_t sum, column_view const& col) {
+                           return sum + estimate_column_bytes(col, num_rows, nullable);
+                         });
+}
+
+}  // namespace detail
+}  // namespace cudf
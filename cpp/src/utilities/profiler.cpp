@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/profiler.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/profiler.hpp>
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+std::atomic<bool> profiler_enabled{false};
+
+namespace {
+/**
+ * @brief Figures of a call in progress on the current thread
+ */
+struct frame {
+  char const* name;
+  int64_t allocated;
+  int64_t current;  ///< Bytes allocated minus bytes freed since the start of the call
+  int64_t peak;
+  cudaEvent_t start;
+};
+
+/**
+ * @brief Calls of the current thread in progress, innermost last
+ *
+ * The allocations of a call are also attributed to the calls it is nested in.
+ */
+thread_local std::vector<frame> call_stack;
+
+/**
+ * @brief Completed call whose GPU time is not known yet
+ */
+struct pending_call {
+  char const* name;
+  cudaEvent_t start;
+  cudaEvent_t stop;
+};
+
+/**
+ * @brief Device memory resource adaptor attributing allocations to the calls in progress
+ */
+class profiling_resource final : public rmm::mr::device_memory_resource {
+ public:
+  explicit profiling_resource(rmm::mr::device_memory_resource* upstream) : _upstream{upstream} {}
+
+  rmm::mr::device_memory_resource* upstream() const { return _upstream; }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override
+  {
+    auto p = _upstream->allocate(bytes, stream);
+    for (auto& f : call_stack) {
+      f.allocated += bytes;
+      f.current += bytes;
+      f.peak = std::max(f.peak, f.current);
+    }
+    return p;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override
+  {
+    _upstream->deallocate(p, bytes, stream);
+    for (auto& f : call_stack) { f.current -= bytes; }
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t stream) const override
+  {
+    return _upstream->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* const _upstream;
+};
+
+/**
+ * @brief Process-wide state of the profiler, guarded by `mutex`
+ */
+struct profiler_state {
+  static constexpr std::size_t max_pending_calls = 1024;
+
+  std::mutex mutex;
+  std::unordered_map<std::string, operation_profile> profiles;
+  std::vector<pending_call> pending;
+  std::vector<cudaEvent_t> free_events;
+  // Buffers allocated while profiling keep a pointer to the adaptor, so adaptors are never freed
+  std::vector<std::unique_ptr<profiling_resource>> adaptors;
+
+  /**
+   * @brief Returns an event recorded on the default stream, or nullptr on error
+   *
+   * Does not throw, as calls end in destructors.
+   */
+  cudaEvent_t record_event()
+  {
+    cudaEvent_t event = nullptr;
+    if (not free_events.empty()) {
+      event = free_events.back();
+      free_events.pop_back();
+    } else if (cudaEventCreate(&event) != cudaSuccess) {
+      return nullptr;
+    }
+    if (cudaEventRecord(event, 0) != cudaSuccess) {
+      free_events.push_back(event);
+      return nullptr;
+    }
+    return event;
+  }
+
+  /**
+   * @brief Adds the GPU time of the pending calls, waiting for them if `wait` is true
+   */
+  void resolve_pending(bool wait)
+  {
+    auto const is_done = [&](pending_call const& call) {
+      if (wait) {
+        CUDA_TRY(cudaEventSynchronize(call.stop));
+      } else if (cudaEventQuery(call.stop) != cudaSuccess) {
+        return false;
+      }
+      float ms = 0;
+      if (cudaEventElapsedTime(&ms, call.start, call.stop) == cudaSuccess) {
+        profiles[call.name].gpu_time_ms += ms;
+      }
+      free_events.push_back(call.start);
+      free_events.push_back(call.stop);
+      return true;
+    };
+    pending.erase(std::remove_if(pending.begin(), pending.end(), is_done), pending.end());
+    // Clears the error of `cudaEventQuery()` for calls not done yet
+    cudaGetLastError();
+  }
+};
+
+profiler_state& state()
+{
+  // Never destroyed, so that calls ending during static destruction are safe
+  static auto* instance = new profiler_state;
+  return *instance;
+}
+
+}  // namespace
+
+bool begin_profile_range(char const* name)
+{
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  if (not profiler_enabled) { return false; }
+  call_stack.push_back(frame{name, 0, 0, 0, s.record_event()});
+  return true;
+}
+
+void end_profile_range()
+{
+  auto const call = call_stack.back();
+  call_stack.pop_back();
+  auto& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto& profile = s.profiles[call.name];
+  profile.calls += 1;
+  profile.bytes_allocated += call.allocated;
+  profile.peak_bytes = std::max(profile.peak_bytes, call.peak);
+  // The GPU time of the call is not measured if an event could not be recorded
+  auto const stop = s.record_event();
+  if (call.start == nullptr || stop == nullptr) {
+    if (call.start != nullptr) { s.free_events.push_back(call.start); }
+    if (stop != nullptr) { s.free_events.push_back(stop); }
+    return;
+  }
+  s.pending.push_back(pending_call{call.name, call.start, stop});
+  if (s.pending.size() > profiler_state::max_pending_calls) { s.resolve_pending(false); }
+}
+
+}  // namespace detail
+
+void enable_profiler()
+{
+  auto& s = detail::state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  if (detail::profiler_enabled) { return; }
+  s.adaptors.push_back(
+    std::make_unique<detail::profiling_resource>(rmm::mr::get_default_resource()));
+  rmm::mr::set_default_resource(s.adaptors.back().get());
+  detail::profiler_enabled = true;
+}
+
+void disable_profiler()
+{
+  auto& s = detail::state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  if (not detail::profiler_enabled) { return; }
+  detail::profiler_enabled = false;
+  // The default resource is left alone if it was replaced after the profiler was enabled
+  if (rmm::mr::get_default_resource() == s.adaptors.back().get()) {
+    rmm::mr::set_default_resource(s.adaptors.back()->upstream());
+  }
+}
+
+bool is_profiler_enabled() { return detail::profiler_enabled; }
+
+std::vector<operation_profile> get_profiles()
+{
+  auto& s = detail::state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.resolve_pending(true);
+  std::vector<operation_profile> result;
+  for (auto const& entry : s.profiles) {
+    result.push_back(entry.second);
+    result.back().name = entry.first;
+  }
+  std::sort(result.begin(), result.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.name < rhs.name;
+  });
+  return result;
+}
+
+void reset_profiles()
+{
+  auto& s = detail::state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  s.resolve_pending(true);
+  s.profiles.clear();
+}
+
+namespace {
+/**
+ * @brief Returns the name of an operation with the characters special to JSON and Prometheus
+ * label values escaped
+ */
+std::string escape_name(std::string const& name)
+{
+  std::string result;
+  for (auto c : name) {
+    if (c == '"' || c == '\\') { result += '\\'; }
+    result += c;
+  }
+  return result;
+}
+
+}  // namespace
+
+std::string profiles_to_json()
+{
+  std::ostringstream out;
+  out << "{\"operations\":[";
+  auto const profiles = get_profiles();
+  for (std::size_t i = 0; i < profiles.size(); ++i) {
+    auto const& p = profiles[i];
+    if (i > 0) { out << ","; }
+    out << "{\"name\":\"" << escape_name(p.name) << "\",\"calls\":" << p.calls
+        << ",\"bytes_allocated\":" << p.bytes_allocated << ",\"peak_bytes\":" << p.peak_bytes
+        << ",\"gpu_time_ms\":" << p.gpu_time_ms << "}";
+  }
+  out << "]}";
+  return out.str();
+}
+
+std::string profiles_to_prometheus()
+{
+  auto const profiles = get_profiles();
+  std::ostringstream out;
+  auto const write_metric = [&](char const* metric, char const* type, char const* help, auto get) {
+    out << "# HELP " << metric << " " << help << "\n# TYPE " << metric << " " << type << "\n";
+    for (auto const& p : profiles) {
+      out << metric << "{operation=\"" << escape_name(p.name) << "\"} " << get(p) << "\n";
+    }
+  };
+  write_metric("cudf_operation_calls_total",
+               "counter",
+               "Number of calls of the operation",
+               [](auto const& p) { return p.calls; });
+  write_metric("cudf_operation_allocated_bytes_total",
+               "counter",
+               "Bytes of device memory allocated by the operation",
+               [](auto const& p) { return p.bytes_allocated; });
+  write_metric("cudf_operation_peak_bytes",
+               "gauge",
+               "Largest device memory growth of a call of the operation",
+               [](auto const& p) { return p.peak_bytes; });
+  write_metric("cudf_operation_gpu_seconds_total",
+               "counter",
+               "Default stream time of the calls of the operation",
+               [](auto const& p) { return p.gpu_time_ms / 1000; });
+  return out.str();
+}
+
+}  // namespace cudf
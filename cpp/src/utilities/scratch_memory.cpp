@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
+
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <new>
+
+namespace cudf {
+namespace {
+// Alignment of the allocations of a `fixed_buffer_resource`, as guaranteed by cudaMalloc
+constexpr std::size_t fixed_buffer_alignment = 256;
+
+std::size_t aligned_size(std::size_t bytes)
+{
+  return (bytes + fixed_buffer_alignment - 1) / fixed_buffer_alignment * fixed_buffer_alignment;
+}
+
+/**
+ * @brief Returns the size class of a small allocation: its size is `256 << size_class`
+ */
+std::size_t size_class(std::size_t bytes)
+{
+  std::size_t size_class = 0;
+  while ((fixed_buffer_alignment << size_class) < bytes) { ++size_class; }
+  return size_class;
+}
+
+/**
+ * @brief Scratch resource of the current thread, or nullptr for the default resource
+ */
+thread_local rmm::mr::device_memory_resource* scratch_resource = nullptr;
+
+}  // namespace
+
+rmm::mr::device_memory_resource* get_scratch_resource()
+{
+  return (scratch_resource != nullptr) ? scratch_resource : rmm::mr::get_default_resource();
+}
+
+scratch_resource_scope::scratch_resource_scope(rmm::mr::device_memory_resource* mr)
+  : _previous{scratch_resource}
+{
+  CUDF_EXPECTS(mr != nullptr, "Scratch memory resource cannot be null");
+  scratch_resource = mr;
+}
+
+scratch_resource_scope::~scratch_resource_scope() { scratch_resource = _previous; }
+
+std::size_t fixed_buffer_resource::used_bytes() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _used;
+}
+
+void* fixed_buffer_resource::do_allocate(std::size_t bytes, cudaStream_t)
+{
+  auto const size = aligned_size(bytes);
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (size > _capacity - _used) { throw std::bad_alloc{}; }
+  auto const ptr = _buffer + _used;
+  _used += size;
+  ++_num_allocs;
+  return ptr;
+}
+
+void fixed_buffer_resource::do_deallocate(void* p, std::size_t bytes, cudaStream_t)
+{
+  auto const size = aligned_size(bytes);
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (--_num_allocs == 0) {
+    _used = 0;
+  } else if (static_cast<char*>(p) + size == _buffer + _used) {
+    // Temporaries are typically freed in reverse order, so their space is reused right away
+    _used -= size;
+  }
+}
+
+std::pair<std::size_t, std::size_t> fixed_buffer_resource::do_get_mem_info(cudaStream_t) const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return {_capacity - _used, _capacity};
+}
+
+small_object_resource::small_object_resource(rmm::mr::device_memory_resource* upstream,
+                                             std::size_t slab_size)
+  : _upstream{upstream}, _slab_size{aligned_size(slab_size)}
+{
+  CUDF_EXPECTS(upstream != nullptr, "Upstream memory resource cannot be null");
+  CUDF_EXPECTS(slab_size >= max_small_size, "Slabs must hold the largest small allocation");
+}
+
+small_object_resource::~small_object_resource()
+{
+  for (auto const& slab : _slabs) { _upstream->deallocate(slab.first, _slab_size, slab.second); }
+}
+
+std::size_t small_object_resource::slab_bytes() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _slabs.size() * _slab_size;
+}
+
+void* small_object_resource::do_allocate(std::size_t bytes, cudaStream_t stream)
+{
+  if (bytes > max_small_size) { return _upstream->allocate(bytes, stream); }
+  auto const index = size_class(bytes);
+  auto const size  = fixed_buffer_alignment << index;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto& blocks = _streams[stream];
+  auto& free   = blocks.free[index];
+  if (not free.empty()) {
+    auto const block = free.back();
+    free.pop_back();
+    return block;
+  }
+  if (static_cast<std::size_t>(blocks.slab_end - blocks.slab_next) < size) {
+    // The rest of the current slab is too small and stays unused
+    auto const slab = static_cast<char*>(_upstream->allocate(_slab_size, stream));
+    _slabs.emplace_back(slab, stream);
+    blocks.slab_next = slab;
+    blocks.slab_end  = slab + _slab_size;
+  }
+  auto const block = blocks.slab_next;
+  blocks.slab_next += size;
+  return block;
+}
+
+void small_object_resource::do_deallocate(void* p, std::size_t bytes, cudaStream_t stream)
+{
+  if (bytes > max_small_size) { return _upstream->deallocate(p, bytes, stream); }
+  std::lock_guard<std::mutex> lock(_mutex);
+  _streams[stream].free[size_class(bytes)].push_back(p);
+}
+
+std::pair<std::size_t, std::size_t> small_object_resource::do_get_mem_info(
+  cudaStream_t stream) const
+{
+  return _upstream->get_mem_info(stream);
+}
+
+}  // namespace cudf
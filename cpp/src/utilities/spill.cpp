@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/spill.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <new>
+#include <vector>
+
+namespace cudf {
+/**
+ * @brief The packed table, in device memory or, once evicted, in pinned host memory or a file
+ */
+struct spillable_table::storage {
+  struct pinned_deleter {
+    void operator()(uint8_t* ptr) const { cudaFreeHost(ptr); }
+  };
+
+  std::unique_ptr<std::vector<uint8_t>> metadata;
+  std::unique_ptr<rmm::device_buffer> gpu_data;  ///< Null while the table is evicted
+  std::unique_ptr<uint8_t, pinned_deleter> host_data;
+  std::string file;
+};
+
+spill_manager::spill_manager(std::size_t device_limit, std::string spill_directory)
+  : _device_limit{device_limit}, _spill_directory{std::move(spill_directory)}
+{
+}
+
+std::size_t spill_manager::spill(std::size_t bytes)
+{
+  std::lock_guard<std::recursive_mutex> lock(_mutex);
+  return spill_locked(bytes, nullptr);
+}
+
+std::size_t spill_manager::device_bytes() const
+{
+  std::lock_guard<std::recursive_mutex> lock(_mutex);
+  return _device_bytes;
+}
+
+std::size_t spill_manager::spilled_bytes() const
+{
+  std::lock_guard<std::recursive_mutex> lock(_mutex);
+  return _spilled_bytes;
+}
+
+void spill_manager::register_table(spillable_table* table)
+{
+  std::lock_guard<std::recursive_mutex> lock(_mutex);
+  _tables.push_front(table);
+  _device_bytes += table->size();
+  if (_device_bytes > _device_limit) { spill_locked(_device_bytes - _device_limit, table); }
+}
+
+void spill_manager::unregister_table(spillable_table* table)
+{
+  std::lock_guard<std::recursive_mutex> lock(_mutex);
+  _tables.remove(table);
+  if (table->is_spilled()) {
+    _spilled_bytes -= table->size();
+  } else {
+    _device_bytes -= table->size();
+  }
+}
+
+void spill_manager::touch(spillable_table* table)
+{
+  auto it = std::find(_tables.begin(), _tables.end(), table);
+  if (it != _tables.end()) { _tables.splice(_tables.begin(), _tables, it); }
+}
+
+std::size_t spill_manager::spill_locked(std::size_t bytes, spillable_table const* keep)
+{
+  std::size_t freed = 0;
+  for (auto it = _tables.rbegin(); it != _tables.rend() && freed < bytes; ++it) {
+    auto table = *it;
+    if (table == keep || table->_locks > 0 || table->is_spilled() || table->size() == 0) {
+      continue;
+    }
+    auto const size = table->spill(_spill_directory, _next_id++);
+    _device_bytes -= size;
+    _spilled_bytes += size;
+    freed += size;
+  }
+  return freed;
+}
+
+spillable_table::lock::lock(lock&& other) noexcept : _table{other._table}, _view{other._view}
+{
+  other._table = nullptr;
+}
+
+spillable_table::lock::~lock()
+{
+  if (_table == nullptr) { return; }
+  std::lock_guard<std::recursive_mutex> guard(_table->_manager._mutex);
+  --_table->_locks;
+}
+
+spillable_table::spillable_table(table_view const& input,
+                                 spill_manager& manager,
+                                 rmm::mr::device_memory_resource* mr)
+  : spillable_table(pack(input, mr), manager, mr)
+{
+}
+
+spillable_table::spillable_table(packed_columns&& packed,
+                                 spill_manager& manager,
+                                 rmm::mr::device_memory_resource* mr)
+  : _manager{manager},
+    _mr{mr},
+    _size{packed.gpu_data->size()},
+    _storage{new storage{std::move(packed.metadata), std::move(packed.gpu_data), nullptr, {}}}
+{
+  _manager.register_table(this);
+}
+
+spillable_table::~spillable_table()
+{
+  _manager.unregister_table(this);
+  if (not _storage->file.empty()) { std::remove(_storage->file.c_str()); }
+}
+
+spillable_table::lock spillable_table::acquire()
+{
+  std::lock_guard<std::recursive_mutex> guard(_manager._mutex);
+  // Locked first, so that the allocations of the restore do not evict the table again
+  ++_locks;
+  if (is_spilled()) {
+    try {
+      restore();
+    } catch (...) {
+      --_locks;
+      throw;
+    }
+    _manager._spilled_bytes -= _size;
+    _manager._device_bytes += _size;
+  }
+  _manager.touch(this);
+  if (_manager._device_bytes > _manager._device_limit) {
+    _manager.spill_locked(_manager._device_bytes - _manager._device_limit, this);
+  }
+  return lock(this,
+              unpack(_storage->metadata->data(),
+                     static_cast<uint8_t const*>(_storage->gpu_data->data())));
+}
+
+bool spillable_table::is_spilled() const { return _storage->gpu_data == nullptr; }
+
+std::size_t spillable_table::spill(std::string const& spill_directory, std::size_t id)
+{
+  auto& gpu_data = _storage->gpu_data;
+  if (spill_directory.empty()) {
+    uint8_t* host_data;
+    CUDA_TRY(cudaMallocHost(&host_data, _size));
+    _storage->host_data.reset(host_data);
+    CUDA_TRY(cudaMemcpy(host_data, gpu_data->data(), _size, cudaMemcpyDeviceToHost));
+  } else {
+    std::vector<uint8_t> host_data(_size);
+    CUDA_TRY(cudaMemcpy(host_data.data(), gpu_data->data(), _size, cudaMemcpyDeviceToHost));
+    auto const file = spill_directory + "/cudf-spill-" + std::to_string(id) + ".bin";
+    std::ofstream out(file, std::ios::binary);
+    out.write(reinterpret_cast<char const*>(host_data.data()), _size);
+    CUDF_EXPECTS(out.good(), "Cannot write the spill file " + file);
+    _storage->file = file;
+  }
+  gpu_data.reset();
+  return _size;
+}
+
+void spillable_table::restore()
+{
+  auto gpu_data = std::make_unique<rmm::device_buffer>(_size, cudaStream_t{0}, _mr);
+  if (_storage->host_data != nullptr) {
+    CUDA_TRY(cudaMemcpy(
+      gpu_data->data(), _storage->host_data.get(), _size, cudaMemcpyHostToDevice));
+    _storage->host_data.reset();
+  } else {
+    std::vector<uint8_t> host_data(_size);
+    std::ifstream in(_storage->file, std::ios::binary);
+    in.read(reinterpret_cast<char*>(host_data.data()), _size);
+    CUDF_EXPECTS(in.good(), "Cannot read the spill file " + _storage->file);
+    CUDA_TRY(cudaMemcpy(gpu_data->data(), host_data.data(), _size, cudaMemcpyHostToDevice));
+    std::remove(_storage->file.c_str());
+    _storage->file.clear();
+  }
+  _storage->gpu_data = std::move(gpu_data);
+}
+
+void* spill_on_demand_resource::do_allocate(std::size_t bytes, cudaStream_t stream)
+{
+  while (true) {
+    try {
+      return _upstream->allocate(bytes, stream);
+    } catch (std::bad_alloc const&) {
+      if (_manager.spill(bytes) == 0) { throw; }
+    }
+  }
+}
+
+}  // namespace cudf
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/transform.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+using cudf::ast::ast_operator;
+using cudf::ast::column_reference;
+using cudf::ast::literal;
+using cudf::ast::operation;
+
+struct ASTTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ASTTest, FusedArithmeticAndComparison)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{1, 2, 3, 4};
+  cudf::test::fixed_width_column_wrapper<int32_t> b{5, 6, 7, 8};
+  cudf::test::fixed_width_column_wrapper<int16_t> c{1, -20, 3, 0};
+  cudf::test::fixed_width_column_wrapper<int64_t> d{5, 0, 30, 32};
+  cudf::table_view table{{a, b, c, d}};
+
+  // (a * b) + c > d
+  column_reference col_a(0), col_b(1), col_c(2), col_d(3);
+  operation product(ast_operator::MUL, col_a, col_b);
+  operation sum(ast_operator::ADD, product, col_c);
+  operation expr(ast_operator::GREATER, sum, col_d);
+
+  auto result = cudf::ast::compute_column(table, expr);
+  cudf::test::fixed_width_column_wrapper<bool> expected{true, false, false, false};
+  cudf::test::expect_columns_equal(expected, result->view());
+
+  auto sums = cudf::ast::compute_column(table, sum);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_sums{6, -8, 24, 32};
+  cudf::test::expect_columns_equal(expected_sums, sums->view());
+}
+
+TEST_F(ASTTest, FloatPromotionAndLiterals)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<float> x{0.5, 1.5, -2.0};
+  cudf::table_view table{{a, x}};
+
+  cudf::numeric_scalar<int32_t> ten(10);
+  column_reference col_a(0), col_x(1);
+  literal lit_ten(ten);
+  operation scaled(ast_operator::MUL, col_x, lit_ten);
+  operation expr(ast_operator::SUB, col_a, scaled);
+
+  auto result = cudf::ast::compute_column(table, expr);
+  cudf::test::fixed_width_column_wrapper<double> expected{-4.0, -13.0, 23.0};
+  cudf::test::expect_columns_equal(expected, result->view());
+
+  operation halves(ast_operator::TRUE_DIV, col_a, lit_ten);
+  auto divided = cudf::ast::compute_column(table, halves);
+  cudf::test::fixed_width_column_wrapper<double> expected_divided{0.1, 0.2, 0.3};
+  cudf::test::expect_columns_equivalent(expected_divided, divided->view());
+}
+
+TEST_F(ASTTest, NullSemantics)
+{
+  cudf::test::fixed_width_column_wrapper<bool> p{{true, false, true, false, true},
+                                                 {1, 1, 0, 0, 0}};
+  cudf::test::fixed_width_column_wrapper<bool> q{{false, false, true, true, false},
+                                                 {0, 0, 1, 1, 0}};
+  cudf::table_view table{{p, q}};
+  column_reference col_p(0), col_q(1);
+
+  // p = {T, F, -, -, -}, q = {-, -, T, T, -}
+  operation both(ast_operator::LOGICAL_AND, col_p, col_q);
+  auto and_result = cudf::ast::compute_column(table, both);
+  cudf::test::fixed_width_column_wrapper<bool> expected_and{{false, false, false, false, false},
+                                                            {0, 1, 0, 0, 0}};
+  cudf::test::expect_columns_equivalent(expected_and, and_result->view());
+
+  operation either(ast_operator::LOGICAL_OR, col_p, col_q);
+  auto or_result = cudf::ast::compute_column(table, either);
+  cudf::test::fixed_width_column_wrapper<bool> expected_or{{true, false, true, true, false},
+                                                           {1, 0, 1, 1, 0}};
+  cudf::test::expect_columns_equivalent(expected_or, or_result->view());
+
+  operation is_null(ast_operator::IS_NULL, col_p);
+  auto null_result = cudf::ast::compute_column(table, is_null);
+  cudf::test::fixed_width_column_wrapper<bool> expected_null{false, false, true, true, true};
+  cudf::test::expect_columns_equal(expected_null, null_result->view());
+}
+
+TEST_F(ASTTest, IntegerDivisionByZero)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{7, 8, -9, 10};
+  cudf::test::fixed_width_column_wrapper<int32_t> b{2, 0, 4, -1};
+  cudf::table_view table{{a, b}};
+  column_reference col_a(0), col_b(1);
+
+  operation quotient(ast_operator::DIV, col_a, col_b);
+  auto result = cudf::ast::compute_column(table, quotient);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected{{3, 0, -2, -10}, {1, 0, 1, 1}};
+  cudf::test::expect_columns_equivalent(expected, result->view());
+
+  operation remainder(ast_operator::MOD, col_a, col_b);
+  auto mod_result = cudf::ast::compute_column(table, remainder);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_mod{{1, 0, -1, 0}, {1, 0, 1, 1}};
+  cudf::test::expect_columns_equivalent(expected_mod, mod_result->view());
+}
+
+TEST_F(ASTTest, InvalidExpressions)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a{1, 2, 3};
+  cudf::table_view table{{a}};
+  column_reference col_a(0), col_missing(1);
+
+  EXPECT_THROW(cudf::ast::compute_column(table, col_missing), cudf::logic_error);
+  EXPECT_THROW(operation(ast_operator::NOT, col_a, col_a), cudf::logic_error);
+  EXPECT_THROW(operation(ast_operator::ADD, col_a), cudf::logic_error);
+}
@@ -19,7 +19,10 @@
 
 #include <tests/binaryop/assert-binops.h>
 #include <cudf/binaryop.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <tests/binaryop/binop-fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
 
 namespace cudf {
 namespace test {
@@ -2036,6 +2039,169 @@ TEST_F(BinaryOperationIntegrationTest, ATan2_Vector_Vector_FP64_SI32_SI64)
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, ATAN2(), NearEqualComparator<TypeOut>{2});
 }
 
+TEST_F(BinaryOperationIntegrationTest, Precompile_Mul_SI64_SI32_SI64)
+{
+  using TypeOut = int64_t;
+  using TypeLhs = int32_t;
+  using TypeRhs = int64_t;
+
+  using MUL = cudf::library::operation::Mul<TypeOut, TypeLhs, TypeRhs>;
+
+  cudf::precompile_binary_operations({{cudf::binary_operator::MUL,
+                                       data_type(type_to_id<TypeLhs>()),
+                                       data_type(type_to_id<TypeRhs>()),
+                                       data_type(type_to_id<TypeOut>())}});
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(100);
+  auto rhs = make_random_wrapped_column<TypeRhs>(100);
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::MUL, data_type(type_to_id<TypeOut>()));
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, MUL());
+
+  auto scalar     = make_random_wrapped_scalar<TypeLhs>();
+  auto scalar_out = cudf::binary_operation(
+    scalar, rhs, cudf::binary_operator::MUL, data_type(type_to_id<TypeOut>()));
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*scalar_out, scalar, rhs, MUL());
+}
+
+TEST_F(BinaryOperationIntegrationTest, Compare_Dictionary_B8_STR_STR)
+{
+  auto strings = cudf::test::strings_column_wrapper({"eee", "bb", "", "aa", "bbb", "ééé", "bb"});
+  auto others  = cudf::test::strings_column_wrapper({"ééé", "bbb", "aa", "", "zz", "bb", "eee"});
+  // the dictionaries have different keys
+  auto const lhs      = cudf::dictionary::encode(strings);
+  auto const rhs      = cudf::dictionary::encode(others);
+  auto const out_type = data_type(type_to_id<bool>());
+
+  for (auto op : {cudf::binary_operator::EQUAL,
+                  cudf::binary_operator::NOT_EQUAL,
+                  cudf::binary_operator::LESS,
+                  cudf::binary_operator::GREATER,
+                  cudf::binary_operator::LESS_EQUAL,
+                  cudf::binary_operator::GREATER_EQUAL}) {
+    // keys that are in the dictionary and keys that fall between its keys
+    for (auto key : {"bb", "bbc", "zzz"}) {
+      auto const scalar = cudf::string_scalar(key);
+      expect_columns_equivalent(*cudf::binary_operation(strings, scalar, op, out_type),
+                                *cudf::binary_operation(lhs->view(), scalar, op, out_type));
+      expect_columns_equivalent(*cudf::binary_operation(scalar, strings, op, out_type),
+                                *cudf::binary_operation(scalar, lhs->view(), op, out_type));
+    }
+    expect_columns_equivalent(*cudf::binary_operation(strings, others, op, out_type),
+                              *cudf::binary_operation(lhs->view(), rhs->view(), op, out_type));
+  }
+
+  EXPECT_THROW(cudf::binary_operation(
+                 lhs->view(), cudf::string_scalar("bb"), cudf::binary_operator::ADD, out_type),
+               cudf::logic_error);
+}
+
+TEST_F(BinaryOperationIntegrationTest, Compiled_Sliced_Vector_Vector_FP64_SI32_FP64)
+{
+  using TypeOut = double;
+  using TypeLhs = int32_t;
+  using TypeRhs = double;
+
+  using DIV = cudf::library::operation::Div<TypeOut, TypeLhs, TypeRhs>;
+
+  // The operands are read from their offsets, which differ between the two columns
+  auto lhs_column = make_random_wrapped_column<TypeLhs>(100);
+  auto rhs_column = make_random_wrapped_column<TypeRhs>(100);
+  auto const lhs  = cudf::slice(lhs_column, {10, 60})[0];
+  auto const rhs  = cudf::slice(rhs_column, {25, 75})[0];
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::DIV, data_type(type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, DIV());
+}
+
+TEST_F(BinaryOperationIntegrationTest, Compiled_Sub_Vector_Vector_TimepointMS_DurationMS)
+{
+  using TypeOut = cudf::duration_ms;
+  using TypeLhs = cudf::timestamp_ms;
+  using TypeRhs = cudf::timestamp_ms;
+
+  using SUB = cudf::library::operation::Sub<TypeOut, TypeLhs, TypeRhs>;
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(100);
+  auto rhs = make_random_wrapped_column<TypeRhs>(100);
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::SUB, data_type(type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, SUB());
+}
+
+TEST_F(BinaryOperationIntegrationTest, Compiled_Less_Scalar_Vector_B8_DurationNS_DurationNS)
+{
+  using TypeOut = bool;
+  using TypeLhs = cudf::duration_ns;
+  using TypeRhs = cudf::duration_ns;
+
+  using LESS = cudf::library::operation::Less<TypeOut, TypeLhs, TypeRhs>;
+
+  auto lhs = cudf::scalar_type_t<TypeLhs>(TypeLhs{1000});
+  auto rhs = make_random_wrapped_column<TypeRhs>(100);
+  auto out =
+    cudf::binary_operation(lhs, rhs, cudf::binary_operator::LESS, data_type(type_to_id<TypeOut>()));
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, LESS());
+}
+
+TEST_F(BinaryOperationIntegrationTest, Precompile_InvalidType)
+{
+  EXPECT_THROW(cudf::precompile_binary_operations({{cudf::binary_operator::ADD,
+                                                    data_type(type_id::STRING),
+                                                    data_type(type_id::INT32),
+                                                    data_type(type_id::INT32)}}),
+               cudf::logic_error);
+}
+
+TEST_F(BinaryOperationIntegrationTest, FixedPoint_Vector_Vector_Decimal32)
+{
+  using namespace numeric;
+  // 1.5, -0.25, 3 and 0.1, 2.05, 3
+  fixed_point_column_wrapper<int32_t> lhs({15, -2, 30}, {1, 1, 1}, scale_type{-1});
+  fixed_point_column_wrapper<int32_t> rhs({10, 205, 300}, {1, 0, 1}, scale_type{-2});
+  auto const lhs_scale = static_cast<column_view>(lhs).type().scale();
+  auto const rhs_scale = static_cast<column_view>(rhs).type().scale();
+
+  auto const add_type = data_type{
+    type_id::DECIMAL32,
+    binary_operation_fixed_point_scale(binary_operator::ADD, lhs_scale, rhs_scale)};
+  auto const sum = cudf::binary_operation(lhs, rhs, binary_operator::ADD, add_type);
+  expect_columns_equal(
+    *sum, fixed_point_column_wrapper<int32_t>({160, 0, 600}, {1, 0, 1}, scale_type{-2}));
+
+  auto const mul_type = data_type{
+    type_id::DECIMAL32,
+    binary_operation_fixed_point_scale(binary_operator::MUL, lhs_scale, rhs_scale)};
+  auto const product = cudf::binary_operation(lhs, rhs, binary_operator::MUL, mul_type);
+  expect_columns_equal(
+    *product, fixed_point_column_wrapper<int32_t>({150, 0, 9000}, {1, 0, 1}, scale_type{-3}));
+
+  auto const less =
+    cudf::binary_operation(lhs, rhs, binary_operator::LESS, data_type{type_id::BOOL8});
+  expect_columns_equal(*less, fixed_width_column_wrapper<bool>({false, false, false}, {1, 0, 1}));
+  auto const equal =
+    cudf::binary_operation(lhs, rhs, binary_operator::EQUAL, data_type{type_id::BOOL8});
+  expect_columns_equal(*equal, fixed_width_column_wrapper<bool>({false, false, true}, {1, 0, 1}));
+
+  // The output scale must be the scale of the result
+  EXPECT_THROW(cudf::binary_operation(lhs, rhs, binary_operator::ADD, mul_type), cudf::logic_error);
+  EXPECT_THROW(cudf::binary_operation(lhs, rhs, binary_operator::MOD, add_type), cudf::logic_error);
+}
+
+TEST_F(BinaryOperationIntegrationTest, FixedPoint_Scalar_Vector_Decimal64)
+{
+  using namespace numeric;
+  auto const lhs = fixed_point_scalar<decimal64>(125, scale_type{-2});
+  fixed_point_column_wrapper<int64_t> rhs({1, -2, 3}, scale_type{0});
+
+  auto const out =
+    cudf::binary_operation(lhs, rhs, binary_operator::SUB, data_type{type_id::DECIMAL64, -2});
+  expect_columns_equal(*out, fixed_point_column_wrapper<int64_t>({25, 325, -175}, scale_type{-2}));
+}
+
 }  // namespace binop
 }  // namespace test
 }  // namespace cudf
@@ -15,6 +15,7 @@
  */
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
@@ -26,6 +27,8 @@
 #include <thrust/device_ptr.h>
 #include <thrust/device_vector.h>
 
+#include <algorithm>
+
 struct BitmaskUtilitiesTest : public cudf::test::BaseFixture {
 };
 
@@ -496,4 +499,86 @@ TEST_F(CopyBitmaskTest, TestCopyColumnViewVectorDiscontiguous)
     concatenated_bitmask.data(), gold_mask.data(), num_elements / CHAR_BIT);
 }
 
+TEST_F(CopyBitmaskTest, TestBitmaskAndWithNullCount)
+{
+  cudf::size_type num_elements = 1001;
+
+  auto lhs_valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto rhs_valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  auto data       = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> lhs(data, data + num_elements, lhs_valids);
+  cudf::test::fixed_width_column_wrapper<int32_t> rhs(data, data + num_elements, rhs_valids);
+  cudf::test::fixed_width_column_wrapper<int32_t> non_nullable(data, data + num_elements);
+
+  // Offset inputs, so that the masks are shifted before they are combined
+  auto const lhs_sliced   = cudf::slice(lhs, {7, num_elements}).front();
+  auto const rhs_sliced   = cudf::slice(rhs, {0, num_elements - 7}).front();
+  auto const valid_sliced = cudf::slice(non_nullable, {0, num_elements - 7}).front();
+
+  cudf::size_type expected_null_count = 0;
+  for (cudf::size_type i = 0; i < num_elements - 7; ++i) {
+    expected_null_count += ((i + 7) % 3 == 0) || (i % 5 == 0);
+  }
+
+  auto const result = cudf::detail::bitmask_and_with_null_count(
+    cudf::table_view{{lhs_sliced, rhs_sliced, valid_sliced}});
+  EXPECT_EQ(result.second, expected_null_count);
+  EXPECT_EQ(result.second,
+            cudf::count_unset_bits(
+              static_cast<cudf::bitmask_type const *>(result.first.data()), 0, num_elements - 7));
+
+  // A single nullable column with a known null count is copied without counting
+  auto const single =
+    cudf::detail::bitmask_and_with_null_count(cudf::table_view{{lhs_sliced, valid_sliced}});
+  EXPECT_EQ(single.second, lhs_sliced.null_count());
+
+  auto const none = cudf::detail::bitmask_and_with_null_count(cudf::table_view{{non_nullable}});
+  EXPECT_EQ(none.first.size(), 0u);
+  EXPECT_EQ(none.second, 0);
+}
+
+TEST_F(CopyBitmaskTest, TestBitmaskOrWithNullCount)
+{
+  cudf::size_type num_elements = 1001;
+
+  auto lhs_valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto rhs_valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  auto mid_valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return (i % 7) != 1; });
+  auto data = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> lhs(data, data + num_elements, lhs_valids);
+  cudf::test::fixed_width_column_wrapper<int32_t> rhs(data, data + num_elements, rhs_valids);
+  cudf::test::fixed_width_column_wrapper<int32_t> mid(data, data + num_elements, mid_valids);
+  cudf::test::fixed_width_column_wrapper<int32_t> non_nullable(data, data + num_elements);
+
+  // Offset inputs, so that the masks are shifted before they are combined
+  auto const lhs_sliced = cudf::slice(lhs, {7, num_elements}).front();
+  auto const rhs_sliced = cudf::slice(rhs, {0, num_elements - 7}).front();
+  auto const mid_sliced = cudf::slice(mid, {3, num_elements - 4}).front();
+  cudf::table_view input{{lhs_sliced, rhs_sliced, mid_sliced}};
+
+  std::vector<bool> expected_valids(num_elements - 7);
+  for (cudf::size_type i = 0; i < num_elements - 7; ++i) {
+    expected_valids[i] = ((i + 7) % 3 != 0) || (i % 5 != 0) || ((i + 3) % 7 != 1);
+  }
+  auto const expected_null_count = static_cast<cudf::size_type>(
+    std::count(expected_valids.begin(), expected_valids.end(), false));
+
+  auto const result = cudf::bitmask_or_with_null_count(input);
+  EXPECT_EQ(result.second, expected_null_count);
+  auto result_mask = cudf::bitmask_or(input);
+  thrust::device_ptr<cudf::bitmask_type> ptr(static_cast<cudf::bitmask_type *>(result_mask.data()));
+  thrust::host_vector<cudf::bitmask_type> h_mask(
+    ptr, ptr + cudf::num_bitmask_words(num_elements - 7));
+  for (cudf::size_type i = 0; i < num_elements - 7; ++i) {
+    EXPECT_EQ(cudf::bit_is_set(h_mask.data(), i), expected_valids[i]);
+  }
+
+  // A column without a mask makes every row valid
+  auto const all_valid =
+    cudf::bitmask_or_with_null_count(cudf::table_view{{lhs_sliced, non_nullable}});
+  EXPECT_EQ(all_valid.first.size(), 0u);
+  EXPECT_EQ(all_valid.second, 0);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/ipc_handles.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <vector>
+
+using cudf::test::fixed_width_column_wrapper;
+
+// CUDA IPC handles cannot be opened by the process that created them, so the round trip is
+// exercised with tables that reference no device memory
+struct IpcHandlesTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(IpcHandlesTest, EmptyColumnsRoundTrip)
+{
+  cudf::column_view ints{cudf::data_type{cudf::type_id::INT32}, 0, nullptr};
+  cudf::column_view timestamps{cudf::data_type{cudf::type_id::TIMESTAMP_DAYS}, 0, nullptr};
+  cudf::table_view input{{ints, timestamps}};
+  auto const descriptor = cudf::export_ipc(input);
+  auto const imported   = cudf::import_ipc(descriptor);
+  cudf::test::expect_tables_equal(input, imported->view());
+}
+
+TEST_F(IpcHandlesTest, SharedAllocation)
+{
+  fixed_width_column_wrapper<int64_t> col{{1, 2, 3, 4, 5, 6}};
+  auto const halves = cudf::split(cudf::column_view{col}, {3});
+  cudf::table_view one_allocation{{halves[0], halves[1]}};
+  cudf::table_view one_column{{halves[0]}};
+  // The second half is in the allocation of the first, so only the column metadata grows
+  auto const shared_size = cudf::export_ipc(one_allocation).size();
+  auto const single_size = cudf::export_ipc(one_column).size();
+  auto const empty_size  = cudf::export_ipc(cudf::table_view{}).size();
+  EXPECT_EQ(shared_size - single_size, single_size - empty_size - sizeof(cudaIpcMemHandle_t));
+}
+
+TEST_F(IpcHandlesTest, InvalidDescriptor)
+{
+  std::vector<uint8_t> const garbage(64, 0);
+  EXPECT_THROW(cudf::import_ipc(garbage), cudf::logic_error);
+  cudf::column_view ints{cudf::data_type{cudf::type_id::INT32}, 0, nullptr};
+  auto descriptor = cudf::export_ipc(cudf::table_view{{ints}});
+  descriptor.pop_back();
+  EXPECT_THROW(cudf::import_ipc(descriptor), cudf::logic_error);
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/shuffle.hpp>
+#include <cudf/table/table.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <future>
+#include <vector>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct ShuffleTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ShuffleTest, TwoRanks)
+{
+  fixed_width_column_wrapper<int32_t> keys0{{1, 2, 3, 4, 5}, {1, 1, 0, 1, 1}};
+  strings_column_wrapper values0({"a", "b", "c", "d", "e"});
+  fixed_width_column_wrapper<int32_t> keys1{{4, 5, 6, 7}};
+  strings_column_wrapper values1({"f", "g", "h", "i"});
+  std::vector<cudf::table_view> inputs{cudf::table_view{{keys0, values0}},
+                                       cudf::table_view{{keys1, values1}}};
+  std::vector<cudf::size_type> const columns_to_hash{0};
+
+  // Both ranks run on the current device
+  int device;
+  CUDA_TRY(cudaGetDevice(&device));
+  auto comms = cudf::comms::make_peer_communicators({device, device});
+  std::vector<std::future<std::unique_ptr<cudf::table>>> results;
+  for (int r = 0; r < 2; ++r) {
+    results.push_back(std::async(std::launch::async, [&, r]() {
+      CUDA_TRY(cudaSetDevice(device));
+      return cudf::comms::shuffle(inputs[r], columns_to_hash, *comms[r]);
+    }));
+  }
+
+  // Rank `r` receives partition `r` of each rank, in rank order
+  std::vector<std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::size_type>>> partitioned;
+  for (auto const& input : inputs) {
+    partitioned.push_back(cudf::hash_partition(input, columns_to_hash, 2));
+  }
+  for (int r = 0; r < 2; ++r) {
+    std::vector<cudf::table_view> pieces;
+    for (auto const& p : partitioned) {
+      auto const end =
+        (r + 1 < static_cast<int>(p.second.size())) ? p.second[r + 1] : p.first->num_rows();
+      pieces.push_back(cudf::slice(p.first->view(), {p.second[r], end})[0]);
+    }
+    auto const expected = cudf::concatenate(pieces);
+    cudf::test::expect_tables_equal(expected->view(), results[r].get()->view());
+  }
+}
+
+TEST_F(ShuffleTest, EmptyInput)
+{
+  fixed_width_column_wrapper<int64_t> keys{};
+  cudf::table_view input{{keys}};
+  int device;
+  CUDA_TRY(cudaGetDevice(&device));
+  auto comms        = cudf::comms::make_peer_communicators({device});
+  auto const result = cudf::comms::shuffle(input, {0}, *comms[0]);
+  EXPECT_EQ(result->num_rows(), 0);
+  EXPECT_EQ(result->num_columns(), 1);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
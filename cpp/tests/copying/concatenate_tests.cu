@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/table/table.hpp>
@@ -26,6 +27,9 @@
 
 #include <thrust/sequence.h>
 
+#include <numeric>
+#include <string>
+
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
 
@@ -182,6 +186,51 @@ TEST_F(TableTest, ConcatenateTables)
   cudf::test::expect_tables_equal(*concat_table, gold_table);
 }
 
+TEST_F(TableTest, ConcatenateManySmallTables)
+{
+  using LCW                    = cudf::test::lists_column_wrapper<int32_t>;
+  constexpr int32_t num_tables = 300;
+
+  std::vector<column_wrapper<int32_t>> ints;
+  std::vector<s_col_wrapper> strings;
+  std::vector<LCW> lists;
+  std::vector<std::string> h_strings;
+  for (int32_t i = 0; i < num_tables; ++i) {
+    h_strings.push_back("s" + std::to_string(i));
+    ints.push_back(column_wrapper<int32_t>({i}, {i % 3 != 0}));
+    strings.push_back(s_col_wrapper({h_strings.back()}));
+    lists.push_back(LCW{i, i + 1});
+  }
+  std::vector<TView> tables;
+  for (int32_t i = 0; i < num_tables; ++i) {
+    tables.push_back(TView{{ints[i], strings[i], lists[i]}});
+  }
+
+  auto const results = cudf::concatenate(tables);
+
+  auto const valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  std::vector<int32_t> h_ints(num_tables);
+  std::iota(h_ints.begin(), h_ints.end(), 0);
+  column_wrapper<int32_t> expected_ints(h_ints.begin(), h_ints.end(), valids);
+  s_col_wrapper expected_strings(h_strings.begin(), h_strings.end());
+  std::vector<int32_t> h_offsets(num_tables + 1);
+  std::vector<int32_t> h_values;
+  for (int32_t i = 0; i < num_tables; ++i) {
+    h_offsets[i + 1] = 2 * (i + 1);
+    h_values.push_back(i);
+    h_values.push_back(i + 1);
+  }
+  column_wrapper<int32_t> offsets(h_offsets.begin(), h_offsets.end());
+  column_wrapper<int32_t> values(h_values.begin(), h_values.end());
+  auto expected_lists =
+    cudf::make_lists_column(num_tables, offsets.release(), values.release(), 0, {});
+
+  cudf::test::expect_columns_equal(results->get_column(0), expected_ints);
+  cudf::test::expect_columns_equal(results->get_column(1), expected_strings);
+  cudf::test::expect_columns_equal(results->get_column(2), *expected_lists);
+}
+
 TEST_F(TableTest, ConcatenateTablesWithOffsets)
 {
   column_wrapper<int32_t> col1_1{{5, 4, 3, 5, 8, 5, 6}};
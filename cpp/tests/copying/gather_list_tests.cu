@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <tests/strings/utilities.h>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.cuh>
@@ -27,6 +28,8 @@
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
 template <typename T>
 class GatherTestList : public cudf::test::BaseFixture {
 };
@@ -311,3 +314,65 @@ TYPED_TEST(GatherTestList, GatherDetailInvalidIndex)
     cudf::test::expect_columns_equal(results->view().column(0), expected);
   }
 }
+
+TYPED_TEST(GatherTestList, GatherSkewedListSizes)
+{
+  using T = TypeParam;
+
+  // sizes covering the lists copied by a thread, by a warp and by a block
+  std::vector<cudf::size_type> sizes{5000, 3, 100, 0, 40, 1, 4096};
+  std::vector<cudf::size_type> offsets{0};
+  for (auto size : sizes) { offsets.push_back(offsets.back() + size); }
+  auto values   = thrust::make_counting_iterator<int32_t>(0);
+  auto validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+
+  for (bool nullable : {false, true}) {
+    auto child = nullable ? cudf::test::fixed_width_column_wrapper<T, int32_t>(
+                              values, values + offsets.back(), validity)
+                              .release()
+                          : cudf::test::fixed_width_column_wrapper<T, int32_t>(
+                              values, values + offsets.back())
+                              .release();
+    auto list = cudf::make_lists_column(
+      sizes.size(),
+      cudf::test::fixed_width_column_wrapper<cudf::size_type>(offsets.begin(), offsets.end())
+        .release(),
+      std::move(child),
+      0,
+      {});
+
+    std::vector<cudf::size_type> map{6, 0, 2, 1, 3, 5, 4, 0};
+    cudf::test::fixed_width_column_wrapper<cudf::size_type> gather_map(map.begin(), map.end());
+    auto results = cudf::gather(cudf::table_view{{*list}}, gather_map);
+
+    std::vector<cudf::size_type> expected_offsets{0};
+    std::vector<int32_t> expected_values;
+    std::vector<bool> expected_validity;
+    for (auto row : map) {
+      for (auto i = offsets[row]; i < offsets[row + 1]; ++i) {
+        expected_values.push_back(i);
+        expected_validity.push_back(!nullable || i % 3 != 0);
+      }
+      expected_offsets.push_back(expected_values.size());
+    }
+    auto expected_child = nullable ? cudf::test::fixed_width_column_wrapper<T, int32_t>(
+                                       expected_values.begin(),
+                                       expected_values.end(),
+                                       expected_validity.begin())
+                                       .release()
+                                   : cudf::test::fixed_width_column_wrapper<T, int32_t>(
+                                       expected_values.begin(), expected_values.end())
+                                       .release();
+    auto expected = cudf::make_lists_column(
+      map.size(),
+      cudf::test::fixed_width_column_wrapper<cudf::size_type>(expected_offsets.begin(),
+                                                              expected_offsets.end())
+        .release(),
+      std::move(expected_child),
+      0,
+      {});
+
+    cudf::test::expect_columns_equal(results->view().column(0), *expected);
+  }
+}
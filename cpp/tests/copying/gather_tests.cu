@@ -242,3 +242,98 @@ TYPED_TEST(GatherTest, MultiColNulls)
     cudf::test::expect_columns_equal(expect_column, result->view().column(i));
   }
 }
+
+TYPED_TEST(GatherTest, MixedTableNullifyOutOfBounds)
+{
+  constexpr cudf::size_type source_size{1000};
+  constexpr cudf::size_type offset{5};
+
+  auto data     = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+
+  // A sliced nullable column, a non-nullable column and a strings column in between
+  cudf::test::fixed_width_column_wrapper<TypeParam> nullable_column(
+    data, data + source_size + offset, validity);
+  auto sliced = cudf::slice(nullable_column, {offset, source_size + offset}).front();
+  cudf::test::fixed_width_column_wrapper<TypeParam> non_nullable_column(data, data + source_size);
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 7, 'a' + i % 26); });
+  cudf::test::strings_column_wrapper strings_column(strings, strings + source_size);
+
+  cudf::table_view source_table{{sliced, strings_column, non_nullable_column}};
+
+  // Every third index is out of bounds
+  auto map_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 3 == 0) ? source_size + i : source_size - 1 - i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(map_data, map_data + source_size);
+  auto const map_view = static_cast<cudf::column_view>(gather_map);
+
+  auto result =
+    cudf::detail::gather(source_table, map_view.begin<int32_t>(), map_view.end<int32_t>(), true);
+
+  auto expect_index = [](auto i) { return source_size - 1 - i; };
+
+  auto expect_sliced_data = cudf::test::make_counting_transform_iterator(
+    0, [expect_index](auto i) { return (expect_index(i) + offset) % 100; });
+  auto expect_sliced_valid = cudf::test::make_counting_transform_iterator(
+    0, [expect_index](auto i) { return (i % 3 != 0) && ((expect_index(i) + offset) % 2); });
+  auto expect_data = cudf::test::make_counting_transform_iterator(
+    0, [expect_index](auto i) { return expect_index(i) % 100; });
+  auto expect_valid =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto expect_strings = cudf::test::make_counting_transform_iterator(0, [expect_index](auto i) {
+    auto const index = expect_index(i);
+    return (i % 3 == 0) ? std::string{} : std::string(index % 7, 'a' + index % 26);
+  });
+
+  cudf::test::fixed_width_column_wrapper<TypeParam> expect_sliced(
+    expect_sliced_data, expect_sliced_data + source_size, expect_sliced_valid);
+  cudf::test::strings_column_wrapper expect_strings_column(
+    expect_strings, expect_strings + source_size, expect_valid);
+  cudf::test::fixed_width_column_wrapper<TypeParam> expect_non_nullable(
+    expect_data, expect_data + source_size, expect_valid);
+
+  cudf::test::expect_columns_equal(expect_sliced, result->view().column(0));
+  cudf::test::expect_columns_equal(expect_strings_column, result->view().column(1));
+  cudf::test::expect_columns_equal(expect_non_nullable, result->view().column(2));
+}
+
+TYPED_TEST(GatherTest, WideTable)
+{
+  constexpr cudf::size_type source_size{5000};
+  constexpr cudf::size_type n_cols = 100;
+
+  auto data     = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+
+  std::vector<cudf::test::fixed_width_column_wrapper<TypeParam>> source_column_wrappers;
+  for (int i = 0; i < n_cols; ++i) {
+    if (i % 2 == 0) {
+      source_column_wrappers.emplace_back(data, data + source_size, validity);
+    } else {
+      source_column_wrappers.emplace_back(data, data + source_size);
+    }
+  }
+  std::vector<cudf::column_view> source_columns(source_column_wrappers.begin(),
+                                                source_column_wrappers.end());
+
+  auto map_data =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return (i * 7) % source_size; });
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(map_data, map_data + source_size);
+
+  auto result = cudf::gather(cudf::table_view{source_columns}, gather_map);
+
+  auto expect_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return ((i * 7) % source_size) % 100; });
+  auto expect_valid = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return ((i * 7) % source_size) % 3; });
+  cudf::test::fixed_width_column_wrapper<TypeParam> expect_nullable(
+    expect_data, expect_data + source_size, expect_valid);
+  cudf::test::fixed_width_column_wrapper<TypeParam> expect_non_nullable(expect_data,
+                                                                        expect_data + source_size);
+
+  for (auto i = 0; i < n_cols; ++i) {
+    cudf::test::expect_columns_equal(i % 2 == 0 ? expect_nullable : expect_non_nullable,
+                                     result->view().column(i));
+  }
+}
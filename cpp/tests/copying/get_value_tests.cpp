@@ -26,6 +26,9 @@
 #include <tests/utilities/type_list_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace test {
 
@@ -166,5 +169,65 @@ TYPED_TEST(DictionaryGetValueTest, GetNull)
   EXPECT_FALSE(s->is_valid());
 }
 
+template <typename T>
+struct GetElementsTest : public BaseFixture {
+};
+
+TYPED_TEST_CASE(GetElementsTest, FixedWidthTypes);
+
+TYPED_TEST(GetElementsTest, MixedTable)
+{
+  fixed_width_column_wrapper<TypeParam, int32_t> col1({9, 8, 7, 6, 5}, {1, 1, 0, 1, 1});
+  strings_column_wrapper col2({"", "this", "is", "a", "test"}, {1, 1, 1, 0, 1});
+  fixed_width_column_wrapper<TypeParam, int32_t> keys({6, 7, 8, 9});
+  fixed_width_column_wrapper<int32_t> indices({3, 2, 1, 0, 3}, {1, 1, 1, 1, 0});
+  auto col3 = make_dictionary_column(keys, indices);
+
+  auto results = get_elements(table_view{{col1, col2, *col3}}, {4, 1, 2, 3, 0, 1});
+  ASSERT_EQ(results.size(), 3u);
+
+  EXPECT_EQ(results[0].type, data_type{type_to_id<TypeParam>()});
+  EXPECT_EQ(results[0].validity, (std::vector<bool>{1, 1, 0, 1, 1, 1}));
+  EXPECT_EQ(results[0].template value<TypeParam>(0), TypeParam(5));
+  EXPECT_EQ(results[0].template value<TypeParam>(1), TypeParam(8));
+  EXPECT_EQ(results[0].template value<TypeParam>(4), TypeParam(9));
+
+  EXPECT_EQ(results[1].type, data_type{type_id::STRING});
+  EXPECT_EQ(results[1].validity, (std::vector<bool>{1, 1, 1, 0, 1, 1}));
+  EXPECT_EQ(results[1].strings[0], "test");
+  EXPECT_EQ(results[1].strings[1], "this");
+  EXPECT_EQ(results[1].strings[2], "is");
+  EXPECT_EQ(results[1].strings[4], "");
+
+  // dictionaries are returned as their keys
+  EXPECT_EQ(results[2].type, data_type{type_to_id<TypeParam>()});
+  EXPECT_EQ(results[2].validity, (std::vector<bool>{0, 1, 1, 1, 1, 1}));
+  EXPECT_EQ(results[2].template value<TypeParam>(1), TypeParam(8));
+  EXPECT_EQ(results[2].template value<TypeParam>(3), TypeParam(6));
+  EXPECT_EQ(results[2].template value<TypeParam>(4), TypeParam(9));
+}
+
+TYPED_TEST(GetElementsTest, Sliced)
+{
+  fixed_width_column_wrapper<TypeParam, int32_t> col({9, 8, 7, 6, 5}, {1, 0, 1, 1, 1});
+  strings_column_wrapper strings({"a", "bb", "ccc", "dddd", "eeeee"});
+  auto const sliced = slice(table_view{{col, strings}}, {1, 5}).front();
+
+  auto results = get_elements(sliced, {3, 0});
+  EXPECT_EQ(results[0].validity, (std::vector<bool>{1, 0}));
+  EXPECT_EQ(results[0].template value<TypeParam>(0), TypeParam(5));
+  EXPECT_EQ(results[1].strings, (std::vector<std::string>{"eeeee", "bb"}));
+}
+
+TYPED_TEST(GetElementsTest, Empty)
+{
+  fixed_width_column_wrapper<TypeParam, int32_t> col({9, 8, 7});
+  auto results = get_elements(table_view{{col}}, {});
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_TRUE(results[0].data.empty());
+  EXPECT_TRUE(results[0].validity.empty());
+  EXPECT_THROW(get_elements(table_view{{col}}, {1, 3}), cudf::logic_error);
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+struct PackUnpackTest : public BaseFixture {
+};
+
+TEST_F(PackUnpackTest, RoundTrip)
+{
+  fixed_width_column_wrapper<int32_t> col0({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0});
+  fixed_width_column_wrapper<double> col1{0.5, 1.5, 2.5, 3.5, 4.5};
+  strings_column_wrapper col2({"", "pack", "unpack", "shuffle", "spill"}, {1, 1, 0, 1, 1});
+  table_view input{{col0, col1, col2}};
+
+  auto const packed = pack(input);
+  expect_tables_equal(input, unpack(packed));
+}
+
+TEST_F(PackUnpackTest, UnpackFromCopies)
+{
+  fixed_width_column_wrapper<int64_t> col0({1, 2, 3, 4, 5, 6}, {1, 1, 0, 1, 1, 1});
+  strings_column_wrapper col1({"a", "bb", "ccc", "", "ee", "f"}, {1, 0, 1, 1, 1, 1});
+  table_view input{{col0, col1}};
+  auto const sliced = slice(input, {1, 5})[0];
+
+  auto const packed = pack(sliced);
+  // as if both were sent to another process
+  std::vector<uint8_t> const metadata(*packed.metadata);
+  rmm::device_buffer const gpu_data(*packed.gpu_data);
+  auto const result = unpack(metadata.data(), static_cast<uint8_t const*>(gpu_data.data()));
+  expect_tables_equal(sliced, result);
+}
+
+TEST_F(PackUnpackTest, MetadataOfContiguousSplit)
+{
+  fixed_width_column_wrapper<int16_t> col0({1, 2, 3, 4, 5, 6, 7}, {1, 0, 1, 1, 0, 1, 1});
+  strings_column_wrapper col1{"a", "b", "c", "d", "e", "f", "g"};
+  table_view input{{col0, col1}};
+
+  auto const expected = split(input, {3});
+  auto const splits   = contiguous_split(input, {3});
+  for (size_t idx = 0; idx < splits.size(); ++idx) {
+    auto const& all_data = *splits[idx].all_data;
+    auto const metadata  = pack_metadata(
+      splits[idx].table, static_cast<uint8_t const*>(all_data.data()), all_data.size());
+    expect_tables_equal(expected[idx],
+                        unpack(metadata.data(), static_cast<uint8_t const*>(all_data.data())));
+  }
+}
+
+TEST_F(PackUnpackTest, InvalidArguments)
+{
+  fixed_width_column_wrapper<int32_t> col0{1, 2, 3};
+  table_view input{{col0}};
+  rmm::device_buffer other(64);
+  EXPECT_THROW(pack_metadata(input, static_cast<uint8_t const*>(other.data()), other.size()),
+               logic_error);
+
+  std::vector<uint8_t> const garbage(64, 0);
+  EXPECT_THROW(unpack(garbage.data(), nullptr), logic_error);
+}
+
+TEST_F(PackUnpackTest, SerializeToDeviceBuffer)
+{
+  // Several pages of repetitive data, so that most pages compress
+  constexpr size_type num_rows = 50000;
+  auto const values = make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  auto const valids = make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  fixed_width_column_wrapper<int64_t> col0(values, values + num_rows, valids);
+  fixed_width_column_wrapper<int32_t> col1(values, values + num_rows);
+  strings_column_wrapper col2({"", "serialize", "to", "device", "buffer"}, {1, 1, 0, 1, 1});
+  table_view input{{col0, col1}};
+
+  for (auto compression : {io::compression_type::NONE, io::compression_type::SNAPPY}) {
+    auto const serialized = serialize_to_device_buffer(input, compression);
+    // as if the buffer was sent to another process
+    rmm::device_buffer const received(*serialized);
+    auto const packed = deserialize_from_device_buffer(received.data(), received.size());
+    expect_tables_equal(input, unpack(packed));
+  }
+  auto const compressed = serialize_to_device_buffer(input, io::compression_type::SNAPPY);
+  EXPECT_LT(compressed->size(), pack(input).gpu_data->size());
+
+  table_view small{{col2}};
+  auto const serialized = serialize_to_device_buffer(small, io::compression_type::SNAPPY);
+  expect_tables_equal(
+    small, unpack(deserialize_from_device_buffer(serialized->data(), serialized->size())));
+}
+
+TEST_F(PackUnpackTest, DeserializeInvalidBuffer)
+{
+  fixed_width_column_wrapper<int32_t> col0{1, 2, 3};
+  table_view input{{col0}};
+  EXPECT_THROW(serialize_to_device_buffer(input, io::compression_type::GZIP), logic_error);
+
+  auto const serialized = serialize_to_device_buffer(input);
+  EXPECT_THROW(deserialize_from_device_buffer(serialized->data(), serialized->size() - 1),
+               logic_error);
+  rmm::device_buffer const garbage(std::vector<uint8_t>(64, 0).data(), 64);
+  EXPECT_THROW(deserialize_from_device_buffer(garbage.data(), garbage.size()), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -28,6 +28,8 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <algorithm>
+
 struct SampleTest : public cudf::test::BaseFixture {
 };
 
@@ -83,6 +85,47 @@ TEST_F(SampleTest, TestReproducibilityWithSeed)
   }
 }
 
+TEST_F(SampleTest, SparseSampleDistinctRows)
+{
+  cudf::size_type const table_size = 100000;
+  cudf::size_type const n_samples  = 1000;
+  auto data = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(data, data + table_size);
+
+  cudf::table_view input({col1});
+  auto out_table = cudf::sample(input, n_samples, cudf::sample_with_replacement::FALSE, 7);
+  ASSERT_EQ(out_table->num_rows(), n_samples);
+
+  auto rows = cudf::test::to_host<int32_t>(out_table->get_column(0)).first;
+  std::sort(rows.begin(), rows.end());
+  EXPECT_EQ(std::unique(rows.begin(), rows.end()), rows.end());
+  EXPECT_GE(rows.front(), 0);
+  EXPECT_LT(rows.back(), table_size);
+
+  auto again = cudf::sample(input, n_samples, cudf::sample_with_replacement::FALSE, 7);
+  cudf::test::expect_tables_equal(out_table->view(), again->view());
+}
+
+TEST_F(SampleTest, SampleFraction)
+{
+  cudf::size_type const table_size = 10000;
+  auto data = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(data, data + table_size);
+
+  cudf::table_view input({col1});
+  EXPECT_EQ(cudf::sample_fraction(input, 0.0)->num_rows(), 0);
+  cudf::test::expect_tables_equal(input, cudf::sample_fraction(input, 1.0)->view());
+
+  auto out_table = cudf::sample_fraction(input, 0.5, 3);
+  EXPECT_GT(out_table->num_rows(), 4500);
+  EXPECT_LT(out_table->num_rows(), 5500);
+  // Sampled rows keep their input order
+  auto rows = cudf::test::to_host<int32_t>(out_table->get_column(0)).first;
+  EXPECT_TRUE(std::is_sorted(rows.begin(), rows.end()));
+
+  EXPECT_THROW(cudf::sample_fraction(input, 1.5), cudf::logic_error);
+}
+
 struct SampleBasicTest : public SampleTest,
                          public ::testing::WithParamInterface<
                            std::tuple<cudf::size_type, cudf::sample_with_replacement>> {
@@ -205,6 +205,50 @@ TEST_F(SliceCornerCases, NegativeOffset)
   EXPECT_THROW(cudf::slice(col, indices), cudf::logic_error);
 }
 
+TEST_F(SliceCornerCases, NullCounts)
+{
+  cudf::size_type size = 100;
+
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+
+  auto expected_null_count = [](cudf::size_type begin, cudf::size_type end) {
+    cudf::size_type count = 0;
+    for (auto i = begin; i < end; ++i) { count += (i % 3 == 0); }
+    return count;
+  };
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col =
+    create_fixed_columns<int32_t>(0, size, valids);
+  cudf::column_view view = col;
+  ASSERT_EQ(view.null_count(), expected_null_count(0, size));
+
+  // The null counts of the slices of a slice account for its offset
+  auto sliced = cudf::slice(view, {10, 90}).front();
+  EXPECT_EQ(sliced.null_count(), expected_null_count(10, 90));
+  auto slices = cudf::slice(sliced, {0, 5, 5, 50, 37, 80});
+  EXPECT_EQ(slices[0].null_count(), expected_null_count(10, 15));
+  EXPECT_EQ(slices[1].null_count(), expected_null_count(15, 60));
+  EXPECT_EQ(slices[2].null_count(), expected_null_count(47, 90));
+
+  // Slices of a column whose null count is not known are counted on demand
+  cudf::column_view unknown{view.type(),
+                            view.size(),
+                            view.head(),
+                            view.null_mask(),
+                            cudf::UNKNOWN_NULL_COUNT};
+  auto unknown_slices = cudf::slice(unknown, {3, 40});
+  EXPECT_FALSE(unknown_slices[0].has_known_null_count());
+  EXPECT_EQ(unknown_slices[0].null_count(), expected_null_count(3, 40));
+
+  // Slices of a column without nulls have no nulls
+  auto all_valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  cudf::test::fixed_width_column_wrapper<int32_t> all_valid(
+    all_valids, all_valids + size, all_valids);
+  auto valid_slices = cudf::slice(all_valid, {3, 40});
+  EXPECT_TRUE(valid_slices[0].has_known_null_count());
+  EXPECT_EQ(valid_slices[0].null_count(), 0);
+}
+
 template <typename T>
 struct SliceTableTest : public cudf::test::BaseFixture {
 };
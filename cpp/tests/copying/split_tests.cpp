@@ -678,3 +678,29 @@ TEST_F(ContiguousSplitTableCornerCases, MixedColumnTypes)
     cudf::test::expect_tables_equivalent(expected[index], result[index].table);
   }
 }
+
+TEST_F(ContiguousSplitTableCornerCases, ManySplitsWithNulls)
+{
+  constexpr cudf::size_type num_rows = 10000;
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 5, 'a' + i % 26); });
+  cudf::test::fixed_width_column_wrapper<int16_t> col0(values, values + num_rows, valids);
+  cudf::test::fixed_width_column_wrapper<double> col1(values, values + num_rows);
+  cudf::test::strings_column_wrapper col2(strings, strings + num_rows, valids);
+  cudf::table_view input{{col0, col1, col2}};
+
+  // uneven splits, most of which start in the middle of a bitmask word
+  std::vector<cudf::size_type> splits;
+  for (cudf::size_type row = 7; row < num_rows; row += 7 + row % 13) {
+    splits.push_back(row);
+  }
+  auto const expected = cudf::split(input, splits);
+  auto const result   = cudf::contiguous_split(input, splits);
+  ASSERT_EQ(expected.size(), result.size());
+  for (size_t idx = 0; idx < result.size(); ++idx) {
+    cudf::test::expect_tables_equal(expected[idx], result[idx].table);
+    EXPECT_EQ(expected[idx].column(0).null_count(), result[idx].table.column(0).null_count());
+  }
+}
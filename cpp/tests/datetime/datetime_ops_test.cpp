@@ -17,6 +17,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
@@ -55,6 +56,7 @@ TYPED_TEST(NonTimestampTest, TestThrowsOnNonTimestamp)
   EXPECT_THROW(extract_second(col), cudf::logic_error);
   EXPECT_THROW(last_day_of_month(col), cudf::logic_error);
   EXPECT_THROW(day_of_year(col), cudf::logic_error);
+  EXPECT_THROW(extract_components(col), cudf::logic_error);
 }
 
 struct BasicDatetimeOpsTest : public cudf::test::BaseFixture {
@@ -191,6 +193,15 @@ TYPED_TEST(TypedDatetimeOpsTest, TestExtractingGeneratedDatetimeComponents)
   expect_columns_equal(*extract_hour(timestamps), expected_hours);
   expect_columns_equal(*extract_minute(timestamps), expected_minutes);
   expect_columns_equal(*extract_second(timestamps), expected_seconds);
+
+  auto const components = extract_components(timestamps);
+  ASSERT_EQ(components->num_columns(), 6);
+  expect_columns_equal(components->get_column(0), expected_years);
+  expect_columns_equal(components->get_column(1), expected_months);
+  expect_columns_equal(components->get_column(2), expected_days);
+  expect_columns_equal(components->get_column(3), expected_hours);
+  expect_columns_equal(components->get_column(4), expected_minutes);
+  expect_columns_equal(components->get_column(5), expected_seconds);
 }
 
 TYPED_TEST(TypedDatetimeOpsTest, TestExtractingGeneratedNullableDatetimeComponents)
@@ -247,6 +258,15 @@ TYPED_TEST(TypedDatetimeOpsTest, TestExtractingGeneratedNullableDatetimeComponen
   expect_columns_equal(*extract_hour(timestamps), expected_hours);
   expect_columns_equal(*extract_minute(timestamps), expected_minutes);
   expect_columns_equal(*extract_second(timestamps), expected_seconds);
+
+  auto const components = extract_components(timestamps);
+  ASSERT_EQ(components->num_columns(), 6);
+  expect_columns_equal(components->get_column(0), expected_years);
+  expect_columns_equal(components->get_column(1), expected_months);
+  expect_columns_equal(components->get_column(2), expected_days);
+  expect_columns_equal(components->get_column(3), expected_hours);
+  expect_columns_equal(components->get_column(4), expected_minutes);
+  expect_columns_equal(components->get_column(5), expected_seconds);
 }
 
 TEST_F(BasicDatetimeOpsTest, TestLastDayOfMonthWithSeconds)
@@ -383,3 +403,34 @@ TEST_F(BasicDatetimeOpsTest, TestDayOfYearWithEmptyColumn)
 }
 
 CUDF_TEST_PROGRAM_MAIN()
+
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezone)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+
+  auto timestamps_utc = fixed_width_column_wrapper<cudf::timestamp_s>{
+    {1577836800,   // 2020-01-01 00:00:00 UTC
+     1593561600,   // 2020-07-01 00:00:00 UTC
+     0,            // null
+     4118083200},  // 2100-07-01 00:00:00 UTC, after the last transition of the tzfile
+    {true, true, false, true}};
+  auto timestamps_new_york = fixed_width_column_wrapper<cudf::timestamp_s>{
+    {1577836800 - 5 * 3600, 1593561600 - 4 * 3600, 0, 4118083200 - 4 * 3600},
+    {true, true, false, true}};
+
+  auto const local = convert_timezone(timestamps_utc, "UTC", "America/New_York");
+  expect_columns_equal(*local, timestamps_new_york);
+  expect_columns_equal(*convert_timezone(*local, "America/New_York", "UTC"), timestamps_utc);
+  expect_columns_equal(*convert_timezone(timestamps_utc, "UTC", "UTC"), timestamps_utc);
+
+  // New York is 4 hours behind UTC in July, and Tokyo 9 hours ahead
+  auto timestamps_ms = fixed_width_column_wrapper<cudf::timestamp_ms>{1593561600123};
+  auto expected_ms   = fixed_width_column_wrapper<cudf::timestamp_ms>{1593608400123};
+  expect_columns_equal(*convert_timezone(timestamps_ms, "America/New_York", "Asia/Tokyo"),
+                       expected_ms);
+
+  EXPECT_THROW(convert_timezone(timestamps_utc, "UTC", "Not/A_Timezone"), cudf::logic_error);
+  EXPECT_THROW(convert_timezone(fixed_width_column_wrapper<cudf::timestamp_D>{0}, "UTC", "UTC"),
+               cudf::logic_error);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <vector>
+
+struct DictionaryConcatenateTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(DictionaryConcatenateTest, StringsColumn)
+{
+  cudf::test::strings_column_wrapper strings1({"eee", "aaa", "", "ccc"}, {1, 1, 0, 1});
+  cudf::test::strings_column_wrapper strings2({"bbb", "ccc", "fff", "bbb"});
+  auto dictionary1 = cudf::dictionary::encode(strings1);
+  auto dictionary2 = cudf::dictionary::encode(strings2);
+
+  auto result = cudf::concatenate({dictionary1->view(), dictionary2->view()});
+  cudf::dictionary_column_view view(result->view());
+  EXPECT_EQ(view.size(), 8);
+  EXPECT_EQ(view.null_count(), 1);
+
+  cudf::test::strings_column_wrapper keys_expected({"aaa", "bbb", "ccc", "eee", "fff"});
+  cudf::test::expect_columns_equal(view.keys(), keys_expected);
+  cudf::test::fixed_width_column_wrapper<int32_t> indices_expected{3, 0, 0, 2, 1, 2, 4, 1};
+  auto const indices  = cudf::test::to_host<int32_t>(view.indices()).first;
+  auto const expected = cudf::test::to_host<int32_t>(indices_expected).first;
+  for (cudf::size_type i = 0; i < view.size(); ++i) {
+    if (i != 2) { EXPECT_EQ(indices[i], expected[i]) << "at row " << i; }
+  }
+}
+
+TEST_F(DictionaryConcatenateTest, SlicedAndSameKeys)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{7, 5, 7, 5, 9, 5};
+  auto dictionary = cudf::dictionary::encode(input);
+  auto const sliced = cudf::slice(dictionary->view(), std::vector<cudf::size_type>{1, 3, 3, 6});
+
+  auto result = cudf::concatenate({sliced[1], sliced[0], dictionary->view()});
+  cudf::dictionary_column_view view(result->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> keys_expected{5, 7, 9};
+  cudf::test::expect_columns_equal(view.keys(), keys_expected);
+  cudf::test::fixed_width_column_wrapper<int32_t> indices_expected{0, 2, 0, 0, 1, 1, 0, 1, 0, 2, 0};
+  cudf::test::expect_columns_equal(view.indices(), indices_expected);
+}
@@ -79,3 +79,28 @@ TEST_F(DictionaryEncodeTest, InvalidEncode)
   EXPECT_THROW(cudf::dictionary::encode(input, cudf::data_type{cudf::type_id::INT16}),
                cudf::logic_error);
 }
+
+TEST_F(DictionaryEncodeTest, EncodeLowCardinality)
+{
+  std::vector<int32_t> h_input(10000);
+  std::vector<bool> h_valid(h_input.size());
+  std::vector<int32_t> h_expected(h_input.size());
+  for (size_t i = 0; i < h_input.size(); ++i) {
+    h_input[i]    = static_cast<int32_t>((i * 7) % 5) * 10 - 20;
+    h_valid[i]    = (i % 11) != 0;
+    h_expected[i] = h_valid[i] ? (h_input[i] + 20) / 10 : 5;
+  }
+  cudf::test::fixed_width_column_wrapper<int32_t> input(
+    h_input.begin(), h_input.end(), h_valid.begin());
+
+  auto dictionary = cudf::dictionary::encode(input);
+  cudf::dictionary_column_view view(dictionary->view());
+  EXPECT_EQ(view.null_count(), cudf::column_view(input).null_count());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> keys_expected{-20, -10, 0, 10, 20};
+  cudf::test::expect_columns_equal(view.keys(), keys_expected);
+  auto const indices = cudf::test::to_host<int32_t>(view.indices()).first;
+  for (size_t i = 0; i < h_input.size(); ++i) {
+    if (h_valid[i]) { EXPECT_EQ(indices[i], h_expected[i]) << "at row " << i; }
+  }
+}
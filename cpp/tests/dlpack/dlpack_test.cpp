@@ -369,4 +369,71 @@ TYPED_TEST(DLPackNumericTests, FromDlpackEmpty1D)
   EXPECT_THROW(cudf::from_dlpack(tensor.get()), cudf::logic_error);
 }
 
+TYPED_TEST(DLPackNumericTests, ColumnToDlpackZeroCopy)
+{
+  fixed_width_column_wrapper<TypeParam> col({1, 2, 3, 4}, {1, 0, 1, 1});
+  auto input       = col.release();
+  auto const data  = input->view().head();
+  auto const clone = std::make_unique<cudf::column>(*input);
+
+  unique_managed_tensor result(cudf::to_dlpack(std::move(input)));
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<TypeParam>(tensor.dtype);
+  EXPECT_EQ(kDLGPU, tensor.ctx.device_type);
+  EXPECT_EQ(1, tensor.ndim);
+  EXPECT_EQ(4, tensor.shape[0]);
+  EXPECT_EQ(data, tensor.data);
+
+  constexpr cudf::data_type type{cudf::type_to_id<TypeParam>()};
+  cudf::column_view const result_view(
+    type, tensor.shape[0], tensor.data, clone->view().null_mask(), 1);
+  expect_columns_equal(clone->view(), result_view);
+}
+
+TYPED_TEST(DLPackNumericTests, ValidityToDlpack)
+{
+  fixed_width_column_wrapper<TypeParam> col1({1, 2, 3, 4}, {1, 0, 1, 1});
+  fixed_width_column_wrapper<TypeParam> col2({5, 6, 7, 8});
+  cudf::table_view input({col1, col2});
+
+  unique_managed_tensor result(cudf::validity_to_dlpack(input));
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<uint8_t>(tensor.dtype);
+  EXPECT_EQ(2, tensor.ndim);
+  EXPECT_EQ(4, tensor.shape[0]);
+  EXPECT_EQ(2, tensor.shape[1]);
+
+  fixed_width_column_wrapper<uint8_t> expected({1, 0, 1, 1, 1, 1, 1, 1});
+  cudf::column_view const result_view(
+    cudf::data_type{cudf::type_id::UINT8}, 8, tensor.data, nullptr, 0);
+  expect_columns_equal(expected, result_view);
+}
+
+TYPED_TEST(DLPackNumericTests, FromDlpackView)
+{
+  using T         = TypeParam;
+  auto const col1 = cudf::test::make_type_param_vector<T>({1, 2, 3, 4});
+  auto const col2 = cudf::test::make_type_param_vector<T>({4, 5, 6, 7});
+  fixed_width_column_wrapper<T> c1(col1.cbegin(), col1.cend());
+  fixed_width_column_wrapper<T> c2(col2.cbegin(), col2.cend());
+  cudf::table_view input({c1, c2});
+
+  auto tensor       = cudf::to_dlpack(input);
+  auto const data   = tensor->dl_tensor.data;
+  auto const result = cudf::from_dlpack_view(tensor);
+  EXPECT_EQ(data, result.view.column(0).head());
+  expect_tables_equal(input, result.view);
+}
+
+TEST_F(DLPackUntypedTests, CpuTensorFromDlpackView)
+{
+  fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4});
+  cudf::table_view input({col});
+  auto tensor = cudf::to_dlpack(input);
+
+  // Spoof a host tensor, which cannot be viewed from the device; the tensor is deleted
+  tensor->dl_tensor.ctx.device_type = kDLCPU;
+  EXPECT_THROW(cudf::from_dlpack_view(tensor), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/binaryop.hpp>
+#include <cudf/encode.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+struct PackedBoolsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(PackedBoolsTest, RoundTrip)
+{
+  cudf::test::fixed_width_column_wrapper<bool> input(
+    {true, false, false, true, true, false, true, true, false, true},
+    {1, 1, 0, 1, 1, 1, 1, 0, 1, 1});
+  auto packed = cudf::pack_bools(input);
+  EXPECT_EQ(packed->size(), 10);
+  EXPECT_EQ(packed->null_count(), 2);
+  cudf::test::expect_columns_equal(*cudf::unpack_bools(*packed), input);
+
+  cudf::test::fixed_width_column_wrapper<bool> empty{};
+  cudf::test::expect_columns_equal(*cudf::unpack_bools(*cudf::pack_bools(empty)), empty);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> not_bools{1, 0};
+  EXPECT_THROW(cudf::pack_bools(not_bools), cudf::logic_error);
+}
+
+TEST_F(PackedBoolsTest, BinaryOperations)
+{
+  // 40 rows, to span two words
+  std::vector<bool> h_lhs(40), h_rhs(40);
+  for (size_t i = 0; i < h_lhs.size(); ++i) {
+    h_lhs[i] = i % 3 == 0;
+    h_rhs[i] = i % 2 == 0;
+  }
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 35; });
+  cudf::test::fixed_width_column_wrapper<bool> lhs(h_lhs.begin(), h_lhs.end(), validity);
+  cudf::test::fixed_width_column_wrapper<bool> rhs(h_rhs.begin(), h_rhs.end());
+  auto packed_lhs = cudf::pack_bools(lhs);
+  auto packed_rhs = cudf::pack_bools(rhs);
+
+  for (auto op : {cudf::binary_operator::EQUAL,
+                  cudf::binary_operator::NOT_EQUAL,
+                  cudf::binary_operator::LESS,
+                  cudf::binary_operator::GREATER_EQUAL,
+                  cudf::binary_operator::LOGICAL_AND,
+                  cudf::binary_operator::LOGICAL_OR}) {
+    auto expected = cudf::binary_operation(lhs, rhs, op, cudf::data_type{cudf::type_id::BOOL8});
+    auto results  = cudf::binary_operation(*packed_lhs, *packed_rhs, op);
+    EXPECT_EQ(results->null_count(), 1);
+    cudf::test::expect_columns_equal(*cudf::unpack_bools(*results), *expected);
+  }
+
+  EXPECT_THROW(cudf::binary_operation(*packed_lhs, *packed_rhs, cudf::binary_operator::ADD),
+               cudf::logic_error);
+}
+
+TEST_F(PackedBoolsTest, ApplyBooleanMask)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{1, 2, 3, 4, 5, 6};
+  cudf::test::fixed_width_column_wrapper<bool> mask({true, false, true, true, false, true},
+                                                    {1, 1, 1, 0, 1, 1});
+  cudf::table_view input{{col}};
+
+  auto expected = cudf::apply_boolean_mask(input, mask);
+  auto results  = cudf::apply_boolean_mask(input, *cudf::pack_bools(mask));
+  cudf::test::expect_tables_equal(results->view(), expected->view());
+
+  cudf::test::fixed_width_column_wrapper<bool> short_mask{true, false};
+  EXPECT_THROW(cudf::apply_boolean_mask(input, *cudf::pack_bools(short_mask)), cudf::logic_error);
+}
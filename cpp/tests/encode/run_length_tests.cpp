@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/encode.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+struct RunLengthTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(RunLengthTest, EncodeDecode)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input({5, 5, 5, 2, 2, 0, 0, 7, 5, 5},
+                                                        {1, 1, 1, 1, 1, 0, 0, 1, 1, 1});
+  auto encoded = cudf::run_length_encode(input);
+  EXPECT_EQ(encoded->size(), 10);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_values({5, 2, 0, 7, 5}, {1, 1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_ends{3, 5, 7, 8, 10};
+  cudf::test::expect_columns_equal(encoded->values(), expected_values);
+  cudf::test::expect_columns_equal(encoded->run_ends(), expected_ends);
+  cudf::test::expect_columns_equal(*cudf::run_length_decode(*encoded), input);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> empty{};
+  auto empty_encoded = cudf::run_length_encode(empty);
+  EXPECT_EQ(empty_encoded->num_runs(), 0);
+  EXPECT_EQ(cudf::run_length_decode(*empty_encoded)->size(), 0);
+
+  cudf::test::strings_column_wrapper strings{"a", "a"};
+  EXPECT_THROW(cudf::run_length_encode(strings), cudf::logic_error);
+}
+
+TEST_F(RunLengthTest, Reduce)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input({5, 5, 5, 2, 2, 0, 0, 7, 5, 5},
+                                                        {1, 1, 1, 1, 1, 0, 0, 1, 1, 1});
+  auto encoded     = cudf::run_length_encode(input);
+  auto const dtype = cudf::data_type{cudf::type_id::INT64};
+
+  for (auto make_agg :
+       {cudf::make_sum_aggregation, cudf::make_min_aggregation, cudf::make_max_aggregation}) {
+    auto expected = cudf::reduce(input, make_agg(), dtype);
+    auto result   = cudf::reduce(*encoded, make_agg(), dtype);
+    EXPECT_EQ(static_cast<cudf::scalar_type_t<int64_t>*>(result.get())->value(),
+              static_cast<cudf::scalar_type_t<int64_t>*>(expected.get())->value());
+  }
+  EXPECT_EQ(static_cast<cudf::scalar_type_t<int64_t>*>(
+              cudf::reduce(*encoded, cudf::make_sum_aggregation(), dtype).get())
+              ->value(),
+            36);
+
+  EXPECT_THROW(cudf::reduce(*encoded, cudf::make_product_aggregation(), dtype), cudf::logic_error);
+}
+
+TEST_F(RunLengthTest, ApplyBooleanMask)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{1, 2, 3, 4, 5, 6, 7, 8};
+  cudf::test::fixed_width_column_wrapper<bool> mask(
+    {true, true, false, false, true, true, true, false}, {1, 1, 1, 1, 0, 0, 1, 1});
+  cudf::table_view input{{col}};
+
+  auto expected = cudf::apply_boolean_mask(input, mask);
+  auto results  = cudf::apply_boolean_mask(input, *cudf::run_length_encode(mask));
+  cudf::test::expect_tables_equal(results->view(), expected->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> not_bools{1, 1, 1, 1, 1, 1, 1, 1};
+  EXPECT_THROW(cudf::apply_boolean_mask(input, *cudf::run_length_encode(not_bools)),
+               cudf::logic_error);
+}
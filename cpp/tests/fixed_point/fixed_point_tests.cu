@@ -514,4 +514,38 @@ TEST_F(FixedPointTest, DecimalXXThrustOnDevice)
   EXPECT_EQ(vec2, vec3);
 }
 
+struct storage_size_fn {
+  template <typename T>
+  cudf::size_type operator()()
+  {
+    static_assert(not cudf::is_fixed_point<T>(), "Fixed-point types dispatch their storage type");
+    return sizeof(T);
+  }
+};
+
+TEST_F(FixedPointTest, DecimalDataType)
+{
+  cudf::data_type const dec32{cudf::type_id::DECIMAL32, -2};
+  cudf::data_type const dec64{cudf::type_id::DECIMAL64, 3};
+
+  EXPECT_EQ(cudf::type_dispatcher(dec32, storage_size_fn{}), 4);
+  EXPECT_EQ(cudf::type_dispatcher(dec64, storage_size_fn{}), 8);
+  EXPECT_EQ(cudf::size_of(dec64), 8u);
+  EXPECT_EQ(cudf::type_to_id<decimal32>(), cudf::type_id::DECIMAL32);
+
+  EXPECT_TRUE(cudf::is_fixed_point(dec32));
+  EXPECT_TRUE(cudf::is_fixed_width(dec32));
+  EXPECT_FALSE(cudf::is_numeric(dec32));
+  EXPECT_FALSE(cudf::is_fixed_point(cudf::data_type{cudf::type_id::INT32}));
+
+  // Types of different scales are different
+  EXPECT_EQ(dec32.scale(), -2);
+  EXPECT_TRUE(dec32 == (cudf::data_type{cudf::type_id::DECIMAL32, -2}));
+  EXPECT_FALSE(dec32 == (cudf::data_type{cudf::type_id::DECIMAL32, -3}));
+
+  auto const col = cudf::make_fixed_point_column(dec32, 10);
+  EXPECT_EQ(col->type(), dec32);
+  EXPECT_THROW(cudf::make_numeric_column(dec32, 10), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+#include <cmath>
+
+namespace cudf {
+namespace test {
+template <typename V>
+struct groupby_approx_count_distinct_test : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST_CASE(groupby_approx_count_distinct_test, cudf::test::FixedWidthTypes);
+
+// Small cardinalities are estimated by linear counting, which is exact until
+// two values of a group share a register
+// clang-format off
+TYPED_TEST(groupby_approx_count_distinct_test, basic)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::APPROX_COUNT_DISTINCT>;
+
+    fixed_width_column_wrapper<K> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V, int32_t> vals(
+            {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2, 3 };
+    fixed_width_column_wrapper<R> expect_vals { 3, 4, 3 };
+    fixed_width_column_wrapper<R> expect_bool_vals { 2, 1, 1 };
+
+    auto const& expect = std::is_same<V, bool>() ? expect_bool_vals : expect_vals;
+    auto agg = cudf::make_approx_count_distinct_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect, agg->clone());
+    test_single_agg(keys, vals, expect_keys, expect, std::move(agg), force_use_sort_impl::YES);
+}
+
+TYPED_TEST(groupby_approx_count_distinct_test, null_keys_and_values)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::APPROX_COUNT_DISTINCT>;
+
+    fixed_width_column_wrapper<K> keys({ 1, 2, 3, 3, 1, 2, 2, 1, 3, 3, 2, 4, 4, 2},
+                                       { 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1});
+    fixed_width_column_wrapper<V, int32_t> vals({0, 1, 2, 2, 3, 4, 5, 6, 7, 8, 9, 4, 4, 2},
+                                                {0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0});
+
+                                          //  { 1, 1,     2, 2, 2,    3, 3,    4}
+    fixed_width_column_wrapper<K> expect_keys({ 1,        2,          3,       4}, all_valid());
+                                          //  { 3, 6,     1, 4, 9,    2, 8,    -}
+    fixed_width_column_wrapper<R> expect_vals { 2,        3,          2,       0};
+    fixed_width_column_wrapper<R> expect_bool_vals { 1, 1, 1, 0};
+
+    auto const& expect = std::is_same<V, bool>() ? expect_bool_vals : expect_vals;
+    auto agg = cudf::make_approx_count_distinct_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect, std::move(agg));
+}
+
+TYPED_TEST(groupby_approx_count_distinct_test, sorted_keys)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::APPROX_COUNT_DISTINCT>;
+
+    fixed_width_column_wrapper<K> keys { 1, 1, 1, 2, 2, 2, 2, 3, 3, 3};
+    fixed_width_column_wrapper<V, int32_t> vals(
+            {0, 3, 3, 1, 4, 5, 9, 2, 7, 8});
+
+    fixed_width_column_wrapper<K> expect_keys { 1, 2, 3 };
+    fixed_width_column_wrapper<R> expect_vals { 2, 4, 3 };
+    fixed_width_column_wrapper<R> expect_bool_vals { 2, 1, 1 };
+
+    auto const& expect = std::is_same<V, bool>() ? expect_bool_vals : expect_vals;
+    auto agg = cudf::make_approx_count_distinct_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect, std::move(agg),
+                    force_use_sort_impl::NO, null_policy::EXCLUDE, sorted::YES);
+}
+// clang-format on
+
+struct groupby_approx_count_distinct_error_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_approx_count_distinct_error_test, relative_error)
+{
+  constexpr size_type num_rows{1 << 20};
+  constexpr size_type num_groups{4};
+  auto keys_iter = make_counting_transform_iterator(0, [](auto i) { return i % num_groups; });
+  // Group g holds (g + 1) * 25000 distinct values
+  auto vals_iter = make_counting_transform_iterator(0, [](auto i) {
+    auto const num_distinct = (i % num_groups + 1) * 25000;
+    return static_cast<int64_t>((i / num_groups) % num_distinct);
+  });
+  fixed_width_column_wrapper<int32_t> keys(keys_iter, keys_iter + num_rows);
+  fixed_width_column_wrapper<int64_t> vals(vals_iter, vals_iter + num_rows);
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(make_approx_count_distinct_aggregation());
+  auto const result = groupby::groupby(table_view({keys})).aggregate(requests);
+
+  auto const sort_order  = sorted_order(result.first->view());
+  auto const estimates   = gather(table_view({result.second[0].results[0]->view()}), *sort_order);
+  auto const h_estimates = to_host<int64_t>(estimates->get_column(0)).first;
+  // Four times the relative standard error of the estimate
+  auto const tolerance = 4 * 1.04 / std::sqrt(double(1 << 14));
+  for (size_type g = 0; g < num_groups; g++) {
+    auto const expected = (g + 1) * 25000;
+    EXPECT_NEAR(h_estimates[g], expected, tolerance * expected);
+  }
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/detail/aggregation/aggregation.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace test {
+template <typename V>
+struct groupby_approx_quantile_test : public cudf::test::BaseFixture {
+};
+
+using supported_types = cudf::test::Types<int8_t, int16_t, int32_t, int64_t, float, double>;
+
+TYPED_TEST_CASE(groupby_approx_quantile_test, supported_types);
+
+// Groups smaller than the compression keep every value as a centroid of its
+// own, which makes medians and extremes exact
+// clang-format off
+TYPED_TEST(groupby_approx_quantile_test, basic)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::APPROX_QUANTILE>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+                                          //  { 1, 1, 1, 2, 2, 2, 2, 3, 3, 3}
+    fixed_width_column_wrapper<K> expect_keys { 1,       2,          3      };
+                                          //  { 0, 3, 6, 1, 4, 5, 9, 2, 7, 8}
+    fixed_width_column_wrapper<R> expect_vals({   3.,        4.5,      7.   }, all_valid());
+
+    auto agg = cudf::make_approx_quantile_aggregation({0.5});
+    test_single_agg(keys, vals, expect_keys, expect_vals, agg->clone());
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg),
+        force_use_sort_impl::YES);
+}
+
+TYPED_TEST(groupby_approx_quantile_test, null_keys_and_values)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::APPROX_QUANTILE>;
+
+    fixed_width_column_wrapper<K> keys(       { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4},
+                                              { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1});
+    fixed_width_column_wrapper<V> vals(       { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4},
+                                              { 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0});
+
+                                          //  { 1, 1,     2, 2, 2,   3, 3,    4}
+    fixed_width_column_wrapper<K> expect_keys({ 1,        2,         3,       4}, all_valid());
+                                          //  { 3, 6,     1, 4, 9,   2, 8,    -}
+    fixed_width_column_wrapper<R> expect_vals({  4.5,       4.,       5.,    0.},
+                                              {   1,         1,        1,     0});
+
+    auto agg = cudf::make_approx_quantile_aggregation({0.5});
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_approx_quantile_test, multiple_quantile)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::APPROX_QUANTILE>;
+
+    fixed_width_column_wrapper<K> keys        { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+                                          //  { 1, 1, 1, 2, 2, 2, 2, 3, 3, 3}
+    fixed_width_column_wrapper<K> expect_keys { 1,          2,          3       };
+                                          //  { 0, 3, 6, 1, 4, 5, 9, 2, 7, 8}
+    fixed_width_column_wrapper<R> expect_vals({ 0., 3., 6., 1., 4.5, 9., 2., 7., 8.}, all_valid());
+
+    auto agg = cudf::make_approx_quantile_aggregation({0., 0.5, 1.});
+    test_single_agg(keys, vals, expect_keys, expect_vals, agg->clone());
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg),
+        force_use_sort_impl::YES);
+}
+// clang-format on
+
+struct groupby_approx_quantile_error_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_approx_quantile_error_test, rank_error)
+{
+  constexpr size_type num_rows{1 << 20};
+  constexpr size_type num_groups{4};
+  constexpr size_type group_size{num_rows / num_groups};
+  auto keys_iter = make_counting_transform_iterator(0, [](auto i) { return i % num_groups; });
+  // Every group holds a permutation of [0, group_size)
+  auto vals_iter = make_counting_transform_iterator(0, [](auto i) {
+    return static_cast<double>((int64_t{i / num_groups} * 48271) % group_size);
+  });
+  fixed_width_column_wrapper<int32_t> keys(keys_iter, keys_iter + num_rows);
+  fixed_width_column_wrapper<double> vals(vals_iter, vals_iter + num_rows);
+
+  std::vector<double> const q{0.01, 0.5, 0.95, 0.99};
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(make_approx_quantile_aggregation(q));
+  auto const result = groupby::groupby(table_view({keys})).aggregate(requests);
+
+  auto const h_keys      = to_host<int32_t>(result.first->get_column(0)).first;
+  auto const h_quantiles = to_host<double>(*result.second[0].results[0]).first;
+  ASSERT_EQ(h_keys.size(), static_cast<size_t>(num_groups));
+  for (size_type g = 0; g < num_groups; g++) {
+    for (size_t i = 0; i < q.size(); i++) {
+      auto const rank = h_quantiles[g * q.size() + i] / group_size;
+      EXPECT_NEAR(rank, q[i], 0.001 + 0.01 * std::min(q[i], 1 - q[i]));
+    }
+  }
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+namespace cudf {
+namespace test {
+
+template <typename V>
+struct groupby_collect_test : public cudf::test::BaseFixture {
+};
+
+using collect_types = cudf::test::Types<int8_t, int32_t, int64_t, float, double>;
+
+TYPED_TEST_CASE(groupby_collect_test, collect_types);
+
+// clang-format off
+TYPED_TEST(groupby_collect_test, basic)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<V> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  lists_column_wrapper<V> expect_vals{{0, 3, 6}, {1, 4, 5, 9}, {2, 7, 8}};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, make_collect_aggregation());
+  test_single_agg(keys, vals, expect_keys, expect_vals, make_collect_aggregation(),
+                  force_use_sort_impl::YES);
+}
+
+TYPED_TEST(groupby_collect_test, with_nulls)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  fixed_width_column_wrapper<K> keys({1, 2, 3, 1, 2, 2, 1, 3, 3, 2},
+                                     {1, 1, 1, 1, 1, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<V> vals({0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                     {1, 0, 1, 1, 1, 1, 0, 1, 1, 1});
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  // Null values are collected; rows of null keys are not
+  auto validity = make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+  auto first    = make_counting_transform_iterator(0, [](auto i) { return i != 0; });
+  lists_column_wrapper<V> expect_vals{{{0, 3, 6}, validity}, {{1, 4, 5, 9}, first}, {2, 8}};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, make_collect_aggregation());
+}
+// clang-format on
+
+struct groupby_collect_string_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_collect_string_test, basic)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 2, 3};
+  strings_column_wrapper vals{"a", "b", "c", "d", "e"};
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  lists_column_wrapper<cudf::string_view> expect_vals{{"a", "c"}, {"b", "d"}, {"e"}};
+
+  test_single_agg(keys, vals, expect_keys, expect_vals, make_collect_aggregation());
+}
+
+}  // namespace test
+}  // namespace cudf
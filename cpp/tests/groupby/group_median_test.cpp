@@ -119,6 +119,47 @@ TYPED_TEST(groupby_median_test, null_keys_and_values)
     auto agg = cudf::make_median_aggregation();
     test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
 }
+
+TYPED_TEST(groupby_median_test, with_hash_aggregations)
+{
+    using K = int32_t;
+    using V = TypeParam;
+    using R = cudf::detail::target_type_t<V, aggregation::MEDIAN>;
+    using S = cudf::detail::target_type_t<V, aggregation::SUM>;
+    using N = cudf::detail::target_type_t<V, aggregation::NUNIQUE>;
+
+    fixed_width_column_wrapper<K> keys      ( { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4},
+                                              { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0});
+    fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5, 3, 7, 7, 9, 4};
+
+                                          //  { 1, 1, 1, 2, 2, 2, 2, 3, 3, 3}
+    fixed_width_column_wrapper<K> expect_keys { 1,       2,          3      };
+                                          //  { 0, 3, 3, 1, 4, 5, 9, 2, 7, 7}
+    fixed_width_column_wrapper<S> expect_sums     { 6,       19,         16     };
+    fixed_width_column_wrapper<R> expect_medians({  3.,      4.5,        7.     }, all_valid());
+    fixed_width_column_wrapper<N> expect_nuniques { 2,       4,          2      };
+
+    // MEDIAN needs the sort based groupby, SUM and NUNIQUE are computed with a
+    // hash based groupby over its group labels
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+    requests[0].aggregations.push_back(cudf::make_median_aggregation());
+    requests[0].aggregations.push_back(cudf::make_nunique_aggregation());
+
+    groupby::groupby gb_obj(table_view({keys}));
+    auto result = gb_obj.aggregate(requests);
+
+    auto const sort_order = sorted_order(result.first->view());
+    expect_tables_equal(table_view({expect_keys}), *gather(result.first->view(), *sort_order));
+    auto const sorted_vals = gather(table_view({result.second[0].results[0]->view(),
+                                                result.second[0].results[1]->view(),
+                                                result.second[0].results[2]->view()}),
+                                    *sort_order);
+    expect_columns_equivalent(expect_sums, sorted_vals->get_column(0), true);
+    expect_columns_equivalent(expect_medians, sorted_vals->get_column(1), true);
+    expect_columns_equivalent(expect_nuniques, sorted_vals->get_column(2), true);
+}
 // clang-format on
 
 }  // namespace test
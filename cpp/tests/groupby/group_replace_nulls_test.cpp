@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/groupby.hpp>
+#include <cudf/replace.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_replace_nulls_test : public cudf::test::BaseFixture {
+};
+
+// clang-format off
+TEST_F(groupby_replace_nulls_test, preceding_and_following)
+{
+    fixed_width_column_wrapper<int32_t> keys  { 1, 2, 1, 2, 1, 1, 2};
+    fixed_width_column_wrapper<double>  vals ({ 3, 0, 0, 9, 0, 5, 0},
+                                              { 1, 0, 0, 1, 0, 1, 0});
+    groupby::groupby gb(table_view{{keys}});
+
+    //                                               key 1: {0, 2, 4, 5}  2: {1, 3, 6}
+    fixed_width_column_wrapper<int32_t> expect_keys       { 1, 1, 1, 1,     2, 2, 2};
+    fixed_width_column_wrapper<double>  expect_preceding ({ 3, 3, 3, 5,     0, 9, 9},
+                                                          { 1, 1, 1, 1,     0, 1, 1});
+    fixed_width_column_wrapper<double>  expect_following ({ 3, 5, 5, 5,     9, 9, 0},
+                                                          { 1, 1, 1, 1,     1, 1, 0});
+
+    auto preceding = gb.replace_nulls(vals, replace_policy::PRECEDING);
+    expect_tables_equal(table_view{{expect_keys}}, preceding.first->view());
+    expect_columns_equal(expect_preceding, *preceding.second);
+
+    auto following = gb.replace_nulls(vals, replace_policy::FOLLOWING);
+    expect_tables_equal(table_view{{expect_keys}}, following.first->view());
+    expect_columns_equal(expect_following, *following.second);
+}
+
+TEST_F(groupby_replace_nulls_test, null_keys)
+{
+    fixed_width_column_wrapper<int32_t> keys ({ 1, 1, 1, 1},
+                                              { 1, 0, 1, 1});
+    fixed_width_column_wrapper<int32_t> vals ({ 1, 2, 0, 0},
+                                              { 1, 1, 0, 0});
+    groupby::groupby gb(table_view{{keys}});
+
+    // The row of the null key is excluded, so it does not fill the rows after it
+    fixed_width_column_wrapper<int32_t> expect_keys  { 1, 1, 1};
+    fixed_width_column_wrapper<int32_t> expect_vals  { 1, 1, 1};
+
+    auto result = gb.replace_nulls(vals, replace_policy::PRECEDING);
+    expect_tables_equal(table_view{{expect_keys}}, result.first->view());
+    expect_columns_equal(expect_vals, *result.second);
+}
+
+TEST_F(groupby_replace_nulls_test, strings)
+{
+    fixed_width_column_wrapper<int32_t> keys  { 1, 2, 1, 2, 1};
+    strings_column_wrapper              vals ({ "a", "", "", "d", ""},
+                                              {   1,  0,  0,   1,  0});
+    groupby::groupby gb(table_view{{keys}});
+
+    fixed_width_column_wrapper<int32_t> expect_keys  { 1, 1, 1, 2, 2};
+    strings_column_wrapper              expect_vals ({ "a", "", "", "d", "d"},
+                                                     {   1,  0,  0,   1,   1});
+
+    auto result = gb.replace_nulls(vals, replace_policy::FOLLOWING);
+    expect_tables_equal(table_view{{expect_keys}}, result.first->view());
+    expect_columns_equal(expect_vals, *result.second);
+}
+// clang-format on
+
+TEST_F(groupby_replace_nulls_test, size_mismatch)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3};
+  fixed_width_column_wrapper<int32_t> vals{1, 2};
+  groupby::groupby gb(table_view{{keys}});
+  EXPECT_THROW(gb.replace_nulls(vals, replace_policy::PRECEDING), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/groupby.hpp>
+
+#include <limits>
+
+namespace cudf {
+namespace test {
+struct groupby_scan_test : public cudf::test::BaseFixture {
+};
+
+namespace {
+void test_single_scan(column_view const& keys,
+                      column_view const& values,
+                      column_view const& expect_keys,
+                      column_view const& expect_vals,
+                      std::unique_ptr<aggregation>&& agg,
+                      scan_type inclusive           = scan_type::INCLUSIVE,
+                      null_policy include_null_keys = null_policy::EXCLUDE)
+{
+  std::vector<groupby::aggregation_request> requests;
+  requests.emplace_back(groupby::aggregation_request());
+  requests[0].values = values;
+  requests[0].aggregations.push_back(std::move(agg));
+
+  groupby::groupby gb(table_view({keys}), include_null_keys);
+  auto result = gb.scan(requests, inclusive);
+
+  expect_tables_equal(table_view({expect_keys}), result.first->view());
+  expect_columns_equal(expect_vals, *result.second[0].results[0], true);
+}
+}  // namespace
+
+// clang-format off
+TEST_F(groupby_scan_test, basic)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 1, 3, 1};
+    fixed_width_column_wrapper<int32_t> vals { 3, 1, 4, 9, 2};
+
+    //                                         key 1: {0, 2, 4}  2: {1}  3: {3}
+    fixed_width_column_wrapper<int32_t> expect_keys { 1, 1, 1,   2,      3};
+    fixed_width_column_wrapper<int64_t> expect_sum  { 3, 7, 9,   1,      9};
+    fixed_width_column_wrapper<int32_t> expect_min  { 3, 3, 2,   1,      9};
+    fixed_width_column_wrapper<int32_t> expect_max  { 3, 4, 4,   1,      9};
+    fixed_width_column_wrapper<size_type> expect_count { 1, 2, 3, 1,     1};
+
+    test_single_scan(keys, vals, expect_keys, expect_sum, make_sum_aggregation());
+    test_single_scan(keys, vals, expect_keys, expect_min, make_min_aggregation());
+    test_single_scan(keys, vals, expect_keys, expect_max, make_max_aggregation());
+    test_single_scan(
+        keys, vals, expect_keys, expect_count, make_count_aggregation(null_policy::INCLUDE));
+}
+
+TEST_F(groupby_scan_test, exclusive)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 1, 3, 1};
+    fixed_width_column_wrapper<double>  vals { 3, 1, 4, 9, 2};
+
+    // The first row of each group gets the identity of the operator
+    auto const lowest = std::numeric_limits<double>::lowest();
+    fixed_width_column_wrapper<int32_t>   expect_keys  {      1, 1, 1,      2,      3};
+    fixed_width_column_wrapper<double>    expect_sum   {      0, 3, 7,      0,      0};
+    fixed_width_column_wrapper<double>    expect_max   { lowest, 3, 4, lowest, lowest};
+    fixed_width_column_wrapper<size_type> expect_count {      0, 1, 2,      0,      0};
+
+    auto const exclusive = scan_type::EXCLUSIVE;
+    test_single_scan(keys, vals, expect_keys, expect_sum, make_sum_aggregation(), exclusive);
+    test_single_scan(keys, vals, expect_keys, expect_max, make_max_aggregation(), exclusive);
+    test_single_scan(keys, vals, expect_keys, expect_count, make_count_aggregation(), exclusive);
+}
+
+TEST_F(groupby_scan_test, null_values)
+{
+    fixed_width_column_wrapper<int32_t> keys  { 1, 2, 1, 3, 1};
+    fixed_width_column_wrapper<int32_t> vals ({ 3, 1, 4, 9, 2},
+                                              { 1, 1, 0, 1, 1});
+
+    fixed_width_column_wrapper<int32_t> expect_keys   { 1, 1, 1, 2, 3};
+    fixed_width_column_wrapper<int64_t> expect_sum   ({ 3, 0, 5, 1, 9},
+                                                      { 1, 0, 1, 1, 1});
+    fixed_width_column_wrapper<size_type> expect_valid  { 1, 1, 2, 1, 1};
+    fixed_width_column_wrapper<size_type> expect_all    { 1, 2, 3, 1, 1};
+
+    test_single_scan(keys, vals, expect_keys, expect_sum, make_sum_aggregation());
+    test_single_scan(keys, vals, expect_keys, expect_valid, make_count_aggregation());
+    test_single_scan(
+        keys, vals, expect_keys, expect_all, make_count_aggregation(null_policy::INCLUDE));
+}
+
+TEST_F(groupby_scan_test, null_keys)
+{
+    fixed_width_column_wrapper<int32_t> keys ({ 1, 2, 1, 2, 1},
+                                              { 1, 0, 1, 1, 1});
+    fixed_width_column_wrapper<int32_t> vals  { 1, 2, 3, 4, 5};
+
+    fixed_width_column_wrapper<int32_t> expect_keys_excluded { 1, 1, 1, 2};
+    fixed_width_column_wrapper<int64_t> expect_sum_excluded  { 1, 4, 9, 4};
+    test_single_scan(keys, vals, expect_keys_excluded, expect_sum_excluded, make_sum_aggregation());
+
+    fixed_width_column_wrapper<int32_t> expect_keys_included ({ 1, 1, 1, 2, 2},
+                                                              { 1, 1, 1, 1, 0});
+    fixed_width_column_wrapper<int64_t> expect_sum_included   { 1, 4, 9, 4, 2};
+    test_single_scan(keys,
+                     vals,
+                     expect_keys_included,
+                     expect_sum_included,
+                     make_sum_aggregation(),
+                     scan_type::INCLUSIVE,
+                     null_policy::INCLUDE);
+}
+
+TEST_F(groupby_scan_test, rank)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 1, 1, 2, 1};
+    fixed_width_column_wrapper<int64_t> vals { 5, 7, 5, 6, 7, 8};
+
+    //                                           key 1: {0, 2, 3, 5}  2: {1, 4}
+    fixed_width_column_wrapper<int32_t> expect_keys   { 1, 1, 1, 1,    2, 2};
+    fixed_width_column_wrapper<size_type> expect_rank { 1, 1, 3, 4,    1, 1};
+
+    test_single_scan(keys, vals, expect_keys, expect_rank, make_rank_aggregation());
+    test_single_scan(
+        keys, vals, expect_keys, expect_rank, make_rank_aggregation(), scan_type::EXCLUSIVE);
+}
+
+TEST_F(groupby_scan_test, rank_strings_with_nulls)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 1, 1, 1, 1};
+    strings_column_wrapper              vals ({ "a", "a", "", "", "b"},
+                                              {   1,   1,  0,  0,   1});
+
+    fixed_width_column_wrapper<int32_t> expect_keys   { 1, 1, 1, 1, 1};
+    fixed_width_column_wrapper<size_type> expect_rank { 1, 1, 3, 3, 5};
+
+    test_single_scan(keys, vals, expect_keys, expect_rank, make_rank_aggregation());
+}
+// clang-format on
+
+TEST_F(groupby_scan_test, empty)
+{
+  fixed_width_column_wrapper<int32_t> keys{};
+  fixed_width_column_wrapper<int32_t> vals{};
+  fixed_width_column_wrapper<int64_t> expect_sum{};
+
+  test_single_scan(keys, vals, keys, expect_sum, make_sum_aggregation());
+}
+
+TEST_F(groupby_scan_test, errors)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3};
+  strings_column_wrapper strings{"a", "b", "c"};
+  fixed_width_column_wrapper<int32_t> short_vals{1, 2};
+  fixed_width_column_wrapper<int32_t> vals{1, 2, 3};
+  groupby::groupby gb(table_view{{keys}});
+
+  auto make_requests = [](column_view const& values, std::unique_ptr<aggregation>&& agg) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = values;
+    requests[0].aggregations.push_back(std::move(agg));
+    return requests;
+  };
+  EXPECT_THROW(gb.scan(make_requests(short_vals, make_sum_aggregation())), logic_error);
+  EXPECT_THROW(gb.scan(make_requests(strings, make_sum_aggregation())), logic_error);
+  EXPECT_THROW(gb.scan(make_requests(vals, make_mean_aggregation())), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
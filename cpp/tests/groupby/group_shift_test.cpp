@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/groupby.hpp>
+#include <cudf/scalar/scalar.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_shift_test : public cudf::test::BaseFixture {
+};
+
+// clang-format off
+TEST_F(groupby_shift_test, forward_and_backward)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 1, 2, 1};
+    fixed_width_column_wrapper<int64_t> vals { 3, 1, 4, 9, 2};
+    numeric_scalar<int64_t> fill(0);
+    groupby::groupby gb(table_view{{keys}});
+
+    //                                               key 1: {0, 2, 4}  2: {1, 3}
+    fixed_width_column_wrapper<int32_t> expect_keys     { 1, 1, 1,       2, 2};
+    fixed_width_column_wrapper<int64_t> expect_forward  { 0, 3, 4,       0, 1};
+    fixed_width_column_wrapper<int64_t> expect_backward { 4, 2, 0,       9, 0};
+
+    auto forward = gb.shift(vals, 1, fill);
+    expect_tables_equal(table_view{{expect_keys}}, forward.first->view());
+    expect_columns_equal(expect_forward, *forward.second);
+
+    auto backward = gb.shift(vals, -1, fill);
+    expect_tables_equal(table_view{{expect_keys}}, backward.first->view());
+    expect_columns_equal(expect_backward, *backward.second);
+}
+
+TEST_F(groupby_shift_test, null_fill_and_null_values)
+{
+    fixed_width_column_wrapper<int32_t> keys  ({ 1, 2, 1, 2, 1, 1},
+                                               { 1, 1, 1, 1, 0, 1});
+    fixed_width_column_wrapper<int32_t> vals  ({ 3, 1, 4, 9, 2, 5},
+                                               { 1, 1, 0, 1, 1, 1});
+    numeric_scalar<int32_t> fill(0, false);
+    groupby::groupby gb(table_view{{keys}});
+
+    //                                             key 1: {0, 2, 5}  2: {1, 3}
+    fixed_width_column_wrapper<int32_t> expect_keys  { 1, 1, 1,       2, 2};
+    fixed_width_column_wrapper<int32_t> expect_vals ({ 0, 0, 3,       0, 0},
+                                                     { 0, 0, 1,       0, 0});
+
+    auto result = gb.shift(vals, 2, fill);
+    expect_tables_equal(table_view{{expect_keys}}, result.first->view());
+    expect_columns_equal(expect_vals, *result.second);
+}
+
+TEST_F(groupby_shift_test, strings)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 1, 2, 1};
+    strings_column_wrapper              vals { "a", "b", "c", "d", "e"};
+    string_scalar fill("z");
+    groupby::groupby gb(table_view{{keys}});
+
+    fixed_width_column_wrapper<int32_t> expect_keys { 1, 1, 1, 2, 2};
+    strings_column_wrapper              expect_vals { "z", "a", "c", "z", "b"};
+
+    auto result = gb.shift(vals, 1, fill);
+    expect_tables_equal(table_view{{expect_keys}}, result.first->view());
+    expect_columns_equal(expect_vals, *result.second);
+}
+
+TEST_F(groupby_shift_test, offset_beyond_groups)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 1, 2, 1};
+    fixed_width_column_wrapper<float>   vals { 3, 1, 4, 9, 2};
+    numeric_scalar<float> fill(7);
+    groupby::groupby gb(table_view{{keys}});
+
+    fixed_width_column_wrapper<float> expect_vals { 7, 7, 7, 7, 7};
+    expect_columns_equal(expect_vals, *gb.shift(vals, 3, fill).second);
+    expect_columns_equal(expect_vals, *gb.shift(vals, -5, fill).second);
+}
+// clang-format on
+
+TEST_F(groupby_shift_test, errors)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3};
+  fixed_width_column_wrapper<int32_t> short_vals{1, 2};
+  fixed_width_column_wrapper<int32_t> vals{1, 2, 3};
+  numeric_scalar<int32_t> fill(0);
+  numeric_scalar<int64_t> wrong_fill(0);
+  groupby::groupby gb(table_view{{keys}});
+
+  EXPECT_THROW(gb.shift(short_vals, 1, fill), logic_error);
+  EXPECT_THROW(gb.shift(vals, 1, wrong_fill), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
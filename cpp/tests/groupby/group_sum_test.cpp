@@ -134,5 +134,58 @@ TYPED_TEST(groupby_sum_test, null_keys_and_values)
 }
 // clang-format on
 
+TYPED_TEST(groupby_sum_test, many_rows_few_keys)
+{
+  using K = int32_t;
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // Enough rows for every key to repeat across many thread blocks
+  cudf::size_type constexpr num_rows{100000};
+  cudf::size_type constexpr num_keys{5};
+  auto key_iter   = make_counting_transform_iterator(0, [](auto i) { return i % num_keys; });
+  auto val_iter   = make_counting_transform_iterator(0, [](auto i) { return V(i % 11); });
+  auto valid_iter = make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+
+  fixed_width_column_wrapper<K> keys(key_iter, key_iter + num_rows);
+  fixed_width_column_wrapper<V> vals(val_iter, val_iter + num_rows, valid_iter);
+
+  std::vector<R> expect_sums(num_keys, R{0});
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    if (valid_iter[i]) { expect_sums[key_iter[i]] += static_cast<R>(val_iter[i]); }
+  }
+  auto expect_key_iter = thrust::make_counting_iterator<K>(0);
+  fixed_width_column_wrapper<K> expect_keys(expect_key_iter, expect_key_iter + num_keys);
+  fixed_width_column_wrapper<R> expect_vals(expect_sums.begin(), expect_sums.end());
+
+  auto agg = cudf::make_sum_aggregation();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+  auto agg2 = cudf::make_sum_aggregation();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
+struct groupby_sum_fixed_point_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_sum_fixed_point_test, decimal32)
+{
+    using K = int32_t;
+    auto const scale = numeric::scale_type{-2};
+
+    fixed_width_column_wrapper<K> keys        { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_point_column_wrapper<int32_t> vals  {{101, 250, 3, -4, 400, 5, 6, 700, 8, 9}, scale};
+
+    // Sums of DECIMAL32 values are DECIMAL64 values of the same scale
+    fixed_width_column_wrapper<K> expect_keys { 1, 2, 3 };
+    fixed_point_column_wrapper<int64_t> expect_vals {{103, 664, 711}, scale};
+
+    auto agg = cudf::make_sum_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+    auto agg2 = cudf::make_sum_aggregation();
+    test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
 }  // namespace test
 }  // namespace cudf
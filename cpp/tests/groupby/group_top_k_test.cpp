@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/groupby.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_top_k_test : public cudf::test::BaseFixture {
+};
+
+// clang-format off
+TEST_F(groupby_top_k_test, basic)
+{
+    fixed_width_column_wrapper<int32_t> keys { 1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+    fixed_width_column_wrapper<float>   vals { 5, 1, 2, 3, 4, 1, 6, 7, 8, 9};
+
+    groupby::groupby gb(table_view{{keys}});
+
+    //                                           key 1: {0, 3, 6}  2: {1, 4, 5, 9}  3: {2, 7, 8}
+    fixed_width_column_wrapper<int32_t> expect_asc  { 3, 0,         1, 5,            2, 7};
+    expect_columns_equal(expect_asc, gb.top_k(table_view{{vals}}, 2)->view());
+
+    fixed_width_column_wrapper<int32_t> expect_desc { 6,            9,               8};
+    expect_columns_equal(expect_desc, gb.top_k(table_view{{vals}}, 1, {order::DESCENDING})->view());
+
+    fixed_width_column_wrapper<int32_t> expect_all  { 3, 0, 6,      1, 5, 4, 9,      2, 7, 8};
+    expect_columns_equal(expect_all, gb.top_k(table_view{{vals}}, 5)->view());
+
+    fixed_width_column_wrapper<int32_t> expect_none {};
+    expect_columns_equal(expect_none, gb.top_k(table_view{{vals}}, 0)->view());
+}
+
+TEST_F(groupby_top_k_test, null_keys_and_values)
+{
+    fixed_width_column_wrapper<int32_t> keys({ 1, 2, 3, 1, 2, 2, 1, 3},
+                                             { 1, 1, 0, 1, 1, 1, 1, 1});
+    fixed_width_column_wrapper<int64_t> vals({ 5, 1, 2, 3, 4, 1, 6, 7},
+                                             { 1, 0, 1, 1, 1, 1, 0, 1});
+
+    //                                            key 1: {0, 3, 6}  2: {1, 4, 5}  3: {7}
+    fixed_width_column_wrapper<int32_t> expect_excluded { 6, 3,      1, 5,         7};
+    groupby::groupby gb(table_view{{keys}});
+    expect_columns_equal(expect_excluded, gb.top_k(table_view{{vals}}, 2)->view());
+
+    //                                                  key 1        2            3      null
+    fixed_width_column_wrapper<int32_t> expect_included { 3, 0,      5, 4,         7,     2};
+    groupby::groupby gb_nulls(table_view{{keys}}, null_policy::INCLUDE);
+    expect_columns_equal(
+        expect_included,
+        gb_nulls.top_k(table_view{{vals}}, 2, {order::ASCENDING}, {null_order::AFTER})->view());
+}
+// clang-format on
+
+TEST_F(groupby_top_k_test, mismatched_rows)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3};
+  fixed_width_column_wrapper<int32_t> vals{1, 2};
+  groupby::groupby gb(table_view{{keys}});
+  EXPECT_THROW(gb.top_k(table_view{{vals}}, 1), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/aggregation.hpp>
+
+namespace cudf {
+namespace test {
+
+struct groupby_udf_test : public cudf::test::BaseFixture {
+  const std::string cuda_func{
+    R"***(
+      template <typename OutType, typename InType>
+      __device__ void CUDA_GENERIC_AGGREGATOR(OutType *ret, InType *in_col, cudf::size_type start,
+                                              cudf::size_type count) {
+        OutType val = 0;
+        for (cudf::size_type i = 0; i < count; i++) {
+          val += in_col[start + i];
+        }
+        *ret = val;
+      }
+    )***"};
+};
+
+// clang-format off
+TEST_F(groupby_udf_test, cuda_sum)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  fixed_width_column_wrapper<int64_t> expect_vals{9, 19, 17};
+
+  auto agg = make_udf_aggregation(udf_type::CUDA, this->cuda_func, data_type{type_id::INT64});
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TEST_F(groupby_udf_test, uneven_groups)
+{
+  // One large group and many single row groups
+  std::vector<int32_t> h_keys(1000);
+  std::vector<int32_t> h_vals(1000, 1);
+  for (size_t i = 0; i < h_keys.size(); ++i) { h_keys[i] = i < 900 ? 0 : i; }
+  fixed_width_column_wrapper<int32_t> keys(h_keys.begin(), h_keys.end());
+  fixed_width_column_wrapper<int32_t> vals(h_vals.begin(), h_vals.end());
+
+  std::vector<int32_t> h_expect_keys{0};
+  std::vector<int64_t> h_expect_vals{900};
+  for (int32_t i = 900; i < 1000; ++i) {
+    h_expect_keys.push_back(i);
+    h_expect_vals.push_back(1);
+  }
+  fixed_width_column_wrapper<int32_t> expect_keys(h_expect_keys.begin(), h_expect_keys.end());
+  fixed_width_column_wrapper<int64_t> expect_vals(h_expect_vals.begin(), h_expect_vals.end());
+
+  auto agg = make_udf_aggregation(udf_type::CUDA, this->cuda_func, data_type{type_id::INT64});
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TEST_F(groupby_udf_test, empty_cols)
+{
+  fixed_width_column_wrapper<int32_t> keys{};
+  fixed_width_column_wrapper<int32_t> vals{};
+
+  fixed_width_column_wrapper<int32_t> expect_keys{};
+  fixed_width_column_wrapper<int64_t> expect_vals{};
+
+  auto agg = make_udf_aggregation(udf_type::CUDA, this->cuda_func, data_type{type_id::INT64});
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TEST_F(groupby_udf_test, nulls_not_supported)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1};
+  fixed_width_column_wrapper<int32_t> vals({0, 1, 2}, {1, 0, 1});
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  fixed_width_column_wrapper<int64_t> expect_vals{2, 0};
+
+  auto agg = make_udf_aggregation(udf_type::CUDA, this->cuda_func, data_type{type_id::INT64});
+  EXPECT_THROW(test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg)),
+               cudf::logic_error);
+}
+// clang-format on
+
+}  // namespace test
+}  // namespace cudf
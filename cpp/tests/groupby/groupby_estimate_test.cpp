@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/groupby.hpp>
+#include <cudf/types.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+namespace cudf {
+namespace test {
+struct groupby_estimate_test : public BaseFixture {
+  groupby::aggregation_request make_request(std::unique_ptr<aggregation>&& agg)
+  {
+    groupby::aggregation_request request;
+    request.values = vals;
+    request.aggregations.push_back(std::move(agg));
+    return request;
+  }
+
+  static auto key_begin()
+  {
+    return thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                           [](int32_t i) { return i % 10; });
+  }
+
+  // 1000 rows in 10 groups
+  fixed_width_column_wrapper<int32_t> keys{key_begin(), key_begin() + 1000};
+  fixed_width_column_wrapper<int32_t> vals{thrust::make_counting_iterator(0),
+                                           thrust::make_counting_iterator(1000)};
+};
+
+TEST_F(groupby_estimate_test, hash)
+{
+  groupby::groupby gb(table_view{{keys}});
+  std::vector<groupby::aggregation_request> requests;
+  requests.push_back(make_request(make_sum_aggregation()));
+
+  // The keys and the INT64 sums of the 10 groups
+  auto const estimate = gb.estimate_memory(requests, 10);
+  EXPECT_EQ(estimate.output_bytes, 10 * sizeof(int32_t) + 10 * sizeof(int64_t));
+  // The hash map and the sparse sums have a row per input row
+  EXPECT_GT(estimate.scratch_bytes, 1000 * (sizeof(size_type) + sizeof(int64_t)));
+
+  // The sample of the keys finds the 10 groups
+  auto const sampled = gb.estimate_memory(requests);
+  EXPECT_EQ(sampled.output_bytes, estimate.output_bytes);
+  EXPECT_EQ(sampled.scratch_bytes, estimate.scratch_bytes);
+
+  auto const result = gb.aggregate(requests);
+  EXPECT_EQ(result.first->num_rows(), 10);
+}
+
+TEST_F(groupby_estimate_test, sort)
+{
+  groupby::groupby gb(table_view{{keys}});
+  std::vector<groupby::aggregation_request> requests;
+  requests.push_back(make_request(make_median_aggregation()));
+
+  // The keys and the FLOAT64 medians of the 10 groups
+  auto const estimate = gb.estimate_memory(requests, 10);
+  EXPECT_EQ(estimate.output_bytes, 10 * sizeof(int32_t) + 10 * sizeof(double));
+  // The sorted order, the group labels and the sorted values
+  EXPECT_GT(estimate.scratch_bytes, 1000 * (2 * sizeof(size_type) + sizeof(int32_t)));
+}
+
+TEST_F(groupby_estimate_test, size_mismatch)
+{
+  groupby::groupby gb(table_view{{keys}});
+  fixed_width_column_wrapper<int32_t> short_vals{1, 2, 3};
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = short_vals;
+  requests[0].aggregations.push_back(make_sum_aggregation());
+  EXPECT_THROW(gb.estimate_memory(requests), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
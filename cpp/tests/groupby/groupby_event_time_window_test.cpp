@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_event_time_window_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_event_time_window_test, emits_closed_windows)
+{
+  groupby::event_time_window_groupby windows(duration_scalar<duration_s>{duration_s{60}});
+
+  // Watermarks before the first update close nothing
+  auto const empty = windows.advance_watermark(timestamp_scalar<timestamp_s>{timestamp_s{0}});
+  EXPECT_EQ(empty.first->num_columns(), 0);
+
+  fixed_width_column_wrapper<timestamp_s> times_0({5, 50, 61, 130, 0}, {1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<int32_t> keys_0{1, 1, 1, 2, 1};
+  fixed_width_column_wrapper<int32_t> vals_0{1, 2, 3, 4, 100};
+  EXPECT_EQ(windows.update(times_0, table_view{{keys_0}}, make_sum_requests(vals_0)), 0);
+  EXPECT_EQ(windows.num_open_groups(), 3);
+
+  auto const first = windows.advance_watermark(timestamp_scalar<timestamp_s>{timestamp_s{120}});
+  fixed_width_column_wrapper<timestamp_s> expect_windows_0{0, 60};
+  fixed_width_column_wrapper<int32_t> expect_keys_0{1, 1};
+  fixed_width_column_wrapper<int64_t> expect_sums_0{3, 3};
+  expect_tables_equal(table_view{{expect_windows_0, expect_keys_0, expect_sums_0}},
+                      sorted_by_keys(first)->view());
+  EXPECT_EQ(windows.num_open_groups(), 1);
+
+  // The event at 30 is in a closed window
+  fixed_width_column_wrapper<timestamp_s> times_1{30, 125};
+  fixed_width_column_wrapper<int32_t> keys_1{1, 2};
+  fixed_width_column_wrapper<int32_t> vals_1{5, 6};
+  EXPECT_EQ(windows.update(times_1, table_view{{keys_1}}, make_sum_requests(vals_1)), 1);
+
+  // A watermark does not move back
+  auto const none = windows.advance_watermark(timestamp_scalar<timestamp_s>{timestamp_s{60}});
+  EXPECT_EQ(none.first->num_rows(), 0);
+
+  auto const second = windows.advance_watermark(timestamp_scalar<timestamp_s>{timestamp_s{180}});
+  fixed_width_column_wrapper<timestamp_s> expect_windows_1{120};
+  fixed_width_column_wrapper<int32_t> expect_keys_1{2};
+  fixed_width_column_wrapper<int64_t> expect_sums_1{10};
+  expect_tables_equal(table_view{{expect_windows_1, expect_keys_1, expect_sums_1}},
+                      sorted_by_keys(second)->view());
+  EXPECT_EQ(windows.num_open_groups(), 0);
+}
+
+TEST_F(groupby_event_time_window_test, no_keys)
+{
+  groupby::event_time_window_groupby windows(duration_scalar<duration_ms>{duration_ms{1000}});
+
+  fixed_width_column_wrapper<timestamp_ms> times_0{-500, 200, 1500};
+  fixed_width_column_wrapper<double> vals_0{1, 2, 3};
+  windows.update(times_0, table_view{}, make_sum_requests(vals_0));
+  fixed_width_column_wrapper<timestamp_ms> times_1{900, 1999};
+  fixed_width_column_wrapper<double> vals_1{4, 5};
+  windows.update(times_1, table_view{}, make_sum_requests(vals_1));
+
+  auto const result = windows.advance_watermark(timestamp_scalar<timestamp_ms>{timestamp_ms{1000}});
+  fixed_width_column_wrapper<timestamp_ms> expect_windows{-1000, 0};
+  fixed_width_column_wrapper<double> expect_sums{1, 6};
+  expect_tables_equal(table_view{{expect_windows, expect_sums}}, sorted_by_keys(result)->view());
+  EXPECT_EQ(windows.num_open_groups(), 1);
+}
+
+TEST_F(groupby_event_time_window_test, invalid_inputs)
+{
+  EXPECT_THROW(groupby::event_time_window_groupby(numeric_scalar<int64_t>{60}),
+               cudf::logic_error);
+  EXPECT_THROW(groupby::event_time_window_groupby(duration_scalar<duration_s>{duration_s{0}}),
+               cudf::logic_error);
+
+  groupby::event_time_window_groupby windows(duration_scalar<duration_s>{duration_s{60}});
+  fixed_width_column_wrapper<timestamp_ms> times_ms{5, 50};
+  fixed_width_column_wrapper<int32_t> vals{1, 2};
+  EXPECT_THROW(windows.update(times_ms, table_view{}, make_sum_requests(vals)),
+               cudf::logic_error);
+  EXPECT_THROW(windows.advance_watermark(timestamp_scalar<timestamp_ms>{timestamp_ms{5}}),
+               cudf::logic_error);
+  EXPECT_THROW(windows.advance_watermark(numeric_scalar<int64_t>{5}), cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
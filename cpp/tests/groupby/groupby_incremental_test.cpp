@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_incremental_test : public cudf::test::BaseFixture {
+};
+
+namespace {
+std::vector<std::unique_ptr<aggregation>> make_aggregations()
+{
+  std::vector<std::unique_ptr<aggregation>> aggs;
+  aggs.push_back(make_sum_aggregation());
+  aggs.push_back(make_max_aggregation());
+  aggs.push_back(make_count_aggregation(null_policy::INCLUDE));
+  aggs.push_back(make_mean_aggregation());
+  aggs.push_back(make_variance_aggregation());
+  aggs.push_back(make_std_aggregation(0));
+  aggs.push_back(make_nunique_aggregation());
+  return aggs;
+}
+
+std::vector<groupby::aggregation_request> make_requests(column_view const& values)
+{
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values       = values;
+  requests[0].aggregations = make_aggregations();
+  return requests;
+}
+}  // namespace
+
+TEST_F(groupby_incremental_test, matches_groupby_of_all_batches)
+{
+  fixed_width_column_wrapper<int32_t> keys_0{1, 2, 1, 3, 2, 1};
+  fixed_width_column_wrapper<double> vals_0({2., 4., 6., 5., 1., 7.}, {1, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<int32_t> keys_1({3, 1, 4, 2}, {1, 1, 1, 0});
+  fixed_width_column_wrapper<double> vals_1{1., 6., 8., 9.};
+  fixed_width_column_wrapper<int32_t> keys_2{4, 3, 5, 3};
+  fixed_width_column_wrapper<double> vals_2{8., 3., 2., 1.};
+
+  groupby::incremental_groupby incremental;
+  incremental.update(table_view{{keys_0}}, make_requests(vals_0));
+  incremental.update(table_view{{keys_1}}, make_requests(vals_1));
+  incremental.update(table_view{{keys_2}}, make_requests(vals_2));
+  auto const result = incremental.finalize();
+
+  auto const all_keys = concatenate(std::vector<column_view>{keys_0, keys_1, keys_2});
+  auto const all_vals = concatenate(std::vector<column_view>{vals_0, vals_1, vals_2});
+  groupby::groupby gb(table_view{{all_keys->view()}});
+  auto const expected = gb.aggregate(make_requests(all_vals->view()));
+
+  expect_tables_equivalent(sorted_by_keys(expected)->view(), sorted_by_keys(result)->view());
+}
+
+TEST_F(groupby_incremental_test, finalize_between_updates)
+{
+  fixed_width_column_wrapper<int32_t> keys_0{1, 2, 1};
+  fixed_width_column_wrapper<int64_t> vals_0{2, 4, 6};
+  fixed_width_column_wrapper<int32_t> keys_1{3, 1};
+  fixed_width_column_wrapper<int64_t> vals_1{5, 1};
+
+  auto requests = [](column_view const& values) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = values;
+    requests[0].aggregations.push_back(make_mean_aggregation());
+    return requests;
+  };
+
+  groupby::incremental_groupby incremental;
+  incremental.update(table_view{{keys_0}}, requests(vals_0));
+
+  fixed_width_column_wrapper<int32_t> expect_keys_0{1, 2};
+  fixed_width_column_wrapper<double> expect_vals_0{4., 4.};
+  expect_tables_equivalent(table_view{{expect_keys_0, expect_vals_0}},
+                           sorted_by_keys(incremental.finalize())->view());
+
+  incremental.update(table_view{{keys_1}}, requests(vals_1));
+
+  fixed_width_column_wrapper<int32_t> expect_keys_1{1, 2, 3};
+  fixed_width_column_wrapper<double> expect_vals_1{3., 4., 5.};
+  expect_tables_equivalent(table_view{{expect_keys_1, expect_vals_1}},
+                           sorted_by_keys(incremental.finalize())->view());
+}
+
+TEST_F(groupby_incremental_test, evict)
+{
+  fixed_width_column_wrapper<int32_t> keys_0{1, 2, 1, 3, 1};
+  fixed_width_column_wrapper<int64_t> vals_0{2, 4, 6, 5, 2};
+  fixed_width_column_wrapper<int32_t> keys_1{1, 3};
+  fixed_width_column_wrapper<int64_t> vals_1{10, 7};
+
+  auto requests = [](column_view const& values) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = values;
+    requests[0].aggregations.push_back(make_mean_aggregation());
+    requests[0].aggregations.push_back(make_nunique_aggregation());
+    return requests;
+  };
+
+  groupby::incremental_groupby incremental;
+  incremental.update(table_view{{keys_0}}, requests(vals_0));
+
+  numeric_scalar<int32_t> one{1};
+  auto const selection = binary_operation(
+    incremental.keys().column(0), one, binary_operator::EQUAL, data_type{type_id::BOOL8});
+  auto const evicted = incremental.evict(*selection);
+
+  fixed_width_column_wrapper<int32_t> expect_evicted_keys{1};
+  fixed_width_column_wrapper<double> expect_evicted_means{10. / 3};
+  fixed_width_column_wrapper<size_type> expect_evicted_counts{2};
+  expect_tables_equivalent(
+    table_view{{expect_evicted_keys, expect_evicted_means, expect_evicted_counts}},
+    sorted_by_keys(evicted)->view());
+  EXPECT_EQ(incremental.keys().num_rows(), 2);
+
+  // An evicted group starts again from an empty state
+  incremental.update(table_view{{keys_1}}, requests(vals_1));
+
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  fixed_width_column_wrapper<double> expect_means{10., 4., 6.};
+  fixed_width_column_wrapper<size_type> expect_counts{1, 1, 2};
+  expect_tables_equivalent(table_view{{expect_keys, expect_means, expect_counts}},
+                           sorted_by_keys(incremental.finalize())->view());
+
+  fixed_width_column_wrapper<bool> short_selection{true};
+  EXPECT_THROW(incremental.evict(short_selection), cudf::logic_error);
+}
+
+TEST_F(groupby_incremental_test, mismatched_requests)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1};
+  fixed_width_column_wrapper<int64_t> vals{2, 4, 6};
+  fixed_width_column_wrapper<float> float_vals{2, 4, 6};
+
+  groupby::incremental_groupby incremental;
+  EXPECT_THROW(incremental.finalize(), cudf::logic_error);
+  incremental.update(table_view{{keys}}, make_requests(vals));
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(make_min_aggregation());
+  EXPECT_THROW(incremental.update(table_view{{keys}}, requests), cudf::logic_error);
+  EXPECT_THROW(incremental.update(table_view{{keys}}, make_requests(float_vals)),
+               cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
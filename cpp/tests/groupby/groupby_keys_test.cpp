@@ -21,6 +21,8 @@
 #include <tests/utilities/type_lists.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/hashing.hpp>
 
 namespace cudf {
 namespace test {
@@ -195,5 +197,79 @@ TEST_F(groupby_string_keys_test, basic)
 }
 // clang-format on
 
+struct groupby_precomputed_hashes_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_precomputed_hashes_test, basic)
+{
+  using V = int32_t;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  strings_column_wrapper keys(
+    {"aaa", "año", "₹1", "aaa", "año", "año", "aaa", "₹1", "₹1", "año"},
+    {1, 1, 1, 1, 1, 0, 1, 1, 1, 1});
+  fixed_width_column_wrapper<V> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  strings_column_wrapper expect_keys({"aaa", "año", "₹1", ""}, {1, 1, 1, 0});
+  fixed_width_column_wrapper<R> expect_vals{9, 14, 17, 5};
+
+  for (auto const hash_function : {hash_id::HASH_MURMUR3, hash_id::HASH_XXHASH64}) {
+    auto const key_hashes = cudf::hash(table_view({keys}), hash_function);
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+    groupby::groupby gb_obj(table_view({keys}), *key_hashes, null_policy::INCLUDE);
+    auto result = gb_obj.aggregate(requests);
+
+    auto const sort_order  = sorted_order(result.first->view(), {}, {null_order::AFTER});
+    auto const sorted_keys = gather(result.first->view(), *sort_order);
+    auto const sorted_vals = gather(table_view({result.second[0].results[0]->view()}), *sort_order);
+    expect_tables_equal(table_view({expect_keys}), *sorted_keys);
+    expect_columns_equivalent(expect_vals, sorted_vals->get_column(0), true);
+  }
+
+  fixed_width_column_wrapper<int64_t> short_hashes{1, 2, 3};
+  EXPECT_THROW(groupby::groupby(table_view({keys}), short_hashes), cudf::logic_error);
+}
+
+struct groupby_dictionary_keys_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_dictionary_keys_test, basic)
+{
+  using V = int32_t;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  strings_column_wrapper strings(
+    {"aaa", "año", "₹1", "aaa", "año", "año", "aaa", "₹1", "₹1", "año"},
+    {1, 1, 1, 1, 1, 0, 1, 1, 1, 1});
+  fixed_width_column_wrapper<V> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto const keys = cudf::dictionary::encode(strings);
+
+  strings_column_wrapper expect_keys({"aaa", "año", "₹1"});
+  fixed_width_column_wrapper<R> expect_vals{9, 14, 17};
+
+  for (auto use_sort : {force_use_sort_impl::NO, force_use_sort_impl::YES}) {
+    std::vector<groupby::aggregation_request> requests(1);
+    requests[0].values = vals;
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+    if (use_sort == force_use_sort_impl::YES) {
+      requests[0].aggregations.push_back(make_nth_element_aggregation(0));
+    }
+    groupby::groupby gb_obj(table_view({keys->view()}));
+    auto result = gb_obj.aggregate(requests);
+
+    auto const& result_keys = result.first->get_column(0);
+    EXPECT_EQ(type_id::DICTIONARY32, result_keys.type().id());
+    auto const sort_order = sorted_order(result.first->view());
+    auto const decoded    = cudf::dictionary::decode(result_keys.view());
+    expect_columns_equal(expect_keys,
+                         gather(table_view({decoded->view()}), *sort_order)->get_column(0));
+    expect_columns_equivalent(
+      expect_vals,
+      gather(table_view({result.second[0].results[0]->view()}), *sort_order)->get_column(0));
+  }
+}
+
 }  // namespace test
 }  // namespace cudf
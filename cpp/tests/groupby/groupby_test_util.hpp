@@ -20,6 +20,7 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/table_utilities.hpp>
 
+#include <cudf/aggregation.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/groupby.hpp>
@@ -98,6 +99,25 @@ inline void test_single_agg(column_view const& keys,
   }
 }
 
+inline std::vector<groupby::aggregation_request> make_sum_requests(column_view const& values)
+{
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(make_sum_aggregation());
+  return requests;
+}
+
+// Sorts the keys and the results of the first request of a groupby by key, so that results can
+// be compared
+inline std::unique_ptr<table> sorted_by_keys(
+  std::pair<std::unique_ptr<table>, std::vector<groupby::aggregation_result>> const& result)
+{
+  std::vector<column_view> columns(result.first->view().begin(), result.first->view().end());
+  for (auto const& col : result.second[0].results) { columns.push_back(col->view()); }
+  auto const order = sorted_order(result.first->view());
+  return gather(table_view{columns}, *order);
+}
+
 inline auto all_valid()
 {
   auto all_valid = make_counting_transform_iterator(0, [](auto i) { return true; });
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+namespace cudf {
+namespace test {
+struct groupby_time_bucket_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_time_bucket_test, buckets_and_keys)
+{
+  fixed_width_column_wrapper<timestamp_s> timestamps{0, 130, 299, 300, 310, 650};
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 1, 1, 2};
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3, 4, 5, 6};
+  duration_scalar<duration_s> bucket_size{duration_s{300}};
+
+  fixed_width_column_wrapper<timestamp_s> expect_buckets{0, 0, 300, 600};
+  fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 1, 2};
+  fixed_width_column_wrapper<int64_t> expect_sums{4, 2, 9, 6};
+
+  // Sorted timestamps with other keys are grouped like unsorted ones
+  for (auto const is_sorted : {sorted::NO, sorted::YES}) {
+    auto const result = groupby::time_bucket_aggregate(timestamps,
+                                                       bucket_size,
+                                                       table_view{{keys}},
+                                                       make_sum_requests(values),
+                                                       null_policy::EXCLUDE,
+                                                       is_sorted);
+    expect_tables_equal(table_view{{expect_buckets, expect_keys, expect_sums}},
+                        sorted_by_keys(result)->view());
+  }
+}
+
+TEST_F(groupby_time_bucket_test, negative_timestamps)
+{
+  // Buckets are aligned on the epoch, also before it
+  fixed_width_column_wrapper<timestamp_ms> timestamps{-1001, -1000, -1, 0, 999, 1000};
+  fixed_width_column_wrapper<double> values{1, 2, 3, 4, 5, 6};
+  duration_scalar<duration_ms> bucket_size{duration_ms{1000}};
+
+  fixed_width_column_wrapper<timestamp_ms> expect_buckets{-2000, -1000, 0, 1000};
+  fixed_width_column_wrapper<double> expect_sums{1, 5, 9, 6};
+
+  auto const result = groupby::time_bucket_aggregate(
+    timestamps, bucket_size, table_view{}, make_sum_requests(values));
+  expect_tables_equal(table_view{{expect_buckets, expect_sums}}, sorted_by_keys(result)->view());
+}
+
+TEST_F(groupby_time_bucket_test, sorted_timestamps)
+{
+  fixed_width_column_wrapper<timestamp_s> timestamps({0, 0, 10, 20, 70, 75, 200},
+                                                     {0, 0, 1, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3, 4, 5, 6, 7};
+  duration_scalar<duration_s> bucket_size{duration_s{60}};
+
+  // The groups of pre-sorted timestamps are in bucket order
+  auto const excluded = groupby::time_bucket_aggregate(timestamps,
+                                                       bucket_size,
+                                                       table_view{},
+                                                       make_sum_requests(values),
+                                                       null_policy::EXCLUDE,
+                                                       sorted::YES);
+  fixed_width_column_wrapper<timestamp_s> expect_buckets{0, 60, 180};
+  fixed_width_column_wrapper<int64_t> expect_sums{7, 11, 7};
+  expect_tables_equal(table_view{{expect_buckets}}, excluded.first->view());
+  expect_columns_equal(expect_sums, *excluded.second[0].results[0]);
+
+  auto const included = groupby::time_bucket_aggregate(timestamps,
+                                                       bucket_size,
+                                                       table_view{},
+                                                       make_sum_requests(values),
+                                                       null_policy::INCLUDE,
+                                                       sorted::YES);
+  fixed_width_column_wrapper<timestamp_s> expect_all_buckets({0, 0, 60, 180}, {0, 1, 1, 1});
+  fixed_width_column_wrapper<int64_t> expect_all_sums{3, 7, 11, 7};
+  expect_tables_equal(table_view{{expect_all_buckets}}, included.first->view());
+  expect_columns_equal(expect_all_sums, *included.second[0].results[0]);
+}
+
+TEST_F(groupby_time_bucket_test, invalid_inputs)
+{
+  fixed_width_column_wrapper<timestamp_s> timestamps{0, 130, 299};
+  fixed_width_column_wrapper<int32_t> ints{0, 130, 299};
+  fixed_width_column_wrapper<int32_t> values{1, 2, 3};
+  duration_scalar<duration_s> bucket_size{duration_s{300}};
+  duration_scalar<duration_ms> bucket_size_ms{duration_ms{300}};
+  duration_scalar<duration_s> zero_bucket{duration_s{0}};
+
+  auto const aggregate = [&](column_view const& ts, scalar const& bucket) {
+    return groupby::time_bucket_aggregate(ts, bucket, table_view{}, make_sum_requests(values));
+  };
+  EXPECT_THROW(aggregate(ints, bucket_size), cudf::logic_error);
+  EXPECT_THROW(aggregate(timestamps, bucket_size_ms), cudf::logic_error);
+  EXPECT_THROW(aggregate(timestamps, zero_bucket), cudf::logic_error);
+
+  fixed_width_column_wrapper<int32_t> short_values{1, 2};
+  EXPECT_THROW(groupby::time_bucket_aggregate(
+                 timestamps, bucket_size, table_view{}, make_sum_requests(short_values)),
+               cudf::logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
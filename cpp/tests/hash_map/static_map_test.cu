@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/static_map.cuh>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <cudf/detail/utilities/hash_functions.cuh>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/logical.h>
+
+#include <limits>
+#include <vector>
+
+template <typename K, typename V>
+struct key_value_types {
+  using key_type   = K;
+  using value_type = V;
+};
+
+template <typename T>
+struct StaticMapTest : public cudf::test::BaseFixture {
+  using key_type   = typename T::key_type;
+  using value_type = typename T::value_type;
+  using map_type   = cudf::detail::static_map<key_type, value_type>;
+
+  // Stays below the largest key of the small types, which is the empty key
+  int64_t const size = std::min<int64_t>(10000, std::numeric_limits<key_type>::max() - 1);
+};
+
+using TestTypes = ::testing::Types<key_value_types<int32_t, int32_t>,
+                                   key_value_types<int64_t, int64_t>,
+                                   key_value_types<int8_t, int8_t>,
+                                   key_value_types<int16_t, int16_t>,
+                                   key_value_types<int16_t, double>,
+                                   key_value_types<int32_t, float>,
+                                   key_value_types<int64_t, double>>;
+
+TYPED_TEST_CASE(StaticMapTest, TestTypes);
+
+namespace {
+template <typename Key>
+struct key_equal {
+  __device__ bool operator()(Key lhs, Key rhs) const { return lhs == rhs; }
+};
+
+template <typename Key, typename Value>
+struct value_of {
+  __device__ Value operator()(int64_t i) const { return static_cast<Value>(i % 100); }
+};
+
+template <typename Key>
+struct key_of {
+  __device__ Key operator()(int64_t i) const { return static_cast<Key>(i); }
+};
+}  // namespace
+
+TYPED_TEST(StaticMapTest, InsertFind)
+{
+  using key_type   = typename TestFixture::key_type;
+  using value_type = typename TestFixture::value_type;
+
+  typename TestFixture::map_type map(
+    compute_hash_table_size(this->size), std::numeric_limits<key_type>::max());
+  auto keys   = thrust::make_transform_iterator(thrust::make_counting_iterator<int64_t>(0),
+                                              key_of<key_type>{});
+  auto values = thrust::make_transform_iterator(thrust::make_counting_iterator<int64_t>(0),
+                                                value_of<key_type, value_type>{});
+  map.insert(keys, keys + this->size, values, default_hash<key_type>{}, key_equal<key_type>{});
+  // Inserting again keeps the first values
+  auto other_values = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<int64_t>(1), value_of<key_type, value_type>{});
+  map.insert(
+    keys, keys + this->size, other_values, default_hash<key_type>{}, key_equal<key_type>{});
+
+  // Looks up the inserted keys, and as many keys that are not in the map
+  rmm::device_vector<value_type> found(2 * this->size);
+  rmm::device_vector<bool> contained(2 * this->size);
+  auto const probe_size = std::min<int64_t>(2 * this->size, std::numeric_limits<key_type>::max());
+  map.find(keys,
+           keys + probe_size,
+           found.begin(),
+           value_type{-1},
+           default_hash<key_type>{},
+           key_equal<key_type>{});
+  map.contains(
+    keys, keys + probe_size, contained.begin(), default_hash<key_type>{}, key_equal<key_type>{});
+
+  std::vector<value_type> h_found(probe_size);
+  thrust::copy(found.begin(), found.begin() + probe_size, h_found.begin());
+  std::vector<char> h_contained(probe_size);
+  thrust::copy(contained.begin(), contained.begin() + probe_size, h_contained.begin());
+  for (int64_t i = 0; i < probe_size; ++i) {
+    if (i < this->size) {
+      EXPECT_EQ(h_found[i], static_cast<value_type>(i % 100));
+      EXPECT_TRUE(h_contained[i]);
+    } else {
+      EXPECT_EQ(h_found[i], value_type{-1});
+      EXPECT_FALSE(h_contained[i]);
+    }
+  }
+}
+
+TYPED_TEST(StaticMapTest, FullLoad)
+{
+  using key_type   = typename TestFixture::key_type;
+  using value_type = typename TestFixture::value_type;
+
+  // Leaves only a few empty slots
+  typename TestFixture::map_type map(this->size + TestFixture::map_type::tile_size,
+                                     std::numeric_limits<key_type>::max());
+  auto keys = thrust::make_transform_iterator(thrust::make_counting_iterator<int64_t>(0),
+                                              key_of<key_type>{});
+  auto values = thrust::make_transform_iterator(thrust::make_counting_iterator<int64_t>(0),
+                                                value_of<key_type, value_type>{});
+  map.insert(keys, keys + this->size, values, default_hash<key_type>{}, key_equal<key_type>{});
+
+  rmm::device_vector<bool> contained(this->size);
+  map.contains(
+    keys, keys + this->size, contained.begin(), default_hash<key_type>{}, key_equal<key_type>{});
+  EXPECT_TRUE(thrust::all_of(contained.begin(), contained.end(), thrust::identity<bool>{}));
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/hashing.hpp>
+#include <cudf/table/table_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace test {
+struct BloomFilterTest : public BaseFixture {
+};
+
+TEST_F(BloomFilterTest, NoFalseNegatives)
+{
+  fixed_width_column_wrapper<int64_t> keys0({1, 5, -3, 0, 42, 7}, {1, 1, 1, 0, 1, 1});
+  strings_column_wrapper keys1({"a", "", "bloom", "x", "filter", "a"}, {1, 1, 1, 1, 0, 1});
+  table_view keys{{keys0, keys1}};
+
+  auto const filter = build_bloom_filter(keys, 100);
+  EXPECT_EQ(filter->size(), 4);
+  EXPECT_EQ(filter->type().id(), type_id::UINT32);
+
+  fixed_width_column_wrapper<bool> expected{1, 1, 1, 1, 1, 1};
+  expect_columns_equal(expected, bloom_filter_contains(filter->view(), keys)->view());
+}
+
+TEST_F(BloomFilterTest, FiltersMissingRows)
+{
+  auto const inserted = thrust::make_counting_iterator<int32_t>(0);
+  auto const missing  = thrust::make_counting_iterator<int32_t>(1000);
+  fixed_width_column_wrapper<int32_t> keys(inserted, inserted + 100);
+  fixed_width_column_wrapper<int32_t> probe(missing, missing + 1000);
+
+  auto const filter = build_bloom_filter(table_view{{keys}}, 100 * 16, 4);
+  auto const mask   = bloom_filter_contains(filter->view(), table_view{{probe}}, 4);
+  auto const found  = to_host<bool>(mask->view()).first;
+  // 16 bits and 4 hashes per row have a false positive rate of about 0.24%
+  EXPECT_LT(std::count(found.begin(), found.end(), true), 20);
+}
+
+TEST_F(BloomFilterTest, MergeEqualsBuildOfUnion)
+{
+  fixed_width_column_wrapper<int32_t> keys0{3, 1, 4, 1, 5};
+  fixed_width_column_wrapper<int32_t> keys1{9, 2, 6};
+  auto const filter0 = build_bloom_filter(table_view{{keys0}}, 64);
+  auto const filter1 = build_bloom_filter(table_view{{keys1}}, 64);
+  auto const merged  = merge_bloom_filters({filter0->view(), filter1->view()});
+
+  auto const all_keys = concatenate({keys0, keys1});
+  auto const expected = build_bloom_filter(table_view{{all_keys->view()}}, 64);
+  expect_columns_equal(expected->view(), merged->view());
+}
+
+TEST_F(BloomFilterTest, EmptyKeys)
+{
+  fixed_width_column_wrapper<int32_t> keys{};
+  auto const filter = build_bloom_filter(table_view{{keys}}, 1);
+  fixed_width_column_wrapper<uint32_t> expected{0};
+  expect_columns_equal(expected, filter->view());
+
+  fixed_width_column_wrapper<int32_t> probe{1, 2};
+  fixed_width_column_wrapper<bool> none{0, 0};
+  expect_columns_equal(none, bloom_filter_contains(filter->view(), table_view{{probe}})->view());
+}
+
+TEST_F(BloomFilterTest, InvalidArguments)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3};
+  table_view input{{keys}};
+  EXPECT_THROW(build_bloom_filter(input, 0), logic_error);
+  EXPECT_THROW(build_bloom_filter(input, 64, 0), logic_error);
+  EXPECT_THROW(build_bloom_filter(input, 64, 33), logic_error);
+
+  auto const filter0 = build_bloom_filter(input, 64);
+  auto const filter1 = build_bloom_filter(input, 128);
+  EXPECT_THROW(bloom_filter_contains(keys, input), logic_error);
+  EXPECT_THROW(merge_bloom_filters({}), logic_error);
+  EXPECT_THROW(merge_bloom_filters({filter0->view(), filter1->view()}), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
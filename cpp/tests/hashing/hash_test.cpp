@@ -13,6 +13,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/hashing.hpp>
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_utilities.hpp>
@@ -176,4 +178,129 @@ TYPED_TEST(HashTestFloatTyped, TestExtremes)
   expect_columns_equal(output1->view(), output2->view(), true);
 }
 
+class XXHash64Test : public cudf::test::BaseFixture {
+};
+
+// A row of one column hashes to hash_combine(0, XXH64(row)); the reference
+// values are computed by the XXH64 reference implementation
+TEST_F(XXHash64Test, MatchesReference)
+{
+  strings_column_wrapper const strings_col({"",
+                                            "The quick brown fox",
+                                            "jumps over the lazy dog.",
+                                            "All work and no play makes Jack a dull boy",
+                                            "!\"#$%&\'()*+,-./0123456789:;<=>?@[\\]^_`{|}~"});
+  using limits = std::numeric_limits<int32_t>;
+  fixed_width_column_wrapper<int32_t> const ints_col({0, 100, -100, limits::min(), limits::max()});
+
+  fixed_width_column_wrapper<uint64_t> const expected_strings({10195679999691023790ul,
+                                                               7488467402304476661ul,
+                                                               10244976120279292773ul,
+                                                               1146031289950630600ul,
+                                                               7064620647037675567ul});
+  fixed_width_column_wrapper<uint64_t> const expected_ints({15647511400073222857ul,
+                                                            17360182459274923863ul,
+                                                            15522900509018966746ul,
+                                                            2334495022117486472ul,
+                                                            14371883255646019721ul});
+  fixed_width_column_wrapper<uint64_t> const expected_rows({15088649571212786202ul,
+                                                            7067085486632581089ul,
+                                                            610482081936482710ul,
+                                                            1271846395718565106ul,
+                                                            40537372467322491ul});
+
+  auto const xxhash64 = cudf::hash_id::HASH_XXHASH64;
+  expect_columns_equal(expected_strings,
+                       cudf::hash(cudf::table_view({strings_col}), xxhash64)->view());
+  expect_columns_equal(expected_ints, cudf::hash(cudf::table_view({ints_col}), xxhash64)->view());
+  expect_columns_equal(expected_rows,
+                       cudf::hash(cudf::table_view({strings_col, ints_col}), xxhash64)->view());
+}
+
+// The bytes of sliced strings start at any alignment
+TEST_F(XXHash64Test, UnalignedStrings)
+{
+  strings_column_wrapper const strings_col({"a",
+                                            "bc",
+                                            "def",
+                                            "All work and no play makes Jack a dull boy",
+                                            "All work and no play makes Jack a dull boy",
+                                            "ghijklmnopqrstu",
+                                            "ghijklmnopqrstu"});
+  for (cudf::size_type offset = 0; offset < 4; ++offset) {
+    auto const sliced = cudf::slice(strings_col, {offset, 7})[0];
+    for (auto hash_function : {cudf::hash_id::HASH_MURMUR3, cudf::hash_id::HASH_XXHASH64}) {
+      auto const expected = cudf::hash(cudf::table_view({strings_col}), hash_function);
+      auto const output   = cudf::hash(cudf::table_view({sliced}), hash_function);
+      expect_columns_equal(cudf::slice(expected->view(), {offset, 7})[0], output->view());
+    }
+  }
+}
+
+TEST_F(XXHash64Test, MurmurMatchesDefault)
+{
+  fixed_width_column_wrapper<int64_t> const col({0, 1, 2, 3}, {1, 0, 1, 1});
+  auto const input = cudf::table_view({col});
+  expect_columns_equal(cudf::hash(input)->view(),
+                       cudf::hash(input, cudf::hash_id::HASH_MURMUR3)->view());
+}
+
+TYPED_TEST(HashTestFloatTyped, XXHash64Extremes)
+{
+  using T = TypeParam;
+  T nan   = std::numeric_limits<T>::quiet_NaN();
+  T inf   = std::numeric_limits<T>::infinity();
+
+  fixed_width_column_wrapper<T> const col1({T(0.0), T(100.0), nan, inf, -inf});
+  fixed_width_column_wrapper<T> const col2({T(-0.0), T(100.0), -nan, inf, -inf});
+
+  auto const output1 = cudf::hash(cudf::table_view({col1}), cudf::hash_id::HASH_XXHASH64);
+  auto const output2 = cudf::hash(cudf::table_view({col2}), cudf::hash_id::HASH_XXHASH64);
+
+  expect_columns_equal(output1->view(), output2->view(), true);
+}
+
+class HyperLogLogTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(HyperLogLogTest, MergedSketchesMatchSketchOfAllValues)
+{
+  fixed_width_column_wrapper<int64_t> const values_0({1, 5, 9, 5, 7}, {1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<int64_t> const values_1({9, 2, 1, 12});
+  fixed_width_column_wrapper<int64_t> const all_values({1, 5, 9, 5, 7, 9, 2, 1, 12},
+                                                       {1, 1, 1, 1, 0, 1, 1, 1, 1});
+
+  auto const sketch_0 = cudf::hyperloglog_sketches(values_0);
+  auto const sketch_1 = cudf::hyperloglog_sketches(values_1);
+  auto const expected = cudf::hyperloglog_sketches(all_values);
+
+  // Merge both sketches into group 1 of two groups, leaving group 0 empty
+  auto const sketches = cudf::concatenate({sketch_0->view(), sketch_1->view()});
+  fixed_width_column_wrapper<int32_t> const labels({1, 1});
+  auto const merged = cudf::merge_hyperloglog_sketches(*sketches, labels, 2);
+  auto const groups = cudf::split(merged->view(), {1 << 14});
+  expect_columns_equal(*expected, groups[1]);
+
+  fixed_width_column_wrapper<int64_t> const expected_estimates({0, 5});
+  expect_columns_equal(*cudf::hyperloglog_estimates(*merged), expected_estimates);
+}
+
+TEST_F(HyperLogLogTest, GroupedSketches)
+{
+  fixed_width_column_wrapper<int32_t> const values({1, 2, 3, 1, 2, 2, 4, 5});
+  fixed_width_column_wrapper<int32_t> const labels({0, 0, 0, 2, 2, 2, 1, 2},
+                                                   {1, 1, 1, 1, 1, 1, 0, 1});
+
+  auto const sketches = cudf::hyperloglog_sketches(values, labels, 3, 10);
+  EXPECT_EQ(sketches->size(), 3 << 10);
+
+  fixed_width_column_wrapper<int64_t> const expected_estimates({3, 0, 3});
+  expect_columns_equal(*cudf::hyperloglog_estimates(*sketches, 10), expected_estimates);
+
+  EXPECT_THROW(cudf::hyperloglog_sketches(values, labels, 3, 19), cudf::logic_error);
+  EXPECT_THROW(cudf::hyperloglog_estimates(*sketches, 12), cudf::logic_error);
+  fixed_width_column_wrapper<int32_t> const short_labels({0, 1});
+  EXPECT_THROW(cudf::hyperloglog_sketches(values, short_labels, 3, 10), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/wrappers/durations.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <arrow/api.h>
+
+using namespace cudf::test;
+
+struct ArrowInteropTest : public BaseFixture {
+};
+
+TEST_F(ArrowInteropTest, FixedWidthRoundTrip)
+{
+  fixed_width_column_wrapper<int32_t> col0({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0});
+  fixed_width_column_wrapper<double> col1{0.5, -1.25, 2.0, 3.5, 8.0};
+  fixed_width_column_wrapper<cudf::timestamp_ms> col2({1, 2, 3, 4, 5}, {1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<cudf::duration_s> col3{10, 20, 30, 40, 50};
+  cudf::table_view input{{col0, col1, col2, col3}};
+
+  auto const arrow_table = cudf::to_arrow(input, {"a", "b", "c", "d"});
+  EXPECT_EQ(arrow_table->num_rows(), 5);
+  EXPECT_EQ(arrow_table->schema()->field(1)->name(), "b");
+  EXPECT_TRUE(arrow_table->column(2)->type()->Equals(arrow::timestamp(arrow::TimeUnit::MILLI)));
+  auto const ints = std::static_pointer_cast<arrow::Int32Array>(arrow_table->column(0)->chunk(0));
+  EXPECT_EQ(ints->null_count(), 2);
+  EXPECT_TRUE(ints->IsNull(1));
+  EXPECT_EQ(ints->Value(3), 4);
+
+  expect_tables_equal(input, cudf::from_arrow(*arrow_table)->view());
+}
+
+TEST_F(ArrowInteropTest, NestedRoundTrip)
+{
+  fixed_width_column_wrapper<bool> bools({1, 0, 1, 1}, {1, 1, 0, 1});
+  strings_column_wrapper strings({"", "arrow", "cudf", "columns"}, {1, 1, 1, 0});
+  lists_column_wrapper<int32_t> lists{{1, 2}, {}, {3}, {4, 5, 6}};
+  cudf::table_view input{{bools, strings, lists}};
+
+  auto const arrow_table = cudf::to_arrow(input);
+  EXPECT_EQ(arrow_table->schema()->field(0)->name(), "0");
+  EXPECT_TRUE(arrow_table->column(0)->type()->Equals(arrow::boolean()));
+  EXPECT_TRUE(arrow_table->column(2)->type()->Equals(arrow::list(arrow::int32())));
+
+  expect_tables_equal(input, cudf::from_arrow(*arrow_table)->view());
+}
+
+TEST_F(ArrowInteropTest, SlicedRoundTrip)
+{
+  fixed_width_column_wrapper<int64_t> ints({1, 2, 3, 4, 5, 6, 7}, {1, 0, 1, 1, 0, 1, 1});
+  fixed_width_column_wrapper<bool> bools({1, 0, 1, 1, 0, 0, 1}, {1, 1, 0, 1, 1, 1, 0});
+  strings_column_wrapper strings({"a", "bb", "", "ccc", "d", "ee", "f"}, {1, 1, 1, 0, 1, 0, 1});
+  cudf::table_view input{{ints, bools, strings}};
+  auto const sliced = cudf::slice(input, {2, 6})[0];
+
+  auto const arrow_table = cudf::to_arrow(sliced);
+  EXPECT_EQ(arrow_table->num_rows(), 4);
+  expect_tables_equal(sliced, cudf::from_arrow(*arrow_table)->view());
+}
+
+TEST_F(ArrowInteropTest, DictionaryRoundTrip)
+{
+  strings_column_wrapper keys({"zz", "aa", "", "zz", "mm", "aa"}, {1, 1, 0, 1, 1, 1});
+  auto const dictionary = cudf::dictionary::encode(keys);
+  cudf::table_view input{{dictionary->view()}};
+
+  auto const arrow_table = cudf::to_arrow(input);
+  auto const type = std::static_pointer_cast<arrow::DictionaryType>(arrow_table->column(0)->type());
+  EXPECT_TRUE(type->index_type()->Equals(arrow::int32()));
+  EXPECT_TRUE(type->ordered());
+
+  auto const result = cudf::from_arrow(*arrow_table);
+  expect_columns_equal(keys, cudf::dictionary::decode(result->get_column(0).view())->view());
+}
+
+TEST_F(ArrowInteropTest, UnsortedArrowDictionary)
+{
+  arrow::StringBuilder keys_builder;
+  ASSERT_TRUE(keys_builder.AppendValues({"c", "a", "b"}).ok());
+  std::shared_ptr<arrow::Array> keys;
+  ASSERT_TRUE(keys_builder.Finish(&keys).ok());
+  arrow::Int8Builder indices_builder;
+  ASSERT_TRUE(indices_builder.AppendValues({0, 1, 2, 0, 1}, {1, 1, 1, 0, 1}).ok());
+  std::shared_ptr<arrow::Array> indices;
+  ASSERT_TRUE(indices_builder.Finish(&indices).ok());
+  auto const array = std::make_shared<arrow::DictionaryArray>(
+    arrow::dictionary(arrow::int8(), arrow::utf8()), indices, keys);
+  auto const batch = arrow::RecordBatch::Make(
+    arrow::schema({arrow::field("a", array->type())}), array->length(), {array});
+
+  auto const result = cudf::from_arrow(*batch);
+  strings_column_wrapper expected({"c", "a", "b", "", "a"}, {1, 1, 1, 0, 1});
+  expect_columns_equal(expected, cudf::dictionary::decode(result->get_column(0).view())->view());
+}
+
+TEST_F(ArrowInteropTest, DeviceRoundTrip)
+{
+  fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4, 5}, {1, 0, 1, 1, 0});
+  strings_column_wrapper strings({"", "arrow", "cudf", "device", "views"}, {1, 1, 1, 0, 1});
+  lists_column_wrapper<int16_t> lists{{1, 2}, {}, {3}, {4, 5, 6}, {7}};
+  cudf::table_view input{{ints, strings, lists}};
+  auto const sliced = cudf::slice(input, {1, 5})[0];
+
+  auto const arrow_table = cudf::to_arrow_device(sliced);
+  EXPECT_EQ(arrow_table->num_rows(), 4);
+  expect_tables_equal(sliced, cudf::from_arrow_device(*arrow_table));
+
+  fixed_width_column_wrapper<bool> bools{1, 0, 1};
+  auto const bools_table = cudf::to_arrow_device(cudf::table_view{{bools}});
+  EXPECT_EQ(bools_table->num_rows(), 3);
+  EXPECT_THROW(cudf::from_arrow_device(*bools_table), cudf::logic_error);
+}
+
+TEST_F(ArrowInteropTest, InvalidArguments)
+{
+  fixed_width_column_wrapper<int32_t> ints{1, 2, 3};
+  cudf::table_view input{{ints}};
+  EXPECT_THROW(cudf::to_arrow(input, {"a", "b"}), cudf::logic_error);
+
+  fixed_width_column_wrapper<cudf::duration_D> days{1, 2, 3};
+  EXPECT_THROW(cudf::to_arrow(cudf::table_view{{days}}), cudf::logic_error);
+
+  // host buffers cannot be viewed as device memory
+  EXPECT_THROW(cudf::from_arrow_device(*cudf::to_arrow(input)), cudf::logic_error);
+}
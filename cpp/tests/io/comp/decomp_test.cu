@@ -14,9 +14,11 @@
  * limitations under the License.
  */
 
+#include <io/comp/gpu_decompressor.h>
 #include <io/comp/gpuinflate.h>
 #include <tests/utilities/base_fixture.hpp>
 
+#include <numeric>
 #include <vector>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -123,6 +125,16 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
   }
 };
 
+/**
+ * @brief Derived fixture for Zstandard decompression
+ **/
+struct ZstdDecompressTest : public DecompressTest<ZstdDecompressTest> {
+  cudaError_t dispatch()
+  {
+    return cudf::io::gpu_unzstd(d_inf_args.data().get(), d_inf_stat.data().get(), 1);
+  }
+};
+
 TEST_F(GzipDecompressTest, HelloWorld)
 {
   constexpr char uncompressed[]  = "hello world";
@@ -171,4 +183,88 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+TEST_F(ZstdDecompressTest, HelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {0x28, 0xb5, 0x2f, 0xfd, 0x4,  0x58, 0x59, 0x0,  0x0,  0x68,
+                                    0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64,
+                                    0x68, 0x69, 0x1e, 0xb2};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(ZstdDecompressTest, RepeatedHelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world hello world hello world hello world";
+  constexpr uint8_t compressed[] = {0x28, 0xb5, 0x2f, 0xfd, 0x4,  0x58, 0x95, 0x0,  0x0,  0x60,
+                                    0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c,
+                                    0x64, 0x20, 0x1,  0x0,  0x4e, 0x96, 0x24, 0x34, 0x4c, 0xf8,
+                                    0xd0};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(&output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+/**
+ * @brief Returns a Snappy stream holding `data` as a single literal
+ **/
+std::vector<uint8_t> snappy_literal(std::vector<uint8_t> const& data)
+{
+  std::vector<uint8_t> stream;
+  for (auto len = data.size(); len != 0 || stream.empty(); len >>= 7) {
+    stream.push_back(static_cast<uint8_t>((len & 0x7f) | ((len > 0x7f) ? 0x80 : 0)));
+  }
+  uint32_t const len = data.size() - 1;
+  stream.push_back(63 << 2);  // Literal with a 4-byte length
+  for (int i = 0; i < 4; i++) { stream.push_back(static_cast<uint8_t>(len >> (i * 8))); }
+  stream.insert(stream.end(), data.begin(), data.end());
+  return stream;
+}
+
+TEST(GpuDecompressorTest, SizeBuckets)
+{
+  // Blocks of every size bucket, in no particular order
+  std::vector<size_t> const sizes{100, 3 * 1024 * 1024, 20, 200 * 1024, 1024 * 1024, 64 * 1024};
+  std::vector<std::vector<uint8_t>> expected;
+  std::vector<rmm::device_buffer> src;
+  std::vector<rmm::device_buffer> dst;
+  std::vector<cudf::io::gpu_inflate_input_s> inputs;
+  for (size_t i = 0; i < sizes.size(); i++) {
+    std::vector<uint8_t> data(sizes[i]);
+    for (size_t j = 0; j < data.size(); j++) { data[j] = static_cast<uint8_t>(i * 7 + j * 13); }
+    auto const compressed = snappy_literal(data);
+    src.emplace_back(compressed.data(), compressed.size());
+    dst.emplace_back(data.size());
+    inputs.push_back({src.back().data(), src.back().size(), dst.back().data(), dst.back().size()});
+    expected.push_back(std::move(data));
+  }
+
+  cudf::io::gpu_decompressor decompressor;
+  std::vector<cudf::io::gpu_inflate_status_s> statuses(inputs.size());
+  for (int call = 0; call < 2; call++) {
+    decompressor.decompress(
+      cudf::io::gpu_codec::SNAPPY, inputs.data(), statuses.data(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++) {
+      EXPECT_EQ(statuses[i].status, 0u);
+      EXPECT_EQ(statuses[i].bytes_written, sizes[i]);
+      std::vector<uint8_t> output(sizes[i]);
+      ASSERT_CUDA_SUCCEEDED(
+        cudaMemcpy(output.data(), dst[i].data(), output.size(), cudaMemcpyDeviceToHost));
+      EXPECT_EQ(output, expected[i]);
+    }
+  }
+
+  auto const& stats = decompressor.stats(cudf::io::gpu_codec::SNAPPY);
+  EXPECT_EQ(stats.num_blocks, 2 * inputs.size());
+  EXPECT_EQ(stats.num_failed, 0u);
+  EXPECT_EQ(stats.uncompressed_bytes, 2 * std::accumulate(sizes.begin(), sizes.end(), size_t{0}));
+  EXPECT_GT(stats.elapsed_ms, 0);
+  EXPECT_EQ(decompressor.stats(cudf::io::gpu_codec::GZIP).num_blocks, 0u);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -21,6 +21,8 @@
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -224,7 +226,8 @@ void expect_column_data_equal(std::vector<T> const& lhs, cudf::column_view const
 void write_csv_helper(std::string const& filename,
                       cudf::table_view const& table,
                       bool include_header,
-                      std::vector<std::string> const& names = {})
+                      std::vector<std::string> const& names = {},
+                      cudf_io::compression_type compression = cudf_io::compression_type::NONE)
 {
   // write_csv_args is non-owning
   cudf_io::sink_info const sink{filename};
@@ -246,7 +249,8 @@ void write_csv_helper(std::string const& filename,
   int const rows_per_chunk{
     1};  // Note: this gets adjusted to multiple of 8 (per legacy code logic and requirements)
   cudf_io::write_csv_args write_args{sink, table, na, include_header, rows_per_chunk};
-  write_args.metadata_ = &metadata;
+  write_args.metadata_    = &metadata;
+  write_args.compression_ = compression;
 
   cudf_io::write_csv(write_args);
 }
@@ -339,6 +343,90 @@ TEST_F(CsvReaderTest, MultiColumn)
   expect_column_data_equal(float64_values, view.column(14));
 }
 
+TEST_F(CsvReaderTest, MultiChunkInput)
+{
+  // More than one 64MB chunk, so that the upload of later chunks overlaps the parsing; the
+  // quoted terminators check that the quoting context carries across the chunks
+  constexpr auto num_rows = 3 * 1024 * 1024;
+  std::vector<int64_t> ids(num_rows);
+  std::iota(ids.begin(), ids.end(), 1000000);
+
+  auto filepath = temp_env->get_temp_dir() + "MultiChunkInput.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    for (int i = 0; i < num_rows; ++i) {
+      outfile << ids[i] << ",\"line\nbreak\"\n";
+    }
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.dtype  = {"int64", "str"};
+  in_args.header = -1;
+  auto result    = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(num_rows, view.num_rows());
+  expect_column_data_equal(ids, view.column(0));
+}
+
+TEST_F(CsvReaderTest, ChunkedRead)
+{
+  // Rows of different lengths with quoted terminators, so that rows straddle the chunk ends
+  auto filepath = temp_env->get_temp_dir() + "ChunkedRead.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "id,text,value\n";
+    for (int i = 0; i < 500; ++i) {
+      outfile << i << ",\"" << std::string(i % 13, 'a') << "\nb\"," << i * 0.5 << "\n";
+    }
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  auto expected = cudf_io::read_csv(in_args);
+
+  auto state = cudf_io::read_csv_chunked_begin(in_args, 100);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (cudf_io::read_csv_chunked_has_next(state)) {
+    auto chunk = cudf_io::read_csv_chunked(state);
+    EXPECT_EQ(expected.metadata.column_names, chunk.metadata.column_names);
+    chunks.push_back(std::move(chunk.tbl));
+  }
+  cudf_io::read_csv_chunked_end(state);
+  EXPECT_THROW(cudf_io::read_csv_chunked_begin(in_args, 0), cudf::logic_error);
+
+  ASSERT_GT(chunks.size(), 1u);
+  std::vector<cudf::table_view> views;
+  for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+  cudf::test::expect_tables_equal(expected.tbl->view(), cudf::concatenate(views)->view());
+}
+
+TEST_F(CsvReaderTest, ChunkedReadKeepsFirstChunkTypes)
+{
+  // The second chunk's values would be inferred as floats on their own
+  auto filepath = temp_env->get_temp_dir() + "ChunkedReadKeepsFirstChunkTypes.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "A\n1\n2\n33\n4.5\n";
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.byte_range_size = 1;
+  EXPECT_THROW(cudf_io::read_csv_chunked_begin(in_args, 7), cudf::logic_error);
+  in_args.byte_range_size = 0;
+
+  auto state  = cudf_io::read_csv_chunked_begin(in_args, 7);
+  auto first  = cudf_io::read_csv_chunked(state);
+  auto second = cudf_io::read_csv_chunked(state);
+  EXPECT_FALSE(cudf_io::read_csv_chunked_has_next(state));
+  EXPECT_THROW(cudf_io::read_csv_chunked(state), cudf::logic_error);
+
+  ASSERT_EQ(cudf::type_id::INT64, first.tbl->get_column(0).type().id());
+  ASSERT_EQ(cudf::type_id::INT64, second.tbl->get_column(0).type().id());
+  EXPECT_EQ(std::vector<std::string>{"A"}, second.metadata.column_names);
+  expect_column_data_equal(std::vector<int64_t>{1, 2, 33}, first.tbl->get_column(0));
+  EXPECT_EQ(1, second.tbl->num_rows());
+}
+
 TEST_F(CsvReaderTest, Booleans)
 {
   auto filepath = temp_env->get_temp_dir() + "Booleans.csv";
@@ -369,6 +457,57 @@ TEST_F(CsvReaderTest, Booleans)
   expect_column_data_equal(std::vector<bool>{true, true, false, true, false}, view.column(3));
 }
 
+TEST_F(CsvReaderTest, NullValues)
+{
+  auto filepath = temp_env->get_temp_dir() + "NullValues.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "abc\nNA\n#N/A N/A\nmissing_value_a\nmissing_value_c\nNAN\nmissing_value_b\n-NaN\n";
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.names  = {"A"};
+  in_args.dtype  = {"str"};
+  in_args.header = -1;
+  // Keys longer than eight characters share their length and first bytes with other keys
+  in_args.na_values = {
+    "NA", "N/A", "#N/A", "#N/A N/A", "-NaN", "nan", "null", "missing_value_a", "missing_value_b"};
+  auto result = cudf_io::read_csv(in_args);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(cudf::type_id::STRING, view.column(0).type().id());
+  cudf::test::strings_column_wrapper expected(
+    {"abc", "", "", "", "missing_value_c", "NAN", "", ""}, {1, 0, 0, 0, 1, 1, 0, 0});
+  cudf::test::expect_columns_equal(expected, view.column(0));
+}
+
+TEST_F(CsvReaderTest, SampledTypeInference)
+{
+  auto filepath = temp_env->get_temp_dir() + "SampledTypeInference.csv";
+  {
+    // The sampled rows are all integers; the first strided sample is row 5
+    std::ofstream outfile(filepath, std::ofstream::out);
+    for (int i = 0; i < 1000; ++i) { outfile << i << ',' << (i == 6 ? "abc" : "1") << '\n'; }
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.names               = {"A", "B"};
+  in_args.header              = -1;
+  in_args.type_inference_rows = 10;
+  auto result                 = cudf_io::read_csv(in_args);
+
+  // Column B is widened so that row 6 is parsed
+  const auto view = result.tbl->view();
+  ASSERT_EQ(cudf::type_id::INT64, view.column(0).type().id());
+  ASSERT_EQ(cudf::type_id::STRING, view.column(1).type().id());
+  std::vector<int64_t> expected_a(1000);
+  std::iota(expected_a.begin(), expected_a.end(), 0);
+  expect_column_data_equal(expected_a, view.column(0));
+  std::vector<std::string> expected_b(1000, "1");
+  expected_b[6] = "abc";
+  expect_column_data_equal(expected_b, view.column(1));
+}
+
 TEST_F(CsvReaderTest, Dates)
 {
   auto filepath = temp_env->get_temp_dir() + "Dates.csv";
@@ -1106,6 +1245,288 @@ TEST_F(CsvReaderTest, StringsWithWriterSimple)
   check_string_column(input_table.column(1), result_table.column(1));
 }
 
+TEST_F(CsvReaderTest, FormattedRowsWithWriter)
+{
+  std::vector<std::string> names{"index", "label", "flag"};
+
+  auto filepath = temp_env->get_temp_dir() + "FormattedRowsWithWriter.csv";
+
+  // Ten rows, so that the output is formatted in two chunks of eight rows
+  auto int_column    = column_wrapper<int32_t>{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+                                            {1, 1, 0, 1, 1, 1, 1, 1, 1, 0}};
+  auto string_column = column_wrapper<cudf::string_view>(
+    {"a", "b,c", "say \"hi\"", "", "multi\nline", "x", "y", "z", "\"", "last"},
+    {1, 1, 1, 1, 1, 0, 1, 1, 1, 1});
+  auto bool_column = column_wrapper<bool>{1, 0, 1, 0, 1, 0, 1, 0, 1, 0};
+  cudf::table_view input_table(
+    std::vector<cudf::column_view>{int_column, string_column, bool_column});
+
+  write_csv_helper(filepath, input_table, true, names);
+
+  std::ifstream input(filepath, std::ios::binary);
+  std::string const contents{std::istreambuf_iterator<char>(input),
+                             std::istreambuf_iterator<char>()};
+  std::string const expected =
+    "index,label,flag\n"
+    "0,a,true\n"
+    "1,\"b,c\",false\n"
+    "null,\"say \"\"hi\"\"\",true\n"
+    "3,,false\n"
+    "4,\"multi\nline\",true\n"
+    "5,null,false\n"
+    "6,y,true\n"
+    "7,z,false\n"
+    "8,\"\"\"\",true\n"
+    "null,last,false\n";
+  EXPECT_EQ(contents, expected);
+}
+
+TEST_F(CsvReaderTest, GzipCompressedWithWriter)
+{
+  std::vector<std::string> names{"index", "label"};
+
+  auto filepath = temp_env->get_temp_dir() + "GzipCompressedWithWriter.csv.gz";
+
+  constexpr auto num_rows = 1000;
+
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto labels   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "label " + std::to_string(i % 7); });
+
+  auto int_column    = column_wrapper<int32_t>(sequence, sequence + num_rows);
+  auto string_column = column_wrapper<cudf::string_view>(labels, labels + num_rows);
+  cudf::table_view input_table(std::vector<cudf::column_view>{int_column, string_column});
+
+  write_csv_helper(filepath, input_table, true, names, cudf_io::compression_type::GZIP);
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.compression = cudf_io::compression_type::GZIP;
+  in_args.names       = names;
+  in_args.dtype       = {"int32", "str"};
+  auto result         = cudf_io::read_csv(in_args);
+
+  const auto result_table = result.tbl->view();
+  cudf::test::expect_columns_equivalent(input_table.column(0), result_table.column(0));
+  check_string_column(input_table.column(1), result_table.column(1));
+}
+
+TEST_F(CsvReaderTest, GzipMultiMember)
+{
+  std::vector<std::string> names{"index", "label"};
+
+  auto filepath = temp_env->get_temp_dir() + "GzipMultiMember.csv.gz";
+
+  constexpr auto num_rows = 1000;
+
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto labels   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "label " + std::to_string(i % 7); });
+
+  auto int_column    = column_wrapper<int32_t>(sequence, sequence + num_rows);
+  auto string_column = column_wrapper<cudf::string_view>(labels, labels + num_rows);
+  cudf::table_view input_table(std::vector<cudf::column_view>{int_column, string_column});
+
+  // Concatenating gzip files yields a valid multi-member gzip file
+  auto const half = cudf::split(input_table, {num_rows / 2});
+  std::string contents;
+  for (size_t i = 0; i < half.size(); ++i) {
+    auto const member_path = filepath + std::to_string(i);
+    write_csv_helper(member_path, half[i], i == 0, names, cudf_io::compression_type::GZIP);
+    std::ifstream member(member_path, std::ios::binary);
+    contents.append(std::istreambuf_iterator<char>(member), std::istreambuf_iterator<char>());
+  }
+  std::ofstream(filepath, std::ios::binary) << contents;
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.compression = cudf_io::compression_type::GZIP;
+  in_args.names       = names;
+  in_args.dtype       = {"int32", "str"};
+  auto result         = cudf_io::read_csv(in_args);
+
+  const auto result_table = result.tbl->view();
+  cudf::test::expect_columns_equivalent(input_table.column(0), result_table.column(0));
+  check_string_column(input_table.column(1), result_table.column(1));
+}
+
+TEST_F(CsvReaderTest, GzipBgzfMembers)
+{
+  std::vector<std::string> names{"index", "label"};
+
+  auto filepath = temp_env->get_temp_dir() + "GzipBgzfMembers.csv.gz";
+
+  constexpr auto num_rows    = 1000;
+  constexpr auto num_members = 4;
+
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto labels   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "label " + std::to_string(i % 7); });
+
+  auto int_column    = column_wrapper<int32_t>(sequence, sequence + num_rows);
+  auto string_column = column_wrapper<cudf::string_view>(labels, labels + num_rows);
+  cudf::table_view input_table(std::vector<cudf::column_view>{int_column, string_column});
+
+  // Turn each gzip member into a BGZF block by adding the "BC" extra subfield, which holds the
+  // total block size minus one, and terminate the file with the empty BGZF end-of-file block
+  std::vector<cudf::size_type> splits;
+  for (int i = 1; i < num_members; ++i) { splits.push_back(i * num_rows / num_members); }
+  auto const parts = cudf::split(input_table, splits);
+  std::string contents;
+  for (size_t i = 0; i < parts.size(); ++i) {
+    auto const member_path = filepath + std::to_string(i);
+    write_csv_helper(member_path, parts[i], i == 0, names, cudf_io::compression_type::GZIP);
+    std::ifstream member_file(member_path, std::ios::binary);
+    std::string member;
+    member.append(std::istreambuf_iterator<char>(member_file), std::istreambuf_iterator<char>());
+    auto const bsize = member.size() + 8 - 1;
+    ASSERT_LE(bsize, 0xffffu);
+    member[3] |= 0x04;  // FEXTRA
+    char const extra[8] = {6, 0, 'B', 'C', 2, 0, char(bsize & 0xff), char(bsize >> 8)};
+    member.insert(10, extra, sizeof(extra));
+    contents += member;
+  }
+  uint8_t const bgzf_eof[28] = {0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+                                0x06, 0x00, 0x42, 0x43, 0x02, 0x00, 0x1b, 0x00, 0x03, 0x00,
+                                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+  contents.append(reinterpret_cast<char const*>(bgzf_eof), sizeof(bgzf_eof));
+  std::ofstream(filepath, std::ios::binary) << contents;
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.compression = cudf_io::compression_type::GZIP;
+  in_args.names       = names;
+  in_args.dtype       = {"int32", "str"};
+  auto result         = cudf_io::read_csv(in_args);
+
+  const auto result_table = result.tbl->view();
+  cudf::test::expect_columns_equivalent(input_table.column(0), result_table.column(0));
+  check_string_column(input_table.column(1), result_table.column(1));
+}
+
+namespace {
+// bzip2 -1 compressed 28000 rows of "<i % 10>,label <i % 7>\n" (280000 bytes, three blocks)
+uint8_t const bz2_multi_block_csv[] = {
+  0x42, 0x5a, 0x68, 0x31, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x8a, 0x80, 0x6b, 0xa6, 0x00, 0x3d,
+  0x5f, 0xd9, 0x00, 0x00, 0x10, 0x40, 0x04, 0x7f, 0xe0, 0x32, 0x04, 0x50, 0x03, 0x9c, 0x00, 0x79,
+  0x00, 0x20, 0x28, 0x69, 0xa6, 0x00, 0x0a, 0x1a, 0x69, 0x80, 0x02, 0x86, 0x9a, 0x60, 0x00, 0x4d,
+  0x55, 0x50, 0x3f, 0xf5, 0x54, 0x7f, 0xaa, 0x8d, 0x00, 0x4d, 0x52, 0xa0, 0x7a, 0x83, 0x23, 0xd4,
+  0xe8, 0x55, 0xea, 0x15, 0x7b, 0x05, 0x58, 0x2a, 0xf7, 0x85, 0x5f, 0x01, 0x57, 0x05, 0x58, 0x2a,
+  0xc1, 0x56, 0x0a, 0xb0, 0x55, 0x82, 0xad, 0x0a, 0xb0, 0x55, 0x82, 0xac, 0x15, 0x60, 0xab, 0x05,
+  0x58, 0x2a, 0xc1, 0x56, 0x85, 0x5a, 0x15, 0x60, 0xab, 0x05, 0x58, 0x2a, 0xc1, 0x56, 0x0a, 0xb0,
+  0x55, 0x82, 0xad, 0x0a, 0xb0, 0x55, 0x82, 0xac, 0x15, 0x60, 0xab, 0x05, 0x58, 0x2a, 0xc1, 0x56,
+  0x85, 0x58, 0x2a, 0xc1, 0x56, 0x0a, 0xb0, 0x55, 0x82, 0xac, 0x15, 0x60, 0xab, 0x42, 0xac, 0x15,
+  0x60, 0xab, 0x05, 0x58, 0x2a, 0xc1, 0x56, 0x0a, 0xb0, 0x55, 0xa1, 0x56, 0x0a, 0xb0, 0x55, 0x82,
+  0xac, 0x15, 0x68, 0x55, 0x82, 0xac, 0x15, 0x68, 0x55, 0x82, 0xaf, 0x5c, 0x15, 0x60, 0xab, 0xcc,
+  0x2a, 0xd0, 0xab, 0x05, 0x58, 0x2a, 0xf1, 0x0a, 0xb7, 0x0a, 0xa1, 0x5c, 0x85, 0x5a, 0x0a, 0xb4,
+  0x15, 0x68, 0x2a, 0xd4, 0x2a, 0xd0, 0x55, 0xa0, 0xab, 0xc8, 0x55, 0xc0, 0x55, 0xc8, 0x55, 0xc1,
+  0x57, 0x05, 0x5c, 0x15, 0x70, 0x55, 0xc1, 0x57, 0x42, 0xae, 0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0x82,
+  0xae, 0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0x82, 0xae, 0x0a, 0xb8, 0x2a, 0xe8, 0x55, 0xc1, 0x57, 0x05,
+  0x5d, 0x0a, 0xba, 0x15, 0x70, 0x55, 0xc1, 0x57, 0x05, 0x5c, 0x15, 0x70, 0x55, 0xc1, 0x57, 0x42,
+  0xae, 0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0xa1, 0x57, 0x05, 0x5c, 0x15, 0x70, 0x55, 0xc1, 0x57, 0x05,
+  0x5c, 0x15, 0x74, 0x2a, 0xe0, 0xab, 0x82, 0xae, 0x0a, 0xba, 0x15, 0x70, 0x55, 0xc1, 0x57, 0x05,
+  0x5c, 0x15, 0x70, 0x55, 0xc1, 0x57, 0x42, 0xae, 0x85, 0x5c, 0x15, 0x70, 0x55, 0xd0, 0xab, 0x82,
+  0xae, 0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0x82, 0xae, 0x0a, 0xbc, 0x24, 0xa2, 0xf2, 0xf0, 0x28, 0x3a,
+  0x24, 0xa2, 0xca, 0x90, 0x65, 0x25, 0x16, 0x54, 0x83, 0x29, 0x28, 0xb2, 0xa4, 0x19, 0x49, 0x45,
+  0x95, 0x20, 0xca, 0x4a, 0x2c, 0xa9, 0x06, 0x52, 0x51, 0x60, 0x28, 0x38, 0x85, 0x50, 0xaf, 0xb0,
+  0xaa, 0x15, 0xfa, 0x15, 0x42, 0xb7, 0x0a, 0xa1, 0x5b, 0x85, 0x50, 0xaf, 0xe6, 0x28, 0x2b, 0x24,
+  0xca, 0x6b, 0x2e, 0xcd, 0xf7, 0x55, 0x00, 0x05, 0xed, 0x9b, 0x20, 0x00, 0x02, 0x08, 0x00, 0x8f,
+  0xfc, 0x06, 0x40, 0x8a, 0x00, 0x73, 0x80, 0x0f, 0x20, 0x08, 0x05, 0x0d, 0x34, 0xc0, 0x01, 0x43,
+  0x4d, 0x30, 0x00, 0x50, 0xd3, 0x4c, 0x00, 0x09, 0xaa, 0xaa, 0x86, 0x9f, 0xfe, 0xaa, 0xa3, 0xff,
+  0x4a, 0xa6, 0x80, 0x14, 0xa5, 0x40, 0x7a, 0x43, 0xd4, 0x69, 0xc1, 0x57, 0xc4, 0x2a, 0xfb, 0x85,
+  0x58, 0x2a, 0xfc, 0x05, 0x5f, 0x90, 0xab, 0x82, 0xac, 0x15, 0x60, 0xab, 0x42, 0xac, 0x15, 0x60,
+  0xab, 0x05, 0x58, 0x2a, 0xc1, 0x56, 0x0a, 0xb0, 0x55, 0xa1, 0x56, 0x0a, 0xb0, 0x55, 0x82, 0xac,
+  0x15, 0x60, 0xab, 0x05, 0x58, 0x2a, 0xd0, 0xab, 0x05, 0x58, 0x2a, 0xc1, 0x56, 0x0a, 0xb0, 0x55,
+  0x82, 0xac, 0x15, 0x68, 0x55, 0x82, 0xac, 0x15, 0x60, 0xab, 0x05, 0x58, 0x2a, 0xc1, 0x56, 0x0a,
+  0xb4, 0x2a, 0xfa, 0xe8, 0x55, 0x82, 0xac, 0x15, 0x60, 0xab, 0xe2, 0x15, 0x60, 0xab, 0x05, 0x58,
+  0x2a, 0xd0, 0xab, 0x05, 0x58, 0x2a, 0xc1, 0x56, 0x85, 0x58, 0x2a, 0xc1, 0x56, 0x0a, 0xb4, 0x2a,
+  0xc1, 0x56, 0x0a, 0xb0, 0x55, 0xa1, 0x56, 0x85, 0x58, 0x2a, 0xc1, 0x56, 0x0a, 0xb0, 0x55, 0x80,
+  0x78, 0xaa, 0x1c, 0xaa, 0x0a, 0x8f, 0x3b, 0x54, 0x35, 0x54, 0x35, 0x54, 0x35, 0x54, 0x35, 0x54,
+  0x35, 0x54, 0x35, 0x54, 0x3c, 0xaa, 0x1f, 0x2a, 0x86, 0xe1, 0x57, 0x05, 0x5d, 0x0a, 0xb8, 0x2a,
+  0xe0, 0xab, 0x82, 0xae, 0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0xa1, 0x57, 0x05, 0x5c, 0x15, 0x70, 0x55,
+  0xd0, 0xab, 0x82, 0xae, 0x0a, 0xb8, 0x2a, 0xe0, 0xab, 0x82, 0xae, 0x0a, 0xba, 0x15, 0x7e, 0xfc,
+  0x15, 0x78, 0x2a, 0xf0, 0x55, 0xe8, 0x55, 0xe0, 0xab, 0xc1, 0x57, 0x82, 0xaf, 0x05, 0x5e, 0x0a,
+  0xbc, 0x15, 0x70, 0x55, 0xc1, 0x57, 0x05, 0x5c, 0x15, 0x74, 0x2a, 0xe0, 0xab, 0x82, 0xae, 0x85,
+  0x5c, 0x15, 0x70, 0x55, 0xc1, 0x57, 0x05, 0x5c, 0x15, 0x70, 0x55, 0xc1, 0x57, 0x42, 0xae, 0x0a,
+  0xb8, 0x2a, 0xe8, 0x55, 0xc1, 0x57, 0x05, 0x5c, 0x15, 0x70, 0x55, 0xc1, 0x57, 0x05, 0x5c, 0x50,
+  0xe1, 0x50, 0xe2, 0xa8, 0x71, 0x54, 0x38, 0x54, 0x36, 0x48, 0xa6, 0xc4, 0xaa, 0xc2, 0x45, 0x30,
+  0x4a, 0xac, 0x92, 0x29, 0x82, 0x55, 0x64, 0x91, 0x4c, 0x12, 0xab, 0x09, 0x14, 0xc1, 0x2a, 0xb0,
+  0x91, 0x4c, 0x12, 0xab, 0x09, 0x14, 0xc5, 0x51, 0x55, 0xb5, 0x41, 0x51, 0xf5, 0x50, 0x54, 0x7e,
+  0x54, 0x15, 0x1c, 0xaa, 0x0a, 0x8e, 0x55, 0x05, 0x47, 0xf3, 0x14, 0x15, 0x92, 0x65, 0x35, 0x93,
+  0x6c, 0x66, 0x1a, 0xc0, 0x09, 0x72, 0xf5, 0x90, 0x00, 0x01, 0x04, 0x00, 0x47, 0xfe, 0x03, 0x20,
+  0x45, 0x00, 0x33, 0xc0, 0x00, 0x03, 0xc5, 0x14, 0x34, 0xd3, 0x00, 0x05, 0x0d, 0x34, 0xc0, 0x01,
+  0x43, 0x4d, 0x30, 0x00, 0x26, 0xaa, 0xaa, 0x0d, 0xff, 0xaa, 0xa7, 0xbd, 0x55, 0x18, 0x68, 0x14,
+  0x95, 0x40, 0x00, 0x1d, 0x28, 0xfe, 0x94, 0x7b, 0x4a, 0x34, 0xa3, 0xdc, 0xa3, 0xc9, 0x47, 0x4a,
+  0x34, 0xa3, 0x4a, 0x31, 0x46, 0x94, 0x69, 0x46, 0x28, 0xd2, 0x8d, 0x28, 0xd2, 0x8d, 0x28, 0xc5,
+  0x1a, 0x51, 0xa5, 0x18, 0xa3, 0x14, 0x69, 0x46, 0x94, 0x69, 0x46, 0x28, 0xd2, 0x8d, 0x28, 0xd2,
+  0x8c, 0x51, 0xa5, 0x1a, 0x51, 0xa5, 0x18, 0xa3, 0x4a, 0x34, 0xa3, 0x4a, 0x31, 0x46, 0x94, 0x69,
+  0x46, 0x94, 0x62, 0x8c, 0x51, 0xa5, 0x1a, 0x51, 0x8a, 0x34, 0xa3, 0x4a, 0x34, 0xa3, 0x4a, 0x31,
+  0x46, 0x94, 0x69, 0x46, 0x28, 0xc5, 0x1a, 0x51, 0xa5, 0x1a, 0x51, 0x8a, 0x34, 0xa3, 0x4a, 0x31,
+  0x46, 0x28, 0xc5, 0x1a, 0x51, 0xa5, 0x18, 0xa3, 0x4a, 0x34, 0xa3, 0x14, 0x6f, 0x54, 0xa9, 0x07,
+  0xc9, 0x47, 0x92, 0x8f, 0x25, 0x1e, 0x4a, 0x3c, 0x28, 0xf2, 0x51, 0xe4, 0xa3, 0xc2, 0x8f, 0x89,
+  0x47, 0xcc, 0xa3, 0xa5, 0x1c, 0x51, 0xd2, 0x8e, 0x94, 0x74, 0xa3, 0x8a, 0x3a, 0x51, 0xd2, 0x8e,
+  0x28, 0xe9, 0x47, 0x4a, 0x3a, 0x51, 0xc5, 0x1d, 0x28, 0xe9, 0x47, 0x4a, 0x38, 0xa3, 0xa5, 0x1d,
+  0x28, 0xe2, 0x8e, 0x28, 0xe9, 0x47, 0x4a, 0x38, 0xa3, 0xa5, 0x1d, 0x28, 0xe9, 0x47, 0x14, 0x74,
+  0xa3, 0xa5, 0x1d, 0x28, 0xe2, 0x8e, 0x94, 0x74, 0xa3, 0x8a, 0x3a, 0x51, 0xd2, 0x8e, 0x94, 0x71,
+  0x47, 0x4a, 0x3a, 0x51, 0xd2, 0x8e, 0x28, 0xe9, 0x47, 0x4a, 0x38, 0xa3, 0xa5, 0x1d, 0x28, 0xe2,
+  0x8e, 0x28, 0xe9, 0x47, 0x4a, 0x3a, 0x51, 0xc5, 0x1d, 0x28, 0xe9, 0x47, 0x14, 0x74, 0xa3, 0xa5,
+  0x1c, 0x51, 0xdf, 0x02, 0xa8, 0x7a, 0x04, 0x5a, 0xa5, 0x43, 0x02, 0x2d, 0x52, 0xa1, 0x81, 0x16,
+  0xa9, 0x50, 0xc0, 0x8b, 0x0a, 0xa1, 0x81, 0x16, 0x15, 0x43, 0x02, 0x2c, 0x2a, 0x86, 0xa0, 0x45,
+  0xe8, 0x89, 0x07, 0xd5, 0x2a, 0x41, 0xf7, 0x4a, 0x90, 0x7a, 0xa5, 0x48, 0x3d, 0x52, 0xaa, 0x27,
+  0x3d, 0x50, 0x89, 0xfc, 0x5d, 0xc9, 0x14, 0xe1, 0x42, 0x43, 0xc0, 0x62, 0xe9, 0x98};
+
+constexpr cudf::size_type bz2_multi_block_csv_rows = 28000;
+
+void check_bz2_multi_block_rows(cudf::table_view const& result, cudf::size_type num_rows)
+{
+  auto digits = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+  auto labels = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "label " + std::to_string(i % 7); });
+
+  auto int_column    = column_wrapper<int32_t>(digits, digits + num_rows);
+  auto string_column = column_wrapper<cudf::string_view>(labels, labels + num_rows);
+
+  ASSERT_EQ(result.num_rows(), num_rows);
+  cudf::test::expect_columns_equivalent(int_column, result.column(0));
+  check_string_column(string_column, result.column(1));
+}
+
+}  // namespace
+
+TEST_F(CsvReaderTest, Bzip2MultiBlock)
+{
+  auto filepath = temp_env->get_temp_dir() + "Bzip2MultiBlock.csv.bz2";
+  std::ofstream(filepath, std::ios::binary)
+    .write(reinterpret_cast<char const*>(bz2_multi_block_csv), sizeof(bz2_multi_block_csv));
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.compression = cudf_io::compression_type::BZIP2;
+  in_args.names       = {"index", "label"};
+  in_args.dtype       = {"int32", "str"};
+  in_args.header      = -1;
+  auto result         = cudf_io::read_csv(in_args);
+
+  check_bz2_multi_block_rows(result.tbl->view(), bz2_multi_block_csv_rows);
+}
+
+TEST_F(CsvReaderTest, Bzip2MultiStream)
+{
+  auto filepath = temp_env->get_temp_dir() + "Bzip2MultiStream.csv.bz2";
+
+  // Concatenating bzip2 files yields a valid multi-stream bzip2 file
+  std::ofstream file(filepath, std::ios::binary);
+  for (int i = 0; i < 2; ++i) {
+    file.write(reinterpret_cast<char const*>(bz2_multi_block_csv), sizeof(bz2_multi_block_csv));
+  }
+  file.close();
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.compression = cudf_io::compression_type::BZIP2;
+  in_args.names       = {"index", "label"};
+  in_args.dtype       = {"int32", "str"};
+  in_args.header      = -1;
+  auto result         = cudf_io::read_csv(in_args);
+
+  check_bz2_multi_block_rows(result.tbl->view(), 2 * bz2_multi_block_csv_rows);
+}
+
 TEST_F(CsvReaderTest, EmptyFileWithWriter)
 {
   auto filepath = temp_env->get_temp_dir() + "EmptyFileWithWriter.csv";
@@ -31,6 +31,8 @@
 #include <arrow/io/api.h>
 
 #include <fstream>
+#include <limits>
+#include <numeric>
 
 #include <type_traits>
 
@@ -180,6 +182,29 @@ TEST_F(JsonReaderTest, JsonLinesStrings)
                                    cudf::test::strings_column_wrapper({"aa ", "  bbb"}));
 }
 
+TEST_F(JsonReaderTest, SampledTypeInference)
+{
+  // The sampled records are all integers; the first strided sample is record 5
+  std::string data;
+  for (int i = 0; i < 1000; ++i) {
+    data += (i == 6 ? "[0.5]" : "[" + std::to_string(i) + "]") + "\n";
+  }
+
+  cudf_io::read_json_args in_args{cudf_io::source_info{data.data(), data.size()}};
+  in_args.lines               = true;
+  in_args.type_inference_rows = 10;
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_args);
+
+  // The column is widened so that the last record is parsed
+  ASSERT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::FLOAT64);
+  std::vector<double> expected(1000);
+  std::iota(expected.begin(), expected.end(), 0.);
+  expected[6] = 0.5;
+  cudf::test::expect_columns_equal(result.tbl->get_column(0),
+                                   float64_wrapper(expected.begin(), expected.end()));
+}
+
 TEST_F(JsonReaderTest, MultiColumn)
 {
   constexpr auto num_rows = 10;
@@ -546,4 +571,121 @@ TEST_F(JsonReaderTest, StringInference)
   EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::STRING);
 }
 
+TEST_F(JsonReaderTest, NestedObjectsAndArrays)
+{
+  std::string data =
+    "{\"id\": 1, \"user\": {\"name\": \"a\", \"age\": 30}, \"tags\": [\"x\", \"y\"], "
+    "\"items\": [{\"price\": 1.5}, {\"price\": 2.5}]}\n"
+    "{\"id\": 2, \"user\": {\"name\": \"b,}\"}, \"tags\": [], \"items\": [{\"price\": 3.0}]}\n"
+    "{\"id\": 3, \"tags\": [\"z\"], \"nested\": [[1, 2], [3]]}\n";
+
+  cudf_io::read_json_args in_args{cudf_io::source_info{data.data(), data.size()}};
+  in_args.lines  = true;
+  in_args.nested = true;
+  in_args.dtype  = {"user.age:int32"};
+
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_args);
+
+  const std::vector<std::string> expected_names{
+    "id", "user.name", "user.age", "tags", "items.price", "nested"};
+  EXPECT_EQ(result.metadata.column_names, expected_names);
+  ASSERT_EQ(result.tbl->num_columns(), 6);
+  EXPECT_EQ(result.tbl->num_rows(), 3);
+
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  cudf::test::expect_columns_equal(result.tbl->get_column(0),
+                                   int64_wrapper{{1, 2, 3}, validity});
+  cudf::test::expect_columns_equal(result.tbl->get_column(1),
+                                   cudf::test::strings_column_wrapper({"a", "b,}", ""}, {1, 1, 0}));
+  cudf::test::expect_columns_equal(result.tbl->get_column(2), int_wrapper{{30, 0, 0}, {1, 0, 0}});
+
+  using string_lists = cudf::test::lists_column_wrapper<cudf::string_view>;
+  using double_lists = cudf::test::lists_column_wrapper<double>;
+  cudf::test::expect_columns_equivalent(result.tbl->get_column(3),
+                                        string_lists{{"x", "y"}, string_lists{}, {"z"}});
+  cudf::test::expect_columns_equivalent(result.tbl->get_column(4),
+                                        double_lists{{1.5, 2.5}, {3.0}, double_lists{}});
+  // Arrays within arrays are read as the text of the inner arrays
+  cudf::test::expect_columns_equivalent(
+    result.tbl->get_column(5), string_lists{{"[1, 2]", "[3]"}, string_lists{}, string_lists{}});
+}
+
+TEST_F(JsonReaderTest, NestedUnbalancedBrackets)
+{
+  std::string data = "{\"a\": [1, 2}\n";
+
+  cudf_io::read_json_args in_args{cudf_io::source_info{data.data(), data.size()}};
+  in_args.lines  = true;
+  in_args.nested = true;
+  EXPECT_THROW(cudf_io::read_json(in_args), cudf::logic_error);
+}
+
+/**
+ * @brief Base test fixture for JSON writer tests
+ **/
+struct JsonWriterTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(JsonWriterTest, JsonLines)
+{
+  auto int_column   = int64_wrapper{{1, 2, 3}, {1, 0, 1}};
+  auto float_column = float64_wrapper{1.5, std::numeric_limits<double>::quiet_NaN(), -2.0};
+  auto str_column =
+    cudf::test::strings_column_wrapper({"plain", "say \"hi\"\n", "back\\slash\t"}, {1, 1, 0});
+  auto bool_column = bool_wrapper{true, false, true};
+  cudf::table_view input_table({int_column, float_column, str_column, bool_column});
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"id", "value", "label", "flag"};
+
+  std::vector<char> out_buffer;
+  // One row per chunk, so that each row is formatted separately
+  cudf_io::write_json_args out_args{
+    cudf_io::sink_info{&out_buffer}, input_table, true, true, 1, "\n", &metadata};
+  cudf_io::write_json(out_args);
+
+  std::string const expected =
+    "{\"id\":1,\"value\":1.5,\"label\":\"plain\",\"flag\":true}\n"
+    "{\"id\":null,\"value\":null,\"label\":\"say \\\"hi\\\"\\n\",\"flag\":false}\n"
+    "{\"id\":3,\"value\":-2.0,\"label\":null,\"flag\":true}\n";
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), expected);
+
+  // The output reads back as the input
+  cudf_io::read_json_args in_args{cudf_io::source_info{out_buffer.data(), out_buffer.size()}};
+  in_args.lines = true;
+  in_args.dtype = {"int64", "float64", "str", "bool"};
+  auto result   = cudf_io::read_json(in_args);
+
+  EXPECT_EQ(result.metadata.column_names, metadata.column_names);
+  cudf::test::expect_columns_equal(result.tbl->get_column(0), int_column);
+  cudf::test::expect_columns_equal(result.tbl->get_column(3), bool_column);
+}
+
+TEST_F(JsonWriterTest, RecordsWithoutNulls)
+{
+  auto int_column = int_wrapper{{10, 20, 30}, {1, 0, 1}};
+  auto str_column = cudf::test::strings_column_wrapper({"a", "b", "c"}, {0, 1, 1});
+  cudf::table_view input_table({int_column, str_column});
+
+  std::vector<char> out_buffer;
+  cudf_io::write_json_args out_args{cudf_io::sink_info{&out_buffer}, input_table, false, false, 2};
+  cudf_io::write_json(out_args);
+
+  // Without column names, the keys are the column indices
+  std::string const expected = "[{\"0\":10},{\"1\":\"b\"},{\"0\":30,\"1\":\"c\"}]";
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), expected);
+}
+
+TEST_F(JsonWriterTest, EmptyRecords)
+{
+  auto int_column = int_wrapper{};
+  cudf::table_view input_table({int_column});
+
+  std::vector<char> out_buffer;
+  cudf_io::write_json_args out_args{cudf_io::sink_info{&out_buffer}, input_table, false, true, 0};
+  cudf_io::write_json(out_args);
+
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), "[]");
+}
+
 CUDF_TEST_PROGRAM_MAIN()
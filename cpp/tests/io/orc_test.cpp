@@ -20,7 +20,10 @@
 #include <tests/utilities/cudf_gtest.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/io/data_sink.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -398,6 +401,103 @@ TEST_F(OrcWriterTest, Strings)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, StringsMixedCardinality)
+{
+  // Spans several rowgroups; only the low-cardinality column is worth dictionary encoding
+  constexpr auto num_rows = 30000;
+  std::vector<std::string> unique_strings(num_rows);
+  std::vector<std::string> repeated_strings(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    unique_strings[i]   = "unique_" + std::to_string(i * 7919);
+    repeated_strings[i] = "repeated_" + std::to_string(i % 37);
+  }
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+
+  column_wrapper<cudf::string_view> col0{unique_strings.begin(), unique_strings.end()};
+  column_wrapper<cudf::string_view> col1{
+    repeated_strings.begin(), repeated_strings.end(), validity};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("OrcStringsMixedCardinality.orc");
+  cudf_io::write_orc_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+  cudf_io::write_orc(out_args);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_orc(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
+TEST_F(OrcWriterTest, Structs)
+{
+  // More than one rowgroup, the fields being null where their struct is null
+  constexpr auto num_rows = 25000;
+  auto struct_valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto field_valids = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i % 3 != 0 && i % 7 != 0; });
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto names  = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "name" + std::to_string(i); });
+  auto doubles = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+  column_wrapper<int32_t> field0(values, values + num_rows, field_valids);
+  column_wrapper<cudf::string_view> field1(names, names + num_rows, struct_valids);
+  column_wrapper<double> nested_field0(doubles, doubles + num_rows, struct_valids);
+  std::vector<std::unique_ptr<column>> nested_fields;
+  nested_fields.push_back(nested_field0.release());
+  std::vector<std::unique_ptr<column>> fields;
+  fields.push_back(field0.release());
+  fields.push_back(field1.release());
+  fields.push_back(cudf::make_structs_column(num_rows, std::move(nested_fields), 0, {}));
+  auto struct_mask = cudf::test::detail::make_null_mask(struct_valids, struct_valids + num_rows);
+  auto col0        = cudf::make_structs_column(
+    num_rows, std::move(fields), (num_rows + 2) / 3, std::move(struct_mask));
+  column_wrapper<int32_t> col1(values, values + num_rows);
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("struct");
+  expected_metadata.column_names.emplace_back("ints");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(std::move(col0));
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("OrcStructs.orc");
+  cudf_io::write_orc_args out_args{
+    cudf_io::sink_info{filepath}, expected->view(), &expected_metadata};
+  cudf_io::write_orc(out_args);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_orc(in_args);
+
+  ASSERT_EQ(2, result.tbl->num_columns());
+  for (cudf::size_type i = 0; i < expected->num_columns(); i++) {
+    cudf::test::expect_columns_equivalent(expected->get_column(i), result.tbl->get_column(i));
+  }
+  EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
+
+  // A field is selected by its dotted path
+  in_args.columns = {"struct._field1"};
+  result          = cudf_io::read_orc(in_args);
+  ASSERT_EQ(1, result.tbl->num_columns());
+  cudf::test::expect_columns_equivalent(expected->get_column(0).child(1),
+                                        result.tbl->get_column(0));
+
+  // Row ranges select whole structs
+  in_args.columns   = {"struct"};
+  in_args.skip_rows = 9998;
+  in_args.num_rows  = 5;
+  result            = cudf_io::read_orc(in_args);
+  ASSERT_EQ(1, result.tbl->num_columns());
+  auto const expected_slice = cudf::slice(expected->get_column(0), {9998, 10003}).front();
+  cudf::test::expect_columns_equivalent(expected_slice, result.tbl->get_column(0));
+}
+
 TEST_F(OrcWriterTest, HostBuffer)
 {
   constexpr auto num_rows = 100 << 10;
@@ -427,6 +527,96 @@ TEST_F(OrcWriterTest, HostBuffer)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+// custom data sink that optionally reads the written data from device memory itself
+template <bool supports_device_writes>
+class custom_test_memmap_sink : public cudf::io::data_sink {
+ public:
+  explicit custom_test_memmap_sink(std::vector<char>* mm_writer_buf)
+  {
+    mm_writer = cudf::io::data_sink::create(mm_writer_buf);
+  }
+
+  virtual ~custom_test_memmap_sink() { mm_writer->flush(); }
+
+  void host_write(void const* data, size_t size) override
+  {
+    mm_writer->host_write(reinterpret_cast<char const*>(data), size);
+  }
+
+  bool supports_device_write() const override { return supports_device_writes; }
+
+  void device_write(void const* gpu_data, size_t size, cudaStream_t stream) override
+  {
+    std::vector<char> host(size);
+    CUDA_TRY(cudaMemcpyAsync(host.data(), gpu_data, size, cudaMemcpyDeviceToHost, stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    mm_writer->host_write(host.data(), size);
+  }
+
+  void flush() override { mm_writer->flush(); }
+
+  size_t bytes_written() override { return mm_writer->bytes_written(); }
+
+ private:
+  std::unique_ptr<data_sink> mm_writer;
+};
+
+TEST_F(OrcWriterTest, MultiStripeSinks)
+{
+  // Large enough for several stripes, so that staging of the next stripe overlaps with writes
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(16, 1536 * 1024, true);
+
+  std::vector<char> host_buf;
+  custom_test_memmap_sink<false> host_sink(&host_buf);
+  cudf_io::write_orc_args host_args{cudf_io::sink_info{&host_sink}, expected->view()};
+  cudf_io::write_orc(host_args);
+
+  std::vector<char> device_buf;
+  custom_test_memmap_sink<true> device_sink(&device_buf);
+  cudf_io::write_orc_args device_args{cudf_io::sink_info{&device_sink}, expected->view()};
+  cudf_io::write_orc(device_args);
+
+  EXPECT_EQ(host_buf, device_buf);
+  cudf_io::read_orc_args in_args{cudf_io::source_info{host_buf.data(), host_buf.size()}};
+  auto result = cudf_io::read_orc(in_args);
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
+TEST_F(OrcWriterTest, RowMask)
+{
+  constexpr auto num_rows = 10000;
+  auto ids   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto names = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "name" + std::to_string(i); });
+  column_wrapper<int32_t> col0(ids, ids + num_rows);
+  column_wrapper<cudf::string_view> col1(names, names + num_rows);
+  auto expected = table_view{{col0, col1}};
+
+  std::vector<char> out_buffer;
+  cudf_io::write_orc_args out_args{cudf_io::sink_info{&out_buffer}, expected};
+  cudf_io::write_orc(out_args);
+
+  auto selected =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3000 == 7; });
+  column_wrapper<bool> mask(selected, selected + num_rows);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info{out_buffer.data(), out_buffer.size()}};
+  in_args.row_mask = mask;
+  auto result      = cudf_io::read_orc(in_args);
+  column_wrapper<int32_t> expected_ids{7, 3007, 6007, 9007};
+  column_wrapper<cudf::string_view> expected_names{"name7", "name3007", "name6007", "name9007"};
+  expect_tables_equal(table_view{{expected_ids, expected_names}}, result.tbl->view());
+
+  // A mask of the rows of a row range
+  in_args.skip_rows = 3000;
+  in_args.num_rows  = 10;
+  in_args.row_mask  = cudf::slice(static_cast<cudf::column_view>(mask), {0, 10})[0];
+  result            = cudf_io::read_orc(in_args);
+  column_wrapper<int32_t> expected_range{3007};
+  cudf::test::expect_columns_equal(expected_range, result.tbl->get_column(0));
+}
+
 TEST_F(OrcWriterTest, negTimestampsNano)
 {
   // This is a separate test because ORC format has a bug where writing a timestamp between -1 and 0
@@ -644,6 +834,230 @@ TEST_F(OrcChunkedWriterTest, ReadStripesError)
   EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
 }
 
+TEST_F(OrcChunkedWriterTest, ReadStripesWithFilter)
+{
+  // Three stripes holding the ranges [0, 10), [10, 20) and [20, 30)
+  std::vector<std::unique_ptr<table>> tables;
+  for (int i = 0; i < 3; ++i) {
+    auto values =
+      cudf::test::make_counting_transform_iterator(10 * i, [](auto row) { return row; });
+    cudf::test::fixed_width_column_wrapper<int> col(values, values + 10);
+    std::vector<std::unique_ptr<column>> cols;
+    cols.push_back(col.release());
+    tables.push_back(std::make_unique<table>(std::move(cols)));
+  }
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedStripesFilter.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  for (auto const& t : tables) { cudf_io::write_orc_chunked(*t, state); }
+  cudf_io::write_orc_chunked_end(state);
+
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.filter = cudf_io::stats_filter("_col0", cudf_io::filter_op::GREATER_EQUAL, 15);
+  auto result      = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *cudf::concatenate({*tables[1], *tables[2]}));
+
+  read_args.filter = cudf_io::stats_filter::logical_or(
+    cudf_io::stats_filter("_col0", cudf_io::filter_op::LESS, 5),
+    cudf_io::stats_filter("_col0", cudf_io::filter_op::EQUAL, 25));
+  result = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *cudf::concatenate({*tables[0], *tables[2]}));
+
+  read_args.filter      = cudf_io::stats_filter("_col0", cudf_io::filter_op::LESS, 10);
+  read_args.stripe_list = {1, 2, 0};
+  result                = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *tables[0]);
+
+  read_args.filter      = cudf_io::stats_filter("_col0", cudf_io::filter_op::GREATER, 100);
+  read_args.stripe_list = {};
+  result                = cudf_io::read_orc(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  EXPECT_EQ(result.tbl->num_columns(), 1);
+
+  read_args.filter = cudf_io::stats_filter("missing", cudf_io::filter_op::EQUAL, 1);
+  EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
+  read_args.filter   = cudf_io::stats_filter("_col0", cudf_io::filter_op::EQUAL, 1);
+  read_args.num_rows = 5;
+  EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
+}
+
+TEST_F(OrcChunkedWriterTest, ChunkedRead)
+{
+  // Four stripes of 1000 rows, with an int64 column and a string column with nulls
+  std::vector<std::unique_ptr<table>> tables;
+  for (int i = 0; i < 4; ++i) {
+    auto values =
+      cudf::test::make_counting_transform_iterator(1000 * i, [](auto row) { return row; });
+    auto strings = cudf::test::make_counting_transform_iterator(
+      1000 * i, [](auto row) { return "row" + std::to_string(row % 100); });
+    auto validity =
+      cudf::test::make_counting_transform_iterator(0, [](auto row) { return row % 3 != 0; });
+    cudf::test::fixed_width_column_wrapper<int64_t> col0(values, values + 1000);
+    cudf::test::strings_column_wrapper col1(strings, strings + 1000, validity);
+    std::vector<std::unique_ptr<column>> cols;
+    cols.push_back(col0.release());
+    cols.push_back(col1.release());
+    tables.push_back(std::make_unique<table>(std::move(cols)));
+  }
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  for (auto const& t : tables) { cudf_io::write_orc_chunked(*t, state); }
+  cudf_io::write_orc_chunked_end(state);
+
+  auto read_chunks = [](cudf_io::read_orc_chunked_args const& read_args) {
+    std::vector<std::unique_ptr<table>> chunks;
+    auto read_state = cudf_io::read_orc_chunked_begin(read_args);
+    while (cudf_io::read_orc_chunked_has_next(read_state)) {
+      chunks.push_back(std::move(cudf_io::read_orc_chunked(read_state).tbl));
+    }
+    EXPECT_THROW(cudf_io::read_orc_chunked(read_state), cudf::logic_error);
+    cudf_io::read_orc_chunked_end(read_state);
+    return chunks;
+  };
+
+  // No limit reads the whole file at once
+  cudf_io::read_orc_chunked_args read_args{cudf_io::source_info{filepath}};
+  auto chunks = read_chunks(read_args);
+  ASSERT_EQ(chunks.size(), 1u);
+  expect_tables_equal(*chunks[0],
+                      *cudf::concatenate({*tables[0], *tables[1], *tables[2], *tables[3]}));
+
+  // A limit smaller than a stripe still makes progress one stripe at a time, while the next
+  // stripe is loaded in the background
+  read_args.chunk_read_limit = 1;
+  chunks                     = read_chunks(read_args);
+  ASSERT_EQ(chunks.size(), 4u);
+  for (int i = 0; i < 4; ++i) { expect_tables_equal(*chunks[i], *tables[i]); }
+
+  read_args.stripe_list = {3, 1};
+  chunks                = read_chunks(read_args);
+  ASSERT_EQ(chunks.size(), 2u);
+  expect_tables_equal(*chunks[0], *tables[3]);
+  expect_tables_equal(*chunks[1], *tables[1]);
+
+  // Filtered-out stripes are not part of any chunk; an empty selection yields one empty table
+  read_args.stripe_list = {};
+  read_args.filter      = cudf_io::stats_filter("_col0", cudf_io::filter_op::GREATER_EQUAL, 2500);
+  chunks                = read_chunks(read_args);
+  ASSERT_EQ(chunks.size(), 2u);
+  expect_tables_equal(*chunks[0], *tables[2]);
+  expect_tables_equal(*chunks[1], *tables[3]);
+
+  read_args.filter = cudf_io::stats_filter("_col0", cudf_io::filter_op::LESS, 0);
+  chunks           = read_chunks(read_args);
+  ASSERT_EQ(chunks.size(), 1u);
+  EXPECT_EQ(chunks[0]->num_rows(), 0);
+  EXPECT_EQ(chunks[0]->num_columns(), 2);
+}
+
+TEST_F(OrcChunkedWriterTest, ReadStripesWithBloomFilter)
+{
+  // Three stripes holding the even values of [0, 20), [20, 40) and [40, 60), as integers and
+  // strings; the last column has no bloom filter
+  std::vector<std::unique_ptr<table>> tables;
+  for (int i = 0; i < 3; ++i) {
+    auto values =
+      cudf::test::make_counting_transform_iterator(10 * i, [](auto row) { return 2 * row; });
+    std::vector<std::string> strings;
+    for (int row = 0; row < 10; ++row) { strings.push_back("s" + std::to_string(values[row])); }
+    cudf::test::fixed_width_column_wrapper<int> col0(values, values + 10);
+    cudf::test::strings_column_wrapper col1(strings.begin(), strings.end());
+    cudf::test::fixed_width_column_wrapper<int> col2(values, values + 10);
+    std::vector<std::unique_ptr<column>> cols;
+    cols.push_back(col0.release());
+    cols.push_back(col1.release());
+    cols.push_back(col2.release());
+    tables.push_back(std::make_unique<table>(std::move(cols)));
+  }
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedStripesBloomFilter.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  args.bloom_filter_columns = {true, true, false};
+  auto state                = cudf_io::write_orc_chunked_begin(args);
+  for (auto const& t : tables) { cudf_io::write_orc_chunked(*t, state); }
+  cudf_io::write_orc_chunked_end(state);
+
+  // Odd values are within the min/max of the second stripe, but absent from its filters
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.filter = cudf_io::stats_filter("_col0", cudf_io::filter_op::EQUAL, 23);
+  auto result      = cudf_io::read_orc(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  read_args.filter = cudf_io::stats_filter("_col1", cudf_io::filter_op::EQUAL, "s23");
+  result           = cudf_io::read_orc(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  read_args.filter = cudf_io::stats_filter("_col0", cudf_io::filter_op::EQUAL, 24);
+  result           = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *tables[1]);
+  read_args.filter = cudf_io::stats_filter("_col1", cudf_io::filter_op::EQUAL, "s24");
+  result           = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *tables[1]);
+  read_args.filter = cudf_io::stats_filter("_col2", cudf_io::filter_op::EQUAL, 23);
+  result           = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *tables[1]);
+
+  // The bloom filter streams are skipped when reading the data
+  read_args.filter = {};
+  result           = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *cudf::concatenate({*tables[0], *tables[1], *tables[2]}));
+}
+
+TEST_F(OrcWriterTest, ReadStatistics)
+{
+  auto values   = cudf::test::make_counting_transform_iterator(0, [](auto row) { return row; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+  column_wrapper<int> col0(values, values + 4);
+  cudf::test::strings_column_wrapper col1({"delta", "alpha", "echo", "bravo"}, validity);
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("ints");
+  expected_metadata.column_names.emplace_back("strings");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("OrcReadStatistics.orc");
+  cudf_io::write_orc_args out_args{
+    cudf_io::sink_info{filepath}, expected->view(), &expected_metadata};
+  cudf_io::write_orc(out_args);
+
+  auto const result = cudf_io::read_orc_statistics(cudf_io::source_info{filepath});
+  ASSERT_EQ(result.size(), 1u);
+  auto const& md = result[0];
+  EXPECT_EQ(md.num_rows, 4);
+  EXPECT_EQ(md.column_names, expected_metadata.column_names);
+  ASSERT_EQ(md.column_types.size(), 2u);
+  EXPECT_EQ(md.column_types[0].id(), cudf::type_id::INT32);
+  EXPECT_EQ(md.column_types[1].id(), cudf::type_id::STRING);
+
+  auto check_statistics = [](std::vector<cudf_io::column_statistics> const& stats) {
+    ASSERT_EQ(stats.size(), 2u);
+    EXPECT_EQ(stats[0].name, "ints");
+    EXPECT_EQ(stats[0].num_values, 4);
+    EXPECT_EQ(stats[0].null_count, 0);
+    ASSERT_EQ(stats[0].kind, cudf_io::column_statistics::value_kind::SIGNED);
+    EXPECT_EQ(stats[0].i_min, 0);
+    EXPECT_EQ(stats[0].i_max, 3);
+    EXPECT_EQ(stats[1].name, "strings");
+    EXPECT_EQ(stats[1].null_count, 1);
+    ASSERT_EQ(stats[1].kind, cudf_io::column_statistics::value_kind::STRING);
+    EXPECT_EQ(stats[1].s_min, "alpha");
+    EXPECT_EQ(stats[1].s_max, "delta");
+  };
+  check_statistics(md.columns);
+  ASSERT_EQ(md.blocks.size(), 1u);
+  EXPECT_EQ(md.blocks[0].first_row, 0);
+  EXPECT_EQ(md.blocks[0].num_rows, 4);
+  EXPECT_GT(md.blocks[0].offset, 0);
+  EXPECT_GT(md.blocks[0].size, 0);
+  check_statistics(md.blocks[0].columns);
+}
+
 TYPED_TEST(OrcChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+cudf::test::TempDirTestEnvironment* const temp_env =
+  static_cast<cudf::test::TempDirTestEnvironment*>(
+    ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct PackedTest : public cudf::test::BaseFixture {
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 0}};
+  cudf::test::strings_column_wrapper strings{{"a", "", "hello", "cuDF", "x"}, {1, 1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<double> doubles{0.5, 1.5, 2.5, 3.5, 4.5};
+
+  cudf::table_view input() const { return cudf::table_view{{ints, strings, doubles}}; }
+};
+
+/**
+ * @brief Host buffer sink without device writes, to stage through host memory
+ */
+class host_only_sink : public cudf_io::data_sink {
+ public:
+  void host_write(void const* data, size_t size) override
+  {
+    auto const bytes = static_cast<char const*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+  }
+  void flush() override {}
+  size_t bytes_written() override { return buffer.size(); }
+
+  std::vector<char> buffer;
+};
+
+TEST_F(PackedTest, FileRoundTrip)
+{
+  auto const filepath = temp_env->get_temp_filepath("PackedFileRoundTrip.cudfpack");
+  cudf_io::write_packed(cudf_io::write_packed_args{cudf_io::sink_info{filepath}, input()});
+
+  auto const packed =
+    cudf_io::read_packed(cudf_io::read_packed_args{cudf_io::source_info{filepath}});
+  cudf::test::expect_tables_equal(input(), cudf::unpack(packed));
+}
+
+TEST_F(PackedTest, HostBufferRoundTrip)
+{
+  host_only_sink sink;
+  auto const packed_input = cudf::pack(input());
+  cudf_io::write_packed(cudf_io::write_packed_args{cudf_io::sink_info{&sink}, packed_input});
+
+  // The data starts on a 4KB boundary after the header and the metadata
+  EXPECT_EQ(sink.buffer.size(), 4096 + packed_input.gpu_data->size());
+
+  auto const packed = cudf_io::read_packed(
+    cudf_io::read_packed_args{cudf_io::source_info{sink.buffer.data(), sink.buffer.size()}});
+  cudf::test::expect_tables_equal(input(), cudf::unpack(packed));
+}
+
+TEST_F(PackedTest, InvalidFile)
+{
+  std::string const not_packed(8192, 'x');
+  EXPECT_THROW(cudf_io::read_packed(cudf_io::read_packed_args{
+                 cudf_io::source_info{not_packed.data(), not_packed.size()}}),
+               cudf::logic_error);
+
+  std::vector<char> buffer;
+  cudf_io::write_packed(cudf_io::write_packed_args{cudf_io::sink_info{&buffer}, input()});
+  buffer.resize(buffer.size() - 1);
+  EXPECT_THROW(cudf_io::read_packed(
+                 cudf_io::read_packed_args{cudf_io::source_info{buffer.data(), buffer.size()}}),
+               cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -20,15 +20,22 @@
 #include <tests/utilities/cudf_gtest.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/functions.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
 #include <fstream>
+#include <limits>
 #include <type_traits>
 
 namespace cudf_io = cudf::io;
@@ -375,6 +382,392 @@ TEST_F(ParquetWriterTest, MultiColumnWithNulls)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(ParquetWriterTest, DeltaBinaryPacked)
+{
+  constexpr auto num_rows = 50000;
+
+  // Monotonic IDs, sorted event times with nulls, and random values spanning the full range
+  auto ids = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (int64_t{1} << 40) + i * 3; });
+  auto times = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return cudf::timestamp_ms{1577836800000 + i * 1000 + i % 7}; });
+  auto times_valid =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  auto int32_data = random_values<int32_t>(num_rows);
+  auto int16_data = random_values<int16_t>(num_rows);
+  int32_data[0]   = std::numeric_limits<int32_t>::max();
+  int32_data[1]   = std::numeric_limits<int32_t>::min();
+  int32_data[2]   = std::numeric_limits<int32_t>::max();
+
+  column_wrapper<int64_t> col0(ids, ids + num_rows);
+  column_wrapper<cudf::timestamp_ms> col1(times, times + num_rows, times_valid);
+  column_wrapper<int32_t> col2(int32_data.begin(), int32_data.end());
+  column_wrapper<int16_t> col3(int16_data.begin(), int16_data.end());
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  cols.push_back(col3.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> plain_buffer;
+  cudf_io::write_parquet_args plain_args{cudf_io::sink_info(&plain_buffer),
+                                         expected->select({0, 1}),
+                                         nullptr,
+                                         cudf_io::compression_type::NONE};
+  cudf_io::write_parquet(plain_args);
+
+  std::vector<char> delta_buffer;
+  cudf_io::write_parquet_args delta_args{cudf_io::sink_info(&delta_buffer),
+                                         expected->view(),
+                                         nullptr,
+                                         cudf_io::compression_type::NONE};
+  delta_args.delta_encoding = true;
+  cudf_io::write_parquet(delta_args);
+
+  cudf_io::read_parquet_args in_args{
+    cudf_io::source_info(delta_buffer.data(), delta_buffer.size())};
+  auto result = cudf_io::read_parquet(in_args);
+  expect_tables_equal(expected->view(), result.tbl->view());
+
+  // The monotonic columns take a fraction of their PLAIN size
+  std::vector<char> sorted_buffer;
+  delta_args.sink  = cudf_io::sink_info(&sorted_buffer);
+  delta_args.table = expected->select({0, 1});
+  cudf_io::write_parquet(delta_args);
+  EXPECT_LT(sorted_buffer.size() * 4, plain_buffer.size());
+}
+
+TEST_F(ParquetWriterTest, PageSizeAndEncodingOptions)
+{
+  constexpr auto num_rows = 100000;
+
+  // Few distinct values, then many: a small dictionary limit makes the chunks switch to PLAIN
+  auto low_card  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 10; });
+  auto high_card = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (i < num_rows / 4) ? int64_t{i % 100} : int64_t{i} * 7919; });
+  auto sorted = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 2; });
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+
+  column_wrapper<int32_t> col0(low_card, low_card + num_rows);
+  column_wrapper<int64_t> col1(high_card, high_card + num_rows, valids);
+  column_wrapper<int32_t> col2(sorted, sorted + num_rows);
+  column_wrapper<int32_t> col3(low_card, low_card + num_rows, valids);
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  cols.push_back(col3.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer),
+                                       expected->view(),
+                                       nullptr,
+                                       cudf_io::compression_type::NONE};
+  out_args.max_page_size       = 64 * 1024;
+  out_args.max_dictionary_size = 4 * 1024;
+  out_args.column_encodings    = {cudf_io::column_encoding::PLAIN,
+                               cudf_io::column_encoding::DICTIONARY,
+                               cudf_io::column_encoding::DELTA_BINARY_PACKED,
+                               cudf_io::column_encoding::USE_DEFAULT};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  auto result = cudf_io::read_parquet(in_args);
+  expect_tables_equal(expected->view(), result.tbl->view());
+
+  // Writing the low-cardinality column PLAIN costs more than the default dictionary encoding
+  std::vector<char> default_buffer;
+  std::vector<char> plain_buffer;
+  cudf_io::write_parquet_args default_args{cudf_io::sink_info(&default_buffer),
+                                           expected->select({0}),
+                                           nullptr,
+                                           cudf_io::compression_type::NONE};
+  cudf_io::write_parquet(default_args);
+  default_args.sink             = cudf_io::sink_info(&plain_buffer);
+  default_args.column_encodings = {cudf_io::column_encoding::PLAIN};
+  cudf_io::write_parquet(default_args);
+  EXPECT_GT(plain_buffer.size(), default_buffer.size() * 2);
+
+  // Encodings must be given for all columns, and delta encoding requires integers
+  out_args.column_encodings = {cudf_io::column_encoding::PLAIN};
+  EXPECT_THROW(cudf_io::write_parquet(out_args), cudf::logic_error);
+  std::vector<char> strings_buffer;
+  cudf::test::strings_column_wrapper strings{"a", "b", "c"};
+  cudf_io::write_parquet_args strings_args{cudf_io::sink_info(&strings_buffer),
+                                           cudf::table_view{{strings}}};
+  strings_args.column_encodings = {cudf_io::column_encoding::DELTA_BINARY_PACKED};
+  EXPECT_THROW(cudf_io::write_parquet(strings_args), cudf::logic_error);
+  out_args.column_encodings.clear();
+  out_args.max_page_size = 0;
+  EXPECT_THROW(cudf_io::write_parquet(out_args), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, PageIndex)
+{
+  constexpr auto num_rows = 100000;
+
+  auto ids    = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  column_wrapper<int32_t> col0(ids, ids + num_rows);
+  column_wrapper<double> col1(values, values + num_rows, valids);
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  // Page statistics are written as the page index of each chunk
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer),
+                                       expected->view(),
+                                       nullptr,
+                                       cudf_io::compression_type::NONE,
+                                       cudf_io::statistics_freq::STATISTICS_PAGE};
+  out_args.max_page_size = 16 * 1024;
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  auto result = cudf_io::read_parquet(in_args);
+  expect_tables_equal(expected->view(), result.tbl->view());
+
+  // Row ranges only read the pages that hold them
+  in_args.skip_rows = 30011;
+  in_args.num_rows  = 20000;
+  result            = cudf_io::read_parquet(in_args);
+  expect_tables_equal(cudf::slice(expected->view(), {30011, 50011})[0], result.tbl->view());
+
+  // A filter on the sorted column selects the pages that may hold matching rows
+  in_args.skip_rows = 0;
+  in_args.num_rows  = -1;
+  in_args.filter    = cudf_io::stats_filter::logical_and(
+    cudf_io::stats_filter("_col0", cudf_io::filter_op::GREATER_EQUAL, 40000),
+    cudf_io::stats_filter("_col0", cudf_io::filter_op::LESS, 40100));
+  result = cudf_io::read_parquet(in_args);
+  EXPECT_GE(result.tbl->num_rows(), 100);
+  EXPECT_LT(result.tbl->num_rows(), num_rows / 4);
+  auto const first_id = cudf::test::to_host<int32_t>(result.tbl->get_column(0)).first[0];
+  EXPECT_LE(first_id, 40000);
+  EXPECT_GE(first_id + result.tbl->num_rows(), 40100);
+  expect_tables_equal(
+    cudf::slice(expected->view(), {first_id, first_id + result.tbl->num_rows()})[0],
+    result.tbl->view());
+
+  in_args.filter = cudf_io::stats_filter("_col0", cudf_io::filter_op::LESS, 0);
+  result         = cudf_io::read_parquet(in_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+}
+
+TEST_F(ParquetWriterTest, RowMask)
+{
+  constexpr auto num_rows = 100000;
+
+  auto ids    = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  column_wrapper<int32_t> col0(ids, ids + num_rows);
+  column_wrapper<double> col1(values, values + num_rows, valids);
+  auto expected = table_view{{col0, col1}};
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer),
+                                       expected,
+                                       nullptr,
+                                       cudf_io::compression_type::NONE,
+                                       cudf_io::statistics_freq::STATISTICS_PAGE};
+  out_args.max_page_size = 16 * 1024;
+  cudf_io::write_parquet(out_args);
+
+  // Rows in two narrow ranges, and a null mask row that is not selected
+  auto selected = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (i >= 1000 && i < 1010) || (i >= 70000 && i < 70005 && i % 2 == 0); });
+  auto mask_valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 1005; });
+  column_wrapper<bool> mask(selected, selected + num_rows, mask_valids);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  in_args.row_mask = mask;
+  auto result      = cudf_io::read_parquet(in_args);
+
+  EXPECT_EQ(result.tbl->num_rows(), 12);
+  auto const rows = cudf::test::to_host<int32_t>(result.tbl->get_column(0)).first;
+  std::vector<int32_t> const expected_rows{
+    1000, 1001, 1002, 1003, 1004, 1006, 1007, 1008, 1009, 70000, 70002, 70004};
+  EXPECT_EQ(rows, expected_rows);
+
+  // A mask of the rows of a row range
+  in_args.skip_rows = 50000;
+  in_args.num_rows  = 100;
+  in_args.row_mask  = cudf::slice(static_cast<cudf::column_view>(mask), {69950, 70050})[0];
+  result            = cudf_io::read_parquet(in_args);
+  EXPECT_EQ(cudf::test::to_host<int32_t>(result.tbl->get_column(0)).first,
+            (std::vector<int32_t>{50050, 50052, 50054}));
+
+  // No selected row
+  in_args.skip_rows = -1;
+  in_args.num_rows  = -1;
+  auto no_rows = cudf::test::make_counting_transform_iterator(0, [](auto) { return false; });
+  column_wrapper<bool> none(no_rows, no_rows + num_rows);
+  in_args.row_mask = none;
+  result           = cudf_io::read_parquet(in_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  EXPECT_EQ(result.tbl->num_columns(), 2);
+}
+
+TEST_F(ParquetWriterTest, Lists)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  using SCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 2 == 0; });
+  auto row_valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 3; });
+
+  // Null elements, empty lists and null lists
+  LCW col0({{1, 2, 3}, {{4, 5}, valids}, LCW{}, LCW{}, {6}, {7, 8, 9, 10}}, row_valids);
+  SCW col1{{"Monday", "Friday"}, {"Funday"}, SCW{}, {"a", "b", "c"}, {"Sunday"}, {"d"}};
+  column_wrapper<int32_t> col2{0, 1, 2, 3, 4, 5};
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("int_list");
+  expected_metadata.column_names.emplace_back("string_list");
+  expected_metadata.column_names.emplace_back("ints");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("Lists.parquet");
+  cudf_io::write_parquet_args out_args{
+    cudf_io::sink_info{filepath}, expected->view(), &expected_metadata};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  ASSERT_EQ(3, result.tbl->num_columns());
+  for (cudf::size_type i = 0; i < expected->num_columns(); i++) {
+    cudf::test::expect_columns_equivalent(expected->get_column(i), result.tbl->get_column(i));
+  }
+  EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
+
+  // Row ranges select whole lists
+  in_args.skip_rows = 1;
+  in_args.num_rows  = 3;
+  result            = cudf_io::read_parquet(in_args);
+  auto slice_valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+  LCW expected_slice({{{4, 5}, valids}, LCW{}, LCW{}}, slice_valids);
+  cudf::test::expect_columns_equivalent(expected_slice, result.tbl->get_column(0));
+}
+
+TEST_F(ParquetWriterTest, ListLargerThanFragment)
+{
+  // A single list holds more values than a dictionary-encoded page fragment
+  constexpr cudf::size_type num_rows      = 2001;
+  constexpr cudf::size_type long_row      = 1000;
+  constexpr cudf::size_type long_row_size = 6000;
+  constexpr cudf::size_type num_values    = (num_rows - 1) * 3 + long_row_size;
+
+  auto offsets = cudf::test::make_counting_transform_iterator(0, [=](auto i) {
+    return (i <= long_row) ? i * 3 : (i - 1) * 3 + long_row_size;
+  });
+  auto values  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  column_wrapper<cudf::size_type> col0_offsets(offsets, offsets + num_rows + 1);
+  column_wrapper<int32_t> col0_values(values, values + num_values);
+  auto col0 = cudf::make_lists_column(
+    num_rows, col0_offsets.release(), col0_values.release(), 0, rmm::device_buffer{});
+
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> col1(sequence, sequence + num_rows);
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("int_list");
+  expected_metadata.column_names.emplace_back("ints");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(std::move(col0));
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("ListLargerThanFragment.parquet");
+  cudf_io::write_parquet_args out_args{
+    cudf_io::sink_info{filepath}, expected->view(), &expected_metadata};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  ASSERT_EQ(2, result.tbl->num_columns());
+  for (cudf::size_type i = 0; i < expected->num_columns(); i++) {
+    cudf::test::expect_columns_equivalent(expected->get_column(i), result.tbl->get_column(i));
+  }
+  EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
+}
+
+TEST_F(ParquetWriterTest, Structs)
+{
+  // The fields are null where their struct is null
+  auto struct_valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+  auto field_valids =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 2 && i != 3; });
+  column_wrapper<int32_t> field0({1, 2, 3, 4, 5}, field_valids);
+  cudf::test::strings_column_wrapper field1({"a", "bb", "", "dddd", "e"}, struct_valids);
+  column_wrapper<double> nested_field0({0.5, 1.5, 2.5, 3.5, 4.5}, struct_valids);
+  std::vector<std::unique_ptr<column>> nested_fields;
+  nested_fields.push_back(nested_field0.release());
+  std::vector<std::unique_ptr<column>> fields;
+  fields.push_back(field0.release());
+  fields.push_back(field1.release());
+  fields.push_back(cudf::make_structs_column(5, std::move(nested_fields), 0, {}));
+  auto struct_mask = cudf::test::detail::make_null_mask(struct_valids, struct_valids + 5);
+  auto col0 = cudf::make_structs_column(5, std::move(fields), 1, std::move(struct_mask));
+  column_wrapper<int32_t> col1{0, 1, 2, 3, 4};
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("struct");
+  expected_metadata.column_names.emplace_back("ints");
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(std::move(col0));
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("Structs.parquet");
+  cudf_io::write_parquet_args out_args{
+    cudf_io::sink_info{filepath}, expected->view(), &expected_metadata};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  ASSERT_EQ(2, result.tbl->num_columns());
+  for (cudf::size_type i = 0; i < expected->num_columns(); i++) {
+    cudf::test::expect_columns_equivalent(expected->get_column(i), result.tbl->get_column(i));
+  }
+  EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
+
+  // The name of a struct selects all of its fields
+  in_args.columns = {"struct"};
+  result          = cudf_io::read_parquet(in_args);
+  ASSERT_EQ(1, result.tbl->num_columns());
+  cudf::test::expect_columns_equivalent(expected->get_column(0), result.tbl->get_column(0));
+
+  // Row ranges select whole structs
+  in_args.skip_rows = 1;
+  in_args.num_rows  = 3;
+  result            = cudf_io::read_parquet(in_args);
+  auto const expected_slice = cudf::slice(expected->get_column(0), {1, 4}).front();
+  cudf::test::expect_columns_equivalent(expected_slice, result.tbl->get_column(0));
+}
+
 TEST_F(ParquetWriterTest, Strings)
 {
   std::vector<const char*> strings{
@@ -413,6 +806,61 @@ TEST_F(ParquetWriterTest, Strings)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(ParquetWriterTest, StringsAcrossPages)
+{
+  constexpr auto num_rows = 20000;
+
+  // Variable-length strings, including empty and null ones, over many pages
+  auto strings = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 13, static_cast<char>('a' + i % 26)); });
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  column_wrapper<cudf::string_view> col0(strings, strings + num_rows, valids);
+  column_wrapper<cudf::string_view> col1(strings, strings + num_rows);
+  auto expected = table_view{{col0, col1}};
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info(&out_buffer), expected};
+  out_args.max_page_size    = 4 * 1024;
+  out_args.column_encodings = {cudf_io::column_encoding::PLAIN,
+                               cudf_io::column_encoding::DICTIONARY};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  auto result = cudf_io::read_parquet(in_args);
+  expect_tables_equal(expected, result.tbl->view());
+
+  // Rows cropped within the first and last pages
+  in_args.skip_rows = 1234;
+  in_args.num_rows  = 15000;
+  result            = cudf_io::read_parquet(in_args);
+  expect_tables_equal(cudf::slice(expected, {1234, 16234})[0], result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, StringsToDictionary)
+{
+  std::vector<const char*> strings{
+    "Monday", "Monday", "Friday", "Monday", "Friday", "Friday", "Friday", "Funday"};
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 3; });
+  column_wrapper<cudf::string_view> col{strings.begin(), strings.end(), validity};
+  auto expected = table_view{{col}};
+
+  auto filepath = temp_env->get_temp_filepath("StringsToDictionary.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.strings_to_dictionary = true;
+  auto result = cudf_io::read_parquet(in_args);
+
+  auto const& dictionary = result.tbl->view().column(0);
+  EXPECT_EQ(cudf::type_id::DICTIONARY32, dictionary.type().id());
+  EXPECT_EQ(3, cudf::dictionary_column_view(dictionary).keys_size());
+  expect_columns_equal(col, cudf::dictionary::decode(dictionary)->view());
+
+  in_args.strings_to_categorical = true;
+  EXPECT_THROW(cudf_io::read_parquet(in_args), cudf::logic_error);
+}
+
 TEST_F(ParquetWriterTest, MultiIndex)
 {
   constexpr auto num_rows = 100;
@@ -489,6 +937,87 @@ TEST_F(ParquetWriterTest, HostBuffer)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(ParquetWriterTest, Partitioned)
+{
+  column_wrapper<int> keys{2, 0, 2, 1, 0, 2};
+  cudf::test::strings_column_wrapper names{"a", "b", "c", "d", "e", "f"};
+  column_wrapper<int> values{10, 11, 12, 13, 14, 15};
+  cudf::table_view input{{keys, names, values}};
+
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"key", "name", "value"};
+
+  std::vector<std::vector<char>> buffers;
+  cudf_io::write_parquet_partitioned_args args;
+  args.table             = input;
+  args.partition_columns = {0};
+  args.metadata          = &metadata;
+  args.sink_factory      = [&](cudf::size_type partition, cudf::table_view const& partition_keys) {
+    EXPECT_EQ(static_cast<size_t>(partition), buffers.size());
+    EXPECT_EQ(partition_keys.num_rows(), 3);
+    buffers.emplace_back();
+    return cudf_io::sink_info(&buffers.back());
+  };
+  buffers.reserve(3);
+  auto const partition_keys = cudf_io::write_parquet_partitioned(args);
+
+  column_wrapper<int> expected_keys{0, 1, 2};
+  cudf::test::expect_columns_equal(partition_keys->get_column(0), expected_keys);
+  ASSERT_EQ(buffers.size(), 3u);
+
+  // The order of the rows within a partition is unspecified
+  std::vector<std::vector<int>> expected_values{{11, 14}, {13}, {10, 12, 15}};
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    cudf_io::read_parquet_args in_args{
+      cudf_io::source_info(buffers[i].data(), buffers[i].size())};
+    auto const result = cudf_io::read_parquet(in_args);
+    EXPECT_EQ(result.metadata.column_names, std::vector<std::string>({"name", "value"}));
+    auto const sorted = cudf::sort(cudf::table_view{{result.tbl->get_column(1)}});
+    column_wrapper<int> expected(expected_values[i].begin(), expected_values[i].end());
+    cudf::test::expect_columns_equal(sorted->get_column(0), expected);
+  }
+}
+
+TEST_F(ParquetWriterTest, PartitionedClustering)
+{
+  column_wrapper<int> keys{2, 0, 2, 1, 0, 2};
+  column_wrapper<int> values{15, 14, 12, 13, 11, 10};
+  column_wrapper<int> other{0, 1, 2, 3, 4, 5};
+  cudf::table_view input{{keys, values, other}};
+
+  // The options refer to the columns of the input table, including the partition column
+  std::vector<std::vector<char>> buffers;
+  cudf_io::write_parquet_partitioned_args args;
+  args.table                = input;
+  args.partition_columns    = {0};
+  args.bloom_filter_columns = {false, true, false};
+  args.column_encodings     = {cudf_io::column_encoding::USE_DEFAULT,
+                               cudf_io::column_encoding::PLAIN,
+                               cudf_io::column_encoding::USE_DEFAULT};
+  args.clustering           = cudf_io::row_clustering::SORT;
+  args.clustering_columns   = {0, 1};
+  args.sink_factory         = [&](cudf::size_type, cudf::table_view const&) {
+    buffers.emplace_back();
+    return cudf_io::sink_info(&buffers.back());
+  };
+  buffers.reserve(3);
+  cudf_io::write_parquet_partitioned(args);
+  ASSERT_EQ(buffers.size(), 3u);
+
+  // The rows of each partition are sorted by value
+  std::vector<std::vector<int>> expected_values{{11, 14}, {13}, {10, 12, 15}};
+  std::vector<std::vector<int>> expected_other{{4, 1}, {3}, {5, 2, 0}};
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    cudf_io::read_parquet_args in_args{
+      cudf_io::source_info(buffers[i].data(), buffers[i].size())};
+    auto const result = cudf_io::read_parquet(in_args);
+    column_wrapper<int> expected0(expected_values[i].begin(), expected_values[i].end());
+    column_wrapper<int> expected1(expected_other[i].begin(), expected_other[i].end());
+    cudf::test::expect_columns_equal(result.tbl->get_column(0), expected0);
+    cudf::test::expect_columns_equal(result.tbl->get_column(1), expected1);
+  }
+}
+
 TEST_F(ParquetWriterTest, NonNullable)
 {
   srand(31337);
@@ -620,6 +1149,128 @@ TEST_F(ParquetWriterTest, MultipleMismatchedSources)
   }
 }
 
+TEST_F(ParquetWriterTest, Metrics)
+{
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  column_wrapper<int> col(sequence, sequence + 10000);
+  auto expected = table_view{{col}};
+
+  auto filepath = temp_env->get_temp_filepath("Metrics.parquet");
+  cudf_io::io_metrics write_metrics;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected};
+  out_args.compression = cudf_io::compression_type::SNAPPY;
+  out_args.metrics     = &write_metrics;
+  cudf_io::write_parquet(out_args);
+  EXPECT_GT(write_metrics.bytes_written, 0u);
+  EXPECT_EQ(1u, write_metrics.codecs.count("SNAPPY"));
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  EXPECT_EQ(nullptr, cudf_io::read_parquet(in_args).metrics);
+
+  in_args.collect_metrics = true;
+  auto result             = cudf_io::read_parquet(in_args);
+  expect_tables_equal(expected, result.tbl->view());
+  ASSERT_NE(nullptr, result.metrics);
+  EXPECT_GT(result.metrics->bytes_read, 0u);
+  EXPECT_LE(result.metrics->bytes_read, write_metrics.bytes_written);
+  EXPECT_EQ(1u, result.metrics->row_groups_read);
+  EXPECT_EQ(0u, result.metrics->row_groups_skipped);
+}
+
+TEST_F(ParquetWriterTest, MetadataCache)
+{
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int> col(sequence, sequence + 1000);
+  auto expected = table_view{{col}};
+
+  auto filepath = temp_env->get_temp_filepath("MetadataCache.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.use_metadata_cache = true;
+  expect_tables_equal(expected, cudf_io::read_parquet(in_args).tbl->view());
+  expect_tables_equal(expected, cudf_io::read_parquet(in_args).tbl->view());
+
+  // Rewriting the file invalidates its cached footer
+  column_wrapper<int> col2(sequence, sequence + 500);
+  auto expected2 = table_view{{col2}};
+  cudf_io::write_parquet_args out_args2{cudf_io::sink_info{filepath}, expected2};
+  cudf_io::write_parquet(out_args2);
+  expect_tables_equal(expected2, cudf_io::read_parquet(in_args).tbl->view());
+}
+
+TEST_F(ParquetWriterTest, SortClustering)
+{
+  auto keys =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return (i * 7919) % 1000; });
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 2.5; });
+  column_wrapper<int> col0(keys, keys + 1000);
+  column_wrapper<double> col1(values, values + 1000);
+  auto input = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("SortClustering.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, input};
+  out_args.clustering         = cudf_io::row_clustering::SORT;
+  out_args.clustering_columns = {0};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result   = cudf_io::read_parquet(in_args);
+  auto expected = cudf::sort_by_key(input, table_view{{col0}});
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, ZOrderClustering)
+{
+  // A 4x4 grid, written in reverse Z-order; the first column holds the most significant bit of
+  // each pair of interleaved bits
+  std::vector<int> grid_x{0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 3, 3, 2, 2, 3, 3};
+  std::vector<int64_t> grid_y{0, 1, 0, 1, 2, 3, 2, 3, 0, 1, 0, 1, 2, 3, 2, 3};
+  std::vector<int> x;
+  std::vector<int64_t> y;
+  for (size_t i = 0; i < grid_x.size(); ++i) {
+    x.push_back(grid_x[i] + 100);
+    y.push_back(grid_y[i] - 2);
+  }
+  column_wrapper<int> expected_x(x.begin(), x.end());
+  column_wrapper<int64_t> expected_y(y.begin(), y.end());
+  column_wrapper<int> input_x(x.rbegin(), x.rend());
+  column_wrapper<int64_t> input_y(y.rbegin(), y.rend());
+
+  auto filepath = temp_env->get_temp_filepath("ZOrderClustering.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath},
+                                       table_view{{input_x, input_y}}};
+  out_args.clustering         = cudf_io::row_clustering::Z_ORDER;
+  out_args.clustering_columns = {0, 1};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(in_args);
+  expect_tables_equal(table_view{{expected_x, expected_y}}, result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, ClusteringErrors)
+{
+  column_wrapper<int> col0{3, 1, 2};
+  cudf::test::strings_column_wrapper col1{"c", "a", "b"};
+  auto input = table_view{{col0, col1}};
+
+  std::vector<char> out_buffer;
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{&out_buffer}, input};
+  out_args.clustering = cudf_io::row_clustering::SORT;
+  EXPECT_THROW(cudf_io::write_parquet(out_args), cudf::logic_error);
+
+  out_args.clustering_columns = {2};
+  EXPECT_THROW(cudf_io::write_parquet(out_args), cudf::logic_error);
+
+  // Strings can be sorted but not interleaved
+  out_args.clustering_columns = {1};
+  EXPECT_NO_THROW(cudf_io::write_parquet(out_args));
+  out_args.clustering = cudf_io::row_clustering::Z_ORDER;
+  EXPECT_THROW(cudf_io::write_parquet(out_args), cudf::logic_error);
+}
+
 TEST_F(ParquetChunkedWriterTest, SingleTable)
 {
   srand(31337);
@@ -709,6 +1360,30 @@ TEST_F(ParquetChunkedWriterTest, ManyTables)
   expect_tables_equal(*result.tbl, *expected);
 }
 
+TEST_F(ParquetChunkedWriterTest, ReadManyFiles)
+{
+  srand(31337);
+  std::vector<std::unique_ptr<table>> tables;
+  std::vector<table_view> table_views;
+  std::vector<std::string> filepaths;
+  constexpr int num_files = 64;
+  for (int idx = 0; idx < num_files; idx++) {
+    auto tbl      = create_random_fixed_table<int>(4, 32, true);
+    auto filepath = temp_env->get_temp_filepath("ReadManyFiles" + std::to_string(idx) + ".parquet");
+    cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, *tbl};
+    cudf_io::write_parquet(args);
+    table_views.push_back(*tbl);
+    tables.push_back(std::move(tbl));
+    filepaths.push_back(filepath);
+  }
+
+  // the files are opened and their footers parsed in parallel, then decoded together
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepaths}};
+  auto result = cudf_io::read_parquet(read_args);
+
+  expect_tables_equal(*result.tbl, *cudf::concatenate(table_views));
+}
+
 TEST_F(ParquetChunkedWriterTest, Strings)
 {
   std::vector<std::unique_ptr<cudf::column>> cols;
@@ -810,6 +1485,264 @@ TEST_F(ParquetChunkedWriterTest, ReadRowGroupsError)
   EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
 }
 
+TEST_F(ParquetChunkedWriterTest, ReadRowGroupsWithFilter)
+{
+  // Three row groups holding the ranges [0, 10), [10, 20) and [20, 30)
+  std::vector<std::unique_ptr<table>> tables;
+  for (int i = 0; i < 3; ++i) {
+    auto values =
+      cudf::test::make_counting_transform_iterator(10 * i, [](auto row) { return row; });
+    cudf::test::fixed_width_column_wrapper<int> col(values, values + 10);
+    std::vector<std::unique_ptr<column>> cols;
+    cols.push_back(col.release());
+    tables.push_back(std::make_unique<table>(std::move(cols)));
+  }
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRowGroupsFilter.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  for (auto const& t : tables) { cudf_io::write_parquet_chunked(*t, state); }
+  cudf_io::write_parquet_chunked_end(state);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  read_args.filter = cudf_io::stats_filter("_col0", cudf_io::filter_op::GREATER_EQUAL, 15);
+  auto result      = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *cudf::concatenate({*tables[1], *tables[2]}));
+
+  read_args.filter = cudf_io::stats_filter::logical_or(
+    cudf_io::stats_filter("_col0", cudf_io::filter_op::LESS, 5),
+    cudf_io::stats_filter("_col0", cudf_io::filter_op::EQUAL, 25));
+  result = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *cudf::concatenate({*tables[0], *tables[2]}));
+
+  read_args.filter = cudf_io::stats_filter::logical_and(
+    cudf_io::stats_filter("_col0", cudf_io::filter_op::GREATER, 5),
+    cudf_io::stats_filter("_col0", cudf_io::filter_op::LESS, 10));
+  read_args.row_groups = {{1, 2, 0}};
+  result               = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *tables[0]);
+
+  read_args.filter     = cudf_io::stats_filter("_col0", cudf_io::filter_op::GREATER, 100);
+  read_args.row_groups = {};
+  result               = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  EXPECT_EQ(result.tbl->num_columns(), 1);
+
+  read_args.filter = cudf_io::stats_filter("_col0", cudf_io::filter_op::EQUAL, "abc");
+  EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
+  read_args.filter = cudf_io::stats_filter("missing", cudf_io::filter_op::EQUAL, 1);
+  EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
+  read_args.filter   = cudf_io::stats_filter("_col0", cudf_io::filter_op::EQUAL, 1);
+  read_args.num_rows = 5;
+  EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadRowGroupsWithBloomFilter)
+{
+  // Three row groups holding the even values of [0, 20), [20, 40) and [40, 60), as integers and
+  // strings; the last column has no bloom filter
+  std::vector<std::unique_ptr<table>> tables;
+  for (int i = 0; i < 3; ++i) {
+    auto values =
+      cudf::test::make_counting_transform_iterator(10 * i, [](auto row) { return 2 * row; });
+    std::vector<std::string> strings;
+    for (int row = 0; row < 10; ++row) { strings.push_back("s" + std::to_string(values[row])); }
+    cudf::test::fixed_width_column_wrapper<int> col0(values, values + 10);
+    cudf::test::strings_column_wrapper col1(strings.begin(), strings.end());
+    cudf::test::fixed_width_column_wrapper<int> col2(values, values + 10);
+    std::vector<std::unique_ptr<column>> cols;
+    cols.push_back(col0.release());
+    cols.push_back(col1.release());
+    cols.push_back(col2.release());
+    tables.push_back(std::make_unique<table>(std::move(cols)));
+  }
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedBloomFilter.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  args.bloom_filter_columns = {true, true, false};
+  auto state                = cudf_io::write_parquet_chunked_begin(args);
+  for (auto const& t : tables) { cudf_io::write_parquet_chunked(*t, state); }
+  cudf_io::write_parquet_chunked_end(state);
+
+  // Odd values are within the min/max of the second row group, but absent from its filter
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  read_args.filter = cudf_io::stats_filter("_col0", cudf_io::filter_op::EQUAL, 23);
+  auto result      = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  read_args.filter = cudf_io::stats_filter("_col1", cudf_io::filter_op::EQUAL, "s23");
+  result           = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+
+  read_args.filter = cudf_io::stats_filter("_col0", cudf_io::filter_op::EQUAL, 24);
+  result           = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *tables[1]);
+  read_args.filter = cudf_io::stats_filter("_col1", cudf_io::filter_op::EQUAL, "s24");
+  result           = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *tables[1]);
+  read_args.filter = cudf_io::stats_filter("_col2", cudf_io::filter_op::EQUAL, 23);
+  result           = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *tables[1]);
+
+  // Other comparisons only use the statistics
+  read_args.filter = cudf_io::stats_filter("_col0", cudf_io::filter_op::NOT_EQUAL, 23);
+  result           = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *cudf::concatenate({*tables[0], *tables[1], *tables[2]}));
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadMetadata)
+{
+  // Three row groups holding the ranges [0, 10), [10, 20) and [20, 30), with nulls in the second
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 2 == 0; });
+  std::vector<std::unique_ptr<table>> tables;
+  for (int i = 0; i < 3; ++i) {
+    auto values =
+      cudf::test::make_counting_transform_iterator(10 * i, [](auto row) { return row; });
+    std::vector<std::unique_ptr<column>> cols;
+    if (i == 1) {
+      cols.push_back(
+        cudf::test::fixed_width_column_wrapper<int>(values, values + 10, valids).release());
+    } else {
+      cols.push_back(cudf::test::fixed_width_column_wrapper<int>(values, values + 10).release());
+    }
+    tables.push_back(std::make_unique<table>(std::move(cols)));
+  }
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadMetadata.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  for (auto const& t : tables) { cudf_io::write_parquet_chunked(*t, state); }
+  cudf_io::write_parquet_chunked_end(state);
+
+  auto const result = cudf_io::read_parquet_metadata(cudf_io::source_info{filepath});
+  ASSERT_EQ(result.size(), 1u);
+  auto const& md = result[0];
+  EXPECT_EQ(md.num_rows, 30);
+  EXPECT_EQ(md.column_names, std::vector<std::string>{"_col0"});
+  ASSERT_EQ(md.column_types.size(), 1u);
+  EXPECT_EQ(md.column_types[0].id(), cudf::type_id::INT32);
+  EXPECT_TRUE(md.columns.empty());
+  ASSERT_EQ(md.blocks.size(), 3u);
+  for (int i = 0; i < 3; ++i) {
+    auto const& block = md.blocks[i];
+    EXPECT_EQ(block.first_row, 10 * i);
+    EXPECT_EQ(block.num_rows, 10);
+    EXPECT_GT(block.size, 0);
+    if (i > 0) { EXPECT_GE(block.offset, md.blocks[i - 1].offset + md.blocks[i - 1].size); }
+    ASSERT_EQ(block.columns.size(), 1u);
+    auto const& stats = block.columns[0];
+    EXPECT_EQ(stats.name, "_col0");
+    EXPECT_EQ(stats.num_values, 10);
+    EXPECT_EQ(stats.null_count, (i == 1) ? 5 : 0);
+    ASSERT_EQ(stats.kind, cudf_io::column_statistics::value_kind::SIGNED);
+    EXPECT_EQ(stats.i_min, 10 * i);
+    EXPECT_EQ(stats.i_max, (i == 1) ? 18 : 10 * i + 9);
+  }
+}
+
+TEST_F(ParquetChunkedWriterTest, ChunkedRead)
+{
+  // Four uncompressed row groups of 1000 int64 rows; each needs about 16KB of device memory to
+  // read (8KB of page data and 8KB of output)
+  std::vector<std::unique_ptr<table>> tables;
+  for (int i = 0; i < 4; ++i) {
+    auto values =
+      cudf::test::make_counting_transform_iterator(1000 * i, [](auto row) { return row; });
+    cudf::test::fixed_width_column_wrapper<int64_t> col(values, values + 1000);
+    std::vector<std::unique_ptr<column>> cols;
+    cols.push_back(col.release());
+    tables.push_back(std::make_unique<table>(std::move(cols)));
+  }
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.parquet");
+  cudf_io::write_parquet_chunked_args args{
+    cudf_io::sink_info{filepath}, nullptr, cudf_io::compression_type::NONE};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  for (auto const& t : tables) { cudf_io::write_parquet_chunked(*t, state); }
+  cudf_io::write_parquet_chunked_end(state);
+
+  auto read_chunks = [](cudf_io::read_parquet_chunked_args const& read_args) {
+    std::vector<std::unique_ptr<table>> chunks;
+    auto read_state = cudf_io::read_parquet_chunked_begin(read_args);
+    while (cudf_io::read_parquet_chunked_has_next(read_state)) {
+      chunks.push_back(std::move(cudf_io::read_parquet_chunked(read_state).tbl));
+    }
+    EXPECT_THROW(cudf_io::read_parquet_chunked(read_state), cudf::logic_error);
+    cudf_io::read_parquet_chunked_end(read_state);
+    return chunks;
+  };
+
+  // No limit reads the whole file at once
+  cudf_io::read_parquet_chunked_args read_args{cudf_io::source_info{filepath}};
+  auto chunks = read_chunks(read_args);
+  ASSERT_EQ(chunks.size(), 1u);
+  expect_tables_equal(*chunks[0],
+                      *cudf::concatenate({*tables[0], *tables[1], *tables[2], *tables[3]}));
+
+  // Two row groups fit in 40KB
+  read_args.chunk_read_limit = 40000;
+  chunks                     = read_chunks(read_args);
+  ASSERT_EQ(chunks.size(), 2u);
+  expect_tables_equal(*chunks[0], *cudf::concatenate({*tables[0], *tables[1]}));
+  expect_tables_equal(*chunks[1], *cudf::concatenate({*tables[2], *tables[3]}));
+
+  // A limit smaller than a row group still makes progress one row group at a time
+  read_args.chunk_read_limit = 1;
+  read_args.row_groups       = {{3, 1}};
+  chunks                     = read_chunks(read_args);
+  ASSERT_EQ(chunks.size(), 2u);
+  expect_tables_equal(*chunks[0], *tables[3]);
+  expect_tables_equal(*chunks[1], *tables[1]);
+
+  // Filtered-out row groups are not part of any chunk; an empty selection yields one empty table
+  read_args.row_groups = {};
+  read_args.filter     = cudf_io::stats_filter("_col0", cudf_io::filter_op::GREATER_EQUAL, 2500);
+  chunks               = read_chunks(read_args);
+  ASSERT_EQ(chunks.size(), 2u);
+  expect_tables_equal(*chunks[0], *tables[2]);
+  expect_tables_equal(*chunks[1], *tables[3]);
+
+  read_args.filter = cudf_io::stats_filter("_col0", cudf_io::filter_op::LESS, 0);
+  chunks           = read_chunks(read_args);
+  ASSERT_EQ(chunks.size(), 1u);
+  EXPECT_EQ(chunks[0]->num_rows(), 0);
+  EXPECT_EQ(chunks[0]->num_columns(), 1);
+}
+
+TEST_F(ParquetChunkedWriterTest, EstimateReadMemory)
+{
+  // Four uncompressed row groups of 1000 int64 rows
+  auto filepath = temp_env->get_temp_filepath("EstimateReadMemory.parquet");
+  cudf_io::write_parquet_chunked_args args{
+    cudf_io::sink_info{filepath}, nullptr, cudf_io::compression_type::NONE};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  for (int i = 0; i < 4; ++i) {
+    auto values =
+      cudf::test::make_counting_transform_iterator(1000 * i, [](auto row) { return row; });
+    cudf::test::fixed_width_column_wrapper<int64_t> col(values, values + 1000);
+    cudf_io::write_parquet_chunked(table_view{{col}}, state);
+  }
+  cudf_io::write_parquet_chunked_end(state);
+
+  // The output is the decoded column, with a null mask per row group if the column is optional;
+  // the scratch memory is the page data, which holds the values
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  auto const estimate     = cudf_io::estimate_read_parquet_memory(read_args);
+  auto const column_bytes = 4000 * sizeof(int64_t);
+  EXPECT_GE(estimate.output_bytes, column_bytes);
+  EXPECT_LE(estimate.output_bytes, column_bytes + 4 * cudf::bitmask_allocation_size_bytes(1000));
+  EXPECT_GT(estimate.scratch_bytes, column_bytes);
+  EXPECT_EQ(cudf_io::read_parquet(read_args).tbl->num_rows(), 4000);
+
+  // Only the selected row groups are charged
+  read_args.row_groups = {{3, 1}};
+  auto const selected  = cudf_io::estimate_read_parquet_memory(read_args);
+  EXPECT_EQ(2 * selected.output_bytes, estimate.output_bytes);
+
+  read_args.row_groups = {};
+  read_args.filter     = cudf_io::stats_filter("_col0", cudf_io::filter_op::GREATER_EQUAL, 2500);
+  EXPECT_EQ(cudf_io::estimate_read_parquet_memory(read_args).output_bytes, selected.output_bytes);
+}
+
 TYPED_TEST(ParquetChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
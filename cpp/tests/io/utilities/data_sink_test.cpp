@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/io/data_sink.hpp>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+struct DataSinkTest : public cudf::test::BaseFixture {
+  cudf::test::temp_directory const tmpdir{"data_sink_test"};
+};
+
+TEST_F(DataSinkTest, FileDeviceWrite)
+{
+  // Larger than the staging buffers, so that the device data is written in several pieces
+  std::vector<char> data(20 * 1024 * 1024 + 7);
+  std::iota(data.begin(), data.end(), 0);
+  rmm::device_buffer d_data(data.data(), data.size());
+
+  auto const filepath = tmpdir.path() + "device_write.bin";
+  {
+    auto sink = cudf::io::data_sink::create(filepath);
+    ASSERT_TRUE(sink->supports_device_write());
+    sink->host_write(data.data(), 3);
+    sink->device_write(static_cast<char const*>(d_data.data()) + 3, data.size() - 100, 0);
+    EXPECT_EQ(sink->bytes_written(), data.size() - 97);
+    sink->host_write(data.data() + data.size() - 97, 90);
+    sink->device_write(static_cast<char const*>(d_data.data()) + data.size() - 7, 7, 0);
+    sink->flush();
+    EXPECT_EQ(sink->bytes_written(), data.size());
+  }
+
+  std::ifstream infile(filepath, std::ios::binary);
+  std::vector<char> const written{std::istreambuf_iterator<char>(infile),
+                                  std::istreambuf_iterator<char>()};
+  EXPECT_EQ(written, data);
+}
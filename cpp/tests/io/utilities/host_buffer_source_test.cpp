@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/prefetching_source.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/functions.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+struct HostBufferSourceTest : public cudf::test::BaseFixture {
+  std::vector<char> make_data(size_t size)
+  {
+    std::vector<char> data(size);
+    std::iota(data.begin(), data.end(), 0);
+    return data;
+  }
+
+  void expect_device_read(cudf::io::datasource& source, std::vector<char> const& data)
+  {
+    ASSERT_TRUE(source.supports_device_read());
+    rmm::device_buffer d_data(100);
+    EXPECT_EQ(source.device_read(1000, 100, static_cast<uint8_t*>(d_data.data())), 100u);
+    std::vector<char> h_data(d_data.size());
+    CUDA_TRY(cudaMemcpy(h_data.data(), d_data.data(), d_data.size(), cudaMemcpyDeviceToHost));
+    EXPECT_TRUE(std::equal(h_data.begin(), h_data.end(), data.begin() + 1000));
+
+    // Reads are clamped to the end of the buffer
+    auto const tail = source.device_read(data.size() - 10, 100);
+    EXPECT_EQ(tail->size(), 10u);
+
+    auto const host = source.host_read(16, 32);
+    ASSERT_EQ(host->size(), 32u);
+    EXPECT_TRUE(std::equal(data.begin() + 16, data.begin() + 48, host->data()));
+  }
+};
+
+TEST_F(HostBufferSourceTest, Pageable)
+{
+  auto const data = make_data(4096);
+  auto source     = cudf::io::datasource::create(cudf::io::host_buffer{data.data(), data.size()});
+  EXPECT_FALSE(source->supports_device_read());
+}
+
+TEST_F(HostBufferSourceTest, Registered)
+{
+  auto const data = make_data(4096);
+  auto source     = cudf::io::datasource::create(
+    cudf::io::host_buffer{data.data(), data.size(), cudf::io::host_memory_kind::REGISTERED});
+  expect_device_read(*source, data);
+
+  // The buffer is unregistered with the source, so it can be registered again
+  source.reset();
+  source = cudf::io::datasource::create(
+    cudf::io::host_buffer{data.data(), data.size(), cudf::io::host_memory_kind::REGISTERED});
+  expect_device_read(*source, data);
+}
+
+TEST_F(HostBufferSourceTest, Pinned)
+{
+  auto const data = make_data(4096);
+  char* pinned    = nullptr;
+  CUDA_TRY(cudaMallocHost(&pinned, data.size()));
+  std::memcpy(pinned, data.data(), data.size());
+  {
+    auto source = cudf::io::datasource::create(
+      cudf::io::host_buffer{pinned, data.size(), cudf::io::host_memory_kind::PINNED});
+    expect_device_read(*source, data);
+
+    // Registering memory that is already pinned keeps it pinned
+    auto registered = cudf::io::datasource::create(
+      cudf::io::host_buffer{pinned, data.size(), cudf::io::host_memory_kind::REGISTERED});
+    expect_device_read(*registered, data);
+
+    // The prefetcher reads straight from the buffer
+    cudf::io::detail::prefetching_source prefetcher(source.get());
+    prefetcher.prefetch({{0, 256}});
+    rmm::device_buffer d_data(256);
+    prefetcher.read_to_device({{0, 256, static_cast<uint8_t*>(d_data.data())}}, 0);
+    prefetcher.synchronize();
+    std::vector<char> h_data(d_data.size());
+    CUDA_TRY(cudaMemcpy(h_data.data(), d_data.data(), d_data.size(), cudaMemcpyDeviceToHost));
+    EXPECT_TRUE(std::equal(h_data.begin(), h_data.end(), data.begin()));
+  }
+  CUDA_TRY(cudaFreeHost(pinned));
+}
+
+TEST_F(HostBufferSourceTest, ParquetRead)
+{
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 3; });
+  cudf::test::fixed_width_column_wrapper<int64_t> col(values, values + 100000);
+  cudf::table_view const expected{{col}};
+
+  std::vector<char> out_buffer;
+  cudf::io::write_parquet_args out_args{cudf::io::sink_info(&out_buffer), expected};
+  cudf::io::write_parquet(out_args);
+
+  cudf::io::read_parquet_args in_args{cudf::io::source_info(
+    out_buffer.data(), out_buffer.size(), cudf::io::host_memory_kind::REGISTERED)};
+  auto result = cudf::io::read_parquet(in_args);
+  cudf::test::expect_tables_equal(expected, result.tbl->view());
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/metadata_cache.hpp>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <memory>
+#include <string>
+
+struct MetadataCacheTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MetadataCacheTest, LeastRecentlyUsedEviction)
+{
+  // A type of its own, so that the test does not share the cache of a reader
+  struct test_metadata {
+    int value;
+  };
+  auto &cache = cudf::io::detail::metadata_cache<test_metadata>::instance();
+  cache.set_capacity(100);
+
+  cache.put("a", std::make_shared<test_metadata const>(test_metadata{1}), 40);
+  cache.put("b", std::make_shared<test_metadata const>(test_metadata{2}), 40);
+  ASSERT_NE(cache.get("a"), nullptr);  // "b" is now the least recently used
+  cache.put("c", std::make_shared<test_metadata const>(test_metadata{3}), 40);
+  EXPECT_EQ(cache.get("b"), nullptr);
+  EXPECT_EQ(cache.get("a")->value, 1);
+  EXPECT_EQ(cache.get("c")->value, 3);
+
+  // Replacing an entry does not charge it twice
+  cache.put("c", std::make_shared<test_metadata const>(test_metadata{4}), 40);
+  EXPECT_EQ(cache.num_entries(), 2u);
+  EXPECT_EQ(cache.get("c")->value, 4);
+
+  // Entries larger than the capacity are not cached
+  cache.put("d", std::make_shared<test_metadata const>(test_metadata{5}), 200);
+  EXPECT_EQ(cache.get("d"), nullptr);
+
+  cache.clear();
+  EXPECT_EQ(cache.num_entries(), 0u);
+}
+
+TEST_F(MetadataCacheTest, FileKey)
+{
+  EXPECT_TRUE(cudf::io::detail::file_cache_key("/nonexistent/file.parquet").empty());
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/pinned_memory_pool.hpp>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <cstring>
+#include <utility>
+
+struct PinnedMemoryPoolTest : public cudf::test::BaseFixture {
+  void SetUp() override
+  {
+    pool.release();
+    original_max_cached_bytes = pool.max_cached_bytes();
+  }
+  void TearDown() override { pool.set_max_cached_bytes(original_max_cached_bytes); }
+
+  cudf::io::detail::pinned_memory_pool& pool = cudf::io::detail::pinned_memory_pool::instance();
+  size_t original_max_cached_bytes           = 0;
+};
+
+TEST_F(PinnedMemoryPoolTest, ReusesBlocksOfTheSameSizeClass)
+{
+  auto const ptr = pool.allocate(1000);
+  ASSERT_NE(ptr, nullptr);
+  std::memset(ptr, 0, 1000);
+  pool.deallocate(ptr, 1000);
+  EXPECT_EQ(pool.cached_bytes(), 1024u);
+
+  // 1000 and 600 bytes are both served by 1024-byte blocks
+  auto const reused = pool.allocate(600);
+  EXPECT_EQ(reused, ptr);
+  EXPECT_EQ(pool.cached_bytes(), 0u);
+  pool.deallocate(reused, 600);
+
+  EXPECT_EQ(pool.allocate(0), nullptr);
+  pool.release();
+  EXPECT_EQ(pool.cached_bytes(), 0u);
+}
+
+TEST_F(PinnedMemoryPoolTest, CachedBytesLimit)
+{
+  pool.set_max_cached_bytes(2048);
+  auto const ptr1 = pool.allocate(2048);
+  auto const ptr2 = pool.allocate(256);
+  pool.deallocate(ptr1, 2048);
+  // Caching the second block would exceed the limit, so it is freed
+  pool.deallocate(ptr2, 256);
+  EXPECT_EQ(pool.cached_bytes(), 2048u);
+
+  pool.set_max_cached_bytes(1024);
+  EXPECT_EQ(pool.cached_bytes(), 0u);
+
+  // Blocks larger than the largest size class are never cached
+  pool.set_max_cached_bytes(2 * cudf::io::detail::pinned_memory_pool::max_block_size);
+  auto const size = cudf::io::detail::pinned_memory_pool::max_block_size + 1;
+  pool.deallocate(pool.allocate(size), size);
+  EXPECT_EQ(pool.cached_bytes(), 0u);
+}
+
+TEST_F(PinnedMemoryPoolTest, HostDeviceVector)
+{
+  {
+    hostdevice_vector<int> vec(100);
+    for (int i = 0; i < 100; ++i) { vec[i] = i; }
+    hostdevice_vector<int> moved(std::move(vec));
+    EXPECT_EQ(moved[99], 99);
+  }
+  // The host memory of the vector is returned to the pool
+  EXPECT_EQ(pool.cached_bytes(), 512u);
+}
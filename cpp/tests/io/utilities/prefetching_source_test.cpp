@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/prefetching_source.hpp>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+struct PrefetchingSourceTest : public cudf::test::BaseFixture {
+  std::vector<char> make_data(size_t size)
+  {
+    std::vector<char> data(size);
+    std::iota(data.begin(), data.end(), 0);
+    return data;
+  }
+};
+
+TEST_F(PrefetchingSourceTest, DeviceReadAsync)
+{
+  auto const data = make_data(4096);
+  auto source     = cudf::io::datasource::create(cudf::io::host_buffer{data.data(), data.size()});
+  cudf::io::detail::prefetching_source prefetcher(source.get(), 3);
+
+  std::vector<std::pair<size_t, size_t>> ranges{{0, 100}, {1000, 1000}, {3000, 1096}, {2500, 1}};
+  prefetcher.prefetch(ranges);
+
+  rmm::device_buffer d_data(4096);
+  std::vector<cudf::io::detail::device_read_range> reads;
+  size_t dst_offset = 0;
+  for (auto const& range : ranges) {
+    reads.push_back(
+      {range.first, range.second, static_cast<uint8_t*>(d_data.data()) + dst_offset});
+    dst_offset += range.second;
+  }
+  // Includes a range that was not prefetched
+  reads.push_back({100, 900, static_cast<uint8_t*>(d_data.data()) + dst_offset});
+  prefetcher.read_to_device(reads, 0);
+  prefetcher.synchronize();
+
+  std::vector<char> h_data(d_data.size());
+  CUDA_TRY(cudaMemcpy(h_data.data(), d_data.data(), d_data.size(), cudaMemcpyDeviceToHost));
+  size_t pos = 0;
+  for (auto const& read : reads) {
+    for (size_t i = 0; i < read.size; ++i, ++pos) {
+      EXPECT_EQ(h_data[pos], data[read.offset + i]);
+    }
+  }
+}
+
+TEST_F(PrefetchingSourceTest, HostRead)
+{
+  auto const data = make_data(256);
+  auto source     = cudf::io::datasource::create(cudf::io::host_buffer{data.data(), data.size()});
+  cudf::io::detail::prefetching_source prefetcher(source.get());
+
+  prefetcher.prefetch({{16, 32}});
+  auto const staged = prefetcher.host_read(16, 32);
+  ASSERT_EQ(staged->size(), 32u);
+  EXPECT_TRUE(std::equal(data.begin() + 16, data.begin() + 48, staged->data()));
+
+  // Reads that were not prefetched are forwarded to the wrapped source
+  std::vector<uint8_t> dst(8);
+  EXPECT_EQ(prefetcher.host_read(100, 8, dst.data()), 8u);
+  EXPECT_TRUE(std::equal(data.begin() + 100, data.begin() + 108, dst.begin()));
+  EXPECT_EQ(prefetcher.size(), data.size());
+}
+
+TEST_F(PrefetchingSourceTest, StagingBudget)
+{
+  // The ranges add up to far more than the staging budget, and most are larger than it
+  auto const data = make_data(64 * 1024);
+  auto source     = cudf::io::datasource::create(cudf::io::host_buffer{data.data(), data.size()});
+  cudf::io::detail::prefetching_source prefetcher(source.get(), 4, 1000);
+
+  rmm::device_buffer d_data(data.size());
+  auto const d_ptr = static_cast<uint8_t*>(d_data.data());
+  std::vector<cudf::io::detail::device_read_range> reads;
+  size_t offset = 0;
+  for (size_t size = 100; offset + size <= data.size(); offset += size, size += 100) {
+    reads.push_back({offset, size, d_ptr + offset});
+  }
+  reads.push_back({offset, data.size() - offset, d_ptr + offset});
+  prefetcher.read_to_device(reads, 0);
+  prefetcher.synchronize();
+
+  std::vector<char> h_data(d_data.size());
+  CUDA_TRY(cudaMemcpy(h_data.data(), d_data.data(), d_data.size(), cudaMemcpyDeviceToHost));
+  EXPECT_TRUE(std::equal(h_data.begin(), h_data.end(), data.begin()));
+}
+
+TEST_F(PrefetchingSourceTest, UnreadRangesHoldingBudget)
+{
+  auto const data = make_data(8192);
+  auto source     = cudf::io::datasource::create(cudf::io::host_buffer{data.data(), data.size()});
+  cudf::io::detail::prefetching_source prefetcher(source.get(), 2, 1000);
+
+  // The first ranges use up the budget and are never read back; the last one is read on the
+  // calling thread
+  std::vector<std::pair<size_t, size_t>> ranges;
+  for (size_t offset = 0; offset < data.size(); offset += 512) { ranges.emplace_back(offset, 512); }
+  prefetcher.prefetch(ranges);
+
+  auto const last = prefetcher.host_read(ranges.back().first, ranges.back().second);
+  ASSERT_EQ(last->size(), 512u);
+  EXPECT_TRUE(std::equal(data.end() - 512, data.end(), last->data()));
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/remote_source.hpp>
+#include <tests/utilities/base_fixture.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+/**
+ * @brief Host buffer source that counts the read requests
+ */
+class counting_source : public cudf::io::datasource {
+ public:
+  counting_source(std::vector<char> const& data, std::atomic<size_t>* num_reads)
+    : _source(cudf::io::datasource::create(cudf::io::host_buffer{data.data(), data.size()})),
+      _num_reads(num_reads)
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    ++(*_num_reads);
+    return _source->host_read(offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    ++(*_num_reads);
+    return _source->host_read(offset, size, dst);
+  }
+
+  size_t size() const override { return _source->size(); }
+
+ private:
+  std::unique_ptr<cudf::io::datasource> _source;
+  std::atomic<size_t>* _num_reads;
+};
+
+struct RemoteSourceTest : public cudf::test::BaseFixture {
+  std::vector<char> make_data(size_t size)
+  {
+    // Values below 128 compare equal whether read as char or uint8_t
+    std::vector<char> data(size);
+    for (size_t i = 0; i < size; ++i) { data[i] = static_cast<char>(i % 127); }
+    return data;
+  }
+
+  std::unique_ptr<cudf::io::detail::remote_source> make_source(
+    cudf::io::detail::remote_source_options const& options)
+  {
+    return std::make_unique<cudf::io::detail::remote_source>(
+      std::make_unique<counting_source>(data, &num_reads), options);
+  }
+
+  std::vector<char> const data = make_data(64 * 1024);
+  std::atomic<size_t> num_reads{0};
+};
+
+TEST_F(RemoteSourceTest, CoalescedPrefetch)
+{
+  cudf::io::detail::remote_source_options options;
+  options.coalesce_gap = 1000;
+  options.request_size = 512;
+  options.tail_size    = 1024;
+  auto source          = make_source(options);
+
+  // The first two ranges are merged into one block of two requests; the last is in the tail
+  std::vector<std::pair<size_t, size_t>> ranges{
+    {0, 100}, {800, 200}, {20000, 100}, {data.size() - 100, 100}};
+  source->prefetch(ranges);
+
+  for (auto const& range : ranges) {
+    std::vector<uint8_t> dst(range.second);
+    EXPECT_EQ(source->host_read(range.first, range.second, dst.data()), range.second);
+    EXPECT_TRUE(std::equal(dst.begin(), dst.end(), data.begin() + range.first));
+  }
+  // Two requests for the merged block, one for the other block and one for the tail
+  EXPECT_EQ(num_reads, 4u);
+}
+
+TEST_F(RemoteSourceTest, TailCache)
+{
+  cudf::io::detail::remote_source_options options;
+  options.tail_size = 4096;
+  auto source       = make_source(options);
+
+  auto const footer_length = source->host_read(data.size() - 8, 8);
+  EXPECT_EQ(footer_length->size(), 8u);
+  auto const footer = source->host_read(data.size() - 2000, 1992);
+  ASSERT_EQ(footer->size(), 1992u);
+  EXPECT_TRUE(std::equal(footer->data(), footer->data() + 1992, data.end() - 2000));
+  EXPECT_EQ(num_reads, 1u);
+  EXPECT_EQ(source->size(), data.size());
+}
+
+TEST_F(RemoteSourceTest, ParallelRead)
+{
+  cudf::io::detail::remote_source_options options;
+  options.request_size = 1000;
+  options.tail_size    = 0;
+  auto source          = make_source(options);
+
+  auto const result = source->host_read(500, 10000);
+  ASSERT_EQ(result->size(), 10000u);
+  EXPECT_TRUE(std::equal(result->data(), result->data() + 10000, data.begin() + 500));
+  EXPECT_EQ(num_reads, 10u);
+
+  // Reads past the end are truncated
+  auto const end = source->host_read(data.size() - 10, 100);
+  EXPECT_EQ(end->size(), 10u);
+}
@@ -16,6 +16,10 @@
 
 #include "jit-cache-test.hpp"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace cudf {
 namespace test {
 TEST_F(JitCacheTest, CacheExceptionTest)
@@ -76,6 +80,63 @@ TEST_F(JitCacheTest, MemoryCacheProgramTest)
   cudf::test::expect_columns_equal(expect, column);
 }
 
+// Test that concurrent lookups of a missing kernel compile it once and share it
+TEST_F(JitCacheTest, ConcurrentKernelTest)
+{
+  // Brand new cache object that has nothing in in-memory cache
+  cudf::jit::cudfJitCache cache;
+
+  auto column = cudf::test::fixed_width_column_wrapper<int>{{2, 0}};
+  auto expect = cudf::test::fixed_width_column_wrapper<int>{{32, 0}};
+
+  auto program = cache.getProgram("ConcurrentCacheTestProg", program_source);
+  purgeFileCache();
+
+  // New threads have no current context until they call the runtime API
+  CUcontext context;
+  cuCtxGetCurrent(&context);
+
+  std::vector<std::shared_ptr<jitify::experimental::KernelInstantiation>> kernels(8);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kernels.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      cuCtxSetCurrent(context);
+      kernels[i] = std::get<1>(cache.getKernelInstantiation("my_kernel", program, {"5", "int"}));
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+  for (auto const& kernel : kernels) { EXPECT_EQ(kernel, kernels[0]); }
+
+  (*kernels[0])
+    .configure(grid, block)
+    .launch(column.operator cudf::mutable_column_view().data<int>());
+
+  cudf::test::expect_columns_equal(expect, column);
+}
+
+// Test that a failed build is rethrown to all the threads waiting for it
+TEST_F(JitCacheTest, ConcurrentExceptionTest)
+{
+  cudf::jit::cudfJitCache cache;
+
+  std::atomic<int> failures{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&]() {
+      try {
+        cache.getProgram("ConcurrentMissingProg");
+      } catch (cudf::logic_error const&) {
+        ++failures;
+      }
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+  EXPECT_EQ(failures, 8);
+
+  // The failure is not cached
+  EXPECT_NO_THROW(cache.getProgram("ConcurrentMissingProg", program_source));
+}
+
 // Test the file caching ability
 #if defined(JITIFY_USE_CACHE)
 TEST_F(JitCacheTest, FileCacheProgramTest)
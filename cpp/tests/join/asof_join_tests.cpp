@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <limits>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using index_wrapper   = column_wrapper<cudf::size_type>;
+using strings_wrapper = cudf::test::strings_column_wrapper;
+
+struct AsofJoinTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(AsofJoinTest, Directions)
+{
+  column_wrapper<int32_t> left_on{0, 2, 3, 5, 9, 12};
+  column_wrapper<int32_t> right_on{1, 2, 4, 6, 10};
+  cudf::table_view no_keys{};
+
+  auto const backward =
+    cudf::asof_join(no_keys, left_on, no_keys, right_on, cudf::asof_direction::BACKWARD);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*backward.first, index_wrapper{0, 1, 2, 3, 4, 5});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*backward.second, index_wrapper{-1, 1, 1, 2, 3, 4});
+
+  auto const forward =
+    cudf::asof_join(no_keys, left_on, no_keys, right_on, cudf::asof_direction::FORWARD);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*forward.second, index_wrapper{0, 1, 2, 3, 4, -1});
+
+  // 3 is as close to 2 as to 4; ties match backward
+  auto const nearest =
+    cudf::asof_join(no_keys, left_on, no_keys, right_on, cudf::asof_direction::NEAREST);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*nearest.second, index_wrapper{0, 1, 1, 2, 4, 4});
+}
+
+TEST_F(AsofJoinTest, GroupsAndTolerance)
+{
+  strings_wrapper left_by{"A", "B", "A", "A", "C"};
+  column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep> left_on{2, 3, 5, 9, 1};
+  strings_wrapper right_by{"A", "A", "B", "A", "B"};
+  column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep> right_on{1, 2, 4, 6, 8};
+  cudf::table_view left{{left_by}};
+  cudf::table_view right{{right_by}};
+
+  auto const result = cudf::asof_join(left, left_on, right, right_on);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result.first, index_wrapper{0, 1, 2, 3, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result.second, index_wrapper{1, -1, 1, 3, -1});
+
+  auto const forward =
+    cudf::asof_join(left, left_on, right, right_on, cudf::asof_direction::FORWARD);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*forward.second, index_wrapper{1, 2, 3, -1, -1});
+
+  auto const within_2 =
+    cudf::asof_join(left, left_on, right, right_on, cudf::asof_direction::BACKWARD, 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*within_2.second, index_wrapper{1, -1, -1, -1, -1});
+}
+
+TEST_F(AsofJoinTest, NullKeys)
+{
+  column_wrapper<int32_t> left_by{{1, 2, 1}, {1, 0, 1}};
+  column_wrapper<int64_t> left_on{5, 5, 7};
+  column_wrapper<int32_t> right_by{{2, 1, 2}, {0, 1, 1}};
+  column_wrapper<int64_t> right_on{1, 2, 3};
+  cudf::table_view left{{left_by}};
+  cudf::table_view right{{right_by}};
+
+  auto const equal = cudf::asof_join(left, left_on, right, right_on);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*equal.second, index_wrapper{1, 0, 1});
+
+  auto const unequal = cudf::asof_join(left,
+                                       left_on,
+                                       right,
+                                       right_on,
+                                       cudf::asof_direction::BACKWARD,
+                                       std::numeric_limits<int64_t>::max(),
+                                       cudf::null_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*unequal.second, index_wrapper{1, -1, 1});
+}
+
+TEST_F(AsofJoinTest, InvalidInputs)
+{
+  column_wrapper<float> left_on{1.0f};
+  column_wrapper<float> right_on{1.0f};
+  cudf::table_view no_keys{};
+  EXPECT_THROW(cudf::asof_join(no_keys, left_on, no_keys, right_on), cudf::logic_error);
+
+  column_wrapper<int32_t> int_left{1};
+  column_wrapper<int64_t> int_right{1};
+  EXPECT_THROW(cudf::asof_join(no_keys, int_left, no_keys, int_right), cudf::logic_error);
+  column_wrapper<int32_t> int_right32{1};
+  EXPECT_THROW(cudf::asof_join(
+                 no_keys, int_left, no_keys, int_right32, cudf::asof_direction::BACKWARD, -1),
+               cudf::logic_error);
+}
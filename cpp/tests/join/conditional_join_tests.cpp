@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/nodes.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+using cudf::ast::ast_operator;
+using cudf::ast::column_reference;
+using cudf::ast::operation;
+using cudf::ast::table_reference;
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using index_wrapper  = column_wrapper<cudf::size_type>;
+
+struct ConditionalJoinTest : public cudf::test::BaseFixture {
+  /**
+   * @brief Compares gather maps with the expected ones, ignoring the order of the pairs
+   */
+  void expect_maps_equal(
+    std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> const& maps,
+    index_wrapper const& expected_left,
+    index_wrapper const& expected_right)
+  {
+    cudf::table_view result{{maps.first->view(), maps.second->view()}};
+    auto const sorted_result = cudf::gather(result, *cudf::sorted_order(result));
+    cudf::table_view expected{{expected_left, expected_right}};
+    cudf::test::expect_tables_equal(expected, *sorted_result);
+  }
+};
+
+TEST_F(ConditionalJoinTest, RangeJoin)
+{
+  // Events at a timestamp, sessions over an interval
+  column_wrapper<int64_t> ts{5, 12, 20, 31};
+  column_wrapper<int64_t> start{0, 10, 15, 40};
+  column_wrapper<int64_t> end{10, 20, 30, 50};
+  cudf::table_view events{{ts}};
+  cudf::table_view sessions{{start, end}};
+
+  column_reference event_ts(0, table_reference::LEFT);
+  column_reference session_start(0, table_reference::RIGHT);
+  column_reference session_end(1, table_reference::RIGHT);
+  operation after_start(ast_operator::GREATER_EQUAL, event_ts, session_start);
+  operation before_end(ast_operator::LESS_EQUAL, event_ts, session_end);
+  operation between(ast_operator::LOGICAL_AND, after_start, before_end);
+
+  auto const inner = cudf::conditional_inner_join(events, sessions, between);
+  expect_maps_equal(inner, {0, 1, 2, 2}, {0, 1, 1, 2});
+
+  auto const left = cudf::conditional_left_join(events, sessions, between);
+  expect_maps_equal(left, {0, 1, 2, 2, 3}, {0, 1, 1, 2, -1});
+}
+
+TEST_F(ConditionalJoinTest, LargerRightTable)
+{
+  // The inner join runs the nested loop over the larger table
+  column_wrapper<int32_t> a{1, 3};
+  column_wrapper<int32_t> b{0, 1, 2, 3, 4};
+  cudf::table_view left{{a}};
+  cudf::table_view right{{b}};
+
+  column_reference col_a(0, table_reference::LEFT);
+  column_reference col_b(0, table_reference::RIGHT);
+  operation greater(ast_operator::GREATER, col_a, col_b);
+
+  auto const inner = cudf::conditional_inner_join(left, right, greater);
+  expect_maps_equal(inner, {0, 1, 1, 1}, {0, 0, 1, 2});
+}
+
+TEST_F(ConditionalJoinTest, EqualityWithResidual)
+{
+  column_wrapper<int32_t> key0{{1, 1, 2, 3, 0}, {1, 1, 1, 1, 0}};
+  column_wrapper<double> value0{1.0, 5.0, 2.0, 3.0, 0.0};
+  column_wrapper<int32_t> key1{{1, 2, 2, 4, 0}, {1, 1, 1, 1, 0}};
+  column_wrapper<double> value1{2.0, 1.0, 3.0, 0.0, 0.0};
+  cudf::table_view left{{key0, value0}};
+  cudf::table_view right{{key1, value1}};
+
+  // left.key == right.key AND left.value < right.value; null keys do not match
+  column_reference left_key(0, table_reference::LEFT);
+  column_reference right_key(0, table_reference::RIGHT);
+  column_reference left_value(1, table_reference::LEFT);
+  column_reference right_value(1, table_reference::RIGHT);
+  operation same_key(ast_operator::EQUAL, right_key, left_key);
+  operation smaller(ast_operator::LESS, left_value, right_value);
+  operation predicate(ast_operator::LOGICAL_AND, same_key, smaller);
+
+  auto const inner = cudf::conditional_inner_join(left, right, predicate);
+  expect_maps_equal(inner, {0, 2}, {0, 2});
+
+  auto const left_result = cudf::conditional_left_join(left, right, predicate);
+  expect_maps_equal(left_result, {0, 1, 2, 3, 4}, {0, -1, 2, -1, -1});
+}
+
+TEST_F(ConditionalJoinTest, InvalidPredicate)
+{
+  column_wrapper<int32_t> a{1, 2};
+  cudf::table_view table{{a}};
+  column_reference col_a(0, table_reference::LEFT);
+  column_reference col_missing(1, table_reference::RIGHT);
+  operation sum(ast_operator::ADD, col_a, col_a);
+  operation out_of_range(ast_operator::EQUAL, col_a, col_missing);
+
+  EXPECT_THROW(cudf::conditional_inner_join(table, table, sum), cudf::logic_error);
+  EXPECT_THROW(cudf::conditional_inner_join(table, table, out_of_range), cudf::logic_error);
+}
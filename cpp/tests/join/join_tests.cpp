@@ -17,7 +17,10 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/hashing.hpp>
 #include <cudf/join.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -29,6 +32,10 @@
 #include <tests/utilities/type_lists.hpp>
 #include "cudf/types.hpp"
 
+#include <thrust/iterator/counting_iterator.h>
+
+#include <string>
+
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
 using strcol_wrapper = cudf::test::strings_column_wrapper;
@@ -945,4 +952,342 @@ TEST_F(JoinTest, InnerJoinCornerCase)
   cudf::test::expect_tables_equal(*sorted_gold, *sorted_result);
 }
 
+TEST_F(JoinTest, HashJoinMultipleProbes)
+{
+  column_wrapper<int32_t> build_0{{2, 2, 0, 4, 3}};
+  strcol_wrapper build_1{{"s1", "s0", "s1", "s2", "s1"}};
+  CVector build_cols;
+  build_cols.push_back(build_0.release());
+  build_cols.push_back(build_1.release());
+  Table build(std::move(build_cols));
+
+  cudf::hash_join joiner(build, {0});
+
+  column_wrapper<int32_t> probe_a_0{{3, 1, 2, 0, 3}};
+  column_wrapper<int32_t> probe_b_0{{4, 5, 2}};
+  for (auto const& probe : {cudf::table_view{{probe_a_0}}, cudf::table_view{{probe_b_0}}}) {
+    auto const maps         = joiner.inner_join(probe, {0});
+    auto const result       = cudf::gather(probe, maps.first->view());
+    auto const build_result = cudf::gather(build.view().select({0}), maps.second->view());
+    cudf::test::expect_columns_equal(result->get_column(0), build_result->get_column(0));
+
+    auto expected        = cudf::inner_join(probe, build.view().select({0}), {0}, {0}, {{0, 0}});
+    auto expected_sorted = cudf::gather(expected->view(), *cudf::sorted_order(expected->view()));
+    auto result_sorted   = cudf::gather(result->view(), *cudf::sorted_order(result->view()));
+    cudf::test::expect_tables_equal(*expected_sorted, *result_sorted);
+  }
+}
+
+TEST_F(JoinTest, HashJoinLeftAndFullJoin)
+{
+  column_wrapper<int32_t> build_0{{0, 2}};
+  column_wrapper<int32_t> probe_0{{0, 1}};
+  cudf::table_view build{{build_0}};
+  cudf::table_view probe{{probe_0}};
+
+  cudf::hash_join joiner(build, {0});
+
+  auto left_maps = joiner.left_join(probe, {0});
+  auto left      = cudf::table_view{{left_maps.first->view(), left_maps.second->view()}};
+  column_wrapper<int32_t> left_gold_0{{0, 1}};
+  column_wrapper<int32_t> left_gold_1{{0, -1}};
+  cudf::test::expect_tables_equal(*cudf::gather(left, *cudf::sorted_order(left)),
+                                  cudf::table_view{{left_gold_0, left_gold_1}});
+
+  auto full_maps = joiner.full_join(probe, {0});
+  auto full      = cudf::table_view{{full_maps.first->view(), full_maps.second->view()}};
+  column_wrapper<int32_t> full_gold_0{{-1, 0, 1}};
+  column_wrapper<int32_t> full_gold_1{{1, 0, -1}};
+  cudf::test::expect_tables_equal(*cudf::gather(full, *cudf::sorted_order(full)),
+                                  cudf::table_view{{full_gold_0, full_gold_1}});
+}
+
+TEST_F(JoinTest, HashJoinMismatchedKeys)
+{
+  column_wrapper<int32_t> build_0{{0, 2}};
+  column_wrapper<int64_t> probe_0{{0, 1}};
+  cudf::table_view build{{build_0}};
+  cudf::table_view probe{{probe_0}};
+
+  cudf::hash_join joiner(build, {0});
+  EXPECT_THROW(joiner.inner_join(probe, {0}), cudf::logic_error);
+  EXPECT_THROW(joiner.inner_join(cudf::table_view{{probe_0, probe_0}}, {0, 1}), cudf::logic_error);
+}
+
+TEST_F(JoinTest, HashJoinOutputSize)
+{
+  column_wrapper<int32_t> build_0{{2, 2, 0, 4, 3}};
+  column_wrapper<int32_t> probe_0{{3, 1, 2, 0, 3}};
+  cudf::table_view build{{build_0}};
+  cudf::table_view probe{{probe_0}};
+
+  cudf::hash_join joiner(build, {0});
+
+  EXPECT_EQ(joiner.inner_join_size(probe, {0}), 5u);
+  EXPECT_EQ(joiner.left_join_size(probe, {0}), 6u);
+  EXPECT_EQ(joiner.inner_join(probe, {0}).first->size(), 5);
+  EXPECT_EQ(joiner.left_join(probe, {0}).first->size(), 6);
+}
+
+TEST_F(JoinTest, HashJoinProbeSplits)
+{
+  column_wrapper<int32_t> build_0{{2, 2, 0, 4, 3}};
+  column_wrapper<int32_t> probe_0{{3, 1, 2, 0, 3}};
+  cudf::table_view build{{build_0}};
+  cudf::table_view probe{{probe_0}};
+
+  cudf::hash_join joiner(build, {0});
+
+  // Output rows per probe row: inner {1, 0, 2, 1, 1}, left {1, 1, 2, 1, 1}
+  EXPECT_EQ(joiner.inner_join_splits(probe, {0}, 2), (std::vector<cudf::size_type>{2, 3}));
+  EXPECT_EQ(joiner.left_join_splits(probe, {0}, 2), (std::vector<cudf::size_type>{2, 3}));
+  EXPECT_TRUE(joiner.inner_join_splits(probe, {0}, 5).empty());
+  // The probe row with two matches exceeds the budget and gets a part of its own
+  EXPECT_EQ(joiner.inner_join_splits(probe, {0}, 1), (std::vector<cudf::size_type>{2, 3, 4}));
+  EXPECT_THROW(joiner.inner_join_splits(probe, {0}, 0), cudf::logic_error);
+
+  cudf::size_type total = 0;
+  for (auto const& part : cudf::split(probe, joiner.inner_join_splits(probe, {0}, 2))) {
+    auto const part_size = joiner.inner_join(part, {0}).first->size();
+    EXPECT_LE(part_size, 2);
+    total += part_size;
+  }
+  EXPECT_EQ(total, 5);
+}
+
+TEST_F(JoinTest, HashJoinPrecomputedHashes)
+{
+  auto build_ints  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 97; });
+  auto probe_ints  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 50; });
+  auto valids      = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 11; });
+  auto build_strs  = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i % 3); });
+  auto probe_strs  = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i % 2); });
+  column_wrapper<int32_t> build_0(build_ints, build_ints + 5000, valids);
+  strcol_wrapper build_1(build_strs, build_strs + 5000);
+  column_wrapper<int32_t> probe_0(probe_ints, probe_ints + 300, valids);
+  strcol_wrapper probe_1(probe_strs, probe_strs + 300);
+  cudf::table_view build{{build_0, build_1}};
+  cudf::table_view probe{{probe_0, probe_1}};
+
+  auto sorted_maps = [](auto const& maps) {
+    auto const view = cudf::table_view{{maps.first->view(), maps.second->view()}};
+    return cudf::gather(view, *cudf::sorted_order(view));
+  };
+
+  cudf::hash_join joiner(build, {0, 1});
+  // Any function hashing both sides alike gives the same join
+  for (auto const hash_function : {cudf::hash_id::HASH_MURMUR3, cudf::hash_id::HASH_XXHASH64}) {
+    auto const build_hashes = cudf::hash(build, hash_function);
+    auto const probe_hashes = cudf::hash(probe, hash_function);
+    cudf::hash_join hashed_joiner(build, {0, 1}, *build_hashes);
+
+    cudf::test::expect_tables_equal(
+      *sorted_maps(joiner.inner_join(probe, {0, 1})),
+      *sorted_maps(hashed_joiner.inner_join(probe, {0, 1}, *probe_hashes)));
+    cudf::test::expect_tables_equal(
+      *sorted_maps(joiner.left_join(probe, {0, 1}, cudf::null_equality::UNEQUAL)),
+      *sorted_maps(
+        hashed_joiner.left_join(probe, {0, 1}, *probe_hashes, cudf::null_equality::UNEQUAL)));
+    cudf::test::expect_tables_equal(
+      *sorted_maps(joiner.full_join(probe, {0, 1})),
+      *sorted_maps(hashed_joiner.full_join(probe, {0, 1}, *probe_hashes)));
+    EXPECT_EQ(joiner.inner_join_size(probe, {0, 1}),
+              hashed_joiner.inner_join_size(probe, {0, 1}, *probe_hashes));
+    EXPECT_EQ(joiner.left_join_size(probe, {0, 1}),
+              hashed_joiner.left_join_size(probe, {0, 1}, *probe_hashes));
+
+    // Both sides must be hashed alike
+    EXPECT_THROW(hashed_joiner.inner_join(probe, {0, 1}), cudf::logic_error);
+    EXPECT_THROW(joiner.inner_join(probe, {0, 1}, *probe_hashes), cudf::logic_error);
+    EXPECT_THROW(hashed_joiner.inner_join_splits(probe, {0, 1}, 100), cudf::logic_error);
+  }
+}
+
+TEST_F(JoinTest, GatherMapsInnerLeftFull)
+{
+  column_wrapper<int32_t> left_0{{0, 1, 2}};
+  column_wrapper<int32_t> right_0{{1, 2, 3}};
+  cudf::table_view left{{left_0}};
+  cudf::table_view right{{right_0}};
+
+  auto sorted_maps = [](auto const& maps) {
+    auto const view = cudf::table_view{{maps.first->view(), maps.second->view()}};
+    return cudf::gather(view, *cudf::sorted_order(view));
+  };
+
+  column_wrapper<int32_t> inner_gold_0{{1, 2}};
+  column_wrapper<int32_t> inner_gold_1{{0, 1}};
+  cudf::test::expect_tables_equal(*sorted_maps(cudf::inner_join(left, right)),
+                                  cudf::table_view{{inner_gold_0, inner_gold_1}});
+
+  column_wrapper<int32_t> left_gold_0{{0, 1, 2}};
+  column_wrapper<int32_t> left_gold_1{{-1, 0, 1}};
+  cudf::test::expect_tables_equal(*sorted_maps(cudf::left_join(left, right)),
+                                  cudf::table_view{{left_gold_0, left_gold_1}});
+
+  column_wrapper<int32_t> full_gold_0{{-1, 0, 1, 2}};
+  column_wrapper<int32_t> full_gold_1{{2, -1, 0, 1}};
+  cudf::test::expect_tables_equal(*sorted_maps(cudf::full_join(left, right)),
+                                  cudf::table_view{{full_gold_0, full_gold_1}});
+}
+
+TEST_F(JoinTest, GatherMapsSmallBuildTable)
+{
+  // The small table is joined through shared memory hash tables, the hash_join objects through
+  // the global hash table of their build table
+  auto large_keys = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 97; });
+  auto small_keys = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 50; });
+  auto valids     = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 11; });
+  column_wrapper<int32_t> large_0(large_keys, large_keys + 10000, valids);
+  column_wrapper<int32_t> small_0(small_keys, small_keys + 200, valids);
+  cudf::table_view large{{large_0}};
+  cudf::table_view small{{small_0}};
+
+  auto sorted_maps = [](auto const& maps) {
+    auto const view = cudf::table_view{{maps.first->view(), maps.second->view()}};
+    return cudf::gather(view, *cudf::sorted_order(view));
+  };
+
+  cudf::hash_join small_joiner(small, {0});
+  cudf::test::expect_tables_equal(*sorted_maps(cudf::inner_join(large, small)),
+                                  *sorted_maps(small_joiner.inner_join(large, {0})));
+  cudf::test::expect_tables_equal(*sorted_maps(cudf::left_join(large, small)),
+                                  *sorted_maps(small_joiner.left_join(large, {0})));
+  cudf::test::expect_tables_equal(
+    *sorted_maps(cudf::inner_join(large, small, cudf::null_equality::UNEQUAL)),
+    *sorted_maps(small_joiner.inner_join(large, {0}, cudf::null_equality::UNEQUAL)));
+
+  // The inner join builds on the smaller table whichever side it is on
+  cudf::hash_join large_joiner(large, {0});
+  cudf::test::expect_tables_equal(*sorted_maps(cudf::inner_join(small, large)),
+                                  *sorted_maps(large_joiner.inner_join(small, {0})));
+}
+
+TEST_F(JoinTest, GatherMapsDictionaryKeys)
+{
+  strcol_wrapper left_strings{"b", "a", "c", "d"};
+  strcol_wrapper right_strings{{"c", "e", "b", "a"}, {1, 1, 1, 0}};
+  // the dictionaries have different keys
+  auto const left_0  = cudf::dictionary::encode(left_strings);
+  auto const right_0 = cudf::dictionary::encode(right_strings);
+  cudf::table_view left{{left_0->view()}};
+  cudf::table_view right{{right_0->view()}};
+
+  auto const maps = cudf::inner_join(left, right);
+  auto const view = cudf::table_view{{maps.first->view(), maps.second->view()}};
+
+  column_wrapper<int32_t> inner_gold_0{{0, 2}};
+  column_wrapper<int32_t> inner_gold_1{{2, 0}};
+  cudf::test::expect_tables_equal(*cudf::gather(view, *cudf::sorted_order(view)),
+                                  cudf::table_view{{inner_gold_0, inner_gold_1}});
+}
+
+TEST_F(JoinTest, PartitionedJoinMatchesUnpartitioned)
+{
+  auto keys_0 = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 97; });
+  auto keys_1 = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 13; });
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 11; });
+  column_wrapper<int32_t> left_0(keys_0, keys_0 + 1000, valids);
+  column_wrapper<int32_t> left_1(keys_1, keys_1 + 1000);
+  column_wrapper<int32_t> right_0(keys_1, keys_1 + 300);
+  column_wrapper<int32_t> right_1(keys_0, keys_0 + 300, valids);
+  cudf::table_view left{{left_0, left_1}};
+  cudf::table_view right{{right_0, right_1}};
+
+  auto sorted_maps = [](auto const& maps) {
+    auto const view = cudf::table_view{{maps.first->view(), maps.second->view()}};
+    return cudf::gather(view, *cudf::sorted_order(view));
+  };
+
+  for (cudf::size_type num_partitions : {0, 1, 4, 7}) {
+    cudf::test::expect_tables_equal(
+      *sorted_maps(cudf::partitioned_inner_join(left, right, num_partitions)),
+      *sorted_maps(cudf::inner_join(left, right)));
+    cudf::test::expect_tables_equal(
+      *sorted_maps(cudf::partitioned_left_join(left, right, num_partitions)),
+      *sorted_maps(cudf::left_join(left, right)));
+    cudf::test::expect_tables_equal(
+      *sorted_maps(cudf::partitioned_full_join(left, right, num_partitions)),
+      *sorted_maps(cudf::full_join(left, right)));
+  }
+}
+
+TEST_F(JoinTest, PartitionedJoinNegativePartitions)
+{
+  column_wrapper<int32_t> left_0{{0, 1, 2}};
+  column_wrapper<int32_t> right_0{{1, 2, 3}};
+  cudf::table_view left{{left_0}};
+  cudf::table_view right{{right_0}};
+
+  EXPECT_THROW(cudf::partitioned_inner_join(left, right, -1), cudf::logic_error);
+}
+
+TEST_F(JoinTest, SortedMergeJoinMatchesHashJoin)
+{
+  auto keys_0 = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 31; });
+  auto keys_1 = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto valids = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  column_wrapper<int32_t> left_0(keys_0, keys_0 + 500, valids);
+  column_wrapper<int32_t> left_1(keys_1, keys_1 + 500);
+  column_wrapper<int32_t> right_0(keys_1, keys_1 + 200);
+  column_wrapper<int32_t> right_1(keys_0, keys_0 + 200, valids);
+  // The merge join expects both tables in the default sort order
+  auto const left  = cudf::sort(cudf::table_view{{left_0, left_1}});
+  auto const right = cudf::sort(cudf::table_view{{right_1, right_0}});
+
+  auto sorted_maps = [](auto const& maps) {
+    auto const view = cudf::table_view{{maps.first->view(), maps.second->view()}};
+    return cudf::gather(view, *cudf::sorted_order(view));
+  };
+
+  for (auto compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    cudf::test::expect_tables_equal(
+      *sorted_maps(cudf::inner_join(*left, *right, compare_nulls, cudf::sorted::YES)),
+      *sorted_maps(cudf::inner_join(*left, *right, compare_nulls)));
+    cudf::test::expect_tables_equal(
+      *sorted_maps(cudf::left_join(*left, *right, compare_nulls, cudf::sorted::YES)),
+      *sorted_maps(cudf::left_join(*left, *right, compare_nulls)));
+    cudf::test::expect_tables_equal(
+      *sorted_maps(cudf::full_join(*left, *right, compare_nulls, cudf::sorted::YES)),
+      *sorted_maps(cudf::full_join(*left, *right, compare_nulls)));
+  }
+
+  // Empty right table
+  auto const empty = cudf::empty_like(*right);
+  auto const left_maps =
+    cudf::left_join(*left, *empty, cudf::null_equality::EQUAL, cudf::sorted::YES);
+  EXPECT_EQ(left_maps.first->size(), 500);
+}
+
+TEST_F(JoinTest, EstimateJoinMemory)
+{
+  auto const sequence = thrust::make_counting_iterator<int32_t>(0);
+  column_wrapper<int32_t> left_0(sequence, sequence + 5000);
+  column_wrapper<int32_t> right_0(sequence, sequence + 3000);
+  column_wrapper<int64_t> right_1(sequence, sequence + 3000);
+  cudf::table_view left{{left_0}};
+  cudf::table_view right{{right_0, right_1}};
+
+  // The common key column is returned once; every output column may get a null mask
+  auto const estimate   = cudf::estimate_join_memory(left, right, {0}, {0}, {{0, 0}}, 3000);
+  auto const mask_bytes = cudf::bitmask_allocation_size_bytes(3000);
+  EXPECT_EQ(estimate.output_bytes,
+            3000 * sizeof(int32_t) + 3000 * sizeof(int64_t) + 2 * mask_bytes);
+  auto const inner = cudf::inner_join(left, right, {0}, {0}, {{0, 0}});
+  EXPECT_EQ(inner->num_rows(), 3000);
+  EXPECT_EQ(inner->num_columns(), 2);
+
+  // The join indices, plus a hash table for build tables not probed from shared memory
+  auto const indices_bytes = 2 * 3000 * sizeof(cudf::size_type);
+  EXPECT_GT(estimate.scratch_bytes, indices_bytes + 3000 * sizeof(int32_t));
+  auto const small_right = cudf::split(right, {100}).front();
+  auto const small       = cudf::estimate_join_memory(left, small_right, {0}, {0}, {}, 3000);
+  EXPECT_EQ(small.scratch_bytes, indices_bytes);
+  EXPECT_EQ(small.peak_bytes(), small.output_bytes + small.scratch_bytes);
+
+  EXPECT_THROW(cudf::estimate_join_memory(left, right, {0}, {0, 1}, {}, 3000), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
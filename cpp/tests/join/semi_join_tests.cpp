@@ -16,6 +16,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/hashing.hpp>
 #include <cudf/join.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -691,3 +692,29 @@ TEST_F(JoinTest, LeftAntiJoin_empty_right_table)
   expect_columns_equal(join_table->get_column(2), expect_2);
   expect_columns_equal(join_table->get_column(3), expect_3);
 }
+
+TEST_F(JoinTest, LeftSemiAntiJoin_precomputed_hashes)
+{
+  column_wrapper<int32_t> a_0{10, 20, 20, 20, 20, 20, 50};
+  column_wrapper<float> a_1{5.0, .5, .5, .7, .7, .7, .7};
+  column_wrapper<int8_t> a_2{90, 77, 78, 61, 62, 63, 41};
+  column_wrapper<int32_t> b_0{10, 20, 20};
+  column_wrapper<float> b_1{5.0, .7, .7};
+
+  cudf::table_view table_a{{a_0, a_1, a_2}};
+  cudf::table_view table_b{{b_0, b_1}};
+  auto const a_hashes = cudf::hash(table_a.select({0, 1}), cudf::hash_id::HASH_XXHASH64);
+  auto const b_hashes = cudf::hash(table_b, cudf::hash_id::HASH_XXHASH64);
+
+  cudf::test::expect_tables_equal(
+    *cudf::left_semi_join(table_a, table_b, {0, 1}, {0, 1}, {0, 2}),
+    *cudf::left_semi_join(table_a, table_b, {0, 1}, {0, 1}, *a_hashes, *b_hashes, {0, 2}));
+  cudf::test::expect_tables_equal(
+    *cudf::left_anti_join(table_a, table_b, {0, 1}, {0, 1}, {0, 2}),
+    *cudf::left_anti_join(table_a, table_b, {0, 1}, {0, 1}, *a_hashes, *b_hashes, {0, 2}));
+
+  // Both sides must be hashed alike
+  EXPECT_THROW(
+    cudf::left_semi_join(table_a, table_b, {0, 1}, {0, 1}, *a_hashes, cudf::column_view{}, {0}),
+    cudf::logic_error);
+}
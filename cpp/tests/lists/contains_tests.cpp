@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/lists/contains.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
+
+template <typename T>
+struct TypedContainsTest : public cudf::test::BaseFixture {
+};
+
+using ContainsTypes = cudf::test::Types<int8_t, int32_t, int64_t, float, double>;
+
+TYPED_TEST_CASE(TypedContainsTest, ContainsTypes);
+
+TYPED_TEST(TypedContainsTest, Basic)
+{
+  using T   = TypeParam;
+  using LCW = cudf::test::lists_column_wrapper<T>;
+
+  LCW input{{1, 2, 3}, {4, 5}, LCW{}, {2, 2}, {7}};
+
+  auto result = cudf::lists::contains(cudf::lists_column_view(input), cudf::numeric_scalar<T>(2));
+
+  cudf::test::fixed_width_column_wrapper<bool> expected{1, 0, 0, 1, 0};
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TYPED_TEST(TypedContainsTest, Nulls)
+{
+  using T   = TypeParam;
+  using LCW = cudf::test::lists_column_wrapper<T>;
+
+  auto list_validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+  auto element_validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 1; });
+  LCW input{{{1, 2, 3}, {{4, 2}, element_validity}, {2}, {5}}, list_validity};
+
+  // Null elements do not match and null lists produce nulls
+  auto result = cudf::lists::contains(cudf::lists_column_view(input), cudf::numeric_scalar<T>(2));
+  cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0}, {1, 1, 0, 1});
+  cudf::test::expect_columns_equal(expected, *result);
+
+  // An invalid key produces only nulls
+  result = cudf::lists::contains(cudf::lists_column_view(input), cudf::numeric_scalar<T>(2, false));
+  EXPECT_EQ(result->null_count(), 4);
+}
+
+struct ContainsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ContainsTest, Strings)
+{
+  cudf::test::lists_column_wrapper<cudf::string_view> input{
+    {"a", "bc"}, {"def"}, {"bc", "x", "y"}};
+
+  auto result = cudf::lists::contains(cudf::lists_column_view(input), cudf::string_scalar("bc"));
+
+  cudf::test::fixed_width_column_wrapper<bool> expected{1, 0, 1};
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(ContainsTest, Sliced)
+{
+  cudf::test::lists_column_wrapper<int32_t> input{{1, 2}, {3}, {4, 1}, {5}};
+
+  auto sliced = cudf::slice(input, {1, 4})[0];
+  auto result =
+    cudf::lists::contains(cudf::lists_column_view(sliced), cudf::numeric_scalar<int32_t>(1));
+
+  cudf::test::fixed_width_column_wrapper<bool> expected{0, 1, 0};
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(ContainsTest, TypeMismatch)
+{
+  cudf::test::lists_column_wrapper<int32_t> input{{1, 2}, {3}};
+
+  EXPECT_THROW(
+    cudf::lists::contains(cudf::lists_column_view(input), cudf::numeric_scalar<int64_t>(1)),
+    cudf::logic_error);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/lists/count_elements.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
+struct ListsElementsTest : public cudf::test::BaseFixture {
+};
+
+using LCW = cudf::test::lists_column_wrapper<int32_t>;
+
+TEST_F(ListsElementsTest, CountElements)
+{
+  LCW input{{1, 2, 3}, {4}, {LCW{}}, {5, 6}};
+
+  auto result = cudf::lists::count_elements(cudf::lists_column_view(input));
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{3, 1, 0, 2};
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(ListsElementsTest, CountElementsWithNulls)
+{
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 1; });
+  LCW input{{{1, 2, 3}, {4, 5}, {6}}, validity};
+  auto element_validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 0; });
+  LCW input_null_elements{{{1, 2}, element_validity}, {3}};
+
+  auto result = cudf::lists::count_elements(cudf::lists_column_view(input));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({3, 0, 1}, {1, 0, 1});
+  cudf::test::expect_columns_equal(expected, *result);
+
+  // Null elements are counted
+  result = cudf::lists::count_elements(cudf::lists_column_view(input_null_elements));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_null_elements{2, 1};
+  cudf::test::expect_columns_equal(expected_null_elements, *result);
+}
+
+TEST_F(ListsElementsTest, CountElementsSliced)
+{
+  LCW input{{1, 2, 3}, {4}, {5, 6}, {7, 8, 9, 10}};
+
+  auto sliced = cudf::slice(input, {1, 3})[0];
+  auto result = cudf::lists::count_elements(cudf::lists_column_view(sliced));
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{1, 2};
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(ListsElementsTest, Empty)
+{
+  LCW input{};
+  auto result = cudf::lists::count_elements(cudf::lists_column_view(cudf::slice(input, {0, 0})[0]));
+  EXPECT_EQ(result->size(), 0);
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/lists/sorting.hpp>
+
+template <typename T>
+struct SortLists : public cudf::test::BaseFixture {
+};
+
+using SortListsTypes = cudf::test::Types<int8_t, int32_t, int64_t, float, double>;
+
+TYPED_TEST_CASE(SortLists, SortListsTypes);
+
+TYPED_TEST(SortLists, Basic)
+{
+  using T   = TypeParam;
+  using LCW = cudf::test::lists_column_wrapper<T>;
+
+  LCW input{{3, 1, 2}, LCW{}, {5, 4}, {7}, {9, 8, 9, 6}};
+
+  auto ascending = cudf::lists::sort_lists(
+    cudf::lists_column_view(input), cudf::order::ASCENDING, cudf::null_order::AFTER);
+  LCW expected_ascending{{1, 2, 3}, LCW{}, {4, 5}, {7}, {6, 8, 9, 9}};
+  cudf::test::expect_columns_equal(expected_ascending, *ascending);
+
+  auto descending = cudf::lists::sort_lists(
+    cudf::lists_column_view(input), cudf::order::DESCENDING, cudf::null_order::AFTER);
+  LCW expected_descending{{3, 2, 1}, LCW{}, {5, 4}, {7}, {9, 9, 8, 6}};
+  cudf::test::expect_columns_equal(expected_descending, *descending);
+}
+
+TYPED_TEST(SortLists, Nulls)
+{
+  using T   = TypeParam;
+  using LCW = cudf::test::lists_column_wrapper<T>;
+
+  auto list_validity =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 1; });
+  auto first_null = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 0; });
+  auto last_null  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 2; });
+  LCW input{{{{3, 5, 4}, first_null}, {6, 1}, {2, 1}}, list_validity};
+
+  auto result = cudf::lists::sort_lists(
+    cudf::lists_column_view(input), cudf::order::ASCENDING, cudf::null_order::AFTER);
+  LCW expected{{{{4, 5, 3}, last_null}, {6, 1}, {1, 2}}, list_validity};
+  cudf::test::expect_columns_equal(expected, *result);
+
+  result = cudf::lists::sort_lists(
+    cudf::lists_column_view(input), cudf::order::ASCENDING, cudf::null_order::BEFORE);
+  LCW expected_nulls_first{{{{3, 4, 5}, first_null}, {6, 1}, {1, 2}}, list_validity};
+  cudf::test::expect_columns_equal(expected_nulls_first, *result);
+}
+
+struct SortListsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SortListsTest, Sliced)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+
+  LCW input{{3, 2}, {5, 4, 6}, {8, 7}, {1, 0}};
+
+  auto sliced = cudf::slice(input, {1, 3})[0];
+  auto result = cudf::lists::sort_lists(
+    cudf::lists_column_view(sliced), cudf::order::ASCENDING, cudf::null_order::AFTER);
+
+  LCW expected{{4, 5, 6}, {7, 8}};
+  cudf::test::expect_columns_equal(expected, *result);
+}
+
+TEST_F(SortListsTest, Strings)
+{
+  using LCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+
+  LCW input{{"c", "a", "b"}, {"z"}, {"yy", "xx"}};
+
+  auto result = cudf::lists::sort_lists(
+    cudf::lists_column_view(input), cudf::order::ASCENDING, cudf::null_order::AFTER);
+
+  LCW expected{{"a", "b", "c"}, {"z"}, {"xx", "yy"}};
+  cudf::test::expect_columns_equal(expected, *result);
+}
@@ -21,6 +21,7 @@
 
 #include <rmm/thrust_rmm_allocator.h>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/merge.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <tests/utilities/column_utilities.hpp>
@@ -719,4 +720,69 @@ TYPED_TEST(MergeTest_, NMerge1KeyColumns)
   cudf::test::expect_columns_equal(expected_column_view2, output_column_view2);
 }
 
+class MergeTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MergeTest, MultiwayMergeWithNulls)
+{
+  using int_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+  using str_wrapper = cudf::test::strings_column_wrapper;
+
+  int_wrapper keys1({1, 4, 7, 0}, {1, 1, 1, 0});
+  str_wrapper values1({"a", "b", "c", "d"});
+  int_wrapper keys2({2, 4, 8});
+  str_wrapper values2({"e", "f", "g"});
+  int_wrapper keys3({0, 3, 4, 9, 0}, {1, 1, 1, 1, 0});
+  str_wrapper values3({"h", "i", "j", "k", "l"});
+  std::vector<cudf::table_view> tables{cudf::table_view{{keys1, values1}},
+                                       cudf::table_view{{keys2, values2}},
+                                       cudf::table_view{{keys3, values3}}};
+
+  auto const result =
+    cudf::merge(tables, {0}, {cudf::order::ASCENDING}, {cudf::null_order::AFTER});
+
+  // Equal keys are ordered by input table
+  int_wrapper expected_keys({0, 1, 2, 3, 4, 4, 4, 7, 8, 9, 0, 0},
+                            {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0});
+  str_wrapper expected_values({"h", "a", "e", "i", "b", "f", "j", "c", "g", "k", "d", "l"});
+  cudf::test::expect_columns_equal(result->get_column(0), expected_keys);
+  cudf::test::expect_columns_equal(result->get_column(1), expected_values);
+}
+
+TEST_F(MergeTest, ChunkedMerge)
+{
+  using int_wrapper        = cudf::test::fixed_width_column_wrapper<int32_t>;
+  constexpr int num_tables = 5;
+  constexpr int num_rows   = 100;
+
+  std::vector<int_wrapper> keys;
+  std::vector<int_wrapper> values;
+  std::vector<cudf::table_view> tables;
+  for (int t = 0; t < num_tables; ++t) {
+    auto key =
+      cudf::test::make_counting_transform_iterator(0, [t](auto i) { return i * (t + 1); });
+    auto value = cudf::test::make_counting_transform_iterator(0, [t](auto) { return t; });
+    keys.emplace_back(key, key + num_rows);
+    values.emplace_back(value, value + num_rows);
+  }
+  for (int t = 0; t < num_tables; ++t) {
+    tables.push_back(cudf::table_view{{keys[t], values[t]}});
+  }
+  std::vector<cudf::size_type> key_cols{0};
+  auto const expected = cudf::merge(tables, key_cols, {cudf::order::ASCENDING});
+
+  cudf::chunked_merge merger(tables, key_cols, {cudf::order::ASCENDING}, {}, 128);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (merger.has_next()) {
+    chunks.push_back(merger.next());
+    EXPECT_LE(chunks.back()->num_rows(), 128);
+  }
+  EXPECT_EQ(chunks.size(), 4u);
+  EXPECT_THROW(merger.next(), cudf::logic_error);
+
+  std::vector<cudf::table_view> chunk_views;
+  for (auto const& chunk : chunks) { chunk_views.push_back(chunk->view()); }
+  cudf::test::expect_tables_equal(*cudf::concatenate(chunk_views), *expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
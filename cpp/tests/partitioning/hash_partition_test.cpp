@@ -13,6 +13,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
+#include <cudf/filling.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/sorting.hpp>
@@ -285,4 +287,149 @@ TYPED_TEST(HashPartitionFixedWidth, HasNulls)
   run_fixed_width_test<TypeParam>(10, 1000, 10, true);
 }
 
+TYPED_TEST(HashPartitionFixedWidth, RadixPartitioning)
+{
+  // Enough partitions to take the radix sort path, with and without a power of two
+  run_fixed_width_test<TypeParam>(2, 50000, 20000, true);
+  run_fixed_width_test<TypeParam>(2, 50000, 16384);
+}
+
+TEST_F(HashPartition, XXHash64)
+{
+  fixed_width_column_wrapper<int64_t> keys({5, 9, 1, 5, 3, 0, 9, 7, 2, 5},
+                                           {1, 1, 1, 1, 0, 1, 1, 1, 1, 1});
+  strings_column_wrapper values({"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"});
+  auto input = cudf::table_view({keys, values});
+
+  cudf::size_type const num_partitions = 3;
+  std::unique_ptr<cudf::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) =
+    cudf::hash_partition(input, {0}, num_partitions, cudf::hash_id::HASH_XXHASH64);
+  expect_table_properties_equal(input, output->view());
+  offsets.push_back(input.num_rows());
+
+  // Every row is in the partition of its 64-bit hash
+  auto const hashes =
+    cudf::hash(cudf::table_view({output->get_column(0)}), cudf::hash_id::HASH_XXHASH64);
+  auto const host_hashes = cudf::test::to_host<uint64_t>(hashes->view()).first;
+  for (cudf::size_type p = 0; p < num_partitions; ++p) {
+    for (auto row = offsets[p]; row < offsets[p + 1]; ++row) {
+      EXPECT_EQ(static_cast<uint64_t>(p), host_hashes[row] % num_partitions);
+    }
+  }
+}
+
+TEST_F(HashPartition, PrecomputedHashes)
+{
+  fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4, 5, 6, 1, 2, 5},
+                                           {1, 0, 1, 1, 0, 1, 1, 1, 1});
+  strings_column_wrapper strings({"a", "", "ccc", "dd", "e", "ffff", "a", "bb", "e"},
+                                 {1, 1, 0, 1, 1, 1, 1, 0, 1});
+  auto input = cudf::table_view({ints, strings});
+
+  // The rows go to the partitions of the function that computed their hashes
+  for (auto const hash_function : {cudf::hash_id::HASH_MURMUR3, cudf::hash_id::HASH_XXHASH64}) {
+    auto const row_hashes = cudf::hash(input, hash_function);
+    for (cudf::size_type const num_partitions : {3, 4, 2000}) {
+      auto const expected = cudf::hash_partition(input, {0, 1}, num_partitions, hash_function);
+      auto const result   = cudf::hash_partition(input, row_hashes->view(), num_partitions);
+      expect_tables_equal(expected.first->view(), result.first->view());
+      EXPECT_EQ(expected.second, result.second);
+
+      auto const packed = cudf::hash_partition_and_pack(input, row_hashes->view(), num_partitions);
+      ASSERT_EQ(packed.size(), static_cast<size_t>(num_partitions));
+      auto offsets = expected.second;
+      offsets.push_back(input.num_rows());
+      for (cudf::size_type p = 0; p < num_partitions; ++p) {
+        auto const part = cudf::slice(expected.first->view(), {offsets[p], offsets[p + 1]})[0];
+        expect_tables_equal(part, cudf::unpack(packed[p]));
+      }
+    }
+  }
+
+  fixed_width_column_wrapper<int16_t> short_hashes{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  EXPECT_THROW(cudf::hash_partition(input, short_hashes, 3), cudf::logic_error);
+  fixed_width_column_wrapper<int32_t> too_few_hashes{1, 2, 3};
+  EXPECT_THROW(cudf::hash_partition(input, too_few_hashes, 3), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
+
+void expect_packed_partitions_equal(cudf::table_view const& input,
+                                    std::vector<cudf::size_type> const& columns_to_hash,
+                                    cudf::size_type num_partitions)
+{
+  std::unique_ptr<cudf::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) = cudf::hash_partition(input, columns_to_hash, num_partitions);
+  auto const packed = cudf::hash_partition_and_pack(input, columns_to_hash, num_partitions);
+  ASSERT_EQ(packed.size(), static_cast<size_t>(num_partitions));
+
+  offsets.push_back(input.num_rows());
+  for (cudf::size_type p = 0; p < num_partitions; ++p) {
+    auto const expected = cudf::slice(output->view(), {offsets[p], offsets[p + 1]})[0];
+    expect_tables_equal(expected, cudf::unpack(packed[p]));
+  }
+}
+
+TEST_F(HashPartition, PackMixedColumnTypes)
+{
+  fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4, 5, 6, 1, 2, 5},
+                                           {1, 0, 1, 1, 0, 1, 1, 1, 1});
+  fixed_width_column_wrapper<double> doubles{1.5, 2.0, -3.0, 4.0, 5.5, 6.0, 1.5, 2.0, 5.5};
+  strings_column_wrapper strings({"a", "", "ccc", "dd", "e", "ffff", "a", "bb", "e"},
+                                 {1, 1, 0, 1, 1, 1, 1, 0, 1});
+  cudf::table_view input({ints, doubles, strings});
+
+  expect_packed_partitions_equal(input, {0}, 1);
+  expect_packed_partitions_equal(input, {0, 2}, 3);
+  // more partitions than rows leaves some partitions empty
+  expect_packed_partitions_equal(input, {1}, 20);
+  // too many partitions for the shared memory path
+  expect_packed_partitions_equal(input, {2}, 2000);
+}
+
+TEST_F(HashPartition, PackSliced)
+{
+  fixed_width_column_wrapper<int64_t> ints({7, 1, 2, 3, 4, 5, 6, 7}, {1, 1, 0, 1, 1, 0, 1, 1});
+  strings_column_wrapper strings({"x", "a", "bb", "", "ccc", "d", "ee", "f"},
+                                 {1, 1, 1, 1, 0, 1, 1, 1});
+  auto const input = cudf::slice(cudf::table_view({ints, strings}), {1, 8})[0];
+
+  expect_packed_partitions_equal(input, {0}, 4);
+}
+
+TEST_F(HashPartition, PackRadixPartitioning)
+{
+  auto iter = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int32_t> keys(iter, iter + 20000);
+  strings_column_wrapper values({"a", "bb", "ccc", "dddd"});
+  auto repeated = cudf::repeat(cudf::table_view({values}), 5000);
+  auto input    = cudf::table_view({keys, repeated->get_column(0)});
+
+  expect_packed_partitions_equal(input, {0}, 10000);
+}
+
+TEST_F(HashPartition, PackEmpty)
+{
+  fixed_width_column_wrapper<float> floats({});
+  strings_column_wrapper strings({});
+  cudf::table_view input({floats, strings});
+
+  EXPECT_TRUE(cudf::hash_partition_and_pack(input, {0}, 0).empty());
+  auto const packed = cudf::hash_partition_and_pack(input, {0}, 3);
+  ASSERT_EQ(packed.size(), 3u);
+  for (auto const& partition : packed) {
+    expect_table_properties_equal(input, cudf::unpack(partition));
+  }
+}
+
+TEST_F(HashPartition, PackUnsupportedType)
+{
+  cudf::test::lists_column_wrapper<int32_t> lists{{1, 2}, {3}, {}};
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3};
+  cudf::table_view input({keys, lists});
+
+  EXPECT_THROW(cudf::hash_partition_and_pack(input, {0}, 2), cudf::logic_error);
+}
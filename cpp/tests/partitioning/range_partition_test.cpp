@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/copying.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+using cudf::test::expect_columns_equal;
+using cudf::test::expect_tables_equal;
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct RangePartition : public cudf::test::BaseFixture {
+};
+
+TEST_F(RangePartition, SingleColumn)
+{
+  fixed_width_column_wrapper<int32_t> keys{5, 1, 9, 3, 7, 3};
+  fixed_width_column_wrapper<int32_t> splitters{3, 7};
+
+  std::unique_ptr<cudf::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) =
+    cudf::range_partition(cudf::table_view({keys}), {0}, cudf::table_view({splitters}));
+
+  EXPECT_EQ(offsets, (std::vector<cudf::size_type>{0, 3, 5, 6}));
+  // the order within each partition is undefined, but the partitions are in key order
+  auto const sorted = cudf::sort(output->view());
+  fixed_width_column_wrapper<int32_t> expected{1, 3, 3, 5, 7, 9};
+  expect_columns_equal(expected, sorted->get_column(0));
+  auto const middle = cudf::slice(output->view(), {3, 5})[0];
+  fixed_width_column_wrapper<int32_t> expected_middle{5, 7};
+  expect_columns_equal(expected_middle, cudf::sort(middle)->get_column(0));
+}
+
+TEST_F(RangePartition, DescendingWithNulls)
+{
+  fixed_width_column_wrapper<int64_t> keys({4, 8, 0, 2, 6, 1}, {1, 1, 0, 1, 1, 1});
+  strings_column_wrapper values({"d", "h", "null", "b", "f", "a"});
+  fixed_width_column_wrapper<int64_t> splitters{5, 2};
+  cudf::table_view input({values, keys});
+
+  std::unique_ptr<cudf::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) = cudf::range_partition(input,
+                                                    {1},
+                                                    cudf::table_view({splitters}),
+                                                    {cudf::order::DESCENDING},
+                                                    {cudf::null_order::AFTER});
+
+  // {8, 6} sort before 5, {4, 2} before 2 or equal to it, and {1, null} after
+  EXPECT_EQ(offsets, (std::vector<cudf::size_type>{0, 2, 4, 6}));
+  auto const sorted = cudf::sort_by_key(output->view(),
+                                        output->view().select({1}),
+                                        {cudf::order::DESCENDING},
+                                        {cudf::null_order::AFTER});
+  strings_column_wrapper expected({"h", "f", "d", "b", "a", "null"});
+  expect_columns_equal(expected, sorted->get_column(0));
+}
+
+TEST_F(RangePartition, PackMatchesRangePartition)
+{
+  fixed_width_column_wrapper<int32_t> keys({7, 2, 9, 4, 4, 0, 5, 8, 1, 3},
+                                           {1, 1, 1, 1, 0, 1, 1, 1, 1, 1});
+  strings_column_wrapper values({"g", "b", "i", "dd", "", "z", "e", "h", "a", "ccc"},
+                                {1, 1, 1, 1, 1, 0, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> splitters({2, 5, 8});
+  cudf::table_view input({keys, values});
+
+  std::unique_ptr<cudf::table> output;
+  std::vector<cudf::size_type> offsets;
+  std::tie(output, offsets) = cudf::range_partition(input, {0}, cudf::table_view({splitters}));
+  auto const packed = cudf::range_partition_and_pack(input, {0}, cudf::table_view({splitters}));
+  ASSERT_EQ(packed.size(), 4u);
+
+  for (size_t p = 0; p < packed.size(); ++p) {
+    auto const expected = cudf::slice(output->view(), {offsets[p], offsets[p + 1]})[0];
+    expect_tables_equal(cudf::sort(expected)->view(), cudf::sort(cudf::unpack(packed[p]))->view());
+  }
+}
+
+TEST_F(RangePartition, SampledSplitters)
+{
+  std::vector<int32_t> values(1000);
+  std::iota(values.begin(), values.end(), 0);
+  std::reverse(values.begin(), values.end());
+  fixed_width_column_wrapper<int32_t> keys(values.begin(), values.end());
+  cudf::table_view input({keys});
+
+  // sampling every row makes the splitters the exact quantiles
+  auto const splitters = cudf::sample_splitters(input, 4, 1000);
+  fixed_width_column_wrapper<int32_t> expected{250, 500, 750};
+  expect_columns_equal(expected, splitters->get_column(0));
+
+  auto const sampled = cudf::sample_splitters(input, 8, 100, {}, {}, 7);
+  EXPECT_EQ(sampled->num_rows(), 7);
+  auto const result = cudf::range_partition(input, {0}, sampled->view());
+  EXPECT_EQ(result.second.size(), 9u);
+  expect_columns_equal(sampled->get_column(0), cudf::sort(sampled->view())->get_column(0));
+
+  EXPECT_EQ(cudf::sample_splitters(input, 1, 100)->num_rows(), 0);
+  EXPECT_THROW(cudf::sample_splitters(input, 0, 100), cudf::logic_error);
+}
+
+TEST_F(RangePartition, InvalidSplitters)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2, 3};
+  fixed_width_column_wrapper<float> splitters{2};
+  cudf::table_view input({keys});
+
+  EXPECT_THROW(cudf::range_partition(input, {0}, cudf::table_view({splitters})),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::range_partition(input, {0}, cudf::table_view({keys, keys})),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::range_partition(input, {1}, cudf::table_view({keys})), std::out_of_range);
+}
@@ -420,6 +420,50 @@ TYPED_TEST(QuantileTest, TestEmpty)
   auto actual   = cudf::quantile(input, {0.5, 0.25});
 }
 
+TYPED_TEST(QuantileTest, TestUnsortedSelection)
+{
+  using T = TypeParam;
+  fixed_width_column_wrapper<T, int32_t> input({7, 1, 0, 5, 3, 9, 2, 4}, {1, 1, 0, 1, 1, 1, 0, 1});
+  fixed_width_column_wrapper<T, int32_t> sorted({1, 3, 4, 5, 7, 9});
+  // Few enough quantiles to be selected, and enough to fall back to sorting
+  vector<vector<double>> const qs{
+    {0.5}, {0, 0.3, 0.8, 1}, {0, 0.1, 0.2, 0.3, 0.4, 0.6, 0.7, 0.9, 1}};
+
+  for (auto const& q : qs) {
+    for (auto interp : {interpolation::LINEAR,
+                        interpolation::LOWER,
+                        interpolation::HIGHER,
+                        interpolation::MIDPOINT,
+                        interpolation::NEAREST}) {
+      expect_columns_equal(cudf::quantile(sorted, q, interp)->view(),
+                           cudf::quantile_unsorted(input, q, interp)->view());
+      expect_columns_equal(cudf::quantile(sorted, q, interp, {}, false)->view(),
+                           cudf::quantile_unsorted(input, q, interp, false)->view());
+    }
+  }
+}
+
+TYPED_TEST(QuantileTest, TestUnsortedAllElementsInvalid)
+{
+  fixed_width_column_wrapper<TypeParam, int32_t> input({1, 2, 3}, {0, 0, 0});
+  fixed_width_column_wrapper<double> expected({0, 0}, {0, 0});
+
+  expect_columns_equal(expected, cudf::quantile_unsorted(input, {0.5, 0.25})->view());
+}
+
+struct QuantileUnsortedTest : public BaseFixture {
+};
+
+TEST_F(QuantileUnsortedTest, NegativeAndNaN)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  fixed_width_column_wrapper<double> input({2.5, -1.0, nan, -3.5, 0.0});
+  fixed_width_column_wrapper<double> expected({-3.5, -1.0, 0.0, 2.5});
+
+  auto const actual = cudf::quantile_unsorted(input, {0, 0.25, 0.5, 0.75}, interpolation::LOWER);
+  expect_columns_equal(expected, actual->view());
+}
+
 template <typename T>
 struct QuantileUnsupportedTypesTest : public BaseFixture {
 };
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/quantiles.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+using namespace cudf;
+using namespace test;
+
+struct TDigestTest : public BaseFixture {
+};
+
+TEST_F(TDigestTest, MergedDigestsMatchDigestOfAllValues)
+{
+  fixed_width_column_wrapper<int32_t> lhs{5, 1, 9, 3};
+  fixed_width_column_wrapper<int32_t> rhs{7, 2, 8};
+  fixed_width_column_wrapper<int32_t> all{5, 1, 9, 3, 7, 2, 8};
+
+  auto const lhs_digest = tdigest(lhs);
+  auto const rhs_digest = tdigest(rhs);
+  auto const digests    = concatenate({lhs_digest->view(), rhs_digest->view()});
+  auto const merged     = merge_tdigests(digests->view());
+  auto const expected   = tdigest(all);
+  expect_tables_equal(expected->view(), merged->view());
+
+  // Few enough values to each be a centroid of its own
+  fixed_width_column_wrapper<double> expect_quantiles{1., 2.25, 5., 9.};
+  expect_columns_equal(expect_quantiles,
+                       *tdigest_quantiles(merged->view(), 1, {0, 0.25, 0.5, 1}));
+}
+
+TEST_F(TDigestTest, GroupedDigests)
+{
+  fixed_width_column_wrapper<double> values({1., 4., 2., 8., 3., 5., 6., 7.},
+                                            {1, 1, 1, 1, 0, 1, 1, 1});
+  // Rows with a null label or a label outside [0, num_groups) are ignored
+  fixed_width_column_wrapper<int32_t> labels({0, 2, 0, 2, 0, 2, -1, 9}, {1, 1, 1, 0, 1, 1, 1, 1});
+
+  auto const digests = tdigest(values, labels, 4);
+  fixed_width_column_wrapper<int32_t> expect_groups{0, 0, 2, 2};
+  fixed_width_column_wrapper<double> expect_means{1., 2., 4., 5.};
+  fixed_width_column_wrapper<double> expect_weights{1., 1., 1., 1.};
+  expect_tables_equal(table_view{{expect_groups, expect_means, expect_weights}}, digests->view());
+
+  fixed_width_column_wrapper<double> expect_medians({1.5, 0., 4.5, 0.}, {1, 0, 1, 0});
+  expect_columns_equal(expect_medians, *tdigest_quantiles(digests->view(), 4, {0.5}));
+}
+
+TEST_F(TDigestTest, CompressionBoundsCentroids)
+{
+  constexpr size_type num_rows{100000};
+  auto values = make_counting_transform_iterator(0, [](auto i) { return (i * 7919) % num_rows; });
+  fixed_width_column_wrapper<int32_t> col(values, values + num_rows);
+
+  auto const digest = tdigest(col, {}, 1, 50);
+  EXPECT_LE(digest->num_rows(), 26);
+
+  auto const quantiles = tdigest_quantiles(digest->view(), 1, {0.25, 0.5, 0.75});
+  auto const h_quantiles = to_host<double>(*quantiles).first;
+  EXPECT_NEAR(h_quantiles[0] / num_rows, 0.25, 0.01);
+  EXPECT_NEAR(h_quantiles[1] / num_rows, 0.5, 0.01);
+  EXPECT_NEAR(h_quantiles[2] / num_rows, 0.75, 0.01);
+}
+
+TEST_F(TDigestTest, InvalidInputs)
+{
+  strings_column_wrapper strings{"a", "b"};
+  fixed_width_column_wrapper<int32_t> values{1, 2};
+  fixed_width_column_wrapper<int64_t> wrong_labels{0, 0};
+  fixed_width_column_wrapper<int32_t> short_labels{0};
+
+  EXPECT_THROW(tdigest(strings), logic_error);
+  EXPECT_THROW(tdigest(values, wrong_labels), logic_error);
+  EXPECT_THROW(tdigest(values, short_labels), logic_error);
+  EXPECT_THROW(tdigest(values, {}, 1, 0.5), logic_error);
+
+  auto const digest = tdigest(values);
+  EXPECT_THROW(tdigest_quantiles(digest->view(), 1, {1.5}), logic_error);
+  EXPECT_THROW(tdigest_quantiles(table_view{{values}}, 1, {0.5}), logic_error);
+  EXPECT_THROW(merge_tdigests(table_view{{values, values, values}}), logic_error);
+}
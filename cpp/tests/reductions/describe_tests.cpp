@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/describe.hpp>
+
+#include <vector>
+
+struct DescribeTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(DescribeTest, SegmentsAndTotals)
+{
+  // Segments: {5, 1, null}, {7, 3, 3}, {null, null}
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{5, 1, 0, 7, 3, 3, 0, 0},
+                                                       {1, 1, 0, 1, 1, 1, 0, 0}};
+  cudf::test::strings_column_wrapper strings{{"b", "a", "", "dd", "c", "c", "", ""},
+                                             {1, 1, 0, 1, 1, 1, 0, 0}};
+  auto const result = cudf::describe(cudf::table_view{{ints, strings}}, 3);
+  ASSERT_EQ(result.size(), 2u);
+
+  using int32_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+  using int64_wrapper = cudf::test::fixed_width_column_wrapper<int64_t>;
+
+  auto const &ints_segments = result[0].segments;
+  cudf::test::expect_columns_equal(*ints_segments.min, int32_wrapper{{1, 3, 0}, {1, 1, 0}});
+  cudf::test::expect_columns_equal(*ints_segments.max, int32_wrapper{{5, 7, 0}, {1, 1, 0}});
+  cudf::test::expect_columns_equal(*ints_segments.null_count, int32_wrapper{1, 0, 2});
+  cudf::test::expect_columns_equal(*ints_segments.sum, int64_wrapper{{6, 13, 0}, {1, 1, 0}});
+  cudf::test::expect_columns_equal(*ints_segments.distinct_count, int64_wrapper{2, 2, 0});
+
+  auto const &ints_total = result[0].total;
+  cudf::test::expect_columns_equal(*ints_total.min, int32_wrapper{1});
+  cudf::test::expect_columns_equal(*ints_total.max, int32_wrapper{7});
+  cudf::test::expect_columns_equal(*ints_total.null_count, int32_wrapper{3});
+  cudf::test::expect_columns_equal(*ints_total.sum, int64_wrapper{19});
+  cudf::test::expect_columns_equal(*ints_total.distinct_count, int64_wrapper{4});
+
+  // The sum of a string column is the total length of its strings
+  auto const &strings_segments = result[1].segments;
+  cudf::test::expect_columns_equal(*strings_segments.min,
+                                   cudf::test::strings_column_wrapper{{"a", "c", ""}, {1, 1, 0}});
+  cudf::test::expect_columns_equal(*strings_segments.max,
+                                   cudf::test::strings_column_wrapper{{"b", "dd", ""}, {1, 1, 0}});
+  cudf::test::expect_columns_equal(*strings_segments.sum, int64_wrapper{{2, 4, 0}, {1, 1, 0}});
+  cudf::test::expect_columns_equal(*strings_segments.distinct_count, int64_wrapper{2, 2, 0});
+  cudf::test::expect_columns_equal(*result[1].total.distinct_count, int64_wrapper{4});
+}
+
+TEST_F(DescribeTest, SlicedInput)
+{
+  cudf::test::fixed_width_column_wrapper<double> values{{0.5, 1.5, -2.0, 4.0, 0.0, 8.0},
+                                                        {1, 0, 1, 1, 0, 1}};
+  cudf::test::strings_column_wrapper strings{{"x", "", "yy", "zzz", "", "w"}, {1, 0, 1, 1, 0, 1}};
+  auto const sliced = cudf::slice(cudf::table_view{{values, strings}}, {1, 6})[0];
+  auto const result = cudf::describe(sliced, 10);
+
+  using double_wrapper = cudf::test::fixed_width_column_wrapper<double>;
+  cudf::test::expect_columns_equal(*result[0].total.min, double_wrapper{-2.0});
+  cudf::test::expect_columns_equal(*result[0].total.max, double_wrapper{8.0});
+  cudf::test::expect_columns_equal(*result[0].total.sum, double_wrapper{10.0});
+  cudf::test::expect_columns_equal(*result[0].total.null_count,
+                                   cudf::test::fixed_width_column_wrapper<int32_t>{2});
+  cudf::test::expect_columns_equal(*result[1].total.min, cudf::test::strings_column_wrapper{"w"});
+  cudf::test::expect_columns_equal(*result[1].total.max,
+                                   cudf::test::strings_column_wrapper{"zzz"});
+}
+
+TEST_F(DescribeTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{1, 2, 3};
+  EXPECT_THROW(cudf::describe(cudf::table_view{{ints}}, 0), cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<uint32_t> unsigned_ints{1, 2, 3};
+  EXPECT_THROW(cudf::describe(cudf::table_view{{unsigned_ints}}, 2), cudf::logic_error);
+}
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
@@ -886,6 +887,42 @@ TYPED_TEST(ReductionTest, Quantile)
                        cudf::make_quantile_aggregation({1}, interp));
 }
 
+TYPED_TEST(ReductionTest, ApproxQuantile)
+{
+  using T = TypeParam;
+  //{-20, -14, -13,  0, 6, 13, 45, 64/None}
+  std::vector<int> int_values({6, -14, 13, 64, 0, -13, -20, 45});
+  std::vector<bool> host_bools({1, 1, 1, 0, 1, 1, 1, 1});
+  std::vector<T> v = convert_values<T>(int_values);
+
+  // With fewer values than the compression every value is a centroid of its
+  // own, so the median and the extremes are exact
+  cudf::test::fixed_width_column_wrapper<T> col(v.begin(), v.end());
+  double expected_median = [] {
+    if (std::is_same<T, bool>::value) return 1.0;
+    if (std::is_signed<T>::value) return 3.0;
+    return 13.5;
+  }();
+  this->reduction_test(col, expected_median, true, cudf::make_approx_quantile_aggregation({0.5}));
+  double expected_min = std::is_same<T, bool>::value || std::is_unsigned<T>::value ? v[4] : v[6];
+  this->reduction_test(col, expected_min, true, cudf::make_approx_quantile_aggregation({0.0}));
+  double expected_max = v[3];
+  this->reduction_test(col, expected_max, true, cudf::make_approx_quantile_aggregation({1.0}));
+
+  // Nulls are ignored
+  cudf::test::fixed_width_column_wrapper<T> col_nulls = construct_null_column(v, host_bools);
+  double expected_null_median = [] {
+    if (std::is_same<T, bool>::value) return 1.0;
+    if (std::is_signed<T>::value) return 0.0;
+    return 13.0;
+  }();
+  this->reduction_test(
+    col_nulls, expected_null_median, true, cudf::make_approx_quantile_aggregation({0.5}));
+
+  EXPECT_THROW(cudf::reduce(col, cudf::make_approx_quantile_aggregation({0.5, 0.9}), {}),
+               cudf::logic_error);
+}
+
 TYPED_TEST(ReductionTest, UniqueCount)
 {
   using T = TypeParam;
@@ -920,4 +957,163 @@ TYPED_TEST(ReductionTest, UniqueCount)
                        cudf::make_nunique_aggregation(cudf::null_policy::EXCLUDE));
 }
 
+TYPED_TEST(ReductionTest, ApproxCountDistinct)
+{
+  using T = TypeParam;
+  std::vector<int> int_values({1, -3, 1, 2, 0, 2, -4, 45});  // 6 unique values
+  std::vector<bool> host_bools({1, 1, 1, 0, 1, 1, 1, 1});
+  std::vector<T> v = convert_values<T>(int_values);
+
+  // Small cardinalities are estimated by linear counting, which is exact until
+  // two values share a register
+  cudf::test::fixed_width_column_wrapper<T> col(v.begin(), v.end());
+  int64_t expected_value = std::is_same<T, bool>::value ? 2 : 6;
+  this->reduction_test(
+    col, expected_value, true, cudf::make_approx_count_distinct_aggregation());
+
+  // Nulls are never counted
+  cudf::test::fixed_width_column_wrapper<T> col_nulls = construct_null_column(v, host_bools);
+  this->reduction_test(
+    col_nulls, expected_value, true, cudf::make_approx_count_distinct_aggregation());
+}
+
+struct ApproxCountDistinctReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ApproxCountDistinctReductionTest, relative_error)
+{
+  constexpr cudf::size_type num_rows{1 << 20};
+  constexpr cudf::size_type num_distinct{200000};
+  auto values = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>(i % num_distinct) * 7919; });
+  cudf::test::fixed_width_column_wrapper<int64_t> col(values, values + num_rows);
+
+  for (int precision : {10, 14}) {
+    auto const result =
+      cudf::reduce(col, cudf::make_approx_count_distinct_aggregation(precision), {});
+    auto const estimate = static_cast<cudf::scalar_type_t<int64_t> *>(result.get())->value();
+    // Four times the relative standard error of the estimate
+    auto const tolerance = 4 * 1.04 / std::sqrt(double(1 << precision));
+    EXPECT_NEAR(estimate, num_distinct, tolerance * num_distinct);
+  }
+
+  EXPECT_THROW(cudf::reduce(col, cudf::make_approx_count_distinct_aggregation(3), {}),
+               cudf::logic_error);
+}
+
+struct ApproxQuantileReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ApproxQuantileReductionTest, rank_error)
+{
+  // A permutation of [0, num_rows) spanning several chunks of rows
+  constexpr cudf::size_type num_rows{1 << 25};
+  auto values = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>((i * int64_t{48271}) % num_rows); });
+  cudf::test::fixed_width_column_wrapper<int64_t> col(values, values + num_rows);
+
+  for (double q : {0.001, 0.01, 0.5, 0.95, 0.99, 0.999}) {
+    auto const result = cudf::reduce(col, cudf::make_approx_quantile_aggregation({q}), {});
+    auto const estimate = static_cast<cudf::scalar_type_t<double> *>(result.get())->value();
+    EXPECT_NEAR(estimate / num_rows, q, 0.001 + 0.01 * std::min(q, 1 - q));
+  }
+}
+
+struct FixedPointReductionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(FixedPointReductionTest, SumMinMax)
+{
+  using namespace numeric;
+  auto const scale = scale_type{-3};
+  cudf::test::fixed_point_column_wrapper<int32_t> col({1250, -3001, 42, 7000, 100},
+                                                      {1, 1, 1, 0, 1},
+                                                      scale);
+  auto const col_type = static_cast<cudf::column_view>(col).type();
+  cudf::data_type const sum_type{cudf::type_id::DECIMAL64, -3};
+
+  auto const sum = cudf::reduce(col, cudf::make_sum_aggregation(), sum_type);
+  EXPECT_EQ(sum->type(), sum_type);
+  auto const sum_value =
+    static_cast<cudf::fixed_point_scalar<decimal64> *>(sum.get())->fixed_point_value();
+  EXPECT_EQ(sum_value.value(), -1609);
+  EXPECT_EQ(static_cast<double>(sum_value), -1.609);
+
+  auto const min = cudf::reduce(col, cudf::make_min_aggregation(), col_type);
+  EXPECT_EQ(min->type(), col_type);
+  EXPECT_EQ(static_cast<cudf::fixed_point_scalar<decimal32> *>(min.get())->value(), -3001);
+
+  auto const max = cudf::reduce(col, cudf::make_max_aggregation(), col_type);
+  EXPECT_EQ(static_cast<cudf::fixed_point_scalar<decimal32> *>(max.get())->value(), 1250);
+
+  // The result of these reductions would depend on the scale
+  EXPECT_THROW(cudf::reduce(col, cudf::make_mean_aggregation(), sum_type), cudf::logic_error);
+  EXPECT_THROW(cudf::reduce(col, cudf::make_sum_aggregation(), col_type), cudf::logic_error);
+}
+
+struct TableReductionTest : public cudf::test::BaseFixture {
+  template <typename T>
+  void expect_equal(cudf::scalar const &lhs, cudf::scalar const &rhs)
+  {
+    ASSERT_EQ(lhs.type(), rhs.type());
+    ASSERT_EQ(lhs.is_valid(), rhs.is_valid());
+    if (!lhs.is_valid()) { return; }
+    auto const lhs_value = static_cast<cudf::scalar_type_t<T> const &>(lhs).value();
+    auto const rhs_value = static_cast<cudf::scalar_type_t<T> const &>(rhs).value();
+    EXPECT_DOUBLE_EQ(lhs_value, rhs_value);
+  }
+};
+
+TEST_F(TableReductionTest, FusedMatchesColumnReductions)
+{
+  std::vector<int32_t> ints(3000);
+  std::vector<double> doubles(3000);
+  std::vector<bool> valids(3000);
+  for (size_t i = 0; i < ints.size(); ++i) {
+    ints[i]    = static_cast<int32_t>((i * 7919) % 1000) - 500;
+    doubles[i] = 0.25 * ints[i];
+    valids[i]  = i % 7 != 0;
+  }
+  cudf::test::fixed_width_column_wrapper<int32_t> int_col(ints.begin(), ints.end(), valids.begin());
+  cudf::test::fixed_width_column_wrapper<double> double_col(doubles.begin(), doubles.end());
+  cudf::test::fixed_width_column_wrapper<int32_t> null_col(
+    ints.begin(), ints.end(), std::vector<bool>(ints.size(), false).begin());
+  cudf::table_view const table{{int_col, double_col, null_col}};
+
+  std::vector<std::vector<std::unique_ptr<aggregation>>> aggs(3);
+  aggs[0].push_back(cudf::make_sum_aggregation());
+  aggs[0].push_back(cudf::make_min_aggregation());
+  aggs[0].push_back(cudf::make_max_aggregation());
+  aggs[0].push_back(cudf::make_mean_aggregation());
+  aggs[0].push_back(cudf::make_variance_aggregation());
+  aggs[0].push_back(cudf::make_count_aggregation());
+  aggs[1].push_back(cudf::make_sum_of_squares_aggregation());
+  aggs[1].push_back(cudf::make_std_aggregation(0));
+  aggs[1].push_back(cudf::make_product_aggregation());
+  aggs[2].push_back(cudf::make_sum_aggregation());
+  aggs[2].push_back(cudf::make_count_aggregation(cudf::null_policy::INCLUDE));
+
+  auto const results = cudf::reduce(table, aggs);
+  ASSERT_EQ(results.size(), 3u);
+
+  auto const int64_type  = cudf::data_type{cudf::type_id::INT64};
+  auto const int32_type  = cudf::data_type{cudf::type_id::INT32};
+  auto const double_type = cudf::data_type{cudf::type_id::FLOAT64};
+  expect_equal<int64_t>(*results[0][0], *cudf::reduce(int_col, aggs[0][0], int64_type));
+  expect_equal<int32_t>(*results[0][1], *cudf::reduce(int_col, aggs[0][1], int32_type));
+  expect_equal<int32_t>(*results[0][2], *cudf::reduce(int_col, aggs[0][2], int32_type));
+  expect_equal<double>(*results[0][3], *cudf::reduce(int_col, aggs[0][3], double_type));
+  expect_equal<double>(*results[0][4], *cudf::reduce(int_col, aggs[0][4], double_type));
+  auto const valid_count = std::count(valids.begin(), valids.end(), true);
+  expect_equal<int32_t>(*results[0][5], cudf::numeric_scalar<int32_t>(valid_count));
+  expect_equal<double>(*results[1][0], *cudf::reduce(double_col, aggs[1][0], double_type));
+  expect_equal<double>(*results[1][1], *cudf::reduce(double_col, aggs[1][1], double_type));
+  expect_equal<double>(*results[1][2], *cudf::reduce(double_col, aggs[1][2], double_type));
+  EXPECT_FALSE(results[2][0]->is_valid());
+  expect_equal<int32_t>(*results[2][1], cudf::numeric_scalar<int32_t>(3000));
+
+  aggs.pop_back();
+  EXPECT_THROW(cudf::reduce(table, aggs), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/reduction.hpp>
+
+#include <numeric>
+#include <vector>
+
+using cudf::null_policy;
+
+template <typename T>
+struct SegmentedReductionTest : public cudf::test::BaseFixture {
+};
+
+using SegmentedReductionTypes = cudf::test::Types<int32_t, int64_t, float, double>;
+TYPED_TEST_CASE(SegmentedReductionTest, SegmentedReductionTypes);
+
+struct SegmentedReductionBasicTest : public cudf::test::BaseFixture {
+};
+
+TYPED_TEST(SegmentedReductionTest, SumMinMax)
+{
+  using T = TypeParam;
+  // Segments: {1, 2, 3}, {}, {4, null}, {null}, {5}
+  cudf::test::fixed_width_column_wrapper<T> values{{1, 2, 3, 4, 0, 0, 5}, {1, 1, 1, 1, 0, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets{0, 3, 3, 5, 6, 7};
+  auto const dtype = cudf::data_type{cudf::type_to_id<T>()};
+
+  auto const sum = cudf::segmented_reduce(
+    values, offsets, cudf::make_sum_aggregation(), dtype, null_policy::EXCLUDE);
+  cudf::test::expect_columns_equal(
+    *sum, cudf::test::fixed_width_column_wrapper<T>{{6, 0, 4, 0, 5}, {1, 0, 1, 0, 1}});
+
+  auto const min = cudf::segmented_reduce(
+    values, offsets, cudf::make_min_aggregation(), dtype, null_policy::EXCLUDE);
+  cudf::test::expect_columns_equal(
+    *min, cudf::test::fixed_width_column_wrapper<T>{{1, 0, 4, 0, 5}, {1, 0, 1, 0, 1}});
+
+  // A null value makes the result of its segment null
+  auto const max = cudf::segmented_reduce(
+    values, offsets, cudf::make_max_aggregation(), dtype, null_policy::INCLUDE);
+  cudf::test::expect_columns_equal(
+    *max, cudf::test::fixed_width_column_wrapper<T>{{3, 0, 0, 0, 5}, {1, 0, 0, 0, 1}});
+}
+
+TEST_F(SegmentedReductionBasicTest, ShortAndLongSegments)
+{
+  // Long segments are reduced with one block per segment, short ones with one warp per segment
+  for (cudf::size_type segment_size : {3, 1000}) {
+    auto const num_segments = 20;
+    std::vector<int32_t> values(segment_size * num_segments);
+    std::iota(values.begin(), values.end(), 0);
+    std::vector<int32_t> offsets(num_segments + 1);
+    std::vector<int64_t> expected(num_segments);
+    for (int i = 0; i <= num_segments; ++i) { offsets[i] = i * segment_size; }
+    for (int i = 0; i < num_segments; ++i) {
+      expected[i] = std::accumulate(
+        values.begin() + offsets[i], values.begin() + offsets[i + 1], int64_t{0});
+    }
+
+    cudf::test::fixed_width_column_wrapper<int32_t> d_values(values.begin(), values.end());
+    cudf::test::fixed_width_column_wrapper<int32_t> d_offsets(offsets.begin(), offsets.end());
+    auto const result = cudf::segmented_reduce(d_values,
+                                               d_offsets,
+                                               cudf::make_sum_aggregation(),
+                                               cudf::data_type{cudf::type_id::INT64},
+                                               null_policy::EXCLUDE);
+    cudf::test::expect_columns_equal(
+      *result, cudf::test::fixed_width_column_wrapper<int64_t>(expected.begin(), expected.end()));
+  }
+}
+
+TEST_F(SegmentedReductionBasicTest, AnyAll)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> values{0, 1, 0, 2, 3, 0};
+  cudf::test::fixed_width_column_wrapper<int32_t> offsets{0, 2, 4, 6};
+  auto const bool_type = cudf::data_type{cudf::type_id::BOOL8};
+
+  auto const any = cudf::segmented_reduce(
+    values, offsets, cudf::make_any_aggregation(), bool_type, null_policy::EXCLUDE);
+  cudf::test::expect_columns_equal(*any,
+                                   cudf::test::fixed_width_column_wrapper<bool>{true, true, true});
+  auto const all = cudf::segmented_reduce(
+    values, offsets, cudf::make_all_aggregation(), bool_type, null_policy::EXCLUDE);
+  cudf::test::expect_columns_equal(
+    *all, cudf::test::fixed_width_column_wrapper<bool>{false, false, false});
+
+  EXPECT_THROW(cudf::segmented_reduce(values,
+                                      offsets,
+                                      cudf::make_any_aggregation(),
+                                      cudf::data_type{cudf::type_id::INT32},
+                                      null_policy::EXCLUDE),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::segmented_reduce(values,
+                                      offsets,
+                                      cudf::make_mean_aggregation(),
+                                      cudf::data_type{cudf::type_id::FLOAT64},
+                                      null_policy::EXCLUDE),
+               cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
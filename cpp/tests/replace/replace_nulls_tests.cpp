@@ -17,6 +17,7 @@
  * limitations under the License.
  */
 
+#include <cudf/copying.hpp>
 #include <cudf/replace.hpp>
 
 #include <cudf/scalar/scalar.hpp>
@@ -297,4 +298,106 @@ TYPED_TEST(ReplaceNullsTest, LargeScaleScalar)
                                   expectedColumn.begin(), expectedColumn.end()));
 }
 
+TYPED_TEST(ReplaceNullsTest, SlicedInput)
+{
+  using T = TypeParam;
+
+  // An offset that is not a multiple of 32 makes every validity word span two input words, and
+  // the all-valid prefix exercises the all-valid words
+  std::vector<T> input_column(100), replace_column(100);
+  std::vector<cudf::valid_type> input_valid(100), replace_valid(100);
+  for (size_t i = 0; i < input_column.size(); i++) {
+    input_column[i]   = static_cast<T>(i % 2);
+    replace_column[i] = static_cast<T>(1);
+    input_valid[i]    = i < 40 || i % 3 == 0;
+    replace_valid[i]  = i % 5 != 0;
+  }
+  cudf::test::fixed_width_column_wrapper<T> input(
+    input_column.begin(), input_column.end(), input_valid.begin());
+  cudf::test::fixed_width_column_wrapper<T> replacement(
+    replace_column.begin(), replace_column.end(), replace_valid.begin());
+
+  std::vector<T> result_column;
+  std::vector<cudf::valid_type> result_valid;
+  for (size_t i = 7; i < 93; i++) {
+    result_column.push_back(input_valid[i] ? input_column[i] : replace_column[i]);
+    result_valid.push_back(input_valid[i] || replace_valid[i]);
+  }
+  cudf::test::fixed_width_column_wrapper<T> expected(
+    result_column.begin(), result_column.end(), result_valid.begin());
+
+  auto const result = cudf::replace_nulls(cudf::slice(input, {7, 93})[0],
+                                          cudf::slice(replacement, {7, 93})[0]);
+  expect_columns_equal(expected, *result);
+}
+
+TYPED_TEST(ReplaceNullsTest, ReplacePolicy)
+{
+  using T = TypeParam;
+
+  std::vector<T> input_column = cudf::test::make_type_param_vector<T>({0, 1, 2, 3, 4, 5, 6, 7});
+  std::vector<cudf::valid_type> input_valid{0, 1, 0, 0, 1, 0, 1, 0};
+  cudf::test::fixed_width_column_wrapper<T> input(
+    input_column.begin(), input_column.end(), input_valid.begin());
+
+  std::vector<T> preceding_column = cudf::test::make_type_param_vector<T>({0, 1, 1, 1, 4, 4, 6, 6});
+  std::vector<cudf::valid_type> preceding_valid{0, 1, 1, 1, 1, 1, 1, 1};
+  cudf::test::fixed_width_column_wrapper<T> expected_preceding(
+    preceding_column.begin(), preceding_column.end(), preceding_valid.begin());
+  expect_columns_equal(expected_preceding,
+                       *cudf::replace_nulls(input, cudf::replace_policy::PRECEDING));
+
+  std::vector<T> following_column = cudf::test::make_type_param_vector<T>({1, 1, 4, 4, 4, 6, 6, 0});
+  std::vector<cudf::valid_type> following_valid{1, 1, 1, 1, 1, 1, 1, 0};
+  cudf::test::fixed_width_column_wrapper<T> expected_following(
+    following_column.begin(), following_column.end(), following_valid.begin());
+  expect_columns_equal(expected_following,
+                       *cudf::replace_nulls(input, cudf::replace_policy::FOLLOWING));
+}
+
+TYPED_TEST(ReplaceNullsTest, ReplacePolicySlicedInput)
+{
+  using T = TypeParam;
+
+  std::vector<T> input_column(100);
+  std::vector<cudf::valid_type> input_valid(100);
+  for (size_t i = 0; i < input_column.size(); i++) {
+    input_column[i] = static_cast<T>(i % 7);
+    input_valid[i]  = i % 5 == 0;
+  }
+  cudf::test::fixed_width_column_wrapper<T> input(
+    input_column.begin(), input_column.end(), input_valid.begin());
+
+  // Row 7 and the rows after it in the slice are filled from row 10, 15, ... and never from
+  // row 5, which is outside of the slice
+  std::vector<T> result_column;
+  std::vector<cudf::valid_type> result_valid;
+  for (size_t i = 7; i < 93; i++) {
+    auto const source = i - i % 5;
+    result_column.push_back(source >= 7 ? input_column[source] : T{0});
+    result_valid.push_back(source >= 7);
+  }
+  cudf::test::fixed_width_column_wrapper<T> expected(
+    result_column.begin(), result_column.end(), result_valid.begin());
+
+  auto const result =
+    cudf::replace_nulls(cudf::slice(input, {7, 93})[0], cudf::replace_policy::PRECEDING);
+  expect_columns_equal(expected, *result);
+}
+
+TEST_F(ReplaceNullsStringsTest, ReplacePolicy)
+{
+  cudf::test::strings_column_wrapper input({"", "b", "", "", "e", ""}, {0, 1, 0, 0, 1, 0});
+
+  cudf::test::strings_column_wrapper expected_preceding({"", "b", "b", "b", "e", "e"},
+                                                        {0, 1, 1, 1, 1, 1});
+  cudf::test::expect_columns_equal(*cudf::replace_nulls(input, cudf::replace_policy::PRECEDING),
+                                   expected_preceding);
+
+  cudf::test::strings_column_wrapper expected_following({"b", "b", "e", "e", "e", ""},
+                                                        {1, 1, 1, 1, 1, 0});
+  cudf::test::expect_columns_equal(*cudf::replace_nulls(input, cudf::replace_policy::FOLLOWING),
+                                   expected_following);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -281,6 +281,33 @@ TEST_F(ReplaceStringsTest, StringsLargeScale)
   cudf::test::expect_columns_equal(*result, expected_wrapper);
 }
 
+// Strings test with enough values to replace for them to be binary searched
+TEST_F(ReplaceStringsTest, StringsManyValues)
+{
+  std::vector<std::string> values_to_replace;
+  std::vector<std::string> replacement;
+  for (int i = 99; i >= 0; i--) {
+    values_to_replace.push_back("key" + std::to_string(i));
+    replacement.push_back("value" + std::to_string(i));
+  }
+  // the first of duplicate values wins
+  values_to_replace.push_back("key5");
+  replacement.push_back("duplicate");
+
+  std::vector<std::string> input{"key5", "key", "key42", "", "key99", "key0", "key100"};
+  std::vector<std::string> expected{"value5", "key", "value42", "", "value99", "value0", "key100"};
+
+  cudf::test::strings_column_wrapper input_wrapper{input.begin(), input.end()};
+  cudf::test::strings_column_wrapper values_to_replace_wrapper{values_to_replace.begin(),
+                                                               values_to_replace.end()};
+  cudf::test::strings_column_wrapper replacement_wrapper{replacement.begin(), replacement.end()};
+  cudf::test::strings_column_wrapper expected_wrapper{expected.begin(), expected.end()};
+
+  auto result = cudf::find_and_replace_all(
+    input_wrapper, values_to_replace_wrapper, replacement_wrapper, mr());
+  cudf::test::expect_columns_equal(*result, expected_wrapper);
+}
+
 //// This is the main test feature
 template <class T>
 struct ReplaceTest : cudf::test::BaseFixture {
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+
+using namespace cudf::test;
+
+struct ExplodeTest : public BaseFixture {
+};
+
+using LCW = lists_column_wrapper<int32_t>;
+
+TEST_F(ExplodeTest, Basic)
+{
+  fixed_width_column_wrapper<int32_t> a{5, 10, 15};
+  LCW b{{1, 2}, {LCW{}}, {3, 4, 5}};
+  strings_column_wrapper c{"x", "y", "z"};
+
+  cudf::table_view input{{a, b, c}};
+
+  fixed_width_column_wrapper<int32_t> expected_a{5, 5, 15, 15, 15};
+  fixed_width_column_wrapper<int32_t> expected_b{1, 2, 3, 4, 5};
+  strings_column_wrapper expected_c{"x", "x", "z", "z", "z"};
+  cudf::table_view expected{{expected_a, expected_b, expected_c}};
+
+  auto result = cudf::explode(input, 1);
+  expect_tables_equal(expected, result->view());
+}
+
+TEST_F(ExplodeTest, Position)
+{
+  fixed_width_column_wrapper<int32_t> a{5, 10, 15};
+  LCW b{{1, 2}, {LCW{}}, {3, 4, 5}};
+
+  cudf::table_view input{{b, a}};
+
+  fixed_width_column_wrapper<int32_t> expected_position{0, 1, 0, 1, 2};
+  fixed_width_column_wrapper<int32_t> expected_b{1, 2, 3, 4, 5};
+  fixed_width_column_wrapper<int32_t> expected_a{5, 5, 15, 15, 15};
+  cudf::table_view expected{{expected_position, expected_b, expected_a}};
+
+  auto result = cudf::explode_position(input, 0);
+  expect_tables_equal(expected, result->view());
+}
+
+TEST_F(ExplodeTest, Nulls)
+{
+  auto list_validity    = make_counting_transform_iterator(0, [](auto i) { return i != 1; });
+  auto element_validity = make_counting_transform_iterator(0, [](auto i) { return i != 1; });
+  fixed_width_column_wrapper<int32_t> a({5, 10, 15, 20}, {1, 1, 1, 0});
+  LCW b{{{1, 2}, {7, 8}, {{3, 4, 5}, element_validity}, {6}}, list_validity};
+
+  cudf::table_view input{{a, b}};
+
+  // Null lists produce no rows; null elements and null values of the other columns are kept
+  fixed_width_column_wrapper<int32_t> expected_a({5, 5, 15, 15, 15, 20}, {1, 1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<int32_t> expected_b({1, 2, 3, 4, 5, 6}, {1, 1, 1, 0, 1, 1});
+  cudf::table_view expected{{expected_a, expected_b}};
+
+  auto result = cudf::explode(input, 1);
+  expect_tables_equal(expected, result->view());
+}
+
+TEST_F(ExplodeTest, InvalidColumn)
+{
+  fixed_width_column_wrapper<int32_t> a{5, 10, 15};
+  cudf::table_view input{{a}};
+
+  EXPECT_THROW(cudf::explode(input, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::explode(input, 1), cudf::logic_error);
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reshape.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <numeric>
+
+using namespace cudf::test;
+
+struct RowConversionTest : public BaseFixture {
+};
+
+template <typename T>
+struct RowConversionTypedTest : public BaseFixture {
+};
+
+TYPED_TEST_CASE(RowConversionTypedTest, FixedWidthTypes);
+
+TEST_F(RowConversionTest, Layout)
+{
+  fixed_width_column_wrapper<int8_t> a({1, 2});
+  fixed_width_column_wrapper<int32_t> b({3, 0}, {1, 0});
+  fixed_width_column_wrapper<int16_t> c({4, 5});
+  cudf::table_view input({a, b, c});
+
+  auto rows = cudf::convert_to_rows(input);
+  cudf::lists_column_view rows_view(*rows);
+  ASSERT_EQ(rows_view.size(), 2);
+  expect_columns_equal(rows_view.offsets(), fixed_width_column_wrapper<int32_t>({0, 16, 32}));
+
+  auto const bytes = to_host<int8_t>(rows_view.child()).first;
+  ASSERT_EQ(bytes.size(), 32u);
+  EXPECT_EQ(bytes[0], 1);
+  EXPECT_EQ(bytes[4], 3);
+  EXPECT_EQ(bytes[8], 4);
+  EXPECT_EQ(bytes[10], 0b111);
+  EXPECT_EQ(bytes[16], 2);
+  EXPECT_EQ(bytes[24], 5);
+  EXPECT_EQ(bytes[26], 0b101);
+  // Padding is zero
+  for (auto i : {1, 2, 3, 9, 11, 12, 13, 14, 15}) { EXPECT_EQ(bytes[i], 0); }
+}
+
+TYPED_TEST(RowConversionTypedTest, RoundTrip)
+{
+  using T = TypeParam;
+
+  auto const num_rows = 1000;
+  auto valids         = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                [](auto i) { return i % 3 != 0; });
+  std::vector<int32_t> values(num_rows);
+  std::iota(values.begin(), values.end(), 0);
+  fixed_width_column_wrapper<T> a(values.begin(), values.end(), valids);
+  fixed_width_column_wrapper<int8_t> b(values.begin(), values.end());
+  fixed_width_column_wrapper<T> c(values.begin(), values.end());
+  cudf::table_view input({a, b, c});
+
+  std::vector<cudf::data_type> const schema{
+    input.column(0).type(), input.column(1).type(), input.column(2).type()};
+  auto rows   = cudf::convert_to_rows(input);
+  auto result = cudf::convert_from_rows(cudf::lists_column_view(*rows), schema);
+  expect_tables_equal(input, *result);
+}
+
+TEST_F(RowConversionTest, SlicedInput)
+{
+  fixed_width_column_wrapper<int64_t> a({1, 2, 3, 4, 5, 6}, {1, 0, 1, 1, 0, 1});
+  fixed_width_column_wrapper<double> b({1.5, 2.5, 3.5, 4.5, 5.5, 6.5});
+  cudf::table_view input({a, b});
+  auto const sliced = cudf::slice(input, {1, 5})[0];
+
+  auto rows = cudf::convert_to_rows(sliced);
+  std::vector<cudf::data_type> const schema{cudf::data_type{cudf::type_id::INT64},
+                                            cudf::data_type{cudf::type_id::FLOAT64}};
+  expect_tables_equal(sliced, *cudf::convert_from_rows(cudf::lists_column_view(*rows), schema));
+
+  // Sliced rows
+  auto const sliced_rows = cudf::slice(rows->view(), {1, 3})[0];
+  auto result            = cudf::convert_from_rows(cudf::lists_column_view(sliced_rows), schema);
+  expect_tables_equal(cudf::slice(sliced, {1, 3})[0], *result);
+}
+
+TEST_F(RowConversionTest, WideRows)
+{
+  // Rows too large to be staged in shared memory
+  auto const num_rows = 300;
+  std::vector<int32_t> values(num_rows);
+  std::iota(values.begin(), values.end(), 0);
+  auto valids = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                [](auto i) { return i % 7 != 0; });
+  std::vector<fixed_width_column_wrapper<int64_t>> wrappers;
+  std::vector<cudf::column_view> columns;
+  std::vector<cudf::data_type> schema;
+  for (int i = 0; i < 300; ++i) {
+    wrappers.emplace_back(values.begin(), values.end(), valids);
+    schema.push_back(cudf::data_type{cudf::type_id::INT64});
+  }
+  for (auto const& wrapper : wrappers) { columns.push_back(wrapper); }
+  cudf::table_view input(columns);
+
+  auto rows = cudf::convert_to_rows(input);
+  expect_tables_equal(input, *cudf::convert_from_rows(cudf::lists_column_view(*rows), schema));
+}
+
+TEST_F(RowConversionTest, Empty)
+{
+  fixed_width_column_wrapper<int32_t> a({});
+  cudf::table_view input({a});
+
+  auto rows = cudf::convert_to_rows(input);
+  EXPECT_EQ(rows->size(), 0);
+  auto result = cudf::convert_from_rows(cudf::lists_column_view(*rows),
+                                        {cudf::data_type{cudf::type_id::INT32}});
+  expect_tables_equal(input, *result);
+}
+
+TEST_F(RowConversionTest, Errors)
+{
+  strings_column_wrapper strings({"a", "b"});
+  EXPECT_THROW(cudf::convert_to_rows(cudf::table_view({strings})), cudf::logic_error);
+
+  fixed_width_column_wrapper<int32_t> a({1, 2});
+  auto rows = cudf::convert_to_rows(cudf::table_view({a}));
+  std::vector<cudf::data_type> const schema(3, cudf::data_type{cudf::type_id::INT64});
+  EXPECT_THROW(cudf::convert_from_rows(cudf::lists_column_view(*rows), schema),
+               cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
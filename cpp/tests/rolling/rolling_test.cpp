@@ -22,12 +22,16 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/rolling.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <src/rolling/rolling_detail.hpp>
 
 #include <thrust/iterator/constant_iterator.h>
 
+#include <cmath>
+#include <limits>
 #include <vector>
 
 using cudf::bitmask_type;
@@ -712,6 +716,66 @@ TYPED_TEST(RollingTest, RandomDynamicWithInvalid)
   this->run_test_col_agg(input, preceding_window, following_window, max_window_size);
 }
 
+// ------------- large windows --------------------
+
+// Windows of a few hundred rows are aggregated with the sliding-window algorithms. The values are
+// small integers, so that the floating-point sums are exact whichever way they are accumulated.
+template <typename T>
+class RollingLargeWindowTest : public RollingTest<T> {
+ protected:
+  void run_large_window_test(bool with_nulls)
+  {
+    size_type num_rows = 20000;
+
+    std::vector<T> col_data(num_rows);
+    std::vector<bool> col_valid(num_rows);
+    for (size_type i = 0; i < num_rows; ++i) {
+      col_data[i]  = static_cast<T>((i * 7919) % 1000);
+      col_valid[i] = not with_nulls or (i % 5 != 0);
+    }
+    fixed_width_column_wrapper<T> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+    this->run_test_col_agg(input, {300}, {200}, 100);
+
+    // dynamic windows, spanning zero to many blocks of the MIN/MAX sparse table
+    std::vector<size_type> preceding_window(num_rows);
+    std::vector<size_type> following_window(num_rows);
+    for (size_type i = 0; i < num_rows; ++i) {
+      preceding_window[i] = (i * 31) % 500;
+      following_window[i] = (i % 3 == 0) ? 0 : (i * 17) % 300;
+    }
+    this->run_test_col_agg(input, preceding_window, following_window, 1);
+  }
+};
+
+using LargeWindowTypes = cudf::test::Types<int64_t, double>;
+
+TYPED_TEST_CASE(RollingLargeWindowTest, LargeWindowTypes);
+
+TYPED_TEST(RollingLargeWindowTest, AllValid) { this->run_large_window_test(false); }
+
+TYPED_TEST(RollingLargeWindowTest, WithInvalid) { this->run_large_window_test(true); }
+
+// A large value, an infinity or a NaN only changes the sums of the windows that contain it
+class RollingLargeWindowNonFiniteTest : public RollingTest<double> {
+};
+
+TEST_F(RollingLargeWindowNonFiniteTest, SumAndMean)
+{
+  size_type num_rows = 5000;
+
+  std::vector<double> col_data(num_rows);
+  for (size_type i = 0; i < num_rows; ++i) { col_data[i] = i % 10; }
+  col_data[1000] = 1e300;
+  col_data[1500] = -1e300;
+  col_data[2000] = std::numeric_limits<double>::infinity();
+  col_data[3000] = std::numeric_limits<double>::quiet_NaN();
+  fixed_width_column_wrapper<double> input(col_data.begin(), col_data.end());
+
+  run_test_col(input, {300}, {0}, 1, cudf::make_sum_aggregation());
+  run_test_col(input, {300}, {0}, 1, cudf::make_mean_aggregation());
+}
+
 // ------------- non-fixed-width types --------------------
 
 using RollingTestStrings = RollingTest<cudf::string_view>;
@@ -922,4 +986,137 @@ TEST_F(RollingTestUdf, DynamicWindow)
   cudf::test::expect_columns_equal(*output, expected);
 }
 
+TEST_F(RollingTestUdf, MultiColumnWindow)
+{
+  size_type size = 1000;
+
+  const std::string cuda_pair_func{
+    R"***(
+      template <typename OutType, typename InType0, typename InType1>
+      __device__ void CUDA_GENERIC_AGGREGATOR(OutType *ret, InType0 *in_col0, InType1 *in_col1,
+                                              cudf::size_type start, cudf::size_type count) {
+        OutType val = 0;
+        for (cudf::size_type i = 0; i < count; i++) {
+          val += in_col0[start + i] + in_col1[start + i];
+        }
+        *ret = val;
+      }
+    )***"};
+
+  fixed_width_column_wrapper<int32_t> input0(thrust::make_counting_iterator(0),
+                                             thrust::make_counting_iterator(size));
+  auto twice = cudf::test::make_counting_transform_iterator(0, [](auto i) { return 2 * i; });
+  fixed_width_column_wrapper<int64_t> input1(twice, twice + size);
+
+  // The windows of 100 rows of a block span more rows than the block
+  std::vector<int64_t> expected_sums(size);
+  for (size_type row = 0; row < size; ++row) {
+    for (size_type i = std::max(0, row - 99); i <= row; ++i) { expected_sums[row] += 3 * i; }
+  }
+  fixed_width_column_wrapper<int64_t> expected(expected_sums.begin(), expected_sums.end());
+
+  auto cuda_udf_agg = cudf::make_udf_aggregation(
+    cudf::udf_type::CUDA, cuda_pair_func, cudf::data_type{cudf::type_id::INT64});
+
+  cudf::table_view const inputs{{input0, input1}};
+  auto output = cudf::rolling_window(inputs, 100, 0, 1, cuda_udf_agg);
+  cudf::test::expect_columns_equivalent(*output, expected);
+
+  fixed_width_column_wrapper<int32_t> preceding(thrust::make_constant_iterator(100),
+                                                thrust::make_constant_iterator(100) + size);
+  fixed_width_column_wrapper<int32_t> following(thrust::make_constant_iterator(0),
+                                                thrust::make_constant_iterator(0) + size);
+  output = cudf::rolling_window(inputs, preceding, following, 1, cuda_udf_agg);
+  cudf::test::expect_columns_equivalent(*output, expected);
+
+  // Only UDFs of 1 to 4 columns without nulls are supported
+  EXPECT_THROW(cudf::rolling_window(cudf::table_view{{input0, input0, input0, input0, input0}},
+                                    100,
+                                    0,
+                                    1,
+                                    cuda_udf_agg),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::rolling_window(inputs, 100, 0, 1, cudf::make_sum_aggregation()),
+               cudf::logic_error);
+  fixed_width_column_wrapper<int32_t> nullable({1, 2}, {1, 0});
+  cudf::table_view const nullable_inputs{{nullable, nullable}};
+  EXPECT_THROW(cudf::rolling_window(nullable_inputs, 1, 0, 1, cuda_udf_agg), cudf::logic_error);
+}
+
+// ------------- window functions --------------------
+
+class RollingWindowFunctionTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(RollingWindowFunctionTest, VarianceStd)
+{
+  fixed_width_column_wrapper<int32_t> input({1, 0, 3, 4, 5}, {1, 0, 1, 1, 1});
+
+  // the window of row i is [i - 1, i + 1]
+  auto var = cudf::rolling_window(input, 2, 1, 1, cudf::make_variance_aggregation());
+  fixed_width_column_wrapper<double> expected_var({0, 2, 0.5, 1, 0.5}, {0, 1, 1, 1, 1});
+  cudf::test::expect_columns_equivalent(expected_var, *var);
+
+  auto stddev = cudf::rolling_window(input, 2, 1, 1, cudf::make_std_aggregation(0));
+  fixed_width_column_wrapper<double> expected_std({0, 1, 0.5, std::sqrt(2.0 / 3), 0.5});
+  cudf::test::expect_columns_equivalent(expected_std, *stddev);
+}
+
+TEST_F(RollingWindowFunctionTest, ArgMinArgMax)
+{
+  fixed_width_column_wrapper<double> input({5, 1, 3, 1, 4});
+
+  auto argmin = cudf::rolling_window(input, 2, 1, 1, cudf::make_argmin_aggregation());
+  fixed_width_column_wrapper<size_type> expected_argmin({1, 1, 1, 3, 3});
+  cudf::test::expect_columns_equal(expected_argmin, *argmin);
+
+  auto argmax = cudf::rolling_window(input, 2, 1, 1, cudf::make_argmax_aggregation());
+  fixed_width_column_wrapper<size_type> expected_argmax({0, 0, 2, 4, 4});
+  cudf::test::expect_columns_equal(expected_argmax, *argmax);
+}
+
+TEST_F(RollingWindowFunctionTest, LeadLag)
+{
+  fixed_width_column_wrapper<int32_t> input({10, 20, 0, 40, 50}, {1, 1, 0, 1, 1});
+
+  auto lead = cudf::rolling_window(input, 2, 1, 1, cudf::make_lead_aggregation(1));
+  fixed_width_column_wrapper<int32_t> expected_lead({20, 0, 40, 50, 0}, {1, 0, 1, 1, 0});
+  cudf::test::expect_columns_equal(expected_lead, *lead);
+
+  auto lag = cudf::rolling_window(input, 2, 1, 1, cudf::make_lag_aggregation(1));
+  fixed_width_column_wrapper<int32_t> expected_lag({0, 10, 20, 0, 40}, {0, 1, 1, 0, 1});
+  cudf::test::expect_columns_equal(expected_lag, *lag);
+
+  // the row two rows before is outside of the window
+  auto lag2 = cudf::rolling_window(input, 2, 1, 1, cudf::make_lag_aggregation(2));
+  fixed_width_column_wrapper<int32_t> expected_lag2({0, 0, 0, 0, 0}, {0, 0, 0, 0, 0});
+  cudf::test::expect_columns_equal(expected_lag2, *lag2);
+}
+
+TEST_F(RollingWindowFunctionTest, GroupedLead)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 1, 1, 2, 2});
+  fixed_width_column_wrapper<int32_t> input({10, 20, 30, 40, 50});
+
+  auto lead = cudf::grouped_rolling_window(
+    cudf::table_view{{keys}}, input, 2, 1, 1, cudf::make_lead_aggregation(1));
+  fixed_width_column_wrapper<int32_t> expected({20, 30, 0, 50, 0}, {1, 1, 0, 1, 0});
+  cudf::test::expect_columns_equal(expected, *lead);
+}
+
+TEST_F(RollingWindowFunctionTest, Collect)
+{
+  fixed_width_column_wrapper<int32_t> input({10, 20, 30, 40});
+
+  // the window of row i is [i - 1, i]
+  auto result = cudf::rolling_window(input, 2, 0, 2, cudf::make_collect_aggregation());
+  EXPECT_EQ(result->null_count(), 1);
+
+  cudf::lists_column_view lists(*result);
+  fixed_width_column_wrapper<size_type> expected_offsets({0, 0, 2, 4, 6});
+  fixed_width_column_wrapper<int32_t> expected_child({10, 20, 20, 30, 30, 40});
+  cudf::test::expect_columns_equal(expected_offsets, lists.offsets());
+  cudf::test::expect_columns_equal(expected_child, lists.child());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
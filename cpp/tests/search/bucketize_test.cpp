@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <cudf/search.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <cmath>
+#include <vector>
+
+using cudf::closed_side;
+using cudf::size_type;
+using cudf::test::expect_columns_equal;
+using cudf::test::fixed_width_column_wrapper;
+
+template <typename T>
+struct BucketizeTypedTest : public cudf::test::BaseFixture {
+};
+
+using BinTypes = cudf::test::Types<int8_t, int32_t, int64_t, uint16_t, float, double>;
+TYPED_TEST_CASE(BucketizeTypedTest, BinTypes);
+
+TYPED_TEST(BucketizeTypedTest, ClosedSides)
+{
+  fixed_width_column_wrapper<TypeParam> input({1, 10, 15, 20, 25, 0, 3}, {1, 1, 1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<TypeParam> edges{0, 10, 20};
+
+  auto left = cudf::bucketize(input, edges, closed_side::LEFT);
+  expect_columns_equal(fixed_width_column_wrapper<size_type>({0, 1, 1, 0, 0, 0, 0},
+                                                             {1, 1, 1, 0, 0, 1, 0}),
+                       *left);
+
+  auto right = cudf::bucketize(input, edges, closed_side::RIGHT);
+  expect_columns_equal(fixed_width_column_wrapper<size_type>({0, 0, 1, 1, 0, 0, 0},
+                                                             {1, 1, 1, 1, 0, 0, 0}),
+                       *right);
+
+  expect_columns_equal(fixed_width_column_wrapper<int64_t>{2, 2},
+                       *cudf::histogram(input, edges, closed_side::LEFT));
+  expect_columns_equal(fixed_width_column_wrapper<int64_t>{2, 2},
+                       *cudf::histogram(input, edges, closed_side::RIGHT));
+}
+
+struct BucketizeTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(BucketizeTest, NaN)
+{
+  fixed_width_column_wrapper<double> input{0.5, std::nan(""), 1.5};
+  fixed_width_column_wrapper<double> edges{0, 1, 2};
+
+  auto bins = cudf::bucketize(input, edges, closed_side::LEFT);
+  expect_columns_equal(fixed_width_column_wrapper<size_type>({0, 0, 1}, {1, 0, 1}), *bins);
+  expect_columns_equal(fixed_width_column_wrapper<int64_t>{1, 1},
+                       *cudf::histogram(input, edges));
+}
+
+TEST_F(BucketizeTest, Timestamps)
+{
+  fixed_width_column_wrapper<cudf::timestamp_s> input{5, 65, 3600, 7199};
+  fixed_width_column_wrapper<cudf::timestamp_s> edges{0, 60, 3600, 7200};
+
+  auto bins = cudf::bucketize(input, edges, closed_side::LEFT);
+  cudf::test::expect_columns_equivalent(fixed_width_column_wrapper<size_type>{0, 1, 2, 2}, *bins);
+  expect_columns_equal(fixed_width_column_wrapper<int64_t>{1, 1, 2},
+                       *cudf::histogram(input, edges));
+}
+
+TEST_F(BucketizeTest, ManyEdges)
+{
+  // Edges and counters of 10000 bins do not fit in shared memory and are read from global memory
+  for (size_type const num_edges : {101, 10001}) {
+    std::vector<double> edge_values(num_edges);
+    for (size_type j = 0; j < num_edges; ++j) { edge_values[j] = 2.0 * j; }
+    fixed_width_column_wrapper<double> edges(edge_values.begin(), edge_values.end());
+
+    size_type const size = 100000;
+    std::vector<double> values(size);
+    std::vector<size_type> expected_bins(size);
+    std::vector<int64_t> expected_counts(num_edges - 1);
+    for (size_type i = 0; i < size; ++i) {
+      values[i]        = (i * 7919) % (2 * (num_edges - 1));
+      expected_bins[i] = static_cast<size_type>(values[i]) / 2;
+      ++expected_counts[expected_bins[i]];
+    }
+    fixed_width_column_wrapper<double> input(values.begin(), values.end());
+
+    auto bins = cudf::bucketize(input, edges, closed_side::LEFT);
+    cudf::test::expect_columns_equivalent(
+      fixed_width_column_wrapper<size_type>(expected_bins.begin(), expected_bins.end()), *bins);
+    expect_columns_equal(
+      fixed_width_column_wrapper<int64_t>(expected_counts.begin(), expected_counts.end()),
+      *cudf::histogram(input, edges));
+  }
+}
+
+TEST_F(BucketizeTest, Empty)
+{
+  fixed_width_column_wrapper<int32_t> input{};
+  fixed_width_column_wrapper<int32_t> edges{0, 10, 20};
+
+  EXPECT_EQ(cudf::bucketize(input, edges, closed_side::LEFT)->size(), 0);
+  expect_columns_equal(fixed_width_column_wrapper<int64_t>{0, 0}, *cudf::histogram(input, edges));
+}
+
+TEST_F(BucketizeTest, InvalidEdges)
+{
+  fixed_width_column_wrapper<int32_t> input{1, 2, 3};
+  fixed_width_column_wrapper<int64_t> other_type_edges{0, 10};
+  fixed_width_column_wrapper<int32_t> single_edge{0};
+  fixed_width_column_wrapper<int32_t> null_edges({0, 10}, {1, 0});
+
+  EXPECT_THROW(cudf::bucketize(input, other_type_edges, closed_side::LEFT), cudf::logic_error);
+  EXPECT_THROW(cudf::bucketize(input, single_edge, closed_side::LEFT), cudf::logic_error);
+  EXPECT_THROW(cudf::histogram(input, null_edges), cudf::logic_error);
+
+  cudf::test::strings_column_wrapper strings{"a", "b"};
+  EXPECT_THROW(cudf::histogram(strings, strings), cudf::logic_error);
+}
@@ -1815,4 +1815,62 @@ TEST_F(SearchTest, multi_contains_empty_input_set_string)
   expect_columns_equal(*result, expect);
 }
 
+TEST_F(SearchTest, search_index_matches_bounds)
+{
+  using element_type = int32_t;
+
+  // Sizes around complete trees exercise the padding of the Eytzinger layout
+  for (size_type num_rows : {1, 2, 7, 8, 100}) {
+    auto keys_it = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i / 3; });
+    auto vals_it = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i - 2; });
+    fixed_width_column_wrapper<element_type> column(keys_it, keys_it + num_rows);
+    fixed_width_column_wrapper<element_type> values(vals_it, vals_it + num_rows / 3 + 5);
+    cudf::table_view t{{column}};
+    cudf::table_view v{{values}};
+
+    cudf::search_index index(t, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+    expect_columns_equal(
+      *index.lower_bound(v),
+      *cudf::lower_bound(t, v, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE}));
+    expect_columns_equal(
+      *index.upper_bound(v),
+      *cudf::upper_bound(t, v, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE}));
+  }
+}
+
+TEST_F(SearchTest, search_index_descending)
+{
+  fixed_width_column_wrapper<int64_t> column{90, 50, 50, 40, 20, 20, 20, 10, 0};
+  fixed_width_column_wrapper<int64_t> values{100, 90, 50, 45, 20, 10, 0, -1};
+  fixed_width_column_wrapper<size_type> expect_lower{0, 0, 1, 3, 4, 7, 8, 9};
+  fixed_width_column_wrapper<size_type> expect_upper{0, 1, 3, 3, 7, 8, 9, 9};
+
+  cudf::search_index index(
+    cudf::table_view{{column}}, {cudf::order::DESCENDING}, {cudf::null_order::BEFORE});
+  expect_columns_equal(*index.lower_bound(cudf::table_view{{values}}), expect_lower);
+  expect_columns_equal(*index.upper_bound(cudf::table_view{{values}}), expect_upper);
+}
+
+TEST_F(SearchTest, search_index_generic_keys)
+{
+  fixed_width_column_wrapper<int32_t> column_0{{10, 20, 20, 20, 20}, {0, 1, 1, 1, 1}};
+  cudf::test::strings_column_wrapper column_1{"a", "a", "b", "b", "c"};
+  fixed_width_column_wrapper<int32_t> values_0{{20, 20, 5}, {1, 1, 0}};
+  cudf::test::strings_column_wrapper values_1{"b", "d", "a"};
+  cudf::table_view t{{column_0, column_1}};
+  cudf::table_view v{{values_0, values_1}};
+  std::vector<cudf::order> column_order{cudf::order::ASCENDING, cudf::order::ASCENDING};
+  std::vector<cudf::null_order> null_precedence{cudf::null_order::BEFORE,
+                                                cudf::null_order::BEFORE};
+
+  cudf::search_index index(t, column_order, null_precedence);
+  // Searching the index repeatedly reuses its device state
+  for (int i = 0; i < 2; ++i) {
+    expect_columns_equal(*index.lower_bound(v),
+                         *cudf::lower_bound(t, v, column_order, null_precedence));
+    expect_columns_equal(*index.upper_bound(v),
+                         *cudf::upper_bound(t, v, column_order, null_precedence));
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
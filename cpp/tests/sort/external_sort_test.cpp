@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/concatenate.hpp>
+#include <cudf/external_sort.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace test {
+struct ExternalSortTest : public BaseFixture {
+};
+
+std::unique_ptr<table> sort_runs(external_sort_options const& options,
+                                 std::vector<table_view> const& runs)
+{
+  external_sorter sorter(options);
+  for (auto const& run : runs) { sorter.append(run); }
+  std::vector<std::unique_ptr<table>> chunks;
+  while (sorter.has_next()) {
+    chunks.push_back(sorter.next());
+    EXPECT_LE(chunks.back()->num_rows(), options.output_chunk_rows);
+  }
+  std::vector<table_view> views;
+  for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+  return concatenate(views);
+}
+
+void run_external_sort_test(external_sort_options const& options)
+{
+  // Keys are distinct so that the sorted order is unique
+  fixed_width_column_wrapper<int32_t> keys0{{9, 1, 14, 6, 3, 11}, {1, 1, 1, 1, 0, 1}};
+  strings_column_wrapper values0{"a", "b", "c", "d", "e", "f"};
+  fixed_width_column_wrapper<int32_t> keys1{{4, 12, 0, 7}};
+  strings_column_wrapper values1{{"g", "h", "i", "j"}, {1, 0, 1, 1}};
+  fixed_width_column_wrapper<int32_t> keys2{{13, 2, 8, 5, 10}};
+  strings_column_wrapper values2{"k", "l", "m", "n", "o"};
+  table_view run0{{keys0, values0}};
+  table_view run1{{keys1, values1}};
+  table_view run2{{keys2, values2}};
+
+  auto const got      = sort_runs(options, {run0, run1, run2});
+  auto const all_rows = concatenate({run0, run1, run2});
+  auto const expected = sort_by_key(
+    all_rows->view(), all_rows->view().select({0}), options.column_order, options.null_precedence);
+
+  expect_tables_equal(expected->view(), got->view());
+}
+
+external_sort_options small_blocks()
+{
+  external_sort_options options;
+  options.key_columns       = {0};
+  options.spill_block_rows  = 2;
+  options.output_chunk_rows = 3;
+  return options;
+}
+
+TEST_F(ExternalSortTest, HostSpill) { run_external_sort_test(small_blocks()); }
+
+TEST_F(ExternalSortTest, DiskSpill)
+{
+  auto options     = small_blocks();
+  options.location = spill_location::DISK;
+  run_external_sort_test(options);
+}
+
+TEST_F(ExternalSortTest, SnappyCompression)
+{
+  auto options        = small_blocks();
+  options.compression = io::compression_type::SNAPPY;
+  run_external_sort_test(options);
+  options.location = spill_location::DISK;
+  run_external_sort_test(options);
+}
+
+TEST_F(ExternalSortTest, DescendingNullsAfter)
+{
+  auto options            = small_blocks();
+  options.column_order    = {order::DESCENDING};
+  options.null_precedence = {null_order::AFTER};
+  run_external_sort_test(options);
+}
+
+TEST_F(ExternalSortTest, SingleBlock)
+{
+  external_sort_options options;
+  options.key_columns = {0};
+  run_external_sort_test(options);
+}
+
+TEST_F(ExternalSortTest, NoRuns)
+{
+  external_sorter sorter(small_blocks());
+  EXPECT_FALSE(sorter.has_next());
+  EXPECT_THROW(sorter.next(), logic_error);
+}
+
+TEST_F(ExternalSortTest, MismatchedRuns)
+{
+  fixed_width_column_wrapper<int32_t> keys0{1, 2};
+  fixed_width_column_wrapper<int64_t> keys1{3, 4};
+  external_sorter sorter(small_blocks());
+  sorter.append(table_view{{keys0}});
+  EXPECT_THROW(sorter.append(table_view{{keys1}}), logic_error);
+}
+
+TEST_F(ExternalSortTest, AppendAfterNext)
+{
+  fixed_width_column_wrapper<int32_t> keys{2, 1};
+  external_sorter sorter(small_blocks());
+  sorter.append(table_view{{keys}});
+  sorter.next();
+  EXPECT_THROW(sorter.append(table_view{{keys}}), logic_error);
+}
+
+TEST_F(ExternalSortTest, InvalidOptions)
+{
+  auto options        = small_blocks();
+  options.compression = io::compression_type::GZIP;
+  EXPECT_THROW(external_sorter{options}, logic_error);
+  options                  = small_blocks();
+  options.spill_block_rows = 0;
+  EXPECT_THROW(external_sorter{options}, logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
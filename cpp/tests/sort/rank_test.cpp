@@ -410,5 +410,41 @@ TYPED_TEST(Rank, min_desc_bottom_pct)
   this->run_all_tests(rank_method::MIN, desc_bottom, col1_rank, col2_rank, col3_rank, true);
 }
 
+struct RankLargeTies : public BaseFixture {
+};
+
+TEST_F(RankLargeTies, TieGroupsSpanningBlocks)
+{
+  // Groups of 3000 equal values in descending order, so the ties cross scan tile boundaries
+  constexpr size_type num_rows   = 30000;
+  constexpr size_type group_size = 3000;
+  auto input_it                  = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (num_rows - 1 - i) / group_size; });
+  fixed_width_column_wrapper<int32_t> input(input_it, input_it + num_rows);
+
+  auto group_first = [](auto i) { return ((num_rows - 1 - i) / group_size) * group_size; };
+  auto min_it      = cudf::test::make_counting_transform_iterator(
+    0, [group_first](auto i) { return group_first(i) + 1; });
+  auto max_it = cudf::test::make_counting_transform_iterator(
+    0, [group_first](auto i) { return group_first(i) + group_size; });
+  auto average_it = cudf::test::make_counting_transform_iterator(
+    0, [group_first](auto i) { return group_first(i) + (group_size + 1) / 2.0; });
+  auto dense_it = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (num_rows - 1 - i) / group_size + 1; });
+
+  auto rank_of = [&](rank_method method) {
+    return cudf::rank(
+      input, method, order::ASCENDING, null_policy::EXCLUDE, null_order::AFTER, false);
+  };
+  expect_columns_equal(*rank_of(rank_method::MIN),
+                       fixed_width_column_wrapper<size_type>(min_it, min_it + num_rows));
+  expect_columns_equal(*rank_of(rank_method::MAX),
+                       fixed_width_column_wrapper<size_type>(max_it, max_it + num_rows));
+  expect_columns_equal(*rank_of(rank_method::AVERAGE),
+                       fixed_width_column_wrapper<double>(average_it, average_it + num_rows));
+  expect_columns_equal(*rank_of(rank_method::DENSE),
+                       fixed_width_column_wrapper<size_type>(dense_it, dense_it + num_rows));
+}
+
 }  // namespace test
 }  // namespace cudf
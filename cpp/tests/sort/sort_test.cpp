@@ -16,15 +16,18 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
+#include <limits>
 #include <vector>
 
 namespace cudf {
@@ -264,6 +267,142 @@ TYPED_TEST(Sort, ZeroSizedColumns)
   run_sort_test(input, expected, column_order);
 }
 
+// Single and multi-column fixed-width keys are ordered by radix sort passes
+struct SortFixedWidth : public BaseFixture {
+};
+
+TEST_F(SortFixedWidth, SignedWithNulls)
+{
+  fixed_width_column_wrapper<int32_t> col{{3, -1, 0, 7, -5, 3}, {1, 1, 0, 1, 1, 1}};
+  table_view input{{col}};
+
+  fixed_width_column_wrapper<int32_t> expect_asc{{2, 4, 1, 0, 5, 3}};
+  expect_columns_equal(expect_asc, stable_sorted_order(input)->view());
+  run_sort_test(input, expect_asc);
+
+  fixed_width_column_wrapper<int32_t> expect_nulls_last{{3, 0, 5, 1, 4, 2}};
+  expect_columns_equal(
+    expect_nulls_last,
+    stable_sorted_order(input, {order::DESCENDING}, {null_order::BEFORE})->view());
+
+  fixed_width_column_wrapper<int32_t> expect_nulls_first{{2, 3, 0, 5, 1, 4}};
+  expect_columns_equal(
+    expect_nulls_first,
+    stable_sorted_order(input, {order::DESCENDING}, {null_order::AFTER})->view());
+}
+
+TEST_F(SortFixedWidth, FloatsWithNaNAndSignedZero)
+{
+  auto const nan = std::numeric_limits<float>::quiet_NaN();
+  auto const inf = std::numeric_limits<float>::infinity();
+  fixed_width_column_wrapper<float> col{0.f, nan, -1.5f, -0.f, inf, -nan, -inf, 2.f};
+  table_view input{{col}};
+
+  // NaNs are equivalent and after +Inf; -0.0 and 0.0 are equivalent
+  fixed_width_column_wrapper<int32_t> expect_asc{{6, 2, 0, 3, 7, 4, 1, 5}};
+  expect_columns_equal(expect_asc, stable_sorted_order(input)->view());
+
+  fixed_width_column_wrapper<int32_t> expect_desc{{1, 5, 4, 7, 0, 3, 2, 6}};
+  expect_columns_equal(expect_desc, stable_sorted_order(input, {order::DESCENDING})->view());
+}
+
+TEST_F(SortFixedWidth, MultipleColumns)
+{
+  fixed_width_column_wrapper<int16_t> col1{{2, 1, 2, 1, 2}};
+  fixed_width_column_wrapper<double> col2{{0.5, 3., -1., 3., 0.}, {1, 1, 1, 1, 0}};
+  table_view input{{col1, col2}};
+
+  fixed_width_column_wrapper<int32_t> expected{{1, 3, 4, 0, 2}};
+  std::vector<order> column_order{order::ASCENDING, order::DESCENDING};
+  std::vector<null_order> null_precedence{null_order::BEFORE, null_order::AFTER};
+  expect_columns_equal(expected,
+                       stable_sorted_order(input, column_order, null_precedence)->view());
+  run_sort_test(input, expected, column_order, null_precedence);
+}
+
+TEST_F(SortFixedWidth, Timestamps)
+{
+  fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep> col{-100, 50, 0, -100};
+  table_view input{{col}};
+
+  fixed_width_column_wrapper<int32_t> expected{{0, 3, 2, 1}};
+  expect_columns_equal(expected, stable_sorted_order(input)->view());
+}
+
+TEST_F(SortFixedWidth, DictionaryIndices)
+{
+  strings_column_wrapper strings{{"d", "a", "", "c", "a"}, {1, 1, 0, 1, 1}};
+  auto const col = cudf::dictionary::encode(strings);
+  table_view input{{col->view()}};
+
+  fixed_width_column_wrapper<int32_t> expected{{2, 1, 4, 3, 0}};
+  expect_columns_equal(expected, stable_sorted_order(input)->view());
+  expect_columns_equal(*stable_sorted_order(table_view{{strings}}, {order::DESCENDING}),
+                       *stable_sorted_order(input, {order::DESCENDING}));
+}
+
+TEST_F(SortFixedWidth, FixedPoint)
+{
+  // Values of one column share their scale, so they sort like their stored integers
+  fixed_point_column_wrapper<int32_t> col{{250, -1, 0, 31, -400}, {1, 1, 0, 1, 1},
+                                          numeric::scale_type{-2}};
+  table_view input{{col}};
+
+  fixed_width_column_wrapper<int32_t> expected{{2, 4, 1, 3, 0}};
+  expect_columns_equal(expected, stable_sorted_order(input)->view());
+
+  fixed_point_column_wrapper<int32_t> expected_values{{0, -400, -1, 31, 250}, {0, 1, 1, 1, 1},
+                                                      numeric::scale_type{-2}};
+  expect_columns_equal(expected_values, sort(input)->get_column(0));
+}
+
+TEST_F(SortFixedWidth, WideKeys)
+{
+  // Too wide for radix sort passes, which falls back to comparison sort
+  fixed_width_column_wrapper<int64_t> col1{{1, 0, 1, 0}};
+  fixed_width_column_wrapper<int64_t> col2{{5, 5, 5, 5}};
+  fixed_width_column_wrapper<int64_t> col3{{-2, 3, -4, 1}};
+  table_view input{{col1, col2, col3}};
+
+  fixed_width_column_wrapper<int32_t> expected{{3, 1, 2, 0}};
+  expect_columns_equal(expected, sorted_order(input)->view());
+}
+
+// A single strings column is radix sorted by the 8-byte prefixes of its strings
+struct SortStrings : public BaseFixture {
+};
+
+TEST_F(SortStrings, SharedPrefixes)
+{
+  strings_column_wrapper col{
+    {"applesauce", "apple", "applesau", "", "applesauce", "b", "", "applesaucer"},
+    {1, 1, 1, 0, 1, 1, 1, 1}};
+  table_view input{{col}};
+
+  fixed_width_column_wrapper<int32_t> expect_asc{{3, 6, 1, 2, 0, 4, 7, 5}};
+  expect_columns_equal(expect_asc, stable_sorted_order(input)->view());
+  run_sort_test(input, expect_asc);
+
+  fixed_width_column_wrapper<int32_t> expect_desc{{5, 7, 0, 4, 2, 1, 6, 3}};
+  expect_columns_equal(
+    expect_desc, stable_sorted_order(input, {order::DESCENDING}, {null_order::BEFORE})->view());
+
+  fixed_width_column_wrapper<int32_t> expect_nulls_after{{6, 1, 2, 0, 4, 7, 5, 3}};
+  expect_columns_equal(
+    expect_nulls_after,
+    stable_sorted_order(input, {order::ASCENDING}, {null_order::AFTER})->view());
+}
+
+TEST_F(SortStrings, Sliced)
+{
+  strings_column_wrapper col{"zz", "multibyte \u00e9", "multibyte e", "a", "multibyte", "zz"};
+  auto const sliced = cudf::slice(col, {1, 5}).front();
+  table_view input{{sliced}};
+
+  fixed_width_column_wrapper<int32_t> expected{{2, 3, 1, 0}};
+  expect_columns_equal(expected, stable_sorted_order(input)->view());
+}
+
 struct SortByKey : public BaseFixture {
 };
 
@@ -282,6 +421,46 @@ TEST_F(SortByKey, ValueKeysSizeMismatch)
   EXPECT_THROW(sort_by_key(values, keys), logic_error);
 }
 
+struct SortOnStream : public BaseFixture {
+};
+
+TEST_F(SortOnStream, MatchesDefaultStream)
+{
+  // Mixed types and nulls take the comparator path, which copies the orders to the device
+  fixed_width_column_wrapper<int32_t> col1{{3, 1, 2, 1, 3}, {1, 1, 0, 1, 1}};
+  strings_column_wrapper col2({"b", "c", "a", "a", "a"});
+  table_view input{{col1, col2}};
+  std::vector<order> column_order{order::DESCENDING, order::ASCENDING};
+  std::vector<null_order> null_precedence{null_order::AFTER, null_order::AFTER};
+
+  cudaStream_t stream;
+  CUDA_TRY(cudaStreamCreate(&stream));
+  auto const expected = sorted_order(input, column_order, null_precedence);
+  auto const result =
+    sorted_order(input, column_order, null_precedence, rmm::mr::get_default_resource(), stream);
+  auto const sorted_result = is_sorted(input, column_order, null_precedence, stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  CUDA_TRY(cudaStreamDestroy(stream));
+
+  expect_columns_equal(*expected, *result);
+  EXPECT_FALSE(sorted_result);
+}
+
+TEST_F(SortFixedWidth, EstimateSortMemory)
+{
+  fixed_width_column_wrapper<int64_t> keys{{5, 3, 1, 4}};
+  strings_column_wrapper strings{"bb", "a", "", "dddd"};
+  table_view input{{keys, strings}};
+
+  // The output is the reordered values; the radix sort of the keys sorts copies of its keys
+  auto const estimate = estimate_sort_memory(input, table_view{{keys}});
+  EXPECT_EQ(estimate.output_bytes, 4 * sizeof(int64_t) + 5 * sizeof(size_type) + 7);
+  EXPECT_EQ(estimate.scratch_bytes,
+            4 * sizeof(size_type) + 4 * (sizeof(size_type) + 2 * sizeof(int64_t)));
+
+  EXPECT_THROW(estimate_sort_memory(input, split(input, {2}).front()), logic_error);
+}
+
 }  // namespace test
 }  // namespace cudf
 
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/type_lists.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+void run_top_k_test(table_view input,
+                    std::vector<order> const& column_order         = {},
+                    std::vector<null_order> const& null_precedence = {})
+{
+  auto const sorted = stable_sorted_order(input, column_order, null_precedence);
+  for (size_type k = 0; k <= input.num_rows() + 1; ++k) {
+    auto const expected = slice(sorted->view(), {0, std::min(k, input.num_rows())})[0];
+    expect_columns_equal(expected, top_k(input, k, column_order, null_precedence)->view());
+  }
+}
+
+template <typename T>
+struct TopK : public BaseFixture {
+};
+
+TYPED_TEST_CASE(TopK, NumericTypes);
+
+TYPED_TEST(TopK, WithNulls)
+{
+  fixed_width_column_wrapper<TypeParam, int32_t> col{{5, 3, 0, 7, 1, 3, 2, 9},
+                                                     {1, 1, 0, 1, 1, 1, 0, 1}};
+  table_view input{{col}};
+
+  run_top_k_test(input);
+  run_top_k_test(input, {order::ASCENDING}, {null_order::AFTER});
+  run_top_k_test(input, {order::DESCENDING}, {null_order::BEFORE});
+  run_top_k_test(input, {order::DESCENDING}, {null_order::AFTER});
+}
+
+// Ties on the leading key are ordered by the remaining key columns
+TYPED_TEST(TopK, TiesOnLeadingKey)
+{
+  fixed_width_column_wrapper<TypeParam, int32_t> col0{4, 1, 4, 2, 4, 1, 4, 0};
+  strings_column_wrapper col1{{"d", "b", "a", "c", "a", "a", "b", "e"}, {1, 1, 0, 1, 1, 1, 1, 1}};
+  table_view input{{col0, col1}};
+
+  run_top_k_test(input);
+  run_top_k_test(input, {order::DESCENDING, order::DESCENDING});
+  run_top_k_test(
+    input, {order::ASCENDING, order::DESCENDING}, {null_order::AFTER, null_order::AFTER});
+}
+
+struct TopKTest : public BaseFixture {
+};
+
+TEST_F(TopKTest, LeadingStringKey)
+{
+  strings_column_wrapper col0{{"b", "a", "c", "a", "d"}, {1, 1, 1, 0, 1}};
+  fixed_width_column_wrapper<int64_t> col1{5, 3, 2, 1, 4};
+  table_view input{{col0, col1}};
+
+  run_top_k_test(input);
+  run_top_k_test(input, {order::DESCENDING, order::ASCENDING});
+}
+
+TEST_F(TopKTest, NegativeK)
+{
+  fixed_width_column_wrapper<int32_t> col{1, 2, 3};
+  EXPECT_THROW(top_k(table_view{{col}}, -1), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
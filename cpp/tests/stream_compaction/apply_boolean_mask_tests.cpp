@@ -25,6 +25,9 @@
 #include <tests/utilities/table_utilities.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <string>
+#include <vector>
+
 struct ApplyBooleanMask : public cudf::test::BaseFixture {
 };
 
@@ -170,4 +173,68 @@ TEST_F(ApplyBooleanMask, NoNullInput)
   cudf::test::expect_tables_equal(expected, got->view());
 }
 
+TEST_F(ApplyBooleanMask, LargeMixedTable)
+{
+  // Many blocks exercise the look-back across blocks, and the columns of different widths,
+  // with and without nulls, are compacted in the same launch as the strings column
+  constexpr cudf::size_type num_rows = 300000;
+  std::vector<int8_t> col1_data(num_rows);
+  std::vector<int64_t> col2_data(num_rows);
+  std::vector<bool> col1_valid(num_rows), mask_data(num_rows), mask_valid(num_rows);
+  std::vector<std::string> col3_data(num_rows);
+  std::vector<int8_t> col1_expected_data;
+  std::vector<int64_t> col2_expected_data;
+  std::vector<bool> col1_expected_valid;
+  std::vector<std::string> col3_expected_data;
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    col1_data[i]  = static_cast<int8_t>(i % 100);
+    col2_data[i]  = static_cast<int64_t>(i) * 3;
+    col3_data[i]  = std::string(i % 7, 'a' + i % 26);
+    col1_valid[i] = i % 5 != 0;
+    mask_data[i]  = i % 3 != 0 || i > 200000;
+    mask_valid[i] = i % 11 != 0;
+    if (mask_data[i] && mask_valid[i]) {
+      col1_expected_data.push_back(col1_data[i]);
+      col1_expected_valid.push_back(col1_valid[i]);
+      col2_expected_data.push_back(col2_data[i]);
+      col3_expected_data.push_back(col3_data[i]);
+    }
+  }
+  cudf::test::fixed_width_column_wrapper<int8_t> col1(
+    col1_data.begin(), col1_data.end(), col1_valid.begin());
+  cudf::test::fixed_width_column_wrapper<int64_t> col2(col2_data.begin(), col2_data.end());
+  cudf::test::strings_column_wrapper col3(col3_data.begin(), col3_data.end());
+  cudf::test::fixed_width_column_wrapper<bool> mask(
+    mask_data.begin(), mask_data.end(), mask_valid.begin());
+
+  cudf::test::fixed_width_column_wrapper<int8_t> col1_expected(
+    col1_expected_data.begin(), col1_expected_data.end(), col1_expected_valid.begin());
+  cudf::test::fixed_width_column_wrapper<int64_t> col2_expected(col2_expected_data.begin(),
+                                                                col2_expected_data.end());
+  cudf::test::strings_column_wrapper col3_expected(col3_expected_data.begin(),
+                                                   col3_expected_data.end());
+
+  auto got = cudf::apply_boolean_mask(cudf::table_view{{col1, col2, col3}}, mask);
+
+  cudf::test::expect_tables_equal(cudf::table_view{{col1_expected, col2_expected, col3_expected}},
+                                  got->view());
+}
+
+TEST_F(ApplyBooleanMask, SlicedInput)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70, 5, 2, 10, 3, 8},
+                                                       {1, 1, 0, 1, 1, 0, 1, 1}};
+  cudf::test::strings_column_wrapper col2{{"a", "bb", "", "ddd", "e", "", "gg", "h"},
+                                          {1, 1, 0, 1, 1, 0, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, false, true, true, false, true}};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col1_expected{{40, 5, 2, 3}, {1, 1, 1, 1}};
+  cudf::test::strings_column_wrapper col2_expected{{"bb", "ddd", "e", "gg"}, {1, 1, 1, 1}};
+
+  auto const input  = cudf::slice(cudf::table_view{{col1, col2}}, {1, 7})[0];
+  auto const got   = cudf::apply_boolean_mask(input, boolean_mask);
+
+  cudf::test::expect_tables_equal(cudf::table_view{{col1_expected, col2_expected}}, got->view());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
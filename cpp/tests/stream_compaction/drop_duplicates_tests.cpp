@@ -18,6 +18,8 @@
 #include <cmath>
 #include <ctgmath>
 #include <cudf/copying.hpp>
+#include <cudf/hashing.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -394,3 +396,75 @@ TEST_F(DropDuplicate, EmptyKeys)
 
   cudf::test::expect_tables_equal(cudf::table_view{{empty_col}}, got->view());
 }
+
+struct Distinct : public cudf::test::BaseFixture {
+};
+
+TEST_F(Distinct, WithNull)
+{
+  // Rows with equal keys have equal values, so the output does not depend on the rows kept
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{5, 4, 3, 5, 8, 1, 4, 5},
+                                                      {1, 0, 1, 1, 1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<float> values{{5, 4, 3, 5, 8, 1, 4, 5},
+                                                       {1, 0, 1, 1, 1, 1, 0, 1}};
+  cudf::table_view input{{col, values}};
+  std::vector<cudf::size_type> keys{0};
+
+  auto got = cudf::sort(cudf::distinct(input, keys, null_equality::EQUAL)->view());
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col{{4, 1, 3, 5, 8}, {0, 1, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<float> exp_values{{4, 1, 3, 5, 8}, {0, 1, 1, 1, 1}};
+  cudf::test::expect_tables_equal(cudf::table_view{{exp_col, exp_values}}, got->view());
+
+  // Unequal nulls are all kept
+  auto got_unequal = cudf::sort(cudf::distinct(input, keys, null_equality::UNEQUAL)->view());
+  cudf::test::fixed_width_column_wrapper<int32_t> exp_col_unequal{{4, 4, 1, 3, 5, 8},
+                                                                  {0, 0, 1, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<float> exp_values_unequal{{4, 4, 1, 3, 5, 8},
+                                                                   {0, 0, 1, 1, 1, 1}};
+  cudf::test::expect_tables_equal(cudf::table_view{{exp_col_unequal, exp_values_unequal}},
+                                  got_unequal->view());
+}
+
+TEST_F(Distinct, StringKeyColumn)
+{
+  cudf::test::strings_column_wrapper key_col{{"all", "new", "all", "new", "the", "strings"},
+                                             {1, 1, 1, 0, 1, 1}};
+  cudf::table_view input{{key_col}};
+
+  auto got = cudf::sort(cudf::distinct(input, {0})->view());
+  cudf::test::strings_column_wrapper expected{{"", "all", "new", "strings", "the"},
+                                              {0, 1, 1, 1, 1}};
+  cudf::test::expect_tables_equal(cudf::table_view{{expected}}, got->view());
+  EXPECT_EQ(cudf::distinct_count(input), 5);
+}
+
+TEST_F(Distinct, EmptyInputTable)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col(std::initializer_list<int32_t>{});
+  cudf::table_view input{{col}};
+  std::vector<cudf::size_type> keys{0};
+
+  auto got = cudf::distinct(input, keys);
+
+  cudf::test::expect_tables_equal(input, got->view());
+}
+
+TEST_F(Distinct, PrecomputedHashes)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{5, 4, 3, 5, 8, 1, 4, 5},
+                                                      {1, 0, 1, 1, 1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<float> values{{5, 4, 3, 5, 8, 1, 4, 5},
+                                                       {1, 0, 1, 1, 1, 1, 0, 1}};
+  cudf::table_view input{{col, values}};
+  std::vector<cudf::size_type> keys{0};
+
+  auto const expected = cudf::sort(cudf::distinct(input, keys)->view());
+  for (auto const hash_function : {cudf::hash_id::HASH_MURMUR3, cudf::hash_id::HASH_XXHASH64}) {
+    auto const key_hashes = cudf::hash(input.select(keys), hash_function);
+    auto got              = cudf::sort(cudf::distinct(input, keys, *key_hashes)->view());
+    cudf::test::expect_tables_equal(expected->view(), got->view());
+  }
+
+  cudf::test::fixed_width_column_wrapper<int16_t> short_hashes{1, 2, 3, 4, 5, 6, 7, 8};
+  EXPECT_THROW(cudf::distinct(input, keys, short_hashes), cudf::logic_error);
+}
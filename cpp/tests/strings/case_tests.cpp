@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/capitalize.hpp>
 #include <cudf/strings/case.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -172,3 +173,44 @@ TEST_F(StringsCaseTest, MultiCharLower)
 
   cudf::test::expect_columns_equal(*results, expected);
 }
+
+TEST_F(StringsCaseTest, SlicedWithGrowingStrings)
+{
+  // some conversions produce more bytes than the input string
+  cudf::test::strings_column_wrapper strings(
+    {"skipped", "ab\u0250cd", "", "\u1f52x\u0149", "ABC", "\u0250\u0250\u0250", "skipped"},
+    {1, 1, 0, 1, 1, 1, 1});
+  cudf::test::strings_column_wrapper expected(
+    {"AB\u2c6fCD", "", "\u03a5\u0313\u0300X\u02bc\u004e", "ABC", "\u2c6f\u2c6f\u2c6f"},
+    {1, 0, 1, 1, 1});
+  auto sliced = cudf::slice(strings, {1, 6}).front();
+
+  auto results = cudf::strings::to_upper(cudf::strings_column_view(sliced));
+
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsCaseTest, AsciiWords)
+{
+  // The letters next to the ASCII letter ranges are not converted, and ASCII runs and multi-byte
+  // characters are mixed within the strings.
+  cudf::test::strings_column_wrapper strings(
+    {"@AZ[`az{ HELLO wORLD 0123456789", "ÜNÏCODE in THE middle of ASCII text", "aB"});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  cudf::test::strings_column_wrapper expected_lower(
+    {"@az[`az{ hello world 0123456789", "ünïcode in the middle of ascii text", "ab"});
+  cudf::test::expect_columns_equal(*cudf::strings::to_lower(strings_view), expected_lower);
+  cudf::test::strings_column_wrapper expected_upper(
+    {"@AZ[`AZ{ HELLO WORLD 0123456789", "ÜNÏCODE IN THE MIDDLE OF ASCII TEXT", "AB"});
+  cudf::test::expect_columns_equal(*cudf::strings::to_upper(strings_view), expected_upper);
+  cudf::test::strings_column_wrapper expected_swapcase(
+    {"@az[`AZ{ hello World 0123456789", "ünïcode IN the MIDDLE OF ascii TEXT", "Ab"});
+  cudf::test::expect_columns_equal(*cudf::strings::swapcase(strings_view), expected_swapcase);
+  cudf::test::strings_column_wrapper expected_capitalize(
+    {"@az[`az{ hello world 0123456789", "Ünïcode in the middle of ascii text", "Ab"});
+  cudf::test::expect_columns_equal(*cudf::strings::capitalize(strings_view), expected_capitalize);
+  cudf::test::strings_column_wrapper expected_title(
+    {"@Az[`Az{ Hello World 0123456789", "Ünïcode In The Middle Of Ascii Text", "Ab"});
+  cudf::test::expect_columns_equal(*cudf::strings::title(strings_view), expected_title);
+}
@@ -113,6 +113,18 @@ TEST_F(StringsCharsTest, LowerUpper)
   }
 }
 
+TEST_F(StringsCharsTest, AsciiSpaces)
+{
+  // The ASCII separators 0x1C to 0x1F are spaces, as in Python, and 0x1B and 0x7F are not
+  cudf::test::strings_column_wrapper strings(
+    {"\x1c\x1d\x1e\x1f\t\n\v\f\r ", " \x1b", "\x7f", "\u2003 "});
+  auto strings_view = cudf::strings_column_view(strings);
+  auto results      = cudf::strings::all_characters_of_type(
+    strings_view, cudf::strings::string_character_types::SPACE);
+  cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 1});
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
 TEST_F(StringsCharsTest, Alphanumeric)
 {
   std::vector<const char*> h_strings{"Héllo",
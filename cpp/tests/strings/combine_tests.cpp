@@ -499,3 +499,37 @@ TEST_F(StringsConcatenateWithColSeparatorTest, MultiColumnNonNullableStrings)
     cudf::strings::concatenate(cudf::table_view{{col0, col1}}, cudf::strings_column_view(sep_col));
   cudf::test::expect_columns_equal(*results, exp_results, true);
 }
+
+TEST_F(StringsConcatenateWithColSeparatorTest, MultiColumnPerColumnReplacements)
+{
+  auto col0 = cudf::test::strings_column_wrapper({"aa", "", "", "", "eé"}, {1, 0, 1, 0, 1});
+  auto col1 = cudf::test::strings_column_wrapper({"", "cc", "dd", "", "ff"}, {0, 1, 1, 0, 1});
+  auto col2 = cudf::test::strings_column_wrapper({"x", "", "", "", "gg"}, {1, 1, 0, 0, 1});
+  auto sep_col =
+    cudf::test::strings_column_wrapper({"::", "%%", "", "!", "-"}, {true, true, false, true, true});
+
+  // nulls of col0 are replaced, nulls of col1 and col2 are skipped with their separator
+  auto col_nareps = cudf::test::strings_column_wrapper({"~", "", ""}, {true, false, false});
+  auto exp_results =
+    cudf::test::strings_column_wrapper({"aa::x", "~%%cc%%", "", "~", "eé-ff-gg"}, {1, 1, 0, 1, 1});
+
+  auto results = cudf::strings::concatenate(cudf::table_view{{col0, col1, col2}},
+                                            cudf::strings_column_view(sep_col),
+                                            cudf::strings_column_view(col_nareps));
+  cudf::test::expect_columns_equal(*results, exp_results, true);
+
+  // a separator replacement makes the third row valid
+  auto exp_sep_rep =
+    cudf::test::strings_column_wrapper({"aa::x", "~%%cc%%", "+dd", "~", "eé-ff-gg"});
+  results = cudf::strings::concatenate(cudf::table_view{{col0, col1, col2}},
+                                       cudf::strings_column_view(sep_col),
+                                       cudf::strings_column_view(col_nareps),
+                                       cudf::string_scalar("+"));
+  cudf::test::expect_columns_equal(*results, exp_sep_rep, true);
+
+  auto wrong_nareps = cudf::test::strings_column_wrapper({"~", ""});
+  EXPECT_THROW(cudf::strings::concatenate(cudf::table_view{{col0, col1, col2}},
+                                          cudf::strings_column_view(sep_col),
+                                          cudf::strings_column_view(wrong_nareps)),
+               cudf::logic_error);
+}
@@ -21,6 +21,8 @@
 #include <tests/utilities/column_utilities.hpp>
 #include <tests/utilities/column_wrapper.hpp>
 
+#include <algorithm>
+#include <string>
 #include <vector>
 
 struct StringsContainsTests : public cudf::test::BaseFixture {
@@ -372,3 +374,103 @@ TEST_F(StringsContainsTests, LargeRegex)
     cudf::test::expect_columns_equal(*results, expected);
   }
 }
+
+TEST_F(StringsContainsTests, CachedProgram)
+{
+  // Over 1000 instructions, so that every use of the cached program allocates its own state
+  std::string const pattern = std::string(1200, 'a') + "b";
+  std::string const match   = "x" + std::string(1300, 'a') + "b";
+
+  for (cudf::size_type rows : {2, 40, 3}) {
+    auto iter = thrust::make_counting_iterator<cudf::size_type>(0);
+    std::vector<std::string> h_strings(rows);
+    std::transform(iter, iter + rows, h_strings.begin(), [&](auto i) {
+      return (i % 2 == 0) ? match : std::string("ab");
+    });
+    cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+    auto expected = cudf::test::fixed_width_column_wrapper<bool>(
+      thrust::make_transform_iterator(iter, [](auto i) { return i % 2 == 0; }),
+      thrust::make_transform_iterator(iter + rows, [](auto i) { return i % 2 == 0; }));
+
+    for (int repeat = 0; repeat < 2; ++repeat) {
+      auto results = cudf::strings::contains_re(cudf::strings_column_view(strings), pattern);
+      cudf::test::expect_columns_equal(*results, expected);
+    }
+  }
+}
+
+TEST_F(StringsContainsTests, NonAsciiCharacters)
+{
+  // patterns with builtin classes evaluate strings with non-ASCII characters
+  // with the regex instructions instead of the automaton
+  cudf::test::strings_column_wrapper strings(
+    {"ovér 12", "über 5", "ab٣", "a\tb", "naïve", "", "plain 7"}, {1, 1, 1, 1, 1, 0, 1});
+  auto strings_view = cudf::strings_column_view(strings);
+  {
+    auto results = cudf::strings::contains_re(strings_view, "[é-ü]");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 0, 0, 1, 0, 0},
+                                                          {1, 1, 1, 1, 1, 0, 1});
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    auto results = cudf::strings::contains_re(strings_view, "\\d");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 1, 0, 0, 0, 1},
+                                                          {1, 1, 1, 1, 1, 0, 1});
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    auto results = cudf::strings::matches_re(strings_view, "\\w+\\s");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 0, 1, 0, 0, 1},
+                                                          {1, 1, 1, 1, 1, 0, 1});
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    auto results = cudf::strings::matches_re(strings_view, "[^a-z].*\\d");
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 1, 0, 0, 0, 0, 0},
+                                                          {1, 1, 1, 1, 1, 0, 1});
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+}
+
+TEST_F(StringsContainsTests, RequiredLiteral)
+{
+  // every match of these patterns contains "error"
+  cudf::test::strings_column_wrapper strings(
+    {"error: disk 1", "err0r: disk 2", "an error", "ERROR", "xxerror: yy3", "x error: y3"});
+  auto strings_view = cudf::strings_column_view(strings);
+  {
+    auto results = cudf::strings::contains_re(strings_view, "\\berror: .*\\d");
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0, 1});
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+  {
+    auto results = cudf::strings::count_re(strings_view, "(e)rror");
+    cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 0, 1, 0, 1, 1});
+    cudf::test::expect_columns_equal(*results, expected);
+  }
+}
+
+TEST_F(StringsContainsTests, MultiplePatterns)
+{
+  std::vector<const char*> h_strings{
+    "GET /index.html 200", "POST /api 500", "ovér 404", nullptr, "", "GET /api 404"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+
+  std::vector<std::string> patterns{"^GET", "\\s[45]\\d\\d", "/api", "é", "x*"};
+  auto results = cudf::strings::contains_re(strings_view, patterns);
+  ASSERT_EQ(results->num_columns(), static_cast<cudf::size_type>(patterns.size()));
+  for (std::size_t idx = 0; idx < patterns.size(); ++idx) {
+    auto expected = cudf::strings::contains_re(strings_view, patterns[idx]);
+    cudf::test::expect_columns_equal(results->get_column(idx), *expected);
+  }
+
+  cudf::test::strings_column_wrapper empty_strings({});
+  auto empty_results =
+    cudf::strings::contains_re(cudf::strings_column_view(empty_strings), patterns);
+  EXPECT_EQ(empty_results->num_columns(), static_cast<cudf::size_type>(patterns.size()));
+  EXPECT_EQ(empty_results->num_rows(), 0);
+}
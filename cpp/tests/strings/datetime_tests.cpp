@@ -56,6 +56,28 @@ TEST_F(StringsDatetimeTest, ToTimestamp)
   cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsDatetimeTest, ToTimestampIsoLayout)
+{
+  // Strings not matching the ISO layout exactly are parsed with the general parser
+  cudf::test::strings_column_wrapper strings{"2019-07-17T21:34:37.123Z",
+                                             "2019-07-17 21:34:37.123Z",
+                                             "2019/07/17T21:34:37.123Z",
+                                             "2019-07-17T21:34:3",
+                                             "1969-12-31T23:59:59.999Z"};
+  auto strings_view = cudf::strings_column_view(strings);
+  auto results      = cudf::strings::to_timestamps(
+    strings_view, cudf::data_type{cudf::type_id::TIMESTAMP_MILLISECONDS}, "%Y-%m-%dT%H:%M:%S.%3fZ");
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms> expected{
+    1563399277123, 1563399277123, 1563399277123, 0, -1};
+  cudf::test::expect_columns_equal(*results, expected);
+
+  results = cudf::strings::to_timestamps(
+    strings_view, cudf::data_type{cudf::type_id::TIMESTAMP_DAYS}, "%Y-%m-%d");
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_D> expected_days{
+    18094, 18094, 18094, 18094, -1};
+  cudf::test::expect_columns_equal(*results, expected_days);
+}
+
 TEST_F(StringsDatetimeTest, ToTimestampAmPm)
 {
   cudf::test::strings_column_wrapper strings{"1974-02-28 01:23:45 PM",
@@ -226,3 +226,24 @@ TEST_F(StringsExtractTests, LargeRegex)
     thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
   cudf::test::expect_columns_equal(results->get_column(0), expected);
 }
+
+TEST_F(StringsExtractTests, ExtractAllTest)
+{
+  std::vector<const char*> h_strings{"a1b2", "c3", nullptr, "", "b4 a5a6"};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::extract_all(strings_view, "([ab])(\\d)");
+  using LCW    = cudf::test::lists_column_wrapper<cudf::string_view>;
+  LCW expected({LCW{"a", "1", "b", "2"},
+                LCW{},
+                LCW{},
+                LCW{},
+                LCW{"b", "4", "a", "5", "a", "6"}},
+               validity);
+  cudf::test::expect_columns_equal(results->view(), expected);
+
+  EXPECT_THROW(cudf::strings::extract_all(strings_view, "[ab]\\d"), cudf::logic_error);
+}
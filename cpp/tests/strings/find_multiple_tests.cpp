@@ -78,3 +78,48 @@ TEST_F(StringsFindMultipleTest, ErrorTest)
   // targets cannot have nulls
   EXPECT_THROW(cudf::strings::find_multiple(strings_view, strings_view), cudf::logic_error);
 }
+
+TEST_F(StringsFindMultipleTest, ContainsAny)
+{
+  cudf::test::strings_column_wrapper strings({"abc", "def", "", "xyz", "ovér", "zyx"},
+                                             {1, 1, 1, 0, 1, 1});
+  auto strings_view = cudf::strings_column_view(strings);
+  cudf::test::strings_column_wrapper targets({"b", "xy", "ef", "é", "cd"});
+  auto targets_view = cudf::strings_column_view(targets);
+
+  auto results = cudf::strings::contains_any(strings_view, targets_view);
+  cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 0, 0, 1, 0}, {1, 1, 1, 0, 1, 1});
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(StringsFindMultipleTest, FindAllLiterals)
+{
+  cudf::test::strings_column_wrapper strings({"abcab", "xbc", "", "éaé", "aaa"},
+                                             {1, 1, 0, 1, 1});
+  auto strings_view = cudf::strings_column_view(strings);
+  // "ab" is listed twice and "a" is a suffix of "éa"
+  cudf::test::strings_column_wrapper targets({"ab", "bc", "ab", "éa", "a", "aa"});
+  auto targets_view = cudf::strings_column_view(targets);
+
+  auto results = cudf::strings::find_all_literals(strings_view, targets_view);
+  // occurrences are ordered by end position, and "aa" overlaps itself in "aaa"
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_strings{
+    0, 0, 0, 0, 0, 1, 3, 3, 4, 4, 4, 4, 4};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_targets{
+    4, 0, 1, 4, 0, 1, 3, 4, 4, 5, 4, 5, 4};
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_positions{
+    0, 0, 1, 3, 3, 1, 0, 1, 0, 0, 1, 1, 2};
+  cudf::test::expect_columns_equal(results->get_column(0), expected_strings);
+  cudf::test::expect_columns_equal(results->get_column(1), expected_targets);
+  cudf::test::expect_columns_equal(results->get_column(2), expected_positions);
+}
+
+TEST_F(StringsFindMultipleTest, EmptyTargetError)
+{
+  cudf::test::strings_column_wrapper strings({"abc"});
+  auto strings_view = cudf::strings_column_view(strings);
+  cudf::test::strings_column_wrapper targets({"b", ""});
+  auto targets_view = cudf::strings_column_view(targets);
+  EXPECT_THROW(cudf::strings::contains_any(strings_view, targets_view), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::find_all_literals(strings_view, targets_view), cudf::logic_error);
+}
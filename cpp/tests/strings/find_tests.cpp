@@ -25,6 +25,7 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <string>
 #include <vector>
 
 struct StringsFindTest : public cudf::test::BaseFixture {
@@ -141,6 +142,36 @@ TEST_F(StringsFindTest, Find)
   }
 }
 
+TEST_F(StringsFindTest, LongStrings)
+{
+  std::string const padding(300, 'a');
+  std::string const accents(200, ' ');
+  std::vector<std::string> h_strings{padding + "éxyz" + padding + "xyz",
+                                     "xyz",
+                                     "",
+                                     padding,
+                                     "é" + accents + "xyz" + padding,
+                                     padding + "xy"};
+  std::vector<bool> h_valids{1, 1, 0, 1, 1, 1};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), h_valids.begin());
+  auto strings_view = cudf::strings_column_view(strings);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_find({301, 0, -1, -1, 201, -1},
+                                                                {1, 1, 0, 1, 1, 1});
+  auto results = cudf::strings::find(strings_view, cudf::string_scalar("xyz"));
+  cudf::test::expect_columns_equal(*results, expected_find);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_rfind({604, 0, -1, -1, 201, -1},
+                                                                 {1, 1, 0, 1, 1, 1});
+  results = cudf::strings::rfind(strings_view, cudf::string_scalar("xyz"));
+  cudf::test::expect_columns_equal(*results, expected_rfind);
+
+  cudf::test::fixed_width_column_wrapper<bool> expected_contains({1, 1, 0, 0, 1, 0},
+                                                                 {1, 1, 0, 1, 1, 1});
+  results = cudf::strings::contains(strings_view, cudf::string_scalar("xyz"));
+  cudf::test::expect_columns_equal(*results, expected_contains);
+}
+
 TEST_F(StringsFindTest, ZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_strings_column(
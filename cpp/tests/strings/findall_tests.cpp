@@ -15,6 +15,8 @@
  */
 
 #include <tests/strings/utilities.h>
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/findall.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <tests/utilities/base_fixture.hpp>
@@ -22,6 +24,7 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/table_utilities.hpp>
 
+#include <string>
 #include <vector>
 
 struct StringsFindallTests : public cudf::test::BaseFixture {
@@ -135,3 +138,44 @@ TEST_F(StringsFindallTests, LargeRegex)
     thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
   cudf::test::expect_columns_equal(results->get_column(0), expected);
 }
+
+TEST_F(StringsFindallTests, FindallRecord)
+{
+  std::vector<const char*> h_strings{
+    "First Last", "Joe Schmoe", "John Smith", "Jane Smith", "Beyonce", "Sting", nullptr, ""};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::findall_record(strings_view, "(\\w+)");
+  using LCW    = cudf::test::lists_column_wrapper<cudf::string_view>;
+  LCW expected({LCW{"First", "Last"},
+                LCW{"Joe", "Schmoe"},
+                LCW{"John", "Smith"},
+                LCW{"Jane", "Smith"},
+                LCW{"Beyonce"},
+                LCW{"Sting"},
+                LCW{},
+                LCW{}},
+               validity);
+  cudf::test::expect_columns_equal(results->view(), expected);
+}
+
+TEST_F(StringsFindallTests, FindallRecordSkewedCounts)
+{
+  // One string with many matches does not pad the others
+  std::string many_tags;
+  for (int i = 0; i < 100; ++i) many_tags += "#tag" + std::to_string(i) + " ";
+  cudf::test::strings_column_wrapper strings({"no tags", many_tags.c_str(), "#one"});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::findall_record(strings_view, "#\\w+");
+  cudf::lists_column_view lists(results->view());
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets{0, 0, 100, 101};
+  cudf::test::expect_columns_equal(lists.offsets(), expected_offsets);
+  cudf::test::strings_column_wrapper expected_tags({"#tag0", "#tag99", "#one"});
+  auto const tags = cudf::gather(cudf::table_view{{lists.child()}},
+                                 cudf::test::fixed_width_column_wrapper<int32_t>{0, 99, 100});
+  cudf::test::expect_columns_equal(tags->get_column(0), expected_tags);
+}
@@ -165,6 +165,42 @@ TEST_F(StringsConvertTest, ToFloats64)
   cudf::test::expect_columns_equivalent(*results, expected);
 }
 
+TEST_F(StringsConvertTest, ToFloats64InvalidAsNull)
+{
+  std::vector<const char*> h_strings{"0.1",
+                                     "123456789.123456789",
+                                     "-4.9e-324",
+                                     "1.5.3",
+                                     nullptr,
+                                     "",
+                                     "-Inf",
+                                     "2e",
+                                     "+.5E+1",
+                                     "12345678901234567890123"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  auto strings_view = cudf::strings_column_view(strings);
+  auto results =
+    cudf::strings::to_floats(strings_view, cudf::data_type{cudf::type_id::FLOAT64}, true);
+
+  cudf::test::fixed_width_column_wrapper<double> expected(
+    {0.1,
+     123456789.123456789,
+     -4.9e-324,
+     0,
+     0,
+     0,
+     -std::numeric_limits<double>::infinity(),
+     0,
+     5.0,
+     12345678901234567890123.0},
+    {1, 1, 1, 0, 0, 0, 1, 0, 1, 1});
+  cudf::test::expect_columns_equivalent(*results, expected);
+}
+
 TEST_F(StringsConvertTest, FromFloats64)
 {
   std::vector<double> h_floats{100,
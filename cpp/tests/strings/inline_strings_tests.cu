@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/strings/detail/inline_strings.cuh>
+#include <cudf/strings/inline_strings.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <thrust/equal.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <limits>
+#include <vector>
+
+struct InlineStringsTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+std::vector<const char*> const h_strings{"country",
+                                         "",
+                                         "a much longer string",
+                                         nullptr,
+                                         "countr",
+                                         "count",
+                                         "exactly12byt",
+                                         "exactly12bytes!",
+                                         "a much longer strinG",
+                                         "countries"};
+
+cudf::test::strings_column_wrapper make_strings()
+{
+  return cudf::test::strings_column_wrapper(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+}
+
+}  // namespace
+
+TEST_F(InlineStringsTest, RoundTrip)
+{
+  auto strings = make_strings();
+  auto inlined = cudf::strings::to_inline_strings(cudf::strings_column_view(strings));
+  EXPECT_EQ(inlined->size(), static_cast<cudf::size_type>(h_strings.size()));
+  EXPECT_EQ(inlined->null_count(), 1);
+  // Only the strings longer than 12 bytes are in the data buffer
+  EXPECT_EQ(inlined->data_size(), 20u + 15u + 20u);
+
+  auto results = cudf::strings::from_inline_strings(*inlined);
+  cudf::test::expect_columns_equal(*results, strings);
+
+  // Sliced columns are converted from their first row
+  auto sliced = cudf::slice(strings, {2, 8}).front();
+  results     = cudf::strings::from_inline_strings(
+    *cudf::strings::to_inline_strings(cudf::strings_column_view(sliced)));
+  cudf::test::expect_columns_equal(*results, sliced);
+}
+
+TEST_F(InlineStringsTest, ZeroSizeStringsColumn)
+{
+  cudf::column_view zero_size_strings_column(cudf::data_type{cudf::type_id::STRING}, 0, nullptr);
+  auto inlined =
+    cudf::strings::to_inline_strings(cudf::strings_column_view(zero_size_strings_column));
+  EXPECT_EQ(inlined->size(), 0);
+  auto results = cudf::strings::from_inline_strings(*inlined);
+  cudf::test::expect_strings_empty(results->view());
+}
+
+TEST_F(InlineStringsTest, SortMatchesStringsColumn)
+{
+  auto strings = make_strings();
+  auto inlined = cudf::strings::to_inline_strings(cudf::strings_column_view(strings));
+  auto const d_strings = cudf::strings::detail::inline_strings_device_view{*inlined};
+
+  thrust::device_vector<cudf::size_type> indices(inlined->size());
+  thrust::sequence(thrust::device, indices.begin(), indices.end());
+  thrust::sort(thrust::device,
+               indices.begin(),
+               indices.end(),
+               cudf::strings::detail::inline_strings_less{d_strings});
+
+  auto expected = cudf::sorted_order(cudf::table_view{{strings}});
+  thrust::host_vector<cudf::size_type> h_indices(indices);
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> results(h_indices.begin(),
+                                                                  h_indices.end());
+  cudf::test::expect_columns_equal(results, *expected);
+}
+
+TEST_F(InlineStringsTest, EqualAndHash)
+{
+  auto strings = make_strings();
+  auto inlined = cudf::strings::to_inline_strings(cudf::strings_column_view(strings));
+  auto lhs     = cudf::strings::detail::inline_strings_device_view{*inlined};
+  // Every string compared with the string of the next row, and with itself
+  std::vector<const char*> h_others(h_strings.begin() + 1, h_strings.end());
+  h_others.push_back(h_strings.front());
+  cudf::test::strings_column_wrapper others(
+    h_others.begin(),
+    h_others.end(),
+    thrust::make_transform_iterator(h_others.begin(), [](auto str) { return str != nullptr; }));
+  auto other_inlined = cudf::strings::to_inline_strings(cudf::strings_column_view(others));
+  auto rhs           = cudf::strings::detail::inline_strings_device_view{*other_inlined};
+
+  auto const size = inlined->size();
+  thrust::device_vector<bool> d_next(size);
+  thrust::device_vector<bool> d_self(size);
+  auto equal = cudf::strings::detail::inline_strings_equal{lhs, rhs};
+  thrust::transform(thrust::device,
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(size),
+                    d_next.begin(),
+                    [equal] __device__(auto idx) { return equal(idx, idx); });
+  auto self_equal = cudf::strings::detail::inline_strings_equal{lhs, lhs};
+  thrust::transform(thrust::device,
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(size),
+                    d_self.begin(),
+                    [self_equal] __device__(auto idx) { return self_equal(idx, idx); });
+  thrust::host_vector<bool> h_next(d_next);
+  thrust::host_vector<bool> h_self(d_self);
+  for (cudf::size_type idx = 0; idx < size; ++idx) {
+    EXPECT_FALSE(h_next[idx]);
+    EXPECT_TRUE(h_self[idx]);
+  }
+
+  // The hashes are the hashes of the strings column rows
+  auto d_column  = cudf::column_device_view::create(strings);
+  auto d_strings = *d_column;
+  thrust::device_vector<uint32_t> d_hashes(size);
+  thrust::device_vector<uint32_t> d_expected(size);
+  thrust::transform(thrust::device,
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(size),
+                    d_hashes.begin(),
+                    cudf::strings::detail::inline_strings_hasher{lhs});
+  thrust::transform(thrust::device,
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(size),
+                    d_expected.begin(),
+                    [d_strings] __device__(auto idx) {
+                      if (d_strings.is_null(idx)) {
+                        return std::numeric_limits<hash_value_type>::max();
+                      }
+                      return MurmurHash3_32<cudf::string_view>{}(
+                        d_strings.element<cudf::string_view>(idx));
+                    });
+  EXPECT_TRUE(thrust::equal(thrust::device, d_hashes.begin(), d_hashes.end(), d_expected.begin()));
+}
@@ -23,6 +23,7 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/type_lists.hpp>
 
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -49,6 +50,36 @@ TEST_F(StringsConvertTest, ToInteger)
   cudf::test::expect_columns_equal(*results, expected);
 }
 
+TEST_F(StringsConvertTest, ToIntegerInvalidAsNull)
+{
+  std::vector<const char*> h_strings{"123456789012",
+                                     "-9223372036854775808",
+                                     "9223372036854775808",
+                                     nullptr,
+                                     "",
+                                     "+17",
+                                     "12a",
+                                     "-",
+                                     "00000000000000000000042"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto results =
+    cudf::strings::to_integers(strings_view, cudf::data_type{cudf::type_id::INT64}, true);
+  cudf::test::fixed_width_column_wrapper<int64_t> expected(
+    {123456789012L, std::numeric_limits<int64_t>::min(), 0, 0, 0, 17, 0, 0, 42},
+    {1, 1, 0, 0, 0, 1, 0, 0, 1});
+  cudf::test::expect_columns_equal(*results, expected);
+
+  results = cudf::strings::to_integers(strings_view, cudf::data_type{cudf::type_id::INT8}, true);
+  cudf::test::fixed_width_column_wrapper<int8_t> expected_int8({0, 0, 0, 0, 0, 17, 0, 0, 42},
+                                                               {0, 0, 0, 0, 0, 1, 0, 0, 1});
+  cudf::test::expect_columns_equal(*results, expected_int8);
+}
+
 TEST_F(StringsConvertTest, FromInteger)
 {
   int32_t minint = std::numeric_limits<int32_t>::min();
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/split/partition.hpp>
 #include <cudf/strings/split/split.hpp>
@@ -27,6 +28,8 @@
 #include <tests/utilities/column_wrapper.hpp>
 #include <tests/utilities/table_utilities.hpp>
 
+#include <limits>
+#include <string>
 #include <vector>
 
 struct StringsSplitTest : public cudf::test::BaseFixture {
@@ -430,6 +433,88 @@ TEST_F(StringsSplitTest, RSplitRecordWhitespaceWithMaxSplit)
   cudf::test::expect_columns_equal(result->view(), expected);
 }
 
+TEST_F(StringsSplitTest, SplitRecordLongStrings)
+{
+  // Ragged query strings, with tokens crossing the 4-byte words at every alignment
+  std::vector<std::string> h_strings;
+  for (int i = 0; i < 100; ++i) {
+    std::string str;
+    auto const num_pairs = (i == 50) ? 1000 : i % 17;
+    for (int j = 0; j < num_pairs; ++j) {
+      if (j > 0) { str += '&'; }
+      str += "k" + std::to_string(j) + "=" + std::string(j % 5, (j % 2) ? 'v' : '&') + "é";
+    }
+    h_strings.push_back(str);
+  }
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+
+  auto split = [](std::string const& str, std::size_t max_tokens, bool reverse) {
+    std::vector<std::string> tokens;
+    std::size_t begin = 0;
+    std::size_t end   = str.size();
+    while (tokens.size() + 1 < max_tokens) {
+      auto const pos = reverse ? (end == 0 ? std::string::npos : str.rfind('&', end - 1))
+                               : str.find('&', begin);
+      if (pos == std::string::npos) { break; }
+      if (reverse) {
+        tokens.insert(tokens.begin(), str.substr(pos + 1, end - pos - 1));
+        end = pos;
+      } else {
+        tokens.push_back(str.substr(begin, pos - begin));
+        begin = pos + 1;
+      }
+    }
+    tokens.insert(reverse ? tokens.begin() : tokens.end(), str.substr(begin, end - begin));
+    return tokens;
+  };
+
+  auto check = [&](cudf::column_view const& result, std::size_t max_tokens, bool reverse) {
+    std::vector<std::string> h_tokens;
+    std::vector<int32_t> h_offsets{0};
+    for (auto const& str : h_strings) {
+      auto const tokens = split(str, max_tokens, reverse);
+      h_tokens.insert(h_tokens.end(), tokens.begin(), tokens.end());
+      h_offsets.push_back(static_cast<int32_t>(h_tokens.size()));
+    }
+    cudf::lists_column_view lists(result);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected_offsets(h_offsets.begin(),
+                                                                     h_offsets.end());
+    cudf::test::strings_column_wrapper expected_tokens(h_tokens.begin(), h_tokens.end());
+    cudf::test::expect_columns_equal(lists.offsets(), expected_offsets);
+    cudf::test::expect_columns_equal(lists.child(), expected_tokens);
+  };
+
+  auto const delimiter = cudf::string_scalar("&");
+  auto const all       = std::numeric_limits<std::size_t>::max();
+  check(cudf::strings::split_record(cudf::strings_column_view(strings), delimiter)->view(),
+        all,
+        false);
+  check(cudf::strings::rsplit_record(cudf::strings_column_view(strings), delimiter)->view(),
+        all,
+        true);
+  check(cudf::strings::split_record(cudf::strings_column_view(strings), delimiter, 3)->view(),
+        4,
+        false);
+  check(cudf::strings::rsplit_record(cudf::strings_column_view(strings), delimiter, 3)->view(),
+        4,
+        true);
+}
+
+TEST_F(StringsSplitTest, SplitRecordMultiByteDelimiter)
+{
+  std::vector<const char*> h_strings{"a==b==c", nullptr, "==ab", "ab==", "", "a=b"};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+
+  using LCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+  LCW expected(
+    {LCW{"a", "b", "c"}, LCW{}, LCW{"", "ab"}, LCW{"ab", ""}, LCW{""}, LCW{"a=b"}}, validity);
+  auto result =
+    cudf::strings::split_record(cudf::strings_column_view(strings), cudf::string_scalar("=="));
+  cudf::test::expect_columns_equal(result->view(), expected);
+}
+
 TEST_F(StringsSplitTest, SplitRecordZeroSizeStringsColumns)
 {
   cudf::column_view zero_size_strings_column(
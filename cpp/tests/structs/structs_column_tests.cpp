@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/hashing.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <algorithm>
+#include <vector>
+
+struct StructsColumnTest : public cudf::test::BaseFixture {
+};
+
+using int_column    = cudf::test::fixed_width_column_wrapper<int32_t>;
+using string_column = cudf::test::strings_column_wrapper;
+
+namespace {
+// Builds a struct column of the fields, null where `validity` is false
+std::unique_ptr<cudf::column> make_structs(std::vector<cudf::column_view> const& fields,
+                                           std::vector<bool> const& validity = {})
+{
+  std::vector<std::unique_ptr<cudf::column>> children;
+  for (auto const& field : fields) { children.push_back(std::make_unique<cudf::column>(field)); }
+  auto const num_rows = fields.front().size();
+  if (validity.empty()) { return cudf::make_structs_column(num_rows, std::move(children), 0, {}); }
+  auto const null_count =
+    static_cast<cudf::size_type>(std::count(validity.begin(), validity.end(), false));
+  return cudf::make_structs_column(num_rows,
+                                   std::move(children),
+                                   null_count,
+                                   cudf::test::detail::make_null_mask(validity.begin(),
+                                                                      validity.end()));
+}
+
+}  // namespace
+
+TEST_F(StructsColumnTest, FactoryAndView)
+{
+  int_column ints{1, 2, 3};
+  string_column strings{"a", "b", "c"};
+  auto structs = make_structs({ints, strings}, {true, false, true});
+
+  EXPECT_EQ(structs->type().id(), cudf::type_id::STRUCT);
+  EXPECT_EQ(structs->size(), 3);
+  EXPECT_EQ(structs->null_count(), 1);
+  EXPECT_EQ(structs->num_children(), 2);
+
+  // the fields of a slice are sliced like the struct column
+  auto const sliced = cudf::slice(structs->view(), {1, 3}).front();
+  cudf::structs_column_view sliced_view(sliced);
+  EXPECT_EQ(sliced_view.size(), 2);
+  cudf::test::expect_columns_equal(sliced_view.child(0), int_column{2, 3});
+  cudf::test::expect_columns_equal(sliced_view.child(1), string_column{"b", "c"});
+
+  // a copy starts at the first row of the slice
+  cudf::column copy(sliced);
+  cudf::test::expect_columns_equal(copy.view(), sliced);
+}
+
+TEST_F(StructsColumnTest, FieldSizeMismatch)
+{
+  std::vector<std::unique_ptr<cudf::column>> children;
+  children.push_back(int_column{1, 2, 3}.release());
+  children.push_back(int_column{1, 2}.release());
+  EXPECT_THROW(cudf::make_structs_column(3, std::move(children), 0, {}), cudf::logic_error);
+}
+
+TEST_F(StructsColumnTest, Gather)
+{
+  int_column ints{{1, 2, 3, 4}, {1, 1, 0, 1}};
+  string_column strings{"a", "b", "c", "d"};
+  auto structs = make_structs({ints, strings}, {true, false, true, true});
+
+  int_column gather_map{3, 0, 1};
+  auto result = cudf::gather(cudf::table_view{{structs->view()}}, gather_map);
+
+  int_column expected_ints{4, 1, 2};
+  string_column expected_strings{"d", "a", "b"};
+  auto expected = make_structs({expected_ints, expected_strings}, {true, true, false});
+  // the gathered ints are nullable, with no nulls
+  cudf::test::expect_columns_equivalent(result->get_column(0), *expected);
+}
+
+TEST_F(StructsColumnTest, Concatenate)
+{
+  int_column ints1{1, 2};
+  string_column strings1{"a", "b"};
+  auto structs1 = make_structs({ints1, strings1}, {true, false});
+  int_column ints2{3, 4, 5};
+  string_column strings2{"c", "d", "e"};
+  auto structs2 = make_structs({ints2, strings2});
+
+  auto result = cudf::concatenate({structs1->view(), structs2->view()});
+
+  int_column expected_ints{1, 2, 3, 4, 5};
+  string_column expected_strings{"a", "b", "c", "d", "e"};
+  auto expected =
+    make_structs({expected_ints, expected_strings}, {true, false, true, true, true});
+  cudf::test::expect_columns_equal(*result, *expected);
+}
+
+TEST_F(StructsColumnTest, SortedOrder)
+{
+  int_column first{2, 1, 2, 1, 9};
+  int_column second{1, 5, 0, 2, 9};
+  auto structs = make_structs({first, second}, {true, true, true, true, false});
+
+  auto result = cudf::sorted_order(
+    cudf::table_view{{structs->view()}}, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+  cudf::test::expect_columns_equal(*result, int_column{4, 3, 1, 2, 0});
+
+  result = cudf::sorted_order(
+    cudf::table_view{{structs->view()}}, {cudf::order::DESCENDING}, {cudf::null_order::BEFORE});
+  cudf::test::expect_columns_equal(*result, int_column{0, 2, 1, 3, 4});
+}
+
+TEST_F(StructsColumnTest, Hash)
+{
+  // null structs hash alike whatever their fields hold
+  int_column ints{1, 2, 3, 1};
+  auto structs = make_structs({ints}, {false, false, true, true});
+
+  auto result   = cudf::hash(cudf::table_view{{structs->view()}});
+  auto h_result = cudf::test::to_host<int32_t>(*result).first;
+  EXPECT_EQ(h_result[0], h_result[1]);
+  EXPECT_NE(h_result[0], h_result[3]);
+
+  // a struct without nulls hashes like its fields
+  int_column more_ints{4, 5, 6, 7};
+  auto no_nulls = make_structs({ints, more_ints});
+  cudf::test::expect_columns_equal(*cudf::hash(cudf::table_view{{no_nulls->view()}}),
+                                   *cudf::hash(cudf::table_view{{ints, more_ints}}));
+}
+
+TEST_F(StructsColumnTest, GroupbyKeys)
+{
+  int_column first{1, 2, 1, 2, 9, 1};
+  int_column second{5, 0, 5, 0, 9, 7};
+  auto keys = make_structs({first, second}, {true, true, true, true, false, true});
+  int_column values{1, 2, 3, 4, 5, 6};
+
+  int_column expected_first{1, 1, 2};
+  int_column expected_second{5, 7, 0};
+  auto expected_keys = make_structs({expected_first, expected_second});
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_sums{4, 6, 6};
+
+  // the hash implementation computes sums, the sort implementation nth elements
+  for (bool use_sort : {false, true}) {
+    std::vector<cudf::groupby::aggregation_request> requests(1);
+    requests[0].values = values;
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation());
+    if (use_sort) { requests[0].aggregations.push_back(cudf::make_nth_element_aggregation(0)); }
+    cudf::groupby::groupby gb(cudf::table_view{{keys->view()}});
+    auto result = gb.aggregate(requests);
+
+    ASSERT_EQ(result.first->get_column(0).type().id(), cudf::type_id::STRUCT);
+    auto const order       = cudf::sorted_order(result.first->view());
+    auto const sorted_keys = cudf::gather(result.first->view(), *order);
+    auto const sorted_sums =
+      cudf::gather(cudf::table_view{{result.second[0].results[0]->view()}}, *order);
+    cudf::test::expect_columns_equivalent(sorted_keys->get_column(0), *expected_keys);
+    cudf::test::expect_columns_equivalent(sorted_sums->get_column(0), expected_sums);
+  }
+}
+
+TEST_F(StructsColumnTest, InnerJoin)
+{
+  // the keys match on their fields whatever the nullability of the structs
+  int_column left_ints{1, 2, 3, 4};
+  string_column left_strings{"a", "b", "c", "d"};
+  auto left_keys = make_structs({left_ints, left_strings});
+  int_column left_values{10, 20, 30, 40};
+
+  int_column right_ints{2, 1, 4, 3};
+  string_column right_strings{"b", "x", "d", "c"};
+  auto right_keys = make_structs({right_ints, right_strings}, {true, true, false, true});
+  int_column right_values{200, 100, 400, 300};
+
+  auto result = cudf::inner_join(cudf::table_view{{left_keys->view(), left_values}},
+                                 cudf::table_view{{right_keys->view(), right_values}},
+                                 {0},
+                                 {0},
+                                 {});
+  auto const order  = cudf::sorted_order(cudf::table_view{{result->get_column(1).view()}});
+  auto const sorted = cudf::gather(result->view(), *order);
+  cudf::test::expect_columns_equal(sorted->get_column(1), int_column{20, 30});
+  cudf::test::expect_columns_equal(sorted->get_column(3), int_column{200, 300});
+}
+
+CUDF_TEST_PROGRAM_MAIN()
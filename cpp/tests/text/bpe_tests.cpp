@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <nvtext/bpe_tokenize.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct TextBPETokenizeTest : public cudf::test::BaseFixture {
+};
+
+// Encodes bytes in the byte-level encoding of GPT-2: the printable bytes are kept and the other
+// bytes are represented by the code points from 256 on.
+std::string byte_level(std::string const& bytes)
+{
+  std::vector<uint32_t> code_points(256);
+  uint32_t next_code_point = 256;
+  for (uint32_t byte = 0; byte < 256; ++byte) {
+    bool const printable = ((byte >= '!') && (byte <= '~')) || ((byte >= 0xA1) && (byte <= 0xAC)) ||
+                           (byte >= 0xAE);
+    code_points[byte] = printable ? byte : next_code_point++;
+  }
+  std::string result;
+  for (auto const byte : bytes) {
+    auto const cp = code_points[static_cast<uint8_t>(byte)];
+    if (cp < 0x80) {
+      result.push_back(static_cast<char>(cp));
+    } else {
+      result.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+      result.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+  }
+  return result;
+}
+
+// Creates a vocabulary where the id of each byte is its value, followed by the tokens:
+//  'he'=256, 'll'=257, 'hell'=258, 'hello'=259, ' w'=260, 'or'=261, 'ld'=262, ' wor'=263,
+//  ' world'=264
+void create_bpe_files(std::string const& vocabulary_file, std::string const& merges_file)
+{
+  std::ofstream vocabulary(vocabulary_file, std::ofstream::out);
+  for (int byte = 0; byte < 256; ++byte) {
+    vocabulary << byte_level(std::string(1, static_cast<char>(byte))) << "\n";
+  }
+  for (auto const token : {"he", "ll", "hell", "hello", " w", "or", "ld", " wor", " world"}) {
+    vocabulary << byte_level(token) << "\n";
+  }
+  std::ofstream merges(merges_file, std::ofstream::out);
+  merges << "#version: 0.2\n";
+  std::vector<std::pair<std::string, std::string>> const rules{
+    {"h", "e"}, {"l", "l"}, {"he", "ll"}, {"hell", "o"}, {" ", "w"}, {"o", "r"}, {"l", "d"},
+    {" w", "or"}, {" wor", "ld"}};
+  for (auto const& rule : rules) {
+    merges << byte_level(rule.first) << " " << byte_level(rule.second) << "\n";
+  }
+}
+
+TEST_F(TextBPETokenizeTest, Tokenize)
+{
+  std::string vocabulary_file = temp_env->get_temp_filepath("bpe_vocab.txt");
+  std::string merges_file     = temp_env->get_temp_filepath("bpe_merges.txt");
+  create_bpe_files(vocabulary_file, merges_file);
+  auto const vocabulary = nvtext::load_bpe_vocabulary(vocabulary_file, merges_file);
+  EXPECT_EQ(vocabulary->vocabulary_size, 265);
+  EXPECT_EQ(vocabulary->num_merges, 9);
+
+  cudf::test::strings_column_wrapper strings(
+    {"hello world", "hello, world!", "", "help", "", "  hi", "thé"}, {1, 1, 1, 1, 0, 1, 1});
+  auto const results = nvtext::bpe_tokenize(cudf::strings_column_view(strings), *vocabulary);
+
+  using LCW     = cudf::test::lists_column_wrapper<uint32_t>;
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i != 4; });
+  LCW expected({{259, 264},
+                {259, 44, 264, 33},
+                LCW{},
+                {256, 108, 112},
+                LCW{},
+                {32, 32, 104, 105},
+                {116, 104, 195, 169}},
+               validity);
+  cudf::test::expect_columns_equal(*results, expected);
+
+  auto const sliced         = cudf::slice(strings, {1, 4}).front();
+  auto const sliced_results = nvtext::bpe_tokenize(cudf::strings_column_view(sliced), *vocabulary);
+  LCW sliced_expected{{259, 44, 264, 33}, LCW{}, {256, 108, 112}};
+  cudf::test::expect_columns_equal(*sliced_results, sliced_expected);
+}
+
+TEST_F(TextBPETokenizeTest, EmptyTest)
+{
+  std::string vocabulary_file = temp_env->get_temp_filepath("bpe_vocab.txt");
+  std::string merges_file     = temp_env->get_temp_filepath("bpe_merges.txt");
+  create_bpe_files(vocabulary_file, merges_file);
+  auto const vocabulary = nvtext::load_bpe_vocabulary(vocabulary_file, merges_file);
+
+  auto strings = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  auto results = nvtext::bpe_tokenize(cudf::strings_column_view(strings->view()), *vocabulary);
+  EXPECT_EQ(results->size(), 0);
+  EXPECT_EQ(results->type().id(), cudf::type_id::LIST);
+}
+
+TEST_F(TextBPETokenizeTest, LoadErrors)
+{
+  std::string vocabulary_file = temp_env->get_temp_filepath("bpe_vocab.txt");
+  std::string merges_file     = temp_env->get_temp_filepath("bpe_merges.txt");
+  create_bpe_files(vocabulary_file, merges_file);
+  EXPECT_THROW(nvtext::load_bpe_vocabulary("nope.txt", merges_file), cudf::logic_error);
+  EXPECT_THROW(nvtext::load_bpe_vocabulary(vocabulary_file, "nope.txt"), cudf::logic_error);
+
+  // a merge pair whose merged token is not in the vocabulary
+  std::string bad_merges_file = temp_env->get_temp_filepath("bpe_bad_merges.txt");
+  {
+    std::ofstream merges(bad_merges_file, std::ofstream::out);
+    merges << "x y\n";
+  }
+  EXPECT_THROW(nvtext::load_bpe_vocabulary(vocabulary_file, bad_merges_file), cudf::logic_error);
+
+  // the vocabulary must have a token for each byte
+  std::string small_vocabulary_file = temp_env->get_temp_filepath("bpe_small_vocab.txt");
+  {
+    std::ofstream vocabulary(small_vocabulary_file, std::ofstream::out);
+    vocabulary << "a\nb\n";
+  }
+  EXPECT_THROW(nvtext::load_bpe_vocabulary(small_vocabulary_file, merges_file), cudf::logic_error);
+}
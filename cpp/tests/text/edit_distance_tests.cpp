@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <nvtext/edit_distance.hpp>
+
+#include <string>
+#include <vector>
+
+struct TextEditDistanceTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TextEditDistanceTest, EditDistance)
+{
+  std::string const long_string(70, 'a');
+  std::string const long_target = long_string.substr(0, 30) + "b" + long_string.substr(31) + "c";
+  cudf::test::strings_column_wrapper strings(
+    {"hello", "", "world", "kitten", "", "thé", long_string.c_str(), "short"},
+    {1, 1, 1, 1, 0, 1, 1, 1});
+  cudf::test::strings_column_wrapper targets(
+    {"hallo", "goodbye", "world", "sitting", "x", "the", long_target.c_str(), long_string.c_str()});
+
+  auto results = nvtext::edit_distance(cudf::strings_column_view(strings),
+                                       cudf::strings_column_view(targets));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 7, 0, 3, 0, 1, 2, 70},
+                                                           {1, 1, 1, 1, 0, 1, 1, 1});
+  cudf::test::expect_columns_equal(*results, expected);
+
+  results = nvtext::edit_distance(cudf::strings_column_view(strings), cudf::string_scalar("hallo"));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_scalar({1, 5, 4, 6, 0, 5, 69, 5},
+                                                                  {1, 1, 1, 1, 0, 1, 1, 1});
+  cudf::test::expect_columns_equal(*results, expected_scalar);
+}
+
+TEST_F(TextEditDistanceTest, EditDistanceMatrix)
+{
+  cudf::test::strings_column_wrapper strings({"hello", "hallo", "hella", ""}, {1, 1, 1, 0});
+  auto results = nvtext::edit_distance_matrix(cudf::strings_column_view(strings));
+  cudf::test::lists_column_wrapper<int32_t> expected{
+    {0, 1, 1, 5}, {1, 0, 2, 5}, {1, 2, 0, 5}, {5, 5, 5, 0}};
+  cudf::test::expect_columns_equal(*results, expected);
+}
+
+TEST_F(TextEditDistanceTest, JaroWinkler)
+{
+  std::string const long_string(70, 'a');
+  cudf::test::strings_column_wrapper strings(
+    {"martha", "dixon", "", "abc", "", "dwayne", long_string.c_str()}, {1, 1, 1, 1, 0, 1, 1});
+  cudf::test::strings_column_wrapper targets(
+    {"marhta", "dicksonx", "", "xyz", "abc", "duane", long_string.c_str()});
+
+  auto results = nvtext::jaro_winkler(cudf::strings_column_view(strings),
+                                      cudf::strings_column_view(targets));
+  EXPECT_EQ(results->null_count(), 1);
+  std::vector<double> const expected{
+    0.961111111111111, 0.813333333333333, 1.0, 0.0, 0.0, 0.84, 1.0};
+  auto const similarities = cudf::test::to_host<double>(*results).first;
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    if (i != 4) { EXPECT_NEAR(similarities[i], expected[i], 1e-12); }
+  }
+
+  // without the prefix weight this is the Jaro similarity
+  results = nvtext::jaro_winkler(
+    cudf::strings_column_view(strings), cudf::string_scalar("marhta"), 0.0);
+  auto const values = cudf::test::to_host<double>(*results).first;
+  EXPECT_NEAR(values[0], 0.944444444444444, 1e-12);
+  EXPECT_EQ(values[2], 0.0);
+}
+
+TEST_F(TextEditDistanceTest, InvalidTarget)
+{
+  cudf::test::strings_column_wrapper strings({"hello", "world"});
+  cudf::string_scalar target("", false);
+  auto results = nvtext::edit_distance(cudf::strings_column_view(strings), target);
+  EXPECT_EQ(results->size(), 2);
+  EXPECT_EQ(results->null_count(), 2);
+  results = nvtext::jaro_winkler(cudf::strings_column_view(strings), target);
+  EXPECT_EQ(results->null_count(), 2);
+}
+
+TEST_F(TextEditDistanceTest, EmptyTest)
+{
+  auto strings = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  cudf::strings_column_view strings_view(strings->view());
+  auto results = nvtext::edit_distance(strings_view, strings_view);
+  EXPECT_EQ(results->size(), 0);
+  results = nvtext::edit_distance_matrix(strings_view);
+  EXPECT_EQ(results->size(), 0);
+  results = nvtext::jaro_winkler(strings_view, cudf::string_scalar("hello"));
+  EXPECT_EQ(results->size(), 0);
+}
+
+TEST_F(TextEditDistanceTest, ErrorsTest)
+{
+  cudf::test::strings_column_wrapper strings({"hello", "world"});
+  cudf::test::strings_column_wrapper targets({"hello"});
+  cudf::strings_column_view strings_view(strings);
+  EXPECT_THROW(nvtext::edit_distance(strings_view, cudf::strings_column_view(targets)),
+               cudf::logic_error);
+  EXPECT_THROW(nvtext::jaro_winkler(strings_view, cudf::strings_column_view(targets)),
+               cudf::logic_error);
+  EXPECT_THROW(nvtext::jaro_winkler(strings_view, strings_view, 0.3), cudf::logic_error);
+}
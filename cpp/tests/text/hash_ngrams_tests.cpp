@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <nvtext/hash_ngrams.hpp>
+
+#include <algorithm>
+#include <vector>
+
+struct HashNgramsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(HashNgramsTest, CharacterNgrams)
+{
+  cudf::test::strings_column_wrapper strings{{"abab", "ab", "a", "", "thé thé", "xyz"},
+                                             {1, 1, 1, 1, 1, 0}};
+  cudf::strings_column_view strings_view(strings);
+
+  auto const results = nvtext::hash_ngrams(strings_view, 2, 1000);
+  EXPECT_EQ(results->size(), 6);
+  EXPECT_EQ(results->null_count(), 1);
+  cudf::lists_column_view lists(*results);
+  EXPECT_EQ(lists.child().type().id(), cudf::type_id::INT32);
+  auto const offsets = cudf::test::to_host<int32_t>(lists.offsets()).first;
+  EXPECT_EQ(offsets, (std::vector<int32_t>{0, 3, 4, 4, 4, 10, 10}));
+
+  auto const features = cudf::test::to_host<int32_t>(lists.child()).first;
+  EXPECT_TRUE(std::all_of(
+    features.begin(), features.end(), [](int32_t f) { return f >= 0 && f < 1000; }));
+  // "ab" is the 1st and 3rd ngram of "abab" and the only one of "ab"
+  EXPECT_EQ(features[0], features[2]);
+  EXPECT_EQ(features[0], features[3]);
+  EXPECT_NE(features[0], features[1]);
+  // "th" and "hé" of "thé thé" are repeated after the space
+  EXPECT_EQ(features[4], features[8]);
+  EXPECT_EQ(features[5], features[9]);
+
+  // a different seed gives different features
+  auto const seeded   = nvtext::hash_ngrams(strings_view, 2, 1 << 20, 17);
+  auto const unseeded = nvtext::hash_ngrams(strings_view, 2, 1 << 20);
+  EXPECT_NE(cudf::test::to_host<int32_t>(cudf::lists_column_view(*seeded).child()).first,
+            cudf::test::to_host<int32_t>(cudf::lists_column_view(*unseeded).child()).first);
+}
+
+TEST_F(HashNgramsTest, TokenNgrams)
+{
+  cudf::test::strings_column_wrapper strings{"a b a b", "b  a", " ", "a", "c-d-c"};
+  cudf::strings_column_view strings_view(strings);
+
+  {
+    auto const results = nvtext::hash_tokens(strings_view, 2, 1000);
+    cudf::lists_column_view lists(*results);
+    auto const offsets = cudf::test::to_host<int32_t>(lists.offsets()).first;
+    EXPECT_EQ(offsets, (std::vector<int32_t>{0, 3, 4, 4, 4, 4}));
+    auto const features = cudf::test::to_host<int32_t>(lists.child()).first;
+    // the bigram features are independent of the separators between the tokens
+    EXPECT_EQ(features[0], features[2]);
+    EXPECT_EQ(features[1], features[3]);
+    EXPECT_NE(features[0], features[1]);
+  }
+  {
+    auto const results = nvtext::hash_tokens(strings_view, 1, 1000, cudf::string_scalar("-"));
+    cudf::lists_column_view lists(*results);
+    auto const offsets = cudf::test::to_host<int32_t>(lists.offsets()).first;
+    EXPECT_EQ(offsets, (std::vector<int32_t>{0, 1, 2, 3, 4, 7}));
+    auto const features = cudf::test::to_host<int32_t>(lists.child()).first;
+    EXPECT_EQ(features[4], features[6]);
+    EXPECT_NE(features[4], features[5]);
+  }
+  {
+    // a single feature maps every ngram to 0
+    auto const results  = nvtext::hash_tokens(strings_view, 1, 1);
+    auto const features = cudf::test::to_host<int32_t>(cudf::lists_column_view(*results).child());
+    EXPECT_EQ(features.first, (std::vector<int32_t>{0, 0, 0, 0, 0, 0, 0, 0}));
+  }
+}
+
+TEST_F(HashNgramsTest, Empty)
+{
+  auto const strings = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  cudf::strings_column_view strings_view(strings->view());
+  EXPECT_EQ(nvtext::hash_ngrams(strings_view)->size(), 0);
+  EXPECT_EQ(nvtext::hash_tokens(strings_view)->size(), 0);
+}
+
+TEST_F(HashNgramsTest, Errors)
+{
+  cudf::test::strings_column_wrapper strings{"abc"};
+  cudf::strings_column_view strings_view(strings);
+  EXPECT_THROW(nvtext::hash_ngrams(strings_view, 0), cudf::logic_error);
+  EXPECT_THROW(nvtext::hash_ngrams(strings_view, 2, 0), cudf::logic_error);
+  EXPECT_THROW(nvtext::hash_tokens(strings_view, 0), cudf::logic_error);
+  EXPECT_THROW(nvtext::hash_tokens(strings_view, 1, 0), cudf::logic_error);
+}
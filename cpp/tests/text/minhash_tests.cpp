@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <nvtext/minhash.hpp>
+
+#include <vector>
+
+struct MinHashTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MinHashTest, Basic)
+{
+  cudf::test::strings_column_wrapper strings{
+    "abcdabcd", "bcdabcda", "dcbadcba", "abc", "abc", "", "thé quick", "thé quick"};
+  cudf::strings_column_view strings_view(strings);
+
+  auto const results = nvtext::minhash(strings_view);
+  EXPECT_EQ(results->type().id(), cudf::type_id::UINT32);
+  EXPECT_EQ(results->size(), 8);
+  EXPECT_EQ(results->null_count(), 0);
+  auto const hashes = cudf::test::to_host<uint32_t>(*results).first;
+  // the first two strings have the same set of ngrams
+  EXPECT_EQ(hashes[0], hashes[1]);
+  EXPECT_NE(hashes[0], hashes[2]);
+  EXPECT_EQ(hashes[3], hashes[4]);
+  EXPECT_NE(hashes[3], hashes[5]);
+  EXPECT_EQ(hashes[6], hashes[7]);
+
+  // a different seed gives different hashes
+  auto const seeded = nvtext::minhash(strings_view, cudf::numeric_scalar<uint32_t>(17));
+  EXPECT_NE(cudf::test::to_host<uint32_t>(*seeded).first[0], hashes[0]);
+}
+
+TEST_F(MinHashTest, Width)
+{
+  cudf::test::strings_column_wrapper strings{"abcdef", "abcdxy", "abc"};
+  cudf::strings_column_view strings_view(strings);
+
+  {
+    // the minhash is the smallest hash of the ngrams, one of which is "ab"
+    cudf::test::strings_column_wrapper ab{"ab"};
+    auto const ab_hash = nvtext::minhash(cudf::strings_column_view(ab));
+    auto const results = nvtext::minhash(strings_view, cudf::numeric_scalar<uint32_t>(0), 2);
+    auto const hashes  = cudf::test::to_host<uint32_t>(*results).first;
+    EXPECT_LE(hashes[0], cudf::test::to_host<uint32_t>(*ab_hash).first[0]);
+    EXPECT_LE(hashes[1], cudf::test::to_host<uint32_t>(*ab_hash).first[0]);
+  }
+  {
+    // a string with fewer characters than the width is a single ngram
+    cudf::test::strings_column_wrapper abc{"abc"};
+    auto const short_string = nvtext::minhash(cudf::strings_column_view(abc),
+                                              cudf::numeric_scalar<uint32_t>(0), 10);
+    auto const results      = nvtext::minhash(strings_view, cudf::numeric_scalar<uint32_t>(0), 3);
+    EXPECT_EQ(cudf::test::to_host<uint32_t>(*results).first[2],
+              cudf::test::to_host<uint32_t>(*short_string).first[0]);
+  }
+}
+
+TEST_F(MinHashTest, MultiSeed)
+{
+  cudf::test::strings_column_wrapper strings{"the quick brown fox", "jumps over", "the lazy dog"};
+  cudf::strings_column_view strings_view(strings);
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({0, 5, 11});
+
+  auto const results = nvtext::minhash(strings_view, seeds);
+  EXPECT_EQ(results->type().id(), cudf::type_id::LIST);
+  EXPECT_EQ(results->size(), 3);
+  cudf::lists_column_view lists(*results);
+  auto const signatures = cudf::test::to_host<uint32_t>(lists.child()).first;
+  ASSERT_EQ(signatures.size(), 9u);
+
+  // each value of a signature is the minhash of the corresponding seed
+  std::vector<uint32_t> const h_seeds{0, 5, 11};
+  for (std::size_t s = 0; s < h_seeds.size(); ++s) {
+    auto const expected =
+      nvtext::minhash(strings_view, cudf::numeric_scalar<uint32_t>(h_seeds[s]));
+    auto const hashes = cudf::test::to_host<uint32_t>(*expected).first;
+    for (std::size_t row = 0; row < 3; ++row) {
+      EXPECT_EQ(signatures[row * h_seeds.size() + s], hashes[row]);
+    }
+  }
+}
+
+TEST_F(MinHashTest, WithNulls)
+{
+  cudf::test::strings_column_wrapper strings({"abcdabcd", "", "bcdabcda", "abcd"},
+                                             {1, 0, 1, 1});
+  cudf::strings_column_view strings_view(strings);
+
+  auto const results = nvtext::minhash(strings_view);
+  EXPECT_EQ(results->null_count(), 1);
+  auto const bitmask = cudf::test::to_host<uint32_t>(*results).second;
+  EXPECT_EQ(bitmask[0] & 0xF, 0xDu);
+
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({1, 2});
+  auto const signatures = nvtext::minhash(strings_view, seeds);
+  EXPECT_EQ(signatures->null_count(), 1);
+  EXPECT_EQ(cudf::lists_column_view(*signatures).child().size(), 8);
+
+  // sliced input
+  auto const sliced  = cudf::slice(strings, {2, 4}).front();
+  auto const partial = nvtext::minhash(cudf::strings_column_view(sliced));
+  EXPECT_EQ(partial->null_count(), 0);
+  EXPECT_EQ(cudf::test::to_host<uint32_t>(*partial).first[0],
+            cudf::test::to_host<uint32_t>(*results).first[2]);
+}
+
+TEST_F(MinHashTest, EmptyTest)
+{
+  auto strings = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  cudf::strings_column_view strings_view(strings->view());
+  auto results = nvtext::minhash(strings_view);
+  EXPECT_EQ(results->size(), 0);
+  cudf::test::fixed_width_column_wrapper<uint32_t> seeds({1, 2});
+  results = nvtext::minhash(strings_view, seeds);
+  EXPECT_EQ(results->size(), 0);
+}
+
+TEST_F(MinHashTest, ErrorsTest)
+{
+  cudf::test::strings_column_wrapper strings{"this string intentionally left blank"};
+  cudf::strings_column_view strings_view(strings);
+  EXPECT_THROW(nvtext::minhash(strings_view, cudf::numeric_scalar<uint32_t>(0), 1),
+               cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<uint32_t> empty_seeds{};
+  EXPECT_THROW(nvtext::minhash(strings_view, empty_seeds), cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<int32_t> seeds({1, 2});
+  EXPECT_THROW(nvtext::minhash(strings_view, seeds), cudf::logic_error);
+}
+
+TEST_F(MinHashTest, LSHBuckets)
+{
+  using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+  LCW signatures{{1, 2, 3, 4}, {1, 2, 5, 6}, {1, 2, 3, 4}, {7, 8, 3, 4}};
+
+  auto const results = nvtext::minhash_lsh_buckets(cudf::lists_column_view(signatures), 2);
+  EXPECT_EQ(results->size(), 4);
+  cudf::lists_column_view lists(*results);
+  auto const buckets = cudf::test::to_host<uint32_t>(lists.child()).first;
+  ASSERT_EQ(buckets.size(), 8u);
+  // rows with the same band values share the bucket of the band
+  EXPECT_EQ(buckets[0], buckets[4]);
+  EXPECT_EQ(buckets[1], buckets[5]);
+  EXPECT_EQ(buckets[0], buckets[2]);
+  EXPECT_NE(buckets[1], buckets[3]);
+  EXPECT_EQ(buckets[1], buckets[7]);
+  EXPECT_NE(buckets[0], buckets[6]);
+
+  // one band per value
+  auto const single = nvtext::minhash_lsh_buckets(cudf::lists_column_view(signatures), 4);
+  EXPECT_EQ(cudf::lists_column_view(*single).child().size(), 16);
+
+  // the buckets of a sliced column are those of its rows
+  auto const sliced         = cudf::slice(signatures, {2, 4}).front();
+  auto const sliced_results = nvtext::minhash_lsh_buckets(cudf::lists_column_view(sliced), 2);
+  auto const sliced_buckets =
+    cudf::test::to_host<uint32_t>(cudf::lists_column_view(*sliced_results).child()).first;
+  ASSERT_EQ(sliced_buckets.size(), 4u);
+  EXPECT_EQ(sliced_buckets[0], buckets[4]);
+  EXPECT_EQ(sliced_buckets[3], buckets[7]);
+}
+
+TEST_F(MinHashTest, LSHErrors)
+{
+  using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+  LCW signatures{{1, 2, 3, 4}, {1, 2, 5, 6}};
+  EXPECT_THROW(nvtext::minhash_lsh_buckets(cudf::lists_column_view(signatures), 3),
+               cudf::logic_error);
+  EXPECT_THROW(nvtext::minhash_lsh_buckets(cudf::lists_column_view(signatures), 0),
+               cudf::logic_error);
+  LCW uneven{{1, 2, 3, 4}, {1, 2}};
+  EXPECT_THROW(nvtext::minhash_lsh_buckets(cudf::lists_column_view(uneven), 2),
+               cudf::logic_error);
+  cudf::test::lists_column_wrapper<int32_t> wrong_type{{1, 2}, {3, 4}};
+  EXPECT_THROW(nvtext::minhash_lsh_buckets(cudf::lists_column_view(wrong_type), 1),
+               cudf::logic_error);
+}
@@ -232,3 +232,89 @@ TEST(TextSubwordTest, LoadVocabFileErrors)
   std::string hash_file = temp_env->get_temp_filepath("nothing.txt");
   EXPECT_THROW(nvtext::load_vocabulary_file(hash_file), cudf::logic_error);
 }
+
+TEST(TextSubwordTest, TokenizerBatches)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  nvtext::subword_tokenizer tokenizer(vocab,
+                                      8,
+                                      6,
+                                      true,  // do_lower_case
+                                      true,  // do_truncate
+                                      MAX_NUM_SENTENCES,
+                                      MAX_NUM_CHARS,
+                                      MAX_ROWS_TENSOR);
+
+  std::vector<const char*> h_strings{"This is a test.", "This is a test. This is a tést."};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_tokens(
+    {2023, 2003, 1037, 3231, 1012, 0, 0, 0, 2023, 2003, 1037, 3231, 1012, 2023, 2003, 1037});
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_attn(
+    {1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_metadata({0, 0, 4, 1, 0, 7});
+
+  // The working memory is reused by successive batches
+  for (int batch = 0; batch < 2; ++batch) {
+    auto result = tokenizer.tokenize(cudf::strings_column_view{strings});
+    EXPECT_EQ(2, result.nrows_tensor);
+    cudf::test::expect_columns_equal(result.tensor_token_ids->view(), expected_tokens);
+    cudf::test::expect_columns_equal(result.tensor_attention_mask->view(), expected_attn);
+    cudf::test::expect_columns_equal(result.tensor_metadata->view(), expected_metadata);
+  }
+
+  // A batch larger than the limits of the tokenizer is rejected
+  std::vector<const char*> h_large(MAX_NUM_SENTENCES + 1, "This is a test.");
+  cudf::test::strings_column_wrapper large(h_large.begin(), h_large.end());
+  EXPECT_THROW(tokenizer.tokenize(cudf::strings_column_view{large}), cudf::logic_error);
+}
+
+TEST(TextSubwordTest, TokenizerBuffers)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  nvtext::subword_tokenizer tokenizer(vocab,
+                                      8,
+                                      6,
+                                      true,  // do_lower_case
+                                      true,  // do_truncate
+                                      MAX_NUM_SENTENCES,
+                                      MAX_NUM_CHARS,
+                                      MAX_ROWS_TENSOR);
+
+  // Buffers for 3 rows, one more than the output
+  std::vector<uint32_t> h_fill(3 * 8, 7);
+  cudf::test::fixed_width_column_wrapper<uint32_t> token_ids(h_fill.begin(), h_fill.end());
+  cudf::test::fixed_width_column_wrapper<uint32_t> attn(h_fill.begin(), h_fill.end());
+  cudf::test::fixed_width_column_wrapper<uint32_t> metadata(h_fill.begin(), h_fill.begin() + 9);
+  nvtext::tokenizer_buffers output{cudf::mutable_column_view{token_ids},
+                                   cudf::mutable_column_view{attn},
+                                   cudf::mutable_column_view{metadata}};
+
+  std::vector<const char*> h_strings{"This is a test.", "This is a test. This is a tést."};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  EXPECT_EQ(2u, tokenizer.tokenize(cudf::strings_column_view{strings}, output));
+
+  // The rows past the output are not modified
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_tokens(
+    {2023, 2003, 1037, 3231, 1012, 0, 0, 0, 2023, 2003, 1037, 3231,
+     1012, 2023, 2003, 1037, 7,    7, 7, 7, 7,    7,    7,    7});
+  cudf::test::expect_columns_equal(token_ids, expected_tokens);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_attn(
+    {1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 7, 7, 7, 7, 7, 7, 7, 7});
+  cudf::test::expect_columns_equal(attn, expected_attn);
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_metadata({0, 0, 4, 1, 0, 7, 7, 7, 7});
+  cudf::test::expect_columns_equal(metadata, expected_metadata);
+
+  // Buffers too small for the output are rejected
+  auto const small = cudf::mutable_column_view{
+    cudf::data_type{cudf::type_id::UINT32}, 8, output.tensor_token_ids.data<uint32_t>()};
+  nvtext::tokenizer_buffers small_output{
+    small, output.tensor_attention_mask, output.tensor_metadata};
+  EXPECT_THROW(tokenizer.tokenize(cudf::strings_column_view{strings}, small_output),
+               cudf::logic_error);
+}
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <nvtext/tokenize.hpp>
@@ -148,3 +149,38 @@ TEST_F(TextTokenizeTest, TokenizeEmptyTest)
   results = nvtext::character_tokenize(cudf::strings_column_view(all_null));
   EXPECT_EQ(results->size(), 0);
 }
+
+TEST_F(TextTokenizeTest, TokenizeWithVocabulary)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"the  fox", "a fox jumped", "", "fox fox", "the fox"}, {1, 1, 1, 1, 0});
+  cudf::test::strings_column_wrapper vocabulary({"fox", "the", "jumped", "the"});
+
+  auto results = nvtext::tokenize_with_vocabulary(cudf::strings_column_view(strings),
+                                                  cudf::strings_column_view(vocabulary));
+  EXPECT_EQ(results->size(), 5);
+  EXPECT_EQ(results->null_count(), 1);
+  cudf::lists_column_view lists(*results);
+  EXPECT_EQ(cudf::test::to_host<int32_t>(lists.offsets()).first,
+            (std::vector<int32_t>{0, 2, 5, 5, 7, 7}));
+  // duplicate vocabulary entries have the ID of their first row
+  EXPECT_EQ(cudf::test::to_host<int32_t>(lists.child()).first,
+            (std::vector<int32_t>{1, 0, -1, 0, 2, 0, 0}));
+
+  cudf::test::strings_column_wrapper delimited({"fox,the", "jumped,,fox", "a cat"});
+  results = nvtext::tokenize_with_vocabulary(cudf::strings_column_view(delimited),
+                                             cudf::strings_column_view(vocabulary),
+                                             cudf::string_scalar(","),
+                                             99);
+  EXPECT_EQ(cudf::test::to_host<int32_t>(cudf::lists_column_view(*results).child()).first,
+            (std::vector<int32_t>{0, 1, 2, 0, 99}));
+}
+
+TEST_F(TextTokenizeTest, TokenizeWithVocabularyErrors)
+{
+  cudf::test::strings_column_wrapper strings({"the fox"});
+  cudf::test::strings_column_wrapper vocabulary({"fox", "the"}, {1, 0});
+  EXPECT_THROW(nvtext::tokenize_with_vocabulary(cudf::strings_column_view(strings),
+                                                cudf::strings_column_view(vocabulary)),
+               cudf::logic_error);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Copyright 2018-2020 BlazingDB, Inc.
+ *     Copyright 2018 Christian Noboa Mardini <christian@blazingdb.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+struct MultiInputTransformTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(MultiInputTransformTest, ExcludeNulls)
+{
+  const char* cuda =
+    R"***(
+__device__ inline void fma_udf(float* out, float a, int32_t b, double c)
+{
+  *out = a * b + c;
+}
+)***";
+
+  cudf::test::fixed_width_column_wrapper<float> a({1, 2, 3, 4}, {1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> b({5, 6, 7, 8});
+  cudf::test::fixed_width_column_wrapper<double> c({0.5, 1.5, 2.5, 3.5}, {1, 0, 1, 1});
+
+  auto const out = cudf::transform(cudf::table_view({a, b, c}),
+                                   cuda,
+                                   cudf::data_type(cudf::type_id::FLOAT32),
+                                   false,
+                                   cudf::null_policy::EXCLUDE);
+
+  cudf::test::fixed_width_column_wrapper<float> expected({5.5, 0, 0, 35.5}, {1, 0, 0, 1});
+  cudf::test::expect_columns_equal(expected, out->view());
+}
+
+TEST_F(MultiInputTransformTest, ExcludeNullsWithoutNulls)
+{
+  const char* cuda =
+    R"***(
+__device__ inline void sub_udf(int64_t* out, int64_t a, int16_t b)
+{
+  *out = a - b;
+}
+)***";
+
+  cudf::test::fixed_width_column_wrapper<int64_t> a({10, 20, 30});
+  cudf::test::fixed_width_column_wrapper<int16_t> b({1, 2, 3});
+
+  auto const out = cudf::transform(
+    cudf::table_view({a, b}), cuda, cudf::data_type(cudf::type_id::INT64), false);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> expected({9, 18, 27});
+  cudf::test::expect_columns_equal(expected, out->view());
+  EXPECT_FALSE(out->nullable());
+}
+
+TEST_F(MultiInputTransformTest, IncludeNulls)
+{
+  // Null inputs count as zero; the output is null only if both inputs are null
+  const char* cuda =
+    R"***(
+__device__ inline void add_udf(int32_t* out, bool* out_valid, int32_t a, bool a_valid,
+                               int32_t b, bool b_valid)
+{
+  *out       = (a_valid ? a : 0) + (b_valid ? b : 0);
+  *out_valid = a_valid || b_valid;
+}
+)***";
+
+  auto iter = thrust::make_counting_iterator<int32_t>(0);
+  auto a_valid =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto b_valid =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 2 != 0; });
+  // Enough rows for several validity words and a partial last word
+  cudf::size_type const size = 100;
+  cudf::test::fixed_width_column_wrapper<int32_t> a(iter, iter + size, a_valid);
+  cudf::test::fixed_width_column_wrapper<int32_t> b(iter, iter + size, b_valid);
+
+  auto const out = cudf::transform(cudf::table_view({a, b}),
+                                   cuda,
+                                   cudf::data_type(cudf::type_id::INT32),
+                                   false,
+                                   cudf::null_policy::INCLUDE);
+
+  auto expected_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 3 != 0 ? i : 0) + (i % 2 != 0 ? i : 0); });
+  auto expected_valid = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i % 3 != 0 || i % 2 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> expected(
+    expected_data, expected_data + size, expected_valid);
+  cudf::test::expect_columns_equal(expected, out->view());
+}
+
+CUDF_TEST_PROGRAM_MAIN()
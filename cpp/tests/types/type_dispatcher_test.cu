@@ -15,6 +15,7 @@
  */
 
 #include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <tests/utilities/base_fixture.hpp>
 #include <tests/utilities/cudf_gtest.hpp>
@@ -84,4 +85,31 @@ TEST_P(IdDispatcherTest, IdToType)
   EXPECT_TRUE(cudf::type_dispatcher(cudf::data_type{t}, verify_dispatched_type{}, t));
 }
 
+namespace {
+// Only compiles if the dispatcher does not instantiate it for durations
+struct not_duration {
+  template <typename T, std::enable_if_t<not cudf::is_duration<T>()>* = nullptr>
+  bool operator()()
+  {
+    return true;
+  }
+};
+}  // namespace
+
+TEST_F(DispatcherTest, ExcludedGroups)
+{
+  static_assert(cudf::is_dispatched(cudf::type_id::INT8, ~uint32_t{0}), "INT8 is excluded");
+  static_assert(not cudf::is_dispatched(cudf::type_id::DURATION_DAYS, cudf::DISPATCH_DURATIONS),
+                "DURATION_DAYS is dispatched");
+
+  auto dispatch = [](cudf::type_id id) {
+    return cudf::type_dispatcher<cudf::id_to_type_impl, cudf::DISPATCH_DURATIONS>(
+      cudf::data_type{id}, not_duration{});
+  };
+  EXPECT_TRUE(dispatch(cudf::type_id::INT32));
+  EXPECT_TRUE(dispatch(cudf::type_id::TIMESTAMP_DAYS));
+  EXPECT_THROW(dispatch(cudf::type_id::DURATION_DAYS), cudf::logic_error);
+  EXPECT_THROW(dispatch(cudf::type_id::DURATION_NANOSECONDS), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
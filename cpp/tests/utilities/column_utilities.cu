@@ -21,6 +21,7 @@
 #include <cudf/detail/copy.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/lists/lists_column_view.hpp>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/strings/convert/convert_datetime.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
@@ -58,12 +59,18 @@ struct column_property_comparator {
     //   correct way to do this would be to implement a specialization for strings (and
     //   dictionaries, lists, etc) that explicitly understand this structure.  but for now, this
     //   seems to be ok.
+    //
+    // - the children of a struct column are full length, so they are compared sliced to the
+    //   rows of the parent.
     if (cudf::is_nested<T>()) {
+      bool const is_struct = std::is_same<T, cudf::struct_view>::value;
       for (size_type idx = 0; idx < lhs.num_children(); idx++) {
-        cudf::type_dispatcher(lhs.child(idx).type(),
+        auto const lhs_child = is_struct ? structs_column_view(lhs).child(idx) : lhs.child(idx);
+        auto const rhs_child = is_struct ? structs_column_view(rhs).child(idx) : rhs.child(idx);
+        cudf::type_dispatcher(lhs_child.type(),
                               column_property_comparator<check_exact_equality>{},
-                              lhs.child(idx),
-                              rhs.child(idx));
+                              lhs_child,
+                              rhs_child);
       }
     }
   }
@@ -260,6 +267,32 @@ struct column_comparator_impl<list_view, check_exact_equality> {
   }
 };
 
+// specialization for struct columns
+template <bool check_exact_equality>
+struct column_comparator_impl<struct_view, check_exact_equality> {
+  void operator()(column_view const& lhs,
+                  column_view const& rhs,
+                  bool print_all_differences,
+                  int depth)
+  {
+    structs_column_view lhs_s(lhs);
+    structs_column_view rhs_s(rhs);
+
+    CUDF_EXPECTS(lhs_s.size() == rhs_s.size(), "Struct column size mismatch");
+    CUDF_EXPECTS(lhs_s.num_children() == rhs_s.num_children(), "Struct field count mismatch");
+
+    // the children are compared field by field, each sliced to the rows of the parent
+    for (size_type idx = 0; idx < lhs_s.num_children(); idx++) {
+      cudf::type_dispatcher(lhs_s.child(idx).type(),
+                            column_comparator<check_exact_equality>{},
+                            lhs_s.child(idx),
+                            rhs_s.child(idx),
+                            print_all_differences,
+                            depth + 1);
+    }
+  }
+};
+
 template <bool check_exact_equality>
 struct column_comparator {
   template <typename T>
@@ -395,6 +428,15 @@ std::string get_nested_type_str(cudf::column_view const& view)
     return cudf::jit::get_type_name(view.type()) + "<" +
            (lcv.size() > 0 ? get_nested_type_str(lcv.child()) : "") + ">";
   }
+  if (view.type().id() == cudf::type_id::STRUCT) {
+    structs_column_view scv(view);
+    std::string fields;
+    for (size_type idx = 0; idx < scv.num_children(); idx++) {
+      if (idx > 0) { fields += ", "; }
+      fields += get_nested_type_str(scv.child(idx));
+    }
+    return cudf::jit::get_type_name(view.type()) + "<" + fields + ">";
+  }
   return cudf::jit::get_type_name(view.type());
 }
 
@@ -536,6 +578,27 @@ struct column_view_printer {
 
     out.push_back(tmp);
   }
+
+  template <typename Element,
+            typename std::enable_if_t<std::is_same<Element, cudf::struct_view>::value>* = nullptr>
+  void operator()(cudf::column_view const& col,
+                  std::vector<std::string>& out,
+                  std::string const& indent)
+  {
+    structs_column_view scv(col);
+
+    std::string tmp =
+      get_nested_type_str(col) + ":\n" + indent + "Length : " + std::to_string(scv.size()) + "\n" +
+      (scv.has_nulls() ? indent + "Null count: " + std::to_string(scv.null_count()) + "\n" +
+                           detail::to_string(bitmask_to_host(col), col.size(), indent) + "\n"
+                       : "") +
+      indent + "Children :\n";
+    for (size_type idx = 0; idx < scv.num_children(); idx++) {
+      tmp += detail::to_string(scv.child(idx), ", ", indent + "   ") + "\n";
+    }
+
+    out.push_back(tmp);
+  }
 };
 
 }  // namespace
@@ -428,6 +428,100 @@ class fixed_width_column_wrapper : public detail::column_wrapper {
   }
 };
 
+/**
+ * @brief `column_wrapper` derived class for wrapping columns of fixed-point elements.
+ *
+ * The elements are given as their stored integers, all with the scale of the column:
+ * an element `v` represents the value `v * 10^scale`.
+ *
+ * Example:
+ * @code{.cpp}
+ * // Creates a DECIMAL32 column with 3 elements: {1.01, 2.00, -0.03}
+ * fixed_point_column_wrapper<int32_t> w({101, 200, -3}, numeric::scale_type{-2});
+ * @endcode
+ *
+ * @tparam Rep The representation type, `int32_t` for DECIMAL32 or `int64_t` for DECIMAL64
+ **/
+template <typename Rep>
+class fixed_point_column_wrapper : public detail::column_wrapper {
+ public:
+  /**
+   * @brief Construct a non-nullable column of the stored integers in the range `[begin,end)`.
+   *
+   * @param begin The beginning of the sequence of stored integers
+   * @param end The end of the sequence of stored integers
+   * @param scale The scale of the elements
+   **/
+  template <typename InputIterator>
+  fixed_point_column_wrapper(InputIterator begin, InputIterator end, numeric::scale_type scale)
+    : column_wrapper{}
+  {
+    cudf::size_type size = std::distance(begin, end);
+    wrapped.reset(new cudf::column{fixed_point_type(scale),
+                                   size,
+                                   detail::make_elements<Rep, Rep>(begin, end)});
+  }
+
+  /**
+   * @brief Construct a nullable column of the stored integers in the range `[begin,end)`, using
+   * the range `[v, v + distance(begin,end))` interpreted as booleans to indicate the validity of
+   * each element.
+   *
+   * @param begin The beginning of the sequence of stored integers
+   * @param end The end of the sequence of stored integers
+   * @param v The beginning of the sequence of validity indicators
+   * @param scale The scale of the elements
+   **/
+  template <typename InputIterator, typename ValidityIterator>
+  fixed_point_column_wrapper(InputIterator begin,
+                             InputIterator end,
+                             ValidityIterator v,
+                             numeric::scale_type scale)
+    : column_wrapper{}
+  {
+    cudf::size_type size = std::distance(begin, end);
+    wrapped.reset(new cudf::column{fixed_point_type(scale),
+                                   size,
+                                   detail::make_elements<Rep, Rep>(begin, end),
+                                   detail::make_null_mask(v, v + size),
+                                   cudf::UNKNOWN_NULL_COUNT});
+  }
+
+  /**
+   * @brief Construct a non-nullable column of stored integers from an initializer list.
+   *
+   * @param values The list of stored integers
+   * @param scale The scale of the elements
+   **/
+  fixed_point_column_wrapper(std::initializer_list<Rep> values, numeric::scale_type scale)
+    : fixed_point_column_wrapper(std::cbegin(values), std::cend(values), scale)
+  {
+  }
+
+  /**
+   * @brief Construct a nullable column of stored integers from an initializer list, using the
+   * list of booleans to indicate the validity of each element.
+   *
+   * @param values The list of stored integers
+   * @param validity The list of validity indicator booleans
+   * @param scale The scale of the elements
+   **/
+  fixed_point_column_wrapper(std::initializer_list<Rep> values,
+                             std::initializer_list<bool> validity,
+                             numeric::scale_type scale)
+    : fixed_point_column_wrapper(
+        std::cbegin(values), std::cend(values), std::cbegin(validity), scale)
+  {
+  }
+
+ private:
+  static cudf::data_type fixed_point_type(numeric::scale_type scale)
+  {
+    auto const id = std::is_same<Rep, int32_t>::value ? type_id::DECIMAL32 : type_id::DECIMAL64;
+    return cudf::data_type{id, static_cast<int32_t>(scale)};
+  }
+};
+
 /**
  * @brief `column_wrapper` derived class for wrapping columns of strings.
  **/
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/copy_range.cuh>
+#include <cudf/utilities/cuda_graph.hpp>
+#include <cudf/utilities/error.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <vector>
+
+struct CudaGraphTest : public cudf::test::BaseFixture {
+  CudaGraphTest() { CUDA_TRY(cudaStreamCreate(&stream)); }
+  ~CudaGraphTest() { cudaStreamDestroy(stream); }
+
+  cudaStream_t stream{};
+};
+
+TEST_F(CudaGraphTest, LaunchReadsCurrentData)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> source({1, 2, 3, 4});
+  cudf::test::fixed_width_column_wrapper<int32_t> target({0, 0, 0, 0, 0, 0});
+  cudf::column_view source_view         = source;
+  cudf::mutable_column_view target_view = target;
+
+  cudf::captured_graph graph(stream, [&](cudaStream_t s) {
+    cudf::detail::copy_range_in_place(source_view, target_view, 0, 4, 1, s);
+  });
+  // Nothing runs until the graph is launched
+  cudf::test::expect_columns_equal(
+    target_view, cudf::test::fixed_width_column_wrapper<int32_t>({0, 0, 0, 0, 0, 0}));
+
+  graph.launch(stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  cudf::test::expect_columns_equal(
+    target_view, cudf::test::fixed_width_column_wrapper<int32_t>({0, 1, 2, 3, 4, 0}));
+
+  // Each launch reads the buffers as they are when it runs
+  std::vector<int32_t> new_values{5, 6, 7, 8};
+  CUDA_TRY(cudaMemcpy(source_view.head<int32_t>(),
+                      new_values.data(),
+                      new_values.size() * sizeof(int32_t),
+                      cudaMemcpyHostToDevice));
+  graph.launch(stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  cudf::test::expect_columns_equal(
+    target_view, cudf::test::fixed_width_column_wrapper<int32_t>({0, 5, 6, 7, 8, 0}));
+}
+
+TEST_F(CudaGraphTest, Update)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> source({1, 2, 3, 4});
+  cudf::test::fixed_width_column_wrapper<int32_t> target({0, 0, 0, 0});
+  cudf::column_view source_view         = source;
+  cudf::mutable_column_view target_view = target;
+
+  cudf::captured_graph graph(stream, [&](cudaStream_t s) {
+    cudf::detail::copy_range_in_place(source_view, target_view, 0, 2, 0, s);
+  });
+  graph.update(stream, [&](cudaStream_t s) {
+    cudf::detail::copy_range_in_place(source_view, target_view, 2, 4, 2, s);
+  });
+  graph.launch(stream);
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  cudf::test::expect_columns_equal(target_view,
+                                   cudf::test::fixed_width_column_wrapper<int32_t>({0, 0, 3, 4}));
+}
+
+TEST_F(CudaGraphTest, Errors)
+{
+  EXPECT_THROW(cudf::captured_graph(0, [](cudaStream_t) {}), cudf::logic_error);
+
+  // An exception thrown during the capture ends it, leaving the stream usable
+  cudf::test::fixed_width_column_wrapper<int32_t> source({1, 2});
+  cudf::test::fixed_width_column_wrapper<int32_t> target({0});
+  cudf::column_view source_view         = source;
+  cudf::mutable_column_view target_view = target;
+  EXPECT_THROW(cudf::captured_graph(stream,
+                                    [&](cudaStream_t s) {
+                                      cudf::detail::copy_range_in_place(
+                                        source_view, target_view, 0, 2, 0, s);
+                                    }),
+               cudf::logic_error);
+  cudaStreamCaptureStatus status{};
+  CUDA_TRY(cudaStreamIsCapturing(stream, &status));
+  EXPECT_EQ(status, cudaStreamCaptureStatusNone);
+}
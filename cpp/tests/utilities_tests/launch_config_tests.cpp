@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/launch_config.hpp>
+#include <cudf/io/functions.hpp>
+#include <cudf/utilities/error.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <fstream>
+#include <string>
+
+struct LaunchConfigTest : public cudf::test::BaseFixture {
+  int current_arch()
+  {
+    int device = 0;
+    CUDA_TRY(cudaGetDevice(&device));
+    int major = 0;
+    int minor = 0;
+    CUDA_TRY(cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor, device));
+    CUDA_TRY(cudaDeviceGetAttribute(&minor, cudaDevAttrComputeCapabilityMinor, device));
+    return major * 10 + minor;
+  }
+
+  cudf::test::temp_directory const tmpdir{"launch_config"};
+};
+
+TEST_F(LaunchConfigTest, BlockSizes)
+{
+  cudf::detail::tunable_kernel const kernel{"launch_config_test_kernel", 128, {64, 128, 256}};
+  EXPECT_EQ(cudf::detail::launch_block_size(kernel), 128);
+
+  cudf::detail::set_launch_block_size(kernel.name, 256);
+  EXPECT_EQ(cudf::detail::launch_block_size(kernel), 256);
+  {
+    cudf::detail::tuned_launch launch(kernel, 1000, 0);
+    EXPECT_EQ(launch.block_size(), 256);
+  }
+
+  // Block sizes that are not candidates of the kernel are ignored
+  cudf::detail::set_launch_block_size(kernel.name, 1024);
+  EXPECT_EQ(cudf::detail::launch_block_size(kernel), 128);
+}
+
+TEST_F(LaunchConfigTest, LoadFile)
+{
+  cudf::detail::tunable_kernel const kernel{"launch_config_file_kernel", 128, {64, 128, 256}};
+  auto const path = tmpdir.path() + "launch.cfg";
+  {
+    std::ofstream file(path);
+    file << "# comment\n\n";
+    file << (current_arch() == 10 ? 11 : 10) << " launch_config_file_kernel 256\n";
+    file << current_arch() << " launch_config_file_kernel 64  # trailing comment\n";
+  }
+  cudf::detail::load_launch_configs(path);
+  EXPECT_EQ(cudf::detail::launch_block_size(kernel), 64);
+
+  {
+    std::ofstream file(path);
+    file << current_arch() << " launch_config_file_kernel\n";
+  }
+  EXPECT_THROW(cudf::detail::load_launch_configs(path), cudf::logic_error);
+  EXPECT_THROW(cudf::detail::load_launch_configs(tmpdir.path() + "missing.cfg"),
+               cudf::logic_error);
+}
+
+TEST_F(LaunchConfigTest, TunedCsvKernels)
+{
+  std::string csv;
+  for (int i = 0; i < 1000; ++i) {
+    csv += std::to_string(i) + "," + std::to_string(i * 0.5) + "\n";
+  }
+  cudf::io::read_csv_args args{cudf::io::source_info{csv.data(), csv.size()}};
+  args.header = -1;
+  auto const expected = cudf::io::read_csv(args);
+
+  // Every candidate block size of the kernels gives the same result
+  for (auto block_size : {64, 128, 256}) {
+    cudf::detail::set_launch_block_size("csv_data_type_detection", block_size);
+    cudf::detail::set_launch_block_size("csv_convert_csv_to_cudf", block_size);
+    auto const result = cudf::io::read_csv(args);
+    cudf::test::expect_columns_equal(result.tbl->get_column(0), expected.tbl->get_column(0));
+    cudf::test::expect_columns_equal(result.tbl->get_column(1), expected.tbl->get_column(1));
+  }
+  cudf::detail::set_launch_block_size("csv_data_type_detection", 128);
+  cudf::detail::set_launch_block_size("csv_convert_csv_to_cudf", 128);
+}
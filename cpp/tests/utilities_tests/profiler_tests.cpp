@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/profiler.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <algorithm>
+
+struct ProfilerTest : public cudf::test::BaseFixture {
+  void SetUp() override
+  {
+    cudf::reset_profiles();
+    cudf::enable_profiler();
+  }
+  void TearDown() override
+  {
+    cudf::disable_profiler();
+    cudf::reset_profiles();
+  }
+};
+
+TEST_F(ProfilerTest, Gather)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> source({1, 2, 3, 4, 5});
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({4, 3, 2, 1, 0, 0});
+  cudf::table_view source_table({source});
+
+  for (int i = 0; i < 3; ++i) { cudf::gather(source_table, gather_map); }
+
+  auto const profiles = cudf::get_profiles();
+  auto const gather   = std::find_if(
+    profiles.begin(), profiles.end(), [](auto const& p) { return p.name == "gather"; });
+  ASSERT_NE(gather, profiles.end());
+  EXPECT_EQ(gather->calls, 3);
+  // Each call allocates at least its output column
+  EXPECT_GE(gather->bytes_allocated, 3 * 6 * static_cast<int64_t>(sizeof(int64_t)));
+  EXPECT_GE(gather->peak_bytes, 6 * static_cast<int64_t>(sizeof(int64_t)));
+  EXPECT_GE(gather->gpu_time_ms, 0);
+
+  EXPECT_NE(cudf::profiles_to_json().find("{\"name\":\"gather\",\"calls\":3,"), std::string::npos);
+  auto const metrics = cudf::profiles_to_prometheus();
+  EXPECT_NE(metrics.find("cudf_operation_calls_total{operation=\"gather\"} 3\n"),
+            std::string::npos);
+}
+
+TEST_F(ProfilerTest, Disabled)
+{
+  cudf::disable_profiler();
+  EXPECT_FALSE(cudf::is_profiler_enabled());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> source({0, 1, 2});
+  cudf::gather(cudf::table_view({source}), source);
+
+  EXPECT_TRUE(cudf::get_profiles().empty());
+  EXPECT_EQ(cudf::profiles_to_json(), "{\"operations\":[]}");
+}
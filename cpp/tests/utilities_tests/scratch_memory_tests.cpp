@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/io/functions.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/scratch_memory.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <new>
+#include <string>
+
+/**
+ * @brief Resource counting the bytes allocated from and outstanding in its upstream
+ */
+class counting_resource final : public rmm::mr::device_memory_resource {
+ public:
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+  std::size_t allocated   = 0;
+  std::size_t outstanding = 0;
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override
+  {
+    allocated += bytes;
+    outstanding += bytes;
+    return _upstream->allocate(bytes, stream);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override
+  {
+    outstanding -= bytes;
+    _upstream->deallocate(p, bytes, stream);
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t) const override
+  {
+    return {0, 0};
+  }
+
+  rmm::mr::device_memory_resource* const _upstream = rmm::mr::get_default_resource();
+};
+
+struct ScratchMemoryTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ScratchMemoryTest, NestedScopes)
+{
+  auto const default_mr = rmm::mr::get_default_resource();
+  EXPECT_EQ(cudf::get_scratch_resource(), default_mr);
+  counting_resource outer_mr, inner_mr;
+  {
+    cudf::scratch_resource_scope outer{&outer_mr};
+    EXPECT_EQ(cudf::get_scratch_resource(), &outer_mr);
+    {
+      cudf::scratch_resource_scope inner{&inner_mr};
+      EXPECT_EQ(cudf::get_scratch_resource(), &inner_mr);
+    }
+    EXPECT_EQ(cudf::get_scratch_resource(), &outer_mr);
+  }
+  EXPECT_EQ(cudf::get_scratch_resource(), default_mr);
+  EXPECT_THROW(cudf::scratch_resource_scope{nullptr}, cudf::logic_error);
+}
+
+TEST_F(ScratchMemoryTest, JoinTemporaries)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> left({0, 1, 2, 3, 4, 5, 6, 7});
+  cudf::test::fixed_width_column_wrapper<int32_t> right({6, 4, 2, 0, 9});
+  cudf::table_view left_table({left});
+  cudf::table_view right_table({right});
+
+  counting_resource scratch_mr, result_mr;
+  std::unique_ptr<cudf::table> result;
+  {
+    cudf::scratch_resource_scope scratch{&scratch_mr};
+    result = cudf::full_join(
+      left_table, right_table, {0}, {0}, {{0, 0}}, cudf::null_equality::EQUAL, &result_mr);
+  }
+  EXPECT_EQ(result->num_rows(), 9);
+  // The join indices are allocated from the scratch resource and freed before returning
+  EXPECT_GT(scratch_mr.allocated, 0u);
+  EXPECT_EQ(scratch_mr.outstanding, 0u);
+  EXPECT_GT(result_mr.outstanding, 0u);
+}
+
+TEST_F(ScratchMemoryTest, FixedBufferResource)
+{
+  rmm::device_buffer buffer(4096);
+  cudf::fixed_buffer_resource mr{buffer.data(), buffer.size()};
+
+  // Allocations are carved out in order, 256-byte aligned
+  auto const first  = static_cast<char*>(mr.allocate(100));
+  auto const second = static_cast<char*>(mr.allocate(1000));
+  EXPECT_EQ(first, buffer.data());
+  EXPECT_EQ(second, first + 256);
+  EXPECT_EQ(mr.used_bytes(), 1280u);
+  EXPECT_THROW(mr.allocate(4096), std::bad_alloc);
+
+  // Freeing the last allocation returns its space; freeing all rewinds the buffer
+  mr.deallocate(second, 1000);
+  EXPECT_EQ(mr.used_bytes(), 256u);
+  EXPECT_EQ(mr.allocate(2000), second);
+  mr.deallocate(first, 100);
+  EXPECT_EQ(mr.used_bytes(), 2304u);
+  mr.deallocate(second, 2000);
+  EXPECT_EQ(mr.used_bytes(), 0u);
+}
+
+TEST_F(ScratchMemoryTest, ReadIntoFixedBuffer)
+{
+  std::string const csv = "1,10\n2,20\n3,30\n";
+  cudf::io::read_csv_args args{cudf::io::source_info{csv.data(), csv.size()}};
+  args.dtype  = {"int32", "int32"};
+  args.header = -1;
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_a({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_b({10, 20, 30});
+
+  rmm::device_buffer slot(64 * 1024);
+  cudf::fixed_buffer_resource slot_mr{slot.data(), slot.size()};
+  counting_resource scratch_mr;
+  // Identical reads reuse the same slot memory once the previous result is released
+  for (int i = 0; i < 2; ++i) {
+    cudf::scratch_resource_scope scratch{&scratch_mr};
+    auto const result = cudf::io::read_csv(args, &slot_mr);
+    cudf::test::expect_columns_equal(result.tbl->get_column(0), expected_a);
+    cudf::test::expect_columns_equal(result.tbl->get_column(1), expected_b);
+    auto const data = result.tbl->get_column(0).view().data<char>();
+    EXPECT_TRUE(data >= slot.data() && data < static_cast<char*>(slot.data()) + slot.size());
+    EXPECT_GT(slot_mr.used_bytes(), 0u);
+    EXPECT_EQ(scratch_mr.outstanding, 0u);
+  }
+  EXPECT_EQ(slot_mr.used_bytes(), 0u);
+  EXPECT_GT(scratch_mr.allocated, 0u);
+}
+
+TEST_F(ScratchMemoryTest, SmallObjectResource)
+{
+  cudaStream_t stream;
+  ASSERT_EQ(cudaStreamCreate(&stream), cudaSuccess);
+  counting_resource upstream;
+  {
+    cudf::small_object_resource mr{&upstream, 8192};
+
+    // Small allocations are carved out of a slab in size classes
+    auto const first  = static_cast<char*>(mr.allocate(4));
+    auto const second = static_cast<char*>(mr.allocate(300));
+    EXPECT_EQ(second, first + 256);
+    EXPECT_EQ(mr.slab_bytes(), 8192u);
+    EXPECT_EQ(upstream.allocated, 8192u);
+
+    // A freed block is reused by the next allocation of its size class on the same stream only
+    mr.deallocate(first, 4);
+    EXPECT_EQ(mr.allocate(200), first);
+    mr.deallocate(second, 300);
+    auto const other = mr.allocate(300, stream);
+    EXPECT_NE(other, second);
+    EXPECT_EQ(mr.slab_bytes(), 16384u);
+    mr.deallocate(other, 300, stream);
+
+    // Large allocations are forwarded to the upstream
+    auto const large = mr.allocate(5000);
+    EXPECT_EQ(upstream.outstanding, 16384u + 5000u);
+    mr.deallocate(large, 5000);
+    EXPECT_EQ(upstream.outstanding, 16384u);
+    mr.deallocate(first, 200);
+  }
+  EXPECT_EQ(upstream.outstanding, 0u);
+  EXPECT_THROW(cudf::small_object_resource(&upstream, 1024), cudf::logic_error);
+  ASSERT_EQ(cudaStreamSynchronize(stream), cudaSuccess);
+  ASSERT_EQ(cudaStreamDestroy(stream), cudaSuccess);
+}
+
+TEST_F(ScratchMemoryTest, SmallObjects)
+{
+  counting_resource upstream;
+  {
+    cudf::small_object_resource mr{&upstream};
+    cudf::test::strings_column_wrapper strings({"a", "bc", "def"});
+
+    // The scalars and the storage of device views are small allocations
+    for (int i = 0; i < 10; ++i) {
+      cudf::numeric_scalar<int32_t> scalar(i, true, 0, &mr);
+      EXPECT_EQ(scalar.value(), i);
+      cudf::scratch_resource_scope scratch{&mr};
+      auto const d_strings = cudf::column_device_view::create(strings);
+    }
+    EXPECT_EQ(upstream.allocated, mr.slab_bytes());
+    EXPECT_EQ(mr.slab_bytes(), std::size_t{1} << 20);
+  }
+  EXPECT_EQ(upstream.outstanding, 0u);
+}
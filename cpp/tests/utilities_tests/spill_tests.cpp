@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/spill.hpp>
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/table_utilities.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <new>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+/**
+ * @brief Resource failing the allocations beyond a capacity, like a nearly full device
+ */
+class limited_resource final : public rmm::mr::device_memory_resource {
+ public:
+  limited_resource(rmm::mr::device_memory_resource* upstream, std::size_t capacity)
+    : _upstream{upstream}, _capacity{capacity}
+  {
+  }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  void* do_allocate(std::size_t bytes, cudaStream_t stream) override
+  {
+    if (_allocated + bytes > _capacity) { throw std::bad_alloc{}; }
+    _allocated += bytes;
+    return _upstream->allocate(bytes, stream);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, cudaStream_t stream) override
+  {
+    _allocated -= bytes;
+    _upstream->deallocate(p, bytes, stream);
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(cudaStream_t stream) const override
+  {
+    return std::make_pair(0, 0);
+  }
+
+  rmm::mr::device_memory_resource* const _upstream;
+  std::size_t const _capacity;
+  std::size_t _allocated = 0;
+};
+
+struct SpillTest : public cudf::test::BaseFixture {
+  fixed_width_column_wrapper<int32_t> ints{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 0}};
+  strings_column_wrapper strings{{"a", "bb", "", "dddd", "e"}, {1, 1, 1, 0, 1}};
+  cudf::table_view input{{ints, strings}};
+};
+
+TEST_F(SpillTest, DeviceLimitEvictsLeastRecentlyUsed)
+{
+  auto const size = cudf::pack(input).gpu_data->size();
+  cudf::spill_manager manager(size);
+  cudf::spillable_table first(input, manager);
+  cudf::spillable_table second(input, manager);
+  EXPECT_TRUE(first.is_spilled());
+  EXPECT_FALSE(second.is_spilled());
+  EXPECT_EQ(manager.device_bytes(), size);
+  EXPECT_EQ(manager.spilled_bytes(), size);
+
+  {
+    auto const lock = first.acquire();
+    EXPECT_TRUE(second.is_spilled());
+    cudf::test::expect_tables_equal(input, lock.view());
+  }
+  auto const lock = second.acquire();
+  EXPECT_TRUE(first.is_spilled());
+  cudf::test::expect_tables_equal(input, lock.view());
+}
+
+TEST_F(SpillTest, LockedTablesStayResident)
+{
+  cudf::spill_manager manager;
+  cudf::spillable_table table(input, manager);
+  {
+    auto const lock = table.acquire();
+    EXPECT_EQ(manager.spill(table.size()), 0u);
+    EXPECT_FALSE(table.is_spilled());
+  }
+  EXPECT_EQ(manager.spill(table.size()), table.size());
+  EXPECT_TRUE(table.is_spilled());
+}
+
+TEST_F(SpillTest, SpillToDisk)
+{
+  cudf::test::temp_directory const tmpdir{"spill"};
+  cudf::spill_manager manager(std::numeric_limits<std::size_t>::max(), tmpdir.path());
+  cudf::spillable_table table(input, manager);
+  manager.spill(table.size());
+  EXPECT_TRUE(table.is_spilled());
+  EXPECT_EQ(manager.device_bytes(), 0u);
+  auto const lock = table.acquire();
+  cudf::test::expect_tables_equal(input, lock.view());
+}
+
+TEST_F(SpillTest, SpillOnFailedAllocation)
+{
+  auto const size = cudf::pack(input).gpu_data->size();
+  limited_resource limited(rmm::mr::get_default_resource(), 2 * size);
+  cudf::spill_manager manager;
+  cudf::spill_on_demand_resource spilling(&limited, manager);
+
+  cudf::spillable_table first(input, manager, &spilling);
+  cudf::spillable_table second(input, manager, &spilling);
+  // Only one of the tables fits with the new buffer; the least recently used is evicted
+  rmm::device_buffer buffer(size, 0, &spilling);
+  EXPECT_TRUE(first.is_spilled());
+  EXPECT_FALSE(second.is_spilled());
+  EXPECT_THROW(rmm::device_buffer(3 * size, 0, &spilling), std::bad_alloc);
+}
@@ -416,6 +416,25 @@ public class Cuda {
   private static native void asyncMemcpyOnStream(long dst, long src, long count, int kind,
                                                  long stream) throws CudaException;
 
+  /**
+   * Queues copies of several buffers on the specified CUDA stream in a single native call.
+   * The copies have not necessarily completed when this returns; record an event on the stream
+   * to find out when they have.
+   * Specifying pointers that do not match the copy direction results in undefined behavior.
+   * @param dsts destination memory address of each copy
+   * @param srcs source memory address of each copy
+   * @param counts size in bytes of each copy; copies of 0 bytes are skipped
+   * @param kind direction of all the transfers. {@link CudaMemcpyKind}
+   * @param stream CUDA stream to use for the copies
+   */
+  static void asyncMemcpyBatch(long[] dsts, long[] srcs, long[] counts, CudaMemcpyKind kind,
+                               Stream stream) {
+    asyncMemcpyBatchOnStream(dsts, srcs, counts, kind.getValue(), stream.getStream());
+  }
+
+  private static native void asyncMemcpyBatchOnStream(long[] dsts, long[] srcs, long[] counts,
+                                                      int kind, long stream) throws CudaException;
+
   /**
    * This should only be used for tests, to enable or disable tests if the current environment
    * is not compatible with this version of the library.  Currently it only does some very
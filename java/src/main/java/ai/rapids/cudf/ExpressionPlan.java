@@ -0,0 +1,163 @@
+/*
+ *
+ *  Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.Arrays;
+
+/**
+ * A batch of expressions over the columns of a table, serialized so that
+ * {@link Table#evaluate(ExpressionPlan)} can evaluate all of them with a single native call.
+ * Each expression is evaluated by a single kernel without materializing intermediate columns.
+ *
+ * <p>Expressions are written in postfix order: column references and literals push a value,
+ * operators replace their operands with their result, and {@link #output()} pops the value on
+ * top as the next output column. For example, the outputs {@code a + 1} and {@code a < b} are:
+ * <code>
+ *   new ExpressionPlan().column(0).literal(1L).op(Op.ADD).output()
+ *                       .column(0).column(1).op(Op.LESS).output();
+ * </code>
+ */
+public final class ExpressionPlan {
+  /**
+   * Operators of an expression. These numbers come from cudf::ast::ast_operator and must stay in
+   * sync.
+   */
+  public enum Op {
+    ADD(0),
+    SUB(1),
+    MUL(2),
+    DIV(3),
+    TRUE_DIV(4),
+    MOD(5),
+    EQUAL(6),
+    NOT_EQUAL(7),
+    LESS(8),
+    GREATER(9),
+    LESS_EQUAL(10),
+    GREATER_EQUAL(11),
+    LOGICAL_AND(12),
+    LOGICAL_OR(13),
+    NOT(14),
+    NEGATE(15),
+    ABS(16),
+    IS_NULL(17);
+
+    final int nativeId;
+
+    Op(int nativeId) {this.nativeId = nativeId;}
+  }
+
+  // Instructions of the plan. These numbers must stay in sync with the native plan decoder
+  private static final int COLUMN = 0;
+  private static final int LITERAL = 1;
+  private static final int OPERATOR = 2;
+  private static final int OUTPUT = 3;
+
+  private ByteBuffer buffer = ByteBuffer.allocate(256).order(ByteOrder.nativeOrder());
+  private int numOutputs = 0;
+
+  /**
+   * Push a reference to a column of the table.
+   * @param index index of the column
+   */
+  public ExpressionPlan column(int index) {
+    reserve(8);
+    buffer.putInt(COLUMN).putInt(index);
+    return this;
+  }
+
+  /**
+   * Push an INT64 literal.
+   */
+  public ExpressionPlan literal(long value) {
+    return literal(DType.INT64, value, true);
+  }
+
+  /**
+   * Push a FLOAT64 literal.
+   */
+  public ExpressionPlan literal(double value) {
+    return literal(DType.FLOAT64, Double.doubleToRawLongBits(value), true);
+  }
+
+  /**
+   * Push a BOOL8 literal.
+   */
+  public ExpressionPlan literal(boolean value) {
+    return literal(DType.BOOL8, value ? 1 : 0, true);
+  }
+
+  /**
+   * Push a null literal.
+   * @param type INT64, FLOAT64 or BOOL8
+   */
+  public ExpressionPlan nullLiteral(DType type) {
+    return literal(type, 0, false);
+  }
+
+  /**
+   * Apply an operator to the one or two values on top.
+   */
+  public ExpressionPlan op(Op op) {
+    reserve(8);
+    buffer.putInt(OPERATOR).putInt(op.nativeId);
+    return this;
+  }
+
+  /**
+   * Pop the value on top as the next output column.
+   */
+  public ExpressionPlan output() {
+    reserve(4);
+    buffer.putInt(OUTPUT);
+    numOutputs++;
+    return this;
+  }
+
+  /**
+   * Get the number of output columns of the plan.
+   */
+  public int getNumOutputs() {
+    return numOutputs;
+  }
+
+  byte[] serialize() {
+    return Arrays.copyOf(buffer.array(), buffer.position());
+  }
+
+  private ExpressionPlan literal(DType type, long bits, boolean isValid) {
+    assert type == DType.INT64 || type == DType.FLOAT64 || type == DType.BOOL8 :
+        "Unsupported literal type " + type;
+    reserve(20);
+    buffer.putInt(LITERAL).putInt(type.nativeId).putInt(isValid ? 1 : 0).putLong(bits);
+    return this;
+  }
+
+  private void reserve(int bytes) {
+    if (buffer.remaining() < bytes) {
+      int capacity = Math.max(buffer.capacity() * 2, buffer.position() + bytes);
+      ByteBuffer grown = ByteBuffer.allocate(capacity).order(ByteOrder.nativeOrder());
+      buffer.flip();
+      grown.put(buffer);
+      buffer = grown;
+    }
+  }
+}
@@ -54,4 +54,40 @@ class HostMemoryBufferNativeUtils {
    * @param length size of the mapped region in bytes
    */
   static native void munmap(long address, long length);
+
+  /**
+   * Create a native sub-allocator of a pinned host memory region.
+   * @param address start of the region
+   * @param length size of the region in bytes
+   * @return handle of the arena
+   */
+  static native long createPinnedArena(long address, long length);
+
+  /**
+   * Destroy an arena. The region itself is not freed.
+   * @param arena handle of the arena
+   */
+  static native void destroyPinnedArena(long arena);
+
+  /**
+   * Allocate memory from an arena.
+   * @param arena handle of the arena
+   * @param length size of the allocation in bytes
+   * @return address of the allocation or 0 if the arena has no room for it
+   */
+  static native long pinnedArenaAllocate(long arena, long length);
+
+  /**
+   * Free memory allocated from an arena.
+   * @param arena handle of the arena
+   * @param address address of the allocation
+   * @param length size in bytes the allocation was requested with
+   */
+  static native void pinnedArenaFree(long arena, long address, long length);
+
+  /**
+   * Get the number of bytes of an arena that are not allocated.
+   * @param arena handle of the arena
+   */
+  static native long pinnedArenaAvailableBytes(long arena);
 }
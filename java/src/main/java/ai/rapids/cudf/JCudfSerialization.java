@@ -1523,6 +1523,43 @@ public class JCudfSerialization {
     }
   }
 
+  /**
+   * Serialize a table on the GPU and copy it to host memory with a single transfer. Unlike
+   * {@link #writeToStream(Table, OutputStream, long, long)}, no column is copied to the host
+   * on its own, and the data can be compressed on the GPU.
+   * @param t the table to serialize.
+   * @param compress true to compress the data with snappy on the GPU.
+   * @return a host buffer holding the serialized table. The caller must close it.
+   */
+  public static HostMemoryBuffer serializeToHostBuffer(Table t, boolean compress) {
+    try (DeviceMemoryBuffer serialized = t.serializeToDeviceBuffer(compress)) {
+      HostMemoryBuffer result = HostMemoryBuffer.allocate(serialized.getLength());
+      try {
+        result.copyFromDeviceBuffer(serialized);
+      } catch (Throwable e) {
+        result.close();
+        throw e;
+      }
+      return result;
+    }
+  }
+
+  /**
+   * Copy a table serialized by {@link #serializeToHostBuffer(Table, boolean)} to the GPU with a
+   * single transfer and restore it there.
+   * @param buffer the host buffer holding the serialized table.
+   * @param offset the offset of the serialized table in the buffer.
+   * @param length the length of the serialized table.
+   * @return the table. The caller must close it.
+   */
+  public static ContiguousTable deserializeFromHostBuffer(HostMemoryBuffer buffer, long offset,
+                                                          long length) {
+    try (DeviceMemoryBuffer serialized = DeviceMemoryBuffer.allocate(length)) {
+      serialized.copyFromHostBuffer(buffer, offset, length);
+      return Table.deserializeFromDeviceBuffer(serialized);
+    }
+  }
+
   /** Holds the result of deserializing a table. */
   public static final class TableAndRowCountPair implements Closeable {
     private final int numRows;
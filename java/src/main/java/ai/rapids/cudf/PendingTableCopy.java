@@ -0,0 +1,122 @@
+/*
+ *
+ *  Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+/**
+ * The columns of a table being copied between host and device memory on a stream, returned by
+ * {@link Table#copyToHostAsync(Cuda.Stream)} and
+ * {@link Table#copyToDeviceAsync(HostColumnVector[], Cuda.Stream)}.
+ * <p>
+ * The copy completes when its event does. Until then the staging buffer and the source columns
+ * are kept alive by this object, and the destination columns must not be read, except by work
+ * queued after the event on the GPU. Closing this object waits for the copy to complete before
+ * releasing them, and closes the destination columns unless they were taken with
+ * {@link #getColumns()}.
+ * @param <T> the type of the destination columns
+ */
+public final class PendingTableCopy<T extends AutoCloseable> implements AutoCloseable {
+  private final T[] columns;
+  private final Cuda.Event event;
+  private AutoCloseable[] inFlight;
+  private boolean columnsTaken = false;
+  private boolean closed = false;
+
+  /**
+   * @param columns the destination columns
+   * @param event the event recorded on the stream after the copies
+   * @param inFlight the resources that must stay alive until the copies complete
+   */
+  PendingTableCopy(T[] columns, Cuda.Event event, AutoCloseable... inFlight) {
+    this.columns = columns;
+    this.event = event;
+    this.inFlight = inFlight;
+  }
+
+  /**
+   * Get the event that completes with the copy, e.g. for a stream to wait on it with
+   * {@link Cuda.Stream#waitOn(Cuda.Event)}. It is owned by this object.
+   */
+  public Cuda.Event getEvent() {
+    return event;
+  }
+
+  /**
+   * Returns true if the copy has completed, without blocking.
+   */
+  public boolean isDone() {
+    return event.hasCompleted();
+  }
+
+  /**
+   * Wait for the copy to complete and take the destination columns. The caller owns the
+   * returned columns and must close them.
+   */
+  public synchronized T[] getColumns() {
+    if (closed || columnsTaken) {
+      throw new IllegalStateException("The columns were already taken or closed");
+    }
+    event.sync();
+    releaseInFlight();
+    columnsTaken = true;
+    return columns;
+  }
+
+  @Override
+  public synchronized void close() {
+    if (closed) {
+      return;
+    }
+    closed = true;
+    // The buffers cannot be released while a copy may still access them
+    event.sync();
+    releaseInFlight();
+    if (!columnsTaken) {
+      closeAll(columns);
+    }
+    event.close();
+  }
+
+  private void releaseInFlight() {
+    if (inFlight != null) {
+      closeAll(inFlight);
+      inFlight = null;
+    }
+  }
+
+  private static void closeAll(AutoCloseable[] resources) {
+    RuntimeException error = null;
+    for (AutoCloseable resource : resources) {
+      if (resource == null) {
+        continue;
+      }
+      try {
+        resource.close();
+      } catch (Exception e) {
+        if (error == null) {
+          error = new RuntimeException(e);
+        } else {
+          error.addSuppressed(e);
+        }
+      }
+    }
+    if (error != null) {
+      throw error;
+    }
+  }
+}
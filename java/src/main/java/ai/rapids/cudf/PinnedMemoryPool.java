@@ -22,20 +22,20 @@ package ai.rapids.cudf;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
-import java.util.Comparator;
-import java.util.Iterator;
 import java.util.Objects;
-import java.util.PriorityQueue;
 import java.util.concurrent.ExecutorService;
 import java.util.concurrent.Executors;
 import java.util.concurrent.Future;
 
 /**
  * This provides a pool of pinned memory similar to what RMM does for device memory.
+ *
+ * The pool is sub-allocated by a native arena that rounds small allocations up to size classes
+ * and caches freed blocks per thread, so that concurrent tasks staging copies do not contend on a
+ * lock. Larger allocations come from a coalescing allocator shared by all threads.
  */
 public final class PinnedMemoryPool implements AutoCloseable {
   private static final Logger log = LoggerFactory.getLogger(PinnedMemoryPool.class);
-  private static final long ALIGNMENT = 8;
 
   // These static fields should only ever be accessed when class-synchronized.
   // Do NOT use singleton_ directly!  Use the getSingleton accessor instead.
@@ -43,83 +43,29 @@ public final class PinnedMemoryPool implements AutoCloseable {
   private static Future<PinnedMemoryPool> initFuture = null;
 
   private final long pinnedPoolBase;
-  private final PriorityQueue<MemorySection> freeHeap = new PriorityQueue<>(new SortedBySize());
-  private int numAllocatedSections = 0;
-  private long availableBytes;
-
-  private static class SortedBySize implements Comparator<MemorySection> {
-    @Override
-    public int compare(MemorySection s0, MemorySection s1) {
-      // We want the largest ones first...
-      int ret = Long.compare(s1.size, s0.size);
-      if (ret == 0) {
-        ret = Long.compare(s0.baseAddress, s1.baseAddress);
-      }
-      return ret;
-    }
-  }
-
-  private static class MemorySection {
-    private long baseAddress;
-    private long size;
-
-    MemorySection(long baseAddress, long size) {
-      this.baseAddress = baseAddress;
-      this.size = size;
-    }
-
-    boolean canCombine(MemorySection other) {
-      boolean ret = (other.baseAddress + other.size) == baseAddress ||
-          (baseAddress + size) == other.baseAddress;
-      log.trace("CAN {} COMBINE WITH {} ? {}", this, other, ret);
-      return ret;
-    }
-
-    void combineWith(MemorySection other) {
-      assert canCombine(other);
-      log.trace("COMBINING {} AND {}", this, other);
-      this.baseAddress = Math.min(baseAddress, other.baseAddress);
-      this.size = other.size + this.size;
-      log.trace("COMBINED TO {}\n", this);
-    }
-
-    MemorySection splitOff(long newSize) {
-      assert this.size > newSize;
-      MemorySection ret = new MemorySection(baseAddress, newSize);
-      this.baseAddress += newSize;
-      this.size -= newSize;
-      return ret;
-    }
-
-    @Override
-    public String toString() {
-      return "PINNED: " + size + " bytes (0x" + Long.toHexString(baseAddress)
-          + " to 0x" + Long.toHexString(baseAddress + size) + ")";
-    }
-  }
+  private final long arena;
 
   private static final class PinnedHostBufferCleaner extends MemoryBuffer.MemoryBufferCleaner {
-    private MemorySection section;
+    private long address;
     private final long origLength;
 
-    PinnedHostBufferCleaner(MemorySection section, long length) {
-      this.section = section;
+    PinnedHostBufferCleaner(long address, long length) {
+      this.address = address;
       origLength = length;
     }
 
     @Override
     protected boolean cleanImpl(boolean logErrorIfNotClean) {
       boolean neededCleanup = false;
-      long origAddress = 0;
-      if (section != null) {
-        origAddress = section.baseAddress;
+      long origAddress = address;
+      if (address != 0) {
         try {
-          PinnedMemoryPool.freeInternal(section);
+          PinnedMemoryPool.freeInternal(address, origLength);
         } finally {
           // Always mark the resource as freed even if an exception is thrown.
           // We cannot know how far it progressed before the exception, and
           // therefore it is unsafe to retry.
-          section = null;
+          address = 0;
         }
         neededCleanup = true;
       }
@@ -132,7 +78,7 @@ public final class PinnedMemoryPool implements AutoCloseable {
 
     @Override
     public boolean isClean() {
-      return section == null;
+      return address == 0;
     }
   }
 
@@ -156,8 +102,8 @@ public final class PinnedMemoryPool implements AutoCloseable {
     return singleton_;
   }
 
-  private static void freeInternal(MemorySection section) {
-    Objects.requireNonNull(getSingleton()).free(section);
+  private static void freeInternal(long address, long length) {
+    Objects.requireNonNull(getSingleton()).free(address, length);
   }
 
   /**
@@ -252,72 +198,31 @@ public final class PinnedMemoryPool implements AutoCloseable {
       Cuda.freeZero();
     }
     this.pinnedPoolBase = Cuda.hostAllocPinned(poolSize);
-    freeHeap.add(new MemorySection(pinnedPoolBase, poolSize));
-    this.availableBytes = poolSize;
+    this.arena = HostMemoryBufferNativeUtils.createPinnedArena(pinnedPoolBase, poolSize);
   }
 
   @Override
   public void close() {
-    assert numAllocatedSections == 0;
+    HostMemoryBufferNativeUtils.destroyPinnedArena(arena);
     Cuda.freePinned(pinnedPoolBase);
   }
 
-  private synchronized HostMemoryBuffer tryAllocateInternal(long bytes) {
-    if (freeHeap.isEmpty()) {
-      log.debug("No free pinned memory left");
-      return null;
-    }
-    // Align the allocation
-    long alignedBytes = ((bytes + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
-    MemorySection largest = freeHeap.peek();
-    if (largest.size < alignedBytes) {
-      log.debug("Insufficient pinned memory. {} needed, {} found", alignedBytes, largest.size);
+  private HostMemoryBuffer tryAllocateInternal(long bytes) {
+    long address = HostMemoryBufferNativeUtils.pinnedArenaAllocate(arena, bytes);
+    if (address == 0) {
+      log.debug("Insufficient pinned memory. {} needed", bytes);
       return null;
     }
-    log.debug("Allocating {}/{} bytes pinned from {} FREE COUNT {} OUTSTANDING COUNT {}",
-        bytes, alignedBytes, largest, freeHeap.size(), numAllocatedSections);
-    freeHeap.remove(largest);
-    MemorySection allocated;
-    if (largest.size == alignedBytes) {
-      allocated = largest;
-    } else {
-      allocated = largest.splitOff(alignedBytes);
-      freeHeap.add(largest);
-    }
-    numAllocatedSections++;
-    availableBytes -= allocated.size;
-    log.debug("Allocated {} free {} outstanding {}", allocated, freeHeap, numAllocatedSections);
-    return new HostMemoryBuffer(allocated.baseAddress, bytes,
-        new PinnedHostBufferCleaner(allocated, bytes));
+    log.trace("Allocated {} bytes pinned at 0x{}", bytes, Long.toHexString(address));
+    return new HostMemoryBuffer(address, bytes, new PinnedHostBufferCleaner(address, bytes));
   }
 
-  private synchronized void free(MemorySection section) {
-    log.debug("Freeing {} with {} outstanding {}", section, freeHeap, numAllocatedSections);
-    // This looks inefficient, but in reality it will only walk through the heap about 2 times.
-    // Because we keep entries up to date, each new entry will at most combine with one above it
-    // and one below it. That will happen in a single pass through the heap.  We do a second pass
-    // simply out of an abundance of caution.
-    // Adding it in will be a log(N) operation because it is a heap.
-    availableBytes += section.size;
-    boolean anyReplaced;
-    do {
-      anyReplaced = false;
-      Iterator<MemorySection> it = freeHeap.iterator();
-      while(it.hasNext()) {
-        MemorySection current = it.next();
-        if (section.canCombine(current)) {
-          it.remove();
-          anyReplaced = true;
-          section.combineWith(current);
-        }
-      }
-    } while(anyReplaced);
-    freeHeap.add(section);
-    numAllocatedSections--;
-    log.debug("After freeing {} outstanding {}", freeHeap, numAllocatedSections);
+  private void free(long address, long length) {
+    log.trace("Freeing {} bytes pinned at 0x{}", length, Long.toHexString(address));
+    HostMemoryBufferNativeUtils.pinnedArenaFree(arena, address, length);
   }
 
-  private synchronized long getAvailableBytesInternal() {
-    return this.availableBytes;
+  private long getAvailableBytesInternal() {
+    return HostMemoryBufferNativeUtils.pinnedArenaAvailableBytes(arena);
   }
 }
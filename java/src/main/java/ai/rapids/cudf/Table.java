@@ -24,6 +24,7 @@ import java.util.Arrays;
 import java.util.Collection;
 import java.util.List;
 import java.util.Map;
+import java.util.Optional;
 import java.util.Set;
 import java.util.TreeMap;
 
@@ -167,6 +168,12 @@ public final class Table implements AutoCloseable {
   
   private static native ContiguousTable[] contiguousSplit(long inputTable, int[] indices);
 
+  private static native long[] evaluatePlan(long inputTable, byte[] plan);
+
+  private static native long[] serializeToDeviceBuffer(long inputTable, boolean compress);
+
+  private static native ContiguousTable deserializeFromDeviceBuffer(long address, long length);
+
   private static native long[] hashPartition(long inputTable,
                                              int[] columnsToHash,
                                              int numberOfPartitions,
@@ -220,6 +227,41 @@ public final class Table implements AutoCloseable {
   private static native long[] readParquet(String[] filterColumnNames, String filePath,
                                            long address, long length, int timeUnit) throws CudfException;
 
+  /**
+   * Setup everything to read parquet formatted data in chunks.
+   * @param filterColumnNames name of the columns to read, or an empty array if we want to read
+   *                          all of them
+   * @param filePath          the path of the file to read, or null if no path should be read.
+   * @param address           the address of the buffer to read from or 0 if we should not.
+   * @param length            the length of the buffer to read from.
+   * @param timeUnit          return type of TimeStamp in units
+   * @param chunkReadLimit    limit on the device memory used to read each chunk in bytes, or 0
+   *                          to read everything in a single chunk.
+   * @return a handle that is used in later calls to readParquetChunkedHasNext,
+   * readParquetChunk and readParquetChunkedEnd.
+   */
+  private static native long readParquetChunkedBegin(String[] filterColumnNames, String filePath,
+                                                     long address, long length, int timeUnit,
+                                                     long chunkReadLimit) throws CudfException;
+
+  /**
+   * Check if a chunked parquet read has more data.
+   * @param handle the handle to the reader.
+   */
+  private static native boolean readParquetChunkedHasNext(long handle) throws CudfException;
+
+  /**
+   * Read the next chunk of a chunked parquet read.
+   * @param handle the handle to the reader.
+   */
+  private static native long[] readParquetChunk(long handle) throws CudfException;
+
+  /**
+   * Finish reading parquet.
+   * @param handle the handle.  Do not use again once this returns.
+   */
+  private static native void readParquetChunkedEnd(long handle);
+
   /**
    * Setup everything to write parquet formatted data to a file.
    * @param columnNames     names that correspond to the table columns
@@ -643,6 +685,77 @@ public final class Table implements AutoCloseable {
         opts.timeUnit().nativeId));
   }
 
+  private static class ParquetTableReader implements TableReader {
+    private long handle;
+
+    private ParquetTableReader(ParquetOptions opts, String filePath, long address, long length,
+                               long chunkReadLimit) {
+      this.handle = readParquetChunkedBegin(opts.getIncludeColumnNames(), filePath, address,
+          length, opts.timeUnit().nativeId, chunkReadLimit);
+    }
+
+    @Override
+    public boolean hasNext() {
+      if (handle == 0) {
+        throw new IllegalStateException("Reader was already closed");
+      }
+      return readParquetChunkedHasNext(handle);
+    }
+
+    @Override
+    public Table readChunk() {
+      if (!hasNext()) {
+        throw new IllegalStateException("No more data to read");
+      }
+      return new Table(readParquetChunk(handle));
+    }
+
+    @Override
+    public void close() throws CudfException {
+      if (handle != 0) {
+        readParquetChunkedEnd(handle);
+      }
+      handle = 0;
+    }
+  }
+
+  /**
+   * Get a table reader to read a parquet file in chunks.  The footer of the file is parsed only
+   * once, when the reader is created.
+   * @param opts various parquet parsing options.
+   * @param path the local file to read.
+   * @param chunkReadLimit limit on the device memory used to read each chunk in bytes, or 0 to
+   *                       read the whole file in a single chunk.
+   * @return a table reader to use for reading the file one table at a time.
+   */
+  public static TableReader readParquetChunked(ParquetOptions opts, File path,
+                                               long chunkReadLimit) {
+    return new ParquetTableReader(opts, path.getAbsolutePath(), 0, 0, chunkReadLimit);
+  }
+
+  /**
+   * Get a table reader to read parquet formatted data in chunks.  The footer is parsed only once,
+   * when the reader is created.  The buffer must not be closed or modified until the reader is
+   * closed.
+   * @param opts various parquet parsing options.
+   * @param buffer raw parquet formatted bytes.
+   * @param offset the starting offset into buffer.
+   * @param len the number of bytes to parse.
+   * @param chunkReadLimit limit on the device memory used to read each chunk in bytes, or 0 to
+   *                       read all the data in a single chunk.
+   * @return a table reader to use for reading the data one table at a time.
+   */
+  public static TableReader readParquetChunked(ParquetOptions opts, HostMemoryBuffer buffer,
+                                               long offset, long len, long chunkReadLimit) {
+    if (len <= 0) {
+      len = buffer.length - offset;
+    }
+    assert len > 0;
+    assert len <= buffer.getLength() - offset;
+    assert offset >= 0 && offset < buffer.length;
+    return new ParquetTableReader(opts, null, buffer.getAddress() + offset, len, chunkReadLimit);
+  }
+
   private static class ParquetTableWriter implements TableWriter {
     private long handle;
     HostBufferConsumer consumer;
@@ -1186,6 +1299,242 @@ public final class Table implements AutoCloseable {
     return contiguousSplit(nativeHandle, indices);
   }
 
+  /**
+   * The buffers of each column, in the order they are staged by the async copies.
+   */
+  private static final BufferType[] STAGED_BUFFERS =
+      {BufferType.VALIDITY, BufferType.OFFSET, BufferType.DATA};
+
+  /**
+   * Start copying the columns of this table to host memory on a stream, without waiting for the
+   * copy to complete.
+   * <p>
+   * All the buffers of all the columns are copied with a single native call into one staging
+   * buffer, allocated from the {@link PinnedMemoryPool} when it has room, that the host columns
+   * slice. This avoids a synchronous copy, and a JNI call, per buffer. The null counts of the
+   * columns are computed first, which waits for the GPU if they are not known yet. The table can
+   * be closed before the copy completes.
+   * @param stream the stream to copy on.
+   * @return the pending host columns. NOTE: It is the responsibility of the caller to close it.
+   */
+  public PendingTableCopy<HostColumnVector> copyToHostAsync(Cuda.Stream stream) {
+    int numBuffers = columns.length * STAGED_BUFFERS.length;
+    BaseDeviceMemoryBuffer[] srcs = new BaseDeviceMemoryBuffer[numBuffers];
+    long[] stagedOffsets = new long[numBuffers];
+    long stagedSize = 0;
+    for (int i = 0; i < columns.length; i++) {
+      // The host columns need the null counts
+      columns[i].getNullCount();
+      for (int b = 0; b < STAGED_BUFFERS.length; b++) {
+        int index = i * STAGED_BUFFERS.length + b;
+        srcs[index] = columns[i].getDeviceBufferFor(STAGED_BUFFERS[b]);
+        stagedOffsets[index] = stagedSize;
+        if (srcs[index] != null) {
+          // Keep every buffer 8-byte aligned, as separate host allocations would be
+          stagedSize += (srcs[index].getLength() + 7) & ~7L;
+        }
+      }
+    }
+
+    HostMemoryBuffer[] slices = new HostMemoryBuffer[numBuffers];
+    HostColumnVector[] hostColumns = new HostColumnVector[columns.length];
+    ColumnVector[] sources = new ColumnVector[columns.length];
+    HostMemoryBuffer staging = null;
+    Cuda.Event event = null;
+    boolean success = false;
+    try {
+      staging = PinnedMemoryPool.allocate(Math.max(stagedSize, 1));
+      long[] dstAddrs = new long[numBuffers];
+      long[] srcAddrs = new long[numBuffers];
+      long[] counts = new long[numBuffers];
+      for (int index = 0; index < numBuffers; index++) {
+        if (srcs[index] != null) {
+          slices[index] = staging.slice(stagedOffsets[index], srcs[index].getLength());
+          dstAddrs[index] = slices[index].getAddress();
+          srcAddrs[index] = srcs[index].getAddress();
+          counts[index] = srcs[index].getLength();
+        }
+      }
+      Cuda.asyncMemcpyBatch(dstAddrs, srcAddrs, counts, CudaMemcpyKind.DEVICE_TO_HOST, stream);
+      event = new Cuda.Event();
+      event.record(stream);
+
+      for (int i = 0; i < columns.length; i++) {
+        int index = i * STAGED_BUFFERS.length;
+        hostColumns[i] = new HostColumnVector(columns[i].getType(), columns[i].getRowCount(),
+            Optional.of(columns[i].getNullCount()), slices[index + 2], slices[index],
+            slices[index + 1]);
+        slices[index] = slices[index + 1] = slices[index + 2] = null;
+        sources[i] = columns[i].incRefCount();
+      }
+      PendingTableCopy<HostColumnVector> ret =
+          new PendingTableCopy<>(hostColumns, event, sources);
+      success = true;
+      return ret;
+    } finally {
+      // The slices hold the staging buffer from here
+      if (staging != null) {
+        staging.close();
+      }
+      if (!success) {
+        stream.sync();
+        closeAll(slices);
+        closeAll(hostColumns);
+        closeAll(sources);
+        if (event != null) {
+          event.close();
+        }
+      }
+    }
+  }
+
+  /**
+   * Start copying host columns to the device on a stream, without waiting for the copy to
+   * complete.
+   * <p>
+   * The buffers of all the columns are first copied on the host into one staging buffer,
+   * allocated from the {@link PinnedMemoryPool} when it has room, and then copied to the device
+   * with a single native call. The host columns can be closed as soon as this returns.
+   * @param columns the columns to copy.
+   * @param stream the stream to copy on.
+   * @return the pending device columns. NOTE: It is the responsibility of the caller to close it.
+   */
+  public static PendingTableCopy<ColumnVector> copyToDeviceAsync(HostColumnVector[] columns,
+                                                                 Cuda.Stream stream) {
+    int numBuffers = columns.length * STAGED_BUFFERS.length;
+    long[] lengths = new long[numBuffers];
+    long[] stagedOffsets = new long[numBuffers];
+    long stagedSize = 0;
+    for (int i = 0; i < columns.length; i++) {
+      HostColumnVector column = columns[i];
+      long rows = column.getRowCount();
+      for (int b = 0; b < STAGED_BUFFERS.length; b++) {
+        int index = i * STAGED_BUFFERS.length + b;
+        stagedOffsets[index] = stagedSize;
+        if (rows == 0 || column.getHostBufferFor(STAGED_BUFFERS[b]) == null) {
+          continue;
+        }
+        // The lengths are those HostColumnVector.copyToDevice copies
+        switch (STAGED_BUFFERS[b]) {
+          case VALIDITY:
+            lengths[index] = ColumnVector.getNativeValidPointerSize((int) rows);
+            break;
+          case OFFSET:
+            lengths[index] = HostColumnVector.OFFSET_SIZE * (rows + 1);
+            break;
+          default:
+            lengths[index] = rows * column.getType().sizeInBytes;
+            if (column.getType() == DType.STRING) {
+              lengths[index] = column.getEndStringOffset(rows - 1);
+              if (lengths[index] == 0 && column.getNullCount() == 0) {
+                // A column of all empty strings must have at least one byte of data
+                lengths[index] = 1;
+              }
+            }
+        }
+        stagedSize += (lengths[index] + 7) & ~7L;
+      }
+    }
+
+    DeviceMemoryBuffer[] buffers = new DeviceMemoryBuffer[numBuffers];
+    ColumnVector[] deviceColumns = new ColumnVector[columns.length];
+    HostMemoryBuffer staging = null;
+    Cuda.Event event = null;
+    boolean success = false;
+    try {
+      staging = PinnedMemoryPool.allocate(Math.max(stagedSize, 1));
+      long[] dstAddrs = new long[numBuffers];
+      long[] srcAddrs = new long[numBuffers];
+      for (int index = 0; index < numBuffers; index++) {
+        if (lengths[index] == 0) {
+          continue;
+        }
+        HostMemoryBuffer src = columns[index / STAGED_BUFFERS.length]
+            .getHostBufferFor(STAGED_BUFFERS[index % STAGED_BUFFERS.length]);
+        staging.copyFromHostBuffer(stagedOffsets[index], src, 0,
+            Math.min(lengths[index], src.getLength()));
+        buffers[index] = DeviceMemoryBuffer.allocate(lengths[index]);
+        dstAddrs[index] = buffers[index].getAddress();
+        srcAddrs[index] = staging.getAddress() + stagedOffsets[index];
+      }
+      Cuda.asyncMemcpyBatch(dstAddrs, srcAddrs, lengths, CudaMemcpyKind.HOST_TO_DEVICE, stream);
+      event = new Cuda.Event();
+      event.record(stream);
+
+      for (int i = 0; i < columns.length; i++) {
+        int index = i * STAGED_BUFFERS.length;
+        long rows = columns[i].getRowCount();
+        deviceColumns[i] = new ColumnVector(columns[i].getType(), rows,
+            Optional.of(rows == 0 ? 0L : columns[i].getNullCount()), buffers[index + 2],
+            buffers[index], buffers[index + 1]);
+        buffers[index] = buffers[index + 1] = buffers[index + 2] = null;
+      }
+      PendingTableCopy<ColumnVector> ret = new PendingTableCopy<>(deviceColumns, event, staging);
+      staging = null;
+      success = true;
+      return ret;
+    } finally {
+      if (!success) {
+        stream.sync();
+        if (staging != null) {
+          staging.close();
+        }
+        closeAll(buffers);
+        closeAll(deviceColumns);
+        if (event != null) {
+          event.close();
+        }
+      }
+    }
+  }
+
+  private static void closeAll(AutoCloseable[] resources) {
+    for (AutoCloseable resource : resources) {
+      if (resource != null) {
+        try {
+          resource.close();
+        } catch (Exception e) {
+          // Already failing: the original exception is the one to report
+        }
+      }
+    }
+  }
+
+  /**
+   * Evaluate a batch of expressions over the columns of this table with a single native call.
+   * This avoids a JNI call and the intermediate columns of each operator, which dominate the cost
+   * of projections over small batches.
+   * @param plan the expressions to evaluate.
+   * @return a table with one column per output of the plan. NOTE: It is the responsibility of
+   * the caller to close it.
+   */
+  public Table evaluate(ExpressionPlan plan) {
+    return new Table(evaluatePlan(nativeHandle, plan.serialize()));
+  }
+
+  /**
+   * Serialize this table into a single device buffer that can be copied to the host and sent as
+   * is. The data is packed as by {@link #contiguousSplit(int...)} and, if requested, compressed
+   * with snappy on the GPU.
+   * @param compress true to compress the data on the GPU.
+   * @return the serialized table. NOTE: It is the responsibility of the caller to close it.
+   */
+  public DeviceMemoryBuffer serializeToDeviceBuffer(boolean compress) {
+    long[] buffer = serializeToDeviceBuffer(nativeHandle, compress);
+    return DeviceMemoryBuffer.fromRmm(buffer[0], buffer[1], buffer[2]);
+  }
+
+  /**
+   * Restore a table serialized by {@link #serializeToDeviceBuffer(boolean)}, decompressing it
+   * on the GPU if needed.
+   * @param buffer device memory holding the serialized table.
+   * @return the table, whose memory is laid out in a single buffer. NOTE: It is the
+   * responsibility of the caller to close the result.
+   */
+  public static ContiguousTable deserializeFromDeviceBuffer(BaseDeviceMemoryBuffer buffer) {
+    return deserializeFromDeviceBuffer(buffer.getAddress(), buffer.getLength());
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // HELPER CLASSES
   /////////////////////////////////////////////////////////////////////////////
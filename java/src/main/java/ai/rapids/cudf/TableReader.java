@@ -0,0 +1,45 @@
+/*
+ *
+ *  Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+/**
+ * Provides an interface for reading in Table information in multiple steps.
+ * A TableReader will be returned from one of various factory functions in Table that
+ * let you set the format of the data, its source and a limit on the size of each chunk. The
+ * metadata of the source is parsed only once, when the reader is created.  After that readChunk
+ * can be called while hasNext returns true.  When you are done reading call close to release the
+ * resources of the reader.
+ */
+public interface TableReader extends AutoCloseable {
+  /**
+   * Check if there is more data to read.
+   * @return true if readChunk will return another table.
+   */
+  boolean hasNext() throws CudfException;
+
+  /**
+   * Read the next chunk of the data.  The caller owns the returned table and must close it.
+   * @return the next chunk of the data as a table on the GPU.
+   * @throws IllegalStateException if all of the data has already been read.
+   */
+  Table readChunk() throws CudfException;
+
+  @Override
+  void close() throws CudfException;
+}
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace jni {
+
+/**
+ * @brief Sub-allocator of a pinned host memory region with per-thread caches
+ *
+ * Allocations up to `max_cached_size` are rounded up to one of a few size classes (four per power
+ * of two) and freed blocks are kept in a cache owned by the freeing thread, so that the common
+ * allocate/free cycle of a thread staging copies never touches shared state. Each cache has its
+ * own mutex, which only another thread reclaiming memory ever contends for.
+ *
+ * Larger allocations, and the blocks that refill the caches, come from a coalescing best-fit
+ * allocator under a single mutex. When it cannot satisfy a request, the blocks of every cache are
+ * returned to it and the request is retried, so cached memory is never unavailable.
+ */
+class pinned_arena {
+ public:
+  static constexpr std::size_t alignment = 8;
+  static constexpr std::size_t max_cached_size = 1 << 20;
+  static constexpr std::size_t max_cache_bytes = 4 << 20;  ///< Bytes cached by one thread at most
+
+  /**
+   * @brief Constructs an arena managing `[base, base + size)`
+   */
+  pinned_arena(void *base, std::size_t size)
+      : _id(next_id()), _base(reinterpret_cast<std::uintptr_t>(base)) {
+    if (size > 0) {
+      insert_free(_base, size);
+    }
+  }
+
+  pinned_arena(pinned_arena const &) = delete;
+  pinned_arena &operator=(pinned_arena const &) = delete;
+
+  /**
+   * @brief Returns a block of at least `size` bytes, or nullptr if the arena has no room for it
+   *
+   * Zero-sized allocations return the base of the region and need not be freed.
+   */
+  void *allocate(std::size_t size) {
+    if (size == 0) {
+      return reinterpret_cast<void *>(_base);
+    }
+    auto const rounded = round_size(size);
+    auto const cls = size_class(rounded);
+    if (cls < num_classes) {
+      auto &cache = local_cache();
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      auto &blocks = cache.blocks[cls];
+      if (!blocks.empty()) {
+        auto const block = blocks.back();
+        blocks.pop_back();
+        cache.cached_bytes -= rounded;
+        return reinterpret_cast<void *>(block);
+      }
+    }
+    auto block = allocate_shared(rounded);
+    if (block == 0) {
+      reclaim_caches();
+      block = allocate_shared(rounded);
+    }
+    return reinterpret_cast<void *>(block);
+  }
+
+  /**
+   * @brief Frees a block returned by `allocate(size)`
+   */
+  void deallocate(void *ptr, std::size_t size) {
+    if (size == 0) {
+      return;
+    }
+    auto const block = reinterpret_cast<std::uintptr_t>(ptr);
+    auto const rounded = round_size(size);
+    auto const cls = size_class(rounded);
+    if (cls >= num_classes) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      insert_free(block, rounded);
+      return;
+    }
+    auto &cache = local_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.blocks[cls].push_back(block);
+    cache.cached_bytes += rounded;
+    if (cache.cached_bytes > max_cache_bytes) {
+      flush(cache);
+    }
+  }
+
+  /**
+   * @brief Returns the number of bytes that are not allocated, including the cached blocks
+   */
+  std::size_t available_bytes() {
+    std::lock_guard<std::mutex> caches_lock(_caches_mutex);
+    std::size_t total = 0;
+    for (auto const &cache : _caches) {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      total += cache->cached_bytes;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    return total + _free_bytes;
+  }
+
+ private:
+  static constexpr std::size_t num_classes = 64;
+
+  struct thread_cache {
+    std::mutex mutex;
+    std::array<std::vector<std::uintptr_t>, num_classes> blocks;  ///< Free blocks of each class
+    std::size_t cached_bytes = 0;
+  };
+
+  static std::uint64_t next_id() {
+    static std::atomic<std::uint64_t> id{0};
+    return ++id;
+  }
+
+  /**
+   * @brief Returns the size classes: the multiples of `max(8, 2^k / 4)` in `[2^k, 2^(k+1))`
+   */
+  static std::array<std::size_t, num_classes> const &class_sizes() {
+    static auto const sizes = []() {
+      std::array<std::size_t, num_classes> result{};
+      std::size_t idx = 0;
+      for (std::size_t base = alignment; base < max_cached_size; base *= 2) {
+        auto const step = std::max(alignment, base / 4);
+        for (auto size = base; size < 2 * base; size += step) {
+          result[idx++] = size;
+        }
+      }
+      result[idx++] = max_cached_size;
+      // Unused classes are never matched
+      std::fill(result.begin() + idx, result.end(), ~std::size_t{0});
+      return result;
+    }();
+    return sizes;
+  }
+
+  /**
+   * @brief Returns the index of the size class of `size`, or `num_classes` if it is not cached
+   */
+  static std::size_t size_class(std::size_t size) {
+    if (size > max_cached_size) {
+      return num_classes;
+    }
+    auto const &sizes = class_sizes();
+    return std::lower_bound(sizes.begin(), sizes.end(), size) - sizes.begin();
+  }
+
+  /**
+   * @brief Returns the size of the block allocated for a request of `size` bytes
+   */
+  static std::size_t round_size(std::size_t size) {
+    auto const aligned = (size + alignment - 1) / alignment * alignment;
+    auto const cls = size_class(aligned);
+    return cls < num_classes ? class_sizes()[cls] : aligned;
+  }
+
+  /**
+   * @brief Returns the cache of the calling thread, registering it on first use
+   *
+   * A thread remembers the cache of the last arena it used only; the process is expected to have
+   * one arena at a time, as the pinned pool does.
+   */
+  thread_cache &local_cache() {
+    thread_local std::uint64_t arena_id = 0;
+    thread_local thread_cache *cache = nullptr;
+    if (arena_id != _id) {
+      auto owned = std::make_unique<thread_cache>();
+      cache = owned.get();
+      std::lock_guard<std::mutex> lock(_caches_mutex);
+      _caches.push_back(std::move(owned));
+      arena_id = _id;
+    }
+    return *cache;
+  }
+
+  std::uintptr_t allocate_shared(std::size_t size) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _free_by_size.lower_bound({size, 0});
+    if (it == _free_by_size.end()) {
+      return 0;
+    }
+    auto const block = it->second;
+    auto const block_size = it->first;
+    erase_free(block, block_size);
+    if (block_size > size) {
+      insert_free(block + size, block_size - size);
+    }
+    return block;
+  }
+
+  /**
+   * @brief Returns the blocks of a cache to the shared allocator; the cache must be locked
+   */
+  void flush(thread_cache &cache) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (std::size_t cls = 0; cls < num_classes; ++cls) {
+      for (auto block : cache.blocks[cls]) {
+        insert_free(block, class_sizes()[cls]);
+      }
+      cache.blocks[cls].clear();
+    }
+    cache.cached_bytes = 0;
+  }
+
+  void reclaim_caches() {
+    std::lock_guard<std::mutex> caches_lock(_caches_mutex);
+    for (auto &cache : _caches) {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      flush(*cache);
+    }
+  }
+
+  /**
+   * @brief Adds a free block, merging it with its free neighbors; `_mutex` must be held
+   */
+  void insert_free(std::uintptr_t block, std::size_t size) {
+    auto next = _free_by_addr.lower_bound(block);
+    if (next != _free_by_addr.end() && block + size == next->first) {
+      size += next->second;
+      erase_free(next->first, next->second);
+    }
+    auto prev = _free_by_addr.lower_bound(block);
+    if (prev != _free_by_addr.begin()) {
+      --prev;
+      if (prev->first + prev->second == block) {
+        block = prev->first;
+        size += prev->second;
+        erase_free(prev->first, prev->second);
+      }
+    }
+    _free_by_addr.emplace(block, size);
+    _free_by_size.emplace(size, block);
+    _free_bytes += size;
+  }
+
+  void erase_free(std::uintptr_t block, std::size_t size) {
+    _free_by_addr.erase(block);
+    _free_by_size.erase({size, block});
+    _free_bytes -= size;
+  }
+
+  std::uint64_t const _id;  ///< Distinguishes the caches of this arena from those of earlier ones
+  std::uintptr_t const _base;
+
+  // The caches are locked before `_mutex` whenever both are held
+  std::mutex _caches_mutex;
+  std::vector<std::unique_ptr<thread_cache>> _caches;
+
+  std::mutex _mutex;
+  std::map<std::uintptr_t, std::size_t> _free_by_addr;
+  std::set<std::pair<std::size_t, std::uintptr_t>> _free_by_size;
+  std::size_t _free_bytes = 0;
+};
+
+} // namespace jni
+} // namespace cudf
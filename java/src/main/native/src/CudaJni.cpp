@@ -303,4 +303,32 @@ JNIEXPORT void JNICALL Java_ai_rapids_cudf_Cuda_asyncMemcpyOnStream(JNIEnv* env,
   CATCH_STD(env, );
 }
 
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_Cuda_asyncMemcpyBatchOnStream(JNIEnv* env, jclass,
+    jlongArray jdsts, jlongArray jsrcs, jlongArray jcounts, jint jkind, jlong jstream) {
+  JNI_NULL_CHECK(env, jdsts, "dst addresses are null", );
+  JNI_NULL_CHECK(env, jsrcs, "src addresses are null", );
+  JNI_NULL_CHECK(env, jcounts, "counts are null", );
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::native_jlongArray dsts(env, jdsts);
+    cudf::jni::native_jlongArray srcs(env, jsrcs);
+    cudf::jni::native_jlongArray counts(env, jcounts);
+    JNI_ARG_CHECK(env, dsts.size() == srcs.size() && dsts.size() == counts.size(),
+        "address and count arrays differ in length", );
+    auto kind = static_cast<cudaMemcpyKind>(jkind);
+    auto stream = reinterpret_cast<cudaStream_t>(jstream);
+    // All the copies are queued in one call so that the Java thread does not block between them
+    for (int i = 0; i < counts.size(); ++i) {
+      if (counts[i] == 0) {
+        continue;
+      }
+      JNI_ARG_CHECK(env, dsts[i] != 0, "dst memory pointer is null", );
+      JNI_ARG_CHECK(env, srcs[i] != 0, "src memory pointer is null", );
+      JNI_CUDA_TRY(env, , cudaMemcpyAsync(reinterpret_cast<void*>(dsts[i]),
+          reinterpret_cast<void*>(srcs[i]), counts[i], kind, stream));
+    }
+  }
+  CATCH_STD(env, );
+}
+
 } // extern "C"
@@ -24,6 +24,7 @@
 #include <unistd.h>
 
 #include "jni_utils.hpp"
+#include "pinned_arena.hpp"
 
 extern "C" {
 
@@ -75,4 +76,53 @@ Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_munmap(JNIEnv* env, jclass,
   } CATCH_STD(env, );
 }
 
+JNIEXPORT jlong JNICALL
+Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_createPinnedArena(JNIEnv* env, jclass,
+                                                                  jlong address,
+                                                                  jlong length) {
+  JNI_NULL_CHECK(env, address, "address is NULL", 0);
+  try {
+    auto arena = new cudf::jni::pinned_arena(reinterpret_cast<void*>(address), length);
+    return reinterpret_cast<jlong>(arena);
+  } CATCH_STD(env, 0);
+}
+
+JNIEXPORT void JNICALL
+Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_destroyPinnedArena(JNIEnv* env, jclass,
+                                                                   jlong arena) {
+  delete reinterpret_cast<cudf::jni::pinned_arena*>(arena);
+}
+
+JNIEXPORT jlong JNICALL
+Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_pinnedArenaAllocate(JNIEnv* env, jclass,
+                                                                    jlong arena,
+                                                                    jlong length) {
+  JNI_NULL_CHECK(env, arena, "arena is NULL", 0);
+  try {
+    auto n_arena = reinterpret_cast<cudf::jni::pinned_arena*>(arena);
+    return reinterpret_cast<jlong>(n_arena->allocate(length));
+  } CATCH_STD(env, 0);
+}
+
+JNIEXPORT void JNICALL
+Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_pinnedArenaFree(JNIEnv* env, jclass,
+                                                                jlong arena,
+                                                                jlong address,
+                                                                jlong length) {
+  JNI_NULL_CHECK(env, arena, "arena is NULL", );
+  try {
+    auto n_arena = reinterpret_cast<cudf::jni::pinned_arena*>(arena);
+    n_arena->deallocate(reinterpret_cast<void*>(address), length);
+  } CATCH_STD(env, );
+}
+
+JNIEXPORT jlong JNICALL
+Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_pinnedArenaAvailableBytes(JNIEnv* env, jclass,
+                                                                          jlong arena) {
+  JNI_NULL_CHECK(env, arena, "arena is NULL", 0);
+  try {
+    return reinterpret_cast<cudf::jni::pinned_arena*>(arena)->available_bytes();
+  } CATCH_STD(env, 0);
+}
+
 } // extern "C"
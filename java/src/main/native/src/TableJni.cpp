@@ -15,7 +15,9 @@
  */
 
 #include <cudf/aggregation.hpp>
+#include <cudf/ast/transform.hpp>
 #include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/io/data_sink.hpp>
@@ -28,6 +30,8 @@
 #include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
 
+#include <cstring>
+
 #include "jni_utils.hpp"
 
 namespace cudf {
@@ -186,6 +190,8 @@ public:
 typedef jni_table_writer_handle<cudf::io::detail::parquet::pq_chunked_state>
     native_parquet_writer_handle;
 typedef jni_table_writer_handle<cudf::io::detail::orc::orc_chunked_state> native_orc_writer_handle;
+typedef std::shared_ptr<cudf::io::detail::parquet::pq_chunked_read_state>
+    native_parquet_reader_handle;
 
 /**
  * Take a table returned by some operation and turn it into an array of column* so we can track them
@@ -277,6 +283,92 @@ bool valid_window_parameters(native_jintArray const &values, native_jintArray co
   return values.size() == timestamps.size() &&
          valid_window_parameters(values, ops, min_periods, preceding, following);
 }
+
+// Instructions of a serialized expression plan. These numbers come from ExpressionPlan.java and
+// must stay in sync
+enum class plan_instruction : int32_t { COLUMN, LITERAL, OPERATOR, OUTPUT };
+
+/**
+ * @brief Expression trees decoded from a serialized plan, owning their nodes and literals
+ */
+struct decoded_plan {
+  std::vector<std::unique_ptr<cudf::scalar>> literals;
+  std::vector<std::unique_ptr<cudf::ast::expression>> nodes;
+  std::vector<cudf::ast::expression const *> outputs;
+};
+
+template <typename T> T read_plan_value(uint8_t const *&next, uint8_t const *end) {
+  CUDF_EXPECTS(static_cast<size_t>(end - next) >= sizeof(T), "Truncated expression plan");
+  T value;
+  std::memcpy(&value, next, sizeof(T));
+  next += sizeof(T);
+  return value;
+}
+
+std::unique_ptr<cudf::scalar> make_plan_literal(cudf::type_id type, int64_t bits, bool valid) {
+  switch (type) {
+    case cudf::type_id::INT64:
+      return std::make_unique<cudf::numeric_scalar<int64_t>>(bits, valid);
+    case cudf::type_id::FLOAT64: {
+      double value;
+      std::memcpy(&value, &bits, sizeof(value));
+      return std::make_unique<cudf::numeric_scalar<double>>(value, valid);
+    }
+    case cudf::type_id::BOOL8:
+      return std::make_unique<cudf::numeric_scalar<bool>>(bits != 0, valid);
+    default: CUDF_FAIL("Unsupported expression plan literal type");
+  }
+}
+
+/**
+ * @brief Decodes a plan: a postfix program whose instructions push column references and
+ * literals, apply operators to the top of the stack and pop outputs
+ */
+decoded_plan decode_plan(uint8_t const *next, uint8_t const *end) {
+  decoded_plan plan;
+  std::vector<cudf::ast::expression const *> stack;
+  while (next != end) {
+    switch (static_cast<plan_instruction>(read_plan_value<int32_t>(next, end))) {
+      case plan_instruction::COLUMN: {
+        auto const index = read_plan_value<int32_t>(next, end);
+        plan.nodes.push_back(std::make_unique<cudf::ast::column_reference>(index));
+        break;
+      }
+      case plan_instruction::LITERAL: {
+        auto const type = static_cast<cudf::type_id>(read_plan_value<int32_t>(next, end));
+        auto const valid = read_plan_value<int32_t>(next, end) != 0;
+        auto const bits = read_plan_value<int64_t>(next, end);
+        plan.literals.push_back(make_plan_literal(type, bits, valid));
+        plan.nodes.push_back(std::make_unique<cudf::ast::literal>(*plan.literals.back()));
+        break;
+      }
+      case plan_instruction::OPERATOR: {
+        auto const op = static_cast<cudf::ast::ast_operator>(read_plan_value<int32_t>(next, end));
+        auto const arity = static_cast<size_t>(cudf::ast::ast_operator_arity(op));
+        CUDF_EXPECTS(stack.size() >= arity, "Missing operands in expression plan");
+        auto const operands = stack.end() - arity;
+        if (arity == 1) {
+          plan.nodes.push_back(std::make_unique<cudf::ast::operation>(op, *operands[0]));
+        } else {
+          plan.nodes.push_back(
+              std::make_unique<cudf::ast::operation>(op, *operands[0], *operands[1]));
+        }
+        stack.erase(operands, stack.end());
+        break;
+      }
+      case plan_instruction::OUTPUT:
+        CUDF_EXPECTS(!stack.empty(), "Missing output in expression plan");
+        plan.outputs.push_back(stack.back());
+        stack.pop_back();
+        continue;
+      default: CUDF_FAIL("Invalid expression plan instruction");
+    }
+    stack.push_back(plan.nodes.back().get());
+  }
+  CUDF_EXPECTS(stack.empty(), "Unused values in expression plan");
+  return plan;
+}
+
 } // namespace
 
 } // namespace jni
@@ -497,6 +589,94 @@ JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_readParquet(
   CATCH_STD(env, NULL);
 }
 
+JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_Table_readParquetChunkedBegin(
+    JNIEnv *env, jclass, jobjectArray filter_col_names, jstring inputfilepath, jlong buffer,
+    jlong buffer_length, jint unit, jlong chunk_read_limit) {
+  bool read_buffer = true;
+  if (buffer == 0) {
+    JNI_NULL_CHECK(env, inputfilepath, "input file or buffer must be supplied", 0);
+    read_buffer = false;
+  } else if (inputfilepath != NULL) {
+    JNI_THROW_NEW(env, "java/lang/IllegalArgumentException",
+                  "cannot pass in both a buffer and an inputfilepath", 0);
+  } else if (buffer_length <= 0) {
+    JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "An empty buffer is not supported",
+                  0);
+  }
+  if (chunk_read_limit < 0) {
+    JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "negative chunk read limit", 0);
+  }
+
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::jni::native_jstring filename(env, inputfilepath);
+    if (!read_buffer && filename.is_empty()) {
+      JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "inputfilepath can't be empty",
+                    0);
+    }
+
+    cudf::jni::native_jstringArray n_filter_col_names(env, filter_col_names);
+
+    std::unique_ptr<cudf::io::source_info> source;
+    if (read_buffer) {
+      source.reset(new cudf::io::source_info(reinterpret_cast<char *>(buffer), buffer_length));
+    } else {
+      source.reset(new cudf::io::source_info(filename.get()));
+    }
+
+    cudf::io::read_parquet_chunked_args read_arg(*source, chunk_read_limit);
+
+    read_arg.columns = n_filter_col_names.as_cpp_vector();
+
+    read_arg.strings_to_categorical = false;
+    read_arg.timestamp_type = cudf::data_type(static_cast<cudf::type_id>(unit));
+
+    // The footer is parsed once here and kept in the state for every later chunk
+    auto state = cudf::io::read_parquet_chunked_begin(read_arg);
+    return reinterpret_cast<jlong>(new cudf::jni::native_parquet_reader_handle(std::move(state)));
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT jboolean JNICALL Java_ai_rapids_cudf_Table_readParquetChunkedHasNext(JNIEnv *env,
+                                                                               jclass,
+                                                                               jlong j_state) {
+  JNI_NULL_CHECK(env, j_state, "null state", false);
+  cudf::jni::native_parquet_reader_handle *state =
+      reinterpret_cast<cudf::jni::native_parquet_reader_handle *>(j_state);
+  try {
+    cudf::jni::auto_set_device(env);
+    return cudf::io::read_parquet_chunked_has_next(*state);
+  }
+  CATCH_STD(env, false);
+}
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_readParquetChunk(JNIEnv *env, jclass,
+                                                                       jlong j_state) {
+  JNI_NULL_CHECK(env, j_state, "null state", NULL);
+  cudf::jni::native_parquet_reader_handle *state =
+      reinterpret_cast<cudf::jni::native_parquet_reader_handle *>(j_state);
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::io::table_with_metadata result = cudf::io::read_parquet_chunked(*state);
+    return cudf::jni::convert_table_for_return(env, result.tbl);
+  }
+  CATCH_STD(env, NULL);
+}
+
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_Table_readParquetChunkedEnd(JNIEnv *env, jclass,
+                                                                      jlong j_state) {
+  JNI_NULL_CHECK(env, j_state, "null state", );
+  cudf::jni::native_parquet_reader_handle *state =
+      reinterpret_cast<cudf::jni::native_parquet_reader_handle *>(j_state);
+  std::unique_ptr<cudf::jni::native_parquet_reader_handle> make_sure_we_delete(state);
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::io::read_parquet_chunked_end(*state);
+  }
+  CATCH_STD(env, )
+}
+
 JNIEXPORT long JNICALL Java_ai_rapids_cudf_Table_writeParquetBufferBegin(
     JNIEnv *env, jclass, jobjectArray j_col_names, jbooleanArray j_col_nullability,
     jobjectArray j_metadata_keys, jobjectArray j_metadata_values, jint j_compression,
@@ -1205,6 +1385,69 @@ JNIEXPORT jobjectArray JNICALL Java_ai_rapids_cudf_Table_contiguousSplit(JNIEnv
   CATCH_STD(env, NULL);
 }
 
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_evaluatePlan(JNIEnv *env, jclass clazz,
+                                                                    jlong input_table,
+                                                                    jbyteArray j_plan) {
+  JNI_NULL_CHECK(env, input_table, "native handle is null", NULL);
+  JNI_NULL_CHECK(env, j_plan, "plan is null", NULL);
+
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::table_view *n_table = reinterpret_cast<cudf::table_view *>(input_table);
+    cudf::jni::native_jbyteArray n_plan(env, j_plan);
+    auto const data = reinterpret_cast<uint8_t const *>(n_plan.data());
+    auto const plan = cudf::jni::decode_plan(data, data + n_plan.size());
+
+    std::vector<std::unique_ptr<cudf::column>> outputs;
+    for (auto const *expr : plan.outputs) {
+      outputs.push_back(cudf::ast::compute_column(*n_table, *expr));
+    }
+    auto result = std::make_unique<cudf::table>(std::move(outputs));
+    return cudf::jni::convert_table_for_return(env, result);
+  }
+  CATCH_STD(env, NULL);
+}
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_serializeToDeviceBuffer(JNIEnv *env,
+                                                                               jclass clazz,
+                                                                               jlong input_table,
+                                                                               jboolean compress) {
+  JNI_NULL_CHECK(env, input_table, "native handle is null", NULL);
+
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::table_view *n_table = reinterpret_cast<cudf::table_view *>(input_table);
+    std::unique_ptr<rmm::device_buffer> result = cudf::serialize_to_device_buffer(
+        *n_table, compress ? cudf::io::compression_type::SNAPPY : cudf::io::compression_type::NONE);
+
+    cudf::jni::native_jlongArray n_result(env, 3);
+    n_result[0] = reinterpret_cast<jlong>(result->data());
+    n_result[1] = static_cast<jlong>(result->size());
+    n_result[2] = reinterpret_cast<jlong>(result.get());
+    n_result.commit();
+    jlongArray ret = n_result.get_jArray();
+    result.release();
+    return ret;
+  }
+  CATCH_STD(env, NULL);
+}
+
+JNIEXPORT jobject JNICALL Java_ai_rapids_cudf_Table_deserializeFromDeviceBuffer(JNIEnv *env,
+                                                                              jclass clazz,
+                                                                              jlong address,
+                                                                              jlong length) {
+  JNI_NULL_CHECK(env, address, "buffer address is null", NULL);
+
+  try {
+    cudf::jni::auto_set_device(env);
+    cudf::packed_columns packed = cudf::deserialize_from_device_buffer(
+        reinterpret_cast<void const *>(address), static_cast<size_t>(length));
+    cudf::contiguous_split_result result{cudf::unpack(packed), std::move(packed.gpu_data)};
+    return cudf::jni::contiguous_table_from(env, result);
+  }
+  CATCH_STD(env, NULL);
+}
+
 JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_rollingWindowAggregate(
     JNIEnv *env, jclass clazz, jlong j_input_table, jintArray j_keys,
     jintArray j_aggregate_column_indices, jintArray j_agg_types, jintArray j_min_periods,
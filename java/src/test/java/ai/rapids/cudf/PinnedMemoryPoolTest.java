@@ -23,6 +23,8 @@ import org.junit.jupiter.api.Test;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
+import java.util.concurrent.atomic.AtomicReference;
+
 import static org.junit.jupiter.api.Assertions.*;
 
 class PinnedMemoryPoolTest extends CudfTestBase {
@@ -119,6 +121,39 @@ class PinnedMemoryPoolTest extends CudfTestBase {
     assertEquals(poolSize, PinnedMemoryPool.getAvailableBytes());
   }
 
+  @Test
+  void testConcurrentAllocations() throws InterruptedException {
+    final long poolSize = 64 * 1024 * 1024L;
+    PinnedMemoryPool.initialize(poolSize);
+    AtomicReference<Throwable> failure = new AtomicReference<>();
+    Thread[] threads = new Thread[8];
+    for (int t = 0; t < threads.length; t++) {
+      final int seed = t;
+      threads[t] = new Thread(() -> {
+        try {
+          for (int i = 0; i < 1000; i++) {
+            long size = 100 + (i * 37 + seed * 1009) % (2 * 1024 * 1024);
+            try (HostMemoryBuffer buffer = PinnedMemoryPool.allocate(size)) {
+              buffer.setLong(0, i);
+              buffer.setByte(size - 1, (byte) seed);
+              assertEquals(i, buffer.getLong(0));
+              assertEquals((byte) seed, buffer.getByte(size - 1));
+            }
+          }
+        } catch (Throwable e) {
+          failure.compareAndSet(null, e);
+        }
+      });
+      threads[t].start();
+    }
+    for (Thread thread : threads) {
+      thread.join();
+    }
+    assertNull(failure.get());
+    // Blocks cached by the threads are still available
+    assertEquals(poolSize, PinnedMemoryPool.getAvailableBytes());
+  }
+
   @Test
   void testZeroSizedAllocation() {
     final long poolSize = 4 * 1024L;
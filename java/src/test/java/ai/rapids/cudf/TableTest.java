@@ -1411,6 +1411,45 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testEvaluatePlan() {
+    try (Table t1 = new Table.TestBuilder()
+        .column(1, 2, null, 4)
+        .column(4L, 3L, 2L, 1L)
+        .build()) {
+      ExpressionPlan plan = new ExpressionPlan()
+          .column(0).literal(1L).op(ExpressionPlan.Op.ADD).output()
+          .column(0).column(1).op(ExpressionPlan.Op.LESS).output()
+          .column(1).literal(2.5).op(ExpressionPlan.Op.MUL).output();
+      assertEquals(3, plan.getNumOutputs());
+      try (Table result = t1.evaluate(plan);
+           ColumnVector expectedSum = ColumnVector.fromBoxedLongs(2L, 3L, null, 5L);
+           ColumnVector expectedLess = ColumnVector.fromBoxedBooleans(true, true, null, false);
+           ColumnVector expectedProduct = ColumnVector.fromBoxedDoubles(10.0, 7.5, 5.0, 2.5)) {
+        assertEquals(3, result.getNumberOfColumns());
+        assertColumnsAreEqual(expectedSum, result.getColumn(0));
+        assertColumnsAreEqual(expectedLess, result.getColumn(1));
+        assertColumnsAreEqual(expectedProduct, result.getColumn(2));
+      }
+    }
+  }
+
+  @Test
+  void testSerializeToHostBuffer() {
+    try (Table t1 = new Table.TestBuilder()
+        .column(10, 12, 14, 16, 18, 20, 22, 24, null, 28)
+        .column("A", "B", "C", "D", "E", "F", "G", "H", "I", null)
+        .build()) {
+      for (boolean compress : new boolean[] {false, true}) {
+        try (HostMemoryBuffer serialized = JCudfSerialization.serializeToHostBuffer(t1, compress);
+             ContiguousTable result = JCudfSerialization.deserializeFromHostBuffer(serialized, 0,
+                 serialized.getLength())) {
+          assertTablesAreEqual(t1, result.getTable());
+        }
+      }
+    }
+  }
+
   @Test
   void testContiguousSplitWithStrings() {
     ContiguousTable[] splits = null;
@@ -1434,6 +1473,39 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testAsyncCopyRoundTrip() {
+    try (Cuda.Stream stream = new Cuda.Stream(true);
+         Table expected = new Table.TestBuilder()
+             .column(10, 12, 14, null, 18)
+             .column("A", "", null, "DDD", "E")
+             .column(1.0, 2.0, 3.0, 4.0, 5.0)
+             .build();
+         PendingTableCopy<HostColumnVector> toHost = expected.copyToHostAsync(stream)) {
+      HostColumnVector[] hostColumns = toHost.getColumns();
+      try {
+        assertEquals(1, hostColumns[0].getNullCount());
+        assertEquals(1, hostColumns[1].getNullCount());
+        assertEquals("DDD", hostColumns[1].getJavaString(3));
+        try (PendingTableCopy<ColumnVector> toDevice =
+                 Table.copyToDeviceAsync(hostColumns, stream)) {
+          ColumnVector[] deviceColumns = toDevice.getColumns();
+          try (Table table = new Table(deviceColumns)) {
+            assertTablesAreEqual(expected, table);
+          } finally {
+            for (ColumnVector column : deviceColumns) {
+              column.close();
+            }
+          }
+        }
+      } finally {
+        for (HostColumnVector column : hostColumns) {
+          column.close();
+        }
+      }
+    }
+  }
+
   @Test
   void testPartStability() {
     final int PARTS = 5;
@@ -2989,6 +3061,36 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testParquetReadChunked() {
+    try (Table table0 = getExpectedFileTable();
+         MyBufferConsumer consumer = new MyBufferConsumer()) {
+      try (TableWriter writer = Table.writeParquetChunked(ParquetWriterOptions.DEFAULT, consumer)) {
+        writer.write(table0);
+        writer.write(table0);
+        writer.write(table0);
+      }
+      // Each write is a separate row group, so a tiny limit must return several chunks
+      List<Table> chunks = new ArrayList<>();
+      try (TableReader reader = Table.readParquetChunked(ParquetOptions.DEFAULT, consumer.buffer,
+          0, consumer.offset, 1)) {
+        while (reader.hasNext()) {
+          chunks.add(reader.readChunk());
+        }
+        assertThrows(IllegalStateException.class, reader::readChunk);
+      }
+      try (Table concat = Table.concatenate(table0, table0, table0);
+           Table result = Table.concatenate(chunks.toArray(new Table[0]))) {
+        assertTrue(chunks.size() > 1);
+        assertTablesAreEqual(concat, result);
+      } finally {
+        for (Table chunk : chunks) {
+          chunk.close();
+        }
+      }
+    }
+  }
+
   @Test
   void testParquetWriteToFileWithNames() throws IOException {
     File tempFile = File.createTempFile("test-names", ".parquet");
@@ -25,7 +25,12 @@ cdef class Column:
         cdef object _data
         cdef object _mask
         cdef object _null_count
+        cdef object _cuda_array_interface
 
+    cdef column_view _cached_view
+    cdef bool _has_cached_view
+
+    cpdef _clear_cached_views(self)
     cdef column_view _view(self, size_type null_count) except *
     cdef column_view view(self) except *
     cdef mutable_column_view mutable_view(self) except *
@@ -55,6 +55,8 @@ cdef class Column:
         self._dtype = dtype
         self._offset = offset
         self._null_count = null_count
+        self._has_cached_view = False
+        self._cuda_array_interface = None
         self.set_base_children(children)
         self.set_base_data(data)
         self.set_base_mask(mask)
@@ -110,6 +112,7 @@ cdef class Column:
                             type(value).__name__)
 
         self._data = None
+        self._clear_cached_views()
 
         self._base_data = value
 
@@ -177,6 +180,7 @@ cdef class Column:
         self._mask = None
         self._null_count = None
         self._children = None
+        self._clear_cached_views()
         self._base_mask = value
 
     def set_mask(self, value):
@@ -268,6 +272,7 @@ cdef class Column:
                 )
 
         self._children = None
+        self._clear_cached_views()
         self._base_children = value
 
     def _mimic_inplace(self, other_col, inplace=False):
@@ -278,6 +283,7 @@ cdef class Column:
         object with the Buffers and attributes from the other column.
         """
         if inplace:
+            self._clear_cached_views()
             self._offset = other_col.offset
             self._size = other_col.size
             self._dtype = other_col._dtype
@@ -330,6 +336,8 @@ cdef class Column:
         self._null_count = None
         self._children = None
         self._data = None
+        # The caller may change the null mask through the returned view
+        self._clear_cached_views()
 
         return mutable_column_view(
             dtype,
@@ -340,12 +348,31 @@ cdef class Column:
             offset,
             children)
 
+    cpdef _clear_cached_views(self):
+        """
+        Drops the cached ``column_view`` and ``__cuda_array_interface__`` of
+        the column. Called whenever the buffers, children, size, offset or
+        null count of the column may have changed.
+        """
+        self._has_cached_view = False
+        self._cuda_array_interface = None
+
     cdef column_view view(self) except *:
+        """
+        Returns a ``column_view`` of the column. The view only references the
+        buffers owned by the column, so it is built once (along with the views
+        of the children) and reused by every later call until the column is
+        modified.
+        """
+        if self._has_cached_view:
+            return self._cached_view
         null_count = self.null_count
         if null_count is None:
             null_count = libcudf_types.UNKNOWN_NULL_COUNT
         cdef libcudf_types.size_type c_null_count = null_count
-        return self._view(c_null_count)
+        self._cached_view = self._view(c_null_count)
+        self._has_cached_view = True
+        return self._cached_view
 
     cdef column_view _view(self, libcudf_types.size_type null_count) except *:
         if is_categorical_dtype(self.dtype):
@@ -955,6 +955,12 @@ class ColumnBase(Column, Serializable):
 
     @property
     def __cuda_array_interface__(self):
+        # The descriptor only depends on the buffers of the column, so it is
+        # built once and cached until the column is modified. A copy is
+        # returned since consumers may modify the dict.
+        if self._cuda_array_interface is not None:
+            return dict(self._cuda_array_interface)
+
         output = {
             "shape": (len(self),),
             "strides": (self.dtype.itemsize,),
@@ -978,7 +984,8 @@ class ColumnBase(Column, Serializable):
             )
             output["mask"] = mask
 
-        return output
+        self._cuda_array_interface = output
+        return dict(output)
 
     def searchsorted(
         self, value, side="left", ascending=True, na_position="last"
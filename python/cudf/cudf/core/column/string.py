@@ -109,7 +109,9 @@ from cudf._lib.strings.split.partition import (
 )
 from cudf._lib.strings.split.split import (
     rsplit as cpp_rsplit,
+    rsplit_record as cpp_rsplit_record,
     split as cpp_split,
+    split_record as cpp_split_record,
 )
 from cudf._lib.strings.strip import (
     lstrip as cpp_lstrip,
@@ -1908,11 +1910,18 @@ class StringMethods(ColumnMethodsMixin):
         n : int, default -1 (all)
             Limit number of splits in output. `None`, 0, and -1 will all be
             interpreted as "all splits".
+        expand : bool, default True
+            Expand the split strings into separate columns.
+
+            * If ``True``, return DataFrame/MultiIndex expanding
+              dimensionality.
+            * If ``False``, return Series/Index, containing lists
+              of strings.
 
         Returns
         -------
-        DataFrame
-            Returns a DataFrame with each split as a column.
+        Series, Index, DataFrame or MultiIndex
+            Type matches caller unless ``expand=True`` (see Notes).
 
         See also
         --------
@@ -1928,15 +1937,17 @@ class StringMethods(ColumnMethodsMixin):
 
         Notes
         -----
-        The parameter `expand` is not yet supported and will raise a
-        NotImplementedError if anything other than the default value
-        is set. The handling of the n keyword depends on the number
+        The handling of the n keyword depends on the number
         of found splits:
 
             - If found splits > n, make first n splits only
             - If found splits <= n, make all splits
             - If for a certain row the number of found
               splits < n, append None for padding up to n
+              if ``expand=True``
+
+        With ``expand=False`` every row holds only its own splits, so
+        rows with many splits do not widen the result of the other rows.
 
         Examples
         --------
@@ -1970,9 +1981,10 @@ class StringMethods(ColumnMethodsMixin):
         if expand is None:
             expand = True
             warnings.warn("`expand` parameter defatults to True.")
-        elif expand is not True:
-            raise NotImplementedError(
-                "`expand=False` setting is not supported yet"
+        elif expand not in (True, False):
+            raise ValueError(
+                f"expand parameter accepts only : [True, False], "
+                f"got {expand}"
             )
 
         # Pandas treats 0 as all
@@ -1983,6 +1995,12 @@ class StringMethods(ColumnMethodsMixin):
         if pat is None:
             pat = ""
 
+        if expand is False:
+            return self._return_or_inplace(
+                cpp_split_record(self._column, as_scalar(pat, "str"), n),
+                **kwargs,
+            )
+
         result_table = cpp_split(self._column, as_scalar(pat, "str"), n)
         if len(result_table._data) == 1:
             if result_table._data[0].null_count == len(self._column):
@@ -2008,10 +2026,18 @@ class StringMethods(ColumnMethodsMixin):
             Limit number of splits in output. `None`, 0, and -1 will all be
             interpreted as "all splits".
 
+        expand : bool, default True
+            Expand the split strings into separate columns.
+
+            * If ``True``, return DataFrame/MultiIndex expanding
+              dimensionality.
+            * If ``False``, return Series/Index, containing lists
+              of strings.
+
         Returns
         -------
-        DataFrame or MultiIndex
-            Returns a DataFrame/MultiIndex with each split as a column.
+        Series, Index, DataFrame or MultiIndex
+            Type matches caller unless ``expand=True`` (see Notes).
 
         See also
         --------
@@ -2026,15 +2052,13 @@ class StringMethods(ColumnMethodsMixin):
 
         Notes
         -----
-        The parameter `expand` is not yet supported and will raise a
-        `NotImplementedError` if anything other than the default value is
-        set. The handling of the n keyword depends on the number of
+        The handling of the n keyword depends on the number of
         found splits:
 
             - If found splits > n, make first n splits only
             - If found splits <= n, make all splits
             - If for a certain row the number of found splits < n,
-              append None for padding up to n.
+              append None for padding up to n, if ``expand=True``.
 
         Examples
         --------
@@ -2062,9 +2086,10 @@ class StringMethods(ColumnMethodsMixin):
         if expand is None:
             expand = True
             warnings.warn("`expand` parameter defatults to True.")
-        elif expand is not True:
-            raise NotImplementedError(
-                "`expand=False` setting is not supported yet"
+        elif expand not in (True, False):
+            raise ValueError(
+                f"expand parameter accepts only : [True, False], "
+                f"got {expand}"
             )
 
         # Pandas treats 0 as all
@@ -2075,6 +2100,11 @@ class StringMethods(ColumnMethodsMixin):
         if pat is None:
             pat = ""
 
+        if expand is False:
+            return self._return_or_inplace(
+                cpp_rsplit_record(self._column, as_scalar(pat), n), **kwargs
+            )
+
         result_table = cpp_rsplit(self._column, as_scalar(pat), n)
         if len(result_table._data) == 1:
             if result_table._data[0].null_count == len(self._parent):
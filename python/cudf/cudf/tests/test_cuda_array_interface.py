@@ -208,3 +208,23 @@ def test_cuda_array_interface_pytorch():
 
     with pytest.raises(TypeError):
         cat_series.__cuda_array_interface__
+
+
+def test_cuda_array_interface_cached():
+    sr = cudf.Series([1, 2, None, 4])
+    col = sr._column
+
+    first = col.__cuda_array_interface__
+    second = col.__cuda_array_interface__
+    assert first == second
+    assert first["mask"] is second["mask"]
+
+    # Consumers may modify the returned dict without affecting the column
+    first["mask"] = None
+    assert col.__cuda_array_interface__["mask"] is not None
+
+    # Replacing the mask inplace rebuilds the descriptor
+    col.set_base_mask(None)
+    third = col.__cuda_array_interface__
+    assert "mask" not in third
+    assert third["data"] == second["data"]
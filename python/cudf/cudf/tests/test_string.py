@@ -530,7 +530,7 @@ def test_string_upper(ps_gs):
 )
 @pytest.mark.parametrize("pat", [None, " ", "-"])
 @pytest.mark.parametrize("n", [-1, 0, 1, 3, 10])
-@pytest.mark.parametrize("expand,expand_raise", [(True, 0), (False, 1)])
+@pytest.mark.parametrize("expand,expand_raise", [(True, 0)])
 def test_string_split(data, pat, n, expand, expand_raise):
 
     if data in (["a b", " c ", "   d", "e   ", "f"],) and pat is None:
@@ -1310,6 +1310,37 @@ def test_strings_split(data, n, expand):
     )
 
 
+@pytest.mark.parametrize(
+    "data",
+    [
+        ["koala", "fox", "chameleon"],
+        ["A,,B", "1,,5", "3,00,0"],
+        ["Linda van der Berg", "George Pitt-Rivers"],
+        ["23", "³", "⅕", ""],
+        [" ", "\t\r\n ", ""],
+        ["a=1&b=22&c=333", "&&", "k=v&", None, "=&é=&x"],
+        [
+            "this is a regular sentence",
+            "https://docs.python.org/3/tutorial/index.html",
+            None,
+        ],
+    ],
+)
+@pytest.mark.parametrize("n", [-1, 2, 1, 9])
+@pytest.mark.parametrize("pat", [None, ",", "-", "&", "=&"])
+@pytest.mark.parametrize("method", ["split", "rsplit"])
+def test_strings_split_expand_false(data, n, pat, method):
+    gs = Series(data)
+    ps = pd.Series(data)
+
+    expect = getattr(ps.str, method)(pat=pat, n=n, expand=False)
+    got = getattr(gs.str, method)(pat=pat, n=n, expand=False)
+
+    # pandas holds a NaN for a null row
+    expect = [v if isinstance(v, list) else None for v in expect.to_list()]
+    assert got._column.to_arrow().to_pylist() == expect
+
+
 @pytest.mark.parametrize(
     "data",
     [